@@ -132,6 +132,7 @@ let package = Package(
         "src/core/call/client_call.cc",
         "src/core/call/client_call.h",
         "src/core/call/custom_metadata.h",
+        "src/core/call/filter_fusion.h",
         "src/core/call/interception_chain.cc",
         "src/core/call/interception_chain.h",
         "src/core/call/message.cc",
@@ -318,10 +319,16 @@ let package = Package(
         "src/core/ext/filters/backend_metrics/backend_metric_filter.h",
         "src/core/ext/filters/backend_metrics/backend_metric_provider.h",
         "src/core/ext/filters/census/grpc_context.cc",
+        "src/core/ext/filters/channel_idle/goaway_pacer.cc",
+        "src/core/ext/filters/channel_idle/goaway_pacer.h",
         "src/core/ext/filters/channel_idle/idle_filter_state.cc",
         "src/core/ext/filters/channel_idle/idle_filter_state.h",
         "src/core/ext/filters/channel_idle/legacy_channel_idle_filter.cc",
+        "src/core/ext/filters/concurrency_limit/client_concurrency_limit_filter.cc",
+        "src/core/ext/filters/concurrency_limit/server_concurrency_limit_filter.cc",
         "src/core/ext/filters/channel_idle/legacy_channel_idle_filter.h",
+        "src/core/ext/filters/concurrency_limit/client_concurrency_limit_filter.h",
+        "src/core/ext/filters/concurrency_limit/server_concurrency_limit_filter.h",
         "src/core/ext/filters/fault_injection/fault_injection_filter.cc",
         "src/core/ext/filters/fault_injection/fault_injection_filter.h",
         "src/core/ext/filters/fault_injection/fault_injection_service_config_parser.cc",
@@ -1314,6 +1321,7 @@ let package = Package(
         "src/core/lib/event_engine/extensions/iomgr_compatible.h",
         "src/core/lib/event_engine/extensions/supports_fd.h",
         "src/core/lib/event_engine/extensions/supports_win_sockets.h",
+        "src/core/lib/event_engine/extensions/tcp_info.h",
         "src/core/lib/event_engine/extensions/tcp_trace.h",
         "src/core/lib/event_engine/forkable.cc",
         "src/core/lib/event_engine/forkable.h",
@@ -1324,7 +1332,9 @@ let package = Package(
         "src/core/lib/event_engine/poller.h",
         "src/core/lib/event_engine/posix.h",
         "src/core/lib/event_engine/posix_engine/ev_epoll1_linux.cc",
+        "src/core/lib/event_engine/posix_engine/ev_io_uring_linux.cc",
         "src/core/lib/event_engine/posix_engine/ev_epoll1_linux.h",
+        "src/core/lib/event_engine/posix_engine/ev_io_uring_linux.h",
         "src/core/lib/event_engine/posix_engine/ev_poll_posix.cc",
         "src/core/lib/event_engine/posix_engine/ev_poll_posix.h",
         "src/core/lib/event_engine/posix_engine/event_poller.h",
@@ -1345,7 +1355,9 @@ let package = Package(
         "src/core/lib/event_engine/posix_engine/posix_engine_listener.cc",
         "src/core/lib/event_engine/posix_engine/posix_engine_listener.h",
         "src/core/lib/event_engine/posix_engine/posix_engine_listener_utils.cc",
+        "src/core/lib/event_engine/posix_engine/read_buffer_pool.cc",
         "src/core/lib/event_engine/posix_engine/posix_engine_listener_utils.h",
+        "src/core/lib/event_engine/posix_engine/read_buffer_pool.h",
         "src/core/lib/event_engine/posix_engine/set_socket_dualstack.cc",
         "src/core/lib/event_engine/posix_engine/tcp_socket_utils.cc",
         "src/core/lib/event_engine/posix_engine/tcp_socket_utils.h",
@@ -1355,6 +1367,8 @@ let package = Package(
         "src/core/lib/event_engine/posix_engine/timer_heap.h",
         "src/core/lib/event_engine/posix_engine/timer_manager.cc",
         "src/core/lib/event_engine/posix_engine/timer_manager.h",
+        "src/core/lib/event_engine/posix_engine/timer_wheel.cc",
+        "src/core/lib/event_engine/posix_engine/timer_wheel.h",
         "src/core/lib/event_engine/posix_engine/traced_buffer_list.cc",
         "src/core/lib/event_engine/posix_engine/traced_buffer_list.h",
         "src/core/lib/event_engine/posix_engine/wakeup_fd_eventfd.cc",
@@ -1579,7 +1593,9 @@ let package = Package(
         "src/core/lib/resource_quota/arena.cc",
         "src/core/lib/resource_quota/arena.h",
         "src/core/lib/resource_quota/connection_quota.cc",
+        "src/core/lib/resource_quota/cpu_quota.cc",
         "src/core/lib/resource_quota/connection_quota.h",
+        "src/core/lib/resource_quota/cpu_quota.h",
         "src/core/lib/resource_quota/memory_quota.cc",
         "src/core/lib/resource_quota/memory_quota.h",
         "src/core/lib/resource_quota/periodic_update.cc",
@@ -1642,6 +1658,8 @@ let package = Package(
         "src/core/lib/surface/completion_queue_factory.h",
         "src/core/lib/surface/connection_context.cc",
         "src/core/lib/surface/connection_context.h",
+        "src/core/lib/surface/deadline_sweeper.cc",
+        "src/core/lib/surface/deadline_sweeper.h",
         "src/core/lib/surface/event_string.cc",
         "src/core/lib/surface/event_string.h",
         "src/core/lib/surface/filter_stack_call.cc",
@@ -1703,11 +1721,13 @@ let package = Package(
         "src/core/load_balancing/lb_policy_factory.h",
         "src/core/load_balancing/lb_policy_registry.cc",
         "src/core/load_balancing/lb_policy_registry.h",
+        "src/core/load_balancing/least_request/least_request.cc",
         "src/core/load_balancing/oob_backend_metric.cc",
         "src/core/load_balancing/oob_backend_metric.h",
         "src/core/load_balancing/oob_backend_metric_internal.h",
         "src/core/load_balancing/outlier_detection/outlier_detection.cc",
         "src/core/load_balancing/outlier_detection/outlier_detection.h",
+        "src/core/load_balancing/peak_ewma/peak_ewma.cc",
         "src/core/load_balancing/pick_first/pick_first.cc",
         "src/core/load_balancing/pick_first/pick_first.h",
         "src/core/load_balancing/priority/priority.cc",
@@ -1742,6 +1762,8 @@ let package = Package(
         "src/core/resolver/dns/c_ares/grpc_ares_wrapper_windows.cc",
         "src/core/resolver/dns/dns_resolver_plugin.cc",
         "src/core/resolver/dns/dns_resolver_plugin.h",
+        "src/core/resolver/dns/event_engine/dns_cache.cc",
+        "src/core/resolver/dns/event_engine/dns_cache.h",
         "src/core/resolver/dns/event_engine/event_engine_client_channel_resolver.cc",
         "src/core/resolver/dns/event_engine/event_engine_client_channel_resolver.h",
         "src/core/resolver/dns/event_engine/service_config_helper.cc",
@@ -1779,6 +1801,8 @@ let package = Package(
         "src/core/server/server_interface.h",
         "src/core/server/xds_channel_stack_modifier.cc",
         "src/core/server/xds_channel_stack_modifier.h",
+        "src/core/server/xds_filter_chain_match_table.cc",
+        "src/core/server/xds_filter_chain_match_table.h",
         "src/core/server/xds_server_config_fetcher.cc",
         "src/core/service_config/service_config.h",
         "src/core/service_config/service_config_call_data.h",
@@ -1822,6 +1846,8 @@ let package = Package(
         "src/core/tsi/alts/frame_protector/alts_unseal_privacy_integrity_crypter.cc",
         "src/core/tsi/alts/frame_protector/frame_handler.cc",
         "src/core/tsi/alts/frame_protector/frame_handler.h",
+        "src/core/tsi/alts/handshaker/alts_handshaker_channel_pool.cc",
+        "src/core/tsi/alts/handshaker/alts_handshaker_channel_pool.h",
         "src/core/tsi/alts/handshaker/alts_handshaker_client.cc",
         "src/core/tsi/alts/handshaker/alts_handshaker_client.h",
         "src/core/tsi/alts/handshaker/alts_shared_resource.cc",
@@ -1855,6 +1881,10 @@ let package = Package(
         "src/core/tsi/ssl/session_cache/ssl_session_cache.cc",
         "src/core/tsi/ssl/session_cache/ssl_session_cache.h",
         "src/core/tsi/ssl/session_cache/ssl_session_openssl.cc",
+        "src/core/tsi/ssl/session_ticket/ssl_session_ticket_keys.cc",
+        "src/core/tsi/ssl/session_ticket/ssl_session_ticket_keys.h",
+        "src/core/tsi/ssl/verified_chain_cache/ssl_verified_chain_cache.cc",
+        "src/core/tsi/ssl/verified_chain_cache/ssl_verified_chain_cache.h",
         "src/core/tsi/ssl_transport_security.cc",
         "src/core/tsi/ssl_transport_security.h",
         "src/core/tsi/ssl_transport_security_utils.cc",
@@ -1872,8 +1902,13 @@ let package = Package(
         "src/core/util/backoff.cc",
         "src/core/util/backoff.h",
         "src/core/util/bitset.h",
+        "src/core/util/byte_scan.h",
         "src/core/util/check_class_size.h",
         "src/core/util/chunked_vector.h",
+        "src/core/util/codel.cc",
+        "src/core/util/codel.h",
+        "src/core/util/concurrent_tdigest.cc",
+        "src/core/util/concurrent_tdigest.h",
         "src/core/util/construct_destruct.h",
         "src/core/util/cpp_impl_of.h",
         "src/core/util/crash.cc",
@@ -1914,6 +1949,8 @@ let package = Package(
         "src/core/util/http_client/httpcli_ssl_credentials.h",
         "src/core/util/http_client/parser.cc",
         "src/core/util/http_client/parser.h",
+        "src/core/util/huge_page_allocator.cc",
+        "src/core/util/huge_page_allocator.h",
         "src/core/util/if_list.h",
         "src/core/util/iphone/cpu.cc",
         "src/core/util/json/json.h",
@@ -1946,6 +1983,8 @@ let package = Package(
         "src/core/util/msys/tmpfile.cc",
         "src/core/util/no_destruct.h",
         "src/core/util/notification.h",
+        "src/core/util/numa.cc",
+        "src/core/util/numa.h",
         "src/core/util/orphanable.h",
         "src/core/util/overload.h",
         "src/core/util/packed_table.h",
@@ -1985,6 +2024,8 @@ let package = Package(
         "src/core/util/table.h",
         "src/core/util/tchar.cc",
         "src/core/util/tchar.h",
+        "src/core/util/tdigest.cc",
+        "src/core/util/tdigest.h",
         "src/core/util/thd.h",
         "src/core/util/time.cc",
         "src/core/util/time.h",
@@ -17,44 +17,76 @@
 """Dictionary of tags to experiments so we know when to test different experiments."""
 
 EXPERIMENT_ENABLES = {
+    "alts_handshaker_channel_pool": "alts_handshaker_channel_pool",
+    "bdp_estimate_from_tcp_info": "bdp_estimate_from_tcp_info",
+    "call_arena_recycling": "call_arena_recycling",
     "call_tracer_in_transport": "call_tracer_in_transport",
     "callv3_client_auth_filter": "callv3_client_auth_filter",
+    "chaotic_good_adaptive_data_endpoints": "chaotic_good_adaptive_data_endpoints",
     "chaotic_good_framing_layer": "chaotic_good_framing_layer",
+    "chaotic_good_shared_memory": "chaotic_good_shared_memory",
     "chttp2_bound_write_size": "chttp2_bound_write_size",
+    "chttp2_coalesce_small_write_slices": "chttp2_coalesce_small_write_slices",
+    "chttp2_weighted_write_scheduling": "chttp2_weighted_write_scheduling",
     "error_flatten": "error_flatten",
+    "event_engine_adaptive_spinning": "event_engine_adaptive_spinning",
     "event_engine_client": "event_engine_client",
     "event_engine_dns": "event_engine_dns",
     "event_engine_dns_non_client_channel": "event_engine_dns_non_client_channel",
     "event_engine_fork": "event_engine_fork",
+    "event_engine_hot_spinners": "event_engine_hot_spinners",
     "event_engine_listener": "event_engine_listener",
     "event_engine_callback_cq": "event_engine_callback_cq,event_engine_client,event_engine_listener",
     "event_engine_for_all_other_endpoints": "event_engine_client,event_engine_dns,event_engine_dns_non_client_channel,event_engine_for_all_other_endpoints,event_engine_listener",
+    "event_engine_numa_aware_stealing": "event_engine_numa_aware_stealing",
     "event_engine_secure_endpoint": "event_engine_secure_endpoint",
+    "event_engine_timer_wheel": "event_engine_timer_wheel",
+    "event_engine_worker_affinity": "event_engine_worker_affinity",
     "free_large_allocator": "free_large_allocator",
+    "fused_filter_stacks": "fused_filter_stacks",
+    "hpack_encoder_prefix_cache": "hpack_encoder_prefix_cache",
+    "hpack_shared_values": "hpack_shared_values",
+    "huge_page_slab_allocator": "huge_page_slab_allocator",
     "keep_alive_ping_timer_batch": "keep_alive_ping_timer_batch",
+    "lazy_deadline_timers": "lazy_deadline_timers",
     "local_connector_secure": "local_connector_secure",
+    "lock_free_work_serializer": "lock_free_work_serializer",
     "max_inflight_pings_strict_limit": "max_inflight_pings_strict_limit",
     "max_pings_wo_data_throttle": "max_pings_wo_data_throttle",
     "monitoring_experiment": "monitoring_experiment",
     "multiping": "multiping",
+    "party_arena_participants": "party_arena_participants",
+    "per_cpu_memory_quota": "per_cpu_memory_quota",
     "pollset_alternative": "event_engine_client,event_engine_listener,pollset_alternative",
     "posix_ee_skip_grpc_init": "posix_ee_skip_grpc_init",
     "promise_based_http2_client_transport": "promise_based_http2_client_transport",
     "promise_based_http2_server_transport": "promise_based_http2_server_transport",
     "promise_based_inproc_transport": "promise_based_inproc_transport",
     "retry_in_callv3": "retry_in_callv3",
+    "rls_lock_free_picks": "rls_lock_free_picks",
     "rq_fast_reject": "rq_fast_reject",
     "rst_stream_fix": "rst_stream_fix",
     "schedule_cancellation_over_write": "schedule_cancellation_over_write",
     "secure_endpoint_offload_large_reads": "event_engine_client,event_engine_listener,event_engine_secure_endpoint,secure_endpoint_offload_large_reads",
     "secure_endpoint_offload_large_writes": "event_engine_client,event_engine_listener,event_engine_secure_endpoint,secure_endpoint_offload_large_writes",
+    "security_handshake_offload": "security_handshake_offload",
     "server_global_callbacks_ownership": "server_global_callbacks_ownership",
     "shard_global_connection_pool": "shard_global_connection_pool",
+    "sharded_lb_picker": "sharded_lb_picker",
+    "shared_service_configs": "shared_service_configs",
     "sleep_promise_exec_ctx_removal": "sleep_promise_exec_ctx_removal",
+    "small_slice_inlining": "small_slice_inlining",
     "tcp_frame_size_tuning": "tcp_frame_size_tuning",
     "tcp_rcv_lowat": "tcp_rcv_lowat",
+    "tcp_read_buffer_pool": "tcp_read_buffer_pool",
+    "tcp_tx_zerocopy_adaptive": "tcp_tx_zerocopy_adaptive",
+    "tls_verified_chain_cache": "tls_verified_chain_cache",
+    "token_fetcher_proactive_refresh": "token_fetcher_proactive_refresh",
+    "token_fetcher_shared_cache": "token_fetcher_shared_cache",
     "tsi_frame_protector_without_locks": "tsi_frame_protector_without_locks",
     "unconstrained_max_quota_buffer_size": "unconstrained_max_quota_buffer_size",
+    "xds_skip_unchanged_resources": "xds_skip_unchanged_resources",
+    "zlib_stream_reuse": "zlib_stream_reuse",
 }
 
 EXPERIMENT_POLLERS = [
@@ -72,44 +104,112 @@ EXPERIMENTS = {
         "dbg": {
         },
         "off": {
+            "alts_test": [
+                "alts_handshaker_channel_pool",
+            ],
+            "channel_init_test": [
+                "fused_filter_stacks",
+            ],
+            "compression_test": [
+                "zlib_stream_reuse",
+            ],
             "core_end2end_test": [
                 "callv3_client_auth_filter",
+                "chaotic_good_shared_memory",
                 "chttp2_bound_write_size",
+                "chttp2_coalesce_small_write_slices",
+                "chttp2_weighted_write_scheduling",
                 "error_flatten",
                 "event_engine_fork",
+                "event_engine_timer_wheel",
+                "fused_filter_stacks",
+                "lazy_deadline_timers",
                 "local_connector_secure",
+                "lock_free_work_serializer",
+                "party_arena_participants",
                 "pollset_alternative",
                 "retry_in_callv3",
                 "secure_endpoint_offload_large_reads",
                 "secure_endpoint_offload_large_writes",
+                "security_handshake_offload",
+                "sharded_lb_picker",
+                "small_slice_inlining",
+                "tls_verified_chain_cache",
             ],
             "cpp_end2end_test": [
                 "error_flatten",
+                "rls_lock_free_picks",
             ],
             "endpoint_test": [
                 "tcp_frame_size_tuning",
                 "tcp_rcv_lowat",
+                "tcp_read_buffer_pool",
+                "tcp_tx_zerocopy_adaptive",
             ],
             "error_tests": [
                 "error_flatten",
             ],
+            "event_engine_client_test": [
+                "event_engine_adaptive_spinning",
+                "event_engine_hot_spinners",
+                "event_engine_numa_aware_stealing",
+                "event_engine_timer_wheel",
+                "event_engine_worker_affinity",
+            ],
             "event_engine_fork_test": [
                 "event_engine_fork",
             ],
+            "event_engine_listener_test": [
+                "event_engine_adaptive_spinning",
+                "event_engine_hot_spinners",
+                "event_engine_numa_aware_stealing",
+                "event_engine_worker_affinity",
+            ],
             "flow_control_test": [
+                "bdp_estimate_from_tcp_info",
                 "multiping",
                 "tcp_frame_size_tuning",
                 "tcp_rcv_lowat",
             ],
+            "hpack_test": [
+                "hpack_encoder_prefix_cache",
+                "hpack_shared_values",
+            ],
+            "message_compress_test": [
+                "zlib_stream_reuse",
+            ],
             "promise_test": [
+                "party_arena_participants",
                 "sleep_promise_exec_ctx_removal",
             ],
             "resource_quota_test": [
+                "call_arena_recycling",
                 "free_large_allocator",
+                "huge_page_slab_allocator",
+                "per_cpu_memory_quota",
                 "unconstrained_max_quota_buffer_size",
             ],
+            "service_config_test": [
+                "shared_service_configs",
+            ],
+            "slice_test": [
+                "small_slice_inlining",
+            ],
+            "thread_pool_test": [
+                "event_engine_worker_affinity",
+            ],
+            "tsi_test": [
+                "tls_verified_chain_cache",
+            ],
+            "work_serializer_test": [
+                "lock_free_work_serializer",
+            ],
+            "xds_client_test": [
+                "xds_skip_unchanged_resources",
+            ],
             "xds_end2end_test": [
                 "error_flatten",
+                "xds_skip_unchanged_resources",
             ],
         },
         "on": {
@@ -147,44 +247,112 @@ EXPERIMENTS = {
         "dbg": {
         },
         "off": {
+            "alts_test": [
+                "alts_handshaker_channel_pool",
+            ],
+            "channel_init_test": [
+                "fused_filter_stacks",
+            ],
+            "compression_test": [
+                "zlib_stream_reuse",
+            ],
             "core_end2end_test": [
                 "callv3_client_auth_filter",
+                "chaotic_good_shared_memory",
                 "chttp2_bound_write_size",
+                "chttp2_coalesce_small_write_slices",
+                "chttp2_weighted_write_scheduling",
                 "error_flatten",
                 "event_engine_fork",
+                "event_engine_timer_wheel",
+                "fused_filter_stacks",
+                "lazy_deadline_timers",
                 "local_connector_secure",
+                "lock_free_work_serializer",
+                "party_arena_participants",
                 "pollset_alternative",
                 "retry_in_callv3",
                 "secure_endpoint_offload_large_reads",
                 "secure_endpoint_offload_large_writes",
+                "security_handshake_offload",
+                "sharded_lb_picker",
+                "small_slice_inlining",
+                "tls_verified_chain_cache",
             ],
             "cpp_end2end_test": [
                 "error_flatten",
+                "rls_lock_free_picks",
             ],
             "endpoint_test": [
                 "tcp_frame_size_tuning",
                 "tcp_rcv_lowat",
+                "tcp_read_buffer_pool",
+                "tcp_tx_zerocopy_adaptive",
             ],
             "error_tests": [
                 "error_flatten",
             ],
+            "event_engine_client_test": [
+                "event_engine_adaptive_spinning",
+                "event_engine_hot_spinners",
+                "event_engine_numa_aware_stealing",
+                "event_engine_timer_wheel",
+                "event_engine_worker_affinity",
+            ],
             "event_engine_fork_test": [
                 "event_engine_fork",
             ],
+            "event_engine_listener_test": [
+                "event_engine_adaptive_spinning",
+                "event_engine_hot_spinners",
+                "event_engine_numa_aware_stealing",
+                "event_engine_worker_affinity",
+            ],
             "flow_control_test": [
+                "bdp_estimate_from_tcp_info",
                 "multiping",
                 "tcp_frame_size_tuning",
                 "tcp_rcv_lowat",
             ],
+            "hpack_test": [
+                "hpack_encoder_prefix_cache",
+                "hpack_shared_values",
+            ],
+            "message_compress_test": [
+                "zlib_stream_reuse",
+            ],
             "promise_test": [
+                "party_arena_participants",
                 "sleep_promise_exec_ctx_removal",
             ],
             "resource_quota_test": [
+                "call_arena_recycling",
                 "free_large_allocator",
+                "huge_page_slab_allocator",
+                "per_cpu_memory_quota",
                 "unconstrained_max_quota_buffer_size",
             ],
+            "service_config_test": [
+                "shared_service_configs",
+            ],
+            "slice_test": [
+                "small_slice_inlining",
+            ],
+            "thread_pool_test": [
+                "event_engine_worker_affinity",
+            ],
+            "tsi_test": [
+                "tls_verified_chain_cache",
+            ],
+            "work_serializer_test": [
+                "lock_free_work_serializer",
+            ],
+            "xds_client_test": [
+                "xds_skip_unchanged_resources",
+            ],
             "xds_end2end_test": [
                 "error_flatten",
+                "xds_skip_unchanged_resources",
             ],
         },
         "on": {
@@ -222,44 +390,112 @@ EXPERIMENTS = {
         "dbg": {
         },
         "off": {
+            "alts_test": [
+                "alts_handshaker_channel_pool",
+            ],
+            "channel_init_test": [
+                "fused_filter_stacks",
+            ],
+            "compression_test": [
+                "zlib_stream_reuse",
+            ],
             "core_end2end_test": [
                 "callv3_client_auth_filter",
+                "chaotic_good_shared_memory",
                 "chttp2_bound_write_size",
+                "chttp2_coalesce_small_write_slices",
+                "chttp2_weighted_write_scheduling",
                 "error_flatten",
                 "event_engine_fork",
+                "event_engine_timer_wheel",
+                "fused_filter_stacks",
+                "lazy_deadline_timers",
                 "local_connector_secure",
+                "lock_free_work_serializer",
+                "party_arena_participants",
                 "pollset_alternative",
                 "retry_in_callv3",
                 "secure_endpoint_offload_large_reads",
                 "secure_endpoint_offload_large_writes",
+                "security_handshake_offload",
+                "sharded_lb_picker",
+                "small_slice_inlining",
+                "tls_verified_chain_cache",
             ],
             "cpp_end2end_test": [
                 "error_flatten",
+                "rls_lock_free_picks",
             ],
             "endpoint_test": [
                 "tcp_frame_size_tuning",
                 "tcp_rcv_lowat",
+                "tcp_read_buffer_pool",
+                "tcp_tx_zerocopy_adaptive",
             ],
             "error_tests": [
                 "error_flatten",
             ],
+            "event_engine_client_test": [
+                "event_engine_adaptive_spinning",
+                "event_engine_hot_spinners",
+                "event_engine_numa_aware_stealing",
+                "event_engine_timer_wheel",
+                "event_engine_worker_affinity",
+            ],
             "event_engine_fork_test": [
                 "event_engine_fork",
             ],
+            "event_engine_listener_test": [
+                "event_engine_adaptive_spinning",
+                "event_engine_hot_spinners",
+                "event_engine_numa_aware_stealing",
+                "event_engine_worker_affinity",
+            ],
             "flow_control_test": [
+                "bdp_estimate_from_tcp_info",
                 "multiping",
                 "tcp_frame_size_tuning",
                 "tcp_rcv_lowat",
             ],
+            "hpack_test": [
+                "hpack_encoder_prefix_cache",
+                "hpack_shared_values",
+            ],
+            "message_compress_test": [
+                "zlib_stream_reuse",
+            ],
             "promise_test": [
+                "party_arena_participants",
                 "sleep_promise_exec_ctx_removal",
             ],
             "resource_quota_test": [
+                "call_arena_recycling",
                 "free_large_allocator",
+                "huge_page_slab_allocator",
+                "per_cpu_memory_quota",
                 "unconstrained_max_quota_buffer_size",
             ],
+            "service_config_test": [
+                "shared_service_configs",
+            ],
+            "slice_test": [
+                "small_slice_inlining",
+            ],
+            "thread_pool_test": [
+                "event_engine_worker_affinity",
+            ],
+            "tsi_test": [
+                "tls_verified_chain_cache",
+            ],
+            "work_serializer_test": [
+                "lock_free_work_serializer",
+            ],
+            "xds_client_test": [
+                "xds_skip_unchanged_resources",
+            ],
             "xds_end2end_test": [
                 "error_flatten",
+                "xds_skip_unchanged_resources",
             ],
         },
         "on": {
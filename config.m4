@@ -138,8 +138,11 @@ if test "$PHP_GRPC" != "no"; then
     src/core/credentials/transport/xds/xds_credentials.cc \
     src/core/ext/filters/backend_metrics/backend_metric_filter.cc \
     src/core/ext/filters/census/grpc_context.cc \
+    src/core/ext/filters/channel_idle/goaway_pacer.cc \
     src/core/ext/filters/channel_idle/idle_filter_state.cc \
     src/core/ext/filters/channel_idle/legacy_channel_idle_filter.cc \
+    src/core/ext/filters/concurrency_limit/client_concurrency_limit_filter.cc \
+    src/core/ext/filters/concurrency_limit/server_concurrency_limit_filter.cc \
     src/core/ext/filters/fault_injection/fault_injection_filter.cc \
     src/core/ext/filters/fault_injection/fault_injection_service_config_parser.cc \
     src/core/ext/filters/gcp_authentication/gcp_authentication_filter.cc \
@@ -548,6 +551,7 @@ if test "$PHP_GRPC" != "no"; then
     src/core/lib/event_engine/event_engine.cc \
     src/core/lib/event_engine/forkable.cc \
     src/core/lib/event_engine/posix_engine/ev_epoll1_linux.cc \
+    src/core/lib/event_engine/posix_engine/ev_io_uring_linux.cc \
     src/core/lib/event_engine/posix_engine/ev_poll_posix.cc \
     src/core/lib/event_engine/posix_engine/event_poller_posix_default.cc \
     src/core/lib/event_engine/posix_engine/internal_errqueue.cc \
@@ -557,11 +561,13 @@ if test "$PHP_GRPC" != "no"; then
     src/core/lib/event_engine/posix_engine/posix_engine.cc \
     src/core/lib/event_engine/posix_engine/posix_engine_listener.cc \
     src/core/lib/event_engine/posix_engine/posix_engine_listener_utils.cc \
+    src/core/lib/event_engine/posix_engine/read_buffer_pool.cc \
     src/core/lib/event_engine/posix_engine/set_socket_dualstack.cc \
     src/core/lib/event_engine/posix_engine/tcp_socket_utils.cc \
     src/core/lib/event_engine/posix_engine/timer.cc \
     src/core/lib/event_engine/posix_engine/timer_heap.cc \
     src/core/lib/event_engine/posix_engine/timer_manager.cc \
+    src/core/lib/event_engine/posix_engine/timer_wheel.cc \
     src/core/lib/event_engine/posix_engine/traced_buffer_list.cc \
     src/core/lib/event_engine/posix_engine/wakeup_fd_eventfd.cc \
     src/core/lib/event_engine/posix_engine/wakeup_fd_pipe.cc \
@@ -664,6 +670,7 @@ if test "$PHP_GRPC" != "no"; then
     src/core/lib/resource_quota/api.cc \
     src/core/lib/resource_quota/arena.cc \
     src/core/lib/resource_quota/connection_quota.cc \
+    src/core/lib/resource_quota/cpu_quota.cc \
     src/core/lib/resource_quota/memory_quota.cc \
     src/core/lib/resource_quota/periodic_update.cc \
     src/core/lib/resource_quota/resource_quota.cc \
@@ -693,6 +700,7 @@ if test "$PHP_GRPC" != "no"; then
     src/core/lib/surface/completion_queue.cc \
     src/core/lib/surface/completion_queue_factory.cc \
     src/core/lib/surface/connection_context.cc \
+    src/core/lib/surface/deadline_sweeper.cc \
     src/core/lib/surface/event_string.cc \
     src/core/lib/surface/filter_stack_call.cc \
     src/core/lib/surface/init.cc \
@@ -722,8 +730,10 @@ if test "$PHP_GRPC" != "no"; then
     src/core/load_balancing/health_check_client.cc \
     src/core/load_balancing/lb_policy.cc \
     src/core/load_balancing/lb_policy_registry.cc \
+    src/core/load_balancing/least_request/least_request.cc \
     src/core/load_balancing/oob_backend_metric.cc \
     src/core/load_balancing/outlier_detection/outlier_detection.cc \
+    src/core/load_balancing/peak_ewma/peak_ewma.cc \
     src/core/load_balancing/pick_first/pick_first.cc \
     src/core/load_balancing/priority/priority.cc \
     src/core/load_balancing/ring_hash/ring_hash.cc \
@@ -746,6 +756,7 @@ if test "$PHP_GRPC" != "no"; then
     src/core/resolver/dns/c_ares/grpc_ares_wrapper_posix.cc \
     src/core/resolver/dns/c_ares/grpc_ares_wrapper_windows.cc \
     src/core/resolver/dns/dns_resolver_plugin.cc \
+    src/core/resolver/dns/event_engine/dns_cache.cc \
     src/core/resolver/dns/event_engine/event_engine_client_channel_resolver.cc \
     src/core/resolver/dns/event_engine/service_config_helper.cc \
     src/core/resolver/dns/native/dns_resolver.cc \
@@ -764,6 +775,7 @@ if test "$PHP_GRPC" != "no"; then
     src/core/server/server_call_tracer_filter.cc \
     src/core/server/server_config_selector_filter.cc \
     src/core/server/xds_channel_stack_modifier.cc \
+    src/core/server/xds_filter_chain_match_table.cc \
     src/core/server/xds_server_config_fetcher.cc \
     src/core/service_config/service_config_channel_arg_filter.cc \
     src/core/service_config/service_config_impl.cc \
@@ -786,6 +798,7 @@ if test "$PHP_GRPC" != "no"; then
     src/core/tsi/alts/frame_protector/alts_seal_privacy_integrity_crypter.cc \
     src/core/tsi/alts/frame_protector/alts_unseal_privacy_integrity_crypter.cc \
     src/core/tsi/alts/frame_protector/frame_handler.cc \
+    src/core/tsi/alts/handshaker/alts_handshaker_channel_pool.cc \
     src/core/tsi/alts/handshaker/alts_handshaker_client.cc \
     src/core/tsi/alts/handshaker/alts_shared_resource.cc \
     src/core/tsi/alts/handshaker/alts_tsi_handshaker.cc \
@@ -802,12 +815,16 @@ if test "$PHP_GRPC" != "no"; then
     src/core/tsi/ssl/session_cache/ssl_session_boringssl.cc \
     src/core/tsi/ssl/session_cache/ssl_session_cache.cc \
     src/core/tsi/ssl/session_cache/ssl_session_openssl.cc \
+    src/core/tsi/ssl/session_ticket/ssl_session_ticket_keys.cc \
+    src/core/tsi/ssl/verified_chain_cache/ssl_verified_chain_cache.cc \
     src/core/tsi/ssl_transport_security.cc \
     src/core/tsi/ssl_transport_security_utils.cc \
     src/core/tsi/transport_security.cc \
     src/core/tsi/transport_security_grpc.cc \
     src/core/util/alloc.cc \
     src/core/util/backoff.cc \
+    src/core/util/codel.cc \
+    src/core/util/concurrent_tdigest.cc \
     src/core/util/crash.cc \
     src/core/util/dump_args.cc \
     src/core/util/event_log.cc \
@@ -826,6 +843,7 @@ if test "$PHP_GRPC" != "no"; then
     src/core/util/http_client/httpcli.cc \
     src/core/util/http_client/httpcli_security_connector.cc \
     src/core/util/http_client/parser.cc \
+    src/core/util/huge_page_allocator.cc \
     src/core/util/iphone/cpu.cc \
     src/core/util/json/json_object_loader.cc \
     src/core/util/json/json_reader.cc \
@@ -839,6 +857,7 @@ if test "$PHP_GRPC" != "no"; then
     src/core/util/matchers.cc \
     src/core/util/mpscq.cc \
     src/core/util/msys/tmpfile.cc \
+    src/core/util/numa.cc \
     src/core/util/per_cpu.cc \
     src/core/util/posix/cpu.cc \
     src/core/util/posix/directory_reader.cc \
@@ -858,6 +877,7 @@ if test "$PHP_GRPC" != "no"; then
     src/core/util/sync.cc \
     src/core/util/sync_abseil.cc \
     src/core/util/tchar.cc \
+    src/core/util/tdigest.cc \
     src/core/util/time.cc \
     src/core/util/time_averaged_stats.cc \
     src/core/util/time_precise.cc \
@@ -1457,6 +1477,7 @@ if test "$PHP_GRPC" != "no"; then
   PHP_ADD_BUILD_DIR($ext_builddir/src/core/ext/filters/backend_metrics)
   PHP_ADD_BUILD_DIR($ext_builddir/src/core/ext/filters/census)
   PHP_ADD_BUILD_DIR($ext_builddir/src/core/ext/filters/channel_idle)
+  PHP_ADD_BUILD_DIR($ext_builddir/src/core/ext/filters/concurrency_limit)
   PHP_ADD_BUILD_DIR($ext_builddir/src/core/ext/filters/fault_injection)
   PHP_ADD_BUILD_DIR($ext_builddir/src/core/ext/filters/gcp_authentication)
   PHP_ADD_BUILD_DIR($ext_builddir/src/core/ext/filters/http)
@@ -1605,7 +1626,9 @@ if test "$PHP_GRPC" != "no"; then
   PHP_ADD_BUILD_DIR($ext_builddir/src/core/lib/transport)
   PHP_ADD_BUILD_DIR($ext_builddir/src/core/load_balancing)
   PHP_ADD_BUILD_DIR($ext_builddir/src/core/load_balancing/grpclb)
+  PHP_ADD_BUILD_DIR($ext_builddir/src/core/load_balancing/least_request)
   PHP_ADD_BUILD_DIR($ext_builddir/src/core/load_balancing/outlier_detection)
+  PHP_ADD_BUILD_DIR($ext_builddir/src/core/load_balancing/peak_ewma)
   PHP_ADD_BUILD_DIR($ext_builddir/src/core/load_balancing/pick_first)
   PHP_ADD_BUILD_DIR($ext_builddir/src/core/load_balancing/priority)
   PHP_ADD_BUILD_DIR($ext_builddir/src/core/load_balancing/ring_hash)
@@ -1214,6 +1214,22 @@ GRPCAPI void grpc_tls_credentials_options_set_check_call_host(
 GRPCAPI void grpc_tls_credentials_options_set_tls_session_key_log_file_path(
     grpc_tls_credentials_options* options, const char* path);
 
+/**
+ * EXPERIMENTAL API - Subject to change.
+ * Configures a grpc_tls_credentials_options object used by a TLS server to
+ * encrypt and decrypt session tickets with the keys in the file at path. The
+ * file holds one or more 80 byte keys back to back, each made of a 16 byte key
+ * name, a 32 byte HMAC secret and a 32 byte AES key, as used by Envoy and
+ * nginx. New tickets are encrypted with the first key, and tickets encrypted
+ * with any of the keys are accepted. The file is read again every minute, so
+ * keys can be rotated without restarting the server. Servers sharing the file
+ * can resume each other's TLS sessions.
+ * - options is the grpc_tls_credentials_options object
+ * - path is the location of the session ticket key file.
+ */
+GRPCAPI void grpc_tls_credentials_options_set_tls_session_ticket_key_file_path(
+    grpc_tls_credentials_options* options, const char* path);
+
 #ifdef __cplusplus
 }
 #endif
@@ -122,6 +122,20 @@ GRPCAPI grpc_event grpc_completion_queue_next(grpc_completion_queue* cq,
                                               gpr_timespec deadline,
                                               void* reserved);
 
+/** EXPERIMENTAL. Like grpc_completion_queue_next, but once an event is
+    available also takes up to max_events - 1 further events that are already
+    queued, without blocking for them. The events are written to events, which
+    must have room for max_events entries, and their count is returned.
+
+    Either every returned event has type GRPC_OP_COMPLETE, or a single event of
+    type GRPC_QUEUE_TIMEOUT or GRPC_QUEUE_SHUTDOWN is returned.
+
+    Only valid for completion queues of type GRPC_CQ_NEXT. */
+GRPCAPI int grpc_completion_queue_next_batch(grpc_completion_queue* cq,
+                                             grpc_event* events, int max_events,
+                                             gpr_timespec deadline,
+                                             void* reserved);
+
 /** Blocks until an event with tag 'tag' is available, the completion queue is
     being shutdown or deadline is reached.
 
@@ -529,6 +543,13 @@ GRPCAPI void grpc_resource_quota_resize(grpc_resource_quota* resource_quota,
 GRPCAPI void grpc_resource_quota_set_max_threads(
     grpc_resource_quota* resource_quota, int new_max_threads);
 
+/** EXPERIMENTAL.  Update the CPU budget, in cores, of the process using this
+ * quota. While the process uses more CPU than this, servers using the quota
+ * reject calls that would otherwise queue, rather than queue them. A budget of
+ * zero or less is unlimited, which is the default. */
+GRPCAPI void grpc_resource_quota_set_max_cpu(
+    grpc_resource_quota* resource_quota, double max_cores);
+
 /** EXPERIMENTAL.  Dumps xDS configs as a serialized ClientConfig proto.
     The full name of the proto is envoy.service.status.v3.ClientConfig. */
 GRPCAPI grpc_slice grpc_dump_xds_configs(void);
@@ -30,6 +30,29 @@
 /** If non-zero, call metric recording is enabled. */
 #define GRPC_ARG_SERVER_CALL_METRIC_RECORDING \
   "grpc.server_call_metric_recording"
+/** If non-zero, and call metric recording is enabled, the server adds the
+    median and 99th percentile latency (in seconds) of the calls that finished
+    on each connection over the last second to the per-call load reports on
+    that connection, as the grpc.server.call.latency_p50 and
+    grpc.server.call.latency_p99 named metrics. */
+#define GRPC_ARG_SERVER_CALL_LATENCY_METRICS \
+  "grpc.experimental.server_call_latency_metrics"
+/** If non-zero, the C++ callback API runs a server's reactions on the
+ * EventEngine thread that completed the operation, once that thread finishes
+ * its current work, instead of handing them to another EventEngine thread.
+ * Reactions must then never block. Boolean valued, defaults to false. */
+#define GRPC_ARG_SERVER_INLINE_CALLBACKS \
+  "grpc.experimental.server_inline_callbacks"
+/** If positive, the C++ sync server's polling threads hand the requests they
+ * find to a pool of at most this many worker threads per completion queue,
+ * instead of handling each request themselves. Int valued, defaults to 0. */
+#define GRPC_ARG_SYNC_SERVER_MAX_WORKERS \
+  "grpc.experimental.sync_server_max_workers"
+/** Number of worker threads per completion queue that the C++ sync server
+ * keeps running when GRPC_ARG_SYNC_SERVER_MAX_WORKERS is set. Int valued,
+ * defaults to 0. */
+#define GRPC_ARG_SYNC_SERVER_MIN_WORKERS \
+  "grpc.experimental.sync_server_min_workers"
 /** Request that optional features default to off (regardless of what they
     usually default to) - to enable tight control over what gets enabled
     Boolean valued. Defaults to false. */
@@ -59,6 +82,13 @@
 /** Grace period in milliseconds after connection reaches its max age for
  * outstanding RPCs to complete. Int valued, defaults to INT_MAX (disabled). */
 #define GRPC_ARG_MAX_CONNECTION_AGE_GRACE_MS "grpc.max_connection_age_grace_ms"
+/** Maximum number of connections per second, across all servers in the
+ * process, that send a GOAWAY because they reached their max age. Connections
+ * over the rate wait for their turn, and idle connections go first. The grace
+ * period starts once the GOAWAY is sent. Int valued, defaults to 0 (no
+ * limit). */
+#define GRPC_ARG_EXPERIMENTAL_MAX_CONNECTION_AGE_GOAWAY_RATE \
+  "grpc.experimental.max_connection_age_goaway_rate"
 /** Timeout after the last RPC finishes on the client channel at which the
  * channel goes back into IDLE state. Int valued, milliseconds. INT_MAX means
  * unlimited. The default value is 30 minutes and the min value is 1 second. */
@@ -72,6 +102,29 @@
    application will see the compressed message in the byte buffer. */
 #define GRPC_ARG_ENABLE_PER_MESSAGE_DECOMPRESSION \
   "grpc.per_message_decompression"
+/** Experimental Arg. zlib compression level used for outgoing deflate and
+   gzip messages, from 1 (fastest) to 9 (smallest). Lower levels spend much
+   less CPU for a somewhat larger payload. Defaults to zlib's default
+   level (6). */
+#define GRPC_ARG_DEFLATE_COMPRESSION_LEVEL \
+  "grpc.experimental.deflate_compression_level"
+/** Experimental Arg. Outgoing messages smaller than this many bytes are sent
+   uncompressed even when a compression algorithm is in use, since for small
+   messages compression costs CPU and rarely saves anything. Int valued,
+   defaults to 0. */
+#define GRPC_ARG_COMPRESSION_MIN_MESSAGE_SIZE \
+  "grpc.experimental.compression_min_message_size"
+/** Experimental Arg. If non-zero, track how well outgoing messages compress
+   for each method, and stop compressing a method's messages (other than an
+   occasional sample) while they save less than 10%. Per-method statistics
+   are reported via channelz. Defaults to 0. */
+#define GRPC_ARG_ADAPTIVE_COMPRESSION "grpc.experimental.adaptive_compression"
+/** Experimental Arg. Messages of at least this many bytes are compressed and
+   decompressed on an EventEngine thread rather than the thread driving the
+   call, so that large messages do not hold up other streams. Int valued,
+   defaults to 0 (never offload). */
+#define GRPC_ARG_COMPRESSION_OFFLOAD_THRESHOLD \
+  "grpc.experimental.compression_offload_threshold"
 /** Initial stream ID for http2 transports. Int valued. Defaults to -1
     indicating use of default http2 setting initial stream ID (1). */
 #define GRPC_ARG_HTTP2_INITIAL_SEQUENCE_NUMBER \
@@ -89,6 +142,12 @@
     indicating use of default http2 setting(4096 bytes). */
 #define GRPC_ARG_HTTP2_HPACK_TABLE_SIZE_ENCODER \
   "grpc.http2.hpack_table_size.encoder"
+/** If non-zero, a value of a request header that varies between calls
+    (:path, :authority) is only added to the hpack encoder's dynamic table the
+    second time it is sent on a connection, so that values sent only once do
+    not evict entries that are reused. Int valued. Defaults to 0. */
+#define GRPC_ARG_HTTP2_HPACK_ADMISSION_CONTROL \
+  "grpc.experimental.http2.hpack_admission_control"
 /** How big a frame are we willing to receive via HTTP2.
     Min 16384, max 16777215. Larger values give lower CPU usage for large
     messages, but more head of line blocking for small messages. Defaults to
@@ -120,6 +179,41 @@
     before the request is cancelled */
 #define GRPC_ARG_SERVER_MAX_UNREQUESTED_TIME_IN_SERVER_SECONDS \
   "grpc.server_max_unrequested_time_in_server"
+/** Target queueing delay, in milliseconds, for requests waiting to be
+    requested by the application.  When the smallest delay seen by a
+    method over an interval stays above this target, the server starts
+    rejecting new calls to that method with RESOURCE_EXHAUSTED, at a rate
+    that grows while the delay stays high.  Defaults to 0 (disabled). */
+#define GRPC_ARG_SERVER_QUEUE_DELAY_TARGET_MS \
+  "grpc.experimental.server_queue_delay_target_ms"
+/** Interval, in milliseconds, over which the queueing delay is measured
+    against GRPC_ARG_SERVER_QUEUE_DELAY_TARGET_MS.  Defaults to 100. */
+#define GRPC_ARG_SERVER_QUEUE_DELAY_INTERVAL_MS \
+  "grpc.experimental.server_queue_delay_interval_ms"
+/** Maximum number of calls a server may have in flight for each method (and
+    tenant, see GRPC_ARG_SERVER_CONCURRENCY_LIMIT_TENANT_METADATA), across
+    all of its connections.  Calls over the limit are rejected with
+    RESOURCE_EXHAUSTED.  Unlimited if unset. */
+#define GRPC_ARG_SERVER_MAX_CONCURRENT_CALLS_PER_METHOD \
+  "grpc.experimental.server_max_concurrent_calls_per_method"
+/** Name of a request header whose value identifies the tenant of a call.  If
+    set, GRPC_ARG_SERVER_MAX_CONCURRENT_CALLS_PER_METHOD applies to each
+    tenant of a method separately.  String valued. */
+#define GRPC_ARG_SERVER_CONCURRENCY_LIMIT_TENANT_METADATA \
+  "grpc.experimental.server_concurrency_limit_tenant_metadata"
+/** Target latency, in milliseconds, for calls limited by
+    GRPC_ARG_SERVER_MAX_CONCURRENT_CALLS_PER_METHOD.  If set, the limit of
+    each method and tenant shrinks while its calls take longer than this,
+    and grows back up to the maximum while they are faster. */
+#define GRPC_ARG_SERVER_CONCURRENCY_LIMIT_LATENCY_TARGET_MS \
+  "grpc.experimental.server_concurrency_limit_latency_target_ms"
+/** Maximum number of calls a client may have in flight to a target, across
+    all of the process's channels with this arg.  Within it, the limit
+    adapts to the target's latency: it shrinks while calls get slower and
+    grows while they do not.  Calls over the limit fail with
+    RESOURCE_EXHAUSTED without being sent.  Disabled if unset. */
+#define GRPC_ARG_CLIENT_ADAPTIVE_CONCURRENCY_LIMIT \
+  "grpc.experimental.client_adaptive_concurrency_limit"
 /** Channel arg to override the http2 :scheme header. String valued. */
 #define GRPC_ARG_HTTP2_SCHEME "grpc.http2_scheme"
 /** How many pings can the client send before needing to send a data/header
@@ -139,6 +233,41 @@
     GRPC_WRITE_BUFFER_HINT is set? This is an upper bound
   * Integer valued, bytes. Defaults to 65535 bytes. */
 #define GRPC_ARG_HTTP2_WRITE_BUFFER_SIZE "grpc.http2.write_buffer_size"
+/** How long may data queued with GRPC_WRITE_BUFFER_HINT wait for more writes
+    before it is sent anyway? Buffered data is also sent as soon as a write
+    without the hint arrives or the stream's buffer exceeds
+    GRPC_ARG_HTTP2_WRITE_BUFFER_SIZE.
+  * Integer valued, milliseconds. Defaults to 0 (buffered data waits for one of
+    those events). */
+#define GRPC_ARG_HTTP2_WRITE_BUFFER_FLUSH_DELAY_MS \
+  "grpc.http2.write_buffer_flush_delay_ms"
+/** How often should an HTTP2 transport sample TCP_INFO for its connection and
+    report the RTT, delivery rate, congestion window, send buffer backlog and
+    retransmits to the stats plugins (as the grpc.tcp.* metrics)?
+  * Integer valued, milliseconds. Defaults to 0 (no sampling). Only endpoints
+    that report TCP_INFO are sampled. */
+#define GRPC_ARG_TCP_INFO_SAMPLE_INTERVAL_MS \
+  "grpc.experimental.tcp_info_sample_interval_ms"
+/** How long may an idle transport hold back a write so that more streams can
+    add their frames to it? Writes are only held back while at least
+    GRPC_ARG_HTTP2_WRITE_COALESCING_MIN_STREAMS streams are open, so that
+    lightly loaded connections keep their latency. Only writes started by
+    stream data are held back; pings, settings and stream resets are not.
+  * Integer valued, microseconds, at most 1000. Defaults to 0 (writes are
+    never held back). */
+#define GRPC_ARG_HTTP2_WRITE_COALESCING_WINDOW_US \
+  "grpc.http2.write_coalescing_window_us"
+/** How many streams must be open on a transport before its writes are held
+    back for GRPC_ARG_HTTP2_WRITE_COALESCING_WINDOW_US?
+  * Integer valued. Defaults to 16. */
+#define GRPC_ARG_HTTP2_WRITE_COALESCING_MIN_STREAMS \
+  "grpc.http2.write_coalescing_min_streams"
+/** How many bytes of its most recent frame, flow control and write events
+    should an HTTP2 transport keep while no ztrace query is running on its
+    channelz socket? Each new query then starts with these events, so that it
+    shows what led up to e.g. a stall on a live connection.
+  * Integer valued, bytes. Defaults to 0 (no history is kept). */
+#define GRPC_ARG_HTTP2_ZTRACE_HISTORY_BYTES "grpc.http2.ztrace_history_bytes"
 /** Should we allow receipt of true-binary data on http2 connections?
     Defaults to on (1) */
 #define GRPC_ARG_HTTP2_ENABLE_TRUE_BINARY "grpc.http2.true_binary"
@@ -161,6 +290,15 @@
    outstanding streams. Int valued, 0(false)/1(true). Defaults to 0. */
 #define GRPC_ARG_KEEPALIVE_PERMIT_WITHOUT_CALLS \
   "grpc.keepalive_permit_without_calls"
+/** Upper bound for the keepalive interval while the transport is idle. Each
+    keepalive ping that is acked without any other data having been received
+    since the previous one doubles the interval, starting from
+    GRPC_ARG_KEEPALIVE_TIME_MS, up to this value. Receiving any data, which
+    includes the acks of BDP and application pings, resets the interval to
+    GRPC_ARG_KEEPALIVE_TIME_MS. Int valued, milliseconds. Defaults to
+    GRPC_ARG_KEEPALIVE_TIME_MS, i.e. the interval does not grow. */
+#define GRPC_ARG_EXPERIMENTAL_KEEPALIVE_MAX_IDLE_TIME_MS \
+  "grpc.experimental.keepalive_max_idle_time_ms"
 /** Default authority to pass if none specified on call construction. A string.
  * */
 #define GRPC_ARG_DEFAULT_AUTHORITY "grpc.default_authority"
@@ -209,6 +347,20 @@
  *  protector. Defaults to zero.
  */
 #define GRPC_ARG_TSI_MAX_FRAME_SIZE "grpc.tsi.max_frame_size"
+/** If non-zero, TLS connections over a POSIX TCP endpoint try to hand the
+    record encryption over to the kernel (kTLS) once the handshake is done,
+    instead of using TSI's frame protector. This is only possible for TLS 1.2
+    sessions with an AES-GCM cipher suite on Linux; other connections keep
+    using the frame protector. Defaults to 0. */
+#define GRPC_ARG_TLS_KERNEL_OFFLOAD "grpc.tls_kernel_offload"
+/** When the security_handshake_offload experiment is enabled, the maximum
+    number of offloaded handshake steps that may be queued or running across
+    the process before new handshakes are refused. Handshakes already in
+    progress are never refused. Typically set on servers, to shed new
+    connections during a connection storm rather than let every handshake
+    slow down. Defaults to 0, which means no limit. */
+#define GRPC_ARG_SECURITY_HANDSHAKE_OFFLOAD_MAX_PENDING \
+  "grpc.security_handshake_offload_max_pending"
 /** Maximum metadata size (soft limit), in bytes. Note this limit applies to the
    max sum of all metadata key-value entries in a batch of headers. Some random
    sample of requests between this limit and
@@ -223,6 +375,17 @@
 #define GRPC_ARG_ABSOLUTE_MAX_METADATA_SIZE "grpc.absolute_max_metadata_size"
 /** If non-zero, allow the use of SO_REUSEPORT if it's available (default 1) */
 #define GRPC_ARG_ALLOW_REUSEPORT "grpc.so_reuseport"
+/** Number of SO_REUSEPORT sockets (shards) a server listener opens for every
+ * address it binds, so that incoming connections are spread by the kernel over
+ * several accept queues. Requires SO_REUSEPORT to be allowed. Int valued,
+ * defaults to 1 (no sharding). Only supported by the POSIX EventEngine. */
+#define GRPC_ARG_TCP_LISTENER_SHARDS "grpc.tcp_listener_shards"
+/** If non-zero and GRPC_ARG_TCP_LISTENER_SHARDS is greater than 1, attach a
+ * BPF program to the listener shards which steers every incoming connection to
+ * the shard indexed by the CPU that received it (modulo the number of shards).
+ * Linux only. Boolean valued, defaults to false. */
+#define GRPC_ARG_TCP_LISTENER_SHARD_CPU_STEERING \
+  "grpc.tcp_listener_shard_cpu_steering"
 /** If non-zero, a pointer to a buffer pool (a pointer of type
  * grpc_resource_quota*). (use grpc_resource_quota_arg_vtable() to fetch an
  * appropriate pointer arg vtable). */
@@ -286,10 +449,34 @@
    issued by the tcp_write(). By default, this is set to 4. */
 #define GRPC_ARG_TCP_TX_ZEROCOPY_MAX_SIMULT_SENDS \
   "grpc.experimental.tcp_tx_zerocopy_max_simultaneous_sends"
+/* On Linux unix domain socket connections of the EventEngine endpoint, writes
+   of at least this many bytes are copied into a sealed memfd whose descriptor
+   is passed to the peer with SCM_RIGHTS, and the peer maps it instead of
+   copying the bytes out of the socket. Only set this when the peer sets
+   GRPC_ARG_UNIX_SOCKET_ACCEPT_MEMFD, and keep it below the peer's maximum
+   receive message size. 0 (the default) disables it. */
+#define GRPC_ARG_UNIX_SOCKET_MEMFD_THRESHOLD \
+  "grpc.experimental.unix_socket_memfd_threshold"
+/* If non-zero, Linux unix domain socket connections of the EventEngine
+   endpoint accept writes passed by the peer as sealed memfds (see
+   GRPC_ARG_UNIX_SOCKET_MEMFD_THRESHOLD). A memfd longer than the maximum
+   receive message size fails the connection, and mapped memfds are charged to
+   the resource quota. Without this, a peer that passes any file descriptor
+   fails the connection. Defaults to 0. */
+#define GRPC_ARG_UNIX_SOCKET_ACCEPT_MEMFD \
+  "grpc.experimental.unix_socket_accept_memfd"
 /* Overrides the TCP socket receive buffer size, SO_RCVBUF.
     Default value is -1(kReadBufferSizeUnset) indicating that the system will
     decide the buffer size. Range varies from 0 to INT_MAX. */
 #define GRPC_ARG_TCP_RECEIVE_BUFFER_SIZE "grpc.tcp_receive_buffer_size"
+/* If non-zero, EventEngine POSIX endpoints shrink SO_RCVBUF to a small size
+   when the resource quota comes under memory pressure, which idle
+   connections otherwise never give back, and from then on size it from the
+   amount of data each read finds on the socket. SO_SNDBUF is left to the
+   kernel. Ignored when GRPC_ARG_TCP_RECEIVE_BUFFER_SIZE is set. Defaults to
+   0. */
+#define GRPC_ARG_TCP_AUTO_TUNE_BUFFER_SIZES \
+  "grpc.experimental.tcp_auto_tune_buffer_sizes"
 /* Timeout in milliseconds to use for calls to the grpclb load balancer.
    If 0 or unset, the balancer calls will have no deadline. Defaults to 0 ms. */
 #define GRPC_ARG_GRPCLB_CALL_TIMEOUT_MS "grpc.grpclb_call_timeout_ms"
@@ -346,6 +533,19 @@
           this arg will be removed, and the hedging functionality will
           be enabled via the GRPC_ARG_ENABLE_RETRIES arg above. */
 #define GRPC_ARG_EXPERIMENTAL_ENABLE_HEDGING "grpc.experimental.enable_hedging"
+/** EXPERIMENTAL. If non-zero, hedging is adaptive: instead of the
+    hedgingDelay from the service config, hedged attempts are sent after the
+    95th percentile of the time attempts of the same method on this channel
+    have taken to get a response, once 100 of them have been seen. Hedged
+    attempts are also capped to GRPC_ARG_EXPERIMENTAL_HEDGING_MAX_PERCENT of
+    the method's calls. Boolean valued. Defaults to false. */
+#define GRPC_ARG_EXPERIMENTAL_ADAPTIVE_HEDGING \
+  "grpc.experimental.adaptive_hedging"
+/** EXPERIMENTAL. With GRPC_ARG_EXPERIMENTAL_ADAPTIVE_HEDGING, the most hedged
+    attempts a method may send, as a percentage of its calls. Int valued, from
+    0 to 100. Defaults to 10. */
+#define GRPC_ARG_EXPERIMENTAL_HEDGING_MAX_PERCENT \
+  "grpc.experimental.hedging_max_percent"
 /** Per-RPC retry buffer size, in bytes. Default is 256 KiB. */
 #define GRPC_ARG_PER_RPC_RETRY_BUFFER_SIZE "grpc.per_rpc_retry_buffer_size"
 /** Channel arg that carries the bridged objective c object for custom metrics
@@ -377,6 +577,14 @@
 /** If set, inhibits health checking (which may be enabled via the
  *  service config.). Boolean valued. Defaults to false. */
 #define GRPC_ARG_INHIBIT_HEALTH_CHECKING "grpc.inhibit_health_checking"
+/** Percentage of subchannels, from 0 to 100, that run the health checks
+ *  enabled via the service config. Each subchannel decides once, at random,
+ *  whether it is sampled. Subchannels that are not sampled report their
+ *  connectivity state as their health, so that across a large fleet of
+ *  clients each backend receives health check streams from only this
+ *  percentage of its clients. Integer valued. Defaults to 100. */
+#define GRPC_ARG_HEALTH_CHECK_SAMPLE_PERCENT \
+  "grpc.experimental.health_check_sample_percent"
 /** If enabled, the channel's DNS resolver queries for SRV records.
  *  This is useful only when using the "grpclb" load balancing policy,
  *  as described in the following documents:
@@ -393,6 +601,15 @@
  * timeouts/backoff/retry logic, and so the actual DNS resolution may time out
  * sooner than the value specified here. */
 #define GRPC_ARG_DNS_ARES_QUERY_TIMEOUT_MS "grpc.dns_ares_query_timeout"
+/** If set to a positive value, DNS results from the EventEngine based
+ * resolver are kept in a process-wide cache for up to this many ms, and
+ * concurrent identical lookups from different channels share one query.
+ * Defaults to 0, which disables the cache. */
+#define GRPC_ARG_DNS_CACHE_MAX_AGE_MS "grpc.experimental.dns_cache_max_age_ms"
+/** Like GRPC_ARG_DNS_CACHE_MAX_AGE_MS, but for failed lookups. Defaults to
+ * 0, which does not cache failures. */
+#define GRPC_ARG_DNS_CACHE_NEGATIVE_MAX_AGE_MS \
+  "grpc.experimental.dns_cache_negative_max_age_ms"
 /** If set, uses a local subchannel pool within the channel. Otherwise, uses the
  * global subchannel pool. Boolean valued. Defaults to false. */
 #define GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL "grpc.use_local_subchannel_pool"
@@ -417,6 +634,16 @@
  *  Defaults to 250ms. */
 #define GRPC_ARG_HAPPY_EYEBALLS_CONNECTION_ATTEMPT_DELAY_MS \
   "grpc.happy_eyeballs_connection_attempt_delay_ms"
+/** EXPERIMENTAL. Number of addresses that Happy Eyeballs starts connecting to
+ *  at once, before staggering the rest by the Connection Attempt Delay.
+ *  Defaults to 1. */
+#define GRPC_ARG_HAPPY_EYEBALLS_PARALLEL_CONNECTION_ATTEMPTS \
+  "grpc.happy_eyeballs_parallel_connection_attempts"
+/** EXPERIMENTAL. If non-zero, the Connection Attempt Delay for Happy Eyeballs
+ *  follows the time that successful connection attempts on the channel have
+ *  taken, never exceeding the configured delay. Defaults to false. */
+#define GRPC_ARG_HAPPY_EYEBALLS_ADAPTIVE_CONNECTION_ATTEMPT_DELAY \
+  "grpc.happy_eyeballs_adaptive_connection_attempt_delay"
 /** It accepts a MemoryAllocatorFactory as input and If specified, it forces
  * the default event engine to use memory allocators created using the provided
  * factory. */
@@ -426,10 +653,49 @@
  * If unspecified, it is unlimited */
 #define GRPC_ARG_MAX_ALLOWED_INCOMING_CONNECTIONS \
   "grpc.max_allowed_incoming_connections"
+/** Configure the max number of incoming connections that may be handshaking
+ * at once on the server. Connections beyond it are closed as soon as they
+ * are accepted. If unspecified, it is unlimited. */
+#define GRPC_ARG_MAX_PENDING_INCOMING_HANDSHAKES \
+  "grpc.max_pending_incoming_handshakes"
+/** Target handshake latency, in milliseconds, for incoming connections on the
+ * server. If set, the number of incoming connections allowed to handshake at
+ * once shrinks while handshakes take longer than this, and grows back while
+ * they are faster, up to GRPC_ARG_MAX_PENDING_INCOMING_HANDSHAKES. */
+#define GRPC_ARG_INCOMING_HANDSHAKE_LATENCY_TARGET_MS \
+  "grpc.incoming_handshake_latency_target_ms"
 /** Configure per-channel or per-server stats plugins. */
 #define GRPC_ARG_EXPERIMENTAL_STATS_PLUGINS "grpc.experimental.stats_plugins"
 /** If non-zero, allow security frames to be sent and received. */
 #define GRPC_ARG_SECURITY_FRAME_ALLOWED "grpc.security_frame_allowed"
+/** EXPERIMENTAL. If non-zero on a C++ in-process channel, protobuf request
+ * messages sent with the lazily serialized write APIs are handed to the server
+ * as C++ objects instead of being serialized and parsed again. Defaults to
+ * false. */
+#define GRPC_ARG_INPROC_PASS_MESSAGE_OBJECTS \
+  "grpc.experimental.inproc_pass_message_objects"
+/** EXPERIMENTAL. Maximum number of connections a subchannel keeps open to
+ * its address. Connections past the first are opened on demand, when every
+ * existing connection carries GRPC_ARG_SUBCHANNEL_MAX_CALLS_PER_CONNECTION
+ * calls, and each call is sent on the connection with the fewest calls in
+ * flight. Int valued, from 1 to 32. Defaults to 1. */
+#define GRPC_ARG_MAX_CONNECTIONS_PER_SUBCHANNEL \
+  "grpc.experimental.max_connections_per_subchannel"
+/** EXPERIMENTAL. Number of calls in flight on a subchannel connection at which
+ * it is considered saturated; see GRPC_ARG_MAX_CONNECTIONS_PER_SUBCHANNEL.
+ * This is usually set to the servers' MAX_CONCURRENT_STREAMS. Int valued.
+ * Defaults to 100. */
+#define GRPC_ARG_SUBCHANNEL_MAX_CALLS_PER_CONNECTION \
+  "grpc.experimental.subchannel_max_calls_per_connection"
+/** EXPERIMENTAL. If non-zero, the subchannel pool ignores channel args that
+ * only configure the channel itself (service config, LB policy, retries,
+ * idle timeout, resolver settings, user agent) when deciding whether two
+ * channels can share a subchannel. Channels that set this and differ only in
+ * those args then share connections to each backend. Calls on a shared
+ * subchannel carry the user agent of the channel that created it. Int valued,
+ * 0 (false) or 1 (true). Defaults to 0. */
+#define GRPC_ARG_SHARE_SUBCHANNELS_ACROSS_CHANNEL_ARGS \
+  "grpc.experimental.share_subchannels_across_channel_args"
 /** \} */
 
 #endif /* GRPC_IMPL_CHANNEL_ARG_NAMES_H */
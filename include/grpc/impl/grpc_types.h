@@ -205,6 +205,16 @@ typedef enum grpc_call_error {
   (GRPC_INITIAL_METADATA_WAIT_FOR_READY_EXPLICITLY_SET | \
    GRPC_INITIAL_METADATA_WAIT_FOR_READY | GRPC_WRITE_THROUGH)
 
+/** Initial metadata key hinting the write priority of a call to the transport.
+    Its value is a decimal integer between 0 (the default) and
+    GRPC_MAX_WRITE_PRIORITY; calls with a higher priority get a larger share of
+    each write on a connection. The chttp2 transport takes the key out of the
+    metadata, so it is not sent on the wire. Other transports ignore the hint
+    and send the key to the peer like any other metadata. */
+#define GRPC_WRITE_PRIORITY_MD_KEY "grpc-internal-write-priority"
+/** Highest value accepted for GRPC_WRITE_PRIORITY_MD_KEY. */
+#define GRPC_MAX_WRITE_PRIORITY 7
+
 /** A single metadata element */
 typedef struct grpc_metadata {
   /** the key, value values are expected to line up with grpc_mdelem: if
@@ -27,12 +27,15 @@
 #include <grpcpp/impl/sync.h>
 #include <grpcpp/support/client_interceptor.h>
 #include <grpcpp/support/config.h>
+#include <grpcpp/support/time.h>
 
 #include <memory>
+#include <vector>
 
 struct grpc_channel;
 
 namespace grpc {
+class Server;
 namespace testing {
 class ChannelTestPeer;
 }  // namespace testing
@@ -48,6 +51,30 @@ namespace experimental {
 /// TODO(roth): Once we see whether this proves useful, either create a gRFC
 /// and change this to be a method of the Channel class, or remove it.
 void ChannelResetConnectionBackoff(Channel* channel);
+
+/// Options for \a WarmupChannels.
+struct ChannelWarmupOptions {
+  /// The most channels that are connecting for the first time at once.
+  size_t max_concurrent_connects = 32;
+  /// The fraction of the channels that must be READY to finish warming up.
+  double target_ready_fraction = 1.0;
+};
+
+/// Starts name resolution and connection establishment on \a channels, with
+/// at most \a options.max_concurrent_connects of them connecting for the
+/// first time at once, and waits until \a options.target_ready_fraction of
+/// them are READY or \a deadline passes.  Returns true if the target fraction
+/// of the channels is READY.  Channels that are not READY yet keep
+/// connecting in the background afterwards.
+bool WarmupChannels(const std::vector<std::shared_ptr<Channel>>& channels,
+                    const ChannelWarmupOptions& options, gpr_timespec deadline);
+
+template <typename T>
+bool WarmupChannels(const std::vector<std::shared_ptr<Channel>>& channels,
+                    const ChannelWarmupOptions& options, const T& deadline) {
+  return WarmupChannels(channels, options,
+                        grpc::TimePoint<T>(deadline).raw_time());
+}
 }  // namespace experimental
 
 /// Channels represent a connection to an endpoint. Created by \a CreateChannel.
@@ -80,6 +107,7 @@ class Channel final : public grpc::ChannelInterface,
           grpc::experimental::ClientInterceptorFactoryInterface>>
           interceptor_creators);
   friend class grpc::internal::InterceptedChannel;
+  friend class grpc::Server;
   Channel(const std::string& host, grpc_channel* c_channel,
           std::vector<std::unique_ptr<
               grpc::experimental::ClientInterceptorFactoryInterface>>
@@ -119,6 +147,10 @@ class Channel final : public grpc::ChannelInterface,
   std::vector<
       std::unique_ptr<grpc::experimental::ClientInterceptorFactoryInterface>>
       interceptor_creators_;
+
+  // Set by Server::InProcessChannel() when GRPC_ARG_INPROC_PASS_MESSAGE_OBJECTS
+  // is enabled.
+  bool pass_message_objects_ = false;
 };
 
 }  // namespace grpc
@@ -343,6 +343,16 @@ class ClientContext {
   /// \param algorithm The compression algorithm used for the client call.
   void set_compression_algorithm(grpc_compression_algorithm algorithm);
 
+  /// Set the write priority of the client call.
+  ///
+  /// Calls with a higher priority get a larger share of each write on the
+  /// connection they share with other calls, so that small calls are not held
+  /// back by bulk transfers. Must be called before the call starts.
+  ///
+  /// \param priority A value between 0 (the default) and
+  /// GRPC_MAX_WRITE_PRIORITY.
+  void set_write_priority(uint32_t priority);
+
   /// Flag whether the initial metadata should be \a corked
   ///
   /// If \a corked is true, then the initial metadata will be coalesced with the
@@ -184,6 +184,22 @@ class CompletionQueue : private grpc::internal::GrpcLibrary {
             GOT_EVENT);
   }
 
+  /// EXPERIMENTAL
+  /// Read up to \a max_events events from the queue, blocking until at least
+  /// one is available or the queue is shutting down. Events that are already
+  /// queued are taken together, which saves a trip through the queue for each.
+  ///
+  /// \param[out] tags Filled with the tags of the events read. Must have room
+  ///        for \a max_events entries.
+  /// \param[out] oks Filled with whether each event succeeded; see
+  ///        CompletionQueue::Next for the meaning of ok. Must have room for
+  ///        \a max_events entries.
+  /// \param[in] max_events The most events to read.
+  ///
+  /// \return The number of events read, or 0 if the queue is fully drained and
+  ///         shut down.
+  int NextBatch(void** tags, bool* oks, int max_events);
+
   /// Read from the queue, blocking up to \a deadline (or the queue's shutdown).
   /// Both \a tag and \a ok are updated upon success (if an event is available
   /// within the \a deadline).  A \a tag points to an arbitrary location usually
@@ -80,6 +80,13 @@ class Call final {
     return server_rpc_info_;
   }
 
+  /// Whether messages sent on this call may be passed to the peer as C++
+  /// objects instead of being serialized. Only set for in-process channels.
+  bool pass_message_objects() const { return pass_message_objects_; }
+  void set_pass_message_objects(bool pass_message_objects) {
+    pass_message_objects_ = pass_message_objects;
+  }
+
  private:
   CallHook* call_hook_;
   grpc::CompletionQueue* cq_;
@@ -87,6 +94,7 @@ class Call final {
   int max_receive_message_size_;
   experimental::ClientRpcInfo* client_rpc_info_ = nullptr;
   experimental::ServerRpcInfo* server_rpc_info_ = nullptr;
+  bool pass_message_objects_ = false;
 };
 }  // namespace internal
 }  // namespace grpc
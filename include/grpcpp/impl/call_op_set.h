@@ -32,6 +32,7 @@
 #include <grpcpp/impl/codegen/intercepted_channel.h>
 #include <grpcpp/impl/completion_queue_tag.h>
 #include <grpcpp/impl/interceptor_common.h>
+#include <grpcpp/impl/message_object.h>
 #include <grpcpp/impl/serialization_traits.h>
 #include <grpcpp/support/byte_buffer.h>
 #include <grpcpp/support/config.h>
@@ -315,12 +316,20 @@ class CallOpSendMessage {
     if (msg_ == nullptr && !send_buf_.Valid()) return;
     if (hijacked_) {
       serializer_ = nullptr;
+      make_message_object_ = nullptr;
       return;
     }
     if (msg_ != nullptr) {
-      ABSL_CHECK(serializer_(msg_).ok());
+      if (pass_message_objects_ && make_message_object_ != nullptr) {
+        make_message_object_(msg_, &send_buf_);
+        // The carrier is not protobuf and must reach the peer untouched.
+        write_options_.set_no_compression();
+      } else {
+        ABSL_CHECK(serializer_(msg_).ok());
+      }
     }
     serializer_ = nullptr;
+    make_message_object_ = nullptr;
     grpc_op* op = &ops[(*nops)++];
     op->op = GRPC_OP_SEND_MESSAGE;
     op->flags = write_options_.flags();
@@ -369,14 +378,23 @@ class CallOpSendMessage {
   }
 
  private:
+  friend void SetPassMessageObjects(CallOpSendMessage* op, const Call& call);
+
   const void* msg_ = nullptr;  // The original non-serialized message
   bool hijacked_ = false;
   bool failed_send_ = false;
+  bool pass_message_objects_ = false;
   ByteBuffer send_buf_;
   WriteOptions write_options_;
   std::function<Status(const void*)> serializer_;
+  MakeMessageObjectFn make_message_object_ = nullptr;
 };
 
+inline void SetPassMessageObjects(void* /*op*/, const Call& /*call*/) {}
+inline void SetPassMessageObjects(CallOpSendMessage* op, const Call& call) {
+  op->pass_message_objects_ = call.pass_message_objects();
+}
+
 template <class M>
 Status CallOpSendMessage::SendMessage(const M& message, WriteOptions options) {
   write_options_ = options;
@@ -400,6 +418,7 @@ Status CallOpSendMessage::SendMessagePtr(const M* message,
                                          WriteOptions options) {
   msg_ = message;
   write_options_ = options;
+  make_message_object_ = MessageObjectMaker<M>();
   // Store the serializer for later since we have access to the message
   serializer_ = [this](const void* message) {
     bool own_buf;
@@ -927,6 +946,11 @@ class CallOpSet : public CallOpSetInterface,
     this->Op6::FinishOp(status);
     saved_status_ = *status;
     if (RunInterceptorsPostRecv()) {
+      if (!interceptor_methods_.InterceptorsListEmpty()) {
+        // None of the interceptors wanted to see the results of this batch,
+        // so complete the avalanching registered when the ops were filled.
+        call_.cq()->CompleteAvalanching();
+      }
       *tag = return_tag_;
       grpc_call_unref(call_.call());
       return true;
@@ -962,6 +986,12 @@ class CallOpSet : public CallOpSetInterface,
     static const size_t MAX_OPS = 6;
     grpc_op ops[MAX_OPS];
     size_t nops = 0;
+    SetPassMessageObjects(static_cast<Op1*>(this), call_);
+    SetPassMessageObjects(static_cast<Op2*>(this), call_);
+    SetPassMessageObjects(static_cast<Op3*>(this), call_);
+    SetPassMessageObjects(static_cast<Op4*>(this), call_);
+    SetPassMessageObjects(static_cast<Op5*>(this), call_);
+    SetPassMessageObjects(static_cast<Op6*>(this), call_);
     this->Op1::AddOp(ops, &nops);
     this->Op2::AddOp(ops, &nops);
     this->Op3::AddOp(ops, &nops);
@@ -37,6 +37,12 @@
 #endif
 #endif
 
+#ifndef GRPC_CUSTOM_ARENA
+#include <google/protobuf/arena.h>
+#define GRPC_CUSTOM_ARENA ::google::protobuf::Arena
+#define GRPC_CUSTOM_ARENAOPTIONS ::google::protobuf::ArenaOptions
+#endif
+
 #ifndef GRPC_CUSTOM_DESCRIPTOR
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/descriptor.pb.h>
@@ -89,6 +95,9 @@ namespace protobuf {
 typedef GRPC_CUSTOM_MESSAGE Message;
 typedef GRPC_CUSTOM_MESSAGELITE MessageLite;
 
+typedef GRPC_CUSTOM_ARENA Arena;
+typedef GRPC_CUSTOM_ARENAOPTIONS ArenaOptions;
+
 typedef GRPC_CUSTOM_DESCRIPTOR Descriptor;
 typedef GRPC_CUSTOM_DESCRIPTORPOOL DescriptorPool;
 typedef GRPC_CUSTOM_DESCRIPTORDATABASE DescriptorDatabase;
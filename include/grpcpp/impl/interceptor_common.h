@@ -26,7 +26,7 @@
 #include <grpcpp/support/client_interceptor.h>
 #include <grpcpp/support/server_interceptor.h>
 
-#include <array>
+#include <cstdint>
 #include <functional>
 
 #include "absl/log/absl_check.h"
@@ -37,20 +37,13 @@ namespace internal {
 class InterceptorBatchMethodsImpl
     : public experimental::InterceptorBatchMethods {
  public:
-  InterceptorBatchMethodsImpl() {
-    for (auto i = static_cast<experimental::InterceptionHookPoints>(0);
-         i < experimental::InterceptionHookPoints::NUM_INTERCEPTION_HOOKS;
-         i = static_cast<experimental::InterceptionHookPoints>(
-             static_cast<size_t>(i) + 1)) {
-      hooks_[static_cast<size_t>(i)] = false;
-    }
-  }
+  InterceptorBatchMethodsImpl() {}
 
   ~InterceptorBatchMethodsImpl() override {}
 
   bool QueryInterceptionHookPoint(
       experimental::InterceptionHookPoints type) override {
-    return hooks_[static_cast<size_t>(type)];
+    return (hooks_ & experimental::InterceptionHookPointBit(type)) != 0;
   }
 
   void Proceed() override {
@@ -77,7 +70,7 @@ class InterceptorBatchMethodsImpl
   }
 
   void AddInterceptionHookPoint(experimental::InterceptionHookPoints type) {
-    hooks_[static_cast<size_t>(type)] = true;
+    hooks_ |= experimental::InterceptionHookPointBit(type);
   }
 
   ByteBuffer* GetSerializedSendMessage() override {
@@ -130,8 +123,8 @@ class InterceptorBatchMethodsImpl
   Status* GetRecvStatus() override { return recv_status_; }
 
   void FailHijackedSendMessage() override {
-    ABSL_CHECK(hooks_[static_cast<size_t>(
-        experimental::InterceptionHookPoints::PRE_SEND_MESSAGE)]);
+    ABSL_CHECK(QueryInterceptionHookPoint(
+        experimental::InterceptionHookPoints::PRE_SEND_MESSAGE));
     *fail_send_message_ = true;
   }
 
@@ -193,8 +186,8 @@ class InterceptorBatchMethodsImpl
   }
 
   void FailHijackedRecvMessage() override {
-    ABSL_CHECK(hooks_[static_cast<size_t>(
-        experimental::InterceptionHookPoints::PRE_RECV_MESSAGE)]);
+    ABSL_CHECK(QueryInterceptionHookPoint(
+        experimental::InterceptionHookPoints::PRE_RECV_MESSAGE));
     *hijacked_recv_message_failed_ = true;
   }
 
@@ -235,12 +228,17 @@ class InterceptorBatchMethodsImpl
   // SetCallOpSetInterface should have been called before this. After all the
   // interceptors are done running, either ContinueFillOpsAfterInterception or
   // ContinueFinalizeOpsAfterInterception will be called. Note that neither of
-  // them is invoked if there were no interceptors registered.
+  // them is invoked if there were no interceptors registered, or if none of
+  // them is interested in the hook points of this batch.
   bool RunInterceptors() {
     ABSL_CHECK(ops_);
     auto* client_rpc_info = call_->client_rpc_info();
     if (client_rpc_info != nullptr) {
-      if (client_rpc_info->interceptors_.empty()) {
+      // A hijacked RPC always goes through the hijacking interceptor, since
+      // the ops past it are never sent to the core.
+      if (client_rpc_info->interceptors_.empty() ||
+          (!client_rpc_info->hijacked_ &&
+           (client_rpc_info->hook_points_ & hooks_) == 0)) {
         return true;
       } else {
         RunClientInterceptors();
@@ -249,7 +247,8 @@ class InterceptorBatchMethodsImpl
     }
 
     auto* server_rpc_info = call_->server_rpc_info();
-    if (server_rpc_info == nullptr || server_rpc_info->interceptors_.empty()) {
+    if (server_rpc_info == nullptr || server_rpc_info->interceptors_.empty() ||
+        (server_rpc_info->hook_points_ & hooks_) == 0) {
       return true;
     }
     RunServerInterceptors();
@@ -265,7 +264,8 @@ class InterceptorBatchMethodsImpl
     ABSL_CHECK_EQ(reverse_, true);
     ABSL_CHECK_EQ(call_->client_rpc_info(), nullptr);
     auto* server_rpc_info = call_->server_rpc_info();
-    if (server_rpc_info == nullptr || server_rpc_info->interceptors_.empty()) {
+    if (server_rpc_info == nullptr || server_rpc_info->interceptors_.empty() ||
+        (server_rpc_info->hook_points_ & hooks_) == 0) {
       return true;
     }
     callback_ = std::move(f);
@@ -285,7 +285,7 @@ class InterceptorBatchMethodsImpl
         current_interceptor_index_ = rpc_info->interceptors_.size() - 1;
       }
     }
-    rpc_info->RunInterceptor(this, current_interceptor_index_);
+    RunCurrentInterceptor(rpc_info);
   }
 
   void RunServerInterceptors() {
@@ -295,9 +295,32 @@ class InterceptorBatchMethodsImpl
     } else {
       current_interceptor_index_ = rpc_info->interceptors_.size() - 1;
     }
+    RunCurrentInterceptor(rpc_info);
+  }
+
+  // Runs the interceptor at current_interceptor_index_, or proceeds past it
+  // if it is not interested in any hook point of this batch. The interceptor
+  // that hijacked the RPC is always run.
+  template <typename RpcInfo>
+  void RunCurrentInterceptor(RpcInfo* rpc_info) {
+    if (!rpc_info->InterceptorWantsHookPoints(current_interceptor_index_,
+                                              hooks_) &&
+        !IsHijackingInterceptor(rpc_info)) {
+      Proceed();
+      return;
+    }
     rpc_info->RunInterceptor(this, current_interceptor_index_);
   }
 
+  bool IsHijackingInterceptor(experimental::ClientRpcInfo* rpc_info) const {
+    return rpc_info->hijacked_ &&
+           current_interceptor_index_ == rpc_info->hijacked_interceptor_;
+  }
+
+  bool IsHijackingInterceptor(experimental::ServerRpcInfo* /*rpc_info*/) const {
+    return false;
+  }
+
   void ProceedClient() {
     auto* rpc_info = call_->client_rpc_info();
     if (rpc_info->hijacked_ && !reverse_ &&
@@ -319,7 +342,7 @@ class InterceptorBatchMethodsImpl
           // This is a hijacked RPC and we are done with hijacking
           ops_->ContinueFillOpsAfterInterception();
         } else {
-          rpc_info->RunInterceptor(this, current_interceptor_index_);
+          RunCurrentInterceptor(rpc_info);
         }
       } else {
         // we are done running all the interceptors without any hijacking
@@ -330,7 +353,7 @@ class InterceptorBatchMethodsImpl
       if (current_interceptor_index_ > 0) {
         // Continue running interceptors
         current_interceptor_index_--;
-        rpc_info->RunInterceptor(this, current_interceptor_index_);
+        RunCurrentInterceptor(rpc_info);
       } else {
         // we are done running all the interceptors without any hijacking
         ops_->ContinueFinalizeResultAfterInterception();
@@ -343,7 +366,7 @@ class InterceptorBatchMethodsImpl
     if (!reverse_) {
       current_interceptor_index_++;
       if (current_interceptor_index_ < rpc_info->interceptors_.size()) {
-        return rpc_info->RunInterceptor(this, current_interceptor_index_);
+        return RunCurrentInterceptor(rpc_info);
       } else if (ops_) {
         return ops_->ContinueFillOpsAfterInterception();
       }
@@ -352,7 +375,7 @@ class InterceptorBatchMethodsImpl
       if (current_interceptor_index_ > 0) {
         // Continue running interceptors
         current_interceptor_index_--;
-        return rpc_info->RunInterceptor(this, current_interceptor_index_);
+        return RunCurrentInterceptor(rpc_info);
       } else if (ops_) {
         return ops_->ContinueFinalizeResultAfterInterception();
       }
@@ -361,19 +384,11 @@ class InterceptorBatchMethodsImpl
     callback_();
   }
 
-  void ClearHookPoints() {
-    for (auto i = static_cast<experimental::InterceptionHookPoints>(0);
-         i < experimental::InterceptionHookPoints::NUM_INTERCEPTION_HOOKS;
-         i = static_cast<experimental::InterceptionHookPoints>(
-             static_cast<size_t>(i) + 1)) {
-      hooks_[static_cast<size_t>(i)] = false;
-    }
-  }
+  void ClearHookPoints() { hooks_ = 0; }
 
-  std::array<bool,
-             static_cast<size_t>(
-                 experimental::InterceptionHookPoints::NUM_INTERCEPTION_HOOKS)>
-      hooks_;
+  // Mask of the hook points present in this batch, built from
+  // experimental::InterceptionHookPointBit().
+  uint32_t hooks_ = 0;
 
   size_t current_interceptor_index_ = 0;  // Current iterator
   bool reverse_ = false;
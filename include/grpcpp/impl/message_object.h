@@ -0,0 +1,209 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPCPP_IMPL_MESSAGE_OBJECT_H
+#define GRPCPP_IMPL_MESSAGE_OBJECT_H
+
+#include <grpc/byte_buffer.h>
+#include <grpc/impl/compression_types.h>
+#include <grpc/slice.h>
+#include <grpcpp/impl/serialization_traits.h>
+#include <grpcpp/support/byte_buffer.h>
+#include <grpcpp/support/status.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace grpc {
+namespace internal {
+
+/// A message that travels through an in-process call as a C++ object instead
+/// of as its serialized bytes.
+///
+/// The object rides in a byte buffer holding a single slice that points at a
+/// small token owned by the object. The token is not valid protobuf, and
+/// objects are only recognized by the address of their token, so bytes that
+/// arrive from the network are never mistaken for one. If the buffer leaves
+/// the process or is copied, the receiver fails to parse it.
+///
+/// SerializationTraits opt in to carrying message objects by declaring
+/// `using supports_message_objects = std::true_type;`.
+class MessageObject {
+ public:
+  static constexpr size_t kTokenSize = 16;
+
+  virtual ~MessageObject() = default;
+
+  MessageObject(const MessageObject&) = delete;
+  MessageObject& operator=(const MessageObject&) = delete;
+
+  /// Replace the contents of \a buffer with a carrier for \a object. The
+  /// object is destroyed when the last reference to the carrier is released.
+  static void ToByteBuffer(std::unique_ptr<MessageObject> object,
+                           ByteBuffer* buffer);
+
+  /// Return the object carried by \a buffer, or nullptr if \a buffer holds
+  /// ordinary serialized bytes. The object remains owned by \a buffer.
+  static MessageObject* FromByteBuffer(ByteBuffer* buffer) {
+    grpc_byte_buffer* bb = buffer == nullptr ? nullptr : buffer->c_buffer();
+    if (bb == nullptr || bb->type != GRPC_BB_RAW ||
+        bb->data.raw.compression != GRPC_COMPRESS_NONE ||
+        bb->data.raw.slice_buffer.count != 1) {
+      return nullptr;
+    }
+    const grpc_slice& slice = bb->data.raw.slice_buffer.slices[0];
+    if (slice.refcount == nullptr || GRPC_SLICE_LENGTH(slice) != kTokenSize ||
+        GRPC_SLICE_START_PTR(slice)[0] != 0) {
+      return nullptr;
+    }
+    return Lookup(GRPC_SLICE_START_PTR(slice));
+  }
+
+  /// Move the carried message into \a message and clear \a buffer. If the
+  /// carried message is not an M, it is converted by serializing it and
+  /// parsing the result.
+  template <class M>
+  Status MoveTo(M* message, ByteBuffer* buffer);
+
+  /// Serialize the carried message into \a buffer.
+  virtual Status Serialize(ByteBuffer* buffer) const = 0;
+
+  /// The number of messages handed to a receiver of the same type, so
+  /// without being serialized, since the process started.
+  static size_t NumMovedForTesting();
+
+ protected:
+  explicit MessageObject(const void* type);
+
+ private:
+  static MessageObject* Lookup(const uint8_t* token);
+  static void Destroy(void* object);
+  static void CountMoved();
+
+  // Identifies the concrete TypedMessageObject.
+  const void* const type_;
+  std::atomic<bool> consumed_{false};
+  uint8_t token_[kTokenSize];
+};
+
+template <class M>
+class TypedMessageObject final : public MessageObject {
+ public:
+  explicit TypedMessageObject(const M& message)
+      : MessageObject(Type()), message_(message) {}
+
+  static const void* Type() {
+    static const char type = 0;
+    return &type;
+  }
+
+  M* message() { return &message_; }
+
+  Status Serialize(ByteBuffer* buffer) const override {
+    bool own_buffer;
+    Status result =
+        SerializationTraits<M>::Serialize(message_, buffer, &own_buffer);
+    if (!own_buffer) buffer->Duplicate();
+    return result;
+  }
+
+ private:
+  M message_;
+};
+
+template <class M>
+Status MessageObject::MoveTo(M* message, ByteBuffer* buffer) {
+  if (consumed_.exchange(true, std::memory_order_acq_rel)) {
+    buffer->Clear();
+    return Status(StatusCode::INTERNAL, "Message object already consumed");
+  }
+  if (type_ == TypedMessageObject<M>::Type()) {
+    *message =
+        std::move(*static_cast<TypedMessageObject<M>*>(this)->message());
+    buffer->Clear();
+    CountMoved();
+    return Status::OK;
+  }
+  ByteBuffer serialized;
+  Status result = Serialize(&serialized);
+  buffer->Clear();
+  if (!result.ok()) return result;
+  return SerializationTraits<M>::Deserialize(&serialized, message);
+}
+
+using MakeMessageObjectFn = void (*)(const void* message, ByteBuffer* buffer);
+
+template <class M, class = void>
+struct SupportsMessageObjects : std::false_type {};
+
+template <class M>
+struct SupportsMessageObjects<
+    M, std::void_t<typename SerializationTraits<M>::supports_message_objects>>
+    : std::integral_constant<
+          bool, SerializationTraits<M>::supports_message_objects::value &&
+                    std::is_copy_constructible<M>::value> {};
+
+template <class M>
+MakeMessageObjectFn MessageObjectMaker(std::false_type) {
+  return nullptr;
+}
+
+template <class M>
+MakeMessageObjectFn MessageObjectMaker(std::true_type) {
+  return [](const void* message, ByteBuffer* buffer) {
+    MessageObject::ToByteBuffer(std::make_unique<TypedMessageObject<M>>(
+                                    *static_cast<const M*>(message)),
+                                buffer);
+  };
+}
+
+/// Return a function that wraps an M in a message object, or nullptr if M
+/// cannot be carried as one.
+template <class M>
+MakeMessageObjectFn MessageObjectMaker() {
+  return MessageObjectMaker<M>(SupportsMessageObjects<M>());
+}
+
+template <class M>
+bool MoveMessageObject(ByteBuffer* /*buffer*/, M* /*message*/,
+                       Status* /*status*/, std::false_type) {
+  return false;
+}
+
+template <class M>
+bool MoveMessageObject(ByteBuffer* buffer, M* message, Status* status,
+                       std::true_type) {
+  MessageObject* object = MessageObject::FromByteBuffer(buffer);
+  if (object == nullptr) return false;
+  *status = object->MoveTo(message, buffer);
+  return true;
+}
+
+/// If \a buffer carries a message object, move it into \a message, set
+/// \a status and return true. Returns false if \a buffer holds serialized
+/// bytes.
+template <class M>
+bool MoveMessageObject(ByteBuffer* buffer, M* message, Status* status) {
+  return MoveMessageObject(buffer, message, status,
+                           SupportsMessageObjects<M>());
+}
+
+}  // namespace internal
+}  // namespace grpc
+
+#endif  // GRPCPP_IMPL_MESSAGE_OBJECT_H
@@ -24,6 +24,7 @@
 #include <grpc/slice.h>
 #include <grpcpp/impl/codegen/config_protobuf.h>
 #include <grpcpp/impl/generic_serialize.h>
+#include <grpcpp/impl/message_object.h>
 #include <grpcpp/impl/serialization_traits.h>
 #include <grpcpp/support/byte_buffer.h>
 #include <grpcpp/support/proto_buffer_reader.h>
@@ -46,6 +47,9 @@ class SerializationTraits<
     T, typename std::enable_if<
            std::is_base_of<grpc::protobuf::MessageLite, T>::value>::type> {
  public:
+  // Messages may be passed through in-process calls without serialization.
+  using supports_message_objects = std::true_type;
+
   static Status Serialize(const grpc::protobuf::MessageLite& msg,
                           ByteBuffer* bb, bool* own_buffer) {
     return GenericSerialize<ProtoBufferWriter, T>(msg, bb, own_buffer);
@@ -53,6 +57,10 @@ class SerializationTraits<
 
   static Status Deserialize(ByteBuffer* buffer,
                             grpc::protobuf::MessageLite* msg) {
+    Status status;
+    if (internal::MoveMessageObject(buffer, static_cast<T*>(msg), &status)) {
+      return status;
+    }
     return GenericDeserialize<ProtoBufferReader, T>(buffer, msg);
   }
 };
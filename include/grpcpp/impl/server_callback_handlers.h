@@ -87,7 +87,7 @@ class CallbackUnaryHandler : public grpc::internal::MethodHandler {
     RequestType* request = nullptr;
     MessageHolder<RequestType, ResponseType>* allocator_state;
     if (allocator_ != nullptr) {
-      allocator_state = allocator_->AllocateMessages();
+      allocator_state = allocator_->AllocateMessagesForCall(call);
     } else {
       allocator_state = new (grpc_call_arena_alloc(
           call, sizeof(DefaultMessageHolder<RequestType, ResponseType>)))
@@ -138,8 +138,11 @@ class CallbackUnaryHandler : public grpc::internal::MethodHandler {
       }
       // The response is dropped if the status is not OK.
       if (s.ok()) {
-        finish_ops_.ServerSendStatus(&ctx_->trailing_metadata_,
-                                     finish_ops_.SendMessagePtr(response()));
+        finish_ops_.ServerSendStatus(
+            &ctx_->trailing_metadata_,
+            ctx_->serialized_response_.Valid()
+                ? finish_ops_.SendMessage(ctx_->serialized_response_)
+                : finish_ops_.SendMessagePtr(response()));
       } else {
         finish_ops_.ServerSendStatus(&ctx_->trailing_metadata_, s);
       }
@@ -326,8 +329,11 @@ class CallbackClientStreamingHandler : public grpc::internal::MethodHandler {
       }
       // The response is dropped if the status is not OK.
       if (s.ok()) {
-        finish_ops_.ServerSendStatus(&ctx_->trailing_metadata_,
-                                     finish_ops_.SendMessagePtr(&resp_));
+        finish_ops_.ServerSendStatus(
+            &ctx_->trailing_metadata_,
+            ctx_->serialized_response_.Valid()
+                ? finish_ops_.SendMessage(ctx_->serialized_response_)
+                : finish_ops_.SendMessagePtr(&resp_));
       } else {
         finish_ops_.ServerSendStatus(&ctx_->trailing_metadata_, s);
       }
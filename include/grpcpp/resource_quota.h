@@ -54,6 +54,15 @@ class ResourceQuota final : private grpc::internal::GrpcLibrary {
   /// normal course.
   ResourceQuota& SetMaxThreads(int new_max_threads);
 
+  /// EXPERIMENTAL. Set the CPU budget, in cores, of the process using this
+  /// ResourceQuota object.
+  ///
+  /// While the process uses more CPU than this, servers using this
+  /// ResourceQuota reject new calls with RESOURCE_EXHAUSTED rather than queue
+  /// them for the application. Calls that the application is already waiting
+  /// for are not affected. A budget of zero or less is unlimited.
+  ResourceQuota& SetMaxCpu(double max_cores);
+
   grpc_resource_quota* c_resource_quota() const { return impl_; }
 
  private:
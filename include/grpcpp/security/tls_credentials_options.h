@@ -190,6 +190,18 @@ class TlsServerCredentialsOptions final : public TlsCredentialsOptions {
   // Deprecated: This function will be removed in the 1.66 release.
   void set_send_client_ca_list(bool send_client_ca_list);
 
+  // Sets the file holding the keys session tickets are encrypted and decrypted
+  // with. The file holds one or more 80 byte keys back to back, in the format
+  // used by Envoy and nginx, and is read again every minute. New tickets are
+  // encrypted with the first key and tickets encrypted with any of the keys
+  // are accepted, so keys can be rotated by prepending a new key. Servers
+  // sharing the file can resume each other's TLS sessions. If not set, each
+  // server makes up its own key.
+  //
+  // @param tls_session_ticket_key_file_path: Path of the key file.
+  void set_tls_session_ticket_key_file_path(
+      const std::string& tls_session_ticket_key_file_path);
+
  private:
 };
 
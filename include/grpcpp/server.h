@@ -350,6 +350,9 @@ class Server : public ServerInterface, private internal::GrpcLibrary {
   // Whetner per-call load reporting is enabled.
   bool call_metric_recording_enabled_ = false;
 
+  // Whether callback_cq_ runs reactions on the thread completing the op.
+  bool inline_callbacks_ = false;
+
   // Interface to read or update server-wide metrics. Optional.
   experimental::ServerMetricRecorder* server_metric_recorder_ = nullptr;
 };
@@ -228,10 +228,13 @@ class ServerBuilder {
 
   /// Options for synchronous servers.
   enum SyncServerOption {
-    NUM_CQS,         ///< Number of completion queues.
-    MIN_POLLERS,     ///< Minimum number of polling threads.
-    MAX_POLLERS,     ///< Maximum number of polling threads.
-    CQ_TIMEOUT_MSEC  ///< Completion queue timeout in milliseconds.
+    NUM_CQS,          ///< Number of completion queues.
+    MIN_POLLERS,      ///< Minimum number of polling threads.
+    MAX_POLLERS,      ///< Maximum number of polling threads.
+    CQ_TIMEOUT_MSEC,  ///< Completion queue timeout in milliseconds.
+    MIN_WORKERS,      ///< Minimum number of worker threads.
+    MAX_WORKERS       ///< Maximum number of worker threads. If positive,
+                      ///< pollers hand requests to worker threads.
   };
 
   /// Only useful if this is a Synchronous server.
@@ -295,6 +298,38 @@ class ServerBuilder {
     void EnableCallMetricRecording(
         experimental::ServerMetricRecorder* server_metric_recorder = nullptr);
 
+    /// Makes the server open \a num_shards SO_REUSEPORT listening sockets for
+    /// every address it binds instead of a single one, so that accepting
+    /// connections is spread over several accept queues. When \a
+    /// steer_by_cpu is true, each incoming connection is steered to the shard
+    /// matching the CPU that received it. Sets the
+    /// GRPC_ARG_TCP_LISTENER_SHARDS and
+    /// GRPC_ARG_TCP_LISTENER_SHARD_CPU_STEERING channel arguments.
+    void SetListenerShards(int num_shards, bool steer_by_cpu = false);
+
+    /// Configures the server to keep each request on one core where it can:
+    /// a SO_REUSEPORT listener shard per core with connections steered to
+    /// the shard of the CPU that received them (see \a SetListenerShards),
+    /// and callback API reactions run on the EventEngine thread that
+    /// completed the operation instead of being handed to another one. Sets
+    /// the GRPC_ARG_SERVER_INLINE_CALLBACKS channel argument. Reactions must
+    /// not block, since they hold up the I/O of other calls on their thread.
+    void EnableThreadPerCore();
+
+    /// Limits the server to \a max_concurrent_calls calls in flight for each
+    /// method, across all of its connections; calls over the limit fail with
+    /// RESOURCE_EXHAUSTED. If \a tenant_metadata_key is not empty, the
+    /// value of that request header names the tenant of a call, and each
+    /// tenant of a method gets its own limit. If \a latency_target_ms is
+    /// positive, each limit shrinks while calls take longer than that and
+    /// grows back while they are faster. Sets the
+    /// GRPC_ARG_SERVER_MAX_CONCURRENT_CALLS_PER_METHOD,
+    /// GRPC_ARG_SERVER_CONCURRENCY_LIMIT_TENANT_METADATA and
+    /// GRPC_ARG_SERVER_CONCURRENCY_LIMIT_LATENCY_TARGET_MS channel arguments.
+    void SetConcurrencyLimit(int max_concurrent_calls,
+                             const std::string& tenant_metadata_key = "",
+                             int latency_target_ms = 0);
+
     // Creates a passive listener for Server Endpoint injection.
     ///
     /// \a PassiveListener lets applications provide pre-established connections
@@ -408,6 +443,12 @@ class ServerBuilder {
 
     /// The timeout for server completion queue's AsyncNext call.
     int cq_timeout_msec;
+
+    /// Minimum and maximum number of threads per completion queue that
+    /// handle the requests found by the polling threads. When max_workers is
+    /// 0, the polling threads handle them.
+    int min_workers = 0;
+    int max_workers = 0;
   };
 
   int max_receive_message_size_;
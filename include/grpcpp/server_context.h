@@ -31,6 +31,7 @@
 #include <grpcpp/impl/metadata_map.h>
 #include <grpcpp/impl/rpc_service_method.h>
 #include <grpcpp/security/auth_context.h>
+#include <grpcpp/support/byte_buffer.h>
 #include <grpcpp/support/callback_common.h>
 #include <grpcpp/support/config.h>
 #include <grpcpp/support/message_allocator.h>
@@ -262,6 +263,13 @@ class ServerContextBase {
   /// \param algorithm The compression algorithm used for the server call.
   void set_compression_algorithm(grpc_compression_algorithm algorithm);
 
+  /// Set the write priority of the server call. Must be called before initial
+  /// metadata is sent.
+  ///
+  /// \param priority A value between 0 (the default) and
+  /// GRPC_MAX_WRITE_PRIORITY.
+  void set_write_priority(uint32_t priority);
+
   /// Set the serialized load reporting costs in \a cost_data for the call.
   void SetLoadReportingCosts(const std::vector<std::string>& cost_data);
 
@@ -301,6 +309,17 @@ class ServerContextBase {
   /// Returns the call's authority.
   grpc::string_ref ExperimentalGetAuthority() const;
 
+  /// EXPERIMENTAL API
+  /// Send \a response, an already-serialized message, as the response of this
+  /// unary or client-streaming call instead of serializing the response
+  /// message the handler fills in. The slices of \a response are referenced
+  /// rather than copied, so one buffer can be shared by any number of calls.
+  /// Must be called before a sync handler returns, or before a callback
+  /// reactor calls Finish. Has no effect if the call fails.
+  void ExperimentalSetSerializedResponse(const grpc::ByteBuffer& response) {
+    serialized_response_ = response;
+  }
+
  protected:
   /// Async only. Has to be called before the rpc starts.
   /// Returns the tag in completion queue when the rpc finishes.
@@ -490,6 +509,7 @@ class ServerContextBase {
                             grpc::internal::CallOpSendMessage>
       pending_ops_;
   bool has_pending_ops_ = false;
+  grpc::ByteBuffer serialized_response_;
 
   grpc::experimental::ServerRpcInfo* rpc_info_ = nullptr;
   RpcAllocatorState* message_allocator_state_ = nullptr;
@@ -594,6 +614,7 @@ class ServerContext : public ServerContextBase {
   using ServerContextBase::raw_deadline;
   using ServerContextBase::set_compression_algorithm;
   using ServerContextBase::set_compression_level;
+  using ServerContextBase::set_write_priority;
   using ServerContextBase::SetLoadReportingCosts;
   using ServerContextBase::TryCancel;
 
@@ -637,6 +658,7 @@ class CallbackServerContext : public ServerContextBase {
   using ServerContextBase::raw_deadline;
   using ServerContextBase::set_compression_algorithm;
   using ServerContextBase::set_compression_level;
+  using ServerContextBase::set_write_priority;
   using ServerContextBase::set_context_allocator;
   using ServerContextBase::SetLoadReportingCosts;
   using ServerContextBase::TryCancel;
@@ -0,0 +1,142 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPCPP_SUPPORT_ARENA_MESSAGE_ALLOCATOR_H
+#define GRPCPP_SUPPORT_ARENA_MESSAGE_ALLOCATOR_H
+
+#include <grpc/grpc.h>
+#include <grpc/impl/grpc_types.h>
+#include <grpcpp/impl/codegen/config_protobuf.h>
+#include <grpcpp/support/message_allocator.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+
+namespace grpc {
+
+// A MessageAllocator that creates the request and response of each RPC on a
+// protobuf Arena, so that parsing and filling in large messages does not
+// allocate every field separately. The first block of the protobuf arena is
+// carved out of the gRPC call arena, and the protobuf arena is destroyed when
+// the call ends, freeing all of its messages at once.
+//
+// The size of that first block tracks how much memory the messages of recent
+// calls used, in the same way the call arena sizes itself. Since the block is
+// counted as part of the call arena's usage, the call arena's initial size
+// estimate grows to include it, and steady state calls serve both from a
+// single allocation.
+//
+// Register it with the generated SetMessageAllocatorFor_<Method>(). It must
+// outlive the server. FreeRequest() is a no-op: arena messages are only freed
+// with the arena.
+template <typename RequestT, typename ResponseT>
+class ArenaMessageAllocator final
+    : public MessageAllocator<RequestT, ResponseT> {
+  static_assert(std::is_base_of<protobuf::MessageLite, RequestT>::value &&
+                    std::is_base_of<protobuf::MessageLite, ResponseT>::value,
+                "ArenaMessageAllocator requires protobuf messages");
+
+ public:
+  explicit ArenaMessageAllocator(size_t initial_block_size = 1024)
+      : block_size_estimate_(initial_block_size) {}
+
+  MessageHolder<RequestT, ResponseT>* AllocateMessages() override {
+    return new Holder(this, nullptr, 0, /*in_call_arena=*/false);
+  }
+
+  MessageHolder<RequestT, ResponseT>* AllocateMessagesForCall(
+      grpc_call* call) override {
+    const size_t block_size = BlockSizeEstimate();
+    char* memory = static_cast<char*>(
+        grpc_call_arena_alloc(call, kHolderSize + block_size));
+    return new (memory)
+        Holder(this, memory + kHolderSize, block_size, /*in_call_arena=*/true);
+  }
+
+  // Size of the first protobuf arena block that the next call will use.
+  size_t BlockSizeEstimate() const {
+    // Round up to the next multiple of kRoundUpSize, as the call arena does:
+    // this keeps allocation sizes stable while the estimate drifts, and leaves
+    // some room for growth before the protobuf arena needs another block.
+    static constexpr size_t kRoundUpSize = 256;
+    return (block_size_estimate_.load(std::memory_order_relaxed) +
+            2 * kRoundUpSize) &
+           ~(kRoundUpSize - 1);
+  }
+
+ private:
+  class Holder final : public MessageHolder<RequestT, ResponseT> {
+   public:
+    Holder(ArenaMessageAllocator* allocator, char* initial_block,
+           size_t initial_block_size, bool in_call_arena)
+        : allocator_(allocator),
+          in_call_arena_(in_call_arena),
+          arena_(MakeOptions(initial_block, initial_block_size)) {
+      this->set_request(protobuf::Arena::Create<RequestT>(&arena_));
+      this->set_response(protobuf::Arena::Create<ResponseT>(&arena_));
+    }
+
+    void Release() override {
+      allocator_->UpdateBlockSizeEstimate(arena_.SpaceUsed());
+      if (in_call_arena_) {
+        // The memory belongs to the call arena.
+        this->~Holder();
+      } else {
+        delete this;
+      }
+    }
+
+   private:
+    static protobuf::ArenaOptions MakeOptions(char* initial_block,
+                                              size_t initial_block_size) {
+      protobuf::ArenaOptions options;
+      options.initial_block = initial_block;
+      options.initial_block_size = initial_block_size;
+      return options;
+    }
+
+    ArenaMessageAllocator* const allocator_;
+    const bool in_call_arena_;
+    protobuf::Arena arena_;
+  };
+
+  // The protobuf arena block follows the holder; keep it suitably aligned.
+  static constexpr size_t kHolderSize =
+      (sizeof(Holder) + alignof(std::max_align_t) - 1) &
+      ~(alignof(std::max_align_t) - 1);
+
+  void UpdateBlockSizeEstimate(size_t size) {
+    size_t cur = block_size_estimate_.load(std::memory_order_relaxed);
+    if (cur < size) {
+      // Grow straight to the new size.
+      block_size_estimate_.compare_exchange_weak(
+          cur, size, std::memory_order_relaxed, std::memory_order_relaxed);
+    } else if (cur > size && cur > 0) {
+      // Shrink slowly.
+      block_size_estimate_.compare_exchange_weak(
+          cur, std::min(cur - 1, (255 * cur + size) / 256),
+          std::memory_order_relaxed, std::memory_order_relaxed);
+    }
+    // If a compare_exchange loses, a later call will update the estimate.
+  }
+
+  std::atomic<size_t> block_size_estimate_;
+};
+
+}  // namespace grpc
+
+#endif  // GRPCPP_SUPPORT_ARENA_MESSAGE_ALLOCATOR_H
@@ -53,6 +53,12 @@ class ExternalConnectionAcceptorImpl;
 template <class R>
 class DeserializeFuncType;
 class GrpcByteBufferPeer;
+class MessageObject;
+
+// If source carries a message object, serialize the message into dest and
+// return true.
+bool MaterializeMessageObject(ByteBuffer* source, ByteBuffer* dest,
+                              Status* status);
 
 }  // namespace internal
 /// A sequence of bytes.
@@ -180,6 +186,7 @@ class ByteBuffer final {
   friend class ProtoBufferReader;
   friend class ProtoBufferWriter;
   friend class internal::GrpcByteBufferPeer;
+  friend class internal::MessageObject;
   friend class internal::ExternalConnectionAcceptorImpl;
 
   grpc_byte_buffer* buffer_;
@@ -217,6 +224,10 @@ template <>
 class SerializationTraits<ByteBuffer, void> {
  public:
   static Status Deserialize(ByteBuffer* byte_buffer, ByteBuffer* dest) {
+    Status status;
+    if (internal::MaterializeMessageObject(byte_buffer, dest, &status)) {
+      return status;
+    }
     dest->set_buffer(byte_buffer->buffer_);
     return Status::OK;
   }
@@ -144,6 +144,24 @@ class ClientRpcInfo {
     interceptors_[pos]->Intercept(interceptor_methods);
   }
 
+  // Returns true if the interceptor at pos \a pos wants to see a batch with
+  // the hook points in \a hook_points.
+  bool InterceptorWantsHookPoints(size_t pos, uint32_t hook_points) const {
+    return (interceptor_hook_points_[pos] & hook_points) != 0;
+  }
+
+  void AddInterceptor(experimental::Interceptor* interceptor) {
+    // Null interceptors from the global factories keep the full mask so that
+    // they fail the same way they always have.
+    const uint32_t hook_points = interceptor == nullptr
+                                     ? experimental::kAllInterceptionHookPoints
+                                     : interceptor->InterceptionHookPointMask();
+    interceptors_.push_back(
+        std::unique_ptr<experimental::Interceptor>(interceptor));
+    interceptor_hook_points_.push_back(hook_points);
+    hook_points_ |= hook_points;
+  }
+
   void RegisterInterceptors(
       const std::vector<std::unique_ptr<
           experimental::ClientInterceptorFactoryInterface>>& creators,
@@ -159,9 +177,8 @@ class ClientRpcInfo {
       return;
     }
     if (internal::g_global_client_stats_interceptor_factory != nullptr) {
-      interceptors_.push_back(std::unique_ptr<experimental::Interceptor>(
-          internal::g_global_client_stats_interceptor_factory
-              ->CreateClientInterceptor(this)));
+      AddInterceptor(internal::g_global_client_stats_interceptor_factory
+                         ->CreateClientInterceptor(this));
       --interceptor_pos;
     }
     // NOTE: The following is not a range-based for loop because it will only
@@ -170,14 +187,12 @@ class ClientRpcInfo {
          ++it) {
       auto* interceptor = (*it)->CreateClientInterceptor(this);
       if (interceptor != nullptr) {
-        interceptors_.push_back(
-            std::unique_ptr<experimental::Interceptor>(interceptor));
+        AddInterceptor(interceptor);
       }
     }
     if (internal::g_global_client_interceptor_factory != nullptr) {
-      interceptors_.push_back(std::unique_ptr<experimental::Interceptor>(
-          internal::g_global_client_interceptor_factory
-              ->CreateClientInterceptor(this)));
+      AddInterceptor(internal::g_global_client_interceptor_factory
+                         ->CreateClientInterceptor(this));
     }
   }
 
@@ -188,6 +203,9 @@ class ClientRpcInfo {
   const char* suffix_for_stats_ = nullptr;
   grpc::ChannelInterface* channel_ = nullptr;
   std::vector<std::unique_ptr<experimental::Interceptor>> interceptors_;
+  // Hook point mask of each entry of interceptors_, and their union.
+  std::vector<uint32_t> interceptor_hook_points_;
+  uint32_t hook_points_ = 0;
   bool hijacked_ = false;
   size_t hijacked_interceptor_ = 0;
 
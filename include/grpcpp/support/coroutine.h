@@ -0,0 +1,494 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#ifndef GRPCPP_SUPPORT_COROUTINE_H
+#define GRPCPP_SUPPORT_COROUTINE_H
+
+// C++20 coroutine layer over the callback API. Only available when the
+// including translation unit is compiled as C++20 with coroutine support; the
+// library itself does not depend on it.
+//
+// Client calls:
+//
+//   grpc::Status status = co_await grpc::experimental::UnaryCall(
+//       [&](std::function<void(grpc::Status)> done) {
+//         stub->async()->SayHello(&context, &request, &reply, std::move(done));
+//       });
+//
+//   grpc::experimental::ClientReaderCoroutine<Feature> reader;
+//   stub->async()->ListFeatures(&context, &rect, &reader);
+//   while (co_await reader.Read(&feature)) { ... }
+//   grpc::Status status = co_await reader.Finish();
+//
+// Server handlers:
+//
+//   grpc::ServerUnaryReactor* SayHello(grpc::CallbackServerContext* context,
+//                                      const HelloRequest* request,
+//                                      HelloReply* reply) override {
+//     return grpc::experimental::RunUnaryCoroutine(
+//         context, HandleSayHello(request, reply));
+//   }
+//
+// where HandleSayHello returns grpc::experimental::Task<grpc::Status>.
+//
+// Each awaiter lives in the frame of the coroutine awaiting it, so an awaited
+// operation costs no allocation beyond what the callback API itself makes.
+// Coroutines are resumed inline from the reactions of the callback API, so
+// they must not block, exactly like reactions.
+
+#if defined(__cpp_impl_coroutine) && __cplusplus >= 202002L
+
+#include <grpcpp/server_context.h>
+#include <grpcpp/support/client_callback.h>
+#include <grpcpp/support/server_callback.h>
+#include <grpcpp/support/status.h>
+
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <utility>
+
+namespace grpc {
+namespace experimental {
+
+template <typename T = void>
+class Task;
+
+namespace internal {
+
+template <typename T>
+class TaskPromiseBase {
+ public:
+  std::suspend_always initial_suspend() noexcept { return {}; }
+  auto final_suspend() noexcept {
+    struct FinalAwaiter {
+      bool await_ready() noexcept { return false; }
+      std::coroutine_handle<> await_suspend(
+          std::coroutine_handle<> /*self*/) noexcept {
+        return continuation;
+      }
+      void await_resume() noexcept {}
+      std::coroutine_handle<> continuation;
+    };
+    return FinalAwaiter{continuation_};
+  }
+  void unhandled_exception() noexcept { std::terminate(); }
+  void set_continuation(std::coroutine_handle<> continuation) {
+    continuation_ = continuation;
+  }
+
+ private:
+  std::coroutine_handle<> continuation_ = std::noop_coroutine();
+};
+
+template <typename T>
+class TaskPromise : public TaskPromiseBase<T> {
+ public:
+  Task<T> get_return_object() noexcept;
+  template <typename U>
+  void return_value(U&& value) {
+    value_.emplace(std::forward<U>(value));
+  }
+  T TakeResult() { return std::move(*value_); }
+
+ private:
+  std::optional<T> value_;
+};
+
+template <>
+class TaskPromise<void> : public TaskPromiseBase<void> {
+ public:
+  Task<void> get_return_object() noexcept;
+  void return_void() noexcept {}
+  void TakeResult() {}
+};
+
+// A coroutine that starts right away and frees itself when it finishes.
+struct DetachedCoroutine {
+  struct promise_type {
+    DetachedCoroutine get_return_object() noexcept { return {}; }
+    std::suspend_never initial_suspend() noexcept { return {}; }
+    std::suspend_never final_suspend() noexcept { return {}; }
+    void return_void() noexcept {}
+    void unhandled_exception() noexcept { std::terminate(); }
+  };
+};
+
+// Runs task to completion, then passes its result to on_done.
+template <typename T, typename F>
+DetachedCoroutine Detach(Task<T> task, F on_done) {
+  on_done(co_await std::move(task));
+}
+
+// Keeps the body of a server coroutine reactor, a callable that may hold the
+// coroutine's state in its captures, alive for as long as the reactor.
+class CoroutineBody {
+ public:
+  virtual ~CoroutineBody() = default;
+};
+
+template <typename Body>
+class CoroutineBodyImpl final : public CoroutineBody {
+ public:
+  explicit CoroutineBodyImpl(Body body) : body_(std::move(body)) {}
+  Body& body() { return body_; }
+
+ private:
+  Body body_;
+};
+
+// Awaits one operation of a callback reactor: the reactor stores the waiting
+// coroutine with Suspend() and hands the result of the operation to Resume()
+// from the matching reaction.
+template <typename Result>
+class ReactorOp {
+ public:
+  void Suspend(std::coroutine_handle<> waiter) { waiter_ = waiter; }
+  void Resume(Result result) {
+    result_ = std::move(result);
+    std::exchange(waiter_, nullptr).resume();
+  }
+  Result TakeResult() { return std::move(result_); }
+
+ private:
+  std::coroutine_handle<> waiter_;
+  Result result_{};
+};
+
+// The awaiter returned by the operations of the coroutine reactors. start is
+// called once the coroutine is suspended and must be the last thing to touch
+// the coroutine's frame, since the operation may complete, and resume the
+// coroutine on another thread, before it returns.
+template <typename Result, typename Start>
+class ReactorOpAwaiter {
+ public:
+  ReactorOpAwaiter(ReactorOp<Result>* op, Start start)
+      : op_(op), start_(std::move(start)) {}
+
+  bool await_ready() noexcept { return false; }
+  void await_suspend(std::coroutine_handle<> waiter) {
+    op_->Suspend(waiter);
+    start_();
+  }
+  Result await_resume() { return op_->TakeResult(); }
+
+ private:
+  ReactorOp<Result>* op_;
+  Start start_;
+};
+
+template <typename Result, typename Start>
+ReactorOpAwaiter<Result, Start> AwaitReactorOp(ReactorOp<Result>* op,
+                                               Start start) {
+  return ReactorOpAwaiter<Result, Start>(op, std::move(start));
+}
+
+// State shared by the client coroutine reactors. The call is started by the
+// first operation, with a hold that Finish() releases so that OnDone, and so
+// the end of the call, cannot come before the coroutine asks for the status.
+class ClientCoroutineState {
+ public:
+  template <typename Reactor>
+  void MaybeStartCall(Reactor* reactor) {
+    if (started_.exchange(true, std::memory_order_relaxed)) return;
+    reactor->AddHold();
+    reactor->StartCall();
+  }
+
+  template <typename Reactor>
+  auto Finish(Reactor* reactor) {
+    return AwaitReactorOp(&done_, [this, reactor] {
+      if (started_.exchange(true, std::memory_order_relaxed)) {
+        reactor->RemoveHold();
+      } else {
+        reactor->StartCall();
+      }
+    });
+  }
+
+  void OnDone(const grpc::Status& s) { done_.Resume(s); }
+
+ private:
+  std::atomic<bool> started_{false};
+  ReactorOp<grpc::Status> done_;
+};
+
+}  // namespace internal
+
+// A lazily started coroutine returning T. Awaiting it runs it, and resumes the
+// awaiting coroutine once it completes.
+template <typename T>
+class Task {
+ public:
+  using promise_type = internal::TaskPromise<T>;
+
+  Task(Task&& other) noexcept
+      : handle_(std::exchange(other.handle_, nullptr)) {}
+  Task& operator=(Task&& other) noexcept {
+    if (this != &other) {
+      if (handle_) handle_.destroy();
+      handle_ = std::exchange(other.handle_, nullptr);
+    }
+    return *this;
+  }
+  Task(const Task&) = delete;
+  Task& operator=(const Task&) = delete;
+  ~Task() {
+    if (handle_) handle_.destroy();
+  }
+
+  auto operator co_await() && noexcept {
+    struct Awaiter {
+      bool await_ready() noexcept { return false; }
+      std::coroutine_handle<> await_suspend(
+          std::coroutine_handle<> continuation) noexcept {
+        handle.promise().set_continuation(continuation);
+        return handle;
+      }
+      T await_resume() { return handle.promise().TakeResult(); }
+      std::coroutine_handle<promise_type> handle;
+    };
+    return Awaiter{handle_};
+  }
+
+ private:
+  friend promise_type;
+  explicit Task(std::coroutine_handle<promise_type> handle) : handle_(handle) {}
+
+  std::coroutine_handle<promise_type> handle_;
+};
+
+namespace internal {
+
+template <typename T>
+Task<T> TaskPromise<T>::get_return_object() noexcept {
+  return Task<T>(std::coroutine_handle<TaskPromise<T>>::from_promise(*this));
+}
+
+inline Task<void> TaskPromise<void>::get_return_object() noexcept {
+  return Task<void>(
+      std::coroutine_handle<TaskPromise<void>>::from_promise(*this));
+}
+
+}  // namespace internal
+
+/// Awaits a unary call made through a stub's callback API. \a start is called
+/// with the completion callback to pass to the stub, and the awaiting
+/// coroutine is resumed with the status of the call.
+template <typename Start>
+auto UnaryCall(Start start) {
+  class Awaiter {
+   public:
+    explicit Awaiter(Start start) : start_(std::move(start)) {}
+    bool await_ready() noexcept { return false; }
+    void await_suspend(std::coroutine_handle<> waiter) {
+      start_(std::function<void(grpc::Status)>(
+          [this, waiter](grpc::Status s) {
+            status_ = std::move(s);
+            waiter.resume();
+          }));
+    }
+    grpc::Status await_resume() { return std::move(status_); }
+
+   private:
+    Start start_;
+    grpc::Status status_;
+  };
+  return Awaiter(std::move(start));
+}
+
+/// The reactor of a server-streaming call awaited from a coroutine. Pass it to
+/// the stub like any other reactor, then await Read() until it returns false
+/// and await Finish() for the status. It must outlive the awaited Finish().
+template <class Response>
+class ClientReaderCoroutine final
+    : public grpc::ClientReadReactor<Response> {
+ public:
+  /// Reads the next message into \a msg; resumes with false once the stream
+  /// has ended.
+  auto Read(Response* msg) {
+    return internal::AwaitReactorOp(&read_, [this, msg] {
+      state_.MaybeStartCall(this);
+      this->StartRead(msg);
+    });
+  }
+  /// Resumes with the status of the call.
+  auto Finish() { return state_.Finish(this); }
+
+  void OnReadDone(bool ok) override { read_.Resume(ok); }
+  void OnDone(const grpc::Status& s) override { state_.OnDone(s); }
+
+ private:
+  internal::ClientCoroutineState state_;
+  internal::ReactorOp<bool> read_;
+};
+
+/// The reactor of a client-streaming call awaited from a coroutine. Await
+/// Write() for each message, then WritesDone() and Finish().
+template <class Request>
+class ClientWriterCoroutine final
+    : public grpc::ClientWriteReactor<Request> {
+ public:
+  /// Writes \a msg, which must stay alive until the write resumes; resumes
+  /// with false if the stream is broken.
+  auto Write(const Request* msg,
+             grpc::WriteOptions options = grpc::WriteOptions()) {
+    return internal::AwaitReactorOp(&write_, [this, msg, options] {
+      state_.MaybeStartCall(this);
+      this->StartWrite(msg, options);
+    });
+  }
+  /// Half-closes the stream.
+  auto WritesDone() {
+    return internal::AwaitReactorOp(&write_, [this] {
+      state_.MaybeStartCall(this);
+      this->StartWritesDone();
+    });
+  }
+  /// Resumes with the status of the call.
+  auto Finish() { return state_.Finish(this); }
+
+  void OnWriteDone(bool ok) override { write_.Resume(ok); }
+  void OnWritesDoneDone(bool ok) override { write_.Resume(ok); }
+  void OnDone(const grpc::Status& s) override { state_.OnDone(s); }
+
+ private:
+  internal::ClientCoroutineState state_;
+  internal::ReactorOp<bool> write_;
+};
+
+/// The reactor of a bidi-streaming call awaited from a coroutine. One
+/// coroutine awaits one operation at a time; to read and write at once, await
+/// them from two coroutines.
+template <class Request, class Response>
+class ClientReaderWriterCoroutine final
+    : public grpc::ClientBidiReactor<Request, Response> {
+ public:
+  auto Read(Response* msg) {
+    return internal::AwaitReactorOp(&read_, [this, msg] {
+      state_.MaybeStartCall(this);
+      this->StartRead(msg);
+    });
+  }
+  auto Write(const Request* msg,
+             grpc::WriteOptions options = grpc::WriteOptions()) {
+    return internal::AwaitReactorOp(&write_, [this, msg, options] {
+      state_.MaybeStartCall(this);
+      this->StartWrite(msg, options);
+    });
+  }
+  auto WritesDone() {
+    return internal::AwaitReactorOp(&write_, [this] {
+      state_.MaybeStartCall(this);
+      this->StartWritesDone();
+    });
+  }
+  auto Finish() { return state_.Finish(this); }
+
+  void OnReadDone(bool ok) override { read_.Resume(ok); }
+  void OnWriteDone(bool ok) override { write_.Resume(ok); }
+  void OnWritesDoneDone(bool ok) override { write_.Resume(ok); }
+  void OnDone(const grpc::Status& s) override { state_.OnDone(s); }
+
+ private:
+  internal::ClientCoroutineState state_;
+  internal::ReactorOp<bool> read_;
+  internal::ReactorOp<bool> write_;
+};
+
+/// Runs \a handler as the body of a unary method of a callback service, and
+/// finishes the call with the status it returns. Return the result from the
+/// method.
+inline grpc::ServerUnaryReactor* RunUnaryCoroutine(
+    grpc::CallbackServerContext* context, Task<grpc::Status> handler) {
+  grpc::ServerUnaryReactor* reactor = context->DefaultReactor();
+  internal::Detach(std::move(handler), [reactor](grpc::Status s) {
+    reactor->Finish(std::move(s));
+  });
+  return reactor;
+}
+
+/// The reactor of a server-streaming method whose body is a coroutine. Return
+/// `new ServerWriterCoroutine<Response>(body)` from the method, where \a body
+/// takes the reactor and returns a Task<grpc::Status>; the call is finished
+/// with that status, and the reactor deletes itself once it is done. The
+/// reactor keeps \a body, and so anything it captures, until then.
+template <class Response>
+class ServerWriterCoroutine final : public grpc::ServerWriteReactor<Response> {
+ public:
+  template <typename Body>
+  explicit ServerWriterCoroutine(Body body) {
+    auto* stored = new internal::CoroutineBodyImpl<Body>(std::move(body));
+    body_.reset(stored);
+    internal::Detach(stored->body()(*this),
+                     [this](grpc::Status s) { this->Finish(std::move(s)); });
+  }
+
+  /// Writes \a msg, which must stay alive until the write resumes; resumes
+  /// with false if the call was cancelled.
+  auto Write(const Response* msg,
+             grpc::WriteOptions options = grpc::WriteOptions()) {
+    return internal::AwaitReactorOp(
+        &write_, [this, msg, options] { this->StartWrite(msg, options); });
+  }
+
+  void OnWriteDone(bool ok) override { write_.Resume(ok); }
+  void OnDone() override { delete this; }
+
+ private:
+  std::unique_ptr<internal::CoroutineBody> body_;
+  internal::ReactorOp<bool> write_;
+};
+
+/// The reactor of a client-streaming method whose body is a coroutine, used
+/// like ServerWriterCoroutine.
+template <class Request>
+class ServerReaderCoroutine final : public grpc::ServerReadReactor<Request> {
+ public:
+  template <typename Body>
+  explicit ServerReaderCoroutine(Body body) {
+    auto* stored = new internal::CoroutineBodyImpl<Body>(std::move(body));
+    body_.reset(stored);
+    internal::Detach(stored->body()(*this),
+                     [this](grpc::Status s) { this->Finish(std::move(s)); });
+  }
+
+  /// Reads the next message into \a msg; resumes with false once the client
+  /// has half-closed the stream.
+  auto Read(Request* msg) {
+    return internal::AwaitReactorOp(&read_,
+                                    [this, msg] { this->StartRead(msg); });
+  }
+
+  void OnReadDone(bool ok) override { read_.Resume(ok); }
+  void OnDone() override { delete this; }
+
+ private:
+  std::unique_ptr<internal::CoroutineBody> body_;
+  internal::ReactorOp<bool> read_;
+};
+
+}  // namespace experimental
+}  // namespace grpc
+
+#endif  // defined(__cpp_impl_coroutine) && __cplusplus >= 202002L
+
+#endif  // GRPCPP_SUPPORT_COROUTINE_H
@@ -25,6 +25,7 @@
 #include <grpcpp/support/config.h>
 #include <grpcpp/support/string_ref.h>
 
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <string>
@@ -80,6 +81,21 @@ enum class InterceptionHookPoints {
   NUM_INTERCEPTION_HOOKS
 };
 
+/// Returns the bit that represents \a type in an interception hook point
+/// mask (see Interceptor::InterceptionHookPointMask).
+constexpr uint32_t InterceptionHookPointBit(InterceptionHookPoints type) {
+  return uint32_t{1} << static_cast<uint32_t>(type);
+}
+
+/// A mask containing every interception hook point.
+constexpr uint32_t kAllInterceptionHookPoints =
+    (uint32_t{1} << static_cast<uint32_t>(
+         InterceptionHookPoints::NUM_INTERCEPTION_HOOKS)) -
+    1;
+static_assert(static_cast<uint32_t>(
+                  InterceptionHookPoints::NUM_INTERCEPTION_HOOKS) < 32,
+              "interception hook points must fit in a uint32_t mask");
+
 /// Class that is passed as an argument to the \a Intercept method
 /// of the application's \a Interceptor interface implementation. It has five
 /// purposes:
@@ -222,6 +238,19 @@ class Interceptor {
   /// The one public method of an Interceptor interface. Override this to
   /// trigger the desired actions at the hook points described above.
   virtual void Intercept(InterceptorBatchMethods* methods) = 0;
+
+  /// Returns the set of hook points this interceptor needs to see, as a
+  /// bitwise OR of InterceptionHookPointBit() values. The library does not
+  /// call \a Intercept for a batch that contains none of these hook points;
+  /// it proceeds past this interceptor directly, and if no interceptor of the
+  /// RPC is interested in the batch, the interception machinery is skipped
+  /// altogether. The mask is read once, when the interceptor is created, so
+  /// it must not change afterwards. Interceptors that hijack RPCs must
+  /// include PRE_SEND_INITIAL_METADATA. PRE_SEND_CANCEL is delivered
+  /// regardless of the mask. The default covers every hook point.
+  virtual uint32_t InterceptionHookPointMask() const {
+    return kAllInterceptionHookPoints;
+  }
 };
 
 }  // namespace experimental
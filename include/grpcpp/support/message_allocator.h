@@ -19,6 +19,8 @@
 #ifndef GRPCPP_SUPPORT_MESSAGE_ALLOCATOR_H
 #define GRPCPP_SUPPORT_MESSAGE_ALLOCATOR_H
 
+#include <grpc/impl/grpc_types.h>
+
 namespace grpc {
 
 // NOTE: This is an API for advanced users who need custom allocators.
@@ -64,6 +66,13 @@ class MessageAllocator {
  public:
   virtual ~MessageAllocator() = default;
   virtual MessageHolder<RequestT, ResponseT>* AllocateMessages() = 0;
+  // Allocate the messages for an RPC on \a call. Allocators that want to use
+  // memory tied to the call (for example, with grpc_call_arena_alloc()) can
+  // override this; by default the call is ignored.
+  virtual MessageHolder<RequestT, ResponseT>* AllocateMessagesForCall(
+      grpc_call* /*call*/) {
+    return AllocateMessages();
+  }
 };
 
 }  // namespace grpc
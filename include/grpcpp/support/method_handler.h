@@ -69,7 +69,9 @@ void UnaryRunHandlerHelper(const MethodHandler::HandlerParameter& param,
     ops.set_compression_level(param.server_context->compression_level());
   }
   if (status.ok()) {
-    status = ops.SendMessagePtr(rsp);
+    status = param.server_context->serialized_response_.Valid()
+                 ? ops.SendMessage(param.server_context->serialized_response_)
+                 : ops.SendMessagePtr(rsp);
   }
   ops.ServerSendStatus(&param.server_context->trailing_metadata_, status);
   param.call->PerformOps(&ops);
@@ -171,7 +173,10 @@ class ClientStreamingHandler : public grpc::internal::MethodHandler {
       }
     }
     if (status.ok()) {
-      status = ops.SendMessagePtr(&rsp);
+      status =
+          param.server_context->serialized_response_.Valid()
+              ? ops.SendMessage(param.server_context->serialized_response_)
+              : ops.SendMessagePtr(&rsp);
     }
     ops.ServerSendStatus(&param.server_context->trailing_metadata_, status);
     param.call->PerformOps(&ops);
@@ -0,0 +1,186 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#ifndef GRPCPP_SUPPORT_PARALLEL_MESSAGE_PARSER_H
+#define GRPCPP_SUPPORT_PARALLEL_MESSAGE_PARSER_H
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpcpp/impl/serialization_traits.h>
+#include <grpcpp/impl/sync.h>
+#include <grpcpp/support/byte_buffer.h>
+#include <grpcpp/support/status.h>
+
+#include <deque>
+#include <functional>
+#include <memory>
+#include <utility>
+
+namespace grpc {
+namespace experimental {
+
+/// Deserializes the messages of a stream on EventEngine threads, several at a
+/// time, and hands them back in stream order.
+///
+/// A callback reactor normally deserializes each message on the thread that
+/// completes the read, and cannot start the next read until it has done so.
+/// For large messages this limits a stream to the parse throughput of one
+/// core. Streams that want more should be read as raw \a ByteBuffer (for
+/// example through a method marked with \a MarkMethodRawCallback on the
+/// server, or a generic stub on the client) and passed through this class:
+///
+///   void OnReadDone(bool ok) override {
+///     if (!ok) { ... }
+///     if (parser_.Submit(std::move(buffer_))) StartRead(&buffer_);
+///   }
+///
+/// with \a on_ready calling StartRead(&buffer_) once there is room again, and
+/// \a on_parsed doing what OnReadDone would have done with the message.
+///
+/// The library only allows one read per stream at a time, so the reads
+/// themselves still happen one after another. What runs in parallel is the
+/// parsing of up to \a max_outstanding messages that have already been read.
+template <class Message>
+class ParallelMessageParser {
+ public:
+  /// Called in stream order, once per submitted message, with the status of
+  /// its deserialization. \a message is only valid for the duration of the
+  /// call. Calls never overlap.
+  using ParsedCallback = std::function<void(Status status, Message* message)>;
+  /// Called when Submit() returned false and there is room again.
+  using ReadyCallback = std::function<void()>;
+
+  ParallelMessageParser(
+      size_t max_outstanding, ParsedCallback on_parsed, ReadyCallback on_ready,
+      std::shared_ptr<grpc_event_engine::experimental::EventEngine>
+          event_engine =
+              grpc_event_engine::experimental::GetDefaultEventEngine())
+      : state_(std::make_shared<State>(max_outstanding == 0 ? 1
+                                                            : max_outstanding,
+                                       std::move(on_parsed),
+                                       std::move(on_ready))),
+        event_engine_(std::move(event_engine)) {}
+
+  /// Callbacks that have not started yet are dropped once the parser is
+  /// destroyed. It must not be destroyed while a callback runs on another
+  /// thread; reactors usually only finish the RPC after \a on_parsed has seen
+  /// the last message they submitted.
+  ~ParallelMessageParser() {
+    grpc::internal::MutexLock lock(&state_->mu);
+    state_->shutdown = true;
+  }
+
+  ParallelMessageParser(const ParallelMessageParser&) = delete;
+  ParallelMessageParser& operator=(const ParallelMessageParser&) = delete;
+
+  /// Schedules \a buffer, the next message of the stream, for parsing.
+  /// Returns true if the caller may read and submit another message right
+  /// away. Otherwise \a max_outstanding messages are already being parsed or
+  /// waiting to be delivered, and \a on_ready is called when one of them has
+  /// been delivered.
+  bool Submit(ByteBuffer buffer) {
+    auto entry = std::make_shared<Entry>();
+    entry->buffer = std::move(buffer);
+    bool has_room;
+    {
+      grpc::internal::MutexLock lock(&state_->mu);
+      state_->entries.push_back(entry);
+      has_room = state_->entries.size() < state_->max_outstanding;
+      if (!has_room) state_->ready_pending = true;
+    }
+    event_engine_->Run([state = state_, entry = std::move(entry)]() {
+      Status status =
+          SerializationTraits<Message>::Deserialize(&entry->buffer,
+                                                    &entry->message);
+      bool deliver;
+      {
+        grpc::internal::MutexLock lock(&state->mu);
+        entry->status = std::move(status);
+        entry->parsed = true;
+        deliver = !state->delivering;
+        state->delivering = true;
+      }
+      if (deliver) state->Deliver();
+    });
+    return has_room;
+  }
+
+ private:
+  struct Entry {
+    ByteBuffer buffer;
+    Message message;
+    Status status;
+    bool parsed = false;
+  };
+
+  struct State {
+    State(size_t max_outstanding, ParsedCallback on_parsed,
+          ReadyCallback on_ready)
+        : max_outstanding(max_outstanding),
+          on_parsed(std::move(on_parsed)),
+          on_ready(std::move(on_ready)) {}
+
+    // Delivers parsed messages from the front of the queue until it reaches
+    // one that is still being parsed. Only the thread that set \a delivering
+    // runs this, so deliveries never overlap.
+    void Deliver() {
+      while (true) {
+        std::shared_ptr<Entry> entry;
+        bool notify_ready;
+        {
+          grpc::internal::MutexLock lock(&mu);
+          if (shutdown || entries.empty() || !entries.front()->parsed) {
+            delivering = false;
+            return;
+          }
+          entry = std::move(entries.front());
+          entries.pop_front();
+          notify_ready = ready_pending;
+          ready_pending = false;
+        }
+        on_parsed(std::move(entry->status), &entry->message);
+        entry.reset();
+        if (notify_ready) {
+          // on_parsed may have destroyed the parser along with its owner.
+          {
+            grpc::internal::MutexLock lock(&mu);
+            if (shutdown) notify_ready = false;
+          }
+          if (notify_ready) on_ready();
+        }
+      }
+    }
+
+    grpc::internal::Mutex mu;
+    const size_t max_outstanding;
+    const ParsedCallback on_parsed;
+    const ReadyCallback on_ready;
+    std::deque<std::shared_ptr<Entry>> entries ABSL_GUARDED_BY(mu);
+    bool delivering ABSL_GUARDED_BY(mu) = false;
+    bool ready_pending ABSL_GUARDED_BY(mu) = false;
+    bool shutdown ABSL_GUARDED_BY(mu) = false;
+  };
+
+  const std::shared_ptr<State> state_;
+  const std::shared_ptr<grpc_event_engine::experimental::EventEngine>
+      event_engine_;
+};
+
+}  // namespace experimental
+}  // namespace grpc
+
+#endif  // GRPCPP_SUPPORT_PARALLEL_MESSAGE_PARSER_H
@@ -42,6 +42,10 @@ namespace grpc {
 /// The principle is to get one chunk of data at a time from the proto layer,
 /// with options to backup (re-see some bytes) or skip (forward past some bytes)
 ///
+/// Large Cord-typed fields (`bytes` fields with `[ctype = CORD]`) are read
+/// with ReadCord(), which makes the Cord reference the received slices rather
+/// than copying them.
+///
 /// Read more about ZeroCopyInputStream interface here:
 /// https://developers.google.com/protocol-buffers/docs/reference/cpp/google.protobuf.io.zero_copy_stream#ZeroCopyInputStream
 class ProtoBufferReader : public grpc::protobuf::io::ZeroCopyInputStream {
@@ -193,20 +197,22 @@ class ProtoBufferReader : public grpc::protobuf::io::ZeroCopyInputStream {
 
  private:
 #ifdef GRPC_PROTOBUF_CORD_SUPPORT_ENABLED
-  // This function takes ownership of slice and return a newly created Cord off
-  // of it.
+  // This function takes ownership of slice and returns a Cord that references
+  // its memory.
   static absl::Cord MakeCordFromSlice(grpc_slice slice) {
-    // slice_for_cord is created to keep inlined data of the given slice
-    grpc_slice* slice_for_cord = new grpc_slice;
-    *slice_for_cord = slice;
+    absl::string_view data(
+        reinterpret_cast<char*>(GRPC_SLICE_START_PTR(slice)),
+        GRPC_SLICE_LENGTH(slice));
+    if (slice.refcount == nullptr) {
+      // Inlined data lives in the grpc_slice itself, so it cannot be
+      // referenced; it is only a few bytes long, so copy it.
+      return absl::Cord(data);
+    }
+    // The releaser holds the slice's reference, so that the Cord needs no
+    // allocation beyond its external rep.
     return absl::MakeCordFromExternal(
-        absl::string_view(
-            reinterpret_cast<char*>(GRPC_SLICE_START_PTR(*slice_for_cord)),
-            GRPC_SLICE_LENGTH(*slice_for_cord)),
-        [slice_for_cord](absl::string_view /* view */) {
-          grpc_slice_unref(*slice_for_cord);
-          delete slice_for_cord;
-        });
+        data,
+        [slice](absl::string_view /* view */) { grpc_slice_unref(slice); });
   }
 #endif  // GRPC_PROTOBUF_CORD_SUPPORT_ENABLED
 
@@ -50,6 +50,9 @@ const int kProtoBufferWriterMaxBufferLength = 1024 * 1024;
 /// that it can use to serialize the next portion of the message, with the
 /// option to "backup" if more buffer is given than required at the last buffer.
 ///
+/// Large Cord-typed fields are written with WriteCord(), which appends slices
+/// referencing the Cord's memory rather than copying it.
+///
 /// Read more about ZeroCopyOutputStream interface here:
 /// https://developers.google.com/protocol-buffers/docs/reference/cpp/google.protobuf.io.zero_copy_stream#ZeroCopyOutputStream
 class ProtoBufferWriter : public grpc::protobuf::io::ZeroCopyOutputStream {
@@ -0,0 +1,164 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#ifndef GRPCPP_SUPPORT_SERIALIZED_RESPONSE_CACHE_H
+#define GRPCPP_SUPPORT_SERIALIZED_RESPONSE_CACHE_H
+
+#include <grpcpp/impl/serialization_traits.h>
+#include <grpcpp/impl/sync.h>
+#include <grpcpp/support/byte_buffer.h>
+#include <grpcpp/support/slice.h>
+#include <grpcpp/support/status.h>
+
+#include <chrono>
+#include <cstddef>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace grpc {
+namespace experimental {
+
+/// A small cache of serialized responses, keyed by the serialized request,
+/// for methods that return the same response to many callers (configuration,
+/// feature flags and the like).
+///
+/// A hit hands back a ByteBuffer that references the cached slices, ready for
+/// ServerContextBase::ExperimentalSetSerializedResponse, so the response is
+/// neither rebuilt nor serialized again:
+///
+///   grpc::Status GetConfig(grpc::ServerContext* context,
+///                          const ConfigRequest* request,
+///                          ConfigResponse* response) override {
+///     std::string key = cache_.KeyFor(*request);
+///     grpc::ByteBuffer cached;
+///     if (cache_.Lookup(key, &cached)) {
+///       context->ExperimentalSetSerializedResponse(cached);
+///       return grpc::Status::OK;
+///     }
+///     ... fill in *response ...
+///     cache_.Insert(std::move(key), *response);
+///     return grpc::Status::OK;
+///   }
+///
+/// Entries expire \a ttl after they are inserted. Once \a max_entries is
+/// reached, inserting evicts the least recently used entry. All methods are
+/// thread-safe.
+class SerializedResponseCache {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  SerializedResponseCache(size_t max_entries, Clock::duration ttl)
+      : max_entries_(max_entries == 0 ? 1 : max_entries), ttl_(ttl) {}
+
+  SerializedResponseCache(const SerializedResponseCache&) = delete;
+  SerializedResponseCache& operator=(const SerializedResponseCache&) = delete;
+
+  /// Return the cache key for \a request: its serialized bytes. Returns an
+  /// empty string if \a request fails to serialize.
+  template <class Request>
+  static std::string KeyFor(const Request& request) {
+    ByteBuffer buffer;
+    bool own_buffer;
+    if (!SerializationTraits<Request>::Serialize(request, &buffer, &own_buffer)
+             .ok()) {
+      return std::string();
+    }
+    Slice slice;
+    if (!buffer.DumpToSingleSlice(&slice).ok()) return std::string();
+    return std::string(reinterpret_cast<const char*>(slice.begin()),
+                       slice.size());
+  }
+
+  /// If a live entry exists for \a key, point \a response at it and return
+  /// true.
+  bool Lookup(const std::string& key, ByteBuffer* response) {
+    const Clock::time_point now = Clock::now();
+    grpc::internal::MutexLock lock(&mu_);
+    auto it = entries_.find(key);
+    if (it == entries_.end()) return false;
+    if (it->second.expiry <= now) {
+      lru_.erase(it->second.lru_position);
+      entries_.erase(it);
+      return false;
+    }
+    lru_.splice(lru_.begin(), lru_, it->second.lru_position);
+    *response = it->second.response;
+    return true;
+  }
+
+  /// Cache \a response, already serialized, under \a key.
+  void Insert(std::string key, const ByteBuffer& response) {
+    const Clock::time_point expiry = Clock::now() + ttl_;
+    grpc::internal::MutexLock lock(&mu_);
+    auto it = entries_.find(key);
+    if (it != entries_.end()) {
+      it->second.response = response;
+      it->second.expiry = expiry;
+      lru_.splice(lru_.begin(), lru_, it->second.lru_position);
+      return;
+    }
+    if (entries_.size() >= max_entries_) {
+      entries_.erase(lru_.back());
+      lru_.pop_back();
+    }
+    lru_.push_front(key);
+    entries_.emplace(std::move(key), Entry{response, expiry, lru_.begin()});
+  }
+
+  /// Serialize \a response and cache it under \a key.
+  template <class Response>
+  Status Insert(std::string key, const Response& response) {
+    ByteBuffer buffer;
+    bool own_buffer;
+    Status status =
+        SerializationTraits<Response>::Serialize(response, &buffer,
+                                                 &own_buffer);
+    if (!status.ok()) return status;
+    if (!own_buffer) buffer.Duplicate();
+    Insert(std::move(key), buffer);
+    return Status::OK;
+  }
+
+  /// Drop every entry.
+  void Clear() {
+    grpc::internal::MutexLock lock(&mu_);
+    entries_.clear();
+    lru_.clear();
+  }
+
+ private:
+  struct Entry {
+    ByteBuffer response;
+    Clock::time_point expiry;
+    std::list<std::string>::iterator lru_position;
+  };
+
+  const size_t max_entries_;
+  const Clock::duration ttl_;
+  grpc::internal::Mutex mu_;
+  // Keys, most recently used first.
+  std::list<std::string> lru_ ABSL_GUARDED_BY(mu_);
+  std::unordered_map<std::string, Entry> entries_ ABSL_GUARDED_BY(mu_);
+};
+
+}  // namespace experimental
+}  // namespace grpc
+
+#endif  // GRPCPP_SUPPORT_SERIALIZED_RESPONSE_CACHE_H
@@ -105,6 +105,12 @@ class ServerRpcInfo {
     interceptors_[pos]->Intercept(interceptor_methods);
   }
 
+  // Returns true if the interceptor at pos \a pos wants to see a batch with
+  // the hook points in \a hook_points.
+  bool InterceptorWantsHookPoints(size_t pos, uint32_t hook_points) const {
+    return (interceptor_hook_points_[pos] & hook_points) != 0;
+  }
+
   void RegisterInterceptors(
       const std::vector<
           std::unique_ptr<experimental::ServerInterceptorFactoryInterface>>&
@@ -112,8 +118,11 @@ class ServerRpcInfo {
     for (const auto& creator : creators) {
       auto* interceptor = creator->CreateServerInterceptor(this);
       if (interceptor != nullptr) {
+        const uint32_t hook_points = interceptor->InterceptionHookPointMask();
         interceptors_.push_back(
             std::unique_ptr<experimental::Interceptor>(interceptor));
+        interceptor_hook_points_.push_back(hook_points);
+        hook_points_ |= hook_points;
       }
     }
   }
@@ -130,6 +139,9 @@ class ServerRpcInfo {
   const Type type_;
   std::atomic<intptr_t> ref_{1};
   std::vector<std::unique_ptr<experimental::Interceptor>> interceptors_;
+  // Hook point mask of each entry of interceptors_, and their union.
+  std::vector<uint32_t> interceptor_hook_points_;
+  uint32_t hook_points_ = 0;
 
   friend class internal::InterceptorBatchMethodsImpl;
   friend class grpc::ServerContextBase;
@@ -0,0 +1,102 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#ifndef GRPCPP_SUPPORT_SLICE_MESSAGE_H
+#define GRPCPP_SUPPORT_SLICE_MESSAGE_H
+
+#include <grpcpp/impl/serialization_traits.h>
+#include <grpcpp/support/byte_buffer.h>
+#include <grpcpp/support/slice.h>
+#include <grpcpp/support/status.h>
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace grpc {
+namespace experimental {
+
+/// A message that is already serialized, held as a sequence of slices.
+///
+/// Sending a SliceMessage references its slices rather than copying them, so
+/// a precomputed blob (for instance one wrapped in a static slice, or in a
+/// slice with a custom destroy function) can be sent on any number of calls
+/// without a serialization step. Receiving one takes references on the slices
+/// the transport produced instead of flattening them into contiguous memory.
+/// Compressed messages are still decompressed on receipt.
+///
+/// Use it as the request or response type of a generic stub or of a method
+/// registered with a raw handler, wherever ByteBuffer would otherwise be used.
+class SliceMessage final {
+ public:
+  SliceMessage() = default;
+  explicit SliceMessage(Slice slice) { slices_.push_back(std::move(slice)); }
+  explicit SliceMessage(std::vector<Slice> slices)
+      : slices_(std::move(slices)) {}
+
+  /// The slices making up the serialized message, in order.
+  const std::vector<Slice>& slices() const { return slices_; }
+
+  /// Move the slices out, leaving the message empty.
+  std::vector<Slice> TakeSlices() { return std::exchange(slices_, {}); }
+
+  /// Total length of the message in bytes.
+  size_t Length() const {
+    size_t length = 0;
+    for (const Slice& slice : slices_) length += slice.size();
+    return length;
+  }
+
+  void Clear() { slices_.clear(); }
+
+ private:
+  std::vector<Slice> slices_;
+};
+
+}  // namespace experimental
+
+template <>
+class SerializationTraits<experimental::SliceMessage, void> {
+ public:
+  static Status Deserialize(ByteBuffer* byte_buffer,
+                            experimental::SliceMessage* dest) {
+    ByteBuffer materialized;
+    Status status;
+    if (internal::MaterializeMessageObject(byte_buffer, &materialized,
+                                           &status)) {
+      if (!status.ok()) return status;
+      byte_buffer = &materialized;
+    }
+    std::vector<Slice> slices;
+    status = byte_buffer->Dump(&slices);
+    byte_buffer->Clear();
+    if (!status.ok()) return status;
+    *dest = experimental::SliceMessage(std::move(slices));
+    return Status::OK;
+  }
+  static Status Serialize(const experimental::SliceMessage& source,
+                          ByteBuffer* buffer, bool* own_buffer) {
+    *buffer = ByteBuffer(source.slices().data(), source.slices().size());
+    *own_buffer = true;
+    return Status::OK;
+  }
+};
+
+}  // namespace grpc
+
+#endif  // GRPCPP_SUPPORT_SLICE_MESSAGE_H
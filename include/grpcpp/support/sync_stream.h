@@ -141,6 +141,39 @@ class WriterInterface {
   void WriteLast(const W& msg, grpc::WriteOptions options) {
     Write(msg, options.set_last_message());
   }
+
+  /// Block to write the messages in [\a begin, \a end) to the stream with
+  /// WriteOptions \a options. Every message but the last is written with the
+  /// buffer hint set, so that the transport can send the whole batch in one
+  /// flush rather than one flush per message. Only the last message is
+  /// written as the last message when \a options asks for it.
+  ///
+  /// \param begin, end The range of messages to be written to the stream.
+  /// \param options The WriteOptions affecting the write operations.
+  ///
+  /// \return \a true on success, \a false when the stream has been closed.
+  template <class Iterator>
+  bool WriteBatch(Iterator begin, Iterator end, grpc::WriteOptions options) {
+    grpc::WriteOptions buffered_options = options;
+    buffered_options.set_buffer_hint().clear_last_message();
+    while (begin != end) {
+      const W& msg = *begin;
+      if (++begin == end) return Write(msg, options);
+      if (!Write(msg, buffered_options)) return false;
+    }
+    return true;
+  }
+
+  /// Block to write the messages in [\a begin, \a end) to the stream with
+  /// default write options, flushing them together.
+  ///
+  /// \param begin, end The range of messages to be written to the stream.
+  ///
+  /// \return \a true on success, \a false when the stream has been closed.
+  template <class Iterator>
+  bool WriteBatch(Iterator begin, Iterator end) {
+    return WriteBatch(begin, end, grpc::WriteOptions());
+  }
 };
 
 }  // namespace internal
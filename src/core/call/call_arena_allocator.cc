@@ -20,8 +20,58 @@
 
 namespace grpc_core {
 
+namespace {
+// Arenas larger than this are not worth keeping around.
+constexpr size_t kMaxCachedArenaSize = 64 * 1024;
+}  // namespace
+
+CallArenaAllocator::~CallArenaAllocator() {
+  for (ArenaCache& cache : arena_caches_) {
+    MutexLock lock(&cache.mu);
+    while (cache.count > 0) FreeCachedArena(cache.arenas[--cache.count]);
+  }
+}
+
 void CallArenaAllocator::FinalizeArena(Arena* arena) {
   call_size_estimator_.UpdateCallSizeEstimate(arena->TotalUsedBytes());
 }
 
+void CallArenaAllocator::ReleaseArenaStorage(void* storage, size_t size) {
+  if (IsCallArenaRecyclingEnabled() && size <= kMaxCachedArenaSize) {
+    ArenaCache& cache = arena_caches_.this_cpu();
+    MutexLock lock(&cache.mu);
+    if (cache.count < ArenaCache::kMaxArenas) {
+      allocator().Reserve(size);
+      cache.arenas[cache.count++] = CachedArena{storage, size};
+      return;
+    }
+  }
+  ArenaFactory::ReleaseArenaStorage(storage, size);
+}
+
+void* CallArenaAllocator::TakeCachedArena(size_t& size) {
+  CachedArena arena;
+  {
+    ArenaCache& cache = arena_caches_.this_cpu();
+    MutexLock lock(&cache.mu);
+    if (cache.count == 0) return nullptr;
+    arena = cache.arenas[--cache.count];
+  }
+  // Arenas cached before the size estimate moved are dropped, rather than
+  // wasting memory or overflowing into extra zones.
+  if (arena.size < size || arena.size > 2 * size) {
+    FreeCachedArena(arena);
+    return nullptr;
+  }
+  // The new arena charges itself for its initial zone.
+  allocator().Release(arena.size);
+  size = arena.size;
+  return arena.storage;
+}
+
+void CallArenaAllocator::FreeCachedArena(CachedArena arena) {
+  allocator().Release(arena.size);
+  ArenaFactory::ReleaseArenaStorage(arena.storage, arena.size);
+}
+
 }  // namespace grpc_core
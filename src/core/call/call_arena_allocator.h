@@ -18,12 +18,17 @@
 #include <grpc/support/port_platform.h>
 #include <stddef.h>
 
+#include <array>
 #include <atomic>
 #include <cstddef>
 
+#include "absl/base/thread_annotations.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/resource_quota/arena.h"
 #include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/util/per_cpu.h"
 #include "src/core/util/ref_counted.h"
+#include "src/core/util/sync.h"
 
 namespace grpc_core {
 
@@ -73,17 +78,45 @@ class CallArenaAllocator final : public ArenaFactory {
   CallArenaAllocator(MemoryAllocator allocator, size_t initial_size)
       : ArenaFactory(std::move(allocator)),
         call_size_estimator_(initial_size) {}
+  ~CallArenaAllocator() override;
 
   RefCountedPtr<Arena> MakeArena() override {
-    return Arena::Create(call_size_estimator_.CallSizeEstimate(), Ref());
+    size_t size = call_size_estimator_.CallSizeEstimate();
+    if (IsCallArenaRecyclingEnabled()) {
+      void* storage = TakeCachedArena(size);
+      if (storage != nullptr) {
+        return Arena::CreateInStorage(storage, size, Ref());
+      }
+    }
+    return Arena::Create(size, Ref());
   }
 
   void FinalizeArena(Arena* arena) override;
+  void ReleaseArenaStorage(void* storage, size_t size) override;
 
   size_t CallSizeEstimate() { return call_size_estimator_.CallSizeEstimate(); }
 
  private:
+  // Memory of recently destroyed arenas, kept for new calls to reuse while it
+  // is still warm in cache. Cached memory stays charged to the allocator.
+  struct CachedArena {
+    void* storage;
+    size_t size;
+  };
+  struct alignas(GPR_CACHELINE_SIZE) ArenaCache {
+    static constexpr size_t kMaxArenas = 4;
+    Mutex mu;
+    size_t count ABSL_GUARDED_BY(mu) = 0;
+    std::array<CachedArena, kMaxArenas> arenas ABSL_GUARDED_BY(mu);
+  };
+
+  // Take a cached arena suitable for arenas of \a size bytes, and update
+  // \a size to its actual size. Returns nullptr if there is none.
+  void* TakeCachedArena(size_t& size);
+  void FreeCachedArena(CachedArena arena);
+
   CallSizeEstimator call_size_estimator_;
+  PerCpu<ArenaCache> arena_caches_{PerCpuOptions().SetMaxShards(16)};
 };
 
 }  // namespace grpc_core
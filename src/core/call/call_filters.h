@@ -1037,6 +1037,96 @@ struct AddOpImpl<FilterType, T, R (FilterType::Call::*)(T, FilterType*), impl,
   }
 };
 
+// Fused filters (see filter_fusion.h) expose one method per interception
+// point that runs every member filter and resolves to a
+// ServerMetadataOrHandle. Those methods are declared on a base class of the
+// fused filter's Call type.
+template <typename T, typename R>
+class FusedOpPromise {
+ public:
+  explicit FusedOpPromise(R impl) : impl_(std::move(impl)) {}
+
+  Poll<ResultOr<T>> PollOnce() {
+    auto p = impl_();
+    auto* r = p.value_if_ready();
+    if (r == nullptr) return Pending{};
+    auto result = std::move(*r);
+    this->~FusedOpPromise();
+    if (result.ok()) return ResultOr<T>{std::move(result).TakeValue(), nullptr};
+    return ResultOr<T>{nullptr, std::move(result).TakeMetadata()};
+  }
+
+ private:
+  GPR_NO_UNIQUE_ADDRESS R impl_;
+};
+
+// Op must provide a static Start(value, call_data, channel_data) returning
+// the fused promise.
+template <typename Op, typename FilterType, typename T>
+void AddFusedOp(FilterType* channel_data, size_t call_offset, Layout<T>& to) {
+  using Promise =
+      FusedOpPromise<T, decltype(Op::Start(
+                            std::declval<T>(),
+                            std::declval<typename FilterType::Call*>(),
+                            std::declval<FilterType*>()))>;
+  to.Add(sizeof(Promise), alignof(Promise),
+         Operator<T>{
+             channel_data,
+             call_offset,
+             [](void* promise_data, void* call_data, void* channel_data,
+                T value) -> Poll<ResultOr<T>> {
+               auto* promise = new (promise_data) Promise(Op::Start(
+                   std::move(value),
+                   static_cast<typename FilterType::Call*>(call_data),
+                   static_cast<FilterType*>(channel_data)));
+               return promise->PollOnce();
+             },
+             [](void* promise_data) {
+               return static_cast<Promise*>(promise_data)->PollOnce();
+             },
+             [](void* promise_data) {
+               static_cast<Promise*>(promise_data)->~Promise();
+             },
+         });
+}
+
+// PROMISE_RETURNING(ServerMetadataOrHandle<$VALUE_TYPE>)
+// $INTERCEPTOR_NAME($VALUE_HANDLE, FilterType*), declared on a base of Call
+template <typename FilterType, typename T, typename R, typename C,
+          R (C::*impl)(T, FilterType*)>
+struct AddOpImpl<
+    FilterType, T, R (C::*)(T, FilterType*), impl,
+    absl::enable_if_t<
+        std::is_base_of<C, typename FilterType::Call>::value &&
+        std::is_same<ServerMetadataOrHandle<typename T::element_type>,
+                     PromiseResult<R>>::value>> {
+  static R Start(T value, typename FilterType::Call* call_data,
+                 FilterType* channel_data) {
+    return (call_data->*impl)(std::move(value), channel_data);
+  }
+  static void Add(FilterType* channel_data, size_t call_offset, Layout<T>& to) {
+    AddFusedOp<AddOpImpl>(channel_data, call_offset, to);
+  }
+};
+
+// PROMISE_RETURNING(ServerMetadataOrHandle<$VALUE_TYPE>)
+// $INTERCEPTOR_NAME($VALUE_HANDLE), declared on a base of Call
+template <typename FilterType, typename T, typename R, typename C,
+          R (C::*impl)(T)>
+struct AddOpImpl<
+    FilterType, T, R (C::*)(T), impl,
+    absl::enable_if_t<
+        std::is_base_of<C, typename FilterType::Call>::value &&
+        std::is_same<ServerMetadataOrHandle<typename T::element_type>,
+                     PromiseResult<R>>::value>> {
+  static R Start(T value, typename FilterType::Call* call_data, FilterType*) {
+    return (call_data->*impl)(std::move(value));
+  }
+  static void Add(FilterType* channel_data, size_t call_offset, Layout<T>& to) {
+    AddFusedOp<AddOpImpl>(channel_data, call_offset, to);
+  }
+};
+
 struct ChannelDataDestructor {
   void (*destroy)(void* channel_data);
   void* channel_data;
@@ -19,10 +19,35 @@
 #include "absl/functional/any_invocable.h"
 #include "src/core/lib/event_engine/event_engine_context.h"
 #include "src/core/lib/promise/for_each.h"
+#include "src/core/lib/promise/map.h"
+#include "src/core/lib/promise/promise.h"
+#include "src/core/lib/promise/seq.h"
 #include "src/core/lib/promise/try_seq.h"
 
 namespace grpc_core {
 
+namespace {
+
+// Pushes msg from the call of `from` into the call of `to`, and resolves once
+// the call of `to` has taken it. Waiting for that before pulling the next
+// message means a slow reader on one side holds back the writer on the other,
+// instead of the forwarded messages queueing up in between.
+// The push gives up once the call of `to` completes, since nothing will take
+// the message after that, and the wait gives up once the call of `from`
+// completes; the latter resolves to failure, ending the forwarding loop.
+template <typename From, typename To>
+auto ForwardMessage(From from, To to, MessageHandle msg) {
+  return from.UntilCallCompletes(
+      Map(to.SpawnWaitable("forward_message",
+                           [to, msg = std::move(msg)]() mutable {
+                             return to.CancelIfFails(to.UntilCallCompletes(
+                                 to.PushMessage(std::move(msg))));
+                           }),
+          [](Empty) -> StatusFlag { return Success{}; }));
+}
+
+}  // namespace
+
 void ForwardCall(CallHandler call_handler, CallInitiator call_initiator,
                  absl::AnyInvocable<void(ServerMetadata&)>
                      on_server_trailing_metadata_from_initiator) {
@@ -32,11 +57,9 @@ void ForwardCall(CallHandler call_handler, CallInitiator call_initiator,
       "read_messages", [call_handler, call_initiator]() mutable {
         return Seq(
             ForEach(MessagesFrom(call_handler),
-                    [call_initiator](MessageHandle msg) mutable {
-                      // Need to spawn a job into the initiator's activity to
-                      // push the message in.
-                      call_initiator.SpawnPushMessage(std::move(msg));
-                      return Success{};
+                    [call_handler, call_initiator](MessageHandle msg) mutable {
+                      return ForwardMessage(call_handler, call_initiator,
+                                            std::move(msg));
                     }),
             [call_initiator]() mutable { call_initiator.SpawnFinishSends(); });
       });
@@ -55,13 +78,25 @@ void ForwardCall(CallHandler call_handler, CallInitiator call_initiator,
                       has_md,
                       [&call_handler, &call_initiator,
                        md = std::move(md)]() mutable {
-                        call_handler.SpawnPushServerInitialMetadata(
-                            std::move(*md));
-                        return ForEach(
-                            MessagesFrom(call_initiator),
-                            [call_handler](MessageHandle msg) mutable {
-                              call_handler.SpawnPushMessage(std::move(msg));
-                              return Success{};
+                        return Seq(
+                            call_handler.SpawnWaitable(
+                                "push_server_initial_metadata",
+                                [call_handler, md = std::move(*md)]() mutable {
+                                  return call_handler.CancelIfFails(
+                                      Immediate(
+                                          call_handler
+                                              .PushServerInitialMetadata(
+                                                  std::move(md))));
+                                }),
+                            [call_handler, call_initiator]() mutable {
+                              return ForEach(
+                                  MessagesFrom(call_initiator),
+                                  [call_handler, call_initiator](
+                                      MessageHandle msg) mutable {
+                                    return ForwardMessage(call_initiator,
+                                                          call_handler,
+                                                          std::move(msg));
+                                  });
                             });
                       },
                       []() -> StatusFlag { return Success{}; });
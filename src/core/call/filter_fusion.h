@@ -22,6 +22,7 @@
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "absl/log/check.h"
 #include "absl/log/log.h"
@@ -32,10 +33,12 @@
 #include "src/core/call/metadata.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/promise_based_filter.h"
+#include "src/core/lib/promise/promise.h"
 #include "src/core/lib/transport/call_final_info.h"
 #include "src/core/lib/transport/transport.h"
 #include "src/core/util/status_helper.h"
 #include "src/core/util/type_list.h"
+#include "src/core/util/unique_type_name.h"
 
 struct grpc_transport_op;
 
@@ -393,6 +396,37 @@ class AdaptMethod<
   Derived* filter_;
 };
 
+// Overrides for filter methods which take a Hdl<T> type as input and return a
+// (possibly different) Hdl<T> as output: these cannot fail.
+template <typename T, typename Call, Hdl<T> (Call::*method)(Hdl<T>)>
+class AdaptMethod<T, Hdl<T> (Call::*)(Hdl<T>), method> {
+ public:
+  explicit AdaptMethod(Call* call, void* /*filter*/ = nullptr) : call_(call) {}
+  auto operator()(Hdl<T> x) {
+    return Immediate(
+        ServerMetadataOrHandle<T>::Ok((call_->*method)(std::move(x))));
+  }
+
+ private:
+  Call* call_;
+};
+
+template <typename T, typename Call, typename Derived,
+          Hdl<T> (Call::*method)(Hdl<T>, Derived*)>
+class AdaptMethod<T, Hdl<T> (Call::*)(Hdl<T>, Derived*), method> {
+ public:
+  explicit AdaptMethod(Call* call, Derived* filter)
+      : call_(call), filter_(filter) {}
+  auto operator()(Hdl<T> x) {
+    return Immediate(ServerMetadataOrHandle<T>::Ok(
+        (call_->*method)(std::move(x), filter_)));
+  }
+
+ private:
+  Call* call_;
+  Derived* filter_;
+};
+
 // Overrides for filter methods which take a Hdl<T> type or void as input and
 // return a StatusOr<Hdl<T>> type as output
 template <typename T, typename R, typename Call, R (Call::*method)(Hdl<T>)>
@@ -455,6 +489,25 @@ class AdaptMethod<T, R (Call::*)(Hdl<T>, Derived*), method,
   Derived* filter_;
 };
 
+// Overrides for filter methods which take a Hdl<T> and return a promise
+// resolving to a ServerMetadataOrHandle<T>.
+template <typename T, typename R, typename Call, typename Derived,
+          R (Call::*method)(Hdl<T>, Derived*)>
+class AdaptMethod<
+    T, R (Call::*)(Hdl<T>, Derived*), method,
+    absl::enable_if_t<
+        std::is_same<ServerMetadataOrHandle<T>, PromiseResult<R>>::value,
+        void>> {
+ public:
+  explicit AdaptMethod(Call* call, Derived* filter)
+      : call_(call), filter_(filter) {}
+  auto operator()(Hdl<T> x) { return (call_->*method)(std::move(x), filter_); }
+
+ private:
+  Call* call_;
+  Derived* filter_;
+};
+
 // Overrides for filter methods which return a ServerMetadataHandle type as
 // output.
 template <typename T, typename A, typename Call,
@@ -552,7 +605,7 @@ class AdaptOnServerTrailingMetadataMethod<
   void operator()(T& x) {
     absl::Status status = (call_->*method)(x, filter_);
     if (!status.ok()) {
-      x = ServerMetadataFromStatus(status);
+      x = std::move(*CancelledServerMetadataFromStatus(status));
     }
   }
 
@@ -583,7 +636,7 @@ class AdaptOnServerTrailingMetadataMethod<T, absl::Status (Call::*)(A), method,
   void operator()(T& x) {
     absl::Status status = (call_->*method)(x);
     if (!status.ok()) {
-      x = ServerMetadataFromStatus(status);
+      x = std::move(*CancelledServerMetadataFromStatus(status));
     }
   }
 
@@ -617,12 +670,6 @@ struct FilterMethods {
   using Idxs = std::make_index_sequence<sizeof...(filter_methods)>;
 };
 
-template <typename... Filters>
-struct FilterTypes {
-  using Types = Typelist<Filters...>;
-  using Idxs = std::make_index_sequence<sizeof...(Filters)>;
-};
-
 template <std::size_t, typename>
 struct make_reverse_index_sequence_helper;
 
@@ -641,14 +688,6 @@ struct ReverseFilterMethods {
   using Idxs = make_reverse_index_sequence<sizeof...(filter_methods)>;
 };
 
-template <typename... Filters>
-struct ReverseFilterTypes {
-  using Types = Reverse<Filters...>;
-  using Idxs = make_reverse_index_sequence<sizeof...(Filters)>;
-  template <bool forward, auto... filter_methods>
-  struct ForwardOrReverse;
-};
-
 template <bool forward, auto... filter_methods>
 struct ForwardOrReverse;
 
@@ -662,19 +701,6 @@ struct ForwardOrReverse<false, filter_methods...> {
   using OrderMethod = ReverseFilterMethods<filter_methods...>;
 };
 
-template <bool forward, typename... filter_types>
-struct ForwardOrReverseTypes;
-
-template <typename... filter_types>
-struct ForwardOrReverseTypes<true, filter_types...> {
-  using OrderMethod = FilterTypes<filter_types...>;
-};
-
-template <typename... filter_types>
-struct ForwardOrReverseTypes<false, filter_types...> {
-  using OrderMethod = ReverseFilterTypes<filter_types...>;
-};
-
 // Combine the result of a series of filter methods into a single method.
 template <typename Call, typename T, auto filter_method_0,
           auto... filter_methods, size_t I0, size_t... Is>
@@ -695,67 +721,65 @@ auto ExecuteCombined(Call* call, Hdl<T> hdl) {
 }
 
 // Combine the result of a series of filter methods into a single method.
-template <typename Call, typename Derived, typename T, typename Filter0,
-          typename... Filters, auto filter_method_0, auto... filter_methods,
-          size_t I0, size_t... Is>
+// Methods that need their channel are passed the child filter instance that
+// the fused channel created for them.
+template <typename Call, typename Derived, typename T, auto filter_method_0,
+          auto... filter_methods, size_t I0, size_t... Is>
 auto ExecuteCombinedWithChannelAccess(
-    Call* call, Derived* channel, Hdl<T> hdl, Typelist<Filter0, Filters...>,
+    Call* call, Derived* channel, Hdl<T> hdl,
     Valuelist<filter_method_0, filter_methods...>,
     std::index_sequence<I0, Is...>) {
   return TrySeq(AdaptMethod<T, decltype(filter_method_0), filter_method_0>(
                     call->template fused_child<I0>(),
-                    reinterpret_cast<Filter0*>(channel))(std::move(hdl)),
+                    channel->template fused_filter<I0>())(std::move(hdl)),
                 AdaptMethod<T, decltype(filter_methods), filter_methods>(
                     call->template fused_child<Is>(),
-                    reinterpret_cast<Filters*>(channel))...);
+                    channel->template fused_filter<Is>())...);
 }
 
-template <typename FilterMethods, typename FilterTypes, typename Call,
-          typename Derived, typename T>
+template <typename FilterMethods, typename Call, typename Derived, typename T>
 auto ExecuteCombinedWithChannelAccess(Call* call, Derived* channel,
                                       Hdl<T> hdl) {
-  return ExecuteCombinedWithChannelAccess(
-      call, channel, std::move(hdl), typename FilterTypes::Types(),
-      typename FilterMethods::Methods(), typename FilterMethods::Idxs());
+  return ExecuteCombinedWithChannelAccess(call, channel, std::move(hdl),
+                                          typename FilterMethods::Methods(),
+                                          typename FilterMethods::Idxs());
 }
 
 // Combine the result of a series of OnFinalize filter methods into a single
 // method.
-template <typename Call, typename Derived, typename T, typename... Filters,
-          auto... filter_methods, size_t... Is>
+template <typename Call, typename Derived, typename T, auto... filter_methods,
+          size_t... Is>
 void ExecuteCombinedOnFinalizeWithChannelAccess(Call* call, Derived* channel,
                                                 T* call_final_info,
-                                                Typelist<Filters...>,
                                                 Valuelist<filter_methods...>,
                                                 std::index_sequence<Is...>) {
   (AdaptMethod<T, decltype(filter_methods), filter_methods>(
        call->template fused_child<Is>(),
-       reinterpret_cast<Filters*>(channel))(call_final_info),
+       channel->template fused_filter<Is>())(call_final_info),
    ...);
 }
 
 // Combine the result of a series of OnServerTrailingMetadata filter methods
 // into a single method.
-template <typename Call, typename Derived, typename T, typename... Filters,
-          auto... filter_methods, size_t... Is>
+template <typename Call, typename Derived, typename T, auto... filter_methods,
+          size_t... Is>
 void ExecuteCombinedOnServerTrailingMetadataWithChannelAccess(
-    Call* call, Derived* channel, T& metadata, Typelist<Filters...>,
-    Valuelist<filter_methods...>, std::index_sequence<Is...>) {
+    Call* call, Derived* channel, T& metadata, Valuelist<filter_methods...>,
+    std::index_sequence<Is...>) {
   (AdaptOnServerTrailingMetadataMethod<T, decltype(filter_methods),
                                        filter_methods>(
        call->template fused_child<Is>(),
-       reinterpret_cast<Filters*>(channel))(metadata),
+       channel->template fused_filter<Is>())(metadata),
    ...);
 }
 
-template <typename FilterMethods, typename FilterTypes, typename Call,
-          typename Derived, typename T>
+template <typename FilterMethods, typename Call, typename Derived, typename T>
 void ExecuteCombinedOnServerTrailingMetadataWithChannelAccess(Call* call,
                                                               Derived* channel,
                                                               T& metadata) {
   ExecuteCombinedOnServerTrailingMetadataWithChannelAccess(
-      call, channel, metadata, typename FilterTypes::Types(),
-      typename FilterMethods::Methods(), typename FilterMethods::Idxs());
+      call, channel, metadata, typename FilterMethods::Methods(),
+      typename FilterMethods::Idxs());
 }
 
 template <typename Call, typename T, auto... filter_methods, size_t... Is>
@@ -791,13 +815,12 @@ void ExecuteCombinedOnClientToServerHalfClose(Call* call) {
       call, typename FilterMethods::Methods(), typename FilterMethods::Idxs());
 }
 
-template <typename FilterMethods, typename FilterTypes, typename Call,
-          typename Derived, typename T>
+template <typename FilterMethods, typename Call, typename Derived, typename T>
 void ExecuteCombinedWithChannelAccess(Call* call, Derived* channel,
                                       T* call_final_info) {
   ExecuteCombinedOnFinalizeWithChannelAccess(
-      call, channel, call_final_info, typename FilterTypes::Types(),
-      typename FilterMethods::Methods(), typename FilterMethods::Idxs());
+      call, channel, call_final_info, typename FilterMethods::Methods(),
+      typename FilterMethods::Idxs());
 }
 
 #define GRPC_FUSE_METHOD(name, type, forward)                                 \
@@ -821,10 +844,8 @@ void ExecuteCombinedWithChannelAccess(Call* call, Derived* channel,
   class FuseImpl##name<MethodVariant::kChannelAccess, Derived, Filters...> {  \
    public:                                                                    \
     auto name(type x, Derived* channel) {                                     \
-      return ExecuteCombinedWithChannelAccess<                                \
-          typename ForwardOrReverse<forward,                                  \
-                                    &Filters::Call::name...>::OrderMethod,    \
-          typename ForwardOrReverseTypes<forward, Filters...>::OrderMethod>(  \
+      return ExecuteCombinedWithChannelAccess<typename ForwardOrReverse<      \
+          forward, &Filters::Call::name...>::OrderMethod>(                    \
           static_cast<typename Derived::Call*>(this), channel, std::move(x)); \
     }                                                                         \
   };                                                                          \
@@ -840,7 +861,7 @@ template <typename Derived, typename... Filters>
 class FuseImplOnServerTrailingMetadata<MethodVariant::kNoInterceptor, Derived,
                                        Filters...> {
  public:
-  static inline const NoInterceptor name;
+  static inline const NoInterceptor OnServerTrailingMetadata;
 };
 
 template <typename Derived, typename... Filters>
@@ -861,8 +882,7 @@ class FuseImplOnServerTrailingMetadata<MethodVariant::kChannelAccess, Derived,
   void OnServerTrailingMetadata(ServerMetadata& x, Derived* channel) {
     return ExecuteCombinedOnServerTrailingMetadataWithChannelAccess<
         typename ForwardOrReverse<
-            false, &Filters::Call::OnServerTrailingMetadata...>::OrderMethod,
-        typename ForwardOrReverseTypes<false, Filters...>::OrderMethod>(
+            false, &Filters::Call::OnServerTrailingMetadata...>::OrderMethod>(
         static_cast<typename Derived::Call*>(this), channel, x);
   }
 };
@@ -879,7 +899,7 @@ class FuseImplOnClientToServerHalfClose;
 template <typename Derived, typename... Filters>
 class FuseImplOnClientToServerHalfClose<true, Derived, Filters...> {
  public:
-  static inline const NoInterceptor name;
+  static inline const NoInterceptor OnClientToServerHalfClose;
 };
 
 template <typename Derived, typename... Filters>
@@ -903,63 +923,90 @@ GRPC_FUSE_METHOD(OnClientToServerMessage, MessageHandle, true);
 GRPC_FUSE_METHOD(OnServerToClientMessage, MessageHandle, false);
 GRPC_FUSE_METHOD(OnFinalize, const grpc_call_final_info*, true);
 
+#undef GRPC_FUSE_METHOD
+
+// The channel filters of a fused filter, created in stack order.
 template <typename... Filters>
-struct FilterWrapper;
+class FusedChannelFilters {
+ public:
+  static absl::StatusOr<std::unique_ptr<FusedChannelFilters>> Create(
+      const ChannelArgs& args, ChannelFilter::Args filter_args) {
+    auto filters = absl::WrapUnique(new FusedChannelFilters());
+    GRPC_RETURN_IF_ERROR(filters->CreateFilters(
+        args, filter_args, std::index_sequence_for<Filters...>()));
+    return filters;
+  }
 
-template <typename Filter>
-struct FilterWrapper<Filter> {
-  FilterWrapper(const ChannelArgs& args, ChannelFilter::Args filter_args)
-      : filter_(Filter::Create(args, filter_args)) {}
+  template <size_t I>
+  auto* get() const {
+    return std::get<I>(filters_).get();
+  }
 
-  absl::Status status() const { return filter_.status(); }
   bool StartTransportOp(grpc_transport_op* op) {
-    CHECK(filter_.ok());
-    return (*filter_)->StartTransportOp(op);
+    return std::apply(
+        [op](auto&... filters) {
+          return (filters->StartTransportOp(op) || ...);
+        },
+        filters_);
   }
 
   bool GetChannelInfo(const grpc_channel_info* info) {
-    CHECK(filter_.ok());
-    return (*filter_)->GetChannelInfo(info);
+    return std::apply(
+        [info](auto&... filters) {
+          return (filters->GetChannelInfo(info) || ...);
+        },
+        filters_);
   }
 
  private:
-  absl::StatusOr<std::unique_ptr<Filter>> filter_;
-};
-
-template <typename Filter0, typename... Filters>
-struct FilterWrapper<Filter0, Filters...> : public FilterWrapper<Filters...> {
-  FilterWrapper(const ChannelArgs& args, ChannelFilter::Args filter_args)
-      : filter0_(Filter0::Create(args, filter_args)),
-        FilterWrapper<Filters...>(args, filter_args) {}
-
-  absl::Status status() const {
-    if (filter0_.ok()) {
-      return FilterWrapper<Filters...>::status();
-    }
-    return filter0_.status();
+  FusedChannelFilters() = default;
+
+  template <size_t... Is>
+  absl::Status CreateFilters(const ChannelArgs& args,
+                             ChannelFilter::Args filter_args,
+                             std::index_sequence<Is...>) {
+    absl::Status status;
+    // Stop at the first filter that fails to create.
+    ((status.ok() ? (status = CreateFilter<Is>(args, filter_args)) : status),
+     ...);
+    return status;
   }
 
-  bool StartTransportOp(grpc_transport_op* op) {
-    CHECK(filter0_.ok());
-    return (*filter0_)->StartTransportOp(op) ||
-           FilterWrapper<Filters...>::StartTransportOp(op);
+  template <size_t I>
+  absl::Status CreateFilter(const ChannelArgs& args,
+                            ChannelFilter::Args filter_args) {
+    using Filter = std::tuple_element_t<I, std::tuple<Filters...>>;
+    auto filter = Filter::Create(args, filter_args);
+    if (!filter.ok()) return filter.status();
+    std::get<I>(filters_) = std::move(*filter);
+    return absl::OkStatus();
   }
 
-  bool GetChannelInfo(const grpc_channel_info* info) {
-    CHECK(filter0_.ok());
-    return (*filter0_)->GetChannelInfo(info) ||
-           FilterWrapper<Filters...>::GetChannelInfo(info);
-  }
+  std::tuple<std::unique_ptr<Filters>...> filters_;
+};
 
- private:
-  absl::StatusOr<std::unique_ptr<Filter0>> filter0_;
+// Per call state of one filter within a fused filter. Call types that need
+// their channel to be constructed are handed the child filter instance.
+template <typename Filter, typename = void>
+struct FusedChildCall {
+  explicit FusedChildCall(Filter* /*filter*/) {}
+  typename Filter::Call call;
 };
 
-#undef GRPC_FUSE_METHOD
+template <typename Filter>
+struct FusedChildCall<Filter,
+                      absl::void_t<decltype(typename Filter::Call(
+                          static_cast<Filter*>(nullptr)))>> {
+  explicit FusedChildCall(Filter* filter) : call(filter) {}
+  typename Filter::Call call;
+};
 
+// A single filter that runs Filters in order. Each interception point of the
+// fused call is one statically typed function that calls straight into every
+// filter's method, so the call stack sees one filter instead of one per
+// member, and the compiler can inline across filter boundaries.
 template <typename... Filters>
-class FusedFilter : public ImplementChannelFilter<FusedFilter<Filters...>>,
-                    public Filters... {
+class FusedFilter : public ImplementChannelFilter<FusedFilter<Filters...>> {
  public:
   static const grpc_channel_filter kFilter;
 
@@ -972,21 +1019,31 @@ class FusedFilter : public ImplementChannelFilter<FusedFilter<Filters...>>,
 
   static absl::StatusOr<std::unique_ptr<FusedFilter<Filters...>>> Create(
       const ChannelArgs& args, ChannelFilter::Args filter_args) {
-    auto filters_wrapper =
-        std::make_unique<FilterWrapper<Filters...>>(args, filter_args);
-    GRPC_RETURN_IF_ERROR(filters_wrapper->status());
+    auto filters = FusedChannelFilters<Filters...>::Create(args, filter_args);
+    GRPC_RETURN_IF_ERROR(filters.status());
     return absl::WrapUnique<FusedFilter<Filters...>>(
-        new FusedFilter<Filters...>(std::move(filters_wrapper)));
+        new FusedFilter<Filters...>(std::move(*filters)));
   }
 
   static constexpr bool IsFused = true;
 
+  // Names of the member filters, in the order they run.
+  static std::vector<UniqueTypeName> FilterNames() {
+    return {UniqueTypeNameFor<Filters>()...};
+  }
+
   static constexpr bool FusedFilterHasAsyncErrorInterceptor() {
     return (
         promise_filter_detail::CallHasAsyncErrorInterceptor<Filters>::value ||
         ...);
   }
 
+  // The channel filter for the I'th member of Filters.
+  template <size_t I>
+  auto* fused_filter() const {
+    return filters_->template get<I>();
+  }
+
   class Call : public FuseOnClientInitialMetadata<FusedFilter, Filters...>,
                public FuseOnServerInitialMetadata<FusedFilter, Filters...>,
                public FuseOnClientToServerMessage<FusedFilter, Filters...>,
@@ -995,9 +1052,12 @@ class FusedFilter : public ImplementChannelFilter<FusedFilter<Filters...>>,
                public FuseOnClientToServerHalfClose<FusedFilter, Filters...>,
                public FuseOnFinalize<FusedFilter, Filters...> {
    public:
+    explicit Call(FusedFilter* filter)
+        : Call(filter, std::index_sequence_for<Filters...>()) {}
+
     template <size_t I>
     auto* fused_child() {
-      return &std::get<I>(filter_calls_);
+      return &std::get<I>(filter_calls_).call;
     }
 
     using FuseOnClientInitialMetadata<FusedFilter,
@@ -1015,7 +1075,11 @@ class FusedFilter : public ImplementChannelFilter<FusedFilter<Filters...>>,
     using FuseOnFinalize<FusedFilter, Filters...>::OnFinalize;
 
    private:
-    std::tuple<typename Filters::Call...> filter_calls_;
+    template <size_t... Is>
+    Call(FusedFilter* filter, std::index_sequence<Is...>)
+        : filter_calls_(filter->template fused_filter<Is>()...) {}
+
+    std::tuple<FusedChildCall<Filters>...> filter_calls_;
   };
 
   bool StartTransportOp(grpc_transport_op* op) override {
@@ -1027,10 +1091,10 @@ class FusedFilter : public ImplementChannelFilter<FusedFilter<Filters...>>,
   }
 
  private:
-  explicit FusedFilter(std::unique_ptr<FilterWrapper<Filters...>> filters)
-      : filters_(std::move(filters)) {};
+  explicit FusedFilter(std::unique_ptr<FusedChannelFilters<Filters...>> filters)
+      : filters_(std::move(filters)) {}
 
-  std::unique_ptr<FilterWrapper<Filters...>> filters_;
+  std::unique_ptr<FusedChannelFilters<Filters...>> filters_;
 };
 
 }  // namespace filters_detail
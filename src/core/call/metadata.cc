@@ -29,7 +29,7 @@ ServerMetadataHandle ServerMetadataFromStatus(const absl::Status& status) {
                         nullptr, nullptr);
   hdl->Set(GrpcStatusMetadata(), code);
   if (!status.ok()) {
-    hdl->Set(GrpcMessageMetadata(), Slice::FromCopiedString(message));
+    hdl->Set(GrpcMessageMetadata(), GrpcMessageMetadata::FromString(message));
   }
   return hdl;
 }
@@ -45,7 +45,7 @@ ServerMetadataHandle ServerMetadataFromStatus(grpc_status_code code,
                                               absl::string_view message) {
   auto hdl = Arena::MakePooledForOverwrite<ServerMetadata>();
   hdl->Set(GrpcStatusMetadata(), code);
-  hdl->Set(GrpcMessageMetadata(), Slice::FromCopiedString(message));
+  hdl->Set(GrpcMessageMetadata(), GrpcMessageMetadata::FromString(message));
   return hdl;
 }
 
@@ -53,7 +53,7 @@ ServerMetadataHandle CancelledServerMetadataFromStatus(
     grpc_status_code code, absl::string_view message) {
   auto hdl = Arena::MakePooledForOverwrite<ServerMetadata>();
   hdl->Set(GrpcStatusMetadata(), code);
-  hdl->Set(GrpcMessageMetadata(), Slice::FromCopiedString(message));
+  hdl->Set(GrpcMessageMetadata(), GrpcMessageMetadata::FromString(message));
   hdl->Set(GrpcCallWasCancelled(), true);
   return hdl;
 }
@@ -18,7 +18,9 @@
 #include <string.h>
 
 #include <algorithm>
+#include <optional>
 #include <string>
+#include <utility>
 
 #include "absl/base/no_destructor.h"
 #include "absl/container/flat_hash_set.h"
@@ -102,6 +104,34 @@ bool DebugStringBuilder::IsAllowListed(const absl::string_view key) const {
   return allow_list->contains(key);
 }
 
+NameIndex::NameIndex(absl::Span<const absl::string_view> names) {
+  size_t size = 1;
+  while (size < 2 * names.size()) size *= 2;
+  // Look for a seed that gives every name its own slot, growing the table
+  // if none does.  If even the largest table has collisions, keep the last
+  // one tried: probing still finds every name.
+  constexpr uint32_t kSeedsPerSize = 64;
+  const size_t max_size = 8 * size;
+  for (;; size *= 2) {
+    for (uint32_t seed = 0; seed < kSeedsPerSize; ++seed) {
+      slots_.assign(size, Slot());
+      mask_ = size - 1;
+      seed_ = seed;
+      bool collided = false;
+      int index = 0;
+      for (absl::string_view name : names) {
+        size_t i = Hash(name, seed) & mask_;
+        if (slots_[i].index >= 0) collided = true;
+        while (slots_[i].index >= 0) i = (i + 1) & mask_;
+        slots_[i] = Slot{name, index++};
+      }
+      if (!collided || (size >= max_size && seed + 1 == kSeedsPerSize)) {
+        return;
+      }
+    }
+  }
+}
+
 void UnknownMap::Append(absl::string_view key, Slice value) {
   unknown_.emplace_back(Slice::FromCopiedString(key), value.Ref());
 }
@@ -131,6 +161,40 @@ std::optional<absl::string_view> UnknownMap::GetStringValue(
 
 }  // namespace metadata_detail
 
+std::optional<Slice> GrpcMessageMetadata::Interned(
+    absl::string_view message) {
+  static constexpr absl::string_view kInterned[] = {
+      "Deadline Exceeded",
+      "OK",
+      "CANCELLED",
+      "UNKNOWN",
+      "INVALID_ARGUMENT",
+      "DEADLINE_EXCEEDED",
+      "NOT_FOUND",
+      "ALREADY_EXISTS",
+      "PERMISSION_DENIED",
+      "RESOURCE_EXHAUSTED",
+      "FAILED_PRECONDITION",
+      "ABORTED",
+      "OUT_OF_RANGE",
+      "UNIMPLEMENTED",
+      "INTERNAL",
+      "UNAVAILABLE",
+      "DATA_LOSS",
+      "UNAUTHENTICATED",
+  };
+  for (absl::string_view interned : kInterned) {
+    if (message == interned) return Slice::FromStaticString(interned);
+  }
+  return std::nullopt;
+}
+
+Slice GrpcMessageMetadata::FromString(absl::string_view message) {
+  std::optional<Slice> interned = Interned(message);
+  if (interned.has_value()) return std::move(*interned);
+  return Slice::FromCopiedString(message);
+}
+
 ContentTypeMetadata::MementoType ContentTypeMetadata::ParseMemento(
     Slice value, bool, MetadataParseErrorFn /*on_error*/) {
   auto out = kInvalid;
@@ -29,6 +29,7 @@
 #include <string>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "absl/container/inlined_vector.h"
 #include "absl/functional/function_ref.h"
@@ -36,6 +37,7 @@
 #include "absl/meta/type_traits.h"
 #include "absl/strings/numbers.h"
 #include "absl/strings/string_view.h"
+#include "absl/types/span.h"
 #include "src/core/call/custom_metadata.h"
 #include "src/core/call/metadata_compression_traits.h"
 #include "src/core/call/parsed_metadata.h"
@@ -274,8 +276,15 @@ struct UserAgentMetadata : public SimpleSliceBasedMetadata {
 struct GrpcMessageMetadata : public SimpleSliceBasedMetadata {
   static constexpr bool kRepeatable = false;
   static constexpr bool kTransferOnTrailersOnly = false;
-  using CompressionTraits = NoCompressionCompressor;
+  using CompressionTraits = GrpcMessageCompressor;
   static absl::string_view key() { return "grpc-message"; }
+  // If \a message is one that gRPC attaches to many calls (a status code
+  // name or "Deadline Exceeded"), returns a static slice holding it, so that
+  // trailers carrying it need no copy and transports can compress it.
+  static std::optional<Slice> Interned(absl::string_view message);
+  // Returns \a message as a value for this trait: interned if possible,
+  // copied otherwise.
+  static Slice FromString(absl::string_view message);
 };
 
 // host metadata trait.
@@ -417,7 +426,8 @@ struct GrpcStatusMetadata {
   static auto DisplayMemento(MementoType x) { return DisplayValue(x); }
   static constexpr bool kRepeatable = false;
   static constexpr bool kTransferOnTrailersOnly = false;
-  using CompressionTraits = SmallIntegralValuesCompressor<16>;
+  using CompressionTraits =
+      SmallIntegralValuesCompressor<GRPC_STATUS_UNAUTHENTICATED + 1>;
   static absl::string_view key() { return "grpc-status"; }
   static grpc_status_code ParseMemento(Slice value, bool,
                                        MetadataParseErrorFn on_error) {
@@ -695,16 +705,72 @@ struct EncodableNameLookupKeyComparison {
 template <typename Trait, typename Op>
 struct EncodableNameLookupOnFound {
   auto operator()(Op* op) { return op->Found(Trait()); }
+  static auto Call(Op* op) { return op->Found(Trait()); }
+};
+
+// Maps a set of distinct names to their positions in that set.
+// The names are placed in a hash table whose seed is chosen when the table is
+// built so that, in practice, every name lands in its own slot: a lookup
+// hashes the key once and compares it against at most one name.
+class NameIndex {
+ public:
+  explicit NameIndex(absl::Span<const absl::string_view> names);
+
+  // Returns the position of name in the list passed at construction, or -1.
+  int Find(absl::string_view name) const {
+    for (size_t i = Hash(name, seed_) & mask_;; i = (i + 1) & mask_) {
+      const Slot& slot = slots_[i];
+      if (slot.index < 0) return -1;
+      if (slot.name == name) return slot.index;
+    }
+  }
+
+ private:
+  struct Slot {
+    absl::string_view name;
+    int index = -1;
+  };
+
+  static uint32_t Hash(absl::string_view name, uint32_t seed) {
+    uint32_t h = seed ^ static_cast<uint32_t>(name.size());
+    for (char c : name) h = (h ^ static_cast<uint8_t>(c)) * 16777619u;
+    return h ^ (h >> 15);
+  }
+
+  // Slots are never all full, so probing always ends.
+  std::vector<Slot> slots_;
+  uint32_t seed_ = 0;
+  size_t mask_ = 0;
 };
 
 template <typename... Traits>
 struct EncodableNameLookup {
   template <typename Op>
   static auto Lookup(absl::string_view key, Op* op) {
-    return IfList(
-        key, op, [key](Op* op) { return op->NotFound(key); },
-        EncodableNameLookupKeyComparison<Traits>()...,
-        EncodableNameLookupOnFound<Traits, Op>()...);
+    if constexpr (sizeof...(Traits) < kMinTraitsForIndex) {
+      return IfList(
+          key, op, [key](Op* op) { return op->NotFound(key); },
+          EncodableNameLookupKeyComparison<Traits>()...,
+          EncodableNameLookupOnFound<Traits, Op>()...);
+    } else {
+      // Known names are looked up on every header parsed, so find the trait
+      // with one hash probe instead of comparing against each name in turn.
+      using Result = decltype(op->NotFound(key));
+      static constexpr Result (*kFound[])(Op*) = {
+          &EncodableNameLookupOnFound<Traits, Op>::Call...};
+      const int i = Index().Find(key);
+      if (i < 0) return op->NotFound(key);
+      return kFound[i](op);
+    }
+  }
+
+ private:
+  // Below this many names a chain of comparisons is as quick as hashing.
+  static constexpr size_t kMinTraitsForIndex = 4;
+
+  static const NameIndex& Index() {
+    static const NameIndex* const index = new NameIndex({Traits::key()...});
+    return *index;
   }
 };
 
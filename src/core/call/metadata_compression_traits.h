@@ -56,6 +56,11 @@ struct SmallIntegralValuesCompressor {};
 // Specialty compressor for grpc-timeout metadata.
 struct TimeoutCompressor {};
 
+// Specialty compressor for grpc-message metadata: messages that gRPC interns
+// recur across calls and are worth indexing, anything else is sent as a
+// literal.
+struct GrpcMessageCompressor {};
+
 // Specialty compressors for HTTP/2 pseudo headers.
 struct HttpSchemeCompressor {};
 struct HttpMethodCompressor {};
@@ -92,16 +92,29 @@ void RequestBuffer::Commit(Reader* winner) {
         winner->message_index_ == buffering->messages.size() &&
         winner->pulled_client_initial_metadata_) {
       state_.emplace<Streaming>();
+    } else {
+      ReleaseReadByWinner(buffering->initial_metadata, buffering->messages);
     }
   } else if (auto* buffered = std::get_if<Buffered>(&state_)) {
     CHECK_NE(buffered->initial_metadata.get(), nullptr);
     if (winner->message_index_ == buffered->messages.size()) {
       state_.emplace<Streaming>().end_of_stream = true;
+    } else {
+      ReleaseReadByWinner(buffered->initial_metadata, buffered->messages);
     }
   }
   WakeupAsyncAllPullersExcept(winner);
 }
 
+void RequestBuffer::ReleaseReadByWinner(
+    ClientMetadataHandle& initial_metadata,
+    absl::InlinedVector<MessageHandle, 1>& messages) {
+  // The winner has its own copies of what it read before the commit, and no
+  // other reader will read anything again.
+  if (winner_->pulled_client_initial_metadata_) initial_metadata.reset();
+  for (size_t i = 0; i < winner_->message_index_; ++i) messages[i].reset();
+}
+
 void RequestBuffer::WakeupAsyncAllPullersExcept(Reader* except_reader) {
   for (auto wakeup_reader : readers_) {
     if (wakeup_reader == except_reader) continue;
@@ -190,7 +203,8 @@ std::string RequestBuffer::DebugString(Reader* caller)
                 absl::StrJoin(
                     buffering.messages, ",",
                     [](std::string* output, const MessageHandle& hdl) {
-                      absl::StrAppend(output, hdl->DebugString());
+                      absl::StrAppend(
+                          output, hdl != nullptr ? hdl->DebugString() : "null");
                     }),
                 "] buffered=", buffering.buffered);
           },
@@ -162,6 +162,11 @@ class RequestBuffer {
     push_waker_.Wakeup();
   }
 
+  // Drops the buffered data that the winner has already read.
+  void ReleaseReadByWinner(ClientMetadataHandle& initial_metadata,
+                           absl::InlinedVector<MessageHandle, 1>& messages)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
   void WakeupAsyncAllPullers() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
     WakeupAsyncAllPullersExcept(nullptr);
   }
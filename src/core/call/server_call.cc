@@ -48,6 +48,7 @@
 #include "src/core/lib/promise/try_seq.h"
 #include "src/core/lib/resource_quota/arena.h"
 #include "src/core/lib/slice/slice_buffer.h"
+#include "src/core/lib/slice/slice_internal.h"
 #include "src/core/lib/surface/completion_queue.h"
 #include "src/core/server/server_interface.h"
 #include "src/core/util/bitset.h"
@@ -167,7 +168,8 @@ void ServerCall::CommitBatch(const grpc_op* ops, size_t nops, void* notify_tag,
       // callers that allocate and pass in a slice created with
       // grpc_slice_from_static_string and then delete the string
       // after passing it in, which shouldn't be a supported API.
-      metadata->Set(GrpcMessageMetadata(), Slice(grpc_slice_copy(*details)));
+      metadata->Set(GrpcMessageMetadata(), GrpcMessageMetadata::FromString(
+                                               StringViewFromSlice(*details)));
     }
     CHECK(metadata != nullptr);
     bool wait_for_initial_metadata_scheduled =
@@ -216,64 +216,62 @@ ChannelzRegistry::QueryNodes(
     nursery_visitation_order.push_back(i);
   }
   absl::c_shuffle(nursery_visitation_order, SharedBitGen());
-  // In the iteration below, even once we have max_results nodes, we need
-  // to find the next node in order to know if we've hit the end.  If we get
-  // through the loop without returning, then we return end=true.  But if we
-  // find a node to add after we already have max_results nodes, then we
-  // return with end=false before exiting the loop.  However, in the latter
-  // case, we will have already increased the ref count of the next node,
-  // so we need to unref it, but we can't do that while holding the lock.
-  // So instead, we store it in node_after_end, which will be unreffed
-  // after releasing the lock.
-  WeakRefCountedPtr<BaseNode> node_after_end;
-  std::vector<WeakRefCountedPtr<BaseNode>> result;
-  MutexLock index_lock(&index_mu_);
-  for (auto it = index_.lower_bound(start_node); it != index_.end(); ++it) {
-    BaseNode* node = it->second;
-    if (!discriminator(node)) continue;
-    auto node_ref = node->WeakRefIfNonZero();
-    if (node_ref == nullptr) continue;
-    if (result.size() == max_results) {
-      node_after_end = std::move(node_ref);
-      return std::tuple(std::move(result), false);
-    }
-    result.emplace_back(std::move(node_ref));
-  }
+  // Number every matching node that does not have a uuid yet, so that the
+  // index holds all the candidates.  The index lock is dropped between
+  // shards so that registrations and unregistrations elsewhere can proceed.
   for (auto nursery_index : nursery_visitation_order) {
     NodeShard& node_shard = node_shards_[nursery_index];
+    MutexLock index_lock(&index_mu_);
     MutexLock shard_lock(&node_shard.mu);
     for (auto [nursery, numbered] :
          {std::pair(&node_shard.nursery, &node_shard.numbered),
           std::pair(&node_shard.orphaned, &node_shard.orphaned_numbered)}) {
-      if (nursery->head == nullptr) continue;
       BaseNode* n = nursery->head;
       while (n != nullptr) {
-        if (!discriminator(n)) {
-          n = n->next_;
-          continue;
-        }
-        auto node_ref = n->WeakRefIfNonZero();
-        if (node_ref == nullptr) {
-          n = n->next_;
-          continue;
-        }
         BaseNode* next = n->next_;
-        nursery->Remove(n);
-        numbered->AddToHead(n);
-        n->uuid_ = uuid_generator_;
-        ++uuid_generator_;
-        index_.emplace(n->uuid_, n);
-        if (n->uuid_ >= start_node) {
-          if (result.size() == max_results) {
-            node_after_end = std::move(node_ref);
-            return std::tuple(std::move(result), false);
-          }
-          result.emplace_back(std::move(node_ref));
+        if (discriminator(n)) {
+          nursery->Remove(n);
+          numbered->AddToHead(n);
+          n->uuid_ = uuid_generator_;
+          ++uuid_generator_;
+          index_.emplace(n->uuid_, n);
         }
         n = next;
       }
     }
   }
+  // Then walk the index in uuid order.  Each pass holds the index lock for a
+  // bounded number of nodes and resumes from where the previous one stopped,
+  // so a query over many nodes does not stall unregistration for its whole
+  // duration.
+  //
+  // Even once we have max_results nodes, we need to find the next node in
+  // order to know if we've hit the end.  If we find one, we will have already
+  // increased its ref count, but we can't unref it while holding the lock.
+  // So instead, we store it in node_after_end, which will be unreffed after
+  // releasing the lock.
+  constexpr size_t kMaxNodesPerPass = 1024;
+  WeakRefCountedPtr<BaseNode> node_after_end;
+  std::vector<WeakRefCountedPtr<BaseNode>> result;
+  intptr_t cursor = start_node;
+  while (true) {
+    MutexLock index_lock(&index_mu_);
+    auto it = index_.lower_bound(cursor);
+    for (size_t visited = 0; it != index_.end() && visited < kMaxNodesPerPass;
+         ++it, ++visited) {
+      BaseNode* node = it->second;
+      if (!discriminator(node)) continue;
+      auto node_ref = node->WeakRefIfNonZero();
+      if (node_ref == nullptr) continue;
+      if (result.size() == max_results) {
+        node_after_end = std::move(node_ref);
+        return std::tuple(std::move(result), false);
+      }
+      result.emplace_back(std::move(node_ref));
+    }
+    if (it == index_.end()) break;
+    cursor = it->first;
+  }
   CHECK(node_after_end == nullptr);
   return std::tuple(std::move(result), true);
 }
@@ -18,6 +18,7 @@
 #include <grpc/support/time.h>
 
 #include <memory>
+#include <optional>
 #include <tuple>
 #include <vector>
 
@@ -53,6 +54,8 @@ class StubImpl {
   template <typename T>
   void Append(const T&) {}
 
+  void KeepHistory(size_t) {}
+
   std::unique_ptr<ZTrace> MakeZTrace() {
     return std::make_unique<ZTraceImpl>();
   }
@@ -148,37 +151,55 @@ class ZTraceCollector {
     return std::make_unique<ZTraceImpl>(impl_.GetOrCreate());
   }
 
+  // Keeps the most recent events, up to about \a memory_cap bytes of them,
+  // even while no trace is running, and starts each new trace with them, so
+  // that a trace shows what led up to the moment it was requested.
+  // This costs an uncontended lock per event, so it is off unless enabled.
+  // Must be called before the first Append().
+  void KeepHistory(size_t memory_cap) {
+    if (memory_cap == 0) return;
+    auto impl = impl_.GetOrCreate();
+    MutexLock lock(&impl->mu);
+    impl->history.emplace(memory_cap);
+  }
+
  private:
   template <typename T>
   using Collection = ztrace_collector_detail::Collection<T>;
 
-  struct Instance : public RefCounted<Instance> {
-    Instance(std::map<std::string, std::string> args,
-             std::shared_ptr<grpc_event_engine::experimental::EventEngine>
-                 event_engine,
-             absl::AnyInvocable<void(Json)> done)
-        : memory_cap_(IntFromArgs(args, "memory_cap").value_or(1024 * 1024)),
-          config(args),
-          event_engine(std::move(event_engine)),
-          done(std::move(done)) {}
+  // Events collected for a trace, oldest evicted first beyond a memory cap.
+  struct Buffer {
+    explicit Buffer(size_t memory_cap) : memory_cap_(memory_cap) {}
     using Collections = std::tuple<Collection<Data>...>;
     struct RemoveMostRecentState {
-      void (*enact)(Instance*) = nullptr;
+      void (*enact)(Buffer*) = nullptr;
       gpr_cycle_counter most_recent =
           std::numeric_limits<gpr_cycle_counter>::max();
     };
     template <typename T>
     void Append(std::pair<gpr_cycle_counter, T> value) {
       memory_used_ += MemoryUsage(value.second);
-      while (memory_used_ > memory_cap_) RemoveMostRecent();
+      while (memory_used_ > memory_cap_ && RemoveMostRecent()) {
+      }
       std::get<Collection<T> >(data).push_back(std::move(value));
     }
-    void RemoveMostRecent() {
+    void AppendAll(const Buffer& other) {
+      (AppendCollection<Data>(other), ...);
+    }
+    template <typename T>
+    void AppendCollection(const Buffer& other) {
+      for (const auto& value : std::get<Collection<T> >(other.data)) {
+        Append(value);
+      }
+    }
+    // Returns false if there was nothing to remove.
+    bool RemoveMostRecent() {
       RemoveMostRecentState state;
       (UpdateRemoveMostRecentState<Data>(&state), ...);
-      CHECK(state.enact != nullptr);
+      if (state.enact == nullptr) return false;
       state.enact(this);
       ++items_removed_;
+      return true;
     }
     template <typename T>
     void UpdateRemoveMostRecentState(RemoveMostRecentState* state) {
@@ -186,16 +207,35 @@ class ZTraceCollector {
       if (collection.empty()) return;
       if (state->enact == nullptr ||
           collection.front().first < state->most_recent) {
-        state->enact = +[](Instance* instance) {
-          auto& collection = std::get<Collection<T> >(instance->data);
+        state->enact = +[](Buffer* buffer) {
+          auto& collection = std::get<Collection<T> >(buffer->data);
           const size_t ent_usage = MemoryUsage(collection.front().second);
-          CHECK_GE(instance->memory_used_, ent_usage);
-          instance->memory_used_ -= ent_usage;
+          CHECK_GE(buffer->memory_used_, ent_usage);
+          buffer->memory_used_ -= ent_usage;
           collection.pop_front();
         };
         state->most_recent = collection.front().first;
       }
     }
+    size_t memory_used_ = 0;
+    size_t memory_cap_ = 0;
+    uint64_t items_removed_ = 0;
+    Collections data;
+  };
+
+  struct Instance : public RefCounted<Instance>, public Buffer {
+    Instance(std::map<std::string, std::string> args,
+             std::shared_ptr<grpc_event_engine::experimental::EventEngine>
+                 event_engine,
+             absl::AnyInvocable<void(Json)> done)
+        : Buffer(IntFromArgs(args, "memory_cap").value_or(1024 * 1024)),
+          config(args),
+          event_engine(std::move(event_engine)),
+          done(std::move(done)) {}
+    using typename Buffer::Collections;
+    using Buffer::data;
+    using Buffer::items_removed_;
+    using Buffer::memory_used_;
     void Finish(absl::Status status) {
       event_engine->Run([data = std::move(data), done = std::move(done),
                          status = std::move(status), memory_used = memory_used_,
@@ -213,20 +253,18 @@ class ZTraceCollector {
         done(Json::FromObject(std::move(result)));
       });
     }
-    size_t memory_used_ = 0;
-    size_t memory_cap_ = 0;
-    uint64_t items_removed_ = 0;
     Config config;
     const Timestamp start_time = Timestamp::Now();
     std::shared_ptr<grpc_event_engine::experimental::EventEngine> event_engine;
     grpc_event_engine::experimental::EventEngine::TaskHandle task_handle{
         grpc_event_engine::experimental::EventEngine::TaskHandle::kInvalid};
-    Collections data;
     absl::AnyInvocable<void(Json)> done;
   };
   struct Impl : public RefCounted<Impl> {
     Mutex mu;
     absl::flat_hash_set<RefCountedPtr<Instance> > instances ABSL_GUARDED_BY(mu);
+    // Set by KeepHistory().
+    std::optional<Buffer> history ABSL_GUARDED_BY(mu);
   };
   class ZTraceImpl final : public ZTrace {
    public:
@@ -264,6 +302,7 @@ class ZTraceCollector {
             }
             if (finish) instance->Finish(absl::DeadlineExceededError(""));
           });
+      if (impl->history.has_value()) instance->AppendAll(*impl->history);
       impl->instances.insert(instance);
     }
 
@@ -277,6 +316,7 @@ class ZTraceCollector {
     auto* impl = impl_.Get();
     {
       MutexLock lock(&impl->mu);
+      if (impl->history.has_value()) impl->history->Append(value);
       switch (impl->instances.size()) {
         case 0:
           return;
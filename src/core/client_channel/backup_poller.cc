@@ -26,6 +26,8 @@
 #include "absl/log/log.h"
 #include "absl/status/status.h"
 #include "src/core/config/config_vars.h"
+#include "src/core/lib/event_engine/shim.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/iomgr/closure.h"
 #include "src/core/lib/iomgr/error.h"
 #include "src/core/lib/iomgr/iomgr.h"
@@ -62,10 +64,13 @@ static grpc_core::Duration g_poll_interval =
 static bool g_backup_polling_disabled;
 
 void grpc_client_channel_global_init_backup_polling() {
-  // Disable backup polling if EventEngine is used everywhere.
-  g_backup_polling_disabled = grpc_core::IsEventEngineClientEnabled() &&
-                              grpc_core::IsEventEngineListenerEnabled() &&
-                              grpc_core::IsEventEngineDnsEnabled();
+  // Disable backup polling if the EventEngine owns every fd a client channel
+  // can put in its pollset_set: its connections and its DNS lookups.
+  // Listeners do not matter here, since no server fd is ever added to a
+  // channel's interested parties.
+  g_backup_polling_disabled =
+      grpc_event_engine::experimental::UseEventEngineClient() &&
+      grpc_core::IsEventEngineDnsEnabled();
   if (g_backup_polling_disabled) {
     return;
   }
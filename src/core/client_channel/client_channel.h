@@ -186,7 +186,7 @@ class ClientChannel : public Channel {
   // Idleness state.
   //
   const Duration idle_timeout_;
-  IdleFilterState idle_state_{false};
+  ShardedIdleFilterState idle_state_{false};
   SingleSetPtr<Activity, typename ActivityPtr::deleter_type> idle_activity_;
 
   //
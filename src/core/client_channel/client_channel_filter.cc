@@ -567,6 +567,10 @@ class ClientChannelFilter::SubchannelWrapper final
     return subchannel_->connected_subchannel();
   }
 
+  RefCountedPtr<ConnectedSubchannel> connected_subchannel_for_call() const {
+    return subchannel_->connected_subchannel_for_call();
+  }
+
   void RequestConnection() override { subchannel_->RequestConnection(); }
 
   void ResetBackoff() override { subchannel_->ResetBackoff(); }
@@ -1572,6 +1576,14 @@ void ClientChannelFilter::UpdateStateAndPickerLocked(
   // Old picker will be unreffed after releasing the lock.
   MutexLock lock(&lb_mu_);
   picker_.swap(picker);
+  ++picker_generation_;
+  if (IsShardedLbPickerEnabled()) {
+    for (PickerShard& shard : picker_shards_) {
+      MutexLock shard_lock(&shard.mu);
+      shard.picker = picker_;
+      shard.picker_generation = picker_generation_;
+    }
+  }
   // Reprocess queued picks.
   for (auto& call : lb_queued_calls_) {
     call->RemoveCallFromLbQueuedCallsLocked();
@@ -2465,11 +2477,38 @@ void ClientChannelFilter::LoadBalancedCall::AddCallToLbQueuedCallsLocked() {
 std::optional<absl::Status>
 ClientChannelFilter::LoadBalancedCall::PickSubchannel(bool was_queued) {
   RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> picker;
-  // Grab mutex and take a ref to the picker.
-  GRPC_TRACE_LOG(client_channel_lb_call, INFO)
-      << "chand=" << chand_ << " lb_call=" << this
-      << ": grabbing LB mutex to get picker";
-  {
+  if (IsShardedLbPickerEnabled()) {
+    // Try the pick with this CPU's copy of the picker, which does not need
+    // the LB mutex or a ref to the picker.
+    grpc_error_handle error;
+    bool pick_complete = false;
+    uint64_t picker_generation = 0;
+    {
+      PickerShard& shard = chand_->picker_shards_.this_cpu();
+      MutexLock lock(&shard.mu);
+      if (shard.picker != nullptr) {
+        GRPC_TRACE_LOG(client_channel_lb_call, INFO)
+            << "chand=" << chand_ << " lb_call=" << this
+            << ": performing pick with sharded picker=" << shard.picker.get();
+        picker_generation = shard.picker_generation;
+        pick_complete = PickSubchannelImpl(shard.picker.get(), &error);
+      }
+    }
+    if (pick_complete) return OnPickComplete(was_queued, error);
+    // The pick was queued.  Unless the picker has been swapped out since
+    // we used it, queue the call until we get a new picker.
+    MutexLock lock(&chand_->lb_mu_);
+    if (picker_generation != 0 &&
+        picker_generation == chand_->picker_generation_) {
+      AddCallToLbQueuedCallsLocked();
+      return std::nullopt;
+    }
+    picker = chand_->picker_;
+  } else {
+    // Grab mutex and take a ref to the picker.
+    GRPC_TRACE_LOG(client_channel_lb_call, INFO)
+        << "chand=" << chand_ << " lb_call=" << this
+        << ": grabbing LB mutex to get picker";
     MutexLock lock(&chand_->lb_mu_);
     picker = chand_->picker_;
   }
@@ -2505,24 +2544,28 @@ ClientChannelFilter::LoadBalancedCall::PickSubchannel(bool was_queued) {
       AddCallToLbQueuedCallsLocked();
       return std::nullopt;
     }
-    // Pick is complete.
-    // If it was queued, add a trace annotation.
-    if (was_queued && call_attempt_tracer() != nullptr) {
-      call_attempt_tracer()->RecordAnnotation("Delayed LB pick complete.");
-    }
-    // If the pick failed, fail the call.
-    if (!error.ok()) {
-      GRPC_TRACE_LOG(client_channel_lb_call, INFO)
-          << "chand=" << chand_ << " lb_call=" << this
-          << ": failed to pick subchannel: error=" << StatusToString(error);
-      return error;
-    }
-    // Pick succeeded.
-    Commit();
-    return absl::OkStatus();
+    return OnPickComplete(was_queued, error);
   }
 }
 
+absl::Status ClientChannelFilter::LoadBalancedCall::OnPickComplete(
+    bool was_queued, grpc_error_handle error) {
+  // If it was queued, add a trace annotation.
+  if (was_queued && call_attempt_tracer() != nullptr) {
+    call_attempt_tracer()->RecordAnnotation("Delayed LB pick complete.");
+  }
+  // If the pick failed, fail the call.
+  if (!error.ok()) {
+    GRPC_TRACE_LOG(client_channel_lb_call, INFO)
+        << "chand=" << chand_ << " lb_call=" << this
+        << ": failed to pick subchannel: error=" << StatusToString(error);
+    return error;
+  }
+  // Pick succeeded.
+  Commit();
+  return absl::OkStatus();
+}
+
 bool ClientChannelFilter::LoadBalancedCall::PickSubchannelImpl(
     LoadBalancingPolicy::SubchannelPicker* picker, grpc_error_handle* error) {
   CHECK(connected_subchannel_ == nullptr);
@@ -2549,7 +2592,7 @@ bool ClientChannelFilter::LoadBalancedCall::PickSubchannelImpl(
         // holding the data plane mutex.
         SubchannelWrapper* subchannel =
             static_cast<SubchannelWrapper*>(complete_pick->subchannel.get());
-        connected_subchannel_ = subchannel->connected_subchannel();
+        connected_subchannel_ = subchannel->connected_subchannel_for_call();
         // If the subchannel has no connected subchannel (e.g., if the
         // subchannel has moved out of state READY but the LB policy hasn't
         // yet seen that change and given us a new picker), then just
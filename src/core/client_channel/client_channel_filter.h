@@ -21,6 +21,7 @@
 #include <grpc/impl/connectivity_state.h>
 #include <grpc/support/port_platform.h>
 #include <stddef.h>
+#include <stdint.h>
 
 #include <atomic>
 #include <map>
@@ -61,6 +62,7 @@
 #include "src/core/service_config/service_config.h"
 #include "src/core/telemetry/call_tracer.h"
 #include "src/core/util/orphanable.h"
+#include "src/core/util/per_cpu.h"
 #include "src/core/util/ref_counted.h"
 #include "src/core/util/ref_counted_ptr.h"
 #include "src/core/util/sync.h"
@@ -295,6 +297,19 @@ class ClientChannelFilter final {
   mutable Mutex lb_mu_;
   RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> picker_
       ABSL_GUARDED_BY(lb_mu_);
+  // Incremented every time picker_ is updated.
+  uint64_t picker_generation_ ABSL_GUARDED_BY(lb_mu_) = 0;
+  // With the sharded_lb_picker experiment, a copy of picker_ per CPU shard,
+  // updated under lb_mu_.  Picks run under the lock of their shard instead
+  // of taking lb_mu_ and a ref to picker_, both of which are contended when
+  // many threads start calls on the same channel.
+  struct alignas(GPR_CACHELINE_SIZE) PickerShard {
+    Mutex mu;
+    RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> picker
+        ABSL_GUARDED_BY(mu);
+    uint64_t picker_generation ABSL_GUARDED_BY(mu) = 0;
+  };
+  PerCpu<PickerShard> picker_shards_{PerCpuOptions().SetMaxShards(16)};
   absl::flat_hash_set<RefCountedPtr<LoadBalancedCall>,
                       RefCountedPtrHash<LoadBalancedCall>,
                       RefCountedPtrEq<LoadBalancedCall>>
@@ -421,6 +436,9 @@ class ClientChannelFilter::LoadBalancedCall
   // Returns true if the pick is complete.
   bool PickSubchannelImpl(LoadBalancingPolicy::SubchannelPicker* picker,
                           grpc_error_handle* error);
+  // Finishes a completed pick: returns error if the pick failed, and
+  // otherwise commits the call to the picked subchannel.
+  absl::Status OnPickComplete(bool was_queued, grpc_error_handle error);
   // Adds the call to the channel's list of queued picks if not already present.
   void AddCallToLbQueuedCallsLocked()
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(&ClientChannelFilter::lb_mu_);
@@ -23,6 +23,7 @@
 #include "src/core/config/core_configuration.h"
 #include "src/core/lib/promise/loop.h"
 #include "src/core/telemetry/call_tracer.h"
+#include "src/core/util/match.h"
 
 namespace grpc_core {
 
@@ -52,36 +53,6 @@ class LbCallState : public ClientChannelLbCallState {
   }
 };
 
-// TODO(roth): Remove this in favor of src/core/util/match.h function once
-// we can do that without breaking lock annotations.
-template <typename T>
-T HandlePickResult(
-    LoadBalancingPolicy::PickResult* result,
-    std::function<T(LoadBalancingPolicy::PickResult::Complete*)> complete_func,
-    std::function<T(LoadBalancingPolicy::PickResult::Queue*)> queue_func,
-    std::function<T(LoadBalancingPolicy::PickResult::Fail*)> fail_func,
-    std::function<T(LoadBalancingPolicy::PickResult::Drop*)> drop_func) {
-  auto* complete_pick =
-      std::get_if<LoadBalancingPolicy::PickResult::Complete>(&result->result);
-  if (complete_pick != nullptr) {
-    return complete_func(complete_pick);
-  }
-  auto* queue_pick =
-      std::get_if<LoadBalancingPolicy::PickResult::Queue>(&result->result);
-  if (queue_pick != nullptr) {
-    return queue_func(queue_pick);
-  }
-  auto* fail_pick =
-      std::get_if<LoadBalancingPolicy::PickResult::Fail>(&result->result);
-  if (fail_pick != nullptr) {
-    return fail_func(fail_pick);
-  }
-  auto* drop_pick =
-      std::get_if<LoadBalancingPolicy::PickResult::Drop>(&result->result);
-  CHECK(drop_pick != nullptr);
-  return drop_func(drop_pick);
-}
-
 // Does an LB pick for a call.  Returns one of the following things:
 // - Continue{}, meaning to queue the pick
 // - a non-OK status, meaning to fail the call
@@ -105,9 +76,8 @@ LoopCtl<absl::StatusOr<RefCountedPtr<UnstartedCallDestination>>> PickSubchannel(
   pick_args.initial_metadata = &initial_metadata;
   auto result = picker.Pick(pick_args);
   // Handle result.
-  return HandlePickResult<
-      LoopCtl<absl::StatusOr<RefCountedPtr<UnstartedCallDestination>>>>(
-      &result,
+  return MatchMutable(
+      &result.result,
       // CompletePick
       [&](LoadBalancingPolicy::PickResult::Complete* complete_pick)
           -> LoopCtl<absl::StatusOr<RefCountedPtr<UnstartedCallDestination>>> {
@@ -149,7 +119,8 @@ LoopCtl<absl::StatusOr<RefCountedPtr<UnstartedCallDestination>>> PickSubchannel(
         return call_destination;
       },
       // QueuePick
-      [&](LoadBalancingPolicy::PickResult::Queue* /*queue_pick*/) {
+      [&](LoadBalancingPolicy::PickResult::Queue* /*queue_pick*/)
+          -> LoopCtl<absl::StatusOr<RefCountedPtr<UnstartedCallDestination>>> {
         GRPC_TRACE_LOG(client_channel_lb_call, INFO)
             << "client_channel: " << GetContext<Activity>()->DebugTag()
             << " pick queued";
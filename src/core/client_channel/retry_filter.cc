@@ -129,8 +129,13 @@ RetryFilter::RetryFilter(const ChannelArgs& args, grpc_error_handle* error)
 const RetryMethodConfig* RetryFilter::GetRetryPolicy(Arena* arena) {
   auto* svc_cfg_call_data = arena->GetContext<ServiceConfigCallData>();
   if (svc_cfg_call_data == nullptr) return nullptr;
-  return static_cast<const RetryMethodConfig*>(
+  const auto* config = static_cast<const RetryMethodConfig*>(
       svc_cfg_call_data->GetMethodParsedConfig(service_config_parser_index_));
+  // Hedging is only implemented by the retry interceptor.
+  if (config != nullptr && config->hedging_policy().has_value()) {
+    return nullptr;
+  }
+  return config;
 }
 
 const grpc_channel_filter RetryFilter::kVtable = {
@@ -14,8 +14,13 @@
 
 #include "src/core/client_channel/retry_interceptor.h"
 
+#include <algorithm>
+#include <cmath>
+
+#include "absl/algorithm/container.h"
 #include "src/core/lib/promise/cancel_callback.h"
 #include "src/core/lib/promise/for_each.h"
+#include "src/core/lib/promise/if.h"
 #include "src/core/lib/promise/map.h"
 #include "src/core/lib/promise/sleep.h"
 #include "src/core/service_config/service_config_call_data.h"
@@ -31,6 +36,14 @@ size_t GetMaxPerRpcRetryBufferSize(const ChannelArgs& args) {
                    .value_or(kDefaultPerRpcRetryBufferSize),
                0, INT_MAX);
 }
+
+double GetMaxHedgedFraction(const ChannelArgs& args) {
+  static constexpr int kDefaultMaxHedgedPercent = 10;
+  return Clamp(args.GetInt(GRPC_ARG_EXPERIMENTAL_HEDGING_MAX_PERCENT)
+                   .value_or(kDefaultMaxHedgedPercent),
+               0, 100) /
+         100.0;
+}
 }  // namespace
 
 namespace retry_detail {
@@ -131,6 +144,154 @@ std::optional<Duration> RetryState::ShouldRetry(
   return next_attempt_timeout;
 }
 
+void LatencySketch::Add(Duration latency) {
+  const int64_t millis = latency.millis();
+  int bucket = 0;
+  if (millis >= 1) {
+    bucket = 1 + static_cast<int>(std::floor(
+                     std::log2(static_cast<double>(millis)) *
+                     kBucketsPerDoubling));
+    bucket = std::min(bucket, kNumBuckets - 1);
+  }
+  ++buckets_[bucket];
+  if (++count_ < kDecayCount) return;
+  count_ = 0;
+  for (uint32_t& n : buckets_) {
+    n /= 2;
+    count_ += n;
+  }
+}
+
+Duration LatencySketch::Percentile(double p) const {
+  const double target = p * count_;
+  uint32_t below = 0;
+  int bucket = 0;
+  for (; bucket < kNumBuckets - 1; ++bucket) {
+    below += buckets_[bucket];
+    if (below > target) break;
+  }
+  if (bucket == 0) return Duration::Milliseconds(1);
+  return Duration::Milliseconds(static_cast<int64_t>(std::ceil(
+      std::exp2(static_cast<double>(bucket) / kBucketsPerDoubling))));
+}
+
+void HedgingMethodStats::RecordCall() {
+  MutexLock lock(&mu_);
+  calls_ += 1;
+  if (calls_ >= LatencySketch::kDecayCount) {
+    calls_ /= 2;
+    hedged_attempts_ /= 2;
+  }
+}
+
+bool HedgingMethodStats::TryRecordHedgedAttempt() {
+  MutexLock lock(&mu_);
+  if (hedged_attempts_ + 1 > calls_ * max_hedged_fraction_) return false;
+  hedged_attempts_ += 1;
+  return true;
+}
+
+void HedgingMethodStats::RecordLatency(Duration latency) {
+  MutexLock lock(&mu_);
+  latencies_.Add(latency);
+}
+
+Duration HedgingMethodStats::HedgingDelay(Duration configured_delay) {
+  MutexLock lock(&mu_);
+  if (latencies_.count() < kMinSamples) return configured_delay;
+  return latencies_.Percentile(0.95);
+}
+
+HedgingState::HedgingState(
+    const internal::HedgingPolicy* hedging_policy,
+    RefCountedPtr<internal::ServerRetryThrottleData> retry_throttle_data,
+    RefCountedPtr<HedgingMethodStats> method_stats)
+    : hedging_policy_(hedging_policy),
+      retry_throttle_data_(std::move(retry_throttle_data)),
+      method_stats_(std::move(method_stats)) {}
+
+bool HedgingState::StartAttempt(
+    absl::FunctionRef<std::string()> lazy_attempt_debug_string) {
+  if (num_attempts_started_ >= hedging_policy_->max_attempts()) {
+    GRPC_TRACE_LOG(retry, INFO)
+        << lazy_attempt_debug_string() << " exceeded "
+        << hedging_policy_->max_attempts() << " hedged attempts";
+    return false;
+  }
+  if (stopped_by_server_pushback_) {
+    GRPC_TRACE_LOG(retry, INFO)
+        << lazy_attempt_debug_string()
+        << " not hedging due to server push-back";
+    return false;
+  }
+  // The first attempt is always sent; the others only if retries are not
+  // throttled.
+  if (num_attempts_started_ > 0 && retry_throttle_data_ != nullptr &&
+      !retry_throttle_data_->RetryAllowed()) {
+    GRPC_TRACE_LOG(retry, INFO)
+        << lazy_attempt_debug_string() << " hedged attempts throttled";
+    return false;
+  }
+  if (method_stats_ != nullptr) {
+    if (num_attempts_started_ == 0) {
+      method_stats_->RecordCall();
+    } else if (!method_stats_->TryRecordHedgedAttempt()) {
+      GRPC_TRACE_LOG(retry, INFO)
+          << lazy_attempt_debug_string()
+          << " hedged attempts capped for this method";
+      return false;
+    }
+  }
+  ++num_attempts_started_;
+  return true;
+}
+
+Duration HedgingState::hedging_delay() const {
+  if (method_stats_ == nullptr) return hedging_policy_->hedging_delay();
+  return method_stats_->HedgingDelay(hedging_policy_->hedging_delay());
+}
+
+std::optional<Duration> HedgingState::OnAttemptFailed(
+    const ServerMetadata& md,
+    absl::FunctionRef<std::string()> lazy_attempt_debug_string) {
+  const auto status = md.get(GrpcStatusMetadata());
+  if (status.has_value()) {
+    if (GPR_LIKELY(*status == GRPC_STATUS_OK)) {
+      if (retry_throttle_data_ != nullptr) {
+        retry_throttle_data_->RecordSuccess();
+      }
+      GRPC_TRACE_LOG(retry, INFO)
+          << lazy_attempt_debug_string() << " call succeeded";
+      return std::nullopt;
+    }
+    if (!hedging_policy_->non_fatal_status_codes().Contains(*status)) {
+      GRPC_TRACE_LOG(retry, INFO) << lazy_attempt_debug_string() << ": status "
+                                  << grpc_status_code_to_string(*status)
+                                  << " is fatal";
+      return std::nullopt;
+    }
+  }
+  // As with retries, only non-fatal failures count against the throttle.
+  // Whether the next attempt may be sent is checked by StartAttempt().
+  if (retry_throttle_data_ != nullptr) retry_throttle_data_->RecordFailure();
+  const auto server_pushback = md.get(GrpcRetryPushbackMsMetadata());
+  if (server_pushback.has_value()) {
+    if (*server_pushback < Duration::Zero()) {
+      GRPC_TRACE_LOG(retry, INFO)
+          << lazy_attempt_debug_string()
+          << " no more hedged attempts due to server push-back";
+      stopped_by_server_pushback_ = true;
+      return Duration::Zero();
+    }
+    GRPC_TRACE_LOG(retry, INFO)
+        << lazy_attempt_debug_string()
+        << " server push-back: next hedged attempt in " << *server_pushback;
+    return *server_pushback;
+  }
+  // A non-fatal failure sends the next hedged attempt straight away.
+  return Duration::Zero();
+}
+
 absl::StatusOr<RefCountedPtr<internal::ServerRetryThrottleData>>
 ServerRetryThrottleDataFromChannelArgs(const ChannelArgs& args) {
   // Get retry throttling parameters from service config.
@@ -179,34 +340,100 @@ RetryInterceptor::RetryInterceptor(
     : per_rpc_retry_buffer_size_(GetMaxPerRpcRetryBufferSize(args)),
       service_config_parser_index_(
           internal::RetryServiceConfigParser::ParserIndex()),
-      retry_throttle_data_(std::move(retry_throttle_data)) {}
+      retry_throttle_data_(std::move(retry_throttle_data)),
+      adaptive_hedging_(
+          args.GetBool(GRPC_ARG_EXPERIMENTAL_ADAPTIVE_HEDGING).value_or(false)),
+      max_hedged_fraction_(GetMaxHedgedFraction(args)) {}
 
 void RetryInterceptor::InterceptCall(
     UnstartedCallHandler unstarted_call_handler) {
+  RefCountedPtr<retry_detail::HedgingMethodStats> hedging_stats;
+  if (adaptive_hedging_ && GetHedgingPolicy() != nullptr) {
+    const Slice* path =
+        unstarted_call_handler.UnprocessedClientInitialMetadata().get_pointer(
+            HttpPathMetadata());
+    if (path != nullptr) {
+      hedging_stats = GetHedgingMethodStats(path->as_string_view());
+    }
+  }
   auto call_handler = unstarted_call_handler.StartCall();
   auto* arena = call_handler.arena();
   auto call = arena->MakeRefCounted<Call>(RefAsSubclass<RetryInterceptor>(),
-                                          std::move(call_handler));
+                                          std::move(call_handler),
+                                          std::move(hedging_stats));
   call->StartAttempt();
   call->Start();
 }
 
-const internal::RetryMethodConfig* RetryInterceptor::GetRetryPolicy() {
+const internal::RetryMethodConfig* RetryInterceptor::GetMethodConfig() {
   auto* svc_cfg_call_data = MaybeGetContext<ServiceConfigCallData>();
   if (svc_cfg_call_data == nullptr) return nullptr;
   return static_cast<const internal::RetryMethodConfig*>(
       svc_cfg_call_data->GetMethodParsedConfig(service_config_parser_index_));
 }
 
+const internal::RetryMethodConfig* RetryInterceptor::GetRetryPolicy() {
+  const auto* config = GetMethodConfig();
+  if (config != nullptr && config->hedging_policy().has_value()) {
+    return nullptr;
+  }
+  return config;
+}
+
+const internal::HedgingPolicy* RetryInterceptor::GetHedgingPolicy() {
+  const auto* config = GetMethodConfig();
+  if (config == nullptr || !config->hedging_policy().has_value()) {
+    return nullptr;
+  }
+  return &*config->hedging_policy();
+}
+
+RefCountedPtr<retry_detail::HedgingMethodStats>
+RetryInterceptor::GetHedgingMethodStats(absl::string_view path) {
+  MutexLock lock(&hedging_stats_mu_);
+  const Timestamp now = Timestamp::Now();
+  auto it = hedging_stats_.find(path);
+  if (it != hedging_stats_.end()) {
+    it->second.last_used = now;
+    return it->second.stats;
+  }
+  if (hedging_stats_.size() >= kMaxHedgingStatsPaths) {
+    if (now >= next_hedging_stats_sweep_) {
+      // Calls still in flight hold their own ref to the stats.
+      absl::erase_if(hedging_stats_, [now](const auto& entry) {
+        return now - entry.second.last_used > kHedgingStatsIdleTimeout;
+      });
+      next_hedging_stats_sweep_ = now + kHedgingStatsSweepPeriod;
+    }
+    // The call hedges with the configured delay instead.
+    if (hedging_stats_.size() >= kMaxHedgingStatsPaths) return nullptr;
+  }
+  auto stats =
+      MakeRefCounted<retry_detail::HedgingMethodStats>(max_hedged_fraction_);
+  hedging_stats_.emplace(std::string(path), HedgingStatsEntry{stats, now});
+  return stats;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // RetryInterceptor::Call
 
-RetryInterceptor::Call::Call(RefCountedPtr<RetryInterceptor> interceptor,
-                             CallHandler call_handler)
+RetryInterceptor::Call::Call(
+    RefCountedPtr<RetryInterceptor> interceptor, CallHandler call_handler,
+    RefCountedPtr<retry_detail::HedgingMethodStats> hedging_stats)
     : call_handler_(std::move(call_handler)),
       interceptor_(std::move(interceptor)),
       retry_state_(interceptor_->GetRetryPolicy(),
-                   interceptor_->retry_throttle_data_) {
+                   interceptor_->retry_throttle_data_),
+      hedging_(interceptor_->GetHedgingPolicy() != nullptr),
+      hedging_stats_(std::move(hedging_stats)) {
+  if (hedging_) {
+    MutexLock lock(&mu_);
+    hedging_state_.emplace(interceptor_->GetHedgingPolicy(),
+                           interceptor_->retry_throttle_data_, hedging_stats_);
+    GRPC_TRACE_LOG(retry, INFO)
+        << DebugTag() << " retry call created: " << *hedging_state_;
+    return;
+  }
   GRPC_TRACE_LOG(retry, INFO)
       << DebugTag() << " retry call created: " << retry_state_;
 }
@@ -254,19 +481,160 @@ void RetryInterceptor::Call::Start() {
 }
 
 void RetryInterceptor::Call::StartAttempt() {
-  if (current_attempt_ != nullptr) {
-    current_attempt_->Cancel();
+  if (hedging_) {
+    StartHedgedAttempt();
+    return;
+  }
+  CancelAttemptsExcept(nullptr);
+  auto attempt = call_handler_.arena()->MakeRefCounted<Attempt>(
+      Ref(), retry_state_.num_attempts_completed());
+  {
+    MutexLock lock(&mu_);
+    attempts_.push_back(attempt.get());
+  }
+  attempt->Start();
+}
+
+void RetryInterceptor::Call::StartHedgedAttempt() {
+  int num_previous_attempts;
+  {
+    MutexLock lock(&mu_);
+    if (committed_attempt_ != nullptr) return;
+    if (!hedging_state_->StartAttempt([this]() { return DebugTag(); })) {
+      return;
+    }
+    num_previous_attempts = hedging_state_->num_attempts_started() - 1;
+  }
+  LaunchHedgedAttempt(num_previous_attempts);
+}
+
+void RetryInterceptor::Call::LaunchHedgedAttempt(int num_previous_attempts) {
+  auto attempt = call_handler_.arena()->MakeRefCounted<Attempt>(
+      Ref(), num_previous_attempts);
+  Duration hedging_delay;
+  bool attempts_remaining;
+  {
+    MutexLock lock(&mu_);
+    if (committed_attempt_ != nullptr) return;
+    attempts_.push_back(attempt.get());
+    hedging_delay = hedging_state_->hedging_delay();
+    attempts_remaining = hedging_state_->attempts_remaining();
+  }
+  attempt->Start();
+  if (attempts_remaining) ScheduleHedgedAttempt(hedging_delay, std::nullopt);
+}
+
+void RetryInterceptor::Call::ScheduleHedgedAttempt(
+    Duration delay, std::optional<int> num_previous_attempts) {
+  uint64_t generation;
+  {
+    MutexLock lock(&mu_);
+    generation = ++hedging_generation_;
+  }
+  call_handler_.SpawnGuardedUntilCallCompletes(
+      "hedging_delay", [self = Ref(), delay, num_previous_attempts,
+                        generation]() {
+        return Map(Sleep(delay), [self, num_previous_attempts,
+                                  generation](absl::Status) {
+          {
+            MutexLock lock(&self->mu_);
+            if (self->hedging_generation_ != generation) {
+              return absl::OkStatus();
+            }
+          }
+          if (num_previous_attempts.has_value()) {
+            self->LaunchHedgedAttempt(*num_previous_attempts);
+          } else {
+            self->StartHedgedAttempt();
+          }
+          return absl::OkStatus();
+        });
+      });
+}
+
+bool RetryInterceptor::Call::HedgedAttemptFailed(
+    Attempt* attempt, const ServerMetadata& md,
+    absl::FunctionRef<std::string()> lazy_attempt_debug_string) {
+  std::optional<Duration> delay;
+  int num_previous_attempts;
+  {
+    MutexLock lock(&mu_);
+    if (committed_attempt_ != nullptr) return false;
+    delay = hedging_state_->OnAttemptFailed(md, lazy_attempt_debug_string);
+    if (!delay.has_value()) return false;
+    if (!hedging_state_->StartAttempt(lazy_attempt_debug_string)) {
+      // No more hedged attempts: wait for the ones still in flight. The last
+      // of them to fail is the one the call commits to.
+      if (attempts_.size() <= 1) return false;
+      RemoveAttemptLocked(attempt);
+      return true;
+    }
+    RemoveAttemptLocked(attempt);
+    num_previous_attempts = hedging_state_->num_attempts_started() - 1;
+  }
+  // The next attempt has been counted already, so it is started even if
+  // retries get throttled in the meantime: there may be no other attempt in
+  // flight to finish the call.
+  if (*delay == Duration::Zero()) {
+    LaunchHedgedAttempt(num_previous_attempts);
+  } else {
+    ScheduleHedgedAttempt(*delay, num_previous_attempts);
+  }
+  return true;
+}
+
+bool RetryInterceptor::Call::CommitAttempt(Attempt* attempt,
+                                           SourceLocation whence) {
+  {
+    MutexLock lock(&mu_);
+    if (committed_attempt_ == attempt) return true;
+    GRPC_TRACE_LOG(retry, INFO)
+        << attempt->DebugTag() << " commit attempt from " << whence.file()
+        << ":" << whence.line();
+    if (committed_attempt_ != nullptr) return false;
+    if (!absl::c_linear_search(attempts_, attempt)) return false;
+    committed_attempt_ = attempt;
   }
-  auto current_attempt = call_handler_.arena()->MakeRefCounted<Attempt>(Ref());
-  current_attempt_ = current_attempt.get();
-  current_attempt->Start();
+  request_buffer_.Commit(attempt->reader());
+  CancelAttemptsExcept(attempt);
+  return true;
+}
+
+void RetryInterceptor::Call::CancelAttemptsExcept(Attempt* keep) {
+  absl::InlinedVector<RefCountedPtr<Attempt>, 1> cancelled;
+  {
+    MutexLock lock(&mu_);
+    for (Attempt* attempt : attempts_) {
+      if (attempt == keep) continue;
+      // An attempt whose last ref is gone is waiting in its destructor to
+      // remove itself.
+      auto ref = attempt->RefIfNonZero();
+      if (ref != nullptr) cancelled.push_back(std::move(ref));
+    }
+    attempts_.erase(std::remove_if(attempts_.begin(), attempts_.end(),
+                                   [keep](Attempt* a) { return a != keep; }),
+                    attempts_.end());
+  }
+  for (auto& attempt : cancelled) attempt->Cancel();
+}
+
+void RetryInterceptor::Call::RemoveAttemptLocked(Attempt* attempt) {
+  auto it = absl::c_find(attempts_, attempt);
+  if (it != attempts_.end()) attempts_.erase(it);
 }
 
 void RetryInterceptor::Call::MaybeCommit(size_t buffered) {
   GRPC_TRACE_LOG(retry, INFO) << DebugTag() << " buffered:" << buffered << "/"
                               << interceptor_->per_rpc_retry_buffer_size_;
   if (buffered >= interceptor_->per_rpc_retry_buffer_size_) {
-    std::ignore = current_attempt_->Commit();
+    // With hedging, commit to the oldest attempt in flight: it is the one
+    // most likely to get a response first.
+    RefCountedPtr<Attempt> attempt;
+    {
+      MutexLock lock(&mu_);
+      if (!attempts_.empty()) attempt = attempts_.front()->RefIfNonZero();
+    }
+    if (attempt != nullptr) std::ignore = attempt->Commit();
   }
 }
 
@@ -277,8 +645,11 @@ std::string RetryInterceptor::Call::DebugTag() {
 ////////////////////////////////////////////////////////////////////////////////
 // RetryInterceptor::Attempt
 
-RetryInterceptor::Attempt::Attempt(RefCountedPtr<Call> call)
-    : call_(std::move(call)), reader_(call_->request_buffer()) {
+RetryInterceptor::Attempt::Attempt(RefCountedPtr<Call> call,
+                                   int num_previous_attempts)
+    : call_(std::move(call)),
+      reader_(call_->request_buffer()),
+      num_previous_attempts_(num_previous_attempts) {
   GRPC_TRACE_LOG(retry, INFO) << DebugTag() << " retry attempt created";
 }
 
@@ -288,6 +659,7 @@ auto RetryInterceptor::Attempt::ServerToClientGotInitialMetadata(
     ServerMetadataHandle md) {
   GRPC_TRACE_LOG(retry, INFO)
       << DebugTag() << " get server initial metadata " << md->DebugString();
+  call_->RecordAttemptLatency(Timestamp::Now() - start_time_);
   const bool committed = Commit();
   return If(
       committed,
@@ -324,22 +696,39 @@ auto RetryInterceptor::Attempt::ServerToClientGotTrailersOnlyResponse() {
         GRPC_TRACE_LOG(retry, INFO)
             << self->DebugTag()
             << " got server trailing metadata: " << md->DebugString();
-        auto delay = self->call_->ShouldRetry(
-            *md,
-            [self = self.get()]() -> std::string { return self->DebugTag(); });
+        if (md->get(GrpcStatusMetadata()) == GRPC_STATUS_OK) {
+          self->call_->RecordAttemptLatency(Timestamp::Now() -
+                                            self->start_time_);
+        }
+        auto lazy_attempt_debug_string =
+            [self = self.get()]() -> std::string { return self->DebugTag(); };
+        // With hedging, the call may carry on with its other attempts.
+        const bool hedged_attempt_failed =
+            self->call_->hedging() &&
+            self->call_->HedgedAttemptFailed(self.get(), *md,
+                                             lazy_attempt_debug_string);
+        std::optional<Duration> delay;
+        if (!self->call_->hedging()) {
+          delay = self->call_->ShouldRetry(*md, lazy_attempt_debug_string);
+        }
         return If(
-            delay.has_value(),
-            [self, delay]() {
-              return Map(Sleep(*delay), [call = self->call_](absl::Status) {
-                call->StartAttempt();
-                return absl::OkStatus();
-              });
-            },
-            [self, md = std::move(md)]() mutable {
-              if (!self->Commit()) return absl::CancelledError();
-              self->call_->call_handler()->SpawnPushServerTrailingMetadata(
-                  std::move(md));
-              return absl::OkStatus();
+            hedged_attempt_failed, []() { return absl::OkStatus(); },
+            [self, delay, md = std::move(md)]() mutable {
+              return If(
+                  delay.has_value(),
+                  [self, delay]() {
+                    return Map(Sleep(*delay),
+                               [call = self->call_](absl::Status) {
+                                 call->StartAttempt();
+                                 return absl::OkStatus();
+                               });
+                  },
+                  [self, md = std::move(md)]() mutable {
+                    if (!self->Commit()) return absl::CancelledError();
+                    self->call_->call_handler()
+                        ->SpawnPushServerTrailingMetadata(std::move(md));
+                    return absl::OkStatus();
+                  });
             });
       });
 }
@@ -361,29 +750,23 @@ auto RetryInterceptor::Attempt::ServerToClient() {
 }
 
 bool RetryInterceptor::Attempt::Commit(SourceLocation whence) {
-  if (committed_) return true;
-  GRPC_TRACE_LOG(retry, INFO) << DebugTag() << " commit attempt from "
-                              << whence.file() << ":" << whence.line();
-  if (!call_->IsCurrentAttempt(this)) return false;
-  committed_ = true;
-  call_->request_buffer()->Commit(reader());
-  return true;
+  return call_->CommitAttempt(this, whence);
 }
 
 auto RetryInterceptor::Attempt::ClientToServer() {
   return TrySeq(
       reader_.PullClientInitialMetadata(),
       [self = Ref()](ClientMetadataHandle metadata) {
-        int num_attempts_completed = self->call_->num_attempts_completed();
-        if (GPR_UNLIKELY(num_attempts_completed > 0)) {
+        if (GPR_UNLIKELY(self->num_previous_attempts_ > 0)) {
           metadata->Set(GrpcPreviousRpcAttemptsMetadata(),
-                        num_attempts_completed);
+                        self->num_previous_attempts_);
         } else {
           metadata->Remove(GrpcPreviousRpcAttemptsMetadata());
         }
         self->initiator_ = self->call_->interceptor()->MakeChildCall(
             std::move(metadata), self->call_->call_handler()->arena()->Ref());
         self->call_->call_handler()->AddChildCall(self->initiator_);
+        self->child_call_started_ = true;
         self->initiator_.SpawnGuarded(
             "server_to_client", [self]() { return self->ServerToClient(); });
         return ForEach(MessagesFrom(&self->reader_),
@@ -395,11 +778,26 @@ auto RetryInterceptor::Attempt::ClientToServer() {
 }
 
 void RetryInterceptor::Attempt::Start() {
+  start_time_ = Timestamp::Now();
   call_->call_handler()->SpawnGuardedUntilCallCompletes(
-      "buffer_to_server", [self = Ref()]() { return self->ClientToServer(); });
+      "buffer_to_server", [self = Ref()]() {
+        // Reading from the request buffer fails once the call is committed to
+        // another attempt: that ends this attempt, not the call.
+        return Map(self->ClientToServer(), [self](auto status) {
+          if (!IsStatusOk(status)) self->CancelChildCall();
+          return absl::OkStatus();
+        });
+      });
 }
 
-void RetryInterceptor::Attempt::Cancel() { initiator_.SpawnCancel(); }
+void RetryInterceptor::Attempt::Cancel() {
+  call_->call_handler()->SpawnInfallible(
+      "cancel_attempt", [self = Ref()]() { self->CancelChildCall(); });
+}
+
+void RetryInterceptor::Attempt::CancelChildCall() {
+  if (child_call_started_) initiator_.SpawnCancel();
+}
 
 std::string RetryInterceptor::Attempt::DebugTag() const {
   return absl::StrFormat("%s attempt:%p", call_->DebugTag(), this);
@@ -15,6 +15,14 @@
 #ifndef GRPC_SRC_CORE_CLIENT_CHANNEL_RETRY_INTERCEPTOR_H
 #define GRPC_SRC_CORE_CLIENT_CHANNEL_RETRY_INTERCEPTOR_H
 
+#include <cstdint>
+#include <optional>
+#include <string>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/container/inlined_vector.h"
+#include "absl/strings/string_view.h"
 #include "src/core/call/interception_chain.h"
 #include "src/core/call/request_buffer.h"
 #include "src/core/client_channel/client_channel_args.h"
@@ -22,6 +30,9 @@
 #include "src/core/client_channel/retry_throttle.h"
 #include "src/core/filter/filter_args.h"
 #include "src/core/util/backoff.h"
+#include "src/core/util/ref_counted.h"
+#include "src/core/util/sync.h"
+#include "src/core/util/time.h"
 
 namespace grpc_core {
 
@@ -56,6 +67,110 @@ class RetryState {
   BackOff retry_backoff_;
 };
 
+// A streaming sketch of a latency distribution: a histogram with buckets
+// about 19% wide, whose counts are halved every kDecayCount samples so that it
+// follows changes in the distribution. Not thread safe.
+class LatencySketch {
+ public:
+  static constexpr uint32_t kDecayCount = 1024;
+
+  void Add(Duration latency);
+  // Returns the p-th percentile (0 < p < 1) of the samples, rounded up to
+  // the end of its bucket.
+  Duration Percentile(double p) const;
+  uint32_t count() const { return count_; }
+
+ private:
+  // Bucket 0 holds latencies under 1ms, and bucket i latencies from
+  // 2^((i-1)/4) to 2^(i/4) ms; the last bucket also holds everything longer.
+  static constexpr int kBucketsPerDoubling = 4;
+  static constexpr int kNumBuckets = 1 + 20 * kBucketsPerDoubling;
+
+  uint32_t buckets_[kNumBuckets] = {};
+  uint32_t count_ = 0;
+};
+
+// What the calls to one method on one channel have seen, for adaptive
+// hedging: how long attempts take to get a response, from which the hedging
+// delay is derived, and how many hedged attempts have been sent, to cap them
+// to a fraction of the calls.
+class HedgingMethodStats final : public RefCounted<HedgingMethodStats> {
+ public:
+  // Samples needed before the observed latency replaces the configured
+  // hedging delay.
+  static constexpr uint32_t kMinSamples = 100;
+
+  explicit HedgingMethodStats(double max_hedged_fraction)
+      : max_hedged_fraction_(max_hedged_fraction) {}
+
+  void RecordCall();
+  // Returns true, and counts the hedged attempt, if it fits within
+  // max_hedged_fraction of the calls.
+  bool TryRecordHedgedAttempt();
+  void RecordLatency(Duration latency);
+  // The p95 of recorded latencies, or configured_delay if there are fewer
+  // than kMinSamples of them.
+  Duration HedgingDelay(Duration configured_delay);
+
+ private:
+  const double max_hedged_fraction_;
+  Mutex mu_;
+  LatencySketch latencies_ ABSL_GUARDED_BY(mu_);
+  // Halved together every LatencySketch::kDecayCount calls.
+  double calls_ ABSL_GUARDED_BY(mu_) = 0;
+  double hedged_attempts_ ABSL_GUARDED_BY(mu_) = 0;
+};
+
+// The hedging counterpart of RetryState (gRFC A6): counts the hedged attempts
+// started so far, and decides what a failed attempt means for the rest of the
+// call.
+class HedgingState {
+ public:
+  // If method_stats is set, hedging is adaptive: the hedging delay follows
+  // the method's observed latency, and hedged attempts are capped to a
+  // fraction of its calls.
+  HedgingState(
+      const internal::HedgingPolicy* hedging_policy,
+      RefCountedPtr<internal::ServerRetryThrottleData> retry_throttle_data,
+      RefCountedPtr<HedgingMethodStats> method_stats);
+
+  // Returns true, and counts the attempt as started, if another attempt may
+  // be started: fewer than maxAttempts have been started, the server has not
+  // pushed back with a negative delay, and - for all but the first attempt -
+  // retries are not throttled and the adaptive hedging cap is not reached.
+  bool StartAttempt(absl::FunctionRef<std::string()> lazy_attempt_debug_string);
+  // Called with the status of an attempt that got a trailers only response.
+  // if nullopt --> the status is fatal: commit to it
+  // if duration --> the status is non-fatal: the next hedged attempt may be
+  //                 started after duration
+  std::optional<Duration> OnAttemptFailed(
+      const ServerMetadata& md,
+      absl::FunctionRef<std::string()> lazy_attempt_debug_string);
+
+  Duration hedging_delay() const;
+  int num_attempts_started() const { return num_attempts_started_; }
+  bool attempts_remaining() const {
+    return num_attempts_started_ < hedging_policy_->max_attempts() &&
+           !stopped_by_server_pushback_;
+  }
+
+  template <typename Sink>
+  friend void AbslStringify(Sink& sink, const HedgingState& state) {
+    sink.Append(absl::StrCat(
+        "hedging_policy:{", *state.hedging_policy_,
+        "} throttle:", state.retry_throttle_data_ != nullptr,
+        " adaptive:", state.method_stats_ != nullptr,
+        " attempts:", state.num_attempts_started_));
+  }
+
+ private:
+  const internal::HedgingPolicy* const hedging_policy_;
+  RefCountedPtr<internal::ServerRetryThrottleData> retry_throttle_data_;
+  RefCountedPtr<HedgingMethodStats> method_stats_;
+  int num_attempts_started_ = 0;
+  bool stopped_by_server_pushback_ = false;
+};
+
 absl::StatusOr<RefCountedPtr<internal::ServerRetryThrottleData>>
 ServerRetryThrottleDataFromChannelArgs(const ChannelArgs& args);
 }  // namespace retry_detail
@@ -80,7 +195,9 @@ class RetryInterceptor : public Interceptor {
   class Call final
       : public RefCounted<Call, NonPolymorphicRefCount, UnrefCallDtor> {
    public:
-    Call(RefCountedPtr<RetryInterceptor> interceptor, CallHandler call_handler);
+    // hedging_stats is set for methods with adaptive hedging.
+    Call(RefCountedPtr<RetryInterceptor> interceptor, CallHandler call_handler,
+         RefCountedPtr<retry_detail::HedgingMethodStats> hedging_stats);
 
     void StartAttempt();
     void Start();
@@ -88,6 +205,7 @@ class RetryInterceptor : public Interceptor {
     RequestBuffer* request_buffer() { return &request_buffer_; }
     CallHandler* call_handler() { return &call_handler_; }
     RetryInterceptor* interceptor() { return interceptor_.get(); }
+    bool hedging() const { return hedging_; }
     // if nullopt --> commit & don't retry
     // if duration --> retry after duration
     std::optional<Duration> ShouldRetry(
@@ -96,15 +214,23 @@ class RetryInterceptor : public Interceptor {
       return retry_state_.ShouldRetry(md, request_buffer_.committed(),
                                       lazy_attempt_debug_string);
     }
-    int num_attempts_completed() const {
-      return retry_state_.num_attempts_completed();
+    // Hedging only: called when attempt got a trailers only response.
+    // Returns true if the call carries on with other hedged attempts, false if
+    // the call should commit to this response.
+    bool HedgedAttemptFailed(
+        Attempt* attempt, const ServerMetadata& md,
+        absl::FunctionRef<std::string()> lazy_attempt_debug_string);
+    // Commits the call to attempt and cancels every other attempt. Returns
+    // false if the call was already committed to another attempt, or attempt
+    // is no longer in flight.
+    bool CommitAttempt(Attempt* attempt, SourceLocation whence);
+    // Records how long an attempt took to get a response from the server.
+    void RecordAttemptLatency(Duration latency) {
+      if (hedging_stats_ != nullptr) hedging_stats_->RecordLatency(latency);
     }
     void RemoveAttempt(Attempt* attempt) {
-      if (current_attempt_ == attempt) current_attempt_ = nullptr;
-    }
-    bool IsCurrentAttempt(Attempt* attempt) {
-      CHECK(attempt != nullptr);
-      return current_attempt_ == attempt;
+      MutexLock lock(&mu_);
+      RemoveAttemptLocked(attempt);
     }
 
     std::string DebugTag();
@@ -112,18 +238,47 @@ class RetryInterceptor : public Interceptor {
    private:
     void MaybeCommit(size_t buffered);
     auto ClientToBuffer();
+    // Starts a hedged attempt if hedging_state_ allows it.
+    void StartHedgedAttempt() ABSL_LOCKS_EXCLUDED(mu_);
+    // Starts a hedged attempt that hedging_state_ already counted, and
+    // schedules the next one after the hedging delay.
+    void LaunchHedgedAttempt(int num_previous_attempts)
+        ABSL_LOCKS_EXCLUDED(mu_);
+    // Starts a hedged attempt after delay, unless another one is scheduled in
+    // the meantime. If num_previous_attempts is set, the attempt was already
+    // counted by hedging_state_ and is started regardless of throttling.
+    void ScheduleHedgedAttempt(Duration delay,
+                               std::optional<int> num_previous_attempts)
+        ABSL_LOCKS_EXCLUDED(mu_);
+    void CancelAttemptsExcept(Attempt* keep) ABSL_LOCKS_EXCLUDED(mu_);
+    void RemoveAttemptLocked(Attempt* attempt)
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
 
     RequestBuffer request_buffer_;
     CallHandler call_handler_;
     RefCountedPtr<RetryInterceptor> interceptor_;
-    Attempt* current_attempt_ = nullptr;
     retry_detail::RetryState retry_state_;
+    const bool hedging_;
+    const RefCountedPtr<retry_detail::HedgingMethodStats> hedging_stats_;
+    // Attempts may run on their own threads (each attempt is its own child
+    // call), and with hedging several of them are in flight at once.
+    Mutex mu_;
+    // The attempts in flight, oldest first. Without a hedging policy there is
+    // at most one.
+    absl::InlinedVector<Attempt*, 1> attempts_ ABSL_GUARDED_BY(mu_);
+    Attempt* committed_attempt_ ABSL_GUARDED_BY(mu_) = nullptr;
+    // Set if hedging_.
+    std::optional<retry_detail::HedgingState> hedging_state_
+        ABSL_GUARDED_BY(mu_);
+    // Bumped each time a hedged attempt is scheduled, so that a hedging delay
+    // cut short by a non-fatal failure does not start an extra attempt.
+    uint64_t hedging_generation_ ABSL_GUARDED_BY(mu_) = 0;
   };
 
   class Attempt final
       : public RefCounted<Attempt, NonPolymorphicRefCount, UnrefCallDtor> {
    public:
-    explicit Attempt(RefCountedPtr<Call> call);
+    Attempt(RefCountedPtr<Call> call, int num_previous_attempts);
     ~Attempt();
 
     void Start();
@@ -138,18 +293,47 @@ class RetryInterceptor : public Interceptor {
     auto ServerToClient();
     auto ServerToClientGotInitialMetadata(ServerMetadataHandle md);
     auto ServerToClientGotTrailersOnlyResponse();
+    // Runs on the call's party, as does ClientToServer().
+    void CancelChildCall();
 
     RefCountedPtr<Call> call_;
     RequestBuffer::Reader reader_;
     CallInitiator initiator_;
-    bool committed_ = false;
+    const int num_previous_attempts_;
+    Timestamp start_time_;
+    bool child_call_started_ = false;
   };
 
+  const internal::RetryMethodConfig* GetMethodConfig();
+  // The retry policy of the method, unless it has a hedging policy instead.
   const internal::RetryMethodConfig* GetRetryPolicy();
+  const internal::HedgingPolicy* GetHedgingPolicy();
+  // Returns nullptr if the channel already tracks kMaxHedgingStatsPaths
+  // methods, none of which has been idle for kHedgingStatsIdleTimeout.
+  RefCountedPtr<retry_detail::HedgingMethodStats> GetHedgingMethodStats(
+      absl::string_view path);
+
+  // Bounds the per-method stats, since the paths come from the application.
+  static constexpr size_t kMaxHedgingStatsPaths = 1024;
+  static constexpr Duration kHedgingStatsIdleTimeout = Duration::Minutes(5);
+  // How often a full map may be swept for idle methods.
+  static constexpr Duration kHedgingStatsSweepPeriod = Duration::Minutes(1);
+
+  struct HedgingStatsEntry {
+    RefCountedPtr<retry_detail::HedgingMethodStats> stats;
+    Timestamp last_used;
+  };
 
   const size_t per_rpc_retry_buffer_size_;
   const size_t service_config_parser_index_;
   const RefCountedPtr<internal::ServerRetryThrottleData> retry_throttle_data_;
+  const bool adaptive_hedging_;
+  const double max_hedged_fraction_;
+  Mutex hedging_stats_mu_;
+  absl::flat_hash_map<std::string, HedgingStatsEntry> hedging_stats_
+      ABSL_GUARDED_BY(hedging_stats_mu_);
+  Timestamp next_hedging_stats_sweep_ ABSL_GUARDED_BY(hedging_stats_mu_) =
+      Timestamp::InfPast();
 };
 
 }  // namespace grpc_core
@@ -213,6 +213,55 @@ void RetryMethodConfig::JsonPostLoad(const Json& json, const JsonArgs& args,
   }
 }
 
+//
+// HedgingPolicy
+//
+
+const JsonLoaderInterface* HedgingPolicy::JsonLoader(const JsonArgs&) {
+  static const auto* loader =
+      JsonObjectLoader<HedgingPolicy>()
+          // Note: The "nonFatalStatusCodes" field requires custom parsing,
+          // so it's handled in JsonPostLoad() instead.
+          .Field("maxAttempts", &HedgingPolicy::max_attempts_)
+          .OptionalField("hedgingDelay", &HedgingPolicy::hedging_delay_)
+          .Finish();
+  return loader;
+}
+
+void HedgingPolicy::JsonPostLoad(const Json& json, const JsonArgs& args,
+                                 ValidationErrors* errors) {
+  // Validate maxAttempts.
+  {
+    ValidationErrors::ScopedField field(errors, ".maxAttempts");
+    if (!errors->FieldHasErrors()) {
+      if (max_attempts_ <= 1) {
+        errors->AddError("must be at least 2");
+      } else if (max_attempts_ > MAX_MAX_RETRY_ATTEMPTS) {
+        LOG(ERROR) << "service config: clamped hedgingPolicy.maxAttempts at "
+                   << MAX_MAX_RETRY_ATTEMPTS;
+        max_attempts_ = MAX_MAX_RETRY_ATTEMPTS;
+      }
+    }
+  }
+  // Parse nonFatalStatusCodes.
+  auto status_code_list = LoadJsonObjectField<std::vector<std::string>>(
+      json.object(), args, "nonFatalStatusCodes", errors,
+      /*required=*/false);
+  if (status_code_list.has_value()) {
+    for (size_t i = 0; i < status_code_list->size(); ++i) {
+      ValidationErrors::ScopedField field(
+          errors, absl::StrCat(".nonFatalStatusCodes[", i, "]"));
+      grpc_status_code status;
+      if (!grpc_status_code_from_string((*status_code_list)[i].c_str(),
+                                        &status)) {
+        errors->AddError("failed to parse status code");
+      } else {
+        non_fatal_status_codes_.Add(status);
+      }
+    }
+  }
+}
+
 //
 // RetryServiceConfigParser
 //
@@ -255,14 +304,24 @@ namespace {
 
 struct MethodConfig {
   std::unique_ptr<RetryMethodConfig> retry_policy;
+  std::optional<HedgingPolicy> hedging_policy;
 
   static const JsonLoaderInterface* JsonLoader(const JsonArgs&) {
     static const auto* loader =
         JsonObjectLoader<MethodConfig>()
             .OptionalField("retryPolicy", &MethodConfig::retry_policy)
+            .OptionalField("hedgingPolicy", &MethodConfig::hedging_policy,
+                           GRPC_ARG_EXPERIMENTAL_ENABLE_HEDGING)
             .Finish();
     return loader;
   }
+
+  void JsonPostLoad(const Json&, const JsonArgs&, ValidationErrors* errors) {
+    if (retry_policy != nullptr && hedging_policy.has_value()) {
+      ValidationErrors::ScopedField field(errors, ".hedgingPolicy");
+      errors->AddError("retryPolicy and hedgingPolicy are mutually exclusive");
+    }
+  }
 };
 
 }  // namespace
@@ -273,6 +332,10 @@ RetryServiceConfigParser::ParsePerMethodParams(const ChannelArgs& args,
                                                ValidationErrors* errors) {
   auto method_params =
       LoadFromJson<MethodConfig>(json, JsonChannelArgs(args), errors);
+  if (method_params.hedging_policy.has_value()) {
+    return std::make_unique<RetryMethodConfig>(
+        std::move(*method_params.hedging_policy));
+  }
   return std::move(method_params.retry_policy);
 }
 
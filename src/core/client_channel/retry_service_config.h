@@ -17,13 +17,17 @@
 #ifndef GRPC_SRC_CORE_CLIENT_CHANNEL_RETRY_SERVICE_CONFIG_H
 #define GRPC_SRC_CORE_CLIENT_CHANNEL_RETRY_SERVICE_CONFIG_H
 
+#include <grpc/impl/channel_arg_names.h>
 #include <grpc/support/port_platform.h>
 #include <stddef.h>
 #include <stdint.h>
 
 #include <memory>
 #include <optional>
+#include <utility>
+#include <vector>
 
+#include "absl/strings/str_cat.h"
 #include "absl/strings/string_view.h"
 #include "src/core/call/status_util.h"
 #include "src/core/config/core_configuration.h"
@@ -52,8 +56,47 @@ class RetryGlobalConfig final : public ServiceConfigParser::ParsedConfig {
   uintptr_t milli_token_ratio_ = 0;
 };
 
+// A hedgingPolicy from a method config, as per gRFC A6.
+class HedgingPolicy final {
+ public:
+  int max_attempts() const { return max_attempts_; }
+  Duration hedging_delay() const { return hedging_delay_; }
+  StatusCodeSet non_fatal_status_codes() const {
+    return non_fatal_status_codes_;
+  }
+
+  static const JsonLoaderInterface* JsonLoader(const JsonArgs&);
+  void JsonPostLoad(const Json& json, const JsonArgs& args,
+                    ValidationErrors* errors);
+
+  template <typename Sink>
+  friend void AbslStringify(Sink& sink, const HedgingPolicy& policy) {
+    sink.Append(absl::StrCat(
+        "max_attempts:", policy.max_attempts_,
+        " hedging_delay:", policy.hedging_delay_, " non_fatal_status_codes:",
+        policy.non_fatal_status_codes_.ToString()));
+  }
+
+ private:
+  int max_attempts_ = 0;
+  Duration hedging_delay_;
+  StatusCodeSet non_fatal_status_codes_;
+};
+
+// The retry policy or the hedging policy of a method: a method config may
+// have one or the other, not both.
 class RetryMethodConfig final : public ServiceConfigParser::ParsedConfig {
  public:
+  RetryMethodConfig() = default;
+  explicit RetryMethodConfig(HedgingPolicy hedging_policy)
+      : hedging_policy_(std::move(hedging_policy)) {}
+
+  // Set if the method has a hedging policy, in which case the retry policy
+  // fields below are unset.
+  const std::optional<HedgingPolicy>& hedging_policy() const {
+    return hedging_policy_;
+  }
+
   int max_attempts() const { return max_attempts_; }
   Duration initial_backoff() const { return initial_backoff_; }
   Duration max_backoff() const { return max_backoff_; }
@@ -71,6 +114,10 @@ class RetryMethodConfig final : public ServiceConfigParser::ParsedConfig {
 
   template <typename Sink>
   friend void AbslStringify(Sink& sink, const RetryMethodConfig& config) {
+    if (config.hedging_policy_.has_value()) {
+      sink.Append(absl::StrCat("hedging:{", *config.hedging_policy_, "}"));
+      return;
+    }
     sink.Append(absl::StrCat(
         "max_attempts:", config.max_attempts_, " initial_backoff:",
         config.initial_backoff_, " max_backoff:", config.max_backoff_,
@@ -89,6 +136,7 @@ class RetryMethodConfig final : public ServiceConfigParser::ParsedConfig {
   float backoff_multiplier_ = 0;
   StatusCodeSet retryable_status_codes_;
   std::optional<Duration> per_attempt_recv_timeout_;
+  std::optional<HedgingPolicy> hedging_policy_;
 };
 
 class RetryServiceConfigParser final : public ServiceConfigParser::Parser {
@@ -103,6 +151,10 @@ class RetryServiceConfigParser final : public ServiceConfigParser::Parser {
       const ChannelArgs& args, const Json& json,
       ValidationErrors* errors) override;
 
+  std::vector<absl::string_view> ChannelArgKeys() const override {
+    return {GRPC_ARG_EXPERIMENTAL_ENABLE_HEDGING};
+  }
+
   static size_t ParserIndex();
   static void Register(CoreConfiguration::Builder* builder);
 
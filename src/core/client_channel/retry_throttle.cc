@@ -105,6 +105,14 @@ void ServerRetryThrottleData::RecordSuccess() {
                                  std::numeric_limits<intptr_t>::max())));
 }
 
+bool ServerRetryThrottleData::RetryAllowed() {
+  // First, check if we are stale and need to be replaced.
+  ServerRetryThrottleData* throttle_data = this;
+  GetReplacementThrottleDataIfNeeded(&throttle_data);
+  return static_cast<uintptr_t>(throttle_data->milli_tokens()) >
+         throttle_data->max_milli_tokens_ / 2;
+}
+
 //
 // ServerRetryThrottleMap
 //
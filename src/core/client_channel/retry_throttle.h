@@ -50,6 +50,10 @@ class ServerRetryThrottleData final
   /// Records a success.
   void RecordSuccess();
 
+  /// Returns true if it's okay to send a retry, without recording anything.
+  /// Used before sending hedged attempts.
+  bool RetryAllowed();
+
   uintptr_t max_milli_tokens() const { return max_milli_tokens_; }
   uintptr_t milli_token_ratio() const { return milli_token_ratio_; }
   intptr_t milli_tokens() const {
@@ -27,8 +27,10 @@
 #include <memory>
 #include <new>
 #include <optional>
+#include <string>
 #include <utility>
 
+#include "absl/hash/hash.h"
 #include "absl/log/check.h"
 #include "absl/log/log.h"
 #include "absl/status/statusor.h"
@@ -78,6 +80,10 @@
 #define GRPC_SUBCHANNEL_RECONNECT_MAX_BACKOFF_SECONDS 120
 #define GRPC_SUBCHANNEL_RECONNECT_JITTER 0.2
 
+// Connection pool parameters.
+#define GRPC_SUBCHANNEL_MAX_CONNECTIONS_LIMIT 32
+#define GRPC_SUBCHANNEL_DEFAULT_MAX_CALLS_PER_CONNECTION 100
+
 // Conversion between subchannel call and call stack.
 #define SUBCHANNEL_CALL_TO_CALL_STACK(call) \
   (grpc_call_stack*)((char*)(call) +        \
@@ -242,6 +248,7 @@ SubchannelCall::SubchannelCall(Args args, grpc_error_handle* error)
     : connected_subchannel_(args.connected_subchannel
                                 .TakeAsSubclass<LegacyConnectedSubchannel>()),
       deadline_(args.deadline) {
+  connected_subchannel_->IncrementCallsInFlight();
   grpc_call_stack* callstk = SUBCHANNEL_CALL_TO_CALL_STACK(this);
   const grpc_call_element_args call_args = {
       callstk,            // call_stack
@@ -311,6 +318,7 @@ void SubchannelCall::Destroy(void* arg, grpc_error_handle /*error*/) {
   grpc_closure* after_call_stack_destroy = self->after_call_stack_destroy_;
   RefCountedPtr<ConnectedSubchannel> connected_subchannel =
       std::move(self->connected_subchannel_);
+  connected_subchannel->DecrementCallsInFlight();
   // Destroy the subchannel call.
   self->~SubchannelCall();
   // Destroy the call stack. This should be after destroying the subchannel
@@ -389,8 +397,10 @@ class Subchannel::ConnectedSubchannelStateWatcher final
     : public AsyncConnectivityStateWatcherInterface {
  public:
   // Must be instantiated while holding c->mu.
-  explicit ConnectedSubchannelStateWatcher(WeakRefCountedPtr<Subchannel> c)
-      : subchannel_(std::move(c)) {}
+  ConnectedSubchannelStateWatcher(WeakRefCountedPtr<Subchannel> c,
+                                  ConnectedSubchannel* connected_subchannel)
+      : subchannel_(std::move(c)),
+        connected_subchannel_(connected_subchannel) {}
 
   ~ConnectedSubchannelStateWatcher() override {
     subchannel_.reset(DEBUG_LOCATION, "state_watcher");
@@ -410,29 +420,37 @@ class Subchannel::ConnectedSubchannelStateWatcher final
       // we will see TRANSIENT_FAILURE followed by SHUTDOWN, but if not, we
       // will see only SHUTDOWN.  Either way, we react to the first one we
       // see, ignoring anything that happens after that.
-      if (c->connected_subchannel_ == nullptr) return;
-      if (new_state == GRPC_CHANNEL_TRANSIENT_FAILURE ||
-          new_state == GRPC_CHANNEL_SHUTDOWN) {
-        GRPC_TRACE_LOG(subchannel, INFO)
-            << "subchannel " << c << " " << c->key_.ToString()
-            << ": Connected subchannel " << c->connected_subchannel_.get()
-            << " reports " << ConnectivityStateName(new_state) << ": "
-            << status;
-        c->connected_subchannel_.reset();
-        if (c->channelz_node() != nullptr) {
-          c->channelz_node()->SetChildSocket(nullptr);
-        }
-        // Even though we're reporting IDLE instead of TRANSIENT_FAILURE here,
-        // pass along the status from the transport, since it may have
-        // keepalive info attached to it that the channel needs.
-        // TODO(roth): Consider whether there's a cleaner way to do this.
-        c->SetConnectivityStateLocked(GRPC_CHANNEL_IDLE, status);
-        c->backoff_.Reset();
+      if (new_state != GRPC_CHANNEL_TRANSIENT_FAILURE &&
+          new_state != GRPC_CHANNEL_SHUTDOWN) {
+        return;
+      }
+      // A connection past the first going away only shrinks the pool.
+      if (c->connected_subchannel_.get() != connected_subchannel_) {
+        c->RemoveExtraConnectionLocked(connected_subchannel_);
+        return;
+      }
+      GRPC_TRACE_LOG(subchannel, INFO)
+          << "subchannel " << c << " " << c->key_.ToString()
+          << ": Connected subchannel " << c->connected_subchannel_.get()
+          << " reports " << ConnectivityStateName(new_state) << ": "
+          << status;
+      c->connected_subchannel_.reset();
+      c->extra_connections_.clear();
+      if (c->channelz_node() != nullptr) {
+        c->channelz_node()->SetChildSocket(nullptr);
       }
+      // Even though we're reporting IDLE instead of TRANSIENT_FAILURE here,
+      // pass along the status from the transport, since it may have
+      // keepalive info attached to it that the channel needs.
+      // TODO(roth): Consider whether there's a cleaner way to do this.
+      c->SetConnectivityStateLocked(GRPC_CHANNEL_IDLE, status);
+      c->backoff_.Reset();
     }
   }
 
   WeakRefCountedPtr<Subchannel> subchannel_;
+  // The connection being watched.  Compared against, never dereferenced.
+  ConnectedSubchannel* const connected_subchannel_;
 };
 
 //
@@ -511,6 +529,12 @@ Subchannel::Subchannel(SubchannelKey key,
       key_(std::move(key)),
       args_(args),
       pollset_set_(grpc_pollset_set_create()),
+      max_connections_(Clamp(
+          args.GetInt(GRPC_ARG_MAX_CONNECTIONS_PER_SUBCHANNEL).value_or(1), 1,
+          GRPC_SUBCHANNEL_MAX_CONNECTIONS_LIMIT)),
+      max_calls_per_connection_(std::max(
+          1, args.GetInt(GRPC_ARG_SUBCHANNEL_MAX_CALLS_PER_CONNECTION)
+                 .value_or(GRPC_SUBCHANNEL_DEFAULT_MAX_CALLS_PER_CONNECTION))),
       connector_(std::move(connector)),
       watcher_list_(this),
       work_serializer_(args_.GetObjectRef<EventEngine>()),
@@ -570,22 +594,54 @@ Subchannel::~Subchannel() {
 RefCountedPtr<Subchannel> Subchannel::Create(
     OrphanablePtr<SubchannelConnector> connector,
     const grpc_resolved_address& address, const ChannelArgs& args) {
-  SubchannelKey key(address, args);
+  SubchannelKey key(address, MakeSubchannelKeyArgs(args));
   auto* subchannel_pool = args.GetObject<SubchannelPoolInterface>();
   CHECK_NE(subchannel_pool, nullptr);
   RefCountedPtr<Subchannel> c = subchannel_pool->FindSubchannel(key);
-  if (c != nullptr) {
-    return c;
+  if (c == nullptr) {
+    c = MakeRefCounted<Subchannel>(std::move(key), std::move(connector), args);
+    // Try to register the subchannel before setting the subchannel pool.
+    // Otherwise, in case of a registration race, unreffing c in
+    // RegisterSubchannel() will cause c to be tried to be unregistered, while
+    // its key maps to a different subchannel.
+    RefCountedPtr<Subchannel> registered =
+        subchannel_pool->RegisterSubchannel(c->key_, c);
+    if (registered == c) {
+      c->subchannel_pool_ = subchannel_pool->Ref();
+      c->AddSharingArgs(args);
+      return c;
+    }
+    c = std::move(registered);
+  }
+  c->AddSharingArgs(args);
+  return c;
+}
+
+void Subchannel::AddSharingArgs(const ChannelArgs& args) {
+  // Only tracked when it can be reported, i.e. for subchannels that may be
+  // shared across channel args and have a channelz node.
+  if (channelz_node_ == nullptr ||
+      !args.GetBool(GRPC_ARG_SHARE_SUBCHANNELS_ACROSS_CHANNEL_ARGS)
+           .value_or(false)) {
+    return;
+  }
+  size_t num_sharing_args;
+  {
+    MutexLock lock(&mu_);
+    // Pool hits from a channel that already holds this subchannel, e.g.
+    // after an LB policy update, do not add an entry.
+    if (!sharing_args_.insert(absl::Hash<std::string>()(args.ToString()))
+             .second) {
+      return;
+    }
+    num_sharing_args = sharing_args_.size();
   }
-  c = MakeRefCounted<Subchannel>(std::move(key), std::move(connector), args);
-  // Try to register the subchannel before setting the subchannel pool.
-  // Otherwise, in case of a registration race, unreffing c in
-  // RegisterSubchannel() will cause c to be tried to be unregistered, while
-  // its key maps to a different subchannel.
-  RefCountedPtr<Subchannel> registered =
-      subchannel_pool->RegisterSubchannel(c->key_, c);
-  if (registered == c) c->subchannel_pool_ = subchannel_pool->Ref();
-  return registered;
+  if (num_sharing_args == 1) return;
+  channelz_node_->AddTraceEvent(
+      channelz::ChannelTrace::Severity::Info,
+      grpc_slice_from_cpp_string(absl::StrCat(
+          "subchannel shared with another channel (", num_sharing_args,
+          " distinct channel args)")));
 }
 
 void Subchannel::ThrottleKeepaliveTime(int new_keepalive_time) {
@@ -629,6 +685,27 @@ void Subchannel::CancelConnectivityStateWatch(
   watcher_list_.RemoveWatcherLocked(watcher);
 }
 
+RefCountedPtr<ConnectedSubchannel>
+Subchannel::connected_subchannel_for_call() {
+  MutexLock lock(&mu_);
+  if (connected_subchannel_ == nullptr || max_connections_ == 1) {
+    return connected_subchannel_;
+  }
+  ConnectedSubchannel* least_loaded = connected_subchannel_.get();
+  for (const auto& connection : extra_connections_) {
+    if (connection->calls_in_flight() < least_loaded->calls_in_flight()) {
+      least_loaded = connection.get();
+    }
+  }
+  if (least_loaded->calls_in_flight() >= max_calls_per_connection_ &&
+      !extra_connection_pending_ &&
+      extra_connections_.size() + 1 < max_connections_ &&
+      Timestamp::Now() >= next_extra_connection_time_) {
+    StartExtraConnectionLocked();
+  }
+  return least_loaded->Ref();
+}
+
 void Subchannel::RequestConnection() {
   MutexLock lock(&mu_);
   if (state_ == GRPC_CHANNEL_IDLE) {
@@ -663,6 +740,7 @@ void Subchannel::Orphaned() {
   shutdown_ = true;
   connector_.reset();
   connected_subchannel_.reset();
+  extra_connections_.clear();
 }
 
 void Subchannel::GetOrAddDataProducer(
@@ -733,6 +811,9 @@ void Subchannel::StartConnectingLocked() {
   next_attempt_time_ = now + backoff_.NextAttemptDelay();
   // Report CONNECTING.
   SetConnectivityStateLocked(GRPC_CHANNEL_CONNECTING, absl::OkStatus());
+  // If the connector is already opening an extra connection, that attempt
+  // becomes this one.
+  if (std::exchange(extra_connection_pending_, false)) return;
   // Start connection attempt.
   SubchannelConnector::Args args;
   args.address = &address_for_connect_;
@@ -757,6 +838,10 @@ void Subchannel::OnConnectingFinishedLocked(grpc_error_handle error) {
     connecting_result_.Reset();
     return;
   }
+  if (std::exchange(extra_connection_pending_, false)) {
+    OnExtraConnectingFinishedLocked();
+    return;
+  }
   // If we didn't get a transport or we fail to publish it, report
   // TRANSIENT_FAILURE and start the retry timer.
   // Note that if the connection attempt took longer than the backoff
@@ -791,6 +876,28 @@ void Subchannel::OnConnectingFinishedLocked(grpc_error_handle error) {
 
 bool Subchannel::PublishTransportLocked() {
   auto socket_node = connecting_result_.transport->GetSocketNode();
+  connected_subchannel_ = CreateConnectedSubchannelLocked();
+  if (connected_subchannel_ == nullptr) return false;
+  // Publish.
+  GRPC_TRACE_LOG(subchannel, INFO)
+      << "subchannel " << this << " " << key_.ToString()
+      << ": new connected subchannel at " << connected_subchannel_.get();
+  if (channelz_node_ != nullptr) {
+    channelz_node_->SetChildSocket(std::move(socket_node));
+  }
+  // Start watching connected subchannel.
+  connected_subchannel_->StartWatch(
+      pollset_set_, MakeOrphanable<ConnectedSubchannelStateWatcher>(
+                        WeakRef(DEBUG_LOCATION, "state_watcher"),
+                        connected_subchannel_.get()));
+  // Report initial state.
+  SetConnectivityStateLocked(GRPC_CHANNEL_READY, absl::Status());
+  return true;
+}
+
+RefCountedPtr<ConnectedSubchannel>
+Subchannel::CreateConnectedSubchannelLocked() {
+  RefCountedPtr<ConnectedSubchannel> connected_subchannel;
   if (connecting_result_.transport->filter_stack_transport() != nullptr) {
     // Construct channel stack.
     // Builder takes ownership of transport.
@@ -799,16 +906,16 @@ bool Subchannel::PublishTransportLocked() {
         connecting_result_.channel_args.SetObject(
             std::exchange(connecting_result_.transport, nullptr)));
     if (!CoreConfiguration::Get().channel_init().CreateStack(&builder)) {
-      return false;
+      return nullptr;
     }
     absl::StatusOr<RefCountedPtr<grpc_channel_stack>> stack = builder.Build();
     if (!stack.ok()) {
       connecting_result_.Reset();
       LOG(ERROR) << "subchannel " << this << " " << key_.ToString()
                  << ": error initializing subchannel stack: " << stack.status();
-      return false;
+      return nullptr;
     }
-    connected_subchannel_ = MakeRefCounted<LegacyConnectedSubchannel>(
+    connected_subchannel = MakeRefCounted<LegacyConnectedSubchannel>(
         std::move(*stack), args_, channelz_node_);
   } else {
     OrphanablePtr<ClientTransport> transport(
@@ -845,26 +952,68 @@ bool Subchannel::PublishTransportLocked() {
       LOG(ERROR) << "subchannel " << this << " " << key_.ToString()
                  << ": error initializing subchannel stack: "
                  << call_destination.status();
-      return false;
+      return nullptr;
     }
-    connected_subchannel_ = MakeRefCounted<NewConnectedSubchannel>(
+    connected_subchannel = MakeRefCounted<NewConnectedSubchannel>(
         std::move(*call_destination), std::move(transport_destination), args_);
   }
   connecting_result_.Reset();
-  // Publish.
+  return connected_subchannel;
+}
+
+void Subchannel::StartExtraConnectionLocked() {
   GRPC_TRACE_LOG(subchannel, INFO)
-      << "subchannel " << this << " " << key_.ToString()
-      << ": new connected subchannel at " << connected_subchannel_.get();
-  if (channelz_node_ != nullptr) {
-    channelz_node_->SetChildSocket(std::move(socket_node));
+      << "subchannel " << this << " " << key_.ToString() << ": all "
+      << extra_connections_.size() + 1
+      << " connections are saturated, opening another";
+  extra_connection_pending_ = true;
+  SubchannelConnector::Args args;
+  args.address = &address_for_connect_;
+  args.interested_parties = pollset_set_;
+  args.deadline = Timestamp::Now() + min_connect_timeout_;
+  args.channel_args = args_;
+  WeakRef(DEBUG_LOCATION, "Connect").release();  // Ref held by callback.
+  connector_->Connect(args, &connecting_result_, &on_connecting_finished_);
+}
+
+void Subchannel::OnExtraConnectingFinishedLocked() {
+  // Extra connections are only kept while the first one is up.
+  RefCountedPtr<ConnectedSubchannel> connection;
+  if (connected_subchannel_ != nullptr &&
+      connecting_result_.transport != nullptr) {
+    connection = CreateConnectedSubchannelLocked();
   }
-  // Start watching connected subchannel.
-  connected_subchannel_->StartWatch(
-      pollset_set_, MakeOrphanable<ConnectedSubchannelStateWatcher>(
-                        WeakRef(DEBUG_LOCATION, "state_watcher")));
-  // Report initial state.
-  SetConnectivityStateLocked(GRPC_CHANNEL_READY, absl::Status());
-  return true;
+  connecting_result_.Reset();
+  if (connection == nullptr) {
+    GRPC_TRACE_LOG(subchannel, INFO)
+        << "subchannel " << this << " " << key_.ToString()
+        << ": extra connection attempt failed";
+    next_extra_connection_time_ =
+        Timestamp::Now() +
+        Duration::Seconds(GRPC_SUBCHANNEL_INITIAL_CONNECT_BACKOFF_SECONDS);
+    return;
+  }
+  GRPC_TRACE_LOG(subchannel, INFO)
+      << "subchannel " << this << " " << key_.ToString()
+      << ": new extra connection at " << connection.get();
+  connection->StartWatch(pollset_set_,
+                         MakeOrphanable<ConnectedSubchannelStateWatcher>(
+                             WeakRef(DEBUG_LOCATION, "state_watcher"),
+                             connection.get()));
+  extra_connections_.push_back(std::move(connection));
+}
+
+void Subchannel::RemoveExtraConnectionLocked(
+    ConnectedSubchannel* connected_subchannel) {
+  auto it = std::find_if(extra_connections_.begin(), extra_connections_.end(),
+                         [&](const RefCountedPtr<ConnectedSubchannel>& c) {
+                           return c.get() == connected_subchannel;
+                         });
+  if (it == extra_connections_.end()) return;
+  GRPC_TRACE_LOG(subchannel, INFO)
+      << "subchannel " << this << " " << key_.ToString()
+      << ": extra connection " << connected_subchannel << " closed";
+  extra_connections_.erase(it);
 }
 
 ChannelArgs Subchannel::MakeSubchannelArgs(
@@ -892,4 +1041,24 @@ ChannelArgs Subchannel::MakeSubchannelArgs(
       .RemoveAllKeysWithPrefix(GRPC_ARG_NO_SUBCHANNEL_PREFIX);
 }
 
+ChannelArgs Subchannel::MakeSubchannelKeyArgs(const ChannelArgs& args) {
+  if (!args.GetBool(GRPC_ARG_SHARE_SUBCHANNELS_ACROSS_CHANNEL_ARGS)
+           .value_or(false)) {
+    return args;
+  }
+  // Drop args that are read only above the subchannel, plus the user agent,
+  // so that they do not keep otherwise identical connections apart.
+  return args.Remove(GRPC_ARG_SERVICE_CONFIG)
+      .Remove(GRPC_ARG_SERVICE_CONFIG_DISABLE_RESOLUTION)
+      .Remove(GRPC_ARG_LB_POLICY_NAME)
+      .Remove(GRPC_ARG_ENABLE_RETRIES)
+      .Remove(GRPC_ARG_PER_RPC_RETRY_BUFFER_SIZE)
+      .Remove(GRPC_ARG_CLIENT_IDLE_TIMEOUT_MS)
+      .Remove(GRPC_ARG_DNS_MIN_TIME_BETWEEN_RESOLUTIONS_MS)
+      .Remove(GRPC_ARG_DNS_ENABLE_SRV_QUERIES)
+      .Remove(GRPC_ARG_DNS_ARES_QUERY_TIMEOUT_MS)
+      .Remove(GRPC_ARG_PRIMARY_USER_AGENT_STRING)
+      .Remove(GRPC_ARG_SECONDARY_USER_AGENT_STRING);
+}
+
 }  // namespace grpc_core
@@ -22,9 +22,12 @@
 #include <grpc/support/port_platform.h>
 #include <stddef.h>
 
+#include <atomic>
 #include <functional>
 #include <map>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/container/flat_hash_set.h"
@@ -80,11 +83,24 @@ class ConnectedSubchannel : public RefCounted<ConnectedSubchannel> {
   virtual size_t GetInitialCallSizeEstimate() const = 0;
   virtual void Ping(grpc_closure* on_initiate, grpc_closure* on_ack) = 0;
 
+  // Calls in flight on this connection, used to spread calls across the
+  // connections of a subchannel.  Counted by SubchannelCall.
+  size_t calls_in_flight() const {
+    return calls_in_flight_.load(std::memory_order_relaxed);
+  }
+  void IncrementCallsInFlight() {
+    calls_in_flight_.fetch_add(1, std::memory_order_relaxed);
+  }
+  void DecrementCallsInFlight() {
+    calls_in_flight_.fetch_sub(1, std::memory_order_relaxed);
+  }
+
  protected:
   explicit ConnectedSubchannel(const ChannelArgs& args);
 
  private:
   ChannelArgs args_;
+  std::atomic<size_t> calls_in_flight_{0};
 };
 
 class LegacyConnectedSubchannel;
@@ -205,6 +221,11 @@ class Subchannel final : public DualRefCounted<Subchannel> {
 
   grpc_pollset_set* pollset_set() const { return pollset_set_; }
 
+  ChannelArgs channel_args() ABSL_LOCKS_EXCLUDED(mu_) {
+    MutexLock lock(&mu_);
+    return args_;
+  }
+
   channelz::SubchannelNode* channelz_node();
 
   std::string address() const {
@@ -233,6 +254,14 @@ class Subchannel final : public DualRefCounted<Subchannel> {
     return connected_subchannel_;
   }
 
+  // Returns the connection a new call should use: the one with the fewest
+  // calls in flight, or null if not connected.  If that connection is
+  // saturated, this may start opening another one for later calls.
+  // Anything other than calls (health checks, ORCA, pings) should use
+  // connected_subchannel().
+  RefCountedPtr<ConnectedSubchannel> connected_subchannel_for_call()
+      ABSL_LOCKS_EXCLUDED(mu_);
+
   RefCountedPtr<UnstartedCallDestination> call_destination() {
     MutexLock lock(&mu_);
     if (connected_subchannel_ == nullptr) return nullptr;
@@ -274,6 +303,10 @@ class Subchannel final : public DualRefCounted<Subchannel> {
       const RefCountedPtr<SubchannelPoolInterface>& subchannel_pool,
       const std::string& channel_default_authority);
 
+  // Returns the args that go into the subchannel pool key for a subchannel
+  // created with \a args.  Exposed for testing purposes only.
+  static ChannelArgs MakeSubchannelKeyArgs(const ChannelArgs& args);
+
  private:
   // Tears down any existing connection, and arranges for destruction
   void Orphaned() override ABSL_LOCKS_EXCLUDED(mu_);
@@ -323,6 +356,18 @@ class Subchannel final : public DualRefCounted<Subchannel> {
   void OnConnectingFinishedLocked(grpc_error_handle error)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
   bool PublishTransportLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  RefCountedPtr<ConnectedSubchannel> CreateConnectedSubchannelLocked()
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  // Records that a channel with \a args uses this subchannel, and adds a
+  // channelz trace event the first time a channel with different args does.
+  void AddSharingArgs(const ChannelArgs& args) ABSL_LOCKS_EXCLUDED(mu_);
+
+  // Methods for connections past the first.
+  void StartExtraConnectionLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void OnExtraConnectingFinishedLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void RemoveExtraConnectionLocked(ConnectedSubchannel* connected_subchannel)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
 
   // The subchannel pool this subchannel is in.
   RefCountedPtr<SubchannelPoolInterface> subchannel_pool_;
@@ -339,6 +384,9 @@ class Subchannel final : public DualRefCounted<Subchannel> {
   RefCountedPtr<channelz::SubchannelNode> channelz_node_;
   // Minimum connection timeout.
   Duration min_connect_timeout_;
+  // Connection pool limits.
+  const size_t max_connections_;
+  const size_t max_calls_per_connection_;
 
   // Connection state.
   OrphanablePtr<SubchannelConnector> connector_;
@@ -350,6 +398,10 @@ class Subchannel final : public DualRefCounted<Subchannel> {
 
   bool shutdown_ ABSL_GUARDED_BY(mu_) = false;
 
+  // Hashes of the distinct channel args this subchannel has been handed out
+  // for, when it is shared across channel args.
+  absl::flat_hash_set<size_t> sharing_args_ ABSL_GUARDED_BY(mu_);
+
   // Connectivity state tracking.
   // Note that the connectivity state implies the state of the
   // Subchannel object:
@@ -366,6 +418,17 @@ class Subchannel final : public DualRefCounted<Subchannel> {
 
   // Active connection, or null.
   RefCountedPtr<ConnectedSubchannel> connected_subchannel_ ABSL_GUARDED_BY(mu_);
+  // Connections opened past the first because it was saturated.  Only
+  // kept while connected_subchannel_ is set; they do not affect the
+  // subchannel's connectivity state.
+  std::vector<RefCountedPtr<ConnectedSubchannel>> extra_connections_
+      ABSL_GUARDED_BY(mu_);
+  // True while the connector is opening an extra connection.  If the
+  // subchannel needs to reconnect meanwhile, that attempt takes over.
+  bool extra_connection_pending_ ABSL_GUARDED_BY(mu_) = false;
+  // No extra connection is attempted before this, after one fails.
+  Timestamp next_extra_connection_time_ ABSL_GUARDED_BY(mu_) =
+      Timestamp::InfPast();
 
   // Backoff state.
   BackOff backoff_ ABSL_GUARDED_BY(mu_);
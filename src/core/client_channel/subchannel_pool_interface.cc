@@ -36,13 +36,15 @@ namespace grpc_core {
 
 SubchannelKey::SubchannelKey(const grpc_resolved_address& address,
                              const ChannelArgs& args)
-    : address_(address), args_(args) {}
+    : address_(address), args_(args), args_hash_(args.Hash()) {}
 
 int SubchannelKey::Compare(const SubchannelKey& other) const {
   if (address_.len < other.address_.len) return -1;
   if (address_.len > other.address_.len) return 1;
   int r = memcmp(address_.addr, other.address_.addr, address_.len);
   if (r != 0) return r;
+  r = QsortCompare(args_hash_, other.args_hash_);
+  if (r != 0) return r;
   return QsortCompare(args_, other.args_);
 }
 
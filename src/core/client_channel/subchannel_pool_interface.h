@@ -20,6 +20,7 @@
 #define GRPC_SRC_CORE_CLIENT_CHANNEL_SUBCHANNEL_POOL_INTERFACE_H
 
 #include <grpc/support/port_platform.h>
+#include <stddef.h>
 
 #include <string>
 
@@ -66,6 +67,9 @@ class SubchannelKey final {
  private:
   grpc_resolved_address address_;
   ChannelArgs args_;
+  // Keys are ordered by the hash of their args before the args themselves,
+  // so that comparing keys for different args rarely has to walk the args.
+  size_t args_hash_;
 };
 
 // Interface for subchannel pool.
@@ -81,6 +81,24 @@ ABSL_FLAG(
     "EXPERIMENTAL: If non-zero, extend the lifetime of channelz nodes past the "
     "underlying object lifetime, up to this many nodes. The value may be "
     "adjusted slightly to account for implementation limits.");
+ABSL_FLAG(
+    absl::optional<int32_t>, grpc_event_engine_poller_busy_poll_us, {},
+    "EXPERIMENTAL: If positive, the EventEngine epoll poller spins for up to "
+    "this many microseconds before it blocks, and asks the kernel to busy poll "
+    "the network device queues for as long. Trades CPU for wakeup latency.");
+ABSL_FLAG(absl::optional<int32_t>, grpc_event_engine_poller_count, {},
+          "EXPERIMENTAL: The number of independent pollers each "
+          "PosixEventEngine runs, each with its own epoll set. New connections "
+          "are spread over them round-robin.");
+ABSL_FLAG(absl::optional<bool>, grpc_event_engine_windows_zero_byte_reads, {},
+          "EXPERIMENTAL: If true, Windows EventEngine endpoints wait for data "
+          "with zero-byte overlapped reads, so that their read buffers are not "
+          "locked while idle.");
+ABSL_FLAG(absl::optional<bool>, grpc_event_engine_lazy_fork_restart, {},
+          "EXPERIMENTAL: If true, a forked child does not restart the "
+          "EventEngine thread pool and timer threads it inherits until it "
+          "first runs a closure or arms a timer, so that fork() returns in the "
+          "child without starting any threads.");
 
 namespace grpc_core {
 
@@ -93,6 +111,14 @@ ConfigVars::ConfigVars(const Overrides& overrides)
           LoadConfig(FLAGS_grpc_channelz_max_orphaned_nodes,
                      "GRPC_CHANNELZ_MAX_ORPHANED_NODES",
                      overrides.channelz_max_orphaned_nodes, 0)),
+      event_engine_poller_busy_poll_us_(
+          LoadConfig(FLAGS_grpc_event_engine_poller_busy_poll_us,
+                     "GRPC_EVENT_ENGINE_POLLER_BUSY_POLL_US",
+                     overrides.event_engine_poller_busy_poll_us, 0)),
+      event_engine_poller_count_(
+          LoadConfig(FLAGS_grpc_event_engine_poller_count,
+                     "GRPC_EVENT_ENGINE_POLLER_COUNT",
+                     overrides.event_engine_poller_count, 1)),
       enable_fork_support_(LoadConfig(
           FLAGS_grpc_enable_fork_support, "GRPC_ENABLE_FORK_SUPPORT",
           overrides.enable_fork_support, GRPC_ENABLE_FORK_SUPPORT_DEFAULT)),
@@ -106,6 +132,14 @@ ConfigVars::ConfigVars(const Overrides& overrides)
           LoadConfig(FLAGS_grpc_cpp_experimental_disable_reflection,
                      "GRPC_CPP_EXPERIMENTAL_DISABLE_REFLECTION",
                      overrides.cpp_experimental_disable_reflection, false)),
+      event_engine_windows_zero_byte_reads_(
+          LoadConfig(FLAGS_grpc_event_engine_windows_zero_byte_reads,
+                     "GRPC_EVENT_ENGINE_WINDOWS_ZERO_BYTE_READS",
+                     overrides.event_engine_windows_zero_byte_reads, false)),
+      event_engine_lazy_fork_restart_(
+          LoadConfig(FLAGS_grpc_event_engine_lazy_fork_restart,
+                     "GRPC_EVENT_ENGINE_LAZY_FORK_RESTART",
+                     overrides.event_engine_lazy_fork_restart, false)),
       dns_resolver_(LoadConfig(FLAGS_grpc_dns_resolver, "GRPC_DNS_RESOLVER",
                                overrides.dns_resolver, "")),
       verbosity_(LoadConfig(FLAGS_grpc_verbosity, "GRPC_VERBOSITY",
@@ -156,7 +190,13 @@ std::string ConfigVars::ToString() const {
       ", ssl_cipher_suites: ", "\"", absl::CEscape(SslCipherSuites()), "\"",
       ", cpp_experimental_disable_reflection: ",
       CppExperimentalDisableReflection() ? "true" : "false",
-      ", channelz_max_orphaned_nodes: ", ChannelzMaxOrphanedNodes());
+      ", channelz_max_orphaned_nodes: ", ChannelzMaxOrphanedNodes(),
+      ", event_engine_poller_busy_poll_us: ", EventEnginePollerBusyPollUs(),
+      ", event_engine_poller_count: ", EventEnginePollerCount(),
+      ", event_engine_windows_zero_byte_reads: ",
+      EventEngineWindowsZeroByteReads() ? "true" : "false",
+      ", event_engine_lazy_fork_restart: ",
+      EventEngineLazyForkRestart() ? "true" : "false");
 }
 
 }  // namespace grpc_core
@@ -36,10 +36,14 @@ class GPR_DLL ConfigVars {
   struct Overrides {
     absl::optional<int32_t> client_channel_backup_poll_interval_ms;
     absl::optional<int32_t> channelz_max_orphaned_nodes;
+    absl::optional<int32_t> event_engine_poller_busy_poll_us;
+    absl::optional<int32_t> event_engine_poller_count;
     absl::optional<bool> enable_fork_support;
     absl::optional<bool> abort_on_leaks;
     absl::optional<bool> not_use_system_ssl_roots;
     absl::optional<bool> cpp_experimental_disable_reflection;
+    absl::optional<bool> event_engine_windows_zero_byte_reads;
+    absl::optional<bool> event_engine_lazy_fork_restart;
     absl::optional<std::string> dns_resolver;
     absl::optional<std::string> verbosity;
     absl::optional<std::string> poll_strategy;
@@ -111,6 +115,29 @@ class GPR_DLL ConfigVars {
   int32_t ChannelzMaxOrphanedNodes() const {
     return channelz_max_orphaned_nodes_;
   }
+  // EXPERIMENTAL: If positive, the EventEngine epoll poller spins for up to
+  // this many microseconds before it blocks, and asks the kernel to busy poll
+  // the network device queues for as long. Trades CPU for wakeup latency.
+  int32_t EventEnginePollerBusyPollUs() const {
+    return event_engine_poller_busy_poll_us_;
+  }
+  // EXPERIMENTAL: The number of independent pollers each PosixEventEngine
+  // runs, each with its own epoll set. New connections are spread over them
+  // round-robin.
+  int32_t EventEnginePollerCount() const { return event_engine_poller_count_; }
+  // EXPERIMENTAL: If true, Windows EventEngine endpoints wait for data with
+  // zero-byte overlapped reads, so that their read buffers are not locked
+  // while idle.
+  bool EventEngineWindowsZeroByteReads() const {
+    return event_engine_windows_zero_byte_reads_;
+  }
+  // EXPERIMENTAL: If true, a forked child does not restart the EventEngine
+  // thread pool and timer threads it inherits until it first runs a closure or
+  // arms a timer, so that fork() returns in the child without starting any
+  // threads.
+  bool EventEngineLazyForkRestart() const {
+    return event_engine_lazy_fork_restart_;
+  }
 
  private:
   explicit ConfigVars(const Overrides& overrides);
@@ -118,10 +145,14 @@ class GPR_DLL ConfigVars {
   static std::atomic<ConfigVars*> config_vars_;
   int32_t client_channel_backup_poll_interval_ms_;
   int32_t channelz_max_orphaned_nodes_;
+  int32_t event_engine_poller_busy_poll_us_;
+  int32_t event_engine_poller_count_;
   bool enable_fork_support_;
   bool abort_on_leaks_;
   bool not_use_system_ssl_roots_;
   bool cpp_experimental_disable_reflection_;
+  bool event_engine_windows_zero_byte_reads_;
+  bool event_engine_lazy_fork_restart_;
   std::string dns_resolver_;
   std::string verbosity_;
   std::string poll_strategy_;
@@ -20,9 +20,11 @@
 #include <grpc/credentials.h>
 #include <grpc/grpc_security.h>
 
+#include <optional>
 #include <string>
 #include <utility>
 
+#include "absl/strings/str_cat.h"
 #include "src/core/call/metadata.h"
 #include "src/core/credentials/call/call_credentials.h"
 #include "src/core/credentials/call/token_fetcher/token_fetcher_credentials.h"
@@ -73,6 +75,10 @@ class GcpServiceAccountIdentityCallCredentials
   absl::string_view audience() const { return audience_; }
 
  private:
+  std::optional<std::string> TokenCacheKey() const override {
+    return absl::StrCat("gcp_service_account_identity:", audience_);
+  }
+
   OrphanablePtr<HttpRequest> StartHttpRequest(
       grpc_polling_entity* pollent, Timestamp deadline,
       grpc_http_response* response, grpc_closure* on_complete) override;
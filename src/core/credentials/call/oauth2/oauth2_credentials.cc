@@ -27,6 +27,7 @@
 #include <grpc/support/port_platform.h>
 #include <grpc/support/string_util.h>
 #include <grpc/support/time.h>
+#include <openssl/sha.h>
 #include <string.h>
 
 #include <algorithm>
@@ -38,6 +39,7 @@
 #include "absl/log/check.h"
 #include "absl/log/log.h"
 #include "absl/status/status.h"
+#include "absl/strings/escaping.h"
 #include "absl/strings/numbers.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_format.h"
@@ -302,6 +304,12 @@ class grpc_compute_engine_token_fetcher_credentials
   }
 
  private:
+  // Every instance fetches the token of the VM's default service account
+  // from the same metadata server.
+  std::optional<std::string> TokenCacheKey() const override {
+    return "compute_engine";
+  }
+
   grpc_core::OrphanablePtr<grpc_core::HttpRequest> StartHttpRequest(
       grpc_polling_entity* pollent, grpc_core::Timestamp deadline,
       grpc_http_response* response, grpc_closure* on_complete) override {
@@ -396,6 +404,26 @@ grpc_refresh_token_credentials_create_from_auth_refresh_token(
       refresh_token);
 }
 
+std::optional<std::string>
+grpc_google_refresh_token_credentials::TokenCacheKey() const {
+  // The key outlives this object in a process-wide map, so it holds a digest
+  // of the secrets rather than the secrets themselves. Each field is length
+  // prefixed so that different credentials cannot produce the same input.
+  std::string fields;
+  for (absl::string_view field :
+       {refresh_token_.client_id, refresh_token_.client_secret,
+        refresh_token_.refresh_token}) {
+    absl::StrAppend(&fields, field.size(), ":", field);
+  }
+  unsigned char digest[SHA256_DIGEST_LENGTH];
+  SHA256(reinterpret_cast<const uint8_t*>(fields.data()), fields.size(),
+         digest);
+  return absl::StrCat(
+      "refresh_token:",
+      absl::BytesToHexString(absl::string_view(
+          reinterpret_cast<const char*>(digest), sizeof(digest))));
+}
+
 std::string grpc_google_refresh_token_credentials::debug_string() {
   return absl::StrFormat(
       "GoogleRefreshToken{ClientID:%s,%s}", refresh_token_.client_id,
@@ -18,12 +18,17 @@
 
 #include "src/core/credentials/call/token_fetcher/token_fetcher_credentials.h"
 
+#include <algorithm>
+
+#include "absl/container/flat_hash_map.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/iomgr/pollset_set.h"
 #include "src/core/lib/promise/context.h"
 #include "src/core/lib/promise/poll.h"
 #include "src/core/lib/promise/promise.h"
+#include "src/core/util/no_destruct.h"
 
 namespace grpc_core {
 
@@ -37,6 +42,53 @@ constexpr Duration kTokenExpirationAdjustmentDuration = Duration::Seconds(30);
 // token.  Also determines the timeout for the fetch request.
 constexpr Duration kTokenRefreshDuration = Duration::Seconds(60);
 
+// Amount of time before the token's expiration, or half of the token's
+// lifetime if that is shorter, that we refresh a token that calls are using
+// without waiting for a call to notice that it is about to expire.
+constexpr Duration kTokenProactiveRefreshDuration = Duration::Minutes(5);
+
+// Tokens shared by all credentials objects with the same
+// TokenFetcherCredentials::TokenCacheKey().
+class SharedTokenCache {
+ public:
+  static SharedTokenCache& Get() {
+    static NoDestruct<SharedTokenCache> cache;
+    return *cache;
+  }
+
+  // Returns the token for key, or nullptr if there is no unexpired one.
+  RefCountedPtr<TokenFetcherCredentials::Token> Lookup(const std::string& key) {
+    MutexLock lock(&mu_);
+    auto it = tokens_.find(key);
+    if (it == tokens_.end() ||
+        it->second->ExpirationTime() <= Timestamp::Now()) {
+      return nullptr;
+    }
+    return it->second;
+  }
+
+  // Stores token for key, unless the stored token expires later.
+  void Update(const std::string& key,
+              RefCountedPtr<TokenFetcherCredentials::Token> token) {
+    MutexLock lock(&mu_);
+    const Timestamp now = Timestamp::Now();
+    absl::erase_if(tokens_, [now](const auto& entry) {
+      return entry.second->ExpirationTime() <= now;
+    });
+    auto& stored = tokens_[key];
+    if (stored == nullptr ||
+        stored->ExpirationTime() < token->ExpirationTime()) {
+      stored = std::move(token);
+    }
+  }
+
+ private:
+  Mutex mu_;
+  absl::flat_hash_map<std::string,
+                      RefCountedPtr<TokenFetcherCredentials::Token>>
+      tokens_ ABSL_GUARDED_BY(mu_);
+};
+
 }  // namespace
 
 //
@@ -170,7 +222,7 @@ void TokenFetcherCredentials::FetchState::TokenFetchComplete(
     GRPC_TRACE_LOG(token_fetcher_credentials, INFO)
         << "[TokenFetcherCredentials " << creds_.get()
         << "]: fetch_state=" << this << ": token fetch succeeded";
-    creds_->token_ = *token;
+    creds_->SetToken(*token, /*used=*/!queued_calls_.empty());
     creds_->fetch_state_.reset();  // Orphan ourselves.
   } else {
     GRPC_TRACE_LOG(token_fetcher_credentials, INFO)
@@ -237,9 +289,74 @@ TokenFetcherCredentials::~TokenFetcherCredentials() {
 
 void TokenFetcherCredentials::Orphaned() {
   MutexLock lock(&mu_);
+  if (refresh_timer_handle_.has_value()) {
+    event_engine().Cancel(*refresh_timer_handle_);
+    refresh_timer_handle_.reset();
+  }
   fetch_state_.reset();
 }
 
+void TokenFetcherCredentials::SetToken(RefCountedPtr<Token> token, bool used) {
+  token_ = std::move(token);
+  token_used_ = used;
+  if (IsTokenFetcherSharedCacheEnabled()) {
+    std::optional<std::string> key = TokenCacheKey();
+    if (key.has_value()) SharedTokenCache::Get().Update(*key, token_);
+  }
+  if (!IsTokenFetcherProactiveRefreshEnabled()) return;
+  if (refresh_timer_handle_.has_value()) {
+    event_engine().Cancel(*refresh_timer_handle_);
+    refresh_timer_handle_.reset();
+  }
+  if (token_->ExpirationTime() == Timestamp::InfFuture()) return;
+  const Duration lifetime = token_->ExpirationTime() - Timestamp::Now();
+  // Tokens this short-lived are within the refresh duration almost right
+  // away, so the calls using them trigger the refresh.
+  if (lifetime / 2 <= kTokenRefreshDuration) return;
+  const Duration delay =
+      lifetime - std::min(kTokenProactiveRefreshDuration, lifetime / 2);
+  GRPC_TRACE_LOG(token_fetcher_credentials, INFO)
+      << "[TokenFetcherCredentials " << this
+      << "]: scheduling token refresh in " << delay;
+  refresh_timer_handle_ = event_engine().RunAfter(
+      delay, [self = WeakRefAsSubclass<TokenFetcherCredentials>()]() mutable {
+        ExecCtx exec_ctx;
+        self->OnProactiveRefreshTimer();
+        self.reset();
+      });
+}
+
+bool TokenFetcherCredentials::MaybeUseSharedToken() {
+  if (!IsTokenFetcherSharedCacheEnabled()) return false;
+  std::optional<std::string> key = TokenCacheKey();
+  if (!key.has_value()) return false;
+  RefCountedPtr<Token> token = SharedTokenCache::Get().Lookup(*key);
+  if (token == nullptr || (token_ != nullptr && token->ExpirationTime() <=
+                                                    token_->ExpirationTime())) {
+    return false;
+  }
+  GRPC_TRACE_LOG(token_fetcher_credentials, INFO)
+      << "[TokenFetcherCredentials " << this
+      << "]: using token from shared token cache";
+  SetToken(std::move(token), /*used=*/true);
+  return true;
+}
+
+void TokenFetcherCredentials::OnProactiveRefreshTimer() {
+  MutexLock lock(&mu_);
+  if (!refresh_timer_handle_.has_value()) return;
+  refresh_timer_handle_.reset();
+  // Leave tokens that no call has used to be fetched when a call needs one,
+  // so that idle credentials do not keep fetching tokens.
+  if (!token_used_ || fetch_state_ != nullptr) return;
+  if (MaybeUseSharedToken()) return;
+  GRPC_TRACE_LOG(token_fetcher_credentials, INFO)
+      << "[TokenFetcherCredentials " << this
+      << "]: refreshing token ahead of expiration";
+  fetch_state_ = OrphanablePtr<FetchState>(
+      new FetchState(WeakRefAsSubclass<TokenFetcherCredentials>()));
+}
+
 ArenaPromise<absl::StatusOr<ClientMetadataHandle>>
 TokenFetcherCredentials::GetRequestMetadata(
     ClientMetadataHandle initial_metadata, const GetRequestMetadataArgs*) {
@@ -247,10 +364,11 @@ TokenFetcherCredentials::GetRequestMetadata(
   {
     MutexLock lock(&mu_);
     // If we don't have a cached token or the token is within the
-    // refresh duration, start a new fetch if there isn't a pending one.
+    // refresh duration, start a new fetch if there isn't a pending one and
+    // the shared token cache has no fresher token.
     if ((token_ == nullptr || (token_->ExpirationTime() - Timestamp::Now()) <=
                                   kTokenRefreshDuration) &&
-        fetch_state_ == nullptr) {
+        fetch_state_ == nullptr && !MaybeUseSharedToken()) {
       GRPC_TRACE_LOG(token_fetcher_credentials, INFO)
           << "[TokenFetcherCredentials " << this
           << "]: " << GetContext<Activity>()->DebugTag()
@@ -265,6 +383,7 @@ TokenFetcherCredentials::GetRequestMetadata(
           << "[TokenFetcherCredentials " << this
           << "]: " << GetContext<Activity>()->DebugTag()
           << " using cached token";
+      token_used_ = true;
       token_->AddTokenToClientInitialMetadata(*initial_metadata);
       return Immediate(std::move(initial_metadata));
     }
@@ -21,6 +21,8 @@
 
 #include <atomic>
 #include <memory>
+#include <optional>
+#include <string>
 #include <utility>
 #include <variant>
 
@@ -85,6 +87,14 @@ class TokenFetcherCredentials : public grpc_call_credentials {
       absl::AnyInvocable<void(absl::StatusOr<RefCountedPtr<Token>>)>
           on_done) = 0;
 
+  // Returns a key identifying the principal the fetched tokens belong to,
+  // or nullopt if tokens must not be shared with other credentials objects.
+  // Credentials returning the same key share tokens through a process-wide
+  // cache, so that only one of them needs to fetch a token for everyone.
+  virtual std::optional<std::string> TokenCacheKey() const {
+    return std::nullopt;
+  }
+
   grpc_event_engine::experimental::EventEngine& event_engine() const {
     return *event_engine_;
   }
@@ -164,12 +174,27 @@ class TokenFetcherCredentials : public grpc_call_credentials {
     return QsortCompare(static_cast<const grpc_call_credentials*>(this), other);
   }
 
+  // Replaces the cached token with one that was just fetched or found in
+  // the shared token cache. used is whether a call is already waiting for it.
+  void SetToken(RefCountedPtr<Token> token, bool used)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(&mu_);
+  // Adopts the token in the shared token cache if it expires later than the
+  // cached token. Returns true if it did.
+  bool MaybeUseSharedToken() ABSL_EXCLUSIVE_LOCKS_REQUIRED(&mu_);
+  void OnProactiveRefreshTimer();
+
   std::shared_ptr<grpc_event_engine::experimental::EventEngine> event_engine_;
   const bool test_only_use_backoff_jitter_;
 
   Mutex mu_;
   // Cached token, if any.
   RefCountedPtr<Token> token_ ABSL_GUARDED_BY(&mu_);
+  // Whether a call has used the cached token. Tokens that nobody used are
+  // not refreshed ahead of time.
+  bool token_used_ ABSL_GUARDED_BY(&mu_) = false;
+  // Timer refreshing the cached token before calls see it close to expiring.
+  std::optional<grpc_event_engine::experimental::EventEngine::TaskHandle>
+      refresh_timer_handle_ ABSL_GUARDED_BY(&mu_);
   // Fetch state, if any.
   OrphanablePtr<FetchState> fetch_state_ ABSL_GUARDED_BY(&mu_);
 
@@ -28,16 +28,31 @@
 #include "src/core/credentials/transport/alts/alts_security_connector.h"
 #include "src/core/credentials/transport/alts/check_gcp_environment.h"
 #include "src/core/credentials/transport/alts/grpc_alts_credentials_options.h"
+#include "src/core/lib/experiments/experiments.h"
 
 #define GRPC_ALTS_HANDSHAKER_SERVICE_URL "dns:///metadata.google.internal.:8080"
 
+namespace {
+
+grpc_core::RefCountedPtr<grpc_core::AltsHandshakerChannelPool>
+MaybeCreateHandshakerChannelPool(const char* handshaker_service_url) {
+  if (!grpc_core::IsAltsHandshakerChannelPoolEnabled()) return nullptr;
+  return grpc_core::MakeRefCounted<grpc_core::AltsHandshakerChannelPool>(
+      handshaker_service_url,
+      grpc_core::AltsHandshakerChannelPool::DefaultSize());
+}
+
+}  // namespace
+
 grpc_alts_credentials::grpc_alts_credentials(
     const grpc_alts_credentials_options* options,
     const char* handshaker_service_url)
     : options_(grpc_alts_credentials_options_copy(options)),
       handshaker_service_url_(handshaker_service_url == nullptr
                                   ? gpr_strdup(GRPC_ALTS_HANDSHAKER_SERVICE_URL)
-                                  : gpr_strdup(handshaker_service_url)) {
+                                  : gpr_strdup(handshaker_service_url)),
+      handshaker_channel_pool_(
+          MaybeCreateHandshakerChannelPool(handshaker_service_url_)) {
   grpc_alts_set_rpc_protocol_versions(&options_->rpc_versions);
 }
 
@@ -65,7 +80,9 @@ grpc_alts_server_credentials::grpc_alts_server_credentials(
     : options_(grpc_alts_credentials_options_copy(options)),
       handshaker_service_url_(handshaker_service_url == nullptr
                                   ? gpr_strdup(GRPC_ALTS_HANDSHAKER_SERVICE_URL)
-                                  : gpr_strdup(handshaker_service_url)) {
+                                  : gpr_strdup(handshaker_service_url)),
+      handshaker_channel_pool_(
+          MaybeCreateHandshakerChannelPool(handshaker_service_url_)) {
   grpc_alts_set_rpc_protocol_versions(&options_->rpc_versions);
 }
 
@@ -27,6 +27,7 @@
 #include "src/core/credentials/transport/security_connector.h"
 #include "src/core/credentials/transport/transport_credentials.h"
 #include "src/core/lib/channel/channel_args.h"
+#include "src/core/tsi/alts/handshaker/alts_handshaker_channel_pool.h"
 #include "src/core/util/ref_counted_ptr.h"
 #include "src/core/util/unique_type_name.h"
 #include "src/core/util/useful.h"
@@ -50,6 +51,12 @@ class grpc_alts_credentials final : public grpc_channel_credentials {
   const grpc_alts_credentials_options* options() const { return options_; }
   grpc_alts_credentials_options* mutable_options() { return options_; }
   const char* handshaker_service_url() const { return handshaker_service_url_; }
+  // Channels to the handshaker service shared by this credential's
+  // handshakes, or nullptr if every handshake creates its own channel.
+  grpc_core::RefCountedPtr<grpc_core::AltsHandshakerChannelPool>
+  handshaker_channel_pool() const {
+    return handshaker_channel_pool_;
+  }
 
  private:
   int cmp_impl(const grpc_channel_credentials* other) const override {
@@ -60,6 +67,8 @@ class grpc_alts_credentials final : public grpc_channel_credentials {
 
   grpc_alts_credentials_options* options_;
   char* handshaker_service_url_;
+  grpc_core::RefCountedPtr<grpc_core::AltsHandshakerChannelPool>
+      handshaker_channel_pool_;
 };
 
 // Main struct for grpc ALTS server credential.
@@ -79,10 +88,18 @@ class grpc_alts_server_credentials final : public grpc_server_credentials {
   const grpc_alts_credentials_options* options() const { return options_; }
   grpc_alts_credentials_options* mutable_options() { return options_; }
   const char* handshaker_service_url() const { return handshaker_service_url_; }
+  // Channels to the handshaker service shared by this credential's
+  // handshakes, or nullptr if every handshake creates its own channel.
+  grpc_core::RefCountedPtr<grpc_core::AltsHandshakerChannelPool>
+  handshaker_channel_pool() const {
+    return handshaker_channel_pool_;
+  }
 
  private:
   grpc_alts_credentials_options* options_;
   char* handshaker_service_url_;
+  grpc_core::RefCountedPtr<grpc_core::AltsHandshakerChannelPool>
+      handshaker_channel_pool_;
 };
 
 ///
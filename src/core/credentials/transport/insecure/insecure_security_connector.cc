@@ -22,13 +22,12 @@
 #include <grpc/support/port_platform.h>
 #include <string.h>
 
-#include "absl/log/check.h"
 #include "src/core/handshaker/security/security_handshaker.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/promise/promise.h"
 #include "src/core/transport/auth_context.h"
-#include "src/core/tsi/local_transport_security.h"
+#include "src/core/tsi/transport_security_interface.h"
 #include "src/core/util/debug_location.h"
 #include "src/core/util/ref_counted_ptr.h"
 
@@ -65,12 +64,9 @@ ArenaPromise<absl::Status> InsecureChannelSecurityConnector::CheckCallHost(
 // security handshaker so that check_peer is invoked and an auth_context is
 // created with the security level of TSI_SECURITY_NONE.
 void InsecureChannelSecurityConnector::add_handshakers(
-    const ChannelArgs& args, grpc_pollset_set* /* interested_parties */,
+    const ChannelArgs& /*args*/, grpc_pollset_set* /* interested_parties */,
     HandshakeManager* handshake_manager) {
-  tsi_handshaker* handshaker = nullptr;
-  // Re-use local_tsi_handshaker_create as a minimalist handshaker.
-  CHECK(tsi_local_handshaker_create(&handshaker) == TSI_OK);
-  handshake_manager->Add(SecurityHandshakerCreate(handshaker, this, args));
+  handshake_manager->Add(SecurityPeerCheckHandshakerCreate(this));
 }
 
 void InsecureChannelSecurityConnector::check_peer(
@@ -92,12 +88,9 @@ int InsecureChannelSecurityConnector::cmp(
 // security handshaker so that check_peer is invoked and an auth_context is
 // created with the security level of TSI_SECURITY_NONE.
 void InsecureServerSecurityConnector::add_handshakers(
-    const ChannelArgs& args, grpc_pollset_set* /* interested_parties */,
+    const ChannelArgs& /*args*/, grpc_pollset_set* /* interested_parties */,
     HandshakeManager* handshake_manager) {
-  tsi_handshaker* handshaker = nullptr;
-  // Re-use local_tsi_handshaker_create as a minimalist handshaker.
-  CHECK(tsi_local_handshaker_create(&handshaker) == TSI_OK);
-  handshake_manager->Add(SecurityHandshakerCreate(handshaker, this, args));
+  handshake_manager->Add(SecurityPeerCheckHandshakerCreate(this));
 }
 
 void InsecureServerSecurityConnector::check_peer(
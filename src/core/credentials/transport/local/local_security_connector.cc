@@ -56,7 +56,6 @@
 #include "src/core/lib/promise/arena_promise.h"
 #include "src/core/lib/promise/promise.h"
 #include "src/core/transport/auth_context.h"
-#include "src/core/tsi/local_transport_security.h"
 #include "src/core/tsi/transport_security.h"
 #include "src/core/tsi/transport_security_interface.h"
 #include "src/core/util/debug_location.h"
@@ -182,13 +181,12 @@ class grpc_local_channel_security_connector final
   ~grpc_local_channel_security_connector() override { gpr_free(target_name_); }
 
   void add_handshakers(
-      const grpc_core::ChannelArgs& args,
+      const grpc_core::ChannelArgs& /*args*/,
       grpc_pollset_set* /*interested_parties*/,
       grpc_core::HandshakeManager* handshake_manager) override {
-    tsi_handshaker* handshaker = nullptr;
-    CHECK(tsi_local_handshaker_create(&handshaker) == TSI_OK);
-    handshake_manager->Add(
-        grpc_core::SecurityHandshakerCreate(handshaker, this, args));
+    // There is nothing to negotiate and no frame protection, so only check
+    // the peer and leave the endpoint as it is.
+    handshake_manager->Add(grpc_core::SecurityPeerCheckHandshakerCreate(this));
   }
 
   int cmp(const grpc_security_connector* other_sc) const override {
@@ -237,13 +235,12 @@ class grpc_local_server_security_connector final
   ~grpc_local_server_security_connector() override = default;
 
   void add_handshakers(
-      const grpc_core::ChannelArgs& args,
+      const grpc_core::ChannelArgs& /*args*/,
       grpc_pollset_set* /*interested_parties*/,
       grpc_core::HandshakeManager* handshake_manager) override {
-    tsi_handshaker* handshaker = nullptr;
-    CHECK(tsi_local_handshaker_create(&handshaker) == TSI_OK);
-    handshake_manager->Add(
-        grpc_core::SecurityHandshakerCreate(handshaker, this, args));
+    // There is nothing to negotiate and no frame protection, so only check
+    // the peer and leave the endpoint as it is.
+    handshake_manager->Add(grpc_core::SecurityPeerCheckHandshakerCreate(this));
   }
 
   void check_peer(tsi_peer peer, grpc_endpoint* ep,
@@ -133,6 +133,18 @@ void grpc_tls_credentials_options_set_tls_session_key_log_file_path(
   options->set_tls_session_key_log_file_path(path != nullptr ? path : "");
 }
 
+void grpc_tls_credentials_options_set_tls_session_ticket_key_file_path(
+    grpc_tls_credentials_options* options, const char* path) {
+  if (options == nullptr) {
+    return;
+  }
+  GRPC_TRACE_LOG(api, INFO)
+      << "grpc_tls_credentials_options_set_tls_session_ticket_key_file_path("
+         "options="
+      << options << ")";
+  options->set_tls_session_ticket_key_file_path(path != nullptr ? path : "");
+}
+
 void grpc_tls_credentials_options_set_send_client_ca_list(
     grpc_tls_credentials_options* options, bool send_client_ca_list) {
   if (options == nullptr) {
@@ -62,6 +62,7 @@ struct grpc_tls_credentials_options
   bool watch_identity_pair() const { return watch_identity_pair_; }
   const std::string& identity_cert_name() const { return identity_cert_name_; }
   const std::string& tls_session_key_log_file_path() const { return tls_session_key_log_file_path_; }
+  const std::string& tls_session_ticket_key_file_path() const { return tls_session_ticket_key_file_path_; }
   const std::string& crl_directory() const { return crl_directory_; }
   // Returns the CRL Provider
   std::shared_ptr<grpc_core::experimental::CrlProvider> crl_provider() const { return crl_provider_; }
@@ -84,6 +85,7 @@ struct grpc_tls_credentials_options
   // Sets the name of identity key-cert pairs being watched, if |set_watch_identity_pair| is called. If not set, an empty string will be used as the name.
   void set_identity_cert_name(std::string identity_cert_name) { identity_cert_name_ = std::move(identity_cert_name); }
   void set_tls_session_key_log_file_path(std::string tls_session_key_log_file_path) { tls_session_key_log_file_path_ = std::move(tls_session_key_log_file_path); }
+  void set_tls_session_ticket_key_file_path(std::string tls_session_ticket_key_file_path) { tls_session_ticket_key_file_path_ = std::move(tls_session_ticket_key_file_path); }
   //  gRPC will enforce CRLs on all handshakes from all hashed CRL files inside of the crl_directory. If not set, an empty string will be used, which will not enable CRL checking. Only supported for OpenSSL version > 1.1.
   void set_crl_directory(std::string crl_directory) { crl_directory_ = std::move(crl_directory); }
   void set_crl_provider(std::shared_ptr<grpc_core::experimental::CrlProvider> crl_provider) { crl_provider_ = std::move(crl_provider); }
@@ -102,6 +104,7 @@ struct grpc_tls_credentials_options
       watch_identity_pair_ == other.watch_identity_pair_ &&
       identity_cert_name_ == other.identity_cert_name_ &&
       tls_session_key_log_file_path_ == other.tls_session_key_log_file_path_ &&
+      tls_session_ticket_key_file_path_ == other.tls_session_ticket_key_file_path_ &&
       crl_directory_ == other.crl_directory_ &&
       (crl_provider_ == other.crl_provider_) &&
       send_client_ca_list_ == other.send_client_ca_list_;
@@ -120,6 +123,7 @@ struct grpc_tls_credentials_options
       watch_identity_pair_(other.watch_identity_pair_),
       identity_cert_name_(other.identity_cert_name_),
       tls_session_key_log_file_path_(other.tls_session_key_log_file_path_),
+      tls_session_ticket_key_file_path_(other.tls_session_ticket_key_file_path_),
       crl_directory_(other.crl_directory_),
       crl_provider_(other.crl_provider_),
       send_client_ca_list_(other.send_client_ca_list_)  {}
@@ -137,6 +141,7 @@ struct grpc_tls_credentials_options
   bool watch_identity_pair_ = false;
   std::string identity_cert_name_;
   std::string tls_session_key_log_file_path_;
+  std::string tls_session_ticket_key_file_path_;
   std::string crl_directory_;
   std::shared_ptr<grpc_core::experimental::CrlProvider> crl_provider_;
   bool send_client_ca_list_ = false;
@@ -583,6 +583,12 @@ TlsServerSecurityConnector::TlsServerSecurityConnector(
     tls_session_key_logger_ =
         tsi::TlsSessionKeyLoggerCache::Get(tls_session_key_log_file_path);
   }
+  const std::string& tls_session_ticket_key_file_path =
+      options_->tls_session_ticket_key_file_path();
+  if (!tls_session_ticket_key_file_path.empty()) {
+    session_ticket_keys_ =
+        tsi::TlsSessionTicketKeys::FromFile(tls_session_ticket_key_file_path);
+  }
   // Create a watcher.
   auto watcher_ptr = std::make_unique<TlsServerCertificateWatcher>(this);
   certificate_watcher_ = watcher_ptr.get();
@@ -805,9 +811,9 @@ TlsServerSecurityConnector::UpdateHandshakerFactoryLocked() {
       options_->cert_request_type(),
       grpc_get_tsi_tls_version(options_->min_tls_version()),
       grpc_get_tsi_tls_version(options_->max_tls_version()),
-      tls_session_key_logger_.get(), options_->crl_directory().c_str(),
-      options_->send_client_ca_list(), options_->crl_provider(),
-      &server_handshaker_factory_);
+      tls_session_key_logger_.get(), session_ticket_keys_.get(),
+      options_->crl_directory().c_str(), options_->send_client_ca_list(),
+      options_->crl_provider(), &server_handshaker_factory_);
   // Free memory.
   grpc_tsi_ssl_pem_key_cert_pairs_destroy(pem_key_cert_pairs,
                                           num_key_cert_pairs);
@@ -19,6 +19,7 @@
 #include <inttypes.h>
 #include <stddef.h>
 
+#include <algorithm>
 #include <functional>
 #include <map>
 #include <memory>
@@ -45,10 +46,8 @@
 namespace grpc_core {
 
 namespace {
-std::optional<std::string> MaybeSerializeBackendMetrics(
-    BackendMetricProvider* provider) {
-  if (provider == nullptr) return std::nullopt;
-  BackendMetricData data = provider->GetBackendMetricData();
+std::optional<std::string> SerializeBackendMetrics(
+    const BackendMetricData& data) {
   upb::Arena arena;
   xds_data_orca_v3_OrcaLoadReport* response =
       xds_data_orca_v3_OrcaLoadReport_new(arena.ptr());
@@ -111,11 +110,114 @@ const grpc_channel_filter BackendMetricFilter::kFilter =
     MakePromiseBasedFilter<BackendMetricFilter, FilterEndpoint::kServer>();
 
 absl::StatusOr<std::unique_ptr<BackendMetricFilter>>
-BackendMetricFilter::Create(const ChannelArgs&, ChannelFilter::Args) {
-  return std::make_unique<BackendMetricFilter>();
+BackendMetricFilter::Create(const ChannelArgs& args, ChannelFilter::Args) {
+  return std::make_unique<BackendMetricFilter>(
+      args.GetBool(GRPC_ARG_SERVER_CALL_LATENCY_METRICS).value_or(false));
 }
 
-void BackendMetricFilter::Call::OnServerTrailingMetadata(ServerMetadata& md) {
+void BackendMetricFilter::LatencyTracker::RecordAndReport(
+    double latency_seconds, BackendMetricData& data) {
+  digest_.Add(latency_seconds);
+  const Timestamp now = Timestamp::Now();
+  // One call per window folds the finished window into the quantiles; the
+  // others keep reporting the previous ones.
+  if (now >= window_end_.load(std::memory_order_relaxed) && mu_.TryLock()) {
+    if (now >= window_end_.load(std::memory_order_relaxed)) {
+      TDigest window(0);
+      digest_.Collect(window);
+      if (window.Count() > 0) {
+        p50_.store(window.Quantile(0.5), std::memory_order_relaxed);
+        p99_.store(window.Quantile(0.99), std::memory_order_relaxed);
+      }
+      window_end_.store(now + kWindow, std::memory_order_relaxed);
+    }
+    mu_.Unlock();
+  }
+  const double p50 = p50_.load(std::memory_order_relaxed);
+  if (p50 < 0) return;
+  data.named_metrics["grpc.server.call.latency_p50"] = p50;
+  data.named_metrics["grpc.server.call.latency_p99"] =
+      p99_.load(std::memory_order_relaxed);
+}
+
+namespace {
+
+template <typename OwnedMap>
+bool MetricMapsEqual(const OwnedMap& owned,
+                     const std::map<absl::string_view, double>& map) {
+  return owned.size() == map.size() &&
+         std::equal(owned.begin(), owned.end(), map.begin(),
+                    [](const auto& a, const auto& b) {
+                      return a.first == b.first && a.second == b.second;
+                    });
+}
+
+template <typename OwnedMap>
+void CopyMetricMap(const std::map<absl::string_view, double>& map,
+                   OwnedMap* owned) {
+  // Usually only the values change, so avoid reallocating the names.
+  if (owned->size() == map.size() &&
+      std::equal(owned->begin(), owned->end(), map.begin(),
+                 [](const auto& a, const auto& b) {
+                   return a.first == b.first;
+                 })) {
+    auto it = map.begin();
+    for (auto& [_, value] : *owned) value = (it++)->second;
+    return;
+  }
+  owned->clear();
+  for (const auto& [name, value] : map) owned->emplace(name, value);
+}
+
+}  // namespace
+
+bool BackendMetricFilter::ReportCache::Report::Matches(
+    const BackendMetricData& data) const {
+  return cpu_utilization == data.cpu_utilization &&
+         mem_utilization == data.mem_utilization &&
+         application_utilization == data.application_utilization &&
+         qps == data.qps && eps == data.eps &&
+         MetricMapsEqual(request_cost, data.request_cost) &&
+         MetricMapsEqual(utilization, data.utilization) &&
+         MetricMapsEqual(named_metrics, data.named_metrics);
+}
+
+void BackendMetricFilter::ReportCache::Report::CopyFrom(
+    const BackendMetricData& data) {
+  cpu_utilization = data.cpu_utilization;
+  mem_utilization = data.mem_utilization;
+  application_utilization = data.application_utilization;
+  qps = data.qps;
+  eps = data.eps;
+  CopyMetricMap(data.request_cost, &request_cost);
+  CopyMetricMap(data.utilization, &utilization);
+  CopyMetricMap(data.named_metrics, &named_metrics);
+}
+
+std::optional<Slice> BackendMetricFilter::ReportCache::Serialize(
+    const BackendMetricData& data) {
+  // Calls that find the cache busy serialize on their own rather than wait.
+  if (mu_.TryLock()) {
+    std::optional<Slice> cached;
+    if (!serialized_.empty() && report_.Matches(data)) {
+      cached = serialized_.Ref();
+    }
+    mu_.Unlock();
+    if (cached.has_value()) return cached;
+  }
+  std::optional<std::string> serialized = SerializeBackendMetrics(data);
+  if (!serialized.has_value()) return std::nullopt;
+  Slice slice = Slice::FromCopiedString(std::move(*serialized));
+  if (mu_.TryLock()) {
+    report_.CopyFrom(data);
+    serialized_ = slice.Ref();
+    mu_.Unlock();
+  }
+  return slice;
+}
+
+void BackendMetricFilter::Call::OnServerTrailingMetadata(
+    ServerMetadata& md, BackendMetricFilter* filter) {
   GRPC_LATENT_SEE_INNER_SCOPE(
       "BackendMetricFilter::Call::OnServerTrailingMetadata");
   if (md.get(GrpcCallWasCancelled()).value_or(false)) return;
@@ -125,13 +227,19 @@ void BackendMetricFilter::Call::OnServerTrailingMetadata(ServerMetadata& md) {
         << "[" << this << "] No BackendMetricProvider.";
     return;
   }
-  std::optional<std::string> serialized = MaybeSerializeBackendMetrics(ctx);
+  BackendMetricData data = ctx->GetBackendMetricData();
+  if (filter->latency_ != nullptr) {
+    const gpr_timespec latency =
+        gpr_cycle_counter_sub(gpr_get_cycle_counter(), start_);
+    filter->latency_->RecordAndReport(
+        static_cast<double>(latency.tv_sec) + latency.tv_nsec * 1e-9, data);
+  }
+  std::optional<Slice> serialized = filter->report_cache_.Serialize(data);
   if (serialized.has_value() && !serialized->empty()) {
     GRPC_TRACE_LOG(backend_metric_filter, INFO)
         << "[" << this
         << "] Backend metrics serialized. size: " << serialized->size();
-    md.Set(EndpointLoadMetricsBinMetadata(),
-           Slice::FromCopiedString(std::move(*serialized)));
+    md.Set(EndpointLoadMetricsBinMetadata(), std::move(*serialized));
   } else {
     GRPC_TRACE_LOG(backend_metric_filter, INFO)
         << "[" << this << "] No backend metrics.";
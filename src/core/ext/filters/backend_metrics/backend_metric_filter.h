@@ -17,16 +17,27 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <atomic>
+#include <functional>
+#include <map>
+#include <memory>
 #include <optional>
 #include <string>
 
+#include "absl/base/thread_annotations.h"
 #include "absl/status/statusor.h"
 #include "src/core/ext/filters/backend_metrics/backend_metric_provider.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/channel_fwd.h"
 #include "src/core/lib/channel/promise_based_filter.h"
 #include "src/core/lib/promise/arena_promise.h"
+#include "src/core/lib/slice/slice.h"
 #include "src/core/lib/transport/transport.h"
+#include "src/core/load_balancing/backend_metric_data.h"
+#include "src/core/util/concurrent_tdigest.h"
+#include "src/core/util/sync.h"
+#include "src/core/util/time.h"
+#include "src/core/util/time_precise.h"
 
 namespace grpc_core {
 
@@ -39,16 +50,79 @@ class BackendMetricFilter : public ImplementChannelFilter<BackendMetricFilter> {
   static absl::StatusOr<std::unique_ptr<BackendMetricFilter>> Create(
       const ChannelArgs& args, ChannelFilter::Args);
 
+  explicit BackendMetricFilter(bool record_latency)
+      : latency_(record_latency ? std::make_unique<LatencyTracker>()
+                                : nullptr) {}
+
   class Call {
    public:
     static inline const NoInterceptor OnClientInitialMetadata;
     static inline const NoInterceptor OnServerInitialMetadata;
-    void OnServerTrailingMetadata(ServerMetadata& md);
+    void OnServerTrailingMetadata(ServerMetadata& md,
+                                  BackendMetricFilter* filter);
     static inline const NoInterceptor OnClientToServerMessage;
     static inline const NoInterceptor OnClientToServerHalfClose;
     static inline const NoInterceptor OnServerToClientMessage;
     static inline const NoInterceptor OnFinalize;
+
+   private:
+    const gpr_cycle_counter start_ = gpr_get_cycle_counter();
+  };
+
+ private:
+  // Keeps the latency quantiles of the calls that finished in the previous
+  // window on this connection.
+  class LatencyTracker {
+   public:
+    static constexpr Duration kWindow = Duration::Seconds(1);
+
+    // Records the latency of a call that just finished, and adds the
+    // quantiles of the previous window (if there was one) to data.
+    void RecordAndReport(double latency_seconds, BackendMetricData& data);
+
+   private:
+    ConcurrentTDigest digest_{100};
+    std::atomic<Timestamp> window_end_{Timestamp::InfPast()};
+    Mutex mu_;
+    // -1 until a window with calls has ended.
+    std::atomic<double> p50_{-1};
+    std::atomic<double> p99_{-1};
   };
+
+  // Remembers the last report serialized on this connection. Backends
+  // usually report the same values for many calls in a row, and a call
+  // whose data matches the cached report reuses its slice instead of
+  // serializing the proto again.
+  class ReportCache {
+   public:
+    // Returns the serialized report for data, or nullopt if it has no
+    // metrics.
+    std::optional<Slice> Serialize(const BackendMetricData& data);
+
+   private:
+    // An owning copy of the BackendMetricData that was serialized.
+    struct Report {
+      double cpu_utilization = -1;
+      double mem_utilization = -1;
+      double application_utilization = -1;
+      double qps = -1;
+      double eps = -1;
+      std::map<std::string, double, std::less<>> request_cost;
+      std::map<std::string, double, std::less<>> utilization;
+      std::map<std::string, double, std::less<>> named_metrics;
+
+      bool Matches(const BackendMetricData& data) const;
+      void CopyFrom(const BackendMetricData& data);
+    };
+
+    Mutex mu_;
+    Report report_ ABSL_GUARDED_BY(mu_);
+    // Empty until the first report is serialized.
+    Slice serialized_ ABSL_GUARDED_BY(mu_);
+  };
+
+  const std::unique_ptr<LatencyTracker> latency_;
+  ReportCache report_cache_;
 };
 
 }  // namespace grpc_core
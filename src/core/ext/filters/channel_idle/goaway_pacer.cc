@@ -0,0 +1,124 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/filters/channel_idle/goaway_pacer.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+#include <utility>
+
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/util/no_destruct.h"
+
+namespace grpc_core {
+
+using grpc_event_engine::experimental::EventEngine;
+
+GoawayPacer::Ticket::~Ticket() {
+  if (entry_ != nullptr) pacer_->Remove(entry_.get());
+}
+
+GoawayPacer::Ticket& GoawayPacer::Ticket::operator=(Ticket&& other) noexcept {
+  if (this != &other) {
+    // Give up the place this ticket held before taking over other's.
+    if (entry_ != nullptr) pacer_->Remove(entry_.get());
+    pacer_ = other.pacer_;
+    entry_ = std::move(other.entry_);
+  }
+  return *this;
+}
+
+GoawayPacer::GoawayPacer(std::shared_ptr<EventEngine> event_engine)
+    : event_engine_(std::move(event_engine)) {}
+
+GoawayPacer::~GoawayPacer() {
+  MutexLock lock(&mu_);
+  if (timer_handle_ != EventEngine::TaskHandle::kInvalid) {
+    event_engine_->Cancel(timer_handle_);
+  }
+}
+
+GoawayPacer& GoawayPacer::Global() {
+  static NoDestruct<GoawayPacer> pacer(
+      grpc_event_engine::experimental::GetDefaultEventEngine());
+  return *pacer;
+}
+
+GoawayPacer::Ticket GoawayPacer::Enqueue(Duration interval,
+                                         absl::AnyInvocable<bool()> is_idle,
+                                         absl::AnyInvocable<void()> on_turn) {
+  auto entry = MakeRefCounted<Entry>(interval, std::move(is_idle),
+                                     std::move(on_turn));
+  {
+    MutexLock lock(&mu_);
+    const Timestamp now = Timestamp::Now();
+    if (!queue_.empty() || now < next_turn_) {
+      entry->it = queue_.insert(queue_.end(), entry);
+      entry->queued = true;
+      StartTimerLocked();
+      return Ticket(this, std::move(entry));
+    }
+    next_turn_ = now + interval;
+  }
+  entry->on_turn();
+  return Ticket();
+}
+
+void GoawayPacer::Remove(Entry* entry) {
+  MutexLock lock(&mu_);
+  if (!entry->queued) return;
+  entry->queued = false;
+  queue_.erase(entry->it);
+}
+
+void GoawayPacer::StartTimerLocked() {
+  if (timer_handle_ != EventEngine::TaskHandle::kInvalid) return;
+  timer_handle_ = event_engine_->RunAfter(
+      std::max(next_turn_ - Timestamp::Now(), Duration::Zero()), [this] {
+        ExecCtx exec_ctx;
+        OnTimer();
+      });
+}
+
+void GoawayPacer::OnTimer() {
+  RefCountedPtr<Entry> entry;
+  {
+    MutexLock lock(&mu_);
+    timer_handle_ = EventEngine::TaskHandle::kInvalid;
+    if (queue_.empty()) return;
+    auto it = queue_.begin();
+    if ((*it)->turns_passed_over < kMaxTurnsPassedOver) {
+      for (auto idle = queue_.begin(); idle != queue_.end(); ++idle) {
+        if ((*idle)->is_idle()) {
+          it = idle;
+          break;
+        }
+      }
+      // Everyone queued ahead of the idle connection is passed over.
+      for (auto passed = queue_.begin(); passed != it; ++passed) {
+        ++(*passed)->turns_passed_over;
+      }
+    }
+    entry = std::move(*it);
+    queue_.erase(it);
+    entry->queued = false;
+    next_turn_ = Timestamp::Now() + entry->interval;
+    if (!queue_.empty()) StartTimerLocked();
+  }
+  entry->on_turn();
+}
+
+}  // namespace grpc_core
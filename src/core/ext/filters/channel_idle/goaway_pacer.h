@@ -0,0 +1,120 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_EXT_FILTERS_CHANNEL_IDLE_GOAWAY_PACER_H
+#define GRPC_SRC_CORE_EXT_FILTERS_CHANNEL_IDLE_GOAWAY_PACER_H
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+
+#include <list>
+#include <memory>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/functional/any_invocable.h"
+#include "src/core/util/ref_counted.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/sync.h"
+#include "src/core/util/time.h"
+
+namespace grpc_core {
+
+// Paces the GOAWAYs that server connections send when they reach their
+// max connection age, so that connections that were established together do
+// not all reconnect together.
+//
+// Connections queue up for their turn, and turns are handed out at most one
+// per interval, where the interval is the one the previous connection was
+// queued with. Of the queued connections, the first one that is idle goes
+// next; if none is idle, or the one that has waited the longest has already
+// been passed over kMaxTurnsPassedOver times, that one goes.
+class GoawayPacer final {
+ private:
+  struct Entry;
+
+ public:
+  // A connection's place in the queue. Destroying it before the turn comes
+  // gives up the place.
+  class Ticket {
+   public:
+    Ticket() = default;
+    ~Ticket();
+    Ticket(const Ticket&) = delete;
+    Ticket& operator=(const Ticket&) = delete;
+    Ticket(Ticket&& other) noexcept = default;
+    Ticket& operator=(Ticket&& other) noexcept;
+
+   private:
+    friend class GoawayPacer;
+
+    Ticket(GoawayPacer* pacer, RefCountedPtr<Entry> entry)
+        : pacer_(pacer), entry_(std::move(entry)) {}
+
+    GoawayPacer* pacer_ = nullptr;
+    RefCountedPtr<Entry> entry_;
+  };
+
+  // How many turns a connection with calls in progress gives up to idle
+  // connections queued after it before it goes anyway.
+  static constexpr int kMaxTurnsPassedOver = 3;
+
+  explicit GoawayPacer(
+      std::shared_ptr<grpc_event_engine::experimental::EventEngine>
+          event_engine);
+  ~GoawayPacer();
+
+  // The pacer shared by all servers in the process.
+  static GoawayPacer& Global();
+
+  // Queues a connection. on_turn is run once it is the connection's turn,
+  // which is right away if no other connection has had its turn within the
+  // last interval. is_idle is called, with the pacer's lock held, to find out
+  // whether the connection has calls in progress.
+  Ticket Enqueue(Duration interval, absl::AnyInvocable<bool()> is_idle,
+                 absl::AnyInvocable<void()> on_turn);
+
+ private:
+  struct Entry : public RefCounted<Entry> {
+    Entry(Duration interval, absl::AnyInvocable<bool()> is_idle,
+          absl::AnyInvocable<void()> on_turn)
+        : interval(interval),
+          is_idle(std::move(is_idle)),
+          on_turn(std::move(on_turn)) {}
+
+    const Duration interval;
+    absl::AnyInvocable<bool()> is_idle;
+    absl::AnyInvocable<void()> on_turn;
+    bool queued = false;
+    int turns_passed_over = 0;
+    std::list<RefCountedPtr<Entry>>::iterator it;
+  };
+
+  void Remove(Entry* entry);
+  void StartTimerLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void OnTimer();
+
+  const std::shared_ptr<grpc_event_engine::experimental::EventEngine>
+      event_engine_;
+  Mutex mu_;
+  std::list<RefCountedPtr<Entry>> queue_ ABSL_GUARDED_BY(mu_);
+  // When the connection that had the last turn allows the next one.
+  Timestamp next_turn_ ABSL_GUARDED_BY(mu_) = Timestamp::InfPast();
+  grpc_event_engine::experimental::EventEngine::TaskHandle timer_handle_
+      ABSL_GUARDED_BY(mu_) =
+          grpc_event_engine::experimental::EventEngine::TaskHandle::kInvalid;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_FILTERS_CHANNEL_IDLE_GOAWAY_PACER_H
@@ -92,4 +92,78 @@ bool IdleFilterState::CheckTimer() {
   return start_timer;
 }
 
+ShardedIdleFilterState::ShardedIdleFilterState(bool start_timer)
+    : timer_started_(start_timer) {}
+
+void ShardedIdleFilterState::IncreaseCallCount() {
+  shards_.this_cpu().calls_started.fetch_add(1, std::memory_order_seq_cst);
+}
+
+bool ShardedIdleFilterState::DecreaseCallCount() {
+  shards_.this_cpu().calls_finished.fetch_add(1, std::memory_order_seq_cst);
+  // The common case: a timer is running, and will notice when this was the
+  // last call.
+  if (timer_started_.load(std::memory_order_seq_cst)) return false;
+  bool expected = false;
+  return timer_started_.compare_exchange_strong(expected, true,
+                                                std::memory_order_seq_cst);
+}
+
+uint64_t ShardedIdleFilterState::CallsStarted() const {
+  uint64_t started = 0;
+  for (const Shard& shard : shards_) {
+    started += shard.calls_started.load(std::memory_order_seq_cst);
+  }
+  return started;
+}
+
+uint64_t ShardedIdleFilterState::CallsInProgress() const {
+  // Sum the finished calls first: every call seen finishing here started
+  // before it finished, so is then seen starting too, and the difference
+  // cannot underflow.
+  uint64_t finished = 0;
+  for (const Shard& shard : shards_) {
+    finished += shard.calls_finished.load(std::memory_order_seq_cst);
+  }
+  const uint64_t started = CallsStarted();
+  assert(started >= finished);
+  return started - finished;
+}
+
+bool ShardedIdleFilterState::CheckTimer() {
+  if (CallsInProgress() != 0) {
+    // Still calls in progress: keep the timer going!
+    calls_started_at_last_check_.store(CallsStarted(),
+                                       std::memory_order_relaxed);
+    return true;
+  }
+  const uint64_t started = CallsStarted();
+  if (started !=
+      calls_started_at_last_check_.load(std::memory_order_relaxed)) {
+    // If any calls started since the last time we checked, then consider the
+    // channel still active and try again.
+    calls_started_at_last_check_.store(started, std::memory_order_relaxed);
+    return true;
+  }
+  // Idle for a full cycle: stop the timer, so that the next call to finish
+  // starts another one.
+  timer_started_.store(false, std::memory_order_seq_cst);
+  // A call that started after the checks above, and finished before the
+  // store, saw the timer running and did not start a new one; one still in
+  // progress shows that the channel is not idle after all. Either way, keep
+  // going if we can take the timer back. If we can't, another timer has
+  // started and owns calls_started_at_last_check_, so leave it alone.
+  if (CallsStarted() != started) {
+    bool expected = false;
+    if (!timer_started_.compare_exchange_strong(expected, true,
+                                                std::memory_order_seq_cst)) {
+      return false;
+    }
+    calls_started_at_last_check_.store(CallsStarted(),
+                                       std::memory_order_relaxed);
+    return true;
+  }
+  return false;
+}
+
 }  // namespace grpc_core
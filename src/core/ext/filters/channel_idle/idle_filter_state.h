@@ -20,6 +20,8 @@
 
 #include <atomic>
 
+#include "src/core/util/per_cpu.h"
+
 namespace grpc_core {
 
 // State machine for the idle filter.
@@ -47,6 +49,12 @@ class IdleFilterState {
   // we know that the channel is idle and has been for one full cycle.
   GRPC_MUST_USE_RESULT bool CheckTimer();
 
+  // Returns true if no calls are in progress.
+  bool IsIdle() const {
+    return (state_.load(std::memory_order_relaxed) >> kCallsInProgressShift) ==
+           0;
+  }
+
  private:
   // Bit in state_ indicating that the timer has been started.
   static constexpr uintptr_t kTimerStarted = 1;
@@ -62,6 +70,59 @@ class IdleFilterState {
   std::atomic<uintptr_t> state_;
 };
 
+// A version of IdleFilterState for channels that many cores start calls on
+// at once, such as the client channel.
+//
+// Calls are counted in per-cpu shards, so that starting and finishing a call
+// on a busy channel does not write to memory shared by every core. The
+// shards are only summed by the timer, once per idle timeout. The shards
+// cost a cache line per cpu, so state that is per connection should stay
+// with IdleFilterState.
+class ShardedIdleFilterState {
+ public:
+  explicit ShardedIdleFilterState(bool start_timer);
+  ~ShardedIdleFilterState() = default;
+
+  ShardedIdleFilterState(const ShardedIdleFilterState&) = delete;
+  ShardedIdleFilterState& operator=(const ShardedIdleFilterState&) = delete;
+
+  // Increment the number of calls in progress.
+  void IncreaseCallCount();
+
+  // Decrement the number of calls in progress.
+  // Return true if no timer was started, in which case the caller must start
+  // one. The timer may then find calls still in progress, and keep going.
+  GRPC_MUST_USE_RESULT bool DecreaseCallCount();
+
+  // Check if there's been any activity since the last timer check.
+  // If there was, reset the activity flag and return true to indicated that
+  // a new timer should be started.
+  // If there was not, reset the timer flag and return false - in this case
+  // we know that the channel is idle and has been for one full cycle.
+  // Must only be called by the timer.
+  GRPC_MUST_USE_RESULT bool CheckTimer();
+
+  // Returns true if no calls are in progress.
+  bool IsIdle() const { return CallsInProgress() == 0; }
+
+ private:
+  struct alignas(GPR_CACHELINE_SIZE) Shard {
+    std::atomic<uint64_t> calls_started{0};
+    std::atomic<uint64_t> calls_finished{0};
+  };
+
+  uint64_t CallsStarted() const;
+  uint64_t CallsInProgress() const;
+
+  PerCpu<Shard> shards_{PerCpuOptions().SetCpusPerShard(1).SetMaxShards(16)};
+  // Only written when a timer starts or stops, so calls only ever read it.
+  std::atomic<bool> timer_started_;
+  // Calls started as of the previous CheckTimer(). Only written by the timer
+  // that holds timer_started_, but atomic since the timer that gives it up
+  // and the next one to take it can briefly overlap.
+  std::atomic<uint64_t> calls_started_at_last_check_{0};
+};
+
 }  // namespace grpc_core
 
 #endif  // GRPC_SRC_CORE_EXT_FILTERS_CHANNEL_IDLE_IDLE_FILTER_STATE_H
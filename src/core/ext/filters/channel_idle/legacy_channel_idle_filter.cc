@@ -21,6 +21,7 @@
 #include <grpc/support/port_platform.h>
 
 #include <functional>
+#include <memory>
 #include <optional>
 #include <utility>
 
@@ -30,6 +31,7 @@
 #include "absl/status/statusor.h"
 #include "src/core/call/metadata_batch.h"
 #include "src/core/config/core_configuration.h"
+#include "src/core/ext/filters/channel_idle/goaway_pacer.h"
 #include "src/core/ext/transport/chttp2/transport/http2_status.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/promise_based_filter.h"
@@ -39,7 +41,10 @@
 #include "src/core/lib/iomgr/error.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/promise/exec_ctx_wakeup_scheduler.h"
+#include "src/core/lib/promise/if.h"
+#include "src/core/lib/promise/inter_activity_latch.h"
 #include "src/core/lib/promise/loop.h"
+#include "src/core/lib/promise/map.h"
 #include "src/core/lib/promise/poll.h"
 #include "src/core/lib/promise/promise.h"
 #include "src/core/lib/promise/sleep.h"
@@ -80,6 +85,7 @@ struct LegacyMaxAgeFilter::Config {
   Duration max_connection_age;
   Duration max_connection_idle;
   Duration max_connection_age_grace;
+  Duration goaway_interval;
 
   bool enable() const {
     return max_connection_age != Duration::Infinity() ||
@@ -98,6 +104,9 @@ struct LegacyMaxAgeFilter::Config {
     const Duration args_max_age_grace =
         args.GetDurationFromIntMillis(GRPC_ARG_MAX_CONNECTION_AGE_GRACE_MS)
             .value_or(kDefaultMaxConnectionAgeGrace);
+    const int goaway_rate =
+        args.GetInt(GRPC_ARG_EXPERIMENTAL_MAX_CONNECTION_AGE_GOAWAY_RATE)
+            .value_or(0);
     // generate a random number between 1 - kMaxConnectionAgeJitter and
     // 1 + kMaxConnectionAgeJitter
     struct BitGen {
@@ -116,7 +125,10 @@ struct LegacyMaxAgeFilter::Config {
     // GRPC_MILLIS_INF_FUTURE - 0.5 converts the value to float, so that result
     // will not be cast to int implicitly before the comparison.
     return Config{args_max_age * multiplier, args_max_idle * multiplier,
-                  args_max_age_grace};
+                  args_max_age_grace,
+                  goaway_rate > 0
+                      ? Duration::FromSecondsAsDouble(1.0 / goaway_rate)
+                      : Duration::Zero()};
   }
 };
 
@@ -178,7 +190,23 @@ void LegacyMaxAgeFilter::PostInit() {
     max_age_activity_.Set(MakeActivity(
         TrySeq(
             // First sleep until the max connection age
-            Sleep(Timestamp::Now() + max_connection_age_),
+            CoarseSleep(Timestamp::Now() + max_connection_age_),
+            // Then wait for our turn, if goaways are paced.
+            [this] {
+              return If(
+                  goaway_interval_ == Duration::Zero(),
+                  [] { return Immediate(absl::OkStatus()); },
+                  [this] {
+                    auto turn = std::make_shared<InterActivityLatch<void>>();
+                    auto ticket = GoawayPacer::Global().Enqueue(
+                        goaway_interval_, [this] { return IsIdle(); },
+                        [turn] { turn->Set(); });
+                    return Map(turn->Wait(),
+                               [turn, ticket = std::move(ticket)](Empty) {
+                                 return absl::OkStatus();
+                               });
+                  });
+            },
             // Then send a goaway.
             [this] {
               GRPC_CHANNEL_STACK_REF(this->channel_stack(),
@@ -262,7 +290,7 @@ void LegacyChannelIdleFilter::StartIdleTimer() {
   auto channel_stack = channel_stack_->Ref();
   auto timeout = client_idle_timeout_;
   auto promise = Loop([timeout, idle_filter_state]() {
-    return TrySeq(Sleep(Timestamp::Now() + timeout),
+    return TrySeq(CoarseSleep(Timestamp::Now() + timeout),
                   [idle_filter_state]() -> Poll<LoopCtl<absl::Status>> {
                     if (idle_filter_state->CheckTimer()) {
                       return Continue{};
@@ -318,6 +346,7 @@ LegacyMaxAgeFilter::LegacyMaxAgeFilter(grpc_channel_stack* channel_stack,
     : LegacyChannelIdleFilter(channel_stack,
                               max_age_config.max_connection_idle),
       max_connection_age_(max_age_config.max_connection_age),
-      max_connection_age_grace_(max_age_config.max_connection_age_grace) {}
+      max_connection_age_grace_(max_age_config.max_connection_age_grace),
+      goaway_interval_(max_age_config.goaway_interval) {}
 
 }  // namespace grpc_core
@@ -72,6 +72,9 @@ class LegacyChannelIdleFilter : public ChannelFilter {
   void IncreaseCallCount();
   void DecreaseCallCount();
 
+  // Returns true if no calls are in progress.
+  bool IsIdle() const { return idle_filter_state_->IsIdle(); }
+
  private:
   void StartIdleTimer();
 
@@ -139,6 +142,8 @@ class LegacyMaxAgeFilter final : public LegacyChannelIdleFilter {
   SingleSetActivityPtr max_age_activity_;
   Duration max_connection_age_;
   Duration max_connection_age_grace_;
+  // Minimum time between max age GOAWAYs; zero if they are not paced.
+  Duration goaway_interval_;
 };
 
 }  // namespace grpc_core
@@ -0,0 +1,192 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/filters/concurrency_limit/client_concurrency_limit_filter.h"
+
+#include <grpc/impl/channel_arg_names.h>
+#include <grpc/status.h>
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+#include <cmath>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/status/status.h"
+#include "src/core/call/metadata_batch.h"
+#include "src/core/client_channel/client_channel_args.h"
+#include "src/core/config/core_configuration.h"
+#include "src/core/lib/channel/channel_stack.h"
+#include "src/core/lib/surface/channel_stack_type.h"
+#include "src/core/util/latent_see.h"
+#include "src/core/util/no_destruct.h"
+
+namespace grpc_core {
+
+//
+// ClientConcurrencyLimiter
+//
+
+namespace {
+
+// Limiters by target. The limiters are owned by the channels using them and
+// remove themselves when the last one goes away.
+Mutex* g_mu = new Mutex;
+NoDestruct<absl::flat_hash_map<std::string, ClientConcurrencyLimiter*>>
+    g_limiters ABSL_GUARDED_BY(*g_mu);
+
+}  // namespace
+
+RefCountedPtr<ClientConcurrencyLimiter> ClientConcurrencyLimiter::Get(
+    absl::string_view target, int max_limit) {
+  MutexLock lock(g_mu);
+  auto it = g_limiters->find(target);
+  if (it != g_limiters->end()) {
+    // The limiter may be on its way out, waiting for the lock to remove
+    // itself; if so, replace it.
+    auto limiter = it->second->RefIfNonZero();
+    if (limiter != nullptr) return limiter;
+  }
+  auto limiter =
+      MakeRefCounted<ClientConcurrencyLimiter>(std::string(target), max_limit);
+  (*g_limiters)[target] = limiter.get();
+  return limiter;
+}
+
+ClientConcurrencyLimiter::ClientConcurrencyLimiter(std::string target,
+                                                   int max_limit)
+    : target_(std::move(target)),
+      max_limit_(std::max(kMinLimit, max_limit)),
+      limit_(std::min(kInitialLimit, max_limit_)),
+      estimated_limit_(limit_.load(std::memory_order_relaxed)) {}
+
+ClientConcurrencyLimiter::~ClientConcurrencyLimiter() {
+  MutexLock lock(g_mu);
+  auto it = g_limiters->find(target_);
+  if (it != g_limiters->end() && it->second == this) g_limiters->erase(it);
+}
+
+bool ClientConcurrencyLimiter::TryAcquire() {
+  int in_flight = in_flight_.load(std::memory_order_relaxed);
+  do {
+    if (in_flight >= limit_.load(std::memory_order_relaxed)) return false;
+  } while (!in_flight_.compare_exchange_weak(in_flight, in_flight + 1,
+                                             std::memory_order_relaxed));
+  return true;
+}
+
+void ClientConcurrencyLimiter::Release() {
+  in_flight_.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void ClientConcurrencyLimiter::RecordLatency(Duration latency) {
+  const double rtt = std::max(latency.seconds(), 1e-6);
+  // Samples are plentiful on a busy channel, so skip one rather than wait.
+  if (!mu_.TryLock()) return;
+  if (long_rtt_seconds_ == 0) {
+    short_rtt_seconds_ = long_rtt_seconds_ = rtt;
+  } else {
+    short_rtt_seconds_ += kShortWeight * (rtt - short_rtt_seconds_);
+    long_rtt_seconds_ += kLongWeight * (rtt - long_rtt_seconds_);
+  }
+  // After a long stretch of high latency, let the long-term latency catch
+  // up quickly once the target recovers, so that the limit can grow again.
+  if (long_rtt_seconds_ > 2 * short_rtt_seconds_) long_rtt_seconds_ *= 0.95;
+  const double gradient = std::clamp(
+      kTolerance * long_rtt_seconds_ / short_rtt_seconds_, 0.5, 1.0);
+  const int in_flight = in_flight_.load(std::memory_order_relaxed);
+  // Only grow the limit while it is being used; an idle channel says
+  // nothing about how much more the target could take.
+  if (gradient < 1 || in_flight >= estimated_limit_ / 2) {
+    const double new_limit =
+        estimated_limit_ * gradient + std::sqrt(estimated_limit_);
+    estimated_limit_ = std::clamp(
+        (1 - kSmoothing) * estimated_limit_ + kSmoothing * new_limit,
+        static_cast<double>(kMinLimit), static_cast<double>(max_limit_));
+    limit_.store(static_cast<int>(estimated_limit_),
+                 std::memory_order_relaxed);
+  }
+  mu_.Unlock();
+}
+
+//
+// ClientConcurrencyLimitFilter
+//
+
+const grpc_channel_filter ClientConcurrencyLimitFilter::kFilter =
+    MakePromiseBasedFilter<ClientConcurrencyLimitFilter,
+                           FilterEndpoint::kClient>();
+
+absl::StatusOr<std::unique_ptr<ClientConcurrencyLimitFilter>>
+ClientConcurrencyLimitFilter::Create(const ChannelArgs& args,
+                                     ChannelFilter::Args) {
+  std::optional<int> max_limit =
+      args.GetInt(GRPC_ARG_CLIENT_ADAPTIVE_CONCURRENCY_LIMIT);
+  if (!max_limit.has_value()) {
+    return absl::InvalidArgumentError(
+        "client concurrency limit filter needs "
+        "GRPC_ARG_CLIENT_ADAPTIVE_CONCURRENCY_LIMIT");
+  }
+  return std::make_unique<ClientConcurrencyLimitFilter>(
+      ClientConcurrencyLimiter::Get(
+          args.GetString(GRPC_ARG_SERVER_URI).value_or(""), *max_limit));
+}
+
+ClientConcurrencyLimitFilter::Call::~Call() {
+  if (limiter_ != nullptr) limiter_->Release();
+}
+
+absl::Status ClientConcurrencyLimitFilter::Call::OnClientInitialMetadata(
+    ClientMetadata&, ClientConcurrencyLimitFilter* filter) {
+  GRPC_LATENT_SEE_INNER_SCOPE(
+      "ClientConcurrencyLimitFilter::Call::OnClientInitialMetadata");
+  if (!filter->limiter_->TryAcquire()) {
+    return absl::ResourceExhaustedError(
+        "Too many concurrent calls to the target");
+  }
+  limiter_ = filter->limiter_.get();
+  start_ = Timestamp::Now();
+  return absl::OkStatus();
+}
+
+void ClientConcurrencyLimitFilter::Call::OnServerInitialMetadata(
+    ServerMetadata&, ClientConcurrencyLimitFilter*) {
+  // The time to the first response is closest to what the target's load
+  // costs: it leaves out how long the call streams for.
+  if (limiter_ == nullptr || latency_recorded_) return;
+  latency_recorded_ = true;
+  limiter_->RecordLatency(Timestamp::Now() - start_);
+}
+
+void ClientConcurrencyLimitFilter::Call::OnServerTrailingMetadata(
+    ServerMetadata& md, ClientConcurrencyLimitFilter*) {
+  if (limiter_ == nullptr || latency_recorded_) return;
+  latency_recorded_ = true;
+  // A cancelled call says nothing about the target.
+  if (md.get(GrpcStatusMetadata()).value_or(GRPC_STATUS_UNKNOWN) ==
+      GRPC_STATUS_CANCELLED) {
+    return;
+  }
+  limiter_->RecordLatency(Timestamp::Now() - start_);
+}
+
+void RegisterClientConcurrencyLimitFilter(CoreConfiguration::Builder* builder) {
+  builder->channel_init()
+      ->RegisterFilter<ClientConcurrencyLimitFilter>(GRPC_CLIENT_CHANNEL)
+      .IfHasChannelArg(GRPC_ARG_CLIENT_ADAPTIVE_CONCURRENCY_LIMIT);
+}
+
+}  // namespace grpc_core
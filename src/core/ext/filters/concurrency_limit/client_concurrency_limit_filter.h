@@ -0,0 +1,140 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_EXT_FILTERS_CONCURRENCY_LIMIT_CLIENT_CONCURRENCY_LIMIT_FILTER_H
+#define GRPC_SRC_CORE_EXT_FILTERS_CONCURRENCY_LIMIT_CLIENT_CONCURRENCY_LIMIT_FILTER_H
+
+#include <grpc/support/port_platform.h>
+
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/channel/channel_fwd.h"
+#include "src/core/lib/channel/promise_based_filter.h"
+#include "src/core/lib/transport/transport.h"
+#include "src/core/util/ref_counted.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/sync.h"
+#include "src/core/util/time.h"
+
+namespace grpc_core {
+
+// An adaptive limit on the calls a client has in flight to one target,
+// shared by every channel to that target in the process.
+//
+// The limit follows the gradient between the target's long-term latency
+// and its recent latency: while recent calls are no slower than
+// kTolerance times the long-term latency, the limit grows by a queueing
+// allowance of sqrt(limit); as they get slower, it shrinks in proportion,
+// by at most half per update. A brownout therefore cuts the number of
+// calls sent to the target instead of piling more onto it.
+class ClientConcurrencyLimiter final
+    : public RefCounted<ClientConcurrencyLimiter> {
+ public:
+  // Returns the limiter for \a target, creating it with \a max_limit if
+  // there is none.
+  static RefCountedPtr<ClientConcurrencyLimiter> Get(absl::string_view target,
+                                                     int max_limit);
+
+  ClientConcurrencyLimiter(std::string target, int max_limit);
+  ~ClientConcurrencyLimiter() override;
+
+  // Counts a call as in flight and returns true, or returns false if the
+  // target is at its limit. Every call that was let through must call
+  // Release() when it is done.
+  bool TryAcquire();
+  void Release();
+
+  // Records the latency of a call to the target.
+  void RecordLatency(Duration latency);
+
+  int limit() const { return limit_.load(std::memory_order_relaxed); }
+  int in_flight() const { return in_flight_.load(std::memory_order_relaxed); }
+
+ private:
+  static constexpr int kInitialLimit = 20;
+  static constexpr int kMinLimit = 4;
+  // How much slower than the long-term latency recent calls may be before
+  // the limit shrinks.
+  static constexpr double kTolerance = 1.5;
+  // Weights of a new sample in the recent and long-term latencies.
+  static constexpr double kShortWeight = 0.1;
+  static constexpr double kLongWeight = 1.0 / 600;
+  // Weight of the new limit each update.
+  static constexpr double kSmoothing = 0.2;
+
+  const std::string target_;
+  const int max_limit_;
+  std::atomic<int> in_flight_{0};
+  std::atomic<int> limit_;
+  Mutex mu_;
+  double short_rtt_seconds_ ABSL_GUARDED_BY(mu_) = 0;
+  double long_rtt_seconds_ ABSL_GUARDED_BY(mu_) = 0;
+  double estimated_limit_ ABSL_GUARDED_BY(mu_);
+};
+
+// Fails calls with RESOURCE_EXHAUSTED, without sending them, while the
+// channel's target has as many calls in flight as its
+// ClientConcurrencyLimiter allows.
+class ClientConcurrencyLimitFilter final
+    : public ImplementChannelFilter<ClientConcurrencyLimitFilter> {
+ public:
+  static const grpc_channel_filter kFilter;
+
+  static absl::string_view TypeName() { return "client_concurrency_limit"; }
+
+  static absl::StatusOr<std::unique_ptr<ClientConcurrencyLimitFilter>> Create(
+      const ChannelArgs& args, ChannelFilter::Args);
+
+  explicit ClientConcurrencyLimitFilter(
+      RefCountedPtr<ClientConcurrencyLimiter> limiter)
+      : limiter_(std::move(limiter)) {}
+
+  class Call {
+   public:
+    ~Call();
+
+    absl::Status OnClientInitialMetadata(ClientMetadata& md,
+                                         ClientConcurrencyLimitFilter* filter);
+    void OnServerInitialMetadata(ServerMetadata& md,
+                                 ClientConcurrencyLimitFilter* filter);
+    void OnServerTrailingMetadata(ServerMetadata& md,
+                                  ClientConcurrencyLimitFilter* filter);
+    static inline const NoInterceptor OnClientToServerMessage;
+    static inline const NoInterceptor OnClientToServerHalfClose;
+    static inline const NoInterceptor OnServerToClientMessage;
+    static inline const NoInterceptor OnFinalize;
+
+   private:
+    // Set while the call counts against the limit.
+    ClientConcurrencyLimiter* limiter_ = nullptr;
+    Timestamp start_;
+    // Whether the call's latency has been recorded already.
+    bool latency_recorded_ = false;
+  };
+
+ private:
+  const RefCountedPtr<ClientConcurrencyLimiter> limiter_;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_FILTERS_CONCURRENCY_LIMIT_CLIENT_CONCURRENCY_LIMIT_FILTER_H
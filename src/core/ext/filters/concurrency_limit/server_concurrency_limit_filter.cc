@@ -0,0 +1,204 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/filters/concurrency_limit/server_concurrency_limit_filter.h"
+
+#include <grpc/impl/channel_arg_names.h>
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include "absl/hash/hash.h"
+#include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
+#include "src/core/call/metadata_batch.h"
+#include "src/core/config/core_configuration.h"
+#include "src/core/lib/channel/channel_stack.h"
+#include "src/core/lib/surface/channel_stack_type.h"
+#include "src/core/util/latent_see.h"
+
+namespace grpc_core {
+
+//
+// ServerConcurrencyLimiter
+//
+
+RefCountedPtr<ServerConcurrencyLimiter>
+ServerConcurrencyLimiter::FromChannelArgs(const ChannelArgs& args) {
+  std::optional<int> max_concurrent_calls =
+      args.GetInt(GRPC_ARG_SERVER_MAX_CONCURRENT_CALLS_PER_METHOD);
+  if (!max_concurrent_calls.has_value()) return nullptr;
+  return MakeRefCounted<ServerConcurrencyLimiter>(
+      std::max(1, *max_concurrent_calls),
+      std::string(
+          args.GetString(GRPC_ARG_SERVER_CONCURRENCY_LIMIT_TENANT_METADATA)
+              .value_or("")),
+      args.GetDurationFromIntMillis(
+              GRPC_ARG_SERVER_CONCURRENCY_LIMIT_LATENCY_TARGET_MS)
+          .value_or(Duration::Infinity()));
+}
+
+ServerConcurrencyLimiter::ServerConcurrencyLimiter(
+    int max_concurrent_calls, std::string tenant_metadata_key,
+    Duration latency_target)
+    : max_concurrent_calls_(max_concurrent_calls),
+      tenant_metadata_key_(std::move(tenant_metadata_key)),
+      latency_target_(latency_target > Duration::Zero()
+                          ? latency_target
+                          : Duration::Infinity()) {}
+
+std::string ServerConcurrencyLimiter::Key(absl::string_view method,
+                                          absl::string_view tenant) {
+  // Neither paths nor header values can contain a newline.
+  return absl::StrCat(method, "\n", tenant);
+}
+
+std::optional<ServerConcurrencyLimiter::Permit>
+ServerConcurrencyLimiter::TryAcquire(absl::string_view method,
+                                     absl::string_view tenant) {
+  std::string key = Key(method, tenant);
+  const size_t shard_index = absl::HashOf(key) % kNumShards;
+  Shard& shard = shards_[shard_index];
+  MutexLock lock(&shard.mu);
+  auto it = shard.limits.find(key);
+  if (it == shard.limits.end()) {
+    it = shard.limits
+             .emplace(std::move(key),
+                      Limit{0, static_cast<double>(max_concurrent_calls_)})
+             .first;
+  }
+  Limit& limit = it->second;
+  if (limit.in_flight >= static_cast<int>(limit.limit)) return std::nullopt;
+  if (limit.idle.has_value()) {
+    shard.idle.erase(*limit.idle);
+    limit.idle.reset();
+  }
+  ++limit.in_flight;
+  return Permit(Ref(), shard_index, &*it);
+}
+
+void ServerConcurrencyLimiter::Release(size_t shard_index,
+                                       LimitMap::value_type* entry,
+                                       Duration latency) {
+  Shard& shard = shards_[shard_index];
+  MutexLock lock(&shard.mu);
+  Limit& limit = entry->second;
+  --limit.in_flight;
+  if (latency_target_ != Duration::Infinity()) {
+    if (latency > latency_target_) {
+      limit.limit = std::max(1.0, limit.limit * 0.9);
+    } else {
+      limit.limit = std::min<double>(max_concurrent_calls_,
+                                     limit.limit + 1 / limit.limit);
+    }
+  }
+  if (limit.in_flight != 0) return;
+  // Forget idle entries that have nothing to remember, and bound the ones
+  // that do, so that a stream of one-off tenants does not grow the map.
+  if (limit.limit >= max_concurrent_calls_) {
+    shard.limits.erase(shard.limits.find(entry->first));
+    return;
+  }
+  limit.idle = shard.idle.insert(shard.idle.end(), &entry->first);
+  if (shard.idle.size() > kMaxIdleEntriesPerShard) {
+    const std::string* oldest = shard.idle.front();
+    shard.idle.pop_front();
+    shard.limits.erase(shard.limits.find(*oldest));
+  }
+}
+
+int ServerConcurrencyLimiter::TestOnlyLimit(absl::string_view method,
+                                            absl::string_view tenant) {
+  std::string key = Key(method, tenant);
+  Shard& shard = shards_[absl::HashOf(key) % kNumShards];
+  MutexLock lock(&shard.mu);
+  auto it = shard.limits.find(key);
+  if (it == shard.limits.end()) return max_concurrent_calls_;
+  return static_cast<int>(it->second.limit);
+}
+
+ServerConcurrencyLimiter::Permit::~Permit() {
+  if (limiter_ != nullptr) {
+    limiter_->Release(shard_, entry_, Timestamp::Now() - start_);
+  }
+}
+
+//
+// ServerConcurrencyLimitFilter
+//
+
+const grpc_channel_filter ServerConcurrencyLimitFilter::kFilter =
+    MakePromiseBasedFilter<ServerConcurrencyLimitFilter,
+                           FilterEndpoint::kServer>();
+
+absl::StatusOr<std::unique_ptr<ServerConcurrencyLimitFilter>>
+ServerConcurrencyLimitFilter::Create(const ChannelArgs& args,
+                                     ChannelFilter::Args) {
+  // Normally shared by every connection of the server; see
+  // RegisterServerConcurrencyLimitFilter(). Without one, for args that were
+  // not preconditioned, limit this connection on its own.
+  auto limiter = args.GetObjectRef<ServerConcurrencyLimiter>();
+  if (limiter == nullptr) {
+    limiter = ServerConcurrencyLimiter::FromChannelArgs(args);
+  }
+  if (limiter == nullptr) {
+    return absl::InvalidArgumentError(
+        "server concurrency limit filter needs "
+        "GRPC_ARG_SERVER_MAX_CONCURRENT_CALLS_PER_METHOD");
+  }
+  return std::make_unique<ServerConcurrencyLimitFilter>(std::move(limiter));
+}
+
+absl::Status ServerConcurrencyLimitFilter::Call::OnClientInitialMetadata(
+    ClientMetadata& md, ServerConcurrencyLimitFilter* filter) {
+  GRPC_LATENT_SEE_INNER_SCOPE(
+      "ServerConcurrencyLimitFilter::Call::OnClientInitialMetadata");
+  const Slice* path = md.get_pointer(HttpPathMetadata());
+  const absl::string_view method =
+      path == nullptr ? absl::string_view() : path->as_string_view();
+  std::string buffer;
+  absl::string_view tenant;
+  if (!filter->limiter_->tenant_metadata_key().empty()) {
+    tenant = md.GetStringValue(filter->limiter_->tenant_metadata_key(),
+                               &buffer)
+                 .value_or(absl::string_view());
+  }
+  auto permit = filter->limiter_->TryAcquire(method, tenant);
+  if (!permit.has_value()) {
+    return absl::ResourceExhaustedError(
+        "Too many concurrent calls to this method");
+  }
+  permit_.emplace(std::move(*permit));
+  return absl::OkStatus();
+}
+
+void RegisterServerConcurrencyLimitFilter(CoreConfiguration::Builder* builder) {
+  // Give the server one limiter, before its args are copied to each of its
+  // connections, so that the limits apply to the server as a whole.
+  builder->channel_args_preconditioning()->RegisterStage(
+      [](ChannelArgs args) {
+        if (args.GetObject<ServerConcurrencyLimiter>() != nullptr) return args;
+        auto limiter = ServerConcurrencyLimiter::FromChannelArgs(args);
+        if (limiter == nullptr) return args;
+        return args.SetObject(std::move(limiter));
+      });
+  builder->channel_init()
+      ->RegisterFilter<ServerConcurrencyLimitFilter>(GRPC_SERVER_CHANNEL)
+      .IfHasChannelArg(GRPC_ARG_SERVER_MAX_CONCURRENT_CALLS_PER_METHOD);
+}
+
+}  // namespace grpc_core
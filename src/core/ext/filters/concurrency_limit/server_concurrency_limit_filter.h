@@ -0,0 +1,180 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_EXT_FILTERS_CONCURRENCY_LIMIT_SERVER_CONCURRENCY_LIMIT_FILTER_H
+#define GRPC_SRC_CORE_EXT_FILTERS_CONCURRENCY_LIMIT_SERVER_CONCURRENCY_LIMIT_FILTER_H
+
+#include <grpc/support/port_platform.h>
+
+#include <array>
+#include <list>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/node_hash_map.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/channel/channel_fwd.h"
+#include "src/core/lib/channel/promise_based_filter.h"
+#include "src/core/lib/transport/transport.h"
+#include "src/core/util/ref_counted.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/sync.h"
+#include "src/core/util/time.h"
+#include "src/core/util/useful.h"
+
+namespace grpc_core {
+
+// Limits the number of calls a server has in flight for each method and
+// tenant, across all of its connections. The tenant of a call is the value
+// of a request header chosen by the server, so that one caller flooding a
+// method does not use up the capacity every other caller relies on.
+//
+// With a latency target, the limit of each method and tenant adapts to the
+// latency of its calls: every call slower than the target shrinks it by a
+// tenth, and every faster one grows it by one over the current limit, up
+// to the configured maximum. Idle methods and tenants whose limit has
+// shrunk are remembered, up to a bound, so that the limit of a caller that
+// makes one call at a time still adapts; the least recently idle are
+// forgotten first.
+class ServerConcurrencyLimiter final
+    : public RefCounted<ServerConcurrencyLimiter> {
+ private:
+  struct Limit {
+    int in_flight = 0;
+    double limit;
+    // Position in the shard's idle list, if the entry is on it.
+    std::optional<std::list<const std::string*>::iterator> idle;
+  };
+  using LimitMap = absl::node_hash_map<std::string, Limit>;
+
+ public:
+  // A slot for one call, held until the call is done.
+  class Permit {
+   public:
+    Permit(Permit&& other) noexcept
+        : limiter_(std::move(other.limiter_)),
+          shard_(other.shard_),
+          entry_(other.entry_),
+          start_(other.start_) {}
+    Permit& operator=(Permit&&) = delete;
+    ~Permit();
+
+   private:
+    friend class ServerConcurrencyLimiter;
+
+    Permit(RefCountedPtr<ServerConcurrencyLimiter> limiter, size_t shard,
+           LimitMap::value_type* entry)
+        : limiter_(std::move(limiter)), shard_(shard), entry_(entry) {}
+
+    RefCountedPtr<ServerConcurrencyLimiter> limiter_;
+    size_t shard_;
+    LimitMap::value_type* entry_;
+    Timestamp start_ = Timestamp::Now();
+  };
+
+  static absl::string_view ChannelArgName() {
+    return "grpc.internal.server_concurrency_limiter";
+  }
+  static int ChannelArgsCompare(const ServerConcurrencyLimiter* a,
+                                const ServerConcurrencyLimiter* b) {
+    return QsortCompare(a, b);
+  }
+
+  // Returns a limiter configured by \a args, or nullptr if they do not set
+  // GRPC_ARG_SERVER_MAX_CONCURRENT_CALLS_PER_METHOD.
+  static RefCountedPtr<ServerConcurrencyLimiter> FromChannelArgs(
+      const ChannelArgs& args);
+
+  ServerConcurrencyLimiter(int max_concurrent_calls,
+                           std::string tenant_metadata_key,
+                           Duration latency_target);
+
+  // The request header that names the tenant of a call; empty if calls are
+  // only limited by method.
+  absl::string_view tenant_metadata_key() const {
+    return tenant_metadata_key_;
+  }
+
+  // Returns a permit for a call to \a method from \a tenant, or nullopt if
+  // they already have as many calls in flight as their limit allows.
+  std::optional<Permit> TryAcquire(absl::string_view method,
+                                   absl::string_view tenant);
+
+  int TestOnlyLimit(absl::string_view method, absl::string_view tenant);
+
+ private:
+  static constexpr size_t kNumShards = 16;
+  static constexpr size_t kMaxIdleEntriesPerShard = 1024;
+
+  struct alignas(GPR_CACHELINE_SIZE) Shard {
+    Mutex mu;
+    LimitMap limits ABSL_GUARDED_BY(mu);
+    // Keys of the entries with no calls in flight, least recently idle
+    // first.
+    std::list<const std::string*> idle ABSL_GUARDED_BY(mu);
+  };
+
+  static std::string Key(absl::string_view method, absl::string_view tenant);
+  void Release(size_t shard, LimitMap::value_type* entry, Duration latency);
+
+  const int max_concurrent_calls_;
+  const std::string tenant_metadata_key_;
+  const Duration latency_target_;
+  std::array<Shard, kNumShards> shards_;
+};
+
+// Rejects calls with RESOURCE_EXHAUSTED when their method and tenant are at
+// the limit of the server's ServerConcurrencyLimiter.
+class ServerConcurrencyLimitFilter final
+    : public ImplementChannelFilter<ServerConcurrencyLimitFilter> {
+ public:
+  static const grpc_channel_filter kFilter;
+
+  static absl::string_view TypeName() { return "server_concurrency_limit"; }
+
+  static absl::StatusOr<std::unique_ptr<ServerConcurrencyLimitFilter>> Create(
+      const ChannelArgs& args, ChannelFilter::Args);
+
+  explicit ServerConcurrencyLimitFilter(
+      RefCountedPtr<ServerConcurrencyLimiter> limiter)
+      : limiter_(std::move(limiter)) {}
+
+  class Call {
+   public:
+    absl::Status OnClientInitialMetadata(ClientMetadata& md,
+                                         ServerConcurrencyLimitFilter* filter);
+    static inline const NoInterceptor OnServerInitialMetadata;
+    static inline const NoInterceptor OnServerTrailingMetadata;
+    static inline const NoInterceptor OnClientToServerMessage;
+    static inline const NoInterceptor OnClientToServerHalfClose;
+    static inline const NoInterceptor OnServerToClientMessage;
+    static inline const NoInterceptor OnFinalize;
+
+   private:
+    // Released when the call is destroyed.
+    std::optional<ServerConcurrencyLimiter::Permit> permit_;
+  };
+
+ private:
+  const RefCountedPtr<ServerConcurrencyLimiter> limiter_;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_FILTERS_CONCURRENCY_LIMIT_SERVER_CONCURRENCY_LIMIT_FILTER_H
@@ -42,10 +42,12 @@
 #include "src/core/lib/channel/channel_stack.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/promise/context.h"
+#include "src/core/lib/promise/promise.h"
 #include "src/core/lib/promise/sleep.h"
 #include "src/core/lib/promise/try_seq.h"
 #include "src/core/lib/transport/transport.h"
 #include "src/core/service_config/service_config_call_data.h"
+#include "src/core/util/shared_bit_gen.h"
 #include "src/core/util/time.h"
 
 namespace grpc_core {
@@ -64,14 +66,13 @@ auto AsInt(absl::string_view s) -> std::optional<T> {
   return std::nullopt;
 }
 
-inline bool UnderFraction(absl::InsecureBitGen* rand_generator,
-                          const uint32_t numerator,
+inline bool UnderFraction(const uint32_t numerator,
                           const uint32_t denominator) {
   if (numerator <= 0) return false;
   if (numerator >= denominator) return true;
   // Generate a random number in [0, denominator).
   const uint32_t random_number =
-      absl::Uniform(absl::IntervalClosedOpen, *rand_generator, 0u, denominator);
+      absl::Uniform(absl::IntervalClosedOpen, SharedBitGen(), 0u, denominator);
   return random_number < numerator;
 }
 
@@ -139,7 +140,12 @@ FaultInjectionFilter::FaultInjectionFilter(ChannelFilter::Args filter_args)
 // Construct a promise for one call.
 ArenaPromise<absl::Status> FaultInjectionFilter::Call::OnClientInitialMetadata(
     ClientMetadata& md, FaultInjectionFilter* filter) {
-  auto decision = filter->MakeInjectionDecision(md);
+  // Shouldn't ever be null, but just in case, let the call through.
+  const auto* fi_policy = filter->GetFaultInjectionPolicy();
+  if (fi_policy == nullptr || fi_policy->inert) {
+    return Immediate(absl::OkStatus());
+  }
+  auto decision = MakeInjectionDecision(*fi_policy, md);
   GRPC_TRACE_LOG(fault_injection_filter, INFO)
       << "chand=" << this << ": Fault injection triggered "
       << decision.ToString();
@@ -149,65 +155,60 @@ ArenaPromise<absl::Status> FaultInjectionFilter::Call::OnClientInitialMetadata(
   });
 }
 
-FaultInjectionFilter::InjectionDecision
-FaultInjectionFilter::MakeInjectionDecision(
-    const ClientMetadata& initial_metadata) {
+const FaultInjectionMethodParsedConfig::FaultInjectionPolicy*
+FaultInjectionFilter::GetFaultInjectionPolicy() const {
   // Fetch the fault injection policy from the service config, based on the
   // relative index for which policy should this CallData use.
   auto* service_config_call_data = GetContext<ServiceConfigCallData>();
   auto* method_params = static_cast<FaultInjectionMethodParsedConfig*>(
       service_config_call_data->GetMethodParsedConfig(
           service_config_parser_index_));
-  const FaultInjectionMethodParsedConfig::FaultInjectionPolicy* fi_policy =
-      nullptr;
-  if (method_params != nullptr) {
-    fi_policy = method_params->fault_injection_policy(index_);
-  }
-
-  // Shouldn't ever be null, but just in case, return a no-op decision.
-  if (fi_policy == nullptr) {
-    return InjectionDecision(/*max_faults=*/0, /*delay_time=*/Duration::Zero(),
-                             /*abort_request=*/std::nullopt);
-  }
+  if (method_params == nullptr) return nullptr;
+  return method_params->fault_injection_policy(index_);
+}
 
-  grpc_status_code abort_code = fi_policy->abort_code;
-  uint32_t abort_percentage_numerator = fi_policy->abort_percentage_numerator;
-  uint32_t delay_percentage_numerator = fi_policy->delay_percentage_numerator;
-  Duration delay = fi_policy->delay;
+FaultInjectionFilter::InjectionDecision
+FaultInjectionFilter::MakeInjectionDecision(
+    const FaultInjectionMethodParsedConfig::FaultInjectionPolicy& fi_policy,
+    const ClientMetadata& initial_metadata) {
+  grpc_status_code abort_code = fi_policy.abort_code;
+  uint32_t abort_percentage_numerator = fi_policy.abort_percentage_numerator;
+  uint32_t delay_percentage_numerator = fi_policy.delay_percentage_numerator;
+  Duration delay = fi_policy.delay;
 
   // Update the policy with values in initial metadata.
-  if (!fi_policy->abort_code_header.empty() ||
-      !fi_policy->abort_percentage_header.empty() ||
-      !fi_policy->delay_header.empty() ||
-      !fi_policy->delay_percentage_header.empty()) {
+  if (!fi_policy.abort_code_header.empty() ||
+      !fi_policy.abort_percentage_header.empty() ||
+      !fi_policy.delay_header.empty() ||
+      !fi_policy.delay_percentage_header.empty()) {
     std::string buffer;
-    if (!fi_policy->abort_code_header.empty() && abort_code == GRPC_STATUS_OK) {
-      auto value = initial_metadata.GetStringValue(fi_policy->abort_code_header,
+    if (!fi_policy.abort_code_header.empty() && abort_code == GRPC_STATUS_OK) {
+      auto value = initial_metadata.GetStringValue(fi_policy.abort_code_header,
                                                    &buffer);
       if (value.has_value()) {
         grpc_status_code_from_int(
             AsInt<int>(*value).value_or(GRPC_STATUS_UNKNOWN), &abort_code);
       }
     }
-    if (!fi_policy->abort_percentage_header.empty()) {
+    if (!fi_policy.abort_percentage_header.empty()) {
       auto value = initial_metadata.GetStringValue(
-          fi_policy->abort_percentage_header, &buffer);
+          fi_policy.abort_percentage_header, &buffer);
       if (value.has_value()) {
         abort_percentage_numerator = std::min(
             AsInt<uint32_t>(*value).value_or(-1), abort_percentage_numerator);
       }
     }
-    if (!fi_policy->delay_header.empty() && delay == Duration::Zero()) {
+    if (!fi_policy.delay_header.empty() && delay == Duration::Zero()) {
       auto value =
-          initial_metadata.GetStringValue(fi_policy->delay_header, &buffer);
+          initial_metadata.GetStringValue(fi_policy.delay_header, &buffer);
       if (value.has_value()) {
         delay = Duration::Milliseconds(
             std::max(AsInt<int64_t>(*value).value_or(0), int64_t{0}));
       }
     }
-    if (!fi_policy->delay_percentage_header.empty()) {
+    if (!fi_policy.delay_percentage_header.empty()) {
       auto value = initial_metadata.GetStringValue(
-          fi_policy->delay_percentage_header, &buffer);
+          fi_policy.delay_percentage_header, &buffer);
       if (value.has_value()) {
         delay_percentage_numerator = std::min(
             AsInt<uint32_t>(*value).value_or(-1), delay_percentage_numerator);
@@ -217,25 +218,20 @@ FaultInjectionFilter::MakeInjectionDecision(
   // Roll the dice
   bool delay_request = delay != Duration::Zero();
   bool abort_request = abort_code != GRPC_STATUS_OK;
-  if (delay_request || abort_request) {
-    MutexLock lock(&mu_);
-    if (delay_request) {
-      delay_request =
-          UnderFraction(&delay_rand_generator_, delay_percentage_numerator,
-                        fi_policy->delay_percentage_denominator);
-    }
-    if (abort_request) {
-      abort_request =
-          UnderFraction(&abort_rand_generator_, abort_percentage_numerator,
-                        fi_policy->abort_percentage_denominator);
-    }
+  if (delay_request) {
+    delay_request = UnderFraction(delay_percentage_numerator,
+                                  fi_policy.delay_percentage_denominator);
+  }
+  if (abort_request) {
+    abort_request = UnderFraction(abort_percentage_numerator,
+                                  fi_policy.abort_percentage_denominator);
   }
 
   return InjectionDecision(
-      fi_policy->max_faults, delay_request ? delay : Duration::Zero(),
+      fi_policy.max_faults, delay_request ? delay : Duration::Zero(),
       abort_request ? std::optional<absl::Status>(absl::Status(
                           static_cast<absl::StatusCode>(abort_code),
-                          fi_policy->abort_message))
+                          fi_policy.abort_message))
                     : std::nullopt);
 }
 
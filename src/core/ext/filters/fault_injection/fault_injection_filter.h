@@ -22,15 +22,13 @@
 
 #include <memory>
 
-#include "absl/base/thread_annotations.h"
-#include "absl/random/random.h"
 #include "absl/status/statusor.h"
+#include "src/core/ext/filters/fault_injection/fault_injection_service_config_parser.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/channel_fwd.h"
 #include "src/core/lib/channel/promise_based_filter.h"
 #include "src/core/lib/promise/arena_promise.h"
 #include "src/core/lib/transport/transport.h"
-#include "src/core/util/sync.h"
 
 namespace grpc_core {
 
@@ -65,15 +63,16 @@ class FaultInjectionFilter
 
  private:
   class InjectionDecision;
-  InjectionDecision MakeInjectionDecision(
+  // Returns the policy for the current call, or nullptr if it has none.
+  const FaultInjectionMethodParsedConfig::FaultInjectionPolicy*
+  GetFaultInjectionPolicy() const;
+  static InjectionDecision MakeInjectionDecision(
+      const FaultInjectionMethodParsedConfig::FaultInjectionPolicy& fi_policy,
       const ClientMetadata& initial_metadata);
 
   // The relative index of instances of the same filter.
   size_t index_;
   const size_t service_config_parser_index_;
-  Mutex mu_;
-  absl::InsecureBitGen abort_rand_generator_ ABSL_GUARDED_BY(mu_);
-  absl::InsecureBitGen delay_rand_generator_ ABSL_GUARDED_BY(mu_);
 };
 
 }  // namespace grpc_core
@@ -77,6 +77,14 @@ void FaultInjectionMethodParsedConfig::FaultInjectionPolicy::JsonPostLoad(
     ValidationErrors::ScopedField field(errors, ".delayPercentageDenominator");
     errors->AddError("must be one of 100, 10000, or 1000000");
   }
+  // Metadata can only lower the percentages, so a zero percentage, or a
+  // fault that is neither configured nor settable by metadata, never fires.
+  const bool can_abort =
+      abort_percentage_numerator > 0 &&
+      (abort_code != GRPC_STATUS_OK || !abort_code_header.empty());
+  const bool can_delay = delay_percentage_numerator > 0 &&
+                         (delay != Duration::Zero() || !delay_header.empty());
+  inert = !can_abort && !can_delay;
 }
 
 const JsonLoaderInterface* FaultInjectionMethodParsedConfig::JsonLoader(
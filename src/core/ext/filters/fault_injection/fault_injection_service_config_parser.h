@@ -63,6 +63,10 @@ class FaultInjectionMethodParsedConfig
     // By default, the max allowed active faults are unlimited.
     uint32_t max_faults = std::numeric_limits<uint32_t>::max();
 
+    // Set after parsing if no call can be delayed or aborted by this policy,
+    // whatever its metadata, so that the filter can pass calls through.
+    bool inert = false;
+
     static const JsonLoaderInterface* JsonLoader(const JsonArgs&);
     void JsonPostLoad(const Json& json, const JsonArgs&,
                       ValidationErrors* errors);
@@ -95,6 +99,9 @@ class FaultInjectionServiceConfigParser final
   std::unique_ptr<ServiceConfigParser::ParsedConfig> ParsePerMethodParams(
       const ChannelArgs& args, const Json& json,
       ValidationErrors* errors) override;
+  std::vector<absl::string_view> ChannelArgKeys() const override {
+    return {GRPC_ARG_PARSE_FAULT_INJECTION_METHOD_CONFIG};
+  }
   // Returns the parser index for FaultInjectionServiceConfigParser.
   static size_t ParserIndex();
   // Registers FaultInjectionServiceConfigParser to ServiceConfigParser.
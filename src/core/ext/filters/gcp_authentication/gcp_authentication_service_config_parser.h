@@ -72,6 +72,9 @@ class GcpAuthenticationServiceConfigParser final
   std::unique_ptr<ServiceConfigParser::ParsedConfig> ParseGlobalParams(
       const ChannelArgs& args, const Json& json,
       ValidationErrors* errors) override;
+  std::vector<absl::string_view> ChannelArgKeys() const override {
+    return {GRPC_ARG_PARSE_GCP_AUTHENTICATION_METHOD_CONFIG};
+  }
   // Returns the parser index for the parser.
   static size_t ParserIndex();
   // Registers the parser.
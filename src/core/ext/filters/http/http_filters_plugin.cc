@@ -19,6 +19,7 @@
 #include <grpc/support/port_platform.h>
 
 #include "absl/strings/match.h"
+#include "src/core/call/filter_fusion.h"
 #include "src/core/config/core_configuration.h"
 #include "src/core/ext/filters/http/client/http_client_filter.h"
 #include "src/core/ext/filters/http/message_compress/compression_filter.h"
@@ -65,5 +66,24 @@ void RegisterHttpFilters(CoreConfiguration::Builder* builder) {
       ->RegisterFilter<HttpServerFilter>(GRPC_SERVER_CHANNEL)
       .If(IsBuildingHttpLikeTransport)
       .After<ServerMessageSizeFilter>();
+  // Every call on an http-like transport passes through these runs of filters
+  // (the message size filter only when limits are configured), so fuse them.
+  for (auto type : {GRPC_CLIENT_SUBCHANNEL, GRPC_CLIENT_DIRECT_CHANNEL}) {
+    builder->channel_init()
+        ->RegisterFusedFilter<FusedFilter<ClientMessageSizeFilter,
+                                          HttpClientFilter,
+                                          ClientCompressionFilter>>(type);
+    builder->channel_init()
+        ->RegisterFusedFilter<
+            FusedFilter<HttpClientFilter, ClientCompressionFilter>>(type);
+  }
+  builder->channel_init()
+      ->RegisterFusedFilter<FusedFilter<
+          ServerMessageSizeFilter, HttpServerFilter, ServerCompressionFilter>>(
+          GRPC_SERVER_CHANNEL);
+  builder->channel_init()
+      ->RegisterFusedFilter<
+          FusedFilter<HttpServerFilter, ServerCompressionFilter>>(
+          GRPC_SERVER_CHANNEL);
 }
 }  // namespace grpc_core
@@ -15,12 +15,15 @@
 #include "src/core/ext/filters/http/message_compress/compression_filter.h"
 
 #include <grpc/compression.h>
+#include <grpc/event_engine/event_engine.h>
 #include <grpc/grpc.h>
 #include <grpc/impl/channel_arg_names.h>
 #include <grpc/impl/compression_types.h>
 #include <grpc/support/port_platform.h>
 #include <inttypes.h>
 
+#include <algorithm>
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <optional>
@@ -42,6 +45,7 @@
 #include "src/core/lib/promise/context.h"
 #include "src/core/lib/promise/latch.h"
 #include "src/core/lib/promise/pipe.h"
+#include "src/core/lib/promise/poll.h"
 #include "src/core/lib/promise/prioritized_race.h"
 #include "src/core/lib/resource_quota/arena.h"
 #include "src/core/lib/slice/slice_buffer.h"
@@ -49,9 +53,13 @@
 #include "src/core/lib/transport/transport.h"
 #include "src/core/telemetry/call_tracer.h"
 #include "src/core/util/latent_see.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/status_helper.h"
 
 namespace grpc_core {
 
+using grpc_event_engine::experimental::EventEngine;
+
 const grpc_channel_filter ClientCompressionFilter::kFilter =
     MakePromiseBasedFilter<ClientCompressionFilter, FilterEndpoint::kClient,
                            kFilterExaminesServerInitialMetadata |
@@ -86,7 +94,15 @@ ChannelCompression::ChannelCompression(const ChannelArgs& args)
           args.GetBool(GRPC_ARG_ENABLE_PER_MESSAGE_COMPRESSION).value_or(true)),
       enable_decompression_(
           args.GetBool(GRPC_ARG_ENABLE_PER_MESSAGE_DECOMPRESSION)
-              .value_or(true)) {
+              .value_or(true)),
+      deflate_level_(
+          args.GetInt(GRPC_ARG_DEFLATE_COMPRESSION_LEVEL).value_or(-1)),
+      min_message_size_(std::max(
+          0, args.GetInt(GRPC_ARG_COMPRESSION_MIN_MESSAGE_SIZE).value_or(0))),
+      adaptive_(args.GetBool(GRPC_ARG_ADAPTIVE_COMPRESSION).value_or(false)),
+      offload_threshold_(std::max(
+          0,
+          args.GetInt(GRPC_ARG_COMPRESSION_OFFLOAD_THRESHOLD).value_or(0))) {
   // Make sure the default is enabled.
   if (!enabled_compression_algorithms_.IsSet(default_compression_algorithm_)) {
     const char* name;
@@ -100,35 +116,162 @@ ChannelCompression::ChannelCompression(const ChannelArgs& args)
   }
 }
 
-MessageHandle ChannelCompression::CompressMessage(
-    MessageHandle message, grpc_compression_algorithm algorithm,
-    CallTracerInterface* call_tracer) const {
+bool ChannelCompression::MethodStats::ShouldSkip() {
+  const uint64_t n = messages_.fetch_add(1, std::memory_order_relaxed);
+  if (ratio_.load(std::memory_order_relaxed) <= kPoorRatio ||
+      n % kSampleInterval == 0) {
+    return false;
+  }
+  skipped_.fetch_add(1, std::memory_order_relaxed);
+  return true;
+}
+
+void ChannelCompression::MethodStats::RecordAttempt(size_t uncompressed_size,
+                                                    size_t compressed_size,
+                                                    uint64_t nanos) {
+  uncompressed_bytes_.fetch_add(uncompressed_size, std::memory_order_relaxed);
+  compressed_bytes_.fetch_add(compressed_size, std::memory_order_relaxed);
+  compress_nanos_.fetch_add(nanos, std::memory_order_relaxed);
+  if (uncompressed_size == 0) return;
+  const uint32_t sample = static_cast<uint32_t>(
+      std::min<uint64_t>(1024, uint64_t{compressed_size} * 1024 /
+                                   uint64_t{uncompressed_size}));
+  // Concurrent updates may lose a sample, which is fine for an average.
+  const uint32_t old_ratio = ratio_.load(std::memory_order_relaxed);
+  ratio_.store(old_ratio - old_ratio / 4 + sample / 4,
+               std::memory_order_relaxed);
+}
+
+Json::Object ChannelCompression::MethodStats::ToJsonObject() const {
+  Json::Object object;
+  object["messages"] =
+      Json::FromNumber(messages_.load(std::memory_order_relaxed));
+  object["skipped"] =
+      Json::FromNumber(skipped_.load(std::memory_order_relaxed));
+  object["uncompressedBytes"] =
+      Json::FromNumber(uncompressed_bytes_.load(std::memory_order_relaxed));
+  object["compressedBytes"] =
+      Json::FromNumber(compressed_bytes_.load(std::memory_order_relaxed));
+  object["compressNanos"] =
+      Json::FromNumber(compress_nanos_.load(std::memory_order_relaxed));
+  object["recentRatio"] =
+      Json::FromNumber(ratio_.load(std::memory_order_relaxed) / 1024.0);
+  return object;
+}
+
+ChannelCompression::MethodStats* ChannelCompression::GetMethodStats(
+    absl::string_view path) {
+  if (!adaptive_) return nullptr;
+  MutexLock lock(&method_stats_mu_);
+  auto it = method_stats_.find(path);
+  if (it != method_stats_.end()) return it->second.get();
+  if (method_stats_.size() >= kMaxTrackedMethods) return &other_method_stats_;
+  return method_stats_
+      .emplace(std::string(path), std::make_unique<MethodStats>())
+      .first->second.get();
+}
+
+Json::Object ChannelCompression::ToJsonObject() const {
+  Json::Object object;
+  if (max_recv_size_.has_value()) {
+    object["maxRecvSize"] = Json::FromNumber(*max_recv_size_);
+  }
+  const char* algorithm =
+      CompressionAlgorithmAsString(default_compression_algorithm_);
+  if (algorithm != nullptr) {
+    object["defaultCompressionAlgorithm"] = Json::FromString(algorithm);
+  }
+  object["enabledCompressionAlgorithms"] = Json::FromString(
+      std::string(enabled_compression_algorithms_.ToString()));
+  object["enableCompression"] = Json::FromBool(enable_compression_);
+  object["enableDecompression"] = Json::FromBool(enable_decompression_);
+  if (deflate_level_ != -1) {
+    object["deflateLevel"] = Json::FromNumber(deflate_level_);
+  }
+  if (min_message_size_ != 0) {
+    object["minMessageSize"] = Json::FromNumber(min_message_size_);
+  }
+  if (adaptive_) {
+    Json::Object methods;
+    MutexLock lock(&method_stats_mu_);
+    for (const auto& [path, stats] : method_stats_) {
+      methods[path] = Json::FromObject(stats->ToJsonObject());
+    }
+    if (method_stats_.size() >= kMaxTrackedMethods) {
+      methods["<other>"] = Json::FromObject(other_method_stats_.ToJsonObject());
+    }
+    object["methodCompressionStats"] = Json::FromObject(std::move(methods));
+  }
+  return object;
+}
+
+namespace {
+
+// Compresses payload into compressed, setting *nanos to the time taken.
+bool CompressPayload(grpc_compression_algorithm algorithm, int level,
+                     SliceBuffer& payload, SliceBuffer& compressed,
+                     uint64_t* nanos) {
+  const auto start = std::chrono::steady_clock::now();
+  bool did_compress = grpc_msg_compress_with_level(
+      algorithm, level, payload.c_slice_buffer(), compressed.c_slice_buffer());
+  *nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now() - start)
+               .count();
+  return did_compress;
+}
+
+}  // namespace
+
+bool ChannelCompression::ShouldCompress(Message& message,
+                                        grpc_compression_algorithm algorithm,
+                                        CallTracerInterface* call_tracer,
+                                        MethodStats* method_stats) const {
   GRPC_TRACE_LOG(compression, INFO)
-      << "CompressMessage: len=" << message->payload()->Length()
-      << " alg=" << algorithm << " flags=" << message->flags();
+      << "CompressMessage: len=" << message.payload()->Length()
+      << " alg=" << algorithm << " flags=" << message.flags();
   if (call_tracer != nullptr) {
-    call_tracer->RecordSendMessage(*message);
+    call_tracer->RecordSendMessage(message);
   }
   // Check if we're allowed to compress this message
   // (apps might want to disable compression for certain messages to avoid
   // crime/beast like vulns).
-  uint32_t& flags = message->mutable_flags();
   if (algorithm == GRPC_COMPRESS_NONE || !enable_compression_ ||
-      (flags & (GRPC_WRITE_NO_COMPRESS | GRPC_WRITE_INTERNAL_COMPRESS))) {
-    return message;
+      (message.flags() &
+       (GRPC_WRITE_NO_COMPRESS | GRPC_WRITE_INTERNAL_COMPRESS))) {
+    return false;
+  }
+  if (message.payload()->Length() < min_message_size_) {
+    GRPC_TRACE_LOG(compression, INFO)
+        << "Not compressing message smaller than " << min_message_size_
+        << " bytes";
+    return false;
+  }
+  if (method_stats != nullptr && method_stats->ShouldSkip()) {
+    GRPC_TRACE_LOG(compression, INFO)
+        << "Not compressing message: recent messages on this method did not "
+           "compress well";
+    return false;
+  }
+  return true;
+}
+
+void ChannelCompression::FinishCompress(
+    Message& message, grpc_compression_algorithm algorithm, bool did_compress,
+    SliceBuffer& compressed, uint64_t nanos, CallTracerInterface* call_tracer,
+    MethodStats* method_stats) const {
+  SliceBuffer* payload = message.payload();
+  if (method_stats != nullptr) {
+    method_stats->RecordAttempt(
+        payload->Length(),
+        did_compress ? compressed.Length() : payload->Length(), nanos);
   }
-  // Try to compress the payload.
-  SliceBuffer tmp;
-  SliceBuffer* payload = message->payload();
-  bool did_compress = grpc_msg_compress(algorithm, payload->c_slice_buffer(),
-                                        tmp.c_slice_buffer());
   // If we achieved compression send it as compressed, otherwise send it as (to
   // avoid spending cycles on the receiver decompressing).
   if (did_compress) {
     if (GRPC_TRACE_FLAG_ENABLED(compression)) {
       const char* algo_name;
       const size_t before_size = payload->Length();
-      const size_t after_size = tmp.Length();
+      const size_t after_size = compressed.Length();
       const float savings_ratio = 1.0f - (static_cast<float>(after_size) /
                                           static_cast<float>(before_size));
       CHECK(grpc_compression_algorithm_name(algorithm, &algo_name));
@@ -137,10 +280,10 @@ MessageHandle ChannelCompression::CompressMessage(
           " bytes (%.2f%% savings)",
           algo_name, before_size, after_size, 100 * savings_ratio);
     }
-    tmp.Swap(payload);
-    flags |= GRPC_WRITE_INTERNAL_COMPRESS;
+    compressed.Swap(payload);
+    message.mutable_flags() |= GRPC_WRITE_INTERNAL_COMPRESS;
     if (call_tracer != nullptr) {
-      call_tracer->RecordSendCompressedMessage(*message);
+      call_tracer->RecordSendCompressedMessage(message);
     }
   } else {
     if (GRPC_TRACE_FLAG_ENABLED(compression)) {
@@ -151,52 +294,179 @@ MessageHandle ChannelCompression::CompressMessage(
                 << payload->Length();
     }
   }
+}
+
+MessageHandle ChannelCompression::CompressMessage(
+    MessageHandle message, grpc_compression_algorithm algorithm,
+    CallTracerInterface* call_tracer, MethodStats* method_stats) const {
+  if (!ShouldCompress(*message, algorithm, call_tracer, method_stats)) {
+    return message;
+  }
+  // Try to compress the payload.
+  SliceBuffer tmp;
+  uint64_t nanos;
+  bool did_compress = CompressPayload(algorithm, deflate_level_,
+                                      *message->payload(), tmp, &nanos);
+  FinishCompress(*message, algorithm, did_compress, tmp, nanos, call_tracer,
+                 method_stats);
   return message;
 }
 
-absl::StatusOr<MessageHandle> ChannelCompression::DecompressMessage(
-    bool is_client, MessageHandle message, DecompressArgs args,
+absl::StatusOr<bool> ChannelCompression::ShouldDecompress(
+    bool is_client, Message& message, const DecompressArgs& args,
     CallTracerInterface* call_tracer) const {
   GRPC_TRACE_LOG(compression, INFO)
-      << "DecompressMessage: len=" << message->payload()->Length()
+      << "DecompressMessage: len=" << message.payload()->Length()
       << " max=" << args.max_recv_message_length.value_or(-1)
       << " alg=" << args.algorithm;
   if (call_tracer != nullptr) {
-    call_tracer->RecordReceivedMessage(*message);
+    call_tracer->RecordReceivedMessage(message);
   }
   // Check max message length.
   if (args.max_recv_message_length.has_value() &&
-      message->payload()->Length() >
+      message.payload()->Length() >
           static_cast<size_t>(*args.max_recv_message_length)) {
     return absl::ResourceExhaustedError(absl::StrFormat(
         "%s: Received message larger than max (%u vs. %d)",
-        is_client ? "CLIENT" : "SERVER", message->payload()->Length(),
+        is_client ? "CLIENT" : "SERVER", message.payload()->Length(),
         *args.max_recv_message_length));
   }
   // Check if decompression is enabled (if not, we can just pass the message
   // up).
-  if (!enable_decompression_ ||
-      (message->flags() & GRPC_WRITE_INTERNAL_COMPRESS) == 0) {
-    return std::move(message);
-  }
-  // Try to decompress the payload.
-  SliceBuffer decompressed_slices;
-  if (grpc_msg_decompress(args.algorithm, message->payload()->c_slice_buffer(),
-                          decompressed_slices.c_slice_buffer()) == 0) {
+  return enable_decompression_ &&
+         (message.flags() & GRPC_WRITE_INTERNAL_COMPRESS) != 0;
+}
+
+absl::Status ChannelCompression::FinishDecompress(
+    Message& message, grpc_compression_algorithm algorithm,
+    bool did_decompress, SliceBuffer& decompressed,
+    CallTracerInterface* call_tracer) const {
+  if (!did_decompress) {
     return absl::InternalError(
         absl::StrCat("Unexpected error decompressing data for algorithm ",
-                     CompressionAlgorithmAsString(args.algorithm)));
+                     CompressionAlgorithmAsString(algorithm)));
   }
   // Swap the decompressed slices into the message.
-  message->payload()->Swap(&decompressed_slices);
-  message->mutable_flags() &= ~GRPC_WRITE_INTERNAL_COMPRESS;
-  message->mutable_flags() |= GRPC_WRITE_INTERNAL_TEST_ONLY_WAS_COMPRESSED;
+  message.payload()->Swap(&decompressed);
+  message.mutable_flags() &= ~GRPC_WRITE_INTERNAL_COMPRESS;
+  message.mutable_flags() |= GRPC_WRITE_INTERNAL_TEST_ONLY_WAS_COMPRESSED;
   if (call_tracer != nullptr) {
-    call_tracer->RecordReceivedDecompressedMessage(*message);
+    call_tracer->RecordReceivedDecompressedMessage(message);
   }
+  return absl::OkStatus();
+}
+
+absl::StatusOr<MessageHandle> ChannelCompression::DecompressMessage(
+    bool is_client, MessageHandle message, DecompressArgs args,
+    CallTracerInterface* call_tracer) const {
+  auto should_decompress =
+      ShouldDecompress(is_client, *message, args, call_tracer);
+  if (!should_decompress.ok()) return should_decompress.status();
+  if (!*should_decompress) return std::move(message);
+  // Try to decompress the payload.
+  SliceBuffer decompressed_slices;
+  bool did_decompress =
+      grpc_msg_decompress(args.algorithm, message->payload()->c_slice_buffer(),
+                          decompressed_slices.c_slice_buffer()) != 0;
+  GRPC_RETURN_IF_ERROR(FinishDecompress(*message, args.algorithm,
+                                        did_decompress, decompressed_slices,
+                                        call_tracer));
   return std::move(message);
 }
 
+//
+// ChannelCompression::MessageTransform
+//
+
+void ChannelCompression::MessageTransform::Offload::Run(int level) {
+  if (compress) {
+    succeeded = CompressPayload(algorithm, level, *message->payload(), output,
+                                &nanos);
+  } else {
+    succeeded =
+        grpc_msg_decompress(algorithm, message->payload()->c_slice_buffer(),
+                            output.c_slice_buffer()) != 0;
+  }
+  auto wakeup = std::move(waker);
+  done.store(true, std::memory_order_release);
+  wakeup.Wakeup();
+}
+
+Poll<ServerMetadataOrHandle<Message>>
+ChannelCompression::MessageTransform::operator()() {
+  if (offload_ == nullptr) return std::move(*result_);
+  if (!offload_->done.load(std::memory_order_acquire)) return Pending{};
+  auto offload = std::move(offload_);
+  auto& message = *offload->message;
+  if (offload->compress) {
+    engine_->FinishCompress(message, offload->algorithm, offload->succeeded,
+                            offload->output, offload->nanos,
+                            offload->call_tracer, offload->method_stats);
+  } else {
+    absl::Status status = engine_->FinishDecompress(
+        message, offload->algorithm, offload->succeeded, offload->output,
+        offload->call_tracer);
+    if (!status.ok()) {
+      return ServerMetadataOrHandle<Message>::Failure(
+          ServerMetadataFromStatus(status));
+    }
+  }
+  return ServerMetadataOrHandle<Message>::Ok(std::move(offload->message));
+}
+
+ChannelCompression::MessageTransform
+ChannelCompression::MaybeOffloadCompressMessage(
+    MessageHandle message, grpc_compression_algorithm algorithm,
+    CallTracerInterface* call_tracer, MethodStats* method_stats) const {
+  if (offload_threshold_ == 0 ||
+      message->payload()->Length() < offload_threshold_) {
+    return MessageTransform(ServerMetadataOrHandle<Message>::Ok(
+        CompressMessage(std::move(message), algorithm, call_tracer,
+                        method_stats)));
+  }
+  if (!ShouldCompress(*message, algorithm, call_tracer, method_stats)) {
+    return MessageTransform(
+        ServerMetadataOrHandle<Message>::Ok(std::move(message)));
+  }
+  auto offload = MakeRefCounted<MessageTransform::Offload>(
+      std::move(message), algorithm, /*compress=*/true, call_tracer);
+  offload->method_stats = method_stats;
+  GetContext<EventEngine>()->Run(
+      [offload, level = deflate_level_]() { offload->Run(level); });
+  return MessageTransform(this, std::move(offload));
+}
+
+ChannelCompression::MessageTransform
+ChannelCompression::MaybeOffloadDecompressMessage(
+    bool is_client, MessageHandle message, DecompressArgs args,
+    CallTracerInterface* call_tracer) const {
+  if (offload_threshold_ == 0 ||
+      message->payload()->Length() < offload_threshold_) {
+    auto decompressed = DecompressMessage(is_client, std::move(message),
+                                          args, call_tracer);
+    if (!decompressed.ok()) {
+      return MessageTransform(ServerMetadataOrHandle<Message>::Failure(
+          ServerMetadataFromStatus(decompressed.status())));
+    }
+    return MessageTransform(
+        ServerMetadataOrHandle<Message>::Ok(std::move(*decompressed)));
+  }
+  auto should_decompress =
+      ShouldDecompress(is_client, *message, args, call_tracer);
+  if (!should_decompress.ok()) {
+    return MessageTransform(ServerMetadataOrHandle<Message>::Failure(
+        ServerMetadataFromStatus(should_decompress.status())));
+  }
+  if (!*should_decompress) {
+    return MessageTransform(
+        ServerMetadataOrHandle<Message>::Ok(std::move(message)));
+  }
+  auto offload = MakeRefCounted<MessageTransform::Offload>(
+      std::move(message), args.algorithm, /*compress=*/false, call_tracer);
+  GetContext<EventEngine>()->Run([offload]() { offload->Run(0); });
+  return MessageTransform(this, std::move(offload));
+}
+
 grpc_compression_algorithm ChannelCompression::HandleOutgoingMetadata(
     grpc_metadata_batch& outgoing_metadata) {
   const auto algorithm = outgoing_metadata.Take(GrpcInternalEncodingRequest())
@@ -234,14 +504,22 @@ void ClientCompressionFilter::Call::OnClientInitialMetadata(
   compression_algorithm_ =
       filter->compression_engine_.HandleOutgoingMetadata(md);
   call_tracer_ = MaybeGetContext<CallTracerInterface>();
+  if (compression_algorithm_ != GRPC_COMPRESS_NONE) {
+    const Slice* path = md.get_pointer(HttpPathMetadata());
+    if (path != nullptr) {
+      method_stats_ =
+          filter->compression_engine_.GetMethodStats(path->as_string_view());
+    }
+  }
 }
 
-MessageHandle ClientCompressionFilter::Call::OnClientToServerMessage(
+ChannelCompression::MessageTransform
+ClientCompressionFilter::Call::OnClientToServerMessage(
     MessageHandle message, ClientCompressionFilter* filter) {
   GRPC_LATENT_SEE_INNER_SCOPE(
       "ClientCompressionFilter::Call::OnClientToServerMessage");
-  return filter->compression_engine_.CompressMessage(
-      std::move(message), compression_algorithm_, call_tracer_);
+  return filter->compression_engine_.MaybeOffloadCompressMessage(
+      std::move(message), compression_algorithm_, call_tracer_, method_stats_);
 }
 
 void ClientCompressionFilter::Call::OnServerInitialMetadata(
@@ -251,12 +529,12 @@ void ClientCompressionFilter::Call::OnServerInitialMetadata(
   decompress_args_ = filter->compression_engine_.HandleIncomingMetadata(md);
 }
 
-absl::StatusOr<MessageHandle>
+ChannelCompression::MessageTransform
 ClientCompressionFilter::Call::OnServerToClientMessage(
     MessageHandle message, ClientCompressionFilter* filter) {
   GRPC_LATENT_SEE_INNER_SCOPE(
       "ClientCompressionFilter::Call::OnServerToClientMessage");
-  return filter->compression_engine_.DecompressMessage(
+  return filter->compression_engine_.MaybeOffloadDecompressMessage(
       /*is_client=*/true, std::move(message), decompress_args_, call_tracer_);
 }
 
@@ -265,14 +543,19 @@ void ServerCompressionFilter::Call::OnClientInitialMetadata(
   GRPC_LATENT_SEE_INNER_SCOPE(
       "ServerCompressionFilter::Call::OnClientInitialMetadata");
   decompress_args_ = filter->compression_engine_.HandleIncomingMetadata(md);
+  const Slice* path = md.get_pointer(HttpPathMetadata());
+  if (path != nullptr) {
+    method_stats_ =
+        filter->compression_engine_.GetMethodStats(path->as_string_view());
+  }
 }
 
-absl::StatusOr<MessageHandle>
+ChannelCompression::MessageTransform
 ServerCompressionFilter::Call::OnClientToServerMessage(
     MessageHandle message, ServerCompressionFilter* filter) {
   GRPC_LATENT_SEE_INNER_SCOPE(
       "ServerCompressionFilter::Call::OnClientToServerMessage");
-  return filter->compression_engine_.DecompressMessage(
+  return filter->compression_engine_.MaybeOffloadDecompressMessage(
       /*is_client=*/false, std::move(message), decompress_args_,
       MaybeGetContext<CallTracerInterface>());
 }
@@ -285,13 +568,14 @@ void ServerCompressionFilter::Call::OnServerInitialMetadata(
       filter->compression_engine_.HandleOutgoingMetadata(md);
 }
 
-MessageHandle ServerCompressionFilter::Call::OnServerToClientMessage(
+ChannelCompression::MessageTransform
+ServerCompressionFilter::Call::OnServerToClientMessage(
     MessageHandle message, ServerCompressionFilter* filter) {
   GRPC_LATENT_SEE_INNER_SCOPE(
       "ServerCompressionFilter::Call::OnServerToClientMessage");
-  return filter->compression_engine_.CompressMessage(
+  return filter->compression_engine_.MaybeOffloadCompressMessage(
       std::move(message), compression_algorithm_,
-      MaybeGetContext<CallTracerInterface>());
+      MaybeGetContext<CallTracerInterface>(), method_stats_);
 }
 
 }  // namespace grpc_core
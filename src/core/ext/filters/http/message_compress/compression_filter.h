@@ -24,18 +24,31 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <atomic>
 #include <cstddef>
+#include <memory>
 #include <optional>
+#include <string>
 
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/string_view.h"
+#include "src/core/call/metadata.h"
 #include "src/core/call/metadata_batch.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/channel_fwd.h"
 #include "src/core/lib/channel/promise_based_filter.h"
 #include "src/core/lib/compression/compression_internal.h"
+#include "src/core/lib/promise/activity.h"
 #include "src/core/lib/promise/arena_promise.h"
+#include "src/core/lib/promise/context.h"
+#include "src/core/lib/promise/poll.h"
+#include "src/core/lib/slice/slice_buffer.h"
 #include "src/core/lib/transport/transport.h"
+#include "src/core/util/ref_counted.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/sync.h"
 
 namespace grpc_core {
 
@@ -60,11 +73,95 @@ namespace grpc_core {
 /// to incorporate GRPC_WRITE_INTERNAL_COMPRESS. Otherwise, and regardless of
 /// the aforementioned 'grpc-encoding' metadata value, data will pass through
 /// uncompressed.
+///
+/// Messages smaller than GRPC_ARG_COMPRESSION_MIN_MESSAGE_SIZE are never
+/// compressed.  With GRPC_ARG_ADAPTIVE_COMPRESSION, the filter also tracks
+/// how well each method's messages compress, and sends them uncompressed
+/// (apart from an occasional sample) while compression is not paying off.
 
 class ChannelCompression {
  public:
   explicit ChannelCompression(const ChannelArgs& args);
 
+  // How well one method's outgoing messages compress.  Updated without
+  // locks by every call to the method.
+  class MethodStats {
+   public:
+    // Returns true if this message should be sent without even trying to
+    // compress it.
+    bool ShouldSkip();
+    // Records an attempt to compress a message of uncompressed_size bytes
+    // that took nanos and produced compressed_size bytes (equal to
+    // uncompressed_size if compression did not help).
+    void RecordAttempt(size_t uncompressed_size, size_t compressed_size,
+                       uint64_t nanos);
+
+    Json::Object ToJsonObject() const;
+
+   private:
+    // Messages of a method whose average ratio is above this (in 1/1024ths)
+    // are mostly sent uncompressed.
+    static constexpr uint32_t kPoorRatio = 922;
+    // While skipping, one in this many messages is still compressed to
+    // notice if the payloads change.
+    static constexpr uint64_t kSampleInterval = 16;
+
+    std::atomic<uint64_t> messages_{0};
+    std::atomic<uint64_t> skipped_{0};
+    std::atomic<uint64_t> uncompressed_bytes_{0};
+    std::atomic<uint64_t> compressed_bytes_{0};
+    std::atomic<uint64_t> compress_nanos_{0};
+    // Moving average of compressed/uncompressed size, in 1/1024ths.
+    std::atomic<uint32_t> ratio_{0};
+  };
+
+  // A promise for a message compressed or decompressed by MaybeOffload*.
+  // Resolves immediately unless the work was handed to the EventEngine.
+  class MessageTransform {
+   public:
+    explicit MessageTransform(ServerMetadataOrHandle<Message> result)
+        : result_(std::move(result)) {}
+
+    Poll<ServerMetadataOrHandle<Message>> operator()();
+
+   private:
+    friend class ChannelCompression;
+
+    // The state shared with the EventEngine thread doing the work.  That
+    // thread owns the message until done is set, so that it stays valid
+    // if the call is cancelled in the meantime.
+    struct Offload : public RefCounted<Offload> {
+      Offload(MessageHandle message, grpc_compression_algorithm algorithm,
+              bool compress, CallTracerInterface* call_tracer)
+          : message(std::move(message)),
+            algorithm(algorithm),
+            compress(compress),
+            call_tracer(call_tracer) {}
+
+      // Runs on the EventEngine.
+      void Run(int level);
+
+      MessageHandle message;
+      const grpc_compression_algorithm algorithm;
+      const bool compress;
+      CallTracerInterface* const call_tracer;
+      MethodStats* method_stats = nullptr;
+      Waker waker{GetContext<Activity>()->MakeOwningWaker()};
+      SliceBuffer output;
+      bool succeeded = false;
+      uint64_t nanos = 0;
+      std::atomic<bool> done{false};
+    };
+
+    MessageTransform(const ChannelCompression* engine,
+                     RefCountedPtr<Offload> offload)
+        : engine_(engine), offload_(std::move(offload)) {}
+
+    std::optional<ServerMetadataOrHandle<Message>> result_;
+    const ChannelCompression* engine_ = nullptr;
+    RefCountedPtr<Offload> offload_;
+  };
+
   struct DecompressArgs {
     grpc_compression_algorithm algorithm;
     std::optional<uint32_t> max_recv_message_length;
@@ -83,33 +180,55 @@ class ChannelCompression {
   DecompressArgs HandleIncomingMetadata(
       const grpc_metadata_batch& incoming_metadata);
 
-  // Compress one message synchronously.
+  // Returns the adaptive compression state for the method at path, or null
+  // if adaptive compression is disabled.
+  MethodStats* GetMethodStats(absl::string_view path);
+
+  // Compress one message synchronously.  method_stats may be null.
   MessageHandle CompressMessage(MessageHandle message,
                                 grpc_compression_algorithm algorithm,
-                                CallTracerInterface* call_tracer) const;
+                                CallTracerInterface* call_tracer,
+                                MethodStats* method_stats) const;
   // Decompress one message synchronously.
   absl::StatusOr<MessageHandle> DecompressMessage(
       bool is_client, MessageHandle message, DecompressArgs args,
       CallTracerInterface* call_tracer) const;
 
-  Json::Object ToJsonObject() const {
-    Json::Object object;
-    if (max_recv_size_.has_value()) {
-      object["maxRecvSize"] = Json::FromNumber(*max_recv_size_);
-    }
-    const char* algorithm =
-        CompressionAlgorithmAsString(default_compression_algorithm_);
-    if (algorithm != nullptr) {
-      object["defaultCompressionAlgorithm"] = Json::FromString(algorithm);
-    }
-    object["enabledCompressionAlgorithms"] = Json::FromString(
-        std::string(enabled_compression_algorithms_.ToString()));
-    object["enableCompression"] = Json::FromBool(enable_compression_);
-    object["enableDecompression"] = Json::FromBool(enable_decompression_);
-    return object;
-  }
+  // As above, but messages of at least GRPC_ARG_COMPRESSION_OFFLOAD_THRESHOLD
+  // bytes are processed on an EventEngine thread.  Must be called from the
+  // call's activity.
+  MessageTransform MaybeOffloadCompressMessage(
+      MessageHandle message, grpc_compression_algorithm algorithm,
+      CallTracerInterface* call_tracer, MethodStats* method_stats) const;
+  MessageTransform MaybeOffloadDecompressMessage(
+      bool is_client, MessageHandle message, DecompressArgs args,
+      CallTracerInterface* call_tracer) const;
+
+  Json::Object ToJsonObject() const;
 
  private:
+  // Checks whether message should be compressed, and records it with
+  // call_tracer.
+  bool ShouldCompress(Message& message, grpc_compression_algorithm algorithm,
+                      CallTracerInterface* call_tracer,
+                      MethodStats* method_stats) const;
+  // Swaps in the compressed payload, if compression helped.
+  void FinishCompress(Message& message, grpc_compression_algorithm algorithm,
+                      bool did_compress, SliceBuffer& compressed,
+                      uint64_t nanos, CallTracerInterface* call_tracer,
+                      MethodStats* method_stats) const;
+  // Returns true if message needs decompressing, or an error if it may not
+  // be accepted.
+  absl::StatusOr<bool> ShouldDecompress(bool is_client, Message& message,
+                                        const DecompressArgs& args,
+                                        CallTracerInterface* call_tracer) const;
+  // Swaps in the decompressed payload.
+  absl::Status FinishDecompress(Message& message,
+                                grpc_compression_algorithm algorithm,
+                                bool did_decompress,
+                                SliceBuffer& decompressed,
+                                CallTracerInterface* call_tracer) const;
+
   // Max receive message length, if set.
   std::optional<uint32_t> max_recv_size_;
   size_t message_size_service_config_parser_index_;
@@ -121,6 +240,22 @@ class ChannelCompression {
   bool enable_compression_;
   // Is decompression enabled?
   bool enable_decompression_;
+  // zlib level for deflate and gzip, or -1 for zlib's default.
+  int deflate_level_;
+  // Smaller outgoing messages are not compressed.
+  size_t min_message_size_;
+  // Is adaptive compression enabled?
+  bool adaptive_;
+  // Messages at least this large are processed off the call's thread, if
+  // non-zero.
+  size_t offload_threshold_;
+  // Methods beyond this many share one entry, so that a server seeing
+  // arbitrary paths does not grow the map without bound.
+  static constexpr size_t kMaxTrackedMethods = 256;
+  mutable Mutex method_stats_mu_;
+  absl::flat_hash_map<std::string, std::unique_ptr<MethodStats>> method_stats_
+      ABSL_GUARDED_BY(method_stats_mu_);
+  MethodStats other_method_stats_;
 };
 
 class ClientCompressionFilter final
@@ -149,12 +284,12 @@ class ClientCompressionFilter final
    public:
     void OnClientInitialMetadata(ClientMetadata& md,
                                  ClientCompressionFilter* filter);
-    MessageHandle OnClientToServerMessage(MessageHandle message,
-                                          ClientCompressionFilter* filter);
+    ChannelCompression::MessageTransform OnClientToServerMessage(
+        MessageHandle message, ClientCompressionFilter* filter);
 
     void OnServerInitialMetadata(ServerMetadata& md,
                                  ClientCompressionFilter* filter);
-    absl::StatusOr<MessageHandle> OnServerToClientMessage(
+    ChannelCompression::MessageTransform OnServerToClientMessage(
         MessageHandle message, ClientCompressionFilter* filter);
 
     static inline const NoInterceptor OnClientToServerHalfClose;
@@ -164,6 +299,7 @@ class ClientCompressionFilter final
    private:
     grpc_compression_algorithm compression_algorithm_;
     ChannelCompression::DecompressArgs decompress_args_;
+    ChannelCompression::MethodStats* method_stats_ = nullptr;
     // TODO(yashykt): Remove call_tracer_ after migration to call v3 stack. (See
     // https://github.com/grpc/grpc/pull/38729 for more information.)
     CallTracerInterface* call_tracer_ = nullptr;
@@ -199,13 +335,13 @@ class ServerCompressionFilter final
    public:
     void OnClientInitialMetadata(ClientMetadata& md,
                                  ServerCompressionFilter* filter);
-    absl::StatusOr<MessageHandle> OnClientToServerMessage(
+    ChannelCompression::MessageTransform OnClientToServerMessage(
         MessageHandle message, ServerCompressionFilter* filter);
 
     void OnServerInitialMetadata(ServerMetadata& md,
                                  ServerCompressionFilter* filter);
-    MessageHandle OnServerToClientMessage(MessageHandle message,
-                                          ServerCompressionFilter* filter);
+    ChannelCompression::MessageTransform OnServerToClientMessage(
+        MessageHandle message, ServerCompressionFilter* filter);
 
     static inline const NoInterceptor OnClientToServerHalfClose;
     static inline const NoInterceptor OnServerTrailingMetadata;
@@ -214,6 +350,7 @@ class ServerCompressionFilter final
    private:
     ChannelCompression::DecompressArgs decompress_args_;
     grpc_compression_algorithm compression_algorithm_;
+    ChannelCompression::MethodStats* method_stats_ = nullptr;
   };
 
  private:
@@ -0,0 +1,98 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/filters/logging/buffered_logging_sink.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
+
+namespace grpc_core {
+
+BufferedLoggingSink::BufferedLoggingSink(
+    LoggingSink* sink, Options options,
+    std::shared_ptr<grpc_event_engine::experimental::EventEngine>
+        event_engine)
+    : sink_(sink),
+      options_(options),
+      event_engine_(std::move(event_engine)),
+      shards_(PerCpuOptions().SetMaxShards(options.max_shards)) {}
+
+void BufferedLoggingSink::LogEntry(Entry entry) {
+  size_t buffered;
+  {
+    Shard& shard = shards_.this_cpu();
+    MutexLock lock(&shard.mu);
+    buffered = shard.entries.size();
+    if (buffered < options_.max_entries_per_shard) {
+      shard.entries.push_back(std::move(entry));
+    }
+  }
+  if (buffered >= options_.max_entries_per_shard) {
+    dropped_entries_.fetch_add(1, std::memory_order_relaxed);
+    global_stats().IncrementCallLogEntriesDropped();
+    return;
+  }
+  // Flush a shard that is filling up without waiting for the timer.
+  if (buffered + 1 == options_.max_entries_per_shard / 2) {
+    event_engine_->Run([self = weak_from_this()]() {
+      if (auto sink = self.lock()) sink->Flush();
+    });
+    return;
+  }
+  MaybeScheduleFlush(options_.flush_interval);
+}
+
+void BufferedLoggingSink::MaybeScheduleFlush(Duration delay) {
+  if (flush_scheduled_.load(std::memory_order_relaxed) ||
+      flush_scheduled_.exchange(true, std::memory_order_acq_rel)) {
+    return;
+  }
+  event_engine_->RunAfter(delay, [self = weak_from_this()]() {
+    auto sink = self.lock();
+    if (sink == nullptr) return;
+    // Entries logged from here on schedule the next flush.
+    sink->flush_scheduled_.store(false, std::memory_order_release);
+    sink->Flush();
+  });
+}
+
+void BufferedLoggingSink::Flush() {
+  MutexLock flush_lock(&flush_mu_);
+  std::vector<Entry> batch;
+  for (Shard& shard : shards_) {
+    std::vector<Entry> entries;
+    {
+      MutexLock lock(&shard.mu);
+      entries.swap(shard.entries);
+    }
+    batch.insert(batch.end(), std::make_move_iterator(entries.begin()),
+                 std::make_move_iterator(entries.end()));
+  }
+  if (batch.empty()) return;
+  // A call's entries can land in different shards, so put the batch back in
+  // the order the entries were logged.
+  std::stable_sort(batch.begin(), batch.end(),
+                   [](const Entry& a, const Entry& b) {
+                     return a.timestamp < b.timestamp;
+                   });
+  sink_->LogEntries(std::move(batch));
+}
+
+}  // namespace grpc_core
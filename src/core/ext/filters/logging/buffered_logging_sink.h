@@ -0,0 +1,97 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_EXT_FILTERS_LOGGING_BUFFERED_LOGGING_SINK_H
+#define GRPC_SRC_CORE_EXT_FILTERS_LOGGING_BUFFERED_LOGGING_SINK_H
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/strings/string_view.h"
+#include "src/core/ext/filters/logging/logging_sink.h"
+#include "src/core/util/per_cpu.h"
+#include "src/core/util/sync.h"
+#include "src/core/util/time.h"
+
+namespace grpc_core {
+
+// A LoggingSink that buffers entries and hands them to another sink in
+// batches, off the call path.  Calls append entries to sharded, bounded
+// buffers; a flush scheduled on the EventEngine drains them into one batch
+// for the wrapped sink.  Entries that arrive while their shard is full are
+// dropped and counted.
+//
+// Must be owned by a std::shared_ptr.
+class BufferedLoggingSink final
+    : public LoggingSink,
+      public std::enable_shared_from_this<BufferedLoggingSink> {
+ public:
+  struct Options {
+    // Entries each shard holds before it starts dropping them.
+    size_t max_entries_per_shard = 4096;
+    size_t max_shards = 16;
+    // The longest an entry waits before it is handed to the sink.
+    Duration flush_interval = Duration::Milliseconds(100);
+  };
+
+  // sink must outlive this object.
+  BufferedLoggingSink(
+      LoggingSink* sink, Options options,
+      std::shared_ptr<grpc_event_engine::experimental::EventEngine>
+          event_engine);
+  ~BufferedLoggingSink() override { Flush(); }
+
+  Config FindMatch(bool is_client, absl::string_view service,
+                   absl::string_view method) override {
+    return sink_->FindMatch(is_client, service, method);
+  }
+
+  void LogEntry(Entry entry) override;
+
+  // Hands every buffered entry to the wrapped sink now.
+  void Flush();
+
+  uint64_t dropped_entries() const {
+    return dropped_entries_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  struct alignas(GPR_CACHELINE_SIZE) Shard {
+    Mutex mu;
+    std::vector<Entry> entries ABSL_GUARDED_BY(mu);
+  };
+
+  void MaybeScheduleFlush(Duration delay);
+
+  LoggingSink* const sink_;
+  const Options options_;
+  const std::shared_ptr<grpc_event_engine::experimental::EventEngine>
+      event_engine_;
+  PerCpu<Shard> shards_;
+  std::atomic<bool> flush_scheduled_{false};
+  std::atomic<uint64_t> dropped_entries_{0};
+  // Serializes flushes, so that each batch reaches the sink whole.
+  Mutex flush_mu_;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_FILTERS_LOGGING_BUFFERED_LOGGING_SINK_H
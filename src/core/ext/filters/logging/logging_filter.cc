@@ -516,4 +516,6 @@ void RegisterLoggingFilter(LoggingSink* sink) {
       });
 }
 
+void SetLoggingFilterSink(LoggingSink* sink) { g_logging_sink = sink; }
+
 }  // namespace grpc_core
@@ -131,6 +131,11 @@ class ServerLoggingFilter final
 
 void RegisterLoggingFilter(LoggingSink* sink);
 
+// Points the registered logging filter at sink instead, without registering
+// the filter again.  Calls that are already logging may still use the old
+// sink.
+void SetLoggingFilterSink(LoggingSink* sink);
+
 }  // namespace grpc_core
 
 #endif  // GRPC_SRC_CORE_EXT_FILTERS_LOGGING_LOGGING_FILTER_H
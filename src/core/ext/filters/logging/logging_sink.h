@@ -24,6 +24,8 @@
 
 #include <map>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "absl/numeric/int128.h"
 #include "absl/strings/str_cat.h"
@@ -149,6 +151,12 @@ class LoggingSink {
                            absl::string_view method) = 0;
 
   virtual void LogEntry(Entry entry) = 0;
+
+  // Logs a batch of entries. Sinks that take a lock per entry should
+  // override this to take it once per batch.
+  virtual void LogEntries(std::vector<Entry> entries) {
+    for (auto& entry : entries) LogEntry(std::move(entry));
+  }
 };
 
 inline std::ostream& operator<<(std::ostream& out,
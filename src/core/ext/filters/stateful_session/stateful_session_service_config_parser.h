@@ -77,6 +77,9 @@ class StatefulSessionServiceConfigParser final
   std::unique_ptr<ServiceConfigParser::ParsedConfig> ParsePerMethodParams(
       const ChannelArgs& args, const Json& json,
       ValidationErrors* errors) override;
+  std::vector<absl::string_view> ChannelArgKeys() const override {
+    return {GRPC_ARG_PARSE_STATEFUL_SESSION_METHOD_CONFIG};
+  }
   // Returns the parser index for the parser.
   static size_t ParserIndex();
   // Registers the parser.
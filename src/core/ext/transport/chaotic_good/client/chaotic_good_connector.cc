@@ -33,6 +33,7 @@
 #include "src/core/ext/transport/chaotic_good/client_transport.h"
 #include "src/core/ext/transport/chaotic_good/frame.h"
 #include "src/core/ext/transport/chaotic_good/frame_header.h"
+#include "src/core/ext/transport/chaotic_good/shared_memory_ring.h"
 #include "src/core/ext/transport/chaotic_good_legacy/client/chaotic_good_connector.h"
 #include "src/core/handshaker/handshaker.h"
 #include "src/core/handshaker/tcp_connect/tcp_connect_handshaker.h"
@@ -220,6 +221,8 @@ void ChaoticGoodConnector::Connect(const Args& args, Result* result,
       [result_notifier_ptr, resolved_addr]() mutable {
         chaotic_good_frame::Settings client_settings;
         client_settings.set_data_channel(false);
+        result_notifier_ptr->config.MaybeOfferSharedMemory(
+            IsLoopbackAddress(resolved_addr));
         result_notifier_ptr->config.PrepareClientOutgoingSettings(
             client_settings);
         return TrySeq(
@@ -52,8 +52,10 @@ namespace grpc_core {
 namespace chaotic_good {
 
 ChaoticGoodClientTransport::StreamDispatch::StreamDispatch(
-    MpscSender<OutgoingFrame> outgoing_frames)
-    : outgoing_frames_(std::move(outgoing_frames)) {}
+    MpscSender<OutgoingFrame> outgoing_frames,
+    std::optional<uint32_t> max_recv_message_size)
+    : max_recv_message_size_(max_recv_message_size),
+      outgoing_frames_(std::move(outgoing_frames)) {}
 
 RefCountedPtr<ChaoticGoodClientTransport::Stream>
 ChaoticGoodClientTransport::StreamDispatch::LookupStream(uint32_t stream_id) {
@@ -200,8 +202,9 @@ uint32_t ChaoticGoodClientTransport::StreamDispatch::MakeStream(
         self->stream_map_.erase(stream_id);
       });
   if (!on_done_added) return 0;
-  stream_map_.emplace(stream_id,
-                      MakeRefCounted<Stream>(std::move(call_handler)));
+  stream_map_.emplace(stream_id, MakeRefCounted<Stream>(
+                                     std::move(call_handler),
+                                     max_recv_message_size_));
   return stream_id;
 }
 
@@ -234,8 +237,9 @@ ChaoticGoodClientTransport::ChaoticGoodClientTransport(
   party_ = Party::Make(std::move(party_arena));
   MpscReceiver<OutgoingFrame> outgoing_frames{8};
   outgoing_frames_ = outgoing_frames.MakeSender();
-  stream_dispatch_ =
-      MakeRefCounted<StreamDispatch>(outgoing_frames.MakeSender());
+  stream_dispatch_ = MakeRefCounted<StreamDispatch>(
+      outgoing_frames.MakeSender(),
+      MessageReassembly::MaxRecvMessageSizeFromChannelArgs(args));
   frame_transport_->Start(party_.get(), std::move(outgoing_frames),
                           stream_dispatch_);
 }
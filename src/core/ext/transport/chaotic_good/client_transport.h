@@ -89,8 +89,9 @@ class ChaoticGoodClientTransport final : public ClientTransport {
 
  private:
   struct Stream : public RefCounted<Stream> {
-    explicit Stream(CallHandler call)
+    Stream(CallHandler call, std::optional<uint32_t> max_recv_message_size)
         : call(std::move(call)),
+          message_reassembly(max_recv_message_size),
           frame_dispatch_serializer(this->call.party()->MakeSpawnSerializer()) {
     }
     CallHandler call;
@@ -101,7 +102,8 @@ class ChaoticGoodClientTransport final : public ClientTransport {
 
   class StreamDispatch final : public FrameTransportSink {
    public:
-    explicit StreamDispatch(MpscSender<OutgoingFrame> outgoing_frames);
+    StreamDispatch(MpscSender<OutgoingFrame> outgoing_frames,
+                   std::optional<uint32_t> max_recv_message_size);
 
     void OnIncomingFrame(IncomingFrame incoming_frame) override;
     void OnFrameTransportClosed(absl::Status status) override;
@@ -133,6 +135,7 @@ class ChaoticGoodClientTransport final : public ClientTransport {
     static constexpr const uint32_t kClosedTransportStreamId =
         std::numeric_limits<uint32_t>::max();
 
+    const std::optional<uint32_t> max_recv_message_size_;
     Mutex mu_;
     uint32_t next_stream_id_ ABSL_GUARDED_BY(mu_) = 1;
     // Map of stream incoming server frames, key
@@ -15,15 +15,19 @@
 #ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_CONFIG_H
 #define GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_CONFIG_H
 
+#include <memory>
 #include <vector>
 
 #include "absl/container/flat_hash_set.h"
 #include "src/core/ext/transport/chaotic_good/chaotic_good_frame.pb.h"
 #include "src/core/ext/transport/chaotic_good/message_chunker.h"
 #include "src/core/ext/transport/chaotic_good/pending_connection.h"
+#include "src/core/ext/transport/chaotic_good/shared_memory_ring.h"
 #include "src/core/ext/transport/chaotic_good/tcp_frame_transport.h"
 #include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/debug/trace.h"
 #include "src/core/lib/event_engine/extensions/tcp_trace.h"
+#include "src/core/lib/experiments/experiments.h"
 
 namespace grpc_core {
 namespace chaotic_good {
@@ -35,6 +39,10 @@ namespace chaotic_good {
   "grpc.chaotic_good.max_send_chunk_size"
 #define GRPC_ARG_CHAOTIC_GOOD_INLINED_PAYLOAD_SIZE_THRESHOLD \
   "grpc.chaotic_good.inlined_payload_size_threshold"
+// Size in bytes of the shared memory ring offered to a peer on the same host
+// (0 disables shared memory).
+#define GRPC_ARG_CHAOTIC_GOOD_SHARED_MEMORY_RING_SIZE \
+  "grpc.chaotic_good.shared_memory_ring_size"
 
 // Transport configuration.
 // Most of our configuration is derived from channel args, and then exchanged
@@ -64,6 +72,9 @@ class Config {
         0, channel_args
                .GetInt(GRPC_ARG_CHAOTIC_GOOD_INLINED_PAYLOAD_SIZE_THRESHOLD)
                .value_or(inline_payload_size_threshold_));
+    shared_memory_ring_size_ = std::max(
+        0, channel_args.GetInt(GRPC_ARG_CHAOTIC_GOOD_SHARED_MEMORY_RING_SIZE)
+               .value_or(shared_memory_ring_size_));
     tracing_enabled_ =
         channel_args.GetBool(GRPC_ARG_TCP_TRACING_ENABLED).value_or(false);
   }
@@ -83,6 +94,26 @@ class Config {
     return std::move(pending_data_endpoints_);
   }
 
+  // Offer our peer a shared memory ring for the payloads we send, if it is on
+  // the same host. The offer is only taken up if the peer makes the same offer
+  // in return.
+  // Must be called before PrepareClientOutgoingSettings on the client, and
+  // before ReceiveClientIncomingSettings on the server.
+  void MaybeOfferSharedMemory(bool same_host_peer) {
+    if (!IsChaoticGoodSharedMemoryEnabled() || !same_host_peer ||
+        shared_memory_ring_size_ == 0) {
+      return;
+    }
+    auto ring = SharedMemoryRing::Create(shared_memory_ring_size_);
+    if (!ring.ok()) {
+      GRPC_TRACE_LOG(chaotic_good, INFO)
+          << "CHAOTIC_GOOD: Failed to create shared memory ring: "
+          << ring.status();
+      return;
+    }
+    shared_memory_send_ring_ = std::move(*ring);
+  }
+
   void PrepareServerOutgoingSettings(chaotic_good_frame::Settings& settings) {
     for (const auto& pending_data_endpoint : pending_data_endpoints_) {
       settings.add_connection_id(pending_data_endpoint.id());
@@ -113,7 +144,16 @@ class Config {
     for (const auto& connection_id : settings.connection_id()) {
       pending_data_endpoints_.emplace_back(connector.Connect(connection_id));
     }
-    return ReceiveIncomingSettings(settings);
+    auto status = ReceiveIncomingSettings(settings);
+    if (!status.ok()) return status;
+    // The server accepted our shared memory offer: it will be sending
+    // payloads through its ring, so we must be able to read them.
+    if (!settings.shared_memory_ring().empty() &&
+        shared_memory_recv_ring_ == nullptr) {
+      return absl::InternalError(
+          "Failed to open the shared memory ring offered by the server");
+    }
+    return absl::OkStatus();
   }
 
   absl::Status ReceiveClientIncomingSettings(
@@ -148,6 +188,8 @@ class Config {
     options.encode_alignment = encode_alignment_;
     options.decode_alignment = decode_alignment_;
     options.inlined_payload_size_threshold = inline_payload_size_threshold_;
+    options.shared_memory_send_ring = shared_memory_send_ring_;
+    options.shared_memory_recv_ring = shared_memory_recv_ring_;
     return options;
   }
 
@@ -188,6 +230,11 @@ class Config {
     return supported_features_.contains(chaotic_good_frame::Settings::CHUNKING);
   }
 
+  bool uses_shared_memory() const {
+    return shared_memory_send_ring_ != nullptr &&
+           shared_memory_recv_ring_ != nullptr;
+  }
+
  private:
   // Fill-in a settings frame to be sent with the results of the negotiation so
   // far. For the client this will be whatever we got from channel args; for the
@@ -196,6 +243,9 @@ class Config {
   void PrepareOutgoingSettings(chaotic_good_frame::Settings& settings) const {
     settings.set_alignment(decode_alignment_);
     settings.set_max_chunk_size(max_recv_chunk_size_);
+    if (shared_memory_send_ring_ != nullptr) {
+      settings.set_shared_memory_ring(shared_memory_send_ring_->name());
+    }
   }
 
   // Receive a settings frame from our peer and integrate its settings with our
@@ -209,6 +259,20 @@ class Config {
       max_recv_chunk_size_ = 0;
       max_send_chunk_size_ = 0;
     }
+    // Shared memory is only used if both peers offered a ring; otherwise
+    // drop our own offer.
+    if (shared_memory_send_ring_ != nullptr &&
+        !settings.shared_memory_ring().empty()) {
+      auto ring = SharedMemoryRing::Open(settings.shared_memory_ring());
+      if (ring.ok()) {
+        shared_memory_recv_ring_ = std::move(*ring);
+      } else {
+        GRPC_TRACE_LOG(chaotic_good, INFO)
+            << "CHAOTIC_GOOD: Failed to open peer shared memory ring: "
+            << ring.status();
+      }
+    }
+    if (shared_memory_recv_ring_ == nullptr) shared_memory_send_ring_.reset();
     return absl::OkStatus();
   }
 
@@ -218,6 +282,9 @@ class Config {
   uint32_t max_send_chunk_size_ = 1024 * 1024;
   uint32_t max_recv_chunk_size_ = 1024 * 1024;
   uint32_t inline_payload_size_threshold_ = 8 * 1024;
+  int shared_memory_ring_size_ = 64 * 1024 * 1024;
+  std::shared_ptr<SharedMemoryRing> shared_memory_send_ring_;
+  std::shared_ptr<SharedMemoryRing> shared_memory_recv_ring_;
   std::vector<PendingConnection> pending_data_endpoints_;
   absl::flat_hash_set<chaotic_good_frame::Settings::Features>
       supported_features_;
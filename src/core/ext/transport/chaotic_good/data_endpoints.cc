@@ -19,6 +19,9 @@
 #include <cstdint>
 #include <limits>
 #include <memory>
+#include <optional>
+#include <tuple>
+#include <utility>
 
 #include "absl/cleanup/cleanup.h"
 #include "src/core/ext/transport/chaotic_good/tcp_frame_header.h"
@@ -28,6 +31,7 @@
 #include "src/core/lib/event_engine/extensions/tcp_trace.h"
 #include "src/core/lib/event_engine/query_extensions.h"
 #include "src/core/lib/event_engine/tcp_socket_utils.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/promise/loop.h"
 #include "src/core/lib/promise/map.h"
 #include "src/core/lib/promise/try_seq.h"
@@ -43,7 +47,10 @@ namespace data_endpoints_detail {
 
 namespace {
 const uint64_t kSecurityFramePayloadTag = 0;
-}
+// Set on the payload tag of frames whose body is a SharedMemoryRing::Chunk
+// descriptor rather than the payload itself.
+const uint64_t kSharedMemoryPayloadTagBit = uint64_t{1} << 63;
+}  // namespace
 
 ///////////////////////////////////////////////////////////////////////////////
 // SendRate
@@ -163,9 +170,52 @@ void OutputBuffer::AddData(Json::Object& obj) const {
   send_rate_.AddData(obj);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// ActiveEndpoints
+
+bool ActiveEndpoints::RecordWrite(std::optional<double> earliest_delivery_time) {
+  if (!earliest_delivery_time.has_value() ||
+      *earliest_delivery_time > kGrowDeliveryTime) {
+    prompt_writes_ = 0;
+    if (active_ == connected_) return false;
+    ++active_;
+    return true;
+  }
+  // A zero delivery time means the rate of the endpoint is not known, which
+  // says nothing about how busy it is.
+  if (*earliest_delivery_time <= 0.0 ||
+      *earliest_delivery_time >= kShrinkDeliveryTime) {
+    prompt_writes_ = 0;
+    return false;
+  }
+  if (++prompt_writes_ >= kShrinkAfterWrites) {
+    prompt_writes_ = 0;
+    if (active_ > 1) --active_;
+  }
+  return false;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // OutputBuffers
 
+std::pair<size_t, double> OutputBuffers::EarliestDelivery(
+    uint64_t send_time, size_t write_size, size_t max_endpoints) {
+  size_t best_endpoint = std::numeric_limits<size_t>::max();
+  double earliest_delivery = std::numeric_limits<double>::max();
+  size_t considered = 0;
+  for (size_t i = 0; i < buffers_.size() && considered < max_endpoints; ++i) {
+    if (!buffers_[i].has_value()) continue;
+    ++considered;
+    auto decision = buffers_[i]->GetLbDecision(send_time, write_size);
+    if (!decision.delivery_time.has_value()) continue;
+    if (*decision.delivery_time < earliest_delivery) {
+      earliest_delivery = *decision.delivery_time;
+      best_endpoint = i;
+    }
+  }
+  return {best_endpoint, earliest_delivery};
+}
+
 void OutputBuffers::WriteSecurityFrame(uint32_t connection_id,
                                        SliceBuffer output_buffer) {
   Waker waker;
@@ -214,16 +264,19 @@ Poll<Empty> OutputBuffers::PollWrite(uint64_t payload_tag, uint64_t send_time,
   CHECK_EQ(write_size % encode_alignment_, 0u)
       << GRPC_DUMP_ARGS(write_size, length, encode_alignment_);
   MutexLock lock(&mu_);
-  size_t best_endpoint = std::numeric_limits<size_t>::max();
-  double earliest_delivery = std::numeric_limits<double>::max();
-  for (size_t i = 0; i < buffers_.size(); ++i) {
-    if (!buffers_[i].has_value()) continue;
-    auto decision = buffers_[i]->GetLbDecision(send_time, write_size);
-    if (!decision.delivery_time.has_value()) continue;
-    if (*decision.delivery_time < earliest_delivery) {
-      earliest_delivery = *decision.delivery_time;
-      best_endpoint = i;
-    }
+  size_t best_endpoint;
+  double earliest_delivery;
+  if (IsChaoticGoodAdaptiveDataEndpointsEnabled()) {
+    do {
+      std::tie(best_endpoint, earliest_delivery) = EarliestDelivery(
+          send_time, write_size, active_endpoints_.active());
+    } while (active_endpoints_.RecordWrite(
+        best_endpoint == std::numeric_limits<size_t>::max()
+            ? std::nullopt
+            : std::optional<double>(earliest_delivery)));
+  } else {
+    std::tie(best_endpoint, earliest_delivery) = EarliestDelivery(
+        send_time, write_size, std::numeric_limits<size_t>::max());
   }
   if (best_endpoint == std::numeric_limits<size_t>::max()) {
     GRPC_TRACE_LOG(chaotic_good, INFO)
@@ -307,6 +360,7 @@ void OutputBuffers::AddEndpoint(uint32_t connection_id) {
   }
   CHECK(!buffers_[connection_id].has_value()) << GRPC_DUMP_ARGS(connection_id);
   buffers_[connection_id].emplace();
+  active_endpoints_.AddEndpoint();
   waker = std::move(write_waker_);
   ready_endpoints_.fetch_add(1, std::memory_order_relaxed);
 }
@@ -325,6 +379,7 @@ void OutputBuffers::AddData(channelz::DataSink sink) {
   data["ready_endpoints"] =
       Json::FromNumber(ready_endpoints_.load(std::memory_order_relaxed));
   data["have_write_waker"] = Json::FromBool(!write_waker_.is_unwakeable());
+  data["active_endpoints"] = Json::FromNumber(active_endpoints_.active());
   Json::Array buffers;
   for (const auto& buffer : buffers_) {
     Json::Object obj;
@@ -570,13 +625,17 @@ auto Endpoint::WriteLoop(uint32_t id,
   });
 }
 
-auto Endpoint::ReadLoop(uint32_t id, uint32_t decode_alignment,
-                        RefCountedPtr<InputQueue> input_queues,
-                        std::shared_ptr<PromiseEndpoint> endpoint,
-                        std::shared_ptr<TcpZTraceCollector> ztrace_collector) {
+auto Endpoint::ReadLoop(
+    uint32_t id, uint32_t decode_alignment,
+    RefCountedPtr<InputQueue> input_queues,
+    std::shared_ptr<PromiseEndpoint> endpoint,
+    std::shared_ptr<TcpZTraceCollector> ztrace_collector,
+    std::shared_ptr<SharedMemoryRing> shared_memory_recv_ring) {
   return Loop([id, decode_alignment, endpoint = std::move(endpoint),
                input_queues = std::move(input_queues),
-               ztrace_collector = std::move(ztrace_collector)]() {
+               ztrace_collector = std::move(ztrace_collector),
+               shared_memory_recv_ring =
+                   std::move(shared_memory_recv_ring)]() {
     return TrySeq(
         GRPC_LATENT_SEE_PROMISE(
             "DataEndpointReadHdr",
@@ -611,7 +670,8 @@ auto Endpoint::ReadLoop(uint32_t id, uint32_t decode_alignment,
                 return x;
               });
         },
-        [endpoint, input_queues, id, decode_alignment](
+        [endpoint, input_queues, id, decode_alignment,
+         shared_memory_recv_ring](
             std::tuple<SliceBuffer, TcpDataFrameHeader> buffer_frame)
             -> LoopCtl<absl::Status> {
           auto& [buffer, frame_header] = buffer_frame;
@@ -623,6 +683,13 @@ auto Endpoint::ReadLoop(uint32_t id, uint32_t decode_alignment,
           if (GPR_UNLIKELY(frame_header.payload_tag ==
                            kSecurityFramePayloadTag)) {
             ReceiveSecurityFrame(*endpoint, std::move(buffer));
+          } else if (frame_header.payload_tag & kSharedMemoryPayloadTagBit) {
+            auto payload = ReadFromSharedMemory(shared_memory_recv_ring.get(),
+                                                std::move(buffer));
+            if (!payload.ok()) return payload.status();
+            input_queues->CompleteRead(
+                frame_header.payload_tag & ~kSharedMemoryPayloadTagBit,
+                std::move(*payload));
           } else {
             input_queues->CompleteRead(frame_header.payload_tag,
                                        std::move(buffer));
@@ -632,6 +699,24 @@ auto Endpoint::ReadLoop(uint32_t id, uint32_t decode_alignment,
   });
 }
 
+absl::StatusOr<SliceBuffer> Endpoint::ReadFromSharedMemory(
+    SharedMemoryRing* shared_memory_recv_ring, SliceBuffer descriptor) {
+  if (shared_memory_recv_ring == nullptr) {
+    return absl::InternalError(
+        "Shared memory payload received without a shared memory ring");
+  }
+  if (descriptor.Length() != SharedMemoryRing::Chunk::kWireSize) {
+    return absl::InternalError(
+        absl::StrCat("Bad shared memory descriptor length: ",
+                     descriptor.Length()));
+  }
+  uint8_t data[SharedMemoryRing::Chunk::kWireSize];
+  descriptor.CopyToBuffer(data);
+  auto chunk = SharedMemoryRing::Chunk::Parse(data);
+  if (!chunk.ok()) return chunk.status();
+  return shared_memory_recv_ring->Read(*chunk);
+}
+
 void Endpoint::ReceiveSecurityFrame(PromiseEndpoint& endpoint,
                                     SliceBuffer buffer) {
   auto* transport_framing_endpoint_extension =
@@ -645,7 +730,8 @@ Endpoint::Endpoint(uint32_t id, uint32_t decode_alignment,
                    RefCountedPtr<InputQueue> input_queues,
                    PendingConnection pending_connection, bool enable_tracing,
                    TransportContextPtr ctx,
-                   std::shared_ptr<TcpZTraceCollector> ztrace_collector)
+                   std::shared_ptr<TcpZTraceCollector> ztrace_collector,
+                   std::shared_ptr<SharedMemoryRing> shared_memory_recv_ring)
     : ztrace_collector_(ztrace_collector), id_(id) {
   auto arena = SimpleArenaAllocator(0)->MakeArena();
   arena->SetContext(ctx->event_engine.get());
@@ -656,15 +742,18 @@ Endpoint::Endpoint(uint32_t id, uint32_t decode_alignment,
        output_buffers = std::move(output_buffers), input_queues,
        pending_connection = std::move(pending_connection),
        arena = std::move(arena), ctx = std::move(ctx),
-       ztrace_collector = std::move(ztrace_collector)]() mutable {
+       ztrace_collector = std::move(ztrace_collector),
+       shared_memory_recv_ring =
+           std::move(shared_memory_recv_ring)]() mutable {
         return TrySeq(
             pending_connection.Await(),
             [id, decode_alignment, enable_tracing,
              output_buffers = std::move(output_buffers),
              input_queues = std::move(input_queues), arena = std::move(arena),
              ctx = std::move(ctx),
-             ztrace_collector =
-                 std::move(ztrace_collector)](PromiseEndpoint ep) mutable {
+             ztrace_collector = std::move(ztrace_collector),
+             shared_memory_recv_ring = std::move(shared_memory_recv_ring)](
+                PromiseEndpoint ep) mutable {
               GRPC_TRACE_LOG(chaotic_good, INFO)
                   << "CHAOTIC_GOOD: data endpoint " << id << " to "
                   << grpc_event_engine::experimental::ResolvedAddressToString(
@@ -711,9 +800,10 @@ Endpoint::Endpoint(uint32_t id, uint32_t decode_alignment,
               read_party->Spawn(
                   "read",
                   [id, decode_alignment, input_queues, endpoint,
-                   ztrace_collector]() {
+                   ztrace_collector, shared_memory_recv_ring]() {
                     return ReadLoop(id, decode_alignment, input_queues,
-                                    endpoint, ztrace_collector);
+                                    endpoint, ztrace_collector,
+                                    shared_memory_recv_ring);
                   },
                   [input_queues](absl::Status status) {
                     GRPC_TRACE_LOG(chaotic_good, INFO)
@@ -744,15 +834,35 @@ DataEndpoints::DataEndpoints(
     std::vector<PendingConnection> endpoints_vec, TransportContextPtr ctx,
     uint32_t encode_alignment, uint32_t decode_alignment,
     std::shared_ptr<TcpZTraceCollector> ztrace_collector, bool enable_tracing,
-    data_endpoints_detail::Clock* clock)
-    : output_buffers_(MakeRefCounted<data_endpoints_detail::OutputBuffers>(
+    data_endpoints_detail::Clock* clock,
+    std::shared_ptr<SharedMemoryRing> shared_memory_send_ring,
+    std::shared_ptr<SharedMemoryRing> shared_memory_recv_ring)
+    : shared_memory_send_ring_(std::move(shared_memory_send_ring)),
+      output_buffers_(MakeRefCounted<data_endpoints_detail::OutputBuffers>(
           clock, encode_alignment, ztrace_collector, ctx)),
       input_queues_(MakeRefCounted<data_endpoints_detail::InputQueue>(ctx)) {
   for (size_t i = 0; i < endpoints_vec.size(); ++i) {
     endpoints_.emplace_back(std::make_unique<data_endpoints_detail::Endpoint>(
         i, decode_alignment, output_buffers_, input_queues_,
-        std::move(endpoints_vec[i]), enable_tracing, ctx, ztrace_collector));
+        std::move(endpoints_vec[i]), enable_tracing, ctx, ztrace_collector,
+        shared_memory_recv_ring));
+  }
+}
+
+void DataEndpoints::MaybeMoveToSharedMemory(uint64_t& tag,
+                                            SliceBuffer& output_buffer) {
+  auto chunk = shared_memory_send_ring_->Write(output_buffer);
+  if (!chunk.has_value()) {
+    // Ring is full (or the payload is larger than the ring): send the payload
+    // on the data endpoint as usual.
+    GRPC_TRACE_LOG(chaotic_good, INFO)
+        << "CHAOTIC_GOOD: No shared memory for " << output_buffer.Length()
+        << "b payload " << tag;
+    return;
   }
+  output_buffer.Clear();
+  chunk->Serialize(output_buffer.AddTiny(SharedMemoryRing::Chunk::kWireSize));
+  tag |= data_endpoints_detail::kSharedMemoryPayloadTagBit;
 }
 
 }  // namespace chaotic_good
@@ -20,9 +20,13 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <optional>
+#include <utility>
 
+#include "absl/status/statusor.h"
 #include "src/core/channelz/channelz.h"
 #include "src/core/ext/transport/chaotic_good/pending_connection.h"
+#include "src/core/ext/transport/chaotic_good/shared_memory_ring.h"
 #include "src/core/ext/transport/chaotic_good/tcp_ztrace_collector.h"
 #include "src/core/ext/transport/chaotic_good/transport_context.h"
 #include "src/core/lib/promise/party.h"
@@ -94,6 +98,39 @@ class OutputBuffer {
   SendRate send_rate_;
 };
 
+// Decides how many of the connected data endpoints writes are spread over
+// (chaotic_good_adaptive_data_endpoints).
+// Endpoints are activated in connection order. An endpoint is added whenever
+// no active endpoint is expected to deliver a write promptly, and one is
+// dropped after a run of writes that all are.
+class ActiveEndpoints {
+ public:
+  // Expected delivery time (seconds) above which another endpoint is added.
+  static constexpr double kGrowDeliveryTime = 0.002;
+  // Expected delivery time (seconds) below which a write counts towards
+  // dropping an endpoint.
+  static constexpr double kShrinkDeliveryTime = 0.0002;
+  // Number of consecutive prompt writes after which an endpoint is dropped.
+  static constexpr uint32_t kShrinkAfterWrites = 128;
+
+  // New endpoints start out active.
+  void AddEndpoint() {
+    ++connected_;
+    ++active_;
+  }
+  size_t active() const { return active_; }
+
+  // Records the expected delivery time of the earliest active endpoint for a
+  // write, or nullopt if no active endpoint can take it. Returns true if an
+  // endpoint was added, in which case the write should choose again.
+  bool RecordWrite(std::optional<double> earliest_delivery_time);
+
+ private:
+  size_t connected_ = 0;
+  size_t active_ = 0;
+  uint32_t prompt_writes_ = 0;
+};
+
 // The set of output buffers for all connected data endpoints
 class OutputBuffers final : public RefCounted<OutputBuffers>,
                             public channelz::DataSource {
@@ -138,11 +175,19 @@ class OutputBuffers final : public RefCounted<OutputBuffers>,
                         std::shared_ptr<TcpCallTracer>& call_tracer);
   Poll<NextWrite> PollNext(uint32_t connection_id);
   void UpdateMetrics(size_t output_buffer, const TcpConnectionMetrics& metrics);
+  // Returns the index and expected delivery time of the endpoint that would
+  // deliver a write of write_size bytes first, considering only the first
+  // max_endpoints open endpoints. The index is SIZE_MAX if none of them can.
+  std::pair<size_t, double> EarliestDelivery(uint64_t send_time,
+                                             size_t write_size,
+                                             size_t max_endpoints)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
 
   const std::shared_ptr<TcpZTraceCollector> ztrace_collector_;
   Mutex mu_;
   std::vector<std::optional<OutputBuffer>> buffers_ ABSL_GUARDED_BY(mu_);
   Waker write_waker_ ABSL_GUARDED_BY(mu_);
+  ActiveEndpoints active_endpoints_ ABSL_GUARDED_BY(mu_);
   std::atomic<uint32_t> ready_endpoints_{0};
   const uint32_t encode_alignment_;
   Clock* const clock_;
@@ -247,7 +292,8 @@ class Endpoint final {
            RefCountedPtr<InputQueue> input_queues,
            PendingConnection pending_connection, bool enable_tracing,
            TransportContextPtr ctx,
-           std::shared_ptr<TcpZTraceCollector> ztrace_collector);
+           std::shared_ptr<TcpZTraceCollector> ztrace_collector,
+           std::shared_ptr<SharedMemoryRing> shared_memory_recv_ring);
   Endpoint(const Endpoint&) = delete;
   Endpoint& operator=(const Endpoint&) = delete;
   Endpoint(Endpoint&&) = delete;
@@ -259,10 +305,14 @@ class Endpoint final {
                         RefCountedPtr<OutputBuffers> output_buffers,
                         std::shared_ptr<PromiseEndpoint> endpoint,
                         std::shared_ptr<TcpZTraceCollector> ztrace_collector);
-  static auto ReadLoop(uint32_t id, uint32_t decode_alignment,
-                       RefCountedPtr<InputQueue> input_queues,
-                       std::shared_ptr<PromiseEndpoint> endpoint,
-                       std::shared_ptr<TcpZTraceCollector> ztrace_collector);
+  static auto ReadLoop(
+      uint32_t id, uint32_t decode_alignment,
+      RefCountedPtr<InputQueue> input_queues,
+      std::shared_ptr<PromiseEndpoint> endpoint,
+      std::shared_ptr<TcpZTraceCollector> ztrace_collector,
+      std::shared_ptr<SharedMemoryRing> shared_memory_recv_ring);
+  static absl::StatusOr<SliceBuffer> ReadFromSharedMemory(
+      SharedMemoryRing* shared_memory_recv_ring, SliceBuffer descriptor);
   static void ReceiveSecurityFrame(PromiseEndpoint& endpoint,
                                    SliceBuffer buffer);
 
@@ -283,7 +333,11 @@ class DataEndpoints {
                          uint32_t decode_alignment,
                          std::shared_ptr<TcpZTraceCollector> ztrace_collector,
                          bool enable_tracing,
-                         data_endpoints_detail::Clock* clock = DefaultClock());
+                         data_endpoints_detail::Clock* clock = DefaultClock(),
+                         std::shared_ptr<SharedMemoryRing>
+                             shared_memory_send_ring = nullptr,
+                         std::shared_ptr<SharedMemoryRing>
+                             shared_memory_recv_ring = nullptr);
 
   // Try to queue output_buffer against a data endpoint.
   // Returns a promise that resolves to the data endpoint connection id
@@ -291,8 +345,13 @@ class DataEndpoints {
   // Connection ids returned by this class are 0 based (which is different
   // to how chaotic good communicates them on the wire - those are 1 based
   // to allow for the control channel identification)
+  // If a shared memory ring was negotiated and has room, the payload is
+  // copied there, and only a descriptor for it is sent on the data endpoint.
   auto Write(uint64_t tag, SliceBuffer output_buffer,
              std::shared_ptr<TcpCallTracer> call_tracer) {
+    if (shared_memory_send_ring_ != nullptr) {
+      MaybeMoveToSharedMemory(tag, output_buffer);
+    }
     return output_buffers_->Write(tag, std::move(output_buffer),
                                   std::move(call_tracer));
   }
@@ -303,7 +362,6 @@ class DataEndpoints {
 
   bool empty() const { return output_buffers_->ReadyEndpoints() == 0; }
 
- private:
   static data_endpoints_detail::Clock* DefaultClock() {
     class ClockImpl final : public data_endpoints_detail::Clock {
      public:
@@ -315,6 +373,10 @@ class DataEndpoints {
     return &clock;
   }
 
+ private:
+  void MaybeMoveToSharedMemory(uint64_t& tag, SliceBuffer& output_buffer);
+
+  const std::shared_ptr<SharedMemoryRing> shared_memory_send_ring_;
   RefCountedPtr<data_endpoints_detail::OutputBuffers> output_buffers_;
   RefCountedPtr<data_endpoints_detail::InputQueue> input_queues_;
   Mutex mu_;
@@ -15,9 +15,19 @@
 #ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_MESSAGE_REASSEMBLY_H
 #define GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_MESSAGE_REASSEMBLY_H
 
+#include <grpc/impl/channel_arg_names.h>
+#include <grpc/impl/grpc_types.h>
+#include <grpc/status.h>
+
+#include <cstdint>
+#include <optional>
+
 #include "absl/log/log.h"
+#include "absl/status/status.h"
+#include "absl/strings/str_format.h"
 #include "src/core/call/call_spine.h"
 #include "src/core/ext/transport/chaotic_good/frame.h"
+#include "src/core/lib/channel/channel_args.h"
 
 namespace grpc_core {
 namespace chaotic_good {
@@ -26,6 +36,23 @@ namespace chaotic_good {
 // never having two messages in flight on the same stream.
 class MessageReassembly {
  public:
+  // Returns the largest message the message size filter would let through
+  // on a transport with \a args, if there is a limit.
+  static std::optional<uint32_t> MaxRecvMessageSizeFromChannelArgs(
+      const ChannelArgs& args) {
+    if (args.WantMinimalStack()) return std::nullopt;
+    const int size = args.GetInt(GRPC_ARG_MAX_RECEIVE_MESSAGE_LENGTH)
+                         .value_or(GRPC_DEFAULT_MAX_RECV_MESSAGE_LENGTH);
+    if (size < 0) return std::nullopt;
+    return static_cast<uint32_t>(size);
+  }
+
+  // Chunked messages longer than \a max_recv_message_size fail their call
+  // as soon as their BeginMessage arrives, before any chunk is buffered.
+  explicit MessageReassembly(
+      std::optional<uint32_t> max_recv_message_size = std::nullopt)
+      : max_recv_message_size_(max_recv_message_size) {}
+
   void FailCall(CallInitiator& call, absl::string_view msg) {
     LOG_EVERY_N_SEC(INFO, 10) << "Call failed during reassembly: " << msg;
     call.Cancel();
@@ -36,6 +63,18 @@ class MessageReassembly {
         CancelledServerMetadataFromStatus(GRPC_STATUS_INTERNAL, msg));
   }
 
+  void FailCallMessageTooLarge(CallInitiator& call, uint64_t length) {
+    call.Cancel(absl::ResourceExhaustedError(
+        absl::StrFormat("SERVER: Received message larger than max (%u vs. %d)",
+                        length, *max_recv_message_size_)));
+  }
+  void FailCallMessageTooLarge(CallHandler& call, uint64_t length) {
+    call.PushServerTrailingMetadata(CancelledServerMetadataFromStatus(
+        GRPC_STATUS_RESOURCE_EXHAUSTED,
+        absl::StrFormat("CLIENT: Received message larger than max (%u vs. %d)",
+                        length, *max_recv_message_size_)));
+  }
+
   template <typename Sink>
   auto PushFrameInto(MessageFrame frame, Sink& sink) {
     return If(
@@ -61,6 +100,9 @@ class MessageReassembly {
                "Received begin message for an empty message (not allowed)");
     } else if (frame.body.length() > std::numeric_limits<size_t>::max() / 2) {
       FailCall(sink, "Received too large begin message");
+    } else if (max_recv_message_size_.has_value() &&
+               frame.body.length() > *max_recv_message_size_) {
+      FailCallMessageTooLarge(sink, frame.body.length());
     } else {
       GRPC_TRACE_LOG(chaotic_good, INFO)
           << this << " begin message " << frame.body.ShortDebugString();
@@ -105,11 +147,16 @@ class MessageReassembly {
   bool in_message_boundary() { return chunk_receiver_ == nullptr; }
 
  private:
+  // Chunks are kept by reference rather than copied into a buffer sized from
+  // the BeginMessage length: each chunk payload was already read in one
+  // piece sized from its frame header, so flattening would only add a copy
+  // (and a large up front allocation a peer could request without sending).
   struct ChunkReceiver {
     size_t bytes_remaining;
     SliceBuffer incoming;
   };
   std::unique_ptr<ChunkReceiver> chunk_receiver_;
+  const std::optional<uint32_t> max_recv_message_size_;
 };
 
 }  // namespace chaotic_good
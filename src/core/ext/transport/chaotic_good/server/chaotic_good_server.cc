@@ -36,6 +36,7 @@
 #include "src/core/ext/transport/chaotic_good/frame.h"
 #include "src/core/ext/transport/chaotic_good/frame_header.h"
 #include "src/core/ext/transport/chaotic_good/server_transport.h"
+#include "src/core/ext/transport/chaotic_good/shared_memory_ring.h"
 #include "src/core/ext/transport/chaotic_good_legacy/server/chaotic_good_server.h"
 #include "src/core/handshaker/handshaker.h"
 #include "src/core/lib/channel/channel_args.h"
@@ -337,6 +338,11 @@ auto ChaoticGoodServerListener::ActiveConnection::HandshakingState::
                           frame.body.connection_id()[0]);
                     } else {
                       Config config{self->connection_->args()};
+                      if (!frame.body.shared_memory_ring().empty()) {
+                        const auto& ep = self->connection_->endpoint_;
+                        config.MaybeOfferSharedMemory(IsSameHostPeer(
+                            ep.GetLocalAddress(), ep.GetPeerAddress()));
+                      }
                       auto settings_status =
                           config.ReceiveClientIncomingSettings(frame.body);
                       if (!settings_status.ok()) return settings_status;
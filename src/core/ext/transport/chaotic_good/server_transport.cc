@@ -275,7 +275,9 @@ ChaoticGoodServerTransport::StreamDispatch::StreamDispatch(
               ->CreateMemoryAllocator("chaotic-good"),
           1024)),
       call_destination_(std::move(call_destination)),
-      message_chunker_(message_chunker) {
+      message_chunker_(message_chunker),
+      max_recv_message_size_(
+          MessageReassembly::MaxRecvMessageSizeFromChannelArgs(args)) {
   CHECK(ctx_ != nullptr);
   auto party_arena = SimpleArenaAllocator(0)->MakeArena();
   party_arena->SetContext<grpc_event_engine::experimental::EventEngine>(
@@ -381,7 +383,8 @@ absl::Status ChaoticGoodServerTransport::StreamDispatch::AddStream(
     return absl::CancelledError();
   }
   stream_map_.emplace(stream_id,
-                      MakeRefCounted<Stream>(std::move(call_initiator)));
+                      MakeRefCounted<Stream>(std::move(call_initiator),
+                                             max_recv_message_size_));
   return absl::OkStatus();
 }
 
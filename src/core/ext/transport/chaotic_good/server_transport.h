@@ -101,7 +101,8 @@ class ChaoticGoodServerTransport final : public ServerTransport {
 
  private:
   struct Stream : public RefCounted<Stream> {
-    explicit Stream(CallInitiator call) : call(std::move(call)) {}
+    Stream(CallInitiator call, std::optional<uint32_t> max_recv_message_size)
+        : call(std::move(call)), message_reassembly(max_recv_message_size) {}
     CallInitiator call;
     MessageReassembly message_reassembly;
     Party::SpawnSerializer* spawn_serializer =
@@ -158,6 +159,7 @@ class ChaoticGoodServerTransport final : public ServerTransport {
     const RefCountedPtr<UnstartedCallDestination> call_destination_;
     Party::SpawnSerializer* incoming_frame_spawner_;
     MessageChunker message_chunker_;
+    const std::optional<uint32_t> max_recv_message_size_;
     MpscSender<OutgoingFrame> outgoing_frames_;
     RefCountedPtr<Party> party_;
   };
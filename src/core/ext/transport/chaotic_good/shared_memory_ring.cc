@@ -0,0 +1,333 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chaotic_good/shared_memory_ring.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <atomic>
+#include <cstring>
+#include <limits>
+
+#include "absl/random/random.h"
+#include "absl/status/status.h"
+#include "absl/strings/match.h"
+#include "absl/strings/str_cat.h"
+#include "src/core/ext/transport/chaotic_good/serialize_little_endian.h"
+#include "src/core/lib/event_engine/tcp_socket_utils.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/util/strerror.h"
+
+#if GPR_LINUX
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif  // GPR_LINUX
+
+namespace grpc_core {
+namespace chaotic_good {
+
+using grpc_event_engine::experimental::EventEngine;
+
+namespace {
+
+constexpr absl::string_view kNamePrefix = "/grpc-chaotic-good-";
+constexpr uint64_t kRingMagic = 0x6772706373686d31;  // "grpcshm1"
+// The ring header holds the magic number and ring size. Chunks start after
+// it, and each chunk starts with a header holding its state and payload
+// length. Both are padded out to kChunkAlignment so that payloads stay
+// cache line aligned.
+constexpr size_t kChunkAlignment = 64;
+constexpr size_t kRingHeaderSize = kChunkAlignment;
+constexpr size_t kChunkHeaderSize = kChunkAlignment;
+// Chunk states, stored in the first four bytes of every chunk header.
+// A freshly truncated region reads as all zeros, so every chunk starts free.
+constexpr uint32_t kChunkFree = 0;
+constexpr uint32_t kChunkWritten = 1;
+
+uint64_t RoundUpToChunkAlignment(uint64_t n) {
+  return (n + kChunkAlignment - 1) & ~uint64_t{kChunkAlignment - 1};
+}
+
+std::atomic<uint32_t>* ChunkState(uint8_t* chunk) {
+  static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t));
+  return reinterpret_cast<std::atomic<uint32_t>*>(chunk);
+}
+
+EventEngine::ResolvedAddress NormalizeAddress(
+    const EventEngine::ResolvedAddress& address) {
+  EventEngine::ResolvedAddress normalized;
+  if (grpc_event_engine::experimental::ResolvedAddressIsV4Mapped(
+          address, &normalized)) {
+    return normalized;
+  }
+  return address;
+}
+
+}  // namespace
+
+#if GPR_LINUX
+
+bool IsLoopbackAddress(const EventEngine::ResolvedAddress& address) {
+  const EventEngine::ResolvedAddress normalized = NormalizeAddress(address);
+  switch (normalized.address()->sa_family) {
+    case AF_INET: {
+      const auto* addr4 =
+          reinterpret_cast<const sockaddr_in*>(normalized.address());
+      return (ntohl(addr4->sin_addr.s_addr) >> 24) == 127;
+    }
+    case AF_INET6: {
+      const auto* addr6 =
+          reinterpret_cast<const sockaddr_in6*>(normalized.address());
+      return IN6_IS_ADDR_LOOPBACK(&addr6->sin6_addr);
+    }
+    case AF_UNIX:
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool IsSameHostPeer(const EventEngine::ResolvedAddress& local_address,
+                    const EventEngine::ResolvedAddress& peer_address) {
+  if (IsLoopbackAddress(peer_address)) return true;
+  const EventEngine::ResolvedAddress local = NormalizeAddress(local_address);
+  const EventEngine::ResolvedAddress peer = NormalizeAddress(peer_address);
+  if (local.address()->sa_family != peer.address()->sa_family) return false;
+  switch (peer.address()->sa_family) {
+    case AF_INET:
+      return reinterpret_cast<const sockaddr_in*>(local.address())
+                 ->sin_addr.s_addr ==
+             reinterpret_cast<const sockaddr_in*>(peer.address())
+                 ->sin_addr.s_addr;
+    case AF_INET6:
+      return memcmp(&reinterpret_cast<const sockaddr_in6*>(local.address())
+                         ->sin6_addr,
+                    &reinterpret_cast<const sockaddr_in6*>(peer.address())
+                         ->sin6_addr,
+                    sizeof(in6_addr)) == 0;
+    default:
+      return false;
+  }
+}
+
+absl::StatusOr<std::shared_ptr<SharedMemoryRing>> SharedMemoryRing::Create(
+    size_t size) {
+  size &= ~(kChunkAlignment - 1);
+  if (size < kChunkAlignment) {
+    return absl::InvalidArgumentError(
+        absl::StrCat("Shared memory ring too small: ", size, " bytes"));
+  }
+  absl::BitGen bitgen;
+  const std::string name = absl::StrCat(
+      kNamePrefix, absl::Hex(absl::Uniform<uint64_t>(bitgen), absl::kZeroPad16),
+      absl::Hex(absl::Uniform<uint64_t>(bitgen), absl::kZeroPad16));
+  const int fd =
+      shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0600);
+  if (fd < 0) {
+    return absl::InternalError(
+        absl::StrCat("shm_open(", name, "): ", StrError(errno)));
+  }
+  const size_t mapped_size = kRingHeaderSize + size;
+  if (ftruncate(fd, mapped_size) != 0) {
+    const int err = errno;
+    close(fd);
+    shm_unlink(name.c_str());
+    return absl::InternalError(
+        absl::StrCat("ftruncate(", name, "): ", StrError(err)));
+  }
+  void* base =
+      mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  const int err = errno;
+  close(fd);
+  if (base == MAP_FAILED) {
+    shm_unlink(name.c_str());
+    return absl::InternalError(
+        absl::StrCat("mmap(", name, "): ", StrError(err)));
+  }
+  uint8_t* header = static_cast<uint8_t*>(base);
+  WriteLittleEndianUint64(size, header + 8);
+  WriteLittleEndianUint64(kRingMagic, header);
+  return std::shared_ptr<SharedMemoryRing>(
+      new SharedMemoryRing(name, header, size, /*owner=*/true));
+}
+
+absl::StatusOr<std::shared_ptr<SharedMemoryRing>> SharedMemoryRing::Open(
+    absl::string_view name) {
+  // Only ever open rings following our own naming scheme, so that a peer
+  // cannot point us at an unrelated shared memory object.
+  if (!absl::StartsWith(name, kNamePrefix) ||
+      name.find('/', 1) != absl::string_view::npos) {
+    return absl::InvalidArgumentError(
+        absl::StrCat("Invalid shared memory ring name: ", name));
+  }
+  const std::string name_str(name);
+  const int fd = shm_open(name_str.c_str(), O_RDWR | O_CLOEXEC, 0);
+  if (fd < 0) {
+    return absl::InternalError(
+        absl::StrCat("shm_open(", name, "): ", StrError(errno)));
+  }
+  shm_unlink(name_str.c_str());
+  struct stat st;
+  if (fstat(fd, &st) != 0) {
+    const int err = errno;
+    close(fd);
+    return absl::InternalError(
+        absl::StrCat("fstat(", name, "): ", StrError(err)));
+  }
+  const size_t mapped_size = st.st_size;
+  if (mapped_size < kRingHeaderSize + kChunkAlignment) {
+    close(fd);
+    return absl::InternalError(
+        absl::StrCat("Shared memory ring ", name, " too small"));
+  }
+  void* base =
+      mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  const int err = errno;
+  close(fd);
+  if (base == MAP_FAILED) {
+    return absl::InternalError(
+        absl::StrCat("mmap(", name, "): ", StrError(err)));
+  }
+  uint8_t* header = static_cast<uint8_t*>(base);
+  const uint64_t size = ReadLittleEndianUint64(header + 8);
+  if (ReadLittleEndianUint64(header) != kRingMagic ||
+      size != mapped_size - kRingHeaderSize) {
+    munmap(base, mapped_size);
+    return absl::InternalError(
+        absl::StrCat("Corrupt shared memory ring header in ", name));
+  }
+  return std::shared_ptr<SharedMemoryRing>(
+      new SharedMemoryRing(name_str, header, size, /*owner=*/false));
+}
+
+SharedMemoryRing::~SharedMemoryRing() {
+  munmap(base_, kRingHeaderSize + size_);
+  // Normally our peer removed the name when it opened the ring; this catches
+  // rings that were never opened.
+  if (owner_) shm_unlink(name_.c_str());
+}
+
+#else  // GPR_LINUX
+
+bool IsLoopbackAddress(const EventEngine::ResolvedAddress&) { return false; }
+
+bool IsSameHostPeer(const EventEngine::ResolvedAddress&,
+                    const EventEngine::ResolvedAddress&) {
+  return false;
+}
+
+absl::StatusOr<std::shared_ptr<SharedMemoryRing>> SharedMemoryRing::Create(
+    size_t) {
+  return absl::UnimplementedError(
+      "Shared memory rings are only supported on Linux");
+}
+
+absl::StatusOr<std::shared_ptr<SharedMemoryRing>> SharedMemoryRing::Open(
+    absl::string_view) {
+  return absl::UnimplementedError(
+      "Shared memory rings are only supported on Linux");
+}
+
+SharedMemoryRing::~SharedMemoryRing() = default;
+
+#endif  // GPR_LINUX
+
+absl::StatusOr<SharedMemoryRing::Chunk> SharedMemoryRing::Chunk::Parse(
+    const uint8_t* data) {
+  Chunk chunk;
+  chunk.offset = ReadLittleEndianUint64(data);
+  chunk.length = ReadLittleEndianUint32(data + 8);
+  if (ReadLittleEndianUint32(data + 12) != 0) {
+    return absl::InternalError("Non-zero reserved bits in shared memory chunk");
+  }
+  return chunk;
+}
+
+void SharedMemoryRing::Chunk::Serialize(uint8_t* data) const {
+  WriteLittleEndianUint64(offset, data);
+  WriteLittleEndianUint32(length, data + 8);
+  WriteLittleEndianUint32(0, data + 12);
+}
+
+void SharedMemoryRing::ReclaimLocked() {
+  uint8_t* const chunks = base_ + kRingHeaderSize;
+  while (!in_flight_.empty()) {
+    const InFlightChunk& chunk = in_flight_.front();
+    if (!chunk.padding &&
+        ChunkState(chunks + chunk.offset)->load(std::memory_order_acquire) !=
+            kChunkFree) {
+      break;
+    }
+    tail_ += chunk.span;
+    in_flight_.pop_front();
+  }
+}
+
+std::optional<SharedMemoryRing::Chunk> SharedMemoryRing::Write(
+    SliceBuffer& payload) {
+  const size_t length = payload.Length();
+  if (length > std::numeric_limits<uint32_t>::max()) return std::nullopt;
+  const uint64_t span = RoundUpToChunkAlignment(kChunkHeaderSize + length);
+  if (span > size_) return std::nullopt;
+  MutexLock lock(&mu_);
+  ReclaimLocked();
+  uint64_t offset = head_ % size_;
+  // Chunks are contiguous: if this one would run past the end of the ring,
+  // skip the remaining space and start again at the beginning.
+  const uint64_t padding = offset + span > size_ ? size_ - offset : 0;
+  if (head_ + padding + span - tail_ > size_) return std::nullopt;
+  if (padding != 0) {
+    in_flight_.push_back(InFlightChunk{offset, padding, true});
+    head_ += padding;
+    offset = 0;
+  }
+  uint8_t* const chunk = base_ + kRingHeaderSize + offset;
+  WriteLittleEndianUint32(static_cast<uint32_t>(length), chunk + 4);
+  payload.CopyToBuffer(chunk + kChunkHeaderSize);
+  ChunkState(chunk)->store(kChunkWritten, std::memory_order_release);
+  in_flight_.push_back(InFlightChunk{offset, span, false});
+  head_ += span;
+  return Chunk{offset, static_cast<uint32_t>(length)};
+}
+
+absl::StatusOr<SliceBuffer> SharedMemoryRing::Read(Chunk chunk) {
+  // The chunk descriptor comes from our peer: check it against the ring
+  // before touching memory.
+  if (chunk.offset % kChunkAlignment != 0 || chunk.offset >= size_ ||
+      kChunkHeaderSize + chunk.length > size_ - chunk.offset) {
+    return absl::InternalError(absl::StrCat(
+        "Shared memory chunk out of range: offset=", chunk.offset,
+        " length=", chunk.length, " ring_size=", size_));
+  }
+  uint8_t* const data = base_ + kRingHeaderSize + chunk.offset;
+  if (ChunkState(data)->load(std::memory_order_acquire) != kChunkWritten ||
+      ReadLittleEndianUint32(data + 4) != chunk.length) {
+    return absl::InternalError(absl::StrCat(
+        "Shared memory chunk at offset ", chunk.offset, " not written"));
+  }
+  MutableSlice slice = MutableSlice::CreateUninitialized(chunk.length);
+  memcpy(slice.data(), data + kChunkHeaderSize, chunk.length);
+  ChunkState(data)->store(kChunkFree, std::memory_order_release);
+  SliceBuffer buffer;
+  buffer.Append(Slice(std::move(slice)));
+  return buffer;
+}
+
+}  // namespace chaotic_good
+}  // namespace grpc_core
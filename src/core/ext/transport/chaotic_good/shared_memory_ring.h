@@ -0,0 +1,122 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_SHARED_MEMORY_RING_H
+#define GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_SHARED_MEMORY_RING_H
+
+#include <grpc/event_engine/event_engine.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+#include "src/core/lib/slice/slice_buffer.h"
+#include "src/core/util/sync.h"
+
+namespace grpc_core {
+namespace chaotic_good {
+
+// Returns true if a peer at peer_address is on the same host as a local
+// endpoint at local_address: either the peer is a loopback address, or both
+// ends of the connection share an IP address.
+bool IsSameHostPeer(
+    const grpc_event_engine::experimental::EventEngine::ResolvedAddress&
+        local_address,
+    const grpc_event_engine::experimental::EventEngine::ResolvedAddress&
+        peer_address);
+bool IsLoopbackAddress(
+    const grpc_event_engine::experimental::EventEngine::ResolvedAddress&
+        address);
+
+// A region of POSIX shared memory that carries payloads in one direction
+// between two chaotic-good peers on the same host.
+// The writer creates the ring and advertises its name in its settings frame;
+// the reader opens it by that name. Payloads are copied into chunks of the
+// ring, and a small descriptor naming the chunk travels over a data endpoint
+// in place of the payload. The reader copies the payload back out and marks
+// the chunk free, after which the writer may reuse its space.
+class SharedMemoryRing {
+ public:
+  // Location of one payload within the ring.
+  struct Chunk {
+    enum { kWireSize = 16 };
+
+    uint64_t offset;
+    uint32_t length;
+
+    static absl::StatusOr<Chunk> Parse(const uint8_t* data);
+    void Serialize(uint8_t* data) const;
+  };
+
+  // Create a new ring able to hold size bytes of chunks, with a random name.
+  static absl::StatusOr<std::shared_ptr<SharedMemoryRing>> Create(size_t size);
+  // Open a ring that our peer created. The name is removed from the system
+  // once the ring is mapped, so no other process can open it.
+  static absl::StatusOr<std::shared_ptr<SharedMemoryRing>> Open(
+      absl::string_view name);
+
+  SharedMemoryRing(const SharedMemoryRing&) = delete;
+  SharedMemoryRing& operator=(const SharedMemoryRing&) = delete;
+  ~SharedMemoryRing();
+
+  const std::string& name() const { return name_; }
+  size_t size() const { return size_; }
+
+  // Writer: copy payload into a free chunk.
+  // Returns std::nullopt (and leaves payload untouched) if the ring does not
+  // currently have room for it.
+  std::optional<Chunk> Write(SliceBuffer& payload);
+  // Reader: copy a chunk written by our peer out of the ring and release its
+  // space back to the writer.
+  absl::StatusOr<SliceBuffer> Read(Chunk chunk);
+
+ private:
+  struct InFlightChunk {
+    uint64_t offset;
+    uint64_t span;
+    // Wasted space at the end of the ring: there is no chunk header to wait
+    // on.
+    bool padding;
+  };
+
+  SharedMemoryRing(std::string name, uint8_t* base, size_t size, bool owner)
+      : name_(std::move(name)), base_(base), size_(size), owner_(owner) {}
+
+  // Reclaim chunks that the reader has released, in the order they were
+  // written.
+  void ReclaimLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  const std::string name_;
+  uint8_t* const base_;
+  // Bytes available for chunks (excluding the ring header).
+  const size_t size_;
+  const bool owner_;
+  Mutex mu_;
+  // Writer state is kept in process local memory, so that a misbehaving peer
+  // cannot corrupt it.
+  uint64_t head_ ABSL_GUARDED_BY(mu_) = 0;
+  uint64_t tail_ ABSL_GUARDED_BY(mu_) = 0;
+  std::deque<InFlightChunk> in_flight_ ABSL_GUARDED_BY(mu_);
+};
+
+}  // namespace chaotic_good
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_SHARED_MEMORY_RING_H
@@ -55,7 +55,10 @@ TcpFrameTransport::TcpFrameTransport(
       control_endpoint_(std::move(control_endpoint), ctx, ztrace_collector_),
       data_endpoints_(std::move(pending_data_endpoints), ctx,
                       options.encode_alignment, options.decode_alignment,
-                      ztrace_collector_, options.enable_tracing),
+                      ztrace_collector_, options.enable_tracing,
+                      DataEndpoints::DefaultClock(),
+                      options.shared_memory_send_ring,
+                      options.shared_memory_recv_ring),
       options_(options) {
   auto* transport_framing_endpoint_extension =
       GetTransportFramingEndpointExtension(
@@ -15,12 +15,14 @@
 #ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_TCP_FRAME_TRANSPORT_H
 #define GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_TCP_FRAME_TRANSPORT_H
 
+#include <memory>
 #include <vector>
 
 #include "src/core/ext/transport/chaotic_good/control_endpoint.h"
 #include "src/core/ext/transport/chaotic_good/data_endpoints.h"
 #include "src/core/ext/transport/chaotic_good/frame_transport.h"
 #include "src/core/ext/transport/chaotic_good/pending_connection.h"
+#include "src/core/ext/transport/chaotic_good/shared_memory_ring.h"
 #include "src/core/ext/transport/chaotic_good/tcp_frame_header.h"
 #include "src/core/ext/transport/chaotic_good/tcp_ztrace_collector.h"
 #include "src/core/ext/transport/chaotic_good/transport_context.h"
@@ -43,6 +45,10 @@ class TcpFrameTransport final : public FrameTransport,
     uint32_t decode_alignment = 64;
     uint32_t inlined_payload_size_threshold = 8 * 1024;
     bool enable_tracing = false;
+    // Shared memory rings carrying payloads to and from a peer on the same
+    // host, if negotiated. When unset, payloads go over the data endpoints.
+    std::shared_ptr<SharedMemoryRing> shared_memory_send_ring;
+    std::shared_ptr<SharedMemoryRing> shared_memory_recv_ring;
   };
 
   TcpFrameTransport(Options options, PromiseEndpoint control_endpoint,
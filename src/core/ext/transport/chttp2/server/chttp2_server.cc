@@ -139,6 +139,7 @@ NewChttp2ServerListener::ActiveConnection::HandshakingState::HandshakingState(
       accepting_pollset_(accepting_pollset),
       acceptor_(std::move(acceptor)),
       interested_parties_(grpc_pollset_set_create()),
+      start_time_(Timestamp::Now()),
       deadline_(GetConnectionDeadline(args)),
       endpoint_(std::move(endpoint)),
       handshake_mgr_(MakeRefCounted<HandshakeManager>()) {
@@ -149,6 +150,7 @@ NewChttp2ServerListener::ActiveConnection::HandshakingState::HandshakingState(
 
 NewChttp2ServerListener::ActiveConnection::HandshakingState::
     ~HandshakingState() {
+  ReleaseHandshakeQuota(std::nullopt);
   if (accepting_pollset_ != nullptr) {
     grpc_pollset_set_del_pollset(interested_parties_, accepting_pollset_);
   }
@@ -221,8 +223,17 @@ void NewChttp2ServerListener::ActiveConnection::HandshakingState::
       DEBUG_LOCATION);
 }
 
+void NewChttp2ServerListener::ActiveConnection::HandshakingState::
+    ReleaseHandshakeQuota(std::optional<Duration> duration) {
+  if (std::exchange(handshake_quota_released_, true)) return;
+  connection_->listener_state_->connection_quota()->HandshakeDone(duration);
+}
+
 void NewChttp2ServerListener::ActiveConnection::HandshakingState::
     OnHandshakeDoneLocked(absl::StatusOr<HandshakerArgs*> result) {
+  // Failed and timed out handshakes count too: under overload, they are the
+  // slowest of all.
+  ReleaseHandshakeQuota(Timestamp::Now() - start_time_);
   OrphanablePtr<HandshakingState> handshaking_state_ref;
   RefCountedPtr<HandshakeManager> handshake_mgr;
   // If the handshaking succeeded but there is no endpoint, then the
@@ -565,6 +576,7 @@ void NewChttp2ServerListener::OnAccept(
     // since the acceptor needs it.
     MutexLock lock(&self->mu_);
     if (self->shutdown_) {
+      self->listener_state_->connection_quota()->HandshakeDone(std::nullopt);
       self->listener_state_->connection_quota()->ReleaseConnections(1);
       return;
     }
@@ -85,14 +85,19 @@ class NewChttp2ServerListener : public Server::ListenerInterface {
       void OnTimeoutLocked();
       static void OnReceiveSettings(void* arg, grpc_error_handle /* error */);
       void OnHandshakeDoneLocked(absl::StatusOr<HandshakerArgs*> result);
+      // Tells the connection quota that the handshake is over, if it has
+      // not been told already.
+      void ReleaseHandshakeQuota(std::optional<Duration> duration);
 
       RefCountedPtr<ActiveConnection> const connection_;
       grpc_tcp_server* const tcp_server_;
       grpc_pollset* const accepting_pollset_;
       const AcceptorPtr acceptor_;
       grpc_pollset_set* const interested_parties_;
+      Timestamp const start_time_;
       Timestamp const deadline_;
       OrphanablePtr<grpc_endpoint> endpoint_;
+      bool handshake_quota_released_ = false;
       // Following fields are protected by WorkSerializer.
       RefCountedPtr<HandshakeManager> handshake_mgr_;
       // State for enforcing handshake timeout on receiving HTTP/2 settings.
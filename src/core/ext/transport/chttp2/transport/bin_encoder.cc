@@ -32,7 +32,7 @@ struct b64_huff_sym {
   uint16_t bits;
   uint8_t length;
 };
-static const b64_huff_sym huff_alphabet[64] = {
+static constexpr b64_huff_sym huff_alphabet[64] = {
     {0x21, 6}, {0x5d, 7}, {0x5e, 7},   {0x5f, 7}, {0x60, 7}, {0x61, 7},
     {0x62, 7}, {0x63, 7}, {0x64, 7},   {0x65, 7}, {0x66, 7}, {0x67, 7},
     {0x68, 7}, {0x69, 7}, {0x6a, 7},   {0x6b, 7}, {0x6c, 7}, {0x6d, 7},
@@ -91,79 +91,106 @@ grpc_slice grpc_chttp2_base64_encode(const grpc_slice& input) {
   return output;
 }
 
-grpc_slice grpc_chttp2_huffman_compress(const grpc_slice& input) {
-  size_t nbits;
-  const uint8_t* in;
-  uint8_t* out;
-  grpc_slice output;
-  uint64_t temp = 0;
-  uint32_t temp_length = 0;
-
-  nbits = 0;
-  for (in = GRPC_SLICE_START_PTR(input); in != GRPC_SLICE_END_PTR(input);
-       ++in) {
-    nbits += grpc_chttp2_huffsyms[*in].length;
+namespace {
+// Appends codes to a 64 bit accumulator and writes it out 32 bits at a time
+// instead of a byte at a time. Codes added at once are at most 30 bits long,
+// so the accumulator never holds more than 31 + 30 bits.
+class HuffmanBitWriter {
+ public:
+  explicit HuffmanBitWriter(uint8_t* out) : out_(out) {}
+
+  GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION void Add(uint32_t bits,
+                                                uint32_t length) {
+    temp_ = (temp_ << length) | bits;
+    temp_length_ += length;
+    if (temp_length_ >= 32) {
+      temp_length_ -= 32;
+      const uint32_t word = static_cast<uint32_t>(temp_ >> temp_length_);
+      out_[0] = static_cast<uint8_t>(word >> 24);
+      out_[1] = static_cast<uint8_t>(word >> 16);
+      out_[2] = static_cast<uint8_t>(word >> 8);
+      out_[3] = static_cast<uint8_t>(word);
+      out_ += 4;
+    }
   }
 
-  output = GRPC_SLICE_MALLOC(nbits / 8 + (nbits % 8 != 0));
-  out = GRPC_SLICE_START_PTR(output);
-  for (in = GRPC_SLICE_START_PTR(input); in != GRPC_SLICE_END_PTR(input);
-       ++in) {
-    int sym = *in;
-    temp <<= grpc_chttp2_huffsyms[sym].length;
-    temp |= grpc_chttp2_huffsyms[sym].bits;
-    temp_length += grpc_chttp2_huffsyms[sym].length;
-
-    while (temp_length > 8) {
-      temp_length -= 8;
-      *out++ = static_cast<uint8_t>(temp >> temp_length);
+  // Writes out the remaining bits, padding the last byte with the most
+  // significant bits of EOS (all ones). Returns the end of the output.
+  uint8_t* Finish() {
+    while (temp_length_ >= 8) {
+      temp_length_ -= 8;
+      *out_++ = static_cast<uint8_t>(temp_ >> temp_length_);
+    }
+    if (temp_length_ != 0) {
+      // NB: the following integer arithmetic operation needs to be in its
+      // expanded form due to the "integral promotion" performed (see section
+      // 3.2.1.1 of the C89 draft standard). A cast to the smaller container
+      // type is then required to avoid the compiler warning
+      *out_++ = static_cast<uint8_t>(
+          static_cast<uint8_t>(temp_ << (8u - temp_length_)) |
+          static_cast<uint8_t>(0xffu >> temp_length_));
     }
+    return out_;
   }
 
-  if (temp_length) {
-    // NB: the following integer arithmetic operation needs to be in its
-    // expanded form due to the "integral promotion" performed (see section
-    // 3.2.1.1 of the C89 draft standard). A cast to the smaller container type
-    // is then required to avoid the compiler warning
-    *out++ =
-        static_cast<uint8_t>(static_cast<uint8_t>(temp << (8u - temp_length)) |
-                             static_cast<uint8_t>(0xffu >> temp_length));
-  }
+ private:
+  uint8_t* out_;
+  uint64_t temp_ = 0;
+  uint32_t temp_length_ = 0;
+};
 
-  CHECK(out == GRPC_SLICE_END_PTR(output));
+// Huffman codes for every pair of base64 symbols, indexed by the 12 input
+// bits the pair encodes, so that each input triplet takes two lookups.  Each
+// entry holds the code in its top 27 bits and the code length in the rest.
+struct HuffPairTable {
+  uint32_t codes[4096]{};
+  constexpr HuffPairTable() {
+    for (uint32_t i = 0; i < 4096; i++) {
+      const b64_huff_sym a = huff_alphabet[i >> 6];
+      const b64_huff_sym b = huff_alphabet[i & 0x3f];
+      const uint32_t bits =
+          (static_cast<uint32_t>(a.bits) << b.length) | b.bits;
+      codes[i] = (bits << 5) | (a.length + b.length);
+    }
+  }
+};
 
-  return output;
-}
+constexpr HuffPairTable kHuffPairTable;
 
-struct huff_out {
-  uint32_t temp;
-  uint32_t temp_length;
-  uint8_t* out;
-};
-static void enc_flush_some(huff_out* out) {
-  while (out->temp_length > 8) {
-    out->temp_length -= 8;
-    *out->out++ = static_cast<uint8_t>(out->temp >> out->temp_length);
-  }
+// Base64 symbols are at most 11 bits long, so two of them are always added to
+// the bit writer as a single code.  pair holds the two 6 bit symbols, first
+// symbol in the high bits.
+GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION inline void enc_add2(HuffmanBitWriter* out,
+                                                          uint32_t pair) {
+  const uint32_t code = kHuffPairTable.codes[pair];
+  out->Add(code >> 5, code & 0x1f);
 }
 
-static void enc_add2(huff_out* out, uint8_t a, uint8_t b, uint32_t* wire_size) {
-  *wire_size += 2;
+GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION inline void enc_add1(
+    HuffmanBitWriter* out, uint8_t a) {
   b64_huff_sym sa = huff_alphabet[a];
-  b64_huff_sym sb = huff_alphabet[b];
-  out->temp = (out->temp << (sa.length + sb.length)) |
-              (static_cast<uint32_t>(sa.bits) << sb.length) | sb.bits;
-  out->temp_length +=
-      static_cast<uint32_t>(sa.length) + static_cast<uint32_t>(sb.length);
-  enc_flush_some(out);
+  out->Add(sa.bits, sa.length);
 }
+}  // namespace
 
-static void enc_add1(huff_out* out, uint8_t a, uint32_t* wire_size) {
-  *wire_size += 1;
-  b64_huff_sym sa = huff_alphabet[a];
-  out->temp = (out->temp << sa.length) | sa.bits;
-  out->temp_length += sa.length;
-  enc_flush_some(out);
+grpc_slice grpc_chttp2_huffman_compress(const grpc_slice& input) {
+  const uint8_t* const begin = GRPC_SLICE_START_PTR(input);
+  const uint8_t* const end = GRPC_SLICE_END_PTR(input);
+  size_t nbits = 0;
+  for (const uint8_t* in = begin; in != end; ++in) {
+    nbits += grpc_chttp2_huffsyms[*in].length;
+  }
+
+  grpc_slice output = GRPC_SLICE_MALLOC(nbits / 8 + (nbits % 8 != 0));
+  HuffmanBitWriter out(GRPC_SLICE_START_PTR(output));
+  for (const uint8_t* in = begin; in != end; ++in) {
+    const grpc_chttp2_huffsym& sym = grpc_chttp2_huffsyms[*in];
+    out.Add(sym.bits, sym.length);
+  }
+
+  CHECK(out.Finish() == GRPC_SLICE_END_PTR(output));
+
+  return output;
 }
 
 grpc_slice grpc_chttp2_base64_encode_and_huffman_compress(
@@ -177,23 +204,17 @@ grpc_slice grpc_chttp2_base64_encode_and_huffman_compress(
   grpc_slice output = GRPC_SLICE_MALLOC(max_output_length);
   const uint8_t* in = GRPC_SLICE_START_PTR(input);
   uint8_t* start_out = GRPC_SLICE_START_PTR(output);
-  huff_out out;
+  HuffmanBitWriter out(start_out);
   size_t i;
 
-  out.temp = 0;
-  out.temp_length = 0;
-  out.out = start_out;
-  *wire_size = 0;
+  *wire_size = static_cast<uint32_t>(output_syms);
 
   // encode full triplets
   for (i = 0; i < input_triplets; i++) {
-    const uint8_t low_to_high = static_cast<uint8_t>((in[0] & 0x3) << 4);
-    const uint8_t high_to_low = in[1] >> 4;
-    enc_add2(&out, in[0] >> 2, low_to_high | high_to_low, wire_size);
-
-    const uint8_t a = static_cast<uint8_t>((in[1] & 0xf) << 2);
-    const uint8_t b = (in[2] >> 6);
-    enc_add2(&out, a | b, in[2] & 0x3f, wire_size);
+    const uint32_t triplet = (static_cast<uint32_t>(in[0]) << 16) |
+                             (static_cast<uint32_t>(in[1]) << 8) | in[2];
+    enc_add2(&out, triplet >> 12);
+    enc_add2(&out, triplet & 0xfff);
     in += 3;
   }
 
@@ -202,32 +223,20 @@ grpc_slice grpc_chttp2_base64_encode_and_huffman_compress(
     case 0:
       break;
     case 1:
-      enc_add2(&out, in[0] >> 2, static_cast<uint8_t>((in[0] & 0x3) << 4),
-               wire_size);
+      enc_add2(&out, static_cast<uint32_t>(in[0]) << 4);
       in += 1;
       break;
     case 2: {
-      const uint8_t low_to_high = static_cast<uint8_t>((in[0] & 0x3) << 4);
-      const uint8_t high_to_low = in[1] >> 4;
-      enc_add2(&out, in[0] >> 2, low_to_high | high_to_low, wire_size);
-      enc_add1(&out, static_cast<uint8_t>((in[1] & 0xf) << 2), wire_size);
+      enc_add2(&out, (static_cast<uint32_t>(in[0]) << 4) | (in[1] >> 4));
+      enc_add1(&out, static_cast<uint8_t>((in[1] & 0xf) << 2));
       in += 2;
       break;
     }
   }
 
-  if (out.temp_length) {
-    // NB: the following integer arithmetic operation needs to be in its
-    // expanded form due to the "integral promotion" performed (see section
-    // 3.2.1.1 of the C89 draft standard). A cast to the smaller container type
-    // is then required to avoid the compiler warning
-    *out.out++ = static_cast<uint8_t>(
-        static_cast<uint8_t>(out.temp << (8u - out.temp_length)) |
-        static_cast<uint8_t>(0xffu >> out.temp_length));
-  }
-
-  CHECK(out.out <= GRPC_SLICE_END_PTR(output));
-  GRPC_SLICE_SET_LENGTH(output, out.out - start_out);
+  uint8_t* end_out = out.Finish();
+  CHECK(end_out <= GRPC_SLICE_END_PTR(output));
+  GRPC_SLICE_SET_LENGTH(output, end_out - start_out);
 
   CHECK(in == GRPC_SLICE_END_PTR(input));
   return output;
@@ -31,6 +31,7 @@
 
 #include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <limits>
@@ -52,6 +53,7 @@
 #include "absl/random/random.h"
 #include "absl/status/status.h"
 #include "absl/strings/cord.h"
+#include "absl/strings/numbers.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_format.h"
 #include "absl/strings/string_view.h"
@@ -77,6 +79,7 @@
 #include "src/core/ext/transport/chttp2/transport/write_size_policy.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/event_engine/extensions/channelz.h"
+#include "src/core/lib/event_engine/extensions/tcp_info.h"
 #include "src/core/lib/event_engine/extensions/tcp_trace.h"
 #include "src/core/lib/event_engine/query_extensions.h"
 #include "src/core/lib/experiments/experiments.h"
@@ -104,6 +107,7 @@
 #include "src/core/telemetry/call_tracer.h"
 #include "src/core/telemetry/context_list_entry.h"
 #include "src/core/telemetry/default_tcp_tracer.h"
+#include "src/core/telemetry/metrics.h"
 #include "src/core/telemetry/stats.h"
 #include "src/core/telemetry/stats_data.h"
 #include "src/core/util/bitset.h"
@@ -178,11 +182,15 @@ static void connectivity_state_set(grpc_chttp2_transport* t,
 
 static void benign_reclaimer_locked(
     grpc_core::RefCountedPtr<grpc_chttp2_transport>, grpc_error_handle error);
+static void idle_reclaimer_locked(
+    grpc_core::RefCountedPtr<grpc_chttp2_transport>, grpc_error_handle error);
 static void destructive_reclaimer_locked(
     grpc_core::RefCountedPtr<grpc_chttp2_transport>, grpc_error_handle error);
 
 static void post_benign_reclaimer(grpc_chttp2_transport* t);
+static void post_idle_reclaimer(grpc_chttp2_transport* t);
 static void post_destructive_reclaimer(grpc_chttp2_transport* t);
+static void restore_header_table_size(grpc_chttp2_transport* t);
 
 static void close_transport_locked(grpc_chttp2_transport* t,
                                    grpc_error_handle error);
@@ -198,6 +206,13 @@ static void start_bdp_ping_locked(
 static void finish_bdp_ping_locked(
     grpc_core::RefCountedPtr<grpc_chttp2_transport>, grpc_error_handle error);
 static void next_bdp_ping_timer_expired(grpc_chttp2_transport* t);
+static void write_buffer_flush_locked(
+    grpc_core::RefCountedPtr<grpc_chttp2_transport> t,
+    GRPC_UNUSED grpc_error_handle error);
+static void schedule_tcp_info_sample(grpc_chttp2_transport* t);
+static void tcp_info_sample_locked(
+    grpc_core::RefCountedPtr<grpc_chttp2_transport> t,
+    GRPC_UNUSED grpc_error_handle error);
 static void next_bdp_ping_timer_expired_locked(
     grpc_core::RefCountedPtr<grpc_chttp2_transport> tp,
     GRPC_UNUSED grpc_error_handle error);
@@ -235,6 +250,47 @@ using grpc_core::http2::Http2ErrorCode;
 
 grpc_core::WriteTimestampsCallback g_write_timestamps_callback = nullptr;
 grpc_core::CopyContextFn g_get_copied_context_fn = nullptr;
+
+const auto kMetricTcpRtt =
+    grpc_core::GlobalInstrumentsRegistry::RegisterDoubleHistogram(
+        "grpc.tcp.rtt",
+        "EXPERIMENTAL.  Smoothed round trip time of TCP connections, as "
+        "reported by the kernel.",
+        "s", false)
+        .Build();
+const auto kMetricTcpMinRtt =
+    grpc_core::GlobalInstrumentsRegistry::RegisterDoubleHistogram(
+        "grpc.tcp.min_rtt",
+        "EXPERIMENTAL.  Minimum round trip time of TCP connections, as "
+        "reported by the kernel.",
+        "s", false)
+        .Build();
+const auto kMetricTcpDeliveryRate =
+    grpc_core::GlobalInstrumentsRegistry::RegisterUInt64Histogram(
+        "grpc.tcp.delivery_rate",
+        "EXPERIMENTAL.  Most recent rate at which TCP connections delivered "
+        "data to their peer.",
+        "By/s", false)
+        .Build();
+const auto kMetricTcpCongestionWindow =
+    grpc_core::GlobalInstrumentsRegistry::RegisterUInt64Histogram(
+        "grpc.tcp.congestion_window",
+        "EXPERIMENTAL.  Send congestion window of TCP connections.",
+        "{segment}", false)
+        .Build();
+const auto kMetricTcpNotsentBytes =
+    grpc_core::GlobalInstrumentsRegistry::RegisterUInt64Histogram(
+        "grpc.tcp.notsent_bytes",
+        "EXPERIMENTAL.  Bytes in the send buffer of TCP connections that have "
+        "not been sent yet.",
+        "By", false)
+        .Build();
+const auto kMetricTcpRetransmits =
+    grpc_core::GlobalInstrumentsRegistry::RegisterUInt64Counter(
+        "grpc.tcp.retransmits",
+        "EXPERIMENTAL.  Segments retransmitted by TCP connections.",
+        "{segment}", false)
+        .Build();
 }  // namespace
 
 namespace grpc_core {
@@ -396,6 +452,7 @@ grpc_chttp2_transport::~grpc_chttp2_transport() {
 
 using grpc_event_engine::experimental::ChannelzExtension;
 using grpc_event_engine::experimental::QueryExtension;
+using grpc_event_engine::experimental::TcpInfoExtension;
 using grpc_event_engine::experimental::TcpTraceExtension;
 
 static void read_channel_args(grpc_chttp2_transport* t,
@@ -418,15 +475,43 @@ static void read_channel_args(grpc_chttp2_transport* t,
   if (max_hpack_table_size >= 0) {
     t->hpack_compressor.SetMaxUsableSize(max_hpack_table_size);
   }
+  t->hpack_compressor.set_admission_control(
+      channel_args.GetBool(GRPC_ARG_HTTP2_HPACK_ADMISSION_CONTROL)
+          .value_or(false));
 
   t->write_buffer_size =
       std::max(0, channel_args.GetInt(GRPC_ARG_HTTP2_WRITE_BUFFER_SIZE)
                       .value_or(grpc_core::chttp2::kDefaultWindow));
+  t->write_buffer_flush_delay =
+      std::max(grpc_core::Duration::Zero(),
+               channel_args
+                   .GetDurationFromIntMillis(
+                       GRPC_ARG_HTTP2_WRITE_BUFFER_FLUSH_DELAY_MS)
+                   .value_or(grpc_core::Duration::Zero()));
+  t->tcp_info_sample_interval = std::max(
+      grpc_core::Duration::Zero(),
+      channel_args
+          .GetDurationFromIntMillis(GRPC_ARG_TCP_INFO_SAMPLE_INTERVAL_MS)
+          .value_or(grpc_core::Duration::Zero()));
+  t->write_size_policy.SetCoalescingWindow(
+      std::chrono::microseconds(std::max(
+          0, channel_args.GetInt(GRPC_ARG_HTTP2_WRITE_COALESCING_WINDOW_US)
+                 .value_or(0))),
+      std::max(0,
+               channel_args.GetInt(GRPC_ARG_HTTP2_WRITE_COALESCING_MIN_STREAMS)
+                   .value_or(16)));
   t->keepalive_time =
       std::max(grpc_core::Duration::Milliseconds(1),
                channel_args.GetDurationFromIntMillis(GRPC_ARG_KEEPALIVE_TIME_MS)
                    .value_or(t->is_client ? g_default_client_keepalive_time
                                           : g_default_server_keepalive_time));
+  t->keepalive_max_idle_time = std::max(
+      t->keepalive_time,
+      channel_args
+          .GetDurationFromIntMillis(
+              GRPC_ARG_EXPERIMENTAL_KEEPALIVE_MAX_IDLE_TIME_MS)
+          .value_or(t->keepalive_time));
+  t->current_keepalive_time = t->keepalive_time;
   t->keepalive_timeout = std::max(
       grpc_core::Duration::Zero(),
       channel_args.GetDurationFromIntMillis(GRPC_ARG_KEEPALIVE_TIMEOUT_MS)
@@ -472,6 +557,19 @@ static void read_channel_args(grpc_chttp2_transport* t,
     t->max_requests_per_read = 32;
   }
 
+  // Mirrors the limit the message size filter reads from the same args.
+  if (!channel_args.WantMinimalStack()) {
+    const int max_recv_message_size =
+        channel_args.GetInt(GRPC_ARG_MAX_RECEIVE_MESSAGE_LENGTH)
+            .value_or(GRPC_DEFAULT_MAX_RECV_MESSAGE_LENGTH);
+    if (max_recv_message_size >= 0) {
+      t->max_recv_message_size = static_cast<uint32_t>(max_recv_message_size);
+    }
+  }
+
+  t->http2_ztrace_collector.KeepHistory(std::max(
+      0, channel_args.GetInt(GRPC_ARG_HTTP2_ZTRACE_HISTORY_BYTES).value_or(0)));
+
   if (channel_args.GetBool(GRPC_ARG_ENABLE_CHANNELZ)
           .value_or(GRPC_ENABLE_CHANNELZ_DEFAULT)) {
     t->channelz_socket =
@@ -561,6 +659,18 @@ static void read_channel_args(grpc_chttp2_transport* t,
   t->max_concurrent_streams_reject_on_client =
       channel_args.GetBool(GRPC_ARG_MAX_CONCURRENT_STREAMS_REJECT_ON_CLIENT)
           .value_or(false);
+
+  t->configured_max_concurrent_streams =
+      t->settings.local().max_concurrent_streams();
+  if (!is_client) {
+    t->adaptive_max_concurrent_streams =
+        channel_args.GetBool(GRPC_ARG_HTTP2_ADAPTIVE_MAX_CONCURRENT_STREAMS)
+            .value_or(false);
+  } else if (channel_args.Contains(
+                 GRPC_ARG_HTTP2_ADAPTIVE_MAX_CONCURRENT_STREAMS)) {
+    VLOG(2) << GRPC_ARG_HTTP2_ADAPTIVE_MAX_CONCURRENT_STREAMS
+            << " is not available on clients";
+  }
 }
 
 static void init_keepalive_pings_if_enabled_locked(
@@ -610,6 +720,8 @@ void grpc_chttp2_transport::ChannelzDataSource::AddData(
           }
           misc["keepaliveTime"] =
               Json::FromString(t->keepalive_time.ToJsonString());
+          misc["currentKeepaliveTime"] =
+              Json::FromString(t->current_keepalive_time.ToJsonString());
           misc["nextAdjustedKeepaliveTimestamp"] =
               Json::FromString((t->next_adjusted_keepalive_timestamp -
                                 grpc_core::Timestamp::Now())
@@ -619,6 +731,10 @@ void grpc_chttp2_transport::ChannelzDataSource::AddData(
           misc["numPendingInducedFrames"] =
               Json::FromNumber(t->num_pending_induced_frames);
           misc["writeBufferSize"] = Json::FromNumber(t->write_buffer_size);
+          misc["writeCoalescingWindowUs"] = Json::FromNumber(
+              t->write_size_policy.CoalescingWindow().count());
+          misc["numWriteInitiations"] =
+              Json::FromNumber(t->num_write_initiations);
           misc["readingPausedOnPendingInducedFrames"] =
               Json::FromBool(t->reading_paused_on_pending_induced_frames);
           misc["enablePreferredRxCryptoFrameAdvertisement"] =
@@ -642,6 +758,22 @@ void grpc_chttp2_transport::ChannelzDataSource::AddData(
           http2_info["misc"] = Json::FromObject(std::move(misc));
           http2_info["settings"] = Json::FromObject(t->settings.ToJsonObject());
           sink.AddAdditionalInfo("http2", std::move(http2_info));
+          if (t->closed_with_error.ok() && t->tcp_info_extension != nullptr) {
+            auto info = t->tcp_info_extension->GetTcpConnectionInfo();
+            if (info.has_value()) {
+              Json::Object tcp_info;
+              tcp_info["rttUs"] = Json::FromNumber(info->rtt.count());
+              tcp_info["minRttUs"] = Json::FromNumber(info->min_rtt.count());
+              tcp_info["deliveryRate"] = Json::FromNumber(info->delivery_rate);
+              tcp_info["congestionWindow"] =
+                  Json::FromNumber(info->congestion_window);
+              tcp_info["mss"] = Json::FromNumber(info->mss);
+              tcp_info["totalRetransmits"] =
+                  Json::FromNumber(info->total_retransmits);
+              tcp_info["notsentBytes"] = Json::FromNumber(info->notsent_bytes);
+              sink.AddAdditionalInfo("tcpInfo", std::move(tcp_info));
+            }
+          }
           std::vector<grpc_core::RefCountedPtr<grpc_core::channelz::BaseNode>>
               children;
           children.reserve(t->stream_map.size());
@@ -740,6 +872,25 @@ grpc_chttp2_transport::grpc_chttp2_transport(
     }
   }
 
+  if ((grpc_core::IsBdpEstimateFromTcpInfoEnabled() ||
+       tcp_info_sample_interval > grpc_core::Duration::Zero()) &&
+      grpc_event_engine::experimental::grpc_is_event_engine_endpoint(
+          ep.get())) {
+    tcp_info_extension = QueryExtension<TcpInfoExtension>(
+        grpc_event_engine::experimental::grpc_get_wrapped_event_engine_endpoint(
+            ep.get()));
+  }
+  if (tcp_info_extension != nullptr &&
+      tcp_info_sample_interval > grpc_core::Duration::Zero()) {
+    stats_plugin_group = channel_args.GetObjectRef<
+        grpc_core::GlobalStatsPluginRegistry::StatsPluginGroup>();
+    if (stats_plugin_group == nullptr && !is_client) {
+      stats_plugin_group =
+          grpc_core::GlobalStatsPluginRegistry::GetStatsPluginsForServer(
+              channel_args);
+    }
+  }
+
   if (channel_args.GetBool(GRPC_ARG_SECURITY_FRAME_ALLOWED).value_or(false)) {
     transport_framing_endpoint_extension = QueryExtension<
         grpc_core::TransportFramingEndpointExtension>(
@@ -785,6 +936,7 @@ grpc_chttp2_transport::grpc_chttp2_transport(
       grpc_core::InitTransportClosure<init_keepalive_pings_if_enabled_locked>(
           Ref(), &init_keepalive_ping_locked),
       absl::OkStatus());
+  if (stats_plugin_group != nullptr) schedule_tcp_info_sample(this);
 
   if (flow_control.bdp_probe()) {
     bdp_ping_blocked = true;
@@ -794,6 +946,7 @@ grpc_chttp2_transport::grpc_chttp2_transport(
 
   grpc_chttp2_initiate_write(this, GRPC_CHTTP2_INITIATE_WRITE_INITIAL_WRITE);
   post_benign_reclaimer(this);
+  post_idle_reclaimer(this);
   if (grpc_core::test_only_init_callback != nullptr) {
     grpc_core::test_only_init_callback();
   }
@@ -859,6 +1012,14 @@ static void close_transport_locked(grpc_chttp2_transport* t,
         t->event_engine->Cancel(t->next_bdp_ping_timer_handle)) {
       t->next_bdp_ping_timer_handle = TaskHandle::kInvalid;
     }
+    if (t->write_buffer_flush_timer_handle != TaskHandle::kInvalid &&
+        t->event_engine->Cancel(t->write_buffer_flush_timer_handle)) {
+      t->write_buffer_flush_timer_handle = TaskHandle::kInvalid;
+    }
+    if (t->tcp_info_sample_timer_handle != TaskHandle::kInvalid &&
+        t->event_engine->Cancel(t->tcp_info_sample_timer_handle)) {
+      t->tcp_info_sample_timer_handle = TaskHandle::kInvalid;
+    }
     switch (t->keepalive_state) {
       case GRPC_CHTTP2_KEEPALIVE_STATE_WAITING:
         if (t->keepalive_ping_timer_handle != TaskHandle::kInvalid &&
@@ -890,6 +1051,8 @@ static void close_transport_locked(grpc_chttp2_transport* t,
       t->interested_parties_until_recv_settings = nullptr;
     }
     grpc_core::MutexLock lock(&t->ep_destroy_mu);
+    // The extension lives inside the endpoint.
+    t->tcp_info_extension = nullptr;
     t->ep.reset();
   }
   if (t->notify_on_receive_settings != nullptr) {
@@ -953,6 +1116,7 @@ grpc_chttp2_stream::grpc_chttp2_stream(grpc_chttp2_transport* t,
         << " [from " << server_data << "]";
     *t->accepting_stream = this;
     t->stream_map.emplace(id, this);
+    restore_header_table_size(t);
     post_destructive_reclaimer(t);
   }
 
@@ -1073,12 +1237,48 @@ static void set_write_state(grpc_chttp2_transport* t,
   }
 }
 
+// Writes started for these reasons may be held back for coalescing. Pings,
+// settings and resets are sent right away: delaying them would skew ping
+// based measurements such as BDP estimation, or hold up the peer.
+static bool write_reason_carries_stream_data(
+    grpc_chttp2_initiate_write_reason reason) {
+  switch (reason) {
+    case GRPC_CHTTP2_INITIATE_WRITE_START_NEW_STREAM:
+    case GRPC_CHTTP2_INITIATE_WRITE_SEND_MESSAGE:
+    case GRPC_CHTTP2_INITIATE_WRITE_SEND_INITIAL_METADATA:
+    case GRPC_CHTTP2_INITIATE_WRITE_SEND_TRAILING_METADATA:
+      return true;
+    default:
+      return false;
+  }
+}
+
 void grpc_chttp2_initiate_write(grpc_chttp2_transport* t,
                                 grpc_chttp2_initiate_write_reason reason) {
+  ++t->num_write_initiations;
   switch (t->write_state) {
-    case GRPC_CHTTP2_WRITE_STATE_IDLE:
+    case GRPC_CHTTP2_WRITE_STATE_IDLE: {
       set_write_state(t, GRPC_CHTTP2_WRITE_STATE_WRITING,
                       grpc_chttp2_initiate_write_reason_string(reason));
+      // With many streams open, hold a write of stream data back for a
+      // little while so that the other streams get a chance to add their
+      // frames to it. The transport stays in the WRITING state meanwhile, so
+      // further initiations are folded into this write.
+      const auto delay =
+          write_reason_carries_stream_data(reason)
+              ? t->write_size_policy.CoalescingDelay(t->stream_map.size())
+              : std::chrono::microseconds::zero();
+      if (delay > std::chrono::microseconds::zero()) {
+        t->event_engine->RunAfter(delay, [t = t->Ref()]() mutable {
+          grpc_core::ExecCtx exec_ctx;
+          grpc_chttp2_transport* tp = t.get();
+          tp->combiner->Run(
+              grpc_core::InitTransportClosure<write_action_begin_locked>(
+                  std::move(t), &tp->write_action_begin_locked),
+              absl::OkStatus());
+        });
+        break;
+      }
       // Note that the 'write_action_begin_locked' closure is being scheduled
       // on the 'finally_scheduler' of t->combiner. This means that
       // 'write_action_begin_locked' is called only *after* all the other
@@ -1100,6 +1300,7 @@ void grpc_chttp2_initiate_write(grpc_chttp2_transport* t,
               t->Ref(), &t->write_action_begin_locked),
           absl::OkStatus());
       break;
+    }
     case GRPC_CHTTP2_WRITE_STATE_WRITING:
       set_write_state(t, GRPC_CHTTP2_WRITE_STATE_WRITING_WITH_MORE,
                       grpc_chttp2_initiate_write_reason_string(reason));
@@ -1188,6 +1389,7 @@ static void write_action(grpc_chttp2_transport* t) {
       << (t->is_client ? "CLIENT" : "SERVER") << "[" << t << "]: Write "
       << t->outbuf.Length() << " bytes";
   t->write_size_policy.BeginWrite(t->outbuf.Length());
+  t->endpoint_write_start_cycle = gpr_get_cycle_counter();
   t->http2_ztrace_collector.Append(grpc_core::H2BeginEndpointWrite{
       static_cast<uint32_t>(t->outbuf.Length())});
   grpc_endpoint_write(t->ep.get(), t->outbuf.c_slice_buffer(),
@@ -1212,6 +1414,9 @@ static void write_action_end_locked(
     grpc_core::RefCountedPtr<grpc_chttp2_transport> t,
     grpc_error_handle error) {
   t->write_size_policy.EndWrite(error.ok());
+  grpc_core::global_stats().IncrementHttp2EndpointWriteTimeUs(
+      static_cast<int>(gpr_timespec_to_micros(gpr_cycle_counter_sub(
+          gpr_get_cycle_counter(), t->endpoint_write_start_cycle))));
 
   bool closed = false;
   if (!error.ok()) {
@@ -1369,6 +1574,7 @@ static void maybe_start_some_streams(grpc_chttp2_transport* t) {
     }
 
     t->stream_map.emplace(s->id, s);
+    restore_header_table_size(t);
     post_destructive_reclaimer(t);
     grpc_chttp2_mark_stream_writable(t, s);
     grpc_chttp2_initiate_write(t, GRPC_CHTTP2_INITIATE_WRITE_START_NEW_STREAM);
@@ -1480,6 +1686,22 @@ static void trace_annotations(grpc_chttp2_stream* s) {
   }
 }
 
+// Takes the write priority hint out of the initial metadata of \a s, so that
+// it is not sent to the peer.
+static void take_write_priority_locked(grpc_chttp2_stream* s) {
+  std::string buffer;
+  std::optional<absl::string_view> value =
+      s->send_initial_metadata->GetStringValue(GRPC_WRITE_PRIORITY_MD_KEY,
+                                               &buffer);
+  if (!value.has_value()) return;
+  uint32_t priority;
+  if (absl::SimpleAtoi(*value, &priority)) {
+    s->write_weight = static_cast<uint8_t>(
+        1 + std::min<uint32_t>(priority, GRPC_MAX_WRITE_PRIORITY));
+  }
+  s->send_initial_metadata->Remove(GRPC_WRITE_PRIORITY_MD_KEY);
+}
+
 static void send_initial_metadata_locked(
     grpc_transport_stream_op_batch* op, grpc_chttp2_stream* s,
     grpc_transport_stream_op_batch_payload* op_payload,
@@ -1494,6 +1716,7 @@ static void send_initial_metadata_locked(
   s->send_initial_metadata_finished = add_closure_barrier(on_complete);
   s->send_initial_metadata =
       op_payload->send_initial_metadata.send_initial_metadata;
+  take_write_priority_locked(s);
   if (t->is_client) {
     s->deadline =
         std::min(s->deadline,
@@ -1600,6 +1823,9 @@ static void send_message_locked(
       s->write_buffering = false;
     }
 
+    if (s->flow_controlled_buffer.length == 0) {
+      s->send_message_queued_cycle = gpr_get_cycle_counter();
+    }
     grpc_slice* const slices =
         op_payload->send_message.send_message->c_slice_buffer()->slices;
     grpc_slice* const end =
@@ -1635,10 +1861,87 @@ static void send_message_locked(
                                                   t->write_buffer_size)) {
       grpc_chttp2_mark_stream_writable(t, s);
       grpc_chttp2_initiate_write(t, GRPC_CHTTP2_INITIATE_WRITE_SEND_MESSAGE);
+    } else if (s->write_buffering &&
+               t->write_buffer_flush_delay > grpc_core::Duration::Zero() &&
+               t->write_buffer_flush_timer_handle == TaskHandle::kInvalid) {
+      // Bound how long the buffered data can wait for a write that flushes
+      // it.
+      t->write_buffer_flush_timer_handle = t->event_engine->RunAfter(
+          t->write_buffer_flush_delay, [t = t->Ref()]() mutable {
+            grpc_core::ExecCtx exec_ctx;
+            grpc_chttp2_transport* tp = t.get();
+            tp->combiner->Run(
+                grpc_core::InitTransportClosure<write_buffer_flush_locked>(
+                    std::move(t), &tp->write_buffer_flush_locked),
+                absl::OkStatus());
+          });
     }
   }
 }
 
+static void write_buffer_flush_locked(
+    grpc_core::RefCountedPtr<grpc_chttp2_transport> t,
+    GRPC_UNUSED grpc_error_handle error) {
+  DCHECK(error.ok());
+  t->write_buffer_flush_timer_handle = TaskHandle::kInvalid;
+  bool flush = false;
+  for (const auto& id_stream : t->stream_map) {
+    grpc_chttp2_stream* s = id_stream.second;
+    if (s->write_buffering && s->flow_controlled_buffer.length > 0) {
+      grpc_chttp2_mark_stream_writable(t.get(), s);
+      flush = true;
+    }
+  }
+  if (flush) {
+    grpc_chttp2_initiate_write(t.get(),
+                               GRPC_CHTTP2_INITIATE_WRITE_SEND_MESSAGE);
+  }
+}
+
+static void schedule_tcp_info_sample(grpc_chttp2_transport* t) {
+  t->tcp_info_sample_timer_handle = t->event_engine->RunAfter(
+      t->tcp_info_sample_interval, [t = t->Ref()]() mutable {
+        grpc_core::ExecCtx exec_ctx;
+        grpc_chttp2_transport* tp = t.get();
+        tp->combiner->Run(
+            grpc_core::InitTransportClosure<tcp_info_sample_locked>(
+                std::move(t), &tp->tcp_info_sample_locked),
+            absl::OkStatus());
+      });
+}
+
+static void tcp_info_sample_locked(
+    grpc_core::RefCountedPtr<grpc_chttp2_transport> t,
+    GRPC_UNUSED grpc_error_handle error) {
+  DCHECK(error.ok());
+  t->tcp_info_sample_timer_handle = TaskHandle::kInvalid;
+  if (!t->closed_with_error.ok()) return;
+  auto info = t->tcp_info_extension->GetTcpConnectionInfo();
+  if (info.has_value()) {
+    auto& plugins = *t->stats_plugin_group;
+    plugins.RecordHistogram(
+        kMetricTcpRtt,
+        std::chrono::duration<double>(info->rtt).count(), {}, {});
+    plugins.RecordHistogram(
+        kMetricTcpMinRtt,
+        std::chrono::duration<double>(info->min_rtt).count(), {}, {});
+    plugins.RecordHistogram(kMetricTcpDeliveryRate, info->delivery_rate, {},
+                            {});
+    plugins.RecordHistogram(kMetricTcpCongestionWindow,
+                            info->congestion_window, {}, {});
+    plugins.RecordHistogram(kMetricTcpNotsentBytes, info->notsent_bytes, {},
+                            {});
+    if (info->total_retransmits > t->tcp_info_last_total_retransmits) {
+      plugins.AddCounter(
+          kMetricTcpRetransmits,
+          info->total_retransmits - t->tcp_info_last_total_retransmits, {},
+          {});
+    }
+    t->tcp_info_last_total_retransmits = info->total_retransmits;
+  }
+  schedule_tcp_info_sample(t.get());
+}
+
 static void send_trailing_metadata_locked(
     grpc_transport_stream_op_batch* op, grpc_chttp2_stream* s,
     grpc_transport_stream_op_batch_payload* op_payload,
@@ -2287,6 +2590,7 @@ void grpc_chttp2_maybe_complete_recv_message(grpc_chttp2_transport* t,
 
   upd.SetPendingSize(s->frame_storage.length);
   grpc_chttp2_act_on_flowctl_action(upd.MakeAction(), t, s);
+  if (!error.ok()) grpc_chttp2_cancel_stream(t, s, error, /*tarpit=*/false);
 }
 
 void grpc_chttp2_maybe_complete_recv_trailing_metadata(grpc_chttp2_transport* t,
@@ -2324,6 +2628,7 @@ static grpc_chttp2_transport::RemovedStreamHandle remove_stream(
 
   if (t->stream_map.empty()) {
     post_benign_reclaimer(t);
+    post_idle_reclaimer(t);
     if (t->sent_goaway_state == GRPC_CHTTP2_FINAL_GOAWAY_SENT) {
       close_transport_locked(
           t, GRPC_ERROR_CREATE_REFERENCING(
@@ -2813,6 +3118,44 @@ void grpc_chttp2_act_on_flowctl_action(
   }
 }
 
+uint32_t grpc_chttp2_adaptive_max_concurrent_streams(
+    uint32_t max_concurrent_streams, size_t open_streams,
+    double memory_pressure) {
+  // Below this pressure the configured limit applies.
+  constexpr double kPushbackPressure = 0.5;
+  // Every connection may open at least this many streams, so that quiet
+  // connections are not starved by busy ones.
+  constexpr uint32_t kMinMaxConcurrentStreams = 16;
+  if (memory_pressure < kPushbackPressure) return max_concurrent_streams;
+  // Scale each connection's limit from its own load: from room for 50% more
+  // streams at kPushbackPressure, through no new streams at 75%, down to
+  // half of the open streams at full pressure.
+  const double scale =
+      0.5 + (1.0 - std::min(memory_pressure, 1.0)) / (1.0 - kPushbackPressure);
+  const double limit = std::max(open_streams * scale,
+                                static_cast<double>(kMinMaxConcurrentStreams));
+  return static_cast<uint32_t>(std::min<double>(max_concurrent_streams, limit));
+}
+
+void grpc_chttp2_maybe_update_max_concurrent_streams(
+    grpc_chttp2_transport* t) {
+  if (!t->adaptive_max_concurrent_streams) return;
+  const grpc_core::Timestamp now = grpc_core::Timestamp::Now();
+  if (now < t->next_adaptive_max_concurrent_streams_update) return;
+  t->next_adaptive_max_concurrent_streams_update =
+      now + grpc_core::Duration::Milliseconds(100);
+  const uint32_t limit = grpc_chttp2_adaptive_max_concurrent_streams(
+      t->configured_max_concurrent_streams, t->stream_map.size(),
+      t->memory_owner.GetPressureInfo().pressure_control_value);
+  if (limit == t->settings.local().max_concurrent_streams()) return;
+  GRPC_TRACE_LOG(http, INFO)
+      << t->peer_string.as_string_view()
+      << ": adjusting MAX_CONCURRENT_STREAMS from "
+      << t->settings.local().max_concurrent_streams() << " to " << limit;
+  t->settings.mutable_local().SetMaxConcurrentStreams(limit);
+  grpc_chttp2_initiate_write(t, GRPC_CHTTP2_INITIATE_WRITE_SEND_SETTINGS);
+}
+
 static grpc_error_handle try_http_parsing(grpc_chttp2_transport* t) {
   grpc_http_parser parser;
   size_t i = 0;
@@ -2971,7 +3314,30 @@ static void continue_read_action_locked(
 void schedule_bdp_ping_locked(
     grpc_core::RefCountedPtr<grpc_chttp2_transport> t) {
   auto* tp = t.get();
+  // The BDP ping timer may fire after the transport has closed, and with it
+  // the endpoint that tcp_info_extension points into.
+  if (!tp->closed_with_error.ok()) return;
   tp->flow_control.bdp_estimator()->SchedulePing();
+  if (grpc_core::IsBdpEstimateFromTcpInfoEnabled() &&
+      tp->tcp_info_extension != nullptr) {
+    // Timers have millisecond resolution, so one set for a shorter round trip
+    // fires late and counts the bytes of several round trips instead.
+    constexpr auto kMinTimedRtt = std::chrono::milliseconds(1);
+    auto info = tp->tcp_info_extension->GetTcpConnectionInfo();
+    if (info.has_value() && info->rtt >= kMinTimedRtt) {
+      // What a BDP ping measures is the number of bytes received within one
+      // round trip. The kernel already knows the round trip time, so count
+      // incoming bytes for that long instead of sending a ping that the peer
+      // may hold against us. Below kMinTimedRtt a real ping is more accurate.
+      tp->flow_control.bdp_estimator()->StartPing();
+      tp->bdp_ping_started = true;
+      tp->event_engine->RunAfter(info->rtt, [t = std::move(t)]() mutable {
+        grpc_core::ExecCtx exec_ctx;
+        finish_bdp_ping(std::move(t), absl::OkStatus());
+      });
+      return;
+    }
+  }
   send_ping_locked(tp,
                    grpc_core::InitTransportClosure<start_bdp_ping>(
                        tp->Ref(), &tp->start_bdp_ping_locked),
@@ -3033,6 +3399,7 @@ static void finish_bdp_ping_locked(
       t->flow_control.bdp_estimator()->CompletePing();
   grpc_chttp2_act_on_flowctl_action(t->flow_control.PeriodicUpdate(), t.get(),
                                     nullptr);
+  grpc_chttp2_maybe_update_max_concurrent_streams(t.get());
   CHECK(t->next_bdp_ping_timer_handle == TaskHandle::kInvalid);
   t->next_bdp_ping_timer_handle =
       t->event_engine->RunAfter(next_ping - grpc_core::Timestamp::Now(), [t] {
@@ -3134,6 +3501,7 @@ static void init_keepalive_ping_locked(
     if (!delay_callback &&
         (t->keepalive_permit_without_calls || !t->stream_map.empty())) {
       t->keepalive_state = GRPC_CHTTP2_KEEPALIVE_STATE_PINGING;
+      t->keepalive_data_received = false;
       send_keepalive_ping_locked(t);
       grpc_chttp2_initiate_write(t.get(),
                                  GRPC_CHTTP2_INITIATE_WRITE_KEEPALIVE_PING);
@@ -3143,7 +3511,7 @@ static void init_keepalive_ping_locked(
         extend = adjusted_keepalive_timestamp - now;
       }
       t->keepalive_ping_timer_handle =
-          t->event_engine->RunAfter(t->keepalive_time + extend, [t] {
+          t->event_engine->RunAfter(t->current_keepalive_time + extend, [t] {
             grpc_core::ExecCtx exec_ctx;
             init_keepalive_ping(t);
           });
@@ -3172,9 +3540,16 @@ static void finish_keepalive_ping_locked(
                   << ": Finish keepalive ping";
       }
       t->keepalive_state = GRPC_CHTTP2_KEEPALIVE_STATE_WAITING;
+      // If nothing but the ack has been received since the ping was sent,
+      // the transport is idle: back off.  Otherwise the read path has
+      // already reset current_keepalive_time.
+      if (!std::exchange(t->keepalive_data_received, false)) {
+        t->current_keepalive_time = std::min(t->current_keepalive_time * 2,
+                                             t->keepalive_max_idle_time);
+      }
       CHECK(t->keepalive_ping_timer_handle == TaskHandle::kInvalid);
       t->keepalive_ping_timer_handle =
-          t->event_engine->RunAfter(t->keepalive_time, [t] {
+          t->event_engine->RunAfter(t->current_keepalive_time, [t] {
             grpc_core::ExecCtx exec_ctx;
             init_keepalive_ping(t);
           });
@@ -3203,6 +3578,7 @@ static bool ExtendScheduledTimer(grpc_chttp2_transport* t, TaskHandle& handle,
 }
 
 static void maybe_reset_keepalive_ping_timer_locked(grpc_chttp2_transport* t) {
+  t->current_keepalive_time = t->keepalive_time;
   if (ExtendScheduledTimer(t, t->keepalive_ping_timer_handle, t->keepalive_time,
                            [t = t->Ref()]() mutable {
                              grpc_core::ExecCtx exec_ctx;
@@ -3279,6 +3655,25 @@ static void post_benign_reclaimer(grpc_chttp2_transport* t) {
   }
 }
 
+static void post_idle_reclaimer(grpc_chttp2_transport* t) {
+  if (!t->idle_reclaimer_registered) {
+    t->idle_reclaimer_registered = true;
+    t->memory_owner.PostReclaimer(
+        grpc_core::ReclamationPass::kIdle,
+        [t = t->Ref()](
+            std::optional<grpc_core::ReclamationSweep> sweep) mutable {
+          if (sweep.has_value()) {
+            auto* tp = t.get();
+            tp->active_reclamation = std::move(*sweep);
+            tp->combiner->Run(
+                grpc_core::InitTransportClosure<idle_reclaimer_locked>(
+                    std::move(t), &tp->idle_reclaimer_locked),
+                absl::OkStatus());
+          }
+        });
+  }
+}
+
 static void post_destructive_reclaimer(grpc_chttp2_transport* t) {
   if (!t->destructive_reclaimer_registered) {
     t->destructive_reclaimer_registered = true;
@@ -3301,6 +3696,52 @@ static void post_destructive_reclaimer(grpc_chttp2_transport* t) {
 static void benign_reclaimer_locked(
     grpc_core::RefCountedPtr<grpc_chttp2_transport> t,
     grpc_error_handle error) {
+  if (error.ok() && t->stream_map.empty()) {
+    // Channel with no active streams: give back what it kept from its busier
+    // times without the peer noticing anything but a smaller HPACK table.
+    GRPC_TRACE_LOG(resource_quota, INFO)
+        << "HTTP2: " << t->peer_string.as_string_view()
+        << " - compact idle transport to free memory";
+    grpc_core::global_stats().IncrementHttp2IdleTransportsCompacted();
+    if (t->write_state == GRPC_CHTTP2_WRITE_STATE_IDLE) {
+      // Clear() keeps the slice arrays at their largest size, swapping in
+      // fresh buffers frees them.
+      if (t->outbuf.Length() == 0) t->outbuf = grpc_core::SliceBuffer();
+      if (t->qbuf.length == 0) {
+        grpc_slice_buffer_destroy(&t->qbuf);
+        grpc_slice_buffer_init(&t->qbuf);
+      }
+    }
+    const uint32_t header_table_size = t->settings.local().header_table_size();
+    if (header_table_size != 0 && t->reclaimed_header_table_size == 0) {
+      // Once the peer acks, the HPACK parser drops its dynamic table. The
+      // size is asked back when the next stream starts.
+      t->reclaimed_header_table_size = header_table_size;
+      t->settings.mutable_local().SetHeaderTableSize(0);
+      grpc_chttp2_initiate_write(t.get(),
+                                 GRPC_CHTTP2_INITIATE_WRITE_SEND_SETTINGS);
+    }
+  } else if (error.ok() && GRPC_TRACE_FLAG_ENABLED(resource_quota)) {
+    LOG(INFO) << "HTTP2: " << t->peer_string.as_string_view()
+              << " - skip benign reclamation, there are still "
+              << t->stream_map.size() << " streams";
+  }
+  t->benign_reclaimer_registered = false;
+  if (error != absl::CancelledError()) {
+    t->active_reclamation.Finish();
+  }
+}
+
+static void restore_header_table_size(grpc_chttp2_transport* t) {
+  if (t->reclaimed_header_table_size == 0) return;
+  t->settings.mutable_local().SetHeaderTableSize(
+      std::exchange(t->reclaimed_header_table_size, 0));
+  grpc_chttp2_initiate_write(t, GRPC_CHTTP2_INITIATE_WRITE_SEND_SETTINGS);
+}
+
+static void idle_reclaimer_locked(
+    grpc_core::RefCountedPtr<grpc_chttp2_transport> t,
+    grpc_error_handle error) {
   if (error.ok() && t->stream_map.empty()) {
     // Channel with no active streams: send a goaway to try and make it
     // disconnect cleanly
@@ -3316,10 +3757,10 @@ static void benign_reclaimer_locked(
                 /*immediate_disconnect_hint=*/true);
   } else if (error.ok() && GRPC_TRACE_FLAG_ENABLED(resource_quota)) {
     LOG(INFO) << "HTTP2: " << t->peer_string.as_string_view()
-              << " - skip benign reclamation, there are still "
+              << " - skip idle reclamation, there are still "
               << t->stream_map.size() << " streams";
   }
-  t->benign_reclaimer_registered = false;
+  t->idle_reclaimer_registered = false;
   if (error != absl::CancelledError()) {
     t->active_reclamation.Finish();
   }
@@ -117,7 +117,9 @@ void TransportFlowControl::SentUpdate(uint32_t announce) {
   announced_window_ += announce;
 }
 
-StreamFlowControl::StreamFlowControl(TransportFlowControl* tfc) : tfc_(tfc) {}
+StreamFlowControl::StreamFlowControl(TransportFlowControl* tfc) : tfc_(tfc) {
+  tfc_->AddStream();
+}
 
 absl::Status StreamFlowControl::IncomingUpdateContext::RecvData(
     int64_t incoming_frame_size) {
@@ -175,8 +177,8 @@ double
 TransportFlowControl::TargetInitialWindowSizeBasedOnMemoryPressureAndBdp()
     const {
   const double bdp = bdp_estimator_.EstimateBdp() * 2.0;
-  const double memory_pressure =
-      memory_owner_->GetPressureInfo().pressure_control_value;
+  const auto pressure_info = memory_owner_->GetPressureInfo();
+  const double memory_pressure = pressure_info.pressure_control_value;
   // Linear interpolation between two values.
   // Given a line segment between the two points (t_min, a), and (t_max, b),
   // and a value t such that t_min <= t <= t_max, return the value on the line
@@ -213,16 +215,44 @@ TransportFlowControl::TargetInitialWindowSizeBasedOnMemoryPressureAndBdp()
   const double kAdjustedToBdpPressure = 0.5;
   const double kOneMegabyte = 1024.0 * 1024.0;
   const double kAnythingGoesWindow = std::max(4.0 * kOneMegabyte, bdp);
+  double window;
   if (memory_pressure < kAnythingGoesPressure) {
-    return kAnythingGoesWindow;
+    window = kAnythingGoesWindow;
   } else if (memory_pressure < kAdjustedToBdpPressure) {
-    return lerp(memory_pressure, kAnythingGoesPressure, kAdjustedToBdpPressure,
-                kAnythingGoesWindow, bdp);
+    window = lerp(memory_pressure, kAnythingGoesPressure,
+                  kAdjustedToBdpPressure, kAnythingGoesWindow, bdp);
   } else if (memory_pressure < 1.0) {
-    return lerp(memory_pressure, kAdjustedToBdpPressure, 1.0, bdp, 0);
+    window = lerp(memory_pressure, kAdjustedToBdpPressure, 1.0, bdp, 0);
   } else {
-    return 0;
+    window = 0;
+  }
+  return window;
+}
+
+double TransportFlowControl::SplitInitialWindowBetweenStreams(double window) {
+  // The initial window applies to every stream, so with many streams the
+  // connection could commit num_streams times it.  Split a connection budget
+  // -- what the memory quota recommends for a single allocation, and never
+  // less than the BDP -- between the streams, but don't drop below the
+  // HTTP/2 default window.  This only limits data that was not asked for:
+  // a stream with a pending read still announces what the read needs (see
+  // StreamFlowControl::DesiredAnnounceSize), so fast readers keep going
+  // while slow readers stop being sent data they have not made room for.
+  //
+  // The split rounds up to a power of two, so a stream count hovering around
+  // a boundary would flip the advertised window on every update.  Follow the
+  // stream count up straight away, but only follow it down once it has
+  // halved.
+  if (num_streams_ > split_streams_ || num_streams_ <= split_streams_ / 2) {
+    split_streams_ = num_streams_;
   }
+  if (split_streams_ <= 1 || window <= kDefaultWindow) return window;
+  const double budget = std::max(
+      bdp_estimator_.EstimateBdp() * 2.0,
+      static_cast<double>(
+          memory_owner_->GetPressureInfo().max_recommended_allocation_size));
+  return std::min(window, std::max(budget / split_streams_,
+                                   static_cast<double>(kDefaultWindow)));
 }
 
 void TransportFlowControl::UpdateSetting(
@@ -269,10 +299,17 @@ FlowControlAction TransportFlowControl::PeriodicUpdate() {
     // target might change based on how much memory pressure we are under
     // TODO(ncteisen): experiment with setting target to be huge under low
     // memory pressure.
-    uint32_t target = static_cast<uint32_t>(RoundUpToPowerOf2(
-        Clamp(TargetInitialWindowSizeBasedOnMemoryPressureAndBdp(), 0.0,
-              static_cast<double>(kMaxInitialWindowSize))));
-    if (target < kMinPositiveInitialWindowSize) target = 0;
+    const double window = TargetInitialWindowSizeBasedOnMemoryPressureAndBdp();
+    auto to_target = [](double size) {
+      uint32_t target = static_cast<uint32_t>(RoundUpToPowerOf2(
+          Clamp(size, 0.0, static_cast<double>(kMaxInitialWindowSize))));
+      if (target < kMinPositiveInitialWindowSize) target = 0;
+      return target;
+    };
+    // Frame sizes follow the connection's target; only the initial window,
+    // which every stream gets, is split between the streams.
+    const uint32_t frame_target = to_target(window);
+    uint32_t target = to_target(SplitInitialWindowBetweenStreams(window));
     if (g_test_only_transport_target_window_estimates_mocker != nullptr) {
       // Hook for simulating unusual flow control situations in tests.
       target = g_test_only_transport_target_window_estimates_mocker
@@ -287,7 +324,7 @@ FlowControlAction TransportFlowControl::PeriodicUpdate() {
                   &action, &FlowControlAction::set_send_initial_window_update);
     // we target the max of BDP or bandwidth in microseconds.
     UpdateSetting(Http2Settings::max_frame_size_name(), &target_frame_size_,
-                  Clamp(target, Http2Settings::min_max_frame_size(),
+                  Clamp(frame_target, Http2Settings::min_max_frame_size(),
                         Http2Settings::max_max_frame_size()),
                   &action, &FlowControlAction::set_send_max_frame_size_update);
 
@@ -290,6 +290,11 @@ class TransportFlowControl final {
     }
   }
 
+  // Number of streams sharing the connection's receive budget.
+  int64_t num_streams() const { return num_streams_; }
+  void AddStream() { ++num_streams_; }
+  void RemoveStream() { --num_streams_; }
+
   // A snapshot of the flow control stats to export.
   struct Stats {
     int64_t target_window;
@@ -348,6 +353,8 @@ class TransportFlowControl final {
 
  private:
   double TargetInitialWindowSizeBasedOnMemoryPressureAndBdp() const;
+  // Caps \a window at this connection's share for each of its streams.
+  double SplitInitialWindowBetweenStreams(double window);
   static void UpdateSetting(absl::string_view name, int64_t* desired_value,
                             uint32_t new_desired_value,
                             FlowControlAction* action,
@@ -368,6 +375,12 @@ class TransportFlowControl final {
   /// incoming_window = total_over - max(bdp - total_under, 0)
   int64_t announced_stream_total_over_incoming_window_ = 0;
 
+  /// number of live streams; the initial window is the connection's receive
+  /// budget split between them
+  int64_t num_streams_ = 0;
+  /// the stream count the initial window was last split for
+  int64_t split_streams_ = 0;
+
   /// should we probe bdp?
   const bool enable_bdp_probe_;
 
@@ -391,6 +404,7 @@ class StreamFlowControl final {
   explicit StreamFlowControl(TransportFlowControl* tfc);
   ~StreamFlowControl() {
     tfc_->RemoveAnnouncedWindowDelta(announced_window_delta_);
+    tfc_->RemoveStream();
   }
 
   // Track an update to the incoming flow control counters - that is how many
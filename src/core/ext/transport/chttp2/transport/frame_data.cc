@@ -19,9 +19,12 @@
 #include "src/core/ext/transport/chttp2/transport/frame_data.h"
 
 #include <grpc/slice_buffer.h>
+#include <grpc/status.h>
 #include <grpc/support/port_platform.h>
 #include <stdlib.h>
 
+#include <optional>
+
 #include "absl/log/check.h"
 #include "absl/status/status.h"
 #include "absl/strings/str_format.h"
@@ -34,6 +37,19 @@
 #include "src/core/telemetry/stats.h"
 #include "src/core/util/status_helper.h"
 
+namespace {
+
+// Returns the longest length prefix that a message of at most \a max_length
+// bytes can have. Deflate and gzip add at most this much framing to their
+// input, so a compressed message that is any longer must decompress to more
+// than \a max_length bytes.
+size_t MaxWireMessageLength(uint32_t max_length, bool compressed) {
+  if (!compressed) return max_length;
+  return static_cast<size_t>(max_length) + max_length / 2048 + 64;
+}
+
+}  // namespace
+
 absl::Status grpc_chttp2_data_parser_begin_frame(uint8_t flags,
                                                  uint32_t stream_id,
                                                  grpc_chttp2_stream* s) {
@@ -123,6 +139,19 @@ grpc_core::Poll<grpc_error_handle> grpc_deframe_unprocessed_incoming_frames(
                   (static_cast<uint32_t>(header[3]) << 8) |
                   static_cast<uint32_t>(header[4]);
 
+  // Fail the stream before buffering a message that would be rejected anyway,
+  // and before flow control opens the window for it.
+  const std::optional<uint32_t>& max_length = s->t->max_recv_message_size;
+  if (max_length.has_value() &&
+      length > MaxWireMessageLength(*max_length, header[0] == 1)) {
+    return grpc_error_set_int(
+        absl::ResourceExhaustedError(absl::StrFormat(
+            "%s: Received message larger than max (%u vs. %d)",
+            s->t->is_client ? "CLIENT" : "SERVER", length, *max_length)),
+        grpc_core::StatusIntProperty::kRpcStatus,
+        GRPC_STATUS_RESOURCE_EXHAUSTED);
+  }
+
   if (slices->length < length + GRPC_HEADER_SIZE_IN_BYTES) {
     if (min_progress_size != nullptr) {
       *min_progress_size = length + GRPC_HEADER_SIZE_IN_BYTES - slices->length;
@@ -137,7 +166,20 @@ grpc_core::Poll<grpc_error_handle> grpc_deframe_unprocessed_incoming_frames(
         {GRPC_HEADER_SIZE_IN_BYTES, length, 0});
     grpc_slice_buffer_move_first_into_buffer(slices, GRPC_HEADER_SIZE_IN_BYTES,
                                              header);
-    grpc_slice_buffer_move_first(slices, length, stream_out->c_slice_buffer());
+    grpc_slice_buffer* message = stream_out->c_slice_buffer();
+    const size_t first_new_slice = message->count;
+    grpc_slice_buffer_move_first(slices, length, message);
+    // Message slices normally reference the frames they arrived in; only
+    // inlined slices (small frames, or small pieces split off a frame) hold
+    // copied bytes.
+    size_t copied_bytes = 0;
+    for (size_t i = first_new_slice; i < message->count; ++i) {
+      if (message->slices[i].refcount == nullptr) {
+        copied_bytes += GRPC_SLICE_LENGTH(message->slices[i]);
+      }
+    }
+    grpc_core::global_stats().IncrementHttp2ReceivedMessageCopiedBytes(
+        copied_bytes);
   }
 
   return absl::OkStatus();
@@ -25,6 +25,7 @@
 #include <algorithm>
 #include <cstdint>
 
+#include "absl/hash/hash.h"
 #include "absl/log/check.h"
 #include "absl/log/log.h"
 #include "src/core/ext/transport/chttp2/transport/bin_encoder.h"
@@ -314,6 +315,16 @@ void Encoder::EmitLitHdrWithNonBinaryStringKeyNotIdx(Slice key_slice,
   output_.Append(emit.data());
 }
 
+void Encoder::EmitLitHdrWithNonBinaryStringKeyNeverIdx(uint32_t key_index,
+                                                       Slice value_slice) {
+  NonBinaryStringValue emit(std::move(value_slice));
+  VarintWriter<4> key(key_index);
+  uint8_t* data = output_.AddTiny(key.length() + emit.prefix_length());
+  key.Write(0x10, data);
+  emit.WritePrefix(data + key.length());
+  output_.Append(emit.data());
+}
+
 void Encoder::AdvertiseTableSizeChange() {
   VarintWriter<3> w(compressor_->table_.max_size());
   w.Write(0x20, output_.AddTiny(w.length()));
@@ -357,20 +368,123 @@ void SliceIndex::EmitTo(absl::string_view key, const Slice& value,
     }
     prev = it;
   }
-  // No hit, emit a new literal and add it to the index.
+  // No hit. Unless the value must first prove it is reused, emit a new
+  // literal and add it to the index.
+  if (encoder->admission_control() &&
+      !Admit(absl::HashOf(value.as_string_view()))) {
+    encoder->NoteDeferredIndexing();
+    encoder->EmitLitHdrWithNonBinaryStringKeyNotIdx(
+        Slice::FromStaticString(key), value.Ref());
+    return;
+  }
   uint32_t index = encoder->EmitLitHdrWithNonBinaryStringKeyIncIdx(
       Slice::FromStaticString(key), value.Ref());
   values_.emplace_back(value.Ref(), index);
 }
 
+bool SliceIndex::Admit(size_t hash) {
+  for (size_t& seen : seen_values_) {
+    if (seen == hash) {
+      seen = 0;
+      return true;
+    }
+  }
+  seen_values_[next_seen_value_] = hash;
+  next_seen_value_ = (next_seen_value_ + 1) % kNumSeenValues;
+  return false;
+}
+
+void Compressor<GrpcMessageMetadata, GrpcMessageCompressor>::EncodeWith(
+    GrpcMessageMetadata, const Slice& value, Encoder* encoder) {
+  // Other messages often carry per-call detail, and would only churn the
+  // table.
+  if (GrpcMessageMetadata::Interned(value.as_string_view()).has_value()) {
+    index_.EmitTo(GrpcMessageMetadata::key(), value, encoder);
+    return;
+  }
+  encoder->EmitLitHdrWithNonBinaryStringKeyNotIdx(
+      Slice::FromStaticString(GrpcMessageMetadata::key()), value.Ref());
+}
+
 void Encoder::Encode(const Slice& key, const Slice& value) {
+  static constexpr absl::string_view kAuthorizationKey = "authorization";
+  // Index of "authorization" in the HPACK static table.
+  static constexpr uint32_t kAuthorizationStaticIndex = 23;
   if (absl::EndsWith(key.as_string_view(), "-bin")) {
     EmitLitHdrWithBinaryStringKeyNotIdx(key.Ref(), value.Ref());
+  } else if (key.as_string_view() == kAuthorizationKey) {
+    // Credentials are kept out of every HPACK table, including those of
+    // intermediaries re-encoding the request (RFC 7541 section 7.1.3), so
+    // that they cannot be probed for by a compression oracle.
+    EmitLitHdrWithNonBinaryStringKeyNeverIdx(kAuthorizationStaticIndex,
+                                             value.Ref());
   } else {
     EmitLitHdrWithNonBinaryStringKeyNotIdx(key.Ref(), value.Ref());
   }
 }
 
+void Encoder::EncodeRequestPrefix(const grpc_metadata_batch& headers) {
+  const Slice* path = headers.get_pointer(HttpPathMetadata());
+  const Slice* authority = headers.get_pointer(HttpAuthorityMetadata());
+  const auto* method = headers.get_pointer(HttpMethodMetadata());
+  const auto* scheme = headers.get_pointer(HttpSchemeMetadata());
+  const auto* content_type = headers.get_pointer(ContentTypeMetadata());
+  const auto* te = headers.get_pointer(TeMetadata());
+  const Slice* user_agent = headers.get_pointer(UserAgentMetadata());
+  if (path == nullptr || authority == nullptr || method == nullptr ||
+      scheme == nullptr || content_type == nullptr || te == nullptr ||
+      user_agent == nullptr) {
+    return;
+  }
+  skip_request_prefix_ = true;
+  RequestPrefix& prefix =
+      compressor_->request_prefixes_[absl::HashOf(path->as_string_view()) %
+                                     HPackCompressor::kNumRequestPrefixes];
+  const uint64_t table_epoch = hpack_table().epoch();
+  if (prefix.table_epoch == table_epoch && !prefix.encoded.empty() &&
+      prefix.path == *path && prefix.authority == *authority &&
+      prefix.method == *method && prefix.scheme == *scheme &&
+      prefix.content_type == *content_type && prefix.te == *te &&
+      prefix.user_agent == *user_agent) {
+    output_.Append(prefix.encoded.Ref());
+    return;
+  }
+  SliceBuffer encoded;
+  Encoder encoder(compressor_, use_true_binary_metadata_, encoded);
+  encoder.Encode(HttpPathMetadata(), *path);
+  encoder.Encode(HttpAuthorityMetadata(), *authority);
+  encoder.Encode(HttpMethodMetadata(), *method);
+  encoder.Encode(HttpSchemeMetadata(), *scheme);
+  encoder.Encode(ContentTypeMetadata(), *content_type);
+  encoder.Encode(TeMetadata(), *te);
+  encoder.Encode(UserAgentMetadata(), *user_agent);
+  if (encoder.saw_encoding_errors()) {
+    NoteEncodingError();
+    output_.TakeAndAppend(encoded);
+    return;
+  }
+  if (hpack_table().epoch() != table_epoch || encoder.deferred_indexing()) {
+    // Some of the headers were, or will next time be, added to the table, so
+    // the next call will encode them differently.
+    prefix.encoded = Slice();
+    output_.TakeAndAppend(encoded);
+    return;
+  }
+  // Nothing was added to the table: every header was encoded as a reference
+  // to an existing entry or as a literal, and the same bytes stay valid until
+  // the table changes.
+  prefix.path = path->Ref();
+  prefix.authority = authority->Ref();
+  prefix.method = *method;
+  prefix.scheme = *scheme;
+  prefix.content_type = *content_type;
+  prefix.te = *te;
+  prefix.user_agent = user_agent->Ref();
+  prefix.table_epoch = table_epoch;
+  prefix.encoded = encoded.JoinIntoSlice();
+  output_.Append(prefix.encoded.Ref());
+}
+
 void Compressor<HttpSchemeMetadata, HttpSchemeCompressor>::EncodeWith(
     HttpSchemeMetadata, HttpSchemeMetadata::ValueType value, Encoder* encoder) {
   switch (value) {
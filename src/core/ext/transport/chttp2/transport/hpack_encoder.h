@@ -24,6 +24,7 @@
 #include <stddef.h>
 
 #include <cstdint>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -36,6 +37,7 @@
 #include "src/core/ext/transport/chttp2/transport/hpack_constants.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_encoder_table.h"
 #include "src/core/ext/transport/chttp2/transport/http2_ztrace_collector.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/slice/slice.h"
 #include "src/core/lib/slice/slice_buffer.h"
 #include "src/core/lib/transport/timeout_encoding.h"
@@ -50,6 +52,32 @@ class HPackCompressor;
 
 namespace hpack_encoder_detail {
 
+// Request headers that are the same on every call of a method, and are
+// encoded together by Encoder::EncodeRequestPrefix().
+template <typename MetadataTrait>
+inline constexpr bool kIsRequestPrefixTrait =
+    std::is_same_v<MetadataTrait, HttpPathMetadata> ||
+    std::is_same_v<MetadataTrait, HttpAuthorityMetadata> ||
+    std::is_same_v<MetadataTrait, HttpMethodMetadata> ||
+    std::is_same_v<MetadataTrait, HttpSchemeMetadata> ||
+    std::is_same_v<MetadataTrait, ContentTypeMetadata> ||
+    std::is_same_v<MetadataTrait, TeMetadata> ||
+    std::is_same_v<MetadataTrait, UserAgentMetadata>;
+
+// Encoded request prefix headers, along with the values they were encoded
+// from and the encoder table epoch they are valid in.
+struct RequestPrefix {
+  Slice path;
+  Slice authority;
+  HttpMethodMetadata::ValueType method = HttpMethodMetadata::kInvalid;
+  HttpSchemeMetadata::ValueType scheme = HttpSchemeMetadata::kInvalid;
+  ContentTypeMetadata::ValueType content_type = ContentTypeMetadata::kInvalid;
+  TeMetadata::ValueType te = TeMetadata::kInvalid;
+  Slice user_agent;
+  uint64_t table_epoch = 0;
+  Slice encoded;
+};
+
 class Encoder {
  public:
   Encoder(HPackCompressor* compressor, bool use_true_binary_metadata,
@@ -59,6 +87,12 @@ class Encoder {
   template <typename MetadataTrait>
   void Encode(MetadataTrait, const typename MetadataTrait::ValueType& value);
 
+  // If headers carry all the request prefix headers, emit them first, and
+  // skip them when headers are encoded afterwards. The encoding is replayed
+  // from a cache when the same values were last encoded in the current table
+  // epoch.
+  void EncodeRequestPrefix(const grpc_metadata_batch& headers);
+
   void AdvertiseTableSizeChange();
   void EmitIndexed(uint32_t index);
   GRPC_MUST_USE_RESULT
@@ -72,6 +106,8 @@ class Encoder {
                                            Slice value_slice);
   void EmitLitHdrWithNonBinaryStringKeyNotIdx(Slice key_slice,
                                               Slice value_slice);
+  void EmitLitHdrWithNonBinaryStringKeyNeverIdx(uint32_t key_index,
+                                                Slice value_slice);
 
   void EncodeAlwaysIndexed(uint32_t* index, absl::string_view key, Slice value,
                            size_t transport_length);
@@ -85,11 +121,19 @@ class Encoder {
   void NoteEncodingError() { saw_encoding_errors_ = true; }
   bool saw_encoding_errors() const { return saw_encoding_errors_; }
 
+  // Notes that a header was sent as a literal because its value was not yet
+  // admitted to the table, so the next send may encode it differently.
+  void NoteDeferredIndexing() { deferred_indexing_ = true; }
+  bool deferred_indexing() const { return deferred_indexing_; }
+
   HPackEncoderTable& hpack_table();
+  bool admission_control() const;
 
  private:
   const bool use_true_binary_metadata_;
   bool saw_encoding_errors_ = false;
+  bool deferred_indexing_ = false;
+  bool skip_request_prefix_ = false;
   HPackCompressor* const compressor_;
   SliceBuffer& output_;
 };
@@ -257,13 +301,25 @@ class SliceIndex {
   void EmitTo(absl::string_view key, const Slice& value, Encoder* encoder);
 
  private:
+  // Values seen once and not yet admitted to the table, when admission
+  // control is on.
+  static constexpr size_t kNumSeenValues = 16;
+
   struct ValueIndex {
     ValueIndex(Slice value, uint32_t index)
         : value(std::move(value)), index(index) {}
     Slice value;
     uint32_t index;
   };
+
+  // Returns true if a value with this hash was seen recently and should now
+  // be added to the table; otherwise remembers it.
+  bool Admit(size_t hash);
+
   std::vector<ValueIndex> values_;
+  // Hashes of the values seen once, oldest overwritten first.
+  size_t seen_values_[kNumSeenValues] = {};
+  size_t next_seen_value_ = 0;
 };
 
 template <typename MetadataTrait>
@@ -277,6 +333,15 @@ class Compressor<MetadataTrait, SmallSetOfValuesCompressor> {
   SliceIndex index_;
 };
 
+template <>
+class Compressor<GrpcMessageMetadata, GrpcMessageCompressor> {
+ public:
+  void EncodeWith(GrpcMessageMetadata, const Slice& value, Encoder* encoder);
+
+ private:
+  SliceIndex index_;
+};
+
 struct PreviousTimeout {
   Timeout timeout = Timeout::FromDuration(Duration::Zero());
   // Dynamic table index of a previously sent timeout
@@ -344,6 +409,11 @@ class HPackCompressor {
   void SetMaxTableSize(uint32_t max_table_size);
   void SetMaxUsableSize(uint32_t max_table_size);
 
+  // When enabled, values of headers that vary between calls are added to the
+  // table only when they are sent for the second time, so that one-off values
+  // do not evict entries that are reused.
+  void set_admission_control(bool enabled) { admission_control_ = enabled; }
+
   uint32_t test_only_table_size() const {
     return table_.test_only_table_size();
   }
@@ -363,7 +433,7 @@ class HPackCompressor {
     SliceBuffer raw;
     hpack_encoder_detail::Encoder encoder(
         this, options.use_true_binary_metadata, raw);
-    headers.Encode(&encoder);
+    Encode(headers, encoder);
     Frame(options, raw, output);
     return !encoder.saw_encoding_errors();
   }
@@ -371,15 +441,27 @@ class HPackCompressor {
   template <typename HeaderSet>
   bool EncodeRawHeaders(const HeaderSet& headers, SliceBuffer& output) {
     hpack_encoder_detail::Encoder encoder(this, true, output);
-    headers.Encode(&encoder);
+    Encode(headers, encoder);
     return !encoder.saw_encoding_errors();
   }
 
  private:
   static constexpr size_t kNumFilterValues = 64;
   static constexpr uint32_t kNumCachedGrpcStatusValues = 16;
+  static constexpr size_t kNumRequestPrefixes = 16;
   friend class hpack_encoder_detail::Encoder;
 
+  template <typename HeaderSet>
+  static void Encode(const HeaderSet& headers,
+                     hpack_encoder_detail::Encoder& encoder) {
+    if constexpr (std::is_same_v<HeaderSet, grpc_metadata_batch>) {
+      if (IsHpackEncoderPrefixCacheEnabled()) {
+        encoder.EncodeRequestPrefix(headers);
+      }
+    }
+    headers.Encode(&encoder);
+  }
+
   void Frame(const EncodeHeaderOptions& options, SliceBuffer& raw,
              grpc_slice_buffer* output);
 
@@ -389,10 +471,13 @@ class HPackCompressor {
   // if non-zero, advertise to the decoder that we'll start using a table
   // of this size
   bool advertise_table_size_change_ = false;
+  bool admission_control_ = false;
   HPackEncoderTable table_;
 
   grpc_metadata_batch::StatefulCompressor<hpack_encoder_detail::Compressor>
       compression_state_;
+  // Indexed by a hash of :path.
+  hpack_encoder_detail::RequestPrefix request_prefixes_[kNumRequestPrefixes];
 };
 
 namespace hpack_encoder_detail {
@@ -400,6 +485,9 @@ namespace hpack_encoder_detail {
 template <typename MetadataTrait>
 void Encoder::Encode(MetadataTrait,
                      const typename MetadataTrait::ValueType& value) {
+  if constexpr (kIsRequestPrefixTrait<MetadataTrait>) {
+    if (skip_request_prefix_) return;
+  }
   compressor_->compression_state_
       .Compressor<MetadataTrait, typename MetadataTrait::CompressionTraits>::
           EncodeWith(MetadataTrait(), value, this);
@@ -407,6 +495,10 @@ void Encoder::Encode(MetadataTrait,
 
 inline HPackEncoderTable& Encoder::hpack_table() { return compressor_->table_; }
 
+inline bool Encoder::admission_control() const {
+  return compressor_->admission_control_;
+}
+
 }  // namespace hpack_encoder_detail
 
 }  // namespace grpc_core
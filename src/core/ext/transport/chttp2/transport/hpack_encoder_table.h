@@ -50,6 +50,10 @@ class HPackEncoderTable {
   uint32_t test_only_table_size() const { return table_size_; }
   // Get the number of entries in the table
   uint32_t test_only_table_elems() const { return table_elems_; }
+  // Changes whenever the dynamic index of any entry may have changed, so
+  // encoded headers referring to dynamic indices are only valid for the epoch
+  // they were encoded in.
+  uint64_t epoch() const { return epoch_; }
 
   // Convert an element index into a dynamic index
   uint32_t DynamicIndex(uint32_t index) const {
@@ -71,6 +75,7 @@ class HPackEncoderTable {
   uint32_t max_table_size_ = hpack_constants::kInitialTableSize;
   uint32_t table_elems_ = 0;
   uint32_t table_size_ = 0;
+  uint64_t epoch_ = 0;
   // The size of each element in the HPACK table.
   std::vector<EntrySize> elem_size_;
 };
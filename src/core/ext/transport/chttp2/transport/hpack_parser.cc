@@ -45,6 +45,7 @@
 #include "src/core/ext/transport/chttp2/transport/hpack_parse_result.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_parser_table.h"
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/slice/slice.h"
 #include "src/core/lib/slice/slice_refcount.h"
 #include "src/core/lib/surface/validate_metadata.h"
@@ -81,6 +82,24 @@ struct Base64InverseTable {
 
 constexpr Base64InverseTable kBase64InverseTable;
 
+// The inverse table as four tables, one per position in a group of four
+// characters, holding each value already shifted into place.  A group decodes
+// to the OR of four lookups, and an invalid character anywhere in it sets the
+// top bit.
+struct Base64ShiftedInverseTables {
+  uint32_t tables[4][256]{};
+  constexpr Base64ShiftedInverseTables() {
+    for (int pos = 0; pos < 4; pos++) {
+      for (int i = 0; i < 256; i++) {
+        const uint32_t bits = kBase64InverseTable.table[i];
+        tables[pos][i] = bits > 63 ? 0x80000000u : bits << (18 - 6 * pos);
+      }
+    }
+  }
+};
+
+constexpr Base64ShiftedInverseTables kBase64ShiftedInverseTables;
+
 }  // namespace
 
 // Input tracks the current byte through the input data and provides it
@@ -405,31 +424,19 @@ std::optional<std::vector<uint8_t>> HPackParser::String::Unbase64Loop(
   std::vector<uint8_t> out;
   out.reserve((3 * (end - cur) / 4) + 3);
 
-  // Decode 4 bytes at a time while we can
+  // Decode 4 bytes at a time while we can, straight into the output.
+  out.resize(3 * ((end - cur) / 4));
+  uint8_t* out_cur = out.data();
+  const auto& tables = kBase64ShiftedInverseTables.tables;
   while (end - cur >= 4) {
-    uint32_t bits = kBase64InverseTable.table[*cur];
-    if (bits > 63) return {};
-    uint32_t buffer = bits << 18;
-    ++cur;
-
-    bits = kBase64InverseTable.table[*cur];
-    if (bits > 63) return {};
-    buffer |= bits << 12;
-    ++cur;
-
-    bits = kBase64InverseTable.table[*cur];
-    if (bits > 63) return {};
-    buffer |= bits << 6;
-    ++cur;
-
-    bits = kBase64InverseTable.table[*cur];
-    if (bits > 63) return {};
-    buffer |= bits;
-    ++cur;
-
-    out.insert(out.end(), {static_cast<uint8_t>(buffer >> 16),
-                           static_cast<uint8_t>(buffer >> 8),
-                           static_cast<uint8_t>(buffer)});
+    const uint32_t buffer = tables[0][cur[0]] | tables[1][cur[1]] |
+                            tables[2][cur[2]] | tables[3][cur[3]];
+    if (buffer & 0x80000000u) return {};
+    out_cur[0] = static_cast<uint8_t>(buffer >> 16);
+    out_cur[1] = static_cast<uint8_t>(buffer >> 8);
+    out_cur[2] = static_cast<uint8_t>(buffer);
+    out_cur += 3;
+    cur += 4;
   }
   // Deal with the last 0, 1, 2, or 3 bytes.
   switch (end - cur) {
@@ -510,6 +517,24 @@ HPackParser::String::StringResult HPackParser::String::Parse(Input* input,
   return ParseUncompressed(input, length, length);
 }
 
+HPackParser::String::StringResult HPackParser::String::ParseKey(
+    Input* input, bool is_huff, size_t length, bool* all_bytes_legal) {
+  *all_bytes_legal = false;
+  if (is_huff) {
+    std::vector<uint8_t> output;
+    bool legal = true;
+    HpackParseStatus sts =
+        ParseHuff(input, length, [&output, &legal](uint8_t c) {
+          output.push_back(c);
+          legal &= IsLegalHeaderKeyByte(c);
+        });
+    *all_bytes_legal = legal && !output.empty();
+    size_t wire_len = output.size();
+    return StringResult{sts, wire_len, String(std::move(output))};
+  }
+  return ParseUncompressed(input, length, length);
+}
+
 HPackParser::String::StringResult HPackParser::String::ParseBinary(
     Input* input, bool is_huff, size_t length) {
   if (!is_huff) {
@@ -853,8 +878,9 @@ class HPackParser::Parser {
 
   bool ParseKeyBody() {
     DCHECK(state_.parse_state == ParseState::kParsingKeyBody);
-    auto key = String::Parse(input_, state_.is_string_huff_compressed,
-                             state_.string_length);
+    bool all_key_bytes_legal;
+    auto key = String::ParseKey(input_, state_.is_string_huff_compressed,
+                                state_.string_length, &all_key_bytes_legal);
     switch (key.status) {
       case HpackParseStatus::kOk:
         break;
@@ -869,6 +895,11 @@ class HPackParser::Parser {
     input_->UpdateFrontier();
     state_.parse_state = ParseState::kParsingValueLength;
     state_.is_binary_header = absl::EndsWith(key.value.string_view(), "-bin");
+    // Validating here rather than with the value means a value that arrives
+    // across several reads does not revalidate its key on every attempt.
+    state_.key_validation = all_key_bytes_legal
+                                ? ValidateMetadataResult::kOk
+                                : ValidateKey(key.value.string_view());
     state_.key.emplace<Slice>(key.value.Take());
     return ParseValueLength();
   }
@@ -962,12 +993,11 @@ class HPackParser::Parser {
     absl::string_view key_string;
     if (auto* s = std::get_if<Slice>(&state_.key)) {
       key_string = s->as_string_view();
-      if (state_.field_error.ok()) {
-        auto r = ValidateKey(key_string);
-        if (r != ValidateMetadataResult::kOk) {
-          input_->SetErrorAndContinueParsing(
-              HpackParseResult::InvalidMetadataError(r, key_string));
-        }
+      if (state_.field_error.ok() &&
+          state_.key_validation != ValidateMetadataResult::kOk) {
+        input_->SetErrorAndContinueParsing(
+            HpackParseResult::InvalidMetadataError(state_.key_validation,
+                                                   key_string));
       }
     } else {
       const auto* memento = std::get<const HPackTable::Memento*>(state_.key);
@@ -995,10 +1025,22 @@ class HPackParser::Parser {
       }
     }
     auto value_slice = value.value.Take();
+    bool will_keep_past_request_lifetime = state_.add_to_table;
+    if (state_.add_to_table && IsHpackSharedValuesEnabled()) {
+      // Interned values never share memory with the frame they were read
+      // from, so they need not be copied again to outlive the request.
+      value_slice = HPackSharedValues::Get()->Intern(std::move(value_slice));
+      will_keep_past_request_lifetime = false;
+    }
     const auto transport_size =
         key_string.size() + value.wire_size + hpack_constants::kEntryOverhead;
+    // Values are parsed here, not when a filter first reads them: a parsed
+    // entry that lands in the dynamic table is reused by every later
+    // reference to it, so headers that repeat across requests are parsed
+    // once per connection.  Deferring the parse would repeat it per request.
     auto md = grpc_metadata_batch::Parse(
-        key_string, std::move(value_slice), state_.add_to_table, transport_size,
+        key_string, std::move(value_slice), will_keep_past_request_lifetime,
+        transport_size,
         [key_string, this](absl::string_view message, const Slice&) {
           if (!state_.field_error.ok()) return;
           input_->SetErrorAndContinueParsing(
@@ -152,6 +152,12 @@ class HPackParser {
     // Parse a binary string
     static StringResult ParseBinary(Input* input, bool is_huff, size_t length);
 
+    // Parse a header key. Huffman coded keys are checked for legal key bytes
+    // as they are decoded, and *all_bytes_legal says whether they all were;
+    // it is always false for keys sent as-is, which the caller must check.
+    static StringResult ParseKey(Input* input, bool is_huff, size_t length,
+                                 bool* all_bytes_legal);
+
    private:
     void AppendBytes(const uint8_t* data, size_t length);
     explicit String(std::vector<uint8_t> v) : value_(std::move(v)) {}
@@ -251,6 +257,8 @@ class HPackParser {
     // Current parse state
     ParseState parse_state = ParseState::kTop;
     std::variant<const HPackTable::Memento*, Slice> key;
+    // Legality of key, when it is a literal
+    ValidateMetadataResult key_validation;
   };
 
   grpc_error_handle ParseInput(Input input, bool is_last,
@@ -26,6 +26,8 @@
 #include <cstring>
 #include <utility>
 
+#include "absl/container/flat_hash_map.h"
+#include "absl/hash/hash.h"
 #include "absl/log/check.h"
 #include "absl/log/log.h"
 #include "absl/status/status.h"
@@ -36,6 +38,8 @@
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/slice/slice.h"
 #include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
+#include "src/core/util/sync.h"
 
 namespace grpc_core {
 
@@ -196,6 +200,47 @@ std::string HPackTable::TestOnlyDynamicTableAsString() const {
   return out;
 }
 
+Slice HPackSharedValues::Intern(Slice value) {
+  const absl::string_view bytes = value.as_string_view();
+  if (bytes.size() < kMinValueLength || bytes.size() > kMaxValueLength) {
+    return value.TakeUniquelyOwned();
+  }
+  Shard& shard = shards_[absl::HashOf(bytes) % kNumShards];
+  MutexLock lock(&shard.mu);
+  auto it = shard.values.find(bytes);
+  if (it != shard.values.end()) {
+    global_stats().IncrementHttp2HpackSharedValueSize(bytes.size());
+    return it->second.Ref();
+  }
+  if (shard.values.size() >= kMaxValuesPerShard) {
+    if (shard.values_until_sweep > 0) {
+      --shard.values_until_sweep;
+      return value.TakeUniquelyOwned();
+    }
+    // New references are only taken from existing ones or under the lock, so
+    // a value referenced only by the pool cannot be picked up concurrently.
+    absl::erase_if(shard.values, [](const auto& entry) {
+      return entry.second.c_slice().refcount->IsUnique();
+    });
+    shard.values_until_sweep = kValuesPerSweep;
+    if (shard.values.size() >= kMaxValuesPerShard) {
+      return value.TakeUniquelyOwned();
+    }
+  }
+  Slice copy = Slice::FromCopiedBuffer(bytes.data(), bytes.size());
+  shard.values.emplace(copy.as_string_view(), copy.Ref());
+  return copy;
+}
+
+size_t HPackSharedValues::TestOnlyNumValues() {
+  size_t num_values = 0;
+  for (Shard& shard : shards_) {
+    MutexLock lock(&shard.mu);
+    num_values += shard.values.size();
+  }
+  return num_values;
+}
+
 namespace {
 struct StaticTableEntry {
   const char* key;
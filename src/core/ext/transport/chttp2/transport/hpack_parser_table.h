@@ -19,7 +19,9 @@
 #ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_HPACK_PARSER_TABLE_H
 #define GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_HPACK_PARSER_TABLE_H
 
+#include <grpc/slice.h>
 #include <grpc/support/port_platform.h>
+#include <stddef.h>
 #include <stdint.h>
 
 #include <cstdint>
@@ -28,12 +30,17 @@
 #include <string>
 #include <vector>
 
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
 #include "absl/functional/function_ref.h"
+#include "absl/strings/string_view.h"
 #include "src/core/call/metadata_batch.h"
 #include "src/core/call/parsed_metadata.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_constants.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_parse_result.h"
+#include "src/core/lib/slice/slice.h"
 #include "src/core/util/no_destruct.h"
+#include "src/core/util/sync.h"
 #include "src/core/util/unique_ptr_with_bitset.h"
 
 namespace grpc_core {
@@ -175,6 +182,53 @@ class HPackTable {
   const StaticMementos* static_mementos_ = GetStaticMementos();
 };
 
+// Process-wide pool of the header values held by HPACK dynamic tables.
+// Connections that add the same value to their tables (user-agent, authority,
+// ...) reference a single copy of it instead of each holding its own.
+class HPackSharedValues {
+ public:
+  // Shorter values are inlined into their slices, so there is nothing to
+  // share. Longer values are rarely repeated across connections.
+  static constexpr size_t kMinValueLength = GRPC_SLICE_INLINED_SIZE + 1;
+  static constexpr size_t kMaxValueLength = 256;
+  // Once a shard holds this many values, the ones no table references anymore
+  // are dropped before adding another.
+  static constexpr size_t kMaxValuesPerShard = 1024;
+  // After a sweep, this many values that find the shard full again are copied
+  // privately before the next sweep, so that a shard full of referenced values
+  // is not swept on every insert.
+  static constexpr size_t kValuesPerSweep = kMaxValuesPerShard / 4;
+
+  HPackSharedValues() = default;
+  HPackSharedValues(const HPackSharedValues&) = delete;
+  HPackSharedValues& operator=(const HPackSharedValues&) = delete;
+
+  static HPackSharedValues* Get() {
+    static NoDestruct<HPackSharedValues> shared_values;
+    return shared_values.get();
+  }
+
+  // Returns a slice with the contents of value that does not share memory
+  // with value, so it can be kept for as long as the table entry lives.
+  // If an equal value is in the pool, a reference to it is returned.
+  Slice Intern(Slice value);
+
+  size_t TestOnlyNumValues();
+
+ private:
+  static constexpr size_t kNumShards = 16;
+
+  struct Shard {
+    Mutex mu;
+    // Keys view the bytes of the slice they map to.
+    absl::flat_hash_map<absl::string_view, Slice> values ABSL_GUARDED_BY(mu);
+    // Values left to copy privately before the next sweep.
+    size_t values_until_sweep ABSL_GUARDED_BY(mu) = 0;
+  };
+
+  Shard shards_[kNumShards];
+};
+
 }  // namespace grpc_core
 
 #endif  // GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_HPACK_PARSER_TABLE_H
@@ -342,7 +342,7 @@ auto Http2ClientTransport::OnReadLoopEnded() {
 auto Http2ClientTransport::WriteFromQueue() {
   HTTP2_CLIENT_DLOG << "Http2ClientTransport WriteFromQueue Factory";
   return TrySeq(
-      outgoing_frames_.NextBatch(128),
+      outgoing_frames_.NextBatch(kMaxWriteBatchSize),
       [self = RefAsSubclass<Http2ClientTransport>()](
           std::vector<Http2Frame> frames) {
         SliceBuffer output_buf;
@@ -413,6 +413,7 @@ Http2ClientTransport::Http2ClientTransport(
     std::shared_ptr<EventEngine> event_engine)
     : endpoint_(std::move(endpoint)),
       outgoing_frames_(kMpscSize),
+      outgoing_frames_sender_(outgoing_frames_.MakeSender()),
       stream_id_mutex_(/*Initial Stream Id*/ 1),
       bytes_sent_in_last_write_(false),
       keepalive_time_(std::max(
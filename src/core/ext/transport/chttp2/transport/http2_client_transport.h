@@ -115,10 +115,8 @@ class Http2ClientTransport final : public ClientTransport {
   }
 
   auto TestOnlyEnqueueOutgoingFrame(Http2Frame frame) {
-    // TODO(tjagtap) : [PH2][P3] : See if making a sender in the constructor
-    // and using that always would be more efficient.
     return AssertResultType<absl::Status>(Map(
-        outgoing_frames_.MakeSender().Send(std::move(frame), 1),
+        outgoing_frames_sender_.Send(std::move(frame), 1),
         [](StatusFlag status) {
           HTTP2_CLIENT_DLOG
               << "Http2ClientTransport::TestOnlyEnqueueOutgoingFrame status="
@@ -181,11 +179,11 @@ class Http2ClientTransport final : public ClientTransport {
                         ClientMetadataHandle metadata);
 
   // Returns a promise to enqueue a frame to MPSC
+  // All calls share one sender: making a sender per frame would add a pair of
+  // atomic operations on the queue's shared refcount to every frame.
   auto EnqueueOutgoingFrame(Http2Frame frame) {
-    // TODO(tjagtap) : [PH2][P3] : See if making a sender in the constructor
-    // and using that always would be more efficient.
     return AssertResultType<absl::Status>(Map(
-        outgoing_frames_.MakeSender().Send(std::move(frame), 1),
+        outgoing_frames_sender_.Send(std::move(frame), 1),
         [self = RefAsSubclass<Http2ClientTransport>()](StatusFlag status) {
           HTTP2_CLIENT_DLOG
               << "Http2ClientTransport::EnqueueOutgoingFrame status=" << status;
@@ -237,6 +235,9 @@ class Http2ClientTransport final : public ClientTransport {
   }
 
   MpscReceiver<Http2Frame> outgoing_frames_;
+  // Sender half of outgoing_frames_. Sends are thread safe, so calls running
+  // on different parties can use it concurrently.
+  MpscSender<Http2Frame> outgoing_frames_sender_;
 
   Mutex transport_mutex_;
   // TODO(tjagtap) : [PH2][P2] : Add to map in StartCall and clean this
@@ -479,7 +480,7 @@ class Http2ClientTransport final : public ClientTransport {
 // remain within that range. When this check fails, please update it to size
 // (current size + 32) to make sure that it does not fail each time we add a
 // small variable to the class.
-GRPC_CHECK_CLASS_SIZE(Http2ClientTransport, 600);
+GRPC_CHECK_CLASS_SIZE(Http2ClientTransport, 608);
 
 }  // namespace http2
 }  // namespace grpc_core
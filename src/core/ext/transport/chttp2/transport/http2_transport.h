@@ -51,8 +51,15 @@ namespace http2 {
 #define HTTP2_SERVER_DLOG \
   DLOG_IF(INFO, GRPC_TRACE_FLAG_ENABLED(http2_ph2_transport))
 
-// TODO(akshitpatel) : [PH2][P2] : Choose appropriate size later.
-constexpr int kMpscSize = 10;
+// Maximum number of frames the write loop takes off the outgoing frame queue
+// for one endpoint write.
+constexpr int kMaxWriteBatchSize = 128;
+
+// Number of frames that may be queued for the write loop before the calls
+// sending them block. With many concurrent streams, a smaller queue parks most
+// senders until the write loop wakes them, even though the next write would
+// have taken all of their frames.
+constexpr int kMpscSize = kMaxWriteBatchSize;
 
 enum class HttpStreamState : uint8_t {
   // https://www.rfc-editor.org/rfc/rfc9113.html#name-stream-states
@@ -60,6 +60,7 @@
 #include "src/core/ext/transport/chttp2/transport/write_size_policy.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/event_engine/extensions/tcp_info.h"
 #include "src/core/lib/iomgr/closure.h"
 #include "src/core/lib/iomgr/combiner.h"
 #include "src/core/lib/iomgr/endpoint.h"
@@ -75,12 +76,14 @@
 #include "src/core/lib/transport/transport_framing_endpoint_extension.h"
 #include "src/core/telemetry/call_tracer.h"
 #include "src/core/telemetry/context_list_entry.h"
+#include "src/core/telemetry/metrics.h"
 #include "src/core/telemetry/stats.h"
 #include "src/core/util/bitset.h"
 #include "src/core/util/debug_location.h"
 #include "src/core/util/ref_counted.h"
 #include "src/core/util/ref_counted_ptr.h"
 #include "src/core/util/time.h"
+#include "src/core/util/time_precise.h"
 
 // Flag that this closure barrier may be covering a write in a pollset, and so
 //   we should not complete this closure until we can prove that the write got
@@ -290,6 +293,11 @@ struct grpc_chttp2_transport final : public grpc_core::FilterStackTransport,
 
   grpc_core::TransportFramingEndpointExtension*
       transport_framing_endpoint_extension = nullptr;
+  // Set when BDP probes are timed by the kernel's RTT estimate rather than by
+  // pings, or when TCP_INFO is sampled for metrics. Points into ep, so it is
+  // cleared together with ep when the transport closes.
+  grpc_event_engine::experimental::TcpInfoExtension* tcp_info_extension =
+      nullptr;
 
   grpc_core::MemoryOwner memory_owner;
   const grpc_core::MemoryAllocator::Reservation self_reservation;
@@ -345,6 +353,8 @@ struct grpc_chttp2_transport final : public grpc_core::FilterStackTransport,
 
   grpc_closure write_action_begin_locked;
   grpc_closure write_action_end_locked;
+  grpc_closure write_buffer_flush_locked;
+  grpc_closure tcp_info_sample_locked;
 
   grpc_closure read_action_locked;
 
@@ -378,6 +388,11 @@ struct grpc_chttp2_transport final : public grpc_core::FilterStackTransport,
 
   size_t max_requests_per_read;
 
+  /// The largest message the message size filter would let through on this
+  /// transport, if there is a limit. Longer messages fail their stream as
+  /// soon as their length prefix is read, rather than once they are buffered.
+  std::optional<uint32_t> max_recv_message_size;
+
   /// Set to a grpc_error object if a goaway frame is received. By default, set
   /// to absl::OkStatus()
   grpc_error_handle goaway_error;
@@ -475,6 +490,8 @@ struct grpc_chttp2_transport final : public grpc_core::FilterStackTransport,
   // buffer pool state
   /// benign cleanup closure
   grpc_closure benign_reclaimer_locked;
+  /// idle cleanup closure
+  grpc_closure idle_reclaimer_locked;
   /// destructive cleanup closure
   grpc_closure destructive_reclaimer_locked;
 
@@ -494,6 +511,14 @@ struct grpc_chttp2_transport final : public grpc_core::FilterStackTransport,
           grpc_event_engine::experimental::EventEngine::TaskHandle::kInvalid;
   /// time duration in between pings
   grpc_core::Duration keepalive_time;
+  /// upper bound for current_keepalive_time
+  grpc_core::Duration keepalive_max_idle_time;
+  /// time duration until the next ping: keepalive_time, doubled for every
+  /// keepalive ping acked without any other data having been received
+  grpc_core::Duration current_keepalive_time;
+  /// true if a frame other than a ping ack has been received since the
+  /// last keepalive ping was sent
+  bool keepalive_data_received = false;
   /// Tracks any adjustments to the absolute timestamp of the next keepalive
   /// timer callback execution.
   grpc_core::Timestamp next_adjusted_keepalive_timestamp;
@@ -506,6 +531,9 @@ struct grpc_chttp2_transport final : public grpc_core::FilterStackTransport,
   grpc_chttp2_keepalive_state keepalive_state;
   // Soft limit on max header size.
   uint32_t max_header_list_size_soft_limit = 0;
+  // The HPACK table size advertised before the benign reclaimer asked the
+  // peer to empty the table of this idle transport, or 0.
+  uint32_t reclaimed_header_table_size = 0;
   grpc_core::ContextList* context_list = nullptr;
   grpc_core::RefCountedPtr<grpc_core::channelz::SocketNode> channelz_socket;
   std::unique_ptr<ChannelzDataSource> channelz_data_source;
@@ -528,12 +556,32 @@ struct grpc_chttp2_transport final : public grpc_core::FilterStackTransport,
 
   /// how much data are we willing to buffer when the WRITE_BUFFER_HINT is set?
   uint32_t write_buffer_size = grpc_core::chttp2::kDefaultWindow;
+  /// how long may buffered data wait for more writes before it is flushed?
+  /// zero leaves it buffered until a write without the hint
+  grpc_core::Duration write_buffer_flush_delay;
+  grpc_event_engine::experimental::EventEngine::TaskHandle
+      write_buffer_flush_timer_handle =
+          grpc_event_engine::experimental::EventEngine::TaskHandle::kInvalid;
+
+  /// how often TCP_INFO is sampled for metrics; zero disables sampling
+  grpc_core::Duration tcp_info_sample_interval;
+  grpc_event_engine::experimental::EventEngine::TaskHandle
+      tcp_info_sample_timer_handle =
+          grpc_event_engine::experimental::EventEngine::TaskHandle::kInvalid;
+  /// total_retransmits of the previous sample, to report the increase
+  uint32_t tcp_info_last_total_retransmits = 0;
+  std::shared_ptr<grpc_core::GlobalStatsPluginRegistry::StatsPluginGroup>
+      stats_plugin_group;
 
   /// write execution state of the transport
   grpc_chttp2_write_state write_state = GRPC_CHTTP2_WRITE_STATE_IDLE;
+  /// when the current endpoint write was started
+  gpr_cycle_counter endpoint_write_start_cycle = 0;
 
   /// policy for how much data we're willing to put into one http2 write
   grpc_core::Chttp2WriteSizePolicy write_size_policy;
+  /// number of times a write was initiated since the last write began
+  uint32_t num_write_initiations = 0;
 
   bool reading_paused_on_pending_induced_frames = false;
   /// Based on channel args, preferred_rx_crypto_frame_sizes are advertised to
@@ -546,6 +594,8 @@ struct grpc_chttp2_transport final : public grpc_core::FilterStackTransport,
 
   /// have we scheduled a benign cleanup?
   bool benign_reclaimer_registered = false;
+  /// have we scheduled an idle cleanup?
+  bool idle_reclaimer_registered = false;
   /// have we scheduled a destructive cleanup?
   bool destructive_reclaimer_registered = false;
 
@@ -572,6 +622,14 @@ struct grpc_chttp2_transport final : public grpc_core::FilterStackTransport,
   /// MAX_CONCURRENT_STREAMS
   bool max_concurrent_streams_overload_protection = false;
   bool max_concurrent_streams_reject_on_client = false;
+  /// True if a server lowers MAX_CONCURRENT_STREAMS under memory pressure
+  bool adaptive_max_concurrent_streams = false;
+  /// MAX_CONCURRENT_STREAMS as configured, which the adaptive limit never
+  /// exceeds
+  uint32_t configured_max_concurrent_streams;
+  /// Earliest time at which the adaptive limit is recomputed
+  grpc_core::Timestamp next_adaptive_max_concurrent_streams_update =
+      grpc_core::Timestamp::InfPast();
 
   // What percentage of rst_stream frames on the server should cause a ping
   // frame to be generated.
@@ -681,6 +739,9 @@ struct grpc_chttp2_stream {
   grpc_core::chttp2::StreamFlowControl flow_control;
 
   grpc_slice_buffer flow_controlled_buffer;
+  /// when a message was queued into an empty flow_controlled_buffer; zero
+  /// once a write starts sending it
+  gpr_cycle_counter send_message_queued_cycle = 0;
 
   grpc_chttp2_write_cb* on_flow_controlled_cbs = nullptr;
   grpc_chttp2_write_cb* on_write_finished_cbs = nullptr;
@@ -693,6 +754,11 @@ struct grpc_chttp2_stream {
   /// Number of times written
   int64_t write_counter = 0;
 
+  /// Multiple of the peer's max frame size this stream may frame each time it
+  /// is taken off the writable list (chttp2_weighted_write_scheduling).
+  /// One more than the call's write priority.
+  uint8_t write_weight = 1;
+
   grpc_core::Chttp2CallTracerWrapper call_tracer_wrapper;
   // null by default, set by the transport data source upon first query
   grpc_core::RefCountedPtr<grpc_core::channelz::CallNode> channelz_call_node;
@@ -744,6 +810,12 @@ struct grpc_chttp2_stream {
 #define GRPC_ARG_MAX_CONCURRENT_STREAMS_REJECT_ON_CLIENT \
   "grpc.http.max_concurrent_streams_reject_on_client"
 
+// EXPERIMENTAL: on servers, lower the advertised MAX_CONCURRENT_STREAMS of
+// each connection as memory pressure rises, so that clients stop opening
+// streams before calls have to be rejected.
+#define GRPC_ARG_HTTP2_ADAPTIVE_MAX_CONCURRENT_STREAMS \
+  "grpc.http2.adaptive_max_concurrent_streams"
+
 /// Transport writing call flow:
 /// grpc_chttp2_initiate_write() is called anywhere that we know bytes need to
 /// go out on the wire.
@@ -787,6 +859,18 @@ void grpc_chttp2_act_on_flowctl_action(
     const grpc_core::chttp2::FlowControlAction& action,
     grpc_chttp2_transport* t, grpc_chttp2_stream* s);
 
+// The MAX_CONCURRENT_STREAMS a server connection with \a open_streams
+// streams should advertise at \a memory_pressure, given the configured
+// \a max_concurrent_streams.
+uint32_t grpc_chttp2_adaptive_max_concurrent_streams(
+    uint32_t max_concurrent_streams, size_t open_streams,
+    double memory_pressure);
+
+// If adaptive MAX_CONCURRENT_STREAMS is enabled, recomputes the limit and
+// queues a SETTINGS frame if it changed.
+void grpc_chttp2_maybe_update_max_concurrent_streams(
+    grpc_chttp2_transport* t);
+
 //******** End of Flow Control **************
 
 inline grpc_chttp2_stream* grpc_chttp2_parsing_lookup_stream(
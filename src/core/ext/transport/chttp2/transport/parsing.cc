@@ -213,6 +213,7 @@ std::variant<size_t, absl::Status> grpc_chttp2_perform_read(
     grpc_chttp2_transport* t, const grpc_slice& slice,
     size_t& requests_started) {
   GRPC_LATENT_SEE_INNER_SCOPE("grpc_chttp2_perform_read");
+  constexpr ptrdiff_t kFrameHeaderSize = 9;
 
   const uint8_t* beg = GRPC_SLICE_START_PTR(slice);
   const uint8_t* end = GRPC_SLICE_END_PTR(slice);
@@ -274,6 +275,23 @@ std::variant<size_t, absl::Status> grpc_chttp2_perform_read(
       [[fallthrough]];
     case GRPC_DTS_FH_0:
       DCHECK_LT(cur, end);
+      if (end - cur >= kFrameHeaderSize) {
+        // Fast path: the whole frame header is in this slice, as it is for
+        // all but the occasional frame that straddles two reads, so decode it
+        // in one go rather than a byte and a state transition at a time.
+        t->incoming_frame_size = (static_cast<uint32_t>(cur[0]) << 16) |
+                                 (static_cast<uint32_t>(cur[1]) << 8) |
+                                 static_cast<uint32_t>(cur[2]);
+        t->incoming_frame_type = cur[3];
+        t->incoming_frame_flags = cur[4];
+        t->incoming_stream_id = ((static_cast<uint32_t>(cur[5]) & 0x7f) << 24) |
+                                (static_cast<uint32_t>(cur[6]) << 16) |
+                                (static_cast<uint32_t>(cur[7]) << 8) |
+                                static_cast<uint32_t>(cur[8]);
+        // Leave cur on the last header byte, as the slow path does.
+        cur += kFrameHeaderSize - 1;
+        goto dts_fh_done;
+      }
       t->incoming_frame_size = (static_cast<uint32_t>(*cur)) << 16;
       if (++cur == end) {
         t->deframe_state = GRPC_DTS_FH_1;
@@ -339,6 +357,7 @@ std::variant<size_t, absl::Status> grpc_chttp2_perform_read(
     case GRPC_DTS_FH_8:
       DCHECK_LT(cur, end);
       t->incoming_stream_id |= (static_cast<uint32_t>(*cur));
+    dts_fh_done:
       GRPC_TRACE_LOG(http, INFO)
           << "INCOMING[" << t << "]: "
           << FrameTypeString(t->incoming_frame_type, t->incoming_frame_flags)
@@ -427,6 +446,13 @@ static grpc_error_handle init_frame_parser(grpc_chttp2_transport* t,
         t->incoming_frame_type));
   }
   t->is_first_frame = false;
+  if (t->incoming_frame_type != GRPC_CHTTP2_FRAME_PING ||
+      (t->incoming_frame_flags & GRPC_CHTTP2_FLAG_ACK) == 0) {
+    // Anything but a ping ack means the transport is not idle, even if
+    // the keepalive ping is still in flight.
+    t->current_keepalive_time = t->keepalive_time;
+    t->keepalive_data_received = true;
+  }
   if (t->expect_continuation_stream_id != 0) {
     if (t->incoming_frame_type != GRPC_CHTTP2_FRAME_CONTINUATION) {
       return GRPC_ERROR_CREATE(
@@ -753,6 +779,7 @@ static grpc_error_handle init_header_frame_parser(grpc_chttp2_transport* t,
       GRPC_CHTTP2_IF_TRACING(ERROR) << "grpc_chttp2_stream not accepted";
       return init_header_skip_frame_parser(t, priority_type, is_eoh);
     }
+    grpc_chttp2_maybe_update_max_concurrent_streams(t);
     if (GRPC_TRACE_FLAG_ENABLED(http) ||
         GRPC_TRACE_FLAG_ENABLED(chttp2_new_stream)) {
       LOG(INFO) << "[t:" << t << " fd:" << grpc_endpoint_get_fd(t->ep.get())
@@ -57,4 +57,20 @@ void Chttp2WriteSizePolicy::EndWrite(bool success) {
   }
 }
 
+void Chttp2WriteSizePolicy::SetCoalescingWindow(
+    std::chrono::microseconds window, size_t min_streams) {
+  coalescing_window_ =
+      std::clamp(window, std::chrono::microseconds::zero(),
+                 kMaxCoalescingWindow);
+  coalescing_min_streams_ = min_streams;
+}
+
+std::chrono::microseconds Chttp2WriteSizePolicy::CoalescingDelay(
+    size_t open_streams) const {
+  if (open_streams < coalescing_min_streams_) {
+    return std::chrono::microseconds::zero();
+  }
+  return coalescing_window_;
+}
+
 }  // namespace grpc_core
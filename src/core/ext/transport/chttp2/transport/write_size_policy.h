@@ -19,6 +19,8 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <chrono>
+
 #include "src/core/util/time.h"
 
 namespace grpc_core {
@@ -47,6 +49,23 @@ class Chttp2WriteSizePolicy {
   // Notify the policy that a write of some size has ended.
   void EndWrite(bool success);
 
+  // The longest a write may be held back for coalescing.
+  static constexpr std::chrono::microseconds kMaxCoalescingWindow{1000};
+
+  // Allow writes to be held back by up to `window` (clamped to
+  // kMaxCoalescingWindow) while at least `min_streams` streams are open, so
+  // that more of those streams can contribute frames to the same write.
+  // The window is kept in microseconds as it is typically well below the
+  // resolution of Duration.
+  void SetCoalescingWindow(std::chrono::microseconds window,
+                           size_t min_streams);
+  std::chrono::microseconds CoalescingWindow() const {
+    return coalescing_window_;
+  }
+  // How long should the next write be held back, given the number of streams
+  // currently open.
+  std::chrono::microseconds CoalescingDelay(size_t open_streams) const;
+
  private:
   size_t current_target_ = 128 * 1024;
   Timestamp experiment_start_time_ = Timestamp::InfFuture();
@@ -58,6 +77,8 @@ class Chttp2WriteSizePolicy {
   // In this way, we need two consecutive fast/slow operations to adjust,
   // denoising the signal significantly
   int8_t state_ = 0;
+  std::chrono::microseconds coalescing_window_{0};
+  size_t coalescing_min_streams_ = 0;
 };
 
 }  // namespace grpc_core
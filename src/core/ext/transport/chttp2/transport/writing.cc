@@ -260,6 +260,8 @@ class WriteContext {
   explicit WriteContext(grpc_chttp2_transport* t) : t_(t) {
     t->http2_stats.IncrementHttp2WritesBegun();
     t->http2_stats.IncrementHttp2WriteTargetSize(target_write_size_);
+    grpc_core::global_stats().IncrementHttp2WriteCoalescedInitiations(
+        std::exchange(t->num_write_initiations, 0));
   }
 
   void FlushSettings() {
@@ -388,7 +390,12 @@ class DataSendContext {
       : write_context_(write_context),
         t_(t),
         s_(s),
-        sending_bytes_before_(s_->sending_bytes) {}
+        sending_bytes_before_(s_->sending_bytes),
+        write_budget_(
+            grpc_core::IsChttp2WeightedWriteSchedulingEnabled()
+                ? static_cast<int64_t>(t_->settings.peer().max_frame_size()) *
+                      s_->write_weight
+                : std::numeric_limits<int64_t>::max()) {}
 
   uint32_t stream_remote_window() const {
     return static_cast<uint32_t>(std::max(
@@ -401,7 +408,7 @@ class DataSendContext {
     return grpc_core::Clamp<int64_t>(
         std::min<int64_t>(
             {t_->settings.peer().max_frame_size(), stream_remote_window(),
-             t_->flow_control.remote_window(),
+             t_->flow_control.remote_window(), write_budget_,
              static_cast<int64_t>(write_context_->target_write_size()) -
                  (grpc_core::IsChttp2BoundWriteSizeEnabled()
                       ? static_cast<int64_t>(t_->outbuf.Length())
@@ -424,6 +431,13 @@ class DataSendContext {
                             t_->outbuf.c_slice_buffer());
     sfc_upd_.SentData(send_bytes);
     s_->sending_bytes += send_bytes;
+    write_budget_ -= send_bytes;
+    if (s_->send_message_queued_cycle != 0 && send_bytes > 0) {
+      grpc_core::global_stats().IncrementHttp2WriteQueueDelayUs(
+          static_cast<int>(gpr_timespec_to_micros(gpr_cycle_counter_sub(
+              gpr_get_cycle_counter(), s_->send_message_queued_cycle))));
+      s_->send_message_queued_cycle = 0;
+    }
   }
 
   bool is_last_frame() const { return is_last_frame_; }
@@ -444,6 +458,9 @@ class DataSendContext {
   grpc_core::chttp2::StreamFlowControl::OutgoingUpdateContext sfc_upd_{
       &s_->flow_control};
   const size_t sending_bytes_before_;
+  // Bytes this stream may still frame before going back to the end of the
+  // writable list, giving streams behind it a turn within the same write.
+  int64_t write_budget_;
   bool is_last_frame_ = false;
 };
 
@@ -734,6 +751,16 @@ grpc_chttp2_begin_write_result grpc_chttp2_begin_write(
 
   maybe_initiate_ping(t);
 
+  if (grpc_core::IsChttp2CoalesceSmallWriteSlicesEnabled()) {
+    // Frame headers and small messages of many streams would otherwise each
+    // take an iovec of their own, splitting a write into several syscalls.
+    // Copying them is cheap compared to that.
+    static constexpr size_t kMaxCoalescedSliceSize = 512;
+    static constexpr size_t kMaxCoalescedRunSize = 16384;
+    t->outbuf.CoalesceSmallSlices(kMaxCoalescedSliceSize,
+                                  kMaxCoalescedRunSize);
+  }
+
   t->write_flow.Begin(GRPC_LATENT_SEE_METADATA("write"));
 
   return ctx.Result();
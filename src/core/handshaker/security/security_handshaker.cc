@@ -18,18 +18,23 @@
 
 #include "src/core/handshaker/security/security_handshaker.h"
 
+#include <grpc/event_engine/event_engine.h>
 #include <grpc/grpc_security.h>
 #include <grpc/grpc_security_constants.h>
 #include <grpc/impl/channel_arg_names.h>
 #include <grpc/slice.h>
 #include <grpc/slice_buffer.h>
 #include <grpc/support/alloc.h>
+#include <grpc/support/cpu.h>
 #include <grpc/support/port_platform.h>
+#include <errno.h>
 #include <limits.h>
 #include <stdint.h>
 #include <string.h>
 
 #include <algorithm>
+#include <atomic>
+#include <deque>
 #include <memory>
 #include <optional>
 #include <string>
@@ -48,11 +53,15 @@
 #include "src/core/handshaker/handshaker_registry.h"
 #include "src/core/handshaker/security/secure_endpoint.h"
 #include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/debug/trace.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/iomgr/closure.h"
 #include "src/core/lib/iomgr/endpoint.h"
 #include "src/core/lib/iomgr/error.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/iomgr/iomgr_fwd.h"
+#include "src/core/lib/iomgr/port.h"
 #include "src/core/lib/iomgr/tcp_server.h"
 #include "src/core/lib/slice/slice.h"
 #include "src/core/lib/slice/slice_internal.h"
@@ -61,16 +70,105 @@
 #include "src/core/transport/auth_context.h"
 #include "src/core/tsi/transport_security_grpc.h"
 #include "src/core/util/debug_location.h"
+#include "src/core/util/no_destruct.h"
 #include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/strerror.h"
 #include "src/core/util/sync.h"
+#include "src/core/util/time_precise.h"
 #include "src/core/util/unique_type_name.h"
 
+#ifdef GRPC_LINUX_KTLS
+#include <linux/tls.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#ifndef SOL_TLS
+#define SOL_TLS 282
+#endif
+#ifndef TCP_ULP
+#define TCP_ULP 31
+#endif
+#endif  // GRPC_LINUX_KTLS
+
 #define GRPC_INITIAL_HANDSHAKE_BUFFER_SIZE 256
 
 namespace grpc_core {
 
 namespace {
 
+// Runs handshake steps on the EventEngine when the security_handshake_offload
+// experiment is enabled. At most half as many steps as there are cores run at
+// once across every handshake in the process; the rest wait here in order. A
+// storm of new connections can therefore keep at most those EventEngine
+// threads busy, rather than every one of them. Since no threads of its own
+// are involved, forking needs no special handling here.
+class HandshakeOffloadQueue {
+ public:
+  static HandshakeOffloadQueue* Get() {
+    static NoDestruct<HandshakeOffloadQueue> queue(
+        std::max(1u, gpr_cpu_num_cores() / 2));
+    return queue.get();
+  }
+
+  explicit HandshakeOffloadQueue(size_t max_running)
+      : max_running_(max_running) {}
+
+  // Number of steps queued or running.
+  size_t pending() const { return pending_.load(std::memory_order_relaxed); }
+
+  void Run(std::shared_ptr<grpc_event_engine::experimental::EventEngine> engine,
+           absl::AnyInvocable<void()> step) {
+    pending_.fetch_add(1, std::memory_order_relaxed);
+    QueuedStep queued{gpr_get_cycle_counter(), std::move(engine),
+                      std::move(step)};
+    {
+      MutexLock lock(&mu_);
+      if (running_ == max_running_) {
+        queue_.push_back(std::move(queued));
+        return;
+      }
+      ++running_;
+    }
+    Start(std::move(queued));
+  }
+
+ private:
+  struct QueuedStep {
+    gpr_cycle_counter queued;
+    std::shared_ptr<grpc_event_engine::experimental::EventEngine> engine;
+    absl::AnyInvocable<void()> step;
+  };
+
+  void Start(QueuedStep queued) {
+    grpc_event_engine::experimental::EventEngine* engine = queued.engine.get();
+    engine->Run([this, queued = std::move(queued)]() mutable {
+      global_stats().IncrementSecurityHandshakeOffloadQueueTimeUs(
+          static_cast<int>(gpr_timespec_to_micros(
+              gpr_cycle_counter_sub(gpr_get_cycle_counter(), queued.queued))));
+      queued.step();
+      queued.step = nullptr;
+      pending_.fetch_sub(1, std::memory_order_relaxed);
+      QueuedStep next;
+      {
+        MutexLock lock(&mu_);
+        if (queue_.empty()) {
+          --running_;
+          return;
+        }
+        next = std::move(queue_.front());
+        queue_.pop_front();
+      }
+      Start(std::move(next));
+    });
+  }
+
+  const size_t max_running_;
+  std::atomic<size_t> pending_{0};
+  Mutex mu_;
+  size_t running_ ABSL_GUARDED_BY(mu_) = 0;
+  std::deque<QueuedStep> queue_ ABSL_GUARDED_BY(mu_);
+};
+
 class SecurityHandshaker : public Handshaker {
  public:
   SecurityHandshaker(tsi_handshaker* handshaker,
@@ -87,6 +185,9 @@ class SecurityHandshaker : public Handshaker {
   grpc_error_handle DoHandshakerNextLocked(const unsigned char* bytes_received,
                                            size_t bytes_received_size)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  grpc_error_handle RunHandshakerNextLocked(const unsigned char* bytes_received,
+                                            size_t bytes_received_size)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
 
   grpc_error_handle OnHandshakeNextDoneLocked(
       tsi_result result, const unsigned char* bytes_to_send,
@@ -125,6 +226,10 @@ class SecurityHandshaker : public Handshaker {
   RefCountedPtr<grpc_auth_context> auth_context_;
   tsi_handshaker_result* handshaker_result_ = nullptr;
   size_t max_frame_size_ = 0;
+  bool kernel_tls_offload_ = false;
+  size_t max_pending_offloaded_steps_ = 0;
+  bool offload_admitted_ = false;
+  gpr_cycle_counter start_ = 0;
   std::string tsi_handshake_error_;
   grpc_closure* on_peer_checked_ ABSL_GUARDED_BY(mu_) = nullptr;
 };
@@ -138,7 +243,14 @@ SecurityHandshaker::SecurityHandshaker(tsi_handshaker* handshaker,
       handshake_buffer_(
           static_cast<uint8_t*>(gpr_malloc(handshake_buffer_size_))),
       max_frame_size_(
-          std::max(0, args.GetInt(GRPC_ARG_TSI_MAX_FRAME_SIZE).value_or(0))) {}
+          std::max(0, args.GetInt(GRPC_ARG_TSI_MAX_FRAME_SIZE).value_or(0))),
+      // The kernel rejects MSG_ZEROCOPY sends on kTLS sockets.
+      kernel_tls_offload_(
+          args.GetBool(GRPC_ARG_TLS_KERNEL_OFFLOAD).value_or(false) &&
+          !args.GetBool(GRPC_ARG_TCP_TX_ZEROCOPY_ENABLED).value_or(false)),
+      max_pending_offloaded_steps_(std::max(
+          0, args.GetInt(GRPC_ARG_SECURITY_HANDSHAKE_OFFLOAD_MAX_PENDING)
+                 .value_or(0))) {}
 
 SecurityHandshaker::~SecurityHandshaker() {
   tsi_handshaker_destroy(handshaker_);
@@ -183,12 +295,25 @@ void SecurityHandshaker::HandshakeFailedLocked(absl::Status error) {
 }
 
 void SecurityHandshaker::Finish(absl::Status status) {
+  global_stats().IncrementSecurityHandshakeTimeUs(
+      static_cast<int>(gpr_timespec_to_micros(
+          gpr_cycle_counter_sub(gpr_get_cycle_counter(), start_))));
   InvokeOnHandshakeDone(args_, std::move(on_handshake_done_),
                         std::move(status));
 }
 
 namespace {
 
+void CountInsecureConnection(grpc_auth_context* auth_context) {
+  grpc_auth_property_iterator it = grpc_auth_context_find_properties_by_name(
+      auth_context, GRPC_TRANSPORT_SECURITY_LEVEL_PROPERTY_NAME);
+  const grpc_auth_property* prop = grpc_auth_property_iterator_next(&it);
+  if (!prop ||
+      !strcmp(tsi_security_level_to_string(TSI_SECURITY_NONE), prop->value)) {
+    global_stats().IncrementInsecureConnectionsCreated();
+  }
+}
+
 RefCountedPtr<channelz::SocketNode::Security>
 MakeChannelzSecurityFromAuthContext(grpc_auth_context* auth_context) {
   RefCountedPtr<channelz::SocketNode::Security> security =
@@ -210,6 +335,97 @@ MakeChannelzSecurityFromAuthContext(grpc_auth_context* auth_context) {
   return security;
 }
 
+#ifdef GRPC_LINUX_KTLS
+void WipeKeys(void* p, size_t size) {
+  volatile unsigned char* bytes = static_cast<volatile unsigned char*>(p);
+  while (size-- > 0) *bytes++ = 0;
+}
+
+template <typename CryptoInfo>
+bool SetKernelTlsKeys(int fd, int direction, uint16_t cipher_type,
+                      const unsigned char* key, const unsigned char* salt,
+                      const unsigned char* iv, const unsigned char* rec_seq) {
+  CryptoInfo crypto_info;
+  memset(&crypto_info, 0, sizeof(crypto_info));
+  crypto_info.info.version = TLS_1_2_VERSION;
+  crypto_info.info.cipher_type = cipher_type;
+  memcpy(crypto_info.key, key, sizeof(crypto_info.key));
+  memcpy(crypto_info.salt, salt, sizeof(crypto_info.salt));
+  memcpy(crypto_info.iv, iv, sizeof(crypto_info.iv));
+  memcpy(crypto_info.rec_seq, rec_seq, sizeof(crypto_info.rec_seq));
+  bool ok = setsockopt(fd, SOL_TLS, direction, &crypto_info,
+                       sizeof(crypto_info)) == 0;
+  WipeKeys(&crypto_info, sizeof(crypto_info));
+  return ok;
+}
+
+template <typename CryptoInfo>
+bool SetKernelTlsKeys(int fd, int direction, uint16_t cipher_type,
+                      const tsi_ktls_crypto_info& info) {
+  if (direction == TLS_TX) {
+    return SetKernelTlsKeys<CryptoInfo>(fd, direction, cipher_type,
+                                        info.tx_key, info.tx_salt, info.tx_iv,
+                                        info.tx_rec_seq);
+  }
+  return SetKernelTlsKeys<CryptoInfo>(fd, direction, cipher_type, info.rx_key,
+                                      info.rx_salt, info.rx_iv,
+                                      info.rx_rec_seq);
+}
+
+bool SetKernelTlsKeys(int fd, int direction, const tsi_ktls_crypto_info& info) {
+  switch (info.cipher) {
+    case TSI_KTLS_CIPHER_AES_128_GCM:
+      return SetKernelTlsKeys<tls12_crypto_info_aes_gcm_128>(
+          fd, direction, TLS_CIPHER_AES_GCM_128, info);
+    case TSI_KTLS_CIPHER_AES_256_GCM:
+      return SetKernelTlsKeys<tls12_crypto_info_aes_gcm_256>(
+          fd, direction, TLS_CIPHER_AES_GCM_256, info);
+  }
+  return false;
+}
+#endif  // GRPC_LINUX_KTLS
+
+// Tries to hand record protection of the connection over to the kernel.
+// Returns false if the socket was left untouched, in which case a frame
+// protector must be used, and an error if the socket is no longer usable.
+absl::StatusOr<bool> MaybeEnableKernelTls(
+    grpc_endpoint* endpoint, const tsi_handshaker_result* handshaker_result) {
+#ifdef GRPC_LINUX_KTLS
+  int fd = grpc_endpoint_get_fd(endpoint);
+  if (fd < 0) return false;
+  tsi_ktls_crypto_info crypto_info;
+  tsi_result result =
+      tsi_handshaker_result_get_ktls_crypto_info(handshaker_result, &crypto_info);
+  if (result != TSI_OK) {
+    GRPC_TRACE_LOG(handshaker, INFO)
+        << "kTLS not used: " << tsi_result_to_string(result);
+    return false;
+  }
+  absl::StatusOr<bool> enabled = false;
+  if (setsockopt(fd, SOL_TCP, TCP_ULP, "tls", sizeof("tls")) != 0) {
+    // Most likely the tls kernel module is not loaded.
+    GRPC_TRACE_LOG(handshaker, INFO)
+        << "kTLS not used: setting TCP_ULP failed: " << StrError(errno);
+  } else if (!SetKernelTlsKeys(fd, TLS_TX, crypto_info)) {
+    // Nothing has been offloaded yet, so the socket still passes data
+    // through unchanged.
+    GRPC_TRACE_LOG(handshaker, INFO)
+        << "kTLS not used: setting TLS_TX failed: " << StrError(errno);
+  } else if (!SetKernelTlsKeys(fd, TLS_RX, crypto_info)) {
+    enabled = absl::InternalError(
+        absl::StrCat("Setting TLS_RX failed: ", StrError(errno)));
+  } else {
+    enabled = true;
+  }
+  WipeKeys(&crypto_info, sizeof(crypto_info));
+  return enabled;
+#else
+  (void)endpoint;
+  (void)handshaker_result;
+  return false;
+#endif  // GRPC_LINUX_KTLS
+}
+
 }  // namespace
 
 void SecurityHandshaker::OnPeerCheckedFn(grpc_error_handle error) {
@@ -241,6 +457,20 @@ void SecurityHandshaker::OnPeerCheckedFn(grpc_error_handle error) {
                      tsi_result_to_string(result), ")")));
     return;
   }
+  // Records the kernel would see are all protected, so offloading is only
+  // possible if no bytes past the handshake have been read yet.
+  bool kernel_tls = false;
+  if (kernel_tls_offload_ && frame_protector_type != TSI_FRAME_PROTECTOR_NONE &&
+      unused_bytes_size == 0) {
+    absl::StatusOr<bool> enabled =
+        MaybeEnableKernelTls(args_->endpoint.get(), handshaker_result_);
+    if (!enabled.ok()) {
+      HandshakeFailedLocked(enabled.status());
+      return;
+    }
+    kernel_tls = *enabled;
+    if (kernel_tls) frame_protector_type = TSI_FRAME_PROTECTOR_NONE;
+  }
   tsi_zero_copy_grpc_protector* zero_copy_protector = nullptr;
   tsi_frame_protector* protector = nullptr;
   switch (frame_protector_type) {
@@ -298,8 +528,8 @@ void SecurityHandshaker::OnPeerCheckedFn(grpc_error_handle error) {
   tsi_handshaker_result_destroy(handshaker_result_);
   handshaker_result_ = nullptr;
   args_->args = args_->args.SetObject(auth_context_);
-  // Add channelz channel args only if frame protector is created.
-  if (has_frame_protector) {
+  // Add channelz channel args only if the connection is protected.
+  if (has_frame_protector || kernel_tls) {
     args_->args = args_->args.SetObject(
         MakeChannelzSecurityFromAuthContext(auth_context_.get()));
   }
@@ -324,13 +554,7 @@ grpc_error_handle SecurityHandshaker::CheckPeerLocked() {
       });
   connector_->check_peer(peer, args_->endpoint.get(), args_->args,
                          &auth_context_, on_peer_checked_);
-  grpc_auth_property_iterator it = grpc_auth_context_find_properties_by_name(
-      auth_context_.get(), GRPC_TRANSPORT_SECURITY_LEVEL_PROPERTY_NAME);
-  const grpc_auth_property* prop = grpc_auth_property_iterator_next(&it);
-  if (!prop ||
-      !strcmp(tsi_security_level_to_string(TSI_SECURITY_NONE), prop->value)) {
-    global_stats().IncrementInsecureConnectionsCreated();
-  }
+  CountInsecureConnection(auth_context_.get());
   return absl::OkStatus();
 }
 
@@ -414,6 +638,49 @@ void SecurityHandshaker::OnHandshakeNextDoneGrpcWrapper(
 
 grpc_error_handle SecurityHandshaker::DoHandshakerNextLocked(
     const unsigned char* bytes_received, size_t bytes_received_size) {
+  if (!IsSecurityHandshakeOffloadEnabled()) {
+    return RunHandshakerNextLocked(bytes_received, bytes_received_size);
+  }
+  HandshakeOffloadQueue* queue = HandshakeOffloadQueue::Get();
+  // Only handshakes that have not started yet are refused, so that the work
+  // already done for the others is not wasted.
+  if (!offload_admitted_) {
+    if (max_pending_offloaded_steps_ > 0 &&
+        queue->pending() >= max_pending_offloaded_steps_) {
+      global_stats().IncrementSecurityHandshakesShed();
+      return absl::ResourceExhaustedError(
+          "Security handshake refused: handshake offload queue is full");
+    }
+    offload_admitted_ = true;
+  }
+  // bytes_received points into handshake_buffer_, which is not touched again
+  // until this step asks for more bytes from the peer.
+  auto engine = args_->args.GetObjectRef<
+      grpc_event_engine::experimental::EventEngine>();
+  if (engine == nullptr) {
+    engine = grpc_event_engine::experimental::GetDefaultEventEngine();
+  }
+  queue->Run(std::move(engine), [self = RefAsSubclass<SecurityHandshaker>(),
+                                 bytes_received,
+                                 bytes_received_size]() mutable {
+    ExecCtx exec_ctx;
+    {
+      MutexLock lock(&self->mu_);
+      grpc_error_handle error =
+          self->is_shutdown_
+              ? GRPC_ERROR_CREATE("Handshaker shutdown")
+              : self->RunHandshakerNextLocked(bytes_received,
+                                              bytes_received_size);
+      if (!error.ok()) self->HandshakeFailedLocked(std::move(error));
+    }
+    // Avoid destruction outside of an ExecCtx (since this is non-cancelable).
+    self.reset();
+  });
+  return absl::OkStatus();
+}
+
+grpc_error_handle SecurityHandshaker::RunHandshakerNextLocked(
+    const unsigned char* bytes_received, size_t bytes_received_size) {
   // Invoke TSI handshaker.
   const unsigned char* bytes_to_send = nullptr;
   size_t bytes_to_send_size = 0;
@@ -524,6 +791,7 @@ void SecurityHandshaker::DoHandshake(
     HandshakerArgs* args,
     absl::AnyInvocable<void(absl::Status)> on_handshake_done) {
   MutexLock lock(&mu_);
+  start_ = gpr_get_cycle_counter();
   args_ = args;
   on_handshake_done_ = std::move(on_handshake_done);
   size_t bytes_received_size = MoveReadBufferIntoHandshakeBuffer();
@@ -554,6 +822,80 @@ class FailHandshaker : public Handshaker {
   absl::Status status_;
 };
 
+//
+// PeerCheckHandshaker
+//
+
+// Stands in for a SecurityHandshaker whose TSI handshake would exchange no
+// bytes and install no frame protector. It only runs the connector's peer
+// check, so the endpoint and any bytes already read from it go to the
+// transport untouched, without a TSI handshaker, handshake buffer or
+// offloaded step in between.
+class PeerCheckHandshaker : public Handshaker {
+ public:
+  explicit PeerCheckHandshaker(grpc_security_connector* connector)
+      : connector_(connector->Ref(DEBUG_LOCATION, "handshake")) {}
+  absl::string_view name() const override { return "security"; }
+
+  void DoHandshake(
+      HandshakerArgs* args,
+      absl::AnyInvocable<void(absl::Status)> on_handshake_done) override {
+    MutexLock lock(&mu_);
+    start_ = gpr_get_cycle_counter();
+    args_ = args;
+    on_handshake_done_ = std::move(on_handshake_done);
+    on_peer_checked_ = NewClosure(
+        [self = RefAsSubclass<PeerCheckHandshaker>()](absl::Status status) {
+          self->OnPeerChecked(std::move(status));
+        });
+    tsi_peer peer;
+    tsi_construct_peer(0, &peer);
+    connector_->check_peer(peer, args_->endpoint.get(), args_->args,
+                           &auth_context_, on_peer_checked_);
+    CountInsecureConnection(auth_context_.get());
+  }
+
+  void Shutdown(absl::Status error) override {
+    MutexLock lock(&mu_);
+    if (!is_shutdown_) {
+      is_shutdown_ = true;
+      connector_->cancel_check_peer(on_peer_checked_, std::move(error));
+      args_->endpoint.reset();
+    }
+  }
+
+ private:
+  ~PeerCheckHandshaker() override {
+    auth_context_.reset(DEBUG_LOCATION, "handshake");
+    connector_.reset(DEBUG_LOCATION, "handshake");
+  }
+
+  void OnPeerChecked(absl::Status error) {
+    MutexLock lock(&mu_);
+    on_peer_checked_ = nullptr;
+    if (error.ok() && is_shutdown_) {
+      error = GRPC_ERROR_CREATE("Handshaker shutdown");
+    }
+    if (error.ok()) args_->args = args_->args.SetObject(auth_context_);
+    is_shutdown_ = true;
+    global_stats().IncrementSecurityHandshakeTimeUs(
+        static_cast<int>(gpr_timespec_to_micros(
+            gpr_cycle_counter_sub(gpr_get_cycle_counter(), start_))));
+    InvokeOnHandshakeDone(args_, std::move(on_handshake_done_),
+                          std::move(error));
+  }
+
+  RefCountedPtr<grpc_security_connector> connector_;
+  Mutex mu_;
+  bool is_shutdown_ ABSL_GUARDED_BY(mu_) = false;
+  HandshakerArgs* args_ ABSL_GUARDED_BY(mu_) = nullptr;
+  absl::AnyInvocable<void(absl::Status)> on_handshake_done_
+      ABSL_GUARDED_BY(mu_);
+  RefCountedPtr<grpc_auth_context> auth_context_;
+  grpc_closure* on_peer_checked_ ABSL_GUARDED_BY(mu_) = nullptr;
+  gpr_cycle_counter start_ ABSL_GUARDED_BY(mu_) = 0;
+};
+
 //
 // handshaker factories
 //
@@ -619,6 +961,11 @@ RefCountedPtr<Handshaker> SecurityHandshakerCreate(
   }
 }
 
+RefCountedPtr<Handshaker> SecurityPeerCheckHandshakerCreate(
+    grpc_security_connector* connector) {
+  return MakeRefCounted<PeerCheckHandshaker>(connector);
+}
+
 void SecurityRegisterHandshakerFactories(CoreConfiguration::Builder* builder) {
   builder->handshaker_registry()->RegisterHandshakerFactory(
       HANDSHAKER_CLIENT, std::make_unique<ClientSecurityHandshakerFactory>());
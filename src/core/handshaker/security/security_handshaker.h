@@ -37,6 +37,12 @@ RefCountedPtr<Handshaker> SecurityHandshakerCreate(
     absl::StatusOr<tsi_handshaker*> handshaker,
     grpc_security_connector* connector, const ChannelArgs& args);
 
+/// Creates a handshaker that only runs \a connector's peer check. For
+/// connectors whose TSI handshake would exchange no bytes and produce no
+/// frame protector, this leaves the endpoint to the transport as it is.
+RefCountedPtr<Handshaker> SecurityPeerCheckHandshakerCreate(
+    grpc_security_connector* connector);
+
 /// Registers security handshaker factories.
 void SecurityRegisterHandshakerFactories(CoreConfiguration::Builder*);
 
@@ -390,6 +390,11 @@ class ChannelArgs {
 
     grpc_arg MakeCArg(const char* name) const;
 
+    // Hashes ints and strings by value. Other pointers are hashed only by
+    // their vtable, since their cmp function may consider distinct pointers
+    // equal.
+    size_t Hash() const;
+
     bool operator<(const Value& rhs) const { return rep_ < rhs.rep_; }
     bool operator==(const Value& rhs) const { return rep_ == rhs.rep_; }
     bool operator!=(const Value& rhs) const { return !this->operator==(rhs); }
@@ -574,6 +579,10 @@ class ChannelArgs {
     return QsortCompare(lhs.args_, rhs.args_);
   }
 
+  // Returns a hash that is equal for equal args. Computing it visits every
+  // arg, so callers that compare the same args repeatedly should cache it.
+  size_t Hash() const;
+
   // Helpers for commonly accessed things
 
   bool WantMinimalStack() const;
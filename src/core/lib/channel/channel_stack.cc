@@ -144,12 +144,12 @@ grpc_error_handle grpc_channel_stack_init(
                                              sizeof(grpc_channel_element));
 
   // init per-filter data
+  args.channel_stack = stack;
+  args.channel_args = channel_args;
   args.old_blackboard = old_blackboard;
   args.new_blackboard = new_blackboard;
   grpc_error_handle first_error;
   for (i = 0; i < filter_count; i++) {
-    args.channel_stack = stack;
-    args.channel_args = channel_args;
     args.is_first = i == 0;
     args.is_last = i == (filter_count - 1);
     elems[i].filter = filters[i];
@@ -1789,7 +1789,8 @@ void ClientCallData::SetStatusFromError(grpc_metadata_batch* metadata,
   grpc_error_get_status(error, deadline(), &status_code, &status_details,
                         nullptr, nullptr);
   metadata->Set(GrpcStatusMetadata(), status_code);
-  metadata->Set(GrpcMessageMetadata(), Slice::FromCopiedString(status_details));
+  metadata->Set(GrpcMessageMetadata(),
+                GrpcMessageMetadata::FromString(status_details));
   metadata->GetOrCreatePointer(GrpcStatusContext())
       ->emplace_back(StatusToString(error));
 }
@@ -27,17 +27,28 @@
 
 #include "absl/log/check.h"
 #include "absl/log/log.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/slice/slice.h"
 
-#define OUTPUT_BLOCK_SIZE 1024
+#define MIN_OUTPUT_BLOCK_SIZE 1024
+#define MAX_OUTPUT_BLOCK_SIZE (64 * 1024)
+
+// Output blocks start at the size hint (clamped) and double from there,
+// so large messages take few slices and few calls into zlib.
+static size_t output_block_size(size_t size_hint) {
+  if (size_hint < MIN_OUTPUT_BLOCK_SIZE) return MIN_OUTPUT_BLOCK_SIZE;
+  if (size_hint > MAX_OUTPUT_BLOCK_SIZE) return MAX_OUTPUT_BLOCK_SIZE;
+  return size_hint;
+}
 
 static int zlib_body(z_stream* zs, grpc_slice_buffer* input,
                      grpc_slice_buffer* output,
-                     int (*flate)(z_stream* zs, int flush)) {
+                     int (*flate)(z_stream* zs, int flush), size_t size_hint) {
   int r = Z_STREAM_END;  // Do not fail on an empty input.
   int flush;
   size_t i;
-  grpc_slice outbuf = GRPC_SLICE_MALLOC(OUTPUT_BLOCK_SIZE);
+  size_t block_size = output_block_size(size_hint);
+  grpc_slice outbuf = GRPC_SLICE_MALLOC(block_size);
   const uInt uint_max = ~uInt{0};
 
   CHECK(GRPC_SLICE_LENGTH(outbuf) <= uint_max);
@@ -52,7 +63,8 @@ static int zlib_body(z_stream* zs, grpc_slice_buffer* input,
     do {
       if (zs->avail_out == 0) {
         grpc_slice_buffer_add_indexed(output, outbuf);
-        outbuf = GRPC_SLICE_MALLOC(OUTPUT_BLOCK_SIZE);
+        block_size = output_block_size(block_size * 2);
+        outbuf = GRPC_SLICE_MALLOC(block_size);
         CHECK(GRPC_SLICE_LENGTH(outbuf) <= uint_max);
         zs->avail_out = static_cast<uInt> GRPC_SLICE_LENGTH(outbuf);
         zs->next_out = GRPC_SLICE_START_PTR(outbuf);
@@ -91,20 +103,100 @@ static void* zalloc_gpr(void* /*opaque*/, unsigned int items,
 
 static void zfree_gpr(void* /*opaque*/, void* address) { gpr_free(address); }
 
+namespace {
+
+// A z_stream that is kept for the life of a thread and reset between
+// messages.  Setting up a stream allocates and clears its window and hash
+// tables, which for small messages costs more than the compression itself.
+class CachedZStream {
+ public:
+  CachedZStream() = default;
+  CachedZStream(const CachedZStream&) = delete;
+  CachedZStream& operator=(const CachedZStream&) = delete;
+  ~CachedZStream() { Release(); }
+
+  // Returns a deflate stream with the given settings, ready for a new
+  // message.
+  z_stream* Deflate(int gzip, int level) {
+    if (kind_ == Kind::kDeflate && gzip_ == gzip && level_ == level &&
+        deflateReset(&zs_) == Z_OK) {
+      return &zs_;
+    }
+    Reinit();
+    int r = deflateInit2(&zs_, level, Z_DEFLATED, 15 | (gzip ? 16 : 0), 8,
+                         Z_DEFAULT_STRATEGY);
+    CHECK(r == Z_OK);
+    kind_ = Kind::kDeflate;
+    gzip_ = gzip;
+    level_ = level;
+    return &zs_;
+  }
+
+  // Returns an inflate stream ready for a new message.
+  z_stream* Inflate(int gzip) {
+    if (kind_ == Kind::kInflate && gzip_ == gzip &&
+        inflateReset(&zs_) == Z_OK) {
+      return &zs_;
+    }
+    Reinit();
+    int r = inflateInit2(&zs_, 15 | (gzip ? 16 : 0));
+    CHECK(r == Z_OK);
+    kind_ = Kind::kInflate;
+    gzip_ = gzip;
+    return &zs_;
+  }
+
+ private:
+  enum class Kind { kNone, kDeflate, kInflate };
+
+  void Release() {
+    if (kind_ == Kind::kDeflate) deflateEnd(&zs_);
+    if (kind_ == Kind::kInflate) inflateEnd(&zs_);
+    kind_ = Kind::kNone;
+  }
+
+  void Reinit() {
+    Release();
+    memset(&zs_, 0, sizeof(zs_));
+    zs_.zalloc = zalloc_gpr;
+    zs_.zfree = zfree_gpr;
+  }
+
+  z_stream zs_;
+  Kind kind_ = Kind::kNone;
+  int gzip_ = 0;
+  int level_ = 0;
+};
+
+thread_local CachedZStream g_deflate_stream;
+thread_local CachedZStream g_inflate_stream;
+
+}  // namespace
+
 static int zlib_compress(grpc_slice_buffer* input, grpc_slice_buffer* output,
-                         int gzip) {
-  z_stream zs;
+                         int gzip, int level) {
+  z_stream local_zs;
+  z_stream* zs;
   int r;
   size_t i;
   size_t count_before = output->count;
   size_t length_before = output->length;
-  memset(&zs, 0, sizeof(zs));
-  zs.zalloc = zalloc_gpr;
-  zs.zfree = zfree_gpr;
-  r = deflateInit2(&zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 | (gzip ? 16 : 0),
-                   8, Z_DEFAULT_STRATEGY);
-  CHECK(r == Z_OK);
-  r = zlib_body(&zs, input, output, deflate) && output->length < input->length;
+  const bool reuse = grpc_core::IsZlibStreamReuseEnabled();
+  if (reuse) {
+    zs = g_deflate_stream.Deflate(gzip, level);
+  } else {
+    zs = &local_zs;
+    memset(zs, 0, sizeof(*zs));
+    zs->zalloc = zalloc_gpr;
+    zs->zfree = zfree_gpr;
+    r = deflateInit2(zs, level, Z_DEFLATED, 15 | (gzip ? 16 : 0), 8,
+                     Z_DEFAULT_STRATEGY);
+    CHECK(r == Z_OK);
+  }
+  // Output that is not smaller than the input is thrown away, so there
+  // is no point in allocating for more than that.
+  r = zlib_body(zs, input, output, deflate, input->length) &&
+      output->length < input->length;
   if (!r) {
     for (i = count_before; i < output->count; i++) {
       grpc_core::CSliceUnref(output->slices[i]);
@@ -112,23 +204,30 @@ static int zlib_compress(grpc_slice_buffer* input, grpc_slice_buffer* output,
     output->count = count_before;
     output->length = length_before;
   }
-  deflateEnd(&zs);
+  if (!reuse) deflateEnd(zs);
   return r;
 }
 
 static int zlib_decompress(grpc_slice_buffer* input, grpc_slice_buffer* output,
                            int gzip) {
-  z_stream zs;
+  z_stream local_zs;
+  z_stream* zs;
   int r;
   size_t i;
   size_t count_before = output->count;
   size_t length_before = output->length;
-  memset(&zs, 0, sizeof(zs));
-  zs.zalloc = zalloc_gpr;
-  zs.zfree = zfree_gpr;
-  r = inflateInit2(&zs, 15 | (gzip ? 16 : 0));
-  CHECK(r == Z_OK);
-  r = zlib_body(&zs, input, output, inflate);
+  const bool reuse = grpc_core::IsZlibStreamReuseEnabled();
+  if (reuse) {
+    zs = g_inflate_stream.Inflate(gzip);
+  } else {
+    zs = &local_zs;
+    memset(zs, 0, sizeof(*zs));
+    zs->zalloc = zalloc_gpr;
+    zs->zfree = zfree_gpr;
+    r = inflateInit2(zs, 15 | (gzip ? 16 : 0));
+    CHECK(r == Z_OK);
+  }
+  r = zlib_body(zs, input, output, inflate, input->length * 2);
   if (!r) {
     for (i = count_before; i < output->count; i++) {
       grpc_core::CSliceUnref(output->slices[i]);
@@ -136,7 +235,7 @@ static int zlib_decompress(grpc_slice_buffer* input, grpc_slice_buffer* output,
     output->count = count_before;
     output->length = length_before;
   }
-  inflateEnd(&zs);
+  if (!reuse) inflateEnd(zs);
   return r;
 }
 
@@ -148,7 +247,7 @@ static int copy(grpc_slice_buffer* input, grpc_slice_buffer* output) {
   return 1;
 }
 
-static int compress_inner(grpc_compression_algorithm algorithm,
+static int compress_inner(grpc_compression_algorithm algorithm, int level,
                           grpc_slice_buffer* input, grpc_slice_buffer* output) {
   switch (algorithm) {
     case GRPC_COMPRESS_NONE:
@@ -156,9 +255,9 @@ static int compress_inner(grpc_compression_algorithm algorithm,
       // rely on that here
       return 0;
     case GRPC_COMPRESS_DEFLATE:
-      return zlib_compress(input, output, 0);
+      return zlib_compress(input, output, 0, level);
     case GRPC_COMPRESS_GZIP:
-      return zlib_compress(input, output, 1);
+      return zlib_compress(input, output, 1, level);
     case GRPC_COMPRESS_ALGORITHMS_COUNT:
       break;
   }
@@ -168,7 +267,17 @@ static int compress_inner(grpc_compression_algorithm algorithm,
 
 int grpc_msg_compress(grpc_compression_algorithm algorithm,
                       grpc_slice_buffer* input, grpc_slice_buffer* output) {
-  if (!compress_inner(algorithm, input, output)) {
+  return grpc_msg_compress_with_level(algorithm, Z_DEFAULT_COMPRESSION, input,
+                                      output);
+}
+
+int grpc_msg_compress_with_level(grpc_compression_algorithm algorithm,
+                                 int level, grpc_slice_buffer* input,
+                                 grpc_slice_buffer* output) {
+  if (level < Z_DEFAULT_COMPRESSION || level > Z_BEST_COMPRESSION) {
+    level = Z_DEFAULT_COMPRESSION;
+  }
+  if (!compress_inner(algorithm, level, input, output)) {
     copy(input, output);
     return 0;
   }
@@ -29,6 +29,13 @@
 int grpc_msg_compress(grpc_compression_algorithm algorithm,
                       grpc_slice_buffer* input, grpc_slice_buffer* output);
 
+// Like grpc_msg_compress, but deflate and gzip use the given zlib
+// compression level: 0 (none) to 9 (smallest), or -1 for zlib's default.
+// Out-of-range levels fall back to the default.
+int grpc_msg_compress_with_level(grpc_compression_algorithm algorithm,
+                                 int level, grpc_slice_buffer* input,
+                                 grpc_slice_buffer* output);
+
 // decompress 'input' to 'output' using 'algorithm'.
 // On success, appends slices to output and returns 1.
 // On failure, output is unchanged, and returns 0.
@@ -29,6 +29,12 @@ namespace grpc_event_engine::experimental {
 namespace {
 
 int kDefaultReadBufferSize = 8192;
+// The most a single read event reads before handing the data to the reader.
+constexpr size_t kMaxReadBatchSize = 65536;
+// Slices smaller than this are copied together and written in one call.
+constexpr size_t kMaxCoalescedSliceSize = 1024;
+// The most bytes coalesced into one write.
+constexpr size_t kWriteCoalesceBufferSize = 16384;
 
 absl::Status CFErrorToStatus(CFTypeUniqueRef<CFErrorRef> cf_error) {
   if (cf_error == nullptr) {
@@ -280,26 +286,42 @@ void CFStreamEndpointImpl::DoRead(
   GRPC_TRACE_LOG(event_engine_endpoint, INFO)
       << "CFStreamEndpointImpl::DoRead, this: " << this;
 
-  auto buffer_index = buffer->AppendIndexed(
-      Slice(memory_allocator_.MakeSlice(kDefaultReadBufferSize)));
-
-  CFIndex read_size = CFReadStreamRead(
-      cf_read_stream_,
-      internal::SliceCast<MutableSlice>(buffer->MutableSliceAt(buffer_index))
-          .begin(),
-      kDefaultReadBufferSize);
+  // Keep reading while the stream has bytes available, so that a large
+  // message does not take one dispatch hop per read buffer.
+  size_t total_read_size = 0;
+  do {
+    auto buffer_index = buffer->AppendIndexed(
+        Slice(memory_allocator_.MakeSlice(kDefaultReadBufferSize)));
+
+    CFIndex read_size = CFReadStreamRead(
+        cf_read_stream_,
+        internal::SliceCast<MutableSlice>(buffer->MutableSliceAt(buffer_index))
+            .begin(),
+        kDefaultReadBufferSize);
+
+    if (read_size < 0) {
+      auto status = CFErrorToStatus(CFReadStreamCopyError(cf_read_stream_));
+      GRPC_TRACE_LOG(event_engine_endpoint, INFO)
+          << "CFStream read error: " << status << ", read_size: " << read_size;
+      on_read(status);
+      return;
+    }
 
-  if (read_size < 0) {
-    auto status = CFErrorToStatus(CFReadStreamCopyError(cf_read_stream_));
-    GRPC_TRACE_LOG(event_engine_endpoint, INFO)
-        << "CFStream read error: " << status << ", read_size: " << read_size;
-    on_read(status);
-    return;
-  }
+    buffer->RemoveLastNBytes(kDefaultReadBufferSize - read_size);
+    if (read_size == 0) {
+      if (total_read_size > 0) {
+        // Deliver what was read; the next read finds the end of the stream.
+        read_event_.SetReady();
+      }
+      break;
+    }
+    total_read_size += read_size;
+    if (read_size < kDefaultReadBufferSize) break;
+  } while (total_read_size < kMaxReadBatchSize &&
+           CFReadStreamHasBytesAvailable(cf_read_stream_));
 
-  buffer->RemoveLastNBytes(buffer->Length() - read_size);
-  on_read(read_size == 0 ? absl::InternalError("Socket closed")
-                         : absl::OkStatus());
+  on_read(total_read_size == 0 ? absl::InternalError("Socket closed")
+                               : absl::OkStatus());
 }
 
 bool CFStreamEndpointImpl::Write(
@@ -328,14 +350,35 @@ void CFStreamEndpointImpl::DoWrite(
       << "CFStreamEndpointImpl::DoWrite, this: " << this;
 
   size_t total_written_size = 0;
-  for (size_t i = 0; i < data->Count(); i++) {
+  size_t i = 0;
+  while (i < data->Count()) {
     auto slice = data->RefSlice(i);
-    if (slice.size() == 0) {
+    const uint8_t* bytes = slice.begin();
+    size_t length = slice.size();
+    if (length < kMaxCoalescedSliceSize) {
+      // Copy a run of small slices (such as HTTP/2 frame headers) together, so
+      // that they take one write instead of one each.
+      coalesced_write_.clear();
+      for (; i < data->Count(); i++) {
+        auto small_slice = data->RefSlice(i);
+        if (small_slice.size() >= kMaxCoalescedSliceSize ||
+            coalesced_write_.size() + small_slice.size() >
+                kWriteCoalesceBufferSize) {
+          break;
+        }
+        coalesced_write_.insert(coalesced_write_.end(), small_slice.begin(),
+                                small_slice.end());
+      }
+      bytes = coalesced_write_.data();
+      length = coalesced_write_.size();
+    } else {
+      i++;
+    }
+    if (length == 0) {
       continue;
     }
 
-    CFIndex written_size =
-        CFWriteStreamWrite(cf_write_stream_, slice.begin(), slice.size());
+    CFIndex written_size = CFWriteStreamWrite(cf_write_stream_, bytes, length);
 
     if (written_size < 0) {
       auto status = CFErrorToStatus(CFWriteStreamCopyError(cf_write_stream_));
@@ -347,7 +390,7 @@ void CFStreamEndpointImpl::DoWrite(
     }
 
     total_written_size += written_size;
-    if (written_size < slice.size()) {
+    if (written_size < length) {
       SliceBuffer written;
       data->MoveFirstNBytesIntoSliceBuffer(total_written_size, written);
 
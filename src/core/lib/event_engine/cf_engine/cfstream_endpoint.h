@@ -22,6 +22,9 @@
 #include <CoreFoundation/CoreFoundation.h>
 #include <grpc/event_engine/event_engine.h>
 
+#include <cstdint>
+#include <vector>
+
 #include "absl/strings/str_format.h"
 #include "src/core/lib/address_utils/sockaddr_utils.h"
 #include "src/core/lib/event_engine/cf_engine/cf_engine.h"
@@ -93,6 +96,8 @@ class CFStreamEndpointImpl
   std::string peer_address_string_;
   std::string local_address_string_;
   MemoryAllocator memory_allocator_;
+  // Staging buffer for the small slices that DoWrite writes together.
+  std::vector<uint8_t> coalesced_write_;
 
   LockfreeEvent open_event_;
   LockfreeEvent read_event_;
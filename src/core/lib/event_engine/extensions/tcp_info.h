@@ -0,0 +1,63 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_EXTENSIONS_TCP_INFO_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_EXTENSIONS_TCP_INFO_H
+
+#include <grpc/support/port_platform.h>
+#include <stdint.h>
+
+#include <chrono>
+#include <optional>
+
+#include "absl/strings/string_view.h"
+
+namespace grpc_event_engine::experimental {
+
+/// The kernel's view of a TCP connection, as reported by TCP_INFO.
+struct TcpConnectionInfo {
+  /// Smoothed round trip time (tcpi_rtt).
+  std::chrono::microseconds rtt{0};
+  /// Minimum round trip time seen on the connection (tcpi_min_rtt).
+  std::chrono::microseconds min_rtt{0};
+  /// Most recent rate at which data was delivered to the peer, in bytes per
+  /// second (tcpi_delivery_rate).
+  uint64_t delivery_rate = 0;
+  /// Congestion window, in segments (tcpi_snd_cwnd).
+  uint32_t congestion_window = 0;
+  /// Maximum segment size used for sending (tcpi_snd_mss).
+  uint32_t mss = 0;
+  /// Segments retransmitted since the connection was opened
+  /// (tcpi_total_retrans).
+  uint32_t total_retransmits = 0;
+  /// Bytes in the send buffer that have not been sent yet
+  /// (tcpi_notsent_bytes).
+  uint32_t notsent_bytes = 0;
+};
+
+class TcpInfoExtension {
+ public:
+  virtual ~TcpInfoExtension() = default;
+  static absl::string_view EndpointExtensionName() {
+    return "io.grpc.event_engine.extension.tcp_info";
+  }
+
+  /// Returns the current state of the connection, or std::nullopt if it is
+  /// not available.
+  virtual std::optional<TcpConnectionInfo> GetTcpConnectionInfo() = 0;
+};
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_EXTENSIONS_TCP_INFO_H
@@ -23,6 +23,7 @@
 #include "src/core/lib/event_engine/extensions/can_track_errors.h"
 #include "src/core/lib/event_engine/extensions/chaotic_good_extension.h"
 #include "src/core/lib/event_engine/extensions/supports_fd.h"
+#include "src/core/lib/event_engine/extensions/tcp_info.h"
 #include "src/core/lib/event_engine/query_extensions.h"
 
 namespace grpc_event_engine::experimental {
@@ -38,7 +39,8 @@ class PosixEndpointWithChaoticGoodSupport
 /// may implement to support additional file descriptor related functionality.
 class PosixEndpointWithFdSupport
     : public ExtendedType<EventEngine::Endpoint, EndpointSupportsFdExtension,
-                          EndpointCanTrackErrorsExtension> {};
+                          EndpointCanTrackErrorsExtension, TcpInfoExtension> {
+};
 
 /// Defines an interface that posix EventEngine listeners may implement to
 /// support additional file descriptor related functionality.
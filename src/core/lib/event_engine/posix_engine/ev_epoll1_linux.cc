@@ -19,7 +19,9 @@
 #include <grpc/support/sync.h>
 #include <stdint.h>
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <memory>
 
 #include "absl/log/check.h"
@@ -27,6 +29,7 @@
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/str_format.h"
+#include "src/core/config/config_vars.h"
 #include "src/core/lib/event_engine/poller.h"
 #include "src/core/lib/event_engine/time_util.h"
 #include "src/core/lib/iomgr/port.h"
@@ -38,6 +41,7 @@
 #include <errno.h>
 #include <limits.h>
 #include <sys/epoll.h>
+#include <sys/ioctl.h>
 #include <sys/socket.h>
 #include <unistd.h>
 
@@ -53,6 +57,18 @@
 
 #define MAX_EPOLL_EVENTS_HANDLED_PER_ITERATION 1
 
+// Per epoll set busy poll parameters were added in Linux 6.9. The uapi header
+// that declares them cannot be included alongside <sys/epoll.h>.
+#ifndef EPIOCSPARAMS
+struct epoll_params {
+  uint32_t busy_poll_usecs;
+  uint16_t busy_poll_budget;
+  uint8_t prefer_busy_poll;
+  uint8_t __pad;
+};
+#define EPIOCSPARAMS _IOW(0x8A, 0x01, struct epoll_params)
+#endif
+
 namespace grpc_event_engine::experimental {
 
 class Epoll1EventHandle : public EventHandle {
@@ -117,6 +133,11 @@ class Epoll1EventHandle : public EventHandle {
   void SetWritable() override;
   void SetHasError() override;
   bool IsHandleShutdown() override;
+  void SetAffinity(int affinity) override {
+    read_closure_->SetAffinity(affinity);
+    write_closure_->SetAffinity(affinity);
+    error_closure_->SetAffinity(affinity);
+  }
   inline void ExecutePendingActions() {
     // These may execute in Parallel with ShutdownHandle. Thats not an issue
     // because the lockfree event implementation should be able to handle it.
@@ -307,7 +328,11 @@ void Epoll1EventHandle::HandleShutdownInternal(absl::Status why,
 }
 
 Epoll1Poller::Epoll1Poller(Scheduler* scheduler)
-    : scheduler_(scheduler), was_kicked_(false), closed_(false) {
+    : scheduler_(scheduler),
+      was_kicked_(false),
+      closed_(false),
+      busy_poll_budget_(std::max(
+          0, grpc_core::ConfigVars::Get().EventEnginePollerBusyPollUs())) {
   g_epoll_set_.epfd = EpollCreateAndCloexec();
   wakeup_fd_ = *CreateWakeupFd();
   CHECK(wakeup_fd_ != nullptr);
@@ -321,9 +346,26 @@ Epoll1Poller::Epoll1Poller(Scheduler* scheduler)
                   &ev) == 0);
   g_epoll_set_.num_events = 0;
   g_epoll_set_.cursor = 0;
+  if (busy_poll_budget_.count() > 0) EnableKernelBusyPoll();
   ForkPollerListAddPoller(this);
 }
 
+void Epoll1Poller::EnableKernelBusyPoll() {
+  struct epoll_params params{};
+  params.busy_poll_usecs = static_cast<uint32_t>(busy_poll_budget_.count());
+  // The kernel's default NAPI poll budget.
+  params.busy_poll_budget = 8;
+  params.prefer_busy_poll = 1;
+  if (ioctl(g_epoll_set_.epfd, EPIOCSPARAMS, &params) != 0) {
+    // Kernels before 6.9 only busy poll if the net.core.busy_poll sysctl is
+    // set. The spinning in DoEpollWait() still applies.
+    GRPC_TRACE_LOG(event_engine_poller, INFO)
+        << "(event_engine) Epoll1Poller:" << this
+        << " could not set epoll busy poll parameters: "
+        << grpc_core::StrError(errno);
+  }
+}
+
 void Epoll1Poller::Shutdown() { ForkPollerListRemovePoller(this); }
 
 void Epoll1Poller::Close() {
@@ -421,19 +463,47 @@ bool Epoll1Poller::ProcessEpollEvents(int max_epoll_events_to_handle,
 //  See ProcessEpollEvents() function for more details. It returns the number
 // of events generated by epoll_wait.
 int Epoll1Poller::DoEpollWait(EventEngine::Duration timeout) {
+  int r = 0;
+  if (busy_poll_budget_.count() > 0 &&
+      timeout > EventEngine::Duration::zero()) {
+    // Spin for up to the budget, so that events that arrive soon are picked up
+    // without a wakeup, then block for whatever is left of the timeout.
+    const auto start = std::chrono::steady_clock::now();
+    const auto spin_until = start + std::min<EventEngine::Duration>(
+                                        busy_poll_budget_, timeout);
+    std::chrono::steady_clock::time_point now;
+    do {
+      r = EpollWait(0);
+      now = std::chrono::steady_clock::now();
+    } while (r == 0 && now < spin_until);
+    if (r == 0) {
+      timeout = std::max<EventEngine::Duration>(timeout - (now - start),
+                                                EventEngine::Duration::zero());
+      if (timeout > EventEngine::Duration::zero()) {
+        r = EpollWait(static_cast<int>(
+            grpc_event_engine::experimental::Milliseconds(timeout)));
+      }
+    }
+  } else {
+    r = EpollWait(static_cast<int>(
+        grpc_event_engine::experimental::Milliseconds(timeout)));
+  }
+  g_epoll_set_.num_events = r;
+  g_epoll_set_.cursor = 0;
+  return r;
+}
+
+int Epoll1Poller::EpollWait(int timeout_ms) {
   int r;
   do {
     r = epoll_wait(g_epoll_set_.epfd, g_epoll_set_.events, MAX_EPOLL_EVENTS,
-                   static_cast<int>(
-                       grpc_event_engine::experimental::Milliseconds(timeout)));
+                   timeout_ms);
   } while (r < 0 && errno == EINTR);
   if (r < 0) {
     grpc_core::Crash(absl::StrFormat(
         "(event_engine) Epoll1Poller:%p encountered epoll_wait error: %s", this,
         grpc_core::StrError(errno).c_str()));
   }
-  g_epoll_set_.num_events = r;
-  g_epoll_set_.cursor = 0;
   return r;
 }
 
@@ -542,7 +612,7 @@ namespace grpc_event_engine::experimental {
 using ::grpc_event_engine::experimental::EventEngine;
 using ::grpc_event_engine::experimental::Poller;
 
-Epoll1Poller::Epoll1Poller(Scheduler* /* engine */) {
+Epoll1Poller::Epoll1Poller(Scheduler* /* engine */) : busy_poll_budget_(0) {
   grpc_core::Crash("unimplemented");
 }
 
@@ -17,6 +17,7 @@
 #include <grpc/event_engine/event_engine.h>
 #include <grpc/support/port_platform.h>
 
+#include <chrono>
 #include <list>
 #include <memory>
 #include <string>
@@ -90,6 +91,11 @@ class Epoll1Poller : public PosixEventPoller {
   // of events generated by epoll_wait.
   int DoEpollWait(
       grpc_event_engine::experimental::EventEngine::Duration timeout);
+  // Calls epoll_wait, retrying on EINTR, and returns the number of events.
+  int EpollWait(int timeout_ms);
+  // Asks the kernel to busy poll the network device queues of the sockets in
+  // the epoll set for busy_poll_budget_ whenever epoll_wait finds no events.
+  void EnableKernelBusyPoll();
   class HandlesList {
    public:
     explicit HandlesList(Epoll1EventHandle* handle) : handle(handle) {}
@@ -123,6 +129,9 @@ class Epoll1Poller : public PosixEventPoller {
   std::list<EventHandle*> free_epoll1_handles_list_ ABSL_GUARDED_BY(mu_);
   std::unique_ptr<WakeupFd> wakeup_fd_;
   bool closed_;
+  // How long DoEpollWait() spins on a non-blocking epoll_wait before it
+  // blocks. Zero disables busy polling.
+  const std::chrono::microseconds busy_poll_budget_;
 };
 
 // Return an instance of a epoll1 based poller tied to the specified event
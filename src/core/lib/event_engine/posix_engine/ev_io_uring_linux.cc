@@ -0,0 +1,696 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "src/core/lib/event_engine/posix_engine/ev_io_uring_linux.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/status.h>
+#include <grpc/support/port_platform.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+#include "absl/log/check.h"
+#include "absl/log/log.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/str_format.h"
+#include "src/core/lib/event_engine/poller.h"
+#include "src/core/lib/event_engine/time_util.h"
+#include "src/core/lib/iomgr/port.h"
+#include "src/core/util/crash.h"
+
+#ifdef GRPC_LINUX_IO_URING
+#include <linux/io_uring.h>
+#endif
+
+// The poller needs multishot poll requests (Linux 5.13) and timed waits via
+// IORING_ENTER_EXT_ARG (Linux 5.11). Older UAPI headers get the stub below.
+#if defined(GRPC_LINUX_IO_URING) && defined(IORING_POLL_ADD_MULTI) && \
+    defined(IORING_FEAT_EXT_ARG)
+#include <errno.h>
+#include <limits.h>
+#include <poll.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "src/core/lib/event_engine/posix_engine/event_poller.h"
+#include "src/core/lib/event_engine/posix_engine/lockfree_event.h"
+#include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
+#include "src/core/lib/event_engine/posix_engine/wakeup_fd_posix.h"
+#include "src/core/lib/event_engine/posix_engine/wakeup_fd_posix_default.h"
+#include "src/core/util/fork.h"
+#include "src/core/util/status_helper.h"
+#include "src/core/util/strerror.h"
+#include "src/core/util/sync.h"
+
+#define MAX_IO_URING_EVENTS_HANDLED_PER_ITERATION 1
+
+namespace grpc_event_engine::experimental {
+
+namespace {
+
+// Submission queue size. Requests queued by Work() itself are submitted by the
+// next wait, and all others as soon as they are queued, so only a handful of
+// entries are ever pending at once.
+constexpr unsigned kSubmissionQueueEntries = 64;
+// Completion queue size. Multishot polls post one completion per readiness
+// transition, so this needs to be sized for bursts across many fds. Overflowing
+// completions are retained by the kernel (IORING_FEAT_NODROP).
+constexpr unsigned kCompletionQueueEntries = 4096;
+// user_data of requests whose completions carry no information, e.g. poll
+// removals.
+constexpr uint64_t kIgnoredUserData = 0;
+constexpr uint32_t kPollEvents = POLLIN | POLLPRI | POLLOUT;
+
+int IoUringSetup(unsigned entries, io_uring_params* params) {
+  return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+}
+
+int IoUringEnter(int fd, unsigned to_submit, unsigned min_complete,
+                 unsigned flags, void* arg, size_t arg_size) {
+  return static_cast<int>(syscall(__NR_io_uring_enter, fd, to_submit,
+                                  min_complete, flags, arg, arg_size));
+}
+
+bool HasRequiredFeatures(const io_uring_params& params) {
+  return (params.features & IORING_FEAT_SINGLE_MMAP) &&
+         (params.features & IORING_FEAT_NODROP) &&
+         (params.features & IORING_FEAT_EXT_ARG) &&
+         // Multishot poll predates IORING_FEAT_CQE_SKIP; there is no feature
+         // bit for it, so use the latter as a kernel version check.
+         (params.features & IORING_FEAT_CQE_SKIP);
+}
+
+int IoUringCreate(io_uring_params* params) {
+  memset(params, 0, sizeof(*params));
+  params->flags = IORING_SETUP_CQSIZE;
+  params->cq_entries = kCompletionQueueEntries;
+  int fd = IoUringSetup(kSubmissionQueueEntries, params);
+  if (fd < 0) {
+    GRPC_TRACE_LOG(event_engine_poller, INFO)
+        << "io_uring_setup unavailable: " << grpc_core::StrError(errno);
+    return -1;
+  }
+  if (!HasRequiredFeatures(*params)) {
+    GRPC_TRACE_LOG(event_engine_poller, INFO)
+        << "io_uring is missing required features: " << params->features;
+    close(fd);
+    return -1;
+  }
+  return fd;
+}
+
+// Probe whether the kernel supports the io_uring features used by the poller.
+// io_uring may also be disabled through the kernel.io_uring_disabled sysctl or
+// a seccomp filter, in which case io_uring_setup() fails.
+bool InitIoUringPollerLinux() {
+  if (!grpc_event_engine::experimental::SupportsWakeupFd()) {
+    return false;
+  }
+  io_uring_params params;
+  int fd = IoUringCreate(&params);
+  if (fd < 0) {
+    return false;
+  }
+  close(fd);
+  return true;
+}
+
+}  // namespace
+
+class IoUringEventHandle : public EventHandle {
+ public:
+  IoUringEventHandle(int fd, bool track_err, IoUringPoller* poller)
+      : fd_(fd),
+        user_data_(
+            static_cast<uint64_t>(reinterpret_cast<uintptr_t>(this)) |
+            (track_err ? 1 : 0)),
+        poller_(poller),
+        read_closure_(std::make_unique<LockfreeEvent>(poller->GetScheduler())),
+        write_closure_(std::make_unique<LockfreeEvent>(poller->GetScheduler())),
+        error_closure_(
+            std::make_unique<LockfreeEvent>(poller->GetScheduler())) {
+    read_closure_->InitEvent();
+    write_closure_->InitEvent();
+    error_closure_->InitEvent();
+  }
+  void ReInit(int fd, bool track_err) {
+    fd_ = fd;
+    user_data_ = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(this)) |
+                 (track_err ? 1 : 0);
+    read_closure_->InitEvent();
+    write_closure_->InitEvent();
+    error_closure_->InitEvent();
+    pending_read_.store(false, std::memory_order_relaxed);
+    pending_write_.store(false, std::memory_order_relaxed);
+    pending_error_.store(false, std::memory_order_relaxed);
+    grpc_core::MutexLock lock(&mu_);
+    poll_armed_ = false;
+    poll_removed_ = false;
+    orphaned_ = false;
+  }
+  // Registers the multishot poll request for this handle.
+  void ArmPoll() {
+    grpc_core::MutexLock lock(&mu_);
+    poll_armed_ = true;
+    poller_->SubmitPoll(fd_, user_data_, /*remove=*/false,
+                        /*submit_now=*/true);
+  }
+  // Called by the poller when the kernel reports that the poll request for
+  // this handle has terminated.
+  void OnPollTerminated() {
+    bool release = false;
+    {
+      grpc_core::MutexLock lock(&mu_);
+      poll_armed_ = false;
+      if (orphaned_) {
+        release = true;
+      } else if (!poll_removed_) {
+        // The kernel may terminate a multishot request on its own, e.g. when
+        // the completion queue overflows. Re-arm it with the next wait.
+        poll_armed_ = true;
+        poller_->SubmitPoll(fd_, user_data_, /*remove=*/false,
+                            /*submit_now=*/false);
+      }
+    }
+    if (release) poller_->ReleaseHandle(this);
+  }
+  IoUringPoller* Poller() override { return poller_; }
+  bool SetPendingActions(bool pending_read, bool pending_write,
+                         bool pending_error) {
+    // See Epoll1EventHandle::SetPendingActions for why atomics are needed here.
+    if (pending_read) {
+      pending_read_.store(true, std::memory_order_release);
+    }
+    if (pending_write) {
+      pending_write_.store(true, std::memory_order_release);
+    }
+    if (pending_error) {
+      pending_error_.store(true, std::memory_order_release);
+    }
+    return pending_read || pending_write || pending_error;
+  }
+  int WrappedFd() override { return fd_; }
+  void OrphanHandle(PosixEngineClosure* on_done, int* release_fd,
+                    absl::string_view reason) override;
+  void ShutdownHandle(absl::Status why) override;
+  void NotifyOnRead(PosixEngineClosure* on_read) override;
+  void NotifyOnWrite(PosixEngineClosure* on_write) override;
+  void NotifyOnError(PosixEngineClosure* on_error) override;
+  void SetReadable() override;
+  void SetWritable() override;
+  void SetHasError() override;
+  bool IsHandleShutdown() override;
+  void SetAffinity(int affinity) override {
+    read_closure_->SetAffinity(affinity);
+    write_closure_->SetAffinity(affinity);
+    error_closure_->SetAffinity(affinity);
+  }
+  inline void ExecutePendingActions() {
+    if (pending_read_.exchange(false, std::memory_order_acq_rel)) {
+      read_closure_->SetReady();
+    }
+    if (pending_write_.exchange(false, std::memory_order_acq_rel)) {
+      write_closure_->SetReady();
+    }
+    if (pending_error_.exchange(false, std::memory_order_acq_rel)) {
+      error_closure_->SetReady();
+    }
+  }
+  ~IoUringEventHandle() override = default;
+
+ private:
+  void HandleShutdownInternal(absl::Status why);
+  // Protects the poll request state below, and serializes ShutdownHandle and
+  // OrphanHandle. See Epoll1EventHandle::ShutdownHandle for details.
+  grpc_core::Mutex mu_;
+  int fd_;
+  uint64_t user_data_;
+  std::atomic<bool> pending_read_{false};
+  std::atomic<bool> pending_write_{false};
+  std::atomic<bool> pending_error_{false};
+  // True while the kernel holds a poll request for this handle.
+  bool poll_armed_ ABSL_GUARDED_BY(mu_) = false;
+  // True once a removal of the poll request has been requested.
+  bool poll_removed_ ABSL_GUARDED_BY(mu_) = false;
+  // True once OrphanHandle has finished with the handle.
+  bool orphaned_ ABSL_GUARDED_BY(mu_) = false;
+  IoUringPoller* poller_;
+  std::unique_ptr<LockfreeEvent> read_closure_;
+  std::unique_ptr<LockfreeEvent> write_closure_;
+  std::unique_ptr<LockfreeEvent> error_closure_;
+};
+
+void IoUringEventHandle::OrphanHandle(PosixEngineClosure* on_done,
+                                      int* release_fd,
+                                      absl::string_view reason) {
+  if (!read_closure_->IsShutdown()) {
+    HandleShutdownInternal(absl::Status(absl::StatusCode::kUnknown, reason));
+  }
+  // The poll request holds a reference to the underlying file, so it has to be
+  // removed explicitly regardless of whether the fd is closed or released.
+  {
+    grpc_core::MutexLock lock(&mu_);
+    if (poll_armed_ && !poll_removed_) {
+      poll_removed_ = true;
+      poller_->SubmitPoll(fd_, user_data_, /*remove=*/true,
+                          /*submit_now=*/true);
+    }
+  }
+  if (release_fd != nullptr) {
+    *release_fd = fd_;
+  } else {
+    shutdown(fd_, SHUT_RDWR);
+    close(fd_);
+  }
+  bool release = false;
+  {
+    grpc_core::MutexLock lock(&mu_);
+    read_closure_->DestroyEvent();
+    write_closure_->DestroyEvent();
+    error_closure_->DestroyEvent();
+    pending_read_.store(false, std::memory_order_release);
+    pending_write_.store(false, std::memory_order_release);
+    pending_error_.store(false, std::memory_order_release);
+    orphaned_ = true;
+    // If the poll request is still registered, the handle is returned to the
+    // free list once its final completion has been reaped.
+    release = !poll_armed_;
+  }
+  if (release) poller_->ReleaseHandle(this);
+  if (on_done != nullptr) {
+    on_done->SetStatus(absl::OkStatus());
+    poller_->GetScheduler()->Run(on_done);
+  }
+}
+
+void IoUringEventHandle::HandleShutdownInternal(absl::Status why) {
+  grpc_core::StatusSetInt(&why, grpc_core::StatusIntProperty::kRpcStatus,
+                          GRPC_STATUS_UNAVAILABLE);
+  if (read_closure_->SetShutdown(why)) {
+    write_closure_->SetShutdown(why);
+    error_closure_->SetShutdown(why);
+  }
+}
+
+// Might be called multiple times
+void IoUringEventHandle::ShutdownHandle(absl::Status why) {
+  grpc_core::MutexLock lock(&mu_);
+  HandleShutdownInternal(why);
+}
+
+bool IoUringEventHandle::IsHandleShutdown() {
+  return read_closure_->IsShutdown();
+}
+
+void IoUringEventHandle::NotifyOnRead(PosixEngineClosure* on_read) {
+  read_closure_->NotifyOn(on_read);
+}
+
+void IoUringEventHandle::NotifyOnWrite(PosixEngineClosure* on_write) {
+  write_closure_->NotifyOn(on_write);
+}
+
+void IoUringEventHandle::NotifyOnError(PosixEngineClosure* on_error) {
+  error_closure_->NotifyOn(on_error);
+}
+
+void IoUringEventHandle::SetReadable() { read_closure_->SetReady(); }
+
+void IoUringEventHandle::SetWritable() { write_closure_->SetReady(); }
+
+void IoUringEventHandle::SetHasError() { error_closure_->SetReady(); }
+
+IoUringPoller::IoUringPoller(Scheduler* scheduler)
+    : scheduler_(scheduler), was_kicked_(false), closed_(false) {
+  io_uring_params params;
+  ring_.fd = IoUringCreate(&params);
+  CHECK_GE(ring_.fd, 0);
+  // With IORING_FEAT_SINGLE_MMAP both rings share a single mapping.
+  ring_.ring_size =
+      std::max(params.sq_off.array + params.sq_entries * sizeof(unsigned),
+               params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe));
+  ring_.ring_ptr =
+      mmap(nullptr, ring_.ring_size, PROT_READ | PROT_WRITE,
+           MAP_SHARED | MAP_POPULATE, ring_.fd, IORING_OFF_SQ_RING);
+  CHECK(ring_.ring_ptr != MAP_FAILED);
+  ring_.sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+  ring_.sqes_ptr = mmap(nullptr, ring_.sqes_size, PROT_READ | PROT_WRITE,
+                        MAP_SHARED | MAP_POPULATE, ring_.fd, IORING_OFF_SQES);
+  CHECK(ring_.sqes_ptr != MAP_FAILED);
+  char* base = static_cast<char*>(ring_.ring_ptr);
+  ring_.sq_head = reinterpret_cast<unsigned*>(base + params.sq_off.head);
+  ring_.sq_tail = reinterpret_cast<unsigned*>(base + params.sq_off.tail);
+  ring_.sq_mask = reinterpret_cast<unsigned*>(base + params.sq_off.ring_mask);
+  ring_.sq_array = reinterpret_cast<unsigned*>(base + params.sq_off.array);
+  ring_.sq_entries = params.sq_entries;
+  ring_.cq_head = reinterpret_cast<unsigned*>(base + params.cq_off.head);
+  ring_.cq_tail = reinterpret_cast<unsigned*>(base + params.cq_off.tail);
+  ring_.cq_mask = reinterpret_cast<unsigned*>(base + params.cq_off.ring_mask);
+  ring_.cqes = base + params.cq_off.cqes;
+  wakeup_fd_ = *CreateWakeupFd();
+  CHECK(wakeup_fd_ != nullptr);
+  GRPC_TRACE_LOG(event_engine_poller, INFO) << "grpc io_uring fd: " << ring_.fd;
+  ArmWakeupFd();
+}
+
+void IoUringPoller::Shutdown() {}
+
+void IoUringPoller::Close() {
+  grpc_core::MutexLock lock(&mu_);
+  if (closed_) return;
+  if (ring_.sqes_ptr != nullptr) {
+    munmap(ring_.sqes_ptr, ring_.sqes_size);
+    ring_.sqes_ptr = nullptr;
+  }
+  if (ring_.ring_ptr != nullptr) {
+    munmap(ring_.ring_ptr, ring_.ring_size);
+    ring_.ring_ptr = nullptr;
+  }
+  if (ring_.fd >= 0) {
+    close(ring_.fd);
+    ring_.fd = -1;
+  }
+  while (!free_handles_list_.empty()) {
+    IoUringEventHandle* handle =
+        reinterpret_cast<IoUringEventHandle*>(free_handles_list_.front());
+    free_handles_list_.pop_front();
+    delete handle;
+  }
+  closed_ = true;
+}
+
+IoUringPoller::~IoUringPoller() { Close(); }
+
+void IoUringPoller::SubmitPoll(int fd, uint64_t user_data, bool remove,
+                               bool submit_now) {
+  grpc_core::MutexLock lock(&sq_mu_);
+  unsigned tail = *ring_.sq_tail;
+  unsigned head = __atomic_load_n(ring_.sq_head, __ATOMIC_ACQUIRE);
+  if (tail - head == ring_.sq_entries) {
+    // A burst of re-arms filled the ring before the next wait. Submit them
+    // now to make room.
+    SubmitQueuedLocked(tail - head);
+    head = __atomic_load_n(ring_.sq_head, __ATOMIC_ACQUIRE);
+    CHECK_LT(tail - head, ring_.sq_entries);
+  }
+  unsigned index = tail & *ring_.sq_mask;
+  io_uring_sqe* sqe = static_cast<io_uring_sqe*>(ring_.sqes_ptr) + index;
+  memset(sqe, 0, sizeof(*sqe));
+  if (remove) {
+    sqe->opcode = IORING_OP_POLL_REMOVE;
+    sqe->fd = -1;
+    sqe->addr = user_data;
+    sqe->user_data = kIgnoredUserData;
+  } else {
+    sqe->opcode = IORING_OP_POLL_ADD;
+    sqe->fd = fd;
+    sqe->poll32_events = kPollEvents;
+    sqe->len = IORING_POLL_ADD_MULTI;
+    sqe->user_data = user_data;
+  }
+  ring_.sq_array[index] = index;
+  __atomic_store_n(ring_.sq_tail, tail + 1, __ATOMIC_RELEASE);
+  // Requests queued from within Work() are picked up by the io_uring_enter()
+  // that waits for the next completions. Anything else has to be submitted
+  // here, since the poller may be blocked in that wait.
+  if (submit_now) SubmitQueuedLocked(tail + 1 - head);
+}
+
+void IoUringPoller::SubmitQueuedLocked(unsigned to_submit) {
+  int r;
+  do {
+    r = IoUringEnter(ring_.fd, to_submit, 0, 0, nullptr, 0);
+  } while (r < 0 && errno == EINTR);
+  if (r < 0) {
+    // The requests stay in the submission queue and are picked up by the next
+    // successful submission.
+    LOG(ERROR) << "io_uring_enter submit failed: "
+               << grpc_core::StrError(errno);
+  }
+}
+
+unsigned IoUringPoller::QueuedSubmissions() {
+  grpc_core::MutexLock lock(&sq_mu_);
+  return *ring_.sq_tail - __atomic_load_n(ring_.sq_head, __ATOMIC_ACQUIRE);
+}
+
+void IoUringPoller::ArmWakeupFd() {
+  SubmitPoll(wakeup_fd_->ReadFd(),
+             static_cast<uint64_t>(
+                 reinterpret_cast<uintptr_t>(wakeup_fd_.get())),
+             /*remove=*/false, /*submit_now=*/false);
+}
+
+void IoUringPoller::ReleaseHandle(IoUringEventHandle* handle) {
+  grpc_core::MutexLock lock(&mu_);
+  free_handles_list_.push_back(handle);
+}
+
+EventHandle* IoUringPoller::CreateHandle(int fd, absl::string_view /*name*/,
+                                         bool track_err) {
+  IoUringEventHandle* new_handle = nullptr;
+  {
+    grpc_core::MutexLock lock(&mu_);
+    if (free_handles_list_.empty()) {
+      new_handle = new IoUringEventHandle(fd, track_err, this);
+    } else {
+      new_handle = reinterpret_cast<IoUringEventHandle*>(
+          free_handles_list_.front());
+      free_handles_list_.pop_front();
+      new_handle->ReInit(fd, track_err);
+    }
+  }
+  // As with the epoll1 poller, the least significant bit of the user_data
+  // stores track_err, so that it can be read without touching the handle.
+  new_handle->ArmPoll();
+  return new_handle;
+}
+
+int IoUringPoller::ReapCompletions() {
+  unsigned head = *ring_.cq_head;
+  unsigned tail = __atomic_load_n(ring_.cq_tail, __ATOMIC_ACQUIRE);
+  unsigned mask = *ring_.cq_mask;
+  int n = 0;
+  io_uring_cqe* cqes = static_cast<io_uring_cqe*>(ring_.cqes);
+  while (head != tail && n < MAX_IO_URING_EVENTS) {
+    io_uring_cqe* cqe = &cqes[head & mask];
+    events_[n].user_data = cqe->user_data;
+    events_[n].res = cqe->res;
+    events_[n].flags = cqe->flags;
+    ++n;
+    ++head;
+  }
+  __atomic_store_n(ring_.cq_head, head, __ATOMIC_RELEASE);
+  num_events_ = n;
+  cursor_ = 0;
+  return n;
+}
+
+// Wait for completions and store them in events_. It returns the number of
+// completions copied out of the ring.
+int IoUringPoller::DoIoUringWait(EventEngine::Duration timeout) {
+  // Re-arms queued while processing the previous completions are submitted by
+  // the same io_uring_enter() that waits for the next ones. If completions are
+  // already available, that call returns without blocking.
+  unsigned to_submit = QueuedSubmissions();
+  if (to_submit == 0 && ReapCompletions() > 0) return num_events_;
+  int64_t timeout_ms = std::max<int64_t>(
+      0, grpc_event_engine::experimental::Milliseconds(timeout));
+  __kernel_timespec ts;
+  ts.tv_sec = timeout_ms / 1000;
+  ts.tv_nsec = (timeout_ms % 1000) * 1000000;
+  io_uring_getevents_arg arg;
+  memset(&arg, 0, sizeof(arg));
+  arg.ts = reinterpret_cast<uint64_t>(&ts);
+  int r;
+  do {
+    r = IoUringEnter(ring_.fd, to_submit, 1,
+                     IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG, &arg,
+                     sizeof(arg));
+  } while (r < 0 && errno == EINTR);
+  // EAGAIN and EBUSY leave the queued requests to the next submission.
+  if (r < 0 && errno != ETIME && errno != EAGAIN && errno != EBUSY) {
+    grpc_core::Crash(absl::StrFormat(
+        "(event_engine) IoUringPoller:%p encountered io_uring_enter error: %s",
+        this, grpc_core::StrError(errno).c_str()));
+  }
+  return ReapCompletions();
+}
+
+// Process the completions found by DoIoUringWait() function.
+// - cursor_ points to the index of the first completion to be processed
+// - This function then processes up-to max_events_to_handle completions and
+//   updates cursor_.
+// It returns true, it there was a Kick that forced invocation of this
+// function. It also returns the list of handles that became
+// readable/writable.
+bool IoUringPoller::ProcessCompletions(int max_events_to_handle,
+                                       Events& pending_events) {
+  bool was_kicked = false;
+  const uint64_t wakeup_user_data =
+      static_cast<uint64_t>(reinterpret_cast<uintptr_t>(wakeup_fd_.get()));
+  for (int idx = 0; idx < max_events_to_handle && cursor_ != num_events_;
+       idx++) {
+    const Completion& c = events_[cursor_++];
+    if (c.user_data == kIgnoredUserData) continue;
+    const bool terminated = (c.flags & IORING_CQE_F_MORE) == 0;
+    if (c.user_data == wakeup_user_data) {
+      if (c.res > 0) {
+        CHECK(wakeup_fd_->ConsumeWakeup().ok());
+        was_kicked = true;
+      }
+      if (terminated) ArmWakeupFd();
+      continue;
+    }
+    IoUringEventHandle* handle = reinterpret_cast<IoUringEventHandle*>(
+        static_cast<uintptr_t>(c.user_data & ~uint64_t{1}));
+    if (c.res > 0) {
+      bool track_err = (c.user_data & uint64_t{1}) != 0;
+      uint32_t revents = static_cast<uint32_t>(c.res);
+      bool cancel = (revents & POLLHUP) != 0;
+      bool error = (revents & POLLERR) != 0;
+      bool read_ev = (revents & (POLLIN | POLLPRI)) != 0;
+      bool write_ev = (revents & POLLOUT) != 0;
+      bool err_fallback = error && !track_err;
+      if (handle->SetPendingActions(read_ev || cancel || err_fallback,
+                                    write_ev || cancel || err_fallback,
+                                    error && !err_fallback)) {
+        pending_events.push_back(handle);
+      }
+    }
+    if (terminated) handle->OnPollTerminated();
+  }
+  return was_kicked;
+}
+
+// Polls the registered Fds for events until timeout is reached or there is a
+// Kick(). If there is a Kick(), it collects and processes any previously
+// un-processed events. If there are no un-processed events, it returns
+// Poller::WorkResult::Kicked{}
+Poller::WorkResult IoUringPoller::Work(
+    EventEngine::Duration timeout,
+    absl::FunctionRef<void()> schedule_poll_again) {
+  Events pending_events;
+  bool was_kicked_ext = false;
+  if (cursor_ == num_events_) {
+    if (DoIoUringWait(timeout) == 0) {
+      return Poller::WorkResult::kDeadlineExceeded;
+    }
+  }
+  bool drain_all;
+  {
+    grpc_core::MutexLock lock(&mu_);
+    drain_all = was_kicked_;
+  }
+  // If was_kicked_ is true, collect all pending events in this iteration.
+  // Unlike the epoll1 poller, mu_ is not held while processing completions
+  // because terminated poll requests may need to re-arm or release handles.
+  if (ProcessCompletions(
+          drain_all ? INT_MAX : MAX_IO_URING_EVENTS_HANDLED_PER_ITERATION,
+          pending_events)) {
+    grpc_core::MutexLock lock(&mu_);
+    was_kicked_ = false;
+    was_kicked_ext = true;
+  }
+  if (pending_events.empty()) {
+    return Poller::WorkResult::kKicked;
+  }
+  // Run the provided callback.
+  schedule_poll_again();
+  // Process all pending events inline.
+  for (auto& it : pending_events) {
+    it->ExecutePendingActions();
+  }
+  return was_kicked_ext ? Poller::WorkResult::kKicked : Poller::WorkResult::kOk;
+}
+
+void IoUringPoller::Kick() {
+  grpc_core::MutexLock lock(&mu_);
+  if (was_kicked_ || closed_) {
+    return;
+  }
+  was_kicked_ = true;
+  CHECK(wakeup_fd_->Wakeup().ok());
+}
+
+std::shared_ptr<IoUringPoller> MakeIoUringPoller(Scheduler* scheduler) {
+  // Rings are not shared sanely across fork(); leave prefork servers on
+  // epoll1 for now.
+  if (grpc_core::Fork::Enabled()) return nullptr;
+  static bool kIoUringPollerSupported = InitIoUringPollerLinux();
+  if (kIoUringPollerSupported) {
+    return std::make_shared<IoUringPoller>(scheduler);
+  }
+  return nullptr;
+}
+
+void IoUringPoller::PrepareFork() { Kick(); }
+
+void IoUringPoller::PostforkParent() {}
+
+void IoUringPoller::PostforkChild() {}
+
+}  // namespace grpc_event_engine::experimental
+
+#else  // io_uring poller supported
+
+#if defined(GRPC_POSIX_SOCKET_EV)
+
+namespace grpc_event_engine::experimental {
+
+using ::grpc_event_engine::experimental::EventEngine;
+using ::grpc_event_engine::experimental::Poller;
+
+IoUringPoller::IoUringPoller(Scheduler* /* engine */) {
+  grpc_core::Crash("unimplemented");
+}
+
+void IoUringPoller::Shutdown() { grpc_core::Crash("unimplemented"); }
+
+IoUringPoller::~IoUringPoller() { grpc_core::Crash("unimplemented"); }
+
+EventHandle* IoUringPoller::CreateHandle(int /*fd*/, absl::string_view /*name*/,
+                                         bool /*track_err*/) {
+  grpc_core::Crash("unimplemented");
+}
+
+Poller::WorkResult IoUringPoller::Work(
+    EventEngine::Duration /*timeout*/,
+    absl::FunctionRef<void()> /*schedule_poll_again*/) {
+  grpc_core::Crash("unimplemented");
+}
+
+void IoUringPoller::Kick() { grpc_core::Crash("unimplemented"); }
+
+// io_uring is not available. Return nullptr.
+std::shared_ptr<IoUringPoller> MakeIoUringPoller(Scheduler* /*scheduler*/) {
+  return nullptr;
+}
+
+void IoUringPoller::PrepareFork() {}
+
+void IoUringPoller::PostforkParent() {}
+
+void IoUringPoller::PostforkChild() {}
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // defined(GRPC_POSIX_SOCKET_EV)
+#endif  // io_uring poller supported
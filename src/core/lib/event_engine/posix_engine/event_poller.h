@@ -17,6 +17,7 @@
 #include <grpc/event_engine/event_engine.h>
 #include <grpc/support/port_platform.h>
 
+#include <memory>
 #include <string>
 
 #include "absl/functional/any_invocable.h"
@@ -25,6 +26,7 @@
 #include "src/core/lib/event_engine/forkable.h"
 #include "src/core/lib/event_engine/poller.h"
 #include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
+#include "src/core/lib/event_engine/posix_engine/read_buffer_pool.h"
 
 namespace grpc_event_engine::experimental {
 
@@ -32,6 +34,11 @@ class Scheduler {
  public:
   virtual void Run(experimental::EventEngine::Closure* closure) = 0;
   virtual void Run(absl::AnyInvocable<void()>) = 0;
+  // Run the closure, preferably on a thread associated with \a affinity.
+  virtual void RunWithAffinity(size_t /*affinity*/,
+                               experimental::EventEngine::Closure* closure) {
+    Run(closure);
+  }
   virtual ~Scheduler() = default;
 };
 
@@ -81,6 +88,10 @@ class EventHandle {
   virtual bool IsHandleShutdown() = 0;
   // Returns the poller which was used to create this handle.
   virtual PosixEventPoller* Poller() = 0;
+  // Ask for the closures run in response to events on this handle to be
+  // scheduled with the given affinity (see Scheduler::RunWithAffinity).
+  // Pollers which do not support it ignore the request.
+  virtual void SetAffinity(int /*affinity*/) {}
   virtual ~EventHandle() = default;
 };
 
@@ -101,7 +112,15 @@ class PosixEventPoller : public grpc_event_engine::experimental::Poller,
   //    thread to return.
   // 3. Call Shutdown() on the poller.
   virtual void Shutdown() = 0;
+  // Returns the pool of read buffers shared by endpoints using this poller.
+  const std::shared_ptr<ReadBufferPool>& read_buffer_pool() {
+    return read_buffer_pool_;
+  }
   ~PosixEventPoller() override = default;
+
+ private:
+  std::shared_ptr<ReadBufferPool> read_buffer_pool_ =
+      std::make_shared<ReadBufferPool>();
 };
 
 }  // namespace grpc_event_engine::experimental
@@ -22,6 +22,7 @@
 #include "src/core/config/config_vars.h"
 #include "src/core/lib/event_engine/forkable.h"
 #include "src/core/lib/event_engine/posix_engine/ev_epoll1_linux.h"
+#include "src/core/lib/event_engine/posix_engine/ev_io_uring_linux.h"
 #include "src/core/lib/event_engine/posix_engine/ev_poll_posix.h"
 #include "src/core/lib/event_engine/posix_engine/event_poller.h"
 #include "src/core/lib/iomgr/port.h"
@@ -54,7 +55,12 @@ std::shared_ptr<PosixEventPoller> MakeDefaultPoller(Scheduler* scheduler) {
       absl::StrSplit(grpc_core::ConfigVars::Get().PollStrategy(), ',');
   for (auto it = strings.begin(); it != strings.end() && poller == nullptr;
        it++) {
-    if (PollStrategyMatches(*it, "epoll1")) {
+    // The io_uring poller is still experimental, so it is only used when it is
+    // requested explicitly rather than as part of "all".
+    if (*it == "io_uring") {
+      poller = MakeIoUringPoller(scheduler);
+    }
+    if (poller == nullptr && PollStrategyMatches(*it, "epoll1")) {
       poller = MakeEpoll1Poller(scheduler);
     }
     if (poller == nullptr && PollStrategyMatches(*it, "poll")) {
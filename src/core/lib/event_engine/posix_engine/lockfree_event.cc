@@ -67,6 +67,16 @@ void LockfreeEvent::InitEvent() {
   // be SetReady'd, and so we need to perform an atomic operation here to
   // ensure no races
   state_.store(kClosureNotReady, std::memory_order_relaxed);
+  affinity_.store(-1, std::memory_order_relaxed);
+}
+
+void LockfreeEvent::Schedule(PosixEngineClosure* closure) {
+  int affinity = affinity_.load(std::memory_order_relaxed);
+  if (affinity < 0) {
+    scheduler_->Run(closure);
+  } else {
+    scheduler_->RunWithAffinity(static_cast<size_t>(affinity), closure);
+  }
 }
 
 void LockfreeEvent::DestroyEvent() {
@@ -117,7 +127,7 @@ void LockfreeEvent::NotifyOn(PosixEngineClosure* closure) {
         if (state_.compare_exchange_strong(curr, kClosureNotReady,
                                            std::memory_order_acq_rel,
                                            std::memory_order_acquire)) {
-          scheduler_->Run(closure);
+          Schedule(closure);
           return;  // Successful. Return.
         }
         break;  // retry
@@ -131,7 +141,7 @@ void LockfreeEvent::NotifyOn(PosixEngineClosure* closure) {
           absl::Status shutdown_err =
               grpc_core::internal::StatusGetFromHeapPtr(curr & ~kShutdownBit);
           closure->SetStatus(shutdown_err);
-          scheduler_->Run(closure);
+          Schedule(closure);
           return;
         }
 
@@ -187,7 +197,7 @@ bool LockfreeEvent::SetShutdown(absl::Status shutdown_error) {
                                            std::memory_order_acquire)) {
           auto closure = reinterpret_cast<PosixEngineClosure*>(curr);
           closure->SetStatus(shutdown_error);
-          scheduler_->Run(closure);
+          Schedule(closure);
           return true;
         }
         // 'curr' was a closure but now changed to a different state. We will
@@ -234,7 +244,7 @@ void LockfreeEvent::SetReady() {
           // notify_on (or set_shutdown)
           auto closure = reinterpret_cast<PosixEngineClosure*>(curr);
           closure->SetStatus(absl::OkStatus());
-          scheduler_->Run(closure);
+          Schedule(closure);
           return;
         }
         // else the state changed again (only possible by either a racing
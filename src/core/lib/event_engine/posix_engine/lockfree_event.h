@@ -58,10 +58,20 @@ class LockfreeEvent {
   // Signals that the event has been received.
   void SetReady();
 
+  // Closures scheduled by this event from now on are run with the given
+  // affinity (see Scheduler::RunWithAffinity). A negative value clears it.
+  // Reset by InitEvent().
+  void SetAffinity(int affinity) {
+    affinity_.store(affinity, std::memory_order_relaxed);
+  }
+
  private:
   enum State { kClosureNotReady = 0, kClosureReady = 2, kShutdownBit = 1 };
 
+  void Schedule(PosixEngineClosure* closure);
+
   std::atomic<intptr_t> state_;
+  std::atomic<int> affinity_{-1};
   Scheduler* scheduler_;
 };
 
@@ -24,13 +24,17 @@
 
 #include <algorithm>
 #include <cctype>
+#include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <cstdlib>
+#include <limits>
 #include <memory>
 #include <optional>
 #include <string>
 #include <type_traits>
 
+#include "absl/cleanup/cleanup.h"
 #include "absl/functional/any_invocable.h"
 #include "absl/log/check.h"
 #include "absl/log/log.h"
@@ -64,6 +68,12 @@
 #include <sys/prctl.h>         // IWYU pragma: keep
 #include <sys/resource.h>      // IWYU pragma: keep
 #endif
+#ifdef GRPC_LINUX_MEMFD
+#include <fcntl.h>     // IWYU pragma: keep
+#include <sys/mman.h>  // IWYU pragma: keep
+#include <sys/stat.h>  // IWYU pragma: keep
+#include <unistd.h>    // IWYU pragma: keep
+#endif
 #include <netinet/in.h>  // IWYU pragma: keep
 
 #ifndef SOL_TCP
@@ -90,12 +100,22 @@
 #define MSG_ZEROCOPY 0x4000000
 #endif
 
+// Set in sock_extended_err::ee_code of a zerocopy completion if the kernel
+// copied the data anyway. Defined here for the same reason as MSG_ZEROCOPY.
+#ifndef SO_EE_CODE_ZEROCOPY_COPIED
+#define SO_EE_CODE_ZEROCOPY_COPIED 1
+#endif
+
 #define MAX_READ_IOVEC 64
 
 namespace grpc_event_engine::experimental {
 
 namespace {
 
+// Bounds of the socket buffer sizes the endpoint picks when it tunes them.
+constexpr int kMinTunedSocketBufferSize = 16 * 1024;
+constexpr int kMaxTunedSocketBufferSize = 8 * 1024 * 1024;
+
 // A wrapper around sendmsg. It sends \a msg over \a fd and returns the number
 // of bytes sent.
 ssize_t TcpSend(int fd, const struct msghdr* msg, int* saved_errno,
@@ -216,6 +236,79 @@ absl::Status PosixOSError(int error_no, absl::string_view call_name) {
       call_name, ": ", grpc_core::StrError(error_no), " (", error_no, ")"));
 }
 
+#ifdef GRPC_LINUX_MEMFD
+// Copies data into a new memfd and seals it, so that the peer can map it
+// without it changing underneath. Returns -1 on failure.
+int CopyToSealedMemfd(SliceBuffer& data) {
+  int memfd = memfd_create("grpc_write", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+  if (memfd < 0) return -1;
+  for (size_t i = 0; i < data.Count(); ++i) {
+    Slice slice = data.RefSlice(i);
+    const uint8_t* p = slice.begin();
+    size_t remaining = slice.length();
+    while (remaining > 0) {
+      ssize_t written = write(memfd, p, remaining);
+      if (written < 0 && errno == EINTR) continue;
+      if (written <= 0) {
+        close(memfd);
+        return -1;
+      }
+      p += written;
+      remaining -= written;
+    }
+  }
+  if (fcntl(memfd, F_ADD_SEALS,
+            F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_WRITE | F_SEAL_SEAL) != 0) {
+    close(memfd);
+    return -1;
+  }
+  return memfd;
+}
+
+// A mapped memfd, and the memory charged to the endpoint for it.
+struct MappedMemfd {
+  void* data;
+  size_t length;
+  grpc_core::MemoryAllocator::Reservation reservation;
+};
+
+// Maps a memfd received from the peer, after checking that the peer can no
+// longer change it and that it is no longer than max_length. The mapping is
+// charged to allocator until the returned slice is released.
+absl::StatusOr<Slice> MapMemfd(int memfd, size_t max_length,
+                               grpc_core::MemoryAllocator& allocator) {
+  struct stat st;
+  if (fstat(memfd, &st) != 0) return PosixOSError(errno, "fstat");
+  if (!S_ISREG(st.st_mode) || st.st_size <= 0) {
+    return absl::InternalError("Received a memfd with no data");
+  }
+  constexpr int kRequiredSeals = F_SEAL_SHRINK | F_SEAL_WRITE;
+  int seals = fcntl(memfd, F_GET_SEALS);
+  if (seals < 0 || (seals & kRequiredSeals) != kRequiredSeals) {
+    return absl::InternalError("Received a memfd that is not sealed");
+  }
+  size_t length = static_cast<size_t>(st.st_size);
+  if (length > max_length) {
+    return absl::ResourceExhaustedError(
+        absl::StrCat("Received a memfd of ", length,
+                     " bytes, more than the limit of ", max_length));
+  }
+  void* p = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, memfd, 0);
+  if (p == MAP_FAILED) return PosixOSError(errno, "mmap");
+  auto* mapped = new MappedMemfd{
+      p, length,
+      allocator.MakeReservation(grpc_core::MemoryRequest(length))};
+  return Slice(grpc_slice_new_with_user_data(
+      p, length,
+      [](void* arg) {
+        auto* mapped = static_cast<MappedMemfd*>(arg);
+        munmap(mapped->data, mapped->length);
+        delete mapped;
+      },
+      mapped));
+}
+#endif  // GRPC_LINUX_MEMFD
+
 }  // namespace
 
 #if defined(IOV_MAX) && IOV_MAX < 260
@@ -274,6 +367,36 @@ void PosixEndpointImpl::FinishEstimate() {
     target_length_ = 0.99 * target_length_ + 0.01 * bytes_read_this_round_;
   }
   bytes_read_this_round_ = 0;
+  MaybeTuneReceiveBuffer();
+}
+
+void PosixEndpointImpl::MaybeTuneReceiveBuffer() {
+  // Until memory pressure first shrinks it, the receive buffer is left to the
+  // kernel, whose own tuning stops once SO_RCVBUF is set.
+  if (!auto_tune_receive_buffer_ || receive_buffer_size_ == 0) return;
+  if (memory_owner_.GetPressureInfo().pressure_control_value >= 0.8) return;
+  // Leave room for a couple of read rounds, and only resize when the estimate
+  // has moved far enough from the current size to be worth a syscall.
+  const int size = static_cast<int>(
+      std::clamp(2 * target_length_, double{kMinTunedSocketBufferSize},
+                 double{kMaxTunedSocketBufferSize}));
+  if (size >= 2 * receive_buffer_size_ || size <= receive_buffer_size_ / 4) {
+    SetReceiveBufferSize(size);
+  }
+}
+
+void PosixEndpointImpl::SetReceiveBufferSize(int size) {
+  if (size == receive_buffer_size_) return;
+  receive_buffer_size_ = size;
+  auto status = sock_.SetSocketRcvBuf(size);
+  if (!status.ok()) {
+    GRPC_TRACE_LOG(event_engine_endpoint, INFO)
+        << "Endpoint[" << this << "]: failed to set receive buffer size: "
+        << status;
+    auto_tune_receive_buffer_ = false;
+    return;
+  }
+  grpc_core::global_stats().IncrementTcpSocketBufferResizes();
 }
 
 absl::Status PosixEndpointImpl::TcpAnnotateError(absl::Status src_error) const {
@@ -297,7 +420,18 @@ bool PosixEndpointImpl::TcpDoRead(absl::Status& status) {
 #else
   constexpr size_t cmsg_alloc_space = 24;  // CMSG_SPACE(sizeof(int))
 #endif  // GRPC_LINUX_ERRQUEUE
-  char cmsgbuf[cmsg_alloc_space];
+#ifdef GRPC_LINUX_MEMFD
+  // Room for a memfd passed by the peer of a unix domain socket.
+  alignas(cmsghdr) char cmsgbuf[cmsg_alloc_space + CMSG_SPACE(sizeof(int))];
+  const int recv_flags = is_unix_socket_ ? MSG_CMSG_CLOEXEC : 0;
+  // Without a control buffer, the kernel discards any descriptors the peer
+  // passes and flags the read with MSG_CTRUNC.
+  const bool want_control = inq_capable_ || accept_memfd_;
+#else
+  alignas(cmsghdr) char cmsgbuf[cmsg_alloc_space];
+  const int recv_flags = 0;
+  const bool want_control = inq_capable_;
+#endif  // GRPC_LINUX_MEMFD
   for (size_t i = 0; i < iov_len; i++) {
     MutableSlice& slice =
         internal::SliceCast<MutableSlice>(incoming_buffer_->MutableSliceAt(i));
@@ -308,17 +442,23 @@ bool PosixEndpointImpl::TcpDoRead(absl::Status& status) {
   CHECK_NE(incoming_buffer_->Length(), 0u);
   DCHECK_GT(min_progress_size_, 0);
 
+  int num_reads = 0;
+  auto record_num_reads = absl::MakeCleanup([&num_reads]() {
+    grpc_core::global_stats().IncrementTcpReadBatchSize(num_reads);
+  });
+
   do {
     // Assume there is something on the queue. If we receive TCP_INQ from
     // kernel, we will update this value, otherwise, we have to assume there is
     // always something to read until we get EAGAIN.
     inq_ = 1;
+    queued_bytes_ = 0;
 
     msg.msg_name = nullptr;
     msg.msg_namelen = 0;
     msg.msg_iov = iov;
     msg.msg_iovlen = static_cast<msg_iovlen_type>(iov_len);
-    if (inq_capable_) {
+    if (want_control) {
       msg.msg_control = cmsgbuf;
       msg.msg_controllen = sizeof(cmsgbuf);
     } else {
@@ -330,9 +470,10 @@ bool PosixEndpointImpl::TcpDoRead(absl::Status& status) {
     grpc_core::global_stats().IncrementTcpReadOffer(incoming_buffer_->Length());
     grpc_core::global_stats().IncrementTcpReadOfferIovSize(
         incoming_buffer_->Count());
+    ++num_reads;
     do {
       grpc_core::global_stats().IncrementSyscallRead();
-      read_bytes = recvmsg(fd_, &msg, 0);
+      read_bytes = recvmsg(fd_, &msg, recv_flags);
     } while (read_bytes < 0 && errno == EINTR);
 
     if (read_bytes < 0 && errno == EAGAIN) {
@@ -376,6 +517,7 @@ bool PosixEndpointImpl::TcpDoRead(absl::Status& status) {
         if (cmsg->cmsg_level == SOL_TCP && cmsg->cmsg_type == TCP_CM_INQ &&
             cmsg->cmsg_len == CMSG_LEN(sizeof(int))) {
           inq_ = *reinterpret_cast<int*>(CMSG_DATA(cmsg));
+          queued_bytes_ = inq_;
           break;
         }
       }
@@ -383,6 +525,53 @@ bool PosixEndpointImpl::TcpDoRead(absl::Status& status) {
 #endif  // GRPC_HAVE_TCP_INQ
 
     total_read_bytes += read_bytes;
+
+#ifdef GRPC_LINUX_MEMFD
+    if (is_unix_socket_) {
+      int memfd = -1;
+      bool received_fd = false;
+      for (struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr;
+           cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+        if (cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS) {
+          continue;
+        }
+        const size_t num_fds = (cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+        for (size_t i = 0; i < num_fds; ++i) {
+          int fd;
+          memcpy(&fd, CMSG_DATA(cmsg) + i * sizeof(int), sizeof(int));
+          received_fd = true;
+          if (memfd < 0 && accept_memfd_) {
+            memfd = fd;
+          } else {
+            close(fd);
+          }
+        }
+      }
+      if (received_fd || (msg.msg_flags & MSG_CTRUNC)) {
+        // The kernel ends a read at the message that carries descriptors, so
+        // the marker byte sent along with the memfd is the last byte read.
+        absl::StatusOr<size_t> spliced_length;
+        if (memfd >= 0) {
+          spliced_length = SpliceMemfd(memfd, total_read_bytes);
+        } else if (accept_memfd_) {
+          spliced_length =
+              absl::InternalError("Truncated control message from peer");
+        } else {
+          spliced_length = absl::FailedPreconditionError(
+              "Peer passed a file descriptor, but memfd reads are not "
+              "enabled on this endpoint");
+        }
+        if (!spliced_length.ok()) {
+          incoming_buffer_->Clear();
+          status = TcpAnnotateError(spliced_length.status());
+          return true;
+        }
+        total_read_bytes = *spliced_length;
+        break;
+      }
+    }
+#endif  // GRPC_LINUX_MEMFD
+
     if (inq_ == 0 || total_read_bytes == incoming_buffer_->Length()) {
       break;
     }
@@ -454,11 +643,40 @@ bool PosixEndpointImpl::TcpDoRead(absl::Status& status) {
   return true;
 }
 
+absl::StatusOr<size_t> PosixEndpointImpl::SpliceMemfd(int memfd,
+                                                       size_t read_length) {
+#ifdef GRPC_LINUX_MEMFD
+  absl::StatusOr<Slice> mapped = MapMemfd(
+      memfd,
+      std::max(static_cast<size_t>(min_progress_size_), max_memfd_read_size_),
+      memory_owner_);
+  close(memfd);
+  if (!mapped.ok()) return mapped.status();
+  const size_t mapped_length = mapped->length();
+  SliceBuffer unused;
+  incoming_buffer_->MoveLastNBytesIntoSliceBuffer(
+      incoming_buffer_->Length() - read_length, unused);
+  incoming_buffer_->RemoveLastNBytes(1);
+  incoming_buffer_->Append(*std::move(mapped));
+  unused.MoveFirstNBytesIntoSliceBuffer(unused.Length(), *incoming_buffer_);
+  grpc_core::global_stats().IncrementUnixSocketMemfdReads();
+  return read_length - 1 + mapped_length;
+#else
+  close(memfd);
+  return absl::UnimplementedError("memfd is not supported");
+#endif  // GRPC_LINUX_MEMFD
+}
+
 void PosixEndpointImpl::PerformReclamation() {
   read_mu_.Lock();
   if (incoming_buffer_ != nullptr) {
     incoming_buffer_->Clear();
   }
+  if (auto_tune_receive_buffer_) {
+    // Idle connections otherwise keep whatever the kernel grew their receive
+    // buffer to while they were busy.
+    SetReceiveBufferSize(kMinTunedSocketBufferSize);
+  }
   has_posted_reclaimer_ = false;
   read_mu_.Unlock();
 }
@@ -516,10 +734,34 @@ void PosixEndpointImpl::UpdateRcvLowat() {
   }
 }
 
+bool PosixEndpointImpl::AppendPooledReadSlice(size_t size) {
+  if (read_buffer_pool_ == nullptr) return false;
+  bool reused;
+  incoming_buffer_->AppendIndexed(
+      Slice(read_buffer_pool_->MakeSlice(size, memory_owner_, &reused)));
+  // Only count buffers that actually had to be allocated, so that the
+  // allocation counters reflect the malloc traffic saved by the pool.
+  if (!reused) {
+    if (size == ReadBufferPool::kLargeBufferSize) {
+      grpc_core::global_stats().IncrementTcpReadAlloc64k();
+    } else {
+      grpc_core::global_stats().IncrementTcpReadAlloc8k();
+    }
+  }
+  return true;
+}
+
 void PosixEndpointImpl::MaybeMakeReadSlices() {
-  static const int kBigAlloc = 64 * 1024;
-  static const int kSmallAlloc = 8 * 1024;
-  if (incoming_buffer_->Length() < std::max<size_t>(min_progress_size_, 1)) {
+  static const int kBigAlloc = ReadBufferPool::kLargeBufferSize;
+  static const int kSmallAlloc = ReadBufferPool::kSmallBufferSize;
+  // The most that one recvmsg can read into freshly allocated slices.
+  static const size_t kMaxQueuedLength = MAX_READ_IOVEC * kBigAlloc;
+  // If the last read left bytes queued on the socket, make room for all of
+  // them so that they are drained with one recvmsg.
+  const size_t queued_length =
+      std::min<size_t>(std::max(queued_bytes_, 0), kMaxQueuedLength);
+  if (incoming_buffer_->Length() < std::max<size_t>(min_progress_size_, 1) ||
+      incoming_buffer_->Length() < queued_length) {
     size_t allocate_length = min_progress_size_;
     const size_t target_length = static_cast<size_t>(target_length_);
     // If memory pressure is low and we think there will be more than
@@ -529,22 +771,31 @@ void PosixEndpointImpl::MaybeMakeReadSlices() {
     if (low_memory_pressure && target_length > allocate_length) {
       allocate_length = target_length;
     }
+    if (low_memory_pressure && queued_length > allocate_length) {
+      allocate_length = queued_length;
+    }
+    // Only possible when there is a backlog but memory is short.
+    if (allocate_length <= incoming_buffer_->Length()) return;
     int extra_wanted = std::max<int>(
         1, allocate_length - static_cast<int>(incoming_buffer_->Length()));
     if (extra_wanted >=
         (low_memory_pressure ? kSmallAlloc * 3 / 2 : kBigAlloc)) {
       while (extra_wanted > 0) {
         extra_wanted -= kBigAlloc;
-        incoming_buffer_->AppendIndexed(
-            Slice(memory_owner_.MakeSlice(kBigAlloc)));
-        grpc_core::global_stats().IncrementTcpReadAlloc64k();
+        if (!AppendPooledReadSlice(kBigAlloc)) {
+          incoming_buffer_->AppendIndexed(
+              Slice(memory_owner_.MakeSlice(kBigAlloc)));
+          grpc_core::global_stats().IncrementTcpReadAlloc64k();
+        }
       }
     } else {
       while (extra_wanted > 0) {
         extra_wanted -= kSmallAlloc;
-        incoming_buffer_->AppendIndexed(
-            Slice(memory_owner_.MakeSlice(kSmallAlloc)));
-        grpc_core::global_stats().IncrementTcpReadAlloc8k();
+        if (!AppendPooledReadSlice(kSmallAlloc)) {
+          incoming_buffer_->AppendIndexed(
+              Slice(memory_owner_.MakeSlice(kSmallAlloc)));
+          grpc_core::global_stats().IncrementTcpReadAlloc8k();
+        }
       }
     }
     MaybePostReclaimer();
@@ -669,7 +920,9 @@ TcpZerocopySendRecord* PosixEndpointImpl::TcpGetSendZerocopyRecord(
       ProcessErrors();
       zerocopy_send_record = tcp_zerocopy_send_ctx_->GetSendRecord();
     }
-    if (zerocopy_send_record != nullptr) {
+    if (zerocopy_send_record == nullptr) {
+      grpc_core::global_stats().IncrementTcpZerocopyRecordUnavailable();
+    } else {
       zerocopy_send_record->PrepareForSends(buf);
       DCHECK_EQ(buf.Count(), 0u);
       DCHECK_EQ(buf.Length(), 0u);
@@ -765,7 +1018,11 @@ void PosixEndpointImpl::ProcessZerocopy(struct cmsghdr* cmsg) {
   DCHECK(serr->ee_origin == SO_EE_ORIGIN_ZEROCOPY);
   const uint32_t lo = serr->ee_info;
   const uint32_t hi = serr->ee_data;
+  const bool copied = (serr->ee_code & SO_EE_CODE_ZEROCOPY_COPIED) != 0;
   for (uint32_t seq = lo; seq <= hi; ++seq) {
+    grpc_core::global_stats().IncrementTcpZerocopySent();
+    if (copied) grpc_core::global_stats().IncrementTcpZerocopyCopied();
+    tcp_zerocopy_send_ctx_->NoteSendComplete(copied);
     // TODO(arjunroy): It's likely that lo and hi refer to zerocopy sequence
     // numbers that are generated by a single call to grpc_endpoint_write; ie.
     // we can batch the unref operation. So, check if record is the same for
@@ -1127,6 +1384,44 @@ bool PosixEndpointImpl::TcpFlush(absl::Status& status) {
   }
 }
 
+bool PosixEndpointImpl::TcpFlushMemfd(absl::Status& status) {
+  status = absl::OkStatus();
+#ifdef GRPC_LINUX_MEMFD
+  // The memfd travels with a single marker byte, which the peer replaces with
+  // the memfd's contents.
+  char marker = 0;
+  struct iovec iov;
+  iov.iov_base = &marker;
+  iov.iov_len = 1;
+  alignas(cmsghdr) char cmsgbuf[CMSG_SPACE(sizeof(int))];
+  struct msghdr msg;
+  msg.msg_name = nullptr;
+  msg.msg_namelen = 0;
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = cmsgbuf;
+  msg.msg_controllen = sizeof(cmsgbuf);
+  msg.msg_flags = 0;
+  struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+  cmsg->cmsg_level = SOL_SOCKET;
+  cmsg->cmsg_type = SCM_RIGHTS;
+  cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+  memcpy(CMSG_DATA(cmsg), &current_memfd_, sizeof(int));
+  int saved_errno = 0;
+  if (TcpSend(fd_, &msg, &saved_errno) < 0) {
+    if (saved_errno == EAGAIN || saved_errno == ENOBUFS) {
+      return false;
+    }
+    status = TcpAnnotateError(PosixOSError(saved_errno, "sendmsg"));
+  } else {
+    grpc_core::global_stats().IncrementUnixSocketMemfdWrites();
+  }
+  close(current_memfd_);
+#endif  // GRPC_LINUX_MEMFD
+  current_memfd_ = -1;
+  return true;
+}
+
 void PosixEndpointImpl::HandleWrite(absl::Status status) {
   if (!status.ok()) {
     GRPC_TRACE_LOG(event_engine_endpoint, INFO)
@@ -1137,13 +1432,22 @@ void PosixEndpointImpl::HandleWrite(absl::Status status) {
       UnrefMaybePutZerocopySendRecord(current_zerocopy_send_);
       current_zerocopy_send_ = nullptr;
     }
+    if (current_memfd_ >= 0) {
+      close(current_memfd_);
+      current_memfd_ = -1;
+    }
     cb_(status);
     Unref();
     return;
   }
-  bool flush_result = current_zerocopy_send_ != nullptr
-                          ? TcpFlushZerocopy(current_zerocopy_send_, status)
-                          : TcpFlush(status);
+  bool flush_result;
+  if (current_memfd_ >= 0) {
+    flush_result = TcpFlushMemfd(status);
+  } else if (current_zerocopy_send_ != nullptr) {
+    flush_result = TcpFlushZerocopy(current_zerocopy_send_, status);
+  } else {
+    flush_result = TcpFlush(status);
+  }
   if (!flush_result) {
     DCHECK(status.ok());
     handle_->NotifyOnWrite(on_write_);
@@ -1199,10 +1503,26 @@ bool PosixEndpointImpl::Write(
   if (outgoing_buffer_arg_) {
     CHECK(poller_->CanTrackErrors());
   }
+#ifdef GRPC_LINUX_MEMFD
+  if (memfd_threshold_ > 0 && data->Length() >= memfd_threshold_ &&
+      zerocopy_send_record == nullptr && outgoing_buffer_arg_ == nullptr) {
+    // Hand the peer a sealed copy of the data instead of pushing it through
+    // the socket buffers; on failure, fall back to writing the data.
+    current_memfd_ = CopyToSealedMemfd(*data);
+    if (current_memfd_ >= 0) {
+      data->Clear();
+    }
+  }
+#endif  // GRPC_LINUX_MEMFD
 
-  bool flush_result = zerocopy_send_record != nullptr
-                          ? TcpFlushZerocopy(zerocopy_send_record, status)
-                          : TcpFlush(status);
+  bool flush_result;
+  if (current_memfd_ >= 0) {
+    flush_result = TcpFlushMemfd(status);
+  } else if (zerocopy_send_record != nullptr) {
+    flush_result = TcpFlushZerocopy(zerocopy_send_record, status);
+  } else {
+    flush_result = TcpFlush(status);
+  }
   if (!flush_result) {
     Ref().release();
     write_cb_ = std::move(on_writable);
@@ -1228,6 +1548,27 @@ bool PosixEndpointImpl::Write(
   return true;
 }
 
+std::optional<TcpConnectionInfo> PosixEndpointImpl::GetTcpConnectionInfo() {
+#ifdef GRPC_LINUX_ERRQUEUE
+  tcp_info info;
+  if (GetSocketTcpInfo(&info, fd_) != 0 ||
+      info.length <= offsetof(tcp_info, tcpi_delivery_rate)) {
+    return std::nullopt;
+  }
+  TcpConnectionInfo result;
+  result.rtt = std::chrono::microseconds(info.tcpi_rtt);
+  result.min_rtt = std::chrono::microseconds(info.tcpi_min_rtt);
+  result.delivery_rate = info.tcpi_delivery_rate;
+  result.congestion_window = info.tcpi_snd_cwnd;
+  result.mss = info.tcpi_snd_mss;
+  result.total_retransmits = info.tcpi_total_retrans;
+  result.notsent_bytes = info.tcpi_notsent_bytes;
+  return result;
+#else
+  return std::nullopt;
+#endif  // GRPC_LINUX_ERRQUEUE
+}
+
 void PosixEndpointImpl::MaybeShutdown(
     absl::Status why,
     absl::AnyInvocable<void(absl::StatusOr<int>)> on_release_fd) {
@@ -1277,6 +1618,18 @@ PosixEndpointImpl::PosixEndpointImpl(EventHandle* handle,
   mem_quota_ = options.resource_quota->memory_quota();
   memory_owner_ = mem_quota_->CreateMemoryOwner();
   self_reservation_ = memory_owner_.MakeReservation(sizeof(PosixEndpointImpl));
+  if (grpc_core::IsTcpReadBufferPoolEnabled()) {
+    read_buffer_pool_ = poller_->read_buffer_pool();
+  }
+  if (grpc_core::IsEventEngineWorkerAffinityEnabled()) {
+    // Run the callbacks of this endpoint on the workers associated with the
+    // CPU handling its packets, so the transport state built on top of it
+    // stays in that CPU's caches.
+    auto cpu = sock.GetSocketIncomingCpu();
+    if (cpu.ok() && *cpu >= 0) {
+      handle_->SetAffinity(*cpu);
+    }
+  }
   auto local_address = sock.LocalAddress();
   if (local_address.ok()) {
     local_address_ = *local_address;
@@ -1285,6 +1638,18 @@ PosixEndpointImpl::PosixEndpointImpl(EventHandle* handle,
   if (peer_address.ok()) {
     peer_address_ = *peer_address;
   }
+  is_unix_socket_ = local_address.ok() &&
+                    local_address_.address()->sa_family == AF_UNIX;
+  if (is_unix_socket_) {
+    memfd_threshold_ = options.unix_socket_memfd_threshold;
+    accept_memfd_ = options.unix_socket_accept_memfd;
+    max_memfd_read_size_ = options.max_receive_message_size < 0
+                               ? std::numeric_limits<size_t>::max()
+                               : options.max_receive_message_size;
+  }
+  auto_tune_receive_buffer_ =
+      options.tcp_auto_tune_buffer_sizes &&
+      options.tcp_receive_buffer_size == PosixTcpOptions::kReadBufferSizeUnset;
   target_length_ = static_cast<double>(options.tcp_read_chunk_size);
   bytes_read_this_round_ = 0;
   min_read_chunk_size_ = options.tcp_min_read_chunk_size;
@@ -1321,7 +1686,8 @@ PosixEndpointImpl::PosixEndpointImpl(EventHandle* handle,
 #endif  // GRPC_LINUX_ERRQUEUE
   tcp_zerocopy_send_ctx_ = std::make_unique<TcpZerocopySendCtx>(
       zerocopy_enabled, options.tcp_tx_zerocopy_max_simultaneous_sends,
-      options.tcp_tx_zerocopy_send_bytes_threshold);
+      options.tcp_tx_zerocopy_send_bytes_threshold,
+      grpc_core::IsTcpTxZerocopyAdaptiveEnabled());
 #ifdef GRPC_HAVE_TCP_INQ
   int one = 1;
   if (setsockopt(fd_, SOL_TCP, TCP_INQ, &one, sizeof(one)) == 0) {
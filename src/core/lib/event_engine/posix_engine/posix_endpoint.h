@@ -24,12 +24,15 @@
 #include <grpc/event_engine/slice_buffer.h>
 #include <grpc/support/alloc.h>
 
+#include <algorithm>
 #include <atomic>
+#include <climits>
 #include <cstdint>
 #include <memory>
 #include <new>
 #include <optional>
 #include <utility>
+#include <vector>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/container/flat_hash_map.h"
@@ -40,9 +43,11 @@
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
 #include "src/core/lib/event_engine/extensions/supports_fd.h"
+#include "src/core/lib/event_engine/extensions/tcp_info.h"
 #include "src/core/lib/event_engine/posix.h"
 #include "src/core/lib/event_engine/posix_engine/event_poller.h"
 #include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
+#include "src/core/lib/event_engine/posix_engine/read_buffer_pool.h"
 #include "src/core/lib/event_engine/posix_engine/tcp_socket_utils.h"
 #include "src/core/lib/event_engine/posix_engine/traced_buffer_list.h"
 #include "src/core/lib/iomgr/port.h"
@@ -168,13 +173,31 @@ class TcpZerocopySendCtx {
  public:
   static constexpr int kDefaultMaxSends = 4;
   static constexpr size_t kDefaultSendBytesThreshold = 16 * 1024;  // 16KB
-
+  // If adaptive, the pool of send records grows up to this many times
+  // max_sends.
+  static constexpr int kMaxSendsGrowthFactor = 16;
+  // If adaptive, the threshold is raised up to this many bytes on connections
+  // whose zerocopy sends the kernel copies anyway.
+  static constexpr size_t kMaxSendBytesThreshold = 1024 * 1024;  // 1MB
+
+  // If adaptive is true, the pool of send records starts with max_sends
+  // records and grows when they are all in flight, as long as the socket is
+  // not short of optmem. The threshold doubles every time the kernel reports
+  // that it copied the data of a zerocopy send, and halves, down to
+  // send_bytes_threshold, every time it did not.
   explicit TcpZerocopySendCtx(
       bool zerocopy_enabled, int max_sends = kDefaultMaxSends,
-      size_t send_bytes_threshold = kDefaultSendBytesThreshold)
-      : max_sends_(max_sends),
+      size_t send_bytes_threshold = kDefaultSendBytesThreshold,
+      bool adaptive = false)
+      : max_sends_(adaptive && max_sends < INT_MAX / kMaxSendsGrowthFactor
+                       ? max_sends * kMaxSendsGrowthFactor
+                       : max_sends),
+        initial_sends_(max_sends),
+        num_send_records_(max_sends),
         free_send_records_size_(max_sends),
-        threshold_bytes_(send_bytes_threshold) {
+        min_threshold_bytes_(send_bytes_threshold),
+        threshold_bytes_(send_bytes_threshold),
+        adaptive_(adaptive) {
     send_records_ = static_cast<TcpZerocopySendRecord*>(
         gpr_malloc(max_sends * sizeof(*send_records_)));
     free_send_records_ = static_cast<TcpZerocopySendRecord**>(
@@ -186,7 +209,7 @@ class TcpZerocopySendCtx {
       memory_limited_ = true;
       enabled_ = false;
     } else {
-      for (int idx = 0; idx < max_sends_; ++idx) {
+      for (int idx = 0; idx < initial_sends_; ++idx) {
         new (send_records_ + idx) TcpZerocopySendRecord();
         free_send_records_[idx] = send_records_ + idx;
       }
@@ -196,7 +219,7 @@ class TcpZerocopySendCtx {
 
   ~TcpZerocopySendCtx() {
     if (send_records_ != nullptr) {
-      for (int idx = 0; idx < max_sends_; ++idx) {
+      for (int idx = 0; idx < initial_sends_; ++idx) {
         send_records_[idx].~TcpZerocopySendRecord();
       }
     }
@@ -274,7 +297,7 @@ class TcpZerocopySendCtx {
   // same time.
   void PutSendRecord(TcpZerocopySendRecord* record) {
     grpc_core::MutexLock lock(&mu_);
-    DCHECK(record >= send_records_ && record < send_records_ + max_sends_);
+    DCHECK(OwnsSendRecordLocked(record));
     PutSendRecordLocked(record);
   }
 
@@ -286,7 +309,7 @@ class TcpZerocopySendCtx {
   // enabled.
   bool AllSendRecordsEmpty() {
     grpc_core::MutexLock lock(&mu_);
-    return free_send_records_size_ == max_sends_;
+    return free_send_records_size_ == num_send_records_;
   }
 
   bool Enabled() const { return enabled_; }
@@ -294,7 +317,33 @@ class TcpZerocopySendCtx {
   // Only use zerocopy if we are sending at least this many bytes. The
   // additional overhead of reading the error queue for notifications means that
   // zerocopy is not useful for small transfers.
-  size_t ThresholdBytes() const { return threshold_bytes_; }
+  size_t ThresholdBytes() const {
+    return threshold_bytes_.load(std::memory_order_relaxed);
+  }
+
+  // Called for every zerocopy sendmsg() the kernel reports as complete.
+  // copied is true if the kernel reported SO_EE_CODE_ZEROCOPY_COPIED, i.e.
+  // that it had to copy the data anyway, typically because the route does
+  // not support it (eg. loopback). Zerocopy then only adds the cost of
+  // handling the completion, so the threshold is raised.
+  void NoteSendComplete(bool copied) {
+    if (!adaptive_) return;
+    size_t threshold = threshold_bytes_.load(std::memory_order_relaxed);
+    if (copied) {
+      const size_t max_threshold =
+          std::max(kMaxSendBytesThreshold, min_threshold_bytes_);
+      threshold = std::min(threshold * 2, max_threshold);
+    } else {
+      threshold = std::max(threshold / 2, min_threshold_bytes_);
+    }
+    threshold_bytes_.store(threshold, std::memory_order_relaxed);
+  }
+
+  // The number of send records, including the ones the pool has grown by.
+  int NumSendRecords() {
+    grpc_core::MutexLock lock(&mu_);
+    return num_send_records_;
+  }
 
   // Expected to be called by handler reading messages from the err queue.
   // It is used to indicate that some optmem memory is now available. It returns
@@ -433,29 +482,72 @@ class TcpZerocopySendCtx {
     if (shutdown_.load(std::memory_order_acquire)) {
       return nullptr;
     }
-    if (free_send_records_size_ == 0) {
+    if (free_send_records_size_ == 0 && !GrowSendRecordsLocked()) {
       return nullptr;
     }
     free_send_records_size_--;
     return free_send_records_[free_send_records_size_];
   }
 
+  // Doubles the number of send records, up to max_sends_. Returns false if
+  // the pool cannot grow, or should not because the socket is short of
+  // optmem, in which case more zerocopy sends in flight would not help.
+  bool GrowSendRecordsLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    if (num_send_records_ >= max_sends_ ||
+        zcopy_enobuf_state_ != OptMemState::kOpen) {
+      return false;
+    }
+    const int grow_by =
+        std::min(num_send_records_, max_sends_ - num_send_records_);
+    auto& records = grown_send_records_.emplace_back(
+        std::make_unique<TcpZerocopySendRecord[]>(grow_by), grow_by);
+    num_send_records_ += grow_by;
+    free_send_records_ = static_cast<TcpZerocopySendRecord**>(gpr_realloc(
+        free_send_records_, num_send_records_ * sizeof(*free_send_records_)));
+    for (int idx = 0; idx < grow_by; ++idx) {
+      free_send_records_[free_send_records_size_++] = &records.first[idx];
+    }
+    return true;
+  }
+
+  bool OwnsSendRecordLocked(TcpZerocopySendRecord* record)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    if (record >= send_records_ && record < send_records_ + initial_sends_) {
+      return true;
+    }
+    for (const auto& [records, size] : grown_send_records_) {
+      if (record >= records.get() && record < records.get() + size) {
+        return true;
+      }
+    }
+    return false;
+  }
+
   void PutSendRecordLocked(TcpZerocopySendRecord* record)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
-    DCHECK(free_send_records_size_ < max_sends_);
+    DCHECK(free_send_records_size_ < num_send_records_);
     free_send_records_[free_send_records_size_] = record;
     free_send_records_size_++;
   }
 
   TcpZerocopySendRecord* send_records_ ABSL_GUARDED_BY(mu_);
+  // The records the pool has grown by, and how many there are of each.
+  std::vector<std::pair<std::unique_ptr<TcpZerocopySendRecord[]>, int>>
+      grown_send_records_ ABSL_GUARDED_BY(mu_);
   TcpZerocopySendRecord** free_send_records_ ABSL_GUARDED_BY(mu_);
-  int max_sends_;
+  // The most send records the pool may grow to.
+  const int max_sends_;
+  // The number of records in send_records_.
+  const int initial_sends_;
+  int num_send_records_ ABSL_GUARDED_BY(mu_);
   int free_send_records_size_ ABSL_GUARDED_BY(mu_);
   grpc_core::Mutex mu_;
   uint32_t last_send_ = 0;
   std::atomic<bool> shutdown_{false};
   bool enabled_ = false;
-  size_t threshold_bytes_ = kDefaultSendBytesThreshold;
+  const size_t min_threshold_bytes_;
+  std::atomic<size_t> threshold_bytes_;
+  const bool adaptive_;
   absl::flat_hash_map<uint32_t, TcpZerocopySendRecord*> ctx_lookup_
       ABSL_GUARDED_BY(mu_);
   bool memory_limited_ = false;
@@ -492,6 +584,8 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
 
   bool CanTrackErrors() const { return poller_->CanTrackErrors(); }
 
+  std::optional<TcpConnectionInfo> GetTcpConnectionInfo();
+
   void MaybeShutdown(
       absl::Status why,
       absl::AnyInvocable<void(absl::StatusOr<int> release_fd)> on_release_fd);
@@ -504,9 +598,18 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
   bool HandleReadLocked(absl::Status& status)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
   void MaybeMakeReadSlices() ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
+  // Appends a read buffer from read_buffer_pool_ to incoming_buffer_. Returns
+  // false if buffer pooling is disabled.
+  bool AppendPooledReadSlice(size_t size)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
   bool TcpDoRead(absl::Status& status) ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
-  void FinishEstimate();
+  void FinishEstimate() ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
   void AddToEstimate(size_t bytes);
+  // Sets SO_RCVBUF to follow the read estimate, once memory pressure has made
+  // the endpoint take it over from the kernel. SO_SNDBUF is left to the
+  // kernel, which keeps tuning it as long as it is never set.
+  void MaybeTuneReceiveBuffer() ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
+  void SetReceiveBufferSize(int size) ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
   void MaybePostReclaimer() ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
   void PerformReclamation() ABSL_LOCKS_EXCLUDED(read_mu_);
   // Zero copy related helper methods.
@@ -515,6 +618,14 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
   bool DoFlushZerocopy(TcpZerocopySendRecord* record, absl::Status& status);
   bool TcpFlushZerocopy(TcpZerocopySendRecord* record, absl::Status& status);
   bool TcpFlush(absl::Status& status);
+  // Passes current_memfd_ to the peer. Returns false if the socket is not
+  // writable yet.
+  bool TcpFlushMemfd(absl::Status& status);
+  // Replaces the marker byte that ends the first read_length bytes of
+  // incoming_buffer_ with the contents of a memfd received from the peer, and
+  // returns the new number of bytes read. Takes ownership of memfd.
+  absl::StatusOr<size_t> SpliceMemfd(int memfd, size_t read_length)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
   void TcpShutdownTracedBufferList();
   void UnrefMaybePutZerocopySendRecord(TcpZerocopySendRecord* record);
   void ZerocopyDisableAndWaitForRemaining();
@@ -548,6 +659,9 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
       ABSL_GUARDED_BY(read_mu_) = nullptr;
   // bytes pending on the socket from the last read.
   int inq_ = 1;
+  // bytes that TCP_INQ reported still queued after the last read, or 0 if the
+  // kernel did not say. Unlike inq_, never assumed to be non-zero.
+  int queued_bytes_ = 0;
   // cache whether kernel supports inq.
   bool inq_capable_ = false;
 
@@ -570,6 +684,9 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
   grpc_core::MemoryQuotaRefPtr mem_quota_;
   grpc_core::MemoryOwner memory_owner_;
   grpc_core::MemoryAllocator::Reservation self_reservation_;
+  // Source of recycled read buffers, shared with the other endpoints of the
+  // same poller. Only used when the tcp_read_buffer_pool experiment is on.
+  std::shared_ptr<ReadBufferPool> read_buffer_pool_;
 
   void* outgoing_buffer_arg_ = nullptr;
 
@@ -589,6 +706,24 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
   std::atomic<bool> stop_error_notification_{false};
   std::unique_ptr<TcpZerocopySendCtx> tcp_zerocopy_send_ctx_;
   TcpZerocopySendRecord* current_zerocopy_send_ = nullptr;
+  // Whether fd_ is a unix domain socket, whose peer may pass writes as memfds.
+  bool is_unix_socket_ = false;
+  // Whether memfds passed by the peer are read. If not, a peer that passes a
+  // descriptor fails the read.
+  bool accept_memfd_ = false;
+  // Memfds longer than this, or than the current read hint if that is larger,
+  // are rejected.
+  size_t max_memfd_read_size_ = 0;
+  // Writes of at least this many bytes to a unix domain socket are passed to
+  // the peer as sealed memfds. 0 disables it.
+  size_t memfd_threshold_ = 0;
+  // The memfd of the write in progress, or -1.
+  int current_memfd_ = -1;
+  // Whether the receive buffer size is tuned by the endpoint.
+  bool auto_tune_receive_buffer_ = false;
+  // The size the receive buffer was last set to, or 0 while the kernel still
+  // sizes it.
+  int receive_buffer_size_ ABSL_GUARDED_BY(read_mu_) = 0;
   // A hint from upper layers specifying the minimum number of bytes that need
   // to be read to make meaningful progress.
   int min_progress_size_ = 1;
@@ -644,6 +779,11 @@ class PosixEndpoint : public PosixEndpointWithFdSupport {
 
   bool CanTrackErrors() override { return impl_->CanTrackErrors(); }
 
+  std::optional<TcpConnectionInfo> GetTcpConnectionInfo() override {
+    if (shutdown_.load(std::memory_order_acquire)) return std::nullopt;
+    return impl_->GetTcpConnectionInfo();
+  }
+
   void Shutdown(absl::AnyInvocable<void(absl::StatusOr<int> release_fd)>
                     on_release_fd) override {
     if (!shutdown_.exchange(true, std::memory_order_acq_rel)) {
@@ -706,6 +846,11 @@ class PosixEndpoint : public PosixEndpointWithFdSupport {
         "PosixEndpoint::CanTrackErrors not supported on this platform");
   }
 
+  std::optional<TcpConnectionInfo> GetTcpConnectionInfo() override {
+    grpc_core::Crash(
+        "PosixEndpoint::GetTcpConnectionInfo not supported on this platform");
+  }
+
   void Shutdown(absl::AnyInvocable<void(absl::StatusOr<int> release_fd)>
                     on_release_fd) override {
     grpc_core::Crash("PosixEndpoint::Shutdown not supported on this platform");
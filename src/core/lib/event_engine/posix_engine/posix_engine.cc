@@ -36,6 +36,7 @@
 #include "absl/status/status.h"
 #include "absl/strings/match.h"
 #include "absl/strings/str_cat.h"
+#include "src/core/config/config_vars.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/event_engine/ares_resolver.h"
 #include "src/core/lib/event_engine/forkable.h"
@@ -259,7 +260,7 @@ PosixEventEngine::CreateEndpointFromUnconnectedFdInternal(
   }
 
   std::string name = absl::StrCat("tcp-client:", addr_uri.value());
-  PosixEventPoller* poller = poller_manager_->Poller();
+  PosixEventPoller* poller = poller_manager_->ConnectionPoller();
   EventHandle* handle =
       poller->CreateHandle(fd, name, poller->CanTrackErrors());
 
@@ -312,18 +313,38 @@ void PosixEventEngine::OnConnectFinishInternal(int connection_handle) {
 }
 
 PosixEnginePollerManager::PosixEnginePollerManager(
-    std::shared_ptr<ThreadPool> executor)
-    : poller_(grpc_event_engine::experimental::MakeDefaultPoller(this)),
-      executor_(std::move(executor)),
-      trigger_shutdown_called_(false) {}
+    std::shared_ptr<ThreadPool> executor, size_t num_pollers)
+    : executor_(std::move(executor)), trigger_shutdown_called_(false) {
+  DCHECK_GE(num_pollers, 1u);
+  pollers_.reserve(num_pollers);
+  for (size_t i = 0; i < num_pollers; ++i) {
+    auto poller = grpc_event_engine::experimental::MakeDefaultPoller(this);
+    if (poller == nullptr) break;
+    pollers_.push_back(std::move(poller));
+  }
+}
 
 PosixEnginePollerManager::PosixEnginePollerManager(
     std::shared_ptr<PosixEventPoller> poller)
-    : poller_(std::move(poller)),
-      poller_state_(PollerState::kExternal),
+    : poller_state_(PollerState::kExternal),
       executor_(nullptr),
       trigger_shutdown_called_(false) {
-  DCHECK_NE(poller_, nullptr);
+  DCHECK_NE(poller, nullptr);
+  pollers_.push_back(std::move(poller));
+}
+
+std::vector<PosixEventPoller*> PosixEnginePollerManager::Pollers() {
+  std::vector<PosixEventPoller*> pollers;
+  pollers.reserve(pollers_.size());
+  for (auto& poller : pollers_) pollers.push_back(poller.get());
+  return pollers;
+}
+
+PosixEventPoller* PosixEnginePollerManager::ConnectionPoller() {
+  if (pollers_.size() == 1) return pollers_.front().get();
+  return pollers_[next_poller_.fetch_add(1, std::memory_order_relaxed) %
+                  pollers_.size()]
+      .get();
 }
 
 void PosixEnginePollerManager::Run(
@@ -339,6 +360,13 @@ void PosixEnginePollerManager::Run(absl::AnyInvocable<void()> cb) {
   }
 }
 
+void PosixEnginePollerManager::RunWithAffinity(
+    size_t affinity, experimental::EventEngine::Closure* closure) {
+  if (executor_ != nullptr) {
+    executor_->RunWithAffinity(affinity, closure);
+  }
+}
+
 void PosixEnginePollerManager::TriggerShutdown() {
   DCHECK(trigger_shutdown_called_ == false);
   trigger_shutdown_called_ = true;
@@ -346,10 +374,10 @@ void PosixEnginePollerManager::TriggerShutdown() {
   // set poller state to PollerState::kShuttingDown.
   if (poller_state_.exchange(PollerState::kShuttingDown) ==
       PollerState::kExternal) {
-    poller_ = nullptr;
+    pollers_.clear();
     return;
   }
-  poller_->Kick();
+  for (auto& poller : pollers_) poller->Kick();
 }
 
 std::shared_ptr<PosixEventEngine> PosixEventEngine::MakePosixEventEngine() {
@@ -375,9 +403,7 @@ PosixEventEngine::MakeTestOnlyPosixEventEngine(
 #endif  // GRPC_POSIX_SOCKET_TCP
 
 PosixEnginePollerManager::~PosixEnginePollerManager() {
-  if (poller_ != nullptr) {
-    poller_->Shutdown();
-  }
+  for (auto& poller : pollers_) poller->Shutdown();
 }
 
 PosixEventEngine::PosixEventEngine(std::shared_ptr<PosixEventPoller> poller)
@@ -406,33 +432,35 @@ PosixEventEngine::PosixEventEngine()
       TimerForkCallbackMethods::PostforkParent,
       TimerForkCallbackMethods::PostforkChild);
 #if GRPC_PLATFORM_SUPPORTS_POSIX_POLLING
-  poller_manager_ = std::make_shared<PosixEnginePollerManager>(executor_);
+  poller_manager_ = std::make_shared<PosixEnginePollerManager>(
+      executor_,
+      std::max(grpc_core::ConfigVars::Get().EventEnginePollerCount(), 1));
   // The threadpool must be instantiated after the poller otherwise, the
   // process will deadlock when forking.
-  if (poller_manager_->Poller() != nullptr) {
-    executor_->Run([poller_manager = poller_manager_]() {
-      PollerWorkInternal(poller_manager);
+  for (size_t i = 0; i < poller_manager_->NumPollers(); ++i) {
+    executor_->Run([poller_manager = poller_manager_, i]() {
+      PollerWorkInternal(poller_manager, i);
     });
   }
 #endif  // GRPC_PLATFORM_SUPPORTS_POSIX_POLLING
 }
 
 void PosixEventEngine::PollerWorkInternal(
-    std::shared_ptr<PosixEnginePollerManager> poller_manager) {
+    std::shared_ptr<PosixEnginePollerManager> poller_manager, size_t index) {
   // TODO(vigneshbabu): The timeout specified here is arbitrary. For instance,
   // this can be improved by setting the timeout to the next expiring timer.
-  PosixEventPoller* poller = poller_manager->Poller();
+  PosixEventPoller* poller = poller_manager->Poller(index);
   ThreadPool* executor = poller_manager->Executor();
-  auto result = poller->Work(24h, [executor, &poller_manager]() {
-    executor->Run([poller_manager]() mutable {
-      PollerWorkInternal(std::move(poller_manager));
+  auto result = poller->Work(24h, [executor, &poller_manager, index]() {
+    executor->Run([poller_manager, index]() mutable {
+      PollerWorkInternal(std::move(poller_manager), index);
     });
   });
   if (result == Poller::WorkResult::kDeadlineExceeded) {
     // The EventEngine is not shutting down but the next asynchronous
     // PollerWorkInternal did not get scheduled. Schedule it now.
-    executor->Run([poller_manager = std::move(poller_manager)]() {
-      PollerWorkInternal(poller_manager);
+    executor->Run([poller_manager = std::move(poller_manager), index]() {
+      PollerWorkInternal(poller_manager, index);
     });
   } else if (result == Poller::WorkResult::kKicked &&
              poller_manager->IsShuttingDown()) {
@@ -690,7 +718,7 @@ PosixEventEngine::CreatePosixEndpointFromFd(int fd,
                                             MemoryAllocator memory_allocator) {
 #if GRPC_PLATFORM_SUPPORTS_POSIX_POLLING
   DCHECK_GT(fd, 0);
-  PosixEventPoller* poller = poller_manager_->Poller();
+  PosixEventPoller* poller = poller_manager_->ConnectionPoller();
   DCHECK_NE(poller, nullptr);
   EventHandle* handle =
       poller->CreateHandle(fd, "tcp-client", poller->CanTrackErrors());
@@ -736,7 +764,7 @@ PosixEventEngine::CreateListener(
       };
   return std::make_unique<PosixEngineListener>(
       std::move(posix_on_accept), std::move(on_shutdown), config,
-      std::move(memory_allocator_factory), poller_manager_->Poller(),
+      std::move(memory_allocator_factory), poller_manager_->Pollers(),
       shared_from_this());
 #else   // GRPC_PLATFORM_SUPPORTS_POSIX_POLLING
   grpc_core::Crash(
@@ -753,7 +781,7 @@ PosixEventEngine::CreatePosixListener(
 #if GRPC_PLATFORM_SUPPORTS_POSIX_POLLING
   return std::make_unique<PosixEngineListener>(
       std::move(on_accept), std::move(on_shutdown), config,
-      std::move(memory_allocator_factory), poller_manager_->Poller(),
+      std::move(memory_allocator_factory), poller_manager_->Pollers(),
       shared_from_this());
 #else   // GRPC_PLATFORM_SUPPORTS_POSIX_POLLING
   grpc_core::Crash(
@@ -94,23 +94,38 @@ class AsyncConnect {
   bool connect_cancelled_;
 };
 
-// A helper class to manager lifetime of the poller associated with the
+// A helper class to manager lifetime of the pollers associated with the
 // posix EventEngine.
 class PosixEnginePollerManager
     : public grpc_event_engine::experimental::Scheduler {
  public:
-  explicit PosixEnginePollerManager(std::shared_ptr<ThreadPool> executor);
+  // Creates num_pollers pollers, or none if the platform has no usable
+  // poller.
+  PosixEnginePollerManager(std::shared_ptr<ThreadPool> executor,
+                           size_t num_pollers);
   explicit PosixEnginePollerManager(
       std::shared_ptr<grpc_event_engine::experimental::PosixEventPoller>
           poller);
+  // The first poller, which polls listening sockets and anything else that
+  // is not a connection. Null if there are no pollers.
   grpc_event_engine::experimental::PosixEventPoller* Poller() {
-    return poller_.get();
+    return pollers_.empty() ? nullptr : pollers_.front().get();
   }
+  grpc_event_engine::experimental::PosixEventPoller* Poller(size_t index) {
+    return pollers_[index].get();
+  }
+  size_t NumPollers() const { return pollers_.size(); }
+  std::vector<grpc_event_engine::experimental::PosixEventPoller*> Pollers();
+  // Returns the poller for the next new connection. Connections are spread
+  // over the pollers round-robin.
+  grpc_event_engine::experimental::PosixEventPoller* ConnectionPoller();
 
   ThreadPool* Executor() { return executor_.get(); }
 
   void Run(experimental::EventEngine::Closure* closure) override;
   void Run(absl::AnyInvocable<void()>) override;
+  void RunWithAffinity(size_t affinity,
+                       experimental::EventEngine::Closure* closure) override;
 
   bool IsShuttingDown() {
     return poller_state_.load(std::memory_order_acquire) ==
@@ -122,7 +137,10 @@ class PosixEnginePollerManager
 
  private:
   enum class PollerState { kExternal, kOk, kShuttingDown };
-  std::shared_ptr<grpc_event_engine::experimental::PosixEventPoller> poller_;
+  std::vector<
+      std::shared_ptr<grpc_event_engine::experimental::PosixEventPoller>>
+      pollers_;
+  std::atomic<size_t> next_poller_{0};
   std::atomic<PollerState> poller_state_{PollerState::kOk};
   std::shared_ptr<ThreadPool> executor_;
   bool trigger_shutdown_called_;
@@ -235,7 +253,7 @@ class PosixEventEngine final : public PosixEventEngineWithFdSupport,
   };
 
   static void PollerWorkInternal(
-      std::shared_ptr<PosixEnginePollerManager> poller_manager);
+      std::shared_ptr<PosixEnginePollerManager> poller_manager, size_t index);
 
   ConnectionHandle CreateEndpointFromUnconnectedFdInternal(
       int fd, EventEngine::OnConnectCallback on_connect,
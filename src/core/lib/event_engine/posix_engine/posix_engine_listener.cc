@@ -32,6 +32,7 @@
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "absl/functional/any_invocable.h"
 #include "absl/log/check.h"
@@ -57,8 +58,10 @@ PosixEngineListenerImpl::PosixEngineListenerImpl(
     const grpc_event_engine::experimental::EndpointConfig& config,
     std::unique_ptr<grpc_event_engine::experimental::MemoryAllocatorFactory>
         memory_allocator_factory,
-    PosixEventPoller* poller, std::shared_ptr<EventEngine> engine)
-    : poller_(poller),
+    std::vector<PosixEventPoller*> pollers,
+    std::shared_ptr<EventEngine> engine)
+    : pollers_(std::move(pollers)),
+      poller_(pollers_.front()),
       options_(TcpOptionsFromEndpointConfig(config)),
       engine_(std::move(engine)),
       acceptors_(this),
@@ -66,6 +69,12 @@ PosixEngineListenerImpl::PosixEngineListenerImpl(
       on_shutdown_(std::move(on_shutdown)),
       memory_allocator_factory_(std::move(memory_allocator_factory)) {}
 
+PosixEventPoller* PosixEngineListenerImpl::ConnectionPoller() {
+  if (pollers_.size() == 1) return poller_;
+  return pollers_[next_poller_.fetch_add(1, std::memory_order_relaxed) %
+                  pollers_.size()];
+}
+
 absl::StatusOr<int> PosixEngineListenerImpl::Bind(
     const EventEngine::ResolvedAddress& addr,
     PosixListenerWithFdSupport::OnPosixBindNewFdCallback on_bind_new_fd) {
@@ -117,6 +126,43 @@ absl::StatusOr<int> PosixEngineListenerImpl::Bind(
   return result->port;
 }
 
+void PosixEngineListenerImpl::ListenerAsyncAcceptors::AddReusePortShards(
+    ListenerSocket socket) {
+  const PosixTcpOptions& options = listener_->options_;
+  if (options.listener_shards <= 1 ||
+      socket.addr.address()->sa_family == AF_UNIX ||
+      ResolvedAddressIsVSock(socket.addr)) {
+    return;
+  }
+  // All shards must be bound to the port chosen for the first socket.
+  EventEngine::ResolvedAddress addr = socket.addr;
+  ResolvedAddressSetPort(addr, socket.port);
+  int num_shards = 1;
+  for (; num_shards < options.listener_shards; ++num_shards) {
+    auto shard = CreateAndPrepareListenerSocket(options, addr);
+    if (!shard.ok()) {
+      LOG(ERROR) << "Failed to add listener shard " << num_shards << " for "
+                 << ResolvedAddressToString(addr).value_or("<unknown>")
+                 << ": " << shard.status();
+      break;
+    }
+    AddAcceptor(*shard);
+  }
+  GRPC_TRACE_LOG(event_engine, INFO)
+      << "Listening on " << ResolvedAddressToString(addr).value_or("<unknown>")
+      << " with " << num_shards << " SO_REUSEPORT shards";
+  if (options.listener_cpu_steering && num_shards > 1) {
+    // The program is attached to the whole SO_REUSEPORT group. It indexes the
+    // sockets of the group in the order they started listening, which is the
+    // order they were created in above.
+    auto status = socket.sock.SetSocketReusePortCpuSteering(num_shards);
+    if (!status.ok()) {
+      LOG(ERROR) << "Failed to enable CPU steering of listener shards: "
+                 << status;
+    }
+  }
+}
+
 void PosixEngineListenerImpl::AsyncConnectionAcceptor::Start() {
   Ref();
   handle_->NotifyOnRead(notify_on_accept_);
@@ -224,9 +270,10 @@ void PosixEngineListenerImpl::AsyncConnectionAcceptor::NotifyOnAccept(
       Unref();
       return;
     }
+    PosixEventPoller* poller = listener_->ConnectionPoller();
     auto endpoint = CreatePosixEndpoint(
-        /*handle=*/listener_->poller_->CreateHandle(
-            fd, *peer_name, listener_->poller_->CanTrackErrors()),
+        /*handle=*/poller->CreateHandle(fd, *peer_name,
+                                        poller->CanTrackErrors()),
         /*on_shutdown=*/nullptr, /*engine=*/listener_->engine_,
         // allocator=
         listener_->memory_allocator_factory_->CreateMemoryAllocator(
@@ -270,9 +317,10 @@ absl::Status PosixEngineListenerImpl::HandleExternalConnection(
   }
   grpc_core::EnsureRunInExecCtx([this, peer_name = std::move(*peer_name),
                                  pending_data, listener_fd, fd]() mutable {
+    PosixEventPoller* poller = ConnectionPoller();
     auto endpoint = CreatePosixEndpoint(
-        /*handle=*/poller_->CreateHandle(fd, peer_name,
-                                         poller_->CanTrackErrors()),
+        /*handle=*/poller->CreateHandle(fd, peer_name,
+                                        poller->CanTrackErrors()),
         /*on_shutdown=*/nullptr, /*engine=*/engine_,
         /*allocator=*/
         memory_allocator_factory_->CreateMemoryAllocator(absl::StrCat(
@@ -26,6 +26,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/functional/any_invocable.h"
@@ -55,7 +56,8 @@ class PosixEngineListenerImpl
       const grpc_event_engine::experimental::EndpointConfig& config,
       std::unique_ptr<grpc_event_engine::experimental::MemoryAllocatorFactory>
           memory_allocator_factory,
-      PosixEventPoller* poller, std::shared_ptr<EventEngine> engine);
+      std::vector<PosixEventPoller*> pollers,
+      std::shared_ptr<EventEngine> engine);
   // Binds an address to the listener. This creates a ListenerSocket
   // and sets its fields appropriately.
   absl::StatusOr<int> Bind(
@@ -137,11 +139,8 @@ class PosixEngineListenerImpl
     }
 
     void Append(ListenerSocket socket) override {
-      acceptors_.push_back(new AsyncConnectionAcceptor(
-          listener_->engine_, listener_->shared_from_this(), socket));
-      if (on_append_) {
-        on_append_(socket.sock.Fd());
-      }
+      AddAcceptor(socket);
+      AddReusePortShards(socket);
     }
 
     absl::StatusOr<ListenerSocket> Find(
@@ -167,6 +166,19 @@ class PosixEngineListenerImpl
     }
 
    private:
+    void AddAcceptor(ListenerSocket socket) {
+      acceptors_.push_back(new AsyncConnectionAcceptor(
+          listener_->engine_, listener_->shared_from_this(), socket));
+      if (on_append_) {
+        on_append_(socket.sock.Fd());
+      }
+    }
+    // When listener sharding is enabled, opens the remaining
+    // options_.listener_shards - 1 sockets of the SO_REUSEPORT group of
+    // `socket`, each with its own acceptor. Failing to open a shard is not
+    // fatal: the listener keeps working with the shards opened so far.
+    void AddReusePortShards(ListenerSocket socket);
+
     PosixListenerWithFdSupport::OnPosixBindNewFdCallback on_append_;
     std::list<AsyncConnectionAcceptor*> acceptors_;
     PosixEngineListenerImpl* listener_;
@@ -175,8 +187,14 @@ class PosixEngineListenerImpl
   friend class AsyncConnectionAcceptor;
   // The mutex ensures thread safety when multiple threads try to call Bind
   // and Start in parallel.
+  // Returns the poller for the next accepted connection. Connections are
+  // spread over pollers_ round-robin.
+  PosixEventPoller* ConnectionPoller();
   grpc_core::Mutex mu_;
-  PosixEventPoller* poller_;
+  // The listening sockets are always polled by the first poller.
+  const std::vector<PosixEventPoller*> pollers_;
+  PosixEventPoller* const poller_;
+  std::atomic<size_t> next_poller_{0};
   PosixTcpOptions options_;
   std::shared_ptr<EventEngine> engine_;
   // Linked list of sockets. One is created upon each successful bind
@@ -203,10 +221,12 @@ class PosixEngineListener : public PosixListenerWithFdSupport {
       const grpc_event_engine::experimental::EndpointConfig& config,
       std::unique_ptr<grpc_event_engine::experimental::MemoryAllocatorFactory>
           memory_allocator_factory,
-      PosixEventPoller* poller, std::shared_ptr<EventEngine> engine)
+      std::vector<PosixEventPoller*> pollers,
+      std::shared_ptr<EventEngine> engine)
       : impl_(std::make_shared<PosixEngineListenerImpl>(
             std::move(on_accept), std::move(on_shutdown), config,
-            std::move(memory_allocator_factory), poller, std::move(engine))) {}
+            std::move(memory_allocator_factory), std::move(pollers),
+            std::move(engine))) {}
   ~PosixEngineListener() override { ShutdownListeningFds(); };
   absl::StatusOr<int> Bind(
       const grpc_event_engine::experimental::EventEngine::ResolvedAddress& addr)
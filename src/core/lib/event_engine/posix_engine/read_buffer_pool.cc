@@ -0,0 +1,132 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/posix_engine/read_buffer_pool.h"
+
+#include <grpc/support/alloc.h>
+#include <grpc/support/port_platform.h>
+#include <stdint.h>
+
+#include <new>
+#include <utility>
+
+#include "absl/log/check.h"
+#include "src/core/lib/experiments/experiments.h"
+#include "src/core/lib/slice/slice_refcount.h"
+#include "src/core/util/huge_page_allocator.h"
+
+namespace grpc_event_engine::experimental {
+
+namespace {
+
+void FreeBlock(void* block) {
+  if (!grpc_core::HugePageAllocator::MaybeFree(block)) gpr_free(block);
+}
+
+}  // namespace
+
+// Header placed in front of the data of every pooled block. It lives only
+// while the block is handed out as a slice: it is destroyed when the slice's
+// last reference is dropped and constructed again when the block is reused.
+class ReadBufferPool::Block : public grpc_slice_refcount {
+ public:
+  Block(std::shared_ptr<ReadBufferPool> pool,
+        MemoryAllocator::Reservation reservation, size_t size)
+      : grpc_slice_refcount(Destroy),
+        pool_(std::move(pool)),
+        reservation_(std::move(reservation)),
+        size_(size) {}
+
+  uint8_t* data() { return reinterpret_cast<uint8_t*>(this) + HeaderSize(); }
+
+  // The header is rounded up so that the data stays max_align_t aligned.
+  static constexpr size_t HeaderSize() {
+    return (sizeof(Block) + alignof(max_align_t) - 1) &
+           ~(alignof(max_align_t) - 1);
+  }
+
+ private:
+  static void Destroy(grpc_slice_refcount* p) {
+    auto* block = static_cast<Block*>(p);
+    std::shared_ptr<ReadBufferPool> pool = std::move(block->pool_);
+    size_t size = block->size_;
+    // Releases the memory quota charged for this slice.
+    block->~Block();
+    pool->Return(block, size);
+  }
+
+  std::shared_ptr<ReadBufferPool> pool_;
+  MemoryAllocator::Reservation reservation_;
+  size_t size_;
+};
+
+ReadBufferPool::ReadBufferPool(size_t max_cached_bytes)
+    : max_cached_bytes_(max_cached_bytes) {}
+
+ReadBufferPool::~ReadBufferPool() {
+  for (void* block : small_.blocks) FreeBlock(block);
+  for (void* block : large_.blocks) FreeBlock(block);
+}
+
+ReadBufferPool::FreeList& ReadBufferPool::FreeListFor(size_t size) {
+  if (size == kSmallBufferSize) return small_;
+  CHECK_EQ(size, kLargeBufferSize);
+  return large_;
+}
+
+grpc_slice ReadBufferPool::MakeSlice(size_t size, MemoryAllocator& allocator,
+                                     bool* reused) {
+  void* p = nullptr;
+  {
+    grpc_core::MutexLock lock(&mu_);
+    FreeList& free_list = FreeListFor(size);
+    if (!free_list.blocks.empty()) {
+      p = free_list.blocks.back();
+      free_list.blocks.pop_back();
+      cached_bytes_ -= size;
+    }
+  }
+  if (reused != nullptr) *reused = p != nullptr;
+  if (p == nullptr && grpc_core::IsHugePageSlabAllocatorEnabled()) {
+    p = grpc_core::HugePageAllocator::MaybeAlloc(Block::HeaderSize() + size);
+  }
+  if (p == nullptr) p = gpr_malloc(Block::HeaderSize() + size);
+  auto* block = new (p)
+      Block(shared_from_this(),
+            allocator.MakeReservation(Block::HeaderSize() + size), size);
+  grpc_slice slice;
+  slice.refcount = block;
+  slice.data.refcounted.bytes = block->data();
+  slice.data.refcounted.length = size;
+  return slice;
+}
+
+void ReadBufferPool::Return(void* block, size_t size) {
+  {
+    grpc_core::MutexLock lock(&mu_);
+    if (cached_bytes_ + size <= max_cached_bytes_) {
+      FreeListFor(size).blocks.push_back(block);
+      cached_bytes_ += size;
+      return;
+    }
+  }
+  FreeBlock(block);
+}
+
+size_t ReadBufferPool::TestOnlyCachedBytes() {
+  grpc_core::MutexLock lock(&mu_);
+  return cached_bytes_;
+}
+
+}  // namespace grpc_event_engine::experimental
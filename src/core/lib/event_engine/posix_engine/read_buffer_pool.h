@@ -0,0 +1,79 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_READ_BUFFER_POOL_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_READ_BUFFER_POOL_H
+
+#include <grpc/event_engine/memory_allocator.h>
+#include <grpc/slice.h>
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+
+#include <memory>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "src/core/util/sync.h"
+
+namespace grpc_event_engine::experimental {
+
+// A cache of fixed size read buffers shared by all the endpoints of a poller.
+//
+// Slices returned by MakeSlice() are charged to the caller's memory allocator
+// just like MemoryAllocator::MakeSlice(). When the last reference to such a
+// slice is dropped, the quota is released and the backing block goes back to
+// the pool instead of being freed, so the next read reuses memory which is
+// already faulted in (and likely cache resident) without a trip through
+// malloc. The pool keeps at most max_cached_bytes worth of idle blocks.
+class ReadBufferPool : public std::enable_shared_from_this<ReadBufferPool> {
+ public:
+  static constexpr size_t kSmallBufferSize = 8 * 1024;
+  static constexpr size_t kLargeBufferSize = 64 * 1024;
+  static constexpr size_t kDefaultMaxCachedBytes = 4 * 1024 * 1024;
+
+  explicit ReadBufferPool(size_t max_cached_bytes = kDefaultMaxCachedBytes);
+  ~ReadBufferPool();
+
+  ReadBufferPool(const ReadBufferPool&) = delete;
+  ReadBufferPool& operator=(const ReadBufferPool&) = delete;
+
+  // Returns a slice of exactly `size` bytes charged to `allocator`. `size`
+  // must be either kSmallBufferSize or kLargeBufferSize. Sets *reused to
+  // whether the block came from the pool, if reused is not null.
+  grpc_slice MakeSlice(size_t size, MemoryAllocator& allocator,
+                       bool* reused = nullptr);
+
+  // Returns the number of bytes held by idle blocks.
+  size_t TestOnlyCachedBytes();
+
+ private:
+  class Block;
+  struct FreeList {
+    std::vector<void*> blocks;
+  };
+
+  FreeList& FreeListFor(size_t size) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void Return(void* block, size_t size);
+
+  const size_t max_cached_bytes_;
+  grpc_core::Mutex mu_;
+  size_t cached_bytes_ ABSL_GUARDED_BY(mu_) = 0;
+  // Idle blocks of kSmallBufferSize and kLargeBufferSize bytes.
+  FreeList small_ ABSL_GUARDED_BY(mu_);
+  FreeList large_ ABSL_GUARDED_BY(mu_);
+};
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_READ_BUFFER_POOL_H
@@ -34,6 +34,7 @@
 #ifdef GRPC_POSIX_SOCKET_UTILS_COMMON
 #include <arpa/inet.h>  // IWYU pragma: keep
 #ifdef GRPC_LINUX_TCP_H
+#include <linux/filter.h>
 #include <linux/tcp.h>
 #else
 #include <netinet/in.h>  // IWYU pragma: keep
@@ -173,6 +174,18 @@ PosixTcpOptions TcpOptionsFromEndpointConfig(const EndpointConfig& config) {
   options.tcp_receive_buffer_size =
       AdjustValue(PosixTcpOptions::kReadBufferSizeUnset, 0, INT_MAX,
                   config.GetInt(GRPC_ARG_TCP_RECEIVE_BUFFER_SIZE));
+  options.unix_socket_memfd_threshold =
+      AdjustValue(0, 0, INT_MAX,
+                  config.GetInt(GRPC_ARG_UNIX_SOCKET_MEMFD_THRESHOLD));
+  options.unix_socket_accept_memfd =
+      (AdjustValue(0, 0, 1,
+                   config.GetInt(GRPC_ARG_UNIX_SOCKET_ACCEPT_MEMFD)) != 0);
+  options.max_receive_message_size =
+      AdjustValue(GRPC_DEFAULT_MAX_RECV_MESSAGE_LENGTH, -1, INT_MAX,
+                  config.GetInt(GRPC_ARG_MAX_RECEIVE_MESSAGE_LENGTH));
+  options.tcp_auto_tune_buffer_sizes =
+      (AdjustValue(0, 0, 1,
+                   config.GetInt(GRPC_ARG_TCP_AUTO_TUNE_BUFFER_SIZES)) != 0);
   options.tcp_tx_zero_copy_enabled =
       (AdjustValue(PosixTcpOptions::kZerocpTxEnabledDefault, 0, 1,
                    config.GetInt(GRPC_ARG_TCP_TX_ZEROCOPY_ENABLED)) != 0);
@@ -192,6 +205,17 @@ PosixTcpOptions TcpOptionsFromEndpointConfig(const EndpointConfig& config) {
         (AdjustValue(0, 1, INT_MAX, config.GetInt(GRPC_ARG_ALLOW_REUSEPORT)) !=
          0);
   }
+  options.listener_shards =
+      AdjustValue(1, 1, PosixTcpOptions::kMaxListenerShards,
+                  config.GetInt(GRPC_ARG_TCP_LISTENER_SHARDS));
+  if (!options.allow_reuse_port) {
+    // Sharding relies on binding several sockets to the same port.
+    options.listener_shards = 1;
+  }
+  options.listener_cpu_steering =
+      (AdjustValue(0, 1, INT_MAX,
+                   config.GetInt(GRPC_ARG_TCP_LISTENER_SHARD_CPU_STEERING)) !=
+       0);
   if (options.tcp_min_read_chunk_size > options.tcp_max_read_chunk_size) {
     options.tcp_min_read_chunk_size = options.tcp_max_read_chunk_size;
   }
@@ -484,6 +508,50 @@ absl::Status PosixSocketWrapper::SetSocketReusePort(int reuse) {
 #endif
 }
 
+absl::Status PosixSocketWrapper::SetSocketReusePortCpuSteering(
+    int num_sockets) {
+#if defined(GRPC_LINUX_TCP_H) && defined(SO_ATTACH_REUSEPORT_CBPF)
+  CHECK_GT(num_sockets, 0);
+  // A = cpu; A %= num_sockets; return A
+  struct sock_filter code[] = {
+      {BPF_LD | BPF_W | BPF_ABS, 0, 0,
+       static_cast<uint32_t>(SKF_AD_OFF + SKF_AD_CPU)},
+      {BPF_ALU | BPF_MOD | BPF_K, 0, 0, static_cast<uint32_t>(num_sockets)},
+      {BPF_RET | BPF_A, 0, 0, 0},
+  };
+  struct sock_fprog prog;
+  prog.len = sizeof(code) / sizeof(code[0]);
+  prog.filter = code;
+  if (0 != setsockopt(fd_, SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF, &prog,
+                      sizeof(prog))) {
+    return absl::Status(absl::StatusCode::kInternal,
+                        absl::StrCat("setsockopt(SO_ATTACH_REUSEPORT_CBPF): ",
+                                     grpc_core::StrError(errno)));
+  }
+  return absl::OkStatus();
+#else
+  (void)num_sockets;
+  return absl::Status(absl::StatusCode::kInternal,
+                      "SO_ATTACH_REUSEPORT_CBPF unavailable on compiling system");
+#endif
+}
+
+absl::StatusOr<int> PosixSocketWrapper::GetSocketIncomingCpu() {
+#ifdef SO_INCOMING_CPU
+  int cpu = -1;
+  socklen_t len = sizeof(cpu);
+  if (0 != getsockopt(fd_, SOL_SOCKET, SO_INCOMING_CPU, &cpu, &len)) {
+    return absl::Status(absl::StatusCode::kInternal,
+                        absl::StrCat("getsockopt(SO_INCOMING_CPU): ",
+                                     grpc_core::StrError(errno)));
+  }
+  return cpu;
+#else
+  return absl::Status(absl::StatusCode::kUnimplemented,
+                      "SO_INCOMING_CPU unavailable on compiling system");
+#endif
+}
+
 bool PosixSocketWrapper::IsSocketReusePortSupported() {
   static bool kSupportSoReusePort = []() -> bool {
     int s = socket(AF_INET, SOCK_STREAM, 0);
@@ -843,6 +911,15 @@ absl::Status PosixSocketWrapper::SetSocketReusePort(int /*reuse*/) {
   grpc_core::Crash("unimplemented");
 }
 
+absl::Status PosixSocketWrapper::SetSocketReusePortCpuSteering(
+    int /*num_sockets*/) {
+  grpc_core::Crash("unimplemented");
+}
+
+absl::StatusOr<int> PosixSocketWrapper::GetSocketIncomingCpu() {
+  grpc_core::Crash("unimplemented");
+}
+
 absl::Status PosixSocketWrapper::SetSocketDscp(int /*dscp*/) {
   grpc_core::Crash("unimplemented");
 }
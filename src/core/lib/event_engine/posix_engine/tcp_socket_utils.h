@@ -59,17 +59,24 @@ struct PosixTcpOptions {
   // Let the system decide the proper buffer size.
   static constexpr int kReadBufferSizeUnset = -1;
   static constexpr int kDscpNotSet = -1;
+  static constexpr int kMaxListenerShards = 1024;
   int tcp_read_chunk_size = kDefaultReadChunkSize;
   int tcp_min_read_chunk_size = kDefaultMinReadChunksize;
   int tcp_max_read_chunk_size = kDefaultMaxReadChunksize;
   int tcp_tx_zerocopy_send_bytes_threshold = kDefaultSendBytesThreshold;
   int tcp_tx_zerocopy_max_simultaneous_sends = kDefaultMaxSends;
   int tcp_receive_buffer_size = kReadBufferSizeUnset;
+  int unix_socket_memfd_threshold = 0;
+  bool unix_socket_accept_memfd = false;
+  int max_receive_message_size = GRPC_DEFAULT_MAX_RECV_MESSAGE_LENGTH;
+  bool tcp_auto_tune_buffer_sizes = false;
   bool tcp_tx_zero_copy_enabled = kZerocpTxEnabledDefault;
   int keep_alive_time_ms = 0;
   int keep_alive_timeout_ms = 0;
   bool expand_wildcard_addrs = false;
   bool allow_reuse_port = false;
+  int listener_shards = 1;
+  bool listener_cpu_steering = false;
   int dscp = kDscpNotSet;
   grpc_core::RefCountedPtr<grpc_core::ResourceQuota> resource_quota;
   struct grpc_socket_mutator* socket_mutator = nullptr;
@@ -136,11 +143,17 @@ struct PosixTcpOptions {
         other.tcp_tx_zerocopy_send_bytes_threshold;
     tcp_tx_zerocopy_max_simultaneous_sends =
         other.tcp_tx_zerocopy_max_simultaneous_sends;
+    unix_socket_memfd_threshold = other.unix_socket_memfd_threshold;
+    unix_socket_accept_memfd = other.unix_socket_accept_memfd;
+    max_receive_message_size = other.max_receive_message_size;
+    tcp_auto_tune_buffer_sizes = other.tcp_auto_tune_buffer_sizes;
     tcp_tx_zero_copy_enabled = other.tcp_tx_zero_copy_enabled;
     keep_alive_time_ms = other.keep_alive_time_ms;
     keep_alive_timeout_ms = other.keep_alive_timeout_ms;
     expand_wildcard_addrs = other.expand_wildcard_addrs;
     allow_reuse_port = other.allow_reuse_port;
+    listener_shards = other.listener_shards;
+    listener_cpu_steering = other.listener_cpu_steering;
     dscp = other.dscp;
   }
 };
@@ -189,6 +202,15 @@ class PosixSocketWrapper {
   // Set SO_REUSEPORT
   absl::Status SetSocketReusePort(int reuse);
 
+  // Attach a SO_ATTACH_REUSEPORT_CBPF program to the SO_REUSEPORT group of this
+  // socket which steers each incoming connection to the socket at index
+  // (cpu % num_sockets) in the group.
+  absl::Status SetSocketReusePortCpuSteering(int num_sockets);
+
+  // Returns the CPU which processed the last packet received on the socket
+  // (SO_INCOMING_CPU), or a negative value if it is not known yet.
+  absl::StatusOr<int> GetSocketIncomingCpu();
+
   // Set Differentiated Services Code Point (DSCP)
   absl::Status SetSocketDscp(int dscp);
 
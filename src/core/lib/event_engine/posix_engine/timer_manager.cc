@@ -28,7 +28,10 @@
 #include "absl/log/check.h"
 #include "absl/log/log.h"
 #include "absl/time/time.h"
+#include "src/core/config/config_vars.h"
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/event_engine/posix_engine/timer_wheel.h"
+#include "src/core/lib/experiments/experiments.h"
 
 static thread_local bool g_timer_thread;
 
@@ -85,7 +88,11 @@ bool TimerManager::IsTimerManagerThread() { return g_timer_thread; }
 TimerManager::TimerManager(
     std::shared_ptr<grpc_event_engine::experimental::ThreadPool> thread_pool)
     : host_(this), thread_pool_(std::move(thread_pool)) {
-  timer_list_ = std::make_unique<TimerList>(&host_);
+  if (grpc_core::IsEventEngineTimerWheelEnabled()) {
+    timer_list_ = std::make_unique<TimerWheel>(&host_);
+  } else {
+    timer_list_ = std::make_unique<TimerList>(&host_);
+  }
   main_loop_exit_signal_.emplace();
   thread_pool_->Run([this]() { MainLoop(); });
 }
@@ -97,6 +104,10 @@ grpc_core::Timestamp TimerManager::Host::Now() {
 
 void TimerManager::TimerInit(Timer* timer, grpc_core::Timestamp deadline,
                              experimental::EventEngine::Closure* closure) {
+  if (GPR_UNLIKELY(restart_pending_.load(std::memory_order_relaxed)) &&
+      restart_pending_.exchange(false, std::memory_order_acq_rel)) {
+    RestartPostFork();
+  }
   if (GRPC_TRACE_FLAG_ENABLED(timer)) {
     grpc_core::MutexLock lock(&mu_);
     if (shutdown_) {
@@ -146,7 +157,20 @@ void TimerManager::RestartPostFork() {
 }
 
 void TimerManager::PrepareFork() { Shutdown(); }
-void TimerManager::PostforkParent() { RestartPostFork(); }
-void TimerManager::PostforkChild() { RestartPostFork(); }
+
+void TimerManager::PostforkParent() {
+  // A restart deferred by an earlier fork stays deferred.
+  if (!restart_pending_.load(std::memory_order_acquire)) RestartPostFork();
+}
+
+void TimerManager::PostforkChild() {
+  if (grpc_core::ConfigVars::Get().EventEngineLazyForkRestart()) {
+    GRPC_TRACE_VLOG(timer, 2)
+        << "TimerManager::" << this << " deferring restart after fork";
+    restart_pending_.store(true, std::memory_order_release);
+    return;
+  }
+  if (!restart_pending_.load(std::memory_order_acquire)) RestartPostFork();
+}
 
 }  // namespace grpc_event_engine::experimental
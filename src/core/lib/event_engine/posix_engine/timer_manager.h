@@ -23,6 +23,7 @@
 #include <grpc/support/port_platform.h>
 #include <stdint.h>
 
+#include <atomic>
 #include <memory>
 #include <optional>
 #include <vector>
@@ -96,9 +97,13 @@ class TimerManager final : public grpc_event_engine::experimental::Forkable {
   // number of timer wakeups
   uint64_t wakeups_ ABSL_GUARDED_BY(mu_) = false;
   // actual timer implementation
-  std::unique_ptr<TimerList> timer_list_;
+  std::unique_ptr<TimerListInterface> timer_list_;
   std::shared_ptr<grpc_event_engine::experimental::ThreadPool> thread_pool_;
   std::optional<grpc_core::Notification> main_loop_exit_signal_;
+  // Set in a forked child, with the event_engine_lazy_fork_restart config
+  // var, until the first TimerInit restarts the main loop. Timers inherited
+  // from the parent do not fire before that.
+  std::atomic<bool> restart_pending_{false};
 };
 
 }  // namespace grpc_event_engine::experimental
@@ -0,0 +1,223 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/posix_engine/timer_wheel.h"
+
+#include <grpc/support/cpu.h>
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+#include "absl/numeric/bits.h"
+#include "src/core/util/useful.h"
+
+namespace grpc_event_engine::experimental {
+
+void TimerWheel::Wheel::Insert(Timer* timer, size_t slot) {
+  timer->heap_index = slot;
+  timer->prev = nullptr;
+  timer->next = slots_[slot];
+  if (timer->next != nullptr) timer->next->prev = timer;
+  slots_[slot] = timer;
+  if (slot < kOverflowSlot) {
+    occupied_[slot / kSlots] |= uint64_t{1} << (slot % kSlots);
+  }
+}
+
+// A timer goes to the lowest level at which its deadline and the current time
+// fall within the same slot of the level above: it is then met by time
+// entering its slot before it is due.
+void TimerWheel::Wheel::Add(Timer* timer) {
+  const int64_t deadline = std::max(timer->deadline, current_);
+  for (int level = 0; level < kLevels; ++level) {
+    const int shift = kSlotBits * level;
+    if ((deadline >> (shift + kSlotBits)) ==
+        (current_ >> (shift + kSlotBits))) {
+      Insert(timer, level * kSlots + ((deadline >> shift) & (kSlots - 1)));
+      return;
+    }
+  }
+  Insert(timer, kOverflowSlot);
+}
+
+void TimerWheel::Wheel::Remove(Timer* timer) {
+  const size_t slot = timer->heap_index;
+  if (timer->prev != nullptr) {
+    timer->prev->next = timer->next;
+  } else {
+    slots_[slot] = timer->next;
+  }
+  if (timer->next != nullptr) timer->next->prev = timer->prev;
+  if (slots_[slot] == nullptr && slot < kOverflowSlot) {
+    occupied_[slot / kSlots] &= ~(uint64_t{1} << (slot % kSlots));
+  }
+}
+
+void TimerWheel::Wheel::Redistribute(size_t slot) {
+  Timer* timer = std::exchange(slots_[slot], nullptr);
+  if (slot < kOverflowSlot) {
+    occupied_[slot / kSlots] &= ~(uint64_t{1} << (slot % kSlots));
+  }
+  while (timer != nullptr) {
+    Timer* next = timer->next;
+    Add(timer);
+    timer = next;
+  }
+}
+
+void TimerWheel::Wheel::MoveTo(int64_t tick) {
+  const int64_t old = std::exchange(current_, tick);
+  if ((tick >> (kSlotBits * kLevels)) != (old >> (kSlotBits * kLevels))) {
+    Redistribute(kOverflowSlot);
+  }
+  for (int level = kLevels - 1; level > 0; --level) {
+    const int shift = kSlotBits * level;
+    if ((tick >> shift) != (old >> shift)) {
+      Redistribute(level * kSlots + ((tick >> shift) & (kSlots - 1)));
+    }
+  }
+}
+
+int64_t TimerWheel::Wheel::NextEvent() const {
+  for (int level = 0; level < kLevels; ++level) {
+    const int shift = kSlotBits * level;
+    // Slots behind the current one have all been emptied; above level 0 the
+    // current slot has been too.
+    const uint64_t ahead =
+        occupied_[level] &
+        (~uint64_t{0} << ((current_ >> shift) & (kSlots - 1)));
+    if (ahead != 0) {
+      return ((current_ >> (shift + kSlotBits)) << (shift + kSlotBits)) +
+             (static_cast<int64_t>(absl::countr_zero(ahead)) << shift);
+    }
+  }
+  if (slots_[kOverflowSlot] != nullptr) {
+    return ((current_ >> (kSlotBits * kLevels)) + 1)
+           << (kSlotBits * kLevels);
+  }
+  return std::numeric_limits<int64_t>::max();
+}
+
+void TimerWheel::Wheel::Advance(
+    int64_t now, std::vector<experimental::EventEngine::Closure*>* out) {
+  for (;;) {
+    const int64_t next = NextEvent();
+    if (next > now) {
+      // Nothing happens in between, so skip straight there.
+      if (now >= current_) MoveTo(now + 1);
+      return;
+    }
+    if (next != current_) MoveTo(next);
+    const size_t slot = current_ & (kSlots - 1);
+    Timer* timer = std::exchange(slots_[slot], nullptr);
+    occupied_[0] &= ~(uint64_t{1} << slot);
+    for (; timer != nullptr; timer = timer->next) {
+      timer->pending = false;
+      out->push_back(timer->closure);
+    }
+  }
+}
+
+TimerWheel::TimerWheel(TimerListHost* host)
+    : host_(host),
+      num_shards_(grpc_core::Clamp(2 * gpr_cpu_num_cores(), 1u, 32u)),
+      min_timer_(host_->Now().milliseconds_after_process_epoch()) {
+  shards_.reserve(num_shards_);
+  for (size_t i = 0; i < num_shards_; ++i) {
+    shards_.push_back(
+        std::make_unique<Shard>(min_timer_.load(std::memory_order_relaxed)));
+  }
+}
+
+void TimerWheel::TimerInit(Timer* timer, grpc_core::Timestamp deadline,
+                           experimental::EventEngine::Closure* closure) {
+  Shard* shard = shards_[grpc_core::HashPointer(timer, num_shards_)].get();
+  timer->closure = closure;
+  timer->deadline = deadline.milliseconds_after_process_epoch();
+
+#ifndef NDEBUG
+  timer->hash_table_next = nullptr;
+#endif
+
+  int64_t next_event;
+  bool is_first_timer;
+  {
+    grpc_core::MutexLock lock(&shard->mu);
+    timer->pending = true;
+    const int64_t old_next_event = shard->wheel.NextEvent();
+    shard->wheel.Add(timer);
+    next_event = shard->wheel.NextEvent();
+    is_first_timer = next_event < old_next_event;
+  }
+
+  // Only a timer that moves its shard's next event earlier can move
+  // min_timer_ earlier. A TimerCheck that scanned the shard before the Add
+  // holds mu_ until it has published its minimum, so taking mu_ here,
+  // before looking at min_timer_, orders the comparison after that store.
+  if (is_first_timer) {
+    grpc_core::MutexLock lock(&mu_);
+    if (next_event < min_timer_.load(std::memory_order_relaxed)) {
+      min_timer_.store(next_event, std::memory_order_relaxed);
+      host_->Kick();
+    }
+  }
+}
+
+bool TimerWheel::TimerCancel(Timer* timer) {
+  Shard* shard = shards_[grpc_core::HashPointer(timer, num_shards_)].get();
+  grpc_core::MutexLock lock(&shard->mu);
+  if (!timer->pending) return false;
+  timer->pending = false;
+  shard->wheel.Remove(timer);
+  return true;
+}
+
+std::optional<std::vector<experimental::EventEngine::Closure*>>
+TimerWheel::TimerCheck(grpc_core::Timestamp* next) {
+  const int64_t now = host_->Now().milliseconds_after_process_epoch();
+  const int64_t min_timer = min_timer_.load(std::memory_order_relaxed);
+  if (now < min_timer) {
+    if (next != nullptr) {
+      *next = std::min(
+          *next,
+          grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(min_timer));
+    }
+    return std::vector<experimental::EventEngine::Closure*>();
+  }
+
+  if (!checker_mu_.TryLock()) return std::nullopt;
+  std::vector<experimental::EventEngine::Closure*> done;
+  int64_t next_event = std::numeric_limits<int64_t>::max();
+  {
+    grpc_core::MutexLock lock(&mu_);
+    for (auto& shard : shards_) {
+      grpc_core::MutexLock shard_lock(&shard->mu);
+      shard->wheel.Advance(now, &done);
+      next_event = std::min(next_event, shard->wheel.NextEvent());
+    }
+    min_timer_.store(next_event, std::memory_order_relaxed);
+  }
+  checker_mu_.Unlock();
+
+  if (next != nullptr) {
+    *next = std::min(
+        *next,
+        grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(next_event));
+  }
+  return std::move(done);
+}
+
+}  // namespace grpc_event_engine::experimental
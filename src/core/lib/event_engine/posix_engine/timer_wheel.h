@@ -0,0 +1,119 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_TIMER_WHEEL_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_TIMER_WHEEL_H
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "src/core/lib/event_engine/posix_engine/timer.h"
+#include "src/core/util/sync.h"
+#include "src/core/util/time.h"
+
+namespace grpc_event_engine::experimental {
+
+// Timers kept in hierarchical timing wheels: O(1) to add and cancel, which
+// suits call deadlines, most of which are cancelled long before they fire.
+//
+// Each wheel has kLevels levels of kSlots slots. A slot at level L covers
+// kSlots^L milliseconds, so level 0 holds timers due within the next few
+// milliseconds and the top level reaches a few hours out. When time enters a
+// slot above level 0 its timers are redistributed to the levels below, so
+// every timer still fires on the millisecond it is due. Deadlines beyond the
+// top level wait in an unordered overflow list that is only looked at once
+// per revolution of the top level.
+//
+// Timers are sharded over several wheels by address to spread contention.
+class TimerWheel final : public TimerListInterface {
+ public:
+  explicit TimerWheel(TimerListHost* host);
+
+  TimerWheel(const TimerWheel&) = delete;
+  TimerWheel& operator=(const TimerWheel&) = delete;
+
+  void TimerInit(Timer* timer, grpc_core::Timestamp deadline,
+                 experimental::EventEngine::Closure* closure) override;
+  GRPC_MUST_USE_RESULT bool TimerCancel(Timer* timer) override;
+  std::optional<std::vector<experimental::EventEngine::Closure*>> TimerCheck(
+      grpc_core::Timestamp* next) override;
+
+ private:
+  static constexpr int kSlotBits = 6;
+  static constexpr size_t kSlots = 1 << kSlotBits;
+  static constexpr int kLevels = 4;
+  // Stored in Timer::heap_index for timers in the overflow list.
+  static constexpr size_t kOverflowSlot = kLevels * kSlots;
+
+  // A single threaded wheel. Times are in milliseconds after the process
+  // epoch.
+  class Wheel {
+   public:
+    explicit Wheel(int64_t now) : current_(now) {}
+
+    void Add(Timer* timer);
+    void Remove(Timer* timer);
+    // Advance to \a now, appending the closures of expired timers to \a out.
+    void Advance(int64_t now,
+                 std::vector<experimental::EventEngine::Closure*>* out);
+    // The earliest time at which Advance() may have something to do:
+    // fire a timer, or redistribute a slot. Never later than the earliest
+    // deadline in the wheel.
+    int64_t NextEvent() const;
+
+   private:
+    void Insert(Timer* timer, size_t slot);
+    // Move time forward to \a tick, redistributing the slots of every level
+    // that it enters.
+    void MoveTo(int64_t tick);
+    void Redistribute(size_t slot);
+
+    // Time up to which (exclusive) timers have fired.
+    int64_t current_;
+    // Bitmap of non-empty slots, per level.
+    std::array<uint64_t, kLevels> occupied_{};
+    // Heads of the (doubly linked) slot lists, followed by the overflow list.
+    std::array<Timer*, kOverflowSlot + 1> slots_{};
+  };
+
+  struct Shard {
+    explicit Shard(int64_t now) : wheel(now) {}
+
+    grpc_core::Mutex mu;
+    Wheel wheel ABSL_GUARDED_BY(mu);
+  };
+
+  TimerListHost* const host_;
+  const size_t num_shards_;
+  // Serializes lowering min_timer_ against TimerCheck publishing it.
+  grpc_core::Mutex mu_;
+  // No timer fires before this time.
+  std::atomic<int64_t> min_timer_;
+  // Allow only one TimerCheck at once.
+  grpc_core::Mutex checker_mu_;
+  std::vector<std::unique_ptr<Shard>> shards_;
+};
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_TIMER_WHEEL_H
@@ -26,6 +26,8 @@
 #include "absl/functional/any_invocable.h"
 #include "absl/log/log.h"
 #include "src/core/lib/iomgr/port.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
 #include "src/core/util/sync.h"
 
 #ifdef GRPC_LINUX_ERRQUEUE
@@ -248,6 +250,9 @@ void TracedBufferList::ProcessTimestamp(struct sock_extended_err* serr,
         case SCM_TSTAMP_ACK:
           FillGprFromTimestamp(&(elem->ts_.acked_time.time), &(tss->ts[0]));
           ExtractOptStatsFromCmsg(&(elem->ts_.acked_time.metrics), opt_stats);
+          grpc_core::global_stats().IncrementTcpSendmsgToAckUs(
+              static_cast<int>(gpr_timespec_to_micros(gpr_time_sub(
+                  elem->ts_.acked_time.time, elem->ts_.sendmsg_time.time))));
           // Got all timestamps. Do the callback and free this TracedBuffer. The
           // thing below can be passed by value if we don't want the restriction
           // on the lifetime.
@@ -35,6 +35,14 @@ class ThreadPool : public Forkable {
   // Run must not be called after Quiesce completes
   virtual void Run(absl::AnyInvocable<void()> callback) = 0;
   virtual void Run(EventEngine::Closure* closure) = 0;
+  // Run the closure, preferably on a worker thread associated with \a
+  // affinity (typically a CPU number). Closures run with the same affinity
+  // tend to run on the same thread. Pools without a notion of affinity run
+  // the closure as Run() would.
+  virtual void RunWithAffinity(size_t /*affinity*/,
+                               EventEngine::Closure* closure) {
+    Run(closure);
+  }
 };
 
 // Creates a default thread pool.
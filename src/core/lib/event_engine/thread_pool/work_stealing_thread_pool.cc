@@ -17,15 +17,18 @@
 //
 #include "src/core/lib/event_engine/thread_pool/work_stealing_thread_pool.h"
 
+#include <grpc/support/cpu.h>
 #include <grpc/support/port_platform.h>
 #include <grpc/support/thd_id.h>
 #include <inttypes.h>
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <cstddef>
 #include <memory>
 #include <optional>
+#include <thread>
 #include <utility>
 
 #include "absl/functional/any_invocable.h"
@@ -33,15 +36,18 @@
 #include "absl/log/log.h"
 #include "absl/time/clock.h"
 #include "absl/time/time.h"
+#include "src/core/config/config_vars.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/event_engine/common_closures.h"
 #include "src/core/lib/event_engine/thread_local.h"
 #include "src/core/lib/event_engine/work_queue/basic_work_queue.h"
 #include "src/core/lib/event_engine/work_queue/work_queue.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/util/backoff.h"
 #include "src/core/util/crash.h"
 #include "src/core/util/env.h"
 #include "src/core/util/examine_stack.h"
+#include "src/core/util/numa.h"
 #include "src/core/util/thd.h"
 #include "src/core/util/time.h"
 
@@ -69,6 +75,11 @@
 //  * all threads are restarted, including the Lifeguard thread, and
 //  * all previously-saved work is enqueued for execution.
 //
+// With the event_engine_lazy_fork_restart config var, the child instead
+// restarts its threads when it first runs a closure (or quiesces the pool),
+// so that prefork servers do not pay for a pool that a new worker may not use
+// for a while. Until then, previously-saved work stays queued.
+//
 // However, the queue may may get into trouble if one thread is attempting to
 // restart the thread pool while another thread is shutting it down. For that
 // reason, Quiesce and Start must be thread-safe, and Quiesce must wait for the
@@ -134,6 +145,16 @@ constexpr grpc_core::Duration kLifeguardMaxSleepBetweenChecks{
     grpc_core::Duration::Seconds(1)};
 constexpr grpc_core::Duration kBlockUntilThreadCountTimeout{
     grpc_core::Duration::Seconds(60)};
+// Number of workers that spin without a time limit while idle, with the
+// event_engine_hot_spinners experiment. Homes stand in for NUMA nodes.
+constexpr size_t kHotSpinnersPerHome = 1;
+constexpr size_t kHotSpinnersWithoutHomes = 2;
+
+// The number of NUMA nodes to spread workers over.
+size_t NumaNodesForPool() {
+  if (!grpc_core::IsEventEngineNumaAwareStealingEnabled()) return 1;
+  return grpc_core::NumaTopology::Get().num_nodes();
+}
 
 #ifdef GPR_POSIX_SYNC
 const bool g_log_verbose_failures =
@@ -191,39 +212,78 @@ void WorkStealingThreadPool::Run(EventEngine::Closure* closure) {
   pool_->Run(closure);
 }
 
+void WorkStealingThreadPool::RunWithAffinity(size_t affinity,
+                                             EventEngine::Closure* closure) {
+  pool_->RunWithAffinity(affinity, closure);
+}
+
 // -------- WorkStealingThreadPool::TheftRegistry --------
 
-void WorkStealingThreadPool::TheftRegistry::Enroll(WorkQueue* queue) {
-  grpc_core::MutexLock lock(&mu_);
-  queues_.emplace(queue);
+WorkStealingThreadPool::TheftRegistry::TheftRegistry(size_t num_nodes) {
+  for (size_t i = 0; i < num_nodes; ++i) {
+    nodes_.push_back(std::make_unique<Node>());
+  }
 }
 
-void WorkStealingThreadPool::TheftRegistry::Unenroll(WorkQueue* queue) {
-  grpc_core::MutexLock lock(&mu_);
-  queues_.erase(queue);
+void WorkStealingThreadPool::TheftRegistry::Enroll(WorkQueue* queue,
+                                                   size_t node) {
+  Node& n = *nodes_[node];
+  grpc_core::MutexLock lock(&n.mu);
+  n.queues.emplace(queue);
 }
 
-EventEngine::Closure* WorkStealingThreadPool::TheftRegistry::StealOne() {
-  grpc_core::MutexLock lock(&mu_);
+void WorkStealingThreadPool::TheftRegistry::Unenroll(WorkQueue* queue,
+                                                     size_t node) {
+  Node& n = *nodes_[node];
+  grpc_core::MutexLock lock(&n.mu);
+  n.queues.erase(queue);
+}
+
+EventEngine::Closure* WorkStealingThreadPool::TheftRegistry::StealOne(
+    size_t node) {
   EventEngine::Closure* closure;
-  for (auto* queue : queues_) {
-    closure = queue->PopMostRecent();
-    if (closure != nullptr) return closure;
+  for (size_t i = 0; i < nodes_.size(); ++i) {
+    Node& n = *nodes_[(node + i) % nodes_.size()];
+    grpc_core::MutexLock lock(&n.mu);
+    for (auto* queue : n.queues) {
+      closure = queue->PopMostRecent();
+      if (closure != nullptr) return closure;
+    }
   }
   return nullptr;
 }
 
 void WorkStealingThreadPool::PrepareFork() { pool_->PrepareFork(); }
 
-void WorkStealingThreadPool::PostforkParent() { pool_->Postfork(); }
+void WorkStealingThreadPool::PostforkParent() {
+  pool_->Postfork(/*child=*/false);
+}
 
-void WorkStealingThreadPool::PostforkChild() { pool_->Postfork(); }
+void WorkStealingThreadPool::PostforkChild() {
+  pool_->Postfork(/*child=*/true);
+}
 
 // -------- WorkStealingThreadPool::WorkStealingThreadPoolImpl --------
 
 WorkStealingThreadPool::WorkStealingThreadPoolImpl::WorkStealingThreadPoolImpl(
     size_t reserve_threads)
-    : reserve_threads_(reserve_threads), queue_(this) {}
+    : reserve_threads_(reserve_threads),
+      num_nodes_(NumaNodesForPool()),
+      theft_registry_(num_nodes_),
+      queue_(this) {
+  if (grpc_core::IsEventEngineWorkerAffinityEnabled()) {
+    for (size_t i = 0; i < reserve_threads_; i++) {
+      // Affinities are usually cpu numbers, and home i serves affinity i: put
+      // it on the node of that cpu.
+      const size_t node =
+          num_nodes_ > 1 ? grpc_core::NumaTopology::Get().NodeOfCpu(
+                               i % gpr_cpu_num_cores())
+                         : 0;
+      homes_.push_back(std::make_unique<Home>(this, node));
+      theft_registry_.Enroll(&homes_.back()->queue, node);
+    }
+  }
+}
 
 void WorkStealingThreadPool::WorkStealingThreadPoolImpl::Start() {
   for (size_t i = 0; i < reserve_threads_; i++) {
@@ -236,6 +296,7 @@ void WorkStealingThreadPool::WorkStealingThreadPoolImpl::Start() {
 void WorkStealingThreadPool::WorkStealingThreadPoolImpl::Run(
     EventEngine::Closure* closure) {
   CHECK(!IsQuiesced());
+  MaybeStartAfterFork();
   if (g_local_queue != nullptr && g_local_queue->owner() == this) {
     g_local_queue->Add(closure);
   } else {
@@ -243,7 +304,78 @@ void WorkStealingThreadPool::WorkStealingThreadPoolImpl::Run(
   }
   // Signal a worker in any case, even if work was added to a local queue. This
   // improves performance on 32-core streaming benchmarks with small payloads.
-  work_signal_.Signal();
+  WakeWorker();
+}
+
+void WorkStealingThreadPool::WorkStealingThreadPoolImpl::RunWithAffinity(
+    size_t affinity, EventEngine::Closure* closure) {
+  if (homes_.empty()) {
+    Run(closure);
+    return;
+  }
+  CHECK(!IsQuiesced());
+  MaybeStartAfterFork();
+  Home& home = *homes_[affinity % homes_.size()];
+  home.queue.Add(closure);
+  home.signal.Signal();
+  // The pool is imbalanced if all the workers of this home are busy: wake
+  // another worker so that it can steal the closure if it is idle.
+  if (home.busy.load(std::memory_order_relaxed) >=
+      home.workers.load(std::memory_order_relaxed)) {
+    WakeWorker();
+  }
+}
+
+void WorkStealingThreadPool::WorkStealingThreadPoolImpl::WakeWorker() {
+  if (homes_.empty()) {
+    work_signal_.Signal();
+    return;
+  }
+  homes_[next_woken_home_.fetch_add(1, std::memory_order_relaxed) %
+         homes_.size()]
+      ->signal.Signal();
+}
+
+void WorkStealingThreadPool::WorkStealingThreadPoolImpl::WakeAllWorkers() {
+  work_signal_.SignalAll();
+  for (auto& home : homes_) {
+    home->signal.SignalAll();
+  }
+}
+
+size_t WorkStealingThreadPool::WorkStealingThreadPoolImpl::ClaimNode() {
+  if (num_nodes_ == 1) return 0;
+  return next_node_.fetch_add(1, std::memory_order_relaxed) % num_nodes_;
+}
+
+WorkStealingThreadPool::WorkStealingThreadPoolImpl::Home*
+WorkStealingThreadPool::WorkStealingThreadPoolImpl::ClaimHome(size_t node) {
+  if (homes_.empty()) return nullptr;
+  // Racing claims may pick the same home, which only makes the distribution of
+  // workers slightly uneven.
+  Home* best = nullptr;
+  auto consider = [&best](Home* home) {
+    if (best == nullptr || home->workers.load(std::memory_order_relaxed) <
+                               best->workers.load(std::memory_order_relaxed)) {
+      best = home;
+    }
+  };
+  for (auto& home : homes_) {
+    if (home->node == node) consider(home.get());
+  }
+  if (best == nullptr) {
+    for (auto& home : homes_) consider(home.get());
+  }
+  best->workers.fetch_add(1, std::memory_order_relaxed);
+  return best;
+}
+
+void WorkStealingThreadPool::WorkStealingThreadPoolImpl::ReleaseHome(
+    Home* home) {
+  if (home == nullptr) return;
+  home->workers.fetch_sub(1, std::memory_order_relaxed);
+  // Make sure pending closures of this home are picked up by someone else.
+  if (!home->queue.Empty()) WakeWorker();
 }
 
 void WorkStealingThreadPool::WorkStealingThreadPoolImpl::StartThread() {
@@ -263,13 +395,15 @@ void WorkStealingThreadPool::WorkStealingThreadPoolImpl::StartThread() {
 }
 
 void WorkStealingThreadPool::WorkStealingThreadPoolImpl::Quiesce() {
+  // Work saved by a fork must still be drained.
+  MaybeStartAfterFork();
   SetShutdown(true);
   // Wait until all threads have exited.
   // Note that if this is a threadpool thread then we won't exit this thread
   // until all other threads have exited, so we need to wait for just one thread
   // running instead of zero.
   bool is_threadpool_thread = g_local_queue != nullptr;
-  work_signal()->SignalAll();
+  WakeAllWorkers();
   auto threads_were_shut_down = living_thread_count_.BlockUntilThreadCount(
       is_threadpool_thread ? 1 : 0, "shutting down",
       g_log_verbose_failures ? kBlockUntilThreadCountTimeout
@@ -278,6 +412,9 @@ void WorkStealingThreadPool::WorkStealingThreadPoolImpl::Quiesce() {
     DumpStacksAndCrash();
   }
   CHECK(queue_.Empty());
+  for (auto& home : homes_) {
+    CHECK(home->queue.Empty());
+  }
   quiesced_.store(true, std::memory_order_relaxed);
   grpc_core::MutexLock lock(&lifeguard_ptr_mu_);
   lifeguard_.reset();
@@ -292,7 +429,7 @@ void WorkStealingThreadPool::WorkStealingThreadPoolImpl::SetShutdown(
     bool is_shutdown) {
   auto was_shutdown = shutdown_.exchange(is_shutdown);
   CHECK(is_shutdown != was_shutdown);
-  work_signal_.SignalAll();
+  WakeAllWorkers();
 }
 
 void WorkStealingThreadPool::WorkStealingThreadPoolImpl::SetForking(
@@ -317,7 +454,7 @@ void WorkStealingThreadPool::WorkStealingThreadPoolImpl::PrepareFork() {
   GRPC_TRACE_LOG(event_engine, INFO)
       << "WorkStealingThreadPoolImpl::PrepareFork";
   SetForking(true);
-  work_signal_.SignalAll();
+  WakeAllWorkers();
   auto threads_were_shut_down = living_thread_count_.BlockUntilThreadCount(
       0, "forking", kBlockUntilThreadCountTimeout);
   if (!threads_were_shut_down.ok() && g_log_verbose_failures) {
@@ -327,9 +464,25 @@ void WorkStealingThreadPool::WorkStealingThreadPoolImpl::PrepareFork() {
   lifeguard_.reset();
 }
 
-void WorkStealingThreadPool::WorkStealingThreadPoolImpl::Postfork() {
+void WorkStealingThreadPool::WorkStealingThreadPoolImpl::Postfork(
+    bool child) {
   SetForking(false);
-  Start();
+  if (child && grpc_core::ConfigVars::Get().EventEngineLazyForkRestart()) {
+    GRPC_TRACE_LOG(event_engine, INFO)
+        << "WorkStealingThreadPoolImpl::Postfork: deferring restart";
+    start_pending_.store(true, std::memory_order_release);
+    return;
+  }
+  // A pool whose restart was deferred by an earlier fork stays idle.
+  if (!start_pending_.load(std::memory_order_acquire)) Start();
+}
+
+void WorkStealingThreadPool::WorkStealingThreadPoolImpl::
+    MaybeStartAfterFork() {
+  if (GPR_UNLIKELY(start_pending_.load(std::memory_order_relaxed)) &&
+      start_pending_.exchange(false, std::memory_order_acq_rel)) {
+    Start();
+  }
 }
 
 void WorkStealingThreadPool::WorkStealingThreadPoolImpl::TrackThread(
@@ -438,7 +591,7 @@ bool WorkStealingThreadPool::WorkStealingThreadPoolImpl::Lifeguard::
   // Wake an idle worker thread if there's global work to be had.
   if (pool_->busy_thread_count()->count() < living_thread_count) {
     if (!pool_->queue_.Empty()) {
-      pool_->work_signal()->Signal();
+      pool_->WakeWorker();
       backoff_.Reset();
     }
     // Idle threads will eventually wake up for an attempt at work stealing.
@@ -489,8 +642,15 @@ void WorkStealingThreadPool::ThreadState::ThreadBody() {
 #endif
     pool_->TrackThread(gpr_thd_currentid());
   }
+  node_ = pool_->ClaimNode();
+  if (pool_->num_nodes() > 1) {
+    // Bind before allocating the local queue, so that it is first touched by,
+    // and so placed on the node of, this thread.
+    grpc_core::NumaTopology::Get().BindCurrentThread(node_);
+  }
   g_local_queue = new BasicWorkQueue(pool_.get());
-  pool_->theft_registry()->Enroll(g_local_queue);
+  pool_->theft_registry()->Enroll(g_local_queue, node_);
+  home_ = pool_->ClaimHome(node_);
   ThreadLocal::SetIsEventEngineThread(true);
   while (Step()) {
     // loop until the thread should no longer run
@@ -509,7 +669,8 @@ void WorkStealingThreadPool::ThreadState::ThreadBody() {
     FinishDraining();
   }
   CHECK(g_local_queue->Empty());
-  pool_->theft_registry()->Unenroll(g_local_queue);
+  pool_->ReleaseHome(std::exchange(home_, nullptr));
+  pool_->theft_registry()->Unenroll(g_local_queue, node_);
   delete g_local_queue;
   if (g_log_verbose_failures) {
     pool_->UntrackThread(gpr_thd_currentid());
@@ -527,11 +688,11 @@ bool WorkStealingThreadPool::ThreadState::Step() {
   auto* closure = g_local_queue->PopMostRecent();
   // If local work is available, run it.
   if (closure != nullptr) {
-    auto busy =
-        pool_->busy_thread_count()->MakeAutoThreadCounter(busy_count_idx_);
-    closure->Run();
+    RunClosure(closure);
     return true;
   }
+  WorkSignal* work_signal =
+      home_ != nullptr ? &home_->signal : pool_->work_signal();
   // Thread shutdown exit condition (ignoring fork). All must be true:
   // * shutdown was called
   // * the local queue is empty
@@ -539,8 +700,22 @@ bool WorkStealingThreadPool::ThreadState::Step() {
   // * the steal pool returns nullptr
   bool should_run_again = false;
   auto start_time = std::chrono::steady_clock::now();
+  const bool adaptive_spinning =
+      grpc_core::IsEventEngineAdaptiveSpinningEnabled();
+  bool idled = false;
   // Wait until work is available or until shut down.
   while (!pool_->IsForking()) {
+    // Anything queued after this advances the epoch, so that no wakeup is
+    // lost between the scan below and spinning or waiting.
+    const uint64_t epoch = work_signal->epoch();
+    // Closures with affinity to this thread come before any other work.
+    if (home_ != nullptr) {
+      closure = home_->queue.PopOldest();
+      if (closure != nullptr) {
+        should_run_again = true;
+        break;
+      }
+    }
     // Pull from the global queue next
     // TODO(hork): consider an empty check for performance wins. Depends on the
     // queue implementation, the BasicWorkQueue takes two locks when you do an
@@ -551,7 +726,7 @@ bool WorkStealingThreadPool::ThreadState::Step() {
       break;
     };
     // Try stealing if the queue is empty
-    closure = pool_->theft_registry()->StealOne();
+    closure = pool_->theft_registry()->StealOne(node_);
     if (closure != nullptr) {
       should_run_again = true;
       break;
@@ -559,14 +734,25 @@ bool WorkStealingThreadPool::ThreadState::Step() {
     // No closures were retrieved from anywhere.
     // Quit the thread if the pool has been shut down.
     if (pool_->IsShutdown()) break;
+    idled = true;
+    if (MaybeSpinHot(work_signal, epoch)) continue;
+    if (adaptive_spinning) {
+      const std::chrono::nanoseconds spin = spin_policy_.SpinDuration();
+      if (spin > std::chrono::nanoseconds::zero() &&
+          SpinUntilSignalled(work_signal, epoch, spin)) {
+        continue;
+      }
+    }
     bool timed_out =
-        pool_->work_signal()->WaitWithTimeout(backoff_.NextAttemptDelay());
+        work_signal->WaitWithTimeout(backoff_.NextAttemptDelay(), epoch);
     if (pool_->IsForking() || pool_->IsShutdown()) break;
     // Quit a thread if the pool has more than it requires, and this thread
-    // has been idle long enough.
+    // has been idle long enough. The last worker of a home stays around.
     if (timed_out &&
         pool_->living_thread_count()->count() > pool_->reserve_threads() &&
-        std::chrono::steady_clock::now() - start_time > kIdleThreadLimit) {
+        std::chrono::steady_clock::now() - start_time > kIdleThreadLimit &&
+        (home_ == nullptr ||
+         home_->workers.load(std::memory_order_relaxed) > 1)) {
       return false;
     }
   }
@@ -576,14 +762,63 @@ bool WorkStealingThreadPool::ThreadState::Step() {
     return false;
   }
   if (closure != nullptr) {
-    auto busy =
-        pool_->busy_thread_count()->MakeAutoThreadCounter(busy_count_idx_);
-    closure->Run();
+    if (idled) {
+      spin_policy_.AddIdleSample(std::chrono::steady_clock::now() -
+                                 start_time);
+    }
+    RunClosure(closure);
   }
   backoff_.Reset();
   return should_run_again;
 }
 
+bool WorkStealingThreadPool::ThreadState::SpinUntilSignalled(
+    WorkSignal* work_signal, uint64_t epoch,
+    std::optional<std::chrono::nanoseconds> limit) {
+  const auto deadline =
+      limit.has_value() ? std::chrono::steady_clock::now() + *limit
+                        : std::chrono::steady_clock::time_point::max();
+  for (uint32_t i = 1;; ++i) {
+    if (work_signal->epoch() != epoch) return true;
+    if (i % 64 == 0) {
+      if (pool_->IsShutdown() || pool_->IsForking()) return false;
+      if (std::chrono::steady_clock::now() >= deadline) return false;
+      // A hot spinner gives way to any other thread that could run on its
+      // core.
+      if (!limit.has_value()) std::this_thread::yield();
+    }
+  }
+}
+
+bool WorkStealingThreadPool::ThreadState::MaybeSpinHot(WorkSignal* work_signal,
+                                                       uint64_t epoch) {
+  if (!grpc_core::IsEventEngineHotSpinnersEnabled()) return false;
+  std::atomic<size_t>* hot_spinners =
+      home_ != nullptr ? &home_->hot_spinners : pool_->hot_spinners();
+  const size_t limit =
+      home_ != nullptr ? kHotSpinnersPerHome : kHotSpinnersWithoutHomes;
+  if (hot_spinners->fetch_add(1, std::memory_order_relaxed) >= limit) {
+    hot_spinners->fetch_sub(1, std::memory_order_relaxed);
+    return false;
+  }
+  SpinUntilSignalled(work_signal, epoch, std::nullopt);
+  hot_spinners->fetch_sub(1, std::memory_order_relaxed);
+  return true;
+}
+
+void WorkStealingThreadPool::ThreadState::RunClosure(
+    EventEngine::Closure* closure) {
+  auto busy =
+      pool_->busy_thread_count()->MakeAutoThreadCounter(busy_count_idx_);
+  if (home_ == nullptr) {
+    closure->Run();
+    return;
+  }
+  home_->busy.fetch_add(1, std::memory_order_relaxed);
+  closure->Run();
+  home_->busy.fetch_sub(1, std::memory_order_relaxed);
+}
+
 void WorkStealingThreadPool::ThreadState::FinishDraining() {
   // The thread is definitionally busy while draining
   auto busy =
@@ -605,6 +840,15 @@ void WorkStealingThreadPool::ThreadState::FinishDraining() {
       }
       continue;
     }
+    bool ran_home_closure = false;
+    for (auto& home : pool_->homes()) {
+      auto* closure = home->queue.PopOldest();
+      if (closure != nullptr) {
+        closure->Run();
+        ran_home_closure = true;
+      }
+    }
+    if (ran_home_closure) continue;
     break;
   }
 }
@@ -612,11 +856,16 @@ void WorkStealingThreadPool::ThreadState::FinishDraining() {
 // -------- WorkStealingThreadPool::WorkSignal --------
 
 void WorkStealingThreadPool::WorkSignal::Signal() {
+  epoch_.fetch_add(1, std::memory_order_seq_cst);
+  // A thread that registers as a waiter after this load sees the new epoch
+  // and does not wait.
+  if (waiters_.load(std::memory_order_seq_cst) == 0) return;
   grpc_core::MutexLock lock(&mu_);
   cv_.Signal();
 }
 
 void WorkStealingThreadPool::WorkSignal::SignalAll() {
+  epoch_.fetch_add(1, std::memory_order_seq_cst);
   grpc_core::MutexLock lock(&mu_);
   cv_.SignalAll();
 }
@@ -624,7 +873,39 @@ void WorkStealingThreadPool::WorkSignal::SignalAll() {
 bool WorkStealingThreadPool::WorkSignal::WaitWithTimeout(
     grpc_core::Duration time) {
   grpc_core::MutexLock lock(&mu_);
-  return cv_.WaitWithTimeout(&mu_, absl::Milliseconds(time.millis()));
+  waiters_.fetch_add(1, std::memory_order_seq_cst);
+  bool timed_out = cv_.WaitWithTimeout(&mu_, absl::Milliseconds(time.millis()));
+  waiters_.fetch_sub(1, std::memory_order_relaxed);
+  return timed_out;
+}
+
+bool WorkStealingThreadPool::WorkSignal::WaitWithTimeout(
+    grpc_core::Duration time, uint64_t epoch) {
+  grpc_core::MutexLock lock(&mu_);
+  waiters_.fetch_add(1, std::memory_order_seq_cst);
+  bool timed_out = false;
+  if (epoch_.load(std::memory_order_seq_cst) == epoch) {
+    timed_out = cv_.WaitWithTimeout(&mu_, absl::Milliseconds(time.millis()));
+  }
+  waiters_.fetch_sub(1, std::memory_order_relaxed);
+  return timed_out;
+}
+
+// -------- WorkStealingThreadPool::SpinPolicy --------
+
+std::chrono::nanoseconds WorkStealingThreadPool::SpinPolicy::SpinDuration()
+    const {
+  // Work that takes this long to arrive is better waited for.
+  if (average_idle_ >= kMaxSpin) return std::chrono::nanoseconds::zero();
+  return std::clamp(2 * average_idle_, kMinSpin, kMaxSpin);
+}
+
+void WorkStealingThreadPool::SpinPolicy::AddIdleSample(
+    std::chrono::nanoseconds idle) {
+  // Bound the sample so that one long idle period does not stop the worker
+  // from spinning for long once work arrives quickly again.
+  idle = std::min(idle, 4 * kMaxSpin);
+  average_idle_ += (idle - average_idle_) / 8;
 }
 
 }  // namespace grpc_event_engine::experimental
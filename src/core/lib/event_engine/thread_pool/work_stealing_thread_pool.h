@@ -25,7 +25,10 @@
 #include <stdint.h>
 
 #include <atomic>
+#include <chrono>
 #include <memory>
+#include <optional>
+#include <vector>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/container/flat_hash_set.h"
@@ -52,6 +55,11 @@ class WorkStealingThreadPool final : public ThreadPool {
   // Run must not be called after Quiesce completes
   void Run(absl::AnyInvocable<void()> callback) override;
   void Run(EventEngine::Closure* closure) override;
+  // With the event_engine_worker_affinity experiment, queues the closure on
+  // one of reserve_threads home queues. Each home is served by its own worker
+  // threads, and other workers only steal from it when they have nothing else
+  // to do.
+  void RunWithAffinity(size_t affinity, EventEngine::Closure* closure) override;
 
   // Forkable
   // These methods are exposed on the public object to allow for testing.
@@ -62,36 +70,69 @@ class WorkStealingThreadPool final : public ThreadPool {
  private:
   // A basic communication mechanism to signal waiting threads that work is
   // available.
+  //
+  // Every signal advances an epoch, so that a thread can spin on epoch()
+  // instead of waiting, and signalling does not touch the mutex while no
+  // thread is waiting.
   class WorkSignal {
    public:
     void Signal();
     void SignalAll();
     // Returns whether a timeout occurred.
     bool WaitWithTimeout(grpc_core::Duration time);
+    // As above, but returns immediately if the epoch is no longer \a epoch.
+    bool WaitWithTimeout(grpc_core::Duration time, uint64_t epoch);
+    uint64_t epoch() const { return epoch_.load(std::memory_order_seq_cst); }
 
    private:
     grpc_core::Mutex mu_;
     grpc_core::CondVar cv_ ABSL_GUARDED_BY(mu_);
+    std::atomic<uint64_t> epoch_{0};
+    std::atomic<size_t> waiters_{0};
+  };
+
+  // Decides how long an idle worker spins before it waits, based on how long
+  // the worker recently had to wait for work: spinning only pays when work
+  // usually arrives sooner than a futex wake up could deliver it.
+  class SpinPolicy {
+   public:
+    // Longest a worker spins before it waits.
+    static constexpr std::chrono::nanoseconds kMaxSpin{50000};
+    static constexpr std::chrono::nanoseconds kMinSpin{2000};
+
+    std::chrono::nanoseconds SpinDuration() const;
+    // Note that the worker was idle for \a idle before it found work.
+    void AddIdleSample(std::chrono::nanoseconds idle);
+
+   private:
+    // Moving average of recent idle periods.
+    std::chrono::nanoseconds average_idle_{kMaxSpin};
   };
 
   // A pool of WorkQueues that participate in work stealing.
   //
   // Every worker thread registers and unregisters its thread-local thread pool
   // here, and steals closures from other threads when work is otherwise
-  // unavailable.
+  // unavailable. Queues are enrolled with the NUMA node of their workers, and
+  // thieves steal from their own node before crossing to another.
   class TheftRegistry {
    public:
+    explicit TheftRegistry(size_t num_nodes);
     // Allow any member of the registry to steal from the provided queue.
-    void Enroll(WorkQueue* queue) ABSL_LOCKS_EXCLUDED(mu_);
+    void Enroll(WorkQueue* queue, size_t node);
     // Disallow work stealing from the provided queue.
-    void Unenroll(WorkQueue* queue) ABSL_LOCKS_EXCLUDED(mu_);
+    void Unenroll(WorkQueue* queue, size_t node);
     // Returns one closure from another thread, or nullptr if none are
     // available.
-    EventEngine::Closure* StealOne() ABSL_LOCKS_EXCLUDED(mu_);
+    EventEngine::Closure* StealOne(size_t node);
 
    private:
-    grpc_core::Mutex mu_;
-    absl::flat_hash_set<WorkQueue*> queues_ ABSL_GUARDED_BY(mu_);
+    struct Node {
+      grpc_core::Mutex mu;
+      absl::flat_hash_set<WorkQueue*> queues ABSL_GUARDED_BY(mu);
+    };
+    // Never resized after construction.
+    std::vector<std::unique_ptr<Node>> nodes_;
   };
 
   // An implementation of the ThreadPool
@@ -101,12 +142,44 @@ class WorkStealingThreadPool final : public ThreadPool {
   class WorkStealingThreadPoolImpl
       : public std::enable_shared_from_this<WorkStealingThreadPoolImpl> {
    public:
+    // A queue of closures with affinity to a set of worker threads, and the
+    // signal those home workers wait on.
+    struct Home {
+      Home(WorkStealingThreadPoolImpl* pool, size_t node)
+          : queue(pool), node(node) {}
+      BasicWorkQueue queue;
+      // The NUMA node this home's workers are placed on.
+      const size_t node;
+      WorkSignal signal;
+      // Number of worker threads which have this home.
+      std::atomic<size_t> workers{0};
+      // Number of home workers which are running a closure.
+      std::atomic<size_t> busy{0};
+      // Number of home workers spinning without a time limit.
+      std::atomic<size_t> hot_spinners{0};
+    };
+
     explicit WorkStealingThreadPoolImpl(size_t reserve_threads);
     // Start all threads.
     void Start();
     // Add a closure to a work queue, preferably a thread-local queue if
     // available, otherwise the global queue.
     void Run(EventEngine::Closure* closure);
+    // Add a closure to the queue of the home associated with affinity, or
+    // behave as Run() if worker affinity is disabled.
+    void RunWithAffinity(size_t affinity, EventEngine::Closure* closure);
+    // Wake one idle worker thread. With worker affinity, homes are woken in a
+    // round-robin fashion.
+    void WakeWorker();
+    // Wake all idle worker threads.
+    void WakeAllWorkers();
+    // Returns the NUMA node to place a new worker on.
+    size_t ClaimNode();
+    // Returns the home with the fewest workers, preferring those on \a node,
+    // and registers the calling worker with it, or nullptr if worker affinity
+    // is disabled.
+    Home* ClaimHome(size_t node);
+    void ReleaseHome(Home* home);
     // Start a new thread.
     // The reason argument determines whether thread creation is rate-limited;
     // threads created to populate the initial pool are not rate-limited, but
@@ -126,9 +199,12 @@ class WorkStealingThreadPool final : public ThreadPool {
     void SetForking(bool is_forking);
     // Forkable
     // Ensures that the thread pool is empty before forking.
-    // Postfork parent and child have the same behavior.
+    // Postfork parent and child have the same behavior, unless the
+    // event_engine_lazy_fork_restart config var defers the child's restart.
     void PrepareFork();
-    void Postfork();
+    void Postfork(bool child);
+    // Starts the pool if a fork deferred its restart.
+    void MaybeStartAfterFork();
     // Thread ID tracking
     void TrackThread(gpr_thd_id tid);
     void UntrackThread(gpr_thd_id tid);
@@ -137,11 +213,16 @@ class WorkStealingThreadPool final : public ThreadPool {
     bool IsForking();
     bool IsQuiesced();
     size_t reserve_threads() { return reserve_threads_; }
+    // 1 unless the event_engine_numa_aware_stealing experiment is enabled on
+    // a NUMA host.
+    size_t num_nodes() { return num_nodes_; }
     BusyThreadCount* busy_thread_count() { return &busy_thread_count_; }
     LivingThreadCount* living_thread_count() { return &living_thread_count_; }
     TheftRegistry* theft_registry() { return &theft_registry_; }
     WorkQueue* queue() { return &queue_; }
     WorkSignal* work_signal() { return &work_signal_; }
+    std::atomic<size_t>* hot_spinners() { return &hot_spinners_; }
+    const std::vector<std::unique_ptr<Home>>& homes() { return homes_; }
 
    private:
     // Lifeguard monitors the pool and keeps it healthy.
@@ -172,6 +253,7 @@ class WorkStealingThreadPool final : public ThreadPool {
     void DumpStacksAndCrash();
 
     const size_t reserve_threads_;
+    const size_t num_nodes_;
     BusyThreadCount busy_thread_count_;
     LivingThreadCount living_thread_count_;
     TheftRegistry theft_registry_;
@@ -183,11 +265,20 @@ class WorkStealingThreadPool final : public ThreadPool {
     std::atomic<bool> shutdown_{false};
     std::atomic<bool> forking_{false};
     std::atomic<bool> quiesced_{false};
+    // Set in a forked child until it first uses the pool.
+    std::atomic<bool> start_pending_{false};
     std::atomic<uint64_t> last_started_thread_{0};
     // After pool creation we use this to rate limit creation of threads to one
     // at a time.
     std::atomic<bool> throttled_{false};
     WorkSignal work_signal_;
+    // Number of workers without a home spinning without a time limit.
+    std::atomic<size_t> hot_spinners_{0};
+    // One home per reserve thread when worker affinity is enabled, empty
+    // otherwise. Never resized after construction.
+    std::vector<std::unique_ptr<Home>> homes_;
+    std::atomic<size_t> next_woken_home_{0};
+    std::atomic<size_t> next_node_{0};
     grpc_core::Mutex lifeguard_ptr_mu_;
     std::unique_ptr<Lifeguard> lifeguard_ ABSL_GUARDED_BY(lifeguard_ptr_mu_);
     // Set of threads for verbose failure debugging
@@ -204,6 +295,17 @@ class WorkStealingThreadPool final : public ThreadPool {
     // After the pool is shut down, ensure all local and global callbacks are
     // executed before quitting the thread.
     void FinishDraining();
+    // Run a closure, tracking this thread (and its home) as busy.
+    void RunClosure(EventEngine::Closure* closure);
+    // Spin until \a work_signal leaves \a epoch, for at most \a limit, or
+    // without a limit if \a limit is nullopt. Returns false if the signal
+    // did not change.
+    bool SpinUntilSignalled(WorkSignal* work_signal, uint64_t epoch,
+                            std::optional<std::chrono::nanoseconds> limit);
+    // With the event_engine_hot_spinners experiment, becomes one of the few
+    // workers (per home, if any) that spin until work arrives instead of
+    // waiting. Returns false if enough workers already do.
+    bool MaybeSpinHot(WorkSignal* work_signal, uint64_t epoch);
 
    private:
     // pool_ must be the first member so that it is alive when the thread count
@@ -215,6 +317,10 @@ class WorkStealingThreadPool final : public ThreadPool {
     LivingThreadCount::AutoThreadCounter auto_thread_counter_;
     grpc_core::BackOff backoff_;
     size_t busy_count_idx_;
+    WorkStealingThreadPoolImpl::Home* home_ = nullptr;
+    // The NUMA node this thread is placed on.
+    size_t node_ = 0;
+    SpinPolicy spin_policy_;
   };
 
   const std::shared_ptr<WorkStealingThreadPoolImpl> pool_;
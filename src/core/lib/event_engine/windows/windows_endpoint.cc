@@ -18,12 +18,15 @@
 #include <grpc/event_engine/memory_allocator.h>
 #include <grpc/support/log_windows.h>
 
+#include <utility>
+
 #include "absl/cleanup/cleanup.h"
 #include "absl/functional/any_invocable.h"
 #include "absl/log/check.h"
 #include "absl/log/log.h"
 #include "absl/status/status.h"
 #include "absl/strings/str_format.h"
+#include "src/core/config/config_vars.h"
 #include "src/core/lib/event_engine/tcp_socket_utils.h"
 #include "src/core/lib/event_engine/thread_pool/thread_pool.h"
 #include "src/core/lib/event_engine/windows/win_socket.h"
@@ -108,11 +111,24 @@ void WindowsEndpoint::AsyncIOState::DoTcpRead(SliceBuffer* buffer) {
   }
   // Otherwise, let's retry, by queuing a read.
   socket->NotifyOnRead(&handle_read_event);
-  status = WSARecv(socket->raw_socket(), wsa_buffers, (DWORD)buffer->Count(),
-                   nullptr, &flags, socket->read_info()->overlapped(), nullptr);
+  if (zero_byte_reads) {
+    // Only wait for the socket to become readable, so that the kernel does not
+    // lock the read buffers for as long as the connection is idle.
+    WSABUF zero_byte_buffer;
+    zero_byte_buffer.buf = nullptr;
+    zero_byte_buffer.len = 0;
+    waiting_for_data = true;
+    status = WSARecv(socket->raw_socket(), &zero_byte_buffer, 1, nullptr,
+                     &flags, socket->read_info()->overlapped(), nullptr);
+  } else {
+    status =
+        WSARecv(socket->raw_socket(), wsa_buffers, (DWORD)buffer->Count(),
+                nullptr, &flags, socket->read_info()->overlapped(), nullptr);
+  }
   wsa_error = status == 0 ? 0 : WSAGetLastError();
   if (wsa_error != 0 && wsa_error != WSA_IO_PENDING) {
     // The async read attempt returned an error immediately.
+    waiting_for_data = false;
     socket->UnregisterReadCallback();
     socket->read_info()->SetResult(
         wsa_error, 0, absl::StrFormat("WindowsEndpoint::%p Read failed", this));
@@ -277,6 +293,8 @@ void WindowsEndpoint::HandleReadClosure::Run() {
   auto io_state = std::move(io_state_);
   GRPC_TRACE_LOG(event_engine_endpoint, INFO)
       << "WindowsEndpoint::" << io_state->endpoint << " Handling Read Event";
+  const bool was_waiting_for_data =
+      std::exchange(io_state->waiting_for_data, false);
   const auto result = io_state->socket->read_info()->result();
   if (!result.error_status.ok()) {
     buffer_->Clear();
@@ -288,6 +306,13 @@ void WindowsEndpoint::HandleReadClosure::Run() {
     buffer_->Clear();
     return ResetAndReturnCallback()(status);
   }
+  if (was_waiting_for_data) {
+    // The zero-byte read completed, so there is data (or the end of the
+    // stream) to read synchronously.
+    io_state_ = std::move(io_state);
+    io_state_->DoTcpRead(buffer_);
+    return;
+  }
   if (result.bytes_transferred == 0) {
     DCHECK_GT(io_state.use_count(), 0);
     // Either the endpoint is shut down or we've seen the end of the stream
@@ -374,7 +399,9 @@ WindowsEndpoint::AsyncIOState::AsyncIOState(WindowsEndpoint* endpoint,
     : endpoint(endpoint),
       socket(std::move(socket)),
       engine(std::move(engine)),
-      thread_pool(thread_pool) {}
+      thread_pool(thread_pool),
+      zero_byte_reads(
+          grpc_core::ConfigVars::Get().EventEngineWindowsZeroByteReads()) {}
 
 WindowsEndpoint::AsyncIOState::~AsyncIOState() {
   socket->Shutdown(DEBUG_LOCATION, "~AsyncIOState");
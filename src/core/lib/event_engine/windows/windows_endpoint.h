@@ -111,6 +111,11 @@ class WindowsEndpoint : public EventEngine::Endpoint {
     HandleWriteClosure handle_write_event;
     std::shared_ptr<EventEngine> engine;
     ThreadPool* thread_pool;
+    // Whether to wait for data with zero-byte overlapped reads.
+    const bool zero_byte_reads;
+    // True while a zero-byte read is pending. The read buffers are then filled
+    // synchronously once it completes.
+    bool waiting_for_data = false;
   };
 
   EventEngine::ResolvedAddress peer_address_;
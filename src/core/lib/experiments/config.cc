@@ -220,6 +220,8 @@ bool IsTestExperimentEnabled(size_t experiment_id) {
 #define GRPC_EXPERIMENT_LOG VLOG(2)
 
 void PrintExperimentsList() {
+  // Called from grpc_init: skip building the report nobody will see.
+  if (!ABSL_VLOG_IS_ON(2)) return;
   std::map<std::string, std::string> experiment_status;
   std::set<std::string> defaulted_on_experiments;
   for (size_t i = 0; i < kNumExperiments; i++) {
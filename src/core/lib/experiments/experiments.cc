@@ -23,21 +23,63 @@
 
 #if defined(GRPC_CFSTREAM)
 namespace {
+const char* const description_alts_handshaker_channel_pool =
+    "Share a pool of channels to the ALTS handshaker service, each with its "
+    "own connection, between the handshakes of an ALTS credentials object, "
+    "instead of creating a channel per handshake.";
+const char* const additional_constraints_alts_handshaker_channel_pool = "{}";
+const char* const description_bdp_estimate_from_tcp_info =
+    "When the endpoint reports TCP_INFO, time BDP probes by the kernel's round "
+    "trip time estimate instead of sending HTTP2 pings.";
+const char* const additional_constraints_bdp_estimate_from_tcp_info = "{}";
+const char* const description_call_arena_recycling =
+    "Keep recently freed call arenas of the learned call size for reuse by new "
+    "calls, and recycle memory of pooled objects through per-thread free "
+    "lists.";
+const char* const additional_constraints_call_arena_recycling = "{}";
 const char* const description_call_tracer_in_transport =
     "Transport directly passes byte counts to CallTracer.";
 const char* const additional_constraints_call_tracer_in_transport = "{}";
 const char* const description_callv3_client_auth_filter =
     "Use the CallV3 client auth filter.";
 const char* const additional_constraints_callv3_client_auth_filter = "{}";
+const char* const description_chaotic_good_adaptive_data_endpoints =
+    "Spread chaotic good data frames over only as many data endpoints as are "
+    "needed to keep queueing delay low, adding endpoints as writes queue up "
+    "and dropping them again while writes complete promptly.";
+const char* const additional_constraints_chaotic_good_adaptive_data_endpoints =
+    "{}";
 const char* const description_chaotic_good_framing_layer =
     "Enable the chaotic good framing layer.";
 const char* const additional_constraints_chaotic_good_framing_layer = "{}";
+const char* const description_chaotic_good_shared_memory =
+    "Offer chaotic good peers on the same host a shared memory ring per "
+    "direction, so that large payloads are copied through shared memory and "
+    "only a small descriptor is sent on the data endpoints.";
+const char* const additional_constraints_chaotic_good_shared_memory = "{}";
 const char* const description_chttp2_bound_write_size =
     "Fix a bug where chttp2 can generate very large writes";
 const char* const additional_constraints_chttp2_bound_write_size = "{}";
+const char* const description_chttp2_coalesce_small_write_slices =
+    "Copy runs of small slices (frame headers, small messages) in an outgoing "
+    "chttp2 write into contiguous slices, so that each write needs fewer "
+    "iovecs and syscalls.";
+const char* const additional_constraints_chttp2_coalesce_small_write_slices =
+    "{}";
+const char* const description_chttp2_weighted_write_scheduling =
+    "Bound the bytes each writable chttp2 stream may frame per visit of the "
+    "writable list by its write priority, so that writes round-robin between "
+    "streams instead of one stream filling the whole write.";
+const char* const additional_constraints_chttp2_weighted_write_scheduling =
+    "{}";
 const char* const description_error_flatten =
     "Flatten errors to ordinary absl::Status form.";
 const char* const additional_constraints_error_flatten = "{}";
+const char* const description_event_engine_adaptive_spinning =
+    "Let idle EventEngine workers spin briefly before they wait, for as long "
+    "as work recently took to arrive, instead of always waiting on a condition "
+    "variable.";
+const char* const additional_constraints_event_engine_adaptive_spinning = "{}";
 const char* const description_event_engine_client =
     "Use EventEngine clients instead of iomgr's grpc_tcp_client";
 const char* const additional_constraints_event_engine_client = "{}";
@@ -53,6 +95,11 @@ const char* const description_event_engine_fork =
     "Enables event engine fork handling, including onfork events and file "
     "descriptor generations";
 const char* const additional_constraints_event_engine_fork = "{}";
+const char* const description_event_engine_hot_spinners =
+    "Keep one idle EventEngine worker per home (or two per pool without worker "
+    "affinity) spinning until work arrives, trading a core for lower wake up "
+    "latency.";
+const char* const additional_constraints_event_engine_hot_spinners = "{}";
 const char* const description_event_engine_listener =
     "Use EventEngine listeners instead of iomgr's grpc_tcp_server";
 const char* const additional_constraints_event_engine_listener = "{}";
@@ -73,20 +120,61 @@ const uint8_t required_experiments_event_engine_for_all_other_endpoints[] = {
     static_cast<uint8_t>(
         grpc_core::kExperimentIdEventEngineDnsNonClientChannel),
     static_cast<uint8_t>(grpc_core::kExperimentIdEventEngineListener)};
+const char* const description_event_engine_numa_aware_stealing =
+    "Spread EventEngine worker threads over the NUMA nodes of the host, bind "
+    "each to the cpus of its node, and have idle workers steal work from their "
+    "own node before any other.";
+const char* const additional_constraints_event_engine_numa_aware_stealing =
+    "{}";
 const char* const description_event_engine_secure_endpoint =
     "Use EventEngine secure endpoint wrapper instead of iomgr when available";
 const char* const additional_constraints_event_engine_secure_endpoint = "{}";
+const char* const description_event_engine_timer_wheel =
+    "Keep the posix EventEngine's timers in hierarchical timing wheels, with "
+    "constant time insertion and cancellation, instead of sharded heaps.";
+const char* const additional_constraints_event_engine_timer_wheel = "{}";
+const char* const description_event_engine_worker_affinity =
+    "Give every EventEngine endpoint a home worker thread, picked from the CPU "
+    "that received its connection (SO_INCOMING_CPU), and run its I/O callbacks "
+    "there. Other workers only steal that work when they are idle.";
+const char* const additional_constraints_event_engine_worker_affinity = "{}";
 const char* const description_free_large_allocator =
     "If set, return all free bytes from a \042big\042 allocator";
 const char* const additional_constraints_free_large_allocator = "{}";
+const char* const description_fused_filter_stacks =
+    "Replace runs of common v3 filters (message size, http and compression) "
+    "with a single filter fused at compile time, so that each call step makes "
+    "one statically dispatched call for the whole run.";
+const char* const additional_constraints_fused_filter_stacks = "{}";
+const char* const description_hpack_encoder_prefix_cache =
+    "Cache the encoded request headers that are the same on every call of a "
+    "method, and replay them while the HPACK dynamic table is unchanged.";
+const char* const additional_constraints_hpack_encoder_prefix_cache = "{}";
+const char* const description_hpack_shared_values =
+    "Keep header values added to HPACK dynamic tables in a process-wide pool, "
+    "so that connections receiving the same value share a single copy of it.";
+const char* const additional_constraints_hpack_shared_values = "{}";
+const char* const description_huge_page_slab_allocator =
+    "Serve read buffers, memory allocator slices and call arenas from per-cpu "
+    "slabs backed by 2MB huge pages, to cut TLB misses on the data path.";
+const char* const additional_constraints_huge_page_slab_allocator = "{}";
 const char* const description_keep_alive_ping_timer_batch =
     "Avoid explicitly cancelling the keepalive timer. Instead adjust the "
     "callback to re-schedule itself to the next ping interval.";
 const char* const additional_constraints_keep_alive_ping_timer_batch = "{}";
+const char* const description_lazy_deadline_timers =
+    "Only arm a call's deadline timer once its deadline is close, from a "
+    "coarse periodic sweep, so that calls that finish quickly never arm or "
+    "cancel a timer.";
+const char* const additional_constraints_lazy_deadline_timers = "{}";
 const char* const description_local_connector_secure =
     "Local security connector uses TSI_SECURITY_NONE for LOCAL_TCP "
     "connections.";
 const char* const additional_constraints_local_connector_secure = "{}";
+const char* const description_lock_free_work_serializer =
+    "Queue WorkSerializer callbacks on a lock free queue, and run several of "
+    "them per EventEngine callback, bounded by a drain budget.";
+const char* const additional_constraints_lock_free_work_serializer = "{}";
 const char* const description_max_inflight_pings_strict_limit =
     "If set, the max inflight pings limit is strictly enforced.";
 const char* const additional_constraints_max_inflight_pings_strict_limit = "{}";
@@ -101,6 +189,15 @@ const char* const additional_constraints_monitoring_experiment = "{}";
 const char* const description_multiping =
     "Allow more than one ping to be in flight at a time by default.";
 const char* const additional_constraints_multiping = "{}";
+const char* const description_party_arena_participants =
+    "Allocate party participants from the party's arena, reusing the memory of "
+    "completed participants, instead of allocating each one on the heap.";
+const char* const additional_constraints_party_arena_participants = "{}";
+const char* const description_per_cpu_memory_quota =
+    "Keep small per-cpu reserves of memory quota, so that allocators refilling "
+    "and returning memory mostly avoid contending on the quota's shared free "
+    "bytes counter.";
+const char* const additional_constraints_per_cpu_memory_quota = "{}";
 const char* const description_pollset_alternative =
     "Code outside iomgr that relies directly on pollsets will use non-pollset "
     "alternatives when enabled.";
@@ -129,6 +226,10 @@ const char* const description_promise_based_inproc_transport =
 const char* const additional_constraints_promise_based_inproc_transport = "{}";
 const char* const description_retry_in_callv3 = "Support retries with call-v3";
 const char* const additional_constraints_retry_in_callv3 = "{}";
+const char* const description_rls_lock_free_picks =
+    "RLS pickers serve cache hits from immutable, sharded snapshots of the "
+    "cache instead of taking the policy's lock on every pick.";
+const char* const additional_constraints_rls_lock_free_picks = "{}";
 const char* const description_rq_fast_reject =
     "Resource quota rejects requests immediately (before allocating the "
     "request structure) under very high memory pressure.";
@@ -157,6 +258,12 @@ const uint8_t required_experiments_secure_endpoint_offload_large_writes[] = {
     static_cast<uint8_t>(grpc_core::kExperimentIdEventEngineClient),
     static_cast<uint8_t>(grpc_core::kExperimentIdEventEngineListener),
     static_cast<uint8_t>(grpc_core::kExperimentIdEventEngineSecureEndpoint)};
+const char* const description_security_handshake_offload =
+    "Run TSI handshake steps on the EventEngine, a bounded number at a time, "
+    "instead of on the thread that read the handshake bytes, so that the "
+    "crypto of new connections does not delay the data path of established "
+    "ones.";
+const char* const additional_constraints_security_handshake_offload = "{}";
 const char* const description_server_global_callbacks_ownership =
     "If set, server global callbacks ownership is fixed to not be owned by "
     "gRPC.";
@@ -165,9 +272,21 @@ const char* const additional_constraints_server_global_callbacks_ownership =
 const char* const description_shard_global_connection_pool =
     "If set, shard the global connection pool to improve parallelism.";
 const char* const additional_constraints_shard_global_connection_pool = "{}";
+const char* const description_sharded_lb_picker =
+    "Keep a copy of the client channel's LB picker per CPU shard, so that "
+    "picks do not take the channel's LB mutex or a ref to the picker.";
+const char* const additional_constraints_sharded_lb_picker = "{}";
+const char* const description_shared_service_configs =
+    "If set, channels that receive the same service config JSON share a single "
+    "parsed service config instead of each parsing it.";
+const char* const additional_constraints_shared_service_configs = "{}";
 const char* const description_sleep_promise_exec_ctx_removal =
     "If set, polling the sleep promise does not rely on the ExecCtx.";
 const char* const additional_constraints_sleep_promise_exec_ctx_removal = "{}";
+const char* const description_small_slice_inlining =
+    "Store copied slices that fit in a grpc_slice inline instead of allocating "
+    "a refcount for them, and grow slice buffer slice arrays geometrically.";
+const char* const additional_constraints_small_slice_inlining = "{}";
 const char* const description_tcp_frame_size_tuning =
     "If set, enables TCP to use RPC size estimation made by higher layers. TCP "
     "would not indicate completion of a read operation until a specified "
@@ -177,6 +296,29 @@ const char* const additional_constraints_tcp_frame_size_tuning = "{}";
 const char* const description_tcp_rcv_lowat =
     "Use SO_RCVLOWAT to avoid wakeups on the read path.";
 const char* const additional_constraints_tcp_rcv_lowat = "{}";
+const char* const description_tcp_read_buffer_pool =
+    "Recycle TCP read buffers through a pool shared by the endpoints of a "
+    "poller instead of allocating fresh slices for every read.";
+const char* const additional_constraints_tcp_read_buffer_pool = "{}";
+const char* const description_tcp_tx_zerocopy_adaptive =
+    "Let the pool of TCP TX zerocopy send records grow while the socket is not "
+    "short of optmem, and raise the zerocopy size threshold of connections on "
+    "which the kernel reports that zerocopy sends were copied anyway.";
+const char* const additional_constraints_tcp_tx_zerocopy_adaptive = "{}";
+const char* const description_tls_verified_chain_cache =
+    "Have TLS handshaker factories remember the chains built for recently "
+    "verified peer certificates, and skip building and verifying the chain "
+    "again when a peer presents the same certificates.";
+const char* const additional_constraints_tls_verified_chain_cache = "{}";
+const char* const description_token_fetcher_proactive_refresh =
+    "Refresh tokens fetched by token fetcher call credentials in the "
+    "background ahead of their expiration while calls keep using them, instead "
+    "of waiting for a call to find the token about to expire.";
+const char* const additional_constraints_token_fetcher_proactive_refresh = "{}";
+const char* const description_token_fetcher_shared_cache =
+    "Share tokens between token fetcher call credentials objects that fetch "
+    "tokens for the same principal through a process-wide cache.";
+const char* const additional_constraints_token_fetcher_shared_cache = "{}";
 const char* const description_tsi_frame_protector_without_locks =
     "Do not hold locks while using the tsi_frame_protector.";
 const char* const additional_constraints_tsi_frame_protector_without_locks =
@@ -185,22 +327,57 @@ const char* const description_unconstrained_max_quota_buffer_size =
     "Discard the cap on the max free pool size for one memory allocator";
 const char* const additional_constraints_unconstrained_max_quota_buffer_size =
     "{}";
+const char* const description_xds_skip_unchanged_resources =
+    "In XdsClient, skip decoding a resource whose serialized bytes are the "
+    "same as the ones last accepted for it.";
+const char* const additional_constraints_xds_skip_unchanged_resources = "{}";
+const char* const description_zlib_stream_reuse =
+    "Keep a deflate and an inflate z_stream per thread and reset them between "
+    "messages instead of setting up and tearing down a stream per message.";
+const char* const additional_constraints_zlib_stream_reuse = "{}";
 }  // namespace
 
 namespace grpc_core {
 
 const ExperimentMetadata g_experiment_metadata[] = {
+    {"alts_handshaker_channel_pool", description_alts_handshaker_channel_pool,
+     additional_constraints_alts_handshaker_channel_pool, nullptr, 0, false,
+     true},
+    {"bdp_estimate_from_tcp_info", description_bdp_estimate_from_tcp_info,
+     additional_constraints_bdp_estimate_from_tcp_info, nullptr, 0, false,
+     true},
+    {"call_arena_recycling", description_call_arena_recycling,
+     additional_constraints_call_arena_recycling, nullptr, 0, false, true},
     {"call_tracer_in_transport", description_call_tracer_in_transport,
      additional_constraints_call_tracer_in_transport, nullptr, 0, true, false},
     {"callv3_client_auth_filter", description_callv3_client_auth_filter,
      additional_constraints_callv3_client_auth_filter, nullptr, 0, false, true},
+    {"chaotic_good_adaptive_data_endpoints",
+     description_chaotic_good_adaptive_data_endpoints,
+     additional_constraints_chaotic_good_adaptive_data_endpoints, nullptr, 0,
+     false, true},
     {"chaotic_good_framing_layer", description_chaotic_good_framing_layer,
      additional_constraints_chaotic_good_framing_layer, nullptr, 0, true,
      false},
+    {"chaotic_good_shared_memory", description_chaotic_good_shared_memory,
+     additional_constraints_chaotic_good_shared_memory, nullptr, 0, false,
+     false},
     {"chttp2_bound_write_size", description_chttp2_bound_write_size,
      additional_constraints_chttp2_bound_write_size, nullptr, 0, false, true},
+    {"chttp2_coalesce_small_write_slices",
+     description_chttp2_coalesce_small_write_slices,
+     additional_constraints_chttp2_coalesce_small_write_slices, nullptr, 0,
+     false, true},
+    {"chttp2_weighted_write_scheduling",
+     description_chttp2_weighted_write_scheduling,
+     additional_constraints_chttp2_weighted_write_scheduling, nullptr, 0, false,
+     true},
     {"error_flatten", description_error_flatten,
      additional_constraints_error_flatten, nullptr, 0, false, false},
+    {"event_engine_adaptive_spinning",
+     description_event_engine_adaptive_spinning,
+     additional_constraints_event_engine_adaptive_spinning, nullptr, 0, false,
+     true},
     {"event_engine_client", description_event_engine_client,
      additional_constraints_event_engine_client, nullptr, 0, true, false},
     {"event_engine_dns", description_event_engine_dns,
@@ -211,6 +388,8 @@ const ExperimentMetadata g_experiment_metadata[] = {
      true, false},
     {"event_engine_fork", description_event_engine_fork,
      additional_constraints_event_engine_fork, nullptr, 0, false, false},
+    {"event_engine_hot_spinners", description_event_engine_hot_spinners,
+     additional_constraints_event_engine_hot_spinners, nullptr, 0, false, true},
     {"event_engine_listener", description_event_engine_listener,
      additional_constraints_event_engine_listener, nullptr, 0, true, false},
     {"event_engine_callback_cq", description_event_engine_callback_cq,
@@ -220,16 +399,38 @@ const ExperimentMetadata g_experiment_metadata[] = {
      description_event_engine_for_all_other_endpoints,
      additional_constraints_event_engine_for_all_other_endpoints,
      required_experiments_event_engine_for_all_other_endpoints, 4, true, false},
+    {"event_engine_numa_aware_stealing",
+     description_event_engine_numa_aware_stealing,
+     additional_constraints_event_engine_numa_aware_stealing, nullptr, 0, false,
+     true},
     {"event_engine_secure_endpoint", description_event_engine_secure_endpoint,
      additional_constraints_event_engine_secure_endpoint, nullptr, 0, true,
      false},
+    {"event_engine_timer_wheel", description_event_engine_timer_wheel,
+     additional_constraints_event_engine_timer_wheel, nullptr, 0, false, true},
+    {"event_engine_worker_affinity", description_event_engine_worker_affinity,
+     additional_constraints_event_engine_worker_affinity, nullptr, 0, false,
+     true},
     {"free_large_allocator", description_free_large_allocator,
      additional_constraints_free_large_allocator, nullptr, 0, false, true},
+    {"fused_filter_stacks", description_fused_filter_stacks,
+     additional_constraints_fused_filter_stacks, nullptr, 0, false, true},
+    {"hpack_encoder_prefix_cache", description_hpack_encoder_prefix_cache,
+     additional_constraints_hpack_encoder_prefix_cache, nullptr, 0, false,
+     true},
+    {"hpack_shared_values", description_hpack_shared_values,
+     additional_constraints_hpack_shared_values, nullptr, 0, false, true},
+    {"huge_page_slab_allocator", description_huge_page_slab_allocator,
+     additional_constraints_huge_page_slab_allocator, nullptr, 0, false, true},
     {"keep_alive_ping_timer_batch", description_keep_alive_ping_timer_batch,
      additional_constraints_keep_alive_ping_timer_batch, nullptr, 0, false,
      true},
+    {"lazy_deadline_timers", description_lazy_deadline_timers,
+     additional_constraints_lazy_deadline_timers, nullptr, 0, false, false},
     {"local_connector_secure", description_local_connector_secure,
      additional_constraints_local_connector_secure, nullptr, 0, false, true},
+    {"lock_free_work_serializer", description_lock_free_work_serializer,
+     additional_constraints_lock_free_work_serializer, nullptr, 0, false, true},
     {"max_inflight_pings_strict_limit",
      description_max_inflight_pings_strict_limit,
      additional_constraints_max_inflight_pings_strict_limit, nullptr, 0, true,
@@ -240,6 +441,10 @@ const ExperimentMetadata g_experiment_metadata[] = {
      additional_constraints_monitoring_experiment, nullptr, 0, true, true},
     {"multiping", description_multiping, additional_constraints_multiping,
      nullptr, 0, false, true},
+    {"party_arena_participants", description_party_arena_participants,
+     additional_constraints_party_arena_participants, nullptr, 0, false, true},
+    {"per_cpu_memory_quota", description_per_cpu_memory_quota,
+     additional_constraints_per_cpu_memory_quota, nullptr, 0, false, true},
     {"pollset_alternative", description_pollset_alternative,
      additional_constraints_pollset_alternative,
      required_experiments_pollset_alternative, 2, false, false},
@@ -259,6 +464,8 @@ const ExperimentMetadata g_experiment_metadata[] = {
      false},
     {"retry_in_callv3", description_retry_in_callv3,
      additional_constraints_retry_in_callv3, nullptr, 0, false, true},
+    {"rls_lock_free_picks", description_rls_lock_free_picks,
+     additional_constraints_rls_lock_free_picks, nullptr, 0, false, true},
     {"rq_fast_reject", description_rq_fast_reject,
      additional_constraints_rq_fast_reject, nullptr, 0, false, true},
     {"rst_stream_fix", description_rst_stream_fix,
@@ -275,6 +482,9 @@ const ExperimentMetadata g_experiment_metadata[] = {
      description_secure_endpoint_offload_large_writes,
      additional_constraints_secure_endpoint_offload_large_writes,
      required_experiments_secure_endpoint_offload_large_writes, 3, false, true},
+    {"security_handshake_offload", description_security_handshake_offload,
+     additional_constraints_security_handshake_offload, nullptr, 0, false,
+     true},
     {"server_global_callbacks_ownership",
      description_server_global_callbacks_ownership,
      additional_constraints_server_global_callbacks_ownership, nullptr, 0,
@@ -282,14 +492,33 @@ const ExperimentMetadata g_experiment_metadata[] = {
     {"shard_global_connection_pool", description_shard_global_connection_pool,
      additional_constraints_shard_global_connection_pool, nullptr, 0, true,
      true},
+    {"sharded_lb_picker", description_sharded_lb_picker,
+     additional_constraints_sharded_lb_picker, nullptr, 0, false, true},
+    {"shared_service_configs", description_shared_service_configs,
+     additional_constraints_shared_service_configs, nullptr, 0, false, true},
     {"sleep_promise_exec_ctx_removal",
      description_sleep_promise_exec_ctx_removal,
      additional_constraints_sleep_promise_exec_ctx_removal, nullptr, 0, false,
      true},
+    {"small_slice_inlining", description_small_slice_inlining,
+     additional_constraints_small_slice_inlining, nullptr, 0, false, true},
     {"tcp_frame_size_tuning", description_tcp_frame_size_tuning,
      additional_constraints_tcp_frame_size_tuning, nullptr, 0, false, true},
     {"tcp_rcv_lowat", description_tcp_rcv_lowat,
      additional_constraints_tcp_rcv_lowat, nullptr, 0, false, true},
+    {"tcp_read_buffer_pool", description_tcp_read_buffer_pool,
+     additional_constraints_tcp_read_buffer_pool, nullptr, 0, false, true},
+    {"tcp_tx_zerocopy_adaptive", description_tcp_tx_zerocopy_adaptive,
+     additional_constraints_tcp_tx_zerocopy_adaptive, nullptr, 0, false, true},
+    {"tls_verified_chain_cache", description_tls_verified_chain_cache,
+     additional_constraints_tls_verified_chain_cache, nullptr, 0, false, true},
+    {"token_fetcher_proactive_refresh",
+     description_token_fetcher_proactive_refresh,
+     additional_constraints_token_fetcher_proactive_refresh, nullptr, 0, false,
+     true},
+    {"token_fetcher_shared_cache", description_token_fetcher_shared_cache,
+     additional_constraints_token_fetcher_shared_cache, nullptr, 0, false,
+     true},
     {"tsi_frame_protector_without_locks",
      description_tsi_frame_protector_without_locks,
      additional_constraints_tsi_frame_protector_without_locks, nullptr, 0,
@@ -298,27 +527,74 @@ const ExperimentMetadata g_experiment_metadata[] = {
      description_unconstrained_max_quota_buffer_size,
      additional_constraints_unconstrained_max_quota_buffer_size, nullptr, 0,
      false, true},
+    {"xds_skip_unchanged_resources", description_xds_skip_unchanged_resources,
+     additional_constraints_xds_skip_unchanged_resources, nullptr, 0, false,
+     true},
+    {"zlib_stream_reuse", description_zlib_stream_reuse,
+     additional_constraints_zlib_stream_reuse, nullptr, 0, false, true},
 };
 
 }  // namespace grpc_core
 
 #elif defined(GPR_WINDOWS)
 namespace {
+const char* const description_alts_handshaker_channel_pool =
+    "Share a pool of channels to the ALTS handshaker service, each with its "
+    "own connection, between the handshakes of an ALTS credentials object, "
+    "instead of creating a channel per handshake.";
+const char* const additional_constraints_alts_handshaker_channel_pool = "{}";
+const char* const description_bdp_estimate_from_tcp_info =
+    "When the endpoint reports TCP_INFO, time BDP probes by the kernel's round "
+    "trip time estimate instead of sending HTTP2 pings.";
+const char* const additional_constraints_bdp_estimate_from_tcp_info = "{}";
+const char* const description_call_arena_recycling =
+    "Keep recently freed call arenas of the learned call size for reuse by new "
+    "calls, and recycle memory of pooled objects through per-thread free "
+    "lists.";
+const char* const additional_constraints_call_arena_recycling = "{}";
 const char* const description_call_tracer_in_transport =
     "Transport directly passes byte counts to CallTracer.";
 const char* const additional_constraints_call_tracer_in_transport = "{}";
 const char* const description_callv3_client_auth_filter =
     "Use the CallV3 client auth filter.";
 const char* const additional_constraints_callv3_client_auth_filter = "{}";
+const char* const description_chaotic_good_adaptive_data_endpoints =
+    "Spread chaotic good data frames over only as many data endpoints as are "
+    "needed to keep queueing delay low, adding endpoints as writes queue up "
+    "and dropping them again while writes complete promptly.";
+const char* const additional_constraints_chaotic_good_adaptive_data_endpoints =
+    "{}";
 const char* const description_chaotic_good_framing_layer =
     "Enable the chaotic good framing layer.";
 const char* const additional_constraints_chaotic_good_framing_layer = "{}";
+const char* const description_chaotic_good_shared_memory =
+    "Offer chaotic good peers on the same host a shared memory ring per "
+    "direction, so that large payloads are copied through shared memory and "
+    "only a small descriptor is sent on the data endpoints.";
+const char* const additional_constraints_chaotic_good_shared_memory = "{}";
 const char* const description_chttp2_bound_write_size =
     "Fix a bug where chttp2 can generate very large writes";
 const char* const additional_constraints_chttp2_bound_write_size = "{}";
+const char* const description_chttp2_coalesce_small_write_slices =
+    "Copy runs of small slices (frame headers, small messages) in an outgoing "
+    "chttp2 write into contiguous slices, so that each write needs fewer "
+    "iovecs and syscalls.";
+const char* const additional_constraints_chttp2_coalesce_small_write_slices =
+    "{}";
+const char* const description_chttp2_weighted_write_scheduling =
+    "Bound the bytes each writable chttp2 stream may frame per visit of the "
+    "writable list by its write priority, so that writes round-robin between "
+    "streams instead of one stream filling the whole write.";
+const char* const additional_constraints_chttp2_weighted_write_scheduling =
+    "{}";
 const char* const description_error_flatten =
     "Flatten errors to ordinary absl::Status form.";
 const char* const additional_constraints_error_flatten = "{}";
+const char* const description_event_engine_adaptive_spinning =
+    "Let idle EventEngine workers spin briefly before they wait, for as long "
+    "as work recently took to arrive, instead of always waiting on a condition "
+    "variable.";
+const char* const additional_constraints_event_engine_adaptive_spinning = "{}";
 const char* const description_event_engine_client =
     "Use EventEngine clients instead of iomgr's grpc_tcp_client";
 const char* const additional_constraints_event_engine_client = "{}";
@@ -334,6 +610,11 @@ const char* const description_event_engine_fork =
     "Enables event engine fork handling, including onfork events and file "
     "descriptor generations";
 const char* const additional_constraints_event_engine_fork = "{}";
+const char* const description_event_engine_hot_spinners =
+    "Keep one idle EventEngine worker per home (or two per pool without worker "
+    "affinity) spinning until work arrives, trading a core for lower wake up "
+    "latency.";
+const char* const additional_constraints_event_engine_hot_spinners = "{}";
 const char* const description_event_engine_listener =
     "Use EventEngine listeners instead of iomgr's grpc_tcp_server";
 const char* const additional_constraints_event_engine_listener = "{}";
@@ -354,20 +635,61 @@ const uint8_t required_experiments_event_engine_for_all_other_endpoints[] = {
     static_cast<uint8_t>(
         grpc_core::kExperimentIdEventEngineDnsNonClientChannel),
     static_cast<uint8_t>(grpc_core::kExperimentIdEventEngineListener)};
+const char* const description_event_engine_numa_aware_stealing =
+    "Spread EventEngine worker threads over the NUMA nodes of the host, bind "
+    "each to the cpus of its node, and have idle workers steal work from their "
+    "own node before any other.";
+const char* const additional_constraints_event_engine_numa_aware_stealing =
+    "{}";
 const char* const description_event_engine_secure_endpoint =
     "Use EventEngine secure endpoint wrapper instead of iomgr when available";
 const char* const additional_constraints_event_engine_secure_endpoint = "{}";
+const char* const description_event_engine_timer_wheel =
+    "Keep the posix EventEngine's timers in hierarchical timing wheels, with "
+    "constant time insertion and cancellation, instead of sharded heaps.";
+const char* const additional_constraints_event_engine_timer_wheel = "{}";
+const char* const description_event_engine_worker_affinity =
+    "Give every EventEngine endpoint a home worker thread, picked from the CPU "
+    "that received its connection (SO_INCOMING_CPU), and run its I/O callbacks "
+    "there. Other workers only steal that work when they are idle.";
+const char* const additional_constraints_event_engine_worker_affinity = "{}";
 const char* const description_free_large_allocator =
     "If set, return all free bytes from a \042big\042 allocator";
 const char* const additional_constraints_free_large_allocator = "{}";
+const char* const description_fused_filter_stacks =
+    "Replace runs of common v3 filters (message size, http and compression) "
+    "with a single filter fused at compile time, so that each call step makes "
+    "one statically dispatched call for the whole run.";
+const char* const additional_constraints_fused_filter_stacks = "{}";
+const char* const description_hpack_encoder_prefix_cache =
+    "Cache the encoded request headers that are the same on every call of a "
+    "method, and replay them while the HPACK dynamic table is unchanged.";
+const char* const additional_constraints_hpack_encoder_prefix_cache = "{}";
+const char* const description_hpack_shared_values =
+    "Keep header values added to HPACK dynamic tables in a process-wide pool, "
+    "so that connections receiving the same value share a single copy of it.";
+const char* const additional_constraints_hpack_shared_values = "{}";
+const char* const description_huge_page_slab_allocator =
+    "Serve read buffers, memory allocator slices and call arenas from per-cpu "
+    "slabs backed by 2MB huge pages, to cut TLB misses on the data path.";
+const char* const additional_constraints_huge_page_slab_allocator = "{}";
 const char* const description_keep_alive_ping_timer_batch =
     "Avoid explicitly cancelling the keepalive timer. Instead adjust the "
     "callback to re-schedule itself to the next ping interval.";
 const char* const additional_constraints_keep_alive_ping_timer_batch = "{}";
+const char* const description_lazy_deadline_timers =
+    "Only arm a call's deadline timer once its deadline is close, from a "
+    "coarse periodic sweep, so that calls that finish quickly never arm or "
+    "cancel a timer.";
+const char* const additional_constraints_lazy_deadline_timers = "{}";
 const char* const description_local_connector_secure =
     "Local security connector uses TSI_SECURITY_NONE for LOCAL_TCP "
     "connections.";
 const char* const additional_constraints_local_connector_secure = "{}";
+const char* const description_lock_free_work_serializer =
+    "Queue WorkSerializer callbacks on a lock free queue, and run several of "
+    "them per EventEngine callback, bounded by a drain budget.";
+const char* const additional_constraints_lock_free_work_serializer = "{}";
 const char* const description_max_inflight_pings_strict_limit =
     "If set, the max inflight pings limit is strictly enforced.";
 const char* const additional_constraints_max_inflight_pings_strict_limit = "{}";
@@ -382,6 +704,15 @@ const char* const additional_constraints_monitoring_experiment = "{}";
 const char* const description_multiping =
     "Allow more than one ping to be in flight at a time by default.";
 const char* const additional_constraints_multiping = "{}";
+const char* const description_party_arena_participants =
+    "Allocate party participants from the party's arena, reusing the memory of "
+    "completed participants, instead of allocating each one on the heap.";
+const char* const additional_constraints_party_arena_participants = "{}";
+const char* const description_per_cpu_memory_quota =
+    "Keep small per-cpu reserves of memory quota, so that allocators refilling "
+    "and returning memory mostly avoid contending on the quota's shared free "
+    "bytes counter.";
+const char* const additional_constraints_per_cpu_memory_quota = "{}";
 const char* const description_pollset_alternative =
     "Code outside iomgr that relies directly on pollsets will use non-pollset "
     "alternatives when enabled.";
@@ -410,6 +741,10 @@ const char* const description_promise_based_inproc_transport =
 const char* const additional_constraints_promise_based_inproc_transport = "{}";
 const char* const description_retry_in_callv3 = "Support retries with call-v3";
 const char* const additional_constraints_retry_in_callv3 = "{}";
+const char* const description_rls_lock_free_picks =
+    "RLS pickers serve cache hits from immutable, sharded snapshots of the "
+    "cache instead of taking the policy's lock on every pick.";
+const char* const additional_constraints_rls_lock_free_picks = "{}";
 const char* const description_rq_fast_reject =
     "Resource quota rejects requests immediately (before allocating the "
     "request structure) under very high memory pressure.";
@@ -438,6 +773,12 @@ const uint8_t required_experiments_secure_endpoint_offload_large_writes[] = {
     static_cast<uint8_t>(grpc_core::kExperimentIdEventEngineClient),
     static_cast<uint8_t>(grpc_core::kExperimentIdEventEngineListener),
     static_cast<uint8_t>(grpc_core::kExperimentIdEventEngineSecureEndpoint)};
+const char* const description_security_handshake_offload =
+    "Run TSI handshake steps on the EventEngine, a bounded number at a time, "
+    "instead of on the thread that read the handshake bytes, so that the "
+    "crypto of new connections does not delay the data path of established "
+    "ones.";
+const char* const additional_constraints_security_handshake_offload = "{}";
 const char* const description_server_global_callbacks_ownership =
     "If set, server global callbacks ownership is fixed to not be owned by "
     "gRPC.";
@@ -446,9 +787,21 @@ const char* const additional_constraints_server_global_callbacks_ownership =
 const char* const description_shard_global_connection_pool =
     "If set, shard the global connection pool to improve parallelism.";
 const char* const additional_constraints_shard_global_connection_pool = "{}";
+const char* const description_sharded_lb_picker =
+    "Keep a copy of the client channel's LB picker per CPU shard, so that "
+    "picks do not take the channel's LB mutex or a ref to the picker.";
+const char* const additional_constraints_sharded_lb_picker = "{}";
+const char* const description_shared_service_configs =
+    "If set, channels that receive the same service config JSON share a single "
+    "parsed service config instead of each parsing it.";
+const char* const additional_constraints_shared_service_configs = "{}";
 const char* const description_sleep_promise_exec_ctx_removal =
     "If set, polling the sleep promise does not rely on the ExecCtx.";
 const char* const additional_constraints_sleep_promise_exec_ctx_removal = "{}";
+const char* const description_small_slice_inlining =
+    "Store copied slices that fit in a grpc_slice inline instead of allocating "
+    "a refcount for them, and grow slice buffer slice arrays geometrically.";
+const char* const additional_constraints_small_slice_inlining = "{}";
 const char* const description_tcp_frame_size_tuning =
     "If set, enables TCP to use RPC size estimation made by higher layers. TCP "
     "would not indicate completion of a read operation until a specified "
@@ -458,6 +811,29 @@ const char* const additional_constraints_tcp_frame_size_tuning = "{}";
 const char* const description_tcp_rcv_lowat =
     "Use SO_RCVLOWAT to avoid wakeups on the read path.";
 const char* const additional_constraints_tcp_rcv_lowat = "{}";
+const char* const description_tcp_read_buffer_pool =
+    "Recycle TCP read buffers through a pool shared by the endpoints of a "
+    "poller instead of allocating fresh slices for every read.";
+const char* const additional_constraints_tcp_read_buffer_pool = "{}";
+const char* const description_tcp_tx_zerocopy_adaptive =
+    "Let the pool of TCP TX zerocopy send records grow while the socket is not "
+    "short of optmem, and raise the zerocopy size threshold of connections on "
+    "which the kernel reports that zerocopy sends were copied anyway.";
+const char* const additional_constraints_tcp_tx_zerocopy_adaptive = "{}";
+const char* const description_tls_verified_chain_cache =
+    "Have TLS handshaker factories remember the chains built for recently "
+    "verified peer certificates, and skip building and verifying the chain "
+    "again when a peer presents the same certificates.";
+const char* const additional_constraints_tls_verified_chain_cache = "{}";
+const char* const description_token_fetcher_proactive_refresh =
+    "Refresh tokens fetched by token fetcher call credentials in the "
+    "background ahead of their expiration while calls keep using them, instead "
+    "of waiting for a call to find the token about to expire.";
+const char* const additional_constraints_token_fetcher_proactive_refresh = "{}";
+const char* const description_token_fetcher_shared_cache =
+    "Share tokens between token fetcher call credentials objects that fetch "
+    "tokens for the same principal through a process-wide cache.";
+const char* const additional_constraints_token_fetcher_shared_cache = "{}";
 const char* const description_tsi_frame_protector_without_locks =
     "Do not hold locks while using the tsi_frame_protector.";
 const char* const additional_constraints_tsi_frame_protector_without_locks =
@@ -466,22 +842,57 @@ const char* const description_unconstrained_max_quota_buffer_size =
     "Discard the cap on the max free pool size for one memory allocator";
 const char* const additional_constraints_unconstrained_max_quota_buffer_size =
     "{}";
+const char* const description_xds_skip_unchanged_resources =
+    "In XdsClient, skip decoding a resource whose serialized bytes are the "
+    "same as the ones last accepted for it.";
+const char* const additional_constraints_xds_skip_unchanged_resources = "{}";
+const char* const description_zlib_stream_reuse =
+    "Keep a deflate and an inflate z_stream per thread and reset them between "
+    "messages instead of setting up and tearing down a stream per message.";
+const char* const additional_constraints_zlib_stream_reuse = "{}";
 }  // namespace
 
 namespace grpc_core {
 
 const ExperimentMetadata g_experiment_metadata[] = {
+    {"alts_handshaker_channel_pool", description_alts_handshaker_channel_pool,
+     additional_constraints_alts_handshaker_channel_pool, nullptr, 0, false,
+     true},
+    {"bdp_estimate_from_tcp_info", description_bdp_estimate_from_tcp_info,
+     additional_constraints_bdp_estimate_from_tcp_info, nullptr, 0, false,
+     true},
+    {"call_arena_recycling", description_call_arena_recycling,
+     additional_constraints_call_arena_recycling, nullptr, 0, false, true},
     {"call_tracer_in_transport", description_call_tracer_in_transport,
      additional_constraints_call_tracer_in_transport, nullptr, 0, true, false},
     {"callv3_client_auth_filter", description_callv3_client_auth_filter,
      additional_constraints_callv3_client_auth_filter, nullptr, 0, false, true},
+    {"chaotic_good_adaptive_data_endpoints",
+     description_chaotic_good_adaptive_data_endpoints,
+     additional_constraints_chaotic_good_adaptive_data_endpoints, nullptr, 0,
+     false, true},
     {"chaotic_good_framing_layer", description_chaotic_good_framing_layer,
      additional_constraints_chaotic_good_framing_layer, nullptr, 0, true,
      false},
+    {"chaotic_good_shared_memory", description_chaotic_good_shared_memory,
+     additional_constraints_chaotic_good_shared_memory, nullptr, 0, false,
+     false},
     {"chttp2_bound_write_size", description_chttp2_bound_write_size,
      additional_constraints_chttp2_bound_write_size, nullptr, 0, false, true},
+    {"chttp2_coalesce_small_write_slices",
+     description_chttp2_coalesce_small_write_slices,
+     additional_constraints_chttp2_coalesce_small_write_slices, nullptr, 0,
+     false, true},
+    {"chttp2_weighted_write_scheduling",
+     description_chttp2_weighted_write_scheduling,
+     additional_constraints_chttp2_weighted_write_scheduling, nullptr, 0, false,
+     true},
     {"error_flatten", description_error_flatten,
      additional_constraints_error_flatten, nullptr, 0, false, false},
+    {"event_engine_adaptive_spinning",
+     description_event_engine_adaptive_spinning,
+     additional_constraints_event_engine_adaptive_spinning, nullptr, 0, false,
+     true},
     {"event_engine_client", description_event_engine_client,
      additional_constraints_event_engine_client, nullptr, 0, true, false},
     {"event_engine_dns", description_event_engine_dns,
@@ -492,6 +903,8 @@ const ExperimentMetadata g_experiment_metadata[] = {
      true, false},
     {"event_engine_fork", description_event_engine_fork,
      additional_constraints_event_engine_fork, nullptr, 0, false, false},
+    {"event_engine_hot_spinners", description_event_engine_hot_spinners,
+     additional_constraints_event_engine_hot_spinners, nullptr, 0, false, true},
     {"event_engine_listener", description_event_engine_listener,
      additional_constraints_event_engine_listener, nullptr, 0, true, false},
     {"event_engine_callback_cq", description_event_engine_callback_cq,
@@ -501,16 +914,38 @@ const ExperimentMetadata g_experiment_metadata[] = {
      description_event_engine_for_all_other_endpoints,
      additional_constraints_event_engine_for_all_other_endpoints,
      required_experiments_event_engine_for_all_other_endpoints, 4, true, false},
+    {"event_engine_numa_aware_stealing",
+     description_event_engine_numa_aware_stealing,
+     additional_constraints_event_engine_numa_aware_stealing, nullptr, 0, false,
+     true},
     {"event_engine_secure_endpoint", description_event_engine_secure_endpoint,
      additional_constraints_event_engine_secure_endpoint, nullptr, 0, true,
      false},
+    {"event_engine_timer_wheel", description_event_engine_timer_wheel,
+     additional_constraints_event_engine_timer_wheel, nullptr, 0, false, true},
+    {"event_engine_worker_affinity", description_event_engine_worker_affinity,
+     additional_constraints_event_engine_worker_affinity, nullptr, 0, false,
+     true},
     {"free_large_allocator", description_free_large_allocator,
      additional_constraints_free_large_allocator, nullptr, 0, false, true},
+    {"fused_filter_stacks", description_fused_filter_stacks,
+     additional_constraints_fused_filter_stacks, nullptr, 0, false, true},
+    {"hpack_encoder_prefix_cache", description_hpack_encoder_prefix_cache,
+     additional_constraints_hpack_encoder_prefix_cache, nullptr, 0, false,
+     true},
+    {"hpack_shared_values", description_hpack_shared_values,
+     additional_constraints_hpack_shared_values, nullptr, 0, false, true},
+    {"huge_page_slab_allocator", description_huge_page_slab_allocator,
+     additional_constraints_huge_page_slab_allocator, nullptr, 0, false, true},
     {"keep_alive_ping_timer_batch", description_keep_alive_ping_timer_batch,
      additional_constraints_keep_alive_ping_timer_batch, nullptr, 0, false,
      true},
+    {"lazy_deadline_timers", description_lazy_deadline_timers,
+     additional_constraints_lazy_deadline_timers, nullptr, 0, false, false},
     {"local_connector_secure", description_local_connector_secure,
      additional_constraints_local_connector_secure, nullptr, 0, false, true},
+    {"lock_free_work_serializer", description_lock_free_work_serializer,
+     additional_constraints_lock_free_work_serializer, nullptr, 0, false, true},
     {"max_inflight_pings_strict_limit",
      description_max_inflight_pings_strict_limit,
      additional_constraints_max_inflight_pings_strict_limit, nullptr, 0, true,
@@ -521,6 +956,10 @@ const ExperimentMetadata g_experiment_metadata[] = {
      additional_constraints_monitoring_experiment, nullptr, 0, true, true},
     {"multiping", description_multiping, additional_constraints_multiping,
      nullptr, 0, false, true},
+    {"party_arena_participants", description_party_arena_participants,
+     additional_constraints_party_arena_participants, nullptr, 0, false, true},
+    {"per_cpu_memory_quota", description_per_cpu_memory_quota,
+     additional_constraints_per_cpu_memory_quota, nullptr, 0, false, true},
     {"pollset_alternative", description_pollset_alternative,
      additional_constraints_pollset_alternative,
      required_experiments_pollset_alternative, 2, false, false},
@@ -540,6 +979,8 @@ const ExperimentMetadata g_experiment_metadata[] = {
      false},
     {"retry_in_callv3", description_retry_in_callv3,
      additional_constraints_retry_in_callv3, nullptr, 0, false, true},
+    {"rls_lock_free_picks", description_rls_lock_free_picks,
+     additional_constraints_rls_lock_free_picks, nullptr, 0, false, true},
     {"rq_fast_reject", description_rq_fast_reject,
      additional_constraints_rq_fast_reject, nullptr, 0, false, true},
     {"rst_stream_fix", description_rst_stream_fix,
@@ -556,6 +997,9 @@ const ExperimentMetadata g_experiment_metadata[] = {
      description_secure_endpoint_offload_large_writes,
      additional_constraints_secure_endpoint_offload_large_writes,
      required_experiments_secure_endpoint_offload_large_writes, 3, false, true},
+    {"security_handshake_offload", description_security_handshake_offload,
+     additional_constraints_security_handshake_offload, nullptr, 0, false,
+     true},
     {"server_global_callbacks_ownership",
      description_server_global_callbacks_ownership,
      additional_constraints_server_global_callbacks_ownership, nullptr, 0,
@@ -563,14 +1007,33 @@ const ExperimentMetadata g_experiment_metadata[] = {
     {"shard_global_connection_pool", description_shard_global_connection_pool,
      additional_constraints_shard_global_connection_pool, nullptr, 0, true,
      true},
+    {"sharded_lb_picker", description_sharded_lb_picker,
+     additional_constraints_sharded_lb_picker, nullptr, 0, false, true},
+    {"shared_service_configs", description_shared_service_configs,
+     additional_constraints_shared_service_configs, nullptr, 0, false, true},
     {"sleep_promise_exec_ctx_removal",
      description_sleep_promise_exec_ctx_removal,
      additional_constraints_sleep_promise_exec_ctx_removal, nullptr, 0, false,
      true},
+    {"small_slice_inlining", description_small_slice_inlining,
+     additional_constraints_small_slice_inlining, nullptr, 0, false, true},
     {"tcp_frame_size_tuning", description_tcp_frame_size_tuning,
      additional_constraints_tcp_frame_size_tuning, nullptr, 0, false, true},
     {"tcp_rcv_lowat", description_tcp_rcv_lowat,
      additional_constraints_tcp_rcv_lowat, nullptr, 0, false, true},
+    {"tcp_read_buffer_pool", description_tcp_read_buffer_pool,
+     additional_constraints_tcp_read_buffer_pool, nullptr, 0, false, true},
+    {"tcp_tx_zerocopy_adaptive", description_tcp_tx_zerocopy_adaptive,
+     additional_constraints_tcp_tx_zerocopy_adaptive, nullptr, 0, false, true},
+    {"tls_verified_chain_cache", description_tls_verified_chain_cache,
+     additional_constraints_tls_verified_chain_cache, nullptr, 0, false, true},
+    {"token_fetcher_proactive_refresh",
+     description_token_fetcher_proactive_refresh,
+     additional_constraints_token_fetcher_proactive_refresh, nullptr, 0, false,
+     true},
+    {"token_fetcher_shared_cache", description_token_fetcher_shared_cache,
+     additional_constraints_token_fetcher_shared_cache, nullptr, 0, false,
+     true},
     {"tsi_frame_protector_without_locks",
      description_tsi_frame_protector_without_locks,
      additional_constraints_tsi_frame_protector_without_locks, nullptr, 0,
@@ -579,27 +1042,74 @@ const ExperimentMetadata g_experiment_metadata[] = {
      description_unconstrained_max_quota_buffer_size,
      additional_constraints_unconstrained_max_quota_buffer_size, nullptr, 0,
      false, true},
+    {"xds_skip_unchanged_resources", description_xds_skip_unchanged_resources,
+     additional_constraints_xds_skip_unchanged_resources, nullptr, 0, false,
+     true},
+    {"zlib_stream_reuse", description_zlib_stream_reuse,
+     additional_constraints_zlib_stream_reuse, nullptr, 0, false, true},
 };
 
 }  // namespace grpc_core
 
 #else
 namespace {
+const char* const description_alts_handshaker_channel_pool =
+    "Share a pool of channels to the ALTS handshaker service, each with its "
+    "own connection, between the handshakes of an ALTS credentials object, "
+    "instead of creating a channel per handshake.";
+const char* const additional_constraints_alts_handshaker_channel_pool = "{}";
+const char* const description_bdp_estimate_from_tcp_info =
+    "When the endpoint reports TCP_INFO, time BDP probes by the kernel's round "
+    "trip time estimate instead of sending HTTP2 pings.";
+const char* const additional_constraints_bdp_estimate_from_tcp_info = "{}";
+const char* const description_call_arena_recycling =
+    "Keep recently freed call arenas of the learned call size for reuse by new "
+    "calls, and recycle memory of pooled objects through per-thread free "
+    "lists.";
+const char* const additional_constraints_call_arena_recycling = "{}";
 const char* const description_call_tracer_in_transport =
     "Transport directly passes byte counts to CallTracer.";
 const char* const additional_constraints_call_tracer_in_transport = "{}";
 const char* const description_callv3_client_auth_filter =
     "Use the CallV3 client auth filter.";
 const char* const additional_constraints_callv3_client_auth_filter = "{}";
+const char* const description_chaotic_good_adaptive_data_endpoints =
+    "Spread chaotic good data frames over only as many data endpoints as are "
+    "needed to keep queueing delay low, adding endpoints as writes queue up "
+    "and dropping them again while writes complete promptly.";
+const char* const additional_constraints_chaotic_good_adaptive_data_endpoints =
+    "{}";
 const char* const description_chaotic_good_framing_layer =
     "Enable the chaotic good framing layer.";
 const char* const additional_constraints_chaotic_good_framing_layer = "{}";
+const char* const description_chaotic_good_shared_memory =
+    "Offer chaotic good peers on the same host a shared memory ring per "
+    "direction, so that large payloads are copied through shared memory and "
+    "only a small descriptor is sent on the data endpoints.";
+const char* const additional_constraints_chaotic_good_shared_memory = "{}";
 const char* const description_chttp2_bound_write_size =
     "Fix a bug where chttp2 can generate very large writes";
 const char* const additional_constraints_chttp2_bound_write_size = "{}";
+const char* const description_chttp2_coalesce_small_write_slices =
+    "Copy runs of small slices (frame headers, small messages) in an outgoing "
+    "chttp2 write into contiguous slices, so that each write needs fewer "
+    "iovecs and syscalls.";
+const char* const additional_constraints_chttp2_coalesce_small_write_slices =
+    "{}";
+const char* const description_chttp2_weighted_write_scheduling =
+    "Bound the bytes each writable chttp2 stream may frame per visit of the "
+    "writable list by its write priority, so that writes round-robin between "
+    "streams instead of one stream filling the whole write.";
+const char* const additional_constraints_chttp2_weighted_write_scheduling =
+    "{}";
 const char* const description_error_flatten =
     "Flatten errors to ordinary absl::Status form.";
 const char* const additional_constraints_error_flatten = "{}";
+const char* const description_event_engine_adaptive_spinning =
+    "Let idle EventEngine workers spin briefly before they wait, for as long "
+    "as work recently took to arrive, instead of always waiting on a condition "
+    "variable.";
+const char* const additional_constraints_event_engine_adaptive_spinning = "{}";
 const char* const description_event_engine_client =
     "Use EventEngine clients instead of iomgr's grpc_tcp_client";
 const char* const additional_constraints_event_engine_client = "{}";
@@ -615,6 +1125,11 @@ const char* const description_event_engine_fork =
     "Enables event engine fork handling, including onfork events and file "
     "descriptor generations";
 const char* const additional_constraints_event_engine_fork = "{}";
+const char* const description_event_engine_hot_spinners =
+    "Keep one idle EventEngine worker per home (or two per pool without worker "
+    "affinity) spinning until work arrives, trading a core for lower wake up "
+    "latency.";
+const char* const additional_constraints_event_engine_hot_spinners = "{}";
 const char* const description_event_engine_listener =
     "Use EventEngine listeners instead of iomgr's grpc_tcp_server";
 const char* const additional_constraints_event_engine_listener = "{}";
@@ -635,20 +1150,61 @@ const uint8_t required_experiments_event_engine_for_all_other_endpoints[] = {
     static_cast<uint8_t>(
         grpc_core::kExperimentIdEventEngineDnsNonClientChannel),
     static_cast<uint8_t>(grpc_core::kExperimentIdEventEngineListener)};
+const char* const description_event_engine_numa_aware_stealing =
+    "Spread EventEngine worker threads over the NUMA nodes of the host, bind "
+    "each to the cpus of its node, and have idle workers steal work from their "
+    "own node before any other.";
+const char* const additional_constraints_event_engine_numa_aware_stealing =
+    "{}";
 const char* const description_event_engine_secure_endpoint =
     "Use EventEngine secure endpoint wrapper instead of iomgr when available";
 const char* const additional_constraints_event_engine_secure_endpoint = "{}";
+const char* const description_event_engine_timer_wheel =
+    "Keep the posix EventEngine's timers in hierarchical timing wheels, with "
+    "constant time insertion and cancellation, instead of sharded heaps.";
+const char* const additional_constraints_event_engine_timer_wheel = "{}";
+const char* const description_event_engine_worker_affinity =
+    "Give every EventEngine endpoint a home worker thread, picked from the CPU "
+    "that received its connection (SO_INCOMING_CPU), and run its I/O callbacks "
+    "there. Other workers only steal that work when they are idle.";
+const char* const additional_constraints_event_engine_worker_affinity = "{}";
 const char* const description_free_large_allocator =
     "If set, return all free bytes from a \042big\042 allocator";
 const char* const additional_constraints_free_large_allocator = "{}";
+const char* const description_fused_filter_stacks =
+    "Replace runs of common v3 filters (message size, http and compression) "
+    "with a single filter fused at compile time, so that each call step makes "
+    "one statically dispatched call for the whole run.";
+const char* const additional_constraints_fused_filter_stacks = "{}";
+const char* const description_hpack_encoder_prefix_cache =
+    "Cache the encoded request headers that are the same on every call of a "
+    "method, and replay them while the HPACK dynamic table is unchanged.";
+const char* const additional_constraints_hpack_encoder_prefix_cache = "{}";
+const char* const description_hpack_shared_values =
+    "Keep header values added to HPACK dynamic tables in a process-wide pool, "
+    "so that connections receiving the same value share a single copy of it.";
+const char* const additional_constraints_hpack_shared_values = "{}";
+const char* const description_huge_page_slab_allocator =
+    "Serve read buffers, memory allocator slices and call arenas from per-cpu "
+    "slabs backed by 2MB huge pages, to cut TLB misses on the data path.";
+const char* const additional_constraints_huge_page_slab_allocator = "{}";
 const char* const description_keep_alive_ping_timer_batch =
     "Avoid explicitly cancelling the keepalive timer. Instead adjust the "
     "callback to re-schedule itself to the next ping interval.";
 const char* const additional_constraints_keep_alive_ping_timer_batch = "{}";
+const char* const description_lazy_deadline_timers =
+    "Only arm a call's deadline timer once its deadline is close, from a "
+    "coarse periodic sweep, so that calls that finish quickly never arm or "
+    "cancel a timer.";
+const char* const additional_constraints_lazy_deadline_timers = "{}";
 const char* const description_local_connector_secure =
     "Local security connector uses TSI_SECURITY_NONE for LOCAL_TCP "
     "connections.";
 const char* const additional_constraints_local_connector_secure = "{}";
+const char* const description_lock_free_work_serializer =
+    "Queue WorkSerializer callbacks on a lock free queue, and run several of "
+    "them per EventEngine callback, bounded by a drain budget.";
+const char* const additional_constraints_lock_free_work_serializer = "{}";
 const char* const description_max_inflight_pings_strict_limit =
     "If set, the max inflight pings limit is strictly enforced.";
 const char* const additional_constraints_max_inflight_pings_strict_limit = "{}";
@@ -663,6 +1219,15 @@ const char* const additional_constraints_monitoring_experiment = "{}";
 const char* const description_multiping =
     "Allow more than one ping to be in flight at a time by default.";
 const char* const additional_constraints_multiping = "{}";
+const char* const description_party_arena_participants =
+    "Allocate party participants from the party's arena, reusing the memory of "
+    "completed participants, instead of allocating each one on the heap.";
+const char* const additional_constraints_party_arena_participants = "{}";
+const char* const description_per_cpu_memory_quota =
+    "Keep small per-cpu reserves of memory quota, so that allocators refilling "
+    "and returning memory mostly avoid contending on the quota's shared free "
+    "bytes counter.";
+const char* const additional_constraints_per_cpu_memory_quota = "{}";
 const char* const description_pollset_alternative =
     "Code outside iomgr that relies directly on pollsets will use non-pollset "
     "alternatives when enabled.";
@@ -691,6 +1256,10 @@ const char* const description_promise_based_inproc_transport =
 const char* const additional_constraints_promise_based_inproc_transport = "{}";
 const char* const description_retry_in_callv3 = "Support retries with call-v3";
 const char* const additional_constraints_retry_in_callv3 = "{}";
+const char* const description_rls_lock_free_picks =
+    "RLS pickers serve cache hits from immutable, sharded snapshots of the "
+    "cache instead of taking the policy's lock on every pick.";
+const char* const additional_constraints_rls_lock_free_picks = "{}";
 const char* const description_rq_fast_reject =
     "Resource quota rejects requests immediately (before allocating the "
     "request structure) under very high memory pressure.";
@@ -719,6 +1288,12 @@ const uint8_t required_experiments_secure_endpoint_offload_large_writes[] = {
     static_cast<uint8_t>(grpc_core::kExperimentIdEventEngineClient),
     static_cast<uint8_t>(grpc_core::kExperimentIdEventEngineListener),
     static_cast<uint8_t>(grpc_core::kExperimentIdEventEngineSecureEndpoint)};
+const char* const description_security_handshake_offload =
+    "Run TSI handshake steps on the EventEngine, a bounded number at a time, "
+    "instead of on the thread that read the handshake bytes, so that the "
+    "crypto of new connections does not delay the data path of established "
+    "ones.";
+const char* const additional_constraints_security_handshake_offload = "{}";
 const char* const description_server_global_callbacks_ownership =
     "If set, server global callbacks ownership is fixed to not be owned by "
     "gRPC.";
@@ -727,9 +1302,21 @@ const char* const additional_constraints_server_global_callbacks_ownership =
 const char* const description_shard_global_connection_pool =
     "If set, shard the global connection pool to improve parallelism.";
 const char* const additional_constraints_shard_global_connection_pool = "{}";
+const char* const description_sharded_lb_picker =
+    "Keep a copy of the client channel's LB picker per CPU shard, so that "
+    "picks do not take the channel's LB mutex or a ref to the picker.";
+const char* const additional_constraints_sharded_lb_picker = "{}";
+const char* const description_shared_service_configs =
+    "If set, channels that receive the same service config JSON share a single "
+    "parsed service config instead of each parsing it.";
+const char* const additional_constraints_shared_service_configs = "{}";
 const char* const description_sleep_promise_exec_ctx_removal =
     "If set, polling the sleep promise does not rely on the ExecCtx.";
 const char* const additional_constraints_sleep_promise_exec_ctx_removal = "{}";
+const char* const description_small_slice_inlining =
+    "Store copied slices that fit in a grpc_slice inline instead of allocating "
+    "a refcount for them, and grow slice buffer slice arrays geometrically.";
+const char* const additional_constraints_small_slice_inlining = "{}";
 const char* const description_tcp_frame_size_tuning =
     "If set, enables TCP to use RPC size estimation made by higher layers. TCP "
     "would not indicate completion of a read operation until a specified "
@@ -739,6 +1326,29 @@ const char* const additional_constraints_tcp_frame_size_tuning = "{}";
 const char* const description_tcp_rcv_lowat =
     "Use SO_RCVLOWAT to avoid wakeups on the read path.";
 const char* const additional_constraints_tcp_rcv_lowat = "{}";
+const char* const description_tcp_read_buffer_pool =
+    "Recycle TCP read buffers through a pool shared by the endpoints of a "
+    "poller instead of allocating fresh slices for every read.";
+const char* const additional_constraints_tcp_read_buffer_pool = "{}";
+const char* const description_tcp_tx_zerocopy_adaptive =
+    "Let the pool of TCP TX zerocopy send records grow while the socket is not "
+    "short of optmem, and raise the zerocopy size threshold of connections on "
+    "which the kernel reports that zerocopy sends were copied anyway.";
+const char* const additional_constraints_tcp_tx_zerocopy_adaptive = "{}";
+const char* const description_tls_verified_chain_cache =
+    "Have TLS handshaker factories remember the chains built for recently "
+    "verified peer certificates, and skip building and verifying the chain "
+    "again when a peer presents the same certificates.";
+const char* const additional_constraints_tls_verified_chain_cache = "{}";
+const char* const description_token_fetcher_proactive_refresh =
+    "Refresh tokens fetched by token fetcher call credentials in the "
+    "background ahead of their expiration while calls keep using them, instead "
+    "of waiting for a call to find the token about to expire.";
+const char* const additional_constraints_token_fetcher_proactive_refresh = "{}";
+const char* const description_token_fetcher_shared_cache =
+    "Share tokens between token fetcher call credentials objects that fetch "
+    "tokens for the same principal through a process-wide cache.";
+const char* const additional_constraints_token_fetcher_shared_cache = "{}";
 const char* const description_tsi_frame_protector_without_locks =
     "Do not hold locks while using the tsi_frame_protector.";
 const char* const additional_constraints_tsi_frame_protector_without_locks =
@@ -747,22 +1357,57 @@ const char* const description_unconstrained_max_quota_buffer_size =
     "Discard the cap on the max free pool size for one memory allocator";
 const char* const additional_constraints_unconstrained_max_quota_buffer_size =
     "{}";
+const char* const description_xds_skip_unchanged_resources =
+    "In XdsClient, skip decoding a resource whose serialized bytes are the "
+    "same as the ones last accepted for it.";
+const char* const additional_constraints_xds_skip_unchanged_resources = "{}";
+const char* const description_zlib_stream_reuse =
+    "Keep a deflate and an inflate z_stream per thread and reset them between "
+    "messages instead of setting up and tearing down a stream per message.";
+const char* const additional_constraints_zlib_stream_reuse = "{}";
 }  // namespace
 
 namespace grpc_core {
 
 const ExperimentMetadata g_experiment_metadata[] = {
+    {"alts_handshaker_channel_pool", description_alts_handshaker_channel_pool,
+     additional_constraints_alts_handshaker_channel_pool, nullptr, 0, false,
+     true},
+    {"bdp_estimate_from_tcp_info", description_bdp_estimate_from_tcp_info,
+     additional_constraints_bdp_estimate_from_tcp_info, nullptr, 0, false,
+     true},
+    {"call_arena_recycling", description_call_arena_recycling,
+     additional_constraints_call_arena_recycling, nullptr, 0, false, true},
     {"call_tracer_in_transport", description_call_tracer_in_transport,
      additional_constraints_call_tracer_in_transport, nullptr, 0, true, false},
     {"callv3_client_auth_filter", description_callv3_client_auth_filter,
      additional_constraints_callv3_client_auth_filter, nullptr, 0, false, true},
+    {"chaotic_good_adaptive_data_endpoints",
+     description_chaotic_good_adaptive_data_endpoints,
+     additional_constraints_chaotic_good_adaptive_data_endpoints, nullptr, 0,
+     false, true},
     {"chaotic_good_framing_layer", description_chaotic_good_framing_layer,
      additional_constraints_chaotic_good_framing_layer, nullptr, 0, true,
      false},
+    {"chaotic_good_shared_memory", description_chaotic_good_shared_memory,
+     additional_constraints_chaotic_good_shared_memory, nullptr, 0, false,
+     false},
     {"chttp2_bound_write_size", description_chttp2_bound_write_size,
      additional_constraints_chttp2_bound_write_size, nullptr, 0, false, true},
+    {"chttp2_coalesce_small_write_slices",
+     description_chttp2_coalesce_small_write_slices,
+     additional_constraints_chttp2_coalesce_small_write_slices, nullptr, 0,
+     false, true},
+    {"chttp2_weighted_write_scheduling",
+     description_chttp2_weighted_write_scheduling,
+     additional_constraints_chttp2_weighted_write_scheduling, nullptr, 0, false,
+     true},
     {"error_flatten", description_error_flatten,
      additional_constraints_error_flatten, nullptr, 0, false, false},
+    {"event_engine_adaptive_spinning",
+     description_event_engine_adaptive_spinning,
+     additional_constraints_event_engine_adaptive_spinning, nullptr, 0, false,
+     true},
     {"event_engine_client", description_event_engine_client,
      additional_constraints_event_engine_client, nullptr, 0, true, false},
     {"event_engine_dns", description_event_engine_dns,
@@ -773,6 +1418,8 @@ const ExperimentMetadata g_experiment_metadata[] = {
      true, false},
     {"event_engine_fork", description_event_engine_fork,
      additional_constraints_event_engine_fork, nullptr, 0, false, false},
+    {"event_engine_hot_spinners", description_event_engine_hot_spinners,
+     additional_constraints_event_engine_hot_spinners, nullptr, 0, false, true},
     {"event_engine_listener", description_event_engine_listener,
      additional_constraints_event_engine_listener, nullptr, 0, true, false},
     {"event_engine_callback_cq", description_event_engine_callback_cq,
@@ -782,16 +1429,38 @@ const ExperimentMetadata g_experiment_metadata[] = {
      description_event_engine_for_all_other_endpoints,
      additional_constraints_event_engine_for_all_other_endpoints,
      required_experiments_event_engine_for_all_other_endpoints, 4, true, false},
+    {"event_engine_numa_aware_stealing",
+     description_event_engine_numa_aware_stealing,
+     additional_constraints_event_engine_numa_aware_stealing, nullptr, 0, false,
+     true},
     {"event_engine_secure_endpoint", description_event_engine_secure_endpoint,
      additional_constraints_event_engine_secure_endpoint, nullptr, 0, true,
      false},
+    {"event_engine_timer_wheel", description_event_engine_timer_wheel,
+     additional_constraints_event_engine_timer_wheel, nullptr, 0, false, true},
+    {"event_engine_worker_affinity", description_event_engine_worker_affinity,
+     additional_constraints_event_engine_worker_affinity, nullptr, 0, false,
+     true},
     {"free_large_allocator", description_free_large_allocator,
      additional_constraints_free_large_allocator, nullptr, 0, false, true},
+    {"fused_filter_stacks", description_fused_filter_stacks,
+     additional_constraints_fused_filter_stacks, nullptr, 0, false, true},
+    {"hpack_encoder_prefix_cache", description_hpack_encoder_prefix_cache,
+     additional_constraints_hpack_encoder_prefix_cache, nullptr, 0, false,
+     true},
+    {"hpack_shared_values", description_hpack_shared_values,
+     additional_constraints_hpack_shared_values, nullptr, 0, false, true},
+    {"huge_page_slab_allocator", description_huge_page_slab_allocator,
+     additional_constraints_huge_page_slab_allocator, nullptr, 0, false, true},
     {"keep_alive_ping_timer_batch", description_keep_alive_ping_timer_batch,
      additional_constraints_keep_alive_ping_timer_batch, nullptr, 0, false,
      true},
+    {"lazy_deadline_timers", description_lazy_deadline_timers,
+     additional_constraints_lazy_deadline_timers, nullptr, 0, false, false},
     {"local_connector_secure", description_local_connector_secure,
      additional_constraints_local_connector_secure, nullptr, 0, false, true},
+    {"lock_free_work_serializer", description_lock_free_work_serializer,
+     additional_constraints_lock_free_work_serializer, nullptr, 0, false, true},
     {"max_inflight_pings_strict_limit",
      description_max_inflight_pings_strict_limit,
      additional_constraints_max_inflight_pings_strict_limit, nullptr, 0, true,
@@ -802,6 +1471,10 @@ const ExperimentMetadata g_experiment_metadata[] = {
      additional_constraints_monitoring_experiment, nullptr, 0, true, true},
     {"multiping", description_multiping, additional_constraints_multiping,
      nullptr, 0, false, true},
+    {"party_arena_participants", description_party_arena_participants,
+     additional_constraints_party_arena_participants, nullptr, 0, false, true},
+    {"per_cpu_memory_quota", description_per_cpu_memory_quota,
+     additional_constraints_per_cpu_memory_quota, nullptr, 0, false, true},
     {"pollset_alternative", description_pollset_alternative,
      additional_constraints_pollset_alternative,
      required_experiments_pollset_alternative, 2, false, false},
@@ -821,6 +1494,8 @@ const ExperimentMetadata g_experiment_metadata[] = {
      false},
     {"retry_in_callv3", description_retry_in_callv3,
      additional_constraints_retry_in_callv3, nullptr, 0, false, true},
+    {"rls_lock_free_picks", description_rls_lock_free_picks,
+     additional_constraints_rls_lock_free_picks, nullptr, 0, false, true},
     {"rq_fast_reject", description_rq_fast_reject,
      additional_constraints_rq_fast_reject, nullptr, 0, false, true},
     {"rst_stream_fix", description_rst_stream_fix,
@@ -837,6 +1512,9 @@ const ExperimentMetadata g_experiment_metadata[] = {
      description_secure_endpoint_offload_large_writes,
      additional_constraints_secure_endpoint_offload_large_writes,
      required_experiments_secure_endpoint_offload_large_writes, 3, false, true},
+    {"security_handshake_offload", description_security_handshake_offload,
+     additional_constraints_security_handshake_offload, nullptr, 0, false,
+     true},
     {"server_global_callbacks_ownership",
      description_server_global_callbacks_ownership,
      additional_constraints_server_global_callbacks_ownership, nullptr, 0,
@@ -844,14 +1522,33 @@ const ExperimentMetadata g_experiment_metadata[] = {
     {"shard_global_connection_pool", description_shard_global_connection_pool,
      additional_constraints_shard_global_connection_pool, nullptr, 0, true,
      true},
+    {"sharded_lb_picker", description_sharded_lb_picker,
+     additional_constraints_sharded_lb_picker, nullptr, 0, false, true},
+    {"shared_service_configs", description_shared_service_configs,
+     additional_constraints_shared_service_configs, nullptr, 0, false, true},
     {"sleep_promise_exec_ctx_removal",
      description_sleep_promise_exec_ctx_removal,
      additional_constraints_sleep_promise_exec_ctx_removal, nullptr, 0, false,
      true},
+    {"small_slice_inlining", description_small_slice_inlining,
+     additional_constraints_small_slice_inlining, nullptr, 0, false, true},
     {"tcp_frame_size_tuning", description_tcp_frame_size_tuning,
      additional_constraints_tcp_frame_size_tuning, nullptr, 0, false, true},
     {"tcp_rcv_lowat", description_tcp_rcv_lowat,
      additional_constraints_tcp_rcv_lowat, nullptr, 0, false, true},
+    {"tcp_read_buffer_pool", description_tcp_read_buffer_pool,
+     additional_constraints_tcp_read_buffer_pool, nullptr, 0, false, true},
+    {"tcp_tx_zerocopy_adaptive", description_tcp_tx_zerocopy_adaptive,
+     additional_constraints_tcp_tx_zerocopy_adaptive, nullptr, 0, false, true},
+    {"tls_verified_chain_cache", description_tls_verified_chain_cache,
+     additional_constraints_tls_verified_chain_cache, nullptr, 0, false, true},
+    {"token_fetcher_proactive_refresh",
+     description_token_fetcher_proactive_refresh,
+     additional_constraints_token_fetcher_proactive_refresh, nullptr, 0, false,
+     true},
+    {"token_fetcher_shared_cache", description_token_fetcher_shared_cache,
+     additional_constraints_token_fetcher_shared_cache, nullptr, 0, false,
+     true},
     {"tsi_frame_protector_without_locks",
      description_tsi_frame_protector_without_locks,
      additional_constraints_tsi_frame_protector_without_locks, nullptr, 0,
@@ -860,6 +1557,11 @@ const ExperimentMetadata g_experiment_metadata[] = {
      description_unconstrained_max_quota_buffer_size,
      additional_constraints_unconstrained_max_quota_buffer_size, nullptr, 0,
      false, true},
+    {"xds_skip_unchanged_resources", description_xds_skip_unchanged_resources,
+     additional_constraints_xds_skip_unchanged_resources, nullptr, 0, false,
+     true},
+    {"zlib_stream_reuse", description_zlib_stream_reuse,
+     additional_constraints_zlib_stream_reuse, nullptr, 0, false, true},
 };
 
 }  // namespace grpc_core
@@ -57,13 +57,21 @@ namespace grpc_core {
 #ifdef GRPC_EXPERIMENTS_ARE_FINAL
 
 #if defined(GRPC_CFSTREAM)
+inline bool IsAltsHandshakerChannelPoolEnabled() { return false; }
+inline bool IsBdpEstimateFromTcpInfoEnabled() { return false; }
+inline bool IsCallArenaRecyclingEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_CALL_TRACER_IN_TRANSPORT
 inline bool IsCallTracerInTransportEnabled() { return true; }
 inline bool IsCallv3ClientAuthFilterEnabled() { return false; }
+inline bool IsChaoticGoodAdaptiveDataEndpointsEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_CHAOTIC_GOOD_FRAMING_LAYER
 inline bool IsChaoticGoodFramingLayerEnabled() { return true; }
+inline bool IsChaoticGoodSharedMemoryEnabled() { return false; }
 inline bool IsChttp2BoundWriteSizeEnabled() { return false; }
+inline bool IsChttp2CoalesceSmallWriteSlicesEnabled() { return false; }
+inline bool IsChttp2WeightedWriteSchedulingEnabled() { return false; }
 inline bool IsErrorFlattenEnabled() { return false; }
+inline bool IsEventEngineAdaptiveSpinningEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_CLIENT
 inline bool IsEventEngineClientEnabled() { return true; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_DNS
@@ -71,17 +79,27 @@ inline bool IsEventEngineDnsEnabled() { return true; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_DNS_NON_CLIENT_CHANNEL
 inline bool IsEventEngineDnsNonClientChannelEnabled() { return true; }
 inline bool IsEventEngineForkEnabled() { return false; }
+inline bool IsEventEngineHotSpinnersEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_LISTENER
 inline bool IsEventEngineListenerEnabled() { return true; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_CALLBACK_CQ
 inline bool IsEventEngineCallbackCqEnabled() { return true; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_FOR_ALL_OTHER_ENDPOINTS
 inline bool IsEventEngineForAllOtherEndpointsEnabled() { return true; }
+inline bool IsEventEngineNumaAwareStealingEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_SECURE_ENDPOINT
 inline bool IsEventEngineSecureEndpointEnabled() { return true; }
+inline bool IsEventEngineTimerWheelEnabled() { return false; }
+inline bool IsEventEngineWorkerAffinityEnabled() { return false; }
 inline bool IsFreeLargeAllocatorEnabled() { return false; }
+inline bool IsFusedFilterStacksEnabled() { return false; }
+inline bool IsHpackEncoderPrefixCacheEnabled() { return false; }
+inline bool IsHpackSharedValuesEnabled() { return false; }
+inline bool IsHugePageSlabAllocatorEnabled() { return false; }
 inline bool IsKeepAlivePingTimerBatchEnabled() { return false; }
+inline bool IsLazyDeadlineTimersEnabled() { return false; }
 inline bool IsLocalConnectorSecureEnabled() { return false; }
+inline bool IsLockFreeWorkSerializerEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_MAX_INFLIGHT_PINGS_STRICT_LIMIT
 inline bool IsMaxInflightPingsStrictLimitEnabled() { return true; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_MAX_PINGS_WO_DATA_THROTTLE
@@ -89,6 +107,8 @@ inline bool IsMaxPingsWoDataThrottleEnabled() { return true; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_MONITORING_EXPERIMENT
 inline bool IsMonitoringExperimentEnabled() { return true; }
 inline bool IsMultipingEnabled() { return false; }
+inline bool IsPartyArenaParticipantsEnabled() { return false; }
+inline bool IsPerCpuMemoryQuotaEnabled() { return false; }
 inline bool IsPollsetAlternativeEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_POSIX_EE_SKIP_GRPC_INIT
 inline bool IsPosixEeSkipGrpcInitEnabled() { return true; }
@@ -96,29 +116,49 @@ inline bool IsPromiseBasedHttp2ClientTransportEnabled() { return false; }
 inline bool IsPromiseBasedHttp2ServerTransportEnabled() { return false; }
 inline bool IsPromiseBasedInprocTransportEnabled() { return false; }
 inline bool IsRetryInCallv3Enabled() { return false; }
+inline bool IsRlsLockFreePicksEnabled() { return false; }
 inline bool IsRqFastRejectEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_RST_STREAM_FIX
 inline bool IsRstStreamFixEnabled() { return true; }
 inline bool IsScheduleCancellationOverWriteEnabled() { return false; }
 inline bool IsSecureEndpointOffloadLargeReadsEnabled() { return false; }
 inline bool IsSecureEndpointOffloadLargeWritesEnabled() { return false; }
+inline bool IsSecurityHandshakeOffloadEnabled() { return false; }
 inline bool IsServerGlobalCallbacksOwnershipEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_SHARD_GLOBAL_CONNECTION_POOL
 inline bool IsShardGlobalConnectionPoolEnabled() { return true; }
+inline bool IsShardedLbPickerEnabled() { return false; }
+inline bool IsSharedServiceConfigsEnabled() { return false; }
 inline bool IsSleepPromiseExecCtxRemovalEnabled() { return false; }
+inline bool IsSmallSliceInliningEnabled() { return false; }
 inline bool IsTcpFrameSizeTuningEnabled() { return false; }
 inline bool IsTcpRcvLowatEnabled() { return false; }
+inline bool IsTcpReadBufferPoolEnabled() { return false; }
+inline bool IsTcpTxZerocopyAdaptiveEnabled() { return false; }
+inline bool IsTlsVerifiedChainCacheEnabled() { return false; }
+inline bool IsTokenFetcherProactiveRefreshEnabled() { return false; }
+inline bool IsTokenFetcherSharedCacheEnabled() { return false; }
 inline bool IsTsiFrameProtectorWithoutLocksEnabled() { return false; }
 inline bool IsUnconstrainedMaxQuotaBufferSizeEnabled() { return false; }
+inline bool IsXdsSkipUnchangedResourcesEnabled() { return false; }
+inline bool IsZlibStreamReuseEnabled() { return false; }
 
 #elif defined(GPR_WINDOWS)
+inline bool IsAltsHandshakerChannelPoolEnabled() { return false; }
+inline bool IsBdpEstimateFromTcpInfoEnabled() { return false; }
+inline bool IsCallArenaRecyclingEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_CALL_TRACER_IN_TRANSPORT
 inline bool IsCallTracerInTransportEnabled() { return true; }
 inline bool IsCallv3ClientAuthFilterEnabled() { return false; }
+inline bool IsChaoticGoodAdaptiveDataEndpointsEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_CHAOTIC_GOOD_FRAMING_LAYER
 inline bool IsChaoticGoodFramingLayerEnabled() { return true; }
+inline bool IsChaoticGoodSharedMemoryEnabled() { return false; }
 inline bool IsChttp2BoundWriteSizeEnabled() { return false; }
+inline bool IsChttp2CoalesceSmallWriteSlicesEnabled() { return false; }
+inline bool IsChttp2WeightedWriteSchedulingEnabled() { return false; }
 inline bool IsErrorFlattenEnabled() { return false; }
+inline bool IsEventEngineAdaptiveSpinningEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_CLIENT
 inline bool IsEventEngineClientEnabled() { return true; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_DNS
@@ -126,17 +166,27 @@ inline bool IsEventEngineDnsEnabled() { return true; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_DNS_NON_CLIENT_CHANNEL
 inline bool IsEventEngineDnsNonClientChannelEnabled() { return true; }
 inline bool IsEventEngineForkEnabled() { return false; }
+inline bool IsEventEngineHotSpinnersEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_LISTENER
 inline bool IsEventEngineListenerEnabled() { return true; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_CALLBACK_CQ
 inline bool IsEventEngineCallbackCqEnabled() { return true; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_FOR_ALL_OTHER_ENDPOINTS
 inline bool IsEventEngineForAllOtherEndpointsEnabled() { return true; }
+inline bool IsEventEngineNumaAwareStealingEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_SECURE_ENDPOINT
 inline bool IsEventEngineSecureEndpointEnabled() { return true; }
+inline bool IsEventEngineTimerWheelEnabled() { return false; }
+inline bool IsEventEngineWorkerAffinityEnabled() { return false; }
 inline bool IsFreeLargeAllocatorEnabled() { return false; }
+inline bool IsFusedFilterStacksEnabled() { return false; }
+inline bool IsHpackEncoderPrefixCacheEnabled() { return false; }
+inline bool IsHpackSharedValuesEnabled() { return false; }
+inline bool IsHugePageSlabAllocatorEnabled() { return false; }
 inline bool IsKeepAlivePingTimerBatchEnabled() { return false; }
+inline bool IsLazyDeadlineTimersEnabled() { return false; }
 inline bool IsLocalConnectorSecureEnabled() { return false; }
+inline bool IsLockFreeWorkSerializerEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_MAX_INFLIGHT_PINGS_STRICT_LIMIT
 inline bool IsMaxInflightPingsStrictLimitEnabled() { return true; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_MAX_PINGS_WO_DATA_THROTTLE
@@ -144,6 +194,8 @@ inline bool IsMaxPingsWoDataThrottleEnabled() { return true; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_MONITORING_EXPERIMENT
 inline bool IsMonitoringExperimentEnabled() { return true; }
 inline bool IsMultipingEnabled() { return false; }
+inline bool IsPartyArenaParticipantsEnabled() { return false; }
+inline bool IsPerCpuMemoryQuotaEnabled() { return false; }
 inline bool IsPollsetAlternativeEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_POSIX_EE_SKIP_GRPC_INIT
 inline bool IsPosixEeSkipGrpcInitEnabled() { return true; }
@@ -151,29 +203,49 @@ inline bool IsPromiseBasedHttp2ClientTransportEnabled() { return false; }
 inline bool IsPromiseBasedHttp2ServerTransportEnabled() { return false; }
 inline bool IsPromiseBasedInprocTransportEnabled() { return false; }
 inline bool IsRetryInCallv3Enabled() { return false; }
+inline bool IsRlsLockFreePicksEnabled() { return false; }
 inline bool IsRqFastRejectEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_RST_STREAM_FIX
 inline bool IsRstStreamFixEnabled() { return true; }
 inline bool IsScheduleCancellationOverWriteEnabled() { return false; }
 inline bool IsSecureEndpointOffloadLargeReadsEnabled() { return false; }
 inline bool IsSecureEndpointOffloadLargeWritesEnabled() { return false; }
+inline bool IsSecurityHandshakeOffloadEnabled() { return false; }
 inline bool IsServerGlobalCallbacksOwnershipEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_SHARD_GLOBAL_CONNECTION_POOL
 inline bool IsShardGlobalConnectionPoolEnabled() { return true; }
+inline bool IsShardedLbPickerEnabled() { return false; }
+inline bool IsSharedServiceConfigsEnabled() { return false; }
 inline bool IsSleepPromiseExecCtxRemovalEnabled() { return false; }
+inline bool IsSmallSliceInliningEnabled() { return false; }
 inline bool IsTcpFrameSizeTuningEnabled() { return false; }
 inline bool IsTcpRcvLowatEnabled() { return false; }
+inline bool IsTcpReadBufferPoolEnabled() { return false; }
+inline bool IsTcpTxZerocopyAdaptiveEnabled() { return false; }
+inline bool IsTlsVerifiedChainCacheEnabled() { return false; }
+inline bool IsTokenFetcherProactiveRefreshEnabled() { return false; }
+inline bool IsTokenFetcherSharedCacheEnabled() { return false; }
 inline bool IsTsiFrameProtectorWithoutLocksEnabled() { return false; }
 inline bool IsUnconstrainedMaxQuotaBufferSizeEnabled() { return false; }
+inline bool IsXdsSkipUnchangedResourcesEnabled() { return false; }
+inline bool IsZlibStreamReuseEnabled() { return false; }
 
 #else
+inline bool IsAltsHandshakerChannelPoolEnabled() { return false; }
+inline bool IsBdpEstimateFromTcpInfoEnabled() { return false; }
+inline bool IsCallArenaRecyclingEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_CALL_TRACER_IN_TRANSPORT
 inline bool IsCallTracerInTransportEnabled() { return true; }
 inline bool IsCallv3ClientAuthFilterEnabled() { return false; }
+inline bool IsChaoticGoodAdaptiveDataEndpointsEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_CHAOTIC_GOOD_FRAMING_LAYER
 inline bool IsChaoticGoodFramingLayerEnabled() { return true; }
+inline bool IsChaoticGoodSharedMemoryEnabled() { return false; }
 inline bool IsChttp2BoundWriteSizeEnabled() { return false; }
+inline bool IsChttp2CoalesceSmallWriteSlicesEnabled() { return false; }
+inline bool IsChttp2WeightedWriteSchedulingEnabled() { return false; }
 inline bool IsErrorFlattenEnabled() { return false; }
+inline bool IsEventEngineAdaptiveSpinningEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_CLIENT
 inline bool IsEventEngineClientEnabled() { return true; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_DNS
@@ -181,17 +253,27 @@ inline bool IsEventEngineDnsEnabled() { return true; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_DNS_NON_CLIENT_CHANNEL
 inline bool IsEventEngineDnsNonClientChannelEnabled() { return true; }
 inline bool IsEventEngineForkEnabled() { return false; }
+inline bool IsEventEngineHotSpinnersEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_LISTENER
 inline bool IsEventEngineListenerEnabled() { return true; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_CALLBACK_CQ
 inline bool IsEventEngineCallbackCqEnabled() { return true; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_FOR_ALL_OTHER_ENDPOINTS
 inline bool IsEventEngineForAllOtherEndpointsEnabled() { return true; }
+inline bool IsEventEngineNumaAwareStealingEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_SECURE_ENDPOINT
 inline bool IsEventEngineSecureEndpointEnabled() { return true; }
+inline bool IsEventEngineTimerWheelEnabled() { return false; }
+inline bool IsEventEngineWorkerAffinityEnabled() { return false; }
 inline bool IsFreeLargeAllocatorEnabled() { return false; }
+inline bool IsFusedFilterStacksEnabled() { return false; }
+inline bool IsHpackEncoderPrefixCacheEnabled() { return false; }
+inline bool IsHpackSharedValuesEnabled() { return false; }
+inline bool IsHugePageSlabAllocatorEnabled() { return false; }
 inline bool IsKeepAlivePingTimerBatchEnabled() { return false; }
+inline bool IsLazyDeadlineTimersEnabled() { return false; }
 inline bool IsLocalConnectorSecureEnabled() { return false; }
+inline bool IsLockFreeWorkSerializerEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_MAX_INFLIGHT_PINGS_STRICT_LIMIT
 inline bool IsMaxInflightPingsStrictLimitEnabled() { return true; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_MAX_PINGS_WO_DATA_THROTTLE
@@ -199,6 +281,8 @@ inline bool IsMaxPingsWoDataThrottleEnabled() { return true; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_MONITORING_EXPERIMENT
 inline bool IsMonitoringExperimentEnabled() { return true; }
 inline bool IsMultipingEnabled() { return false; }
+inline bool IsPartyArenaParticipantsEnabled() { return false; }
+inline bool IsPerCpuMemoryQuotaEnabled() { return false; }
 inline bool IsPollsetAlternativeEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_POSIX_EE_SKIP_GRPC_INIT
 inline bool IsPosixEeSkipGrpcInitEnabled() { return true; }
@@ -206,64 +290,120 @@ inline bool IsPromiseBasedHttp2ClientTransportEnabled() { return false; }
 inline bool IsPromiseBasedHttp2ServerTransportEnabled() { return false; }
 inline bool IsPromiseBasedInprocTransportEnabled() { return false; }
 inline bool IsRetryInCallv3Enabled() { return false; }
+inline bool IsRlsLockFreePicksEnabled() { return false; }
 inline bool IsRqFastRejectEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_RST_STREAM_FIX
 inline bool IsRstStreamFixEnabled() { return true; }
 inline bool IsScheduleCancellationOverWriteEnabled() { return false; }
 inline bool IsSecureEndpointOffloadLargeReadsEnabled() { return false; }
 inline bool IsSecureEndpointOffloadLargeWritesEnabled() { return false; }
+inline bool IsSecurityHandshakeOffloadEnabled() { return false; }
 inline bool IsServerGlobalCallbacksOwnershipEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_SHARD_GLOBAL_CONNECTION_POOL
 inline bool IsShardGlobalConnectionPoolEnabled() { return true; }
+inline bool IsShardedLbPickerEnabled() { return false; }
+inline bool IsSharedServiceConfigsEnabled() { return false; }
 inline bool IsSleepPromiseExecCtxRemovalEnabled() { return false; }
+inline bool IsSmallSliceInliningEnabled() { return false; }
 inline bool IsTcpFrameSizeTuningEnabled() { return false; }
 inline bool IsTcpRcvLowatEnabled() { return false; }
+inline bool IsTcpReadBufferPoolEnabled() { return false; }
+inline bool IsTcpTxZerocopyAdaptiveEnabled() { return false; }
+inline bool IsTlsVerifiedChainCacheEnabled() { return false; }
+inline bool IsTokenFetcherProactiveRefreshEnabled() { return false; }
+inline bool IsTokenFetcherSharedCacheEnabled() { return false; }
 inline bool IsTsiFrameProtectorWithoutLocksEnabled() { return false; }
 inline bool IsUnconstrainedMaxQuotaBufferSizeEnabled() { return false; }
+inline bool IsXdsSkipUnchangedResourcesEnabled() { return false; }
+inline bool IsZlibStreamReuseEnabled() { return false; }
 #endif
 
 #else
 enum ExperimentIds {
+  kExperimentIdAltsHandshakerChannelPool,
+  kExperimentIdBdpEstimateFromTcpInfo,
+  kExperimentIdCallArenaRecycling,
   kExperimentIdCallTracerInTransport,
   kExperimentIdCallv3ClientAuthFilter,
+  kExperimentIdChaoticGoodAdaptiveDataEndpoints,
   kExperimentIdChaoticGoodFramingLayer,
+  kExperimentIdChaoticGoodSharedMemory,
   kExperimentIdChttp2BoundWriteSize,
+  kExperimentIdChttp2CoalesceSmallWriteSlices,
+  kExperimentIdChttp2WeightedWriteScheduling,
   kExperimentIdErrorFlatten,
+  kExperimentIdEventEngineAdaptiveSpinning,
   kExperimentIdEventEngineClient,
   kExperimentIdEventEngineDns,
   kExperimentIdEventEngineDnsNonClientChannel,
   kExperimentIdEventEngineFork,
+  kExperimentIdEventEngineHotSpinners,
   kExperimentIdEventEngineListener,
   kExperimentIdEventEngineCallbackCq,
   kExperimentIdEventEngineForAllOtherEndpoints,
+  kExperimentIdEventEngineNumaAwareStealing,
   kExperimentIdEventEngineSecureEndpoint,
+  kExperimentIdEventEngineTimerWheel,
+  kExperimentIdEventEngineWorkerAffinity,
   kExperimentIdFreeLargeAllocator,
+  kExperimentIdFusedFilterStacks,
+  kExperimentIdHpackEncoderPrefixCache,
+  kExperimentIdHpackSharedValues,
+  kExperimentIdHugePageSlabAllocator,
   kExperimentIdKeepAlivePingTimerBatch,
+  kExperimentIdLazyDeadlineTimers,
   kExperimentIdLocalConnectorSecure,
+  kExperimentIdLockFreeWorkSerializer,
   kExperimentIdMaxInflightPingsStrictLimit,
   kExperimentIdMaxPingsWoDataThrottle,
   kExperimentIdMonitoringExperiment,
   kExperimentIdMultiping,
+  kExperimentIdPartyArenaParticipants,
+  kExperimentIdPerCpuMemoryQuota,
   kExperimentIdPollsetAlternative,
   kExperimentIdPosixEeSkipGrpcInit,
   kExperimentIdPromiseBasedHttp2ClientTransport,
   kExperimentIdPromiseBasedHttp2ServerTransport,
   kExperimentIdPromiseBasedInprocTransport,
   kExperimentIdRetryInCallv3,
+  kExperimentIdRlsLockFreePicks,
   kExperimentIdRqFastReject,
   kExperimentIdRstStreamFix,
   kExperimentIdScheduleCancellationOverWrite,
   kExperimentIdSecureEndpointOffloadLargeReads,
   kExperimentIdSecureEndpointOffloadLargeWrites,
+  kExperimentIdSecurityHandshakeOffload,
   kExperimentIdServerGlobalCallbacksOwnership,
   kExperimentIdShardGlobalConnectionPool,
+  kExperimentIdShardedLbPicker,
+  kExperimentIdSharedServiceConfigs,
   kExperimentIdSleepPromiseExecCtxRemoval,
+  kExperimentIdSmallSliceInlining,
   kExperimentIdTcpFrameSizeTuning,
   kExperimentIdTcpRcvLowat,
+  kExperimentIdTcpReadBufferPool,
+  kExperimentIdTcpTxZerocopyAdaptive,
+  kExperimentIdTlsVerifiedChainCache,
+  kExperimentIdTokenFetcherProactiveRefresh,
+  kExperimentIdTokenFetcherSharedCache,
   kExperimentIdTsiFrameProtectorWithoutLocks,
   kExperimentIdUnconstrainedMaxQuotaBufferSize,
+  kExperimentIdXdsSkipUnchangedResources,
+  kExperimentIdZlibStreamReuse,
   kNumExperiments
 };
+#define GRPC_EXPERIMENT_IS_INCLUDED_ALTS_HANDSHAKER_CHANNEL_POOL
+inline bool IsAltsHandshakerChannelPoolEnabled() {
+  return IsExperimentEnabled<kExperimentIdAltsHandshakerChannelPool>();
+}
+#define GRPC_EXPERIMENT_IS_INCLUDED_BDP_ESTIMATE_FROM_TCP_INFO
+inline bool IsBdpEstimateFromTcpInfoEnabled() {
+  return IsExperimentEnabled<kExperimentIdBdpEstimateFromTcpInfo>();
+}
+#define GRPC_EXPERIMENT_IS_INCLUDED_CALL_ARENA_RECYCLING
+inline bool IsCallArenaRecyclingEnabled() {
+  return IsExperimentEnabled<kExperimentIdCallArenaRecycling>();
+}
 #define GRPC_EXPERIMENT_IS_INCLUDED_CALL_TRACER_IN_TRANSPORT
 inline bool IsCallTracerInTransportEnabled() {
   return IsExperimentEnabled<kExperimentIdCallTracerInTransport>();
@@ -272,18 +412,38 @@ inline bool IsCallTracerInTransportEnabled() {
 inline bool IsCallv3ClientAuthFilterEnabled() {
   return IsExperimentEnabled<kExperimentIdCallv3ClientAuthFilter>();
 }
+#define GRPC_EXPERIMENT_IS_INCLUDED_CHAOTIC_GOOD_ADAPTIVE_DATA_ENDPOINTS
+inline bool IsChaoticGoodAdaptiveDataEndpointsEnabled() {
+  return IsExperimentEnabled<kExperimentIdChaoticGoodAdaptiveDataEndpoints>();
+}
 #define GRPC_EXPERIMENT_IS_INCLUDED_CHAOTIC_GOOD_FRAMING_LAYER
 inline bool IsChaoticGoodFramingLayerEnabled() {
   return IsExperimentEnabled<kExperimentIdChaoticGoodFramingLayer>();
 }
+#define GRPC_EXPERIMENT_IS_INCLUDED_CHAOTIC_GOOD_SHARED_MEMORY
+inline bool IsChaoticGoodSharedMemoryEnabled() {
+  return IsExperimentEnabled<kExperimentIdChaoticGoodSharedMemory>();
+}
 #define GRPC_EXPERIMENT_IS_INCLUDED_CHTTP2_BOUND_WRITE_SIZE
 inline bool IsChttp2BoundWriteSizeEnabled() {
   return IsExperimentEnabled<kExperimentIdChttp2BoundWriteSize>();
 }
+#define GRPC_EXPERIMENT_IS_INCLUDED_CHTTP2_COALESCE_SMALL_WRITE_SLICES
+inline bool IsChttp2CoalesceSmallWriteSlicesEnabled() {
+  return IsExperimentEnabled<kExperimentIdChttp2CoalesceSmallWriteSlices>();
+}
+#define GRPC_EXPERIMENT_IS_INCLUDED_CHTTP2_WEIGHTED_WRITE_SCHEDULING
+inline bool IsChttp2WeightedWriteSchedulingEnabled() {
+  return IsExperimentEnabled<kExperimentIdChttp2WeightedWriteScheduling>();
+}
 #define GRPC_EXPERIMENT_IS_INCLUDED_ERROR_FLATTEN
 inline bool IsErrorFlattenEnabled() {
   return IsExperimentEnabled<kExperimentIdErrorFlatten>();
 }
+#define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_ADAPTIVE_SPINNING
+inline bool IsEventEngineAdaptiveSpinningEnabled() {
+  return IsExperimentEnabled<kExperimentIdEventEngineAdaptiveSpinning>();
+}
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_CLIENT
 inline bool IsEventEngineClientEnabled() {
   return IsExperimentEnabled<kExperimentIdEventEngineClient>();
@@ -300,6 +460,10 @@ inline bool IsEventEngineDnsNonClientChannelEnabled() {
 inline bool IsEventEngineForkEnabled() {
   return IsExperimentEnabled<kExperimentIdEventEngineFork>();
 }
+#define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_HOT_SPINNERS
+inline bool IsEventEngineHotSpinnersEnabled() {
+  return IsExperimentEnabled<kExperimentIdEventEngineHotSpinners>();
+}
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_LISTENER
 inline bool IsEventEngineListenerEnabled() {
   return IsExperimentEnabled<kExperimentIdEventEngineListener>();
@@ -312,22 +476,58 @@ inline bool IsEventEngineCallbackCqEnabled() {
 inline bool IsEventEngineForAllOtherEndpointsEnabled() {
   return IsExperimentEnabled<kExperimentIdEventEngineForAllOtherEndpoints>();
 }
+#define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_NUMA_AWARE_STEALING
+inline bool IsEventEngineNumaAwareStealingEnabled() {
+  return IsExperimentEnabled<kExperimentIdEventEngineNumaAwareStealing>();
+}
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_SECURE_ENDPOINT
 inline bool IsEventEngineSecureEndpointEnabled() {
   return IsExperimentEnabled<kExperimentIdEventEngineSecureEndpoint>();
 }
+#define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_TIMER_WHEEL
+inline bool IsEventEngineTimerWheelEnabled() {
+  return IsExperimentEnabled<kExperimentIdEventEngineTimerWheel>();
+}
+#define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_WORKER_AFFINITY
+inline bool IsEventEngineWorkerAffinityEnabled() {
+  return IsExperimentEnabled<kExperimentIdEventEngineWorkerAffinity>();
+}
 #define GRPC_EXPERIMENT_IS_INCLUDED_FREE_LARGE_ALLOCATOR
 inline bool IsFreeLargeAllocatorEnabled() {
   return IsExperimentEnabled<kExperimentIdFreeLargeAllocator>();
 }
+#define GRPC_EXPERIMENT_IS_INCLUDED_FUSED_FILTER_STACKS
+inline bool IsFusedFilterStacksEnabled() {
+  return IsExperimentEnabled<kExperimentIdFusedFilterStacks>();
+}
+#define GRPC_EXPERIMENT_IS_INCLUDED_HPACK_ENCODER_PREFIX_CACHE
+inline bool IsHpackEncoderPrefixCacheEnabled() {
+  return IsExperimentEnabled<kExperimentIdHpackEncoderPrefixCache>();
+}
+#define GRPC_EXPERIMENT_IS_INCLUDED_HPACK_SHARED_VALUES
+inline bool IsHpackSharedValuesEnabled() {
+  return IsExperimentEnabled<kExperimentIdHpackSharedValues>();
+}
+#define GRPC_EXPERIMENT_IS_INCLUDED_HUGE_PAGE_SLAB_ALLOCATOR
+inline bool IsHugePageSlabAllocatorEnabled() {
+  return IsExperimentEnabled<kExperimentIdHugePageSlabAllocator>();
+}
 #define GRPC_EXPERIMENT_IS_INCLUDED_KEEP_ALIVE_PING_TIMER_BATCH
 inline bool IsKeepAlivePingTimerBatchEnabled() {
   return IsExperimentEnabled<kExperimentIdKeepAlivePingTimerBatch>();
 }
+#define GRPC_EXPERIMENT_IS_INCLUDED_LAZY_DEADLINE_TIMERS
+inline bool IsLazyDeadlineTimersEnabled() {
+  return IsExperimentEnabled<kExperimentIdLazyDeadlineTimers>();
+}
 #define GRPC_EXPERIMENT_IS_INCLUDED_LOCAL_CONNECTOR_SECURE
 inline bool IsLocalConnectorSecureEnabled() {
   return IsExperimentEnabled<kExperimentIdLocalConnectorSecure>();
 }
+#define GRPC_EXPERIMENT_IS_INCLUDED_LOCK_FREE_WORK_SERIALIZER
+inline bool IsLockFreeWorkSerializerEnabled() {
+  return IsExperimentEnabled<kExperimentIdLockFreeWorkSerializer>();
+}
 #define GRPC_EXPERIMENT_IS_INCLUDED_MAX_INFLIGHT_PINGS_STRICT_LIMIT
 inline bool IsMaxInflightPingsStrictLimitEnabled() {
   return IsExperimentEnabled<kExperimentIdMaxInflightPingsStrictLimit>();
@@ -344,6 +544,14 @@ inline bool IsMonitoringExperimentEnabled() {
 inline bool IsMultipingEnabled() {
   return IsExperimentEnabled<kExperimentIdMultiping>();
 }
+#define GRPC_EXPERIMENT_IS_INCLUDED_PARTY_ARENA_PARTICIPANTS
+inline bool IsPartyArenaParticipantsEnabled() {
+  return IsExperimentEnabled<kExperimentIdPartyArenaParticipants>();
+}
+#define GRPC_EXPERIMENT_IS_INCLUDED_PER_CPU_MEMORY_QUOTA
+inline bool IsPerCpuMemoryQuotaEnabled() {
+  return IsExperimentEnabled<kExperimentIdPerCpuMemoryQuota>();
+}
 #define GRPC_EXPERIMENT_IS_INCLUDED_POLLSET_ALTERNATIVE
 inline bool IsPollsetAlternativeEnabled() {
   return IsExperimentEnabled<kExperimentIdPollsetAlternative>();
@@ -368,6 +576,10 @@ inline bool IsPromiseBasedInprocTransportEnabled() {
 inline bool IsRetryInCallv3Enabled() {
   return IsExperimentEnabled<kExperimentIdRetryInCallv3>();
 }
+#define GRPC_EXPERIMENT_IS_INCLUDED_RLS_LOCK_FREE_PICKS
+inline bool IsRlsLockFreePicksEnabled() {
+  return IsExperimentEnabled<kExperimentIdRlsLockFreePicks>();
+}
 #define GRPC_EXPERIMENT_IS_INCLUDED_RQ_FAST_REJECT
 inline bool IsRqFastRejectEnabled() {
   return IsExperimentEnabled<kExperimentIdRqFastReject>();
@@ -388,6 +600,10 @@ inline bool IsSecureEndpointOffloadLargeReadsEnabled() {
 inline bool IsSecureEndpointOffloadLargeWritesEnabled() {
   return IsExperimentEnabled<kExperimentIdSecureEndpointOffloadLargeWrites>();
 }
+#define GRPC_EXPERIMENT_IS_INCLUDED_SECURITY_HANDSHAKE_OFFLOAD
+inline bool IsSecurityHandshakeOffloadEnabled() {
+  return IsExperimentEnabled<kExperimentIdSecurityHandshakeOffload>();
+}
 #define GRPC_EXPERIMENT_IS_INCLUDED_SERVER_GLOBAL_CALLBACKS_OWNERSHIP
 inline bool IsServerGlobalCallbacksOwnershipEnabled() {
   return IsExperimentEnabled<kExperimentIdServerGlobalCallbacksOwnership>();
@@ -396,10 +612,22 @@ inline bool IsServerGlobalCallbacksOwnershipEnabled() {
 inline bool IsShardGlobalConnectionPoolEnabled() {
   return IsExperimentEnabled<kExperimentIdShardGlobalConnectionPool>();
 }
+#define GRPC_EXPERIMENT_IS_INCLUDED_SHARDED_LB_PICKER
+inline bool IsShardedLbPickerEnabled() {
+  return IsExperimentEnabled<kExperimentIdShardedLbPicker>();
+}
+#define GRPC_EXPERIMENT_IS_INCLUDED_SHARED_SERVICE_CONFIGS
+inline bool IsSharedServiceConfigsEnabled() {
+  return IsExperimentEnabled<kExperimentIdSharedServiceConfigs>();
+}
 #define GRPC_EXPERIMENT_IS_INCLUDED_SLEEP_PROMISE_EXEC_CTX_REMOVAL
 inline bool IsSleepPromiseExecCtxRemovalEnabled() {
   return IsExperimentEnabled<kExperimentIdSleepPromiseExecCtxRemoval>();
 }
+#define GRPC_EXPERIMENT_IS_INCLUDED_SMALL_SLICE_INLINING
+inline bool IsSmallSliceInliningEnabled() {
+  return IsExperimentEnabled<kExperimentIdSmallSliceInlining>();
+}
 #define GRPC_EXPERIMENT_IS_INCLUDED_TCP_FRAME_SIZE_TUNING
 inline bool IsTcpFrameSizeTuningEnabled() {
   return IsExperimentEnabled<kExperimentIdTcpFrameSizeTuning>();
@@ -408,6 +636,26 @@ inline bool IsTcpFrameSizeTuningEnabled() {
 inline bool IsTcpRcvLowatEnabled() {
   return IsExperimentEnabled<kExperimentIdTcpRcvLowat>();
 }
+#define GRPC_EXPERIMENT_IS_INCLUDED_TCP_READ_BUFFER_POOL
+inline bool IsTcpReadBufferPoolEnabled() {
+  return IsExperimentEnabled<kExperimentIdTcpReadBufferPool>();
+}
+#define GRPC_EXPERIMENT_IS_INCLUDED_TCP_TX_ZEROCOPY_ADAPTIVE
+inline bool IsTcpTxZerocopyAdaptiveEnabled() {
+  return IsExperimentEnabled<kExperimentIdTcpTxZerocopyAdaptive>();
+}
+#define GRPC_EXPERIMENT_IS_INCLUDED_TLS_VERIFIED_CHAIN_CACHE
+inline bool IsTlsVerifiedChainCacheEnabled() {
+  return IsExperimentEnabled<kExperimentIdTlsVerifiedChainCache>();
+}
+#define GRPC_EXPERIMENT_IS_INCLUDED_TOKEN_FETCHER_PROACTIVE_REFRESH
+inline bool IsTokenFetcherProactiveRefreshEnabled() {
+  return IsExperimentEnabled<kExperimentIdTokenFetcherProactiveRefresh>();
+}
+#define GRPC_EXPERIMENT_IS_INCLUDED_TOKEN_FETCHER_SHARED_CACHE
+inline bool IsTokenFetcherSharedCacheEnabled() {
+  return IsExperimentEnabled<kExperimentIdTokenFetcherSharedCache>();
+}
 #define GRPC_EXPERIMENT_IS_INCLUDED_TSI_FRAME_PROTECTOR_WITHOUT_LOCKS
 inline bool IsTsiFrameProtectorWithoutLocksEnabled() {
   return IsExperimentEnabled<kExperimentIdTsiFrameProtectorWithoutLocks>();
@@ -416,6 +664,14 @@ inline bool IsTsiFrameProtectorWithoutLocksEnabled() {
 inline bool IsUnconstrainedMaxQuotaBufferSizeEnabled() {
   return IsExperimentEnabled<kExperimentIdUnconstrainedMaxQuotaBufferSize>();
 }
+#define GRPC_EXPERIMENT_IS_INCLUDED_XDS_SKIP_UNCHANGED_RESOURCES
+inline bool IsXdsSkipUnchangedResourcesEnabled() {
+  return IsExperimentEnabled<kExperimentIdXdsSkipUnchangedResources>();
+}
+#define GRPC_EXPERIMENT_IS_INCLUDED_ZLIB_STREAM_REUSE
+inline bool IsZlibStreamReuseEnabled() {
+  return IsExperimentEnabled<kExperimentIdZlibStreamReuse>();
+}
 
 extern const ExperimentMetadata g_experiment_metadata[kNumExperiments];
 
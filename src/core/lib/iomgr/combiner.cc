@@ -28,6 +28,8 @@
 #include "absl/log/log.h"
 #include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/iomgr/iomgr_internal.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
 #include "src/core/util/crash.h"
 #include "src/core/util/mpscq.h"
 
@@ -158,6 +160,7 @@ static void queue_offload(grpc_core::Combiner* lock) {
   // that we don't immediately offload again.
   gpr_atm_no_barrier_store(&lock->initiating_exec_ctx_or_null, 1);
   GRPC_TRACE_LOG(combiner, INFO) << "C:" << lock << " queue_offload";
+  grpc_core::global_stats().IncrementCombinerOffloads();
   lock->event_engine->Run([lock] {
     grpc_core::ExecCtx exec_ctx(0);
     push_last_on_exec_ctx(lock);
@@ -214,6 +217,7 @@ bool grpc_combiner_continue_exec_ctx() {
     grpc_error_handle cl_err =
         grpc_core::internal::StatusMoveFromHeapPtr(cl->error_data.error);
     cl->error_data.error = 0;
+    grpc_core::global_stats().IncrementCombinerClosuresRun();
     cl->cb(cl->cb_arg, std::move(cl_err));
   } else {
     grpc_closure* c = lock->final_list.head;
@@ -230,6 +234,7 @@ bool grpc_combiner_continue_exec_ctx() {
       grpc_error_handle error =
           grpc_core::internal::StatusMoveFromHeapPtr(c->error_data.error);
       c->error_data.error = 0;
+      grpc_core::global_stats().IncrementCombinerClosuresRun();
       c->cb(c->cb_arg, std::move(error));
       c = next;
     }
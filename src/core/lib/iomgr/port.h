@@ -85,6 +85,9 @@
 #if __GLIBC_PREREQ(2, 10)
 #define GRPC_LINUX_SOCKETUTILS 1
 #endif
+#if __GLIBC_PREREQ(2, 27)
+#define GRPC_LINUX_MEMFD 1
+#endif
 #if !(__GLIBC_PREREQ(2, 18))
 //
 // TCP_USER_TIMEOUT wasn't imported to glibc until 2.18. Use Linux system
@@ -99,6 +102,16 @@
 #define GRPC_LINUX_EVENTFD 1
 #define GRPC_MSG_IOVLEN_TYPE int
 #endif
+// The io_uring poller is only compiled when the kernel UAPI header is
+// available. Whether the running kernel supports it is checked at runtime.
+#if defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#define GRPC_LINUX_IO_URING 1
+#endif
+#if __has_include(<linux/tls.h>)
+#define GRPC_LINUX_KTLS 1
+#endif
+#endif
 #ifndef GRPC_LINUX_EVENTFD
 #define GRPC_POSIX_NO_SPECIAL_WAKEUP_FD 1
 #endif
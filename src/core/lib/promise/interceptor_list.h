@@ -83,7 +83,8 @@ class InterceptorList {
   // The result of Run: a promise that will execute the entire chain.
   class RunPromise {
    public:
-    RunPromise(size_t memory_required, Map** factory, std::optional<T> value) {
+    RunPromise(InterceptorList* list, std::optional<T> value) {
+      Map** factory = &list->first_map_;
       if (!value.has_value() || *factory == nullptr) {
         GRPC_TRACE_VLOG(promise_primitives, 2)
             << "InterceptorList::RunPromise[" << this << "]: create immediate";
@@ -91,14 +92,13 @@ class InterceptorList {
         Construct(&result_, std::move(value));
       } else {
         is_immediately_resolved_ = false;
-        Construct(&async_resolution_, memory_required);
-        (*factory)->MakePromise(std::move(*value),
-                                async_resolution_.space.get());
+        Construct(&async_resolution_, list);
+        (*factory)->MakePromise(std::move(*value), async_resolution_.space);
         async_resolution_.current_factory = *factory;
         async_resolution_.first_factory = factory;
         GRPC_TRACE_VLOG(promise_primitives, 2)
             << "InterceptorList::RunPromise[" << this
-            << "]: create async; mem=" << async_resolution_.space.get();
+            << "]: create async; mem=" << async_resolution_.space;
       }
     }
 
@@ -109,8 +109,7 @@ class InterceptorList {
         Destruct(&result_);
       } else {
         if (async_resolution_.current_factory != nullptr) {
-          async_resolution_.current_factory->Destroy(
-              async_resolution_.space.get());
+          async_resolution_.current_factory->Destroy(async_resolution_.space);
         }
         Destruct(&async_resolution_);
       }
@@ -143,10 +142,9 @@ class InterceptorList {
           return std::nullopt;
         }
         auto r = async_resolution_.current_factory->PollOnce(
-            async_resolution_.space.get());
+            async_resolution_.space);
         if (auto* p = r.value_if_ready()) {
-          async_resolution_.current_factory->Destroy(
-              async_resolution_.space.get());
+          async_resolution_.current_factory->Destroy(async_resolution_.space);
           async_resolution_.current_factory =
               async_resolution_.current_factory->next();
           if (!p->has_value()) async_resolution_.current_factory = nullptr;
@@ -157,7 +155,7 @@ class InterceptorList {
             return std::move(*p);
           }
           async_resolution_.current_factory->MakePromise(
-              std::move(**p), async_resolution_.space.get());
+              std::move(**p), async_resolution_.space);
           continue;
         }
         return Pending{};
@@ -180,17 +178,24 @@ class InterceptorList {
       }
     }
     struct AsyncResolution {
-      explicit AsyncResolution(size_t max_size)
-          : space(GetContext<Arena>()->MakePooledArray<char>(max_size)) {}
+      explicit AsyncResolution(InterceptorList* list)
+          : list(list), space(list->TakePromiseMemory(&space_size)) {}
+      ~AsyncResolution() {
+        if (space != nullptr) list->ReturnPromiseMemory(space, space_size);
+      }
       AsyncResolution(const AsyncResolution&) = delete;
       AsyncResolution& operator=(const AsyncResolution&) = delete;
       AsyncResolution(AsyncResolution&& other) noexcept
           : current_factory(std::exchange(other.current_factory, nullptr)),
             first_factory(std::exchange(other.first_factory, nullptr)),
-            space(std::move(other.space)) {}
+            list(other.list),
+            space_size(other.space_size),
+            space(std::exchange(other.space, nullptr)) {}
       Map* current_factory;
       Map** first_factory;
-      Arena::PoolPtr<char[]> space;
+      InterceptorList* list;
+      size_t space_size;
+      void* space;
     };
     union {
       AsyncResolution async_resolution_;
@@ -208,8 +213,7 @@ class InterceptorList {
   ~InterceptorList() { DeleteFactories(); }
 
   RunPromise Run(std::optional<T> initial_value) {
-    return RunPromise(promise_memory_required_, &first_map_,
-                      std::move(initial_value));
+    return RunPromise(this, std::move(initial_value));
   }
 
   // Append a new map to the end of the chain.
@@ -245,6 +249,7 @@ class InterceptorList {
     first_map_ = nullptr;
     last_map_ = nullptr;
     promise_memory_required_ = 0;
+    spare_promise_memory_ = nullptr;
   }
 
  private:
@@ -301,6 +306,30 @@ class InterceptorList {
     }
   }
 
+  // Memory for the promises of one run of the chain: the memory left by the
+  // last run if it is still big enough, else a fresh arena allocation.
+  // Reusing it means that running the chain once per message allocates only
+  // on the first message.
+  void* TakePromiseMemory(size_t* size) {
+    if (spare_promise_memory_ != nullptr &&
+        spare_promise_memory_size_ >= promise_memory_required_) {
+      *size = spare_promise_memory_size_;
+      return std::exchange(spare_promise_memory_, nullptr);
+    }
+    *size = promise_memory_required_;
+    return GetContext<Arena>()->Alloc(promise_memory_required_);
+  }
+
+  // Hand back memory from TakePromiseMemory() once its run is done. Whatever
+  // is not kept for the next run stays with the arena.
+  void ReturnPromiseMemory(void* memory, size_t size) {
+    if (spare_promise_memory_ == nullptr ||
+        size > spare_promise_memory_size_) {
+      spare_promise_memory_ = memory;
+      spare_promise_memory_size_ = size;
+    }
+  }
+
   void DeleteFactories() {
     for (auto* f = first_map_; f != nullptr;) {
       auto* next = f->next();
@@ -315,6 +344,10 @@ class InterceptorList {
   Map* last_map_ = nullptr;
   // The amount of memory required to store the largest promise in the chain.
   size_t promise_memory_required_ = 0;
+  // Promise memory not in use by any run, of spare_promise_memory_size_
+  // bytes.
+  void* spare_promise_memory_ = nullptr;
+  size_t spare_promise_memory_size_ = 0;
 };
 
 }  // namespace grpc_core
@@ -25,8 +25,10 @@
 #include "absl/log/log.h"
 #include "absl/strings/str_format.h"
 #include "src/core/lib/event_engine/event_engine_context.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/promise/activity.h"
+#include "src/core/util/alloc.h"
 #include "src/core/util/json/json_writer.h"
 #include "src/core/util/latent_see.h"
 #include "src/core/util/sync.h"
@@ -367,6 +369,9 @@ void Party::RunLockedAndUnref(Party* party, uint64_t prev_state) {
 }
 
 void Party::RunPartyAndUnref(uint64_t prev_state) {
+  // The length of this scope is the length of one run of the party; the
+  // Party::PollParticipant scopes within it are the wakeups it handled.
+  GRPC_LATENT_SEE_INNER_SCOPE("Party::RunPartyAndUnref");
   ScopedActivity activity(this);
   promise_detail::Context<Arena> arena_ctx(arena_.get());
   DCHECK_EQ(prev_state & kLocked, 0u)
@@ -401,6 +406,7 @@ void Party::RunPartyAndUnref(uint64_t prev_state) {
         GRPC_TRACE_LOG(promise_primitives, INFO)
             << "Party " << this << "                 Run:Wakeup " << i;
         // Poll the participant.
+        GRPC_LATENT_SEE_INNER_SCOPE("Party::PollParticipant");
         currently_polling_ = i;
         if (participant->PollParticipantPromise()) {
           participants_[i].store(nullptr, std::memory_order_relaxed);
@@ -433,12 +439,11 @@ void Party::RunPartyAndUnref(uint64_t prev_state) {
       }
       return;
     }
-    // CAS out (but retrieve) any allocations and wakeups that occurred during
-    // the run.
-    while (!state_.compare_exchange_weak(
-        prev_state, prev_state & (kRefMask | kLocked | keep_allocated_mask))) {
-      // Nothing to do here.
-    }
+    // Clear out (but retrieve) any allocations and wakeups that occurred
+    // during the run: all of them are handled in one more pass.
+    prev_state = state_.fetch_and(kRefMask | kLocked | keep_allocated_mask,
+                                  std::memory_order_acq_rel);
+    GRPC_LATENT_SEE_MARK("Party::RunPartyAndUnref:batched_wakeups");
     LogStateChange("Run:Continue", prev_state,
                    prev_state & (kRefMask | kLocked | keep_allocated_mask));
     DCHECK(prev_state & kLocked)
@@ -486,6 +491,58 @@ uint64_t Party::NextAllocationMask(uint64_t current_allocation_mask) {
 }
 #endif
 
+void* Party::AllocParticipant(size_t size) {
+  if (!IsPartyArenaParticipantsEnabled()) return ::operator new(size);
+  size = GPR_ROUND_UP_TO_ALIGNMENT_SIZE(size);
+  if (free_participants_.load(std::memory_order_relaxed) != nullptr) {
+    // Take the whole list so that no other thread can unlink the block we
+    // pick, then put back the rest.
+    FreeBlock* block =
+        free_participants_.exchange(nullptr, std::memory_order_acquire);
+    FreeBlock* found = nullptr;
+    FreeBlock* rest_first = nullptr;
+    FreeBlock* rest_last = nullptr;
+    while (block != nullptr) {
+      FreeBlock* next = block->next;
+      if (found == nullptr && block->size == size) {
+        found = block;
+      } else {
+        block->next = nullptr;
+        if (rest_last == nullptr) {
+          rest_first = block;
+        } else {
+          rest_last->next = block;
+        }
+        rest_last = block;
+      }
+      block = next;
+    }
+    if (rest_first != nullptr) PushFreeBlocks(rest_first, rest_last);
+    if (found != nullptr) return found;
+  }
+  return arena_->Alloc(size);
+}
+
+void Party::FreeParticipant(void* p, size_t size) {
+  if (!IsPartyArenaParticipantsEnabled()) {
+    ::operator delete(p, size);
+    return;
+  }
+  Party* party = GetContext<Party>();
+  DCHECK(party != nullptr);
+  auto* block =
+      new (p) FreeBlock{nullptr, GPR_ROUND_UP_TO_ALIGNMENT_SIZE(size)};
+  party->PushFreeBlocks(block, block);
+}
+
+void Party::PushFreeBlocks(FreeBlock* first, FreeBlock* last) {
+  FreeBlock* head = free_participants_.load(std::memory_order_relaxed);
+  do {
+    last->next = head;
+  } while (!free_participants_.compare_exchange_weak(
+      head, first, std::memory_order_release, std::memory_order_relaxed));
+}
+
 size_t Party::AddParticipant(Participant* participant) {
   GRPC_LATENT_SEE_INNER_SCOPE("Party::AddParticipant");
   uint64_t state = state_.load(std::memory_order_acquire);
@@ -279,8 +279,10 @@ class Party : public Activity, private Wakeable {
     template <class Factory>
     void Spawn(Factory factory) {
       auto empty_completion = [](Empty) {};
-      next_.Push(new ParticipantImpl<Factory, decltype(empty_completion)>(
-          "SpawnSerializer", std::move(factory), empty_completion));
+      next_.Push(
+          party_->NewParticipant<
+              ParticipantImpl<Factory, decltype(empty_completion)>>(
+              "SpawnSerializer", std::move(factory), empty_completion));
       party_->WakeupFromState<false>(
           party_->state_.load(std::memory_order_relaxed), wakeup_mask_);
     }
@@ -438,7 +440,7 @@ class Party : public Activity, private Wakeable {
       auto p = promise_();
       if (auto* r = p.value_if_ready()) {
         on_complete_(std::move(*r));
-        delete this;
+        DeleteParticipant(this);
         return true;
       }
       return false;
@@ -457,7 +459,7 @@ class Party : public Activity, private Wakeable {
       return obj;
     }
 
-    void Destroy() override { delete this; }
+    void Destroy() override { DeleteParticipant(this); }
 
    private:
     union {
@@ -664,6 +666,34 @@ class Party : public Activity, private Wakeable {
   void WakeupAsync(WakeupMask wakeup_mask) final;
   void Drop(WakeupMask wakeup_mask) final;
 
+  // Memory for participants. With the party_arena_participants experiment,
+  // participants are carved out of the party's arena, next to the call state
+  // they work on, rather than each being a separate heap allocation. Memory of
+  // completed participants goes onto a free list, and is reused by later
+  // spawns of the same size - so long lived parties that keep spawning (one
+  // participant per message, say) do not grow their arena without bound.
+  // The free list only ever has single entries or whole lists pushed, or is
+  // emptied with an exchange, so it is safe to use from any thread.
+  struct FreeBlock {
+    FreeBlock* next;
+    size_t size;
+  };
+  void* AllocParticipant(size_t size);
+  // Must be called from the party's own promises (with it as the current
+  // activity), which is where participants complete or are destroyed.
+  static void FreeParticipant(void* p, size_t size);
+  void PushFreeBlocks(FreeBlock* first, FreeBlock* last);
+
+  template <typename T, typename... Args>
+  T* NewParticipant(Args&&... args) {
+    return new (AllocParticipant(sizeof(T))) T(std::forward<Args>(args)...);
+  }
+  template <typename T>
+  static void DeleteParticipant(T* p) {
+    p->~T();
+    FreeParticipant(p, sizeof(T));
+  }
+
   // Add a participant (backs Spawn, after type erasure to ParticipantFactory).
   size_t AddParticipant(Participant* participant);
   void MaybeAsyncAddParticipant(Participant* participant);
@@ -691,10 +721,11 @@ class Party : public Activity, private Wakeable {
   // If the lower bit is unset, then this is a Participant*.
   // If the lower bit is set, then this is a ParticipantFactory*.
   std::atomic<Participant*> participants_[party_detail::kMaxParticipants] = {};
+  std::atomic<FreeBlock*> free_participants_{nullptr};
   RefCountedPtr<Arena> arena_;
 };
 
-GRPC_CHECK_CLASS_SIZE(Party, 180);
+GRPC_CHECK_CLASS_SIZE(Party, 188);
 
 template <>
 struct ContextSubclass<Party> {
@@ -705,7 +736,7 @@ template <typename Factory, typename OnComplete>
 void Party::Spawn(absl::string_view name, Factory promise_factory,
                   OnComplete on_complete) {
   GRPC_TRACE_LOG(party_state, INFO) << "PARTY[" << this << "]: spawn " << name;
-  MaybeAsyncAddParticipant(new ParticipantImpl<Factory, OnComplete>(
+  MaybeAsyncAddParticipant(NewParticipant<ParticipantImpl<Factory, OnComplete>>(
       name, std::move(promise_factory), std::move(on_complete)));
 }
 
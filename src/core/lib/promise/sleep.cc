@@ -17,13 +17,22 @@
 #include <grpc/event_engine/event_engine.h>
 #include <grpc/support/port_platform.h>
 
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <memory>
 #include <utility>
 
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/container/inlined_vector.h"
 #include "src/core/lib/event_engine/event_engine_context.h"  // IWYU pragma: keep
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/promise/activity.h"
 #include "src/core/lib/promise/context.h"
 #include "src/core/lib/promise/poll.h"
+#include "src/core/util/per_cpu.h"
+#include "src/core/util/sync.h"
 #include "src/core/util/time.h"
 
 namespace grpc_core {
@@ -90,4 +99,138 @@ bool Sleep::ActiveClosure::HasRun() const {
   return refs_.load(std::memory_order_acquire) == 1;
 }
 
+namespace {
+
+struct CoarseTimerShard;
+
+// The coarse sleeps of one shard that wake at one rounded time, and the
+// timer that wakes them.
+struct CoarseTimerBucket {
+  using Key = std::pair<EventEngine*, int64_t>;
+
+  CoarseTimerShard* const shard;
+  const Key key;
+  const std::shared_ptr<EventEngine> event_engine;
+  EventEngine::TaskHandle timer_handle;
+  CoarseSleep::Waiter* waiters = nullptr;
+};
+
+struct alignas(GPR_CACHELINE_SIZE) CoarseTimerShard {
+  Mutex mu;
+  absl::flat_hash_map<CoarseTimerBucket::Key, CoarseTimerBucket*> buckets
+      ABSL_GUARDED_BY(mu);
+};
+
+PerCpu<CoarseTimerShard>& CoarseTimerShards() {
+  static auto* shards = new PerCpu<CoarseTimerShard>(
+      PerCpuOptions().SetCpusPerShard(1).SetMaxShards(16));
+  return *shards;
+}
+
+}  // namespace
+
+struct CoarseSleep::Waiter {
+  Waker waker;
+  CoarseTimerShard* shard = nullptr;
+  // The bucket this waiter is linked into, and its neighbours there, guarded
+  // by shard->mu. bucket is null once the timer has fired.
+  CoarseTimerBucket* bucket = nullptr;
+  Waiter* prev = nullptr;
+  Waiter* next = nullptr;
+  std::atomic<bool> fired{false};
+};
+
+namespace {
+
+void FireCoarseTimerBucket(CoarseTimerBucket* bucket) {
+  ExecCtx exec_ctx;
+  absl::InlinedVector<Waker, 8> wakers;
+  {
+    MutexLock lock(&bucket->shard->mu);
+    bucket->shard->buckets.erase(bucket->key);
+    for (CoarseSleep::Waiter* waiter = bucket->waiters; waiter != nullptr;
+         waiter = waiter->next) {
+      waiter->bucket = nullptr;
+      wakers.push_back(std::move(waiter->waker));
+      waiter->fired.store(true, std::memory_order_release);
+    }
+  }
+  for (Waker& waker : wakers) waker.Wakeup();
+  delete bucket;
+}
+
+}  // namespace
+
+CoarseSleep::~CoarseSleep() {
+  if (waiter_ == nullptr) return;
+  CoarseTimerBucket* cancelled_bucket = nullptr;
+  {
+    MutexLock lock(&waiter_->shard->mu);
+    CoarseTimerBucket* bucket = waiter_->bucket;
+    if (bucket != nullptr) {
+      if (waiter_->prev != nullptr) {
+        waiter_->prev->next = waiter_->next;
+      } else {
+        bucket->waiters = waiter_->next;
+      }
+      if (waiter_->next != nullptr) waiter_->next->prev = waiter_->prev;
+      // The last sleep of a bucket cancels its timer, so that no timer is
+      // left behind on an EventEngine that might be shutting down.
+      if (bucket->waiters == nullptr &&
+          bucket->event_engine->Cancel(bucket->timer_handle)) {
+        bucket->shard->buckets.erase(bucket->key);
+        cancelled_bucket = bucket;
+      }
+    }
+  }
+  delete waiter_;
+  delete cancelled_bucket;
+}
+
+Poll<absl::Status> CoarseSleep::operator()() {
+  if (!IsSleepPromiseExecCtxRemovalEnabled()) {
+    // Invalidate now so that we see a fresh version of the time.
+    ExecCtx::Get()->InvalidateNow();
+  }
+  if (deadline_ <= Timestamp::Now()) return absl::OkStatus();
+  if (deadline_ == Timestamp::InfFuture()) return Pending{};
+  if (waiter_ == nullptr) Arm();
+  if (waiter_->fired.load(std::memory_order_acquire)) return absl::OkStatus();
+  return Pending{};
+}
+
+void CoarseSleep::Arm() {
+  // Round the deadline up, so that the sleep never ends early.
+  const int64_t granularity = std::max<int64_t>(1, granularity_.millis());
+  int64_t wake_millis =
+      static_cast<int64_t>(deadline_.milliseconds_after_process_epoch());
+  const int64_t remainder = wake_millis % granularity;
+  if (remainder != 0 && wake_millis <= std::numeric_limits<int64_t>::max() -
+                                           (granularity - remainder)) {
+    wake_millis += granularity - remainder;
+  }
+  EventEngine* event_engine = GetContext<EventEngine>();
+  waiter_ = new Waiter();
+  waiter_->waker = GetContext<Activity>()->MakeOwningWaker();
+  CoarseTimerShard* shard = &CoarseTimerShards().this_cpu();
+  waiter_->shard = shard;
+  MutexLock lock(&shard->mu);
+  const CoarseTimerBucket::Key key(event_engine, wake_millis);
+  CoarseTimerBucket*& bucket = shard->buckets[key];
+  if (bucket == nullptr) {
+    bucket = new CoarseTimerBucket{shard, key,
+                                   event_engine->shared_from_this(), {}};
+    // The wake time is after now, so the timer cannot run before the bucket
+    // is set up.
+    bucket->timer_handle = event_engine->RunAfter(
+        Timestamp::FromMillisecondsAfterProcessEpoch(wake_millis) -
+            Timestamp::Now(),
+        [bucket]() { FireCoarseTimerBucket(bucket); });
+  }
+  waiter_->bucket = bucket;
+  waiter_->next = bucket->waiters;
+  if (bucket->waiters != nullptr) bucket->waiters->prev = waiter_;
+  bucket->waiters = waiter_;
+}
+
 }  // namespace grpc_core
@@ -86,6 +86,50 @@ class Sleep final {
   ActiveClosure* closure_{nullptr};
 };
 
+// CoarseSleep is a Sleep for deadlines that tolerate some slack, such as
+// keepalive, idle and connection age timers.
+//
+// Its deadline is rounded up to a multiple of \a granularity, and all coarse
+// sleeps started on the same CPU that wake at the same rounded time share a
+// single EventEngine timer, so many similar sleeps cost a few timer
+// operations instead of one each.
+class CoarseSleep final {
+ public:
+  static constexpr Duration kDefaultGranularity = Duration::Milliseconds(10);
+
+  explicit CoarseSleep(Timestamp deadline,
+                       Duration granularity = kDefaultGranularity)
+      : deadline_(deadline), granularity_(granularity) {}
+  explicit CoarseSleep(Duration timeout,
+                       Duration granularity = kDefaultGranularity)
+      : CoarseSleep(Timestamp::Now() + timeout, granularity) {}
+  ~CoarseSleep();
+
+  CoarseSleep(const CoarseSleep&) = delete;
+  CoarseSleep& operator=(const CoarseSleep&) = delete;
+  CoarseSleep(CoarseSleep&& other) noexcept
+      : deadline_(other.deadline_),
+        granularity_(other.granularity_),
+        waiter_(std::exchange(other.waiter_, nullptr)) {}
+  CoarseSleep& operator=(CoarseSleep&& other) noexcept {
+    deadline_ = other.deadline_;
+    granularity_ = other.granularity_;
+    std::swap(waiter_, other.waiter_);
+    return *this;
+  }
+
+  Poll<absl::Status> operator()();
+
+  struct Waiter;
+
+ private:
+  void Arm();
+
+  Timestamp deadline_;
+  Duration granularity_;
+  Waiter* waiter_ = nullptr;
+};
+
 }  // namespace grpc_core
 
 #endif  // GRPC_SRC_CORE_LIB_PROMISE_SLEEP_H
@@ -100,3 +100,9 @@ extern "C" void grpc_resource_quota_set_max_threads(
       ->thread_quota()
       ->SetMax(new_max_threads);
 }
+
+extern "C" void grpc_resource_quota_set_max_cpu(
+    grpc_resource_quota* resource_quota, double max_cores) {
+  grpc_core::ResourceQuota::FromC(resource_quota)->cpu_quota()->SetMax(
+      max_cores);
+}
@@ -21,12 +21,16 @@
 #include <grpc/support/alloc.h>
 #include <grpc/support/port_platform.h>
 
+#include <array>
 #include <atomic>
 #include <new>
+#include <utility>
 
 #include "absl/log/log.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
 #include "src/core/util/alloc.h"
+#include "src/core/util/huge_page_allocator.h"
 namespace grpc_core {
 
 namespace {
@@ -42,34 +46,103 @@ void* ArenaStorage(size_t& initial_size) {
        GPR_CACHELINE_SIZE % GPR_MAX_ALIGNMENT == 0)
           ? GPR_CACHELINE_SIZE
           : GPR_MAX_ALIGNMENT;
+  // Huge page slab blocks are cacheline aligned.
+  if (IsHugePageSlabAllocatorEnabled()) {
+    void* p = HugePageAllocator::MaybeAlloc(initial_size);
+    if (p != nullptr) return p;
+  }
   return gpr_malloc_aligned(initial_size, alignment);
 }
 
+// Per-thread free lists for pooled objects. This is trivially destructible so
+// that it stays usable while other thread locals are destroyed; the memory it
+// holds is freed by PooledFreeListsCleanup.
+struct PooledFreeLists {
+  struct FreeObject {
+    FreeObject* next;
+  };
+  struct FreeList {
+    size_t size;
+    size_t count;
+    FreeObject* head;
+  };
+  static constexpr size_t kMaxObjectsPerList = 64;
+  // Lists are claimed in order and never given up, so the first unclaimed
+  // list marks the end of the claimed ones.
+  std::array<FreeList, 8> lists;
+  bool cleanup_registered;
+  bool closed;
+};
+
+thread_local PooledFreeLists g_pooled_free_lists;
+
+struct PooledFreeListsCleanup {
+  ~PooledFreeListsCleanup() {
+    g_pooled_free_lists.closed = true;
+    for (auto& list : g_pooled_free_lists.lists) {
+      while (list.head != nullptr) {
+        ::operator delete(std::exchange(list.head, list.head->next));
+      }
+      list.count = 0;
+    }
+  }
+};
+
+thread_local PooledFreeListsCleanup g_pooled_free_lists_cleanup;
+
 }  // namespace
 
-Arena::~Arena() {
-  for (size_t i = 0; i < arena_detail::BaseArenaContextTraits::NumContexts();
-       ++i) {
-    arena_detail::BaseArenaContextTraits::Destroy(i, contexts()[i]);
+namespace arena_detail {
+
+void* AllocPooled(size_t size) {
+  if (IsCallArenaRecyclingEnabled()) {
+    for (auto& list : g_pooled_free_lists.lists) {
+      if (list.size == 0) break;
+      if (list.size != size) continue;
+      if (list.head == nullptr) break;
+      --list.count;
+      return std::exchange(list.head, list.head->next);
+    }
   }
-  DestroyManagedNewObjects();
-  arena_factory_->FinalizeArena(this);
-  arena_factory_->allocator().Release(
-      total_allocated_.load(std::memory_order_relaxed));
-  Zone* z = last_zone_;
-  while (z) {
-    Zone* prev_z = z->prev;
-    Destruct(z);
-    gpr_free_aligned(z);
-    z = prev_z;
+  return ::operator new(size);
+}
+
+void FreePooled(void* p, size_t size) {
+  PooledFreeLists& free_lists = g_pooled_free_lists;
+  if (IsCallArenaRecyclingEnabled() && !free_lists.closed) {
+    for (auto& list : free_lists.lists) {
+      if (list.size == 0) list.size = size;
+      if (list.size != size) continue;
+      if (list.count == PooledFreeLists::kMaxObjectsPerList) break;
+      if (!free_lists.cleanup_registered) {
+        free_lists.cleanup_registered = true;
+        // Touching the cleanup object registers its destructor for this
+        // thread.
+        static_cast<void>(&g_pooled_free_lists_cleanup);
+      }
+      ++list.count;
+      list.head = new (p) PooledFreeLists::FreeObject{list.head};
+      return;
+    }
   }
+  ::operator delete(p);
 }
 
+}  // namespace arena_detail
+
+Arena::~Arena() = default;
+
 RefCountedPtr<Arena> Arena::Create(size_t initial_size,
                                    RefCountedPtr<ArenaFactory> arena_factory) {
   void* p = ArenaStorage(initial_size);
+  return CreateInStorage(p, initial_size, std::move(arena_factory));
+}
+
+RefCountedPtr<Arena> Arena::CreateInStorage(
+    void* storage, size_t initial_size,
+    RefCountedPtr<ArenaFactory> arena_factory) {
   return RefCountedPtr<Arena>(
-      new (p) Arena(initial_size, std::move(arena_factory)));
+      new (storage) Arena(initial_size, std::move(arena_factory)));
 }
 
 Arena::Arena(size_t initial_size, RefCountedPtr<ArenaFactory> arena_factory)
@@ -100,8 +173,32 @@ void Arena::DestroyManagedNewObjects() {
 }
 
 void Arena::Destroy() const {
-  this->~Arena();
-  gpr_free_aligned(const_cast<Arena*>(this));
+  Arena* arena = const_cast<Arena*>(this);
+  for (size_t i = 0; i < arena_detail::BaseArenaContextTraits::NumContexts();
+       ++i) {
+    arena_detail::BaseArenaContextTraits::Destroy(i, arena->contexts()[i]);
+  }
+  arena->DestroyManagedNewObjects();
+  arena->arena_factory_->FinalizeArena(arena);
+  arena->arena_factory_->allocator().Release(
+      total_allocated_.load(std::memory_order_relaxed));
+  Zone* z = last_zone_;
+  while (z) {
+    Zone* prev_z = z->prev;
+    Destruct(z);
+    gpr_free_aligned(z);
+    z = prev_z;
+  }
+  // Hold the factory past the destructor, so that it can take the storage.
+  RefCountedPtr<ArenaFactory> arena_factory = std::move(arena->arena_factory_);
+  const size_t initial_size = initial_zone_size_;
+  arena->~Arena();
+  arena_factory->ReleaseArenaStorage(arena, initial_size);
+}
+
+void ArenaFactory::ReleaseArenaStorage(void* storage, size_t /*size*/) {
+  if (HugePageAllocator::MaybeFree(storage)) return;
+  gpr_free_aligned(storage);
 }
 
 void* Arena::AllocZone(size_t size) {
@@ -33,6 +33,8 @@
 #include <cstddef>
 #include <iosfwd>
 #include <memory>
+#include <new>
+#include <type_traits>
 #include <utility>
 
 #include "src/core/lib/promise/context.h"
@@ -116,12 +118,61 @@ struct UnrefDestroy {
   void operator()(const Arena* arena) const;
 };
 
+// Memory for pooled objects. With the call_arena_recycling experiment, freed
+// memory is kept on per-thread free lists, one per object size, and handed
+// out again to the next pooled object of the same size.
+void* AllocPooled(size_t size);
+void FreePooled(void* p, size_t size);
+
+// Objects go through the free lists only if the size passed to FreePooled is
+// the size they were allocated with, so their static type must be their
+// dynamic type.
+template <typename T>
+constexpr bool UsesPooledFreeList() {
+  return (!std::is_polymorphic<T>::value || std::is_final<T>::value) &&
+         sizeof(T) >= sizeof(void*) && sizeof(T) <= 4096 &&
+         alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+}
+
+template <typename T, typename... Args>
+T* NewPooledObject(Args&&... args) {
+  if constexpr (UsesPooledFreeList<T>()) {
+    return new (AllocPooled(sizeof(T))) T(std::forward<Args>(args)...);
+  } else {
+    return new T(std::forward<Args>(args)...);
+  }
+}
+
+template <typename T>
+T* NewPooledObjectForOverwrite() {
+  if constexpr (UsesPooledFreeList<T>()) {
+    return new (AllocPooled(sizeof(T))) T;
+  } else {
+    return new T;
+  }
+}
+
+template <typename T>
+void DeletePooledObject(T* p) {
+  if constexpr (UsesPooledFreeList<T>()) {
+    p->~T();
+    FreePooled(p, sizeof(T));
+  } else {
+    delete p;
+  }
+}
+
 }  // namespace arena_detail
 
 class ArenaFactory : public RefCounted<ArenaFactory> {
  public:
   virtual RefCountedPtr<Arena> MakeArena() = 0;
   virtual void FinalizeArena(Arena* arena) = 0;
+  // Called with the memory of an arena once it has been destroyed. \a size is
+  // the arena's initial size; the memory may be passed to
+  // Arena::CreateInStorage for another arena of that size. By default the
+  // memory is freed.
+  virtual void ReleaseArenaStorage(void* storage, size_t size);
 
   MemoryAllocator& allocator() { return allocator_; }
 
@@ -145,6 +196,11 @@ class Arena final : public RefCounted<Arena, NonPolymorphicRefCount,
   // Create an arena, with \a initial_size bytes in the first allocated buffer.
   static RefCountedPtr<Arena> Create(size_t initial_size,
                                      RefCountedPtr<ArenaFactory> arena_factory);
+  // Create an arena in \a storage: memory that was handed to
+  // ArenaFactory::ReleaseArenaStorage by an arena of the same \a initial_size.
+  static RefCountedPtr<Arena> CreateInStorage(
+      void* storage, size_t initial_size,
+      RefCountedPtr<ArenaFactory> arena_factory);
 
   // Destroy all `ManagedNew` allocated objects.
   // Allows safe destruction of these objects even if they need context held by
@@ -210,7 +266,7 @@ class Arena final : public RefCounted<Arena, NonPolymorphicRefCount,
       // by setting the arena to nullptr.
       // This is a transitional hack and should be removed once promise based
       // filter is removed.
-      if (delete_) delete p;
+      if (delete_) arena_detail::DeletePooledObject(p);
     }
 
     bool has_freelist() const { return delete_; }
@@ -252,12 +308,15 @@ class Arena final : public RefCounted<Arena, NonPolymorphicRefCount,
   //          arena size.
   template <typename T, typename... Args>
   static PoolPtr<T> MakePooled(Args&&... args) {
-    return PoolPtr<T>(new T(std::forward<Args>(args)...), PooledDeleter());
+    return PoolPtr<T>(
+        arena_detail::NewPooledObject<T>(std::forward<Args>(args)...),
+        PooledDeleter());
   }
 
   template <typename T>
   static PoolPtr<T> MakePooledForOverwrite() {
-    return PoolPtr<T>(new T, PooledDeleter());
+    return PoolPtr<T>(arena_detail::NewPooledObjectForOverwrite<T>(),
+                      PooledDeleter());
   }
 
   // Make a unique_ptr to an array of T that is allocated from the arena.
@@ -278,12 +337,12 @@ class Arena final : public RefCounted<Arena, NonPolymorphicRefCount,
   // function (else the free list returned to the arena will be corrupted).
   template <typename T, typename... Args>
   T* NewPooled(Args&&... args) {
-    return new T(std::forward<Args>(args)...);
+    return arena_detail::NewPooledObject<T>(std::forward<Args>(args)...);
   }
 
   template <typename T>
   void DeletePooled(T* p) {
-    delete p;
+    arena_detail::DeletePooledObject(p);
   }
 
   // Context accessors
@@ -16,8 +16,11 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <algorithm>
 #include <atomic>
 #include <cstdint>
+#include <limits>
+#include <optional>
 
 #include "absl/log/check.h"
 
@@ -32,6 +35,48 @@ void ConnectionQuota::SetMaxIncomingConnections(int max_incoming_connections) {
             max_incoming_connections, std::memory_order_release) == INT_MAX);
 }
 
+void ConnectionQuota::SetMaxPendingHandshakes(int max_pending_handshakes) {
+  CHECK_GE(max_pending_handshakes, 0);
+  MutexLock lock(&handshake_mu_);
+  max_pending_handshakes_ = max_pending_handshakes;
+  handshake_limit_ = max_pending_handshakes;
+  limit_handshakes_.store(true, std::memory_order_relaxed);
+}
+
+void ConnectionQuota::SetHandshakeLatencyTarget(Duration target) {
+  MutexLock lock(&handshake_mu_);
+  handshake_latency_target_ = target;
+  if (max_pending_handshakes_ == std::numeric_limits<int>::max()) {
+    handshake_limit_ = kInitialAdaptiveHandshakeLimit;
+  }
+  limit_handshakes_.store(true, std::memory_order_relaxed);
+}
+
+bool ConnectionQuota::ReserveHandshake() {
+  if (!limit_handshakes_.load(std::memory_order_relaxed)) return true;
+  MutexLock lock(&handshake_mu_);
+  if (pending_handshakes_ >= static_cast<int>(handshake_limit_)) return false;
+  ++pending_handshakes_;
+  return true;
+}
+
+void ConnectionQuota::HandshakeDone(std::optional<Duration> duration) {
+  if (!limit_handshakes_.load(std::memory_order_relaxed)) return;
+  MutexLock lock(&handshake_mu_);
+  // The limit may have been configured while this handshake was running.
+  if (pending_handshakes_ > 0) --pending_handshakes_;
+  if (!duration.has_value() ||
+      handshake_latency_target_ == Duration::Infinity()) {
+    return;
+  }
+  if (*duration > handshake_latency_target_) {
+    handshake_limit_ = std::max(1.0, handshake_limit_ * 0.9);
+  } else {
+    handshake_limit_ = std::min<double>(max_pending_handshakes_,
+                                        handshake_limit_ + 1);
+  }
+}
+
 // Returns true if the incoming connection is allowed to be accepted on the
 // server.
 bool ConnectionQuota::AllowIncomingConnection(MemoryQuotaRefPtr mem_quota,
@@ -40,6 +85,8 @@ bool ConnectionQuota::AllowIncomingConnection(MemoryQuotaRefPtr mem_quota,
     return false;
   }
 
+  if (!ReserveHandshake()) return false;
+
   if (max_incoming_connections_.load(std::memory_order_relaxed) == INT_MAX) {
     return true;
   }
@@ -49,6 +96,7 @@ bool ConnectionQuota::AllowIncomingConnection(MemoryQuotaRefPtr mem_quota,
   do {
     if (curr_active_connections >=
         max_incoming_connections_.load(std::memory_order_relaxed)) {
+      HandshakeDone(std::nullopt);
       return false;
     }
   } while (!active_incoming_connections_.compare_exchange_weak(
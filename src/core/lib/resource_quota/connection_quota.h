@@ -17,14 +17,17 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <atomic>
 #include <cstddef>
 #include <limits>
+#include <optional>
 
 #include "absl/base/thread_annotations.h"
 #include "src/core/lib/resource_quota/memory_quota.h"
 #include "src/core/util/ref_counted.h"
 #include "src/core/util/ref_counted_ptr.h"
 #include "src/core/util/sync.h"
+#include "src/core/util/time.h"
 
 namespace grpc_core {
 
@@ -40,11 +43,25 @@ class ConnectionQuota : public RefCounted<ConnectionQuota> {
   // Set the maximum number of allowed incoming connections on the server.
   void SetMaxIncomingConnections(int max_incoming_connections);
 
+  // Set the maximum number of incoming connections that may be handshaking
+  // at once. Connections beyond it are refused before any handshake work is
+  // done for them.
+  void SetMaxPendingHandshakes(int max_pending_handshakes);
+
+  // Adapt the pending handshake limit to keep handshakes faster than
+  // \a target: every handshake slower than it shrinks the limit by a tenth,
+  // and every faster one grows it by one, up to the configured maximum.
+  void SetHandshakeLatencyTarget(Duration target);
+
   // Returns true if the incoming connection is allowed to be accepted on the
-  // server.
+  // server. If so, HandshakeDone() must be called once its handshake is over.
   bool AllowIncomingConnection(MemoryQuotaRefPtr mem_quota,
                                absl::string_view peer);
 
+  // Mark the handshake of an allowed connection as over, after \a duration,
+  // or nullopt if it was abandoned without completing.
+  void HandshakeDone(std::optional<Duration> duration);
+
   // Mark connections as closed.
   void ReleaseConnections(int num_connections);
 
@@ -52,9 +69,34 @@ class ConnectionQuota : public RefCounted<ConnectionQuota> {
     return active_incoming_connections_;
   }
 
+  int TestOnlyPendingHandshakes() {
+    MutexLock lock(&handshake_mu_);
+    return pending_handshakes_;
+  }
+
+  int TestOnlyPendingHandshakeLimit() {
+    MutexLock lock(&handshake_mu_);
+    return static_cast<int>(handshake_limit_);
+  }
+
  private:
+  // The pending handshake limit while adapting, if no maximum is set.
+  static constexpr double kInitialAdaptiveHandshakeLimit = 1000;
+
+  bool ReserveHandshake();
+
   std::atomic<int> active_incoming_connections_{0};
   std::atomic<int> max_incoming_connections_{std::numeric_limits<int>::max()};
+  // Set once either handshake limit is configured.
+  std::atomic<bool> limit_handshakes_{false};
+  Mutex handshake_mu_;
+  int pending_handshakes_ ABSL_GUARDED_BY(handshake_mu_) = 0;
+  int max_pending_handshakes_ ABSL_GUARDED_BY(handshake_mu_) =
+      std::numeric_limits<int>::max();
+  double handshake_limit_ ABSL_GUARDED_BY(handshake_mu_) =
+      std::numeric_limits<int>::max();
+  Duration handshake_latency_target_ ABSL_GUARDED_BY(handshake_mu_) =
+      Duration::Infinity();
 };
 
 using ConnectionQuotaRefPtr = RefCountedPtr<ConnectionQuota>;
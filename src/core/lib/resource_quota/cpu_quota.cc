@@ -0,0 +1,91 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/resource_quota/cpu_quota.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <cstdint>
+#include <optional>
+#include <utility>
+
+#ifdef GPR_WINDOWS
+#include <windows.h>
+#elif defined(GPR_POSIX_TIME)
+#include <time.h>
+#endif
+
+namespace grpc_core {
+
+namespace {
+
+std::optional<Duration> ProcessCpuTime() {
+#ifdef GPR_WINDOWS
+  FILETIME creation_time, exit_time, kernel_time, user_time;
+  if (!GetProcessTimes(GetCurrentProcess(), &creation_time, &exit_time,
+                       &kernel_time, &user_time)) {
+    return std::nullopt;
+  }
+  // FILETIMEs count 100ns intervals.
+  auto to_100ns = [](const FILETIME& t) {
+    return (static_cast<uint64_t>(t.dwHighDateTime) << 32) | t.dwLowDateTime;
+  };
+  return Duration::Milliseconds(
+      static_cast<int64_t>((to_100ns(kernel_time) + to_100ns(user_time)) /
+                           10000));
+#elif defined(GPR_POSIX_TIME) && defined(CLOCK_PROCESS_CPUTIME_ID)
+  struct timespec ts;
+  if (clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts) != 0) return std::nullopt;
+  return Duration::FromSecondsAndNanoseconds(ts.tv_sec, ts.tv_nsec);
+#else
+  return std::nullopt;
+#endif
+}
+
+}  // namespace
+
+CpuQuota::CpuQuota() : CpuQuota(ProcessCpuTime) {}
+
+CpuQuota::CpuQuota(CpuTimeSource cpu_time_source)
+    : cpu_time_source_(std::move(cpu_time_source)) {}
+
+CpuQuota::~CpuQuota() = default;
+
+void CpuQuota::SetMax(double cores) {
+  MutexLock lock(&mu_);
+  max_cores_ = cores > 0 ? cores : 0;
+  last_cpu_time_.reset();
+  utilization_ = 0;
+  limited_.store(max_cores_ > 0, std::memory_order_relaxed);
+}
+
+double CpuQuota::GetUtilization() {
+  if (!limited_.load(std::memory_order_relaxed)) return 0;
+  MutexLock lock(&mu_);
+  const Timestamp now = Timestamp::Now();
+  if (last_cpu_time_.has_value() && now - last_sample_time_ < kSamplePeriod) {
+    return utilization_;
+  }
+  std::optional<Duration> cpu_time = cpu_time_source_();
+  if (cpu_time.has_value() && last_cpu_time_.has_value() &&
+      now > last_sample_time_) {
+    utilization_ = (*cpu_time - *last_cpu_time_).seconds() /
+                   (now - last_sample_time_).seconds() / max_cores_;
+  }
+  last_cpu_time_ = cpu_time;
+  last_sample_time_ = now;
+  return utilization_;
+}
+
+}  // namespace grpc_core
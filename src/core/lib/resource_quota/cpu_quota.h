@@ -0,0 +1,75 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_RESOURCE_QUOTA_CPU_QUOTA_H
+#define GRPC_SRC_CORE_LIB_RESOURCE_QUOTA_CPU_QUOTA_H
+
+#include <grpc/support/port_platform.h>
+
+#include <atomic>
+#include <optional>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/functional/any_invocable.h"
+#include "src/core/util/ref_counted.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/sync.h"
+#include "src/core/util/time.h"
+
+namespace grpc_core {
+
+// Tracks the CPU used by the process against a budget in a resource quota.
+class CpuQuota : public RefCounted<CpuQuota> {
+ public:
+  // Returns the CPU time the process has used so far, or nullopt if it is
+  // not known.
+  using CpuTimeSource = absl::AnyInvocable<std::optional<Duration>()>;
+
+  CpuQuota();
+  explicit CpuQuota(CpuTimeSource cpu_time_source);
+  ~CpuQuota() override;
+
+  CpuQuota(const CpuQuota&) = delete;
+  CpuQuota& operator=(const CpuQuota&) = delete;
+
+  // Set the CPU budget, in cores. A budget of zero or less is unlimited.
+  void SetMax(double cores);
+
+  // Returns the CPU used over the last sampling period as a fraction of the
+  // budget: 1.0 means the process is using exactly its budget. Always 0.0
+  // if the budget is unlimited or CPU time is not known.
+  double GetUtilization();
+
+  // Returns true if the process is using more CPU than its budget.
+  bool IsOverBudget() { return GetUtilization() > 1.0; }
+
+ private:
+  // How often utilization is recomputed; in between, the last value is
+  // returned.
+  static constexpr Duration kSamplePeriod = Duration::Milliseconds(100);
+
+  std::atomic<bool> limited_{false};
+  Mutex mu_;
+  CpuTimeSource cpu_time_source_ ABSL_GUARDED_BY(mu_);
+  double max_cores_ ABSL_GUARDED_BY(mu_) = 0;
+  Timestamp last_sample_time_ ABSL_GUARDED_BY(mu_);
+  std::optional<Duration> last_cpu_time_ ABSL_GUARDED_BY(mu_);
+  double utilization_ ABSL_GUARDED_BY(mu_) = 0;
+};
+
+using CpuQuotaPtr = RefCountedPtr<CpuQuota>;
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LIB_RESOURCE_QUOTA_CPU_QUOTA_H
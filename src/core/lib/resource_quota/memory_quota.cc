@@ -39,6 +39,7 @@
 #include "src/core/lib/promise/race.h"
 #include "src/core/lib/promise/seq.h"
 #include "src/core/lib/slice/slice_refcount.h"
+#include "src/core/util/huge_page_allocator.h"
 #include "src/core/util/mpscq.h"
 #include "src/core/util/useful.h"
 
@@ -52,6 +53,13 @@ constexpr size_t kMaxReplenishBytes = 1024 * 1024;
 // Minimum number of bytes an allocator will request from a quota in one step.
 constexpr size_t kMinReplenishBytes = 4096;
 
+// Maximum number of bytes parked in a single per-cpu reserve.
+constexpr size_t kMaxCpuReserveBytes = 2 * kMaxReplenishBytes;
+
+// All per-cpu reserves together hold at most 1/kCpuReserveQuotaFraction of
+// the quota, so that parked memory barely moves the measured pressure.
+constexpr size_t kCpuReserveQuotaFraction = 256;
+
 class MemoryQuotaTracker {
  public:
   static MemoryQuotaTracker& Get() {
@@ -121,7 +129,7 @@ class SliceRefCount : public grpc_slice_refcount {
   static void Destroy(grpc_slice_refcount* p) {
     auto* rc = static_cast<SliceRefCount*>(p);
     rc->~SliceRefCount();
-    free(rc);
+    if (!HugePageAllocator::MaybeFree(rc)) free(rc);
   }
 
   std::shared_ptr<
@@ -397,7 +405,11 @@ void GrpcMemoryAllocatorImpl::Replenish() {
 
 grpc_slice GrpcMemoryAllocatorImpl::MakeSlice(MemoryRequest request) {
   auto size = Reserve(request.Increase(sizeof(SliceRefCount)));
-  void* p = malloc(size);
+  void* p = nullptr;
+  if (IsHugePageSlabAllocatorEnabled()) {
+    p = HugePageAllocator::MaybeAlloc(size);
+  }
+  if (p == nullptr) p = malloc(size);
   new (p) SliceRefCount(shared_from_this(), size);
   grpc_slice slice;
   slice.refcount = static_cast<SliceRefCount*>(p);
@@ -449,6 +461,14 @@ void BasicMemoryQuota::Start() {
           if (self->free_bytes_.load(std::memory_order_acquire) > 0) {
             return Pending{};
           }
+          // Memory parked in per-cpu reserves may be enough to get us out of
+          // overcommit without bothering any reclaimers.
+          if (IsPerCpuMemoryQuotaEnabled()) {
+            self->DrainCpuReserves();
+            if (self->free_bytes_.load(std::memory_order_acquire) > 0) {
+              return Pending{};
+            }
+          }
           return 0;
         },
         [self]() {
@@ -505,6 +525,8 @@ void BasicMemoryQuota::Start() {
 void BasicMemoryQuota::Stop() { reclaimer_activity_.reset(); }
 
 void BasicMemoryQuota::SetSize(size_t new_size) {
+  // The reserve limit scales with the quota size: start the new size afresh.
+  if (IsPerCpuMemoryQuotaEnabled()) DrainCpuReserves();
   size_t old_size = quota_size_.exchange(new_size, std::memory_order_relaxed);
   if (old_size < new_size) {
     // We're growing the quota.
@@ -519,11 +541,10 @@ void BasicMemoryQuota::Take(GrpcMemoryAllocatorImpl* allocator, size_t amount) {
   // If there's a request for nothing, then do nothing!
   if (amount == 0) return;
   DCHECK(amount <= std::numeric_limits<intptr_t>::max());
-  // Grab memory from the quota.
-  auto prior = free_bytes_.fetch_sub(amount, std::memory_order_acq_rel);
-  // If we push into overcommit, awake the reclaimer.
-  if (prior >= 0 && prior < static_cast<intptr_t>(amount)) {
-    if (reclaimer_activity_ != nullptr) reclaimer_activity_->ForceWakeup();
+  // Resizes (allocator == nullptr) always apply directly to free_bytes_.
+  if (allocator == nullptr || !IsPerCpuMemoryQuotaEnabled() ||
+      !TakeFromCpuReserve(amount)) {
+    TakeFromFreeBytes(amount);
   }
 
   if (IsFreeLargeAllocatorEnabled()) {
@@ -546,6 +567,77 @@ void BasicMemoryQuota::Take(GrpcMemoryAllocatorImpl* allocator, size_t amount) {
   }
 }
 
+void BasicMemoryQuota::TakeFromFreeBytes(size_t amount) {
+  // Grab memory from the quota.
+  auto prior = free_bytes_.fetch_sub(amount, std::memory_order_acq_rel);
+  // If we push into overcommit, awake the reclaimer.
+  if (prior >= 0 && prior < static_cast<intptr_t>(amount)) {
+    if (reclaimer_activity_ != nullptr) reclaimer_activity_->ForceWakeup();
+  }
+}
+
+bool BasicMemoryQuota::TakeFromCpuReserve(size_t amount) {
+  const size_t limit = CpuReserveLimit();
+  if (amount > limit) return false;
+  std::atomic<size_t>& reserve = cpu_reserves_.this_cpu().free_bytes;
+  size_t available = reserve.load(std::memory_order_relaxed);
+  while (available >= amount) {
+    if (reserve.compare_exchange_weak(available, available - amount,
+                                      std::memory_order_relaxed)) {
+      return true;
+    }
+  }
+  // Refill the reserve, taking this request and a full reserve in one step.
+  // Only do so while the rest of the quota could absorb every reserve being
+  // full: close to overcommit, all traffic goes straight to free_bytes_ and
+  // the reclaimer sees exactly what it always has.
+  const intptr_t refill = amount + limit;
+  const intptr_t headroom =
+      2 * limit * (cpu_reserves_.end() - cpu_reserves_.begin());
+  intptr_t free = free_bytes_.load(std::memory_order_relaxed);
+  do {
+    if (free - refill < headroom) return false;
+  } while (!free_bytes_.compare_exchange_weak(free, free - refill,
+                                              std::memory_order_acq_rel,
+                                              std::memory_order_relaxed));
+  reserve.fetch_add(limit, std::memory_order_relaxed);
+  return true;
+}
+
+bool BasicMemoryQuota::ReturnToCpuReserve(size_t amount) {
+  const size_t limit = CpuReserveLimit();
+  if (amount > limit) return false;
+  // In overcommit the reclaimer is waiting on free_bytes_.
+  if (free_bytes_.load(std::memory_order_relaxed) < 0) return false;
+  std::atomic<size_t>& reserve = cpu_reserves_.this_cpu().free_bytes;
+  size_t current =
+      reserve.fetch_add(amount, std::memory_order_relaxed) + amount;
+  // Keep the reserve bounded: once it fills, hand half of it back.
+  while (current > limit) {
+    if (reserve.compare_exchange_weak(current, limit / 2,
+                                      std::memory_order_relaxed)) {
+      free_bytes_.fetch_add(current - limit / 2, std::memory_order_relaxed);
+      break;
+    }
+  }
+  return true;
+}
+
+size_t BasicMemoryQuota::CpuReserveLimit() const {
+  const size_t shards = cpu_reserves_.end() - cpu_reserves_.begin();
+  return std::min(kMaxCpuReserveBytes,
+                  quota_size_.load(std::memory_order_relaxed) /
+                      (kCpuReserveQuotaFraction * shards));
+}
+
+void BasicMemoryQuota::DrainCpuReserves() {
+  size_t drained = 0;
+  for (CpuReserve& reserve : cpu_reserves_) {
+    drained += reserve.free_bytes.exchange(0, std::memory_order_acq_rel);
+  }
+  if (drained != 0) free_bytes_.fetch_add(drained, std::memory_order_relaxed);
+}
+
 void BasicMemoryQuota::FinishReclamation(uint64_t token, Waker waker) {
   uint64_t current = reclamation_counter_.load(std::memory_order_relaxed);
   if (current != token) return;
@@ -564,6 +656,7 @@ void BasicMemoryQuota::FinishReclamation(uint64_t token, Waker waker) {
 }
 
 void BasicMemoryQuota::Return(size_t amount) {
+  if (IsPerCpuMemoryQuotaEnabled() && ReturnToCpuReserve(amount)) return;
   free_bytes_.fetch_add(amount, std::memory_order_relaxed);
 }
 
@@ -663,6 +756,11 @@ void BasicMemoryQuota::MaybeMoveAllocatorSmallToBig(
 }
 
 BasicMemoryQuota::PressureInfo BasicMemoryQuota::GetPressureInfo() {
+  // Memory parked in cpu reserves reads as used; draining them from time to
+  // time keeps that error small even when load moves between cpus.
+  if (IsPerCpuMemoryQuotaEnabled()) {
+    cpu_reserve_rebalance_.Tick([this](Duration) { DrainCpuReserves(); });
+  }
   double free = free_bytes_.load();
   if (free < 0) free = 0;
   size_t quota_size = quota_size_.load();
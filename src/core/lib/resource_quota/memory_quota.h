@@ -41,6 +41,7 @@
 #include "src/core/lib/promise/poll.h"
 #include "src/core/lib/resource_quota/periodic_update.h"
 #include "src/core/util/orphanable.h"
+#include "src/core/util/per_cpu.h"
 #include "src/core/util/ref_counted_ptr.h"
 #include "src/core/util/sync.h"
 #include "src/core/util/time.h"
@@ -346,8 +347,28 @@ class BasicMemoryQuota final
     std::array<Shard, 16> shards;
   };
 
+  // Memory taken from free_bytes_ and parked near a cpu, so that allocators
+  // running there can take and return small amounts without touching the
+  // shared counter. Bytes parked here count as used until they are drained
+  // back into free_bytes_.
+  struct alignas(GPR_CACHELINE_SIZE) CpuReserve {
+    std::atomic<size_t> free_bytes{0};
+  };
+
   static constexpr intptr_t kInitialSize = std::numeric_limits<intptr_t>::max();
 
+  // Take from free_bytes_, waking the reclaimer if we enter overcommit.
+  void TakeFromFreeBytes(size_t amount);
+  // Try to satisfy a take from this cpu's reserve, refilling it from
+  // free_bytes_ if the quota is far enough from overcommit.
+  bool TakeFromCpuReserve(size_t amount);
+  // Try to give memory back to this cpu's reserve.
+  bool ReturnToCpuReserve(size_t amount);
+  // The most that a single cpu reserve should hold.
+  size_t CpuReserveLimit() const;
+  // Move everything held by cpu reserves back into free_bytes_.
+  void DrainCpuReserves();
+
   // Move allocator from big bucket to small bucket.
   void MaybeMoveAllocatorBigToSmall(GrpcMemoryAllocatorImpl* allocator);
   // Move allocator from small bucket to big bucket.
@@ -359,6 +380,11 @@ class BasicMemoryQuota final
   std::atomic<intptr_t> free_bytes_{kInitialSize};
   // The total number of bytes in this quota.
   std::atomic<size_t> quota_size_{kInitialSize};
+  // Per-cpu reserves, only used with the per_cpu_memory_quota experiment.
+  PerCpu<CpuReserve> cpu_reserves_{PerCpuOptions().SetMaxShards(64)};
+  // Drains the cpu reserves every so often, so that memory parked on idle
+  // cpus finds its way back to the rest of the process.
+  PeriodicUpdate cpu_reserve_rebalance_{Duration::Seconds(1)};
 
   // Reclaimer queues.
   ReclaimerQueue reclaimers_[kNumReclamationPasses];
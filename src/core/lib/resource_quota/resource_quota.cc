@@ -20,7 +20,8 @@ namespace grpc_core {
 
 ResourceQuota::ResourceQuota(std::string name)
     : memory_quota_(MakeMemoryQuota(std::move(name))),
-      thread_quota_(MakeRefCounted<ThreadQuota>()) {}
+      thread_quota_(MakeRefCounted<ThreadQuota>()),
+      cpu_quota_(MakeRefCounted<CpuQuota>()) {}
 
 ResourceQuota::~ResourceQuota() = default;
 
@@ -23,6 +23,7 @@
 #include <utility>
 
 #include "absl/strings/string_view.h"
+#include "src/core/lib/resource_quota/cpu_quota.h"
 #include "src/core/lib/resource_quota/memory_quota.h"
 #include "src/core/lib/resource_quota/thread_quota.h"
 #include "src/core/util/cpp_impl_of.h"
@@ -51,6 +52,8 @@ class ResourceQuota : public RefCounted<ResourceQuota>,
 
   const RefCountedPtr<ThreadQuota>& thread_quota() { return thread_quota_; }
 
+  const RefCountedPtr<CpuQuota>& cpu_quota() { return cpu_quota_; }
+
   // The default global resource quota
   static ResourceQuotaRefPtr Default();
 
@@ -62,6 +65,7 @@ class ResourceQuota : public RefCounted<ResourceQuota>,
  private:
   MemoryQuotaRefPtr memory_quota_;
   RefCountedPtr<ThreadQuota> thread_quota_;
+  RefCountedPtr<CpuQuota> cpu_quota_;
 };
 
 inline ResourceQuotaRefPtr MakeResourceQuota(std::string name) {
@@ -18,6 +18,8 @@
 #include <grpc/support/port_platform.h>
 #include <string.h>
 
+#include <utility>
+
 #include "absl/log/log.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
@@ -214,4 +216,31 @@ absl::string_view EvaluateArgs::GetSubject() const {
   return channel_args_->subject;
 }
 
+EvaluateArgs::PerChannelArgs::EngineResults*
+EvaluateArgs::GetEngineResults() const {
+  if (channel_args_ == nullptr) {
+    return nullptr;
+  }
+  return channel_args_->engine_results.get();
+}
+
+//
+// EvaluateArgs::PerChannelArgs::EngineResults
+//
+
+EvaluateArgs::PerChannelArgs::EngineResults::Results
+EvaluateArgs::PerChannelArgs::EngineResults::Get(uint64_t engine_id) const {
+  MutexLock lock(&mu_);
+  auto it = results_.find(engine_id);
+  if (it == results_.end()) return nullptr;
+  return it->second;
+}
+
+void EvaluateArgs::PerChannelArgs::EngineResults::Set(uint64_t engine_id,
+                                                      Results results) {
+  MutexLock lock(&mu_);
+  if (results_.size() >= kMaxEngines) results_.clear();
+  results_.emplace(engine_id, std::move(results));
+}
+
 }  // namespace grpc_core
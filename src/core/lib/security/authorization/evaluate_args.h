@@ -18,14 +18,20 @@
 #include <grpc/grpc_security.h>
 #include <grpc/support/port_platform.h>
 
+#include <stdint.h>
+
+#include <memory>
 #include <optional>
 #include <string>
 #include <vector>
 
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
 #include "absl/strings/string_view.h"
 #include "src/core/call/metadata_batch.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/iomgr/resolved_address.h"
+#include "src/core/util/sync.h"
 
 namespace grpc_core {
 
@@ -42,6 +48,27 @@ class EvaluateArgs final {
       int port = 0;
     };
 
+    // Remembers, for each authorization engine, which of its
+    // connection-level predicates hold for this channel, so that they are
+    // evaluated once per connection rather than once per call.
+    class EngineResults {
+     public:
+      using Results = std::shared_ptr<const std::vector<bool>>;
+
+      // Returns the results stored for the engine with the given id, or
+      // null.
+      Results Get(uint64_t engine_id) const;
+      void Set(uint64_t engine_id, Results results);
+
+     private:
+      // Results are dropped once this many engines have stored them, since
+      // policy updates replace engines over the life of a channel.
+      static constexpr size_t kMaxEngines = 16;
+
+      mutable Mutex mu_;
+      absl::flat_hash_map<uint64_t, Results> results_ ABSL_GUARDED_BY(mu_);
+    };
+
     PerChannelArgs(grpc_auth_context* auth_context, const ChannelArgs& args);
 
     absl::string_view transport_security_type;
@@ -52,6 +79,8 @@ class EvaluateArgs final {
     absl::string_view subject;
     Address local_address;
     Address peer_address;
+    std::shared_ptr<EngineResults> engine_results =
+        std::make_shared<EngineResults>();
   };
 
   EvaluateArgs(grpc_metadata_batch* metadata, PerChannelArgs* channel_args)
@@ -83,6 +112,10 @@ class EvaluateArgs final {
   absl::string_view GetCommonName() const;
   absl::string_view GetSubject() const;
 
+  // Returns the per-channel cache of engine results, or null if there is
+  // no channel.
+  PerChannelArgs::EngineResults* GetEngineResults() const;
+
  private:
   grpc_metadata_batch* metadata_;
   PerChannelArgs* channel_args_;
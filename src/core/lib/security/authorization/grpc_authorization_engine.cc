@@ -17,9 +17,11 @@
 #include <grpc/support/port_platform.h>
 
 #include <algorithm>
+#include <atomic>
 #include <map>
 #include <utility>
 
+#include "absl/container/inlined_vector.h"
 #include "absl/log/check.h"
 #include "src/core/lib/security/authorization/audit_logging.h"
 #include "src/core/lib/security/authorization/authorization_engine.h"
@@ -42,19 +44,42 @@ bool ShouldLog(const Decision& decision,
           condition == Rbac::AuditCondition::kOnDeny);
 }
 
+bool MatchesAll(
+    const std::vector<std::unique_ptr<AuthorizationMatcher>>& matchers,
+    const EvaluateArgs& args) {
+  for (const auto& matcher : matchers) {
+    if (!matcher->Matches(args)) return false;
+  }
+  return true;
+}
+
+// Returns true if the engine can find the calls whose path matches path by
+// looking them up.
+bool IsIndexable(const StringMatcher* path) {
+  return path->case_sensitive() &&
+         (path->type() == StringMatcher::Type::kExact ||
+          path->type() == StringMatcher::Type::kPrefix);
+}
+
 }  // namespace
 
+uint64_t GrpcAuthorizationEngine::NextId() {
+  static std::atomic<uint64_t> next_id{1};
+  return next_id.fetch_add(1, std::memory_order_relaxed);
+}
+
 GrpcAuthorizationEngine::GrpcAuthorizationEngine(Rbac policy)
-    : name_(std::move(policy.name)),
+    : id_(NextId()),
+      name_(std::move(policy.name)),
       action_(policy.action),
       audit_condition_(policy.audit_condition) {
   for (auto& sub_policy : policy.policies) {
-    Policy policy;
-    policy.name = sub_policy.first;
-    policy.matcher = std::make_unique<PolicyAuthorizationMatcher>(
-        std::move(sub_policy.second));
-    policies_.push_back(std::move(policy));
+    AddPolicy(sub_policy.first, std::move(sub_policy.second));
   }
+  std::sort(path_prefix_lengths_.begin(), path_prefix_lengths_.end());
+  path_prefix_lengths_.erase(
+      std::unique(path_prefix_lengths_.begin(), path_prefix_lengths_.end()),
+      path_prefix_lengths_.end());
   for (auto& logger_config : policy.logger_configs) {
     auto logger =
         AuditLoggerRegistry::CreateAuditLogger(std::move(logger_config));
@@ -65,33 +90,134 @@ GrpcAuthorizationEngine::GrpcAuthorizationEngine(Rbac policy)
 
 GrpcAuthorizationEngine::GrpcAuthorizationEngine(
     GrpcAuthorizationEngine&& other) noexcept
-    : name_(std::move(other.name_)),
+    : id_(std::exchange(other.id_, NextId())),
+      name_(std::move(other.name_)),
       action_(other.action_),
       policies_(std::move(other.policies_)),
+      has_connection_matchers_(other.has_connection_matchers_),
+      policies_by_path_(std::move(other.policies_by_path_)),
+      policies_by_path_prefix_(std::move(other.policies_by_path_prefix_)),
+      path_prefix_lengths_(std::move(other.path_prefix_lengths_)),
+      unindexed_policies_(std::move(other.unindexed_policies_)),
       audit_condition_(other.audit_condition_),
       audit_loggers_(std::move(other.audit_loggers_)) {}
 
 GrpcAuthorizationEngine& GrpcAuthorizationEngine::operator=(
     GrpcAuthorizationEngine&& other) noexcept {
+  id_ = std::exchange(other.id_, NextId());
   name_ = std::move(other.name_);
   action_ = other.action_;
   policies_ = std::move(other.policies_);
+  has_connection_matchers_ = other.has_connection_matchers_;
+  policies_by_path_ = std::move(other.policies_by_path_);
+  policies_by_path_prefix_ = std::move(other.policies_by_path_prefix_);
+  path_prefix_lengths_ = std::move(other.path_prefix_lengths_);
+  unindexed_policies_ = std::move(other.unindexed_policies_);
   audit_condition_ = other.audit_condition_;
   audit_loggers_ = std::move(other.audit_loggers_);
   return *this;
 }
 
-AuthorizationEngine::Decision GrpcAuthorizationEngine::Evaluate(
+void GrpcAuthorizationEngine::AddPolicy(std::string name,
+                                        Rbac::Policy policy) {
+  const size_t index = policies_.size();
+  Policy compiled;
+  compiled.name = std::move(name);
+  std::unique_ptr<AuthorizationMatcher> matchers[] = {
+      AuthorizationMatcher::Create(std::move(policy.permissions)),
+      AuthorizationMatcher::Create(std::move(policy.principals))};
+  std::vector<const StringMatcher*> paths;
+  bool indexed = false;
+  for (auto& matcher : matchers) {
+    if (!indexed) indexed = matcher->RequiredPaths(&paths);
+    if (matcher->DependsOnCall()) {
+      compiled.call_matchers.push_back(std::move(matcher));
+    } else {
+      compiled.connection_matchers.push_back(std::move(matcher));
+    }
+  }
+  has_connection_matchers_ |= !compiled.connection_matchers.empty();
+  policies_.push_back(std::move(compiled));
+  if (!indexed || !std::all_of(paths.begin(), paths.end(), IsIndexable)) {
+    unindexed_policies_.push_back(index);
+    return;
+  }
+  for (const StringMatcher* path : paths) {
+    const bool exact = path->type() == StringMatcher::Type::kExact;
+    auto& policies_by_path =
+        exact ? policies_by_path_ : policies_by_path_prefix_;
+    std::vector<size_t>& indices = policies_by_path[path->string_matcher()];
+    if (indices.empty() || indices.back() != index) indices.push_back(index);
+    if (!exact) path_prefix_lengths_.push_back(path->string_matcher().size());
+  }
+}
+
+std::vector<bool> GrpcAuthorizationEngine::EvaluateConnectionMatchers(
     const EvaluateArgs& args) const {
-  Decision decision;
-  bool matches = false;
+  std::vector<bool> results;
+  results.reserve(policies_.size());
   for (const auto& policy : policies_) {
-    if (policy.matcher->Matches(args)) {
-      matches = true;
-      decision.matching_policy_name = policy.name;
-      break;
+    results.push_back(MatchesAll(policy.connection_matchers, args));
+  }
+  return results;
+}
+
+std::optional<size_t> GrpcAuthorizationEngine::FindMatchingPolicy(
+    const EvaluateArgs& args) const {
+  absl::InlinedVector<size_t, 16> candidates(unindexed_policies_.begin(),
+                                             unindexed_policies_.end());
+  const absl::string_view path = args.GetPath();
+  if (!path.empty()) {
+    auto add_candidates = [&](const auto& policies_by_path,
+                              absl::string_view key) {
+      auto it = policies_by_path.find(key);
+      if (it == policies_by_path.end()) return;
+      candidates.insert(candidates.end(), it->second.begin(),
+                        it->second.end());
+    };
+    add_candidates(policies_by_path_, path);
+    for (size_t length : path_prefix_lengths_) {
+      if (length > path.size()) break;
+      add_candidates(policies_by_path_prefix_, path.substr(0, length));
+    }
+    // The first matching policy in config order wins.
+    if (candidates.size() > unindexed_policies_.size()) {
+      std::sort(candidates.begin(), candidates.end());
+      candidates.erase(std::unique(candidates.begin(), candidates.end()),
+                       candidates.end());
+    }
+  }
+  if (candidates.empty()) return std::nullopt;
+  EvaluateArgs::PerChannelArgs::EngineResults* engine_results =
+      has_connection_matchers_ ? args.GetEngineResults() : nullptr;
+  EvaluateArgs::PerChannelArgs::EngineResults::Results connection_results;
+  if (engine_results != nullptr) {
+    connection_results = engine_results->Get(id_);
+    if (connection_results == nullptr) {
+      connection_results = std::make_shared<const std::vector<bool>>(
+          EvaluateConnectionMatchers(args));
+      engine_results->Set(id_, connection_results);
     }
   }
+  for (size_t index : candidates) {
+    const Policy& policy = policies_[index];
+    const bool connection_matches =
+        connection_results != nullptr
+            ? (*connection_results)[index]
+            : MatchesAll(policy.connection_matchers, args);
+    if (connection_matches && MatchesAll(policy.call_matchers, args)) {
+      return index;
+    }
+  }
+  return std::nullopt;
+}
+
+AuthorizationEngine::Decision GrpcAuthorizationEngine::Evaluate(
+    const EvaluateArgs& args) const {
+  Decision decision;
+  const std::optional<size_t> match = FindMatchingPolicy(args);
+  const bool matches = match.has_value();
+  if (matches) decision.matching_policy_name = policies_[*match].name;
   decision.type = (matches == (action_ == Rbac::Action::kAllow))
                       ? Decision::Type::kAllow
                       : Decision::Type::kDeny;
@@ -18,11 +18,14 @@
 #include <grpc/grpc_audit_logging.h>
 #include <grpc/support/port_platform.h>
 #include <stddef.h>
+#include <stdint.h>
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
+#include "absl/container/flat_hash_map.h"
 #include "src/core/lib/security/authorization/authorization_engine.h"
 #include "src/core/lib/security/authorization/evaluate_args.h"
 #include "src/core/lib/security/authorization/matchers.h"
@@ -38,11 +41,19 @@ using experimental::AuditLogger;
 // engine type. This engine ignores condition field in RBAC config. It is the
 // caller's responsibility to provide RBAC policies that are compatible with
 // this engine.
+//
+// Policies are compiled when the engine is built. Policies that can only
+// match certain paths are indexed by those paths, so a call only evaluates
+// the policies that could apply to it. The parts of each policy that depend
+// only on the connection are evaluated once per connection and cached in
+// the channel's EvaluateArgs::PerChannelArgs.
 class GrpcAuthorizationEngine : public AuthorizationEngine {
  public:
   // Builds GrpcAuthorizationEngine without any policies.
   explicit GrpcAuthorizationEngine(Rbac::Action action)
-      : action_(action), audit_condition_(Rbac::AuditCondition::kNone) {}
+      : id_(NextId()),
+        action_(action),
+        audit_condition_(Rbac::AuditCondition::kNone) {}
   // Builds GrpcAuthorizationEngine with allow/deny RBAC policy.
   explicit GrpcAuthorizationEngine(Rbac policy);
 
@@ -69,12 +80,35 @@ class GrpcAuthorizationEngine : public AuthorizationEngine {
  private:
   struct Policy {
     std::string name;
-    std::unique_ptr<AuthorizationMatcher> matcher;
+    // The permissions and principals of the policy, split by whether they
+    // only depend on the connection.  The policy matches if all of them do.
+    std::vector<std::unique_ptr<AuthorizationMatcher>> connection_matchers;
+    std::vector<std::unique_ptr<AuthorizationMatcher>> call_matchers;
   };
 
+  static uint64_t NextId();
+
+  void AddPolicy(std::string name, Rbac::Policy policy);
+  // Returns the index of the first policy that matches args, if any.
+  std::optional<size_t> FindMatchingPolicy(const EvaluateArgs& args) const;
+  // Evaluates the connection matchers of every policy.
+  std::vector<bool> EvaluateConnectionMatchers(const EvaluateArgs& args) const;
+
+  // Identifies this engine in the per-channel cache of connection results.
+  uint64_t id_;
   std::string name_;
   Rbac::Action action_;
   std::vector<Policy> policies_;
+  // Whether any policy has connection matchers worth caching.
+  bool has_connection_matchers_ = false;
+  // Policies that can only match calls with certain paths, indexed by those
+  // paths, and the distinct lengths of the prefixes.
+  absl::flat_hash_map<std::string, std::vector<size_t>> policies_by_path_;
+  absl::flat_hash_map<std::string, std::vector<size_t>>
+      policies_by_path_prefix_;
+  std::vector<size_t> path_prefix_lengths_;
+  // Policies that may match calls with any path.
+  std::vector<size_t> unindexed_policies_;
   Rbac::AuditCondition audit_condition_;
   std::vector<std::unique_ptr<AuditLogger>> audit_loggers_;
 };
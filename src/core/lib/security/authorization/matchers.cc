@@ -18,6 +18,7 @@
 #include <grpc/support/port_platform.h>
 #include <string.h>
 
+#include <algorithm>
 #include <string>
 
 #include "absl/log/log.h"
@@ -131,6 +132,22 @@ bool AndAuthorizationMatcher::Matches(const EvaluateArgs& args) const {
   return true;
 }
 
+bool AndAuthorizationMatcher::DependsOnCall() const {
+  return std::any_of(matchers_.begin(), matchers_.end(),
+                     [](const auto& matcher) {
+                       return matcher->DependsOnCall();
+                     });
+}
+
+bool AndAuthorizationMatcher::RequiredPaths(
+    std::vector<const StringMatcher*>* paths) const {
+  // Any one child's paths will do.
+  for (const auto& matcher : matchers_) {
+    if (matcher->RequiredPaths(paths)) return true;
+  }
+  return false;
+}
+
 bool OrAuthorizationMatcher::Matches(const EvaluateArgs& args) const {
   for (const auto& matcher : matchers_) {
     if (matcher->Matches(args)) {
@@ -140,6 +157,25 @@ bool OrAuthorizationMatcher::Matches(const EvaluateArgs& args) const {
   return false;
 }
 
+bool OrAuthorizationMatcher::DependsOnCall() const {
+  return std::any_of(matchers_.begin(), matchers_.end(),
+                     [](const auto& matcher) {
+                       return matcher->DependsOnCall();
+                     });
+}
+
+bool OrAuthorizationMatcher::RequiredPaths(
+    std::vector<const StringMatcher*>* paths) const {
+  // Every child must require a path, or the call could match without one.
+  std::vector<const StringMatcher*> child_paths;
+  for (const auto& matcher : matchers_) {
+    if (!matcher->RequiredPaths(&child_paths)) return false;
+  }
+  if (child_paths.empty()) return false;
+  paths->insert(paths->end(), child_paths.begin(), child_paths.end());
+  return true;
+}
+
 bool NotAuthorizationMatcher::Matches(const EvaluateArgs& args) const {
   return !matcher_->Matches(args);
 }
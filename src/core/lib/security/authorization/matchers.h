@@ -39,6 +39,17 @@ class AuthorizationMatcher {
   // matcher.
   virtual bool Matches(const EvaluateArgs& args) const = 0;
 
+  // Returns true if the result of Matches() may depend on the call itself,
+  // rather than only on the connection it arrived on.
+  virtual bool DependsOnCall() const { return false; }
+
+  // If Matches() can only succeed for a call whose path matches one of a
+  // known set of path matchers, appends them to paths and returns true.
+  virtual bool RequiredPaths(
+      std::vector<const StringMatcher*>* /*paths*/) const {
+    return false;
+  }
+
   // Creates an instance of a matcher based off the rules defined in Permission
   // config.
   static std::unique_ptr<AuthorizationMatcher> Create(
@@ -64,6 +75,8 @@ class AndAuthorizationMatcher : public AuthorizationMatcher {
       : matchers_(std::move(matchers)) {}
 
   bool Matches(const EvaluateArgs& args) const override;
+  bool DependsOnCall() const override;
+  bool RequiredPaths(std::vector<const StringMatcher*>* paths) const override;
 
  private:
   std::vector<std::unique_ptr<AuthorizationMatcher>> matchers_;
@@ -76,6 +89,8 @@ class OrAuthorizationMatcher : public AuthorizationMatcher {
       : matchers_(std::move(matchers)) {}
 
   bool Matches(const EvaluateArgs& args) const override;
+  bool DependsOnCall() const override;
+  bool RequiredPaths(std::vector<const StringMatcher*>* paths) const override;
 
  private:
   std::vector<std::unique_ptr<AuthorizationMatcher>> matchers_;
@@ -89,6 +104,7 @@ class NotAuthorizationMatcher : public AuthorizationMatcher {
       : matcher_(std::move(matcher)) {}
 
   bool Matches(const EvaluateArgs& args) const override;
+  bool DependsOnCall() const override { return matcher_->DependsOnCall(); }
 
  private:
   std::unique_ptr<AuthorizationMatcher> matcher_;
@@ -117,6 +133,7 @@ class HeaderAuthorizationMatcher : public AuthorizationMatcher {
       : matcher_(std::move(matcher)) {}
 
   bool Matches(const EvaluateArgs& args) const override;
+  bool DependsOnCall() const override { return true; }
 
  private:
   const HeaderMatcher matcher_;
@@ -188,6 +205,11 @@ class PathAuthorizationMatcher : public AuthorizationMatcher {
       : matcher_(std::move(path)) {}
 
   bool Matches(const EvaluateArgs& args) const override;
+  bool DependsOnCall() const override { return true; }
+  bool RequiredPaths(std::vector<const StringMatcher*>* paths) const override {
+    paths->push_back(&matcher_);
+    return true;
+  }
 
  private:
   const StringMatcher matcher_;
@@ -205,6 +227,13 @@ class PolicyAuthorizationMatcher : public AuthorizationMatcher {
             AuthorizationMatcher::Create(std::move(policy.principals))) {}
 
   bool Matches(const EvaluateArgs& args) const override;
+  bool DependsOnCall() const override {
+    return permissions_->DependsOnCall() || principals_->DependsOnCall();
+  }
+  bool RequiredPaths(std::vector<const StringMatcher*>* paths) const override {
+    return permissions_->RequiredPaths(paths) ||
+           principals_->RequiredPaths(paths);
+  }
 
  private:
   std::unique_ptr<AuthorizationMatcher> permissions_;
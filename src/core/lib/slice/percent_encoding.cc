@@ -20,12 +20,15 @@
 
 #include <grpc/support/port_platform.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include <cstdint>
 #include <utility>
 
 #include "absl/log/check.h"
+#include "absl/strings/string_view.h"
 #include "src/core/util/bitset.h"
+#include "src/core/util/byte_scan.h"
 
 namespace grpc_core {
 
@@ -75,11 +78,18 @@ Slice PercentEncodeSlice(Slice slice, PercentEncodingType type) {
 
   const BitSet<256>& lut = LookupTableForPercentEncodingType(type);
 
+  // The compatible encoding leaves printable ASCII other than '%' alone,
+  // which is what a grpc-message nearly always is, so find the part that
+  // needs no escaping a word at a time.
+  const size_t unreserved_prefix =
+      type == PercentEncodingType::Compatible
+          ? PrintableAsciiPrefixLength(slice.as_string_view(), '%')
+          : 0;
   // first pass: count the number of bytes needed to output this string
-  size_t output_length = 0;
+  size_t output_length = unreserved_prefix;
   bool any_reserved_bytes = false;
-  for (uint8_t c : slice) {
-    bool unres = lut.is_set(c);
+  for (size_t i = unreserved_prefix; i < slice.size(); ++i) {
+    bool unres = lut.is_set(slice[i]);
     output_length += unres ? 1 : 3;
     any_reserved_bytes |= !unres;
   }
@@ -90,7 +100,10 @@ Slice PercentEncodeSlice(Slice slice, PercentEncodingType type) {
   // second pass: actually encode
   auto out = MutableSlice::CreateUninitialized(output_length);
   uint8_t* q = out.begin();
-  for (uint8_t c : slice) {
+  memcpy(q, slice.begin(), unreserved_prefix);
+  q += unreserved_prefix;
+  for (size_t i = unreserved_prefix; i < slice.size(); ++i) {
+    const uint8_t c = slice[i];
     if (lut.is_set(c)) {
       *q++ = c;
     } else {
@@ -117,18 +130,15 @@ static uint8_t DeHex(uint8_t c) {
 }
 
 Slice PermissivePercentDecodeSlice(Slice slice_in) {
-  bool any_percent_encoded_stuff = false;
-  for (uint8_t c : slice_in) {
-    if (c == '%') {
-      any_percent_encoded_stuff = true;
-      break;
-    }
-  }
-  if (!any_percent_encoded_stuff) return slice_in;
+  const void* first_percent = memchr(slice_in.data(), '%', slice_in.size());
+  if (first_percent == nullptr) return slice_in;
+  const size_t unchanged_prefix =
+      static_cast<const uint8_t*>(first_percent) - slice_in.begin();
 
   MutableSlice out = slice_in.TakeMutable();
-  uint8_t* q = out.begin();
-  const uint8_t* p = out.begin();
+  // Everything before the first '%' stays where it is.
+  uint8_t* q = out.begin() + unchanged_prefix;
+  const uint8_t* p = q;
   const uint8_t* end = out.end();
   while (p != end) {
     if (*p == '%') {
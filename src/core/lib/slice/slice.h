@@ -27,6 +27,7 @@
 
 #include "absl/log/check.h"
 #include "absl/strings/string_view.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/slice/slice_internal.h"
 #include "src/core/lib/slice/slice_refcount.h"
 #include "src/core/util/debug_location.h"
@@ -422,6 +423,16 @@ class GPR_MSVC_EMPTY_BASE_CLASS_WORKAROUND Slice
                                     const uint8_t* begin, const uint8_t* end,
                                     DebugLocation location = {}) {
     grpc_slice out;
+    if (r != grpc_slice_refcount::NoopRefcount() &&
+        static_cast<size_t>(end - begin) <= GRPC_SLICE_INLINED_SIZE &&
+        IsSmallSliceInliningEnabled()) {
+      // Copying a few bytes is cheaper than the two atomic refcount updates,
+      // and does not keep the (usually much larger) backing buffer alive.
+      out.refcount = nullptr;
+      out.data.inlined.length = static_cast<uint8_t>(end - begin);
+      memcpy(out.data.inlined.bytes, begin, end - begin);
+      return Slice(out);
+    }
     out.refcount = r;
     if (r != grpc_slice_refcount::NoopRefcount()) r->Ref(location);
     out.data.refcounted.bytes = const_cast<uint8_t*>(begin);
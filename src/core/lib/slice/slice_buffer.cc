@@ -24,9 +24,11 @@
 #include <grpc/support/port_platform.h>
 #include <string.h>
 
+#include <algorithm>
 #include <utility>
 
 #include "absl/log/check.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/slice/slice_internal.h"
 
 namespace grpc_core {
@@ -83,11 +85,67 @@ Slice SliceBuffer::JoinIntoSlice() const {
   return Slice(slice);
 }
 
+void SliceBuffer::CoalesceSmallSlices(size_t max_slice_size,
+                                      size_t max_run_size) {
+  DCHECK_LE(max_slice_size, max_run_size);
+  grpc_slice* slices = slice_buffer_.slices;
+  const size_t count = slice_buffer_.count;
+  auto is_small = [slices, max_slice_size](size_t i) {
+    return GRPC_SLICE_LENGTH(slices[i]) < max_slice_size;
+  };
+  // Most buffers have nothing to coalesce: leave those untouched.
+  size_t first = 1;
+  while (first < count && !(is_small(first - 1) && is_small(first))) ++first;
+  if (first >= count) return;
+  grpc_slice_buffer out;
+  grpc_slice_buffer_init(&out);
+  size_t i = 0;
+  while (i < count) {
+    size_t run_end = i;
+    size_t run_length = 0;
+    while (run_end < count && is_small(run_end) &&
+           run_length + GRPC_SLICE_LENGTH(slices[run_end]) <= max_run_size) {
+      run_length += GRPC_SLICE_LENGTH(slices[run_end]);
+      ++run_end;
+    }
+    if (run_end - i < 2) {
+      // Ownership of the slice moves to `out`.
+      grpc_slice_buffer_add(&out, slices[i]);
+      ++i;
+      continue;
+    }
+    grpc_slice merged = GRPC_SLICE_MALLOC(run_length);
+    uint8_t* p = GRPC_SLICE_START_PTR(merged);
+    for (; i < run_end; ++i) {
+      memcpy(p, GRPC_SLICE_START_PTR(slices[i]), GRPC_SLICE_LENGTH(slices[i]));
+      p += GRPC_SLICE_LENGTH(slices[i]);
+      CSliceUnref(slices[i]);
+    }
+    grpc_slice_buffer_add(&out, merged);
+  }
+  DCHECK_EQ(out.length, slice_buffer_.length);
+  // All slices have been moved or released already.
+  slice_buffer_.count = 0;
+  slice_buffer_.length = 0;
+  grpc_slice_buffer_swap(&slice_buffer_, &out);
+  grpc_slice_buffer_destroy(&out);
+}
+
 }  // namespace grpc_core
 
 // grow a buffer; requires GRPC_SLICE_BUFFER_INLINE_ELEMENTS > 1
 #define GROW(x) (3 * (x) / 2)
 
+// Buffers that outgrow their inline elements usually carry a whole message
+// made of many slices: double from a larger first allocation so that such a
+// buffer reallocates a handful of times rather than once every few slices.
+static constexpr size_t kMinHeapSliceCapacity = 8;
+
+static size_t grow_capacity(size_t capacity) {
+  if (!grpc_core::IsSmallSliceInliningEnabled()) return GROW(capacity);
+  return std::max(kMinHeapSliceCapacity, 2 * capacity);
+}
+
 // Typically, we do not actually need to embiggen (by calling
 // memmove/malloc/realloc) - only if we were up against the full capacity of the
 // slice buffer. If do_embiggen is inlined, the compiler clobbers multiple
@@ -101,7 +159,7 @@ static void GPR_ATTRIBUTE_NOINLINE do_embiggen(grpc_slice_buffer* sb,
     sb->slices = sb->base_slices;
   } else {
     // Allocate more memory if no more space is available
-    const size_t new_capacity = GROW(sb->capacity);
+    const size_t new_capacity = grow_capacity(sb->capacity);
     sb->capacity = new_capacity;
     if (sb->base_slices == sb->inlined) {
       sb->base_slices = static_cast<grpc_slice*>(
@@ -163,6 +163,12 @@ class SliceBuffer {
   /// Concatenate all slices and return the resulting slice.
   Slice JoinIntoSlice() const;
 
+  /// Copy every run of two or more consecutive slices, each shorter than
+  /// \a max_slice_size, into a single slice of at most \a max_run_size bytes.
+  /// The contents are unchanged, but they are spread over fewer slices, so
+  /// that writing them out needs fewer iovecs.
+  void CoalesceSmallSlices(size_t max_slice_size, size_t max_run_size);
+
   // Return a copy of the slice buffer
   SliceBuffer Copy() const {
     SliceBuffer copy;
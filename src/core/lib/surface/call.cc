@@ -99,6 +99,7 @@
 #include "src/core/util/crash.h"
 #include "src/core/util/debug_location.h"
 #include "src/core/util/match.h"
+#include "src/core/util/no_destruct.h"
 #include "src/core/util/ref_counted.h"
 #include "src/core/util/ref_counted_ptr.h"
 #include "src/core/util/status_helper.h"
@@ -112,6 +113,19 @@ namespace grpc_core {
 // prefix.
 using GrpcClosure = Closure;
 
+namespace {
+
+// Built once and copied: a copy shares the payloads of the original instead
+// of allocating its own, which matters when many calls expire at once.
+const absl::Status& DeadlineExceededError() {
+  static const NoDestruct<absl::Status> error(grpc_error_set_int(
+      absl::DeadlineExceededError("Deadline Exceeded"),
+      StatusIntProperty::kRpcStatus, GRPC_STATUS_DEADLINE_EXCEEDED));
+  return *error;
+}
+
+}  // namespace
+
 ///////////////////////////////////////////////////////////////////////////////
 // Call
 
@@ -344,28 +358,38 @@ void Call::UpdateDeadline(Timestamp deadline) {
   if (deadline >= deadline_) return;
   if (deadline < Timestamp::Now()) {
     lock.Release();
-    CancelWithError(grpc_error_set_int(
-        absl::DeadlineExceededError("Deadline Exceeded"),
-        StatusIntProperty::kRpcStatus, GRPC_STATUS_DEADLINE_EXCEEDED));
+    CancelWithError(DeadlineExceededError());
     return;
   }
   auto* event_engine =
       arena_->GetContext<grpc_event_engine::experimental::EventEngine>();
+  const bool lazy = IsLazyDeadlineTimersEnabled();
   if (deadline_ != Timestamp::InfFuture()) {
-    if (!event_engine->Cancel(deadline_task_)) return;
+    if (!(lazy ? DeadlineSweeper::Get()->Cancel(&deadline_entry_)
+               : event_engine->Cancel(deadline_task_))) {
+      return;
+    }
   } else {
     InternalRef("deadline");
   }
   deadline_ = deadline;
-  deadline_task_ = event_engine->RunAfter(deadline - Timestamp::Now(), this);
+  if (lazy) {
+    DeadlineSweeper::Get()->Schedule(&deadline_entry_, deadline, event_engine,
+                                     this);
+  } else {
+    deadline_task_ = event_engine->RunAfter(deadline - Timestamp::Now(), this);
+  }
 }
 
 void Call::ResetDeadline() {
   {
     MutexLock lock(&deadline_mu_);
     if (deadline_ == Timestamp::InfFuture()) return;
-    if (!arena_->GetContext<grpc_event_engine::experimental::EventEngine>()
-             ->Cancel(deadline_task_)) {
+    auto* event_engine =
+        arena_->GetContext<grpc_event_engine::experimental::EventEngine>();
+    if (!(IsLazyDeadlineTimersEnabled()
+              ? DeadlineSweeper::Get()->Cancel(&deadline_entry_)
+              : event_engine->Cancel(deadline_task_))) {
       return;
     }
     deadline_ = Timestamp::InfFuture();
@@ -378,9 +402,7 @@ void Call::Run() {
   GRPC_TRACE_LOG(call, INFO)
       << "call deadline expired "
       << GRPC_DUMP_ARGS(Timestamp::Now(), send_deadline_);
-  CancelWithError(grpc_error_set_int(
-      absl::DeadlineExceededError("Deadline Exceeded"),
-      StatusIntProperty::kRpcStatus, GRPC_STATUS_DEADLINE_EXCEEDED));
+  CancelWithError(DeadlineExceededError());
   InternalUnref("deadline[run]");
 }
 
@@ -43,6 +43,7 @@
 #include "src/core/lib/resource_quota/arena.h"
 #include "src/core/lib/slice/slice.h"
 #include "src/core/lib/surface/channel.h"
+#include "src/core/lib/surface/deadline_sweeper.h"
 #include "src/core/lib/transport/transport.h"
 #include "src/core/server/server_interface.h"
 #include "src/core/util/ref_counted_ptr.h"
@@ -225,6 +226,8 @@ class Call : public CppImplOf<Call, grpc_call>,
   Timestamp deadline_ ABSL_GUARDED_BY(deadline_mu_) = Timestamp::InfFuture();
   grpc_event_engine::experimental::EventEngine::TaskHandle ABSL_GUARDED_BY(
       deadline_mu_) deadline_task_;
+  // Used instead of deadline_task_ when deadline timers are armed lazily.
+  DeadlineSweeper::Entry deadline_entry_ ABSL_GUARDED_BY(deadline_mu_);
   gpr_cycle_counter start_time_ = gpr_get_cycle_counter();
 };
 
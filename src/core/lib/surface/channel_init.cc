@@ -29,12 +29,15 @@
 #include <string>
 #include <type_traits>
 
+#include "absl/container/inlined_vector.h"
 #include "absl/log/check.h"
 #include "absl/log/log.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_join.h"
 #include "absl/strings/string_view.h"
+#include "absl/types/span.h"
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/surface/channel_stack_type.h"
 #include "src/core/util/crash.h"
 #include "src/core/util/sync.h"
@@ -413,6 +416,12 @@ ChannelInit ChannelInit::Builder::Build() {
     result.stack_configs_[i] =
         BuildStackConfig(filters_[i], post_processors_[i],
                          static_cast<grpc_channel_stack_type>(i));
+    auto& fusions = result.stack_configs_[i].fusions;
+    fusions = fusions_[i];
+    std::stable_sort(fusions.begin(), fusions.end(),
+                     [](const Fusion& a, const Fusion& b) {
+                       return a.filters.size() > b.filters.size();
+                     });
   }
   return result;
 }
@@ -426,6 +435,8 @@ bool ChannelInit::Filter::CheckPredicates(const ChannelArgs& args) const {
 
 bool ChannelInit::CreateStack(ChannelStackBuilder* builder) const {
   const auto& stack_config = stack_configs_[builder->channel_stack_type()];
+  // Room for every candidate, so a stack is assembled without regrowing.
+  builder->mutable_stack()->reserve(stack_config.filters.size() + 1);
   for (const auto& filter : stack_config.filters) {
     if (SkipV2(filter.version)) continue;
     if (!filter.CheckPredicates(builder->channel_args())) continue;
@@ -471,6 +482,7 @@ void ChannelInit::AddToInterceptionChainBuilder(
     grpc_channel_stack_type type, InterceptionChainBuilder& builder) const {
   const auto& stack_config = stack_configs_[type];
   // Based on predicates build a list of filters to include in this segment.
+  absl::InlinedVector<const Filter*, 16> filters;
   for (const auto& filter : stack_config.filters) {
     if (SkipV3(filter.version)) continue;
     if (!filter.CheckPredicates(builder.channel_args())) continue;
@@ -479,8 +491,38 @@ void ChannelInit::AddToInterceptionChainBuilder(
           absl::StrCat("Filter ", filter.name, " has no v3-callstack vtable")));
       return;
     }
-    filter.filter_adder(builder);
+    filters.push_back(&filter);
   }
+  const bool fuse =
+      !stack_config.fusions.empty() && IsFusedFilterStacksEnabled();
+  for (size_t i = 0; i < filters.size();) {
+    const Fusion* fusion = nullptr;
+    if (fuse) fusion = FindFusion(stack_config.fusions, filters, i);
+    if (fusion != nullptr) {
+      fusion->filter_adder(builder);
+      i += fusion->filters.size();
+    } else {
+      filters[i]->filter_adder(builder);
+      ++i;
+    }
+  }
+}
+
+const ChannelInit::Fusion* ChannelInit::FindFusion(
+    const std::vector<Fusion>& fusions,
+    absl::Span<const Filter* const> filters, size_t start) {
+  for (const auto& fusion : fusions) {
+    if (fusion.filters.size() > filters.size() - start) continue;
+    bool matches = true;
+    for (size_t j = 0; j < fusion.filters.size(); ++j) {
+      if (fusion.filters[j] != filters[start + j]->name) {
+        matches = false;
+        break;
+      }
+    }
+    if (matches) return &fusion;
+  }
+  return nullptr;
 }
 
 }  // namespace grpc_core
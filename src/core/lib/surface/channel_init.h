@@ -30,6 +30,7 @@
 
 #include "absl/functional/any_invocable.h"
 #include "absl/log/check.h"
+#include "absl/types/span.h"
 #include "src/core/call/call_filters.h"
 #include "src/core/call/interception_chain.h"
 #include "src/core/lib/channel/channel_args.h"
@@ -117,6 +118,14 @@ class ChannelInit {
   using PostProcessor = absl::AnyInvocable<void(ChannelStackBuilder&) const>;
   // Function that can be called to add a filter to a stack builder
   using FilterAdder = void (*)(InterceptionChainBuilder&);
+
+  // A fused filter that replaces a run of separately registered filters.
+  struct Fusion {
+    // Names of the filters replaced, in stack order.
+    std::vector<UniqueTypeName> filters;
+    FilterAdder filter_adder;
+    SourceLocation registration_source;
+  };
   // Post processing slots - up to one PostProcessor per slot can be registered
   // They run after filters registered are added to the channel stack builder,
   // but before Build is called - allowing ad-hoc mutation to the channel stack.
@@ -322,6 +331,22 @@ class ChannelInit {
           .SkipV3();
     }
 
+    // Register a fused replacement for a run of v3 filters: Fused is a
+    // FusedFilter<Filters...> over filters that are registered separately.
+    // When the fused_filter_stacks experiment is enabled and the filters
+    // selected for a v3 stack of this type include all of Filters, adjacent
+    // and in the same order, they are replaced by a single Fused filter.
+    // Registering a fusion never changes which filters are in a stack, or
+    // their order.
+    template <typename Fused>
+    void RegisterFusedFilter(grpc_channel_stack_type type,
+                             SourceLocation registration_source = {}) {
+      fusions_[type].push_back(Fusion{
+          Fused::FilterNames(),
+          [](InterceptionChainBuilder& builder) { builder.Add<Fused>(); },
+          registration_source});
+    }
+
     // Register a post processor for the builder.
     // These run after the main graph has been placed into the builder.
     // At most one filter per slot per channel stack type can be added.
@@ -343,6 +368,7 @@ class ChannelInit {
         filters_[GRPC_NUM_CHANNEL_STACK_TYPES];
     PostProcessor post_processors_[GRPC_NUM_CHANNEL_STACK_TYPES]
                                   [static_cast<int>(PostProcessorSlot::kCount)];
+    std::vector<Fusion> fusions_[GRPC_NUM_CHANNEL_STACK_TYPES];
   };
 
   /// Construct a channel stack of some sort: see channel_stack.h for details
@@ -386,10 +412,16 @@ class ChannelInit {
     std::vector<Filter> filters;
     std::vector<Filter> terminators;
     std::vector<PostProcessor> post_processors;
+    // Longest first, so that the biggest fusion that applies wins.
+    std::vector<Fusion> fusions;
   };
 
   StackConfig stack_configs_[GRPC_NUM_CHANNEL_STACK_TYPES];
 
+  // The longest fusion that replaces the filters starting at filters[start].
+  static const Fusion* FindFusion(const std::vector<Fusion>& fusions,
+                                  absl::Span<const Filter* const> filters,
+                                  size_t start);
   static StackConfig BuildStackConfig(
       const std::vector<std::unique_ptr<FilterRegistration>>& registrations,
       PostProcessor* post_processors, grpc_channel_stack_type type);
@@ -38,6 +38,7 @@
 #include "absl/strings/str_format.h"
 #include "absl/strings/str_join.h"
 #include "src/core/lib/event_engine/shim.h"
+#include "src/core/lib/event_engine/thread_local.h"
 #include "src/core/lib/iomgr/closure.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/iomgr/pollset.h"
@@ -296,6 +297,9 @@ class CqEventQueue {
 
   bool Push(grpc_cq_completion* c);
   grpc_cq_completion* Pop();
+  // Pops up to max_items completions into items under a single acquisition
+  // of the consumer lock, returning how many were popped.
+  size_t PopBatch(grpc_cq_completion** items, size_t max_items);
 
  private:
   // Spinlock to serialize consumers i.e pop() operations
@@ -401,6 +405,9 @@ struct cq_callback_data {
   grpc_completion_queue_functor* shutdown_callback;
 
   std::shared_ptr<grpc_event_engine::experimental::EventEngine> event_engine;
+
+  /// Set by grpc_cq_run_callbacks_inline.
+  bool run_inline = false;
 };
 
 }  // namespace
@@ -565,6 +572,27 @@ grpc_cq_completion* CqEventQueue::Pop() {
   return c;
 }
 
+size_t CqEventQueue::PopBatch(grpc_cq_completion** items, size_t max_items) {
+  size_t n = 0;
+
+  if (gpr_spinlock_trylock(&queue_lock_)) {
+    bool is_empty = false;
+    while (n < max_items) {
+      auto* c = reinterpret_cast<grpc_cq_completion*>(
+          queue_.PopAndCheckEnd(&is_empty));
+      if (c == nullptr) break;
+      items[n++] = c;
+    }
+    gpr_spinlock_unlock(&queue_lock_);
+  }
+
+  if (n > 0) {
+    num_queue_items_.fetch_sub(n, std::memory_order_relaxed);
+  }
+
+  return n;
+}
+
 grpc_completion_queue* grpc_completion_queue_create_internal(
     grpc_cq_completion_type completion_type, grpc_cq_polling_type polling_type,
     grpc_completion_queue_functor* shutdown_callback) {
@@ -907,6 +935,16 @@ static void cq_end_op_for_callback(
   }
 
   auto* functor = static_cast<grpc_completion_queue_functor*>(tag);
+  if (cqd->run_inline && grpc_core::ExecCtx::Get() != nullptr &&
+      grpc_event_engine::experimental::ThreadLocal::IsEventEngineThread()) {
+    grpc_core::ExecCtx::Run(
+        DEBUG_LOCATION,
+        grpc_core::NewClosure([functor, ok = error.ok()](grpc_error_handle) {
+          (*functor->functor_run)(functor, ok);
+        }),
+        absl::OkStatus());
+    return;
+  }
   cqd->event_engine->Run(
       [engine = cqd->event_engine, functor, ok = error.ok()]() {
         grpc_core::ExecCtx exec_ctx;
@@ -914,6 +952,11 @@ static void cq_end_op_for_callback(
       });
 }
 
+void grpc_cq_run_callbacks_inline(grpc_completion_queue* cq) {
+  CHECK_EQ(cq->vtable->cq_completion_type, GRPC_CQ_CALLBACK);
+  static_cast<cq_callback_data*> DATA_FROM_CQ(cq)->run_inline = true;
+}
+
 void grpc_cq_end_op(grpc_completion_queue* cq, void* tag,
                     grpc_error_handle error,
                     void (*done)(void* done_arg, grpc_cq_completion* storage),
@@ -1153,6 +1196,39 @@ grpc_event grpc_completion_queue_next(grpc_completion_queue* cq,
   return cq->vtable->next(cq, deadline, reserved);
 }
 
+int grpc_completion_queue_next_batch(grpc_completion_queue* cq,
+                                     grpc_event* events, int max_events,
+                                     gpr_timespec deadline, void* reserved) {
+  CHECK_EQ(cq->vtable->cq_completion_type, GRPC_CQ_NEXT);
+  CHECK_GT(max_events, 0);
+  events[0] = cq_next(cq, deadline, reserved);
+  if (events[0].type != GRPC_OP_COMPLETE || max_events == 1) return 1;
+
+  // Take whatever else is already queued without polling again.
+  cq_next_data* cqd = static_cast<cq_next_data*> DATA_FROM_CQ(cq);
+  GRPC_CQ_INTERNAL_REF(cq, "next_batch");
+  grpc_core::ExecCtx exec_ctx;
+  constexpr size_t kMaxPopBatch = 32;
+  grpc_cq_completion* completions[kMaxPopBatch];
+  int num_events = 1;
+  while (num_events < max_events) {
+    size_t n = cqd->queue.PopBatch(
+        completions, std::min<size_t>(kMaxPopBatch, max_events - num_events));
+    for (size_t i = 0; i < n; ++i) {
+      grpc_cq_completion* c = completions[i];
+      grpc_event* ev = &events[num_events++];
+      ev->type = GRPC_OP_COMPLETE;
+      ev->success = c->next & 1u;
+      ev->tag = c->tag;
+      c->done(c->done_arg, c);
+      GRPC_SURFACE_TRACE_RETURNED_EVENT(cq, ev);
+    }
+    if (n < kMaxPopBatch) break;
+  }
+  GRPC_CQ_INTERNAL_UNREF(cq, "next_batch");
+  return num_events;
+}
+
 static int add_plucker(grpc_completion_queue* cq, void* tag,
                        grpc_pollset_worker** worker) {
   cq_pluck_data* cqd = static_cast<cq_pluck_data*> DATA_FROM_CQ(cq);
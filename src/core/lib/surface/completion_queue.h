@@ -75,6 +75,14 @@ void grpc_cq_end_op(grpc_completion_queue* cq, void* tag,
                     void* done_arg, grpc_cq_completion* storage,
                     bool internal = false);
 
+// Makes a GRPC_CQ_CALLBACK completion queue run the callbacks of operations
+// that complete on an EventEngine thread on that same thread, once its
+// current ExecCtx is flushed, rather than handing them to the EventEngine.
+// Callbacks for operations completed elsewhere still go to the EventEngine,
+// so they never run inside an application's call into gRPC.  Must be called
+// before any operation is started on cq.
+void grpc_cq_run_callbacks_inline(grpc_completion_queue* cq);
+
 grpc_pollset* grpc_cq_pollset(grpc_completion_queue* cq);
 
 bool grpc_cq_can_listen(grpc_completion_queue* cq);
@@ -0,0 +1,153 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/surface/deadline_sweeper.h"
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/util/no_destruct.h"
+
+namespace grpc_core {
+
+using grpc_event_engine::experimental::EventEngine;
+
+DeadlineSweeper* DeadlineSweeper::Get() {
+  static NoDestruct<DeadlineSweeper> sweeper;
+  return sweeper.get();
+}
+
+void DeadlineSweeper::Arm(Entry* entry, Timestamp now) {
+  entry->armed_ = true;
+  entry->task_ =
+      entry->event_engine_->RunAfter(entry->deadline_ - now, entry->closure_);
+}
+
+void DeadlineSweeper::SiftUp(Shard* shard, size_t index) {
+  std::vector<Entry*>& queue = shard->queue;
+  Entry* entry = queue[index];
+  while (index > 0) {
+    const size_t parent = (index - 1) / 2;
+    if (queue[parent]->deadline_ <= entry->deadline_) break;
+    queue[index] = queue[parent];
+    queue[index]->queue_index_ = index;
+    index = parent;
+  }
+  queue[index] = entry;
+  entry->queue_index_ = index;
+}
+
+void DeadlineSweeper::SiftDown(Shard* shard, size_t index) {
+  std::vector<Entry*>& queue = shard->queue;
+  Entry* entry = queue[index];
+  while (true) {
+    size_t child = 2 * index + 1;
+    if (child >= queue.size()) break;
+    if (child + 1 < queue.size() &&
+        queue[child + 1]->deadline_ < queue[child]->deadline_) {
+      ++child;
+    }
+    if (entry->deadline_ <= queue[child]->deadline_) break;
+    queue[index] = queue[child];
+    queue[index]->queue_index_ = index;
+    index = child;
+  }
+  queue[index] = entry;
+  entry->queue_index_ = index;
+}
+
+void DeadlineSweeper::Push(Shard* shard, Entry* entry) {
+  shard->queue.push_back(entry);
+  SiftUp(shard, shard->queue.size() - 1);
+}
+
+void DeadlineSweeper::Remove(Shard* shard, Entry* entry) {
+  std::vector<Entry*>& queue = shard->queue;
+  const size_t index = entry->queue_index_;
+  Entry* last = queue.back();
+  queue.pop_back();
+  if (last == entry) return;
+  // Put the last entry in the hole, and restore the order from there.
+  queue[index] = last;
+  last->queue_index_ = index;
+  if (index > 0 && last->deadline_ < queue[(index - 1) / 2]->deadline_) {
+    SiftUp(shard, index);
+  } else {
+    SiftDown(shard, index);
+  }
+}
+
+void DeadlineSweeper::Schedule(Entry* entry, Timestamp deadline,
+                               EventEngine* event_engine,
+                               EventEngine::Closure* closure) {
+  Shard* shard = &shards_.this_cpu();
+  entry->shard_ = shard;
+  entry->deadline_ = deadline;
+  entry->event_engine_ = event_engine;
+  entry->closure_ = closure;
+  MutexLock lock(&shard->mu);
+  const Timestamp now = Timestamp::Now();
+  if (deadline - now < kArmLead) {
+    Arm(entry, now);
+    return;
+  }
+  entry->armed_ = false;
+  Push(shard, entry);
+  if (shard->sweep_engine == nullptr) ScheduleSweep(shard);
+}
+
+bool DeadlineSweeper::Cancel(Entry* entry) {
+  Shard* shard = entry->shard_;
+  MutexLock lock(&shard->mu);
+  if (entry->armed_) {
+    entry->armed_ = false;
+    return entry->event_engine_->Cancel(entry->task_);
+  }
+  Remove(shard, entry);
+  if (shard->sweep_engine == nullptr) return true;
+  if (shard->queue.empty()) {
+    // If this fails the sweep is already running, and finds nothing to do.
+    if (shard->sweep_engine->Cancel(shard->sweep_task)) {
+      shard->sweep_engine = nullptr;
+    }
+  } else if (shard->sweep_engine == entry->event_engine_ &&
+             shard->queue.front()->event_engine_ != entry->event_engine_) {
+    // The sweep must not outlive the calls on the EventEngine it is scheduled
+    // on: move it to that of a call that is still waiting.
+    if (shard->sweep_engine->Cancel(shard->sweep_task)) {
+      ScheduleSweep(shard);
+    }
+  }
+  return true;
+}
+
+void DeadlineSweeper::ScheduleSweep(Shard* shard) {
+  shard->sweep_engine = shard->queue.front()->event_engine_;
+  shard->sweep_task = shard->sweep_engine->RunAfter(
+      kSweepPeriod, [this, shard]() { Sweep(shard); });
+}
+
+void DeadlineSweeper::Sweep(Shard* shard) {
+  MutexLock lock(&shard->mu);
+  shard->sweep_engine = nullptr;
+  const Timestamp now = Timestamp::Now();
+  while (!shard->queue.empty() &&
+         shard->queue.front()->deadline_ - now < kArmLead) {
+    Entry* entry = shard->queue.front();
+    Remove(shard, entry);
+    Arm(entry, now);
+  }
+  if (!shard->queue.empty()) ScheduleSweep(shard);
+}
+
+}  // namespace grpc_core
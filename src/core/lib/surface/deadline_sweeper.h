@@ -0,0 +1,110 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_SURFACE_DEADLINE_SWEEPER_H
+#define GRPC_SRC_CORE_LIB_SURFACE_DEADLINE_SWEEPER_H
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+
+#include <stddef.h>
+
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "src/core/util/per_cpu.h"
+#include "src/core/util/sync.h"
+#include "src/core/util/time.h"
+
+namespace grpc_core {
+
+// Arms call deadline timers lazily.
+//
+// Almost all calls finish well within their deadline, so arming an
+// EventEngine timer for each of them and cancelling it again shortly after is
+// mostly wasted work. Instead, calls whose deadline is further out than
+// kArmLead are put on a per-cpu queue ordered by deadline that is swept every
+// kSweepPeriod, and a sweep only arms the timers of the calls whose deadline
+// has come within kArmLead. Calls that finish before then never touch the
+// timer system. Adding and removing a call is O(log n) in the number of
+// waiting calls, and a sweep only visits the calls it arms.
+class DeadlineSweeper {
+ private:
+  struct Shard;
+
+ public:
+  static constexpr Duration kSweepPeriod = Duration::Milliseconds(100);
+  // Twice the sweep period, so that a sweep that runs a little late still
+  // arms timers before they are due.
+  static constexpr Duration kArmLead = Duration::Milliseconds(200);
+
+  // Per-call state. Owned by the call, accessed by the sweeper under the lock
+  // of the shard it is scheduled on.
+  class Entry {
+   private:
+    friend class DeadlineSweeper;
+
+    Shard* shard_ = nullptr;
+    // Position in the shard's queue.
+    size_t queue_index_ = 0;
+    // Whether task_ is an EventEngine timer; otherwise the entry is on its
+    // shard's queue.
+    bool armed_ = false;
+    Timestamp deadline_;
+    grpc_event_engine::experimental::EventEngine* event_engine_ = nullptr;
+    grpc_event_engine::experimental::EventEngine::Closure* closure_ = nullptr;
+    grpc_event_engine::experimental::EventEngine::TaskHandle task_;
+  };
+
+  static DeadlineSweeper* Get();
+
+  // Run \a closure on \a event_engine at \a deadline, unless cancelled first.
+  // \a entry must not already be scheduled.
+  void Schedule(Entry* entry, Timestamp deadline,
+                grpc_event_engine::experimental::EventEngine* event_engine,
+                grpc_event_engine::experimental::EventEngine::Closure* closure);
+  // Returns false if the closure has already run or is about to.
+  bool Cancel(Entry* entry);
+
+ private:
+  struct Shard {
+    Mutex mu;
+    // Binary min-heap of the waiting entries, ordered by deadline.
+    std::vector<Entry*> queue ABSL_GUARDED_BY(mu);
+    // The EventEngine the next sweep is scheduled on, or nullptr if none is.
+    grpc_event_engine::experimental::EventEngine* sweep_engine
+        ABSL_GUARDED_BY(mu) = nullptr;
+    grpc_event_engine::experimental::EventEngine::TaskHandle sweep_task
+        ABSL_GUARDED_BY(mu);
+  };
+
+  static void Arm(Entry* entry, Timestamp now);
+  static void Push(Shard* shard, Entry* entry)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(shard->mu);
+  static void Remove(Shard* shard, Entry* entry)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(shard->mu);
+  // Move the entry at index up or down the queue until it is in order.
+  static void SiftUp(Shard* shard, size_t index)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(shard->mu);
+  static void SiftDown(Shard* shard, size_t index)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(shard->mu);
+  void ScheduleSweep(Shard* shard) ABSL_EXCLUSIVE_LOCKS_REQUIRED(shard->mu);
+  void Sweep(Shard* shard);
+
+  PerCpu<Shard> shards_{PerCpuOptions().SetMaxShards(16)};
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LIB_SURFACE_DEADLINE_SWEEPER_H
@@ -923,7 +923,7 @@ grpc_call_error FilterStackCall::StartBatch(const grpc_op* ops, size_t nops,
         if (op->data.send_status_from_server.status_details != nullptr) {
           send_trailing_metadata_.Set(
               GrpcMessageMetadata(),
-              Slice(grpc_slice_copy(
+              GrpcMessageMetadata::FromString(StringViewFromSlice(
                   *op->data.send_status_from_server.status_details)));
           if (!status_error.ok()) {
             status_error = grpc_error_set_str(
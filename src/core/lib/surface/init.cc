@@ -46,6 +46,7 @@
 #include "src/core/lib/surface/channel_stack_type.h"
 #include "src/core/lib/surface/init_internally.h"
 #include "src/core/util/fork.h"
+#include "src/core/util/http_client/httpcli.h"
 #include "src/core/util/sync.h"
 #include "src/core/util/thd.h"
 
@@ -146,6 +147,7 @@ void grpc_shutdown_internal_locked(void)
   {
     grpc_core::ExecCtx exec_ctx(0);
     grpc_iomgr_shutdown_background_closure();
+    grpc_core::HttpRequest::ShutdownConnectionPool();
     grpc_timer_manager_set_threading(false);  // shutdown timer_manager thread
     if (grpc_core::IsEventEngineDnsEnabled()) {
       address_sorting_shutdown();
@@ -26,21 +26,11 @@
 #include "src/core/lib/iomgr/error.h"
 #include "src/core/lib/slice/slice_internal.h"
 #include "src/core/util/bitset.h"
+#include "src/core/util/byte_scan.h"
 
 namespace grpc_core {
 
 namespace {
-class LegalHeaderKeyBits : public BitSet<256> {
- public:
-  constexpr LegalHeaderKeyBits() {
-    for (int i = 'a'; i <= 'z'; i++) set(i);
-    for (int i = '0'; i <= '9'; i++) set(i);
-    set('-');
-    set('_');
-    set('.');
-  }
-};
-constexpr LegalHeaderKeyBits g_legal_header_key_bits;
 
 ValidateMetadataResult ConformsTo(absl::string_view x,
                                   const BitSet<256>& legal_bits,
@@ -67,7 +57,7 @@ ValidateMetadataResult ValidateHeaderKeyIsLegal(absl::string_view key) {
   if (key.size() > UINT32_MAX) {
     return ValidateMetadataResult::kTooLong;
   }
-  return ConformsTo(key, g_legal_header_key_bits,
+  return ConformsTo(key, validate_metadata_detail::kLegalHeaderKeyBits,
                     ValidateMetadataResult::kIllegalHeaderKey);
 }
 
@@ -103,23 +93,14 @@ int grpc_header_key_is_legal(grpc_slice slice) {
   return error2int(grpc_validate_header_key_is_legal(slice));
 }
 
-namespace {
-class LegalHeaderNonBinValueBits : public grpc_core::BitSet<256> {
- public:
-  constexpr LegalHeaderNonBinValueBits() {
-    for (int i = 32; i <= 126; i++) {
-      set(i);
-    }
-  }
-};
-constexpr LegalHeaderNonBinValueBits g_legal_header_non_bin_value_bits;
-}  // namespace
-
 grpc_error_handle grpc_validate_header_nonbin_value_is_legal(
     const grpc_slice& slice) {
-  return grpc_core::UpgradeToStatus(grpc_core::ConformsTo(
-      grpc_core::StringViewFromSlice(slice), g_legal_header_non_bin_value_bits,
-      grpc_core::ValidateMetadataResult::kIllegalHeaderValue));
+  // Legal values are printable ASCII throughout.
+  const absl::string_view value = grpc_core::StringViewFromSlice(slice);
+  return grpc_core::UpgradeToStatus(
+      grpc_core::PrintableAsciiPrefixLength(value) == value.size()
+          ? grpc_core::ValidateMetadataResult::kOk
+          : grpc_core::ValidateMetadataResult::kIllegalHeaderValue);
 }
 
 int grpc_header_nonbin_value_is_legal(grpc_slice slice) {
@@ -28,6 +28,7 @@
 #include "absl/log/check.h"
 #include "absl/strings/string_view.h"
 #include "src/core/lib/iomgr/error.h"
+#include "src/core/util/bitset.h"
 
 namespace grpc_core {
 
@@ -44,6 +45,26 @@ const char* ValidateMetadataResultToString(ValidateMetadataResult result);
 // Returns nullopt if the key is legal, otherwise returns an error message.
 ValidateMetadataResult ValidateHeaderKeyIsLegal(absl::string_view key);
 
+namespace validate_metadata_detail {
+class LegalHeaderKeyBits : public BitSet<256> {
+ public:
+  constexpr LegalHeaderKeyBits() {
+    for (int i = 'a'; i <= 'z'; i++) set(i);
+    for (int i = '0'; i <= '9'; i++) set(i);
+    set('-');
+    set('_');
+    set('.');
+  }
+};
+inline constexpr LegalHeaderKeyBits kLegalHeaderKeyBits;
+}  // namespace validate_metadata_detail
+
+// Returns true if \a c may appear in a header key, for callers that check a
+// key byte by byte as they produce it.
+inline bool IsLegalHeaderKeyByte(uint8_t c) {
+  return validate_metadata_detail::kLegalHeaderKeyBits.is_set(c);
+}
+
 }  // namespace grpc_core
 
 grpc_error_handle grpc_validate_header_key_is_legal(const grpc_slice& slice);
@@ -22,6 +22,7 @@
 #include <grpc/support/time.h>
 
 #include <limits>
+#include <optional>
 
 #include "absl/base/attributes.h"
 #include "absl/log/check.h"
@@ -43,6 +44,28 @@ bool IsAllSpace(const uint8_t* p, const uint8_t* end) {
   return p == end;
 }
 
+// Returns the timeout of \a x in the unit given by the specifier \a unit.
+std::optional<Duration> DurationFromUnit(int32_t x, uint8_t unit) {
+  switch (unit) {
+    case 'n':
+      return Duration::Milliseconds((x / GPR_NS_PER_MS) +
+                                    (x % GPR_NS_PER_MS != 0));
+    case 'u':
+      return Duration::Milliseconds((x / GPR_US_PER_MS) +
+                                    (x % GPR_US_PER_MS != 0));
+    case 'm':
+      return Duration::Milliseconds(x);
+    case 'S':
+      return Duration::Seconds(x);
+    case 'M':
+      return Duration::Minutes(x);
+    case 'H':
+      return Duration::Hours(x);
+    default:
+      return std::nullopt;
+  }
+}
+
 }  // namespace
 
 Timeout Timeout::FromDuration(Duration duration) {
@@ -230,9 +253,24 @@ Timeout Timeout::FromHours(int64_t hours) {
 }
 
 std::optional<Duration> ParseTimeout(const Slice& text) {
-  int32_t x = 0;
   const uint8_t* p = text.begin();
   const uint8_t* end = text.end();
+  // Fast path for the form that peers send: up to 8 digits directly
+  // followed by the unit. Eight digits cannot overflow, so they need no range
+  // checks, and there is no whitespace to skip.
+  if (const size_t length = end - p; length >= 2 && length <= 9) {
+    const uint8_t* unit = end - 1;
+    int32_t x = 0;
+    const uint8_t* q = p;
+    for (; q != unit; q++) {
+      const uint32_t digit = static_cast<uint32_t>(*q) - '0';
+      if (digit > 9) break;
+      x = x * 10 + static_cast<int32_t>(digit);
+    }
+    // Anything else, e.g. with whitespace, takes the general path.
+    if (q == unit) return DurationFromUnit(x, *unit);
+  }
+  int32_t x = 0;
   int have_digit = 0;
   // skip whitespace
   for (; p != end && *p == ' '; p++) {
@@ -255,31 +293,8 @@ std::optional<Duration> ParseTimeout(const Slice& text) {
   }
   if (p == end) return std::nullopt;
   // decode unit specifier
-  Duration timeout;
-  switch (*p) {
-    case 'n':
-      timeout = Duration::Milliseconds((x / GPR_NS_PER_MS) +
-                                       (x % GPR_NS_PER_MS != 0));
-      break;
-    case 'u':
-      timeout = Duration::Milliseconds((x / GPR_US_PER_MS) +
-                                       (x % GPR_US_PER_MS != 0));
-      break;
-    case 'm':
-      timeout = Duration::Milliseconds(x);
-      break;
-    case 'S':
-      timeout = Duration::Seconds(x);
-      break;
-    case 'M':
-      timeout = Duration::Minutes(x);
-      break;
-    case 'H':
-      timeout = Duration::Hours(x);
-      break;
-    default:
-      return std::nullopt;
-  }
+  std::optional<Duration> timeout = DurationFromUnit(x, *p);
+  if (!timeout.has_value()) return std::nullopt;
   p++;
   if (!IsAllSpace(p, end)) return std::nullopt;
   return timeout;
@@ -19,9 +19,11 @@
 #include <grpc/support/port_platform.h>
 #include <stddef.h>
 
+#include <algorithm>
+#include <map>
 #include <utility>
+#include <vector>
 
-#include "absl/functional/function_ref.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/iomgr/resolved_address.h"
 #include "src/core/util/ref_counted_ptr.h"
@@ -43,63 +45,45 @@ int HierarchicalPathArg::ChannelArgsCompare(const HierarchicalPathArg* a,
   return 0;
 }
 
-namespace {
-
-class HierarchicalAddressIterator final : public EndpointAddressesIterator {
- public:
-  HierarchicalAddressIterator(
-      std::shared_ptr<EndpointAddressesIterator> parent_it,
-      RefCountedStringValue child_name)
-      : parent_it_(std::move(parent_it)), child_name_(std::move(child_name)) {}
-
-  void ForEach(absl::FunctionRef<void(const EndpointAddresses&)> callback)
-      const override {
-    RefCountedPtr<HierarchicalPathArg> remaining_path_attr;
-    parent_it_->ForEach([&](const EndpointAddresses& endpoint) {
-      const auto* path_arg = endpoint.args().GetObject<HierarchicalPathArg>();
-      if (path_arg == nullptr) return;
-      const std::vector<RefCountedStringValue>& path = path_arg->path();
-      auto it = path.begin();
-      if (it == path.end()) return;
-      if (*it != child_name_) return;
-      ChannelArgs args = endpoint.args();
-      ++it;
-      if (it != path.end()) {
-        std::vector<RefCountedStringValue> remaining_path(it, path.end());
-        if (remaining_path_attr == nullptr ||
-            remaining_path_attr->path() != remaining_path) {
-          remaining_path_attr =
-              MakeRefCounted<HierarchicalPathArg>(std::move(remaining_path));
-        }
-        args = args.SetObject(remaining_path_attr);
-      }
-      callback(EndpointAddresses(endpoint.addresses(), args));
-    });
-  }
-
- private:
-  std::shared_ptr<EndpointAddressesIterator> parent_it_;
-  RefCountedStringValue child_name_;
-};
-
-}  // namespace
-
 absl::StatusOr<HierarchicalAddressMap> MakeHierarchicalAddressMap(
     absl::StatusOr<std::shared_ptr<EndpointAddressesIterator>> addresses) {
   if (!addresses.ok()) return addresses.status();
-  HierarchicalAddressMap result;
+  // Each child's endpoints are collected in a single pass over the parent
+  // and then shared by every update sent to the child. Filtering lazily
+  // instead would make each child walk, and each level of the hierarchy
+  // rebuild, the whole parent list every time it iterates.
+  struct Child {
+    EndpointAddressesList endpoints;
+    // Endpoints of a locality arrive together and share a remaining path,
+    // so remembering the last one avoids an attribute per endpoint.
+    RefCountedPtr<HierarchicalPathArg> remaining_path_attr;
+  };
+  std::map<RefCountedStringValue, Child, RefCountedStringValueLessThan>
+      children;
   (*addresses)->ForEach([&](const EndpointAddresses& endpoint) {
     const auto* path_arg = endpoint.args().GetObject<HierarchicalPathArg>();
     if (path_arg == nullptr) return;
     const std::vector<RefCountedStringValue>& path = path_arg->path();
-    auto it = path.begin();
-    if (it == path.end()) return;
-    auto& target_list = result[*it];
-    if (target_list == nullptr) {
-      target_list =
-          std::make_shared<HierarchicalAddressIterator>(*addresses, *it);
+    if (path.empty()) return;
+    Child& child = children[path.front()];
+    ChannelArgs args = endpoint.args();
+    if (path.size() > 1) {
+      if (child.remaining_path_attr == nullptr ||
+          !std::equal(child.remaining_path_attr->path().begin(),
+                      child.remaining_path_attr->path().end(),
+                      path.begin() + 1, path.end())) {
+        child.remaining_path_attr = MakeRefCounted<HierarchicalPathArg>(
+            std::vector<RefCountedStringValue>(path.begin() + 1, path.end()));
+      }
+      args = args.SetObject(child.remaining_path_attr);
     }
+    child.endpoints.emplace_back(endpoint.addresses(), std::move(args));
   });
+  HierarchicalAddressMap result;
+  for (auto& [name, child] : children) {
+    result.emplace(name, std::make_shared<EndpointAddressesListIterator>(
+                             std::move(child.endpoints)));
+  }
   return result;
 }
 
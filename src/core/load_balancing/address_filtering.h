@@ -108,7 +108,8 @@ using HierarchicalAddressMap =
     std::map<RefCountedStringValue, std::shared_ptr<EndpointAddressesIterator>,
              RefCountedStringValueLessThan>;
 
-// Splits up the addresses into a separate list for each child.
+// Splits up the addresses into a separate list for each child, in a single
+// pass over \a addresses.
 absl::StatusOr<HierarchicalAddressMap> MakeHierarchicalAddressMap(
     absl::StatusOr<std::shared_ptr<EndpointAddressesIterator>> addresses);
 
@@ -31,6 +31,8 @@ namespace grpc_core {
 
 namespace {
 
+constexpr size_t kInitialArenaBlockSize = 1024;
+
 std::map<absl::string_view, double> ParseMap(
     xds_data_orca_v3_OrcaLoadReport* msg,
     bool (*upb_next_func)(const xds_data_orca_v3_OrcaLoadReport* msg,
@@ -53,7 +55,11 @@ std::map<absl::string_view, double> ParseMap(
 const BackendMetricData* ParseBackendMetricData(
     absl::string_view serialized_load_report,
     BackendMetricAllocatorInterface* allocator) {
-  upb::Arena upb_arena;
+  // This runs for every call that gets a load report in its trailers, so
+  // parse into a block on the stack.  Typical reports fit; larger ones
+  // spill over into heap blocks as usual.
+  char initial_block[kInitialArenaBlockSize];
+  upb::Arena upb_arena(initial_block, sizeof(initial_block));
   xds_data_orca_v3_OrcaLoadReport* msg = xds_data_orca_v3_OrcaLoadReport_parse(
       serialized_load_report.data(), serialized_load_report.size(),
       upb_arena.ptr());
@@ -21,6 +21,7 @@
 #include <grpc/support/port_platform.h>
 #include <stdlib.h>
 
+#include <algorithm>
 #include <memory>
 #include <optional>
 #include <utility>
@@ -67,8 +68,23 @@ class EndpointList::Endpoint::Helper final
       grpc_connectivity_state state, const absl::Status& status,
       RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> picker) override {
     auto old_state = std::exchange(endpoint_->connectivity_state_, state);
+    auto* endpoint_list = endpoint_->endpoint_list_.get();
     if (!old_state.has_value()) {
-      ++endpoint_->endpoint_list_->num_endpoints_seen_initial_state_;
+      ++endpoint_list->num_endpoints_seen_initial_state_;
+    }
+    const bool was_ready = old_state == GRPC_CHANNEL_READY;
+    const bool is_ready = state == GRPC_CHANNEL_READY;
+    if (was_ready != is_ready) {
+      auto& ready = endpoint_list->ready_endpoints_;
+      auto it = std::lower_bound(ready.begin(), ready.end(), endpoint_->index_,
+                                 [](const Endpoint* e, size_t index) {
+                                   return e->index_ < index;
+                                 });
+      if (is_ready) {
+        ready.insert(it, endpoint_.get());
+      } else if (it != ready.end() && *it == endpoint_.get()) {
+        ready.erase(it);
+      }
     }
     endpoint_->picker_ = std::move(picker);
     endpoint_->OnStateUpdate(old_state, state, status);
@@ -143,12 +159,7 @@ void EndpointList::Endpoint::ExitIdleLocked() {
   if (child_policy_ != nullptr) child_policy_->ExitIdleLocked();
 }
 
-size_t EndpointList::Endpoint::Index() const {
-  for (size_t i = 0; i < endpoint_list_->endpoints_.size(); ++i) {
-    if (endpoint_list_->endpoints_[i].get() == this) return i;
-  }
-  return -1;
-}
+size_t EndpointList::Endpoint::Index() const { return index_; }
 
 RefCountedPtr<SubchannelInterface> EndpointList::Endpoint::CreateSubchannel(
     const grpc_resolved_address& address, const ChannelArgs& per_address_args,
@@ -123,7 +123,8 @@ class EndpointList : public InternallyRefCounted<EndpointList> {
     // initialized before we need to use it.  Subclass must invoke Init()
     // from inside its ctor.
     explicit Endpoint(RefCountedPtr<EndpointList> endpoint_list)
-        : endpoint_list_(std::move(endpoint_list)) {}
+        : endpoint_list_(std::move(endpoint_list)),
+          index_(endpoint_list_->endpoints_.size()) {}
 
     absl::Status Init(const EndpointAddresses& addresses,
                       const ChannelArgs& args,
@@ -161,6 +162,7 @@ class EndpointList : public InternallyRefCounted<EndpointList> {
         const ChannelArgs& per_address_args, const ChannelArgs& args);
 
     RefCountedPtr<EndpointList> endpoint_list_;
+    const size_t index_;  // Index of this endpoint within the EndpointList.
 
     OrphanablePtr<LoadBalancingPolicy> child_policy_;
     std::optional<grpc_connectivity_state> connectivity_state_;
@@ -170,6 +172,7 @@ class EndpointList : public InternallyRefCounted<EndpointList> {
   ~EndpointList() override { policy_.reset(DEBUG_LOCATION, "EndpointList"); }
 
   void Orphan() override {
+    ready_endpoints_.clear();
     endpoints_.clear();
     Unref();
   }
@@ -180,6 +183,13 @@ class EndpointList : public InternallyRefCounted<EndpointList> {
     return endpoints_;
   }
 
+  // The endpoints currently reporting READY, in list order.  Kept up to
+  // date as each endpoint reports its state, so that building a picker
+  // does not need to look at the endpoints that are not READY.
+  const std::vector<Endpoint*>& ready_endpoints() const {
+    return ready_endpoints_;
+  }
+
   void ResetBackoffLocked();
 
   void ReportTransientFailure(absl::Status status);
@@ -223,6 +233,7 @@ class EndpointList : public InternallyRefCounted<EndpointList> {
   std::string resolution_note_;
   const char* tracer_;
   std::vector<OrphanablePtr<Endpoint>> endpoints_;
+  std::vector<Endpoint*> ready_endpoints_;
   size_t num_endpoints_seen_initial_state_ = 0;
 };
 
@@ -389,12 +389,12 @@ class GrpcLb final : public LoadBalancingPolicy {
     // no backend address entries.
     bool ContainsAllDropEntries() const;
 
-    // Returns the LB token to use for a drop, or null if the call
-    // should not be dropped.
+    // Returns the index of the drop entry to use for a drop, or nullopt if
+    // the call should not be dropped.
     //
     // Note: This is called from the picker, NOT from inside the control
     // plane work_serializer.
-    const char* ShouldDrop();
+    std::optional<size_t> ShouldDrop();
 
    private:
     class AddressIterator;
@@ -409,10 +409,7 @@ class GrpcLb final : public LoadBalancingPolicy {
    public:
     Picker(RefCountedPtr<Serverlist> serverlist,
            RefCountedPtr<SubchannelPicker> child_picker,
-           RefCountedPtr<GrpcLbClientStats> client_stats)
-        : serverlist_(std::move(serverlist)),
-          child_picker_(std::move(child_picker)),
-          client_stats_(std::move(client_stats)) {}
+           RefCountedPtr<GrpcLbClientStats> client_stats);
 
     PickResult Pick(PickArgs args) override;
 
@@ -455,6 +452,9 @@ class GrpcLb final : public LoadBalancingPolicy {
 
     RefCountedPtr<SubchannelPicker> child_picker_;
     RefCountedPtr<GrpcLbClientStats> client_stats_;
+    // Ids of the drop tokens in serverlist_, indexed like the serverlist,
+    // if client_stats_ is set.
+    std::vector<GrpcLbClientStats::DropTokenId> drop_token_ids_;
   };
 
   class Helper final
@@ -724,29 +724,49 @@ bool GrpcLb::Serverlist::ContainsAllDropEntries() const {
   return true;
 }
 
-const char* GrpcLb::Serverlist::ShouldDrop() {
-  if (serverlist_.empty()) return nullptr;
-  size_t index = drop_index_.fetch_add(1, std::memory_order_relaxed);
-  GrpcLbServer& server = serverlist_[index % serverlist_.size()];
-  return server.drop ? server.load_balance_token : nullptr;
+std::optional<size_t> GrpcLb::Serverlist::ShouldDrop() {
+  if (serverlist_.empty()) return std::nullopt;
+  size_t index =
+      drop_index_.fetch_add(1, std::memory_order_relaxed) % serverlist_.size();
+  if (!serverlist_[index].drop) return std::nullopt;
+  return index;
 }
 
 //
 // GrpcLb::Picker
 //
 
+GrpcLb::Picker::Picker(RefCountedPtr<Serverlist> serverlist,
+                       RefCountedPtr<SubchannelPicker> child_picker,
+                       RefCountedPtr<GrpcLbClientStats> client_stats)
+    : serverlist_(std::move(serverlist)),
+      child_picker_(std::move(child_picker)),
+      client_stats_(std::move(client_stats)) {
+  // Intern the drop tokens up front, so that recording a drop is lock-free.
+  if (serverlist_ != nullptr && client_stats_ != nullptr) {
+    drop_token_ids_.reserve(serverlist_->serverlist().size());
+    for (const GrpcLbServer& server : serverlist_->serverlist()) {
+      GrpcLbClientStats::DropTokenId id = 0;
+      if (server.drop) {
+        id = client_stats_->InternDropToken(server.load_balance_token);
+      }
+      drop_token_ids_.push_back(id);
+    }
+  }
+}
+
 GrpcLb::PickResult GrpcLb::Picker::Pick(PickArgs args) {
   // Check if we should drop the call.
-  const char* drop_token =
-      serverlist_ == nullptr ? nullptr : serverlist_->ShouldDrop();
-  if (drop_token != nullptr) {
+  std::optional<size_t> drop_index =
+      serverlist_ == nullptr ? std::nullopt : serverlist_->ShouldDrop();
+  if (drop_index.has_value()) {
     // Update client load reporting stats to indicate the number of
     // dropped calls.  Note that we have to do this here instead of in
     // the client_load_reporting filter, because we do not create a
     // subchannel call (and therefore no client_load_reporting filter)
     // for dropped calls.
     if (client_stats_ != nullptr) {
-      client_stats_->AddCallDropped(drop_token);
+      client_stats_->AddCallDropped(drop_token_ids_[*drop_index]);
     }
     return PickResult::Drop(
         absl::UnavailableError("drop directed by grpclb balancer"));
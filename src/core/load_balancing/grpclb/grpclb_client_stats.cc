@@ -18,71 +18,106 @@
 
 #include "src/core/load_balancing/grpclb/grpclb_client_stats.h"
 
-#include <grpc/support/atm.h>
 #include <grpc/support/port_platform.h>
 #include <grpc/support/string_util.h>
-#include <string.h>
+
+#include <algorithm>
+#include <memory>
+#include <utility>
 
 #include "src/core/util/sync.h"
 
 namespace grpc_core {
 
 void GrpcLbClientStats::AddCallStarted() {
-  gpr_atm_full_fetch_add(&num_calls_started_, (gpr_atm)1);
+  shards_.this_cpu().num_calls_started.fetch_add(1, std::memory_order_relaxed);
 }
 
 void GrpcLbClientStats::AddCallFinished(
     bool finished_with_client_failed_to_send, bool finished_known_received) {
-  gpr_atm_full_fetch_add(&num_calls_finished_, (gpr_atm)1);
+  Shard& shard = shards_.this_cpu();
+  shard.num_calls_finished.fetch_add(1, std::memory_order_relaxed);
   if (finished_with_client_failed_to_send) {
-    gpr_atm_full_fetch_add(&num_calls_finished_with_client_failed_to_send_,
-                           (gpr_atm)1);
+    shard.num_calls_finished_with_client_failed_to_send.fetch_add(
+        1, std::memory_order_relaxed);
   }
   if (finished_known_received) {
-    gpr_atm_full_fetch_add(&num_calls_finished_known_received_, (gpr_atm)1);
+    shard.num_calls_finished_known_received.fetch_add(
+        1, std::memory_order_relaxed);
   }
 }
 
-void GrpcLbClientStats::AddCallDropped(const char* token) {
-  // Increment num_calls_started and num_calls_finished.
-  gpr_atm_full_fetch_add(&num_calls_started_, (gpr_atm)1);
-  gpr_atm_full_fetch_add(&num_calls_finished_, (gpr_atm)1);
-  // Record the drop.
+GrpcLbClientStats::DropTokenId GrpcLbClientStats::InternDropToken(
+    absl::string_view token) {
   MutexLock lock(&drop_count_mu_);
-  if (drop_token_counts_ == nullptr) {
-    drop_token_counts_ = std::make_unique<DroppedCallCounts>();
+  auto it = std::find(drop_tokens_.begin(), drop_tokens_.end(), token);
+  if (it != drop_tokens_.end()) {
+    return static_cast<DropTokenId>(it - drop_tokens_.begin());
   }
-  for (size_t i = 0; i < drop_token_counts_->size(); ++i) {
-    if (strcmp((*drop_token_counts_)[i].token.get(), token) == 0) {
-      ++(*drop_token_counts_)[i].count;
-      return;
-    }
+  drop_tokens_.emplace_back(token);
+  if (drop_tokens_.size() > kMaxShardedDropTokens) {
+    unsharded_drop_counts_.push_back(0);
   }
-  // Not found, so add a new entry.
-  drop_token_counts_->emplace_back(UniquePtr<char>(gpr_strdup(token)), 1);
+  return static_cast<DropTokenId>(drop_tokens_.size() - 1);
 }
 
-namespace {
-
-void AtomicGetAndResetCounter(int64_t* value, gpr_atm* counter) {
-  *value = static_cast<int64_t>(gpr_atm_full_xchg(counter, (gpr_atm)0));
+void GrpcLbClientStats::AddCallDropped(DropTokenId token_id) {
+  // Increment num_calls_started and num_calls_finished.
+  Shard& shard = shards_.this_cpu();
+  shard.num_calls_started.fetch_add(1, std::memory_order_relaxed);
+  shard.num_calls_finished.fetch_add(1, std::memory_order_relaxed);
+  // Record the drop.
+  if (token_id < kMaxShardedDropTokens) {
+    shard.num_drops[token_id].fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  MutexLock lock(&drop_count_mu_);
+  ++unsharded_drop_counts_[token_id - kMaxShardedDropTokens];
 }
 
-}  // namespace
-
 void GrpcLbClientStats::Get(
     int64_t* num_calls_started, int64_t* num_calls_finished,
     int64_t* num_calls_finished_with_client_failed_to_send,
     int64_t* num_calls_finished_known_received,
     std::unique_ptr<DroppedCallCounts>* drop_token_counts) {
-  AtomicGetAndResetCounter(num_calls_started, &num_calls_started_);
-  AtomicGetAndResetCounter(num_calls_finished, &num_calls_finished_);
-  AtomicGetAndResetCounter(num_calls_finished_with_client_failed_to_send,
-                           &num_calls_finished_with_client_failed_to_send_);
-  AtomicGetAndResetCounter(num_calls_finished_known_received,
-                           &num_calls_finished_known_received_);
+  *num_calls_started = 0;
+  *num_calls_finished = 0;
+  *num_calls_finished_with_client_failed_to_send = 0;
+  *num_calls_finished_known_received = 0;
+  std::array<int64_t, kMaxShardedDropTokens> num_drops{};
+  for (Shard& shard : shards_) {
+    *num_calls_started +=
+        shard.num_calls_started.exchange(0, std::memory_order_relaxed);
+    *num_calls_finished +=
+        shard.num_calls_finished.exchange(0, std::memory_order_relaxed);
+    *num_calls_finished_with_client_failed_to_send +=
+        shard.num_calls_finished_with_client_failed_to_send.exchange(
+            0, std::memory_order_relaxed);
+    *num_calls_finished_known_received +=
+        shard.num_calls_finished_known_received.exchange(
+            0, std::memory_order_relaxed);
+    for (size_t i = 0; i < kMaxShardedDropTokens; ++i) {
+      num_drops[i] += shard.num_drops[i].exchange(0, std::memory_order_relaxed);
+    }
+  }
+  drop_token_counts->reset();
   MutexLock lock(&drop_count_mu_);
-  *drop_token_counts = std::move(drop_token_counts_);
+  for (size_t i = 0; i < drop_tokens_.size(); ++i) {
+    int64_t count = 0;
+    if (i < kMaxShardedDropTokens) {
+      count = num_drops[i];
+    } else {
+      count = std::exchange(unsharded_drop_counts_[i - kMaxShardedDropTokens],
+                            0);
+    }
+    if (count == 0) continue;
+    if (*drop_token_counts == nullptr) {
+      *drop_token_counts = std::make_unique<DroppedCallCounts>();
+    }
+    (*drop_token_counts)
+        ->emplace_back(UniquePtr<char>(gpr_strdup(drop_tokens_[i].c_str())),
+                       count);
+  }
 }
 
 }  // namespace grpc_core
@@ -19,21 +19,29 @@
 #ifndef GRPC_SRC_CORE_LOAD_BALANCING_GRPCLB_GRPCLB_CLIENT_STATS_H
 #define GRPC_SRC_CORE_LOAD_BALANCING_GRPCLB_GRPCLB_CLIENT_STATS_H
 
-#include <grpc/support/atm.h>
 #include <grpc/support/port_platform.h>
 #include <stdint.h>
 
+#include <array>
+#include <atomic>
 #include <memory>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/container/inlined_vector.h"
+#include "absl/strings/string_view.h"
 #include "src/core/util/memory.h"
+#include "src/core/util/per_cpu.h"
 #include "src/core/util/ref_counted.h"
 #include "src/core/util/sync.h"
 
 namespace grpc_core {
 
+// Call counts reported to the balancer. Calls are counted in per-cpu
+// shards, so that recording a call or a drop does not write to memory
+// shared by every core; the shards are summed when a report is sent.
 class GrpcLbClientStats final : public RefCounted<GrpcLbClientStats> {
  public:
   struct DropTokenCount {
@@ -46,11 +54,18 @@ class GrpcLbClientStats final : public RefCounted<GrpcLbClientStats> {
 
   typedef absl::InlinedVector<DropTokenCount, 10> DroppedCallCounts;
 
+  // Identifies a drop token, as returned by InternDropToken().
+  using DropTokenId = uint32_t;
+
   void AddCallStarted();
   void AddCallFinished(bool finished_with_client_failed_to_send,
                        bool finished_known_received);
 
-  void AddCallDropped(const char* token);
+  // Returns the id with which to record drops for \a token. Takes a lock, so
+  // should be called when a serverlist is received rather than per call.
+  DropTokenId InternDropToken(absl::string_view token);
+
+  void AddCallDropped(DropTokenId token_id);
 
   void Get(int64_t* num_calls_started, int64_t* num_calls_finished,
            int64_t* num_calls_finished_with_client_failed_to_send,
@@ -64,13 +79,25 @@ class GrpcLbClientStats final : public RefCounted<GrpcLbClientStats> {
   }
 
  private:
-  gpr_atm num_calls_started_ = 0;
-  gpr_atm num_calls_finished_ = 0;
-  gpr_atm num_calls_finished_with_client_failed_to_send_ = 0;
-  gpr_atm num_calls_finished_known_received_ = 0;
-  Mutex drop_count_mu_;  // Guards drop_token_counts_.
-  std::unique_ptr<DroppedCallCounts> drop_token_counts_
-      ABSL_GUARDED_BY(drop_count_mu_);
+  // Drops for the first tokens interned are counted in the shards. Balancers
+  // use few distinct tokens; drops for any beyond these take drop_count_mu_.
+  static constexpr DropTokenId kMaxShardedDropTokens = 8;
+
+  struct alignas(GPR_CACHELINE_SIZE) Shard {
+    std::atomic<int64_t> num_calls_started{0};
+    std::atomic<int64_t> num_calls_finished{0};
+    std::atomic<int64_t> num_calls_finished_with_client_failed_to_send{0};
+    std::atomic<int64_t> num_calls_finished_known_received{0};
+    std::array<std::atomic<int64_t>, kMaxShardedDropTokens> num_drops{};
+  };
+
+  PerCpu<Shard> shards_{PerCpuOptions().SetMaxShards(16)};
+  Mutex drop_count_mu_;
+  // Interned drop tokens, indexed by DropTokenId.
+  std::vector<std::string> drop_tokens_ ABSL_GUARDED_BY(drop_count_mu_);
+  // Drop counts for tokens not counted in the shards, indexed by
+  // DropTokenId - kMaxShardedDropTokens.
+  std::vector<int64_t> unsharded_drop_counts_ ABSL_GUARDED_BY(drop_count_mu_);
 };
 
 }  // namespace grpc_core
@@ -22,6 +22,7 @@
 #include <stdint.h>
 #include <string.h>
 
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <optional>
@@ -32,6 +33,7 @@
 
 #include "absl/log/check.h"
 #include "absl/log/log.h"
+#include "absl/random/random.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/str_cat.h"
@@ -55,6 +57,7 @@
 #include "src/core/util/debug_location.h"
 #include "src/core/util/orphanable.h"
 #include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/shared_bit_gen.h"
 #include "src/core/util/sync.h"
 #include "src/core/util/work_serializer.h"
 #include "src/proto/grpc/health/v1/health.upb.h"
@@ -299,10 +302,18 @@ class HealthProducer::ConnectivityWatcher final
 // HealthProducer
 //
 
+bool HealthProducer::ShouldSample(const ChannelArgs& args) {
+  const int sample_percent = std::clamp(
+      args.GetInt(GRPC_ARG_HEALTH_CHECK_SAMPLE_PERCENT).value_or(100), 0, 100);
+  if (sample_percent == 100) return true;
+  SharedBitGen g;
+  return absl::Uniform(g, 0, 100) < sample_percent;
+}
+
 void HealthProducer::Start(RefCountedPtr<Subchannel> subchannel) {
   GRPC_TRACE_LOG(health_check_client, INFO)
       << "HealthProducer " << this << ": starting with subchannel "
-      << subchannel.get();
+      << subchannel.get() << " (sampled=" << sampled_ << ")";
   subchannel_ = std::move(subchannel);
   {
     MutexLock lock(&mu_);
@@ -331,7 +342,7 @@ void HealthProducer::AddWatcher(
   MutexLock lock(&mu_);
   grpc_pollset_set_add_pollset_set(interested_parties_,
                                    watcher->interested_parties());
-  if (!health_check_service_name.has_value()) {
+  if (!health_check_service_name.has_value() || !sampled_) {
     if (state_.has_value()) watcher->Notify(*state_, status_);
     non_health_watchers_.insert(watcher);
   } else {
@@ -352,7 +363,7 @@ void HealthProducer::RemoveWatcher(
   MutexLock lock(&mu_);
   grpc_pollset_set_del_pollset_set(interested_parties_,
                                    watcher->interested_parties());
-  if (!health_check_service_name.has_value()) {
+  if (!health_check_service_name.has_value() || !sampled_) {
     non_health_watchers_.erase(watcher);
   } else {
     auto it = health_checkers_.find(*health_check_service_name);
@@ -404,6 +415,9 @@ HealthWatcher::~HealthWatcher() {
 
 void HealthWatcher::SetSubchannel(Subchannel* subchannel) {
   bool created = false;
+  // Read outside of the lambda below, which runs with the subchannel lock
+  // held.
+  const bool sampled = HealthProducer::ShouldSample(subchannel->channel_args());
   // Check if our producer is already registered with the subchannel.
   // If not, create a new one.
   subchannel->GetOrAddDataProducer(
@@ -414,7 +428,7 @@ void HealthWatcher::SetSubchannel(Subchannel* subchannel) {
               (*producer)->RefIfNonZero().TakeAsSubclass<HealthProducer>();
         }
         if (producer_ == nullptr) {
-          producer_ = MakeRefCounted<HealthProducer>();
+          producer_ = MakeRefCounted<HealthProducer>(sampled);
           *producer = producer_.get();
           created = true;
         }
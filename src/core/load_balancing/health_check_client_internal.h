@@ -33,6 +33,7 @@
 #include "src/core/client_channel/subchannel.h"
 #include "src/core/client_channel/subchannel_interface_internal.h"
 #include "src/core/client_channel/subchannel_stream_client.h"
+#include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/iomgr/iomgr_fwd.h"
 #include "src/core/lib/iomgr/pollset_set.h"
 #include "src/core/load_balancing/subchannel_interface.h"
@@ -50,9 +51,14 @@ class HealthWatcher;
 // health watch call for each health check service name that is being
 // watched and reports the resulting connectivity state to all
 // registered watchers.
+//
+// If the subchannel is not sampled for health checking (see
+// GRPC_ARG_HEALTH_CHECK_SAMPLE_PERCENT), no health watch calls are made,
+// and all watchers are reported the subchannel's connectivity state.
 class HealthProducer final : public Subchannel::DataProducerInterface {
  public:
-  HealthProducer() : interested_parties_(grpc_pollset_set_create()) {}
+  explicit HealthProducer(bool sampled)
+      : sampled_(sampled), interested_parties_(grpc_pollset_set_create()) {}
   ~HealthProducer() override { grpc_pollset_set_destroy(interested_parties_); }
 
   void Start(RefCountedPtr<Subchannel> subchannel);
@@ -64,6 +70,10 @@ class HealthProducer final : public Subchannel::DataProducerInterface {
 
   UniqueTypeName type() const override { return Type(); }
 
+  // Decides at random whether a subchannel created with args is sampled
+  // for health checking.
+  static bool ShouldSample(const ChannelArgs& args);
+
   void AddWatcher(HealthWatcher* watcher,
                   const std::optional<std::string>& health_check_service_name);
   void RemoveWatcher(
@@ -137,6 +147,7 @@ class HealthProducer final : public Subchannel::DataProducerInterface {
                                  const absl::Status& status);
   void Orphaned() override;
 
+  const bool sampled_;
   RefCountedPtr<Subchannel> subchannel_;
   ConnectivityWatcher* connectivity_watcher_;
   grpc_pollset_set* interested_parties_;
@@ -81,6 +81,37 @@ using ::grpc_event_engine::experimental::EventEngine;
 constexpr absl::string_view kOutlierDetection =
     "outlier_detection_experimental";
 
+// Call latencies are counted in buckets a quarter of a doubling wide: bucket
+// 0 holds latencies of up to 1ms, and bucket i > 0 latencies of more than
+// 2^((i-1)/4) and up to 2^(i/4) ms.  The last bucket also holds everything
+// longer.
+constexpr size_t kLatencyBuckets = 80;
+
+size_t LatencyBucket(Duration latency) {
+  const int64_t millis = latency.millis();
+  if (millis <= 1) return 0;
+  return std::min(kLatencyBuckets - 1,
+                  static_cast<size_t>(
+                      std::ceil(4 * std::log2(static_cast<double>(millis)))));
+}
+
+// Returns the upper bound of the bucket holding the given percentile of the
+// latencies counted in counts, which must not all be zero.
+Duration LatencyPercentile(const std::vector<uint64_t>& counts,
+                           uint32_t percentile) {
+  uint64_t total = 0;
+  for (uint64_t count : counts) total += count;
+  const double rank = total * (percentile / 100.0);
+  uint64_t cumulative = 0;
+  size_t bucket = 0;
+  for (; bucket < counts.size() - 1; ++bucket) {
+    cumulative += counts[bucket];
+    if (cumulative > rank || cumulative == total) break;
+  }
+  return Duration::Milliseconds(
+      static_cast<int64_t>(std::ceil(std::pow(2.0, bucket / 4.0))));
+}
+
 // Config for xDS Cluster Impl LB policy.
 class OutlierDetectionLbConfig final : public LoadBalancingPolicy::Config {
  public:
@@ -94,7 +125,12 @@ class OutlierDetectionLbConfig final : public LoadBalancingPolicy::Config {
 
   bool CountingEnabled() const {
     return outlier_detection_config_.success_rate_ejection.has_value() ||
-           outlier_detection_config_.failure_percentage_ejection.has_value();
+           outlier_detection_config_.failure_percentage_ejection.has_value() ||
+           LatencyTrackingEnabled();
+  }
+
+  bool LatencyTrackingEnabled() const {
+    return outlier_detection_config_.latency_ejection.has_value();
   }
 
   const OutlierDetectionConfig& outlier_detection_config() const {
@@ -284,6 +320,11 @@ class OutlierDetectionLb final : public LoadBalancingPolicy {
     void RotateBucket() {
       backup_bucket_->successes = 0;
       backup_bucket_->failures = 0;
+      if (backup_bucket_->latency_counts != nullptr) {
+        for (size_t i = 0; i < kLatencyBuckets; ++i) {
+          backup_bucket_->latency_counts[i] = 0;
+        }
+      }
       current_bucket_.swap(backup_bucket_);
       active_bucket_.store(current_bucket_.get());
     }
@@ -305,6 +346,33 @@ class OutlierDetectionLb final : public LoadBalancingPolicy {
 
     void AddFailureCount() { active_bucket_.load()->failures.fetch_add(1); }
 
+    // Allocates the latency counts.  Must be called before a picker that
+    // tracks latencies can pick this endpoint.
+    void EnableLatencyTracking() {
+      for (Bucket* bucket : {current_bucket_.get(), backup_bucket_.get()}) {
+        if (bucket->latency_counts == nullptr) {
+          bucket->latency_counts =
+              std::make_unique<std::atomic<uint32_t>[]>(kLatencyBuckets);
+        }
+      }
+    }
+
+    void AddLatency(Duration latency) {
+      active_bucket_.load()->latency_counts[LatencyBucket(latency)].fetch_add(
+          1, std::memory_order_relaxed);
+    }
+
+    // Returns the latency counts of the last interval, or an empty vector if
+    // latencies are not tracked.
+    std::vector<uint64_t> GetLatencyCounts() const {
+      if (backup_bucket_->latency_counts == nullptr) return {};
+      std::vector<uint64_t> counts(kLatencyBuckets);
+      for (size_t i = 0; i < kLatencyBuckets; ++i) {
+        counts[i] = backup_bucket_->latency_counts[i].load();
+      }
+      return counts;
+    }
+
     std::optional<Timestamp> ejection_time() const { return ejection_time_; }
 
     void Eject(const Timestamp& time) {
@@ -352,6 +420,8 @@ class OutlierDetectionLb final : public LoadBalancingPolicy {
     struct Bucket {
       std::atomic<uint64_t> successes;
       std::atomic<uint64_t> failures;
+      // The latencies of successful calls, if latency_ejection is enabled.
+      std::unique_ptr<std::atomic<uint32_t>[]> latency_counts;
     };
 
     const std::set<SubchannelState*> subchannels_;
@@ -369,7 +439,8 @@ class OutlierDetectionLb final : public LoadBalancingPolicy {
   class Picker final : public SubchannelPicker {
    public:
     Picker(OutlierDetectionLb* outlier_detection_lb,
-           RefCountedPtr<SubchannelPicker> picker, bool counting_enabled);
+           RefCountedPtr<SubchannelPicker> picker, bool counting_enabled,
+           bool latency_tracking_enabled);
 
     PickResult Pick(PickArgs args) override;
 
@@ -377,6 +448,7 @@ class OutlierDetectionLb final : public LoadBalancingPolicy {
     class SubchannelCallTracker;
     RefCountedPtr<SubchannelPicker> picker_;
     bool counting_enabled_;
+    bool latency_tracking_enabled_;
   };
 
   class Helper final
@@ -484,17 +556,20 @@ class OutlierDetectionLb::Picker::SubchannelCallTracker final
   SubchannelCallTracker(
       std::unique_ptr<LoadBalancingPolicy::SubchannelCallTrackerInterface>
           original_subchannel_call_tracker,
-      RefCountedPtr<EndpointState> endpoint_state)
+      RefCountedPtr<EndpointState> endpoint_state, bool track_latency)
       : original_subchannel_call_tracker_(
             std::move(original_subchannel_call_tracker)),
-        endpoint_state_(std::move(endpoint_state)) {}
+        endpoint_state_(std::move(endpoint_state)),
+        track_latency_(track_latency) {}
 
   ~SubchannelCallTracker() override {
     endpoint_state_.reset(DEBUG_LOCATION, "SubchannelCallTracker");
   }
 
   void Start() override {
-    // This tracker does not care about started calls only finished calls.
+    // This tracker does not care about started calls only finished calls,
+    // other than to time them.
+    if (track_latency_) start_time_ = Timestamp::Now();
     // Delegate if needed.
     if (original_subchannel_call_tracker_ != nullptr) {
       original_subchannel_call_tracker_->Start();
@@ -510,6 +585,9 @@ class OutlierDetectionLb::Picker::SubchannelCallTracker final
     // calculations.
     if (args.status.ok()) {
       endpoint_state_->AddSuccessCount();
+      if (track_latency_) {
+        endpoint_state_->AddLatency(Timestamp::Now() - start_time_);
+      }
     } else {
       endpoint_state_->AddFailureCount();
     }
@@ -519,6 +597,8 @@ class OutlierDetectionLb::Picker::SubchannelCallTracker final
   std::unique_ptr<LoadBalancingPolicy::SubchannelCallTrackerInterface>
       original_subchannel_call_tracker_;
   RefCountedPtr<EndpointState> endpoint_state_;
+  const bool track_latency_;
+  Timestamp start_time_;
 };
 
 //
@@ -527,8 +607,11 @@ class OutlierDetectionLb::Picker::SubchannelCallTracker final
 
 OutlierDetectionLb::Picker::Picker(OutlierDetectionLb* outlier_detection_lb,
                                    RefCountedPtr<SubchannelPicker> picker,
-                                   bool counting_enabled)
-    : picker_(std::move(picker)), counting_enabled_(counting_enabled) {
+                                   bool counting_enabled,
+                                   bool latency_tracking_enabled)
+    : picker_(std::move(picker)),
+      counting_enabled_(counting_enabled),
+      latency_tracking_enabled_(latency_tracking_enabled) {
   GRPC_TRACE_LOG(outlier_detection_lb, INFO)
       << "[outlier_detection_lb " << outlier_detection_lb
       << "] constructed new picker " << this << " and counting " << "is "
@@ -555,7 +638,7 @@ LoadBalancingPolicy::PickResult OutlierDetectionLb::Picker::Pick(
         complete_pick->subchannel_call_tracker =
             std::make_unique<SubchannelCallTracker>(
                 std::move(complete_pick->subchannel_call_tracker),
-                std::move(endpoint_state));
+                std::move(endpoint_state), latency_tracking_enabled_);
       }
     }
     // Unwrap subchannel to pass back up the stack.
@@ -675,8 +758,10 @@ absl::Status OutlierDetectionLb::UpdateLocked(UpdateArgs args) {
           subchannels.insert(it2->second.get());
         }
         // Now create the endpoint.
-        endpoint_state_map_.emplace(
-            key, MakeRefCounted<EndpointState>(std::move(subchannels)));
+        it = endpoint_state_map_
+                 .emplace(key,
+                          MakeRefCounted<EndpointState>(std::move(subchannels)))
+                 .first;
       } else if (!config_->CountingEnabled()) {
         // If counting is not enabled, reset state.
         GRPC_TRACE_LOG(outlier_detection_lb, INFO)
@@ -684,6 +769,10 @@ absl::Status OutlierDetectionLb::UpdateLocked(UpdateArgs args) {
             << "] counting disabled; disabling ejection for " << key.ToString();
         it->second->DisableEjection();
       }
+      // The pickers created after this update track latencies.
+      if (config_->LatencyTrackingEnabled()) {
+        it->second->EnableLatencyTracking();
+      }
     });
     // Remove any entries we no longer need in the subchannel map.
     for (auto it = subchannel_state_map_.begin();
@@ -740,7 +829,8 @@ absl::Status OutlierDetectionLb::UpdateLocked(UpdateArgs args) {
 void OutlierDetectionLb::MaybeUpdatePickerLocked() {
   if (picker_ != nullptr) {
     auto outlier_detection_picker =
-        MakeRefCounted<Picker>(this, picker_, config_->CountingEnabled());
+        MakeRefCounted<Picker>(this, picker_, config_->CountingEnabled(),
+                               config_->LatencyTrackingEnabled());
     GRPC_TRACE_LOG(outlier_detection_lb, INFO)
         << "[outlier_detection_lb " << this
         << "] updating connectivity: state=" << ConnectivityStateName(state_)
@@ -855,6 +945,8 @@ void OutlierDetectionLb::EjectionTimer::OnTimerLocked() {
       << "] ejection timer running";
   std::map<EndpointState*, double> success_rate_ejection_candidates;
   std::map<EndpointState*, double> failure_percentage_ejection_candidates;
+  std::map<EndpointState*, Duration> latency_ejection_candidates;
+  std::vector<uint64_t> cluster_latency_counts(kLatencyBuckets);
   size_t ejected_host_count = 0;
   double success_rate_sum = 0;
   auto time_now = Timestamp::Now();
@@ -866,6 +958,19 @@ void OutlierDetectionLb::EjectionTimer::OnTimerLocked() {
     // Gather data to run success rate algorithm or failure percentage
     // algorithm.
     if (endpoint_state->ejection_time().has_value()) ++ejected_host_count;
+    if (config.latency_ejection.has_value()) {
+      std::vector<uint64_t> latency_counts = endpoint_state->GetLatencyCounts();
+      uint64_t latency_volume = 0;
+      for (uint64_t count : latency_counts) latency_volume += count;
+      if (latency_volume > 0 &&
+          latency_volume >= config.latency_ejection->request_volume) {
+        latency_ejection_candidates[endpoint_state.get()] = LatencyPercentile(
+            latency_counts, config.latency_ejection->percentile);
+        for (size_t i = 0; i < kLatencyBuckets; ++i) {
+          cluster_latency_counts[i] += latency_counts[i];
+        }
+      }
+    }
     std::optional<std::pair<double, uint64_t>> host_success_rate_and_volume =
         endpoint_state->GetSuccessRateAndVolume();
     if (!host_success_rate_and_volume.has_value()) continue;
@@ -889,7 +994,9 @@ void OutlierDetectionLb::EjectionTimer::OnTimerLocked() {
       << success_rate_ejection_candidates.size()
       << " success rate candidates and "
       << failure_percentage_ejection_candidates.size()
-      << " failure percentage candidates; ejected_host_count="
+      << " failure percentage candidates and "
+      << latency_ejection_candidates.size()
+      << " latency candidates; ejected_host_count="
       << ejected_host_count
       << "; success_rate_sum=" << absl::StrFormat("%.3f", success_rate_sum);
   // success rate algorithm
@@ -991,6 +1098,53 @@ void OutlierDetectionLb::EjectionTimer::OnTimerLocked() {
       }
     }
   }
+  // latency algorithm
+  if (!latency_ejection_candidates.empty() &&
+      latency_ejection_candidates.size() >=
+          config.latency_ejection->minimum_hosts) {
+    const Duration cluster_latency = LatencyPercentile(
+        cluster_latency_counts, config.latency_ejection->percentile);
+    const double ejection_threshold_ms =
+        cluster_latency.millis() *
+        (static_cast<double>(config.latency_ejection->threshold_factor) /
+         1000);
+    GRPC_TRACE_LOG(outlier_detection_lb, INFO)
+        << "[outlier_detection_lb " << parent_.get()
+        << "] running latency algorithm: percentile="
+        << config.latency_ejection->percentile
+        << ", cluster_latency=" << cluster_latency.ToString()
+        << ", ejection_threshold_ms=" << ejection_threshold_ms
+        << ", enforcement_percentage="
+        << config.latency_ejection->enforcement_percentage;
+    for (auto& [endpoint_state, latency] : latency_ejection_candidates) {
+      GRPC_TRACE_LOG(outlier_detection_lb, INFO)
+          << "[outlier_detection_lb " << parent_.get()
+          << "] checking candidate " << endpoint_state
+          << ": latency=" << latency.ToString();
+      // Extra check to make sure the other algorithms didn't already
+      // eject this backend.
+      if (endpoint_state->ejection_time().has_value()) continue;
+      if (latency.millis() > ejection_threshold_ms) {
+        uint32_t random_key = absl::Uniform(SharedBitGen(), 1, 100);
+        double current_percent =
+            100.0 * ejected_host_count / parent_->endpoint_state_map_.size();
+        GRPC_TRACE_LOG(outlier_detection_lb, INFO)
+            << "[outlier_detection_lb " << parent_.get()
+            << "] random_key=" << random_key
+            << " ejected_host_count=" << ejected_host_count
+            << " current_percent=" << current_percent;
+        if (random_key < config.latency_ejection->enforcement_percentage &&
+            (ejected_host_count == 0 ||
+             (current_percent < config.max_ejection_percent))) {
+          GRPC_TRACE_LOG(outlier_detection_lb, INFO)
+              << "[outlier_detection_lb " << parent_.get()
+              << "] ejecting candidate";
+          endpoint_state->Eject(time_now);
+          ++ejected_host_count;
+        }
+      }
+    }
+  }
   // For each address in the map:
   //   If the address is not ejected and the multiplier is greater than 0,
   //   decrease the multiplier by 1. If the address is ejected, and the
@@ -1112,6 +1266,32 @@ void OutlierDetectionConfig::FailurePercentageEjection::JsonPostLoad(
   }
 }
 
+const JsonLoaderInterface* OutlierDetectionConfig::LatencyEjection::JsonLoader(
+    const JsonArgs&) {
+  static const auto* loader =
+      JsonObjectLoader<LatencyEjection>()
+          .OptionalField("percentile", &LatencyEjection::percentile)
+          .OptionalField("thresholdFactor", &LatencyEjection::threshold_factor)
+          .OptionalField("enforcementPercentage",
+                         &LatencyEjection::enforcement_percentage)
+          .OptionalField("minimumHosts", &LatencyEjection::minimum_hosts)
+          .OptionalField("requestVolume", &LatencyEjection::request_volume)
+          .Finish();
+  return loader;
+}
+
+void OutlierDetectionConfig::LatencyEjection::JsonPostLoad(
+    const Json&, const JsonArgs&, ValidationErrors* errors) {
+  if (percentile == 0 || percentile > 100) {
+    ValidationErrors::ScopedField field(errors, ".percentile");
+    errors->AddError("value must be in the range [1, 100]");
+  }
+  if (enforcement_percentage > 100) {
+    ValidationErrors::ScopedField field(errors, ".enforcement_percentage");
+    errors->AddError("value must be <= 100");
+  }
+}
+
 const JsonLoaderInterface* OutlierDetectionConfig::JsonLoader(const JsonArgs&) {
   static const auto* loader =
       JsonObjectLoader<OutlierDetectionConfig>()
@@ -1126,6 +1306,8 @@ const JsonLoaderInterface* OutlierDetectionConfig::JsonLoader(const JsonArgs&) {
                          &OutlierDetectionConfig::success_rate_ejection)
           .OptionalField("failurePercentageEjection",
                          &OutlierDetectionConfig::failure_percentage_ejection)
+          .OptionalField("latencyEjection",
+                         &OutlierDetectionConfig::latency_ejection)
           .Finish();
   return loader;
 }
@@ -0,0 +1,741 @@
+//
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <grpc/impl/connectivity_state.h>
+#include <grpc/support/port_platform.h>
+#include <grpc/support/time.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <cmath>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "absl/log/check.h"
+#include "absl/log/log.h"
+#include "absl/random/random.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_join.h"
+#include "absl/strings/string_view.h"
+#include "src/core/config/core_configuration.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/debug/trace.h"
+#include "src/core/lib/transport/connectivity_state.h"
+#include "src/core/load_balancing/endpoint_list.h"
+#include "src/core/load_balancing/lb_policy.h"
+#include "src/core/load_balancing/lb_policy_factory.h"
+#include "src/core/resolver/endpoint_addresses.h"
+#include "src/core/util/debug_location.h"
+#include "src/core/util/json/json.h"
+#include "src/core/util/json/json_args.h"
+#include "src/core/util/json/json_object_loader.h"
+#include "src/core/util/orphanable.h"
+#include "src/core/util/per_cpu.h"
+#include "src/core/util/ref_counted.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/shared_bit_gen.h"
+#include "src/core/util/sync.h"
+#include "src/core/util/time.h"
+#include "src/core/util/validation_errors.h"
+#include "src/core/util/work_serializer.h"
+
+namespace grpc_core {
+
+namespace {
+
+constexpr absl::string_view kPeakEwma = "peak_ewma";
+
+// Larger values are capped, as in least_request.
+constexpr uint32_t kMaxChoiceCount = 10;
+
+// Score of an endpoint that has calls in flight but no latency measurement
+// yet, added to its number of calls in flight.  Large enough that such an
+// endpoint is only picked when every other candidate is in the same state,
+// so that a new endpoint is probed by one call rather than flooded.
+constexpr double kUnmeasuredPenalty = 1e12;
+
+// Returns the current monotonic time in microseconds.
+int64_t NowMicros() {
+  gpr_timespec now = gpr_now(GPR_CLOCK_MONOTONIC);
+  return now.tv_sec * GPR_US_PER_SEC + now.tv_nsec / GPR_NS_PER_US;
+}
+
+// Config for peak_ewma LB policy.
+class PeakEwmaConfig final : public LoadBalancingPolicy::Config {
+ public:
+  PeakEwmaConfig() = default;
+
+  PeakEwmaConfig(const PeakEwmaConfig&) = delete;
+  PeakEwmaConfig& operator=(const PeakEwmaConfig&) = delete;
+
+  PeakEwmaConfig(PeakEwmaConfig&&) = delete;
+  PeakEwmaConfig& operator=(PeakEwmaConfig&&) = delete;
+
+  absl::string_view name() const override { return kPeakEwma; }
+
+  uint32_t choice_count() const { return choice_count_; }
+  Duration decay_time() const { return decay_time_; }
+
+  static const JsonLoaderInterface* JsonLoader(const JsonArgs&) {
+    static const auto* loader =
+        JsonObjectLoader<PeakEwmaConfig>()
+            .OptionalField("choiceCount", &PeakEwmaConfig::choice_count_)
+            .OptionalField("decayTime", &PeakEwmaConfig::decay_time_)
+            .Finish();
+    return loader;
+  }
+
+  void JsonPostLoad(const Json&, const JsonArgs&, ValidationErrors* errors) {
+    if (choice_count_ < 2) {
+      ValidationErrors::ScopedField field(errors, ".choiceCount");
+      errors->AddError("must be at least 2");
+    }
+    choice_count_ = std::min(choice_count_, kMaxChoiceCount);
+    if (decay_time_ <= Duration::Zero()) {
+      ValidationErrors::ScopedField field(errors, ".decayTime");
+      errors->AddError("must be greater than 0");
+    }
+  }
+
+ private:
+  uint32_t choice_count_ = 2;
+  Duration decay_time_ = Duration::Seconds(10);
+};
+
+// Peak EWMA LB policy: each pick samples choice_count READY endpoints and
+// uses the one with the lowest expected cost, which is the moving average of
+// its call latency times one more than its number of calls in flight.
+//
+// The average is "peak" sensitive: a latency above it replaces it outright,
+// while lower latencies only pull it down with a weight of
+// 1 - exp(-elapsed / decay_time).  At pick time the average is decayed by
+// the time since it was last updated, so an endpoint that stopped getting
+// traffic because it was slow gets probed again once its history is stale.
+// Endpoints with no measurement at all are tried first.
+class PeakEwma final : public LoadBalancingPolicy {
+ public:
+  explicit PeakEwma(Args args);
+
+  absl::string_view name() const override { return kPeakEwma; }
+
+  absl::Status UpdateLocked(UpdateArgs args) override;
+  void ResetBackoffLocked() override;
+
+ private:
+  // The latency average and number of calls in flight of an endpoint.
+  // Kept across address updates for as long as the endpoint is in the
+  // address list or has calls in flight.  Calls start and finish on many
+  // threads, so the count is spread over per-cpu shards that readers add
+  // up, and pickers read the average without taking the lock that
+  // serializes its updates.
+  class EndpointStats final : public RefCounted<EndpointStats> {
+   public:
+    EndpointStats(RefCountedPtr<PeakEwma> peak_ewma, EndpointAddressSet key)
+        : peak_ewma_(std::move(peak_ewma)), key_(std::move(key)) {}
+    ~EndpointStats() override;
+
+    void Increment() {
+      shards_.this_cpu().count.fetch_add(1, std::memory_order_relaxed);
+    }
+    void Decrement() {
+      shards_.this_cpu().count.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    // Folds the latency of a finished call into the average.
+    void RecordLatency(int64_t latency_us, int64_t now_us,
+                       double decay_time_us);
+
+    // Returns the expected cost of sending one more call to this endpoint.
+    double Score(int64_t now_us, double decay_time_us) const;
+
+   private:
+    // We want to ensure that this per-cpu data structure lands on different
+    // cachelines per cpu.
+    struct alignas(GPR_CACHELINE_SIZE) Shard {
+      std::atomic<int64_t> count{0};
+    };
+
+    int64_t InFlight() const;
+
+    RefCountedPtr<PeakEwma> peak_ewma_;
+    const EndpointAddressSet key_;
+    PerCpu<Shard> shards_{PerCpuOptions().SetCpusPerShard(4).SetMaxShards(8)};
+    Mutex mu_;
+    // Zero until the first latency is recorded.
+    std::atomic<double> cost_us_{0};
+    std::atomic<int64_t> last_update_us_{0};
+  };
+
+  class PeakEwmaEndpointList final : public EndpointList {
+   public:
+    PeakEwmaEndpointList(RefCountedPtr<PeakEwma> peak_ewma,
+                             EndpointAddressesIterator* endpoints,
+                             const ChannelArgs& args,
+                             std::string resolution_note,
+                             std::vector<std::string>* errors)
+        : EndpointList(std::move(peak_ewma), std::move(resolution_note),
+                       GRPC_TRACE_FLAG_ENABLED(peak_ewma_lb)
+                           ? "PeakEwmaEndpointList"
+                           : nullptr) {
+      Init(endpoints, args,
+           [&](RefCountedPtr<EndpointList> endpoint_list,
+               const EndpointAddresses& addresses, const ChannelArgs& args) {
+             return MakeOrphanable<PeakEwmaEndpoint>(
+                 std::move(endpoint_list), addresses, args,
+                 policy<PeakEwma>()->work_serializer(), errors);
+           });
+    }
+
+   private:
+    class PeakEwmaEndpoint final : public Endpoint {
+     public:
+      PeakEwmaEndpoint(RefCountedPtr<EndpointList> endpoint_list,
+                           const EndpointAddresses& addresses,
+                           const ChannelArgs& args,
+                           std::shared_ptr<WorkSerializer> work_serializer,
+                           std::vector<std::string>* errors)
+          : Endpoint(std::move(endpoint_list)),
+            stats_(policy<PeakEwma>()->GetOrCreateEndpointStats(
+                addresses.addresses())) {
+        absl::Status status = Init(addresses, args, std::move(work_serializer));
+        if (!status.ok()) {
+          errors->emplace_back(absl::StrCat("endpoint ", addresses.ToString(),
+                                            ": ", status.ToString()));
+        }
+      }
+
+      RefCountedPtr<EndpointStats> stats() const { return stats_; }
+
+     private:
+      // Called when the child policy reports a connectivity state update.
+      void OnStateUpdate(std::optional<grpc_connectivity_state> old_state,
+                         grpc_connectivity_state new_state,
+                         const absl::Status& status) override;
+
+      RefCountedPtr<EndpointStats> stats_;
+    };
+
+    LoadBalancingPolicy::ChannelControlHelper* channel_control_helper()
+        const override {
+      return policy<PeakEwma>()->channel_control_helper();
+    }
+
+    // Updates the counters of children in each state when a
+    // child transitions from old_state to new_state.
+    void UpdateStateCountersLocked(
+        std::optional<grpc_connectivity_state> old_state,
+        grpc_connectivity_state new_state);
+
+    // Ensures that the right child list is used and then updates
+    // the policy's connectivity state based on the child list's
+    // state counters.
+    void MaybeUpdatePeakEwmaConnectivityStateLocked(
+        absl::Status status_for_tf);
+
+    std::string CountersString() const {
+      return absl::StrCat("num_children=", size(), " num_ready=", num_ready_,
+                          " num_connecting=", num_connecting_,
+                          " num_transient_failure=", num_transient_failure_);
+    }
+
+    size_t num_ready_ = 0;
+    size_t num_connecting_ = 0;
+    size_t num_transient_failure_ = 0;
+
+    absl::Status last_failure_;
+  };
+
+  class Picker final : public SubchannelPicker {
+   public:
+    // Info stored about each READY endpoint.
+    struct EndpointInfo {
+      RefCountedPtr<SubchannelPicker> picker;
+      RefCountedPtr<EndpointStats> stats;
+    };
+
+    Picker(PeakEwma* parent, const PeakEwmaConfig& config,
+           std::vector<EndpointInfo> endpoints);
+
+    PickResult Pick(PickArgs args) override;
+
+   private:
+    // Counts the call as in flight from the pick until it finishes, or
+    // until the pick is abandoned, and records its latency when it
+    // finishes.
+    class SubchannelCallTracker final : public SubchannelCallTrackerInterface {
+     public:
+      SubchannelCallTracker(
+          RefCountedPtr<EndpointStats> stats, double decay_time_us,
+          std::unique_ptr<SubchannelCallTrackerInterface> child_tracker)
+          : stats_(std::move(stats)),
+            decay_time_us_(decay_time_us),
+            child_tracker_(std::move(child_tracker)) {}
+
+      ~SubchannelCallTracker() override {
+        if (stats_ != nullptr) stats_->Decrement();
+      }
+
+      void Start() override;
+
+      void Finish(FinishArgs args) override;
+
+     private:
+      RefCountedPtr<EndpointStats> stats_;
+      const double decay_time_us_;
+      int64_t start_us_ = 0;
+      std::unique_ptr<SubchannelCallTrackerInterface> child_tracker_;
+    };
+
+    // Returns the index into endpoints_ to be picked.
+    size_t PickIndex();
+
+    // Using pointer value only, no ref held -- do not dereference!
+    PeakEwma* parent_;
+
+    const uint32_t choice_count_;
+    const double decay_time_us_;
+    std::vector<EndpointInfo> endpoints_;
+  };
+
+  ~PeakEwma() override;
+
+  void ShutdownLocked() override;
+
+  RefCountedPtr<EndpointStats> GetOrCreateEndpointStats(
+      const std::vector<grpc_resolved_address>& addresses);
+
+  RefCountedPtr<PeakEwmaConfig> config_;
+
+  // Current child list.
+  OrphanablePtr<PeakEwmaEndpointList> endpoint_list_;
+  // Latest pending child list.
+  // When we get an updated address list, we create a new child list
+  // for it here, and we wait to swap it into endpoint_list_ until the new
+  // list becomes READY.
+  OrphanablePtr<PeakEwmaEndpointList> latest_pending_endpoint_list_;
+
+  Mutex stats_map_mu_;
+  std::map<EndpointAddressSet, EndpointStats*> stats_map_
+      ABSL_GUARDED_BY(&stats_map_mu_);
+
+  bool shutdown_ = false;
+};
+
+//
+// PeakEwma::EndpointStats
+//
+
+PeakEwma::EndpointStats::~EndpointStats() {
+  MutexLock lock(&peak_ewma_->stats_map_mu_);
+  auto it = peak_ewma_->stats_map_.find(key_);
+  if (it != peak_ewma_->stats_map_.end() && it->second == this) {
+    peak_ewma_->stats_map_.erase(it);
+  }
+}
+
+int64_t PeakEwma::EndpointStats::InFlight() const {
+  int64_t count = 0;
+  for (const Shard& shard : shards_) {
+    count += shard.count.load(std::memory_order_relaxed);
+  }
+  return count;
+}
+
+void PeakEwma::EndpointStats::RecordLatency(int64_t latency_us,
+                                            int64_t now_us,
+                                            double decay_time_us) {
+  // A zero cost means "not measured yet", so never record one.
+  const double latency = std::max<int64_t>(latency_us, 1);
+  MutexLock lock(&mu_);
+  double cost = cost_us_.load(std::memory_order_relaxed);
+  if (latency > cost) {
+    cost = latency;
+  } else {
+    const int64_t elapsed_us = std::max<int64_t>(
+        now_us - last_update_us_.load(std::memory_order_relaxed), 0);
+    const double weight = std::exp(-elapsed_us / decay_time_us);
+    cost = cost * weight + latency * (1 - weight);
+  }
+  cost_us_.store(cost, std::memory_order_relaxed);
+  last_update_us_.store(now_us, std::memory_order_relaxed);
+}
+
+double PeakEwma::EndpointStats::Score(int64_t now_us,
+                                      double decay_time_us) const {
+  const int64_t in_flight = InFlight();
+  const double cost = cost_us_.load(std::memory_order_relaxed);
+  if (cost == 0) return in_flight == 0 ? 0 : kUnmeasuredPenalty + in_flight;
+  const int64_t age_us = std::max<int64_t>(
+      now_us - last_update_us_.load(std::memory_order_relaxed), 0);
+  return cost * std::exp(-age_us / decay_time_us) * (in_flight + 1);
+}
+
+//
+// PeakEwma::Picker::SubchannelCallTracker
+//
+
+void PeakEwma::Picker::SubchannelCallTracker::Start() {
+  start_us_ = NowMicros();
+  if (child_tracker_ != nullptr) child_tracker_->Start();
+}
+
+void PeakEwma::Picker::SubchannelCallTracker::Finish(FinishArgs args) {
+  if (child_tracker_ != nullptr) child_tracker_->Finish(args);
+  // Failed calls are often fast, and would otherwise attract more traffic
+  // to a broken endpoint; leave those to outlier detection.
+  if (args.status.ok()) {
+    const int64_t now_us = NowMicros();
+    stats_->RecordLatency(now_us - start_us_, now_us, decay_time_us_);
+  }
+  stats_->Decrement();
+  stats_.reset();
+}
+
+//
+// PeakEwma::Picker
+//
+
+PeakEwma::Picker::Picker(PeakEwma* parent, const PeakEwmaConfig& config,
+                         std::vector<EndpointInfo> endpoints)
+    : parent_(parent),
+      choice_count_(config.choice_count()),
+      decay_time_us_(config.decay_time().millis() * 1000.0),
+      endpoints_(std::move(endpoints)) {
+  GRPC_TRACE_LOG(peak_ewma_lb, INFO)
+      << "[PEWMA " << parent_ << " picker " << this
+      << "] created picker from endpoint_list="
+      << parent_->endpoint_list_.get() << " with " << endpoints_.size()
+      << " READY children; choice_count=" << choice_count_;
+}
+
+size_t PeakEwma::Picker::PickIndex() {
+  SharedBitGen bit_gen;
+  const int64_t now_us = NowMicros();
+  // When there are no more endpoints than choices, look at all of them,
+  // starting at a random one so that ties are broken randomly.
+  if (endpoints_.size() <= choice_count_) {
+    const size_t start = absl::Uniform<size_t>(bit_gen, 0, endpoints_.size());
+    size_t best = start;
+    double best_score = endpoints_[start].stats->Score(now_us, decay_time_us_);
+    for (size_t i = 1; i < endpoints_.size() && best_score > 0; ++i) {
+      const size_t index = (start + i) % endpoints_.size();
+      const double score =
+          endpoints_[index].stats->Score(now_us, decay_time_us_);
+      if (score < best_score) {
+        best = index;
+        best_score = score;
+      }
+    }
+    return best;
+  }
+  // Otherwise, sample choice_count endpoints with replacement.
+  size_t best = absl::Uniform<size_t>(bit_gen, 0, endpoints_.size());
+  double best_score = endpoints_[best].stats->Score(now_us, decay_time_us_);
+  for (uint32_t i = 1; i < choice_count_; ++i) {
+    const size_t index = absl::Uniform<size_t>(bit_gen, 0, endpoints_.size());
+    const double score = endpoints_[index].stats->Score(now_us, decay_time_us_);
+    if (score < best_score) {
+      best = index;
+      best_score = score;
+    }
+  }
+  return best;
+}
+
+PeakEwma::PickResult PeakEwma::Picker::Pick(PickArgs args) {
+  const EndpointInfo& endpoint = endpoints_[PickIndex()];
+  GRPC_TRACE_LOG(peak_ewma_lb, INFO)
+      << "[PEWMA " << parent_ << " picker " << this
+      << "] using picker=" << endpoint.picker.get();
+  PickResult result = endpoint.picker->Pick(args);
+  auto* complete = std::get_if<PickResult::Complete>(&result.result);
+  if (complete != nullptr) {
+    // Count the call right away, so that picks made before it starts see it.
+    endpoint.stats->Increment();
+    complete->subchannel_call_tracker = std::make_unique<SubchannelCallTracker>(
+        endpoint.stats, decay_time_us_,
+        std::move(complete->subchannel_call_tracker));
+  }
+  return result;
+}
+
+//
+// PeakEwma
+//
+
+PeakEwma::PeakEwma(Args args) : LoadBalancingPolicy(std::move(args)) {
+  GRPC_TRACE_LOG(peak_ewma_lb, INFO) << "[PEWMA " << this << "] Created";
+}
+
+PeakEwma::~PeakEwma() {
+  GRPC_TRACE_LOG(peak_ewma_lb, INFO)
+      << "[PEWMA " << this << "] Destroying peak EWMA policy";
+  CHECK(endpoint_list_ == nullptr);
+  CHECK(latest_pending_endpoint_list_ == nullptr);
+}
+
+void PeakEwma::ShutdownLocked() {
+  GRPC_TRACE_LOG(peak_ewma_lb, INFO) << "[PEWMA " << this << "] Shutting down";
+  shutdown_ = true;
+  endpoint_list_.reset();
+  latest_pending_endpoint_list_.reset();
+}
+
+void PeakEwma::ResetBackoffLocked() {
+  endpoint_list_->ResetBackoffLocked();
+  if (latest_pending_endpoint_list_ != nullptr) {
+    latest_pending_endpoint_list_->ResetBackoffLocked();
+  }
+}
+
+absl::Status PeakEwma::UpdateLocked(UpdateArgs args) {
+  config_ = args.config.TakeAsSubclass<PeakEwmaConfig>();
+  EndpointAddressesIterator* addresses = nullptr;
+  if (args.addresses.ok()) {
+    GRPC_TRACE_LOG(peak_ewma_lb, INFO)
+        << "[PEWMA " << this << "] received update";
+    addresses = args.addresses->get();
+  } else {
+    GRPC_TRACE_LOG(peak_ewma_lb, INFO)
+        << "[PEWMA " << this
+        << "] received update with address error: " << args.addresses.status();
+    // If we already have a child list, then keep using the existing
+    // list, but still report back that the update was not accepted.
+    if (endpoint_list_ != nullptr) return args.addresses.status();
+  }
+  // Create new child list, replacing the previous pending list, if any.
+  if (GRPC_TRACE_FLAG_ENABLED(peak_ewma_lb) &&
+      latest_pending_endpoint_list_ != nullptr) {
+    LOG(INFO) << "[PEWMA " << this << "] replacing previous pending child list "
+              << latest_pending_endpoint_list_.get();
+  }
+  std::vector<std::string> errors;
+  latest_pending_endpoint_list_ = MakeOrphanable<PeakEwmaEndpointList>(
+      RefAsSubclass<PeakEwma>(DEBUG_LOCATION, "PeakEwmaEndpointList"),
+      addresses, args.args, std::move(args.resolution_note), &errors);
+  // If the new list is empty, immediately promote it to
+  // endpoint_list_ and report TRANSIENT_FAILURE.
+  if (latest_pending_endpoint_list_->size() == 0) {
+    if (GRPC_TRACE_FLAG_ENABLED(peak_ewma_lb) &&
+        endpoint_list_ != nullptr) {
+      LOG(INFO) << "[PEWMA " << this << "] replacing previous child list "
+                << endpoint_list_.get();
+    }
+    endpoint_list_ = std::move(latest_pending_endpoint_list_);
+    absl::Status status = args.addresses.ok()
+                              ? absl::UnavailableError("empty address list")
+                              : args.addresses.status();
+    endpoint_list_->ReportTransientFailure(status);
+    return status;
+  }
+  // Otherwise, if this is the initial update, immediately promote it to
+  // endpoint_list_.
+  if (endpoint_list_ == nullptr) {
+    endpoint_list_ = std::move(latest_pending_endpoint_list_);
+  }
+  if (!errors.empty()) {
+    return absl::UnavailableError(absl::StrCat(
+        "errors from children: [", absl::StrJoin(errors, "; "), "]"));
+  }
+  return absl::OkStatus();
+}
+
+RefCountedPtr<PeakEwma::EndpointStats>
+PeakEwma::GetOrCreateEndpointStats(
+    const std::vector<grpc_resolved_address>& addresses) {
+  EndpointAddressSet key(addresses);
+  MutexLock lock(&stats_map_mu_);
+  auto it = stats_map_.find(key);
+  if (it != stats_map_.end()) {
+    auto stats = it->second->RefIfNonZero();
+    if (stats != nullptr) return stats;
+  }
+  auto stats = MakeRefCounted<EndpointStats>(
+      RefAsSubclass<PeakEwma>(DEBUG_LOCATION, "EndpointStats"), key);
+  stats_map_.insert_or_assign(key, stats.get());
+  return stats;
+}
+
+//
+// PeakEwma::PeakEwmaEndpointList::PeakEwmaEndpoint
+//
+
+void PeakEwma::PeakEwmaEndpointList::PeakEwmaEndpoint::
+    OnStateUpdate(std::optional<grpc_connectivity_state> old_state,
+                  grpc_connectivity_state new_state,
+                  const absl::Status& status) {
+  auto* pe_endpoint_list = endpoint_list<PeakEwmaEndpointList>();
+  auto* peak_ewma = policy<PeakEwma>();
+  GRPC_TRACE_LOG(peak_ewma_lb, INFO)
+      << "[PEWMA " << peak_ewma << "] connectivity changed for child "
+      << this << ", endpoint_list " << pe_endpoint_list << " (index "
+      << Index() << " of " << pe_endpoint_list->size() << "): prev_state="
+      << (old_state.has_value() ? ConnectivityStateName(*old_state) : "N/A")
+      << " new_state=" << ConnectivityStateName(new_state) << " (" << status
+      << ")";
+  if (new_state == GRPC_CHANNEL_IDLE) {
+    GRPC_TRACE_LOG(peak_ewma_lb, INFO)
+        << "[PEWMA " << peak_ewma << "] child " << this
+        << " reported IDLE; requesting connection";
+    ExitIdleLocked();
+  }
+  // If state changed, update state counters.
+  if (!old_state.has_value() || *old_state != new_state) {
+    pe_endpoint_list->UpdateStateCountersLocked(old_state, new_state);
+  }
+  // Update the policy state.
+  pe_endpoint_list->MaybeUpdatePeakEwmaConnectivityStateLocked(status);
+}
+
+//
+// PeakEwma::PeakEwmaEndpointList
+//
+
+void PeakEwma::PeakEwmaEndpointList::UpdateStateCountersLocked(
+    std::optional<grpc_connectivity_state> old_state,
+    grpc_connectivity_state new_state) {
+  // We treat IDLE the same as CONNECTING, since it will immediately
+  // transition into that state anyway.
+  if (old_state.has_value()) {
+    CHECK(*old_state != GRPC_CHANNEL_SHUTDOWN);
+    if (*old_state == GRPC_CHANNEL_READY) {
+      CHECK_GT(num_ready_, 0u);
+      --num_ready_;
+    } else if (*old_state == GRPC_CHANNEL_CONNECTING ||
+               *old_state == GRPC_CHANNEL_IDLE) {
+      CHECK_GT(num_connecting_, 0u);
+      --num_connecting_;
+    } else if (*old_state == GRPC_CHANNEL_TRANSIENT_FAILURE) {
+      CHECK_GT(num_transient_failure_, 0u);
+      --num_transient_failure_;
+    }
+  }
+  CHECK(new_state != GRPC_CHANNEL_SHUTDOWN);
+  if (new_state == GRPC_CHANNEL_READY) {
+    ++num_ready_;
+  } else if (new_state == GRPC_CHANNEL_CONNECTING ||
+             new_state == GRPC_CHANNEL_IDLE) {
+    ++num_connecting_;
+  } else if (new_state == GRPC_CHANNEL_TRANSIENT_FAILURE) {
+    ++num_transient_failure_;
+  }
+}
+
+void PeakEwma::PeakEwmaEndpointList::
+    MaybeUpdatePeakEwmaConnectivityStateLocked(absl::Status status_for_tf) {
+  auto* peak_ewma = policy<PeakEwma>();
+  // If this is latest_pending_endpoint_list_, then swap it into
+  // endpoint_list_ in the following cases:
+  // - endpoint_list_ has no READY children.
+  // - This list has at least one READY child and we have seen the
+  //   initial connectivity state notification for all children.
+  // - All of the children in this list are in TRANSIENT_FAILURE.
+  //   (This may cause the channel to go from READY to TRANSIENT_FAILURE,
+  //   but we're doing what the control plane told us to do.)
+  if (peak_ewma->latest_pending_endpoint_list_.get() == this &&
+      (peak_ewma->endpoint_list_->num_ready_ == 0 ||
+       (num_ready_ > 0 && AllEndpointsSeenInitialState()) ||
+       num_transient_failure_ == size())) {
+    if (GRPC_TRACE_FLAG_ENABLED(peak_ewma_lb)) {
+      LOG(INFO) << "[PEWMA " << peak_ewma << "] swapping out child list "
+                << peak_ewma->endpoint_list_.get() << " ("
+                << peak_ewma->endpoint_list_->CountersString()
+                << ") in favor of " << this << " (" << CountersString() << ")";
+    }
+    peak_ewma->endpoint_list_ =
+        std::move(peak_ewma->latest_pending_endpoint_list_);
+  }
+  // Only set connectivity state if this is the current child list.
+  if (peak_ewma->endpoint_list_.get() != this) return;
+  // First matching rule wins:
+  // 1) ANY child is READY => policy is READY.
+  // 2) ANY child is CONNECTING => policy is CONNECTING.
+  // 3) ALL children are TRANSIENT_FAILURE => policy is TRANSIENT_FAILURE.
+  if (num_ready_ > 0) {
+    GRPC_TRACE_LOG(peak_ewma_lb, INFO)
+        << "[PEWMA " << peak_ewma << "] reporting READY with child list "
+        << this;
+    std::vector<Picker::EndpointInfo> endpoints;
+    for (const auto& endpoint : this->endpoints()) {
+      auto state = endpoint->connectivity_state();
+      if (state.has_value() && *state == GRPC_CHANNEL_READY) {
+        endpoints.push_back(
+            {endpoint->picker(),
+             static_cast<PeakEwmaEndpoint*>(endpoint.get())->stats()});
+      }
+    }
+    CHECK(!endpoints.empty());
+    peak_ewma->channel_control_helper()->UpdateState(
+        GRPC_CHANNEL_READY, absl::OkStatus(),
+        MakeRefCounted<Picker>(peak_ewma, *peak_ewma->config_,
+                               std::move(endpoints)));
+  } else if (num_connecting_ > 0) {
+    GRPC_TRACE_LOG(peak_ewma_lb, INFO)
+        << "[PEWMA " << peak_ewma << "] reporting CONNECTING with child list "
+        << this;
+    peak_ewma->channel_control_helper()->UpdateState(
+        GRPC_CHANNEL_CONNECTING, absl::OkStatus(),
+        MakeRefCounted<QueuePicker>(nullptr));
+  } else if (num_transient_failure_ == size()) {
+    GRPC_TRACE_LOG(peak_ewma_lb, INFO)
+        << "[PEWMA " << peak_ewma
+        << "] reporting TRANSIENT_FAILURE with child list " << this << ": "
+        << status_for_tf;
+    if (!status_for_tf.ok()) {
+      last_failure_ = absl::UnavailableError(
+          absl::StrCat("connections to all backends failing; last error: ",
+                       status_for_tf.message()));
+    }
+    ReportTransientFailure(last_failure_);
+  }
+}
+
+//
+// factory
+//
+
+class PeakEwmaFactory final : public LoadBalancingPolicyFactory {
+ public:
+  OrphanablePtr<LoadBalancingPolicy> CreateLoadBalancingPolicy(
+      LoadBalancingPolicy::Args args) const override {
+    return MakeOrphanable<PeakEwma>(std::move(args));
+  }
+
+  absl::string_view name() const override { return kPeakEwma; }
+
+  absl::StatusOr<RefCountedPtr<LoadBalancingPolicy::Config>>
+  ParseLoadBalancingConfig(const Json& json) const override {
+    return LoadFromJson<RefCountedPtr<PeakEwmaConfig>>(
+        json, JsonArgs(), "errors validating peak_ewma LB policy config");
+  }
+};
+
+}  // namespace
+
+void RegisterPeakEwmaLbPolicy(CoreConfiguration::Builder* builder) {
+  builder->lb_policy_registry()->RegisterLoadBalancingPolicyFactory(
+      std::make_unique<PeakEwmaFactory>());
+}
+
+}  // namespace grpc_core
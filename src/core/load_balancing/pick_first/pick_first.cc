@@ -23,6 +23,7 @@
 #include <inttypes.h>
 #include <string.h>
 
+#include <algorithm>
 #include <memory>
 #include <optional>
 #include <set>
@@ -101,22 +102,52 @@ const auto kMetricConnectionAttemptsFailed =
         .Labels(kMetricLabelTarget)
         .Build();
 
+// Upper bound on the standbyConnections config field.
+constexpr uint32_t kMaxStandbyConnections = 8;
+
 class PickFirstConfig final : public LoadBalancingPolicy::Config {
  public:
   absl::string_view name() const override { return kPickFirst; }
   bool shuffle_addresses() const { return shuffle_addresses_; }
+  uint32_t standby_connections() const { return standby_connections_; }
+  std::optional<Duration> max_connection_age() const {
+    return max_connection_age_;
+  }
 
   static const JsonLoaderInterface* JsonLoader(const JsonArgs&) {
     static const auto kJsonLoader =
         JsonObjectLoader<PickFirstConfig>()
             .OptionalField("shuffleAddressList",
                            &PickFirstConfig::shuffle_addresses_)
+            .OptionalField("standbyConnections",
+                           &PickFirstConfig::standby_connections_)
+            .OptionalField("maxConnectionAge",
+                           &PickFirstConfig::max_connection_age_)
             .Finish();
     return kJsonLoader;
   }
 
+  void JsonPostLoad(const Json&, const JsonArgs&, ValidationErrors* errors) {
+    if (standby_connections_ > kMaxStandbyConnections) {
+      ValidationErrors::ScopedField field(errors, ".standbyConnections");
+      errors->AddError(
+          absl::StrCat("must be at most ", kMaxStandbyConnections));
+    }
+    if (max_connection_age_.has_value() &&
+        *max_connection_age_ <= Duration::Zero()) {
+      ValidationErrors::ScopedField field(errors, ".maxConnectionAge");
+      errors->AddError("must be greater than zero");
+    }
+  }
+
  private:
   bool shuffle_addresses_ = false;
+  // Number of addresses other than the selected one to keep connected, so
+  // that losing the selected connection does not wait for a handshake.
+  uint32_t standby_connections_ = 0;
+  // The servers' max connection age, if known.  Shortly before the
+  // selected connection reaches it, we move to a standby connection.
+  std::optional<Duration> max_connection_age_;
 };
 
 class PickFirst final : public LoadBalancingPolicy {
@@ -144,13 +175,22 @@ class PickFirst final : public LoadBalancingPolicy {
       class SubchannelState final
           : public InternallyRefCounted<SubchannelState> {
        public:
+        // subchannel_data is null for standby subchannels.
         SubchannelState(SubchannelData* subchannel_data,
+                        RefCountedPtr<PickFirst> pick_first,
                         RefCountedPtr<SubchannelInterface> subchannel);
 
         void Orphan() override;
 
+        // Used to tell whether the max connection age timer is stale.
+        using InternallyRefCounted<SubchannelState>::Ref;
+
         SubchannelInterface* subchannel() const { return subchannel_.get(); }
 
+        // When the subchannel last became READY.  Unset while it is not
+        // READY.  Tracked only once we are out of the subchannel list.
+        std::optional<Timestamp> ready_since() const { return ready_since_; }
+
         void RequestConnection() { subchannel_->RequestConnection(); }
 
         void ResetBackoffLocked() { subchannel_->ResetBackoff(); }
@@ -202,6 +242,7 @@ class PickFirst final : public LoadBalancingPolicy {
         RefCountedPtr<SubchannelInterface> subchannel_;
         SubchannelInterface::ConnectivityStateWatcherInterface* watcher_ =
             nullptr;
+        std::optional<Timestamp> ready_since_;
       };
 
       SubchannelData(SubchannelList* subchannel_list, size_t index,
@@ -224,6 +265,10 @@ class PickFirst final : public LoadBalancingPolicy {
       // Used only during the Happy Eyeballs pass.
       void RequestConnectionWithTimer();
 
+      // Requests a connection attempt without starting the timer, for
+      // the addresses raced at the start of the Happy Eyeballs pass.
+      void RequestConnectionWithoutTimer();
+
       bool seen_transient_failure() const { return seen_transient_failure_; }
       void set_seen_transient_failure() { seen_transient_failure_ = true; }
 
@@ -244,6 +289,8 @@ class PickFirst final : public LoadBalancingPolicy {
       std::optional<grpc_connectivity_state> connectivity_state_;
       absl::Status connectivity_status_;
       bool seen_transient_failure_ = false;
+      // When the Happy Eyeballs pass asked this subchannel to connect.
+      std::optional<Timestamp> connect_start_;
     };
 
     SubchannelList(RefCountedPtr<PickFirst> policy,
@@ -287,6 +334,11 @@ class PickFirst final : public LoadBalancingPolicy {
     // MaybeFinishHappyEyeballsPass().
     void StartConnectingNextSubchannel();
 
+    // Starts the Happy Eyeballs pass: requests connections on the first
+    // parallel_connection_attempts_ subchannels at once, and then
+    // continues from the last of them as usual.
+    void StartConnectionRace();
+
     // Checks to see if the initial Happy Eyeballs pass is complete --
     // i.e., all subchannels have seen TRANSIENT_FAILURE state at least once.
     // If so, transitions to a mode where we try to connect to all subchannels
@@ -361,6 +413,8 @@ class PickFirst final : public LoadBalancingPolicy {
     RefCountedPtr<SubchannelInterface> subchannel_;
   };
 
+  using SubchannelState = SubchannelList::SubchannelData::SubchannelState;
+
   void ShutdownLocked() override;
 
   void UpdateState(grpc_connectivity_state state, const absl::Status& status,
@@ -372,6 +426,30 @@ class PickFirst final : public LoadBalancingPolicy {
 
   void GoIdle();
 
+  // Returns the Connection Attempt Delay to use for the next attempt.
+  Duration ConnectionAttemptDelay() const;
+
+  // Updates smoothed_connect_time_ with a successful connection attempt.
+  void RecordConnectTime(Duration connect_time);
+
+  // The number of standby connections to keep, per the latest config.
+  size_t NumStandbyConnections() const;
+
+  // Makes standby_ hold the first NumStandbyConnections() addresses of
+  // the latest update other than the selected one, reusing existing
+  // standby subchannels where possible.
+  void UpdateStandbySubchannels();
+
+  // Replaces the selected subchannel with a READY standby subchannel, if
+  // there is one.  If keep_old_as_standby is true, the old selected
+  // subchannel becomes a standby.  Returns false if no standby is READY.
+  bool PromoteStandbySubchannel(bool keep_old_as_standby);
+
+  // Starts a timer that fires shortly before the selected connection
+  // reaches the configured max connection age.
+  void StartMaxConnectionAgeTimer();
+  void OnMaxConnectionAgeTimer(RefCountedPtr<SubchannelState> selected);
+
   // When ExitIdleLocked() is called, we create a subchannel_list_ and start
   // trying to connect, but we don't actually change state_ until the first
   // subchannel reports CONNECTING.  So in order to know if we're really
@@ -386,6 +464,12 @@ class PickFirst final : public LoadBalancingPolicy {
   const bool omit_status_message_prefix_;
   // Connection Attempt Delay for Happy Eyeballs.
   const Duration connection_attempt_delay_;
+  // Number of subchannels to start connecting to at once.
+  const size_t parallel_connection_attempts_;
+  // Whether to adapt the Connection Attempt Delay to observed connect times.
+  const bool adaptive_connection_attempt_delay_;
+  // Smoothed time taken by successful connection attempts, if any.
+  std::optional<Duration> smoothed_connect_time_;
 
   // Lateset update args.
   UpdateArgs latest_update_args_;
@@ -397,7 +481,13 @@ class PickFirst final : public LoadBalancingPolicy {
   OrphanablePtr<SubchannelList> subchannel_list_;
   // Selected subchannel.  Will generally be null when subchannel_list_
   // is non-null, with the exception mentioned above.
-  OrphanablePtr<SubchannelList::SubchannelData::SubchannelState> selected_;
+  OrphanablePtr<SubchannelState> selected_;
+  // Subchannels kept connected in case the selected one goes away.
+  std::vector<OrphanablePtr<SubchannelState>> standby_;
+  // Timer for switching away from the selected connection before the
+  // server closes it for age.
+  std::optional<grpc_event_engine::experimental::EventEngine::TaskHandle>
+      max_connection_age_timer_handle_;
   // Health watcher for the selected subchannel.
   SubchannelInterface::ConnectivityStateWatcherInterface* health_watcher_ =
       nullptr;
@@ -422,7 +512,16 @@ PickFirst::PickFirst(Args args)
           Clamp(channel_args()
                     .GetInt(GRPC_ARG_HAPPY_EYEBALLS_CONNECTION_ATTEMPT_DELAY_MS)
                     .value_or(250),
-                100, 2000))) {
+                100, 2000))),
+      parallel_connection_attempts_(std::max(
+          1, channel_args()
+                 .GetInt(GRPC_ARG_HAPPY_EYEBALLS_PARALLEL_CONNECTION_ATTEMPTS)
+                 .value_or(1))),
+      adaptive_connection_attempt_delay_(
+          channel_args()
+              .GetBool(
+                  GRPC_ARG_HAPPY_EYEBALLS_ADAPTIVE_CONNECTION_ATTEMPT_DELAY)
+              .value_or(false)) {
   GRPC_TRACE_LOG(pick_first, INFO) << "Pick First " << this << " created.";
 }
 
@@ -435,6 +534,7 @@ void PickFirst::ShutdownLocked() {
   GRPC_TRACE_LOG(pick_first, INFO) << "Pick First " << this << " Shutting down";
   shutdown_ = true;
   UnsetSelectedSubchannel();
+  standby_.clear();
   subchannel_list_.reset();
 }
 
@@ -478,6 +578,12 @@ void PickFirst::AttemptToConnectUsingLatestUpdateArgsLocked() {
   }
 }
 
+// Returns the args used to create subchannels.
+ChannelArgs MakeSubchannelListArgs(const ChannelArgs& args) {
+  return args.Remove(GRPC_ARG_INTERNAL_PICK_FIRST_ENABLE_HEALTH_CHECKING)
+      .Remove(GRPC_ARG_INTERNAL_PICK_FIRST_OMIT_STATUS_MESSAGE_PREFIX);
+}
+
 absl::string_view GetAddressFamily(const grpc_resolved_address& address) {
   const char* uri_scheme = grpc_sockaddr_get_uri_scheme(&address);
   return absl::string_view(uri_scheme == nullptr ? "other" : uri_scheme);
@@ -599,6 +705,11 @@ void PickFirst::UnsetSelectedSubchannel() {
   if (selected_ != nullptr && health_data_watcher_ != nullptr) {
     selected_->subchannel()->CancelDataWatcher(health_data_watcher_);
   }
+  if (max_connection_age_timer_handle_.has_value()) {
+    channel_control_helper()->GetEventEngine()->Cancel(
+        *max_connection_age_timer_handle_);
+    max_connection_age_timer_handle_.reset();
+  }
   selected_.reset();
   health_watcher_ = nullptr;
   health_data_watcher_ = nullptr;
@@ -618,6 +729,145 @@ void PickFirst::GoIdle() {
               MakeRefCounted<QueuePicker>(Ref(DEBUG_LOCATION, "QueuePicker")));
 }
 
+Duration PickFirst::ConnectionAttemptDelay() const {
+  if (!adaptive_connection_attempt_delay_ ||
+      !smoothed_connect_time_.has_value()) {
+    return connection_attempt_delay_;
+  }
+  // Give an attempt twice as long as attempts usually take before starting
+  // the next one.  RFC 8305 section 5 allows going as low as 10ms when
+  // there is connect time history to go by.
+  return Clamp(*smoothed_connect_time_ * 2, Duration::Milliseconds(10),
+               connection_attempt_delay_);
+}
+
+void PickFirst::RecordConnectTime(Duration connect_time) {
+  // Exponentially weighted moving average, weighted as for TCP's SRTT.
+  if (!smoothed_connect_time_.has_value()) {
+    smoothed_connect_time_ = connect_time;
+  } else {
+    smoothed_connect_time_ = Duration::Milliseconds(
+        (smoothed_connect_time_->millis() * 7 + connect_time.millis()) / 8);
+  }
+  GRPC_TRACE_LOG(pick_first, INFO)
+      << "[PF " << this << "] connection attempt took "
+      << connect_time.millis() << "ms, smoothed connect time now "
+      << smoothed_connect_time_->millis() << "ms";
+}
+
+size_t PickFirst::NumStandbyConnections() const {
+  // Standby connections are not health checked, so they are not used when
+  // we are a child of a petiole policy.
+  if (enable_health_watch_ || latest_update_args_.config == nullptr) return 0;
+  return static_cast<const PickFirstConfig*>(latest_update_args_.config.get())
+      ->standby_connections();
+}
+
+void PickFirst::UpdateStandbySubchannels() {
+  std::vector<OrphanablePtr<SubchannelState>> old_standby =
+      std::move(standby_);
+  standby_.clear();
+  const size_t num_standby = NumStandbyConnections();
+  if (num_standby == 0 || selected_ == nullptr ||
+      !latest_update_args_.addresses.ok()) {
+    return;
+  }
+  const std::string selected_address = selected_->subchannel()->address();
+  const ChannelArgs args = MakeSubchannelListArgs(latest_update_args_.args);
+  (*latest_update_args_.addresses)->ForEach([&](const EndpointAddresses&
+                                                    endpoint) {
+    if (standby_.size() == num_standby) return;
+    auto address = grpc_sockaddr_to_uri(&endpoint.address());
+    if (!address.ok() || *address == selected_address) return;
+    auto it = std::find_if(old_standby.begin(), old_standby.end(),
+                           [&](const OrphanablePtr<SubchannelState>& state) {
+                             return state != nullptr &&
+                                    state->subchannel()->address() == *address;
+                           });
+    if (it != old_standby.end()) {
+      standby_.push_back(std::move(*it));
+      return;
+    }
+    RefCountedPtr<SubchannelInterface> subchannel =
+        channel_control_helper()->CreateSubchannel(endpoint.address(),
+                                                   endpoint.args(), args);
+    if (subchannel == nullptr) return;
+    GRPC_TRACE_LOG(pick_first, INFO)
+        << "Pick First " << this << " keeping standby subchannel "
+        << subchannel.get() << " for address " << *address;
+    standby_.push_back(MakeOrphanable<SubchannelState>(
+        nullptr, RefAsSubclass<PickFirst>(DEBUG_LOCATION, "SubchannelState"),
+        std::move(subchannel)));
+  });
+  // Any standby subchannels no longer wanted are dropped here, after the
+  // ones we kept have taken their refs.
+}
+
+bool PickFirst::PromoteStandbySubchannel(bool keep_old_as_standby) {
+  auto it = std::find_if(standby_.begin(), standby_.end(),
+                         [](const OrphanablePtr<SubchannelState>& state) {
+                           return state->ready_since().has_value();
+                         });
+  if (it == standby_.end()) return false;
+  OrphanablePtr<SubchannelState> standby = std::move(*it);
+  standby_.erase(it);
+  GRPC_TRACE_LOG(pick_first, INFO)
+      << "Pick First " << this << " switching to standby subchannel "
+      << standby->subchannel();
+  OrphanablePtr<SubchannelState> old_selected = std::move(selected_);
+  UnsetSelectedSubchannel();
+  selected_ = std::move(standby);
+  UpdateState(GRPC_CHANNEL_READY, absl::OkStatus(),
+              MakeRefCounted<Picker>(selected_->subchannel()->Ref()));
+  if (keep_old_as_standby) standby_.push_back(std::move(old_selected));
+  UpdateStandbySubchannels();
+  StartMaxConnectionAgeTimer();
+  return true;
+}
+
+void PickFirst::StartMaxConnectionAgeTimer() {
+  if (selected_ == nullptr || !selected_->ready_since().has_value() ||
+      NumStandbyConnections() == 0) {
+    return;
+  }
+  std::optional<Duration> max_connection_age =
+      static_cast<const PickFirstConfig*>(latest_update_args_.config.get())
+          ->max_connection_age();
+  if (!max_connection_age.has_value()) return;
+  // Servers jitter the max connection age by up to 10%, so aim for the
+  // earliest time the server could send its GOAWAY.
+  const Duration delay = std::max(
+      Duration::Zero(), *selected_->ready_since() + *max_connection_age * 0.9 -
+                            Timestamp::Now());
+  GRPC_TRACE_LOG(pick_first, INFO)
+      << "Pick First " << this << " switching away from subchannel "
+      << selected_->subchannel() << " in " << delay;
+  max_connection_age_timer_handle_ =
+      channel_control_helper()->GetEventEngine()->RunAfter(
+          delay,
+          [self = RefAsSubclass<PickFirst>(DEBUG_LOCATION,
+                                           "MaxConnectionAgeTimer"),
+           selected = selected_->Ref(DEBUG_LOCATION,
+                                     "MaxConnectionAgeTimer")]() mutable {
+            ExecCtx exec_ctx;
+            auto* self_ptr = self.get();
+            self_ptr->work_serializer()->Run(
+                [self = std::move(self),
+                 selected = std::move(selected)]() mutable {
+                  self->OnMaxConnectionAgeTimer(std::move(selected));
+                });
+          });
+}
+
+void PickFirst::OnMaxConnectionAgeTimer(
+    RefCountedPtr<SubchannelState> selected) {
+  if (shutdown_ || selected_.get() != selected.get()) return;
+  max_connection_age_timer_handle_.reset();
+  // If no standby is ready, the server's GOAWAY will be handled like any
+  // other disconnection.
+  PromoteStandbySubchannel(/*keep_old_as_standby=*/true);
+}
+
 //
 // PickFirst::HealthWatcher
 //
@@ -667,10 +917,10 @@ void PickFirst::HealthWatcher::OnConnectivityStateChange(
 //
 
 PickFirst::SubchannelList::SubchannelData::SubchannelState::SubchannelState(
-    SubchannelData* subchannel_data,
+    SubchannelData* subchannel_data, RefCountedPtr<PickFirst> pick_first,
     RefCountedPtr<SubchannelInterface> subchannel)
     : subchannel_data_(subchannel_data),
-      pick_first_(subchannel_data_->subchannel_list_->policy_),
+      pick_first_(std::move(pick_first)),
       subchannel_(std::move(subchannel)) {
   GRPC_TRACE_LOG(pick_first, INFO)
       << "[PF " << pick_first_.get() << "] subchannel state " << this
@@ -731,12 +981,20 @@ void PickFirst::SubchannelList::SubchannelData::SubchannelState::Select() {
     stats_plugins.AddCounter(
         kMetricConnectionAttemptsSucceeded, 1,
         {pick_first_->channel_control_helper()->GetTarget()}, {});
+    if (subchannel_data_->connect_start_.has_value()) {
+      pick_first_->RecordConnectTime(Timestamp::Now() -
+                                     *subchannel_data_->connect_start_);
+    }
   }
   // Drop our pointer to subchannel_data_, so that we know not to
   // interact with it on subsequent connectivity state updates.
   subchannel_data_ = nullptr;
+  ready_since_ = Timestamp::Now();
   // Clean up subchannel list.
   pick_first_->subchannel_list_.reset();
+  // Warm up standby connections, if configured.
+  pick_first_->UpdateStandbySubchannels();
+  pick_first_->StartMaxConnectionAgeTimer();
 }
 
 void PickFirst::SubchannelList::SubchannelData::SubchannelState::
@@ -764,8 +1022,17 @@ void PickFirst::SubchannelList::SubchannelData::SubchannelState::
     }
     return;
   }
-  // We aren't trying to connect, so we must be the selected subchannel.
-  CHECK_EQ(pick_first_->selected_.get(), this);
+  // If we aren't the selected subchannel, we are a standby, which we
+  // only need to keep connected.
+  if (pick_first_->selected_.get() != this) {
+    if (new_state == GRPC_CHANNEL_READY) {
+      ready_since_ = Timestamp::Now();
+    } else {
+      ready_since_.reset();
+      if (new_state == GRPC_CHANNEL_IDLE) RequestConnection();
+    }
+    return;
+  }
   GRPC_TRACE_LOG(pick_first, INFO)
       << "Pick First " << pick_first_.get()
       << " selected subchannel connectivity changed to "
@@ -777,6 +1044,14 @@ void PickFirst::SubchannelList::SubchannelData::SubchannelState::
   stats_plugins.AddCounter(kMetricDisconnections, 1,
                            {pick_first_->channel_control_helper()->GetTarget()},
                            {});
+  // If a standby connection is ready, move to it right away.
+  if (!pick_first_->standby_.empty()) {
+    PickFirst* pick_first = pick_first_.get();
+    if (pick_first->PromoteStandbySubchannel(/*keep_old_as_standby=*/false)) {
+      pick_first->channel_control_helper()->RequestReresolution();
+      return;
+    }
+  }
   // Report IDLE.
   pick_first_->GoIdle();
 }
@@ -793,8 +1068,8 @@ PickFirst::SubchannelList::SubchannelData::SubchannelData(
       << "[PF " << subchannel_list_->policy_.get() << "] subchannel list "
       << subchannel_list_ << " index " << index_
       << ": creating subchannel data";
-  subchannel_state_ =
-      MakeOrphanable<SubchannelState>(this, std::move(subchannel));
+  subchannel_state_ = MakeOrphanable<SubchannelState>(
+      this, subchannel_list_->policy_, std::move(subchannel));
 }
 
 void PickFirst::SubchannelList::SubchannelData::OnConnectivityStateChange(
@@ -829,6 +1104,9 @@ void PickFirst::SubchannelList::SubchannelData::OnConnectivityStateChange(
   // Make sure we note when a subchannel has seen TRANSIENT_FAILURE.
   if (new_state == GRPC_CHANNEL_TRANSIENT_FAILURE) {
     subchannel_list_->last_failure_ = connectivity_status_;
+    // A failed attempt says nothing about how long connecting takes, and
+    // the next attempt is not one the Happy Eyeballs pass started.
+    connect_start_.reset();
   }
   // If this is the initial connectivity state update for this subchannel,
   // increment the counter in the subchannel list.
@@ -856,7 +1134,7 @@ void PickFirst::SubchannelList::SubchannelData::OnConnectivityStateChange(
       p->GoIdle();
     } else {
       // Start trying to connect, starting with the first subchannel.
-      subchannel_list_->StartConnectingNextSubchannel();
+      subchannel_list_->StartConnectionRace();
     }
     return;
   }
@@ -939,23 +1217,32 @@ void PickFirst::SubchannelList::SubchannelData::OnConnectivityStateChange(
   }
 }
 
-void PickFirst::SubchannelList::SubchannelData::RequestConnectionWithTimer() {
+void PickFirst::SubchannelList::SubchannelData::
+    RequestConnectionWithoutTimer() {
   CHECK(connectivity_state_.has_value());
   if (connectivity_state_ == GRPC_CHANNEL_IDLE) {
     subchannel_state_->RequestConnection();
+    // Only time attempts that we started: one already in progress began
+    // at some unknown point before now.
+    connect_start_ = Timestamp::Now();
   } else {
     CHECK_EQ(connectivity_state_.value(), GRPC_CHANNEL_CONNECTING);
   }
+}
+
+void PickFirst::SubchannelList::SubchannelData::RequestConnectionWithTimer() {
+  RequestConnectionWithoutTimer();
   // If this is not the last subchannel in the list, start the timer.
   if (index_ != subchannel_list_->size() - 1) {
     PickFirst* p = subchannel_list_->policy_.get();
+    const Duration delay = p->ConnectionAttemptDelay();
     GRPC_TRACE_LOG(pick_first, INFO)
         << "Pick First " << p << " subchannel list " << subchannel_list_
-        << ": starting Connection Attempt Delay timer for "
-        << p->connection_attempt_delay_.millis() << "ms for index " << index_;
+        << ": starting Connection Attempt Delay timer for " << delay.millis()
+        << "ms for index " << index_;
     subchannel_list_->timer_handle_ =
         p->channel_control_helper()->GetEventEngine()->RunAfter(
-            p->connection_attempt_delay_,
+            delay,
             [subchannel_list =
                  subchannel_list_->Ref(DEBUG_LOCATION, "timer")]() mutable {
               ExecCtx exec_ctx;
@@ -989,9 +1276,7 @@ PickFirst::SubchannelList::SubchannelList(RefCountedPtr<PickFirst> policy,
     : InternallyRefCounted<SubchannelList>(
           GRPC_TRACE_FLAG_ENABLED(pick_first) ? "SubchannelList" : nullptr),
       policy_(std::move(policy)),
-      args_(
-          args.Remove(GRPC_ARG_INTERNAL_PICK_FIRST_ENABLE_HEALTH_CHECKING)
-              .Remove(GRPC_ARG_INTERNAL_PICK_FIRST_OMIT_STATUS_MESSAGE_PREFIX)),
+      args_(MakeSubchannelListArgs(args)),
       resolution_note_(resolution_note) {
   GRPC_TRACE_LOG(pick_first, INFO)
       << "[PF " << policy_.get() << "] Creating subchannel list " << this
@@ -1074,6 +1359,23 @@ void PickFirst::SubchannelList::StartConnectingNextSubchannel() {
   MaybeFinishHappyEyeballsPass();
 }
 
+void PickFirst::SubchannelList::StartConnectionRace() {
+  // Subchannels in TRANSIENT_FAILURE are skipped, as in
+  // StartConnectingNextSubchannel(), and count towards the race.
+  const size_t race_size =
+      std::min(policy_->parallel_connection_attempts_, size());
+  for (; attempting_index_ + 1 < race_size; ++attempting_index_) {
+    SubchannelData* sc = subchannels_[attempting_index_].get();
+    CHECK(sc->connectivity_state().has_value());
+    if (sc->connectivity_state() == GRPC_CHANNEL_TRANSIENT_FAILURE) {
+      sc->set_seen_transient_failure();
+    } else {
+      sc->RequestConnectionWithoutTimer();
+    }
+  }
+  StartConnectingNextSubchannel();
+}
+
 void PickFirst::SubchannelList::MaybeFinishHappyEyeballsPass() {
   // Make sure all subchannels have finished a connection attempt before
   // we consider the Happy Eyeballs pass complete.
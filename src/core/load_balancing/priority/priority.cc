@@ -148,6 +148,10 @@ class PriorityLb final : public LoadBalancingPolicy {
 
     RefCountedPtr<SubchannelPicker> GetPicker();
 
+    // The picker last reported by the child, or null if it has not
+    // reported one yet.
+    const RefCountedPtr<SubchannelPicker>& picker() const { return picker_; }
+
     grpc_connectivity_state connectivity_state() const {
       return connectivity_state_;
     }
@@ -279,6 +283,14 @@ class PriorityLb final : public LoadBalancingPolicy {
   std::map<std::string, OrphanablePtr<ChildPriority>> children_;
   // The priority that is being used.
   uint32_t current_priority_ = UINT32_MAX;
+
+  // The state, status and child picker last reported to the channel.  An
+  // update from a child that is not the current priority usually leaves
+  // all three unchanged, in which case it is not passed up.  The picker
+  // is null when a QueuePicker was reported for a child that had none.
+  std::optional<grpc_connectivity_state> reported_state_;
+  absl::Status reported_status_;
+  RefCountedPtr<SubchannelPicker> reported_picker_;
 };
 
 //
@@ -305,6 +317,8 @@ void PriorityLb::ShutdownLocked() {
       << "[priority_lb " << this << "] shutting down";
   shutting_down_ = true;
   children_.clear();
+  reported_state_.reset();
+  reported_picker_.reset();
 }
 
 void PriorityLb::ExitIdleLocked() {
@@ -379,6 +393,8 @@ void PriorityLb::ChoosePriorityLocked() {
   if (config_->priorities().empty()) {
     absl::Status status =
         absl::UnavailableError("priority policy has empty priority list");
+    reported_state_.reset();
+    reported_picker_.reset();
     channel_control_helper()->UpdateState(
         GRPC_CHANNEL_TRANSIENT_FAILURE, status,
         MakeRefCounted<TransientFailurePicker>(status));
@@ -481,6 +497,16 @@ void PriorityLb::SetCurrentPriorityLocked(int32_t priority,
   }
   auto& child = children_[config_->priorities()[priority]];
   CHECK(child != nullptr);
+  if (reported_state_ == child->connectivity_state() &&
+      reported_status_ == child->connectivity_status() &&
+      reported_picker_ == child->picker()) {
+    GRPC_TRACE_LOG(priority_lb, INFO)
+        << "[priority_lb " << this << "] picker unchanged, not reporting";
+    return;
+  }
+  reported_state_ = child->connectivity_state();
+  reported_status_ = child->connectivity_status();
+  reported_picker_ = child->picker();
   channel_control_helper()->UpdateState(child->connectivity_state(),
                                         child->connectivity_status(),
                                         child->GetPicker());
@@ -24,12 +24,15 @@
 #include <stdlib.h>
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <limits>
 #include <map>
 #include <memory>
 #include <optional>
 #include <string>
 #include <utility>
+#include <variant>
 #include <vector>
 
 #include "absl/base/attributes.h"
@@ -113,6 +116,10 @@ class RingHashLbConfig final : public LoadBalancingPolicy::Config {
   size_t min_ring_size() const { return min_ring_size_; }
   size_t max_ring_size() const { return max_ring_size_; }
   absl::string_view request_hash_header() const { return request_hash_header_; }
+  // Zero if loads are not bounded.
+  uint32_t hash_balance_factor() const { return hash_balance_factor_; }
+  bool use_maglev() const { return lookup_table_ == "MAGLEV"; }
+  size_t maglev_table_size() const { return maglev_table_size_; }
 
   static const JsonLoaderInterface* JsonLoader(const JsonArgs&) {
     static const auto* loader =
@@ -122,6 +129,11 @@ class RingHashLbConfig final : public LoadBalancingPolicy::Config {
             .OptionalField("requestHashHeader",
                            &RingHashLbConfig::request_hash_header_,
                            "request_hash_header")
+            .OptionalField("hashBalanceFactor",
+                           &RingHashLbConfig::hash_balance_factor_)
+            .OptionalField("lookupTable", &RingHashLbConfig::lookup_table_)
+            .OptionalField("maglevTableSize",
+                           &RingHashLbConfig::maglev_table_size_)
             .Finish();
     return loader;
   }
@@ -144,12 +156,53 @@ class RingHashLbConfig final : public LoadBalancingPolicy::Config {
     if (min_ring_size_ > max_ring_size_) {
       errors->AddError("maxRingSize cannot be smaller than minRingSize");
     }
+    {
+      ValidationErrors::ScopedField field(errors, ".hashBalanceFactor");
+      if (!errors->FieldHasErrors() && hash_balance_factor_ != 0 &&
+          hash_balance_factor_ < 100) {
+        errors->AddError("must be at least 100");
+      }
+    }
+    {
+      ValidationErrors::ScopedField field(errors, ".lookupTable");
+      if (!errors->FieldHasErrors() && lookup_table_ != "RING" &&
+          lookup_table_ != "MAGLEV") {
+        errors->AddError("must be RING or MAGLEV");
+      }
+    }
+    {
+      ValidationErrors::ScopedField field(errors, ".maglevTableSize");
+      if (!errors->FieldHasErrors() &&
+          (maglev_table_size_ > kMaxMaglevTableSize ||
+           !IsPrime(maglev_table_size_))) {
+        errors->AddError(absl::StrCat("must be a prime number at most ",
+                                      kMaxMaglevTableSize));
+      }
+    }
   }
 
  private:
+  // As in Envoy's Maglev implementation.
+  static constexpr uint64_t kMaxMaglevTableSize = 5000011;
+
+  static bool IsPrime(uint64_t n) {
+    if (n < 2) return false;
+    for (uint64_t i = 2; i * i <= n; ++i) {
+      if (n % i == 0) return false;
+    }
+    return true;
+  }
+
   uint64_t min_ring_size_ = 1024;
   uint64_t max_ring_size_ = 4096;
   std::string request_hash_header_;
+  // Percentage of the average load that an endpoint may take before picks
+  // spill over to the next entry; see "Consistent Hashing with Bounded
+  // Loads" (Mirrokni et al.).
+  uint32_t hash_balance_factor_ = 0;
+  // RING for a ketama ring, MAGLEV for a Maglev lookup table.
+  std::string lookup_table_ = "RING";
+  uint64_t maglev_table_size_ = 65537;
 };
 
 //
@@ -168,7 +221,11 @@ class RingHash final : public LoadBalancingPolicy {
   void ResetBackoffLocked() override;
 
  private:
-  // A ring computed based on a config and address list.
+  // A ring computed based on a config and address list.  Depending on the
+  // config, this is either a ketama ring sorted by hash, or a Maglev lookup
+  // table indexed by hash modulo its (prime) size.  Either way, a pick
+  // starts at the entry for the request hash, and walks the following
+  // entries if that endpoint cannot be used.
   class Ring final : public RefCounted<Ring> {
    public:
     struct RingEntry {
@@ -178,10 +235,45 @@ class RingHash final : public LoadBalancingPolicy {
 
     Ring(RingHash* ring_hash, RingHashLbConfig* config);
 
-    const std::vector<RingEntry>& ring() const { return ring_; }
+    size_t size() const {
+      return maglev_table_.empty() ? ring_.size() : maglev_table_.size();
+    }
+
+    // Returns the index of the endpoint for entry i in
+    // RingHash::endpoints_.
+    size_t endpoint_index(size_t i) const {
+      return maglev_table_.empty() ? ring_[i].endpoint_index
+                                   : maglev_table_[i];
+    }
+
+    // Returns the entry to start from for a request hash.
+    size_t FindIndex(uint64_t request_hash) const;
+
+    // The endpoint's share of the total weight of all endpoints.
+    double normalized_weight(size_t endpoint_index) const {
+      return normalized_weights_[endpoint_index];
+    }
 
    private:
+    struct EndpointWeight {
+      std::string hash_key;  // By default, endpoint's first address.
+      // Default weight is 1 for the cases where a weight is not provided,
+      // each occurrence of the address will be counted a weight value of 1.
+      uint32_t weight = 1;
+      double normalized_weight;
+    };
+
+    void BuildRing(RingHash* ring_hash, RingHashLbConfig* config,
+                   const std::vector<EndpointWeight>& endpoint_weights,
+                   double min_normalized_weight);
+    void BuildMaglevTable(const std::vector<EndpointWeight>& endpoint_weights,
+                          double max_normalized_weight, size_t table_size);
+
     std::vector<RingEntry> ring_;
+    // Four bytes per entry instead of the ring's sixteen, and picks are a
+    // modulo instead of a binary search.
+    std::vector<uint32_t> maglev_table_;
+    std::vector<double> normalized_weights_;
   };
 
   // State for a particular endpoint.  Delegates to a pick_first child policy.
@@ -218,6 +310,15 @@ class RingHash final : public LoadBalancingPolicy {
     // asks the child to exit IDLE.
     void RequestConnectionLocked();
 
+    // Calls in flight to this endpoint.  Only counted when loads are
+    // bounded.  Accessed from the data plane.
+    int64_t in_flight() const {
+      return in_flight_.load(std::memory_order_relaxed);
+    }
+    void AddInFlight(int64_t delta) {
+      in_flight_.fetch_add(delta, std::memory_order_relaxed);
+    }
+
    private:
     class Helper;
 
@@ -239,23 +340,23 @@ class RingHash final : public LoadBalancingPolicy {
     grpc_connectivity_state connectivity_state_ = GRPC_CHANNEL_IDLE;
     absl::Status status_;
     RefCountedPtr<SubchannelPicker> picker_;
+
+    std::atomic<int64_t> in_flight_{0};
   };
 
+  static constexpr size_t kEndpointInfoChunkSize = 64;
+  using EndpointInfoChunk = std::vector<RingHashEndpoint::EndpointInfo>;
+
   class Picker final : public SubchannelPicker {
    public:
     explicit Picker(RefCountedPtr<RingHash> ring_hash)
         : ring_hash_(std::move(ring_hash)),
           ring_(ring_hash_->ring_),
-          endpoints_(ring_hash_->endpoints_.size()),
+          endpoint_info_chunks_(ring_hash_->endpoint_info_chunks_),
+          has_endpoint_in_connecting_state_(ring_hash_->num_connecting_ > 0),
           resolution_note_(ring_hash_->resolution_note_),
-          request_hash_header_(ring_hash_->request_hash_header_) {
-      for (const auto& [_, endpoint] : ring_hash_->endpoint_map_) {
-        endpoints_[endpoint->index()] = endpoint->GetInfoForPicker();
-        if (endpoints_[endpoint->index()].state == GRPC_CHANNEL_CONNECTING) {
-          has_endpoint_in_connecting_state_ = true;
-        }
-      }
-    }
+          request_hash_header_(ring_hash_->request_hash_header_),
+          hash_balance_factor_(ring_hash_->hash_balance_factor_) {}
 
     PickResult Pick(PickArgs args) override;
 
@@ -289,12 +390,71 @@ class RingHash final : public LoadBalancingPolicy {
       grpc_closure closure_;
     };
 
+    // Counts a call against its endpoint's load, from the pick until the
+    // call finishes or the pick is abandoned.
+    class SubchannelCallTracker final : public SubchannelCallTrackerInterface {
+     public:
+      SubchannelCallTracker(
+          RefCountedPtr<RingHash> ring_hash,
+          RefCountedPtr<RingHashEndpoint> endpoint,
+          std::unique_ptr<SubchannelCallTrackerInterface> child_tracker)
+          : ring_hash_(std::move(ring_hash)),
+            endpoint_(std::move(endpoint)),
+            child_tracker_(std::move(child_tracker)) {
+        endpoint_->AddInFlight(1);
+        ring_hash_->total_in_flight_.fetch_add(1, std::memory_order_relaxed);
+      }
+
+      ~SubchannelCallTracker() override { Release(); }
+
+      void Start() override {
+        if (child_tracker_ != nullptr) child_tracker_->Start();
+      }
+
+      void Finish(FinishArgs args) override {
+        if (child_tracker_ != nullptr) child_tracker_->Finish(args);
+        Release();
+      }
+
+     private:
+      void Release() {
+        if (endpoint_ == nullptr) return;
+        endpoint_->AddInFlight(-1);
+        ring_hash_->total_in_flight_.fetch_sub(1, std::memory_order_relaxed);
+        endpoint_.reset();
+      }
+
+      RefCountedPtr<RingHash> ring_hash_;
+      RefCountedPtr<RingHashEndpoint> endpoint_;
+      std::unique_ptr<SubchannelCallTrackerInterface> child_tracker_;
+    };
+
+    // Returns true if the endpoint can take one more call without going
+    // over hash_balance_factor_ percent of its share of the calls in
+    // flight, counting the new one.
+    bool HasCapacity(size_t endpoint_index, int64_t total_in_flight) const {
+      const double limit = std::ceil(hash_balance_factor_ / 100.0 *
+                                     (total_in_flight + 1) *
+                                     ring_->normalized_weight(endpoint_index));
+      return GetEndpointInfo(endpoint_index).endpoint->in_flight() + 1 <= limit;
+    }
+
+    const RingHashEndpoint::EndpointInfo& GetEndpointInfo(size_t index) const {
+      return (*endpoint_info_chunks_[index / kEndpointInfoChunkSize])
+          [index % kEndpointInfoChunkSize];
+    }
+
+    // Delegates the pick to a READY endpoint.
+    PickResult PickEndpoint(const RingHashEndpoint::EndpointInfo& endpoint_info,
+                            PickArgs args);
+
     RefCountedPtr<RingHash> ring_hash_;
     RefCountedPtr<Ring> ring_;
-    std::vector<RingHashEndpoint::EndpointInfo> endpoints_;
-    bool has_endpoint_in_connecting_state_ = false;
+    std::vector<std::shared_ptr<const EndpointInfoChunk>> endpoint_info_chunks_;
+    const bool has_endpoint_in_connecting_state_;
     std::string resolution_note_;
     RefCountedStringValue request_hash_header_;
+    const uint32_t hash_balance_factor_;
   };
 
   ~RingHash() override;
@@ -307,15 +467,46 @@ class RingHash final : public LoadBalancingPolicy {
   // TRANSIENT_FAILURE, then status is the status reported by the endpoint.
   void UpdateAggregatedConnectivityStateLocked(absl::Status status);
 
+  // Recomputes the state counters and the endpoint info chunks from
+  // endpoint_map_, after the endpoint list changes.
+  void RebuildEndpointInfoLocked();
+
+  // Updates the state counters and the endpoint info chunk for an
+  // endpoint that has just reported a new state or picker.
+  void UpdateEndpointInfoLocked(RingHashEndpoint* endpoint,
+                                grpc_connectivity_state old_state);
+
+  // Adds delta to the counter for endpoints in state.
+  void CountEndpointState(grpc_connectivity_state state, int delta);
+
   // Current endpoint list, channel args, and ring.
   EndpointAddressesList endpoints_;
   ChannelArgs args_;
   RefCountedStringValue request_hash_header_;
+  uint32_t hash_balance_factor_ = 0;
   RefCountedPtr<Ring> ring_;
 
+  // Calls in flight to all endpoints, when loads are bounded.  Accessed
+  // from the data plane.
+  std::atomic<int64_t> total_in_flight_{0};
+
   std::map<EndpointAddressSet, OrphanablePtr<RingHashEndpoint>> endpoint_map_;
   std::string resolution_note_;
 
+  // The endpoint info for pickers, indexed like endpoints_, in chunks of
+  // kEndpointInfoChunkSize.  Pickers share the chunks, and an endpoint
+  // reporting a new state copies only its own chunk, so building a
+  // picker costs one pointer per chunk rather than a copy of every
+  // endpoint's info.
+  std::vector<std::shared_ptr<const EndpointInfoChunk>> endpoint_info_chunks_;
+
+  // Number of endpoints in each state, kept up to date as endpoints
+  // report their states.
+  size_t num_idle_ = 0;
+  size_t num_connecting_ = 0;
+  size_t num_ready_ = 0;
+  size_t num_transient_failure_ = 0;
+
   // TODO(roth): If we ever change the helper UpdateState() API to not
   // need the status reported for TRANSIENT_FAILURE state (because
   // it's not currently actually used for anything outside of the picker),
@@ -355,48 +546,49 @@ RingHash::PickResult RingHash::Picker::Pick(PickArgs args) {
     }
   }
   // Find the index in the ring to use for this RPC.
-  // Ported from https://github.com/RJ/ketama/blob/master/libketama/ketama.c
-  // (ketama_get_server) NOTE: The algorithm depends on using signed integers
-  // for lowp, highp, and index. Do not change them!
-  const auto& ring = ring_->ring();
-  int64_t lowp = 0;
-  int64_t highp = ring.size();
-  int64_t index = 0;
-  while (true) {
-    index = (lowp + highp) / 2;
-    if (index == static_cast<int64_t>(ring.size())) {
-      index = 0;
-      break;
+  const size_t ring_size = ring_->size();
+  const size_t index = ring_->FindIndex(request_hash);
+  // When loads are bounded, READY endpoints that are at their bound are
+  // passed over for the next one on the ring, and only used if no other
+  // READY endpoint has room.
+  const int64_t total_in_flight =
+      hash_balance_factor_ == 0
+          ? 0
+          : ring_hash_->total_in_flight_.load(std::memory_order_relaxed);
+  std::optional<size_t> overloaded_endpoint_index;
+  auto has_capacity = [&](size_t endpoint_index) {
+    if (hash_balance_factor_ == 0 ||
+        HasCapacity(endpoint_index, total_in_flight)) {
+      return true;
     }
-    uint64_t midval = ring[index].hash;
-    uint64_t midval1 = index == 0 ? 0 : ring[index - 1].hash;
-    if (request_hash <= midval && request_hash > midval1) {
-      break;
+    if (!overloaded_endpoint_index.has_value()) {
+      overloaded_endpoint_index = endpoint_index;
     }
-    if (midval < request_hash) {
-      lowp = index + 1;
-    } else {
-      highp = index - 1;
-    }
-    if (lowp > highp) {
-      index = 0;
-      break;
-    }
-  }
+    return false;
+  };
   // Find the first endpoint we can use from the selected index.
   if (!using_random_hash) {
-    for (size_t i = 0; i < ring.size(); ++i) {
-      const auto& entry = ring[(index + i) % ring.size()];
-      const auto& endpoint_info = endpoints_[entry.endpoint_index];
+    bool requested_connection = false;
+    for (size_t i = 0; i < ring_size; ++i) {
+      const size_t endpoint_index =
+          ring_->endpoint_index((index + i) % ring_size);
+      const auto& endpoint_info = GetEndpointInfo(endpoint_index);
       switch (endpoint_info.state) {
         case GRPC_CHANNEL_READY:
-          return endpoint_info.picker->Pick(args);
+          if (!has_capacity(endpoint_index)) break;
+          return PickEndpoint(endpoint_info, args);
         case GRPC_CHANNEL_IDLE:
-          new EndpointConnectionAttempter(
-              ring_hash_.Ref(DEBUG_LOCATION, "EndpointConnectionAttempter"),
-              endpoint_info.endpoint);
+          if (!requested_connection) {
+            new EndpointConnectionAttempter(
+                ring_hash_.Ref(DEBUG_LOCATION, "EndpointConnectionAttempter"),
+                endpoint_info.endpoint);
+            requested_connection = true;
+          }
           [[fallthrough]];
         case GRPC_CHANNEL_CONNECTING:
+          // Rather than wait for this endpoint, spill over to the next one
+          // when the endpoint for this hash is merely too busy.
+          if (overloaded_endpoint_index.has_value()) break;
           return PickResult::Queue();
         default:
           break;
@@ -406,11 +598,13 @@ RingHash::PickResult RingHash::Picker::Pick(PickArgs args) {
     // Using a random hash.  We will use the first READY endpoint we
     // find, triggering at most one endpoint to attempt connecting.
     bool requested_connection = has_endpoint_in_connecting_state_;
-    for (size_t i = 0; i < ring.size(); ++i) {
-      const auto& entry = ring[(index + i) % ring.size()];
-      const auto& endpoint_info = endpoints_[entry.endpoint_index];
-      if (endpoint_info.state == GRPC_CHANNEL_READY) {
-        return endpoint_info.picker->Pick(args);
+    for (size_t i = 0; i < ring_size; ++i) {
+      const size_t endpoint_index =
+          ring_->endpoint_index((index + i) % ring_size);
+      const auto& endpoint_info = GetEndpointInfo(endpoint_index);
+      if (endpoint_info.state == GRPC_CHANNEL_READY &&
+          has_capacity(endpoint_index)) {
+        return PickEndpoint(endpoint_info, args);
       }
       if (!requested_connection && endpoint_info.state == GRPC_CHANNEL_IDLE) {
         new EndpointConnectionAttempter(
@@ -419,30 +613,41 @@ RingHash::PickResult RingHash::Picker::Pick(PickArgs args) {
         requested_connection = true;
       }
     }
-    if (requested_connection) return PickResult::Queue();
+    if (requested_connection && !overloaded_endpoint_index.has_value()) {
+      return PickResult::Queue();
+    }
+  }
+  if (overloaded_endpoint_index.has_value()) {
+    return PickEndpoint(GetEndpointInfo(*overloaded_endpoint_index), args);
   }
   std::string message = absl::StrCat(
       "ring hash cannot find a connected endpoint; first failure: ",
-      endpoints_[ring[index].endpoint_index].status.message());
+      GetEndpointInfo(ring_->endpoint_index(index)).status.message());
   if (!resolution_note_.empty()) {
     absl::StrAppend(&message, " (", resolution_note_, ")");
   }
   return PickResult::Fail(absl::UnavailableError(message));
 }
 
+RingHash::PickResult RingHash::Picker::PickEndpoint(
+    const RingHashEndpoint::EndpointInfo& endpoint_info, PickArgs args) {
+  PickResult result = endpoint_info.picker->Pick(args);
+  if (hash_balance_factor_ == 0) return result;
+  auto* complete = std::get_if<PickResult::Complete>(&result.result);
+  if (complete != nullptr) {
+    complete->subchannel_call_tracker = std::make_unique<SubchannelCallTracker>(
+        ring_hash_.Ref(DEBUG_LOCATION, "SubchannelCallTracker"),
+        endpoint_info.endpoint, std::move(complete->subchannel_call_tracker));
+  }
+  return result;
+}
+
 //
 // RingHash::Ring
 //
 
 RingHash::Ring::Ring(RingHash* ring_hash, RingHashLbConfig* config) {
   // Store the weights while finding the sum.
-  struct EndpointWeight {
-    std::string hash_key;  // By default, endpoint's first address.
-    // Default weight is 1 for the cases where a weight is not provided,
-    // each occurrence of the address will be counted a weight value of 1.
-    uint32_t weight = 1;
-    double normalized_weight;
-  };
   std::vector<EndpointWeight> endpoint_weights;
   size_t sum = 0;
   const EndpointAddressesList& endpoints = ring_hash->endpoints_;
@@ -469,14 +674,28 @@ RingHash::Ring::Ring(RingHash* ring_hash, RingHashLbConfig* config) {
   // Calculating normalized weights and find min and max.
   double min_normalized_weight = 1.0;
   double max_normalized_weight = 0.0;
+  normalized_weights_.reserve(endpoint_weights.size());
   for (auto& endpoint_weight : endpoint_weights) {
     endpoint_weight.normalized_weight =
         static_cast<double>(endpoint_weight.weight) / sum;
+    normalized_weights_.push_back(endpoint_weight.normalized_weight);
     min_normalized_weight =
         std::min(endpoint_weight.normalized_weight, min_normalized_weight);
     max_normalized_weight =
         std::max(endpoint_weight.normalized_weight, max_normalized_weight);
   }
+  if (config->use_maglev()) {
+    BuildMaglevTable(endpoint_weights, max_normalized_weight,
+                     config->maglev_table_size());
+  } else {
+    BuildRing(ring_hash, config, endpoint_weights, min_normalized_weight);
+  }
+}
+
+void RingHash::Ring::BuildRing(
+    RingHash* ring_hash, RingHashLbConfig* config,
+    const std::vector<EndpointWeight>& endpoint_weights,
+    double min_normalized_weight) {
   // Scale up the number of hashes per host such that the least-weighted host
   // gets a whole number of hashes on the ring. Other hosts might not end up
   // with whole numbers, and that's fine (the ring-building algorithm below can
@@ -505,7 +724,7 @@ RingHash::Ring::Ring(RingHash* ring_hash, RingHashLbConfig* config) {
   double target_hashes = 0.0;
   uint64_t min_hashes_per_host = ring_size;
   uint64_t max_hashes_per_host = 0;
-  for (size_t i = 0; i < endpoints.size(); ++i) {
+  for (size_t i = 0; i < endpoint_weights.size(); ++i) {
     const std::string& hash_key = endpoint_weights[i].hash_key;
     hash_key_buffer.assign(hash_key.begin(), hash_key.end());
     hash_key_buffer.emplace_back('_');
@@ -534,6 +753,83 @@ RingHash::Ring::Ring(RingHash* ring_hash, RingHashLbConfig* config) {
             });
 }
 
+void RingHash::Ring::BuildMaglevTable(
+    const std::vector<EndpointWeight>& endpoint_weights,
+    double max_normalized_weight, size_t table_size) {
+  if (endpoint_weights.empty()) return;
+  // Each endpoint walks its own permutation of the table positions,
+  // defined by an offset and a skip derived from its hash key, and in each
+  // round claims the next position on it that is still free.  Endpoints
+  // with less than the maximum weight skip a share of the rounds, so that
+  // the entries end up split in proportion to the weights.
+  struct Permutation {
+    uint64_t offset;
+    uint64_t skip;
+    uint64_t next = 0;
+    double credit = 0;
+  };
+  std::vector<Permutation> permutations;
+  permutations.reserve(endpoint_weights.size());
+  for (const EndpointWeight& endpoint_weight : endpoint_weights) {
+    const std::string& key = endpoint_weight.hash_key;
+    permutations.push_back(
+        {XXH64(key.data(), key.size(), 0) % table_size,
+         XXH64(key.data(), key.size(), 1) % (table_size - 1) + 1});
+  }
+  constexpr uint32_t kUnset = std::numeric_limits<uint32_t>::max();
+  maglev_table_.assign(table_size, kUnset);
+  size_t filled = 0;
+  while (filled < table_size) {
+    for (size_t i = 0; i < permutations.size() && filled < table_size; ++i) {
+      Permutation& permutation = permutations[i];
+      permutation.credit +=
+          endpoint_weights[i].normalized_weight / max_normalized_weight;
+      if (permutation.credit < 1) continue;
+      permutation.credit -= 1;
+      uint64_t position;
+      do {
+        position = (permutation.offset + permutation.next * permutation.skip) %
+                   table_size;
+        ++permutation.next;
+      } while (maglev_table_[position] != kUnset);
+      maglev_table_[position] = i;
+      ++filled;
+    }
+  }
+}
+
+size_t RingHash::Ring::FindIndex(uint64_t request_hash) const {
+  if (!maglev_table_.empty()) return request_hash % maglev_table_.size();
+  // Ported from https://github.com/RJ/ketama/blob/master/libketama/ketama.c
+  // (ketama_get_server) NOTE: The algorithm depends on using signed integers
+  // for lowp, highp, and index. Do not change them!
+  int64_t lowp = 0;
+  int64_t highp = ring_.size();
+  int64_t index = 0;
+  while (true) {
+    index = (lowp + highp) / 2;
+    if (index == static_cast<int64_t>(ring_.size())) {
+      index = 0;
+      break;
+    }
+    uint64_t midval = ring_[index].hash;
+    uint64_t midval1 = index == 0 ? 0 : ring_[index - 1].hash;
+    if (request_hash <= midval && request_hash > midval1) {
+      break;
+    }
+    if (midval < request_hash) {
+      lowp = index + 1;
+    } else {
+      highp = index - 1;
+    }
+    if (lowp > highp) {
+      index = 0;
+      break;
+    }
+  }
+  return index;
+}
+
 //
 // RingHash::RingHashEndpoint::Helper
 //
@@ -658,9 +954,11 @@ void RingHash::RingHashEndpoint::OnStateUpdate(
       << ")";
   if (child_policy_ == nullptr) return;  // Already orphaned.
   // Update state.
-  connectivity_state_ = new_state;
+  const grpc_connectivity_state old_state =
+      std::exchange(connectivity_state_, new_state);
   status_ = status;
   picker_ = std::move(picker);
+  ring_hash_->UpdateEndpointInfoLocked(this, old_state);
   // Update the aggregated connectivity state.
   ring_hash_->UpdateAggregatedConnectivityStateLocked(status);
 }
@@ -732,6 +1030,7 @@ absl::Status RingHash::UpdateLocked(UpdateArgs args) {
   // Save config.
   auto* config = DownCast<RingHashLbConfig*>(args.config.get());
   request_hash_header_ = RefCountedStringValue(config->request_hash_header());
+  hash_balance_factor_ = config->hash_balance_factor();
   // Build new ring.
   ring_ = MakeRefCounted<Ring>(this, config);
   // Update endpoint map.
@@ -755,6 +1054,7 @@ absl::Status RingHash::UpdateLocked(UpdateArgs args) {
     }
   }
   endpoint_map_ = std::move(endpoint_map);
+  RebuildEndpointInfoLocked();
   // Update resolution note.
   resolution_note_ = std::move(args.resolution_note);
   // If the address list is empty, report TRANSIENT_FAILURE.
@@ -777,32 +1077,67 @@ absl::Status RingHash::UpdateLocked(UpdateArgs args) {
   return absl::OkStatus();
 }
 
-void RingHash::UpdateAggregatedConnectivityStateLocked(absl::Status status) {
-  // Count the number of endpoints in each state.
-  size_t num_idle = 0;
-  size_t num_connecting = 0;
-  size_t num_ready = 0;
-  size_t num_transient_failure = 0;
-  RingHashEndpoint* idle_endpoint = nullptr;
+void RingHash::RebuildEndpointInfoLocked() {
+  num_idle_ = num_connecting_ = num_ready_ = num_transient_failure_ = 0;
+  std::vector<EndpointInfoChunk> chunks(
+      (endpoints_.size() + kEndpointInfoChunkSize - 1) /
+      kEndpointInfoChunkSize);
+  for (size_t i = 0; i < chunks.size(); ++i) {
+    chunks[i].resize(std::min(kEndpointInfoChunkSize,
+                              endpoints_.size() - i * kEndpointInfoChunkSize));
+  }
   for (const auto& [_, endpoint] : endpoint_map_) {
-    switch (endpoint->connectivity_state()) {
-      case GRPC_CHANNEL_READY:
-        ++num_ready;
-        break;
-      case GRPC_CHANNEL_IDLE:
-        ++num_idle;
-        if (idle_endpoint == nullptr) idle_endpoint = endpoint.get();
-        break;
-      case GRPC_CHANNEL_CONNECTING:
-        ++num_connecting;
-        break;
-      case GRPC_CHANNEL_TRANSIENT_FAILURE:
-        ++num_transient_failure;
-        break;
-      default:
-        Crash("child policy should never report SHUTDOWN");
-    }
+    CountEndpointState(endpoint->connectivity_state(), 1);
+    chunks[endpoint->index() / kEndpointInfoChunkSize]
+          [endpoint->index() % kEndpointInfoChunkSize] =
+              endpoint->GetInfoForPicker();
   }
+  endpoint_info_chunks_.clear();
+  endpoint_info_chunks_.reserve(chunks.size());
+  for (auto& chunk : chunks) {
+    endpoint_info_chunks_.push_back(
+        std::make_shared<const EndpointInfoChunk>(std::move(chunk)));
+  }
+}
+
+void RingHash::UpdateEndpointInfoLocked(RingHashEndpoint* endpoint,
+                                        grpc_connectivity_state old_state) {
+  CountEndpointState(old_state, -1);
+  CountEndpointState(endpoint->connectivity_state(), 1);
+  // Pickers may still be using the old chunk, so replace it with a copy.
+  const size_t chunk_index = endpoint->index() / kEndpointInfoChunkSize;
+  if (chunk_index >= endpoint_info_chunks_.size()) return;
+  auto chunk =
+      std::make_shared<EndpointInfoChunk>(*endpoint_info_chunks_[chunk_index]);
+  (*chunk)[endpoint->index() % kEndpointInfoChunkSize] =
+      endpoint->GetInfoForPicker();
+  endpoint_info_chunks_[chunk_index] = std::move(chunk);
+}
+
+void RingHash::CountEndpointState(grpc_connectivity_state state, int delta) {
+  switch (state) {
+    case GRPC_CHANNEL_READY:
+      num_ready_ += delta;
+      break;
+    case GRPC_CHANNEL_IDLE:
+      num_idle_ += delta;
+      break;
+    case GRPC_CHANNEL_CONNECTING:
+      num_connecting_ += delta;
+      break;
+    case GRPC_CHANNEL_TRANSIENT_FAILURE:
+      num_transient_failure_ += delta;
+      break;
+    default:
+      Crash("child policy should never report SHUTDOWN");
+  }
+}
+
+void RingHash::UpdateAggregatedConnectivityStateLocked(absl::Status status) {
+  const size_t num_idle = num_idle_;
+  const size_t num_connecting = num_connecting_;
+  const size_t num_ready = num_ready_;
+  const size_t num_transient_failure = num_transient_failure_;
   // The overall aggregation rules here are:
   // 1. If there is at least one endpoint in READY state, report READY.
   // 2. If there are 2 or more endpoints in TRANSIENT_FAILURE state, report
@@ -879,9 +1214,18 @@ void RingHash::UpdateAggregatedConnectivityStateLocked(absl::Status status) {
   // LB policy and we keep getting picks, so it's not really a new
   // problem.  If/when it becomes an issue, we can figure out how to
   // address it.
+  RingHashEndpoint* idle_endpoint = nullptr;
   if ((state == GRPC_CHANNEL_CONNECTING ||
        state == GRPC_CHANNEL_TRANSIENT_FAILURE) &&
-      num_connecting == 0 && idle_endpoint != nullptr) {
+      num_connecting == 0 && num_idle > 0) {
+    for (const auto& [_, endpoint] : endpoint_map_) {
+      if (endpoint->connectivity_state() == GRPC_CHANNEL_IDLE) {
+        idle_endpoint = endpoint.get();
+        break;
+      }
+    }
+  }
+  if (idle_endpoint != nullptr) {
     GRPC_TRACE_LOG(ring_hash_lb, INFO)
         << "[RH " << this
         << "] triggering internal connection attempt for endpoint "
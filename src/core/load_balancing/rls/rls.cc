@@ -38,6 +38,8 @@
 #include <string.h>
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <deque>
 #include <list>
 #include <map>
@@ -68,6 +70,7 @@
 #include "src/core/credentials/transport/fake/fake_credentials.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/iomgr/closure.h"
 #include "src/core/lib/iomgr/error.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
@@ -96,6 +99,7 @@
 #include "src/core/util/json/json_writer.h"
 #include "src/core/util/match.h"
 #include "src/core/util/orphanable.h"
+#include "src/core/util/ref_counted.h"
 #include "src/core/util/ref_counted_ptr.h"
 #include "src/core/util/shared_bit_gen.h"
 #include "src/core/util/status_helper.h"
@@ -251,6 +255,11 @@ class RlsLb final : public LoadBalancingPolicy {
       return picker_->Pick(args);
     }
 
+    RefCountedPtr<SubchannelPicker> picker() const
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_) {
+      return picker_;
+    }
+
     // Updates for the child policy are handled in two phases:
     // 1. In StartUpdate(), we parse and validate the new child policy
     //    config and store the parsed config.
@@ -332,8 +341,58 @@ class RlsLb final : public LoadBalancingPolicy {
         ABSL_GUARDED_BY(&RlsLb::mu_);
   };
 
+  // Whether a cache entry was used since LRU eviction last looked at it. Picks
+  // that are resolved without the lock set it, so that eviction gives the
+  // entry a second chance instead of treating it as unused.
+  class UsageBit final : public RefCounted<UsageBit, NonPolymorphicRefCount> {
+   public:
+    void Mark() {
+      if (!used_.load(std::memory_order_relaxed)) {
+        used_.store(true, std::memory_order_relaxed);
+      }
+    }
+    bool Take() { return used_.exchange(false, std::memory_order_relaxed); }
+
+   private:
+    std::atomic<bool> used_{false};
+  };
+
+  // What a picker needs to route a request that hits a cache entry with
+  // usable data, copied from the entry when the picker is created.
+  struct CachedPick {
+    Timestamp data_expiration_time;
+    Timestamp stale_time;
+    // Looked up in ChildPickers; only used as keys, never dereferenced.
+    std::vector<const ChildPolicyWrapper*> targets;
+    grpc_event_engine::experimental::Slice header_data;
+    RefCountedPtr<UsageBit> usage;
+  };
+
+  // The cached picks of one shard of the cache. Immutable once built, and
+  // shared by all pickers created until an entry of the shard changes.
+  struct PickShard final : public RefCounted<PickShard> {
+    std::unordered_map<RequestKey, CachedPick, absl::Hash<RequestKey>> picks;
+  };
+
+  // The state and picker of every child policy. Kept apart from the cached
+  // picks, so that a child policy reporting a new picker only requires the
+  // next picker to copy this table, not any shard of the cache.
+  struct ChildPickers final : public RefCounted<ChildPickers> {
+    struct Target {
+      std::string name;
+      grpc_connectivity_state connectivity_state;
+      RefCountedPtr<SubchannelPicker> picker;
+    };
+
+    std::unordered_map<const ChildPolicyWrapper*, Target> targets;
+  };
+
   // A picker that uses the cache and the request map in the LB policy
   // (synchronized via a mutex) to determine how to route requests.
+  //
+  // With the rls_lock_free_picks experiment, the picker also keeps a snapshot
+  // of the cache entries with usable data, so that cache hits, which are the
+  // vast majority of picks, do not take the lock.
   class Picker final : public LoadBalancingPolicy::SubchannelPicker {
    public:
     explicit Picker(RefCountedPtr<RlsLb> lb_policy);
@@ -341,6 +400,10 @@ class RlsLb final : public LoadBalancingPolicy {
     PickResult Pick(PickArgs args) override;
 
    private:
+    // Returns nullopt if the snapshot cannot resolve the pick.
+    std::optional<PickResult> PickFromSnapshot(const RequestKey& key,
+                                               Timestamp now, PickArgs args);
+
     PickResult PickFromDefaultTargetOrFail(const char* reason, PickArgs args,
                                            absl::Status status)
         ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_);
@@ -348,13 +411,28 @@ class RlsLb final : public LoadBalancingPolicy {
     RefCountedPtr<RlsLb> lb_policy_;
     RefCountedPtr<RlsLbConfig> config_;
     RefCountedPtr<ChildPolicyWrapper> default_child_policy_;
+    // Indexed by Cache::ShardIndex(); empty without the experiment.
+    std::vector<RefCountedPtr<const PickShard>> pick_shards_;
+    RefCountedPtr<const ChildPickers> child_pickers_;
   };
 
   // An LRU cache with adjustable size.
+  //
+  // Entries are spread over kNumShards shards by key, and pickers snapshot
+  // the usable entries shard by shard: a change to an entry only requires
+  // the next picker to copy the entries of its own shard again. Picks served
+  // from a snapshot do not reorder the LRU list; they mark the entry's
+  // UsageBit instead, making the eviction order approximate (CLOCK-like).
   class Cache final {
    public:
     using Iterator = std::list<RequestKey>::iterator;
 
+    static constexpr size_t kNumShards = 16;
+
+    static size_t ShardIndex(const RequestKey& key) {
+      return absl::Hash<RequestKey>()(key) % kNumShards;
+    }
+
     class Entry final : public InternallyRefCounted<Entry> {
      public:
       Entry(RefCountedPtr<RlsLb> lb_policy, const RequestKey& key);
@@ -428,6 +506,13 @@ class RlsLb final : public LoadBalancingPolicy {
       // Moves entry to the end of the LRU list.
       void MarkUsed() ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_);
 
+      UsageBit* usage() const { return usage_.get(); }
+
+      // Returns what a picker needs to route requests with this entry, or
+      // nullopt if the entry has no usable data at \a now.
+      std::optional<CachedPick> MakeCachedPick(Timestamp now) const
+          ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_);
+
       // Takes entries from child_policy_wrappers_ and appends them to the end
       // of \a child_policy_wrappers.
       void TakeChildPolicyWrappers(
@@ -438,6 +523,8 @@ class RlsLb final : public LoadBalancingPolicy {
             std::make_move_iterator(child_policy_wrappers_.begin()),
             std::make_move_iterator(child_policy_wrappers_.end()));
         child_policy_wrappers_.clear();
+        // Don't let pickers keep the child policies' pickers alive.
+        lb_policy_->child_pickers_.reset();
       }
 
      private:
@@ -482,6 +569,7 @@ class RlsLb final : public LoadBalancingPolicy {
 
       Timestamp min_expiration_time_ ABSL_GUARDED_BY(&RlsLb::mu_);
       Cache::Iterator lru_iterator_ ABSL_GUARDED_BY(&RlsLb::mu_);
+      const RefCountedPtr<UsageBit> usage_ = MakeRefCounted<UsageBit>();
     };
 
     explicit Cache(RlsLb* lb_policy);
@@ -519,7 +607,25 @@ class RlsLb final : public LoadBalancingPolicy {
     void ReportMetricsLocked(CallbackMetricReporter& reporter)
         ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_);
 
+    // Returns the cached picks of every shard, rebuilding those that changed
+    // since the last call.
+    std::vector<RefCountedPtr<const PickShard>> GetPickShards()
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_);
+    // Makes the next call to GetPickShards() rebuild the shard of \a key.
+    void InvalidatePicks(const RequestKey& key)
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_) {
+      pick_shards_[ShardIndex(key)].reset();
+    }
+
    private:
+    using Map = std::unordered_map<RequestKey, OrphanablePtr<Entry>,
+                                   absl::Hash<RequestKey>>;
+
+    Map& MapFor(const RequestKey& key)
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_) {
+      return maps_[ShardIndex(key)];
+    }
+
     // Shared logic for starting the cleanup timer
     void StartCleanupTimer() ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_);
 
@@ -541,8 +647,10 @@ class RlsLb final : public LoadBalancingPolicy {
     size_t size_ ABSL_GUARDED_BY(&RlsLb::mu_) = 0;
 
     std::list<RequestKey> lru_list_ ABSL_GUARDED_BY(&RlsLb::mu_);
-    std::unordered_map<RequestKey, OrphanablePtr<Entry>, absl::Hash<RequestKey>>
-        map_ ABSL_GUARDED_BY(&RlsLb::mu_);
+    std::array<Map, kNumShards> maps_ ABSL_GUARDED_BY(&RlsLb::mu_);
+    // Null for shards that must be rebuilt.
+    std::array<RefCountedPtr<const PickShard>, kNumShards> pick_shards_
+        ABSL_GUARDED_BY(&RlsLb::mu_);
     std::optional<EventEngine::TaskHandle> cleanup_timer_handle_;
   };
 
@@ -693,6 +801,11 @@ class RlsLb final : public LoadBalancingPolicy {
   // Updates the picker in the work serializer.
   void UpdatePickerLocked() ABSL_LOCKS_EXCLUDED(&mu_);
 
+  // Returns the pickers of the child policies, rebuilding the table if one
+  // of them changed since the last call. Called in the work serializer.
+  RefCountedPtr<const ChildPickers> GetChildPickersLocked()
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(&mu_);
+
   template <typename HandleType>
   void MaybeExportPickCount(HandleType handle, absl::string_view target,
                             absl::string_view lookup_service,
@@ -705,6 +818,8 @@ class RlsLb final : public LoadBalancingPolicy {
   bool is_shutdown_ ABSL_GUARDED_BY(mu_) = false;
   bool update_in_progress_ = false;
   Cache cache_ ABSL_GUARDED_BY(mu_);
+  // Null when it must be rebuilt.
+  RefCountedPtr<const ChildPickers> child_pickers_ ABSL_GUARDED_BY(mu_);
   // Maps an RLS request key to an RlsRequest object that represents a pending
   // RLS request.
   std::unordered_map<RequestKey, OrphanablePtr<RlsRequest>,
@@ -813,6 +928,7 @@ void RlsLb::ChildPolicyWrapper::StartUpdate(
     pending_config_.reset();
     picker_ = MakeRefCounted<TransientFailurePicker>(
         absl::UnavailableError(config.status().message()));
+    lb_policy_->child_pickers_.reset();
     *child_policy_to_delete = std::move(child_policy_);
   } else {
     pending_config_ = std::move(*config);
@@ -879,6 +995,7 @@ void RlsLb::ChildPolicyWrapper::ChildPolicyHelper::UpdateState(
       // We want to unref the picker after we release the lock.
       wrapper_->picker_.swap(picker);
     }
+    wrapper_->lb_policy_->child_pickers_.reset();
   }
   wrapper_->lb_policy_->UpdatePickerLocked();
 }
@@ -955,6 +1072,13 @@ RlsLb::Picker::Picker(RefCountedPtr<RlsLb> lb_policy)
     default_child_policy_ =
         lb_policy_->default_child_policy_->Ref(DEBUG_LOCATION, "Picker");
   }
+  if (IsRlsLockFreePicksEnabled()) {
+    MutexLock lock(&lb_policy_->mu_);
+    if (!lb_policy_->is_shutdown_) {
+      pick_shards_ = lb_policy_->cache_.GetPickShards();
+      child_pickers_ = lb_policy_->GetChildPickersLocked();
+    }
+  }
 }
 
 LoadBalancingPolicy::PickResult RlsLb::Picker::Pick(PickArgs args) {
@@ -967,6 +1091,9 @@ LoadBalancingPolicy::PickResult RlsLb::Picker::Pick(PickArgs args) {
       << "[rlslb " << lb_policy_.get() << "] picker=" << this
       << ": request keys: " << key.ToString();
   Timestamp now = Timestamp::Now();
+  std::optional<PickResult> snapshot_result =
+      PickFromSnapshot(key, now, args);
+  if (snapshot_result.has_value()) return std::move(*snapshot_result);
   MutexLock lock(&lb_policy_->mu_);
   if (lb_policy_->is_shutdown_) {
     return PickResult::Fail(
@@ -1021,6 +1148,48 @@ LoadBalancingPolicy::PickResult RlsLb::Picker::Pick(PickArgs args) {
   return PickResult::Queue();
 }
 
+std::optional<LoadBalancingPolicy::PickResult> RlsLb::Picker::PickFromSnapshot(
+    const RequestKey& key, Timestamp now, PickArgs args) {
+  if (pick_shards_.empty()) return std::nullopt;
+  const PickShard& shard = *pick_shards_[Cache::ShardIndex(key)];
+  auto it = shard.picks.find(key);
+  if (it == shard.picks.end()) return std::nullopt;
+  const CachedPick& cached = it->second;
+  // Once the entry is stale, the locked path decides whether to refresh it.
+  if (cached.data_expiration_time < now || cached.stale_time < now) {
+    return std::nullopt;
+  }
+  // Skip targets before the last one that are in state TRANSIENT_FAILURE.
+  const ChildPickers::Target* target = nullptr;
+  size_t i = 0;
+  for (;; ++i) {
+    auto child = child_pickers_->targets.find(cached.targets[i]);
+    if (child == child_pickers_->targets.end()) return std::nullopt;
+    target = &child->second;
+    if (i == cached.targets.size() - 1 ||
+        target->connectivity_state != GRPC_CHANNEL_TRANSIENT_FAILURE) {
+      break;
+    }
+  }
+  cached.usage->Mark();
+  GRPC_TRACE_LOG(rls_lb, INFO)
+      << "[rlslb " << lb_policy_.get() << "] picker=" << this
+      << ": using cached pick for target " << target->name << " (" << i
+      << " of " << cached.targets.size() << ")";
+  auto pick_result = target->picker->Pick(args);
+  lb_policy_->MaybeExportPickCount(kMetricTargetPicks, target->name,
+                                   config_->lookup_service(), pick_result);
+  if (!cached.header_data.empty()) {
+    auto* complete_pick =
+        std::get_if<PickResult::Complete>(&pick_result.result);
+    if (complete_pick != nullptr) {
+      complete_pick->metadata_mutations.Set(kRlsHeaderKey,
+                                            cached.header_data.Ref());
+    }
+  }
+  return pick_result;
+}
+
 LoadBalancingPolicy::PickResult RlsLb::Picker::PickFromDefaultTargetOrFail(
     const char* reason, PickArgs args, absl::Status status) {
   if (default_child_policy_ != nullptr) {
@@ -1207,12 +1376,30 @@ void RlsLb::Cache::Entry::MarkUsed() {
   lru_iterator_ = new_it;
 }
 
+std::optional<RlsLb::CachedPick> RlsLb::Cache::Entry::MakeCachedPick(
+    Timestamp now) const {
+  if (data_expiration_time_ < now || child_policy_wrappers_.empty()) {
+    return std::nullopt;
+  }
+  CachedPick cached;
+  cached.data_expiration_time = data_expiration_time_;
+  cached.stale_time = stale_time_;
+  cached.targets.reserve(child_policy_wrappers_.size());
+  for (const auto& child_policy_wrapper : child_policy_wrappers_) {
+    cached.targets.push_back(child_policy_wrapper.get());
+  }
+  cached.header_data = header_data_.Ref();
+  cached.usage = usage_;
+  return cached;
+}
+
 std::vector<RlsLb::ChildPolicyWrapper*>
 RlsLb::Cache::Entry::OnRlsResponseLocked(
     ResponseInfo response, std::unique_ptr<BackOff> backoff_state,
     OrphanablePtr<ChildPolicyHandler>* child_policy_to_delete) {
   // Move the entry to the end of the LRU list.
   MarkUsed();
+  lb_policy_->cache_.InvalidatePicks(*lru_iterator_);
   // If the request failed, store the failed status and update the
   // backoff state.
   if (!response.status.ok()) {
@@ -1288,6 +1475,7 @@ RlsLb::Cache::Entry::OnRlsResponseLocked(
     }
   }
   child_policy_wrappers_ = std::move(new_child_policy_wrappers);
+  lb_policy_->child_pickers_.reset();
   if (update_picker) {
     lb_policy_->UpdatePickerAsync();
   }
@@ -1303,8 +1491,9 @@ RlsLb::Cache::Cache(RlsLb* lb_policy) : lb_policy_(lb_policy) {
 }
 
 RlsLb::Cache::Entry* RlsLb::Cache::Find(const RequestKey& key) {
-  auto it = map_.find(key);
-  if (it == map_.end()) return nullptr;
+  Map& map = MapFor(key);
+  auto it = map.find(key);
+  if (it == map.end()) return nullptr;
   it->second->MarkUsed();
   return it->second.get();
 }
@@ -1312,15 +1501,16 @@ RlsLb::Cache::Entry* RlsLb::Cache::Find(const RequestKey& key) {
 RlsLb::Cache::Entry* RlsLb::Cache::FindOrInsert(
     const RequestKey& key, std::vector<RefCountedPtr<ChildPolicyWrapper>>*
                                child_policy_wrappers_to_delete) {
-  auto it = map_.find(key);
+  Map& map = MapFor(key);
+  auto it = map.find(key);
   // If not found, create new entry.
-  if (it == map_.end()) {
+  if (it == map.end()) {
     size_t entry_size = EntrySizeForKey(key);
     MaybeShrinkSize(size_limit_ - std::min(size_limit_, entry_size),
                     child_policy_wrappers_to_delete);
     Entry* entry = new Entry(
         lb_policy_->RefAsSubclass<RlsLb>(DEBUG_LOCATION, "CacheEntry"), key);
-    map_.emplace(key, OrphanablePtr<Entry>(entry));
+    map.emplace(key, OrphanablePtr<Entry>(entry));
     size_ += entry_size;
     GRPC_TRACE_LOG(rls_lb, INFO)
         << "[rlslb " << lb_policy_ << "] key=" << key.ToString()
@@ -1345,8 +1535,10 @@ void RlsLb::Cache::Resize(size_t bytes,
 }
 
 void RlsLb::Cache::ResetAllBackoff() {
-  for (auto& [_, entry] : map_) {
-    entry->ResetBackoff();
+  for (Map& map : maps_) {
+    for (auto& [_, entry] : map) {
+      entry->ResetBackoff();
+    }
   }
   lb_policy_->UpdatePickerAsync();
 }
@@ -1354,11 +1546,14 @@ void RlsLb::Cache::ResetAllBackoff() {
 std::vector<RefCountedPtr<RlsLb::ChildPolicyWrapper>> RlsLb::Cache::Shutdown() {
   std::vector<RefCountedPtr<ChildPolicyWrapper>>
       child_policy_wrappers_to_delete;
-  for (auto& [_, entry] : map_) {
-    entry->TakeChildPolicyWrappers(&child_policy_wrappers_to_delete);
+  for (Map& map : maps_) {
+    for (auto& [_, entry] : map) {
+      entry->TakeChildPolicyWrappers(&child_policy_wrappers_to_delete);
+    }
+    map.clear();
   }
-  map_.clear();
   lru_list_.clear();
+  for (auto& shard : pick_shards_) shard.reset();
   if (cleanup_timer_handle_.has_value() &&
       lb_policy_->channel_control_helper()->GetEventEngine()->Cancel(
           *cleanup_timer_handle_)) {
@@ -1370,13 +1565,15 @@ std::vector<RefCountedPtr<RlsLb::ChildPolicyWrapper>> RlsLb::Cache::Shutdown() {
 }
 
 void RlsLb::Cache::ReportMetricsLocked(CallbackMetricReporter& reporter) {
+  size_t num_entries = 0;
+  for (const Map& map : maps_) num_entries += map.size();
   reporter.Report(
       kMetricCacheSize, size_,
       {lb_policy_->channel_control_helper()->GetTarget(),
        lb_policy_->config_->lookup_service(), lb_policy_->instance_uuid_},
       {});
   reporter.Report(
-      kMetricCacheEntries, map_.size(),
+      kMetricCacheEntries, num_entries,
       {lb_policy_->channel_control_helper()->GetTarget(),
        lb_policy_->config_->lookup_service(), lb_policy_->instance_uuid_},
       {});
@@ -1405,19 +1602,47 @@ void RlsLb::Cache::OnCleanupTimer() {
   MutexLock lock(&lb_policy_->mu_);
   if (!cleanup_timer_handle_.has_value()) return;
   if (lb_policy_->is_shutdown_) return;
-  for (auto it = map_.begin(); it != map_.end();) {
-    auto& entry = it->second;
-    if (GPR_UNLIKELY(entry->ShouldRemove() && entry->CanEvict())) {
-      size_ -= entry->Size();
-      entry->TakeChildPolicyWrappers(&child_policy_wrappers_to_delete);
-      it = map_.erase(it);
-    } else {
-      ++it;
+  bool removed = false;
+  for (size_t i = 0; i < kNumShards; ++i) {
+    Map& map = maps_[i];
+    for (auto it = map.begin(); it != map.end();) {
+      auto& entry = it->second;
+      if (GPR_UNLIKELY(entry->ShouldRemove() && entry->CanEvict())) {
+        size_ -= entry->Size();
+        entry->TakeChildPolicyWrappers(&child_policy_wrappers_to_delete);
+        it = map.erase(it);
+        pick_shards_[i].reset();
+        removed = true;
+      } else {
+        ++it;
+      }
     }
   }
+  // Let go of the child pickers the current picker's snapshot still holds
+  // for the removed entries.
+  if (removed && IsRlsLockFreePicksEnabled()) lb_policy_->UpdatePickerAsync();
   StartCleanupTimer();
 }
 
+std::vector<RefCountedPtr<const RlsLb::PickShard>>
+RlsLb::Cache::GetPickShards() {
+  const Timestamp now = Timestamp::Now();
+  std::vector<RefCountedPtr<const PickShard>> shards;
+  shards.reserve(kNumShards);
+  for (size_t i = 0; i < kNumShards; ++i) {
+    if (pick_shards_[i] == nullptr) {
+      auto shard = MakeRefCounted<PickShard>();
+      for (auto& [key, entry] : maps_[i]) {
+        std::optional<CachedPick> cached = entry->MakeCachedPick(now);
+        if (cached.has_value()) shard->picks.emplace(key, std::move(*cached));
+      }
+      pick_shards_[i] = std::move(shard);
+    }
+    shards.push_back(pick_shards_[i]);
+  }
+  return shards;
+}
+
 size_t RlsLb::Cache::EntrySizeForKey(const RequestKey& key) {
   // Key is stored twice, once in LRU list and again in the cache map.
   return (key.Size() * 2) + sizeof(Entry);
@@ -1429,16 +1654,24 @@ void RlsLb::Cache::MaybeShrinkSize(
   while (size_ > bytes) {
     auto lru_it = lru_list_.begin();
     if (GPR_UNLIKELY(lru_it == lru_list_.end())) break;
-    auto map_it = map_.find(*lru_it);
-    CHECK(map_it != map_.end());
+    Map& map = MapFor(*lru_it);
+    auto map_it = map.find(*lru_it);
+    CHECK(map_it != map.end());
     auto& entry = map_it->second;
+    // Give entries that served picks from a picker's snapshot since the last
+    // pass a second chance. Each entry gets at most one per pass.
+    if (entry->usage()->Take()) {
+      entry->MarkUsed();
+      continue;
+    }
     if (!entry->CanEvict()) break;
     GRPC_TRACE_LOG(rls_lb, INFO)
         << "[rlslb " << lb_policy_ << "] LRU eviction: removing entry "
         << entry.get() << " " << lru_it->ToString();
     size_ -= entry->Size();
     entry->TakeChildPolicyWrappers(child_policy_wrappers_to_delete);
-    map_.erase(map_it);
+    InvalidatePicks(map_it->first);
+    map.erase(map_it);
   }
   GRPC_TRACE_LOG(rls_lb, INFO)
       << "[rlslb " << lb_policy_
@@ -2118,6 +2351,21 @@ void RlsLb::UpdatePickerLocked() {
       MakeRefCounted<Picker>(RefAsSubclass<RlsLb>(DEBUG_LOCATION, "Picker")));
 }
 
+RefCountedPtr<const RlsLb::ChildPickers> RlsLb::GetChildPickersLocked() {
+  if (child_pickers_ == nullptr) {
+    auto child_pickers = MakeRefCounted<ChildPickers>();
+    for (auto& [name, child] : child_policy_map_) {
+      RefCountedPtr<SubchannelPicker> picker = child->picker();
+      if (picker == nullptr) continue;
+      child_pickers->targets.emplace(
+          child, ChildPickers::Target{name, child->connectivity_state(),
+                                      std::move(picker)});
+    }
+    child_pickers_ = std::move(child_pickers);
+  }
+  return child_pickers_;
+}
+
 template <typename HandleType>
 void RlsLb::MaybeExportPickCount(HandleType handle, absl::string_view target,
                                  absl::string_view lookup_service,
@@ -66,6 +66,9 @@ class RoundRobin final : public LoadBalancingPolicy {
   void ResetBackoffLocked() override;
 
  private:
+  using ReadyPickers =
+      std::vector<RefCountedPtr<LoadBalancingPolicy::SubchannelPicker>>;
+
   class RoundRobinEndpointList final : public EndpointList {
    public:
     RoundRobinEndpointList(RefCountedPtr<RoundRobin> round_robin,
@@ -135,14 +138,18 @@ class RoundRobin final : public LoadBalancingPolicy {
     size_t num_connecting_ = 0;
     size_t num_transient_failure_ = 0;
 
+    // Pickers of the READY endpoints, shared by every picker we create
+    // until an endpoint enters or leaves READY, or a READY endpoint
+    // reports a new picker.  Endpoints moving between the other states
+    // therefore do not copy the list.
+    std::shared_ptr<const ReadyPickers> ready_pickers_;
+
     absl::Status last_failure_;
   };
 
   class Picker final : public SubchannelPicker {
    public:
-    Picker(RoundRobin* parent,
-           std::vector<RefCountedPtr<LoadBalancingPolicy::SubchannelPicker>>
-               pickers);
+    Picker(RoundRobin* parent, std::shared_ptr<const ReadyPickers> pickers);
 
     PickResult Pick(PickArgs args) override;
 
@@ -151,7 +158,7 @@ class RoundRobin final : public LoadBalancingPolicy {
     RoundRobin* parent_;
 
     std::atomic<size_t> last_picked_index_;
-    std::vector<RefCountedPtr<LoadBalancingPolicy::SubchannelPicker>> pickers_;
+    std::shared_ptr<const ReadyPickers> pickers_;
   };
 
   ~RoundRobin() override;
@@ -173,28 +180,28 @@ class RoundRobin final : public LoadBalancingPolicy {
 // RoundRobin::Picker
 //
 
-RoundRobin::Picker::Picker(
-    RoundRobin* parent,
-    std::vector<RefCountedPtr<LoadBalancingPolicy::SubchannelPicker>> pickers)
+RoundRobin::Picker::Picker(RoundRobin* parent,
+                           std::shared_ptr<const ReadyPickers> pickers)
     : parent_(parent), pickers_(std::move(pickers)) {
   // For discussion on why we generate a random starting index for
   // the picker, see https://github.com/grpc/grpc-go/issues/2580.
-  size_t index = absl::Uniform<size_t>(SharedBitGen(), 0, pickers_.size());
+  size_t index = absl::Uniform<size_t>(SharedBitGen(), 0, pickers_->size());
   last_picked_index_.store(index, std::memory_order_relaxed);
   GRPC_TRACE_LOG(round_robin, INFO)
       << "[RR " << parent_ << " picker " << this
       << "] created picker from endpoint_list=" << parent_->endpoint_list_.get()
-      << " with " << pickers_.size()
+      << " with " << pickers_->size()
       << " READY children; last_picked_index_=" << index;
 }
 
 RoundRobin::PickResult RoundRobin::Picker::Pick(PickArgs args) {
+  const ReadyPickers& pickers = *pickers_;
   size_t index = last_picked_index_.fetch_add(1, std::memory_order_relaxed) %
-                 pickers_.size();
+                 pickers.size();
   GRPC_TRACE_LOG(round_robin, INFO)
       << "[RR " << parent_ << " picker " << this << "] using picker index "
-      << index << ", picker=" << pickers_[index].get();
-  return pickers_[index]->Pick(args);
+      << index << ", picker=" << pickers[index].get();
+  return pickers[index]->Pick(args);
 }
 
 //
@@ -301,6 +308,10 @@ void RoundRobin::RoundRobinEndpointList::RoundRobinEndpoint::OnStateUpdate(
   if (!old_state.has_value() || *old_state != new_state) {
     rr_endpoint_list->UpdateStateCountersLocked(old_state, new_state);
   }
+  // If the set of READY pickers changed, the next picker needs a new list.
+  if (old_state == GRPC_CHANNEL_READY || new_state == GRPC_CHANNEL_READY) {
+    rr_endpoint_list->ready_pickers_.reset();
+  }
   // Update the policy state.
   rr_endpoint_list->MaybeUpdateRoundRobinConnectivityStateLocked(status);
 }
@@ -373,17 +384,18 @@ void RoundRobin::RoundRobinEndpointList::
     GRPC_TRACE_LOG(round_robin, INFO)
         << "[RR " << round_robin << "] reporting READY with child list "
         << this;
-    std::vector<RefCountedPtr<LoadBalancingPolicy::SubchannelPicker>> pickers;
-    for (const auto& endpoint : endpoints()) {
-      auto state = endpoint->connectivity_state();
-      if (state.has_value() && *state == GRPC_CHANNEL_READY) {
+    if (ready_pickers_ == nullptr) {
+      ReadyPickers pickers;
+      pickers.reserve(ready_endpoints().size());
+      for (const Endpoint* endpoint : ready_endpoints()) {
         pickers.push_back(endpoint->picker());
       }
+      ready_pickers_ = std::make_shared<const ReadyPickers>(std::move(pickers));
     }
-    CHECK(!pickers.empty());
+    CHECK(!ready_pickers_->empty());
     round_robin->channel_control_helper()->UpdateState(
         GRPC_CHANNEL_READY, absl::OkStatus(),
-        MakeRefCounted<Picker>(round_robin, std::move(pickers)));
+        MakeRefCounted<Picker>(round_robin, ready_pickers_));
   } else if (num_connecting_ > 0) {
     GRPC_TRACE_LOG(round_robin, INFO)
         << "[RR " << round_robin << "] reporting CONNECTING with child list "
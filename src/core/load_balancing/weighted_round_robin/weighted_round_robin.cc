@@ -66,6 +66,7 @@
 #include "src/core/util/json/json_args.h"
 #include "src/core/util/json/json_object_loader.h"
 #include "src/core/util/orphanable.h"
+#include "src/core/util/per_cpu.h"
 #include "src/core/util/ref_counted.h"
 #include "src/core/util/ref_counted_ptr.h"
 #include "src/core/util/shared_bit_gen.h"
@@ -416,9 +417,15 @@ class WeightedRoundRobin final : public LoadBalancingPolicy {
 
   bool shutdown_ = false;
 
-  // Accessed by picker.
-  std::atomic<uint32_t> scheduler_state_{
-      absl::Uniform<uint32_t>(SharedBitGen())};
+  // Accessed by picker.  Sharded so that concurrent picks on different
+  // CPUs don't contend on a single counter.  Each shard advances its own
+  // sequence from a random start, and any one sequence visits the
+  // endpoints in proportion to their weights.
+  struct alignas(GPR_CACHELINE_SIZE) SchedulerState {
+    std::atomic<uint32_t> sequence{absl::Uniform<uint32_t>(SharedBitGen())};
+  };
+  PerCpu<SchedulerState> scheduler_state_{
+      PerCpuOptions().SetCpusPerShard(1).SetMaxShards(16)};
 };
 
 //
@@ -540,11 +547,10 @@ WeightedRoundRobin::Picker::Picker(RefCountedPtr<WeightedRoundRobin> wrr,
     : wrr_(std::move(wrr)),
       config_(wrr_->config_),
       last_picked_index_(absl::Uniform<size_t>(SharedBitGen())) {
-  for (auto& endpoint : endpoint_list->endpoints()) {
-    auto* ep = static_cast<WrrEndpointList::WrrEndpoint*>(endpoint.get());
-    if (ep->connectivity_state() == GRPC_CHANNEL_READY) {
-      endpoints_.emplace_back(ep->picker(), ep->weight());
-    }
+  endpoints_.reserve(endpoint_list->ready_endpoints().size());
+  for (auto* endpoint : endpoint_list->ready_endpoints()) {
+    auto* ep = static_cast<WrrEndpointList::WrrEndpoint*>(endpoint);
+    endpoints_.emplace_back(ep->picker(), ep->weight());
   }
   global_stats().IncrementWrrSubchannelListSize(endpoint_list->size());
   global_stats().IncrementWrrSubchannelReadySize(endpoints_.size());
@@ -634,7 +640,10 @@ void WeightedRoundRobin::Picker::BuildSchedulerAndStartTimerLocked() {
       << "[WRR " << wrr_.get() << " picker " << this
       << "] new weights: " << absl::StrJoin(weights, " ");
   auto scheduler_or = StaticStrideScheduler::Make(
-      weights, [this]() { return wrr_->scheduler_state_.fetch_add(1); });
+      weights, [this]() {
+        return wrr_->scheduler_state_.this_cpu().sequence.fetch_add(
+            1, std::memory_order_relaxed);
+      });
   std::shared_ptr<StaticStrideScheduler> scheduler;
   if (scheduler_or.has_value()) {
     scheduler =
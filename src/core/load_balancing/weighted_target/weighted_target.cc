@@ -138,6 +138,8 @@ class WeightedTargetLb final : public LoadBalancingPolicy {
 
     PickResult Pick(PickArgs args) override;
 
+    const PickerList& pickers() const { return pickers_; }
+
    private:
     PickerList pickers_;
   };
@@ -237,6 +239,13 @@ class WeightedTargetLb final : public LoadBalancingPolicy {
 
   // Children.
   std::map<std::string, OrphanablePtr<WeightedChild>> targets_;
+
+  // The state and picker last reported to the channel, so that updates
+  // that would not change how picks are done are not passed up.  The
+  // picker is null when the state is CONNECTING or IDLE, since those
+  // report a QueuePicker regardless of the children's pickers.
+  std::optional<grpc_connectivity_state> reported_state_;
+  RefCountedPtr<WeightedPicker> reported_picker_;
 };
 
 //
@@ -291,6 +300,8 @@ void WeightedTargetLb::ShutdownLocked() {
       << "[weighted_target_lb " << this << "] shutting down";
   shutting_down_ = true;
   targets_.clear();
+  reported_state_.reset();
+  reported_picker_.reset();
 }
 
 void WeightedTargetLb::ResetBackoffLocked() {
@@ -345,6 +356,8 @@ absl::Status WeightedTargetLb::UpdateLocked(UpdateArgs args) {
   if (config_->target_map().empty()) {
     absl::Status status = absl::UnavailableError(absl::StrCat(
         "no children in weighted_target policy (", args.resolution_note, ")"));
+    reported_state_.reset();
+    reported_picker_.reset();
     channel_control_helper()->UpdateState(
         GRPC_CHANNEL_TRANSIENT_FAILURE, status,
         MakeRefCounted<TransientFailurePicker>(status));
@@ -431,18 +444,33 @@ void WeightedTargetLb::UpdateStateLocked() {
   GRPC_TRACE_LOG(weighted_target_lb, INFO)
       << "[weighted_target_lb " << this << "] connectivity changed to "
       << ConnectivityStateName(connectivity_state);
+  WeightedPicker::PickerList* picker_list = nullptr;
+  if (connectivity_state == GRPC_CHANNEL_READY) {
+    picker_list = &ready_picker_list;
+  } else if (connectivity_state == GRPC_CHANNEL_TRANSIENT_FAILURE) {
+    picker_list = &tf_picker_list;
+  }
+  // A change in a child that is not part of the picker (e.g., a
+  // CONNECTING child while others are READY) changes nothing for the
+  // channel, so don't make it reprocess its queued picks.
+  if (reported_state_ == connectivity_state &&
+      (picker_list == nullptr ||
+       (reported_picker_ != nullptr &&
+        reported_picker_->pickers() == *picker_list))) {
+    GRPC_TRACE_LOG(weighted_target_lb, INFO)
+        << "[weighted_target_lb " << this
+        << "] picker unchanged, not reporting";
+    return;
+  }
+  reported_state_ = connectivity_state;
   RefCountedPtr<SubchannelPicker> picker;
   absl::Status status;
-  switch (connectivity_state) {
-    case GRPC_CHANNEL_READY:
-      picker = MakeRefCounted<WeightedPicker>(std::move(ready_picker_list));
-      break;
-    case GRPC_CHANNEL_CONNECTING:
-    case GRPC_CHANNEL_IDLE:
-      picker = MakeRefCounted<QueuePicker>(Ref(DEBUG_LOCATION, "QueuePicker"));
-      break;
-    default:
-      picker = MakeRefCounted<WeightedPicker>(std::move(tf_picker_list));
+  if (picker_list != nullptr) {
+    reported_picker_ = MakeRefCounted<WeightedPicker>(std::move(*picker_list));
+    picker = reported_picker_;
+  } else {
+    reported_picker_.reset();
+    picker = MakeRefCounted<QueuePicker>(Ref(DEBUG_LOCATION, "QueuePicker"));
   }
   channel_control_helper()->UpdateState(connectivity_state, status,
                                         std::move(picker));
@@ -22,6 +22,7 @@
 #include <stddef.h>
 
 #include <algorithm>
+#include <atomic>
 #include <functional>
 #include <map>
 #include <memory>
@@ -35,6 +36,7 @@
 #include <vector>
 
 #include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
 #include "absl/functional/function_ref.h"
 #include "absl/log/check.h"
 #include "absl/log/log.h"
@@ -144,10 +146,7 @@ class XdsOverrideHostLb final : public LoadBalancingPolicy {
       return subchannel_entry_->address_list();
     }
 
-    void set_last_used_time()
-        ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsOverrideHostLb::mu_) {
-      subchannel_entry_->set_last_used_time();
-    }
+    void set_last_used_time() { subchannel_entry_->set_last_used_time(); }
 
     XdsOverrideHostLb* policy() const { return policy_.get(); }
 
@@ -295,13 +294,12 @@ class XdsOverrideHostLb final : public LoadBalancingPolicy {
       per_endpoint_args_ = std::move(per_endpoint_args);
     }
 
-    Timestamp last_used_time() const
-        ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsOverrideHostLb::mu_) {
-      return last_used_time_;
+    // Pickers update this without holding the lock.
+    Timestamp last_used_time() const {
+      return last_used_time_.load(std::memory_order_relaxed);
     }
-    void set_last_used_time()
-        ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsOverrideHostLb::mu_) {
-      last_used_time_ = Timestamp::Now();
+    void set_last_used_time() {
+      last_used_time_.store(Timestamp::Now(), std::memory_order_relaxed);
     }
 
    private:
@@ -314,9 +312,21 @@ class XdsOverrideHostLb final : public LoadBalancingPolicy {
     RefCountedStringValue address_list_
         ABSL_GUARDED_BY(&XdsOverrideHostLb::mu_);
     ChannelArgs per_endpoint_args_ ABSL_GUARDED_BY(&XdsOverrideHostLb::mu_);
-    Timestamp last_used_time_ ABSL_GUARDED_BY(&XdsOverrideHostLb::mu_) =
-        Timestamp::InfPast();
+    std::atomic<Timestamp> last_used_time_{Timestamp::InfPast()};
+  };
+
+  // A READY subchannel that a cookie may route to.
+  struct OverrideHost {
+    RefCountedPtr<SubchannelEntry> entry;
+    // The underlying subchannel, as returned from picks.
+    RefCountedPtr<SubchannelInterface> subchannel;
+    RefCountedStringValue address_list;
   };
+  // The READY subchannels among the entries of subchannel_map_ whose health
+  // status is in the override set, keyed by address.  Built on demand when
+  // creating a picker and shared by pickers until an entry changes, so
+  // that picks for a cookie with a READY address need no lock.
+  using OverrideHostTable = absl::flat_hash_map<std::string, OverrideHost>;
 
   // A picker that wraps the picker from the child for cases when cookie is
   // present.
@@ -324,7 +334,8 @@ class XdsOverrideHostLb final : public LoadBalancingPolicy {
    public:
     Picker(RefCountedPtr<XdsOverrideHostLb> xds_override_host_lb,
            RefCountedPtr<SubchannelPicker> picker,
-           XdsHealthStatusSet override_host_health_status_set);
+           XdsHealthStatusSet override_host_health_status_set,
+           std::shared_ptr<const OverrideHostTable> override_hosts);
 
     PickResult Pick(PickArgs args) override;
 
@@ -335,6 +346,7 @@ class XdsOverrideHostLb final : public LoadBalancingPolicy {
     RefCountedPtr<XdsOverrideHostLb> policy_;
     RefCountedPtr<SubchannelPicker> picker_;
     XdsHealthStatusSet override_host_health_status_set_;
+    std::shared_ptr<const OverrideHostTable> override_hosts_;
   };
 
   class Helper final
@@ -376,6 +388,9 @@ class XdsOverrideHostLb final : public LoadBalancingPolicy {
 
   void MaybeUpdatePickerLocked();
 
+  // Returns override_hosts_, building it first if needed.
+  std::shared_ptr<const OverrideHostTable> GetOverrideHostsLocked();
+
   void UpdateAddressMap(const EndpointAddressesIterator& endpoints);
 
   RefCountedPtr<SubchannelWrapper> AdoptSubchannel(
@@ -403,6 +418,9 @@ class XdsOverrideHostLb final : public LoadBalancingPolicy {
   Mutex mu_;
   std::map<std::string, RefCountedPtr<SubchannelEntry>, std::less<>>
       subchannel_map_ ABSL_GUARDED_BY(mu_);
+  // Reset whenever an entry in subchannel_map_ may have changed.  Accessed
+  // only in the WorkSerializer.
+  std::shared_ptr<const OverrideHostTable> override_hosts_;
 
   // Timer handle for periodic subchannel sweep.
   OrphanablePtr<IdleTimer> idle_timer_;
@@ -415,10 +433,12 @@ class XdsOverrideHostLb final : public LoadBalancingPolicy {
 XdsOverrideHostLb::Picker::Picker(
     RefCountedPtr<XdsOverrideHostLb> xds_override_host_lb,
     RefCountedPtr<SubchannelPicker> picker,
-    XdsHealthStatusSet override_host_health_status_set)
+    XdsHealthStatusSet override_host_health_status_set,
+    std::shared_ptr<const OverrideHostTable> override_hosts)
     : policy_(std::move(xds_override_host_lb)),
       picker_(std::move(picker)),
-      override_host_health_status_set_(override_host_health_status_set) {
+      override_host_health_status_set_(override_host_health_status_set),
+      override_hosts_(std::move(override_hosts)) {
   GRPC_TRACE_LOG(xds_override_host_lb, INFO)
       << "[xds_override_host_lb " << policy_.get()
       << "] constructed new picker " << this;
@@ -431,6 +451,17 @@ XdsOverrideHostLb::Picker::PickOverriddenHost(
   auto cookie_address_list = override_host_attr->cookie_address_list();
   if (cookie_address_list.empty()) return std::nullopt;
   // The cookie has an address list, so look through the addresses in order.
+  // If one of them was READY when this picker was created, use it without
+  // taking the lock.
+  for (absl::string_view address : absl::StrSplit(cookie_address_list, ',')) {
+    auto it = override_hosts_->find(address);
+    if (it == override_hosts_->end()) continue;
+    GRPC_TRACE_LOG(xds_override_host_lb, INFO)
+        << "Picker override found READY subchannel " << address;
+    it->second.entry->set_last_used_time();
+    override_host_attr->set_actual_address_list(it->second.address_list);
+    return PickResult::Complete(it->second.subchannel);
+  }
   absl::string_view address_with_no_subchannel;
   RefCountedPtr<SubchannelWrapper> idle_subchannel;
   bool found_connecting = false;
@@ -619,6 +650,7 @@ void XdsOverrideHostLb::ResetState() {
     }
     subchannel_map_.clear();
   }
+  override_hosts_.reset();
   // Cancel timer, if any.
   idle_timer_.reset();
   // Remove the child policy's interested_parties pollset_set from the
@@ -744,7 +776,8 @@ absl::Status XdsOverrideHostLb::UpdateLocked(UpdateArgs args) {
 void XdsOverrideHostLb::MaybeUpdatePickerLocked() {
   if (picker_ != nullptr) {
     auto xds_override_host_picker = MakeRefCounted<Picker>(
-        RefAsSubclass<XdsOverrideHostLb>(), picker_, override_host_status_set_);
+        RefAsSubclass<XdsOverrideHostLb>(), picker_, override_host_status_set_,
+        GetOverrideHostsLocked());
     GRPC_TRACE_LOG(xds_override_host_lb, INFO)
         << "[xds_override_host_lb " << this
         << "] updating connectivity: state=" << ConnectivityStateName(state_)
@@ -755,6 +788,33 @@ void XdsOverrideHostLb::MaybeUpdatePickerLocked() {
   }
 }
 
+std::shared_ptr<const XdsOverrideHostLb::OverrideHostTable>
+XdsOverrideHostLb::GetOverrideHostsLocked() {
+  if (override_hosts_ != nullptr) return override_hosts_;
+  auto override_hosts = std::make_shared<OverrideHostTable>();
+  // Drop subchannel refs after releasing the lock to avoid deadlock.
+  std::vector<RefCountedPtr<SubchannelWrapper>> subchannel_refs_to_drop;
+  {
+    MutexLock lock(&mu_);
+    for (const auto& [address, subchannel_entry] : subchannel_map_) {
+      if (subchannel_entry->connectivity_state() != GRPC_CHANNEL_READY ||
+          !override_host_status_set_.Contains(
+              subchannel_entry->eds_health_status())) {
+        continue;
+      }
+      auto subchannel = subchannel_entry->GetSubchannelRef();
+      if (subchannel == nullptr) continue;
+      override_hosts->emplace(
+          address, OverrideHost{subchannel_entry,
+                                subchannel->wrapped_subchannel(),
+                                subchannel_entry->address_list()});
+      subchannel_refs_to_drop.push_back(std::move(subchannel));
+    }
+  }
+  override_hosts_ = std::move(override_hosts);
+  return override_hosts_;
+}
+
 OrphanablePtr<LoadBalancingPolicy> XdsOverrideHostLb::CreateChildPolicyLocked(
     const ChannelArgs& args) {
   LoadBalancingPolicy::Args lb_policy_args;
@@ -874,6 +934,7 @@ void XdsOverrideHostLb::UpdateAddressMap(
       }
     }
   }
+  override_hosts_.reset();
   idle_timer_ =
       MakeOrphanable<IdleTimer>(RefAsSubclass<XdsOverrideHostLb>(), next_time);
 }
@@ -896,6 +957,7 @@ XdsOverrideHostLb::AdoptSubchannel(
       subchannel_ref_to_drop = it->second->SetUnownedSubchannel(wrapper.get());
     }
   }
+  override_hosts_.reset();
   return wrapper;
 }
 
@@ -951,6 +1013,7 @@ void XdsOverrideHostLb::CreateSubchannelForAddress(absl::string_view address) {
     wrapper->set_subchannel_entry(it->second);
     it->second->SetOwnedSubchannel(std::move(wrapper));
   }
+  override_hosts_.reset();
   MaybeUpdatePickerLocked();
 }
 
@@ -980,6 +1043,12 @@ void XdsOverrideHostLb::CleanupSubchannels() {
       }
     }
   }
+  // Pickers hold refs to READY subchannels through override_hosts_, so
+  // give them a new table without the dropped ones.
+  if (!subchannel_refs_to_drop.empty()) {
+    override_hosts_.reset();
+    MaybeUpdatePickerLocked();
+  }
   idle_timer_ =
       MakeOrphanable<IdleTimer>(RefAsSubclass<XdsOverrideHostLb>(), next_time);
 }
@@ -1060,12 +1129,16 @@ void XdsOverrideHostLb::SubchannelWrapper::Orphaned() {
 void XdsOverrideHostLb::SubchannelWrapper::UpdateConnectivityState(
     grpc_connectivity_state state, absl::Status status) {
   bool update_picker = false;
+  bool left_ready = false;
   if (subchannel_entry_ != nullptr) {
     MutexLock lock(&policy()->mu_);
     if (subchannel_entry_->connectivity_state() != state) {
+      left_ready =
+          subchannel_entry_->connectivity_state() == GRPC_CHANNEL_READY;
       subchannel_entry_->set_connectivity_state(state);
       update_picker = subchannel_entry_->HasOwnedSubchannel() &&
                       subchannel_entry_->GetSubchannel() == this;
+      policy()->override_hosts_.reset();
     }
   }
   // Sending connectivity state notifications to the watchers may cause the set
@@ -1081,7 +1154,13 @@ void XdsOverrideHostLb::SubchannelWrapper::UpdateConnectivityState(
       watcher->OnConnectivityStateChange(state, status);
     }
   }
-  if (update_picker) policy()->MaybeUpdatePickerLocked();
+  // The current picker may route cookies to this subchannel without
+  // checking its state, so if it is no longer READY, make sure there is a
+  // new picker, unless the child policy has already reported one.
+  if (update_picker ||
+      (left_ready && policy()->override_hosts_ == nullptr)) {
+    policy()->MaybeUpdatePickerLocked();
+  }
 }
 
 //
@@ -1143,7 +1222,7 @@ void XdsOverrideHostLb::SubchannelEntry::OnSubchannelWrapperOrphan(
     ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsOverrideHostLb::mu_) {
   auto* subchannel = GetSubchannel();
   if (subchannel != wrapper) return;
-  if (last_used_time_ < (Timestamp::Now() - connection_idle_timeout)) {
+  if (last_used_time() < (Timestamp::Now() - connection_idle_timeout)) {
     GRPC_TRACE_LOG(xds_override_host_lb, INFO)
         << "[xds_override_host_lb] removing unowned subchannel "
            "wrapper "
@@ -0,0 +1,269 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/resolver/dns/event_engine/dns_cache.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+#include <utility>
+
+#include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
+#include "src/core/util/no_destruct.h"
+
+namespace grpc_core {
+
+using grpc_event_engine::experimental::EventEngine;
+
+//
+// DnsCache::Table
+//
+
+template <typename T>
+void DnsCache::Table<T>::Lookup(const std::string& key, Options options,
+                                EventEngine* event_engine, const void* owner,
+                                Callback on_resolve, StartFn start) {
+  {
+    MutexLock lock(&mu_);
+    Entry& entry = entries_[key];
+    if (!entry.query_in_flight && entry.result.has_value() &&
+        Timestamp::Now() < entry.expires_at) {
+      event_engine->Run([on_resolve = std::move(on_resolve),
+                         result = *entry.result]() mutable {
+        on_resolve(std::move(result));
+      });
+      return;
+    }
+    entry.waiters.push_back(Waiter{owner, std::move(on_resolve)});
+    // Someone else's query will answer this lookup too.
+    if (entry.query_in_flight) return;
+    entry.query_in_flight = true;
+  }
+  start([this, key, options](absl::StatusOr<T> result) {
+    Complete(key, options, std::move(result));
+  });
+}
+
+template <typename T>
+void DnsCache::Table<T>::Complete(const std::string& key, Options options,
+                                  absl::StatusOr<T> result) {
+  std::vector<Waiter> waiters;
+  {
+    MutexLock lock(&mu_);
+    Entry& entry = entries_[key];
+    waiters = std::move(entry.waiters);
+    entry.waiters.clear();
+    entry.query_in_flight = false;
+    // A cancelled query says nothing about the name, so don't remember it.
+    const Duration max_age =
+        result.ok() ? options.max_age
+        : result.status().code() == absl::StatusCode::kCancelled
+            ? Duration::Zero()
+            : options.negative_max_age;
+    if (max_age > Duration::Zero()) {
+      entry.result = result;
+      entry.expires_at = Timestamp::Now() + max_age;
+    } else {
+      entries_.erase(key);
+    }
+    MaybeSweepLocked();
+  }
+  for (size_t i = 0; i + 1 < waiters.size(); ++i) {
+    waiters[i].on_resolve(result);
+  }
+  if (!waiters.empty()) waiters.back().on_resolve(std::move(result));
+}
+
+template <typename T>
+std::vector<typename DnsCache::Table<T>::Callback>
+DnsCache::Table<T>::CancelLookups(
+    const void* owner, const absl::flat_hash_set<std::string>& keys) {
+  std::vector<Callback> cancelled;
+  MutexLock lock(&mu_);
+  for (const std::string& key : keys) {
+    auto it = entries_.find(key);
+    if (it == entries_.end()) continue;
+    std::vector<Waiter>& waiters = it->second.waiters;
+    for (Waiter& waiter : waiters) {
+      if (waiter.owner == owner) {
+        cancelled.push_back(std::move(waiter.on_resolve));
+      }
+    }
+    waiters.erase(std::remove_if(waiters.begin(), waiters.end(),
+                                 [owner](const Waiter& waiter) {
+                                   return waiter.owner == owner;
+                                 }),
+                  waiters.end());
+  }
+  return cancelled;
+}
+
+template <typename T>
+void DnsCache::Table<T>::MaybeSweepLocked() {
+  if (entries_.size() <= kMaxEntries) return;
+  const Timestamp now = Timestamp::Now();
+  absl::erase_if(entries_, [now](const auto& key_and_entry) {
+    const Entry& entry = key_and_entry.second;
+    return !entry.query_in_flight && now >= entry.expires_at;
+  });
+}
+
+template <typename T>
+void DnsCache::Table<T>::Clear() {
+  MutexLock lock(&mu_);
+  absl::erase_if(entries_, [](const auto& key_and_entry) {
+    return !key_and_entry.second.query_in_flight;
+  });
+}
+
+//
+// DnsCache::CachingResolver
+//
+
+class DnsCache::CachingResolver final : public EventEngine::DNSResolver {
+ public:
+  CachingResolver(DnsCache* cache,
+                  std::unique_ptr<EventEngine::DNSResolver> resolver,
+                  absl::string_view dns_server, Options options,
+                  std::shared_ptr<EventEngine> event_engine)
+      : cache_(cache),
+        resolver_(std::move(resolver)),
+        dns_server_(dns_server),
+        options_(options),
+        event_engine_(std::move(event_engine)) {}
+
+  // Only this resolver's lookups are cancelled: the queries may have other
+  // lookups waiting on them.
+  ~CachingResolver() override {
+    MutexLock lock(&mu_);
+    CancelLookups(cache_->hostnames_, hostname_keys_);
+    CancelLookups(cache_->srv_records_, srv_keys_);
+    CancelLookups(cache_->txt_records_, txt_keys_);
+  }
+
+  // A query that other lookups are waiting on must outlive this
+  // resolver, so each one holds a ref to the underlying resolver.
+  void LookupHostname(LookupHostnameCallback on_resolve, absl::string_view name,
+                      absl::string_view default_port) override {
+    std::string key = absl::StrCat(dns_server_, "|", name, "|", default_port);
+    {
+      MutexLock lock(&mu_);
+      hostname_keys_.insert(key);
+    }
+    cache_->hostnames_.Lookup(
+        key, options_, event_engine_.get(), this, std::move(on_resolve),
+        [resolver = resolver_, name = std::string(name),
+         default_port = std::string(default_port)](
+            LookupHostnameCallback on_done) mutable {
+          resolver->LookupHostname(
+              [resolver, on_done = std::move(on_done)](
+                  absl::StatusOr<std::vector<EventEngine::ResolvedAddress>>
+                      addresses) mutable { on_done(std::move(addresses)); },
+              name, default_port);
+        });
+  }
+
+  void LookupSRV(LookupSRVCallback on_resolve,
+                 absl::string_view name) override {
+    std::string key = absl::StrCat(dns_server_, "|", name);
+    {
+      MutexLock lock(&mu_);
+      srv_keys_.insert(key);
+    }
+    cache_->srv_records_.Lookup(
+        key, options_, event_engine_.get(), this, std::move(on_resolve),
+        [resolver = resolver_,
+         name = std::string(name)](LookupSRVCallback on_done) mutable {
+          resolver->LookupSRV(
+              [resolver, on_done = std::move(on_done)](
+                  absl::StatusOr<std::vector<SRVRecord>> records) mutable {
+                on_done(std::move(records));
+              },
+              name);
+        });
+  }
+
+  void LookupTXT(LookupTXTCallback on_resolve,
+                 absl::string_view name) override {
+    std::string key = absl::StrCat(dns_server_, "|", name);
+    {
+      MutexLock lock(&mu_);
+      txt_keys_.insert(key);
+    }
+    cache_->txt_records_.Lookup(
+        key, options_, event_engine_.get(), this, std::move(on_resolve),
+        [resolver = resolver_,
+         name = std::string(name)](LookupTXTCallback on_done) mutable {
+          resolver->LookupTXT(
+              [resolver, on_done = std::move(on_done)](
+                  absl::StatusOr<std::vector<std::string>> records) mutable {
+                on_done(std::move(records));
+              },
+              name);
+        });
+  }
+
+ private:
+  // Delivers absl::CancelledError to the lookups this resolver still has
+  // queued in table.  Like cached answers, these never run inline.
+  template <typename T>
+  void CancelLookups(Table<T>& table,
+                     const absl::flat_hash_set<std::string>& keys)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    for (auto& on_resolve : table.CancelLookups(this, keys)) {
+      event_engine_->Run([on_resolve = std::move(on_resolve)]() mutable {
+        on_resolve(absl::CancelledError("DNS resolver shut down"));
+      });
+    }
+  }
+
+  DnsCache* cache_;
+  std::shared_ptr<EventEngine::DNSResolver> resolver_;
+  const std::string dns_server_;
+  const Options options_;
+  std::shared_ptr<EventEngine> event_engine_;
+  Mutex mu_;
+  // The keys of every lookup this resolver has started.  Names are
+  // re-resolved over and over, so these stay few.
+  absl::flat_hash_set<std::string> hostname_keys_ ABSL_GUARDED_BY(mu_);
+  absl::flat_hash_set<std::string> srv_keys_ ABSL_GUARDED_BY(mu_);
+  absl::flat_hash_set<std::string> txt_keys_ ABSL_GUARDED_BY(mu_);
+};
+
+//
+// DnsCache
+//
+
+DnsCache& DnsCache::Get() {
+  static NoDestruct<DnsCache> cache;
+  return *cache;
+}
+
+std::unique_ptr<EventEngine::DNSResolver> DnsCache::MakeCachingResolver(
+    std::unique_ptr<EventEngine::DNSResolver> resolver,
+    absl::string_view dns_server, Options options,
+    std::shared_ptr<EventEngine> event_engine) {
+  return std::make_unique<CachingResolver>(this, std::move(resolver),
+                                           dns_server, options,
+                                           std::move(event_engine));
+}
+
+void DnsCache::ClearForTesting() {
+  hostnames_.Clear();
+  srv_records_.Clear();
+  txt_records_.Clear();
+}
+
+}  // namespace grpc_core
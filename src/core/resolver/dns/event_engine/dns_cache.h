@@ -0,0 +1,124 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_RESOLVER_DNS_EVENT_ENGINE_DNS_CACHE_H
+#define GRPC_SRC_CORE_RESOLVER_DNS_EVENT_ENGINE_DNS_CACHE_H
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/container/flat_hash_set.h"
+#include "absl/functional/any_invocable.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+#include "src/core/util/sync.h"
+#include "src/core/util/time.h"
+
+namespace grpc_core {
+
+// A cache of DNS results shared by every channel in the process.  Besides
+// remembering results, it merges concurrent identical lookups into one
+// query.
+//
+// The EventEngine DNS API does not report record TTLs, so entries live
+// for the max age chosen by the lookup that filled them.
+class DnsCache final {
+ public:
+  struct Options {
+    Duration max_age = Duration::Zero();
+    Duration negative_max_age = Duration::Zero();
+  };
+
+  using EventEngine = grpc_event_engine::experimental::EventEngine;
+
+  // The process-wide instance.
+  static DnsCache& Get();
+
+  // Expired entries are swept once the cache holds more than this many.
+  static constexpr size_t kMaxEntries = 10000;
+
+  // Returns a resolver that answers lookups from the cache where it can,
+  // and otherwise from resolver.  Cached answers are delivered via
+  // event_engine, never inline.  Destroying the returned resolver cancels
+  // its pending lookups, as the DNSResolver contract requires; queries
+  // that other resolvers' lookups are waiting on keep running.
+  std::unique_ptr<EventEngine::DNSResolver> MakeCachingResolver(
+      std::unique_ptr<EventEngine::DNSResolver> resolver,
+      absl::string_view dns_server, Options options,
+      std::shared_ptr<EventEngine> event_engine);
+
+  // Drops every entry that has no query in flight.
+  void ClearForTesting();
+
+ private:
+  class CachingResolver;
+
+  template <typename T>
+  class Table {
+   public:
+    using Callback = absl::AnyInvocable<void(absl::StatusOr<T>)>;
+    using StartFn = absl::AnyInvocable<void(Callback)>;
+
+    // Delivers the cached result for key, or queues on_resolve behind
+    // the query for key, starting it with start if there is none.  owner
+    // identifies the lookup for CancelLookups().
+    void Lookup(const std::string& key, Options options,
+                EventEngine* event_engine, const void* owner,
+                Callback on_resolve, StartFn start);
+
+    // Removes the lookups that owner queued on keys, and returns their
+    // callbacks.  The queries themselves keep running.
+    std::vector<Callback> CancelLookups(
+        const void* owner, const absl::flat_hash_set<std::string>& keys);
+
+    void Clear();
+
+   private:
+    struct Waiter {
+      const void* owner;
+      Callback on_resolve;
+    };
+
+    struct Entry {
+      std::optional<absl::StatusOr<T>> result;
+      Timestamp expires_at;
+      // True from the start of a query until its result is delivered, even
+      // if every lookup waiting on it was cancelled meanwhile.
+      bool query_in_flight = false;
+      std::vector<Waiter> waiters;
+    };
+
+    void Complete(const std::string& key, Options options,
+                  absl::StatusOr<T> result);
+    void MaybeSweepLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+    Mutex mu_;
+    absl::flat_hash_map<std::string, Entry> entries_ ABSL_GUARDED_BY(mu_);
+  };
+
+  Table<std::vector<EventEngine::ResolvedAddress>> hostnames_;
+  Table<std::vector<EventEngine::DNSResolver::SRVRecord>> srv_records_;
+  Table<std::vector<std::string>> txt_records_;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_RESOLVER_DNS_EVENT_ENGINE_DNS_CACHE_H
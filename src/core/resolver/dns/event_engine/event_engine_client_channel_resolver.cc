@@ -42,6 +42,7 @@
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/iomgr/resolve_address.h"
 #include "src/core/load_balancing/grpclb/grpclb_balancer_addresses.h"
+#include "src/core/resolver/dns/event_engine/dns_cache.h"
 #include "src/core/resolver/dns/event_engine/service_config_helper.h"
 #include "src/core/resolver/endpoint_addresses.h"
 #include "src/core/resolver/polling_resolver.h"
@@ -157,6 +158,8 @@ class EventEngineClientChannelDNSResolver final : public PollingResolver {
   const bool enable_srv_queries_;
   // timeout in milliseconds for active DNS queries
   EventEngine::Duration query_timeout_ms_;
+  // how long results may be served from the process-wide DNS cache
+  const DnsCache::Options cache_options_;
   std::shared_ptr<EventEngine> event_engine_;
 };
 
@@ -183,6 +186,15 @@ EventEngineClientChannelDNSResolver::EventEngineClientChannelDNSResolver(
           std::max(0, channel_args()
                           .GetInt(GRPC_ARG_DNS_ARES_QUERY_TIMEOUT_MS)
                           .value_or(GRPC_DNS_DEFAULT_QUERY_TIMEOUT_MS)))),
+      cache_options_{
+          Duration::Milliseconds(std::max(
+              0, channel_args()
+                     .GetInt(GRPC_ARG_DNS_CACHE_MAX_AGE_MS)
+                     .value_or(0))),
+          Duration::Milliseconds(std::max(
+              0, channel_args()
+                     .GetInt(GRPC_ARG_DNS_CACHE_NEGATIVE_MAX_AGE_MS)
+                     .value_or(0)))},
       event_engine_(channel_args().GetObjectRef<EventEngine>()) {}
 
 OrphanablePtr<Orphanable> EventEngineClientChannelDNSResolver::StartRequest() {
@@ -195,6 +207,11 @@ OrphanablePtr<Orphanable> EventEngineClientChannelDNSResolver::StartRequest() {
     OnRequestComplete(std::move(result));
     return nullptr;
   }
+  if (cache_options_.max_age > Duration::Zero() ||
+      cache_options_.negative_max_age > Duration::Zero()) {
+    *dns_resolver = DnsCache::Get().MakeCachingResolver(
+        std::move(*dns_resolver), authority(), cache_options_, event_engine_);
+  }
   return MakeOrphanable<EventEngineDNSRequestWrapper>(
       RefAsSubclass<EventEngineClientChannelDNSResolver>(DEBUG_LOCATION,
                                                          "dns-resolving"),
@@ -252,6 +252,8 @@ class XdsResolver final : public Resolver {
 
     std::map<absl::string_view, RefCountedPtr<ClusterRef>> clusters_;
     std::vector<RouteEntry> routes_;
+    // Built from routes_ once they are all added.
+    std::optional<XdsRouting::CompiledRouteList> compiled_routes_;
   };
 
   class XdsConfigSelector final : public ConfigSelector {
@@ -417,14 +419,15 @@ XdsResolver::RouteConfigData::Create(
       return status;
     }
   }
+  data->compiled_routes_.emplace(RouteListIterator(data.get()));
   return data;
 }
 
 XdsResolver::RouteConfigData::RouteEntry*
 XdsResolver::RouteConfigData::GetRouteForRequest(
     absl::string_view path, grpc_metadata_batch* initial_metadata) {
-  auto route_index = XdsRouting::GetRouteForRequest(RouteListIterator(this),
-                                                    path, initial_metadata);
+  auto route_index = compiled_routes_->GetRouteForRequest(
+      RouteListIterator(this), path, initial_metadata);
   if (!route_index.has_value()) {
     return nullptr;
   }
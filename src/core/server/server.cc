@@ -35,6 +35,7 @@
 #include <new>
 #include <optional>
 #include <queue>
+#include <string>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -66,6 +67,7 @@
 #include "src/core/lib/promise/seq.h"
 #include "src/core/lib/promise/try_join.h"
 #include "src/core/lib/promise/try_seq.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
 #include "src/core/lib/slice/slice_buffer.h"
 #include "src/core/lib/slice/slice_internal.h"
 #include "src/core/lib/surface/call.h"
@@ -76,11 +78,14 @@
 #include "src/core/lib/surface/legacy_channel.h"
 #include "src/core/lib/transport/connectivity_state.h"
 #include "src/core/lib/transport/error_utils.h"
+#include "src/core/telemetry/metrics.h"
 #include "src/core/telemetry/stats.h"
+#include "src/core/util/codel.h"
 #include "src/core/util/crash.h"
 #include "src/core/util/debug_location.h"
 #include "src/core/util/mpscq.h"
 #include "src/core/util/orphanable.h"
+#include "src/core/util/per_cpu.h"
 #include "src/core/util/shared_bit_gen.h"
 #include "src/core/util/status_helper.h"
 #include "src/core/util/useful.h"
@@ -89,6 +94,18 @@ namespace grpc_core {
 
 using http2::Http2ErrorCode;
 
+namespace {
+
+const auto kMetricQueueDuration =
+    GlobalInstrumentsRegistry::RegisterDoubleHistogram(
+        "grpc.server.call.queue_duration",
+        "EXPERIMENTAL.  Time between a call arriving at the server and it "
+        "being matched with a request from the application.",
+        "s", false)
+        .Build();
+
+}  // namespace
+
 //
 // Server::ListenerState::ConfigFetcherWatcher
 //
@@ -138,6 +155,18 @@ Server::ListenerState::ListenerState(RefCountedPtr<Server> server,
     connection_quota_->SetMaxIncomingConnections(
         max_allowed_incoming_connections.value());
   }
+  auto max_pending_handshakes = server_->channel_args().GetInt(
+      GRPC_ARG_MAX_PENDING_INCOMING_HANDSHAKES);
+  if (max_pending_handshakes.has_value()) {
+    connection_quota_->SetMaxPendingHandshakes(
+        std::max(0, *max_pending_handshakes));
+  }
+  auto handshake_latency_target =
+      server_->channel_args().GetDurationFromIntMillis(
+          GRPC_ARG_INCOMING_HANDSHAKE_LATENCY_TARGET_MS);
+  if (handshake_latency_target.has_value()) {
+    connection_quota_->SetHandshakeLatencyTarget(*handshake_latency_target);
+  }
 }
 
 void Server::ListenerState::Start() {
@@ -552,10 +581,15 @@ struct Server::RequestedCall {
 class Server::RealRequestMatcher : public RequestMatcherInterface {
  public:
   explicit RealRequestMatcher(Server* server)
-      : server_(server), requests_per_cq_(server->cqs_.size()) {}
+      : server_(server),
+        requests_per_cq_(server->cqs_.size()),
+        codel_(server->queue_delay_target_ > Duration::Zero()
+                   ? std::make_unique<Codel>(server->queue_delay_target_,
+                                             server->queue_delay_interval_)
+                   : nullptr) {}
 
   ~RealRequestMatcher() override {
-    for (LockedMultiProducerSingleConsumerQueue& queue : requests_per_cq_) {
+    for (RequestQueue& queue : requests_per_cq_) {
       CHECK_EQ(queue.Pop(), nullptr);
     }
     CHECK(pending_filter_stack_.empty());
@@ -579,8 +613,7 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
   void KillRequests(grpc_error_handle error) override {
     for (size_t i = 0; i < requests_per_cq_.size(); i++) {
       RequestedCall* rc;
-      while ((rc = reinterpret_cast<RequestedCall*>(
-                  requests_per_cq_[i].Pop())) != nullptr) {
+      while ((rc = requests_per_cq_[i].Pop()) != nullptr) {
         server_->FailCall(i, rc, error);
       }
     }
@@ -592,7 +625,7 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
 
   void RequestCallWithPossiblePublish(size_t request_queue_index,
                                       RequestedCall* call) override {
-    if (requests_per_cq_[request_queue_index].Push(&call->mpscq_node)) {
+    if (requests_per_cq_[request_queue_index].Push(call)) {
       // this was the first queued request: we need to lock and start
       // matching calls
       struct NextPendingCall {
@@ -613,17 +646,17 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
             pending_filter_stack_.pop();
           }
           if (!pending_promises_.empty()) {
-            pending_call.rc = reinterpret_cast<RequestedCall*>(
-                requests_per_cq_[request_queue_index].Pop());
+            pending_call.rc = requests_per_cq_[request_queue_index].Pop();
             if (pending_call.rc != nullptr) {
+              RecordQueueDelayLocked(pending_promises_.front()->Age());
               pending_call.pending_promise =
                   std::move(pending_promises_.front());
               pending_promises_.pop();
             }
           } else if (!pending_filter_stack_.empty()) {
-            pending_call.rc = reinterpret_cast<RequestedCall*>(
-                requests_per_cq_[request_queue_index].Pop());
+            pending_call.rc = requests_per_cq_[request_queue_index].Pop();
             if (pending_call.rc != nullptr) {
+              RecordQueueDelayLocked(pending_filter_stack_.front().Age());
               pending_call.pending_filter_stack =
                   pending_filter_stack_.front().calld;
               pending_filter_stack_.pop();
@@ -635,8 +668,7 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
           if (!pending_call.pending_filter_stack->MaybeActivate()) {
             // Zombied Call
             pending_call.pending_filter_stack->KillZombie();
-            requests_per_cq_[request_queue_index].Push(
-                &pending_call.rc->mpscq_node);
+            requests_per_cq_[request_queue_index].Push(pending_call.rc);
           } else {
             pending_call.pending_filter_stack->Publish(request_queue_index,
                                                        pending_call.rc);
@@ -644,8 +676,7 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
         } else {
           if (!pending_call.pending_promise->Finish(
                   server(), request_queue_index, pending_call.rc)) {
-            requests_per_cq_[request_queue_index].Push(
-                &pending_call.rc->mpscq_node);
+            requests_per_cq_[request_queue_index].Push(pending_call.rc);
           }
         }
       }
@@ -656,9 +687,9 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
                     CallData* calld) override {
     for (size_t i = 0; i < requests_per_cq_.size(); i++) {
       size_t cq_idx = (start_request_queue_index + i) % requests_per_cq_.size();
-      RequestedCall* rc =
-          reinterpret_cast<RequestedCall*>(requests_per_cq_[cq_idx].TryPop());
+      RequestedCall* rc = requests_per_cq_[cq_idx].TryPop();
       if (rc != nullptr) {
+        RecordMatchedWithoutQueueing();
         calld->SetState(CallData::CallState::ACTIVATED);
         calld->Publish(cq_idx, rc);
         return;
@@ -672,21 +703,28 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
     RequestedCall* rc = nullptr;
     size_t cq_idx = 0;
     size_t loop_count;
+    absl::string_view shed_message;
     {
       MutexLock lock(&server_->mu_call_);
       for (loop_count = 0; loop_count < requests_per_cq_.size(); loop_count++) {
         cq_idx =
             (start_request_queue_index + loop_count) % requests_per_cq_.size();
-        rc = reinterpret_cast<RequestedCall*>(requests_per_cq_[cq_idx].Pop());
+        rc = requests_per_cq_[cq_idx].Pop();
         if (rc != nullptr) {
           break;
         }
       }
-      if (rc == nullptr) {
+      if (rc == nullptr) shed_message = ShedLocked();
+      if (rc == nullptr && shed_message.empty()) {
         calld->SetState(CallData::CallState::PENDING);
         pending_filter_stack_.push(PendingCallFilterStack{calld});
         return;
       }
+      if (rc != nullptr) RecordQueueDelayLocked(Duration::Zero());
+    }
+    if (rc == nullptr) {
+      calld->Reject(absl::ResourceExhaustedError(shed_message));
+      return;
     }
     calld->SetState(CallData::CallState::ACTIVATED);
     calld->Publish(cq_idx, rc);
@@ -696,9 +734,9 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
       size_t start_request_queue_index) override {
     for (size_t i = 0; i < requests_per_cq_.size(); i++) {
       size_t cq_idx = (start_request_queue_index + i) % requests_per_cq_.size();
-      RequestedCall* rc =
-          reinterpret_cast<RequestedCall*>(requests_per_cq_[cq_idx].TryPop());
+      RequestedCall* rc = requests_per_cq_[cq_idx].TryPop();
       if (rc != nullptr) {
+        RecordMatchedWithoutQueueing();
         return Immediate(MatchResult(server(), cq_idx, rc));
       }
     }
@@ -722,7 +760,7 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
       for (loop_count = 0; loop_count < requests_per_cq_.size(); loop_count++) {
         cq_idx =
             (start_request_queue_index + loop_count) % requests_per_cq_.size();
-        rc = reinterpret_cast<RequestedCall*>(requests_per_cq_[cq_idx].Pop());
+        rc = requests_per_cq_[cq_idx].Pop();
         if (rc != nullptr) break;
       }
       if (rc == nullptr) {
@@ -731,6 +769,10 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
           return Immediate(absl::ResourceExhaustedError(
               "Too many pending requests for this server"));
         }
+        absl::string_view shed_message = ShedLocked();
+        if (!shed_message.empty()) {
+          return Immediate(absl::ResourceExhaustedError(shed_message));
+        }
         if (zombified_) {
           return Immediate(absl::InternalError("Server closed"));
         }
@@ -746,6 +788,7 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
             },
             [w]() { w->Finish(absl::CancelledError()); });
       }
+      RecordQueueDelayLocked(Duration::Zero());
     }
     return Immediate(MatchResult(server(), cq_idx, rc));
   }
@@ -753,6 +796,50 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
   Server* server() const final { return server_; }
 
  private:
+  static constexpr absl::string_view kShedMessage =
+      "Request queueing delay for this method is too high";
+  static constexpr absl::string_view kCpuShedMessage =
+      "Server is over its CPU budget";
+
+  // Notes that a call found a request waiting for it, without taking
+  // mu_call_: the flag is folded into codel_ by the next ShedLocked().
+  void RecordMatchedWithoutQueueing() {
+    RecordQueueDuration(Duration::Zero());
+    if (codel_ != nullptr &&
+        !matched_without_queueing_.load(std::memory_order_relaxed)) {
+      matched_without_queueing_.store(true, std::memory_order_relaxed);
+    }
+  }
+
+  // Records how long a call waited for a request.  Requires mu_call_.
+  void RecordQueueDelayLocked(Duration delay) {
+    RecordQueueDuration(delay);
+    if (codel_ != nullptr) codel_->RecordDelay(delay, Timestamp::Now());
+  }
+
+  void RecordQueueDuration(Duration delay) {
+    server_->stats_plugin_group_->RecordHistogram(kMetricQueueDuration,
+                                                  delay.seconds(), {}, {});
+  }
+
+  // Returns why a call that found no request waiting should be rejected
+  // instead of queued, or an empty string if it should be queued.  Requires
+  // mu_call_.
+  absl::string_view ShedLocked() {
+    if (server_->cpu_quota_->IsOverBudget()) {
+      global_stats().IncrementServerCallsShed();
+      return kCpuShedMessage;
+    }
+    if (codel_ == nullptr) return {};
+    const Timestamp now = Timestamp::Now();
+    if (matched_without_queueing_.exchange(false, std::memory_order_relaxed)) {
+      codel_->RecordDelay(Duration::Zero(), now);
+    }
+    if (!codel_->Reject(now)) return {};
+    global_stats().IncrementServerCallsShed();
+    return kShedMessage;
+  }
+
   Server* const server_;
   struct PendingCallFilterStack {
     CallData* calld;
@@ -798,8 +885,41 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
   using PendingCallPromises = std::shared_ptr<ActivityWaiter>;
   std::queue<PendingCallFilterStack> pending_filter_stack_;
   std::queue<PendingCallPromises> pending_promises_;
-  std::vector<LockedMultiProducerSingleConsumerQueue> requests_per_cq_;
+  // The requests queued on one cq.  Each queue sits on its own cache line,
+  // and keeps a count of the requests it holds so that a call scanning the
+  // queues for a request can pass over empty ones without taking their
+  // lock.  The count is raised before a push and lowered after a pop, so it
+  // is never below the real size; a stale zero only sends the call to the
+  // slow path, which pops every queue under mu_call_ regardless.
+  class alignas(GPR_CACHELINE_SIZE) RequestQueue {
+   public:
+    bool Push(RequestedCall* rc) {
+      size_.fetch_add(1, std::memory_order_relaxed);
+      return queue_.Push(&rc->mpscq_node);
+    }
+    RequestedCall* TryPop() {
+      if (size_.load(std::memory_order_relaxed) == 0) return nullptr;
+      return Popped(queue_.TryPop());
+    }
+    RequestedCall* Pop() { return Popped(queue_.Pop()); }
+
+   private:
+    RequestedCall* Popped(MultiProducerSingleConsumerQueue::Node* node) {
+      if (node == nullptr) return nullptr;
+      size_.fetch_sub(1, std::memory_order_relaxed);
+      return reinterpret_cast<RequestedCall*>(node);
+    }
+
+    LockedMultiProducerSingleConsumerQueue queue_;
+    std::atomic<size_t> size_{0};
+  };
+  std::vector<RequestQueue> requests_per_cq_;
   bool zombified_ = false;
+  // Sheds calls to this method while its queueing delay stays above the
+  // server's target.  Null when shedding is disabled; otherwise guarded by
+  // server_->mu_call_.
+  const std::unique_ptr<Codel> codel_;
+  std::atomic<bool> matched_without_queueing_{false};
 };
 
 // AllocatingRequestMatchers don't allow the application to request an RPC in
@@ -1050,6 +1170,15 @@ const grpc_channel_filter Server::kServerTopFilter = {
 
 namespace {
 
+// Promise-based calls have no cq of their own to start matching from, so
+// spread them over the request queues by the cpu they arrive on rather than
+// having every call contend on the first queue.
+size_t StartRequestQueueIndex(size_t request_queue_count) {
+  if (request_queue_count <= 1) return 0;
+  PerCpuShardingHelper sharding_helper;
+  return sharding_helper.GetShardingBits() % request_queue_count;
+}
+
 RefCountedPtr<channelz::ServerNode> CreateChannelzNode(
     const ChannelArgs& args) {
   RefCountedPtr<channelz::ServerNode> channelz_node;
@@ -1112,7 +1241,8 @@ auto Server::MatchRequestAndMaybeReadFirstMessage(CallHandler call_handler,
       },
       []() -> FirstMessageResult { return FirstMessageResult(std::nullopt); });
   return TryJoin<absl::StatusOr>(
-      std::move(maybe_read_first_message), rm->MatchRequest(0),
+      std::move(maybe_read_first_message),
+      rm->MatchRequest(StartRequestQueueIndex(rm->request_queue_count())),
       [md = std::move(md)]() mutable {
         return ValueOrFailure<ClientMetadataHandle>(std::move(md));
       });
@@ -1173,7 +1303,16 @@ Server::Server(const ChannelArgs& args)
       max_time_in_pending_queue_(Duration::Seconds(
           channel_args_
               .GetInt(GRPC_ARG_SERVER_MAX_UNREQUESTED_TIME_IN_SERVER_SECONDS)
-              .value_or(30))) {}
+              .value_or(30))),
+      queue_delay_target_(Duration::Milliseconds(std::max(
+          0, channel_args_.GetInt(GRPC_ARG_SERVER_QUEUE_DELAY_TARGET_MS)
+                 .value_or(0)))),
+      queue_delay_interval_(Duration::Milliseconds(std::max(
+          1, channel_args_.GetInt(GRPC_ARG_SERVER_QUEUE_DELAY_INTERVAL_MS)
+                 .value_or(100)))),
+      cpu_quota_(channel_args_.GetObject<ResourceQuota>()->cpu_quota()),
+      stats_plugin_group_(
+          GlobalStatsPluginRegistry::GetStatsPluginsForServer(args)) {}
 
 Server::~Server() {
   // Remove the cq pollsets from the config_fetcher.
@@ -1843,6 +1982,14 @@ void Server::CallData::FailCallCreation() {
   }
 }
 
+void Server::CallData::Reject(const absl::Status& status) {
+  state_.store(CallState::ZOMBIED, std::memory_order_relaxed);
+  grpc_call_cancel_with_status(call_,
+                               static_cast<grpc_status_code>(status.code()),
+                               std::string(status.message()).c_str(), nullptr);
+  KillZombie();
+}
+
 void Server::CallData::Start(grpc_call_element* elem) {
   grpc_op op;
   op.op = GRPC_OP_RECV_INITIAL_METADATA;
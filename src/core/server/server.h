@@ -57,12 +57,14 @@
 #include "src/core/lib/iomgr/resolved_address.h"
 #include "src/core/lib/promise/arena_promise.h"
 #include "src/core/lib/resource_quota/connection_quota.h"
+#include "src/core/lib/resource_quota/cpu_quota.h"
 #include "src/core/lib/slice/slice.h"
 #include "src/core/lib/surface/channel.h"
 #include "src/core/lib/surface/completion_queue.h"
 #include "src/core/lib/transport/transport.h"
 #include "src/core/server/server_interface.h"
 #include "src/core/telemetry/call_tracer.h"
+#include "src/core/telemetry/metrics.h"
 #include "src/core/util/cpp_impl_of.h"
 #include "src/core/util/dual_ref_counted.h"
 #include "src/core/util/orphanable.h"
@@ -488,6 +490,10 @@ class Server : public ServerInterface,
 
     void FailCallCreation();
 
+    // Fails a call that has not been published with status, instead of
+    // queueing it.
+    void Reject(const absl::Status& status);
+
     // Filter vtable functions.
     static grpc_error_handle InitCallElement(
         grpc_call_element* elem, const grpc_call_element_args* args);
@@ -696,6 +702,15 @@ class Server : public ServerInterface,
           channel_args_.GetInt(GRPC_ARG_SERVER_MAX_PENDING_REQUESTS_HARD_LIMIT)
               .value_or(3000)))};
   const Duration max_time_in_pending_queue_;
+  // CoDel parameters for shedding calls that wait too long for a request;
+  // a zero target disables shedding.
+  const Duration queue_delay_target_;
+  const Duration queue_delay_interval_;
+  // Calls that would queue are shed while this is over its budget.
+  const RefCountedPtr<CpuQuota> cpu_quota_;
+  // Receives the time each call waited for a request.
+  const std::shared_ptr<GlobalStatsPluginRegistry::StatsPluginGroup>
+      stats_plugin_group_;
 
   std::list<ChannelData*> channels_;
   absl::flat_hash_set<OrphanablePtr<ServerTransport>> connections_
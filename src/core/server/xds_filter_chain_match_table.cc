@@ -0,0 +1,183 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include "src/core/server/xds_filter_chain_match_table.h"
+
+#include <grpc/support/port_platform.h>
+#include <string.h>
+
+#include <algorithm>
+#include <functional>
+
+#include "src/core/lib/iomgr/sockaddr.h"
+
+namespace grpc_core {
+
+namespace {
+
+// Clears all but the first \a prefix_len bits of \a bytes.
+template <size_t N>
+void MaskBytes(std::array<uint8_t, N>* bytes, uint32_t prefix_len) {
+  for (size_t i = 0; i < N; ++i) {
+    if (prefix_len >= 8) {
+      prefix_len -= 8;
+    } else {
+      (*bytes)[i] &= static_cast<uint8_t>(0xff00 >> prefix_len);
+      prefix_len = 0;
+    }
+  }
+}
+
+}  // namespace
+
+//
+// CidrMatcher
+//
+
+int CidrMatcher::AddressFamily(const grpc_resolved_address& address,
+                               Bytes* bytes) {
+  bytes->fill(0);
+  const grpc_sockaddr* sock_addr =
+      reinterpret_cast<const grpc_sockaddr*>(address.addr);
+  if (sock_addr->sa_family == GRPC_AF_INET) {
+    const grpc_sockaddr_in* addr4 =
+        reinterpret_cast<const grpc_sockaddr_in*>(sock_addr);
+    memcpy(bytes->data(), &addr4->sin_addr, sizeof(addr4->sin_addr));
+    return 0;
+  }
+  if (sock_addr->sa_family == GRPC_AF_INET6) {
+    const grpc_sockaddr_in6* addr6 =
+        reinterpret_cast<const grpc_sockaddr_in6*>(sock_addr);
+    memcpy(bytes->data(), &addr6->sin6_addr, sizeof(addr6->sin6_addr));
+    return 1;
+  }
+  return -1;
+}
+
+void CidrMatcher::Insert(
+    const std::optional<XdsListenerResource::FilterChainMap::CidrRange>& range,
+    uint32_t index) {
+  if (!range.has_value()) {
+    catch_all_ = index;
+    return;
+  }
+  Bytes bytes;
+  const int family_index = AddressFamily(range->address, &bytes);
+  if (family_index < 0) return;
+  Family& family = families_[family_index];
+  // The parser has already masked the address and clamped the length.
+  MaskBytes(&bytes, range->prefix_len);
+  family.ranges.emplace(std::pair(range->prefix_len, bytes), index);
+  auto it = std::lower_bound(family.prefix_lens.begin(),
+                             family.prefix_lens.end(), range->prefix_len,
+                             std::greater<uint32_t>());
+  if (it == family.prefix_lens.end() || *it != range->prefix_len) {
+    family.prefix_lens.insert(it, range->prefix_len);
+  }
+}
+
+uint32_t CidrMatcher::Lookup(const grpc_resolved_address& address) const {
+  Bytes bytes;
+  const int family_index = AddressFamily(address, &bytes);
+  if (family_index >= 0) {
+    const Family& family = families_[family_index];
+    for (uint32_t prefix_len : family.prefix_lens) {
+      MaskBytes(&bytes, prefix_len);
+      auto it = family.ranges.find(std::pair(prefix_len, bytes));
+      if (it != family.ranges.end()) return it->second;
+    }
+  }
+  return catch_all_;
+}
+
+//
+// XdsFilterChainMatchTable
+//
+
+XdsFilterChainMatchTable::XdsFilterChainMatchTable(
+    const XdsListenerResource::FilterChainMap& filter_chain_map) {
+  using ConnectionSourceType =
+      XdsListenerResource::FilterChainMap::ConnectionSourceType;
+  const auto& destination_ip_vector = filter_chain_map.destination_ip_vector;
+  destination_ips_.reserve(destination_ip_vector.size());
+  for (size_t i = 0; i < destination_ip_vector.size(); ++i) {
+    const auto& destination_ip = destination_ip_vector[i];
+    destination_matcher_.Insert(destination_ip.prefix_range, i);
+    DestinationIp compiled;
+    for (size_t j = 0; j < compiled.source_types.size(); ++j) {
+      compiled.source_types[j] =
+          CompileSourceType(destination_ip.source_types_array[j]);
+    }
+    compiled.any_source_type_only =
+        destination_ip
+            .source_types_array[static_cast<int>(
+                ConnectionSourceType::kSameIpOrLoopback)]
+            .empty() &&
+        destination_ip
+            .source_types_array[static_cast<int>(
+                ConnectionSourceType::kExternal)]
+            .empty();
+    destination_ips_.push_back(std::move(compiled));
+  }
+}
+
+XdsFilterChainMatchTable::SourceType
+XdsFilterChainMatchTable::CompileSourceType(
+    const XdsListenerResource::FilterChainMap::SourceIpVector& source_ips) {
+  SourceType compiled;
+  compiled.source_ips.reserve(source_ips.size());
+  for (size_t i = 0; i < source_ips.size(); ++i) {
+    compiled.matcher.Insert(source_ips[i].prefix_range, i);
+    SourceIp source_ip;
+    for (const auto& [port, filter_chain] : source_ips[i].ports_map) {
+      if (port == 0) {
+        source_ip.any_port = filter_chain.data.get();
+      } else {
+        source_ip.ports.emplace(port, filter_chain.data.get());
+      }
+    }
+    compiled.source_ips.push_back(std::move(source_ip));
+  }
+  return compiled;
+}
+
+const XdsListenerResource::FilterChainData* XdsFilterChainMatchTable::Find(
+    const grpc_resolved_address& destination,
+    const grpc_resolved_address& source, uint16_t source_port,
+    bool source_is_local) const {
+  using ConnectionSourceType =
+      XdsListenerResource::FilterChainMap::ConnectionSourceType;
+  const uint32_t destination_index = destination_matcher_.Lookup(destination);
+  if (destination_index == CidrMatcher::kNoMatch) return nullptr;
+  const DestinationIp& destination_ip = destination_ips_[destination_index];
+  ConnectionSourceType source_type = ConnectionSourceType::kAny;
+  if (!destination_ip.any_source_type_only) {
+    source_type = source_is_local ? ConnectionSourceType::kSameIpOrLoopback
+                                  : ConnectionSourceType::kExternal;
+  }
+  const SourceType& compiled_source_type =
+      destination_ip.source_types[static_cast<int>(source_type)];
+  const uint32_t source_index = compiled_source_type.matcher.Lookup(source);
+  if (source_index == CidrMatcher::kNoMatch) return nullptr;
+  const SourceIp& source_ip = compiled_source_type.source_ips[source_index];
+  auto it = source_ip.ports.find(source_port);
+  if (it != source_ip.ports.end()) return it->second;
+  return source_ip.any_port;
+}
+
+}  // namespace grpc_core
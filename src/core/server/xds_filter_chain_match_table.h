@@ -0,0 +1,121 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#ifndef GRPC_SRC_CORE_SERVER_XDS_FILTER_CHAIN_MATCH_TABLE_H
+#define GRPC_SRC_CORE_SERVER_XDS_FILTER_CHAIN_MATCH_TABLE_H
+
+#include <grpc/support/port_platform.h>
+#include <stdint.h>
+
+#include <array>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "absl/container/flat_hash_map.h"
+#include "src/core/lib/iomgr/resolved_address.h"
+#include "src/core/xds/grpc/xds_listener.h"
+
+namespace grpc_core {
+
+// Longest-prefix-match lookup over a set of CIDR ranges. Each prefix length
+// in use gets one hash probe, so a lookup costs at most 33 (IPv4) or 129
+// (IPv6) probes however many ranges there are, and in practice only as many
+// as there are distinct prefix lengths.
+class CidrMatcher {
+ public:
+  static constexpr uint32_t kNoMatch = UINT32_MAX;
+
+  // Maps \a range to \a index. An empty \a range matches any address that no
+  // range matches.
+  void Insert(
+      const std::optional<XdsListenerResource::FilterChainMap::CidrRange>&
+          range,
+      uint32_t index);
+
+  // Returns the index of the longest range containing \a address, or kNoMatch.
+  uint32_t Lookup(const grpc_resolved_address& address) const;
+
+ private:
+  using Bytes = std::array<uint8_t, 16>;
+
+  struct Family {
+    // Prefix lengths in use, longest first.
+    std::vector<uint32_t> prefix_lens;
+    absl::flat_hash_map<std::pair<uint32_t, Bytes>, uint32_t> ranges;
+  };
+
+  // Returns 0 for an IPv4 and 1 for an IPv6 address, with its bytes copied
+  // into \a bytes, or -1 for any other address.
+  static int AddressFamily(const grpc_resolved_address& address, Bytes* bytes);
+
+  std::array<Family, 2> families_;
+  uint32_t catch_all_ = kNoMatch;
+};
+
+// A compiled form of XdsListenerResource::FilterChainMap, built once per
+// listener update, that picks the filter chain for a connection without
+// walking the map's vectors of CIDR ranges.
+//
+// The table points into the FilterChainData held by the map it was built
+// from, so the map must outlive it.
+class XdsFilterChainMatchTable {
+ public:
+  explicit XdsFilterChainMatchTable(
+      const XdsListenerResource::FilterChainMap& filter_chain_map);
+
+  // Returns the filter chain for a connection from \a source at
+  // \a source_port to \a destination, or nullptr if none matches.
+  // \a source_is_local tells whether the source is a loopback address or
+  // the destination address itself.
+  const XdsListenerResource::FilterChainData* Find(
+      const grpc_resolved_address& destination,
+      const grpc_resolved_address& source, uint16_t source_port,
+      bool source_is_local) const;
+
+ private:
+  struct SourceIp {
+    absl::flat_hash_map<uint16_t, const XdsListenerResource::FilterChainData*>
+        ports;
+    // Chain for source port 0, which means any port.
+    const XdsListenerResource::FilterChainData* any_port = nullptr;
+  };
+
+  struct SourceType {
+    CidrMatcher matcher;
+    std::vector<SourceIp> source_ips;
+  };
+
+  struct DestinationIp {
+    // Indexed by FilterChainMap::ConnectionSourceType.
+    std::array<SourceType, 3> source_types;
+    // True if only kAny has entries, in which case the source type of a
+    // connection does not matter.
+    bool any_source_type_only;
+  };
+
+  static SourceType CompileSourceType(
+      const XdsListenerResource::FilterChainMap::SourceIpVector& source_ips);
+
+  CidrMatcher destination_matcher_;
+  std::vector<DestinationIp> destination_ips_;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_SERVER_XDS_FILTER_CHAIN_MATCH_TABLE_H
@@ -67,6 +67,7 @@
 #include "src/core/server/server_config_selector.h"
 #include "src/core/server/server_config_selector_filter.h"
 #include "src/core/server/xds_channel_stack_modifier.h"
+#include "src/core/server/xds_filter_chain_match_table.h"
 #include "src/core/service_config/service_config.h"
 #include "src/core/service_config/service_config_impl.h"
 #include "src/core/util/debug_location.h"
@@ -256,6 +257,8 @@ class XdsServerConfigFetcher::ListenerWatcher::FilterChainMatchManager final
   // a pointer to the filter chain data within that LDS resource, rather
   // than copying the filter chain data here.
   XdsListenerResource::FilterChainMap filter_chain_map_;
+  // Built from filter_chain_map_, so it must be declared after it.
+  const XdsFilterChainMatchTable filter_chain_match_table_;
   std::optional<XdsListenerResource::FilterChainData> default_filter_chain_;
   Mutex mu_;
   size_t rds_resources_yet_to_fetch_ ABSL_GUARDED_BY(mu_) = 0;
@@ -350,6 +353,8 @@ class XdsServerConfigFetcher::ListenerWatcher::FilterChainMatchManager::
 
     std::vector<std::string> domains;
     std::vector<Route> routes;
+    // Built from routes once they are all added.
+    std::optional<XdsRouting::CompiledRouteList> compiled_routes;
   };
 
   class VirtualHostListIterator final
@@ -371,6 +376,8 @@ class XdsServerConfigFetcher::ListenerWatcher::FilterChainMatchManager::
   };
 
   std::vector<VirtualHost> virtual_hosts_;
+  // Built from virtual_hosts_ once they are all added.
+  std::optional<XdsRouting::CompiledVirtualHostList> compiled_virtual_hosts_;
 };
 
 // An XdsServerConfigSelectorProvider implementation for when the
@@ -682,6 +689,7 @@ XdsServerConfigFetcher::ListenerWatcher::FilterChainMatchManager::
             default_filter_chain)
     : xds_client_(std::move(xds_client)),
       filter_chain_map_(std::move(filter_chain_map)),
+      filter_chain_match_table_(filter_chain_map_),
       default_filter_chain_(std::move(default_filter_chain)) {}
 
 void XdsServerConfigFetcher::ListenerWatcher::FilterChainMatchManager::
@@ -849,49 +857,6 @@ void XdsServerConfigFetcher::ListenerWatcher::FilterChainMatchManager::
              << resource_name << "; ignoring in favor of existing resource";
 }
 
-const XdsListenerResource::FilterChainData* FindFilterChainDataForSourcePort(
-    const XdsListenerResource::FilterChainMap::SourcePortsMap& source_ports_map,
-    absl::string_view port_str) {
-  int port = 0;
-  if (!absl::SimpleAtoi(port_str, &port)) return nullptr;
-  auto it = source_ports_map.find(port);
-  if (it != source_ports_map.end()) {
-    return it->second.data.get();
-  }
-  // Search for the catch-all port 0 since we didn't get a direct match
-  it = source_ports_map.find(0);
-  if (it != source_ports_map.end()) {
-    return it->second.data.get();
-  }
-  return nullptr;
-}
-
-const XdsListenerResource::FilterChainData* FindFilterChainDataForSourceIp(
-    const XdsListenerResource::FilterChainMap::SourceIpVector& source_ip_vector,
-    const grpc_resolved_address* source_ip, absl::string_view port) {
-  const XdsListenerResource::FilterChainMap::SourceIp* best_match = nullptr;
-  for (const auto& entry : source_ip_vector) {
-    // Special case for catch-all
-    if (!entry.prefix_range.has_value()) {
-      if (best_match == nullptr) {
-        best_match = &entry;
-      }
-      continue;
-    }
-    if (best_match != nullptr && best_match->prefix_range.has_value() &&
-        best_match->prefix_range->prefix_len >=
-            entry.prefix_range->prefix_len) {
-      continue;
-    }
-    if (grpc_sockaddr_match_subnet(source_ip, &entry.prefix_range->address,
-                                   entry.prefix_range->prefix_len)) {
-      best_match = &entry;
-    }
-  }
-  if (best_match == nullptr) return nullptr;
-  return FindFilterChainDataForSourcePort(best_match->ports_map, port);
-}
-
 bool IsLoopbackIp(const grpc_resolved_address* address) {
   const grpc_sockaddr* sock_addr =
       reinterpret_cast<const grpc_sockaddr*>(&address->addr);
@@ -912,107 +877,62 @@ bool IsLoopbackIp(const grpc_resolved_address* address) {
   return false;
 }
 
-const XdsListenerResource::FilterChainData* FindFilterChainDataForSourceType(
-    const XdsListenerResource::FilterChainMap::ConnectionSourceTypesArray&
-        source_types_array,
-    grpc_endpoint* tcp, absl::string_view destination_ip) {
-  auto source_uri = URI::Parse(grpc_endpoint_get_peer(tcp));
-  if (!source_uri.ok() ||
-      (source_uri->scheme() != "ipv4" && source_uri->scheme() != "ipv6")) {
-    return nullptr;
-  }
-  std::string host;
-  std::string port;
-  if (!SplitHostPort(source_uri->path(), &host, &port)) {
-    return nullptr;
-  }
-  auto source_addr = StringToSockaddr(host, 0);  // Port doesn't matter here.
-  if (!source_addr.ok()) {
-    VLOG(2) << "Could not parse \"" << host
-            << "\" as socket address: " << source_addr.status();
-    return nullptr;
-  }
-  // Use kAny only if kSameIporLoopback and kExternal are empty
-  if (source_types_array[static_cast<int>(
-                             XdsListenerResource::FilterChainMap::
-                                 ConnectionSourceType::kSameIpOrLoopback)]
-          .empty() &&
-      source_types_array[static_cast<int>(XdsListenerResource::FilterChainMap::
-                                              ConnectionSourceType::kExternal)]
-          .empty()) {
-    return FindFilterChainDataForSourceIp(
-        source_types_array[static_cast<int>(
-            XdsListenerResource::FilterChainMap::ConnectionSourceType::kAny)],
-        &*source_addr, port);
-  }
-  if (IsLoopbackIp(&*source_addr) || host == destination_ip) {
-    return FindFilterChainDataForSourceIp(
-        source_types_array[static_cast<int>(
-            XdsListenerResource::FilterChainMap::ConnectionSourceType::
-                kSameIpOrLoopback)],
-        &*source_addr, port);
-  } else {
-    return FindFilterChainDataForSourceIp(
-        source_types_array[static_cast<int>(
-            XdsListenerResource::FilterChainMap::ConnectionSourceType::
-                kExternal)],
-        &*source_addr, port);
-  }
+// Parses the host and port of an endpoint address such as
+// "ipv4:10.0.0.1:443".
+bool ParseEndpointAddress(absl::string_view uri_string,
+                          grpc_resolved_address* address, std::string* host,
+                          uint16_t* port) {
+  auto uri = URI::Parse(uri_string);
+  if (!uri.ok() || (uri->scheme() != "ipv4" && uri->scheme() != "ipv6")) {
+    return false;
+  }
+  std::string port_str;
+  if (!SplitHostPort(uri->path(), host, &port_str)) return false;
+  auto parsed = StringToSockaddr(*host, 0);  // Port doesn't matter here.
+  if (!parsed.ok()) {
+    VLOG(2) << "Could not parse \"" << *host
+            << "\" as socket address: " << parsed.status();
+    return false;
+  }
+  *address = *parsed;
+  int port_number = 0;
+  if (!absl::SimpleAtoi(port_str, &port_number) || port_number < 0 ||
+      port_number > UINT16_MAX) {
+    return false;
+  }
+  *port = static_cast<uint16_t>(port_number);
+  return true;
 }
 
-const XdsListenerResource::FilterChainData* FindFilterChainDataForDestinationIp(
-    const XdsListenerResource::FilterChainMap::DestinationIpVector
-        destination_ip_vector,
+const XdsListenerResource::FilterChainData* FindFilterChainDataForConnection(
+    const XdsFilterChainMatchTable& filter_chain_match_table,
     grpc_endpoint* tcp) {
-  auto destination_uri = URI::Parse(grpc_endpoint_get_local_address(tcp));
-  if (!destination_uri.ok() || (destination_uri->scheme() != "ipv4" &&
-                                destination_uri->scheme() != "ipv6")) {
+  grpc_resolved_address destination_addr;
+  std::string destination_host;
+  uint16_t destination_port;
+  if (!ParseEndpointAddress(grpc_endpoint_get_local_address(tcp),
+                            &destination_addr, &destination_host,
+                            &destination_port)) {
     return nullptr;
   }
-  std::string host;
-  std::string port;
-  if (!SplitHostPort(destination_uri->path(), &host, &port)) {
+  grpc_resolved_address source_addr;
+  std::string source_host;
+  uint16_t source_port;
+  if (!ParseEndpointAddress(grpc_endpoint_get_peer(tcp), &source_addr,
+                            &source_host, &source_port)) {
     return nullptr;
   }
-  auto destination_addr =
-      StringToSockaddr(host, 0);  // Port doesn't matter here.
-  if (!destination_addr.ok()) {
-    VLOG(2) << "Could not parse \"" << host
-            << "\" as socket address: " << destination_addr.status();
-    return nullptr;
-  }
-  const XdsListenerResource::FilterChainMap::DestinationIp* best_match =
-      nullptr;
-  for (const auto& entry : destination_ip_vector) {
-    // Special case for catch-all
-    if (!entry.prefix_range.has_value()) {
-      if (best_match == nullptr) {
-        best_match = &entry;
-      }
-      continue;
-    }
-    if (best_match != nullptr && best_match->prefix_range.has_value() &&
-        best_match->prefix_range->prefix_len >=
-            entry.prefix_range->prefix_len) {
-      continue;
-    }
-    if (grpc_sockaddr_match_subnet(&*destination_addr,
-                                   &entry.prefix_range->address,
-                                   entry.prefix_range->prefix_len)) {
-      best_match = &entry;
-    }
-  }
-  if (best_match == nullptr) return nullptr;
-  return FindFilterChainDataForSourceType(best_match->source_types_array, tcp,
-                                          host);
+  return filter_chain_match_table.Find(
+      destination_addr, source_addr, source_port,
+      IsLoopbackIp(&source_addr) || source_host == destination_host);
 }
 
 absl::StatusOr<ChannelArgs> XdsServerConfigFetcher::ListenerWatcher::
     FilterChainMatchManager::UpdateChannelArgsForConnection(
         const ChannelArgs& input_args, grpc_endpoint* tcp) {
   ChannelArgs args = input_args;
-  const auto* filter_chain = FindFilterChainDataForDestinationIp(
-      filter_chain_map_.destination_ip_vector, tcp);
+  const auto* filter_chain =
+      FindFilterChainDataForConnection(filter_chain_match_table_, tcp);
   if (filter_chain == nullptr && default_filter_chain_.has_value()) {
     filter_chain = &default_filter_chain_.value();
   }
@@ -1142,7 +1062,11 @@ XdsServerConfigFetcher::ListenerWatcher::FilterChainMatchManager::
             ServiceConfigImpl::Create(result->args, json.c_str()).value();
       }
     }
+    virtual_host.compiled_routes.emplace(
+        VirtualHost::RouteListIterator(&virtual_host.routes));
   }
+  config_selector->compiled_virtual_hosts_.emplace(
+      VirtualHostListIterator(&config_selector->virtual_hosts_));
   return config_selector;
 }
 
@@ -1160,15 +1084,15 @@ XdsServerConfigFetcher::ListenerWatcher::FilterChainMatchManager::
   }
   absl::string_view authority =
       metadata->get_pointer(HttpAuthorityMetadata())->as_string_view();
-  auto vhost_index = XdsRouting::FindVirtualHostForDomain(
-      VirtualHostListIterator(&virtual_hosts_), authority);
+  auto vhost_index =
+      compiled_virtual_hosts_->FindVirtualHostForDomain(authority);
   if (!vhost_index.has_value()) {
     return absl::UnavailableError(
         absl::StrCat("could not find VirtualHost for ", authority,
                      " in RouteConfiguration"));
   }
   auto& virtual_host = virtual_hosts_[vhost_index.value()];
-  auto route_index = XdsRouting::GetRouteForRequest(
+  auto route_index = virtual_host.compiled_routes->GetRouteForRequest(
       VirtualHost::RouteListIterator(&virtual_host.routes), path, metadata);
   if (route_index.has_value()) {
     auto& route = virtual_host.routes[route_index.value()];
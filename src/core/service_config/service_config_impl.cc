@@ -17,16 +17,19 @@
 #include "src/core/service_config/service_config_impl.h"
 
 #include <grpc/support/port_platform.h>
-#include <string.h>
 
 #include <optional>
 #include <string>
 #include <utility>
 
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
 #include "src/core/config/core_configuration.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/slice/slice.h"
 #include "src/core/lib/slice/slice_internal.h"
 #include "src/core/service_config/service_config_parser.h"
@@ -35,7 +38,8 @@
 #include "src/core/util/json/json_object_loader.h"
 #include "src/core/util/json/json_reader.h"
 #include "src/core/util/json/json_writer.h"
-#include "src/core/util/memory.h"
+#include "src/core/util/no_destruct.h"
+#include "src/core/util/sync.h"
 #include "src/core/util/validation_errors.h"
 
 namespace grpc_core {
@@ -78,10 +82,68 @@ struct MethodConfig {
   }
 };
 
+// The service configs that are shared between channels, keyed by their
+// parser channel args and JSON string. The keys point into the service
+// configs themselves, which remove their entries when destroyed.
+struct SharedServiceConfigs {
+  using Key = std::pair<absl::string_view, absl::string_view>;
+
+  Mutex mu;
+  absl::flat_hash_map<Key, ServiceConfig*> map ABSL_GUARDED_BY(mu);
+};
+
+SharedServiceConfigs* GetSharedServiceConfigs() {
+  static NoDestruct<SharedServiceConfigs> shared_service_configs;
+  return shared_service_configs.get();
+}
+
 }  // namespace
 
+absl::StatusOr<RefCountedPtr<ServiceConfig>> ServiceConfigImpl::CreateShared(
+    const ChannelArgs& args, absl::string_view json_string) {
+  const ChannelArgs parser_args =
+      CoreConfiguration::Get().service_config_parser().ParserChannelArgs(args);
+  std::string args_key = parser_args.ToString();
+  SharedServiceConfigs* shared = GetSharedServiceConfigs();
+  {
+    MutexLock lock(&shared->mu);
+    auto it = shared->map.find({args_key, json_string});
+    // The service config may be in the process of being destroyed, in which
+    // case it cannot be shared any longer.
+    if (it != shared->map.end()) {
+      auto service_config = it->second->RefIfNonZero();
+      if (service_config != nullptr) return service_config;
+    }
+  }
+  auto json = JsonParse(json_string);
+  if (!json.ok()) return json.status();
+  ValidationErrors errors;
+  auto service_config = Create(parser_args, *json, json_string, &errors);
+  if (!errors.ok()) {
+    return errors.status(absl::StatusCode::kInvalidArgument,
+                         "errors validating service config");
+  }
+  auto* impl = static_cast<ServiceConfigImpl*>(service_config.get());
+  MutexLock lock(&shared->mu);
+  auto it = shared->map.find({args_key, json_string});
+  if (it != shared->map.end()) {
+    // Another channel created the same service config in the meantime.
+    auto existing = it->second->RefIfNonZero();
+    if (existing != nullptr) return existing;
+    // The key points into the service config being destroyed, so it must
+    // be replaced along with the value.
+    shared->map.erase(it);
+  }
+  impl->shared_args_key_ = std::move(args_key);
+  shared->map.emplace(
+      SharedServiceConfigs::Key(*impl->shared_args_key_, impl->json_string_),
+      impl);
+  return service_config;
+}
+
 absl::StatusOr<RefCountedPtr<ServiceConfig>> ServiceConfigImpl::Create(
     const ChannelArgs& args, absl::string_view json_string) {
+  if (IsSharedServiceConfigsEnabled()) return CreateShared(args, json_string);
   auto json = JsonParse(json_string);
   if (!json.ok()) return json.status();
   ValidationErrors errors;
@@ -167,6 +229,14 @@ RefCountedPtr<ServiceConfig> ServiceConfigImpl::Create(
 }
 
 ServiceConfigImpl::~ServiceConfigImpl() {
+  if (shared_args_key_.has_value()) {
+    SharedServiceConfigs* shared = GetSharedServiceConfigs();
+    MutexLock lock(&shared->mu);
+    auto it = shared->map.find({*shared_args_key_, json_string_});
+    if (it != shared->map.end() && it->second == this) {
+      shared->map.erase(it);
+    }
+  }
   for (auto& p : parsed_method_configs_map_) {
     CSliceUnref(p.first);
   }
@@ -181,12 +251,13 @@ ServiceConfigImpl::GetMethodParsedConfigVector(const grpc_slice& path) const {
   auto it = parsed_method_configs_map_.find(path);
   if (it != parsed_method_configs_map_.end()) return it->second;
   // If we didn't find a match for the path, try looking for a wildcard
-  // entry (i.e., change "/service/method" to "/service/").
-  UniquePtr<char> path_str(grpc_slice_to_c_string(path));
-  char* sep = strrchr(path_str.get(), '/');
-  if (sep == nullptr) return nullptr;  // Shouldn't ever happen.
-  sep[1] = '\0';
-  grpc_slice wildcard_path = grpc_slice_from_static_string(path_str.get());
+  // entry (i.e., change "/service/method" to "/service/").  The wildcard
+  // path is a prefix of the path, so look it up without copying it.
+  absl::string_view path_str = StringViewFromSlice(path);
+  size_t sep = path_str.rfind('/');
+  if (sep == absl::string_view::npos) return nullptr;  // Shouldn't ever happen.
+  grpc_slice wildcard_path =
+      grpc_slice_from_static_buffer(path_str.data(), sep + 1);
   it = parsed_method_configs_map_.find(wildcard_path);
   if (it != parsed_method_configs_map_.end()) return it->second;
   // Try default method config, if set.
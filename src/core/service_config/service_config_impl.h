@@ -22,6 +22,7 @@
 #include <stddef.h>
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -98,8 +99,17 @@ class ServiceConfigImpl final : public ServiceConfig {
       const grpc_slice& path) const override;
 
  private:
+  // Creates the service config, or returns an existing one created from the
+  // same JSON string for channels whose args the parsers read have the same
+  // values.
+  static absl::StatusOr<RefCountedPtr<ServiceConfig>> CreateShared(
+      const ChannelArgs& args, absl::string_view json_string);
+
   std::string json_string_;
   Json json_;
+  // If the service config is shared, the parser channel args it was created
+  // with, which identify it together with the JSON string.
+  std::optional<std::string> shared_args_key_;
 
   ServiceConfigParser::ParsedConfigVector parsed_global_configs_;
   // A map from the method name to the parsed config vector. Note that we are
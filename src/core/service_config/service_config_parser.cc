@@ -19,6 +19,7 @@
 #include <grpc/support/port_platform.h>
 #include <stdlib.h>
 
+#include <optional>
 #include <string>
 
 #include "absl/log/log.h"
@@ -66,6 +67,18 @@ ServiceConfigParser::ParsePerMethodParameters(const ChannelArgs& args,
   return parsed_method_configs;
 }
 
+ChannelArgs ServiceConfigParser::ParserChannelArgs(
+    const ChannelArgs& args) const {
+  ChannelArgs parser_args;
+  for (auto& parser : registered_parsers_) {
+    for (absl::string_view key : parser->ChannelArgKeys()) {
+      std::optional<int> value = args.GetInt(key);
+      if (value.has_value()) parser_args = parser_args.Set(key, *value);
+    }
+  }
+  return parser_args;
+}
+
 size_t ServiceConfigParser::GetParserIndex(absl::string_view name) const {
   for (size_t i = 0; i < registered_parsers_.size(); ++i) {
     if (registered_parsers_[i]->name() == name) return i;
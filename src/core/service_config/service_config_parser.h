@@ -61,6 +61,14 @@ class ServiceConfigParser {
         ValidationErrors* /*errors*/) {
       return nullptr;
     }
+
+    /// Returns the names of the integer or boolean channel args that the
+    /// parser reads. Channels whose values of these args match may share
+    /// service configs parsed from the same JSON, and shared service configs
+    /// are parsed with only these args.
+    virtual std::vector<absl::string_view> ChannelArgKeys() const {
+      return {};
+    }
   };
 
   using ServiceConfigParserList = std::vector<std::unique_ptr<Parser>>;
@@ -88,6 +96,10 @@ class ServiceConfigParser {
                                               const Json& json,
                                               ValidationErrors* errors) const;
 
+  // Returns the args in \a args that the registered parsers read (see
+  // Parser::ChannelArgKeys()).
+  ChannelArgs ParserChannelArgs(const ChannelArgs& args) const;
+
   // Return the index for a given registered parser.
   // If there is an error, return -1.
   size_t GetParserIndex(absl::string_view name) const;
@@ -394,10 +394,18 @@ const absl::string_view
         "rq_connections_dropped",
         "rq_calls_dropped",
         "rq_calls_rejected",
+        "server_calls_shed",
+        "call_log_entries_dropped",
         "syscall_write",
         "syscall_read",
         "tcp_read_alloc_8k",
         "tcp_read_alloc_64k",
+        "tcp_zerocopy_sent",
+        "tcp_zerocopy_copied",
+        "tcp_zerocopy_record_unavailable",
+        "unix_socket_memfd_writes",
+        "unix_socket_memfd_reads",
+        "tcp_socket_buffer_resizes",
         "http2_settings_writes",
         "http2_pings_sent",
         "http2_writes_begun",
@@ -405,12 +413,15 @@ const absl::string_view
         "http2_stream_stalls",
         "http2_hpack_hits",
         "http2_hpack_misses",
+        "http2_idle_transports_compacted",
         "cq_pluck_creates",
         "cq_next_creates",
         "cq_callback_creates",
         "wrr_updates",
         "work_serializer_items_enqueued",
         "work_serializer_items_dequeued",
+        "combiner_closures_run",
+        "combiner_offloads",
         "econnaborted_count",
         "econnreset_count",
         "epipe_count",
@@ -422,6 +433,11 @@ const absl::string_view
         "enobufs_count",
         "uncommon_io_error_count",
         "msg_errqueue_error_count",
+        "ssl_server_full_handshakes",
+        "ssl_server_resumed_handshakes",
+        "security_handshakes_shed",
+        "ssl_verified_chain_cache_hits",
+        "ssl_verified_chain_cache_misses",
 };
 const absl::string_view GlobalStats::counter_doc[static_cast<int>(
     Counter::COUNT)] = {
@@ -434,11 +450,21 @@ const absl::string_view GlobalStats::counter_doc[static_cast<int>(
     "Number of connections dropped due to resource quota exceeded",
     "Number of calls dropped due to resource quota exceeded",
     "Number of calls rejected (never started) due to resource quota exceeded",
+    "Number of calls rejected by a server because of sustained queueing delay",
+    "Number of call logging entries dropped because the log buffer was full",
     "Number of write syscalls (or equivalent - eg sendmsg) made by this "
     "process",
     "Number of read syscalls (or equivalent - eg recvmsg) made by this process",
     "Number of 8k allocations by the TCP subsystem for reading",
     "Number of 64k allocations by the TCP subsystem for reading",
+    "Number of sendmsg calls with MSG_ZEROCOPY that the kernel completed",
+    "Number of sendmsg calls with MSG_ZEROCOPY for which the kernel reported "
+    "that it copied the data anyway",
+    "Number of writes large enough for zerocopy that were copied because no "
+    "zerocopy send record was free",
+    "Number of unix domain socket writes passed to the peer as a sealed memfd",
+    "Number of sealed memfds received from the peer of a unix domain socket",
+    "Number of times an endpoint resized its socket receive buffer",
     "Number of settings frames sent",
     "Number of HTTP2 pings sent by process",
     "Number of HTTP2 writes initiated",
@@ -448,6 +474,7 @@ const absl::string_view GlobalStats::counter_doc[static_cast<int>(
     "window",
     "Number of HPACK cache hits",
     "Number of HPACK cache misses (entries added but never used)",
+    "Number of times memory pressure compacted an idle HTTP/2 transport",
     "Number of completion queues created for cq_pluck (indicates sync api "
     "usage)",
     "Number of completion queues created for cq_next (indicates cq async api "
@@ -457,6 +484,8 @@ const absl::string_view GlobalStats::counter_doc[static_cast<int>(
     "Number of wrr updates that have been received",
     "Number of items enqueued onto work serializers",
     "Number of items dequeued from work serializers",
+    "Number of closures run by combiners",
+    "Number of times a combiner moved its remaining work to the EventEngine",
     "Number of ECONNABORTED errors",
     "Number of ECONNRESET errors",
     "Number of EPIPE errors",
@@ -468,6 +497,13 @@ const absl::string_view GlobalStats::counter_doc[static_cast<int>(
     "Number of ENOBUFS errors",
     "Number of uncommon io errors",
     "Number of uncommon errors returned by MSG_ERRQUEUE",
+    "Number of TLS handshakes completed by servers without resuming a session",
+    "Number of TLS handshakes completed by servers by resuming a session",
+    "Number of security handshakes refused because the handshake offload queue "
+    "was full",
+    "Number of TLS peer certificate chains found in the verified chain cache",
+    "Number of TLS peer certificate chains not found in the verified chain "
+    "cache, and so verified again",
 };
 const absl::string_view
     GlobalStats::histogram_name[static_cast<int>(Histogram::COUNT)] = {
@@ -477,9 +513,12 @@ const absl::string_view
         "tcp_read_size",
         "tcp_read_offer",
         "tcp_read_offer_iov_size",
+        "tcp_read_batch_size",
+        "tcp_sendmsg_to_ack_us",
         "http2_send_message_size",
         "http2_metadata_size",
         "http2_hpack_entry_lifetime",
+        "http2_hpack_shared_value_size",
         "http2_header_table_size",
         "http2_initial_window_size",
         "http2_max_concurrent_streams",
@@ -491,14 +530,20 @@ const absl::string_view
         "http2_transport_window_update_period",
         "http2_stream_window_update_period",
         "http2_write_target_size",
+        "http2_write_coalesced_initiations",
         "http2_write_data_frame_size",
         "http2_read_data_frame_size",
+        "http2_received_message_copied_bytes",
+        "http2_write_queue_delay_us",
+        "http2_endpoint_write_time_us",
         "wrr_subchannel_list_size",
         "wrr_subchannel_ready_size",
         "work_serializer_run_time_ms",
         "work_serializer_work_time_ms",
         "work_serializer_work_time_per_item_ms",
         "work_serializer_items_per_run",
+        "security_handshake_time_us",
+        "security_handshake_offload_queue_time_us",
         "chaotic_good_sendmsgs_per_write_control",
         "chaotic_good_recvmsgs_per_read_control",
         "chaotic_good_sendmsgs_per_write_data",
@@ -522,9 +567,15 @@ const absl::string_view GlobalStats::histogram_doc[static_cast<int>(
     "Number of bytes received by each syscall_read",
     "Number of bytes offered to each syscall_read",
     "Number of byte segments offered to each syscall_read",
+    "Number of syscall_reads made by each pass that reads a socket until it is "
+    "drained or the read buffer is full",
+    "Microseconds from a traced write being handed to sendmsg to the peer "
+    "acknowledging its last byte, as reported by SO_TIMESTAMPING",
     "Size of messages received by HTTP2 transport",
     "Number of bytes consumed by metadata, according to HPACK accounting rules",
     "Lifetime of HPACK entries in the cache (in milliseconds)",
+    "Size of values added to HPACK dynamic tables that shared a copy already "
+    "held by another connection, in bytes",
     "Http2 header table size received through SETTINGS frame",
     "Http2 initial window size received through SETTINGS frame",
     "Http2 max concurrent streams received through SETTINGS frame",
@@ -537,8 +588,15 @@ const absl::string_view GlobalStats::histogram_doc[static_cast<int>(
     "Period in milliseconds at which peer sends transport window update",
     "Period in milliseconds at which peer sends stream window update",
     "Number of bytes targetted for http2 writes",
+    "Number of write initiations coalesced into each HTTP2 write",
     "Number of bytes for each data frame written",
     "Number of bytes for each data frame read",
+    "Number of bytes copied (rather than referenced) while reassembling each "
+    "message received by the HTTP2 transport",
+    "Microseconds from a message being queued on an HTTP2 stream with no "
+    "unsent data to the transport write that starts sending it",
+    "Microseconds from an HTTP2 transport write being handed to the endpoint "
+    "to the endpoint finishing it",
     "Number of subchannels in a subchannel list at picker creation time",
     "Number of READY subchannels in a subchannel list at picker creation time",
     "Number of milliseconds work serializers run for",
@@ -546,6 +604,10 @@ const absl::string_view GlobalStats::histogram_doc[static_cast<int>(
     "work",
     "How long do individual items take to process in work serializers",
     "How many callbacks are executed when a work serializer runs",
+    "Microseconds from a security handshake starting to it finishing or "
+    "failing",
+    "Microseconds a security handshake step waited to be run on the "
+    "EventEngine",
     "Number of sendmsgs per control channel endpoint write",
     "Number of recvmsgs per control channel endpoint read",
     "Number of sendmsgs per data channel endpoint write",
@@ -571,10 +633,18 @@ GlobalStats::GlobalStats()
       rq_connections_dropped{0},
       rq_calls_dropped{0},
       rq_calls_rejected{0},
+      server_calls_shed{0},
+      call_log_entries_dropped{0},
       syscall_write{0},
       syscall_read{0},
       tcp_read_alloc_8k{0},
       tcp_read_alloc_64k{0},
+      tcp_zerocopy_sent{0},
+      tcp_zerocopy_copied{0},
+      tcp_zerocopy_record_unavailable{0},
+      unix_socket_memfd_writes{0},
+      unix_socket_memfd_reads{0},
+      tcp_socket_buffer_resizes{0},
       http2_settings_writes{0},
       http2_pings_sent{0},
       http2_writes_begun{0},
@@ -582,12 +652,15 @@ GlobalStats::GlobalStats()
       http2_stream_stalls{0},
       http2_hpack_hits{0},
       http2_hpack_misses{0},
+      http2_idle_transports_compacted{0},
       cq_pluck_creates{0},
       cq_next_creates{0},
       cq_callback_creates{0},
       wrr_updates{0},
       work_serializer_items_enqueued{0},
       work_serializer_items_dequeued{0},
+      combiner_closures_run{0},
+      combiner_offloads{0},
       econnaborted_count{0},
       econnreset_count{0},
       epipe_count{0},
@@ -598,7 +671,12 @@ GlobalStats::GlobalStats()
       enotconn_count{0},
       enobufs_count{0},
       uncommon_io_error_count{0},
-      msg_errqueue_error_count{0} {}
+      msg_errqueue_error_count{0},
+      ssl_server_full_handshakes{0},
+      ssl_server_resumed_handshakes{0},
+      security_handshakes_shed{0},
+      ssl_verified_chain_cache_hits{0},
+      ssl_verified_chain_cache_misses{0} {}
 HistogramView GlobalStats::histogram(Histogram which) const {
   switch (which) {
     default:
@@ -621,6 +699,12 @@ HistogramView GlobalStats::histogram(Histogram which) const {
     case Histogram::kTcpReadOfferIovSize:
       return HistogramView{&Histogram_80_10_64::BucketFor, kStatsTable14, 10,
                            tcp_read_offer_iov_size.buckets()};
+    case Histogram::kTcpReadBatchSize:
+      return HistogramView{&Histogram_80_10_64::BucketFor, kStatsTable14, 10,
+                           tcp_read_batch_size.buckets()};
+    case Histogram::kTcpSendmsgToAckUs:
+      return HistogramView{&Histogram_1800000_40_64::BucketFor, kStatsTable16,
+                           40, tcp_sendmsg_to_ack_us.buckets()};
     case Histogram::kHttp2SendMessageSize:
       return HistogramView{&Histogram_16777216_20_64::BucketFor, kStatsTable0,
                            20, http2_send_message_size.buckets()};
@@ -630,6 +714,9 @@ HistogramView GlobalStats::histogram(Histogram which) const {
     case Histogram::kHttp2HpackEntryLifetime:
       return HistogramView{&Histogram_1800000_40_64::BucketFor, kStatsTable16,
                            40, http2_hpack_entry_lifetime.buckets()};
+    case Histogram::kHttp2HpackSharedValueSize:
+      return HistogramView{&Histogram_65536_26_64::BucketFor, kStatsTable6, 26,
+                           http2_hpack_shared_value_size.buckets()};
     case Histogram::kHttp2HeaderTableSize:
       return HistogramView{&Histogram_16777216_20_64::BucketFor, kStatsTable0,
                            20, http2_header_table_size.buckets()};
@@ -664,12 +751,24 @@ HistogramView GlobalStats::histogram(Histogram which) const {
     case Histogram::kHttp2WriteTargetSize:
       return HistogramView{&Histogram_16777216_50_64::BucketFor, kStatsTable12,
                            50, http2_write_target_size.buckets()};
+    case Histogram::kHttp2WriteCoalescedInitiations:
+      return HistogramView{&Histogram_100_20_64::BucketFor, kStatsTable10, 20,
+                           http2_write_coalesced_initiations.buckets()};
     case Histogram::kHttp2WriteDataFrameSize:
       return HistogramView{&Histogram_16777216_50_64::BucketFor, kStatsTable12,
                            50, http2_write_data_frame_size.buckets()};
     case Histogram::kHttp2ReadDataFrameSize:
       return HistogramView{&Histogram_16777216_50_64::BucketFor, kStatsTable12,
                            50, http2_read_data_frame_size.buckets()};
+    case Histogram::kHttp2ReceivedMessageCopiedBytes:
+      return HistogramView{&Histogram_65536_26_64::BucketFor, kStatsTable6, 26,
+                           http2_received_message_copied_bytes.buckets()};
+    case Histogram::kHttp2WriteQueueDelayUs:
+      return HistogramView{&Histogram_1800000_40_64::BucketFor, kStatsTable16,
+                           40, http2_write_queue_delay_us.buckets()};
+    case Histogram::kHttp2EndpointWriteTimeUs:
+      return HistogramView{&Histogram_1800000_40_64::BucketFor, kStatsTable16,
+                           40, http2_endpoint_write_time_us.buckets()};
     case Histogram::kWrrSubchannelListSize:
       return HistogramView{&Histogram_10000_20_64::BucketFor, kStatsTable4, 20,
                            wrr_subchannel_list_size.buckets()};
@@ -688,6 +787,13 @@ HistogramView GlobalStats::histogram(Histogram which) const {
     case Histogram::kWorkSerializerItemsPerRun:
       return HistogramView{&Histogram_10000_20_64::BucketFor, kStatsTable4, 20,
                            work_serializer_items_per_run.buckets()};
+    case Histogram::kSecurityHandshakeTimeUs:
+      return HistogramView{&Histogram_1800000_40_64::BucketFor, kStatsTable16,
+                           40, security_handshake_time_us.buckets()};
+    case Histogram::kSecurityHandshakeOffloadQueueTimeUs:
+      return HistogramView{&Histogram_1800000_40_64::BucketFor, kStatsTable16,
+                           40,
+                           security_handshake_offload_queue_time_us.buckets()};
     case Histogram::kChaoticGoodSendmsgsPerWriteControl:
       return HistogramView{&Histogram_100_20_64::BucketFor, kStatsTable10, 20,
                            chaotic_good_sendmsgs_per_write_control.buckets()};
@@ -771,12 +877,28 @@ std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
         data.rq_calls_dropped.load(std::memory_order_relaxed);
     result->rq_calls_rejected +=
         data.rq_calls_rejected.load(std::memory_order_relaxed);
+    result->server_calls_shed +=
+        data.server_calls_shed.load(std::memory_order_relaxed);
+    result->call_log_entries_dropped +=
+        data.call_log_entries_dropped.load(std::memory_order_relaxed);
     result->syscall_write += data.syscall_write.load(std::memory_order_relaxed);
     result->syscall_read += data.syscall_read.load(std::memory_order_relaxed);
     result->tcp_read_alloc_8k +=
         data.tcp_read_alloc_8k.load(std::memory_order_relaxed);
     result->tcp_read_alloc_64k +=
         data.tcp_read_alloc_64k.load(std::memory_order_relaxed);
+    result->tcp_zerocopy_sent +=
+        data.tcp_zerocopy_sent.load(std::memory_order_relaxed);
+    result->tcp_zerocopy_copied +=
+        data.tcp_zerocopy_copied.load(std::memory_order_relaxed);
+    result->tcp_zerocopy_record_unavailable +=
+        data.tcp_zerocopy_record_unavailable.load(std::memory_order_relaxed);
+    result->unix_socket_memfd_writes +=
+        data.unix_socket_memfd_writes.load(std::memory_order_relaxed);
+    result->unix_socket_memfd_reads +=
+        data.unix_socket_memfd_reads.load(std::memory_order_relaxed);
+    result->tcp_socket_buffer_resizes +=
+        data.tcp_socket_buffer_resizes.load(std::memory_order_relaxed);
     result->http2_settings_writes +=
         data.http2_settings_writes.load(std::memory_order_relaxed);
     result->http2_pings_sent +=
@@ -791,6 +913,8 @@ std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
         data.http2_hpack_hits.load(std::memory_order_relaxed);
     result->http2_hpack_misses +=
         data.http2_hpack_misses.load(std::memory_order_relaxed);
+    result->http2_idle_transports_compacted +=
+        data.http2_idle_transports_compacted.load(std::memory_order_relaxed);
     result->cq_pluck_creates +=
         data.cq_pluck_creates.load(std::memory_order_relaxed);
     result->cq_next_creates +=
@@ -802,6 +926,10 @@ std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
         data.work_serializer_items_enqueued.load(std::memory_order_relaxed);
     result->work_serializer_items_dequeued +=
         data.work_serializer_items_dequeued.load(std::memory_order_relaxed);
+    result->combiner_closures_run +=
+        data.combiner_closures_run.load(std::memory_order_relaxed);
+    result->combiner_offloads +=
+        data.combiner_offloads.load(std::memory_order_relaxed);
     result->econnaborted_count +=
         data.econnaborted_count.load(std::memory_order_relaxed);
     result->econnreset_count +=
@@ -821,16 +949,30 @@ std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
         data.uncommon_io_error_count.load(std::memory_order_relaxed);
     result->msg_errqueue_error_count +=
         data.msg_errqueue_error_count.load(std::memory_order_relaxed);
+    result->ssl_server_full_handshakes +=
+        data.ssl_server_full_handshakes.load(std::memory_order_relaxed);
+    result->ssl_server_resumed_handshakes +=
+        data.ssl_server_resumed_handshakes.load(std::memory_order_relaxed);
+    result->security_handshakes_shed +=
+        data.security_handshakes_shed.load(std::memory_order_relaxed);
+    result->ssl_verified_chain_cache_hits +=
+        data.ssl_verified_chain_cache_hits.load(std::memory_order_relaxed);
+    result->ssl_verified_chain_cache_misses +=
+        data.ssl_verified_chain_cache_misses.load(std::memory_order_relaxed);
     data.call_initial_size.Collect(&result->call_initial_size);
     data.tcp_write_size.Collect(&result->tcp_write_size);
     data.tcp_write_iov_size.Collect(&result->tcp_write_iov_size);
     data.tcp_read_size.Collect(&result->tcp_read_size);
     data.tcp_read_offer.Collect(&result->tcp_read_offer);
     data.tcp_read_offer_iov_size.Collect(&result->tcp_read_offer_iov_size);
+    data.tcp_read_batch_size.Collect(&result->tcp_read_batch_size);
+    data.tcp_sendmsg_to_ack_us.Collect(&result->tcp_sendmsg_to_ack_us);
     data.http2_send_message_size.Collect(&result->http2_send_message_size);
     data.http2_metadata_size.Collect(&result->http2_metadata_size);
     data.http2_hpack_entry_lifetime.Collect(
         &result->http2_hpack_entry_lifetime);
+    data.http2_hpack_shared_value_size.Collect(
+        &result->http2_hpack_shared_value_size);
     data.http2_header_table_size.Collect(&result->http2_header_table_size);
     data.http2_initial_window_size.Collect(&result->http2_initial_window_size);
     data.http2_max_concurrent_streams.Collect(
@@ -849,10 +991,18 @@ std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
     data.http2_stream_window_update_period.Collect(
         &result->http2_stream_window_update_period);
     data.http2_write_target_size.Collect(&result->http2_write_target_size);
+    data.http2_write_coalesced_initiations.Collect(
+        &result->http2_write_coalesced_initiations);
     data.http2_write_data_frame_size.Collect(
         &result->http2_write_data_frame_size);
     data.http2_read_data_frame_size.Collect(
         &result->http2_read_data_frame_size);
+    data.http2_received_message_copied_bytes.Collect(
+        &result->http2_received_message_copied_bytes);
+    data.http2_write_queue_delay_us.Collect(
+        &result->http2_write_queue_delay_us);
+    data.http2_endpoint_write_time_us.Collect(
+        &result->http2_endpoint_write_time_us);
     data.wrr_subchannel_list_size.Collect(&result->wrr_subchannel_list_size);
     data.wrr_subchannel_ready_size.Collect(&result->wrr_subchannel_ready_size);
     data.work_serializer_run_time_ms.Collect(
@@ -863,6 +1013,10 @@ std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
         &result->work_serializer_work_time_per_item_ms);
     data.work_serializer_items_per_run.Collect(
         &result->work_serializer_items_per_run);
+    data.security_handshake_time_us.Collect(
+        &result->security_handshake_time_us);
+    data.security_handshake_offload_queue_time_us.Collect(
+        &result->security_handshake_offload_queue_time_us);
     data.chaotic_good_sendmsgs_per_write_control.Collect(
         &result->chaotic_good_sendmsgs_per_write_control);
     data.chaotic_good_recvmsgs_per_read_control.Collect(
@@ -912,10 +1066,23 @@ std::unique_ptr<GlobalStats> GlobalStats::Diff(const GlobalStats& other) const {
       rq_connections_dropped - other.rq_connections_dropped;
   result->rq_calls_dropped = rq_calls_dropped - other.rq_calls_dropped;
   result->rq_calls_rejected = rq_calls_rejected - other.rq_calls_rejected;
+  result->server_calls_shed = server_calls_shed - other.server_calls_shed;
+  result->call_log_entries_dropped =
+      call_log_entries_dropped - other.call_log_entries_dropped;
   result->syscall_write = syscall_write - other.syscall_write;
   result->syscall_read = syscall_read - other.syscall_read;
   result->tcp_read_alloc_8k = tcp_read_alloc_8k - other.tcp_read_alloc_8k;
   result->tcp_read_alloc_64k = tcp_read_alloc_64k - other.tcp_read_alloc_64k;
+  result->tcp_zerocopy_sent = tcp_zerocopy_sent - other.tcp_zerocopy_sent;
+  result->tcp_zerocopy_copied = tcp_zerocopy_copied - other.tcp_zerocopy_copied;
+  result->tcp_zerocopy_record_unavailable =
+      tcp_zerocopy_record_unavailable - other.tcp_zerocopy_record_unavailable;
+  result->unix_socket_memfd_writes =
+      unix_socket_memfd_writes - other.unix_socket_memfd_writes;
+  result->unix_socket_memfd_reads =
+      unix_socket_memfd_reads - other.unix_socket_memfd_reads;
+  result->tcp_socket_buffer_resizes =
+      tcp_socket_buffer_resizes - other.tcp_socket_buffer_resizes;
   result->http2_settings_writes =
       http2_settings_writes - other.http2_settings_writes;
   result->http2_pings_sent = http2_pings_sent - other.http2_pings_sent;
@@ -925,6 +1092,8 @@ std::unique_ptr<GlobalStats> GlobalStats::Diff(const GlobalStats& other) const {
   result->http2_stream_stalls = http2_stream_stalls - other.http2_stream_stalls;
   result->http2_hpack_hits = http2_hpack_hits - other.http2_hpack_hits;
   result->http2_hpack_misses = http2_hpack_misses - other.http2_hpack_misses;
+  result->http2_idle_transports_compacted =
+      http2_idle_transports_compacted - other.http2_idle_transports_compacted;
   result->cq_pluck_creates = cq_pluck_creates - other.cq_pluck_creates;
   result->cq_next_creates = cq_next_creates - other.cq_next_creates;
   result->cq_callback_creates = cq_callback_creates - other.cq_callback_creates;
@@ -933,6 +1102,9 @@ std::unique_ptr<GlobalStats> GlobalStats::Diff(const GlobalStats& other) const {
       work_serializer_items_enqueued - other.work_serializer_items_enqueued;
   result->work_serializer_items_dequeued =
       work_serializer_items_dequeued - other.work_serializer_items_dequeued;
+  result->combiner_closures_run =
+      combiner_closures_run - other.combiner_closures_run;
+  result->combiner_offloads = combiner_offloads - other.combiner_offloads;
   result->econnaborted_count = econnaborted_count - other.econnaborted_count;
   result->econnreset_count = econnreset_count - other.econnreset_count;
   result->epipe_count = epipe_count - other.epipe_count;
@@ -946,6 +1118,16 @@ std::unique_ptr<GlobalStats> GlobalStats::Diff(const GlobalStats& other) const {
       uncommon_io_error_count - other.uncommon_io_error_count;
   result->msg_errqueue_error_count =
       msg_errqueue_error_count - other.msg_errqueue_error_count;
+  result->ssl_server_full_handshakes =
+      ssl_server_full_handshakes - other.ssl_server_full_handshakes;
+  result->ssl_server_resumed_handshakes =
+      ssl_server_resumed_handshakes - other.ssl_server_resumed_handshakes;
+  result->security_handshakes_shed =
+      security_handshakes_shed - other.security_handshakes_shed;
+  result->ssl_verified_chain_cache_hits =
+      ssl_verified_chain_cache_hits - other.ssl_verified_chain_cache_hits;
+  result->ssl_verified_chain_cache_misses =
+      ssl_verified_chain_cache_misses - other.ssl_verified_chain_cache_misses;
   result->call_initial_size = call_initial_size - other.call_initial_size;
   result->tcp_write_size = tcp_write_size - other.tcp_write_size;
   result->tcp_write_iov_size = tcp_write_iov_size - other.tcp_write_iov_size;
@@ -953,11 +1135,17 @@ std::unique_ptr<GlobalStats> GlobalStats::Diff(const GlobalStats& other) const {
   result->tcp_read_offer = tcp_read_offer - other.tcp_read_offer;
   result->tcp_read_offer_iov_size =
       tcp_read_offer_iov_size - other.tcp_read_offer_iov_size;
+  result->tcp_read_batch_size =
+      tcp_read_batch_size - other.tcp_read_batch_size;
+  result->tcp_sendmsg_to_ack_us =
+      tcp_sendmsg_to_ack_us - other.tcp_sendmsg_to_ack_us;
   result->http2_send_message_size =
       http2_send_message_size - other.http2_send_message_size;
   result->http2_metadata_size = http2_metadata_size - other.http2_metadata_size;
   result->http2_hpack_entry_lifetime =
       http2_hpack_entry_lifetime - other.http2_hpack_entry_lifetime;
+  result->http2_hpack_shared_value_size =
+      http2_hpack_shared_value_size - other.http2_hpack_shared_value_size;
   result->http2_header_table_size =
       http2_header_table_size - other.http2_header_table_size;
   result->http2_initial_window_size =
@@ -985,10 +1173,20 @@ std::unique_ptr<GlobalStats> GlobalStats::Diff(const GlobalStats& other) const {
       other.http2_stream_window_update_period;
   result->http2_write_target_size =
       http2_write_target_size - other.http2_write_target_size;
+  result->http2_write_coalesced_initiations =
+      http2_write_coalesced_initiations -
+      other.http2_write_coalesced_initiations;
   result->http2_write_data_frame_size =
       http2_write_data_frame_size - other.http2_write_data_frame_size;
   result->http2_read_data_frame_size =
       http2_read_data_frame_size - other.http2_read_data_frame_size;
+  result->http2_received_message_copied_bytes =
+      http2_received_message_copied_bytes -
+      other.http2_received_message_copied_bytes;
+  result->http2_write_queue_delay_us =
+      http2_write_queue_delay_us - other.http2_write_queue_delay_us;
+  result->http2_endpoint_write_time_us =
+      http2_endpoint_write_time_us - other.http2_endpoint_write_time_us;
   result->wrr_subchannel_list_size =
       wrr_subchannel_list_size - other.wrr_subchannel_list_size;
   result->wrr_subchannel_ready_size =
@@ -1002,6 +1200,11 @@ std::unique_ptr<GlobalStats> GlobalStats::Diff(const GlobalStats& other) const {
       other.work_serializer_work_time_per_item_ms;
   result->work_serializer_items_per_run =
       work_serializer_items_per_run - other.work_serializer_items_per_run;
+  result->security_handshake_time_us =
+      security_handshake_time_us - other.security_handshake_time_us;
+  result->security_handshake_offload_queue_time_us =
+      security_handshake_offload_queue_time_us -
+      other.security_handshake_offload_queue_time_us;
   result->chaotic_good_sendmsgs_per_write_control =
       chaotic_good_sendmsgs_per_write_control -
       other.chaotic_good_sendmsgs_per_write_control;
@@ -279,10 +279,18 @@ struct GlobalStats {
     kRqConnectionsDropped,
     kRqCallsDropped,
     kRqCallsRejected,
+    kServerCallsShed,
+    kCallLogEntriesDropped,
     kSyscallWrite,
     kSyscallRead,
     kTcpReadAlloc8k,
     kTcpReadAlloc64k,
+    kTcpZerocopySent,
+    kTcpZerocopyCopied,
+    kTcpZerocopyRecordUnavailable,
+    kUnixSocketMemfdWrites,
+    kUnixSocketMemfdReads,
+    kTcpSocketBufferResizes,
     kHttp2SettingsWrites,
     kHttp2PingsSent,
     kHttp2WritesBegun,
@@ -290,12 +298,15 @@ struct GlobalStats {
     kHttp2StreamStalls,
     kHttp2HpackHits,
     kHttp2HpackMisses,
+    kHttp2IdleTransportsCompacted,
     kCqPluckCreates,
     kCqNextCreates,
     kCqCallbackCreates,
     kWrrUpdates,
     kWorkSerializerItemsEnqueued,
     kWorkSerializerItemsDequeued,
+    kCombinerClosuresRun,
+    kCombinerOffloads,
     kEconnabortedCount,
     kEconnresetCount,
     kEpipeCount,
@@ -307,6 +318,11 @@ struct GlobalStats {
     kEnobufsCount,
     kUncommonIoErrorCount,
     kMsgErrqueueErrorCount,
+    kSslServerFullHandshakes,
+    kSslServerResumedHandshakes,
+    kSecurityHandshakesShed,
+    kSslVerifiedChainCacheHits,
+    kSslVerifiedChainCacheMisses,
     COUNT
   };
   enum class Histogram {
@@ -316,9 +332,12 @@ struct GlobalStats {
     kTcpReadSize,
     kTcpReadOffer,
     kTcpReadOfferIovSize,
+    kTcpReadBatchSize,
+    kTcpSendmsgToAckUs,
     kHttp2SendMessageSize,
     kHttp2MetadataSize,
     kHttp2HpackEntryLifetime,
+    kHttp2HpackSharedValueSize,
     kHttp2HeaderTableSize,
     kHttp2InitialWindowSize,
     kHttp2MaxConcurrentStreams,
@@ -330,14 +349,20 @@ struct GlobalStats {
     kHttp2TransportWindowUpdatePeriod,
     kHttp2StreamWindowUpdatePeriod,
     kHttp2WriteTargetSize,
+    kHttp2WriteCoalescedInitiations,
     kHttp2WriteDataFrameSize,
     kHttp2ReadDataFrameSize,
+    kHttp2ReceivedMessageCopiedBytes,
+    kHttp2WriteQueueDelayUs,
+    kHttp2EndpointWriteTimeUs,
     kWrrSubchannelListSize,
     kWrrSubchannelReadySize,
     kWorkSerializerRunTimeMs,
     kWorkSerializerWorkTimeMs,
     kWorkSerializerWorkTimePerItemMs,
     kWorkSerializerItemsPerRun,
+    kSecurityHandshakeTimeUs,
+    kSecurityHandshakeOffloadQueueTimeUs,
     kChaoticGoodSendmsgsPerWriteControl,
     kChaoticGoodRecvmsgsPerReadControl,
     kChaoticGoodSendmsgsPerWriteData,
@@ -372,10 +397,18 @@ struct GlobalStats {
       uint64_t rq_connections_dropped;
       uint64_t rq_calls_dropped;
       uint64_t rq_calls_rejected;
+      uint64_t server_calls_shed;
+      uint64_t call_log_entries_dropped;
       uint64_t syscall_write;
       uint64_t syscall_read;
       uint64_t tcp_read_alloc_8k;
       uint64_t tcp_read_alloc_64k;
+      uint64_t tcp_zerocopy_sent;
+      uint64_t tcp_zerocopy_copied;
+      uint64_t tcp_zerocopy_record_unavailable;
+      uint64_t unix_socket_memfd_writes;
+      uint64_t unix_socket_memfd_reads;
+      uint64_t tcp_socket_buffer_resizes;
       uint64_t http2_settings_writes;
       uint64_t http2_pings_sent;
       uint64_t http2_writes_begun;
@@ -383,12 +416,15 @@ struct GlobalStats {
       uint64_t http2_stream_stalls;
       uint64_t http2_hpack_hits;
       uint64_t http2_hpack_misses;
+      uint64_t http2_idle_transports_compacted;
       uint64_t cq_pluck_creates;
       uint64_t cq_next_creates;
       uint64_t cq_callback_creates;
       uint64_t wrr_updates;
       uint64_t work_serializer_items_enqueued;
       uint64_t work_serializer_items_dequeued;
+      uint64_t combiner_closures_run;
+      uint64_t combiner_offloads;
       uint64_t econnaborted_count;
       uint64_t econnreset_count;
       uint64_t epipe_count;
@@ -400,6 +436,11 @@ struct GlobalStats {
       uint64_t enobufs_count;
       uint64_t uncommon_io_error_count;
       uint64_t msg_errqueue_error_count;
+      uint64_t ssl_server_full_handshakes;
+      uint64_t ssl_server_resumed_handshakes;
+      uint64_t security_handshakes_shed;
+      uint64_t ssl_verified_chain_cache_hits;
+      uint64_t ssl_verified_chain_cache_misses;
     };
     uint64_t counters[static_cast<int>(Counter::COUNT)];
   };
@@ -409,9 +450,12 @@ struct GlobalStats {
   Histogram_16777216_20_64 tcp_read_size;
   Histogram_16777216_20_64 tcp_read_offer;
   Histogram_80_10_64 tcp_read_offer_iov_size;
+  Histogram_80_10_64 tcp_read_batch_size;
+  Histogram_1800000_40_64 tcp_sendmsg_to_ack_us;
   Histogram_16777216_20_64 http2_send_message_size;
   Histogram_65536_26_64 http2_metadata_size;
   Histogram_1800000_40_64 http2_hpack_entry_lifetime;
+  Histogram_65536_26_64 http2_hpack_shared_value_size;
   Histogram_16777216_20_64 http2_header_table_size;
   Histogram_16777216_50_64 http2_initial_window_size;
   Histogram_16777216_20_64 http2_max_concurrent_streams;
@@ -423,14 +467,20 @@ struct GlobalStats {
   Histogram_100000_20_64 http2_transport_window_update_period;
   Histogram_100000_20_64 http2_stream_window_update_period;
   Histogram_16777216_50_64 http2_write_target_size;
+  Histogram_100_20_64 http2_write_coalesced_initiations;
   Histogram_16777216_50_64 http2_write_data_frame_size;
   Histogram_16777216_50_64 http2_read_data_frame_size;
+  Histogram_65536_26_64 http2_received_message_copied_bytes;
+  Histogram_1800000_40_64 http2_write_queue_delay_us;
+  Histogram_1800000_40_64 http2_endpoint_write_time_us;
   Histogram_10000_20_64 wrr_subchannel_list_size;
   Histogram_10000_20_64 wrr_subchannel_ready_size;
   Histogram_100000_20_64 work_serializer_run_time_ms;
   Histogram_100000_20_64 work_serializer_work_time_ms;
   Histogram_100000_20_64 work_serializer_work_time_per_item_ms;
   Histogram_10000_20_64 work_serializer_items_per_run;
+  Histogram_1800000_40_64 security_handshake_time_us;
+  Histogram_1800000_40_64 security_handshake_offload_queue_time_us;
   Histogram_100_20_64 chaotic_good_sendmsgs_per_write_control;
   Histogram_100_20_64 chaotic_good_recvmsgs_per_read_control;
   Histogram_100_20_64 chaotic_good_sendmsgs_per_write_data;
@@ -485,6 +535,13 @@ class GlobalStatsCollector {
   void IncrementRqCallsRejected() {
     data_.this_cpu().rq_calls_rejected.fetch_add(1, std::memory_order_relaxed);
   }
+  void IncrementServerCallsShed() {
+    data_.this_cpu().server_calls_shed.fetch_add(1, std::memory_order_relaxed);
+  }
+  void IncrementCallLogEntriesDropped() {
+    data_.this_cpu().call_log_entries_dropped.fetch_add(
+        1, std::memory_order_relaxed);
+  }
   void IncrementSyscallWrite() {
     data_.this_cpu().syscall_write.fetch_add(1, std::memory_order_relaxed);
   }
@@ -497,6 +554,29 @@ class GlobalStatsCollector {
   void IncrementTcpReadAlloc64k() {
     data_.this_cpu().tcp_read_alloc_64k.fetch_add(1, std::memory_order_relaxed);
   }
+  void IncrementTcpZerocopySent() {
+    data_.this_cpu().tcp_zerocopy_sent.fetch_add(1, std::memory_order_relaxed);
+  }
+  void IncrementTcpZerocopyCopied() {
+    data_.this_cpu().tcp_zerocopy_copied.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementTcpZerocopyRecordUnavailable() {
+    data_.this_cpu().tcp_zerocopy_record_unavailable.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementUnixSocketMemfdWrites() {
+    data_.this_cpu().unix_socket_memfd_writes.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementUnixSocketMemfdReads() {
+    data_.this_cpu().unix_socket_memfd_reads.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementTcpSocketBufferResizes() {
+    data_.this_cpu().tcp_socket_buffer_resizes.fetch_add(
+        1, std::memory_order_relaxed);
+  }
   void IncrementHttp2SettingsWrites() {
     data_.this_cpu().http2_settings_writes.fetch_add(1,
                                                      std::memory_order_relaxed);
@@ -525,6 +605,10 @@ class GlobalStatsCollector {
   void IncrementHttp2HpackMisses() {
     data_.this_cpu().http2_hpack_misses.fetch_add(1, std::memory_order_relaxed);
   }
+  void IncrementHttp2IdleTransportsCompacted() {
+    data_.this_cpu().http2_idle_transports_compacted.fetch_add(
+        1, std::memory_order_relaxed);
+  }
   void IncrementCqPluckCreates() {
     data_.this_cpu().cq_pluck_creates.fetch_add(1, std::memory_order_relaxed);
   }
@@ -546,6 +630,13 @@ class GlobalStatsCollector {
     data_.this_cpu().work_serializer_items_dequeued.fetch_add(
         1, std::memory_order_relaxed);
   }
+  void IncrementCombinerClosuresRun() {
+    data_.this_cpu().combiner_closures_run.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementCombinerOffloads() {
+    data_.this_cpu().combiner_offloads.fetch_add(1, std::memory_order_relaxed);
+  }
   void IncrementEconnabortedCount() {
     data_.this_cpu().econnaborted_count.fetch_add(1, std::memory_order_relaxed);
   }
@@ -581,6 +672,26 @@ class GlobalStatsCollector {
     data_.this_cpu().msg_errqueue_error_count.fetch_add(
         1, std::memory_order_relaxed);
   }
+  void IncrementSslServerFullHandshakes() {
+    data_.this_cpu().ssl_server_full_handshakes.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementSslServerResumedHandshakes() {
+    data_.this_cpu().ssl_server_resumed_handshakes.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementSecurityHandshakesShed() {
+    data_.this_cpu().security_handshakes_shed.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementSslVerifiedChainCacheHits() {
+    data_.this_cpu().ssl_verified_chain_cache_hits.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementSslVerifiedChainCacheMisses() {
+    data_.this_cpu().ssl_verified_chain_cache_misses.fetch_add(
+        1, std::memory_order_relaxed);
+  }
   void IncrementCallInitialSize(int value) {
     data_.this_cpu().call_initial_size.Increment(value);
   }
@@ -599,6 +710,12 @@ class GlobalStatsCollector {
   void IncrementTcpReadOfferIovSize(int value) {
     data_.this_cpu().tcp_read_offer_iov_size.Increment(value);
   }
+  void IncrementTcpReadBatchSize(int value) {
+    data_.this_cpu().tcp_read_batch_size.Increment(value);
+  }
+  void IncrementTcpSendmsgToAckUs(int value) {
+    data_.this_cpu().tcp_sendmsg_to_ack_us.Increment(value);
+  }
   void IncrementHttp2SendMessageSize(int value) {
     data_.this_cpu().http2_send_message_size.Increment(value);
   }
@@ -608,6 +725,9 @@ class GlobalStatsCollector {
   void IncrementHttp2HpackEntryLifetime(int value) {
     data_.this_cpu().http2_hpack_entry_lifetime.Increment(value);
   }
+  void IncrementHttp2HpackSharedValueSize(int value) {
+    data_.this_cpu().http2_hpack_shared_value_size.Increment(value);
+  }
   void IncrementHttp2HeaderTableSize(int value) {
     data_.this_cpu().http2_header_table_size.Increment(value);
   }
@@ -646,12 +766,24 @@ class GlobalStatsCollector {
   }
 
  public:
+  void IncrementHttp2WriteCoalescedInitiations(int value) {
+    data_.this_cpu().http2_write_coalesced_initiations.Increment(value);
+  }
   void IncrementHttp2WriteDataFrameSize(int value) {
     data_.this_cpu().http2_write_data_frame_size.Increment(value);
   }
   void IncrementHttp2ReadDataFrameSize(int value) {
     data_.this_cpu().http2_read_data_frame_size.Increment(value);
   }
+  void IncrementHttp2ReceivedMessageCopiedBytes(int value) {
+    data_.this_cpu().http2_received_message_copied_bytes.Increment(value);
+  }
+  void IncrementHttp2WriteQueueDelayUs(int value) {
+    data_.this_cpu().http2_write_queue_delay_us.Increment(value);
+  }
+  void IncrementHttp2EndpointWriteTimeUs(int value) {
+    data_.this_cpu().http2_endpoint_write_time_us.Increment(value);
+  }
   void IncrementWrrSubchannelListSize(int value) {
     data_.this_cpu().wrr_subchannel_list_size.Increment(value);
   }
@@ -670,6 +802,12 @@ class GlobalStatsCollector {
   void IncrementWorkSerializerItemsPerRun(int value) {
     data_.this_cpu().work_serializer_items_per_run.Increment(value);
   }
+  void IncrementSecurityHandshakeTimeUs(int value) {
+    data_.this_cpu().security_handshake_time_us.Increment(value);
+  }
+  void IncrementSecurityHandshakeOffloadQueueTimeUs(int value) {
+    data_.this_cpu().security_handshake_offload_queue_time_us.Increment(value);
+  }
   void IncrementChaoticGoodSendmsgsPerWriteControl(int value) {
     data_.this_cpu().chaotic_good_sendmsgs_per_write_control.Increment(value);
   }
@@ -726,10 +864,18 @@ class GlobalStatsCollector {
     std::atomic<uint64_t> rq_connections_dropped{0};
     std::atomic<uint64_t> rq_calls_dropped{0};
     std::atomic<uint64_t> rq_calls_rejected{0};
+    std::atomic<uint64_t> server_calls_shed{0};
+    std::atomic<uint64_t> call_log_entries_dropped{0};
     std::atomic<uint64_t> syscall_write{0};
     std::atomic<uint64_t> syscall_read{0};
     std::atomic<uint64_t> tcp_read_alloc_8k{0};
     std::atomic<uint64_t> tcp_read_alloc_64k{0};
+    std::atomic<uint64_t> tcp_zerocopy_sent{0};
+    std::atomic<uint64_t> tcp_zerocopy_copied{0};
+    std::atomic<uint64_t> tcp_zerocopy_record_unavailable{0};
+    std::atomic<uint64_t> unix_socket_memfd_writes{0};
+    std::atomic<uint64_t> unix_socket_memfd_reads{0};
+    std::atomic<uint64_t> tcp_socket_buffer_resizes{0};
     std::atomic<uint64_t> http2_settings_writes{0};
     std::atomic<uint64_t> http2_pings_sent{0};
     std::atomic<uint64_t> http2_writes_begun{0};
@@ -737,12 +883,15 @@ class GlobalStatsCollector {
     std::atomic<uint64_t> http2_stream_stalls{0};
     std::atomic<uint64_t> http2_hpack_hits{0};
     std::atomic<uint64_t> http2_hpack_misses{0};
+    std::atomic<uint64_t> http2_idle_transports_compacted{0};
     std::atomic<uint64_t> cq_pluck_creates{0};
     std::atomic<uint64_t> cq_next_creates{0};
     std::atomic<uint64_t> cq_callback_creates{0};
     std::atomic<uint64_t> wrr_updates{0};
     std::atomic<uint64_t> work_serializer_items_enqueued{0};
     std::atomic<uint64_t> work_serializer_items_dequeued{0};
+    std::atomic<uint64_t> combiner_closures_run{0};
+    std::atomic<uint64_t> combiner_offloads{0};
     std::atomic<uint64_t> econnaborted_count{0};
     std::atomic<uint64_t> econnreset_count{0};
     std::atomic<uint64_t> epipe_count{0};
@@ -754,15 +903,23 @@ class GlobalStatsCollector {
     std::atomic<uint64_t> enobufs_count{0};
     std::atomic<uint64_t> uncommon_io_error_count{0};
     std::atomic<uint64_t> msg_errqueue_error_count{0};
+    std::atomic<uint64_t> ssl_server_full_handshakes{0};
+    std::atomic<uint64_t> ssl_server_resumed_handshakes{0};
+    std::atomic<uint64_t> security_handshakes_shed{0};
+    std::atomic<uint64_t> ssl_verified_chain_cache_hits{0};
+    std::atomic<uint64_t> ssl_verified_chain_cache_misses{0};
     HistogramCollector_65536_26_64 call_initial_size;
     HistogramCollector_16777216_20_64 tcp_write_size;
     HistogramCollector_80_10_64 tcp_write_iov_size;
     HistogramCollector_16777216_20_64 tcp_read_size;
     HistogramCollector_16777216_20_64 tcp_read_offer;
     HistogramCollector_80_10_64 tcp_read_offer_iov_size;
+    HistogramCollector_80_10_64 tcp_read_batch_size;
+    HistogramCollector_1800000_40_64 tcp_sendmsg_to_ack_us;
     HistogramCollector_16777216_20_64 http2_send_message_size;
     HistogramCollector_65536_26_64 http2_metadata_size;
     HistogramCollector_1800000_40_64 http2_hpack_entry_lifetime;
+    HistogramCollector_65536_26_64 http2_hpack_shared_value_size;
     HistogramCollector_16777216_20_64 http2_header_table_size;
     HistogramCollector_16777216_50_64 http2_initial_window_size;
     HistogramCollector_16777216_20_64 http2_max_concurrent_streams;
@@ -775,14 +932,20 @@ class GlobalStatsCollector {
     HistogramCollector_100000_20_64 http2_transport_window_update_period;
     HistogramCollector_100000_20_64 http2_stream_window_update_period;
     HistogramCollector_16777216_50_64 http2_write_target_size;
+    HistogramCollector_100_20_64 http2_write_coalesced_initiations;
     HistogramCollector_16777216_50_64 http2_write_data_frame_size;
     HistogramCollector_16777216_50_64 http2_read_data_frame_size;
+    HistogramCollector_65536_26_64 http2_received_message_copied_bytes;
+    HistogramCollector_1800000_40_64 http2_write_queue_delay_us;
+    HistogramCollector_1800000_40_64 http2_endpoint_write_time_us;
     HistogramCollector_10000_20_64 wrr_subchannel_list_size;
     HistogramCollector_10000_20_64 wrr_subchannel_ready_size;
     HistogramCollector_100000_20_64 work_serializer_run_time_ms;
     HistogramCollector_100000_20_64 work_serializer_work_time_ms;
     HistogramCollector_100000_20_64 work_serializer_work_time_per_item_ms;
     HistogramCollector_10000_20_64 work_serializer_items_per_run;
+    HistogramCollector_1800000_40_64 security_handshake_time_us;
+    HistogramCollector_1800000_40_64 security_handshake_offload_queue_time_us;
     HistogramCollector_100_20_64 chaotic_good_sendmsgs_per_write_control;
     HistogramCollector_100_20_64 chaotic_good_recvmsgs_per_read_control;
     HistogramCollector_100_20_64 chaotic_good_sendmsgs_per_write_data;
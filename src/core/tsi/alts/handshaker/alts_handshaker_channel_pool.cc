@@ -0,0 +1,109 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/tsi/alts/handshaker/alts_handshaker_channel_pool.h"
+
+#include <grpc/credentials.h>
+#include <grpc/impl/channel_arg_names.h>
+#include <grpc/support/cpu.h>
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+#include <optional>
+#include <utility>
+
+#include "absl/log/check.h"
+#include "absl/strings/numbers.h"
+#include "absl/strings/string_view.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/util/env.h"
+
+namespace grpc_core {
+
+namespace {
+
+constexpr absl::string_view kUseGrpcExperimentalAltsHandshakerKeepaliveParams =
+    "GRPC_EXPERIMENTAL_ALTS_HANDSHAKER_KEEPALIVE_PARAMS";
+
+// 10 seconds
+constexpr int kExperimentalKeepAliveTimeoutMs = 10 * 1000;
+// 10 minutes
+constexpr int kExperimentalKeepAliveTimeMs = 10 * 60 * 1000;
+
+constexpr char kChannelPoolSizeEnvironmentVariable[] =
+    "GRPC_ALTS_HANDSHAKER_CHANNEL_POOL_SIZE";
+constexpr size_t kMaxDefaultChannelPoolSize = 8;
+
+}  // namespace
+
+grpc_channel* AltsHandshakerChannelCreate(const char* handshaker_service_url,
+                                          bool own_connection) {
+  grpc_channel_credentials* creds = grpc_insecure_credentials_create();
+  // Disable retries so that we quickly get a signal when the
+  // handshake server is not reachable.
+  std::vector<grpc_arg> args_vec;
+  args_vec.push_back(grpc_channel_arg_integer_create(
+      const_cast<char*>(GRPC_ARG_ENABLE_RETRIES), 0));
+  if (own_connection) {
+    args_vec.push_back(grpc_channel_arg_integer_create(
+        const_cast<char*>(GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL), 1));
+  }
+  // TODO(gtcooke94) - Flag to try new values for ALTS keep alive settings,
+  // remove after trial
+  std::optional<std::string> env =
+      GetEnv(kUseGrpcExperimentalAltsHandshakerKeepaliveParams.data());
+  if (env.has_value() && (*env == "true")) {
+    args_vec.push_back(grpc_channel_arg_integer_create(
+        const_cast<char*>(GRPC_ARG_KEEPALIVE_TIMEOUT_MS),
+        kExperimentalKeepAliveTimeoutMs));
+    args_vec.push_back(grpc_channel_arg_integer_create(
+        const_cast<char*>(GRPC_ARG_KEEPALIVE_TIME_MS),
+        kExperimentalKeepAliveTimeMs));
+  }
+  grpc_channel_args args = {args_vec.size(), args_vec.data()};
+  grpc_channel* channel =
+      grpc_channel_create(handshaker_service_url, creds, &args);
+  grpc_channel_credentials_release(creds);
+  return channel;
+}
+
+AltsHandshakerChannelPool::AltsHandshakerChannelPool(
+    std::string handshaker_service_url, size_t size)
+    : handshaker_service_url_(std::move(handshaker_service_url)),
+      channels_(std::max<size_t>(size, 1)) {}
+
+size_t AltsHandshakerChannelPool::DefaultSize() {
+  std::optional<std::string> env =
+      GetEnv(kChannelPoolSizeEnvironmentVariable);
+  size_t size;
+  if (env.has_value() && absl::SimpleAtoi(*env, &size) && size > 0) {
+    return size;
+  }
+  return std::clamp<size_t>(gpr_cpu_num_cores(), 1,
+                            kMaxDefaultChannelPoolSize);
+}
+
+grpc_channel* AltsHandshakerChannelPool::GetChannel() {
+  MutexLock lock(&mu_);
+  RefCountedPtr<Channel>& channel =
+      channels_[next_++ % channels_.size()];
+  if (channel == nullptr) {
+    channel.reset(Channel::FromC(AltsHandshakerChannelCreate(
+        handshaker_service_url_.c_str(), /*own_connection=*/true)));
+    CHECK(channel != nullptr);
+  }
+  return channel->RefAsSubclass<Channel>().release()->c_ptr();
+}
+
+}  // namespace grpc_core
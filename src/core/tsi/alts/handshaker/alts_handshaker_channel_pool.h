@@ -0,0 +1,71 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_TSI_ALTS_HANDSHAKER_ALTS_HANDSHAKER_CHANNEL_POOL_H
+#define GRPC_SRC_CORE_TSI_ALTS_HANDSHAKER_ALTS_HANDSHAKER_CHANNEL_POOL_H
+
+#include <grpc/grpc.h>
+#include <grpc/support/port_platform.h>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "src/core/lib/surface/channel.h"
+#include "src/core/util/ref_counted.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/sync.h"
+
+namespace grpc_core {
+
+// Creates a channel to the ALTS handshaker service at handshaker_service_url.
+// If own_connection is true, the channel does not share its connection with
+// other channels to the same address.
+grpc_channel* AltsHandshakerChannelCreate(const char* handshaker_service_url,
+                                          bool own_connection);
+
+// A fixed number of channels to the ALTS handshaker service, shared by the
+// handshakes of one ALTS credentials object.
+//
+// Without a pool, every handshake creates its own channel, and all of those
+// channels share a single connection to the handshaker service through the
+// global subchannel pool. Each channel in the pool has a connection of its
+// own, and handshakes are spread over them round robin, so that handshakes
+// are not all funneled through one connection. Channels are created the first
+// time they are handed out.
+class AltsHandshakerChannelPool
+    : public RefCounted<AltsHandshakerChannelPool> {
+ public:
+  AltsHandshakerChannelPool(std::string handshaker_service_url, size_t size);
+
+  // The pool size to use: GRPC_ALTS_HANDSHAKER_CHANNEL_POOL_SIZE if it is set
+  // to a positive number, otherwise the number of cores, up to 8.
+  static size_t DefaultSize();
+
+  // Returns a new ref to the next channel. The caller releases it with
+  // grpc_channel_destroy_internal(). Must not be called with locks held that
+  // channel creation may acquire (see alts_tsi_handshaker_create_channel()).
+  grpc_channel* GetChannel();
+
+ private:
+  const std::string handshaker_service_url_;
+  Mutex mu_;
+  size_t next_ ABSL_GUARDED_BY(mu_) = 0;
+  std::vector<RefCountedPtr<Channel>> channels_ ABSL_GUARDED_BY(mu_);
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_TSI_ALTS_HANDSHAKER_ALTS_HANDSHAKER_CHANNEL_POOL_H
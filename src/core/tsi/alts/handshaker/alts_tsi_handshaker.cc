@@ -35,24 +35,14 @@
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/surface/channel.h"
 #include "src/core/tsi/alts/frame_protector/alts_frame_protector.h"
+#include "src/core/tsi/alts/handshaker/alts_handshaker_channel_pool.h"
 #include "src/core/tsi/alts/handshaker/alts_handshaker_client.h"
 #include "src/core/tsi/alts/handshaker/alts_shared_resource.h"
 #include "src/core/tsi/alts/zero_copy_frame_protector/alts_zero_copy_grpc_protector.h"
-#include "src/core/util/env.h"
 #include "src/core/util/memory.h"
 #include "src/core/util/sync.h"
 #include "upb/mem/arena.hpp"
 
-namespace {
-constexpr absl::string_view kUseGrpcExperimentalAltsHandshakerKeepaliveParams =
-    "GRPC_EXPERIMENTAL_ALTS_HANDSHAKER_KEEPALIVE_PARAMS";
-
-// 10 seconds
-constexpr int kExperimentalKeepAliveTimeoutMs = 10 * 1000;
-// 10 minutes
-constexpr int kExperimentalKeepAliveTimeMs = 10 * 60 * 1000;
-}  // namespace
-
 // Main struct for ALTS TSI handshaker.
 struct alts_tsi_handshaker {
   tsi_handshaker base;
@@ -65,6 +55,7 @@ struct alts_tsi_handshaker {
   grpc_alts_credentials_options* options;
   alts_handshaker_client_vtable* client_vtable_for_testing = nullptr;
   grpc_channel* channel = nullptr;
+  grpc_core::RefCountedPtr<grpc_core::AltsHandshakerChannelPool> channel_pool;
   bool use_dedicated_cq;
   // mu synchronizes all fields below. Note these are the
   // only fields that can be concurrently accessed (due to
@@ -286,7 +277,9 @@ static const tsi_handshaker_result_vtable result_vtable = {
     handshaker_result_create_zero_copy_grpc_protector,
     handshaker_result_create_frame_protector,
     handshaker_result_get_unused_bytes,
-    handshaker_result_destroy};
+    handshaker_result_destroy,
+    nullptr,  // handshaker_result_get_ktls_crypto_info
+};
 
 tsi_result alts_tsi_handshaker_result_create(grpc_gcp_HandshakerResp* resp,
                                              bool is_client,
@@ -535,28 +528,11 @@ static void alts_tsi_handshaker_create_channel(
       static_cast<alts_tsi_handshaker_continue_handshaker_next_args*>(arg);
   alts_tsi_handshaker* handshaker = next_args->handshaker;
   CHECK_EQ(handshaker->channel, nullptr);
-  grpc_channel_credentials* creds = grpc_insecure_credentials_create();
-  // Disable retries so that we quickly get a signal when the
-  // handshake server is not reachable.
-  std::vector<grpc_arg> args_vec;
-  args_vec.push_back(grpc_channel_arg_integer_create(
-      const_cast<char*>(GRPC_ARG_ENABLE_RETRIES), 0));
-  // TODO(gtcooke94) - Flag to try new values for ALTS keep alive settings,
-  // remove after trial
-  std::optional<std::string> env = grpc_core::GetEnv(
-      kUseGrpcExperimentalAltsHandshakerKeepaliveParams.data());
-  if (env.has_value() && (*env == "true")) {
-    args_vec.push_back(grpc_channel_arg_integer_create(
-        const_cast<char*>(GRPC_ARG_KEEPALIVE_TIMEOUT_MS),
-        kExperimentalKeepAliveTimeoutMs));
-    args_vec.push_back(grpc_channel_arg_integer_create(
-        const_cast<char*>(GRPC_ARG_KEEPALIVE_TIME_MS),
-        kExperimentalKeepAliveTimeMs));
-  }
-  grpc_channel_args args = {args_vec.size(), args_vec.data()};
-  handshaker->channel = grpc_channel_create(
-      next_args->handshaker->handshaker_service_url, creds, &args);
-  grpc_channel_credentials_release(creds);
+  handshaker->channel =
+      handshaker->channel_pool != nullptr
+          ? handshaker->channel_pool->GetChannel()
+          : grpc_core::AltsHandshakerChannelCreate(
+                handshaker->handshaker_service_url, /*own_connection=*/false);
   tsi_result continue_next_result =
       alts_tsi_handshaker_continue_handshaker_next(
           handshaker, next_args->received_bytes, next_args->received_bytes_size,
@@ -699,7 +675,9 @@ tsi_result alts_tsi_handshaker_create(
     const char* handshaker_service_url, bool is_client,
     grpc_pollset_set* interested_parties, tsi_handshaker** self,
     size_t user_specified_max_frame_size,
-    std::optional<std::string> preferred_transport_protocols) {
+    std::optional<std::string> preferred_transport_protocols,
+    grpc_core::RefCountedPtr<grpc_core::AltsHandshakerChannelPool>
+        channel_pool) {
   if (handshaker_service_url == nullptr || self == nullptr ||
       options == nullptr || (is_client && target_name == nullptr)) {
     LOG(ERROR) << "Invalid arguments to alts_tsi_handshaker_create()";
@@ -718,6 +696,7 @@ tsi_result alts_tsi_handshaker_create(
   handshaker->interested_parties = interested_parties;
   handshaker->options = grpc_alts_credentials_options_copy(options);
   handshaker->use_dedicated_cq = use_dedicated_cq;
+  handshaker->channel_pool = std::move(channel_pool);
   handshaker->max_frame_size = user_specified_max_frame_size != 0
                                    ? user_specified_max_frame_size
                                    : kTsiAltsMaxFrameSize;
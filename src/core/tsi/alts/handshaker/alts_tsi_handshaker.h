@@ -24,6 +24,7 @@
 
 #include "src/core/credentials/transport/alts/grpc_alts_credentials_options.h"
 #include "src/core/lib/iomgr/pollset_set.h"
+#include "src/core/tsi/alts/handshaker/alts_handshaker_channel_pool.h"
 #include "src/core/tsi/alts/handshaker/alts_handshaker_client.h"
 #include "src/core/tsi/transport_security.h"
 #include "src/core/tsi/transport_security_interface.h"
@@ -65,6 +66,8 @@ typedef struct alts_tsi_handshaker alts_tsi_handshaker;
 ///- preferred_transport_protocols: a comma separated list of preferred
 ///  transport protocols to be negotiated for this connection. If empty, no
 ///  negotiation will occur.
+///- channel_pool: channels to the handshaker service to use. If it's nullptr,
+///  the handshaker creates a channel of its own.
 ///
 /// It returns TSI_OK on success and an error status code on failure. Note that
 /// if interested_parties is nullptr, a dedicated TSI thread will be created and
@@ -75,7 +78,9 @@ tsi_result alts_tsi_handshaker_create(
     const char* handshaker_service_url, bool is_client,
     grpc_pollset_set* interested_parties, tsi_handshaker** self,
     size_t user_specified_max_frame_size,
-    std::optional<std::string> preferred_transport_protocols);
+    std::optional<std::string> preferred_transport_protocols,
+    grpc_core::RefCountedPtr<grpc_core::AltsHandshakerChannelPool>
+        channel_pool = nullptr);
 
 ///
 /// This method creates an ALTS TSI handshaker result instance.
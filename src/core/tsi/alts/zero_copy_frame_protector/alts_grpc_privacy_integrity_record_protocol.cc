@@ -70,6 +70,45 @@ static tsi_result alts_grpc_privacy_integrity_protect(
   return TSI_OK;
 }
 
+static tsi_result alts_grpc_privacy_integrity_protect_batch(
+    alts_grpc_record_protocol* rp, grpc_slice_buffer* unprotected_slices,
+    size_t max_unprotected_data_size, grpc_slice_buffer* protected_slices) {
+  // Input sanity check.
+  if (rp == nullptr || unprotected_slices == nullptr ||
+      protected_slices == nullptr) {
+    LOG(ERROR)
+        << "Invalid nullptr arguments to alts_grpc_record_protocol protect.";
+    return TSI_INVALID_ARGUMENT;
+  }
+  // All the frames are written back to back into one newly allocated buffer.
+  size_t protected_frames_size =
+      alts_iovec_record_protocol_get_batch_protected_size(
+          rp->iovec_rp, unprotected_slices->length, max_unprotected_data_size);
+  if (protected_frames_size == 0) {
+    LOG(ERROR) << "Invalid maximum unprotected data size.";
+    return TSI_INVALID_ARGUMENT;
+  }
+  grpc_slice protected_slice = GRPC_SLICE_MALLOC(protected_frames_size);
+  iovec_t protected_iovec = {GRPC_SLICE_START_PTR(protected_slice),
+                             GRPC_SLICE_LENGTH(protected_slice)};
+  char* error_details = nullptr;
+  alts_grpc_record_protocol_convert_slice_buffer_to_iovec(rp,
+                                                          unprotected_slices);
+  grpc_status_code status =
+      alts_iovec_record_protocol_privacy_integrity_protect_batch(
+          rp->iovec_rp, rp->iovec_buf, unprotected_slices->count,
+          max_unprotected_data_size, protected_iovec, &error_details);
+  if (status != GRPC_STATUS_OK) {
+    LOG(ERROR) << "Failed to protect, " << error_details;
+    gpr_free(error_details);
+    grpc_core::CSliceUnref(protected_slice);
+    return TSI_INTERNAL_ERROR;
+  }
+  grpc_slice_buffer_add(protected_slices, protected_slice);
+  grpc_slice_buffer_reset_and_unref(unprotected_slices);
+  return TSI_OK;
+}
+
 static tsi_result alts_grpc_privacy_integrity_unprotect(
     alts_grpc_record_protocol* rp, grpc_slice_buffer* protected_slices,
     grpc_slice_buffer* unprotected_slices) {
@@ -118,7 +157,8 @@ static tsi_result alts_grpc_privacy_integrity_unprotect(
 static const alts_grpc_record_protocol_vtable
     alts_grpc_privacy_integrity_record_protocol_vtable = {
         alts_grpc_privacy_integrity_protect,
-        alts_grpc_privacy_integrity_unprotect, nullptr};
+        alts_grpc_privacy_integrity_unprotect, nullptr,
+        alts_grpc_privacy_integrity_protect_batch};
 
 tsi_result alts_grpc_privacy_integrity_record_protocol_create(
     gsec_aead_crypter* crypter, size_t overflow_size, bool is_client,
@@ -49,6 +49,28 @@ tsi_result alts_grpc_record_protocol_protect(
     alts_grpc_record_protocol* self, grpc_slice_buffer* unprotected_slices,
     grpc_slice_buffer* protected_slices);
 
+///
+/// This method performs protect operation on unprotected data of any length by
+/// splitting it into frames of at most max_unprotected_data_size bytes, and
+/// appends all the protected frames to protected_slices. It is equivalent to
+/// calling alts_grpc_record_protocol_protect() once per frame, but lets the
+/// implementation protect the whole run at once. The input unprotected data
+/// slice buffer will be cleared, although the actual unprotected data bytes
+/// are not modified.
+///
+///- self: an alts_grpc_record_protocol instance.
+///- unprotected_slices: the unprotected data to be protected.
+///- max_unprotected_data_size: maximum unprotected data size of a frame.
+///- protected_slices: slice buffer where the protected frames are appended.
+///
+/// This method returns TSI_UNIMPLEMENTED if the implementation only protects
+/// one frame at a time, TSI_OK in case of success or a specific error code in
+/// case of failure.
+///
+tsi_result alts_grpc_record_protocol_protect_batch(
+    alts_grpc_record_protocol* self, grpc_slice_buffer* unprotected_slices,
+    size_t max_unprotected_data_size, grpc_slice_buffer* protected_slices);
+
 ///
 /// This methods performs unprotect operation on a full frame of protected data
 /// and appends unprotected data to unprotected_slices. It is the caller's
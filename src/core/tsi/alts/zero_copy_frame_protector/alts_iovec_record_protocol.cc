@@ -23,6 +23,8 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <algorithm>
+
 #include "src/core/tsi/alts/frame_protector/alts_counter.h"
 #include "src/core/util/crash.h"
 
@@ -352,6 +354,88 @@ grpc_status_code alts_iovec_record_protocol_privacy_integrity_protect(
   return increment_counter(rp->ctr, error_details);
 }
 
+size_t alts_iovec_record_protocol_get_batch_protected_size(
+    const alts_iovec_record_protocol* rp, size_t data_length,
+    size_t max_unprotected_data_size) {
+  if (rp == nullptr || max_unprotected_data_size == 0) {
+    return 0;
+  }
+  // Empty data is still sent as one empty frame.
+  size_t frame_count =
+      std::max<size_t>(1, (data_length + max_unprotected_data_size - 1) /
+                              max_unprotected_data_size);
+  return data_length +
+         frame_count *
+             (alts_iovec_record_protocol_get_header_length() + rp->tag_length);
+}
+
+grpc_status_code alts_iovec_record_protocol_privacy_integrity_protect_batch(
+    alts_iovec_record_protocol* rp, const iovec_t* unprotected_vec,
+    size_t unprotected_vec_length, size_t max_unprotected_data_size,
+    iovec_t protected_frames, char** error_details) {
+  // Input sanity checks.
+  if (rp == nullptr) {
+    maybe_copy_error_msg("Input iovec_record_protocol is nullptr.",
+                         error_details);
+    return GRPC_STATUS_INVALID_ARGUMENT;
+  }
+  if (max_unprotected_data_size == 0) {
+    maybe_copy_error_msg("Maximum unprotected data size is zero.",
+                         error_details);
+    return GRPC_STATUS_INVALID_ARGUMENT;
+  }
+  if (protected_frames.iov_base == nullptr) {
+    maybe_copy_error_msg("Protected frames buffer is nullptr.", error_details);
+    return GRPC_STATUS_INVALID_ARGUMENT;
+  }
+  size_t data_length =
+      get_total_length(unprotected_vec, unprotected_vec_length);
+  if (protected_frames.iov_len !=
+      alts_iovec_record_protocol_get_batch_protected_size(
+          rp, data_length, max_unprotected_data_size)) {
+    maybe_copy_error_msg("Protected frames size is incorrect.", error_details);
+    return GRPC_STATUS_INVALID_ARGUMENT;
+  }
+  // A frame never covers more pieces than the input has iovecs.
+  iovec_t* frame_vec = static_cast<iovec_t*>(gpr_malloc(
+      std::max<size_t>(1, unprotected_vec_length) * sizeof(iovec_t)));
+  unsigned char* out = static_cast<unsigned char*>(protected_frames.iov_base);
+  const size_t overhead =
+      alts_iovec_record_protocol_get_header_length() + rp->tag_length;
+  size_t vec_index = 0;
+  size_t vec_offset = 0;
+  size_t remaining = data_length;
+  grpc_status_code status = GRPC_STATUS_OK;
+  do {
+    size_t frame_data_length = std::min(remaining, max_unprotected_data_size);
+    size_t frame_vec_length = 0;
+    size_t needed = frame_data_length;
+    while (needed > 0) {
+      const iovec_t& vec = unprotected_vec[vec_index];
+      size_t take = std::min(needed, vec.iov_len - vec_offset);
+      if (take > 0) {
+        frame_vec[frame_vec_length].iov_base =
+            static_cast<unsigned char*>(vec.iov_base) + vec_offset;
+        frame_vec[frame_vec_length].iov_len = take;
+        frame_vec_length++;
+      }
+      vec_offset += take;
+      needed -= take;
+      if (vec_offset == vec.iov_len) {
+        vec_index++;
+        vec_offset = 0;
+      }
+    }
+    iovec_t protected_frame = {out, frame_data_length + overhead};
+    status = alts_iovec_record_protocol_privacy_integrity_protect(
+        rp, frame_vec, frame_vec_length, protected_frame, error_details);
+    out += protected_frame.iov_len;
+    remaining -= frame_data_length;
+  } while (status == GRPC_STATUS_OK && remaining > 0);
+  gpr_free(frame_vec);
+  return status;
+}
+
 grpc_status_code alts_iovec_record_protocol_privacy_integrity_unprotect(
     alts_iovec_record_protocol* rp, iovec_t header,
     const iovec_t* protected_vec, size_t protected_vec_length,
@@ -135,6 +135,51 @@ grpc_status_code alts_iovec_record_protocol_privacy_integrity_protect(
     size_t unprotected_vec_length, iovec_t protected_frame,
     char** error_details);
 
+///
+/// This method returns the total size of the frames produced by
+/// alts_iovec_record_protocol_privacy_integrity_protect_batch(), given the
+/// total length of unprotected data and the maximum unprotected data size of
+/// each frame.
+///
+///- rp: an alts_iovec_record_protocol instance.
+///- data_length: total length of unprotected data.
+///- max_unprotected_data_size: maximum unprotected data size of a frame.
+///
+/// On success, the method returns the total size of the protected frames.
+/// Otherwise, it returns zero.
+///
+size_t alts_iovec_record_protocol_get_batch_protected_size(
+    const alts_iovec_record_protocol* rp, size_t data_length,
+    size_t max_unprotected_data_size);
+
+///
+/// This method performs privacy-integrity protect operation on a
+/// alts_iovec_record_protocol instance for a run of frames, i.e., it splits
+/// the unprotected data into frames of at most max_unprotected_data_size bytes
+/// and writes the protected frames back to back into protected_frames. The
+/// result is the same as calling
+/// alts_iovec_record_protocol_privacy_integrity_protect() once per frame, but
+/// the caller only needs to allocate one buffer for the whole run. The size of
+/// protected_frames must be the one returned by
+/// alts_iovec_record_protocol_get_batch_protected_size().
+///
+///- rp: an alts_iovec_record_protocol instance.
+///- unprotected_vec: an iovec array containing unprotected data.
+///- unprotected_vec_length: the array length of unprotected_vec.
+///- max_unprotected_data_size: maximum unprotected data size of a frame.
+///- protected_frames: an iovec containing the output protected frames.
+///- error_details: a buffer containing an error message if the method does not
+///  function correctly. It is OK to pass nullptr into error_details.
+///
+/// On success, the method returns GRPC_STATUS_OK. Otherwise, it returns an
+/// error status code along with its details specified in error_details (if
+/// error_details is not nullptr).
+///
+grpc_status_code alts_iovec_record_protocol_privacy_integrity_protect_batch(
+    alts_iovec_record_protocol* rp, const iovec_t* unprotected_vec,
+    size_t unprotected_vec_length, size_t max_unprotected_data_size,
+    iovec_t protected_frames, char** error_details);
+
 ///
 /// This method performs privacy-integrity unprotect operation on a
 /// alts_iovec_record_protocol instance given a full protected frame, i.e.,
@@ -156,6 +156,13 @@ static tsi_result alts_zero_copy_grpc_protector_protect(
   }
   alts_zero_copy_grpc_protector* protector =
       reinterpret_cast<alts_zero_copy_grpc_protector*>(self);
+  // Protects all the frames at once if the record protocol supports it.
+  tsi_result batch_status = alts_grpc_record_protocol_protect_batch(
+      protector->record_protocol, unprotected_slices,
+      protector->max_unprotected_data_size, protected_slices);
+  if (batch_status != TSI_UNIMPLEMENTED) {
+    return batch_status;
+  }
   // Calls alts_grpc_record_protocol protect repeatedly.
   while (unprotected_slices->length > protector->max_unprotected_data_size) {
     grpc_slice_buffer_move_first(unprotected_slices,
@@ -0,0 +1,120 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/tsi/ssl/session_ticket/ssl_session_ticket_keys.h"
+
+#include <grpc/support/port_platform.h>
+#include <string.h>
+
+#include <utility>
+
+#include "absl/log/log.h"
+#include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/util/load_file.h"
+
+namespace tsi {
+
+TlsSessionTicketKeys::TlsSessionTicketKeys(KeyLoader load_keys,
+                                           absl::Duration reload_interval)
+    : load_keys_(std::move(load_keys)), reload_interval_(reload_interval) {
+  auto keys = load_keys_();
+  grpc_core::MutexLock lock(&mu_);
+  next_reload_ = absl::Now() + reload_interval_;
+  if (!keys.ok()) {
+    LOG(ERROR) << "Failed to load TLS session ticket keys: " << keys.status();
+    return;
+  }
+  keys_ = std::move(*keys);
+}
+
+grpc_core::RefCountedPtr<TlsSessionTicketKeys> TlsSessionTicketKeys::FromFile(
+    std::string path, absl::Duration reload_interval) {
+  return grpc_core::MakeRefCounted<TlsSessionTicketKeys>(
+      [path = std::move(path)]() -> absl::StatusOr<std::vector<Key>> {
+        auto contents =
+            grpc_core::LoadFile(path, /*add_null_terminator=*/false);
+        if (!contents.ok()) return contents.status();
+        return ParseKeys(contents->as_string_view());
+      },
+      reload_interval);
+}
+
+absl::StatusOr<std::vector<TlsSessionTicketKeys::Key>>
+TlsSessionTicketKeys::ParseKeys(absl::string_view contents) {
+  if (contents.empty() || contents.size() % kKeySize != 0) {
+    return absl::InvalidArgumentError(
+        absl::StrCat("session ticket key file must hold a multiple of ",
+                     kKeySize, " bytes, but holds ", contents.size()));
+  }
+  std::vector<Key> keys(contents.size() / kKeySize);
+  for (size_t i = 0; i < keys.size(); i++) {
+    const char* key = contents.data() + i * kKeySize;
+    memcpy(keys[i].name, key, kKeyNameSize);
+    memcpy(keys[i].hmac_secret, key + kKeyNameSize, kHmacSecretSize);
+    memcpy(keys[i].aes_key, key + kKeyNameSize + kHmacSecretSize, kAesKeySize);
+  }
+  return keys;
+}
+
+bool TlsSessionTicketKeys::HasKeys() {
+  grpc_core::MutexLock lock(&mu_);
+  return !keys_.empty();
+}
+
+bool TlsSessionTicketKeys::GetEncryptionKey(Key* key) {
+  MaybeReload();
+  grpc_core::MutexLock lock(&mu_);
+  if (keys_.empty()) return false;
+  *key = keys_.front();
+  return true;
+}
+
+bool TlsSessionTicketKeys::GetDecryptionKey(const uint8_t* name, Key* key,
+                                            bool* is_current) {
+  MaybeReload();
+  grpc_core::MutexLock lock(&mu_);
+  for (size_t i = 0; i < keys_.size(); i++) {
+    if (memcmp(keys_[i].name, name, kKeyNameSize) == 0) {
+      *key = keys_[i];
+      *is_current = i == 0;
+      return true;
+    }
+  }
+  return false;
+}
+
+void TlsSessionTicketKeys::MaybeReload() {
+  {
+    grpc_core::MutexLock lock(&mu_);
+    if (absl::Now() < next_reload_) return;
+  }
+  if (!load_mu_.TryLock()) return;
+  auto keys = load_keys_();
+  {
+    grpc_core::MutexLock lock(&mu_);
+    next_reload_ = absl::Now() + reload_interval_;
+    if (keys.ok()) {
+      keys_ = std::move(*keys);
+    } else {
+      LOG(ERROR) << "Failed to reload TLS session ticket keys, keeping the "
+                    "previous keys: "
+                 << keys.status();
+    }
+  }
+  load_mu_.Unlock();
+}
+
+}  // namespace tsi
@@ -0,0 +1,110 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_TSI_SSL_SESSION_TICKET_SSL_SESSION_TICKET_KEYS_H
+#define GRPC_SRC_CORE_TSI_SSL_SESSION_TICKET_SSL_SESSION_TICKET_KEYS_H
+
+#include <grpc/support/port_platform.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/functional/any_invocable.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+#include "absl/time/time.h"
+#include "src/core/util/ref_counted.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/sync.h"
+
+namespace tsi {
+
+// The keys a TLS server encrypts and decrypts session tickets with.
+//
+// By default every server process makes up its own ticket key, so a client
+// can only resume its session with the process that issued the ticket. Servers
+// that load their keys from the same source can resume each other's sessions,
+// which keeps clients reconnecting after a deploy, or to another replica
+// behind a load balancer, from falling back to full handshakes.
+//
+// New tickets are encrypted with the first key; tickets encrypted with any of
+// the keys are accepted, and renewed if they were not encrypted with the first
+// key. Keys are rotated by adding a new first key and keeping the previous
+// keys after it until the tickets they encrypted have expired. The keys are
+// loaded again every reload interval; if loading fails, the keys loaded last
+// are kept.
+class TlsSessionTicketKeys
+    : public grpc_core::RefCounted<TlsSessionTicketKeys> {
+ public:
+  static constexpr size_t kKeyNameSize = 16;
+  static constexpr size_t kHmacSecretSize = 32;
+  static constexpr size_t kAesKeySize = 32;
+  static constexpr size_t kKeySize =
+      kKeyNameSize + kHmacSecretSize + kAesKeySize;
+
+  // A key for HMAC-SHA256 authenticated AES-256-CBC encrypted tickets.
+  struct Key {
+    uint8_t name[kKeyNameSize];
+    uint8_t hmac_secret[kHmacSecretSize];
+    uint8_t aes_key[kAesKeySize];
+  };
+
+  using KeyLoader = absl::AnyInvocable<absl::StatusOr<std::vector<Key>>()>;
+
+  static constexpr absl::Duration kDefaultReloadInterval = absl::Minutes(1);
+
+  // Loads keys with load_keys, now and then again every reload_interval.
+  TlsSessionTicketKeys(KeyLoader load_keys, absl::Duration reload_interval);
+
+  // Loads keys from a file holding one or more keys back to back, each
+  // kKeySize bytes long: the key name, then the HMAC secret, then the AES
+  // key. This is the format of Envoy's and nginx's session ticket key files.
+  static grpc_core::RefCountedPtr<TlsSessionTicketKeys> FromFile(
+      std::string path,
+      absl::Duration reload_interval = kDefaultReloadInterval);
+
+  // Parses the contents of a key file.
+  static absl::StatusOr<std::vector<Key>> ParseKeys(absl::string_view contents);
+
+  // Returns true if keys have been loaded.
+  bool HasKeys();
+
+  // Sets *key to the key new tickets are encrypted with. Returns false if no
+  // keys have been loaded.
+  bool GetEncryptionKey(Key* key);
+
+  // Sets *key to the key named name, which is kKeyNameSize bytes long, and
+  // *is_current to whether it is the key new tickets are encrypted with.
+  // Returns false if there is no such key.
+  bool GetDecryptionKey(const uint8_t* name, Key* key, bool* is_current);
+
+ private:
+  // Loads the keys again if the reload interval has passed. Only one thread
+  // loads at a time; the others keep using the keys loaded last.
+  void MaybeReload();
+
+  grpc_core::Mutex load_mu_;
+  KeyLoader load_keys_ ABSL_GUARDED_BY(load_mu_);
+  const absl::Duration reload_interval_;
+  grpc_core::Mutex mu_;
+  std::vector<Key> keys_ ABSL_GUARDED_BY(mu_);
+  absl::Time next_reload_ ABSL_GUARDED_BY(mu_);
+};
+
+}  // namespace tsi
+
+#endif  // GRPC_SRC_CORE_TSI_SSL_SESSION_TICKET_SSL_SESSION_TICKET_KEYS_H
@@ -0,0 +1,107 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/tsi/ssl/verified_chain_cache/ssl_verified_chain_cache.h"
+
+#include <grpc/support/port_platform.h>
+#include <openssl/asn1.h>
+#include <openssl/evp.h>
+
+#include <algorithm>
+
+namespace tsi {
+
+VerifiedChainCache::Entry::~Entry() {
+  if (chain_ != nullptr) sk_X509_pop_free(chain_, X509_free);
+}
+
+void VerifiedChainCache::Entry::Set(STACK_OF(X509)* chain, absl::Time expiry) {
+  if (chain_ != nullptr) sk_X509_pop_free(chain_, X509_free);
+  chain_ = chain;
+  expiry_ = expiry;
+}
+
+VerifiedChainCache::VerifiedChainCache(size_t max_entries,
+                                       absl::Duration max_age)
+    : max_age_(max_age), entries_(max_entries) {}
+
+std::optional<std::string> VerifiedChainCache::Fingerprint(
+    X509* leaf, STACK_OF(X509)* intermediates) {
+  std::string fingerprint;
+  auto append_digest = [&fingerprint](X509* cert) {
+    unsigned char digest[EVP_MAX_MD_SIZE];
+    unsigned int digest_size = 0;
+    if (X509_digest(cert, EVP_sha256(), digest, &digest_size) != 1) {
+      return false;
+    }
+    fingerprint.append(reinterpret_cast<const char*>(digest), digest_size);
+    return true;
+  };
+  if (leaf == nullptr || !append_digest(leaf)) return std::nullopt;
+  if (intermediates != nullptr) {
+    size_t num_intermediates = sk_X509_num(intermediates);
+    for (size_t i = 0; i < num_intermediates; i++) {
+      if (!append_digest(sk_X509_value(intermediates, i))) return std::nullopt;
+    }
+  }
+  return fingerprint;
+}
+
+STACK_OF(X509)* VerifiedChainCache::Get(absl::string_view fingerprint) {
+  grpc_core::MutexLock lock(&mu_);
+  std::optional<std::shared_ptr<Entry>> entry =
+      entries_.Get(std::string(fingerprint));
+  if (!entry.has_value() || (*entry)->chain() == nullptr ||
+      absl::Now() >= (*entry)->expiry()) {
+    return nullptr;
+  }
+  return X509_chain_up_ref((*entry)->chain());
+}
+
+void VerifiedChainCache::Put(absl::string_view fingerprint,
+                             STACK_OF(X509)* chain) {
+  absl::Time expiry = ExpiryFor(chain);
+  STACK_OF(X509)* copy = X509_chain_up_ref(chain);
+  if (copy == nullptr) return;
+  grpc_core::MutexLock lock(&mu_);
+  std::shared_ptr<Entry> entry = entries_.GetOrInsert(
+      std::string(fingerprint),
+      [](const std::string&) { return std::make_shared<Entry>(); });
+  entry->Set(copy, expiry);
+}
+
+absl::Time VerifiedChainCache::ExpiryFor(STACK_OF(X509)* chain) const {
+  absl::Time now = absl::Now();
+  absl::Time expiry = now + max_age_;
+  size_t chain_length = sk_X509_num(chain);
+  for (size_t i = 0; i < chain_length; i++) {
+    X509* cert = sk_X509_value(chain, i);
+#if OPENSSL_VERSION_NUMBER >= 0x10100000
+    const ASN1_TIME* not_after = X509_get0_notAfter(cert);
+#else
+    const ASN1_TIME* not_after = X509_get_notAfter(cert);
+#endif
+    int days = 0;
+    int seconds = 0;
+    // A null from time means now.
+    if (ASN1_TIME_diff(&days, &seconds, nullptr, not_after) != 1) {
+      return now;
+    }
+    expiry = std::min(expiry,
+                      now + absl::Hours(24) * days + absl::Seconds(seconds));
+  }
+  return expiry;
+}
+
+}  // namespace tsi
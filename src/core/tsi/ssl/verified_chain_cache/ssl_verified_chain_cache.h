@@ -0,0 +1,97 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_TSI_SSL_VERIFIED_CHAIN_CACHE_SSL_VERIFIED_CHAIN_CACHE_H
+#define GRPC_SRC_CORE_TSI_SSL_VERIFIED_CHAIN_CACHE_SSL_VERIFIED_CHAIN_CACHE_H
+
+#include <grpc/support/port_platform.h>
+#include <openssl/x509.h>
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/strings/string_view.h"
+#include "absl/time/time.h"
+#include "src/core/util/lru_cache.h"
+#include "src/core/util/ref_counted.h"
+#include "src/core/util/sync.h"
+
+namespace tsi {
+
+// Remembers the chains built by X509_verify_cert() for recently seen peer
+// certificates, so that a handshake presenting the same certificates as a
+// recent one can skip building and verifying the chain again.
+//
+// A cache belongs to one handshaker factory, and so to one set of trusted
+// roots and one verification purpose: the factory is replaced whenever the
+// roots change. Entries are keyed by the fingerprint of the certificates the
+// peer sent, and expire after at most max_age, and no later than the first
+// certificate of the chain expires.
+class VerifiedChainCache : public grpc_core::RefCounted<VerifiedChainCache> {
+ public:
+  static constexpr size_t kDefaultMaxEntries = 256;
+  static constexpr absl::Duration kDefaultMaxAge = absl::Minutes(5);
+
+  explicit VerifiedChainCache(size_t max_entries = kDefaultMaxEntries,
+                              absl::Duration max_age = kDefaultMaxAge);
+
+  // Returns the SHA-256 digests of leaf and of every certificate in
+  // intermediates, which together identify what a peer presented. Returns
+  // nullopt if a digest could not be computed.
+  static std::optional<std::string> Fingerprint(
+      X509* leaf, STACK_OF(X509)* intermediates);
+
+  // Returns a copy of the verified chain stored under fingerprint, which the
+  // caller must free with sk_X509_pop_free(chain, X509_free), or nullptr if
+  // there is none or it has expired.
+  STACK_OF(X509)* Get(absl::string_view fingerprint);
+
+  // Stores a copy of the verified chain under fingerprint.
+  void Put(absl::string_view fingerprint, STACK_OF(X509)* chain);
+
+ private:
+  class Entry {
+   public:
+    Entry() = default;
+    ~Entry();
+
+    Entry(const Entry&) = delete;
+    Entry& operator=(const Entry&) = delete;
+
+    STACK_OF(X509)* chain() const { return chain_; }
+    absl::Time expiry() const { return expiry_; }
+
+    // Takes ownership of chain.
+    void Set(STACK_OF(X509)* chain, absl::Time expiry);
+
+   private:
+    STACK_OF(X509)* chain_ = nullptr;
+    absl::Time expiry_;
+  };
+
+  // Returns when an entry for chain stored now must expire.
+  absl::Time ExpiryFor(STACK_OF(X509)* chain) const;
+
+  const absl::Duration max_age_;
+  grpc_core::Mutex mu_;
+  grpc_core::LruCache<std::string, std::shared_ptr<Entry>> entries_
+      ABSL_GUARDED_BY(mu_);
+};
+
+}  // namespace tsi
+
+#endif  // GRPC_SRC_CORE_TSI_SSL_VERIFIED_CHAIN_CACHE_SSL_VERIFIED_CHAIN_CACHE_H
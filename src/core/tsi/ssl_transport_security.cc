@@ -40,15 +40,24 @@
 #include <grpc/support/string_util.h>
 #include <grpc/support/sync.h>
 #include <grpc/support/thd_id.h>
+#include <grpc/support/time.h>
 #include <openssl/bio.h>
 #include <openssl/crypto.h>  // For OPENSSL_free
 #include <openssl/engine.h>
 #include <openssl/err.h>
+#include <openssl/evp.h>
+#include <openssl/hmac.h>
+#include <openssl/rand.h>
 #include <openssl/ssl.h>
 #include <openssl/tls1.h>
 #include <openssl/x509.h>
 #include <openssl/x509v3.h>
+#if !defined(OPENSSL_IS_BORINGSSL) && OPENSSL_VERSION_NUMBER >= 0x30000000
+#include <openssl/core_names.h>
+#include <openssl/params.h>
+#endif
 
+#include <algorithm>
 #include <memory>
 #include <optional>
 #include <string>
@@ -62,9 +71,14 @@
 #include "absl/strings/string_view.h"
 #include "src/core/credentials/transport/tls/grpc_tls_crl_provider.h"
 #include "src/core/credentials/transport/tls/ssl_utils.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/surface/init.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
 #include "src/core/tsi/ssl/key_logging/ssl_key_logging.h"
 #include "src/core/tsi/ssl/session_cache/ssl_session_cache.h"
+#include "src/core/tsi/ssl/session_ticket/ssl_session_ticket_keys.h"
+#include "src/core/tsi/ssl/verified_chain_cache/ssl_verified_chain_cache.h"
 #include "src/core/tsi/ssl_transport_security_utils.h"
 #include "src/core/tsi/ssl_types.h"
 #include "src/core/tsi/transport_security.h"
@@ -85,6 +99,15 @@
 #define TSI_SSL_MAX_PROTECTED_FRAME_SIZE_UPPER_BOUND 16384
 #define TSI_SSL_MAX_PROTECTED_FRAME_SIZE_LOWER_BOUND 1024
 #define TSI_SSL_HANDSHAKER_OUTGOING_BUFFER_INITIAL_SIZE 1024
+// Dynamic record sizing. Until TSI_SSL_RECORD_SIZE_BOOST_THRESHOLD bytes have
+// been protected since the protector was created or last went idle, records
+// carry at most TSI_SSL_SMALL_RECORD_SIZE bytes, so that each one fits in a
+// TCP segment and the peer can decrypt the first bytes of a response as soon
+// as they arrive. After that, records grow to the protector's buffer size,
+// which keeps the per-record cost of bulk transfers down.
+#define TSI_SSL_SMALL_RECORD_SIZE 1200
+#define TSI_SSL_RECORD_SIZE_BOOST_THRESHOLD (128 * 1024)
+#define TSI_SSL_RECORD_SIZE_IDLE_RESET_MS 1000
 const size_t kMaxChainLength = 100;
 
 // Putting a macro like this and littering the source file with #if is really
@@ -118,6 +141,7 @@ struct tsi_ssl_client_handshaker_factory {
   size_t alpn_protocol_list_length;
   grpc_core::RefCountedPtr<tsi::SslSessionLRUCache> session_cache;
   grpc_core::RefCountedPtr<TlsSessionKeyLogger> key_logger;
+  grpc_core::RefCountedPtr<tsi::VerifiedChainCache> verified_chain_cache;
 };
 
 struct tsi_ssl_server_handshaker_factory {
@@ -131,6 +155,8 @@ struct tsi_ssl_server_handshaker_factory {
   unsigned char* alpn_protocol_list;
   size_t alpn_protocol_list_length;
   grpc_core::RefCountedPtr<TlsSessionKeyLogger> key_logger;
+  grpc_core::RefCountedPtr<tsi::TlsSessionTicketKeys> session_ticket_keys;
+  grpc_core::RefCountedPtr<tsi::VerifiedChainCache> verified_chain_cache;
 };
 
 struct tsi_ssl_handshaker {
@@ -156,6 +182,13 @@ struct tsi_ssl_frame_protector {
   unsigned char* buffer;
   size_t buffer_size;
   size_t buffer_offset;
+  // The most bytes the record being filled may carry, at most buffer_size.
+  // Only changes between records.
+  size_t record_size;
+  // Bytes protected since the protector was created or last went idle.
+  size_t bytes_since_idle;
+  // When data was last protected or flushed.
+  gpr_timespec last_activity;
   // Ensures that protect, protect_flush, and unprotect are not called
   // concurrently.
   gpr_mu mu;
@@ -250,6 +283,8 @@ int ServerHandshakerFactoryAlpnCallback(SSL* /*ssl*/, const unsigned char** out,
 static gpr_once g_init_openssl_once = GPR_ONCE_INIT;
 static int g_ssl_ctx_ex_factory_index = -1;
 static int g_ssl_ctx_ex_crl_provider_index = -1;
+static int g_ssl_ctx_ex_session_ticket_keys_index = -1;
+static int g_ssl_ctx_ex_verified_chain_cache_index = -1;
 static const unsigned char kSslSessionIdContext[] = {'g', 'r', 'p', 'c'};
 static int g_ssl_ex_verified_root_cert_index = -1;
 #if !defined(OPENSSL_IS_BORINGSSL) && !defined(OPENSSL_NO_ENGINE)
@@ -340,6 +375,14 @@ static void init_openssl(void) {
       SSL_CTX_get_ex_new_index(0, nullptr, nullptr, nullptr, nullptr);
   CHECK_NE(g_ssl_ctx_ex_crl_provider_index, -1);
 
+  g_ssl_ctx_ex_session_ticket_keys_index =
+      SSL_CTX_get_ex_new_index(0, nullptr, nullptr, nullptr, nullptr);
+  CHECK_NE(g_ssl_ctx_ex_session_ticket_keys_index, -1);
+
+  g_ssl_ctx_ex_verified_chain_cache_index =
+      SSL_CTX_get_ex_new_index(0, nullptr, nullptr, nullptr, nullptr);
+  CHECK_NE(g_ssl_ctx_ex_verified_chain_cache_index, -1);
+
   g_ssl_ex_verified_root_cert_index = SSL_get_ex_new_index(
       0, nullptr, nullptr, nullptr, verified_root_cert_free);
   CHECK_NE(g_ssl_ex_verified_root_cert_index, -1);
@@ -998,18 +1041,13 @@ static int NullVerifyCallback(X509_STORE_CTX* /*ctx*/, void* /*arg*/) {
   return 1;
 }
 
-static int RootCertExtractCallback(X509_STORE_CTX* ctx, void* /*arg*/) {
+static int RootCertExtractCallback(X509_STORE_CTX* ctx,
+                                   STACK_OF(X509)* chain) {
   int ret = 1;
-  // Verification was successful. Get the verified chain from the X509_STORE_CTX
-  // and put the root on the SSL object so that we have access to it when
-  // populating the tsi_peer. On error extracting the root, we return success
-  // anyway and proceed with the connection, to preserve the behavior of an
-  // older version of this code.
-#if OPENSSL_VERSION_NUMBER >= 0x10100000
-  STACK_OF(X509)* chain = X509_STORE_CTX_get0_chain(ctx);
-#else
-  STACK_OF(X509)* chain = X509_STORE_CTX_get_chain(ctx);
-#endif
+  // Verification was successful. Put the root of the verified chain on the SSL
+  // object so that we have access to it when populating the tsi_peer. On error
+  // extracting the root, we return success anyway and proceed with the
+  // connection, to preserve the behavior of an older version of this code.
   if (chain == nullptr) {
     return ret;
   }
@@ -1200,12 +1238,7 @@ static int CheckCertRevocation(grpc_core::experimental::CrlProvider* provider,
 // Checks each certificate in the chain for revocation
 // returns 0 if any cert in the chain is revoked, 1 otherwise.
 static int CheckChainRevocation(
-    X509_STORE_CTX* ctx, grpc_core::experimental::CrlProvider* provider) {
-#if OPENSSL_VERSION_NUMBER >= 0x10100000
-  STACK_OF(X509)* chain = X509_STORE_CTX_get0_chain(ctx);
-#else
-  STACK_OF(X509)* chain = X509_STORE_CTX_get_chain(ctx);
-#endif
+    STACK_OF(X509)* chain, grpc_core::experimental::CrlProvider* provider) {
   if (chain == nullptr) {
     return 0;
   }
@@ -1231,30 +1264,87 @@ static int CheckChainRevocation(
   return 1;
 }
 
+static tsi::VerifiedChainCache* GetVerifiedChainCache(X509_STORE_CTX* ctx) {
+  int ssl_index = SSL_get_ex_data_X509_STORE_CTX_idx();
+  if (ssl_index < 0) return nullptr;
+  SSL* ssl = static_cast<SSL*>(X509_STORE_CTX_get_ex_data(ctx, ssl_index));
+  if (ssl == nullptr) return nullptr;
+  return static_cast<tsi::VerifiedChainCache*>(SSL_CTX_get_ex_data(
+      SSL_get_SSL_CTX(ssl), g_ssl_ctx_ex_verified_chain_cache_index));
+}
+
+// Returns the chain X509_verify_cert() would build for the certificates the
+// peer presented, with a reference the caller owns, or nullptr if no trusted
+// chain could be built. When the handshaker factory has a verified chain
+// cache, the chain built for the same certificates by a recent handshake is
+// reused instead of verifying them again.
+static STACK_OF(X509)* VerifyCertChain(X509_STORE_CTX* ctx) {
+  tsi::VerifiedChainCache* cache = GetVerifiedChainCache(ctx);
+  std::optional<std::string> fingerprint;
+#if OPENSSL_VERSION_NUMBER >= 0x10100000
+  if (cache != nullptr) {
+    fingerprint = tsi::VerifiedChainCache::Fingerprint(
+        X509_STORE_CTX_get0_cert(ctx), X509_STORE_CTX_get0_untrusted(ctx));
+  }
+#endif
+  if (fingerprint.has_value()) {
+    STACK_OF(X509)* chain = cache->Get(*fingerprint);
+    if (chain != nullptr) {
+      grpc_core::global_stats().IncrementSslVerifiedChainCacheHits();
+      return chain;
+    }
+    grpc_core::global_stats().IncrementSslVerifiedChainCacheMisses();
+  }
+  if (X509_verify_cert(ctx) <= 0) return nullptr;
+  STACK_OF(X509)* chain = X509_STORE_CTX_get1_chain(ctx);
+  if (chain != nullptr && fingerprint.has_value()) {
+    cache->Put(*fingerprint, chain);
+  }
+  return chain;
+}
+
+// Returns true if handshaker factories should reuse recently verified chains.
+// CRLs loaded from crl_directory are checked by X509_verify_cert() itself, and
+// can change without the factory being replaced, so their chains are always
+// verified again.
+static bool UseVerifiedChainCache(const char* crl_directory) {
+#if OPENSSL_VERSION_NUMBER >= 0x10100000
+  return grpc_core::IsTlsVerifiedChainCacheEnabled() &&
+         (crl_directory == nullptr || crl_directory[0] == '\0');
+#else
+  (void)crl_directory;
+  return false;
+#endif
+}
+
 // The custom verification function to set in OpenSSL using
 // X509_set_cert_verify_callback. This calls the standard OpenSSL procedure
 // (X509_verify_cert), then also extracts the root certificate in the built
 // chain and does revocation checks when a user has configured CrlProviders.
+// Revocation is checked on every handshake, even when the chain comes from the
+// verified chain cache, since CRLs may change at any time.
 // returns 1 on success, indicating a trusted chain to a root of trust was
 // found, 0 if a trusted chain could not be built.
-static int CustomVerificationFunction(X509_STORE_CTX* ctx, void* arg) {
-  int ret = X509_verify_cert(ctx);
-  if (ret <= 0) {
+static int CustomVerificationFunction(X509_STORE_CTX* ctx, void* /*arg*/) {
+  STACK_OF(X509)* chain = VerifyCertChain(ctx);
+  if (chain == nullptr) {
     VLOG(2) << "Failed to verify cert chain.";
     // Verification failed. We shouldn't expect to have a verified chain, so
     // there is no need to attempt to extract the root cert from it, check for
     // revocation, or check anything else.
-    return ret;
+    return 0;
   }
+  int ret = 1;
   grpc_core::experimental::CrlProvider* provider = GetCrlProvider(ctx);
   if (provider != nullptr) {
-    ret = CheckChainRevocation(ctx, provider);
+    ret = CheckChainRevocation(chain, provider);
     if (ret <= 0) {
       VLOG(2) << "The chain failed revocation checks.";
-      return ret;
     }
   }
-  return RootCertExtractCallback(ctx, arg);
+  if (ret > 0) ret = RootCertExtractCallback(ctx, chain);
+  sk_X509_pop_free(chain, X509_free);
+  return ret;
 }
 
 // Sets the min and max TLS version of |ssl_context| to |min_tls_version| and
@@ -1373,6 +1463,23 @@ void tsi_ssl_session_cache_unref(tsi_ssl_session_cache* cache) {
 
 // --- tsi_frame_protector methods implementation. ---
 
+// Picks the size of the next record. Called between records.
+static void ssl_protector_update_record_size(tsi_ssl_frame_protector* impl) {
+  gpr_timespec now = gpr_now(GPR_CLOCK_MONOTONIC);
+  if (gpr_time_cmp(gpr_time_sub(now, impl->last_activity),
+                   gpr_time_from_millis(TSI_SSL_RECORD_SIZE_IDLE_RESET_MS,
+                                        GPR_TIMESPAN)) > 0) {
+    // The congestion window may have shrunk while the connection was idle,
+    // so start small again.
+    impl->bytes_since_idle = 0;
+  }
+  impl->last_activity = now;
+  impl->record_size =
+      impl->bytes_since_idle < TSI_SSL_RECORD_SIZE_BOOST_THRESHOLD
+          ? std::min<size_t>(TSI_SSL_SMALL_RECORD_SIZE, impl->buffer_size)
+          : impl->buffer_size;
+}
+
 static tsi_result ssl_protector_protect(tsi_frame_protector* self,
                                         const unsigned char* unprotected_bytes,
                                         size_t* unprotected_bytes_size,
@@ -1381,10 +1488,12 @@ static tsi_result ssl_protector_protect(tsi_frame_protector* self,
   tsi_ssl_frame_protector* impl =
       reinterpret_cast<tsi_ssl_frame_protector*>(self);
   gpr_mu_lock(&impl->mu);
+  if (impl->buffer_offset == 0) ssl_protector_update_record_size(impl);
   tsi_result result = grpc_core::SslProtectorProtect(
-      unprotected_bytes, impl->buffer_size, impl->buffer_offset, impl->buffer,
+      unprotected_bytes, impl->record_size, impl->buffer_offset, impl->buffer,
       impl->ssl, impl->network_io, unprotected_bytes_size,
       protected_output_frames, protected_output_frames_size);
+  if (result == TSI_OK) impl->bytes_since_idle += *unprotected_bytes_size;
   gpr_mu_unlock(&impl->mu);
   return result;
 }
@@ -1395,6 +1504,7 @@ static tsi_result ssl_protector_protect_flush(
   tsi_ssl_frame_protector* impl =
       reinterpret_cast<tsi_ssl_frame_protector*>(self);
   gpr_mu_lock(&impl->mu);
+  impl->last_activity = gpr_now(GPR_CLOCK_MONOTONIC);
   tsi_result result = grpc_core::SslProtectorProtectFlush(
       impl->buffer_offset, impl->buffer, impl->ssl, impl->network_io,
       protected_output_frames, protected_output_frames_size,
@@ -1616,6 +1726,8 @@ static tsi_result ssl_handshaker_result_create_frame_protector(
   }
   protector_impl->buffer_size =
       actual_max_output_protected_frame_size - TSI_SSL_MAX_PROTECTION_OVERHEAD;
+  protector_impl->record_size = protector_impl->buffer_size;
+  protector_impl->last_activity = gpr_now(GPR_CLOCK_MONOTONIC);
   protector_impl->buffer =
       static_cast<unsigned char*>(gpr_malloc(protector_impl->buffer_size));
   if (protector_impl->buffer == nullptr) {
@@ -1645,6 +1757,81 @@ static tsi_result ssl_handshaker_result_get_unused_bytes(
   return TSI_OK;
 }
 
+#if defined(OPENSSL_IS_BORINGSSL)
+static void store_be64(uint64_t value, unsigned char out[8]) {
+  for (int i = 7; i >= 0; i--) {
+    out[i] = static_cast<unsigned char>(value & 0xff);
+    value >>= 8;
+  }
+}
+#endif  // defined(OPENSSL_IS_BORINGSSL)
+
+// Only TLS 1.2 AES-GCM sessions negotiated with BoringSSL can be exported.
+// TLS 1.3 is not supported because its post-handshake messages (session
+// tickets and key updates) would have to be handled after the kernel has
+// taken over the receive path.
+static tsi_result ssl_handshaker_result_get_ktls_crypto_info(
+    const tsi_handshaker_result* self, tsi_ktls_crypto_info* crypto_info) {
+#if defined(OPENSSL_IS_BORINGSSL)
+  const tsi_ssl_handshaker_result* impl =
+      reinterpret_cast<const tsi_ssl_handshaker_result*>(self);
+  SSL* ssl = impl->ssl;
+  if (ssl == nullptr || SSL_version(ssl) != TLS1_2_VERSION ||
+      SSL_pending(ssl) > 0) {
+    return TSI_UNIMPLEMENTED;
+  }
+  const SSL_CIPHER* cipher = SSL_get_current_cipher(ssl);
+  if (cipher == nullptr) return TSI_UNIMPLEMENTED;
+  size_t key_size;
+  switch (SSL_CIPHER_get_cipher_nid(cipher)) {
+    case NID_aes_128_gcm:
+      crypto_info->cipher = TSI_KTLS_CIPHER_AES_128_GCM;
+      key_size = 16;
+      break;
+    case NID_aes_256_gcm:
+      crypto_info->cipher = TSI_KTLS_CIPHER_AES_256_GCM;
+      key_size = 32;
+      break;
+    default:
+      return TSI_UNIMPLEMENTED;
+  }
+  // For AEAD ciphers the key block has no MAC keys and is laid out as
+  // client_write_key | server_write_key | client_write_IV | server_write_IV.
+  constexpr size_t kSaltSize = 4;
+  unsigned char key_block[2 * (32 + kSaltSize)];
+  const size_t key_block_size = SSL_get_key_block_len(ssl);
+  if (key_block_size != 2 * (key_size + kSaltSize) ||
+      !SSL_generate_key_block(ssl, key_block, key_block_size)) {
+    OPENSSL_cleanse(key_block, sizeof(key_block));
+    return TSI_UNIMPLEMENTED;
+  }
+  const unsigned char* client_key = key_block;
+  const unsigned char* server_key = client_key + key_size;
+  const unsigned char* client_salt = server_key + key_size;
+  const unsigned char* server_salt = client_salt + kSaltSize;
+  const bool is_server = SSL_is_server(ssl);
+  crypto_info->version = TSI_TLS1_2;
+  crypto_info->key_size = key_size;
+  memcpy(crypto_info->tx_key, is_server ? server_key : client_key, key_size);
+  memcpy(crypto_info->rx_key, is_server ? client_key : server_key, key_size);
+  memcpy(crypto_info->tx_salt, is_server ? server_salt : client_salt,
+         kSaltSize);
+  memcpy(crypto_info->rx_salt, is_server ? client_salt : server_salt,
+         kSaltSize);
+  OPENSSL_cleanse(key_block, sizeof(key_block));
+  // BoringSSL uses the record sequence number as the explicit nonce.
+  store_be64(SSL_get_write_sequence(ssl), crypto_info->tx_rec_seq);
+  store_be64(SSL_get_read_sequence(ssl), crypto_info->rx_rec_seq);
+  memcpy(crypto_info->tx_iv, crypto_info->tx_rec_seq, 8);
+  memcpy(crypto_info->rx_iv, crypto_info->rx_rec_seq, 8);
+  return TSI_OK;
+#else
+  (void)self;
+  (void)crypto_info;
+  return TSI_UNIMPLEMENTED;
+#endif  // defined(OPENSSL_IS_BORINGSSL)
+}
+
 static void ssl_handshaker_result_destroy(tsi_handshaker_result* self) {
   tsi_ssl_handshaker_result* impl =
       reinterpret_cast<tsi_ssl_handshaker_result*>(self);
@@ -1661,6 +1848,7 @@ static const tsi_handshaker_result_vtable handshaker_result_vtable = {
     ssl_handshaker_result_create_frame_protector,
     ssl_handshaker_result_get_unused_bytes,
     ssl_handshaker_result_destroy,
+    ssl_handshaker_result_get_ktls_crypto_info,
 };
 
 static tsi_result ssl_handshaker_result_create(
@@ -1937,6 +2125,16 @@ static tsi_result ssl_handshaker_next(tsi_handshaker* self,
       // Indicates that the handshake has completed and that a
       // handshaker_result has been created.
       self->handshaker_result_created = true;
+      SSL* ssl =
+          reinterpret_cast<tsi_ssl_handshaker_result*>(*handshaker_result)
+              ->ssl;
+      if (SSL_is_server(ssl)) {
+        if (SSL_session_reused(ssl)) {
+          grpc_core::global_stats().IncrementSslServerResumedHandshakes();
+        } else {
+          grpc_core::global_stats().IncrementSslServerFullHandshakes();
+        }
+      }
       // Output Cipher information
       if (GRPC_TRACE_FLAG_ENABLED(tsi)) {
         tsi_ssl_handshaker_result* result =
@@ -2155,6 +2353,7 @@ static void tsi_ssl_client_handshaker_factory_destroy(
   if (self->alpn_protocol_list != nullptr) gpr_free(self->alpn_protocol_list);
   self->session_cache.reset();
   self->key_logger.reset();
+  self->verified_chain_cache.reset();
   gpr_free(self);
 }
 
@@ -2205,6 +2404,8 @@ static void tsi_ssl_server_handshaker_factory_destroy(
   }
   if (self->alpn_protocol_list != nullptr) gpr_free(self->alpn_protocol_list);
   self->key_logger.reset();
+  self->session_ticket_keys.reset();
+  self->verified_chain_cache.reset();
   gpr_free(self);
 }
 
@@ -2316,6 +2517,67 @@ static void ssl_keylogging_callback(const SSL* ssl, const char* info) {
   factory->key_logger->LogSessionKeys(ssl_context, info);
 }
 
+/// This callback is invoked at the server to pick the keys a session ticket
+/// is encrypted or decrypted with when the session ticket keys are rotated.
+/// Returns 1 on success, 2 if a ticket decrypted with an old key should be
+/// renewed, 0 if no key decrypts the ticket, and -1 on error.
+#if defined(OPENSSL_IS_BORINGSSL) || OPENSSL_VERSION_NUMBER < 0x30000000
+static int ssl_session_ticket_key_callback(SSL* ssl, unsigned char* key_name,
+                                           unsigned char* iv,
+                                           EVP_CIPHER_CTX* cipher_ctx,
+                                           HMAC_CTX* hmac_ctx, int encrypt) {
+#else
+static int ssl_session_ticket_key_callback(SSL* ssl, unsigned char* key_name,
+                                           unsigned char* iv,
+                                           EVP_CIPHER_CTX* cipher_ctx,
+                                           EVP_MAC_CTX* hmac_ctx,
+                                           int encrypt) {
+#endif
+  auto* keys = static_cast<tsi::TlsSessionTicketKeys*>(SSL_CTX_get_ex_data(
+      SSL_get_SSL_CTX(ssl), g_ssl_ctx_ex_session_ticket_keys_index));
+  if (keys == nullptr) return -1;
+  tsi::TlsSessionTicketKeys::Key key;
+  int result = 1;
+  if (encrypt) {
+    if (!keys->GetEncryptionKey(&key)) return -1;
+    memcpy(key_name, key.name, tsi::TlsSessionTicketKeys::kKeyNameSize);
+    if (RAND_bytes(iv, EVP_CIPHER_iv_length(EVP_aes_256_cbc())) != 1 ||
+        EVP_EncryptInit_ex(cipher_ctx, EVP_aes_256_cbc(), nullptr, key.aes_key,
+                           iv) != 1) {
+      result = -1;
+    }
+  } else {
+    bool is_current = false;
+    if (!keys->GetDecryptionKey(key_name, &key, &is_current)) return 0;
+    if (EVP_DecryptInit_ex(cipher_ctx, EVP_aes_256_cbc(), nullptr, key.aes_key,
+                           iv) != 1) {
+      result = -1;
+    } else if (!is_current) {
+      result = 2;
+    }
+  }
+  if (result != -1) {
+#if defined(OPENSSL_IS_BORINGSSL) || OPENSSL_VERSION_NUMBER < 0x30000000
+    if (HMAC_Init_ex(hmac_ctx, key.hmac_secret,
+                     tsi::TlsSessionTicketKeys::kHmacSecretSize, EVP_sha256(),
+                     nullptr) != 1) {
+      result = -1;
+    }
+#else
+    OSSL_PARAM params[3];
+    params[0] = OSSL_PARAM_construct_octet_string(
+        OSSL_MAC_PARAM_KEY, key.hmac_secret,
+        tsi::TlsSessionTicketKeys::kHmacSecretSize);
+    params[1] = OSSL_PARAM_construct_utf8_string(
+        OSSL_MAC_PARAM_DIGEST, const_cast<char*>("SHA256"), 0);
+    params[2] = OSSL_PARAM_construct_end();
+    if (EVP_MAC_CTX_set_params(hmac_ctx, params) != 1) result = -1;
+#endif
+  }
+  OPENSSL_cleanse(&key, sizeof(key));
+  return result;
+}
+
 // --- tsi_ssl_handshaker_factory constructors. ---
 
 static tsi_ssl_handshaker_factory_vtable client_handshaker_factory_vtable = {
@@ -2467,6 +2729,12 @@ tsi_result tsi_create_ssl_client_handshaker_factory_with_options(
   } else {
     SSL_CTX_set_cert_verify_callback(ssl_context, CustomVerificationFunction,
                                      nullptr);
+    if (UseVerifiedChainCache(options->crl_directory)) {
+      impl->verified_chain_cache =
+          grpc_core::MakeRefCounted<tsi::VerifiedChainCache>();
+      SSL_CTX_set_ex_data(ssl_context, g_ssl_ctx_ex_verified_chain_cache_index,
+                          impl->verified_chain_cache.get());
+    }
   }
 #if OPENSSL_VERSION_NUMBER >= 0x10100000 && !defined(LIBRESSL_VERSION_NUMBER)
   if (options->crl_provider != nullptr) {
@@ -2571,6 +2839,24 @@ tsi_result tsi_create_ssl_server_handshaker_factory_with_options(
     impl->key_logger = options->key_logger->Ref();
   }
 
+  if (options->session_ticket_keys != nullptr) {
+    if (options->session_ticket_keys->HasKeys()) {
+      impl->session_ticket_keys = options->session_ticket_keys->Ref();
+    } else {
+      LOG(ERROR) << "No TLS session ticket keys loaded, session tickets will "
+                    "be encrypted with a key of this process only.";
+    }
+  }
+
+  if ((options->client_certificate_request ==
+           TSI_REQUEST_CLIENT_CERTIFICATE_AND_VERIFY ||
+       options->client_certificate_request ==
+           TSI_REQUEST_AND_REQUIRE_CLIENT_CERTIFICATE_AND_VERIFY) &&
+      UseVerifiedChainCache(options->crl_directory)) {
+    impl->verified_chain_cache =
+        grpc_core::MakeRefCounted<tsi::VerifiedChainCache>();
+  }
+
   for (i = 0; i < options->num_key_cert_pairs; i++) {
     do {
 #if OPENSSL_VERSION_NUMBER >= 0x10100000
@@ -2610,7 +2896,18 @@ tsi_result tsi_create_ssl_server_handshaker_factory_with_options(
         break;
       }
 
-      if (options->session_ticket_key != nullptr) {
+      if (impl->session_ticket_keys != nullptr) {
+        SSL_CTX_set_ex_data(impl->ssl_contexts[i],
+                            g_ssl_ctx_ex_session_ticket_keys_index,
+                            impl->session_ticket_keys.get());
+#if defined(OPENSSL_IS_BORINGSSL) || OPENSSL_VERSION_NUMBER < 0x30000000
+        SSL_CTX_set_tlsext_ticket_key_cb(impl->ssl_contexts[i],
+                                         ssl_session_ticket_key_callback);
+#else
+        SSL_CTX_set_tlsext_ticket_key_evp_cb(impl->ssl_contexts[i],
+                                             ssl_session_ticket_key_callback);
+#endif
+      } else if (options->session_ticket_key != nullptr) {
         if (SSL_CTX_set_tlsext_ticket_keys(
                 impl->ssl_contexts[i],
                 const_cast<char*>(options->session_ticket_key),
@@ -2664,6 +2961,11 @@ tsi_result tsi_create_ssl_server_handshaker_factory_with_options(
                                            CustomVerificationFunction, nullptr);
           break;
       }
+      if (impl->verified_chain_cache != nullptr) {
+        SSL_CTX_set_ex_data(impl->ssl_contexts[i],
+                            g_ssl_ctx_ex_verified_chain_cache_index,
+                            impl->verified_chain_cache.get());
+      }
 
 #if OPENSSL_VERSION_NUMBER >= 0x10100000 && !defined(LIBRESSL_VERSION_NUMBER)
       if (options->crl_provider != nullptr) {
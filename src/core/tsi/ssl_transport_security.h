@@ -28,6 +28,7 @@
 
 #include "absl/strings/string_view.h"
 #include "src/core/tsi/ssl/key_logging/ssl_key_logging.h"
+#include "src/core/tsi/ssl/session_ticket/ssl_session_ticket_keys.h"
 #include "src/core/tsi/ssl_transport_security_utils.h"
 #include "src/core/tsi/transport_security_interface.h"
 
@@ -330,6 +331,10 @@ struct tsi_ssl_server_handshaker_options {
   const char* session_ticket_key;
   // session_ticket_key_size is a size of session ticket encryption key.
   size_t session_ticket_key_size;
+  // session_ticket_keys, if set, rotates the keys session tickets are
+  // encrypted with, so that servers sharing the keys can resume each other's
+  // sessions. It takes precedence over session_ticket_key if it has keys.
+  tsi::TlsSessionTicketKeys* session_ticket_keys;
   // The min and max TLS versions that will be negotiated by the handshaker.
   tsi_tls_version min_tls_version;
   tsi_tls_version max_tls_version;
@@ -370,6 +375,7 @@ struct tsi_ssl_server_handshaker_options {
         num_alpn_protocols(0),
         session_ticket_key(nullptr),
         session_ticket_key_size(0),
+        session_ticket_keys(nullptr),
         min_tls_version(tsi_tls_version::TSI_TLS1_2),
         max_tls_version(tsi_tls_version::TSI_TLS1_3),
         key_logger(nullptr),
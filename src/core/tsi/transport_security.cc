@@ -291,6 +291,15 @@ tsi_result tsi_handshaker_result_get_unused_bytes(
   return self->vtable->get_unused_bytes(self, bytes, bytes_size);
 }
 
+tsi_result tsi_handshaker_result_get_ktls_crypto_info(
+    const tsi_handshaker_result* self, tsi_ktls_crypto_info* crypto_info) {
+  if (self == nullptr || self->vtable == nullptr || crypto_info == nullptr) {
+    return TSI_INVALID_ARGUMENT;
+  }
+  if (self->vtable->get_ktls_crypto_info == nullptr) return TSI_UNIMPLEMENTED;
+  return self->vtable->get_ktls_crypto_info(self, crypto_info);
+}
+
 void tsi_handshaker_result_destroy(tsi_handshaker_result* self) {
   if (self == nullptr) return;
   self->vtable->destroy(self);
@@ -118,6 +118,9 @@ struct tsi_handshaker_result_vtable {
                                  const unsigned char** bytes,
                                  size_t* bytes_size);
   void (*destroy)(tsi_handshaker_result* self);
+  // May be null if the implementation cannot export its record layer state.
+  tsi_result (*get_ktls_crypto_info)(const tsi_handshaker_result* self,
+                                     tsi_ktls_crypto_info* crypto_info);
 };
 struct tsi_handshaker_result {
   const tsi_handshaker_result_vtable* vtable;
@@ -92,6 +92,29 @@ typedef enum {
   TSI_TLS1_3,
 } tsi_tls_version;
 
+typedef enum {
+  TSI_KTLS_CIPHER_AES_128_GCM,
+  TSI_KTLS_CIPHER_AES_256_GCM,
+} tsi_ktls_cipher;
+
+// Record layer state negotiated by a TLS handshake, in the form expected by
+// the kernel TLS (kTLS) socket options. tx_* is used to protect the records
+// sent to the peer and rx_* to unprotect the records received from it.
+// Sequence numbers are big endian.
+typedef struct {
+  tsi_tls_version version;
+  tsi_ktls_cipher cipher;
+  unsigned char tx_key[32];
+  unsigned char rx_key[32];
+  size_t key_size;
+  unsigned char tx_salt[4];
+  unsigned char rx_salt[4];
+  unsigned char tx_iv[8];
+  unsigned char rx_iv[8];
+  unsigned char tx_rec_seq[8];
+  unsigned char rx_rec_seq[8];
+} tsi_ktls_crypto_info;
+
 const char* tsi_result_to_string(tsi_result result);
 const char* tsi_security_level_to_string(tsi_security_level security_level);
 
@@ -279,6 +302,16 @@ tsi_result tsi_handshaker_result_get_unused_bytes(
     const tsi_handshaker_result* self, const unsigned char** bytes,
     size_t* bytes_size);
 
+// This method exports the negotiated record layer state so that record
+// protection can be offloaded to the kernel instead of a frame protector.
+// It returns TSI_UNIMPLEMENTED if the implementation or the negotiated
+// session does not support it, in which case the caller must fall back to a
+// frame protector. On success, the caller takes over the protection of all
+// further records in both directions and must not create a frame protector.
+// The caller is responsible for wiping the keys in crypto_info after use.
+tsi_result tsi_handshaker_result_get_ktls_crypto_info(
+    const tsi_handshaker_result* self, tsi_ktls_crypto_info* crypto_info);
+
 // This method releases the tsi_handshaker_handshaker object. After this method
 // is called, no other method can be called on the object.
 void tsi_handshaker_result_destroy(tsi_handshaker_result* self);
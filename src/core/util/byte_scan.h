@@ -0,0 +1,59 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_UTIL_BYTE_SCAN_H
+#define GRPC_SRC_CORE_UTIL_BYTE_SCAN_H
+
+#include <grpc/support/port_platform.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <cstddef>
+
+#include "absl/strings/string_view.h"
+
+namespace grpc_core {
+
+// Returns the length of the longest prefix of \a s made of printable ASCII
+// (0x20 to 0x7e) other than \a stop.  Metadata values and status messages
+// are nearly always printable ASCII throughout, so this checks eight bytes
+// per step, and only looks at single bytes once a word fails the check.
+inline size_t PrintableAsciiPrefixLength(absl::string_view s,
+                                         char stop = '\0') {
+  constexpr uint64_t kOnes = 0x0101010101010101;
+  constexpr uint64_t kHighBits = 0x8080808080808080;
+  const uint64_t stops = kOnes * static_cast<uint8_t>(stop);
+  size_t i = 0;
+  for (; i + sizeof(uint64_t) <= s.size(); i += sizeof(uint64_t)) {
+    uint64_t word;
+    memcpy(&word, s.data() + i, sizeof(word));
+    // The high bit of a byte ends up set if the byte is below 0x20, above
+    // 0x7e, or equal to stop.  Carries between bytes can only come from a
+    // byte that already failed, so the word as a whole is judged exactly.
+    const uint64_t below_space = (word - kOnes * 0x20) & ~word;
+    const uint64_t above_tilde = (word + kOnes) | word;
+    const uint64_t x = word ^ stops;
+    const uint64_t is_stop = (x - kOnes) & ~x;
+    if (((below_space | above_tilde | is_stop) & kHighBits) != 0) break;
+  }
+  for (; i < s.size(); ++i) {
+    const uint8_t c = static_cast<uint8_t>(s[i]);
+    if (c < 0x20 || c > 0x7e || c == static_cast<uint8_t>(stop)) break;
+  }
+  return i;
+}
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_UTIL_BYTE_SCAN_H
@@ -0,0 +1,51 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/util/codel.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace grpc_core {
+
+void Codel::RecordDelay(Duration delay, Timestamp now) {
+  MaybeEndInterval(now);
+  min_delay_ = std::min(min_delay_, delay);
+}
+
+bool Codel::Reject(Timestamp now) {
+  MaybeEndInterval(now);
+  if (!dropping_ || now < next_drop_) return false;
+  ++drop_count_;
+  next_drop_ = now + interval_ * (1.0 / std::sqrt(drop_count_));
+  return true;
+}
+
+void Codel::MaybeEndInterval(Timestamp now) {
+  if (now < interval_end_) return;
+  // An interval in which nothing left the queue says nothing about its
+  // delay, so stop dropping rather than guess.
+  const bool bad = min_delay_ != Duration::Infinity() && min_delay_ > target_;
+  if (bad && !dropping_) {
+    drop_count_ = 0;
+    next_drop_ = now;
+  }
+  dropping_ = bad;
+  min_delay_ = Duration::Infinity();
+  interval_end_ = now + interval_;
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,70 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_UTIL_CODEL_H
+#define GRPC_SRC_CORE_UTIL_CODEL_H
+
+#include <grpc/support/port_platform.h>
+
+#include <cstdint>
+
+#include "src/core/util/time.h"
+
+namespace grpc_core {
+
+// Implements the CoDel (controlled delay) algorithm as an admission
+// controller: the queue reports how long each item waited, and new
+// arrivals are rejected while the smallest wait seen over an interval stays
+// above a target.  Rejections are spaced out by the CoDel control law, so
+// their rate grows for as long as the queue stays bad.
+//
+// Not thread safe.
+class Codel {
+ public:
+  Codel(Duration target, Duration interval)
+      : target_(target), interval_(interval) {}
+
+  // Records that an item left the queue at now after waiting for delay.
+  void RecordDelay(Duration delay, Timestamp now);
+
+  // Returns true if an item arriving at now should be rejected instead of
+  // queued.
+  bool Reject(Timestamp now);
+
+  // Returns true while the queue shows a standing delay above the target.
+  bool dropping() const { return dropping_; }
+
+  Duration target() const { return target_; }
+  Duration interval() const { return interval_; }
+
+ private:
+  // Decides whether to drop for the next interval once now passes the end
+  // of the current one.
+  void MaybeEndInterval(Timestamp now);
+
+  const Duration target_;
+  const Duration interval_;
+  // The end of the interval whose delays are being watched.
+  Timestamp interval_end_ = Timestamp::InfPast();
+  // The smallest delay recorded in the current interval.
+  Duration min_delay_ = Duration::Infinity();
+  bool dropping_ = false;
+  // Rejections since the queue last went bad, and when the next is due.
+  uint64_t drop_count_ = 0;
+  Timestamp next_drop_ = Timestamp::InfPast();
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_UTIL_CODEL_H
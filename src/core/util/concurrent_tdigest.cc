@@ -0,0 +1,44 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/util/concurrent_tdigest.h"
+
+#include <grpc/support/port_platform.h>
+
+namespace grpc_core {
+
+ConcurrentTDigest::ConcurrentTDigest(double compression)
+    : compression_(compression) {
+  for (Shard& shard : shards_) {
+    MutexLock lock(&shard.mu);
+    shard.digest.Reset(compression_);
+  }
+}
+
+void ConcurrentTDigest::Add(double value) {
+  Shard& shard = shards_.this_cpu();
+  MutexLock lock(&shard.mu);
+  shard.digest.Add(value);
+}
+
+void ConcurrentTDigest::Collect(TDigest& out) {
+  for (Shard& shard : shards_) {
+    MutexLock lock(&shard.mu);
+    if (shard.digest.Count() == 0) continue;
+    out.Merge(shard.digest);
+    shard.digest.Reset(compression_);
+  }
+}
+
+}  // namespace grpc_core
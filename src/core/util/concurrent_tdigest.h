@@ -0,0 +1,57 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_UTIL_CONCURRENT_TDIGEST_H
+#define GRPC_SRC_CORE_UTIL_CONCURRENT_TDIGEST_H
+
+#include <grpc/support/port_platform.h>
+
+#include "absl/base/thread_annotations.h"
+#include "src/core/util/per_cpu.h"
+#include "src/core/util/sync.h"
+#include "src/core/util/tdigest.h"
+
+namespace grpc_core {
+
+// A t-digest that many threads can add values to at once.
+//
+// Each value goes into a per-cpu shard, so that adding values only contends
+// with other threads on the same shard; the shards are merged when the digest
+// is collected.
+class ConcurrentTDigest {
+ public:
+  explicit ConcurrentTDigest(double compression);
+
+  ConcurrentTDigest(const ConcurrentTDigest&) = delete;
+  ConcurrentTDigest& operator=(const ConcurrentTDigest&) = delete;
+
+  void Add(double value);
+
+  // Merges the values added since the last collection into out, and forgets
+  // them here.
+  void Collect(TDigest& out);
+
+ private:
+  struct Shard {
+    Mutex mu;
+    TDigest digest ABSL_GUARDED_BY(mu){0};
+  };
+
+  const double compression_;
+  PerCpu<Shard> shards_{PerCpuOptions().SetMaxShards(16)};
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_UTIL_CONCURRENT_TDIGEST_H
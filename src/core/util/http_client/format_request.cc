@@ -54,21 +54,22 @@ static void fill_common_header(const grpc_http_request* request,
 }
 
 grpc_slice grpc_httpcli_format_get_request(const grpc_http_request* request,
-                                           const char* host, const char* path) {
+                                           const char* host, const char* path,
+                                           bool keep_alive) {
   std::vector<std::string> out;
   out.push_back("GET ");
-  fill_common_header(request, host, path, true, &out);
+  fill_common_header(request, host, path, !keep_alive, &out);
   out.push_back("\r\n");
   std::string req = absl::StrJoin(out, "");
   return grpc_slice_from_copied_buffer(req.data(), req.size());
 }
 
 grpc_slice grpc_httpcli_format_post_request(const grpc_http_request* request,
-                                            const char* host,
-                                            const char* path) {
+                                            const char* host, const char* path,
+                                            bool keep_alive) {
   std::vector<std::string> out;
   out.push_back("POST ");
-  fill_common_header(request, host, path, true, &out);
+  fill_common_header(request, host, path, !keep_alive, &out);
   if (request->body != nullptr) {
     bool has_content_type = false;
     for (size_t i = 0; i < request->hdr_count; i++) {
@@ -94,10 +95,11 @@ grpc_slice grpc_httpcli_format_post_request(const grpc_http_request* request,
 }
 
 grpc_slice grpc_httpcli_format_put_request(const grpc_http_request* request,
-                                           const char* host, const char* path) {
+                                           const char* host, const char* path,
+                                           bool keep_alive) {
   std::vector<std::string> out;
   out.push_back("PUT ");
-  fill_common_header(request, host, path, true, &out);
+  fill_common_header(request, host, path, !keep_alive, &out);
   if (request->body != nullptr) {
     bool has_content_type = false;
     for (size_t i = 0; i < request->hdr_count; i++) {
@@ -24,12 +24,17 @@
 
 #include "src/core/util/http_client/parser.h"
 
+// Unless \a keep_alive is true, the request asks the server to close the
+// connection once it has responded.
 grpc_slice grpc_httpcli_format_get_request(const grpc_http_request* request,
-                                           const char* host, const char* path);
+                                           const char* host, const char* path,
+                                           bool keep_alive = false);
 grpc_slice grpc_httpcli_format_post_request(const grpc_http_request* request,
-                                            const char* host, const char* path);
+                                            const char* host, const char* path,
+                                            bool keep_alive = false);
 grpc_slice grpc_httpcli_format_put_request(const grpc_http_request* request,
-                                           const char* host, const char* path);
+                                           const char* host, const char* path,
+                                           bool keep_alive = false);
 grpc_slice grpc_httpcli_format_connect_request(const grpc_http_request* request,
                                                const char* host,
                                                const char* path);
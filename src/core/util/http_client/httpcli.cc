@@ -24,12 +24,15 @@
 #include <grpc/support/port_platform.h>
 #include <limits.h>
 
+#include <map>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "absl/functional/bind_front.h"
 #include "absl/log/check.h"
 #include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
 #include "absl/strings/str_format.h"
 #include "src/core/config/core_configuration.h"
 #include "src/core/credentials/transport/security_connector.h"
@@ -65,6 +68,107 @@ grpc_httpcli_post_override g_post_override;
 grpc_httpcli_put_override g_put_override;
 void (*g_test_only_on_handshake_done_intercept)(HttpRequest* req);
 
+// How long an idle connection is kept for reuse, and how many are kept per
+// pool key.
+constexpr Duration kIdleConnectionTimeout = Duration::Seconds(30);
+constexpr size_t kMaxIdleConnectionsPerKey = 4;
+
+// Connections left open by the server after a complete response, waiting
+// for the next request with the same pool key. Nothing reads from an idle
+// connection, so one the server has closed is only noticed when reused.
+class ConnectionPool {
+ public:
+  OrphanablePtr<grpc_endpoint> Take(const std::string& key) {
+    std::vector<OrphanablePtr<grpc_endpoint>> expired;
+    OrphanablePtr<grpc_endpoint> endpoint;
+    {
+      MutexLock lock(&mu_);
+      RemoveExpiredLocked(&expired);
+      auto it = idle_.find(key);
+      if (it != idle_.end()) {
+        // Take the most recently used connection, the least likely to have
+        // been closed by the server.
+        endpoint = std::move(it->second.back().endpoint);
+        it->second.pop_back();
+        if (it->second.empty()) idle_.erase(it);
+      }
+    }
+    return endpoint;
+  }
+
+  void Put(const std::string& key, OrphanablePtr<grpc_endpoint> endpoint) {
+    std::vector<OrphanablePtr<grpc_endpoint>> expired;
+    MutexLock lock(&mu_);
+    RemoveExpiredLocked(&expired);
+    std::vector<IdleConnection>& connections = idle_[key];
+    if (connections.size() == kMaxIdleConnectionsPerKey) {
+      expired.push_back(std::move(connections.front().endpoint));
+      connections.erase(connections.begin());
+    }
+    connections.push_back(
+        {std::move(endpoint), Timestamp::Now() + kIdleConnectionTimeout});
+  }
+
+  // Closes every idle connection.
+  void Clear() {
+    std::map<std::string, std::vector<IdleConnection>> idle;
+    {
+      MutexLock lock(&mu_);
+      idle.swap(idle_);
+    }
+  }
+
+ private:
+  struct IdleConnection {
+    OrphanablePtr<grpc_endpoint> endpoint;
+    Timestamp expiry;
+  };
+
+  // Moves the connections that have been idle for too long to \a expired,
+  // so that the caller destroys them after releasing mu_.
+  void RemoveExpiredLocked(std::vector<OrphanablePtr<grpc_endpoint>>* expired)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    const Timestamp now = Timestamp::Now();
+    for (auto it = idle_.begin(); it != idle_.end();) {
+      std::vector<IdleConnection>& connections = it->second;
+      // Connections are kept oldest first.
+      size_t num_expired = 0;
+      while (num_expired < connections.size() &&
+             connections[num_expired].expiry <= now) {
+        expired->push_back(std::move(connections[num_expired].endpoint));
+        ++num_expired;
+      }
+      connections.erase(connections.begin(),
+                        connections.begin() + num_expired);
+      if (connections.empty()) {
+        idle_.erase(it++);
+      } else {
+        ++it;
+      }
+    }
+  }
+
+  Mutex mu_;
+  std::map<std::string, std::vector<IdleConnection>> idle_
+      ABSL_GUARDED_BY(mu_);
+};
+
+ConnectionPool* g_connection_pool = new ConnectionPool;
+
+// Returns the pool key for a request to \a uri, or an empty string if the
+// request must not share its connection. Only requests without channel
+// args, which could change how the connection is set up, and with
+// credentials that are the same for every request (insecure, or the
+// singleton CreateHttpRequestSSLCredentials()) share connections.
+std::string ConnectionPoolKey(const URI& uri,
+                              const grpc_channel_args* channel_args,
+                              const grpc_channel_credentials* channel_creds) {
+  if (channel_args != nullptr || channel_creds == nullptr) return "";
+  const absl::string_view creds_type = channel_creds->type().name();
+  if (creds_type != "Insecure" && creds_type != "HttpRequestSSL") return "";
+  return absl::StrCat(uri.scheme(), "://", uri.authority(), " ", creds_type);
+}
+
 }  // namespace
 
 OrphanablePtr<HttpRequest> HttpRequest::Get(
@@ -84,9 +188,11 @@ OrphanablePtr<HttpRequest> HttpRequest::Get(
   }
   std::string name =
       absl::StrFormat("HTTP:GET:%s:%s", uri.authority(), uri.path());
-  const grpc_slice request_text =
-      grpc_httpcli_format_get_request(request, uri.authority().c_str(),
-                                      uri.EncodedPathAndQueryParams().c_str());
+  const bool keep_alive =
+      !ConnectionPoolKey(uri, channel_args, channel_creds.get()).empty();
+  const grpc_slice request_text = grpc_httpcli_format_get_request(
+      request, uri.authority().c_str(),
+      uri.EncodedPathAndQueryParams().c_str(), keep_alive);
   return MakeOrphanable<HttpRequest>(
       std::move(uri), request_text, response, deadline, channel_args, on_done,
       pollent, name.c_str(), std::move(test_only_generate_response),
@@ -109,9 +215,11 @@ OrphanablePtr<HttpRequest> HttpRequest::Post(
   }
   std::string name =
       absl::StrFormat("HTTP:POST:%s:%s", uri.authority(), uri.path());
-  const grpc_slice request_text =
-      grpc_httpcli_format_post_request(request, uri.authority().c_str(),
-                                       uri.EncodedPathAndQueryParams().c_str());
+  const bool keep_alive =
+      !ConnectionPoolKey(uri, channel_args, channel_creds.get()).empty();
+  const grpc_slice request_text = grpc_httpcli_format_post_request(
+      request, uri.authority().c_str(),
+      uri.EncodedPathAndQueryParams().c_str(), keep_alive);
   return MakeOrphanable<HttpRequest>(
       std::move(uri), request_text, response, deadline, channel_args, on_done,
       pollent, name.c_str(), std::move(test_only_generate_response),
@@ -134,9 +242,11 @@ OrphanablePtr<HttpRequest> HttpRequest::Put(
   }
   std::string name =
       absl::StrFormat("HTTP:PUT:%s:%s", uri.authority(), uri.path());
-  const grpc_slice request_text =
-      grpc_httpcli_format_put_request(request, uri.authority().c_str(),
-                                      uri.EncodedPathAndQueryParams().c_str());
+  const bool keep_alive =
+      !ConnectionPoolKey(uri, channel_args, channel_creds.get()).empty();
+  const grpc_slice request_text = grpc_httpcli_format_put_request(
+      request, uri.authority().c_str(),
+      uri.EncodedPathAndQueryParams().c_str(), keep_alive);
   return MakeOrphanable<HttpRequest>(
       std::move(uri), request_text, response, deadline, channel_args, on_done,
       pollent, name.c_str(), std::move(test_only_generate_response),
@@ -151,6 +261,8 @@ void HttpRequest::SetOverride(grpc_httpcli_get_override get,
   g_put_override = put;
 }
 
+void HttpRequest::ShutdownConnectionPool() { g_connection_pool->Clear(); }
+
 void HttpRequest::TestOnlySetOnHandshakeDoneIntercept(
     void (*intercept)(HttpRequest* req)) {
   g_test_only_on_handshake_done_intercept = intercept;
@@ -171,6 +283,7 @@ HttpRequest::HttpRequest(
                         .ToC()
                         .release()),
       channel_creds_(std::move(channel_creds)),
+      pool_key_(ConnectionPoolKey(uri_, channel_args, channel_creds_.get())),
       on_done_(on_done),
       resource_quota_(ResourceQuotaFromChannelArgs(channel_args_)),
       pollent_(pollent),
@@ -220,6 +333,20 @@ void HttpRequest::Start() {
   if (test_only_generate_response_.has_value()) {
     if (test_only_generate_response_.value()()) return;
   }
+  if (!pool_key_.empty()) {
+    ep_ = g_connection_pool->Take(pool_key_);
+    if (ep_ != nullptr) {
+      // Let this request's pollers drive reads on the reused connection.
+      grpc_endpoint_add_to_pollset_set(ep_.get(), pollset_set_);
+      reused_connection_ = true;
+      StartWrite();
+      return;
+    }
+  }
+  Resolve();
+}
+
+void HttpRequest::Resolve() {
   if (use_event_engine_dns_resolver_ && !ee_resolver_.ok()) {
     Finish(ee_resolver_.status());
     return;
@@ -307,10 +434,20 @@ void HttpRequest::OnReadInternal(grpc_error_handle error) {
   if (cancelled_) {
     Finish(GRPC_ERROR_CREATE_REFERENCING("HTTP1 request cancelled during read",
                                          &overall_error_, 1));
+  } else if (grpc_http_parser_response_complete(&parser_)) {
+    // No need to wait for the server to close the connection. If it left
+    // the connection open, keep it for the next request.
+    if (error.ok() && !pool_key_.empty() &&
+        grpc_http_parser_response_keep_alive(&parser_)) {
+      // pollset_set_ is destroyed with this request.
+      grpc_endpoint_delete_from_pollset_set(ep_.get(), pollset_set_);
+      g_connection_pool->Put(pool_key_, std::move(ep_));
+    }
+    Finish(absl::OkStatus());
   } else if (error.ok()) {
     DoRead();
   } else if (!have_read_byte_) {
-    NextAddress(error);
+    OnConnectionFailed(error);
   } else {
     Finish(grpc_http_parser_eof(&parser_));
   }
@@ -323,10 +460,28 @@ void HttpRequest::ContinueDoneWriteAfterScheduleOnExecCtx(
   if (error.ok() && !req->cancelled_) {
     req->OnWritten();
   } else {
-    req->NextAddress(error);
+    req->OnConnectionFailed(error);
   }
 }
 
+void HttpRequest::OnConnectionFailed(grpc_error_handle error) {
+  if (!reused_connection_) {
+    NextAddress(error);
+    return;
+  }
+  reused_connection_ = false;
+  ep_.reset();
+  if (cancelled_) {
+    Finish(GRPC_ERROR_CREATE("HTTP request was cancelled"));
+    return;
+  }
+  GRPC_TRACE_LOG(http1, INFO)
+      << "Reused HTTP1 connection failed, retrying on a new connection: "
+      << StatusToString(error);
+  grpc_slice_buffer_reset_and_unref(&outgoing_);
+  Resolve();
+}
+
 void HttpRequest::StartWrite() {
   GRPC_TRACE_LOG(http1, INFO)
       << "Sending HTTP1 request: " << StringViewFromSlice(request_text_);
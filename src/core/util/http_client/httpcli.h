@@ -28,6 +28,7 @@
 #include <functional>
 #include <memory>
 #include <optional>
+#include <string>
 #include <vector>
 
 #include "absl/base/thread_annotations.h"
@@ -80,6 +81,9 @@ namespace grpc_core {
 // begins async work and calling \a Orphan() arranges for async work
 // to be completed as sooon as possible (possibly aborting the request
 // if it's in flight).
+// Requests made without channel args, over insecure or
+// CreateHttpRequestSSLCredentials() credentials, keep their connection
+// open, and a later request to the same host reuses it if it is still idle.
 // TODO(ctiller): allow caching and capturing multiple requests for the
 //                same content and combining them
 class HttpRequest : public InternallyRefCounted<HttpRequest> {
@@ -175,6 +179,10 @@ class HttpRequest : public InternallyRefCounted<HttpRequest> {
                           grpc_httpcli_post_override post,
                           grpc_httpcli_put_override put);
 
+  // Closes the connections kept open for reuse by later requests. Called
+  // from grpc_shutdown(), within an ExecCtx.
+  static void ShutdownConnectionPool();
+
   static void TestOnlySetOnHandshakeDoneIntercept(
       void (*intercept)(HttpRequest* req));
 
@@ -223,6 +231,14 @@ class HttpRequest : public InternallyRefCounted<HttpRequest> {
 
   void StartWrite() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
 
+  void Resolve() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  // Called when the connection fails before any response bytes arrive.
+  // Retries on a new connection if the failed one came from the pool, since
+  // the server may have closed it while it was idle.
+  void OnConnectionFailed(grpc_error_handle error)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
   void OnHandshakeDone(absl::StatusOr<HandshakerArgs*> result);
 
   void DoHandshake(
@@ -241,6 +257,9 @@ class HttpRequest : public InternallyRefCounted<HttpRequest> {
   const Timestamp deadline_;
   const grpc_channel_args* channel_args_;
   RefCountedPtr<grpc_channel_credentials> channel_creds_;
+  // Identifies the connections this request may share with others; empty if
+  // it must not share its connection.
+  const std::string pool_key_;
   grpc_closure on_read_;
   grpc_closure continue_on_read_after_schedule_on_exec_ctx_;
   grpc_closure done_write_;
@@ -254,6 +273,7 @@ class HttpRequest : public InternallyRefCounted<HttpRequest> {
   Mutex mu_;
   RefCountedPtr<HandshakeManager> handshake_mgr_ ABSL_GUARDED_BY(mu_);
   bool cancelled_ ABSL_GUARDED_BY(mu_) = false;
+  bool reused_connection_ ABSL_GUARDED_BY(mu_) = false;
   grpc_http_parser parser_ ABSL_GUARDED_BY(mu_);
   std::vector<grpc_event_engine::experimental::EventEngine::ResolvedAddress>
       addresses_ ABSL_GUARDED_BY(mu_);
@@ -27,6 +27,8 @@
 #include "absl/log/check.h"
 #include "absl/log/log.h"
 #include "absl/status/status.h"
+#include "absl/strings/match.h"
+#include "absl/strings/numbers.h"
 
 static char* buf2str(void* buffer, size_t length) {
   char* out = static_cast<char*>(gpr_malloc(length + 1));
@@ -64,6 +66,8 @@ static grpc_error_handle handle_response_line(grpc_http_parser* parser) {
   if (cur == end || *cur < '0' || *cur++ > '1') {
     return GRPC_ERROR_CREATE("Expected HTTP/1.0 or HTTP/1.1");
   }
+  // HTTP/1.1 connections are persistent unless the server says otherwise.
+  parser->keep_alive = cur[-1] == '1';
   if (cur == end || *cur++ != ' ') {
     return GRPC_ERROR_CREATE("Expected ' '");
   }
@@ -210,6 +214,17 @@ static grpc_error_handle add_header(grpc_http_parser* parser) {
       if ((strcmp(hdr.key, "Transfer-Encoding") == 0) &&
           (strcmp(hdr.value, "chunked") == 0)) {
         parser->http.response->chunked_state = GRPC_HTTP_CHUNKED_LENGTH;
+      } else if (absl::EqualsIgnoreCase(hdr.key, "Content-Length")) {
+        // An invalid length leaves the response framed by the connection
+        // closing, as if there were none.
+        parser->has_content_length =
+            absl::SimpleAtoi(hdr.value, &parser->content_length);
+      } else if (absl::EqualsIgnoreCase(hdr.key, "Connection")) {
+        if (absl::EqualsIgnoreCase(hdr.value, "close")) {
+          parser->keep_alive = false;
+        } else if (absl::EqualsIgnoreCase(hdr.value, "keep-alive")) {
+          parser->keep_alive = true;
+        }
       }
       break;
     case GRPC_HTTP_REQUEST:
@@ -269,9 +284,50 @@ static grpc_error_handle finish_line(grpc_http_parser* parser,
   return absl::OkStatus();
 }
 
+// Appends \a length bytes at \a data to the body of the message.
+static void append_body(grpc_http_parser* parser, const uint8_t* data,
+                        size_t length) {
+  size_t* body_length;
+  char** body;
+  if (parser->type == GRPC_HTTP_RESPONSE) {
+    body_length = &parser->http.response->body_length;
+    body = &parser->http.response->body;
+  } else {
+    body_length = &parser->http.request->body_length;
+    body = &parser->http.request->body;
+  }
+  if (*body_length + length > parser->body_capacity) {
+    parser->body_capacity =
+        std::max({size_t{8}, parser->body_capacity * 3 / 2,
+                  *body_length + length});
+    *body = static_cast<char*>(gpr_realloc(*body, parser->body_capacity));
+  }
+  memcpy(*body + *body_length, data, length);
+  *body_length += length;
+}
+
+// Appends as many of the \a length body bytes at \a data as can be taken
+// without looking at them: up to the end of the current chunk of a chunked
+// response, or all of them otherwise. Returns the number of bytes taken.
+static size_t append_body_run(grpc_http_parser* parser, const uint8_t* data,
+                              size_t length) {
+  if (parser->type == GRPC_HTTP_RESPONSE) {
+    switch (parser->http.response->chunked_state) {
+      case GRPC_HTTP_CHUNKED_PLAIN:
+        break;
+      case GRPC_HTTP_CHUNKED_BODY:
+        length = std::min(length, parser->http.response->chunk_length);
+        parser->http.response->chunk_length -= length;
+        break;
+      default:
+        return 0;
+    }
+  }
+  if (length > 0) append_body(parser, data, length);
+  return length;
+}
+
 static grpc_error_handle addbyte_body(grpc_http_parser* parser, uint8_t byte) {
-  size_t* body_length = nullptr;
-  char** body = nullptr;
 
   if (parser->type == GRPC_HTTP_RESPONSE) {
     switch (parser->http.response->chunked_state) {
@@ -324,22 +380,9 @@ static grpc_error_handle addbyte_body(grpc_http_parser* parser, uint8_t byte) {
         // avoiding warning; just fallback to normal codepath
         break;
     }
-    body_length = &parser->http.response->body_length;
-    body = &parser->http.response->body;
-  } else if (parser->type == GRPC_HTTP_REQUEST) {
-    body_length = &parser->http.request->body_length;
-    body = &parser->http.request->body;
-  } else {
-    GPR_UNREACHABLE_CODE(return GRPC_ERROR_CREATE("Should never reach here"));
   }
 
-  if (*body_length == parser->body_capacity) {
-    parser->body_capacity = std::max(size_t{8}, parser->body_capacity * 3 / 2);
-    *body = static_cast<char*>(gpr_realloc(*body, parser->body_capacity));
-  }
-  (*body)[*body_length] = static_cast<char>(byte);
-  (*body_length)++;
-
+  append_body(parser, &byte, 1);
   return absl::OkStatus();
 }
 
@@ -429,10 +472,17 @@ void grpc_http_response_destroy(grpc_http_response* response) {
 grpc_error_handle grpc_http_parser_parse(grpc_http_parser* parser,
                                          const grpc_slice& slice,
                                          size_t* start_of_body) {
-  for (size_t i = 0; i < GRPC_SLICE_LENGTH(slice); i++) {
+  const uint8_t* data = GRPC_SLICE_START_PTR(slice);
+  const size_t length = GRPC_SLICE_LENGTH(slice);
+  for (size_t i = 0; i < length; i++) {
+    // Copy runs of body bytes at once rather than byte by byte.
+    if (parser->state == GRPC_HTTP_BODY) {
+      const size_t run = append_body_run(parser, data + i, length - i);
+      i += run;
+      if (i == length) break;
+    }
     bool found_body_start = false;
-    grpc_error_handle err =
-        addbyte(parser, GRPC_SLICE_START_PTR(slice)[i], &found_body_start);
+    grpc_error_handle err = addbyte(parser, data[i], &found_body_start);
     if (!err.ok()) return err;
     if (found_body_start && start_of_body != nullptr) *start_of_body = i + 1;
   }
@@ -445,3 +495,20 @@ grpc_error_handle grpc_http_parser_eof(grpc_http_parser* parser) {
   }
   return absl::OkStatus();
 }
+
+bool grpc_http_parser_response_complete(const grpc_http_parser* parser) {
+  if (parser->type != GRPC_HTTP_RESPONSE) return false;
+  if (parser->state == GRPC_HTTP_END) return true;
+  return parser->state == GRPC_HTTP_BODY &&
+         parser->http.response->chunked_state == GRPC_HTTP_CHUNKED_PLAIN &&
+         parser->has_content_length &&
+         parser->http.response->body_length >= parser->content_length;
+}
+
+bool grpc_http_parser_response_keep_alive(const grpc_http_parser* parser) {
+  if (!parser->keep_alive || !grpc_http_parser_response_complete(parser)) {
+    return false;
+  }
+  return parser->state == GRPC_HTTP_END ||
+         parser->http.response->body_length == parser->content_length;
+}
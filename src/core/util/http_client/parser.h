@@ -105,6 +105,11 @@ struct grpc_http_parser {
   } http;
   size_t body_capacity;
   size_t hdr_capacity;
+  // Framing of a response, to tell when it is complete without waiting for
+  // the connection to close.
+  size_t content_length;
+  bool has_content_length;
+  bool keep_alive;
 
   uint8_t cur_line[GRPC_HTTP_PARSER_MAX_HEADER_LENGTH];
   size_t cur_line_length;
@@ -120,6 +125,14 @@ grpc_error_handle grpc_http_parser_parse(grpc_http_parser* parser,
                                          size_t* start_of_body);
 grpc_error_handle grpc_http_parser_eof(grpc_http_parser* parser);
 
+// Returns true if the response parsed so far is complete, as framed by its
+// Content-Length or chunked encoding.
+bool grpc_http_parser_response_complete(const grpc_http_parser* parser);
+// Returns true if the connection the response arrived on can carry another
+// request: the response is complete, nothing followed it, and the server did
+// not ask to close the connection.
+bool grpc_http_parser_response_keep_alive(const grpc_http_parser* parser);
+
 void grpc_http_request_destroy(grpc_http_request* request);
 void grpc_http_response_destroy(grpc_http_response* response);
 
@@ -0,0 +1,226 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/util/huge_page_allocator.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+#include <new>
+#include <utility>
+
+#include "absl/log/log.h"
+
+#ifdef GPR_LINUX
+#include <sys/mman.h>
+#endif
+
+namespace grpc_core {
+
+std::atomic<HugePageAllocator*> HugePageAllocator::instance_{nullptr};
+
+HugePageAllocator::HugePageAllocator(uintptr_t base, PerCpuOptions options,
+                                     size_t max_slabs, bool hugetlb)
+    : base_(base),
+      max_slabs_(max_slabs),
+      hugetlb_(hugetlb),
+      slabs_(new Slab[max_slabs]),
+      shards_(options) {
+  MutexLock lock(&idle_mu_);
+  idle_list_.reserve(max_slabs);
+}
+
+#ifdef GPR_LINUX
+
+namespace {
+
+// Whether the system has explicit huge pages reserved. Checked once, so that
+// slabs are not committed with MAP_HUGETLB when it can only fail.
+bool ProbeHugetlb() {
+  void* p =
+      mmap(nullptr, HugePageAllocator::kSlabSize, PROT_READ | PROT_WRITE,
+           MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+  if (p == MAP_FAILED) return false;
+  munmap(p, HugePageAllocator::kSlabSize);
+  return true;
+}
+
+}  // namespace
+
+HugePageAllocator* HugePageAllocator::Get() {
+  static HugePageAllocator* allocator = []() -> HugePageAllocator* {
+    PerCpuOptions options = PerCpuOptions().SetMaxShards(kMaxShards);
+    const size_t max_slabs = std::max(
+        kMinSlabs,
+        options.Shards() * kNumSizeClasses * kSlabsPerShardAndSizeClass);
+    // Reserve address space only; slabs are committed as they are needed.
+    const size_t reservation = (max_slabs + 1) * kSlabSize;
+    void* p = mmap(nullptr, reservation, PROT_NONE,
+                   MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (p == MAP_FAILED) {
+      LOG(ERROR) << "Failed to reserve address space for huge page slabs";
+      return nullptr;
+    }
+    // Slabs must be aligned to the huge page size.
+    const uintptr_t base =
+        (reinterpret_cast<uintptr_t>(p) + kSlabSize - 1) & ~(kSlabSize - 1);
+    auto* allocator =
+        new HugePageAllocator(base, options, max_slabs, ProbeHugetlb());
+    instance_.store(allocator, std::memory_order_release);
+    return allocator;
+  }();
+  return allocator;
+}
+
+bool HugePageAllocator::CommitSlab(uint32_t index) {
+  void* slab = SlabBase(index);
+  if (hugetlb_ &&
+      mmap(slab, kSlabSize, PROT_READ | PROT_WRITE,
+           MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED | MAP_HUGETLB, -1,
+           0) != MAP_FAILED) {
+    explicit_huge_pages_.store(true, std::memory_order_relaxed);
+    return true;
+  }
+  // Either there are no explicit huge pages, or the reserved ones ran out.
+  // A failed MAP_FIXED may already have unmapped the range, so map ordinary
+  // pages over it rather than relying on the reservation still being there,
+  // and mark them for transparent huge pages.
+  if (mmap(slab, kSlabSize, PROT_READ | PROT_WRITE,
+           MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED | MAP_NORESERVE, -1,
+           0) != MAP_FAILED) {
+    madvise(slab, kSlabSize, MADV_HUGEPAGE);
+    return true;
+  }
+  LOG(ERROR) << "Failed to commit a huge page slab";
+  // Keep the range reserved so that nothing else gets mapped into it.
+  mmap(slab, kSlabSize, PROT_NONE,
+       MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED | MAP_NORESERVE, -1, 0);
+  return false;
+}
+
+void HugePageAllocator::ReleaseSlab(uint32_t index) {
+  // The slab stays mapped, and reads back as zeros once it is touched again.
+  madvise(SlabBase(index), kSlabSize, MADV_DONTNEED);
+  MutexLock lock(&idle_mu_);
+  idle_list_.push_back(index);
+  idle_slabs_.fetch_add(1, std::memory_order_relaxed);
+}
+
+#else  // GPR_LINUX
+
+HugePageAllocator* HugePageAllocator::Get() { return nullptr; }
+
+bool HugePageAllocator::CommitSlab(uint32_t) { return false; }
+
+void HugePageAllocator::ReleaseSlab(uint32_t) {}
+
+#endif  // GPR_LINUX
+
+int HugePageAllocator::SizeClassFor(size_t size) {
+  if (size < kMinBlockSize / 2) return -1;
+  for (size_t i = 0; i < kNumSizeClasses; ++i) {
+    if (size <= BlockSize(i)) return i;
+  }
+  return -1;
+}
+
+bool HugePageAllocator::HasRoom(uint32_t index, size_t block_size) const {
+  const Slab& slab = slabs_[index];
+  if (slab.free_list != nullptr) return true;
+  return slab.next != nullptr &&
+         static_cast<size_t>(SlabBase(index) + kSlabSize - slab.next) >=
+             block_size;
+}
+
+uint32_t HugePageAllocator::TakeSlab(size_t size_class, uint32_t owner) {
+  uint32_t index = kNoSlab;
+  {
+    MutexLock lock(&idle_mu_);
+    if (!idle_list_.empty()) {
+      index = idle_list_.back();
+      idle_list_.pop_back();
+      idle_slabs_.fetch_sub(1, std::memory_order_relaxed);
+    }
+  }
+  if (index == kNoSlab) {
+    const size_t next = next_slab_.fetch_add(1, std::memory_order_relaxed);
+    if (next >= max_slabs_ || !CommitSlab(next)) return kNoSlab;
+    index = next;
+  }
+  Slab& slab = slabs_[index];
+  slab.owner.store(owner, std::memory_order_relaxed);
+  slab.size_class.store(size_class, std::memory_order_relaxed);
+  slab.free_list = nullptr;
+  slab.next = SlabBase(index);
+  slab.live = 0;
+  slab.partial = false;
+  return index;
+}
+
+void* HugePageAllocator::Alloc(size_t size) {
+  const int size_class = SizeClassFor(size);
+  if (size_class < 0) return nullptr;
+  const size_t block_size = BlockSize(size_class);
+  Shard& shard = shards_.this_cpu();
+  MutexLock lock(&shard.mu);
+  SizeClass& c = shard.size_classes[size_class];
+  if (c.current == kNoSlab || !HasRoom(c.current, block_size)) {
+    // The current slab is full; it goes back on the partial list when one of
+    // its blocks is freed.
+    if (!c.partial.empty()) {
+      c.current = c.partial.back();
+      c.partial.pop_back();
+      slabs_[c.current].partial = false;
+    } else {
+      c.current = TakeSlab(size_class, &shard - shards_.begin());
+      if (c.current == kNoSlab) return nullptr;
+    }
+  }
+  Slab& slab = slabs_[c.current];
+  ++slab.live;
+  if (slab.free_list != nullptr) {
+    return std::exchange(slab.free_list, slab.free_list->next);
+  }
+  char* p = std::exchange(slab.next, slab.next + block_size);
+  if (!HasRoom(c.current, block_size)) slab.next = nullptr;
+  return p;
+}
+
+void HugePageAllocator::Free(void* p) {
+  const uint32_t index = SlabIndex(p);
+  Slab& slab = slabs_[index];
+  Shard& shard = shards_.begin()[slab.owner.load(std::memory_order_relaxed)];
+  {
+    MutexLock lock(&shard.mu);
+    SizeClass& c =
+        shard.size_classes[slab.size_class.load(std::memory_order_relaxed)];
+    slab.free_list = new (p) FreeBlock{slab.free_list};
+    --slab.live;
+    if (index == c.current) return;
+    if (slab.live != 0) {
+      if (!slab.partial) {
+        slab.partial = true;
+        c.partial.push_back(index);
+      }
+      return;
+    }
+    // The slab is idle: take it away from this shard before releasing it.
+    if (slab.partial) {
+      c.partial.erase(std::find(c.partial.begin(), c.partial.end(), index));
+    }
+  }
+  ReleaseSlab(index);
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,187 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_UTIL_HUGE_PAGE_ALLOCATOR_H
+#define GRPC_SRC_CORE_UTIL_HUGE_PAGE_ALLOCATOR_H
+
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "src/core/util/per_cpu.h"
+#include "src/core/util/sync.h"
+
+namespace grpc_core {
+
+// Serves medium sized blocks - read buffers and call arenas - out of 2MB
+// slabs backed by huge pages, so that the memory that the hottest paths touch
+// needs few TLB entries.
+//
+// Slabs are carved from a single reservation of address space, sized by the
+// number of shards, and are committed only when a shard runs out of room for
+// a size class. Each slab serves one size class for one shard - the shard of
+// the cpu that first needed it, so poller threads mostly touch slabs that
+// were first faulted in (and so placed on the NUMA node) of the cpu they run
+// on - and keeps its own free list. Once every block of a slab has been
+// freed, its memory is returned to the system with madvise(), and the slab
+// goes back to a common pool to be reused by any shard and size class.
+//
+// Explicit huge pages (hugetlbfs) are used when the system has some
+// reserved, otherwise - or once they run out - slabs are marked for
+// transparent huge pages.
+class HugePageAllocator {
+ public:
+  static constexpr size_t kSlabSize = 2 * 1024 * 1024;
+  // Size classes are powers of two, plus room for a small header so that a
+  // 64KB buffer and its refcount fit in one 64KB class block.
+  static constexpr size_t kBlockHeaderRoom = 256;
+  static constexpr size_t kMinBlockSize = 4 * 1024;
+  static constexpr size_t kMaxBlockSize = 128 * 1024;
+  static constexpr size_t kNumSizeClasses = 6;
+  // The address space reservation - the most memory ever served - has room
+  // for this many slabs per shard and size class, and at least kMinSlabs.
+  static constexpr size_t kSlabsPerShardAndSizeClass = 2;
+  static constexpr size_t kMinSlabs = 512;
+  static constexpr size_t kMaxShards = 64;
+
+  // The process wide allocator, or nullptr if it is not supported on this
+  // platform or the address space could not be reserved.
+  static HugePageAllocator* Get();
+
+  // Allocate from the process wide allocator. Returns nullptr if there is
+  // none, or if it cannot serve \a size.
+  static void* MaybeAlloc(size_t size) {
+    HugePageAllocator* allocator = Get();
+    return allocator == nullptr ? nullptr : allocator->Alloc(size);
+  }
+
+  // Free memory returned by Alloc(). Returns false, doing nothing, if \a p
+  // did not come from this allocator.
+  static bool MaybeFree(void* p) {
+    HugePageAllocator* allocator = instance_.load(std::memory_order_acquire);
+    if (allocator == nullptr || !allocator->Owns(p)) return false;
+    allocator->Free(p);
+    return true;
+  }
+
+  // Allocate at least \a size bytes, aligned to 64 bytes. Returns nullptr if
+  // \a size is outside [kMinBlockSize / 2, kMaxBlockSize + kBlockHeaderRoom]
+  // or the reservation is used up.
+  void* Alloc(size_t size);
+  void Free(void* p);
+
+  bool Owns(const void* p) const {
+    const uintptr_t addr = reinterpret_cast<uintptr_t>(p);
+    return addr >= base_ && addr < base_ + max_slabs_ * kSlabSize;
+  }
+
+  // Whether slabs were backed by explicit huge pages.
+  bool using_explicit_huge_pages() const {
+    return explicit_huge_pages_.load(std::memory_order_relaxed);
+  }
+
+  // Number of slabs currently committed and serving some size class.
+  size_t slabs_in_use() const {
+    return std::min(next_slab_.load(std::memory_order_relaxed), max_slabs_) -
+           idle_slabs_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  struct FreeBlock {
+    FreeBlock* next;
+  };
+
+  static constexpr uint32_t kNoSlab = ~uint32_t{0};
+
+  // Bookkeeping for one slab. Everything but owner and size_class is guarded
+  // by the mutex of the owning shard; owner and size_class only change while
+  // no block of the slab is allocated.
+  struct Slab {
+    std::atomic<uint32_t> owner{0};
+    std::atomic<uint8_t> size_class{0};
+    // Blocks of this slab that have been freed.
+    FreeBlock* free_list = nullptr;
+    // Start of the part of the slab that has not been carved into blocks
+    // yet, or nullptr once it all has.
+    char* next = nullptr;
+    // Number of blocks allocated and not yet freed.
+    uint32_t live = 0;
+    // Whether this slab is on its size class' partial list.
+    bool partial = false;
+  };
+
+  struct SizeClass {
+    // The slab blocks are being allocated from, or kNoSlab.
+    uint32_t current = kNoSlab;
+    // Other slabs of this shard with some blocks free.
+    std::vector<uint32_t> partial;
+  };
+
+  struct alignas(GPR_CACHELINE_SIZE) Shard {
+    Mutex mu;
+    std::array<SizeClass, kNumSizeClasses> size_classes ABSL_GUARDED_BY(mu);
+  };
+
+  HugePageAllocator(uintptr_t base, PerCpuOptions options, size_t max_slabs,
+                    bool hugetlb);
+
+  static size_t BlockSize(size_t size_class) {
+    return (kMinBlockSize << size_class) + kBlockHeaderRoom;
+  }
+  static int SizeClassFor(size_t size);
+
+  // Whether a block of \a block_size can be allocated from slab \a index.
+  bool HasRoom(uint32_t index, size_t block_size) const;
+  // Take an idle slab, or commit the next slab of the reservation, to serve
+  // \a size_class for the shard at \a owner. Returns kNoSlab when the
+  // reservation is used up.
+  uint32_t TakeSlab(size_t size_class, uint32_t owner);
+  // Commit the memory of slab \a index.
+  bool CommitSlab(uint32_t index);
+  // Return the memory of slab \a index, which has no blocks allocated, to
+  // the system and put it back in the pool of idle slabs.
+  void ReleaseSlab(uint32_t index);
+  char* SlabBase(uint32_t index) const {
+    return reinterpret_cast<char*>(base_ + index * kSlabSize);
+  }
+  uint32_t SlabIndex(const void* p) const {
+    return (reinterpret_cast<uintptr_t>(p) - base_) / kSlabSize;
+  }
+
+  static std::atomic<HugePageAllocator*> instance_;
+
+  const uintptr_t base_;
+  const size_t max_slabs_;
+  // Whether the system had explicit huge pages when the allocator was
+  // created.
+  const bool hugetlb_;
+  std::atomic<size_t> next_slab_{0};
+  std::atomic<size_t> idle_slabs_{0};
+  std::atomic<bool> explicit_huge_pages_{false};
+  std::unique_ptr<Slab[]> slabs_;
+  PerCpu<Shard> shards_;
+  Mutex idle_mu_;
+  std::vector<uint32_t> idle_list_ ABSL_GUARDED_BY(idle_mu_);
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_UTIL_HUGE_PAGE_ALLOCATOR_H
@@ -93,7 +93,9 @@ class JsonReader {
   static constexpr uint32_t GRPC_JSON_READ_CHAR_EOF = 0x7ffffff0;
 
   struct Scope {
-    std::string parent_object_key;
+    // If the container is the value of an object member, the place in the
+    // parent object to store it in.
+    Json* parent_object_value = nullptr;
     std::variant<Json::Object, Json::Array> data;
 
     Json::Type type() const {
@@ -127,6 +129,7 @@ class JsonReader {
 
   GRPC_MUST_USE_RESULT bool StringAddChar(uint32_t c);
   GRPC_MUST_USE_RESULT bool StringAddUtf32(uint32_t c);
+  GRPC_MUST_USE_RESULT bool StringAddCharRun(uint32_t c);
 
   Json* CreateAndLinkValue();
   bool StartContainer(Json::Type type);
@@ -155,7 +158,8 @@ class JsonReader {
   Json root_value_;
   std::vector<Scope> stack_;
 
-  std::string key_;
+  // The place to store the value of the object member being parsed.
+  Json* object_value_ = nullptr;
   std::string string_;
 };
 
@@ -238,6 +242,25 @@ bool JsonReader::StringAddUtf32(uint32_t c) {
   }
 }
 
+// Most of the characters in the strings of a service config or xDS
+// bootstrap are printable ASCII characters that need no escaping, so once we
+// see one, we consume the run of such characters that follows it at once
+// rather than going through the state machine one character at a time.
+bool JsonReader::StringAddCharRun(uint32_t c) {
+  if (c >= 0x80 || utf8_bytes_remaining_ != 0) return StringAddChar(c);
+  string_.push_back(static_cast<char>(c));
+  const uint8_t* end = input_;
+  const uint8_t* const input_end = input_ + remaining_input_;
+  while (end != input_end && *end >= 32 && *end < 0x80 && *end != '"' &&
+         *end != '\\') {
+    ++end;
+  }
+  string_.append(reinterpret_cast<const char*>(input_), end - input_);
+  remaining_input_ -= end - input_;
+  input_ = end;
+  return true;
+}
+
 uint32_t JsonReader::ReadChar() {
   if (remaining_input_ == 0) return GRPC_JSON_READ_CHAR_EOF;
   const uint32_t r = *input_++;
@@ -253,7 +276,7 @@ Json* JsonReader::CreateAndLinkValue() {
   if (stack_.empty()) return &root_value_;
   return MatchMutable(
       &stack_.back().data,
-      [&](Json::Object* object) { return &(*object)[std::move(key_)]; },
+      [&](Json::Object*) { return std::exchange(object_value_, nullptr); },
       [&](Json::Array* array) {
         array->emplace_back();
         return &array->back();
@@ -273,7 +296,7 @@ bool JsonReader::StartContainer(Json::Type type) {
   }
   stack_.emplace_back();
   Scope& scope = stack_.back();
-  scope.parent_object_key = std::move(key_);
+  scope.parent_object_value = std::exchange(object_value_, nullptr);
   if (type == Json::Type::kObject) {
     scope.data = Json::Object();
   } else {
@@ -287,22 +310,27 @@ void JsonReader::EndContainer() {
   CHECK(!stack_.empty());
   Scope scope = std::move(stack_.back());
   stack_.pop_back();
-  key_ = std::move(scope.parent_object_key);
+  object_value_ = scope.parent_object_value;
   Json* value = CreateAndLinkValue();
   *value = scope.TakeAsJson();
 }
 
 void JsonReader::SetKey() {
-  key_ = std::move(string_);
+  // Insert the member now, so that its value can be stored without looking
+  // up the key again. Map nodes do not move, so the pointer stays valid while
+  // nested containers are pushed onto the stack.
+  Json::Object& object = std::get<Json::Object>(stack_.back().data);
+  auto [it, inserted] = object.try_emplace(std::move(string_));
   string_.clear();
-  const Json::Object& object = std::get<Json::Object>(stack_.back().data);
-  if (object.find(key_) != object.end()) {
+  object_value_ = &it->second;
+  if (!inserted) {
+    const std::string& key = it->first;
     if (errors_.size() == GRPC_JSON_MAX_ERRORS) {
       truncated_errors_ = true;
     } else {
       errors_.push_back(
-          absl::StrFormat("duplicate key \"%s\" at index %" PRIuPTR, key_,
-                          CurrentIndex() - key_.size() - 2));
+          absl::StrFormat("duplicate key \"%s\" at index %" PRIuPTR, key,
+                          CurrentIndex() - key.size() - 2));
     }
   }
 }
@@ -538,7 +566,7 @@ JsonReader::Status JsonReader::Run() {
               SetKey();
             } else {
               if (c < 32) return Status::GRPC_JSON_PARSE_ERROR;
-              if (!StringAddChar(c)) return Status::GRPC_JSON_PARSE_ERROR;
+              if (!StringAddCharRun(c)) return Status::GRPC_JSON_PARSE_ERROR;
             }
             break;
 
@@ -556,7 +584,7 @@ JsonReader::Status JsonReader::Run() {
               SetString();
             } else {
               if (c < 32) return Status::GRPC_JSON_PARSE_ERROR;
-              if (!StringAddChar(c)) return Status::GRPC_JSON_PARSE_ERROR;
+              if (!StringAddCharRun(c)) return Status::GRPC_JSON_PARSE_ERROR;
             }
             break;
 
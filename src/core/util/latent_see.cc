@@ -15,11 +15,13 @@
 #include "src/core/util/latent_see.h"
 
 #ifdef GRPC_ENABLE_LATENT_SEE
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <cstdint>
 #include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "absl/strings/str_cat.h"
@@ -34,8 +36,12 @@ namespace latent_see {
 thread_local uint64_t Log::thread_id_ = Log::Get().next_thread_id_.fetch_add(1);
 thread_local Bin* Log::bin_ = nullptr;
 thread_local void* Log::bin_owner_ = nullptr;
+thread_local uint32_t Log::sample_countdown_ = 0;
+thread_local uint32_t Log::unsampled_depth_ = 0;
 std::atomic<uint64_t> Flow::next_flow_id_{1};
 std::atomic<uintptr_t> Log::free_bins_{0};
+std::atomic<uint32_t> Log::sample_one_in_{1};
+std::atomic<size_t> Log::max_events_per_cpu_{0};
 const std::chrono::steady_clock::time_point start_time =
     std::chrono::steady_clock::now();
 
@@ -69,6 +75,7 @@ void Log::TryPullEventsAndFlush(
     for (auto& fragment : fragments_) {
       MutexLock lock(&fragment.mu_active);
       fragment.active.clear();
+      fragment.oldest = 0;
     }
     return;
   }
@@ -77,8 +84,15 @@ void Log::TryPullEventsAndFlush(
   // long.
   for (auto& fragment : fragments_) {
     CHECK_EQ(fragment.flushing.size(), 0);
-    MutexLock lock(&fragment.mu_active);
-    fragment.flushing.swap(fragment.active);
+    size_t oldest;
+    {
+      MutexLock lock(&fragment.mu_active);
+      fragment.flushing.swap(fragment.active);
+      oldest = std::exchange(fragment.oldest, 0);
+    }
+    // A bounded fragment that wrapped around: put its events back in order.
+    std::rotate(fragment.flushing.begin(), fragment.flushing.begin() + oldest,
+                fragment.flushing.end());
   }
   // Now we've swapped out, call the callback repeatedly with each fragment.
   // This is the slow part - there's a lot of copying and transformation that
@@ -175,10 +189,18 @@ void Log::FlushBin(Bin* bin) {
       log.next_batch_id_.fetch_add(1, std::memory_order_relaxed);
   auto& fragment = log.fragments_.this_cpu();
   const auto thread_id = thread_id_;
+  const size_t max_events = MaxEventsPerCpu();
   {
     MutexLock lock(&fragment.mu_active);
     for (auto event : bin->events) {
-      fragment.active.push_back(RecordedEvent{thread_id, batch_id, event});
+      if (max_events == 0 || fragment.active.size() < max_events) {
+        fragment.active.push_back(RecordedEvent{thread_id, batch_id, event});
+        continue;
+      }
+      // Full: overwrite the oldest event.
+      if (fragment.oldest >= fragment.active.size()) fragment.oldest = 0;
+      fragment.active[fragment.oldest++] =
+          RecordedEvent{thread_id, batch_id, event};
     }
   }
   bin->events.clear();
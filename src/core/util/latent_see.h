@@ -36,6 +36,7 @@
 #include "absl/functional/function_ref.h"
 #include "absl/log/log.h"
 #include "absl/strings/string_view.h"
+#include "absl/types/span.h"
 #include "src/core/util/per_cpu.h"
 #include "src/core/util/sync.h"
 
@@ -118,6 +119,45 @@ class Log {
 
   static Bin* CurrentThreadBin() { return bin_; }
 
+  // Decides whether a parent scope with no enclosing parent records its
+  // events: one in every SampleOneIn() such scopes on each thread is kept.
+  GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION static bool ShouldSample() {
+    const uint32_t one_in = sample_one_in_.load(std::memory_order_relaxed);
+    if (one_in <= 1) return one_in == 1;
+    if (sample_countdown_ > 1) {
+      --sample_countdown_;
+      return false;
+    }
+    sample_countdown_ = one_in;
+    return true;
+  }
+
+  // Keep the events of one in every one_in outermost scopes; 0 stops
+  // capturing altogether and 1 (the default) captures everything.
+  static void SetSampleOneIn(uint32_t one_in) {
+    sample_one_in_.store(one_in, std::memory_order_relaxed);
+  }
+  static uint32_t SampleOneIn() {
+    return sample_one_in_.load(std::memory_order_relaxed);
+  }
+
+  // Bound the events held between pulls to max_events per cpu, overwriting
+  // the oldest once full; 0 (the default) leaves them unbounded. Together
+  // with sampling this lets latent_see stay on in production, keeping a
+  // window of recent history to pull when something goes wrong.
+  static void SetMaxEventsPerCpu(size_t max_events) {
+    max_events_per_cpu_.store(max_events, std::memory_order_relaxed);
+  }
+  static size_t MaxEventsPerCpu() {
+    return max_events_per_cpu_.load(std::memory_order_relaxed);
+  }
+
+  // Parent scopes nested in a parent scope that was not sampled are not
+  // sampled either, so that a trace is always kept or dropped whole.
+  static bool InUnsampledParent() { return unsampled_depth_ != 0; }
+  static void EnterUnsampledParent() { ++unsampled_depth_; }
+  static void LeaveUnsampledParent() { --unsampled_depth_; }
+
   GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION static Log& Get() {
     static Log* log = new Log();
     return *log;
@@ -146,12 +186,18 @@ class Log {
   static thread_local uint64_t thread_id_;
   static thread_local Bin* bin_;
   static thread_local void* bin_owner_;
+  static thread_local uint32_t sample_countdown_;
+  static thread_local uint32_t unsampled_depth_;
   static std::atomic<uintptr_t> free_bins_;
+  static std::atomic<uint32_t> sample_one_in_;
+  static std::atomic<size_t> max_events_per_cpu_;
   absl::AnyInvocable<void(absl::string_view)> stats_flusher_ = nullptr;
   Mutex mu_flushing_;
   struct Fragment {
     Mutex mu_active ABSL_ACQUIRED_AFTER(mu_flushing_);
     std::vector<RecordedEvent> active ABSL_GUARDED_BY(mu_active);
+    // Once active is full, the index of its oldest event.
+    size_t oldest ABSL_GUARDED_BY(mu_active) = 0;
     std::vector<RecordedEvent> flushing ABSL_GUARDED_BY(&Log::mu_flushing_);
   };
   PerCpu<Fragment> fragments_{PerCpuOptions()};
@@ -164,13 +210,24 @@ class Scope {
       : metadata_(metadata) {
     bin_ = Log::CurrentThreadBin();
     if (kParent && bin_ == nullptr) {
+      if (Log::InUnsampledParent() || !Log::ShouldSample()) {
+        Log::EnterUnsampledParent();
+        unsampled_ = true;
+        return;
+      }
       bin_descriptor_ = Log::StartBin(this);
       bin_ = Log::ToBin(bin_descriptor_);
     }
-    CHECK_NE(bin_, nullptr);
+    // Scopes outside a sampled parent scope record nothing.
+    if (bin_ == nullptr) return;
     bin_->Append(metadata_, EventType::kBegin, 0);
   }
   GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION ~Scope() {
+    if (kParent && unsampled_) {
+      Log::LeaveUnsampledParent();
+      return;
+    }
+    if (bin_ == nullptr) return;
     bin_->Append(metadata_, EventType::kEnd, 0);
     if (kParent) Log::EndBin(bin_descriptor_, this);
   }
@@ -182,6 +239,7 @@ class Scope {
   const Metadata* const metadata_;
   uintptr_t bin_descriptor_ = 0;
   Bin* bin_ = nullptr;
+  bool unsampled_ = false;
 };
 
 using ParentScope = Scope<true>;
@@ -191,24 +249,17 @@ class Flow {
  public:
   GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION Flow() : metadata_(nullptr) {}
   GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION explicit Flow(const Metadata* metadata)
-      : metadata_(metadata),
-        id_(next_flow_id_.fetch_add(1, std::memory_order_relaxed)) {
-    Log::CurrentThreadBin()->Append(metadata_, EventType::kFlowStart, id_);
-  }
-  GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION ~Flow() {
-    if (metadata_ != nullptr) {
-      Log::CurrentThreadBin()->Append(metadata_, EventType::kFlowEnd, id_);
-    }
+      : metadata_(nullptr) {
+    Begin(metadata);
   }
+  GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION ~Flow() { End(); }
 
   Flow(const Flow&) = delete;
   Flow& operator=(const Flow&) = delete;
   Flow(Flow&& other) noexcept
       : metadata_(std::exchange(other.metadata_, nullptr)), id_(other.id_) {}
   Flow& operator=(Flow&& other) noexcept {
-    if (metadata_ != nullptr) {
-      Log::CurrentThreadBin()->Append(metadata_, EventType::kFlowEnd, id_);
-    }
+    End();
     metadata_ = std::exchange(other.metadata_, nullptr);
     id_ = other.id_;
     return *this;
@@ -217,18 +268,18 @@ class Flow {
   GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION bool is_active() const {
     return metadata_ != nullptr;
   }
+  // Flows ended or begun outside a sampled parent scope are dropped.
   GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION void End() {
     if (metadata_ == nullptr) return;
-    Log::CurrentThreadBin()->Append(metadata_, EventType::kFlowEnd, id_);
+    auto* bin = Log::CurrentThreadBin();
+    if (bin != nullptr) bin->Append(metadata_, EventType::kFlowEnd, id_);
     metadata_ = nullptr;
   }
   GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION void Begin(const Metadata* metadata) {
+    End();
     auto* bin = Log::CurrentThreadBin();
-    if (metadata_ != nullptr) {
-      bin->Append(metadata_, EventType::kFlowEnd, id_);
-    }
+    if (metadata == nullptr || bin == nullptr) return;
     metadata_ = metadata;
-    if (metadata_ == nullptr) return;
     id_ = next_flow_id_.fetch_add(1, std::memory_order_relaxed);
     bin->Append(metadata_, EventType::kFlowStart, id_);
   }
@@ -240,7 +291,8 @@ class Flow {
 };
 
 GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION inline void Mark(const Metadata* md) {
-  Log::CurrentThreadBin()->Append(md, EventType::kMark, 0);
+  auto* bin = Log::CurrentThreadBin();
+  if (bin != nullptr) bin->Append(md, EventType::kMark, 0);
 }
 
 template <typename P>
@@ -0,0 +1,187 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif  // _GNU_SOURCE
+
+#include "src/core/util/numa.h"
+
+#include <grpc/support/cpu.h>
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <utility>
+
+#include "absl/log/log.h"
+#include "absl/strings/ascii.h"
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_split.h"
+#include "src/core/util/no_destruct.h"
+
+#ifdef GPR_LINUX
+#include <sched.h>
+#include <stdio.h>
+#endif
+
+namespace grpc_core {
+
+namespace {
+
+// Larger than any cpu or node id; guards against absurd ranges in malformed
+// input.
+constexpr unsigned kMaxId = 1 << 16;
+
+#ifdef GPR_LINUX
+std::optional<std::string> ReadSysfsLine(const std::string& path) {
+  FILE* file = fopen(path.c_str(), "r");
+  if (file == nullptr) return std::nullopt;
+  char buf[4096];
+  char* line = fgets(buf, sizeof(buf), file);
+  fclose(file);
+  if (line == nullptr) return std::nullopt;
+  return std::string(absl::StripAsciiWhitespace(line));
+}
+
+// The cpus this process may run on, read once at startup. Threads bound to a
+// node must stay inside this set, or a process started under taskset or a
+// cpuset cgroup would be moved onto cpus it was not given.
+std::optional<std::vector<unsigned>> ReadAllowedCpus() {
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  if (sched_getaffinity(0, sizeof(set), &set) != 0) return std::nullopt;
+  std::vector<unsigned> cpus;
+  for (unsigned cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+    if (CPU_ISSET(cpu, &set)) cpus.push_back(cpu);
+  }
+  if (cpus.empty()) return std::nullopt;
+  return cpus;
+}
+
+std::vector<std::vector<unsigned>> ReadSysfsNodeCpus() {
+  std::vector<std::vector<unsigned>> node_cpus;
+  auto online = ReadSysfsLine("/sys/devices/system/node/online");
+  if (!online.has_value()) return node_cpus;
+  auto nodes = NumaTopology::ParseList(*online);
+  if (!nodes.has_value()) return node_cpus;
+  for (unsigned node : *nodes) {
+    auto cpulist = ReadSysfsLine(
+        absl::StrCat("/sys/devices/system/node/node", node, "/cpulist"));
+    if (!cpulist.has_value()) continue;
+    auto cpus = NumaTopology::ParseList(*cpulist);
+    // Memory-only nodes have no cpus, and no threads to place on them.
+    if (!cpus.has_value() || cpus->empty()) continue;
+    node_cpus.push_back(std::move(*cpus));
+  }
+  return node_cpus;
+}
+
+std::vector<std::vector<unsigned>> ReadNodeCpus() {
+  auto allowed = ReadAllowedCpus();
+  auto node_cpus = ReadSysfsNodeCpus();
+  if (!allowed.has_value()) return node_cpus;
+  // Without sysfs, every allowed cpu is on a single node.
+  if (node_cpus.empty()) return {std::move(*allowed)};
+  return NumaTopology::RestrictToCpus(std::move(node_cpus), *allowed);
+}
+#else
+std::vector<std::vector<unsigned>> ReadNodeCpus() { return {}; }
+#endif
+
+}  // namespace
+
+NumaTopology::NumaTopology(std::vector<std::vector<unsigned>> node_cpus)
+    : node_cpus_(std::move(node_cpus)) {
+  if (node_cpus_.empty()) {
+    std::vector<unsigned> cpus(gpr_cpu_num_cores());
+    for (unsigned i = 0; i < cpus.size(); ++i) cpus[i] = i;
+    node_cpus_.push_back(std::move(cpus));
+  }
+  for (size_t node = 0; node < node_cpus_.size(); ++node) {
+    for (unsigned cpu : node_cpus_[node]) {
+      if (cpu >= cpu_nodes_.size()) cpu_nodes_.resize(cpu + 1, 0);
+      cpu_nodes_[cpu] = node;
+    }
+  }
+}
+
+const NumaTopology& NumaTopology::Get() {
+  static const NoDestruct<NumaTopology> topology(ReadNodeCpus());
+  return *topology;
+}
+
+std::optional<std::vector<unsigned>> NumaTopology::ParseList(
+    absl::string_view list) {
+  std::vector<unsigned> result;
+  list = absl::StripAsciiWhitespace(list);
+  if (list.empty()) return result;
+  for (absl::string_view range : absl::StrSplit(list, ',')) {
+    std::pair<absl::string_view, absl::string_view> bounds =
+        absl::StrSplit(range, absl::MaxSplits('-', 1));
+    unsigned first;
+    if (!absl::SimpleAtoi(bounds.first, &first)) return std::nullopt;
+    unsigned last = first;
+    if (!bounds.second.empty() && !absl::SimpleAtoi(bounds.second, &last)) {
+      return std::nullopt;
+    }
+    if (last < first || last >= kMaxId) return std::nullopt;
+    for (unsigned i = first; i <= last; ++i) result.push_back(i);
+  }
+  std::sort(result.begin(), result.end());
+  result.erase(std::unique(result.begin(), result.end()), result.end());
+  return result;
+}
+
+std::vector<std::vector<unsigned>> NumaTopology::RestrictToCpus(
+    std::vector<std::vector<unsigned>> node_cpus,
+    const std::vector<unsigned>& allowed) {
+  std::vector<std::vector<unsigned>> result;
+  for (std::vector<unsigned>& cpus : node_cpus) {
+    std::vector<unsigned> usable;
+    std::set_intersection(cpus.begin(), cpus.end(), allowed.begin(),
+                          allowed.end(), std::back_inserter(usable));
+    if (!usable.empty()) result.push_back(std::move(usable));
+  }
+  // If none of the allowed cpus is on a known node, treat them as one node
+  // rather than falling back to cpus the process may not use.
+  if (result.empty() && !allowed.empty()) result.push_back(allowed);
+  return result;
+}
+
+size_t NumaTopology::NodeOfCpu(unsigned cpu) const {
+  return cpu < cpu_nodes_.size() ? cpu_nodes_[cpu] : 0;
+}
+
+bool NumaTopology::BindCurrentThread(size_t node) const {
+#ifdef GPR_LINUX
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  for (unsigned cpu : node_cpus_[node]) {
+    if (cpu < CPU_SETSIZE) CPU_SET(cpu, &set);
+  }
+  if (sched_setaffinity(0, sizeof(set), &set) != 0) {
+    VLOG(2) << "Failed to bind thread to NUMA node " << node;
+    return false;
+  }
+  return true;
+#else
+  (void)node;
+  return false;
+#endif
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,72 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_UTIL_NUMA_H
+#define GRPC_SRC_CORE_UTIL_NUMA_H
+
+#include <grpc/support/port_platform.h>
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+#include "absl/strings/string_view.h"
+
+namespace grpc_core {
+
+// The NUMA nodes of the host and the cpus that belong to each of them.
+// Hosts whose topology cannot be read (including all non-Linux hosts) have a
+// single node holding every cpu. Cpus outside the affinity mask the process
+// started with are left out.
+class NumaTopology {
+ public:
+  explicit NumaTopology(std::vector<std::vector<unsigned>> node_cpus);
+
+  // The topology of this host, read once.
+  static const NumaTopology& Get();
+
+  // Parses a cpu or node list in the format used by sysfs, e.g. "0-3,8,10-11".
+  // Returns nullopt if \a list is malformed.
+  static std::optional<std::vector<unsigned>> ParseList(absl::string_view list);
+
+  // Keeps only the cpus of \a node_cpus that are also in \a allowed, and
+  // drops nodes left with none. Both \a allowed and each node's cpus must be
+  // sorted.
+  static std::vector<std::vector<unsigned>> RestrictToCpus(
+      std::vector<std::vector<unsigned>> node_cpus,
+      const std::vector<unsigned>& allowed);
+
+  // Always at least 1.
+  size_t num_nodes() const { return node_cpus_.size(); }
+  // The cpus of \a node, in increasing order.
+  const std::vector<unsigned>& cpus(size_t node) const {
+    return node_cpus_[node];
+  }
+  // The node \a cpu belongs to, or 0 if it is not known.
+  size_t NodeOfCpu(unsigned cpu) const;
+
+  // Restricts the calling thread to the cpus of \a node, so that memory it
+  // touches first is placed on that node. Returns false if that is not
+  // supported.
+  bool BindCurrentThread(size_t node) const;
+
+ private:
+  std::vector<std::vector<unsigned>> node_cpus_;
+  // Indexed by cpu.
+  std::vector<size_t> cpu_nodes_;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_UTIL_NUMA_H
@@ -279,8 +279,12 @@ struct UnrefCallDestroy {
 //    Child* ch;
 //    ch->Unref();
 //
+// RefCountImpl selects the counter. Objects that are heavily contended can
+// use ShardedRefCount (see sharded_ref_count.h), in which case the owner
+// must call ReconcileRefs() before releasing its ref.
 template <typename Child, typename Impl = PolymorphicRefCount,
-          typename UnrefBehavior = UnrefDelete>
+          typename UnrefBehavior = UnrefDelete,
+          typename RefCountImpl = RefCount>
 class RefCounted : public Impl {
  public:
   using RefCountedChildType = Child;
@@ -383,6 +387,9 @@ class RefCounted : public Impl {
                       intptr_t initial_refcount = 1)
       : refs_(initial_refcount, trace), unref_behavior_(b) {}
 
+  // Only for RefCountImpl = ShardedRefCount: see ShardedRefCount::Reconcile().
+  void ReconcileRefs() const { refs_.Reconcile(); }
+
  private:
   // Allow RefCountedPtr<> to access IncrementRefCount().
   template <typename T>
@@ -394,7 +401,7 @@ class RefCounted : public Impl {
     refs_.Ref(location, reason);
   }
 
-  mutable RefCount refs_;
+  mutable RefCountImpl refs_;
   GPR_NO_UNIQUE_ADDRESS UnrefBehavior unref_behavior_;
 };
 
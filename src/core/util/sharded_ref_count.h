@@ -0,0 +1,230 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_UTIL_SHARDED_REF_COUNT_H
+#define GRPC_SRC_CORE_UTIL_SHARDED_REF_COUNT_H
+
+#include <grpc/support/port_platform.h>
+
+#include <atomic>
+#include <cinttypes>
+#include <limits>
+
+#include "absl/log/check.h"
+#include "absl/log/log.h"
+#include "src/core/util/atomic_utils.h"
+#include "src/core/util/debug_location.h"
+#include "src/core/util/per_cpu.h"
+
+namespace grpc_core {
+
+// A drop-in replacement for RefCount, for objects that are reffed and
+// unreffed by every call on every thread, where a single atomic counter
+// would bounce its cache line between cores.
+//
+// Each shard keeps a reserve of refs that it has taken from the shared
+// count in batches. Ref() takes one from the calling CPU's reserve and
+// Unref() returns one to it, so in the common case neither touches the
+// shared count. Because the reserves hold real refs, the shared count can
+// not reach zero while any are outstanding: the object's owner must call
+// Reconcile() once, while it still holds its own ref, on the path that
+// ends the object's life (e.g. when it is orphaned or removed from the
+// structure that keeps it alive). Reconcile() hands every reserve back to
+// the shared count, and from then on all operations go to it directly, so
+// the last Unref() sees zero as usual.
+//
+// An object that is never reconciled is leaked. Each instance also costs a
+// cache line per shard, so only use this for long-lived objects on hot
+// paths, via the RefCountImpl parameter of RefCounted.
+class ShardedRefCount {
+ public:
+  using Value = intptr_t;
+
+  ShardedRefCount() : ShardedRefCount(1) {}
+
+  // `init` is the initial refcount stored in this object.
+  //
+  // `trace` is a string to be logged with trace events; if null, no
+  // trace logging will be done.  Tracing is a no-op in non-debug builds.
+  explicit ShardedRefCount(
+      Value init,
+      const char*
+#ifndef NDEBUG
+          // Leave unnamed if NDEBUG to avoid unused parameter warning
+          trace
+#endif
+      = nullptr)
+      :
+#ifndef NDEBUG
+        trace_(trace),
+#endif
+        value_(init) {
+  }
+
+  ShardedRefCount(const ShardedRefCount&) = delete;
+  ShardedRefCount& operator=(const ShardedRefCount&) = delete;
+
+  // Increases the ref-count by `n`.
+  void Ref(Value n = 1) {
+#ifndef NDEBUG
+    if (trace_ != nullptr) LOG(INFO) << trace_ << ":" << this << " ref " << n;
+#endif
+    RefInternal(n);
+  }
+  void Ref(const DebugLocation& location, const char* reason, Value n = 1) {
+#ifndef NDEBUG
+    if (trace_ != nullptr) {
+      LOG(INFO) << trace_ << ":" << this << " " << location.file() << ":"
+                << location.line() << " ref " << n << " " << reason;
+    }
+#else
+    // Use conditionally-important parameters
+    (void)location;
+    (void)reason;
+#endif
+    RefInternal(n);
+  }
+
+  // Same as Ref(); the sharded count cannot cheaply check for zero.
+  void RefNonZero() { Ref(); }
+  void RefNonZero(const DebugLocation& location, const char* reason) {
+    Ref(location, reason);
+  }
+
+  // Always goes to the shared count, which is non-zero exactly when the
+  // object is alive.
+  bool RefIfNonZero() { return IncrementIfNonzero(&value_); }
+  bool RefIfNonZero(const DebugLocation& location, const char* reason) {
+#ifndef NDEBUG
+    if (trace_ != nullptr) {
+      LOG(INFO) << trace_ << ":" << this << " " << location.file() << ":"
+                << location.line() << " ref_if_non_zero " << reason;
+    }
+#else
+    // Avoid unused-parameter warnings for debug-only parameters
+    (void)location;
+    (void)reason;
+#endif
+    return IncrementIfNonzero(&value_);
+  }
+
+  // Decrements the ref-count and returns true if the ref-count reaches 0.
+  bool Unref() {
+#ifndef NDEBUG
+    if (trace_ != nullptr) LOG(INFO) << trace_ << ":" << this << " unref";
+#endif
+    return UnrefInternal();
+  }
+  bool Unref(const DebugLocation& location, const char* reason) {
+#ifndef NDEBUG
+    if (trace_ != nullptr) {
+      LOG(INFO) << trace_ << ":" << this << " " << location.file() << ":"
+                << location.line() << " unref " << reason;
+    }
+#else
+    // Avoid unused-parameter warnings for debug-only parameters
+    (void)location;
+    (void)reason;
+#endif
+    return UnrefInternal();
+  }
+
+  // Returns the refs held by the shards to the shared count. The caller
+  // must hold a ref. Calling it more than once is harmless.
+  void Reconcile() {
+    Value reserved = 0;
+    for (Shard& shard : shards_) {
+      const Value reserve =
+          shard.reserve.exchange(kReconciled, std::memory_order_acq_rel);
+      if (reserve != kReconciled) reserved += reserve;
+    }
+    // Cannot reach zero, since the caller holds a ref.
+    if (reserved != 0) value_.fetch_sub(reserved, std::memory_order_acq_rel);
+  }
+
+ private:
+  // Refs a shard takes from the shared count when its reserve runs out,
+  // and gives back when its reserve reaches twice this.
+  static constexpr Value kBatch = 64;
+  // Marks a shard whose reserve has been handed back by Reconcile().
+  static constexpr Value kReconciled = std::numeric_limits<Value>::min();
+
+  struct alignas(GPR_CACHELINE_SIZE) Shard {
+    std::atomic<Value> reserve{0};
+  };
+
+  void RefInternal(Value n) {
+    std::atomic<Value>& reserve = shards_.this_cpu().reserve;
+    Value current = reserve.load(std::memory_order_relaxed);
+    while (current != kReconciled && current >= n) {
+      if (reserve.compare_exchange_weak(current, current - n,
+                                        std::memory_order_relaxed)) {
+        return;
+      }
+    }
+    if (current == kReconciled) {
+      value_.fetch_add(n, std::memory_order_relaxed);
+      return;
+    }
+    // Take the caller's refs and a new batch for the shard in one go.
+    value_.fetch_add(n + kBatch, std::memory_order_relaxed);
+    current = reserve.load(std::memory_order_relaxed);
+    while (current != kReconciled) {
+      if (reserve.compare_exchange_weak(current, current + kBatch,
+                                        std::memory_order_release,
+                                        std::memory_order_relaxed)) {
+        return;
+      }
+    }
+    // Reconciled in the meantime. Give the batch back; the caller's refs
+    // keep the shared count above zero.
+    value_.fetch_sub(kBatch, std::memory_order_relaxed);
+  }
+
+  bool UnrefInternal() {
+    std::atomic<Value>& reserve = shards_.this_cpu().reserve;
+    Value current = reserve.load(std::memory_order_relaxed);
+    while (current != kReconciled) {
+      if (current < 2 * kBatch) {
+        if (reserve.compare_exchange_weak(current, current + 1,
+                                          std::memory_order_release,
+                                          std::memory_order_relaxed)) {
+          return false;
+        }
+      } else if (reserve.compare_exchange_weak(current, current + 1 - kBatch,
+                                               std::memory_order_release,
+                                               std::memory_order_relaxed)) {
+        // Return a batch to the shared count. This only reaches zero if
+        // everything else was released and reconciled in the meantime.
+        return value_.fetch_sub(kBatch, std::memory_order_acq_rel) == kBatch;
+      }
+    }
+    const Value prior = value_.fetch_sub(1, std::memory_order_acq_rel);
+#ifndef NDEBUG
+    DCHECK_GT(prior, 0);
+#endif
+    return prior == 1;
+  }
+
+#ifndef NDEBUG
+  const char* trace_;
+#endif
+  // The shared count: refs held by callers plus refs held in reserves.
+  std::atomic<Value> value_;
+  PerCpu<Shard> shards_{PerCpuOptions().SetCpusPerShard(1).SetMaxShards(16)};
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_UTIL_SHARDED_REF_COUNT_H
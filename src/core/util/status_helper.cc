@@ -149,8 +149,12 @@ void StatusSetInt(absl::Status* status, StatusIntProperty key, intptr_t value) {
     *status = ReplaceStatusCode(*status, static_cast<absl::StatusCode>(value));
     return;
   }
-  status->SetPayload(GetStatusIntPropertyUrl(key),
-                     absl::Cord(std::to_string(value)));
+  absl::Cord payload(std::to_string(value));
+  // Errors raised on every call are often shared copies of one status, so
+  // re-stamping a value they already carry must not force a copy of it.
+  absl::string_view url = GetStatusIntPropertyUrl(key);
+  if (status->GetPayload(url) == payload) return;
+  status->SetPayload(url, std::move(payload));
 }
 
 std::optional<intptr_t> StatusGetInt(const absl::Status& status,
@@ -200,7 +204,10 @@ void StatusSetStr(absl::Status* status, StatusStrProperty key,
     }
     return;
   }
-  status->SetPayload(GetStatusStrPropertyUrl(key), absl::Cord(value));
+  absl::string_view url = GetStatusStrPropertyUrl(key);
+  auto existing = status->GetPayload(url);
+  if (existing.has_value() && *existing == value) return;
+  status->SetPayload(url, absl::Cord(value));
 }
 
 std::optional<std::string> StatusGetStr(const absl::Status& status,
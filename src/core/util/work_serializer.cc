@@ -48,28 +48,62 @@ namespace grpc_core {
 // WorkSerializer::WorkSerializerImpl
 //
 
-// Executes callbacks one at a time on EventEngine.
-// One at a time guarantees that fixed size thread pools in EventEngine
-// implementations are not starved of threads by long running work
-// serializers. We implement EventEngine::Closure directly to avoid allocating
-// once per callback in the queue when scheduling.
+// Runs callbacks on EventEngine. We implement EventEngine::Closure directly
+// to avoid allocating once per callback in the queue when scheduling.
 class WorkSerializer::WorkSerializerImpl
     : public Orphanable,
       public grpc_event_engine::experimental::EventEngine::Closure {
  public:
-  explicit WorkSerializerImpl(
-      std::shared_ptr<grpc_event_engine::experimental::EventEngine>
-          event_engine)
-      : event_engine_(std::move(event_engine)) {}
-  void Run(absl::AnyInvocable<void()> callback, DebugLocation location);
-  void Run() override;
-  void Orphan() override;
+  virtual void Run(absl::AnyInvocable<void()> callback,
+                   DebugLocation location) = 0;
+  using grpc_event_engine::experimental::EventEngine::Closure::Run;
 
 #ifndef NDEBUG
   bool RunningInWorkSerializer() const {
     return running_work_serializer_ == this;
   }
 #endif
+
+ protected:
+#ifndef NDEBUG
+  void SetCurrentThread() { running_work_serializer_ = this; }
+  void ClearCurrentThread() { running_work_serializer_ = nullptr; }
+#else
+  void SetCurrentThread() {}
+  void ClearCurrentThread() {}
+#endif
+
+ private:
+#ifndef NDEBUG
+  static thread_local WorkSerializerImpl* running_work_serializer_;
+#endif
+};
+
+#ifndef NDEBUG
+thread_local WorkSerializer::WorkSerializerImpl*
+    WorkSerializer::WorkSerializerImpl::running_work_serializer_ = nullptr;
+#endif
+
+//
+// WorkSerializer::LockedWorkSerializerImpl
+//
+
+// Executes callbacks one at a time on EventEngine.
+// One at a time guarantees that fixed size thread pools in EventEngine
+// implementations are not starved of threads by long running work
+// serializers.
+class WorkSerializer::LockedWorkSerializerImpl final
+    : public WorkSerializerImpl {
+ public:
+  explicit LockedWorkSerializerImpl(
+      std::shared_ptr<grpc_event_engine::experimental::EventEngine>
+          event_engine)
+      : event_engine_(std::move(event_engine)) {}
+  void Run(absl::AnyInvocable<void()> callback,
+           DebugLocation location) override;
+  void Run() override;
+  void Orphan() override;
+
  private:
   // Wrapper to capture DebugLocation for the callback.
   struct CallbackWrapper {
@@ -94,14 +128,6 @@ class WorkSerializer::WorkSerializerImpl
   enum class RefillResult { kRefilled, kFinished, kFinishedAndOrphaned };
   RefillResult RefillInner();
 
-#ifndef NDEBUG
-  void SetCurrentThread() { running_work_serializer_ = this; }
-  void ClearCurrentThread() { running_work_serializer_ = nullptr; }
-#else
-  void SetCurrentThread() {}
-  void ClearCurrentThread() {}
-#endif
-
   // Member variables are roughly sorted to keep processing cache lines
   // separated from incoming cache lines.
 
@@ -137,18 +163,9 @@ class WorkSerializer::WorkSerializerImpl
   CallbackVector incoming_ ABSL_GUARDED_BY(mu_);
 
   GPR_NO_UNIQUE_ADDRESS latent_see::Flow flow_;
-
-#ifndef NDEBUG
-  static thread_local WorkSerializerImpl* running_work_serializer_;
-#endif
 };
 
-#ifndef NDEBUG
-thread_local WorkSerializer::WorkSerializerImpl*
-    WorkSerializer::WorkSerializerImpl::running_work_serializer_ = nullptr;
-#endif
-
-void WorkSerializer::WorkSerializerImpl::Orphan() {
+void WorkSerializer::LockedWorkSerializerImpl::Orphan() {
   ReleasableMutexLock lock(&mu_);
   // If we're not running, then we can delete immediately.
   if (!running_) {
@@ -160,8 +177,8 @@ void WorkSerializer::WorkSerializerImpl::Orphan() {
   orphaned_ = true;
 }
 
-// Implementation of WorkSerializerImpl::Run
-void WorkSerializer::WorkSerializerImpl::Run(
+// Implementation of LockedWorkSerializerImpl::Run
+void WorkSerializer::LockedWorkSerializerImpl::Run(
     absl::AnyInvocable<void()> callback, DebugLocation location) {
   GRPC_TRACE_LOG(work_serializer, INFO)
       << "WorkSerializer[" << this << "] Scheduling callback ["
@@ -186,7 +203,7 @@ void WorkSerializer::WorkSerializerImpl::Run(
 }
 
 // Implementation of EventEngine::Closure::Run - our actual work loop
-void WorkSerializer::WorkSerializerImpl::Run() {
+void WorkSerializer::LockedWorkSerializerImpl::Run() {
   GRPC_LATENT_SEE_PARENT_SCOPE("WorkSerializer::Run");
   flow_.End();
   // TODO(ctiller): remove these when we can deprecate ExecCtx
@@ -220,8 +237,8 @@ void WorkSerializer::WorkSerializerImpl::Run() {
   event_engine_->Run(this);
 }
 
-WorkSerializer::WorkSerializerImpl::RefillResult
-WorkSerializer::WorkSerializerImpl::RefillInner() {
+WorkSerializer::LockedWorkSerializerImpl::RefillResult
+WorkSerializer::LockedWorkSerializerImpl::RefillInner() {
   // Recover any memory held by processing_, so that we don't grow forever.
   // Do so before acquiring a lock so we don't cause inadvertent contention.
   processing_.shrink_to_fit();
@@ -252,7 +269,7 @@ WorkSerializer::WorkSerializerImpl::RefillInner() {
   return RefillResult::kRefilled;
 }
 
-bool WorkSerializer::WorkSerializerImpl::Refill() {
+bool WorkSerializer::LockedWorkSerializerImpl::Refill() {
   const auto result = RefillInner();
   switch (result) {
     case RefillResult::kRefilled:
@@ -273,14 +290,178 @@ bool WorkSerializer::WorkSerializerImpl::Refill() {
   GPR_UNREACHABLE_CODE(return false);
 }
 
+//
+// WorkSerializer::LockFreeWorkSerializerImpl
+//
+
+// Queues callbacks on a lock free multi-producer single-consumer queue, and
+// counts queued callbacks in an atomic: the Run() call that takes the count
+// from zero starts draining on EventEngine, and the drain stops when it takes
+// the count back to zero. Each EventEngine callback runs callbacks until the
+// queue is empty or the drain budget is spent, and then schedules itself
+// again for the rest.
+class WorkSerializer::LockFreeWorkSerializerImpl final
+    : public WorkSerializerImpl {
+ public:
+  LockFreeWorkSerializerImpl(
+      std::shared_ptr<grpc_event_engine::experimental::EventEngine>
+          event_engine,
+      DrainBudget drain_budget)
+      : event_engine_(std::move(event_engine)),
+        drain_budget_(drain_budget) {}
+  ~LockFreeWorkSerializerImpl() override {
+    DCHECK_EQ(state_.load(std::memory_order_relaxed) & kCountMask, 0u);
+  }
+
+  void Run(absl::AnyInvocable<void()> callback,
+           DebugLocation location) override;
+  void Run() override;
+  void Orphan() override;
+
+ private:
+  struct CallbackNode final : public MultiProducerSingleConsumerQueue::Node {
+    CallbackNode(absl::AnyInvocable<void()>&& cb, const DebugLocation& loc)
+        : callback(std::move(cb)), location(loc) {}
+    absl::AnyInvocable<void()> callback;
+    GPR_NO_UNIQUE_ADDRESS DebugLocation location;
+  };
+
+  // state_ holds the number of callbacks queued or running, and a bit that
+  // is set once the serializer is orphaned.
+  static constexpr uint64_t kOrphanedBit = uint64_t{1} << 63;
+  static constexpr uint64_t kCountMask = kOrphanedBit - 1;
+
+  // Record the stats for a run that has just finished.
+  static void FinishRun(std::chrono::steady_clock::time_point start_time,
+                        std::chrono::steady_clock::duration time_running_items,
+                        uint64_t items_processed);
+
+  const std::shared_ptr<grpc_event_engine::experimental::EventEngine>
+      event_engine_;
+  const DrainBudget drain_budget_;
+  // Only touched by the thread that starts a run, then by the drain: the
+  // count in state_ orders the two.
+  std::chrono::steady_clock::time_point running_start_time_;
+  std::chrono::steady_clock::duration time_running_items_;
+  uint64_t items_processed_during_run_;
+  GPR_NO_UNIQUE_ADDRESS latent_see::Flow flow_;
+  MultiProducerSingleConsumerQueue queue_;
+  std::atomic<uint64_t> state_{0};
+};
+
+void WorkSerializer::LockFreeWorkSerializerImpl::Orphan() {
+  const uint64_t prev_state =
+      state_.fetch_or(kOrphanedBit, std::memory_order_acq_rel);
+  // If nothing is queued, nothing is running: delete now. Otherwise the
+  // drain deletes us when it finishes.
+  if ((prev_state & kCountMask) == 0) delete this;
+}
+
+void WorkSerializer::LockFreeWorkSerializerImpl::Run(
+    absl::AnyInvocable<void()> callback, DebugLocation location) {
+  GRPC_TRACE_LOG(work_serializer, INFO)
+      << "WorkSerializer[" << this << "] Scheduling callback ["
+      << location.file() << ":" << location.line() << "]";
+  global_stats().IncrementWorkSerializerItemsEnqueued();
+  // Count the callback before queueing it, so that the drain never sees a
+  // callback it has not counted. It may instead briefly count one that it
+  // cannot pop yet.
+  const uint64_t prev_state = state_.fetch_add(1, std::memory_order_acq_rel);
+  queue_.Push(new CallbackNode(std::move(callback), location));
+  if ((prev_state & kCountMask) == 0) {
+    // We were idle: start a run.
+    running_start_time_ = std::chrono::steady_clock::now();
+    items_processed_during_run_ = 0;
+    time_running_items_ = std::chrono::steady_clock::duration();
+    event_engine_->Run(this);
+  }
+}
+
+void WorkSerializer::LockFreeWorkSerializerImpl::Run() {
+  GRPC_LATENT_SEE_PARENT_SCOPE("WorkSerializer::Run");
+  flow_.End();
+  // TODO(ctiller): remove these when we can deprecate ExecCtx
+  ExecCtx exec_ctx;
+  const auto drain_start = std::chrono::steady_clock::now();
+  size_t callbacks_run = 0;
+  while (true) {
+    auto* node = static_cast<CallbackNode*>(queue_.Pop());
+    if (node == nullptr) {
+      // A Run() call has counted its callback but not finished pushing it:
+      // come back for it rather than spinning here.
+      break;
+    }
+    GRPC_TRACE_LOG(work_serializer, INFO)
+        << "WorkSerializer[" << this << "] Executing callback ["
+        << node->location.file() << ":" << node->location.line() << "]";
+    const auto start = std::chrono::steady_clock::now();
+    SetCurrentThread();
+    node->callback();
+    // Destroy the callback before clearing the current thread in case its
+    // destructor wants to check that it's in the WorkSerializer too.
+    delete node;
+    ClearCurrentThread();
+    global_stats().IncrementWorkSerializerItemsDequeued();
+    const auto end = std::chrono::steady_clock::now();
+    const auto work_time = end - start;
+    global_stats().IncrementWorkSerializerWorkTimePerItemMs(
+        std::chrono::duration_cast<std::chrono::milliseconds>(work_time)
+            .count());
+    time_running_items_ += work_time;
+    ++items_processed_during_run_;
+    // Read what FinishRun needs before releasing the callback: once the
+    // count reaches zero a new run may start and reset these.
+    const auto start_time = running_start_time_;
+    const auto time_running_items = time_running_items_;
+    const uint64_t items_processed = items_processed_during_run_;
+    const uint64_t prev_state = state_.fetch_sub(1, std::memory_order_acq_rel);
+    if ((prev_state & kCountMask) == 1) {
+      FinishRun(start_time, time_running_items, items_processed);
+      if (prev_state & kOrphanedBit) delete this;
+      return;
+    }
+    if (++callbacks_run >= drain_budget_.max_callbacks ||
+        end - drain_start >= drain_budget_.max_time) {
+      // Out of budget: leave the rest of the queue to a new callback.
+      break;
+    }
+  }
+  flow_.Begin(GRPC_LATENT_SEE_METADATA("WorkSerializer::Link"));
+  event_engine_->Run(this);
+}
+
+void WorkSerializer::LockFreeWorkSerializerImpl::FinishRun(
+    std::chrono::steady_clock::time_point start_time,
+    std::chrono::steady_clock::duration time_running_items,
+    uint64_t items_processed) {
+  global_stats().IncrementWorkSerializerRunTimeMs(
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+          std::chrono::steady_clock::now() - start_time)
+          .count());
+  global_stats().IncrementWorkSerializerWorkTimeMs(
+      std::chrono::duration_cast<std::chrono::milliseconds>(time_running_items)
+          .count());
+  global_stats().IncrementWorkSerializerItemsPerRun(items_processed);
+}
+
 //
 // WorkSerializer
 //
 
 WorkSerializer::WorkSerializer(
     std::shared_ptr<grpc_event_engine::experimental::EventEngine> event_engine)
-    : impl_(OrphanablePtr<WorkSerializerImpl>(
-          MakeOrphanable<WorkSerializerImpl>(std::move(event_engine)))) {}
+    : WorkSerializer(std::move(event_engine), DrainBudget()) {}
+
+WorkSerializer::WorkSerializer(
+    std::shared_ptr<grpc_event_engine::experimental::EventEngine> event_engine,
+    DrainBudget drain_budget) {
+  if (IsLockFreeWorkSerializerEnabled()) {
+    impl_ = MakeOrphanable<LockFreeWorkSerializerImpl>(std::move(event_engine),
+                                                       drain_budget);
+  } else {
+    impl_ = MakeOrphanable<LockedWorkSerializerImpl>(std::move(event_engine));
+  }
+}
 
 WorkSerializer::~WorkSerializer() = default;
 
@@ -20,6 +20,9 @@
 #include <grpc/event_engine/event_engine.h>
 #include <grpc/support/port_platform.h>
 
+#include <stddef.h>
+
+#include <chrono>
 #include <functional>
 #include <memory>
 
@@ -37,9 +40,21 @@ namespace grpc_core {
 // When a thread calls Run() with a callback the callback runs asynchronously.
 class ABSL_LOCKABLE WorkSerializer {
  public:
+  // Bounds the work done by one EventEngine callback of the lock free
+  // implementation (the lock_free_work_serializer experiment): once either
+  // limit is reached, the remaining callbacks are left for a new EventEngine
+  // callback, so a long queue does not hold an EventEngine thread for long.
+  struct DrainBudget {
+    size_t max_callbacks = 16;
+    std::chrono::steady_clock::duration max_time = std::chrono::milliseconds(1);
+  };
+
   explicit WorkSerializer(
       std::shared_ptr<grpc_event_engine::experimental::EventEngine>
           event_engine);
+  WorkSerializer(std::shared_ptr<grpc_event_engine::experimental::EventEngine>
+                     event_engine,
+                 DrainBudget drain_budget);
   ~WorkSerializer();
 
   WorkSerializer(const WorkSerializer&) = delete;
@@ -72,6 +87,8 @@ class ABSL_LOCKABLE WorkSerializer {
 
  private:
   class WorkSerializerImpl;
+  class LockedWorkSerializerImpl;
+  class LockFreeWorkSerializerImpl;
 
   OrphanablePtr<WorkSerializerImpl> impl_;
 };
@@ -373,23 +373,22 @@ std::vector<RefCountedPtr<GrpcXdsClient>> GetAllXdsClients() {
 
 }  // namespace
 
-// ABSL_NO_THREAD_SAFETY_ANALYSIS because we have to manually manage locks for
-// individual XdsClients and compiler struggles with checking the validity
-grpc_slice GrpcXdsClient::DumpAllClientConfigs()
-    ABSL_NO_THREAD_SAFETY_ANALYSIS {
+grpc_slice GrpcXdsClient::DumpAllClientConfigs() {
   auto xds_clients = GetAllXdsClients();
   upb::Arena arena;
-  // Contains strings that should survive till serialization
-  std::set<std::string> string_pool;
+  // Keeps alive everything the upb message points into until it has been
+  // serialized, so that each XdsClient is only locked while its config is
+  // being filled in, not for the serialization of the whole response.
+  XdsClient::ConfigDumpStorage storage;
   auto response = envoy_service_status_v3_ClientStatusResponse_new(arena.ptr());
-  // We lock each XdsClient mutex till we are done with the serialization to
-  // ensure that all data referenced from the UPB proto message stays alive.
   for (const auto& xds_client : xds_clients) {
     auto client_config =
         envoy_service_status_v3_ClientStatusResponse_add_config(response,
                                                                 arena.ptr());
-    xds_client->mu()->Lock();
-    xds_client->DumpClientConfig(&string_pool, arena.ptr(), client_config);
+    {
+      MutexLock lock(xds_client->mu());
+      xds_client->DumpClientConfig(&storage, arena.ptr(), client_config);
+    }
     envoy_service_status_v3_ClientConfig_set_client_scope(
         client_config, StdStringToUpbString(xds_client->key()));
   }
@@ -397,9 +396,6 @@ grpc_slice GrpcXdsClient::DumpAllClientConfigs()
   size_t output_length;
   char* output = envoy_service_status_v3_ClientStatusResponse_serialize(
       response, arena.ptr(), &output_length);
-  for (const auto& xds_client : xds_clients) {
-    xds_client->mu()->Unlock();
-  }
   return grpc_slice_from_cpp_string(std::string(output, output_length));
 }
 
@@ -291,6 +291,28 @@ XdsClusterResource::Aggregate AggregateClusterParse(
   return aggregate;
 }
 
+// Returns the hash_balance_factor that bounds the loads of consistent
+// hashing policies, or 0 if it is not set.
+uint32_t ParseHashBalanceFactor(const envoy_config_cluster_v3_Cluster* cluster,
+                                ValidationErrors* errors) {
+  const auto* common_lb_config =
+      envoy_config_cluster_v3_Cluster_common_lb_config(cluster);
+  if (common_lb_config == nullptr) return 0;
+  const auto* consistent_hashing_lb_config =
+      envoy_config_cluster_v3_Cluster_CommonLbConfig_consistent_hashing_lb_config(
+          common_lb_config);
+  if (consistent_hashing_lb_config == nullptr) return 0;
+  auto value = ParseUInt32Value(
+      envoy_config_cluster_v3_Cluster_CommonLbConfig_ConsistentHashingLbConfig_hash_balance_factor(
+          consistent_hashing_lb_config));
+  if (!value.has_value()) return 0;
+  ValidationErrors::ScopedField field(
+      errors,
+      ".common_lb_config.consistent_hashing_lb_config.hash_balance_factor");
+  if (*value < 100) errors->AddError("must be at least 100");
+  return *value;
+}
+
 void ParseLbPolicyConfig(const XdsResourceType::DecodeContext& context,
                          const envoy_config_cluster_v3_Cluster* cluster,
                          XdsClusterResource* cds_update,
@@ -372,12 +394,87 @@ void ParseLbPolicyConfig(const XdsResourceType::DecodeContext& context,
         errors->AddError("invalid hash function");
       }
     }
+    Json::Object ring_hash_json = {
+        {"minRingSize", Json::FromNumber(min_ring_size)},
+        {"maxRingSize", Json::FromNumber(max_ring_size)},
+    };
+    const uint32_t hash_balance_factor =
+        ParseHashBalanceFactor(cluster, errors);
+    if (hash_balance_factor != 0) {
+      ring_hash_json["hashBalanceFactor"] =
+          Json::FromNumber(hash_balance_factor);
+    }
+    cds_update->lb_policy_config = {
+        Json::FromObject({
+            {"ring_hash_experimental",
+             Json::FromObject(std::move(ring_hash_json))},
+        }),
+    };
+  } else if (envoy_config_cluster_v3_Cluster_lb_policy(cluster) ==
+             envoy_config_cluster_v3_Cluster_MAGLEV) {
+    // Maglev is the ring_hash policy using a Maglev lookup table.
+    Json::Object ring_hash_json = {
+        {"lookupTable", Json::FromString("MAGLEV")},
+    };
+    auto* maglev_config =
+        envoy_config_cluster_v3_Cluster_maglev_lb_config(cluster);
+    if (maglev_config != nullptr) {
+      auto value = ParseUInt64Value(
+          envoy_config_cluster_v3_Cluster_MaglevLbConfig_table_size(
+              maglev_config));
+      if (value.has_value()) {
+        ring_hash_json["maglevTableSize"] = Json::FromNumber(*value);
+      }
+    }
+    const uint32_t hash_balance_factor =
+        ParseHashBalanceFactor(cluster, errors);
+    if (hash_balance_factor != 0) {
+      ring_hash_json["hashBalanceFactor"] =
+          Json::FromNumber(hash_balance_factor);
+    }
     cds_update->lb_policy_config = {
         Json::FromObject({
             {"ring_hash_experimental",
+             Json::FromObject(std::move(ring_hash_json))},
+        }),
+    };
+    // Let the policy validate the table size.
+    auto config =
+        CoreConfiguration::Get().lb_policy_registry().ParseLoadBalancingConfig(
+            Json::FromArray(cds_update->lb_policy_config));
+    if (!config.ok()) {
+      ValidationErrors::ScopedField field(errors, ".maglev_lb_config");
+      errors->AddError(config.status().message());
+    }
+  } else if (envoy_config_cluster_v3_Cluster_lb_policy(cluster) ==
+             envoy_config_cluster_v3_Cluster_LEAST_REQUEST) {
+    uint32_t choice_count = 2;
+    auto* least_request_config =
+        envoy_config_cluster_v3_Cluster_least_request_lb_config(cluster);
+    if (least_request_config != nullptr) {
+      ValidationErrors::ScopedField field(errors, ".least_request_lb_config");
+      auto value = ParseUInt32Value(
+          envoy_config_cluster_v3_Cluster_LeastRequestLbConfig_choice_count(
+              least_request_config));
+      if (value.has_value()) {
+        ValidationErrors::ScopedField field(errors, ".choice_count");
+        choice_count = *value;
+        if (choice_count < 2) errors->AddError("must be at least 2");
+      }
+    }
+    cds_update->lb_policy_config = {
+        Json::FromObject({
+            {"xds_wrr_locality_experimental",
              Json::FromObject({
-                 {"minRingSize", Json::FromNumber(min_ring_size)},
-                 {"maxRingSize", Json::FromNumber(max_ring_size)},
+                 {"childPolicy",
+                  Json::FromArray({
+                      Json::FromObject({
+                          {"least_request",
+                           Json::FromObject({
+                               {"choiceCount", Json::FromNumber(choice_count)},
+                           })},
+                      }),
+                  })},
              })},
         }),
     };
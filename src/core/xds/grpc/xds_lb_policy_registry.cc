@@ -249,6 +249,101 @@ class WrrLocalityLbPolicyConfigFactory final
   }
 };
 
+class LeastRequestLbPolicyConfigFactory final
+    : public XdsLbPolicyRegistry::ConfigFactory {
+ public:
+  Json::Object ConvertXdsLbPolicyConfig(
+      const XdsLbPolicyRegistry* /*registry*/,
+      const XdsResourceType::DecodeContext& context,
+      absl::string_view configuration, ValidationErrors* errors,
+      int /*recursion_depth*/) override {
+    std::optional<std::string> choice_count_proto;
+    if (!FindChoiceCount(configuration, &choice_count_proto)) {
+      errors->AddError("can't decode LeastRequest LB policy config");
+      return {};
+    }
+    Json::Object config;
+    if (choice_count_proto.has_value()) {
+      ValidationErrors::ScopedField field(errors, ".choice_count");
+      const auto* choice_count = google_protobuf_UInt32Value_parse(
+          choice_count_proto->data(), choice_count_proto->size(),
+          context.arena);
+      if (choice_count == nullptr) {
+        errors->AddError("can't decode UInt32Value");
+      } else {
+        const uint32_t value = google_protobuf_UInt32Value_value(choice_count);
+        if (value < 2) {
+          errors->AddError("value must be at least 2");
+        } else {
+          config["choiceCount"] = Json::FromNumber(value);
+        }
+      }
+    }
+    return Json::Object{{"least_request", Json::FromObject(std::move(config))}};
+  }
+
+  absl::string_view type() override { return Type(); }
+
+  static absl::string_view Type() {
+    return "envoy.extensions.load_balancing_policies.least_request.v3."
+           "LeastRequest";
+  }
+
+ private:
+  static bool ReadVarint(absl::string_view* input, uint64_t* value) {
+    *value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+      if (input->empty()) return false;
+      const uint8_t byte = static_cast<uint8_t>(input->front());
+      input->remove_prefix(1);
+      *value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+      if ((byte & 0x80) == 0) return true;
+    }
+    return false;
+  }
+
+  // There are no upb bindings for LeastRequest, so walk its fields by hand
+  // to find choice_count (field 1, a google.protobuf.UInt32Value). Every
+  // occurrence is appended to \a choice_count, which gives the merge that
+  // parsing the whole message would. Other fields are skipped. Returns false
+  // if \a configuration is not a valid serialized message.
+  static bool FindChoiceCount(absl::string_view configuration,
+                              std::optional<std::string>* choice_count) {
+    while (!configuration.empty()) {
+      uint64_t tag;
+      if (!ReadVarint(&configuration, &tag) || (tag >> 3) == 0) return false;
+      uint64_t value;
+      switch (tag & 7) {
+        case 0:  // varint
+          if (!ReadVarint(&configuration, &value)) return false;
+          break;
+        case 1:  // fixed64
+          if (configuration.size() < 8) return false;
+          configuration.remove_prefix(8);
+          break;
+        case 2:  // length-delimited
+          if (!ReadVarint(&configuration, &value) ||
+              value > configuration.size()) {
+            return false;
+          }
+          if ((tag >> 3) == 1) {
+            if (!choice_count->has_value()) choice_count->emplace();
+            (*choice_count)->append(configuration.data(), value);
+          }
+          configuration.remove_prefix(value);
+          break;
+        case 5:  // fixed32
+          if (configuration.size() < 4) return false;
+          configuration.remove_prefix(4);
+          break;
+        default:  // groups are not used by LeastRequest
+          return false;
+      }
+    }
+    return true;
+  }
+};
+
 class PickFirstLbPolicyConfigFactory final
     : public XdsLbPolicyRegistry::ConfigFactory {
  public:
@@ -300,6 +395,9 @@ XdsLbPolicyRegistry::XdsLbPolicyRegistry() {
   policy_config_factories_.emplace(
       WrrLocalityLbPolicyConfigFactory::Type(),
       std::make_unique<WrrLocalityLbPolicyConfigFactory>());
+  policy_config_factories_.emplace(
+      LeastRequestLbPolicyConfigFactory::Type(),
+      std::make_unique<LeastRequestLbPolicyConfigFactory>());
   policy_config_factories_.emplace(
       PickFirstLbPolicyConfigFactory::Type(),
       std::make_unique<PickFirstLbPolicyConfigFactory>());
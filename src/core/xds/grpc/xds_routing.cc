@@ -26,9 +26,11 @@
 #include <cctype>
 #include <utility>
 
+#include "absl/container/inlined_vector.h"
 #include "absl/log/check.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
+#include "absl/strings/ascii.h"
 #include "absl/strings/match.h"
 #include "absl/strings/str_cat.h"
 #include "src/core/lib/channel/channel_args.h"
@@ -134,6 +136,80 @@ std::optional<size_t> XdsRouting::FindVirtualHostForDomain(
   return target_index;
 }
 
+//
+// XdsRouting::CompiledVirtualHostList
+//
+
+XdsRouting::CompiledVirtualHostList::CompiledVirtualHostList(
+    const VirtualHostListIterator& vhost_iterator) {
+  for (size_t i = 0; i < vhost_iterator.Size(); ++i) {
+    for (const std::string& domain_pattern :
+         vhost_iterator.GetDomainsForVirtualHost(i)) {
+      // Domain matching is case-insensitive.
+      std::string pattern = absl::AsciiStrToLower(domain_pattern);
+      const MatchType match_type = DomainPatternMatchType(pattern);
+      // This should be caught by RouteConfigParse().
+      CHECK(match_type != INVALID_MATCH);
+      // When the same pattern appears in multiple virtual hosts, the first
+      // one wins, so never overwrite an entry.
+      switch (match_type) {
+        case EXACT_MATCH:
+          exact_.emplace(std::move(pattern), i);
+          break;
+        case SUFFIX_MATCH:
+          suffix_.Add(pattern.substr(1), i);
+          break;
+        case PREFIX_MATCH:
+          pattern.pop_back();
+          prefix_.Add(std::move(pattern), i);
+          break;
+        default:
+          if (!universe_.has_value()) universe_ = i;
+          break;
+      }
+    }
+  }
+}
+
+void XdsRouting::CompiledVirtualHostList::WildcardPatterns::Add(
+    std::string literal, size_t index) {
+  auto it = std::lower_bound(
+      by_length.begin(), by_length.end(), literal.size(),
+      [](const auto& group, size_t length) { return group.first > length; });
+  if (it == by_length.end() || it->first != literal.size()) {
+    it = by_length.emplace(it, literal.size(),
+                           absl::flat_hash_map<std::string, size_t>());
+  }
+  it->second.emplace(std::move(literal), index);
+}
+
+std::optional<size_t>
+XdsRouting::CompiledVirtualHostList::WildcardPatterns::Find(
+    absl::string_view domain, bool suffix) const {
+  for (const auto& [length, literals] : by_length) {
+    // Asterisk must match at least one char.
+    if (length >= domain.size()) continue;
+    auto it = literals.find(suffix ? domain.substr(domain.size() - length)
+                                   : domain.substr(0, length));
+    if (it != literals.end()) return it->second;
+  }
+  return std::nullopt;
+}
+
+std::optional<size_t>
+XdsRouting::CompiledVirtualHostList::FindVirtualHostForDomain(
+    absl::string_view domain) const {
+  // Same search order as XdsRouting::FindVirtualHostForDomain().
+  const std::string host = absl::AsciiStrToLower(domain);
+  auto it = exact_.find(host);
+  if (it != exact_.end()) return it->second;
+  std::optional<size_t> index = suffix_.Find(host, /*suffix=*/true);
+  if (index.has_value()) return index;
+  index = prefix_.Find(host, /*suffix=*/false);
+  if (index.has_value()) return index;
+  return universe_;
+}
+
 namespace {
 
 bool HeadersMatch(const std::vector<HeaderMatcher>& header_matchers,
@@ -172,6 +248,119 @@ std::optional<size_t> XdsRouting::GetRouteForRequest(
   return std::nullopt;
 }
 
+//
+// XdsRouting::CompiledRouteList
+//
+
+XdsRouting::CompiledRouteList::CompiledRouteList(
+    const RouteListIterator& route_list_iterator)
+    // Same options and anchoring as the RE2 in StringMatcher.
+    : regex_set_(
+          std::make_unique<RE2::Set>(RE2::Options(), RE2::ANCHOR_BOTH)) {
+  for (size_t i = 0; i < route_list_iterator.Size(); ++i) {
+    AddPathMatcher(route_list_iterator.GetMatchersForRoute(i).path_matcher,
+                   static_cast<uint32_t>(i));
+  }
+  if (!regex_routes_.empty() && !regex_set_->Compile()) {
+    // Too big for RE2's memory budget; evaluate the regexes one at a time.
+    other_routes_.insert(other_routes_.end(), regex_routes_.begin(),
+                         regex_routes_.end());
+    std::sort(other_routes_.begin(), other_routes_.end());
+    regex_routes_.clear();
+  }
+  if (regex_routes_.empty()) regex_set_.reset();
+}
+
+void XdsRouting::CompiledRouteList::AddPathMatcher(
+    const StringMatcher& path_matcher, uint32_t index) {
+  PathStrings& path_strings = path_strings_[path_matcher.case_sensitive()];
+  switch (path_matcher.type()) {
+    case StringMatcher::Type::kExact:
+    case StringMatcher::Type::kPrefix: {
+      std::string key = path_matcher.case_sensitive()
+                            ? path_matcher.string_matcher()
+                            : absl::AsciiStrToLower(
+                                  path_matcher.string_matcher());
+      if (path_matcher.type() == StringMatcher::Type::kExact) {
+        path_strings.exact[std::move(key)].push_back(index);
+        return;
+      }
+      auto& prefixes = path_strings.prefixes;
+      auto it = std::lower_bound(prefixes.begin(), prefixes.end(), key.size(),
+                                 [](const auto& group, size_t length) {
+                                   return group.first > length;
+                                 });
+      if (it == prefixes.end() || it->first != key.size()) {
+        it = prefixes.emplace(
+            it, key.size(), absl::flat_hash_map<std::string, RouteIndices>());
+      }
+      it->second[std::move(key)].push_back(index);
+      return;
+    }
+    case StringMatcher::Type::kSafeRegex:
+      if (regex_set_->Add(path_matcher.regex_matcher()->pattern(), nullptr) >=
+          0) {
+        regex_routes_.push_back(index);
+        return;
+      }
+      break;
+    default:
+      break;
+  }
+  other_routes_.push_back(index);
+}
+
+std::optional<size_t> XdsRouting::CompiledRouteList::GetRouteForRequest(
+    const RouteListIterator& route_list_iterator, absl::string_view path,
+    grpc_metadata_batch* initial_metadata) const {
+  // Collect the routes whose path matcher matches, then check the rest of
+  // their matchers in route order.
+  absl::InlinedVector<uint32_t, 8> candidates;
+  auto add_candidates = [&](const RouteIndices& indices) {
+    candidates.insert(candidates.end(), indices.begin(), indices.end());
+  };
+  std::string lower_case_path;
+  for (bool case_sensitive : {true, false}) {
+    const PathStrings& path_strings = path_strings_[case_sensitive];
+    if (path_strings.exact.empty() && path_strings.prefixes.empty()) continue;
+    absl::string_view key = path;
+    if (!case_sensitive) {
+      lower_case_path = absl::AsciiStrToLower(path);
+      key = lower_case_path;
+    }
+    auto it = path_strings.exact.find(key);
+    if (it != path_strings.exact.end()) add_candidates(it->second);
+    for (const auto& [length, prefixes] : path_strings.prefixes) {
+      if (length > key.size()) continue;
+      auto prefix_it = prefixes.find(key.substr(0, length));
+      if (prefix_it != prefixes.end()) add_candidates(prefix_it->second);
+    }
+  }
+  if (regex_set_ != nullptr) {
+    std::vector<int> matches;
+    if (regex_set_->Match(std::string(path), &matches)) {
+      for (int match : matches) candidates.push_back(regex_routes_[match]);
+    }
+  }
+  for (uint32_t index : other_routes_) {
+    if (route_list_iterator.GetMatchersForRoute(index).path_matcher.Match(
+            path)) {
+      candidates.push_back(index);
+    }
+  }
+  std::sort(candidates.begin(), candidates.end());
+  for (uint32_t index : candidates) {
+    const XdsRouteConfigResource::Route::Matchers& matchers =
+        route_list_iterator.GetMatchersForRoute(index);
+    if (HeadersMatch(matchers.header_matchers, initial_metadata) &&
+        (!matchers.fraction_per_million.has_value() ||
+         UnderFraction(*matchers.fraction_per_million))) {
+      return index;
+    }
+  }
+  return std::nullopt;
+}
+
 bool XdsRouting::IsValidDomainPattern(absl::string_view domain_pattern) {
   return DomainPatternMatchType(domain_pattern) != INVALID_MATCH;
 }
@@ -23,12 +23,15 @@
 #include <stddef.h>
 
 #include <map>
+#include <memory>
 #include <optional>
 #include <string>
 #include <vector>
 
+#include "absl/container/flat_hash_map.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/string_view.h"
+#include "re2/set.h"
 #include "src/core/call/metadata_batch.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/xds/grpc/xds_http_filter_registry.h"
@@ -69,6 +72,76 @@ class XdsRouting final {
       const RouteListIterator& route_list_iterator, absl::string_view path,
       grpc_metadata_batch* initial_metadata);
 
+  // Precompiled form of FindVirtualHostForDomain(), for callers that look
+  // up many domains in the same virtual host list. Build it whenever the
+  // list changes.
+  class CompiledVirtualHostList final {
+   public:
+    explicit CompiledVirtualHostList(
+        const VirtualHostListIterator& vhost_iterator);
+
+    // Same result as FindVirtualHostForDomain() for the list this was
+    // built from.
+    std::optional<size_t> FindVirtualHostForDomain(
+        absl::string_view domain) const;
+
+   private:
+    // Patterns of one kind ("*suffix" or "prefix*"), keyed by the part
+    // without the asterisk and grouped by its length, longest first.
+    struct WildcardPatterns {
+      void Add(std::string literal, size_t index);
+      std::optional<size_t> Find(absl::string_view domain, bool suffix) const;
+
+      std::vector<std::pair<size_t, absl::flat_hash_map<std::string, size_t>>>
+          by_length;
+    };
+
+    absl::flat_hash_map<std::string, size_t> exact_;
+    WildcardPatterns suffix_;
+    WildcardPatterns prefix_;
+    std::optional<size_t> universe_;
+  };
+
+  // Precompiled form of GetRouteForRequest(). Exact and prefix path
+  // matchers are looked up by hash and regex path matchers are evaluated
+  // together as one RE2::Set, so that only routes whose path matches have
+  // their header and fraction matchers checked, in route order. Build it
+  // whenever the route list changes.
+  class CompiledRouteList final {
+   public:
+    explicit CompiledRouteList(const RouteListIterator& route_list_iterator);
+
+    // Same result as GetRouteForRequest() for the list this was built from,
+    // which must be passed in again as \a route_list_iterator.
+    std::optional<size_t> GetRouteForRequest(
+        const RouteListIterator& route_list_iterator, absl::string_view path,
+        grpc_metadata_batch* initial_metadata) const;
+
+   private:
+    using RouteIndices = std::vector<uint32_t>;
+
+    // Path strings of one kind, exact or prefix, for one case sensitivity.
+    // Case-insensitive ones are stored lower-cased.
+    struct PathStrings {
+      absl::flat_hash_map<std::string, RouteIndices> exact;
+      // Keyed by length, longest first.
+      std::vector<
+          std::pair<size_t, absl::flat_hash_map<std::string, RouteIndices>>>
+          prefixes;
+    };
+
+    void AddPathMatcher(const StringMatcher& path_matcher, uint32_t index);
+
+    // Indexed by StringMatcher::case_sensitive().
+    PathStrings path_strings_[2];
+    std::unique_ptr<RE2::Set> regex_set_;
+    // Route index of each pattern in regex_set_.
+    RouteIndices regex_routes_;
+    // Routes with a path matcher that is not compiled, checked on every
+    // request.
+    RouteIndices other_routes_;
+  };
+
   // Returns true if \a domain_pattern is a valid domain pattern, false
   // otherwise.
   static bool IsValidDomainPattern(absl::string_view domain_pattern);
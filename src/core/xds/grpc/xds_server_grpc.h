@@ -56,6 +56,7 @@ class GrpcXdsServer final : public XdsBootstrap::XdsServer {
   bool IgnoreResourceDeletion() const override;
   bool FailOnDataErrors() const override;
   bool ResourceTimerIsTransientFailure() const override;
+  bool UseDeltaAds() const override;
   bool TrustedXdsServer() const;
   bool Equals(const XdsServer& other) const override;
   std::string Key() const override;
@@ -112,19 +112,29 @@ LrsClient::ClusterDropStats::~ClusterDropStats() {
 LrsClient::ClusterDropStats::Snapshot
 LrsClient::ClusterDropStats::GetSnapshotAndReset() {
   Snapshot snapshot;
-  snapshot.uncategorized_drops = GetAndResetCounter(&uncategorized_drops_);
-  MutexLock lock(&mu_);
-  snapshot.categorized_drops = std::move(categorized_drops_);
+  for (auto& percpu_stats : stats_) {
+    Snapshot percpu_snapshot;
+    percpu_snapshot.uncategorized_drops =
+        GetAndResetCounter(&percpu_stats.uncategorized_drops);
+    {
+      MutexLock lock(&percpu_stats.mu);
+      percpu_snapshot.categorized_drops =
+          std::exchange(percpu_stats.categorized_drops, {});
+    }
+    snapshot += percpu_snapshot;
+  }
   return snapshot;
 }
 
 void LrsClient::ClusterDropStats::AddUncategorizedDrops() {
-  uncategorized_drops_.fetch_add(1);
+  stats_.this_cpu().uncategorized_drops.fetch_add(1,
+                                                  std::memory_order_relaxed);
 }
 
 void LrsClient::ClusterDropStats::AddCallDropped(const std::string& category) {
-  MutexLock lock(&mu_);
-  ++categorized_drops_[category];
+  Stats& stats = stats_.this_cpu();
+  MutexLock lock(&stats.mu);
+  ++stats.categorized_drops[category];
 }
 
 //
@@ -102,12 +102,20 @@ class LrsClient : public DualRefCounted<LrsClient> {
     absl::string_view lrs_server_;
     absl::string_view cluster_name_;
     absl::string_view eds_service_name_;
-    std::atomic<uint64_t> uncategorized_drops_{0};
-    // Protects categorized_drops_. A mutex is necessary because the length of
-    // dropped_requests can be accessed by both the picker (from data plane
-    // mutex) and the load reporting thread (from the control plane combiner).
-    Mutex mu_;
-    CategorizedDropsMap categorized_drops_ ABSL_GUARDED_BY(mu_);
+    // Drops are counted on the picker's thread, which under overload is
+    // every thread, so they are sharded like the locality stats and only
+    // summed when a load report is sent.
+    struct alignas(GPR_CACHELINE_SIZE) Stats {
+      std::atomic<uint64_t> uncategorized_drops{0};
+      // Protects categorized_drops. A mutex is necessary because the length
+      // of dropped_requests can be accessed by both the picker (from data
+      // plane mutex) and the load reporting thread (from the control plane
+      // combiner).
+      Mutex mu;
+      CategorizedDropsMap categorized_drops ABSL_GUARDED_BY(mu);
+    };
+
+    PerCpu<Stats> stats_{PerCpuOptions().SetMaxShards(32).SetCpusPerShard(4)};
   };
 
   // Locality stats for an xds cluster.
@@ -205,7 +213,8 @@ class LrsClient : public DualRefCounted<LrsClient> {
     XdsLocalityName* locality_name() const { return name_.get(); }
 
    private:
-    struct Stats {
+    // Aligned so that threads on different shards do not share cache lines.
+    struct alignas(GPR_CACHELINE_SIZE) Stats {
       std::atomic<uint64_t> total_successful_requests{0};
       std::atomic<uint64_t> total_requests_in_progress{0};
       std::atomic<uint64_t> total_error_requests{0};
@@ -69,6 +69,9 @@ class XdsBootstrap {
 
     virtual bool FailOnDataErrors() const = 0;
     virtual bool ResourceTimerIsTransientFailure() const = 0;
+    // If true, the ADS stream to this server uses the incremental
+    // (delta) protocol instead of state of the world.
+    virtual bool UseDeltaAds() const = 0;
 
     virtual bool Equals(const XdsServer& other) const = 0;
 
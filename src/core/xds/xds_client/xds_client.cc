@@ -30,6 +30,8 @@
 #include <vector>
 
 #include "absl/cleanup/cleanup.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/hash/hash.h"
 #include "absl/log/check.h"
 #include "absl/log/log.h"
 #include "absl/strings/match.h"
@@ -44,6 +46,7 @@
 #include "google/protobuf/any.upb.h"
 #include "google/protobuf/timestamp.upb.h"
 #include "google/rpc/status.upb.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/util/backoff.h"
 #include "src/core/util/debug_location.h"
@@ -304,6 +307,16 @@ class XdsClient::XdsChannel::AdsCall final
     std::map<std::string /*authority*/,
              std::map<XdsResourceKey, OrphanablePtr<ResourceTimer>>>
         subscribed_resources;
+
+    // Names of accepted resources, keyed by a hash of their serialized
+    // bytes.  Lets us find the cached copy of a resource that arrives
+    // without a name and is unchanged, without decoding it.
+    absl::flat_hash_map<size_t, std::string> resource_names_by_hash;
+
+    // For delta ADS, the names the server has been told we are
+    // subscribed to on this stream.
+    std::set<std::string> delta_subscribed_names;
+    bool delta_request_sent = false;
   };
 
   std::string CreateAdsRequest(absl::string_view type_url,
@@ -312,11 +325,31 @@ class XdsClient::XdsChannel::AdsCall final
                                const std::vector<std::string>& resource_names,
                                absl::Status status) const
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
+  std::string CreateDeltaAdsRequest(
+      absl::string_view type_url, absl::string_view nonce,
+      const std::vector<std::string>& names_subscribe,
+      const std::vector<std::string>& names_unsubscribe,
+      const std::map<std::string, std::string>& initial_resource_versions,
+      absl::Status status) const
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
+
+  // Builds the next delta request for type, and records the names it
+  // subscribes to in state.
+  std::string CreateDeltaAdsRequestLocked(const XdsResourceType* type,
+                                          ResourceTypeState& state)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
 
   void SendMessageLocked(const XdsResourceType* type)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
 
   struct DecodeContext {
+    // Sizes the arena's first block from the response, so that a large
+    // update does not grow the arena one block at a time.
+    explicit DecodeContext(size_t payload_size)
+        : arena(std::max(payload_size * 2, kMinDecodeArenaBlockSize)) {}
+
+    static constexpr size_t kMinDecodeArenaBlockSize = 4096;
+
     upb::Arena arena;
     const XdsResourceType* type;
     std::string type_url;
@@ -333,16 +366,38 @@ class XdsClient::XdsChannel::AdsCall final
   void ParseResource(size_t idx, absl::string_view type_url,
                      absl::string_view resource_name,
                      absl::string_view serialized_resource,
-                     DecodeContext* context)
+                     const std::string& version, DecodeContext* context)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
+  // Returns the cache entry for the named resource, or null if there is
+  // none.
+  ResourceState* LookupResourceStateLocked(const XdsResourceType* type,
+                                           absl::string_view resource_name)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
+  // Returns the cached state of the resource whose last accepted bytes
+  // are serialized_resource, or null if there is none.  On success, sets
+  // *name to the resource's name.
+  const ResourceState* FindUnchangedResource(
+      absl::string_view resource_name, absl::string_view serialized_resource,
+      size_t resource_hash, DecodeContext* context, std::string* name)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
   void HandleServerReportedResourceError(size_t idx,
                                          absl::string_view resource_name,
                                          absl::Status status,
                                          DecodeContext* context)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
+  void HandleResourceRemoval(absl::string_view resource_name,
+                             DecodeContext* context)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
+  void HandleResourceErrors(
+      const envoy_service_discovery_v3_ResourceError* const* errors,
+      size_t num_errors, DecodeContext* context)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
   absl::Status DecodeAdsResponse(absl::string_view encoded_response,
                                  DecodeContext* context)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
+  absl::Status DecodeDeltaAdsResponse(absl::string_view encoded_response,
+                                      DecodeContext* context)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
 
   void OnRequestSent(bool ok);
   void OnRecvMessage(absl::string_view payload);
@@ -714,8 +769,11 @@ XdsClient::XdsChannel::AdsCall::AdsCall(
   CHECK_NE(xds_client(), nullptr);
   // Init the ADS call.
   const char* method =
-      "/envoy.service.discovery.v3.AggregatedDiscoveryService/"
-      "StreamAggregatedResources";
+      xds_channel()->server_.UseDeltaAds()
+          ? "/envoy.service.discovery.v3.AggregatedDiscoveryService/"
+            "DeltaAggregatedResources"
+          : "/envoy.service.discovery.v3.AggregatedDiscoveryService/"
+            "StreamAggregatedResources";
   streaming_call_ = xds_channel()->transport_->CreateStreamingCall(
       method, std::make_unique<StreamEventHandler>(
                   // Passing the initial ref here.  This ref will go away when
@@ -828,6 +886,49 @@ std::string SerializeDiscoveryRequest(
   return std::string(output, output_length);
 }
 
+void MaybeLogDeltaDiscoveryRequest(
+    const XdsClient* client, upb_DefPool* def_pool,
+    const envoy_service_discovery_v3_DeltaDiscoveryRequest* request) {
+  if (GRPC_TRACE_FLAG_ENABLED(xds_client) && ABSL_VLOG_IS_ON(2)) {
+    const upb_MessageDef* msg_type =
+        envoy_service_discovery_v3_DeltaDiscoveryRequest_getmsgdef(def_pool);
+    char buf[10240];
+    upb_TextEncode(reinterpret_cast<const upb_Message*>(request), msg_type,
+                   nullptr, 0, buf, sizeof(buf));
+    VLOG(2) << "[xds_client " << client
+            << "] constructed delta ADS request: " << buf;
+  }
+}
+
+std::string SerializeDeltaDiscoveryRequest(
+    upb_Arena* arena,
+    envoy_service_discovery_v3_DeltaDiscoveryRequest* request) {
+  size_t output_length;
+  char* output = envoy_service_discovery_v3_DeltaDiscoveryRequest_serialize(
+      request, arena, &output_length);
+  return std::string(output, output_length);
+}
+
+// Fills in a NACK's error_detail from status.  The message is copied
+// into the arena.
+google_rpc_Status* MakeNackErrorDetail(const absl::Status& status,
+                                       upb_Arena* arena) {
+  google_rpc_Status* error_detail = google_rpc_Status_new(arena);
+  // Hard-code INVALID_ARGUMENT as the status code.
+  // TODO(roth): If at some point we decide we care about this value,
+  // we could attach a status code to the individual errors where we
+  // generate them in the parsing code, and then use that here.
+  google_rpc_Status_set_code(error_detail, GRPC_STATUS_INVALID_ARGUMENT);
+  // Error description comes from the status that was passed in.
+  absl::string_view message = status.message();
+  char* buf = static_cast<char*>(upb_Arena_Malloc(arena, message.size()));
+  if (!message.empty()) memcpy(buf, message.data(), message.size());
+  google_rpc_Status_set_message(error_detail,
+                                upb_StringView_FromDataAndSize(
+                                    buf, message.size()));
+  return error_detail;
+}
+
 }  // namespace
 
 std::string XdsClient::XdsChannel::AdsCall::CreateAdsRequest(
@@ -853,21 +954,9 @@ std::string XdsClient::XdsChannel::AdsCall::CreateAdsRequest(
         request, StdStringToUpbString(nonce));
   }
   // Set error_detail if it's a NACK.
-  std::string error_string_storage;
   if (!status.ok()) {
-    google_rpc_Status* error_detail =
-        envoy_service_discovery_v3_DiscoveryRequest_mutable_error_detail(
-            request, arena.ptr());
-    // Hard-code INVALID_ARGUMENT as the status code.
-    // TODO(roth): If at some point we decide we care about this value,
-    // we could attach a status code to the individual errors where we
-    // generate them in the parsing code, and then use that here.
-    google_rpc_Status_set_code(error_detail, GRPC_STATUS_INVALID_ARGUMENT);
-    // Error description comes from the status that was passed in.
-    error_string_storage = std::string(status.message());
-    upb_StringView error_description =
-        StdStringToUpbString(error_string_storage);
-    google_rpc_Status_set_message(error_detail, error_description);
+    envoy_service_discovery_v3_DiscoveryRequest_set_error_detail(
+        request, MakeNackErrorDetail(status, arena.ptr()));
   }
   // Populate node.
   if (!sent_initial_message_) {
@@ -891,6 +980,60 @@ std::string XdsClient::XdsChannel::AdsCall::CreateAdsRequest(
   return SerializeDiscoveryRequest(arena.ptr(), request);
 }
 
+std::string XdsClient::XdsChannel::AdsCall::CreateDeltaAdsRequest(
+    absl::string_view type_url, absl::string_view nonce,
+    const std::vector<std::string>& names_subscribe,
+    const std::vector<std::string>& names_unsubscribe,
+    const std::map<std::string, std::string>& initial_resource_versions,
+    absl::Status status) const {
+  upb::Arena arena;
+  // Create a request.
+  envoy_service_discovery_v3_DeltaDiscoveryRequest* request =
+      envoy_service_discovery_v3_DeltaDiscoveryRequest_new(arena.ptr());
+  // Set type_url.
+  std::string type_url_str = absl::StrCat("type.googleapis.com/", type_url);
+  envoy_service_discovery_v3_DeltaDiscoveryRequest_set_type_url(
+      request, StdStringToUpbString(type_url_str));
+  // Set nonce.
+  if (!nonce.empty()) {
+    envoy_service_discovery_v3_DeltaDiscoveryRequest_set_response_nonce(
+        request, StdStringToUpbString(nonce));
+  }
+  // Set error_detail if it's a NACK.
+  if (!status.ok()) {
+    envoy_service_discovery_v3_DeltaDiscoveryRequest_set_error_detail(
+        request, MakeNackErrorDetail(status, arena.ptr()));
+  }
+  // Populate node.
+  if (!sent_initial_message_) {
+    envoy_config_core_v3_Node* node_msg =
+        envoy_service_discovery_v3_DeltaDiscoveryRequest_mutable_node(
+            request, arena.ptr());
+    PopulateXdsNode(xds_client()->bootstrap_->node(),
+                    xds_client()->user_agent_name_,
+                    xds_client()->user_agent_version_, node_msg, arena.ptr());
+  }
+  // Add subscription changes.
+  for (const std::string& resource_name : names_subscribe) {
+    envoy_service_discovery_v3_DeltaDiscoveryRequest_add_resource_names_subscribe(
+        request, StdStringToUpbString(resource_name), arena.ptr());
+  }
+  for (const std::string& resource_name : names_unsubscribe) {
+    envoy_service_discovery_v3_DeltaDiscoveryRequest_add_resource_names_unsubscribe(
+        request, StdStringToUpbString(resource_name), arena.ptr());
+  }
+  // Tell the server which versions we already have, so that it does
+  // not need to resend them.
+  for (const auto& [resource_name, version] : initial_resource_versions) {
+    envoy_service_discovery_v3_DeltaDiscoveryRequest_initial_resource_versions_set(
+        request, StdStringToUpbString(resource_name),
+        StdStringToUpbString(version), arena.ptr());
+  }
+  MaybeLogDeltaDiscoveryRequest(xds_client(), xds_client()->def_pool_.ptr(),
+                                request);
+  return SerializeDeltaDiscoveryRequest(arena.ptr(), request);
+}
+
 void XdsClient::XdsChannel::AdsCall::SendMessageLocked(
     const XdsResourceType* type)
     ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_) {
@@ -902,9 +1045,14 @@ void XdsClient::XdsChannel::AdsCall::SendMessageLocked(
   xds_client()->MaybeRemoveUnsubscribedCacheEntriesForTypeLocked(xds_channel(),
                                                                  type);
   auto& state = state_map_[type];
-  std::string serialized_message = CreateAdsRequest(
-      type->type_url(), xds_channel()->resource_type_version_map_[type],
-      state.nonce, ResourceNamesForRequest(type), state.status);
+  std::string serialized_message;
+  if (xds_channel()->server_.UseDeltaAds()) {
+    serialized_message = CreateDeltaAdsRequestLocked(type, state);
+  } else {
+    serialized_message = CreateAdsRequest(
+        type->type_url(), xds_channel()->resource_type_version_map_[type],
+        state.nonce, ResourceNamesForRequest(type), state.status);
+  }
   sent_initial_message_ = true;
   GRPC_TRACE_LOG(xds_client, INFO)
       << "[xds_client " << xds_client() << "] xds server "
@@ -917,6 +1065,37 @@ void XdsClient::XdsChannel::AdsCall::SendMessageLocked(
   send_message_pending_ = type;
 }
 
+std::string XdsClient::XdsChannel::AdsCall::CreateDeltaAdsRequestLocked(
+    const XdsResourceType* type, ResourceTypeState& state) {
+  // Delta requests carry only the change in the set of names.
+  std::vector<std::string> names = ResourceNamesForRequest(type);
+  std::set<std::string> subscribed(std::make_move_iterator(names.begin()),
+                                   std::make_move_iterator(names.end()));
+  std::vector<std::string> names_subscribe;
+  std::map<std::string, std::string> initial_resource_versions;
+  for (const std::string& name : subscribed) {
+    if (state.delta_subscribed_names.count(name) > 0) continue;
+    names_subscribe.push_back(name);
+    // On the first request of the stream, report the versions we have
+    // cached from a previous stream.
+    if (state.delta_request_sent) continue;
+    const ResourceState* resource_state =
+        LookupResourceStateLocked(type, name);
+    if (resource_state != nullptr && resource_state->HasResource()) {
+      initial_resource_versions.emplace(name, resource_state->version());
+    }
+  }
+  std::vector<std::string> names_unsubscribe;
+  for (const std::string& name : state.delta_subscribed_names) {
+    if (subscribed.count(name) == 0) names_unsubscribe.push_back(name);
+  }
+  state.delta_subscribed_names = std::move(subscribed);
+  state.delta_request_sent = true;
+  return CreateDeltaAdsRequest(type->type_url(), state.nonce, names_subscribe,
+                               names_unsubscribe, initial_resource_versions,
+                               state.status);
+}
+
 void XdsClient::XdsChannel::AdsCall::OnRequestSent(bool ok) {
   MutexLock lock(&xds_client()->mu_);
   // For each resource that was in the message we just sent, start the
@@ -952,7 +1131,8 @@ void XdsClient::XdsChannel::AdsCall::OnRequestSent(bool ok) {
 
 void XdsClient::XdsChannel::AdsCall::ParseResource(
     size_t idx, absl::string_view type_url, absl::string_view resource_name,
-    absl::string_view serialized_resource, DecodeContext* context) {
+    absl::string_view serialized_resource, const std::string& version,
+    DecodeContext* context) {
   std::string error_prefix = absl::StrCat(
       "resource index ", idx, ": ",
       resource_name.empty() ? "" : absl::StrCat(resource_name, ": "));
@@ -964,12 +1144,25 @@ void XdsClient::XdsChannel::AdsCall::ParseResource(
     ++context->num_invalid_resources;
     return;
   }
-  // Parse the resource.
-  XdsResourceType::DecodeContext resource_type_context = {
-      xds_client(), xds_channel()->server_, xds_client()->def_pool_.ptr(),
-      context->arena.ptr()};
-  XdsResourceType::DecodeResult decode_result =
-      context->type->Decode(resource_type_context, serialized_resource);
+  // Parse the resource, unless it is byte-for-byte the one we have.
+  const size_t resource_hash = absl::HashOf(serialized_resource);
+  XdsResourceType::DecodeResult decode_result;
+  std::string unchanged_name;
+  const ResourceState* unchanged_state =
+      IsXdsSkipUnchangedResourcesEnabled()
+          ? FindUnchangedResource(resource_name, serialized_resource,
+                                  resource_hash, context, &unchanged_name)
+          : nullptr;
+  if (unchanged_state != nullptr) {
+    decode_result.name = std::move(unchanged_name);
+    decode_result.resource = unchanged_state->resource();
+  } else {
+    XdsResourceType::DecodeContext resource_type_context = {
+        xds_client(), xds_channel()->server_, xds_client()->def_pool_.ptr(),
+        context->arena.ptr()};
+    decode_result =
+        context->type->Decode(resource_type_context, serialized_resource);
+  }
   // If we didn't already have the resource name from the Resource
   // wrapper, try to get it from the decoding result.
   if (resource_name.empty()) {
@@ -1045,7 +1238,7 @@ void XdsClient::XdsChannel::AdsCall::ParseResource(
     // existing cached resource, if any.
     const bool drop_cached_resource = XdsDataErrorHandlingEnabled() &&
                                       xds_channel()->server_.FailOnDataErrors();
-    resource_state.SetNacked(context->version, decode_status.message(),
+    resource_state.SetNacked(version, decode_status.message(),
                              context->update_time, drop_cached_resource);
     xds_client()->NotifyWatchersOnError(resource_state,
                                         context->read_delay_handle);
@@ -1056,15 +1249,32 @@ void XdsClient::XdsChannel::AdsCall::ParseResource(
   // Check if the resource has changed.
   const bool resource_identical =
       resource_state.HasResource() &&
-      context->type->ResourcesEqual(resource_state.resource().get(),
-                                    decode_result.resource->get());
+      (resource_state.resource() == *decode_result.resource ||
+       context->type->ResourcesEqual(resource_state.resource().get(),
+                                     decode_result.resource->get()));
+  // Index the accepted bytes, so that the next copy of them can skip
+  // decoding.
+  if (IsXdsSkipUnchangedResourcesEnabled()) {
+    auto type_state_it = state_map_.find(context->type);
+    if (type_state_it != state_map_.end()) {
+      auto& names_by_hash = type_state_it->second.resource_names_by_hash;
+      if (resource_state.HasResource()) {
+        auto it = names_by_hash.find(
+            absl::HashOf(absl::string_view(resource_state.serialized_proto())));
+        if (it != names_by_hash.end() && it->second == resource_name) {
+          names_by_hash.erase(it);
+        }
+      }
+      names_by_hash[resource_hash] = std::string(resource_name);
+    }
+  }
   // If not changed, keep using the current decoded resource object.
   // This should avoid wasting memory, since external watchers may be
   // holding refs to the current object.
   if (resource_identical) decode_result.resource = resource_state.resource();
   // Update the resource state.
   resource_state.SetAcked(std::move(*decode_result.resource),
-                          std::string(serialized_resource), context->version,
+                          std::string(serialized_resource), version,
                           context->update_time);
   // If the resource didn't change, inhibit watcher notifications.
   if (resource_identical) {
@@ -1086,6 +1296,45 @@ void XdsClient::XdsChannel::AdsCall::ParseResource(
                                                 context->read_delay_handle);
 }
 
+const XdsClient::ResourceState*
+XdsClient::XdsChannel::AdsCall::FindUnchangedResource(
+    absl::string_view resource_name, absl::string_view serialized_resource,
+    size_t resource_hash, DecodeContext* context, std::string* name) {
+  if (resource_name.empty()) {
+    auto type_state_it = state_map_.find(context->type);
+    if (type_state_it == state_map_.end()) return nullptr;
+    const auto& names_by_hash = type_state_it->second.resource_names_by_hash;
+    auto it = names_by_hash.find(resource_hash);
+    if (it == names_by_hash.end()) return nullptr;
+    resource_name = it->second;
+  }
+  const ResourceState* resource_state =
+      LookupResourceStateLocked(context->type, resource_name);
+  // Hashes can collide, so compare the bytes themselves.
+  if (resource_state == nullptr || !resource_state->HasResource() ||
+      resource_state->serialized_proto() != serialized_resource) {
+    return nullptr;
+  }
+  *name = std::string(resource_name);
+  return resource_state;
+}
+
+XdsClient::ResourceState*
+XdsClient::XdsChannel::AdsCall::LookupResourceStateLocked(
+    const XdsResourceType* type, absl::string_view resource_name) {
+  auto parsed_resource_name =
+      xds_client()->ParseXdsResourceName(resource_name, type);
+  if (!parsed_resource_name.ok()) return nullptr;
+  auto authority_it =
+      xds_client()->authority_state_map_.find(parsed_resource_name->authority);
+  if (authority_it == xds_client()->authority_state_map_.end()) return nullptr;
+  auto type_it = authority_it->second.type_map.find(type);
+  if (type_it == authority_it->second.type_map.end()) return nullptr;
+  auto res_it = type_it->second.find(parsed_resource_name->key);
+  if (res_it == type_it->second.end()) return nullptr;
+  return &res_it->second;
+}
+
 void XdsClient::XdsChannel::AdsCall::HandleServerReportedResourceError(
     size_t idx, absl::string_view resource_name, absl::Status status,
     DecodeContext* context) {
@@ -1186,6 +1435,20 @@ void MaybeLogDiscoveryResponse(
   }
 }
 
+void MaybeLogDeltaDiscoveryResponse(
+    const XdsClient* client, upb_DefPool* def_pool,
+    const envoy_service_discovery_v3_DeltaDiscoveryResponse* response) {
+  if (GRPC_TRACE_FLAG_ENABLED(xds_client) && ABSL_VLOG_IS_ON(2)) {
+    const upb_MessageDef* msg_type =
+        envoy_service_discovery_v3_DeltaDiscoveryResponse_getmsgdef(def_pool);
+    char buf[10240];
+    upb_TextEncode(reinterpret_cast<const upb_Message*>(response), msg_type,
+                   nullptr, 0, buf, sizeof(buf));
+    VLOG(2) << "[xds_client " << client
+            << "] received delta response: " << buf;
+  }
+}
+
 }  // namespace
 
 absl::Status XdsClient::XdsChannel::AdsCall::DecodeAdsResponse(
@@ -1269,9 +1532,16 @@ absl::Status XdsClient::XdsChannel::AdsCall::DecodeAdsResponse(
       resource_name = UpbStringToAbsl(
           envoy_service_discovery_v3_Resource_name(resource_wrapper));
     }
-    ParseResource(i, type_url, resource_name, serialized_resource, context);
+    ParseResource(i, type_url, resource_name, serialized_resource,
+                  context->version, context);
   }
-  // Process each error.
+  HandleResourceErrors(errors, num_errors, context);
+  return absl::OkStatus();
+}
+
+void XdsClient::XdsChannel::AdsCall::HandleResourceErrors(
+    const envoy_service_discovery_v3_ResourceError* const* errors,
+    size_t num_errors, DecodeContext* context) {
   for (size_t i = 0; i < num_errors; ++i) {
     absl::string_view name;
     {
@@ -1294,17 +1564,119 @@ absl::Status XdsClient::XdsChannel::AdsCall::DecodeAdsResponse(
     }
     HandleServerReportedResourceError(i, name, std::move(status), context);
   }
+}
+
+absl::Status XdsClient::XdsChannel::AdsCall::DecodeDeltaAdsResponse(
+    absl::string_view encoded_response, DecodeContext* context) {
+  // Decode the response.
+  const envoy_service_discovery_v3_DeltaDiscoveryResponse* response =
+      envoy_service_discovery_v3_DeltaDiscoveryResponse_parse(
+          encoded_response.data(), encoded_response.size(),
+          context->arena.ptr());
+  // If decoding fails, report a fatal error and return.
+  if (response == nullptr) {
+    return absl::InvalidArgumentError("Can't decode DeltaDiscoveryResponse.");
+  }
+  MaybeLogDeltaDiscoveryResponse(xds_client(), xds_client()->def_pool_.ptr(),
+                                 response);
+  // Get the type_url, version, nonce, number of resources, and number
+  // of errors.
+  context->type_url = std::string(absl::StripPrefix(
+      UpbStringToAbsl(
+          envoy_service_discovery_v3_DeltaDiscoveryResponse_type_url(response)),
+      "type.googleapis.com/"));
+  context->version = UpbStringToStdString(
+      envoy_service_discovery_v3_DeltaDiscoveryResponse_system_version_info(
+          response));
+  context->nonce = UpbStringToStdString(
+      envoy_service_discovery_v3_DeltaDiscoveryResponse_nonce(response));
+  size_t num_resources;
+  const envoy_service_discovery_v3_Resource* const* resources =
+      envoy_service_discovery_v3_DeltaDiscoveryResponse_resources(
+          response, &num_resources);
+  size_t num_removed;
+  const upb_StringView* removed =
+      envoy_service_discovery_v3_DeltaDiscoveryResponse_removed_resources(
+          response, &num_removed);
+  size_t num_errors = 0;
+  const envoy_service_discovery_v3_ResourceError* const* errors = nullptr;
+  if (XdsDataErrorHandlingEnabled()) {
+    errors = envoy_service_discovery_v3_DeltaDiscoveryResponse_resource_errors(
+        response, &num_errors);
+  }
+  GRPC_TRACE_LOG(xds_client, INFO)
+      << "[xds_client " << xds_client() << "] xds server "
+      << xds_channel()->server_uri()
+      << ": received delta ADS response: type_url=" << context->type_url
+      << ", system_version=" << context->version
+      << ", nonce=" << context->nonce << ", num_resources=" << num_resources
+      << ", num_removed=" << num_removed << ", num_errors=" << num_errors;
+  context->type = xds_client()->GetResourceTypeLocked(context->type_url);
+  if (context->type == nullptr) {
+    return absl::InvalidArgumentError(
+        absl::StrCat("unknown resource type ", context->type_url));
+  }
+  context->read_delay_handle = MakeRefCounted<AdsReadDelayHandle>(Ref());
+  // Process each resource.  Every resource is in a Resource wrapper,
+  // which carries its name and version.
+  for (size_t i = 0; i < num_resources; ++i) {
+    const auto* resource =
+        envoy_service_discovery_v3_Resource_resource(resources[i]);
+    if (resource == nullptr) {
+      context->errors.emplace_back(absl::StrCat(
+          "resource index ", i, ": No resource present in Resource proto"));
+      ++context->num_invalid_resources;
+      continue;
+    }
+    absl::string_view type_url = absl::StripPrefix(
+        UpbStringToAbsl(google_protobuf_Any_type_url(resource)),
+        "type.googleapis.com/");
+    ParseResource(
+        i, type_url,
+        UpbStringToAbsl(envoy_service_discovery_v3_Resource_name(resources[i])),
+        UpbStringToAbsl(google_protobuf_Any_value(resource)),
+        UpbStringToStdString(
+            envoy_service_discovery_v3_Resource_version(resources[i])),
+        context);
+  }
+  // Process each removal.
+  for (size_t i = 0; i < num_removed; ++i) {
+    HandleResourceRemoval(UpbStringToAbsl(removed[i]), context);
+  }
+  HandleResourceErrors(errors, num_errors, context);
   return absl::OkStatus();
 }
 
+void XdsClient::XdsChannel::AdsCall::HandleResourceRemoval(
+    absl::string_view resource_name, DecodeContext* context) {
+  ResourceState* resource_state =
+      LookupResourceStateLocked(context->type, resource_name);
+  if (resource_state == nullptr) {
+    return;  // Skip resource -- we don't have a subscription for it.
+  }
+  // Unlike state of the world, delta tells us about removals of every
+  // resource type.  If we never got the resource, let the timer decide.
+  if (!resource_state->HasResource()) return;
+  const bool drop_cached_resource =
+      XdsDataErrorHandlingEnabled()
+          ? xds_channel()->server_.FailOnDataErrors()
+          : !xds_channel()->server_.IgnoreResourceDeletion();
+  resource_state->SetDoesNotExistOnLdsOrCdsDeletion(
+      context->version, context->update_time, drop_cached_resource);
+  xds_client()->NotifyWatchersOnError(*resource_state,
+                                      context->read_delay_handle);
+}
+
 void XdsClient::XdsChannel::AdsCall::OnRecvMessage(absl::string_view payload) {
   // context.read_delay_handle needs to be destroyed after the mutex is
   // released.
-  DecodeContext context;
+  DecodeContext context(payload.size());
   MutexLock lock(&xds_client()->mu_);
   if (!IsCurrentCallOnChannel()) return;
   // Parse and validate the response.
-  absl::Status status = DecodeAdsResponse(payload, &context);
+  absl::Status status = xds_channel()->server_.UseDeltaAds()
+                            ? DecodeDeltaAdsResponse(payload, &context)
+                            : DecodeAdsResponse(payload, &context);
   if (!status.ok()) {
     // Ignore unparsable response.
     LOG(ERROR) << "[xds_client " << xds_client() << "] xds server "
@@ -1328,8 +1700,10 @@ void XdsClient::XdsChannel::AdsCall::OnRecvMessage(absl::string_view payload) {
                  << ", will NACK: nonce=" << state.nonce
                  << " status=" << state.status;
     }
-    // Delete resources not seen in update if needed.
-    if (context.type->AllResourcesRequiredInSotW()) {
+    // Delete resources not seen in update if needed.  Delta responses
+    // list removals explicitly instead.
+    if (!xds_channel()->server_.UseDeltaAds() &&
+        context.type->AllResourcesRequiredInSotW()) {
       for (auto& [authority, authority_state] :
            xds_client()->authority_state_map_) {
         // Skip authorities that are not using this xDS channel.
@@ -1446,7 +1820,8 @@ void XdsClient::ResourceState::SetAcked(
     std::string serialized_proto, std::string version, Timestamp update_time) {
   resource_ = std::move(resource);
   client_status_ = ClientResourceStatus::ACKED;
-  serialized_proto_ = std::move(serialized_proto);
+  serialized_proto_ =
+      std::make_shared<const std::string>(std::move(serialized_proto));
   update_time_ = update_time;
   version_ = std::move(version);
   failed_version_.clear();
@@ -1459,7 +1834,7 @@ void XdsClient::ResourceState::SetNacked(const std::string& version,
                                          bool drop_cached_resource) {
   if (drop_cached_resource) {
     resource_.reset();
-    serialized_proto_.clear();
+    serialized_proto_.reset();
   }
   client_status_ = ClientResourceStatus::NACKED;
   failed_status_ =
@@ -1474,7 +1849,7 @@ void XdsClient::ResourceState::SetReceivedError(const std::string& version,
                                                 bool drop_cached_resource) {
   if (drop_cached_resource) {
     resource_.reset();
-    serialized_proto_.clear();
+    serialized_proto_.reset();
   }
   client_status_ = ClientResourceStatus::RECEIVED_ERROR;
   failed_version_ = version;
@@ -1487,7 +1862,7 @@ void XdsClient::ResourceState::SetDoesNotExistOnLdsOrCdsDeletion(
     bool drop_cached_resource) {
   if (drop_cached_resource) {
     resource_.reset();
-    serialized_proto_.clear();
+    serialized_proto_.reset();
   }
   client_status_ = ClientResourceStatus::DOES_NOT_EXIST;
   failed_status_ = absl::NotFoundError("does not exist");
@@ -1540,33 +1915,38 @@ google_protobuf_Timestamp* EncodeTimestamp(Timestamp value, upb_Arena* arena) {
 }  // namespace
 
 void XdsClient::ResourceState::FillGenericXdsConfig(
-    upb_StringView type_url, upb_StringView resource_name, upb_Arena* arena,
+    upb_StringView type_url, upb_StringView resource_name,
+    ConfigDumpStorage* storage, upb_Arena* arena,
     envoy_service_status_v3_ClientConfig_GenericXdsConfig* entry) const {
+  auto copy_string = [storage](absl::string_view s) {
+    return StdStringToUpbString(*storage->strings.emplace(s).first);
+  };
   envoy_service_status_v3_ClientConfig_GenericXdsConfig_set_type_url(entry,
                                                                      type_url);
   envoy_service_status_v3_ClientConfig_GenericXdsConfig_set_name(entry,
                                                                  resource_name);
   envoy_service_status_v3_ClientConfig_GenericXdsConfig_set_client_status(
       entry, client_status_);
-  if (!serialized_proto_.empty()) {
+  if (serialized_proto_ != nullptr && !serialized_proto_->empty()) {
     envoy_service_status_v3_ClientConfig_GenericXdsConfig_set_version_info(
-        entry, StdStringToUpbString(version_));
+        entry, copy_string(version_));
     envoy_service_status_v3_ClientConfig_GenericXdsConfig_set_last_updated(
         entry, EncodeTimestamp(update_time_, arena));
     auto* any_field =
         envoy_service_status_v3_ClientConfig_GenericXdsConfig_mutable_xds_config(
             entry, arena);
     google_protobuf_Any_set_type_url(any_field, type_url);
+    storage->serialized_resources.push_back(serialized_proto_);
     google_protobuf_Any_set_value(any_field,
-                                  StdStringToUpbString(serialized_proto_));
+                                  StdStringToUpbString(*serialized_proto_));
   }
   if (!failed_status_.ok()) {
     auto* update_failure_state = envoy_admin_v3_UpdateFailureState_new(arena);
     envoy_admin_v3_UpdateFailureState_set_details(
-        update_failure_state, StdStringToUpbString(failed_status_.message()));
+        update_failure_state, copy_string(failed_status_.message()));
     if (!failed_version_.empty()) {
       envoy_admin_v3_UpdateFailureState_set_version_info(
-          update_failure_state, StdStringToUpbString(failed_version_));
+          update_failure_state, copy_string(failed_version_));
       envoy_admin_v3_UpdateFailureState_set_last_update_attempt(
           update_failure_state, EncodeTimestamp(failed_update_time_, arena));
     }
@@ -1951,7 +2331,7 @@ void XdsClient::NotifyWatchersOnError(
 }
 
 void XdsClient::DumpClientConfig(
-    std::set<std::string>* string_pool, upb_Arena* arena,
+    ConfigDumpStorage* storage, upb_Arena* arena,
     envoy_service_status_v3_ClientConfig* client_config) {
   // Assemble config dump messages
   // Fill-in the node information
@@ -1962,23 +2342,23 @@ void XdsClient::DumpClientConfig(
   // Dump each resource.
   for (const auto& [authority, authority_state] : authority_state_map_) {
     for (const auto& [type, resource_map] : authority_state.type_map) {
-      auto it =
-          string_pool
-              ->emplace(absl::StrCat("type.googleapis.com/", type->type_url()))
-              .first;
+      auto it = storage->strings
+                    .emplace(absl::StrCat("type.googleapis.com/",
+                                          type->type_url()))
+                    .first;
       upb_StringView type_url = StdStringToUpbString(*it);
       for (const auto& [resource_key, resource_state] : resource_map) {
         if (!resource_state.HasWatchers()) continue;
-        auto it2 = string_pool
-                       ->emplace(ConstructFullXdsResourceName(
+        auto it2 = storage->strings
+                       .emplace(ConstructFullXdsResourceName(
                            authority, type->type_url(), resource_key))
                        .first;
         upb_StringView resource_name = StdStringToUpbString(*it2);
         envoy_service_status_v3_ClientConfig_GenericXdsConfig* entry =
             envoy_service_status_v3_ClientConfig_add_generic_xds_configs(
                 client_config, arena);
-        resource_state.FillGenericXdsConfig(type_url, resource_name, arena,
-                                            entry);
+        resource_state.FillGenericXdsConfig(type_url, resource_name, storage,
+                                            arena, entry);
       }
     }
   }
@@ -140,9 +140,17 @@ class XdsClient : public DualRefCounted<XdsClient> {
 
   Mutex* mu() ABSL_LOCK_RETURNED(&mu_) { return &mu_; }
 
+  // Everything a ClientConfig filled in by DumpClientConfig() points into
+  // that mu_ guards, so that the config can be serialized after mu_ is
+  // released. Resources are held by reference rather than copied.
+  struct ConfigDumpStorage {
+    std::set<std::string> strings;
+    std::vector<std::shared_ptr<const std::string>> serialized_resources;
+  };
+
   // Dumps the active xDS config to the provided
   // envoy.service.status.v3.ClientConfig message.
-  void DumpClientConfig(std::set<std::string>* string_pool, upb_Arena* arena,
+  void DumpClientConfig(ConfigDumpStorage* storage, upb_Arena* arena,
                         envoy_service_status_v3_ClientConfig* client_config)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(&mu_);
 
@@ -330,9 +338,15 @@ class XdsClient : public DualRefCounted<XdsClient> {
     }
 
     const absl::Status& failed_status() const { return failed_status_; }
+    absl::string_view serialized_proto() const {
+      if (serialized_proto_ == nullptr) return absl::string_view();
+      return *serialized_proto_;
+    }
+    const std::string& version() const { return version_; }
 
     void FillGenericXdsConfig(
-        upb_StringView type_url, upb_StringView resource_name, upb_Arena* arena,
+        upb_StringView type_url, upb_StringView resource_name,
+        ConfigDumpStorage* storage, upb_Arena* arena,
         envoy_service_status_v3_ClientConfig_GenericXdsConfig* entry) const;
 
    private:
@@ -342,7 +356,9 @@ class XdsClient : public DualRefCounted<XdsClient> {
     // Cache state.
     ClientResourceStatus client_status_ = REQUESTED;
     // The serialized bytes of the last successfully updated raw xDS resource.
-    std::string serialized_proto_;
+    // Replaced rather than modified, so that a config dump can keep a
+    // reference to it.
+    std::shared_ptr<const std::string> serialized_proto_;
     // The timestamp when the resource was last successfully updated.
     Timestamp update_time_;
     // The last successfully updated version of the resource.
@@ -32,7 +32,10 @@
 #include <grpcpp/support/client_interceptor.h>
 #include <grpcpp/support/slice.h>
 
+#include <algorithm>
 #include <atomic>
+#include <cmath>
+#include <cstdint>
 #include <cstring>
 #include <memory>
 #include <string>
@@ -105,6 +108,86 @@ void ChannelResetConnectionBackoff(Channel* channel) {
   grpc_channel_reset_connect_backoff(channel->c_channel_);
 }
 
+namespace {
+
+// How long each connectivity state watch in WarmupChannels() lasts before it
+// is renewed.  This bounds how long WarmupChannels() waits for its watches to
+// finish once it is done.
+constexpr int64_t kWarmupWatchIntervalMs = 100;
+
+}  // namespace
+
+bool WarmupChannels(const std::vector<std::shared_ptr<Channel>>& channels,
+                    const ChannelWarmupOptions& options,
+                    gpr_timespec deadline) {
+  deadline = gpr_convert_clock_type(deadline, GPR_CLOCK_MONOTONIC);
+  const double target_fraction =
+      std::clamp(options.target_ready_fraction, 0.0, 1.0);
+  const size_t target = std::min(
+      channels.size(),
+      static_cast<size_t>(std::ceil(target_fraction * channels.size())));
+  const size_t max_connecting =
+      std::max<size_t>(options.max_concurrent_connects, 1);
+  struct WarmingChannel {
+    Channel* channel;
+    grpc_connectivity_state state = GRPC_CHANNEL_IDLE;
+    // Whether the channel still counts against max_connecting.
+    bool connecting = true;
+  };
+  std::vector<WarmingChannel> warming;
+  warming.reserve(channels.size());
+  CompletionQueue cq;
+  size_t ready = 0;
+  size_t connecting = 0;
+  size_t pending_watches = 0;
+  // Gets the channel's state, kicking it out of IDLE, and unless it is READY
+  // or SHUTDOWN, watches it for its next state change.  A channel stops
+  // counting against max_connecting once its first connection attempts are
+  // over; after that it retries with backoff.
+  auto update = [&](WarmingChannel* c) {
+    c->state = c->channel->GetState(/*try_to_connect=*/true);
+    if (c->connecting && c->state != GRPC_CHANNEL_IDLE &&
+        c->state != GRPC_CHANNEL_CONNECTING) {
+      c->connecting = false;
+      --connecting;
+    }
+    if (c->state == GRPC_CHANNEL_READY) {
+      ++ready;
+      return;
+    }
+    if (c->state == GRPC_CHANNEL_SHUTDOWN) return;
+    c->channel->NotifyOnStateChange(
+        c->state,
+        gpr_time_min(deadline,
+                     gpr_time_add(gpr_now(GPR_CLOCK_MONOTONIC),
+                                  gpr_time_from_millis(kWarmupWatchIntervalMs,
+                                                       GPR_TIMESPAN))),
+        &cq, c);
+    ++pending_watches;
+  };
+  while (ready < target) {
+    while (warming.size() < channels.size() && connecting < max_connecting) {
+      warming.push_back({channels[warming.size()].get()});
+      ++connecting;
+      update(&warming.back());
+    }
+    if (ready >= target || pending_watches == 0) break;
+    void* tag;
+    bool ok;
+    CHECK(cq.Next(&tag, &ok));
+    --pending_watches;
+    if (gpr_time_cmp(gpr_now(GPR_CLOCK_MONOTONIC), deadline) >= 0) break;
+    update(static_cast<WarmingChannel*>(tag));
+  }
+  // Wait for the watches that are still pending.
+  cq.Shutdown();
+  void* tag;
+  bool ok;
+  while (cq.Next(&tag, &ok)) {
+  }
+  return ready >= target;
+}
+
 }  // namespace experimental
 
 grpc::internal::Call Channel::CreateCallInternal(
@@ -150,7 +233,9 @@ grpc::internal::Call Channel::CreateCallInternal(
       interceptor_creators_, interceptor_pos);
   context->set_call(c_call, shared_from_this());
 
-  return grpc::internal::Call(c_call, this, cq, info);
+  grpc::internal::Call call(c_call, this, cq, info);
+  call.set_pass_message_objects(pass_message_objects_);
+  return call;
 }
 
 grpc::internal::Call Channel::CreateCall(
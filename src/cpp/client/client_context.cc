@@ -38,6 +38,7 @@
 #include <vector>
 
 #include "absl/log/check.h"
+#include "absl/strings/str_cat.h"
 #include "absl/strings/str_format.h"
 #include "src/core/util/crash.h"
 
@@ -150,6 +151,11 @@ void ClientContext::set_compression_algorithm(
   AddMetadata(GRPC_COMPRESSION_REQUEST_ALGORITHM_MD_KEY, algorithm_name);
 }
 
+void ClientContext::set_write_priority(uint32_t priority) {
+  CHECK_LE(priority, static_cast<uint32_t>(GRPC_MAX_WRITE_PRIORITY));
+  AddMetadata(GRPC_WRITE_PRIORITY_MD_KEY, absl::StrCat(priority));
+}
+
 void ClientContext::TryCancel() {
   internal::MutexLock lock(&mu_);
   if (call_) {
@@ -23,6 +23,7 @@
 #include <grpcpp/impl/completion_queue_tag.h>
 #include <grpcpp/impl/grpc_library.h>
 
+#include <algorithm>
 #include <vector>
 
 #include "absl/base/thread_annotations.h"
@@ -163,6 +164,30 @@ CompletionQueue::NextStatus CompletionQueue::AsyncNextInternal(
   }
 }
 
+int CompletionQueue::NextBatch(void** tags, bool* oks, int max_events) {
+  constexpr int kMaxBatch = 32;
+  grpc_event events[kMaxBatch];
+  for (;;) {
+    int n = grpc_completion_queue_next_batch(
+        cq_, events, std::min(max_events, kMaxBatch),
+        gpr_inf_future(GPR_CLOCK_REALTIME), nullptr);
+    if (events[0].type != GRPC_OP_COMPLETE) return 0;
+    int num_events = 0;
+    for (int i = 0; i < n; ++i) {
+      auto core_cq_tag =
+          static_cast<grpc::internal::CompletionQueueTag*>(events[i].tag);
+      void* tag = core_cq_tag;
+      bool ok = events[i].success != 0;
+      if (core_cq_tag->FinalizeResult(&tag, &ok)) {
+        tags[num_events] = tag;
+        oks[num_events] = ok;
+        ++num_events;
+      }
+    }
+    if (num_events > 0) return num_events;
+  }
+}
+
 CompletionQueue::CompletionQueueTLSCache::CompletionQueueTLSCache(
     CompletionQueue* cq)
     : cq_(cq), flushed_(false) {
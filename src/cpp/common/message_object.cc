@@ -0,0 +1,116 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpc/slice.h>
+#include <grpcpp/impl/message_object.h>
+#include <grpcpp/support/byte_buffer.h>
+#include <grpcpp/support/slice.h>
+
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <utility>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "src/core/util/no_destruct.h"
+#include "src/core/util/sync.h"
+
+namespace grpc {
+namespace internal {
+
+namespace {
+
+// The token starts with a zero byte, which is not a valid protobuf tag.
+constexpr char kTokenMagic[MessageObject::kTokenSize] = "\0grpc-msg-obj";
+
+// Objects that are alive, keyed by the address of their token.
+class Registry {
+ public:
+  void Add(const uint8_t* token, MessageObject* object) {
+    grpc_core::MutexLock lock(&mu_);
+    objects_.emplace(token, object);
+  }
+
+  void Remove(const uint8_t* token) {
+    grpc_core::MutexLock lock(&mu_);
+    objects_.erase(token);
+  }
+
+  MessageObject* Find(const uint8_t* token) {
+    grpc_core::MutexLock lock(&mu_);
+    auto it = objects_.find(token);
+    return it == objects_.end() ? nullptr : it->second;
+  }
+
+ private:
+  grpc_core::Mutex mu_;
+  absl::flat_hash_map<const uint8_t*, MessageObject*> objects_
+      ABSL_GUARDED_BY(mu_);
+};
+
+Registry& GetRegistry() {
+  static grpc_core::NoDestruct<Registry> registry;
+  return *registry;
+}
+
+std::atomic<size_t> g_num_moved{0};
+
+}  // namespace
+
+MessageObject::MessageObject(const void* type) : type_(type) {
+  memcpy(token_, kTokenMagic, kTokenSize);
+}
+
+void MessageObject::ToByteBuffer(std::unique_ptr<MessageObject> object,
+                                 ByteBuffer* buffer) {
+  MessageObject* raw = object.release();
+  GetRegistry().Add(raw->token_, raw);
+  Slice slice(grpc_slice_new_with_user_data(raw->token_, kTokenSize, Destroy,
+                                            raw),
+              Slice::STEAL_REF);
+  ByteBuffer carrier(&slice, 1);
+  buffer->Swap(&carrier);
+}
+
+MessageObject* MessageObject::Lookup(const uint8_t* token) {
+  return GetRegistry().Find(token);
+}
+
+void MessageObject::Destroy(void* object) {
+  MessageObject* message_object = static_cast<MessageObject*>(object);
+  GetRegistry().Remove(message_object->token_);
+  delete message_object;
+}
+
+size_t MessageObject::NumMovedForTesting() {
+  return g_num_moved.load(std::memory_order_relaxed);
+}
+
+void MessageObject::CountMoved() {
+  g_num_moved.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool MaterializeMessageObject(ByteBuffer* source, ByteBuffer* dest,
+                              Status* status) {
+  MessageObject* object = MessageObject::FromByteBuffer(source);
+  if (object == nullptr) return false;
+  dest->Clear();
+  *status = object->Serialize(dest);
+  source->Clear();
+  return true;
+}
+
+}  // namespace internal
+}  // namespace grpc
@@ -40,4 +40,9 @@ ResourceQuota& ResourceQuota::SetMaxThreads(int new_max_threads) {
   grpc_resource_quota_set_max_threads(impl_, new_max_threads);
   return *this;
 }
+
+ResourceQuota& ResourceQuota::SetMaxCpu(double max_cores) {
+  grpc_resource_quota_set_max_cpu(impl_, max_cores);
+  return *this;
+}
 }  // namespace grpc
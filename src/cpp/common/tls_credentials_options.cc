@@ -150,5 +150,13 @@ void TlsServerCredentialsOptions::set_send_client_ca_list(
                                                        send_client_ca_list);
 }
 
+void TlsServerCredentialsOptions::set_tls_session_ticket_key_file_path(
+    const std::string& tls_session_ticket_key_file_path) {
+  grpc_tls_credentials_options* options = mutable_c_credentials_options();
+  CHECK_NE(options, nullptr);
+  grpc_tls_credentials_options_set_tls_session_ticket_key_file_path(
+      options, tls_session_ticket_key_file_path.c_str());
+}
+
 }  // namespace experimental
 }  // namespace grpc
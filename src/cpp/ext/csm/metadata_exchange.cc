@@ -25,16 +25,19 @@
 #include <algorithm>
 #include <array>
 #include <cstdint>
+#include <memory>
 #include <optional>
+#include <string>
 #include <unordered_map>
 #include <variant>
+#include <vector>
 
-#include "absl/log/check.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/escaping.h"
 #include "absl/strings/str_split.h"
 #include "absl/strings/string_view.h"
 #include "absl/strings/strip.h"
+#include "google/protobuf/struct.upb.h"
 #include "opentelemetry/sdk/resource/semantic_conventions.h"
 #include "src/core/lib/iomgr/error.h"
 #include "src/core/lib/slice/slice_internal.h"
@@ -42,6 +45,7 @@
 #include "src/core/util/env.h"
 #include "src/cpp/ext/otel/key_value_iterable.h"
 #include "upb/base/string_view.h"
+#include "upb/mem/arena.hpp"
 
 namespace grpc {
 namespace internal {
@@ -83,18 +87,17 @@ constexpr absl::string_view kPeerCanonicalServiceAttribute =
 constexpr absl::string_view kGkeType = "gcp_kubernetes_engine";
 constexpr absl::string_view kGceType = "gcp_compute_engine";
 
-// A helper method that decodes the remote metadata \a slice as a protobuf
-// Struct allocated on \a arena.
-google_protobuf_Struct* DecodeMetadata(grpc_core::Slice slice,
+// A helper method that decodes the remote metadata \a metadata as a
+// protobuf Struct allocated on \a arena.
+google_protobuf_Struct* DecodeMetadata(absl::string_view metadata,
                                        upb_Arena* arena) {
-  // Treat an empty slice as an invalid metadata value.
-  if (slice.empty()) {
+  // Treat an empty value as an invalid metadata value.
+  if (metadata.empty()) {
     return nullptr;
   }
-  // Decode the slice.
+  // Decode the value.
   std::string decoded_metadata;
-  bool metadata_decoded =
-      absl::Base64Unescape(slice.as_string_view(), &decoded_metadata);
+  bool metadata_decoded = absl::Base64Unescape(metadata, &decoded_metadata);
   if (metadata_decoded) {
     return google_protobuf_Struct_parse(decoded_metadata.c_str(),
                                         decoded_metadata.size(), arena);
@@ -102,14 +105,13 @@ google_protobuf_Struct* DecodeMetadata(grpc_core::Slice slice,
   return nullptr;
 }
 
-MeshLabelsIterable::GcpResourceType StringToGcpResourceType(
-    absl::string_view type) {
+GcpResourceType StringToGcpResourceType(absl::string_view type) {
   if (type == kGkeType) {
-    return MeshLabelsIterable::GcpResourceType::kGke;
+    return GcpResourceType::kGke;
   } else if (type == kGceType) {
-    return MeshLabelsIterable::GcpResourceType::kGce;
+    return GcpResourceType::kGce;
   }
-  return MeshLabelsIterable::GcpResourceType::kUnknown;
+  return GcpResourceType::kUnknown;
 }
 
 upb_StringView AbslStrToUpbStr(absl::string_view str) {
@@ -190,33 +192,43 @@ constexpr std::array<RemoteAttribute, 3> kGceAttributeList = {
 };
 
 absl::Span<const RemoteAttribute> GetAttributesForType(
-    MeshLabelsIterable::GcpResourceType remote_type) {
+    GcpResourceType remote_type) {
   switch (remote_type) {
-    case MeshLabelsIterable::GcpResourceType::kGke:
+    case GcpResourceType::kGke:
       return kGkeAttributeList;
-    case MeshLabelsIterable::GcpResourceType::kGce:
+    case GcpResourceType::kGce:
       return kGceAttributeList;
     default:
       return {};
   }
 }
 
-std::optional<std::pair<absl::string_view, absl::string_view>>
-NextFromAttributeList(absl::Span<const RemoteAttribute> attributes,
-                      size_t start_index, size_t curr,
-                      google_protobuf_Struct* decoded_metadata,
-                      upb_Arena* arena) {
-  DCHECK_GE(curr, start_index);
-  const size_t index = curr - start_index;
-  if (index >= attributes.size()) return std::nullopt;
-  const auto& attribute = attributes[index];
-  return std::pair(attribute.otel_attribute,
-                   GetStringValueFromUpbStruct(
-                       decoded_metadata, attribute.metadata_attribute, arena));
-}
-
 }  // namespace
 
+std::shared_ptr<const PeerLabels> DecodePeerLabels(
+    absl::string_view remote_metadata) {
+  upb::Arena arena;
+  google_protobuf_Struct* struct_pb =
+      DecodeMetadata(remote_metadata, arena.ptr());
+  if (struct_pb == nullptr) return nullptr;
+  auto peer_labels = std::make_shared<PeerLabels>();
+  peer_labels->type = StringToGcpResourceType(GetStringValueFromUpbStruct(
+      struct_pb, kMetadataExchangeTypeKey, arena.ptr()));
+  const absl::Span<const RemoteAttribute> type_attributes =
+      GetAttributesForType(peer_labels->type);
+  peer_labels->values.reserve(kFixedAttributes.size() +
+                              type_attributes.size());
+  for (absl::Span<const RemoteAttribute> attributes :
+       {absl::Span<const RemoteAttribute>(kFixedAttributes),
+        type_attributes}) {
+    for (const RemoteAttribute& attribute : attributes) {
+      peer_labels->values.emplace_back(GetStringValueFromUpbStruct(
+          struct_pb, attribute.metadata_attribute, arena.ptr()));
+    }
+  }
+  return peer_labels;
+}
+
 //
 // MeshLabelsIterable
 //
@@ -224,10 +236,13 @@ NextFromAttributeList(absl::Span<const RemoteAttribute> attributes,
 MeshLabelsIterable::MeshLabelsIterable(
     const std::vector<std::pair<absl::string_view, std::string>>& local_labels,
     grpc_core::Slice remote_metadata)
-    : struct_pb_(DecodeMetadata(std::move(remote_metadata), arena_.ptr())),
-      local_labels_(local_labels),
-      remote_type_(StringToGcpResourceType(GetStringValueFromUpbStruct(
-          struct_pb_, kMetadataExchangeTypeKey, arena_.ptr()))) {}
+    : MeshLabelsIterable(local_labels,
+                         DecodePeerLabels(remote_metadata.as_string_view())) {}
+
+MeshLabelsIterable::MeshLabelsIterable(
+    const std::vector<std::pair<absl::string_view, std::string>>& local_labels,
+    std::shared_ptr<const PeerLabels> peer_labels)
+    : local_labels_(local_labels), peer_labels_(std::move(peer_labels)) {}
 
 std::optional<std::pair<absl::string_view, absl::string_view>>
 MeshLabelsIterable::Next() {
@@ -235,20 +250,34 @@ MeshLabelsIterable::Next() {
   if (pos_ < local_labels_size) {
     return local_labels_[pos_++];
   }
-  const size_t fixed_attribute_end =
-      local_labels_size + kFixedAttributes.size();
-  if (pos_ < fixed_attribute_end) {
-    return NextFromAttributeList(kFixedAttributes, local_labels_size, pos_++,
-                                 struct_pb_, arena_.ptr());
+  // The remote attributes: the fixed ones, then those of the peer's type.
+  const size_t index = pos_ - local_labels_size;
+  const RemoteAttribute* attribute;
+  if (index < kFixedAttributes.size()) {
+    attribute = &kFixedAttributes[index];
+  } else {
+    const absl::Span<const RemoteAttribute> type_attributes =
+        GetAttributesForType(peer_labels_ == nullptr
+                                 ? GcpResourceType::kUnknown
+                                 : peer_labels_->type);
+    if (index - kFixedAttributes.size() >= type_attributes.size()) {
+      return std::nullopt;
+    }
+    attribute = &type_attributes[index - kFixedAttributes.size()];
   }
-  return NextFromAttributeList(GetAttributesForType(remote_type_),
-                               fixed_attribute_end, pos_++, struct_pb_,
-                               arena_.ptr());
+  ++pos_;
+  return std::pair(attribute->otel_attribute,
+                   peer_labels_ == nullptr
+                       ? absl::string_view("unknown")
+                       : absl::string_view(peer_labels_->values[index]));
 }
 
 size_t MeshLabelsIterable::Size() const {
   return local_labels_.size() + kFixedAttributes.size() +
-         GetAttributesForType(remote_type_).size();
+         GetAttributesForType(peer_labels_ == nullptr
+                                  ? GcpResourceType::kUnknown
+                                  : peer_labels_->type)
+             .size();
 }
 
 //
@@ -324,8 +353,28 @@ std::unique_ptr<LabelsIterable> ServiceMeshLabelsInjector::GetLabels(
   auto peer_metadata =
       incoming_initial_metadata->Take(grpc_core::XEnvoyPeerMetadata());
   return std::make_unique<MeshLabelsIterable>(
-      local_labels_, peer_metadata.has_value() ? *std::move(peer_metadata)
-                                               : grpc_core::Slice());
+      local_labels_,
+      peer_metadata.has_value() ? GetPeerLabels(*peer_metadata) : nullptr);
+}
+
+std::shared_ptr<const PeerLabels> ServiceMeshLabelsInjector::GetPeerLabels(
+    const grpc_core::Slice& remote_metadata) const {
+  if (remote_metadata.empty()) return nullptr;
+  const absl::string_view key = remote_metadata.as_string_view();
+  {
+    grpc_core::MutexLock lock(&mu_);
+    auto it = peer_labels_cache_.find(key);
+    if (it != peer_labels_cache_.end()) return it->second;
+  }
+  std::shared_ptr<const PeerLabels> peer_labels = DecodePeerLabels(key);
+  grpc_core::MutexLock lock(&mu_);
+  // Values come from peers, so bound the cache. A process only talks to a
+  // handful of workload identities, so it rarely fills up.
+  if (peer_labels_cache_.size() >= kMaxCachedPeerLabels) {
+    peer_labels_cache_.clear();
+  }
+  peer_labels_cache_.emplace(key, peer_labels);
+  return peer_labels;
 }
 
 void ServiceMeshLabelsInjector::AddLabels(
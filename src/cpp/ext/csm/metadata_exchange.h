@@ -21,22 +21,39 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
 #include "absl/strings/string_view.h"
-#include "google/protobuf/struct.upb.h"
 #include "opentelemetry/sdk/common/attribute_utils.h"
 #include "src/core/call/metadata_batch.h"
 #include "src/core/lib/slice/slice.h"
+#include "src/core/util/sync.h"
 #include "src/cpp/ext/otel/otel_plugin.h"
-#include "upb/mem/arena.hpp"
 
 namespace grpc {
 namespace internal {
 
+enum class GcpResourceType : std::uint8_t { kGke, kGce, kUnknown };
+
+// The labels decoded from a peer's "x-envoy-peer-metadata" value.
+struct PeerLabels {
+  GcpResourceType type = GcpResourceType::kUnknown;
+  // The values of the remote attributes: the ones every peer has, followed
+  // by the ones for \a type.
+  std::vector<std::string> values;
+};
+
+// Decodes \a remote_metadata, the base64 encoded "x-envoy-peer-metadata"
+// value. Returns nullptr if it is empty or invalid.
+std::shared_ptr<const PeerLabels> DecodePeerLabels(
+    absl::string_view remote_metadata);
+
 class ServiceMeshLabelsInjector : public LabelsInjector {
  public:
   explicit ServiceMeshLabelsInjector(
@@ -78,20 +95,35 @@ class ServiceMeshLabelsInjector : public LabelsInjector {
   }
 
  private:
+  // A peer sends the same metadata on every call, so the labels decoded from
+  // each distinct value are cached, keyed by the raw value.
+  static constexpr size_t kMaxCachedPeerLabels = 64;
+
+  std::shared_ptr<const PeerLabels> GetPeerLabels(
+      const grpc_core::Slice& remote_metadata) const;
+
   std::vector<std::pair<absl::string_view, std::string>> local_labels_;
   grpc_core::Slice serialized_labels_to_send_;
+  mutable grpc_core::Mutex mu_;
+  mutable absl::flat_hash_map<std::string, std::shared_ptr<const PeerLabels>>
+      peer_labels_cache_ ABSL_GUARDED_BY(mu_);
 };
 
 // A LabelsIterable class provided by ServiceMeshLabelsInjector. EXPOSED FOR
 // TESTING PURPOSES ONLY.
 class MeshLabelsIterable : public LabelsIterable {
  public:
-  enum class GcpResourceType : std::uint8_t { kGke, kGce, kUnknown };
+  using GcpResourceType = ::grpc::internal::GcpResourceType;
 
   MeshLabelsIterable(
       const std::vector<std::pair<absl::string_view, std::string>>&
           local_labels,
       grpc_core::Slice remote_metadata);
+  // \a peer_labels is nullptr if the peer sent no valid metadata.
+  MeshLabelsIterable(
+      const std::vector<std::pair<absl::string_view, std::string>>&
+          local_labels,
+      std::shared_ptr<const PeerLabels> peer_labels);
 
   std::optional<std::pair<absl::string_view, absl::string_view>> Next()
       override;
@@ -102,13 +134,11 @@ class MeshLabelsIterable : public LabelsIterable {
 
   // Returns true if the peer sent a non-empty base64 encoded
   // "x-envoy-peer-metadata" metadata.
-  bool GotRemoteLabels() const { return struct_pb_ != nullptr; }
+  bool GotRemoteLabels() const { return peer_labels_ != nullptr; }
 
  private:
-  upb::Arena arena_;
-  google_protobuf_Struct* struct_pb_ = nullptr;
   const std::vector<std::pair<absl::string_view, std::string>>& local_labels_;
-  GcpResourceType remote_type_ = GcpResourceType::kUnknown;
+  std::shared_ptr<const PeerLabels> peer_labels_;
   uint32_t pos_ = 0;
 };
 
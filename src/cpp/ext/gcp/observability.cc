@@ -44,7 +44,9 @@
 #include "opencensus/stats/stats.h"
 #include "opencensus/trace/sampler.h"
 #include "opencensus/trace/trace_config.h"
+#include "src/core/ext/filters/logging/buffered_logging_sink.h"
 #include "src/core/ext/filters/logging/logging_filter.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
 #include "src/core/util/crash.h"
 #include "src/core/util/notification.h"
 #include "src/cpp/client/client_stats_interceptor.h"
@@ -61,6 +63,9 @@ namespace internal {
 namespace {
 
 grpc::internal::ObservabilityLoggingSink* g_logging_sink = nullptr;
+// Takes entries off the call path before they reach g_logging_sink.
+std::shared_ptr<grpc_core::BufferedLoggingSink>* g_buffered_logging_sink =
+    nullptr;
 
 bool g_gcp_observability_initialized = false;
 
@@ -128,7 +133,12 @@ absl::Status GcpObservabilityInit() {
   if (config->cloud_logging.has_value()) {
     g_logging_sink = new grpc::internal::ObservabilityLoggingSink(
         config->cloud_logging.value(), config->project_id, config->labels);
-    grpc_core::RegisterLoggingFilter(g_logging_sink);
+    g_buffered_logging_sink =
+        new std::shared_ptr<grpc_core::BufferedLoggingSink>(
+            std::make_shared<grpc_core::BufferedLoggingSink>(
+                g_logging_sink, grpc_core::BufferedLoggingSink::Options(),
+                grpc_event_engine::experimental::GetDefaultEventEngine()));
+    grpc_core::RegisterLoggingFilter(g_buffered_logging_sink->get());
   }
   // If tracing or monitoring is enabled, we need to register the OpenCensus
   // plugin as well.
@@ -212,6 +222,14 @@ absl::Status GcpObservabilityInit() {
 }
 
 void GcpObservabilityClose() {
+  if (g_buffered_logging_sink != nullptr) {
+    (*g_buffered_logging_sink)->Flush();
+    // Log straight to g_logging_sink from here on, so that the buffered
+    // sink, and the EventEngine it holds, are released.
+    grpc_core::SetLoggingFilterSink(g_logging_sink);
+    delete g_buffered_logging_sink;
+    g_buffered_logging_sink = nullptr;
+  }
   if (g_logging_sink != nullptr) {
     g_logging_sink->FlushAndClose();
   }
@@ -27,6 +27,7 @@
 #include <grpcpp/support/status.h>
 
 #include <algorithm>
+#include <iterator>
 #include <map>
 #include <optional>
 #include <utility>
@@ -260,6 +261,17 @@ void ObservabilityLoggingSink::LogEntry(Entry entry) {
   MaybeTriggerFlushLocked();
 }
 
+void ObservabilityLoggingSink::LogEntries(std::vector<Entry> entries) {
+  uint64_t entries_size = 0;
+  for (const auto& entry : entries) entries_size += EstimateEntrySize(entry);
+  grpc_core::MutexLock lock(&mu_);
+  if (sink_closed_) return;
+  entries_.insert(entries_.end(), std::make_move_iterator(entries.begin()),
+                  std::make_move_iterator(entries.end()));
+  entries_memory_footprint_ += entries_size;
+  MaybeTriggerFlushLocked();
+}
+
 void ObservabilityLoggingSink::RegisterEnvironmentResource(
     const EnvironmentAutoDetect::ResourceType* resource) {
   grpc_core::MutexLock lock(&mu_);
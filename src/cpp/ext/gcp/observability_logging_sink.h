@@ -53,6 +53,7 @@ class ObservabilityLoggingSink : public grpc_core::LoggingSink {
                                 absl::string_view method) override;
 
   void LogEntry(Entry entry) override;
+  void LogEntries(std::vector<Entry> entries) override;
 
   // Triggers a final flush of all the currently buffered logging entries and
   // closes the sink preventing any more entries to be logged.
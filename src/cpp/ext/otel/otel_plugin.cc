@@ -780,6 +780,12 @@ void OpenTelemetryPluginImpl::AddCounter(
   }
 }
 
+// Histogram values are handed straight to the OpenTelemetry instrument.
+// Pre-aggregating them into per-cpu buckets here would not save the SDK's
+// per-attribute-set aggregation: the synchronous Histogram API only takes
+// individual measurements, so a flush would have to replay every sample (or
+// collapse each bucket to one value, losing the bucket boundaries configured
+// in the SDK's views).
 void OpenTelemetryPluginImpl::RecordHistogram(
     grpc_core::GlobalInstrumentsRegistry::GlobalInstrumentHandle handle,
     uint64_t value, absl::Span<const absl::string_view> label_values,
@@ -22,7 +22,9 @@
 #include <grpcpp/support/interceptor.h>
 #include <grpcpp/support/sync_stream.h>
 
+#include <string>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 // IWYU pragma: no_include "google/protobuf/descriptor.h"
@@ -104,8 +106,7 @@ Status ProtoServerReflectionBackend::GetFileByName(const std::string& file_name,
   if (file_desc == nullptr) {
     return Status(StatusCode::NOT_FOUND, "File not found.");
   }
-  std::unordered_set<std::string> seen_files;
-  FillFileDescriptorResponse(file_desc, response, &seen_files);
+  FillFileDescriptorResponse(file_desc, response);
   return Status::OK;
 }
 
@@ -121,8 +122,7 @@ Status ProtoServerReflectionBackend::GetFileContainingSymbol(
   if (file_desc == nullptr) {
     return Status(StatusCode::NOT_FOUND, "Symbol not found.");
   }
-  std::unordered_set<std::string> seen_files;
-  FillFileDescriptorResponse(file_desc, response, &seen_files);
+  FillFileDescriptorResponse(file_desc, response);
   return Status::OK;
 }
 
@@ -145,8 +145,7 @@ Status ProtoServerReflectionBackend::GetFileContainingExtension(
   if (field_desc == nullptr) {
     return Status(StatusCode::NOT_FOUND, "Extension not found.");
   }
-  std::unordered_set<std::string> seen_files;
-  FillFileDescriptorResponse(field_desc->file(), response, &seen_files);
+  FillFileDescriptorResponse(field_desc->file(), response);
   return Status::OK;
 }
 
@@ -174,22 +173,45 @@ Status ProtoServerReflectionBackend::GetAllExtensionNumbers(
 
 template <typename Response>
 void ProtoServerReflectionBackend::FillFileDescriptorResponse(
-    const protobuf::FileDescriptor* file_desc, Response* response,
-    std::unordered_set<std::string>* seen_files) const {
-  bool inserted = seen_files->emplace(file_desc->name()).second;
-  if (!inserted) {
-    return;
+    const protobuf::FileDescriptor* file_desc, Response* response) const {
+  auto* file_descriptor_response = response->mutable_file_descriptor_response();
+  for (const std::string* data : SerializedFileClosure(file_desc)) {
+    file_descriptor_response->add_file_descriptor_proto(*data);
   }
+}
 
+const std::vector<const std::string*>&
+ProtoServerReflectionBackend::SerializedFileClosure(
+    const protobuf::FileDescriptor* file_desc) const {
+  internal::MutexLock lock(&cache_mu_);
+  auto it = file_closures_.find(file_desc);
+  if (it != file_closures_.end()) return it->second;
+  // Depth first, each file before its dependencies, as reflection clients
+  // have always received them.
+  std::vector<const std::string*> closure;
+  std::unordered_set<const protobuf::FileDescriptor*> seen_files;
+  std::vector<const protobuf::FileDescriptor*> pending = {file_desc};
+  while (!pending.empty()) {
+    const protobuf::FileDescriptor* file = pending.back();
+    pending.pop_back();
+    if (!seen_files.insert(file).second) continue;
+    closure.push_back(&SerializedFileLocked(file));
+    for (int i = file->dependency_count() - 1; i >= 0; --i) {
+      pending.push_back(file->dependency(i));
+    }
+  }
+  return file_closures_.emplace(file_desc, std::move(closure)).first->second;
+}
+
+const std::string& ProtoServerReflectionBackend::SerializedFileLocked(
+    const protobuf::FileDescriptor* file_desc) const {
+  auto it = serialized_files_.find(file_desc);
+  if (it != serialized_files_.end()) return it->second;
   protobuf::FileDescriptorProto file_desc_proto;
   std::string data;
   file_desc->CopyTo(&file_desc_proto);
   file_desc_proto.SerializeToString(&data);
-  response->mutable_file_descriptor_response()->add_file_descriptor_proto(data);
-
-  for (int i = 0; i < file_desc->dependency_count(); ++i) {
-    FillFileDescriptorResponse(file_desc->dependency(i), response, seen_files);
-  }
+  return serialized_files_.emplace(file_desc, std::move(data)).first->second;
 }
 
 Status ProtoServerReflection::ServerReflectionInfo(
@@ -21,13 +21,14 @@
 
 #include <grpcpp/grpcpp.h>
 #include <grpcpp/impl/codegen/config_protobuf.h>
+#include <grpcpp/impl/sync.h>
 #include <grpcpp/support/config.h>
 #include <grpcpp/support/status.h>
 #include <grpcpp/support/sync_stream.h>
 
 #include <memory>
 #include <string>
-#include <unordered_set>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -69,15 +70,33 @@ class ProtoServerReflectionBackend {
                                 Response* response) const;
 
   template <typename Response>
-  void FillFileDescriptorResponse(
-      const protobuf::FileDescriptor* file_desc, Response* response,
-      std::unordered_set<std::string>* seen_files) const;
+  void FillFileDescriptorResponse(const protobuf::FileDescriptor* file_desc,
+                                  Response* response) const;
+
+  // Returns the serialized FileDescriptorProtos of file_desc and of its
+  // transitive dependencies, each once, in the order they are sent. The
+  // files in a pool never change, so each closure is built only once.
+  const std::vector<const std::string*>& SerializedFileClosure(
+      const protobuf::FileDescriptor* file_desc) const;
+
+  const std::string& SerializedFileLocked(
+      const protobuf::FileDescriptor* file_desc) const
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(cache_mu_);
 
   template <typename Response>
   void FillErrorResponse(const Status& status, Response* error_response) const;
 
   const protobuf::DescriptorPool* descriptor_pool_;
   const std::vector<string>* services_;
+
+  mutable internal::Mutex cache_mu_;
+  // Entries are never erased or changed once added, so references to them
+  // stay valid after cache_mu_ is released.
+  mutable std::unordered_map<const protobuf::FileDescriptor*, std::string>
+      serialized_files_ ABSL_GUARDED_BY(cache_mu_);
+  mutable std::unordered_map<const protobuf::FileDescriptor*,
+                             std::vector<const std::string*>>
+      file_closures_ ABSL_GUARDED_BY(cache_mu_);
 };
 
 class ProtoServerReflection final
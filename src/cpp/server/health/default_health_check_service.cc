@@ -26,10 +26,13 @@
 #include <stdint.h>
 
 #include <memory>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "absl/log/check.h"
 #include "absl/log/log.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
 #include "src/proto/grpc/health/v1/health.upb.h"
 #include "upb/base/string_view.h"
 #include "upb/mem/arena.hpp"
@@ -42,10 +45,18 @@ namespace grpc {
 // DefaultHealthCheckService
 //
 
-DefaultHealthCheckService::DefaultHealthCheckService() {
+DefaultHealthCheckService::DefaultHealthCheckService()
+    : event_engine_(grpc_event_engine::experimental::GetDefaultEventEngine()) {
   services_map_[""].SetServingStatus(SERVING);
 }
 
+DefaultHealthCheckService::~DefaultHealthCheckService() {
+  grpc::internal::MutexLock lock(&mu_);
+  while (notify_in_progress_) {
+    notify_done_.Wait(&mu_);
+  }
+}
+
 void DefaultHealthCheckService::SetServingStatus(
     const std::string& service_name, bool serving) {
   grpc::internal::MutexLock lock(&mu_);
@@ -53,7 +64,8 @@ void DefaultHealthCheckService::SetServingStatus(
     // Set to NOT_SERVING in case service_name is not in the map.
     serving = false;
   }
-  services_map_[service_name].SetServingStatus(serving ? SERVING : NOT_SERVING);
+  SetServingStatusLocked(service_name, services_map_[service_name],
+                         serving ? SERVING : NOT_SERVING);
 }
 
 void DefaultHealthCheckService::SetServingStatus(bool serving) {
@@ -61,8 +73,7 @@ void DefaultHealthCheckService::SetServingStatus(bool serving) {
   grpc::internal::MutexLock lock(&mu_);
   if (shutdown_) return;
   for (auto& p : services_map_) {
-    ServiceData& service_data = p.second;
-    service_data.SetServingStatus(status);
+    SetServingStatusLocked(p.first, p.second, status);
   }
 }
 
@@ -71,8 +82,7 @@ void DefaultHealthCheckService::Shutdown() {
   if (shutdown_) return;
   shutdown_ = true;
   for (auto& p : services_map_) {
-    ServiceData& service_data = p.second;
-    service_data.SetServingStatus(NOT_SERVING);
+    SetServingStatusLocked(p.first, p.second, NOT_SERVING);
   }
 }
 
@@ -106,6 +116,46 @@ void DefaultHealthCheckService::UnregisterWatch(
   if (service_data.Unused()) services_map_.erase(it);
 }
 
+void DefaultHealthCheckService::SetServingStatusLocked(
+    const std::string& service_name, ServiceData& service_data,
+    ServingStatus status) {
+  service_data.SetServingStatus(status);
+  if (!service_data.HasWatchers()) return;
+  services_to_notify_.insert(service_name);
+  if (notify_in_progress_) return;
+  notify_in_progress_ = true;
+  event_engine_->Run([this]() { NotifyWatchers(); });
+}
+
+void DefaultHealthCheckService::NotifyWatchers() {
+  while (true) {
+    std::vector<std::pair<
+        ServingStatus, std::vector<grpc_core::RefCountedPtr<
+                           HealthCheckServiceImpl::WatchReactor>>>>
+        updates;
+    {
+      grpc::internal::MutexLock lock(&mu_);
+      if (services_to_notify_.empty()) {
+        notify_in_progress_ = false;
+        notify_done_.Signal();
+        return;
+      }
+      for (const std::string& service_name : services_to_notify_) {
+        auto it = services_map_.find(service_name);
+        if (it == services_map_.end()) continue;
+        updates.emplace_back(it->second.GetServingStatus(),
+                             it->second.Watchers());
+      }
+      services_to_notify_.clear();
+    }
+    for (const auto& update : updates) {
+      for (const auto& watcher : update.second) {
+        watcher->SendHealth(update.first);
+      }
+    }
+  }
+}
+
 DefaultHealthCheckService::HealthCheckServiceImpl*
 DefaultHealthCheckService::GetHealthCheckService() {
   CHECK(impl_ == nullptr);
@@ -117,12 +167,16 @@ DefaultHealthCheckService::GetHealthCheckService() {
 // DefaultHealthCheckService::ServiceData
 //
 
-void DefaultHealthCheckService::ServiceData::SetServingStatus(
-    ServingStatus status) {
-  status_ = status;
+std::vector<grpc_core::RefCountedPtr<
+    DefaultHealthCheckService::HealthCheckServiceImpl::WatchReactor>>
+DefaultHealthCheckService::ServiceData::Watchers() const {
+  std::vector<grpc_core::RefCountedPtr<HealthCheckServiceImpl::WatchReactor>>
+      watchers;
+  watchers.reserve(watchers_.size());
   for (const auto& p : watchers_) {
-    p.first->SendHealth(status);
+    watchers.push_back(p.second);
   }
+  return watchers;
 }
 
 void DefaultHealthCheckService::ServiceData::AddWatch(
@@ -147,6 +201,10 @@ const char kHealthWatchMethodName[] = "/grpc.health.v1.Health/Watch";
 DefaultHealthCheckService::HealthCheckServiceImpl::HealthCheckServiceImpl(
     DefaultHealthCheckService* database)
     : database_(database) {
+  // On failure, the response is left invalid.
+  for (ServingStatus status : {NOT_FOUND, SERVING, NOT_SERVING}) {
+    EncodeResponse(status, &encoded_responses_[status]);
+  }
   // Add Check() method.
   AddMethod(new internal::RpcServiceMethod(
       kHealthCheckMethodName, internal::RpcMethod::NORMAL_RPC, nullptr));
@@ -297,9 +355,10 @@ void DefaultHealthCheckService::HealthCheckServiceImpl::WatchReactor::
       return;
     }
   }
-  // Send response.
-  bool success = EncodeResponse(status, &response_);
-  if (!success) {
+  // Send response. The encoded response is shared by all watchers, and
+  // outlives them, since service_ waits for every watch to be done.
+  const ByteBuffer& response = service_->encoded_responses_[status];
+  if (!response.Valid()) {
     MaybeFinishLocked(
         Status(StatusCode::INTERNAL, "could not encode response"));
     return;
@@ -307,14 +366,13 @@ void DefaultHealthCheckService::HealthCheckServiceImpl::WatchReactor::
   VLOG(2) << "[HCS " << service_ << "] watcher " << this << " \""
           << service_name_ << "\": starting write for ServingStatus " << status;
   write_pending_ = true;
-  StartWrite(&response_);
+  StartWrite(&response);
 }
 
 void DefaultHealthCheckService::HealthCheckServiceImpl::WatchReactor::
     OnWriteDone(bool ok) {
   VLOG(2) << "[HCS " << service_ << "] watcher " << this << " \""
           << service_name_ << "\": OnWriteDone(): ok=" << ok;
-  response_.Clear();
   grpc::internal::MutexLock lock(&mu_);
   if (!ok) {
     MaybeFinishLocked(Status(StatusCode::CANCELLED, "OnWriteDone() ok=false"));
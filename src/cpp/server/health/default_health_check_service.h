@@ -19,6 +19,7 @@
 #ifndef GRPC_SRC_CPP_SERVER_HEALTH_DEFAULT_HEALTH_CHECK_SERVICE_H
 #define GRPC_SRC_CPP_SERVER_HEALTH_DEFAULT_HEALTH_CHECK_SERVICE_H
 
+#include <grpc/event_engine/event_engine.h>
 #include <grpcpp/grpcpp.h>
 #include <grpcpp/health_check_service_interface.h>
 #include <grpcpp/impl/service_type.h>
@@ -28,9 +29,12 @@
 #include <grpcpp/support/status.h>
 #include <stddef.h>
 
+#include <array>
 #include <map>
 #include <memory>
+#include <set>
 #include <string>
+#include <vector>
 
 #include "absl/base/thread_annotations.h"
 #include "src/core/util/ref_counted.h"
@@ -67,7 +71,6 @@ class DefaultHealthCheckService final : public HealthCheckServiceInterface {
 
       HealthCheckServiceImpl* service_;
       std::string service_name_;
-      ByteBuffer response_;
 
       grpc::internal::Mutex mu_;
       bool write_pending_ ABSL_GUARDED_BY(mu_) = false;
@@ -91,6 +94,9 @@ class DefaultHealthCheckService final : public HealthCheckServiceInterface {
     static bool EncodeResponse(ServingStatus status, ByteBuffer* response);
 
     DefaultHealthCheckService* database_;
+    // The response for each ServingStatus, encoded once and shared by all
+    // Watch streams. Invalid if encoding failed.
+    std::array<ByteBuffer, 3> encoded_responses_;
 
     grpc::internal::Mutex mu_;
     grpc::internal::CondVar shutdown_condition_;
@@ -99,6 +105,7 @@ class DefaultHealthCheckService final : public HealthCheckServiceInterface {
   };
 
   DefaultHealthCheckService();
+  ~DefaultHealthCheckService() override;
 
   void SetServingStatus(const std::string& service_name, bool serving) override;
   void SetServingStatus(bool serving) override;
@@ -114,12 +121,15 @@ class DefaultHealthCheckService final : public HealthCheckServiceInterface {
   // handlers registered for updates when the service's status changes.
   class ServiceData {
    public:
-    void SetServingStatus(ServingStatus status);
+    void SetServingStatus(ServingStatus status) { status_ = status; }
     ServingStatus GetServingStatus() const { return status_; }
     void AddWatch(
         grpc_core::RefCountedPtr<HealthCheckServiceImpl::WatchReactor> watcher);
     void RemoveWatch(HealthCheckServiceImpl::WatchReactor* watcher);
     bool Unused() const { return watchers_.empty() && status_ == NOT_FOUND; }
+    bool HasWatchers() const { return !watchers_.empty(); }
+    std::vector<grpc_core::RefCountedPtr<HealthCheckServiceImpl::WatchReactor>>
+    Watchers() const;
 
    private:
     ServingStatus status_ = NOT_FOUND;
@@ -135,9 +145,24 @@ class DefaultHealthCheckService final : public HealthCheckServiceInterface {
   void UnregisterWatch(const std::string& service_name,
                        HealthCheckServiceImpl::WatchReactor* watcher);
 
+  // Sets the status of a service and queues its watchers for notification.
+  void SetServingStatusLocked(const std::string& service_name,
+                              ServiceData& service_data, ServingStatus status)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(&mu_);
+
+  // Sends the current status of every queued service to its watchers,
+  // without holding mu_. Runs on the EventEngine, one instance at a time,
+  // so watchers see the updates of a service in order.
+  void NotifyWatchers();
+
+  std::shared_ptr<grpc_event_engine::experimental::EventEngine> event_engine_;
   mutable grpc::internal::Mutex mu_;
   bool shutdown_ ABSL_GUARDED_BY(&mu_) = false;
   std::map<std::string, ServiceData> services_map_ ABSL_GUARDED_BY(&mu_);
+  // Services whose watchers have not yet seen their latest status.
+  std::set<std::string> services_to_notify_ ABSL_GUARDED_BY(&mu_);
+  bool notify_in_progress_ ABSL_GUARDED_BY(&mu_) = false;
+  grpc::internal::CondVar notify_done_;
   std::unique_ptr<HealthCheckServiceImpl> impl_;
 };
 
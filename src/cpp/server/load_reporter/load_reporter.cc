@@ -27,6 +27,8 @@
 #include <iterator>
 #include <set>
 #include <tuple>
+#include <utility>
+#include <vector>
 
 #include "absl/log/check.h"
 #include "absl/log/log.h"
@@ -396,23 +398,30 @@ void LoadReporter::ReportStreamClosed(const std::string& hostname,
             << ", LB ID: " << lb_id << ").";
 }
 
+void LoadReporter::MergeRows(const std::vector<StoreRow>& rows) {
+  if (rows.empty()) return;
+  grpc_core::MutexLock lock(&store_mu_);
+  for (const StoreRow& row : rows) {
+    load_data_store_.MergeRow(row.host, row.key, row.value);
+  }
+}
+
 void LoadReporter::ProcessViewDataCallStart(
     const CensusViewProvider::ViewDataMap& view_data_map) {
   auto it = view_data_map.find(kViewStartCount);
   if (it != view_data_map.end()) {
+    std::vector<StoreRow> rows;
+    rows.reserve(it->second.int_data().size());
     for (const auto& p : it->second.int_data()) {
       const std::vector<std::string>& tag_values = p.first;
       const uint64_t start_count = static_cast<uint64_t>(p.second);
       const std::string& client_ip_and_token = tag_values[0];
       const std::string& host = tag_values[1];
       const std::string& user_id = tag_values[2];
-      LoadRecordKey key(client_ip_and_token, user_id);
-      LoadRecordValue value = LoadRecordValue(start_count);
-      {
-        grpc_core::MutexLock lock(&store_mu_);
-        load_data_store_.MergeRow(host, key, value);
-      }
+      rows.push_back({host, LoadRecordKey(client_ip_and_token, user_id),
+                      LoadRecordValue(start_count)});
     }
+    MergeRows(rows);
   }
 }
 
@@ -422,6 +431,8 @@ void LoadReporter::ProcessViewDataCallEnd(
   uint64_t total_error_count = 0;
   auto it = view_data_map.find(kViewEndCount);
   if (it != view_data_map.end()) {
+    std::vector<StoreRow> rows;
+    rows.reserve(it->second.int_data().size());
     for (const auto& p : it->second.int_data()) {
       const std::vector<std::string>& tag_values = p.first;
       const uint64_t end_count = static_cast<uint64_t>(p.second);
@@ -457,13 +468,11 @@ void LoadReporter::ProcessViewDataCallEnd(
         error_count = end_count;
         total_error_count += end_count;
       }
-      LoadRecordValue value = LoadRecordValue(
-          0, ok_count, error_count, bytes_sent, bytes_received, latency_ms);
-      {
-        grpc_core::MutexLock lock(&store_mu_);
-        load_data_store_.MergeRow(host, key, value);
-      }
+      rows.push_back({host, std::move(key),
+                      LoadRecordValue(0, ok_count, error_count, bytes_sent,
+                                      bytes_received, latency_ms)});
     }
+    MergeRows(rows);
   }
   AppendNewFeedbackRecord(total_end_count, total_error_count);
 }
@@ -472,6 +481,8 @@ void LoadReporter::ProcessViewDataOtherCallMetrics(
     const CensusViewProvider::ViewDataMap& view_data_map) {
   auto it = view_data_map.find(kViewOtherCallMetricCount);
   if (it != view_data_map.end()) {
+    std::vector<StoreRow> rows;
+    rows.reserve(it->second.int_data().size());
     for (const auto& p : it->second.int_data()) {
       const std::vector<std::string>& tag_values = p.first;
       const int64_t num_calls = p.second;
@@ -484,13 +495,12 @@ void LoadReporter::ProcessViewDataOtherCallMetrics(
           CensusViewProvider::GetRelatedViewDataRowDouble(
               view_data_map, kViewOtherCallMetricValue,
               sizeof(kViewOtherCallMetricValue) - 1, tag_values);
-      LoadRecordValue value = LoadRecordValue(
-          metric_name, static_cast<uint64_t>(num_calls), total_metric_value);
-      {
-        grpc_core::MutexLock lock(&store_mu_);
-        load_data_store_.MergeRow(host, key, value);
-      }
+      rows.push_back({host, std::move(key),
+                      LoadRecordValue(metric_name,
+                                      static_cast<uint64_t>(num_calls),
+                                      total_metric_value)});
     }
+    MergeRows(rows);
   }
 }
 
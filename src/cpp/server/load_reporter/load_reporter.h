@@ -192,6 +192,17 @@ class LoadReporter {
           cpu_limit(cpu_limit) {}
   };
 
+  // A row of view data, ready to be merged into the load data store.
+  struct StoreRow {
+    std::string host;
+    LoadRecordKey key;
+    LoadRecordValue value;
+  };
+
+  // Merges rows into the load data store, taking store_mu_ once for all of
+  // them rather than once per row.
+  void MergeRows(const std::vector<StoreRow>& rows);
+
   // Finds the view data about starting call from the view_data_map and merges
   // the data to the load data store.
   void ProcessViewDataCallStart(
@@ -19,6 +19,7 @@
 #include <grpc/grpc.h>
 #include <grpc/impl/channel_arg_names.h>
 #include <grpc/impl/compression_types.h>
+#include <grpc/support/cpu.h>
 #include <grpc/support/port_platform.h>
 #include <grpc/support/sync.h>
 #include <grpc/support/workaround_list.h>
@@ -190,6 +191,33 @@ void ServerBuilder::experimental_type::EnableCallMetricRecording(
   builder_->server_metric_recorder_ = server_metric_recorder;
 }
 
+void ServerBuilder::experimental_type::SetListenerShards(int num_shards,
+                                                         bool steer_by_cpu) {
+  builder_->AddChannelArgument(GRPC_ARG_TCP_LISTENER_SHARDS, num_shards);
+  builder_->AddChannelArgument(GRPC_ARG_TCP_LISTENER_SHARD_CPU_STEERING,
+                               steer_by_cpu ? 1 : 0);
+}
+
+void ServerBuilder::experimental_type::EnableThreadPerCore() {
+  SetListenerShards(gpr_cpu_num_cores(), /*steer_by_cpu=*/true);
+  builder_->AddChannelArgument(GRPC_ARG_SERVER_INLINE_CALLBACKS, 1);
+}
+
+void ServerBuilder::experimental_type::SetConcurrencyLimit(
+    int max_concurrent_calls, const std::string& tenant_metadata_key,
+    int latency_target_ms) {
+  builder_->AddChannelArgument(GRPC_ARG_SERVER_MAX_CONCURRENT_CALLS_PER_METHOD,
+                               max_concurrent_calls);
+  if (!tenant_metadata_key.empty()) {
+    builder_->AddChannelArgument(
+        GRPC_ARG_SERVER_CONCURRENCY_LIMIT_TENANT_METADATA, tenant_metadata_key);
+  }
+  if (latency_target_ms > 0) {
+    builder_->AddChannelArgument(
+        GRPC_ARG_SERVER_CONCURRENCY_LIMIT_LATENCY_TARGET_MS, latency_target_ms);
+  }
+}
+
 ServerBuilder& ServerBuilder::SetOption(
     std::unique_ptr<ServerBuilderOption> option) {
   options_.push_back(std::move(option));
@@ -211,6 +239,12 @@ ServerBuilder& ServerBuilder::SetSyncServerOption(
     case CQ_TIMEOUT_MSEC:
       sync_server_settings_.cq_timeout_msec = val;
       break;
+    case MIN_WORKERS:
+      sync_server_settings_.min_workers = val;
+      break;
+    case MAX_WORKERS:
+      sync_server_settings_.max_workers = val;
+      break;
   }
   return *this;
 }
@@ -390,7 +424,15 @@ std::unique_ptr<grpc::Server> ServerBuilder::BuildAndStart() {
     VLOG(2) << "Synchronous server. Num CQs: " << sync_server_settings_.num_cqs
             << ", Min pollers: " << sync_server_settings_.min_pollers
             << ", Max Pollers: " << sync_server_settings_.max_pollers
-            << ", CQ timeout (msec): " << sync_server_settings_.cq_timeout_msec;
+            << ", CQ timeout (msec): " << sync_server_settings_.cq_timeout_msec
+            << ", Min workers: " << sync_server_settings_.min_workers
+            << ", Max workers: " << sync_server_settings_.max_workers;
+    if (sync_server_settings_.max_workers > 0) {
+      args.SetInt(GRPC_ARG_SYNC_SERVER_MIN_WORKERS,
+                  sync_server_settings_.min_workers);
+      args.SetInt(GRPC_ARG_SYNC_SERVER_MAX_WORKERS,
+                  sync_server_settings_.max_workers);
+    }
   }
 
   if (has_callback_methods) {
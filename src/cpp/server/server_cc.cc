@@ -67,6 +67,7 @@
 #include "absl/log/log.h"
 #include "absl/status/status.h"
 #include "src/core/ext/transport/inproc/inproc_transport.h"
+#include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/iomgr/iomgr.h"
 #include "src/core/lib/resource_quota/api.h"
@@ -806,8 +807,10 @@ class Server::SyncRequestThreadManager : public grpc::ThreadManager {
   SyncRequestThreadManager(Server* server, grpc::CompletionQueue* server_cq,
                            std::shared_ptr<GlobalCallbacks> global_callbacks,
                            grpc_resource_quota* rq, int min_pollers,
-                           int max_pollers, int cq_timeout_msec)
-      : ThreadManager("SyncServer", rq, min_pollers, max_pollers),
+                           int max_pollers, int cq_timeout_msec,
+                           int min_workers, int max_workers)
+      : ThreadManager("SyncServer", rq, min_pollers, max_pollers, min_workers,
+                      max_workers),
         server_(server),
         server_cq_(server_cq),
         cq_timeout_msec_(cq_timeout_msec),
@@ -942,10 +945,17 @@ Server::Server(
       default_rq_created = true;
     }
 
+    const grpc_channel_args c_args = args->c_channel_args();
+    const grpc_core::ChannelArgs core_args =
+        grpc_core::ChannelArgs::FromC(&c_args);
+    const int min_workers =
+        core_args.GetInt(GRPC_ARG_SYNC_SERVER_MIN_WORKERS).value_or(0);
+    const int max_workers =
+        core_args.GetInt(GRPC_ARG_SYNC_SERVER_MAX_WORKERS).value_or(0);
     for (const auto& it : *sync_server_cqs_) {
       sync_req_mgrs_.emplace_back(new SyncRequestThreadManager(
           this, it.get(), global_callbacks_, server_rq, min_pollers,
-          max_pollers, sync_cq_timeout_msec));
+          max_pollers, sync_cq_timeout_msec, min_workers, max_workers));
     }
 
     if (default_rq_created) {
@@ -979,6 +989,10 @@ Server::Server(
                     GRPC_ARG_SERVER_CALL_METRIC_RECORDING)) {
       call_metric_recording_enabled_ = channel_args.args[i].value.integer;
     }
+    if (0 ==
+        strcmp(channel_args.args[i].key, GRPC_ARG_SERVER_INLINE_CALLBACKS)) {
+      inline_callbacks_ = channel_args.args[i].value.integer != 0;
+    }
   }
   server_ = grpc_server_create(&channel_args, nullptr);
   grpc_server_set_config_fetcher(server_, server_config_fetcher);
@@ -1029,13 +1043,25 @@ void Server::SetGlobalCallbacks(GlobalCallbacks* callbacks) {
 
 grpc_server* Server::c_server() { return server_; }
 
+namespace {
+
+bool PassMessageObjects(const grpc_channel_args& channel_args) {
+  return grpc_core::ChannelArgs::FromC(&channel_args)
+      .GetBool(GRPC_ARG_INPROC_PASS_MESSAGE_OBJECTS)
+      .value_or(false);
+}
+
+}  // namespace
+
 std::shared_ptr<grpc::Channel> Server::InProcessChannel(
     const grpc::ChannelArguments& args) {
   grpc_channel_args channel_args = args.c_channel_args();
-  return grpc::CreateChannelInternal(
+  auto channel = grpc::CreateChannelInternal(
       "inproc", grpc_inproc_channel_create(server_, &channel_args, nullptr),
       std::vector<std::unique_ptr<
           grpc::experimental::ClientInterceptorFactoryInterface>>());
+  channel->pass_message_objects_ = PassMessageObjects(channel_args);
+  return channel;
 }
 
 std::shared_ptr<grpc::Channel>
@@ -1045,10 +1071,12 @@ Server::experimental_type::InProcessChannelWithInterceptors(
         std::unique_ptr<grpc::experimental::ClientInterceptorFactoryInterface>>
         interceptor_creators) {
   grpc_channel_args channel_args = args.c_channel_args();
-  return grpc::CreateChannelInternal(
+  auto channel = grpc::CreateChannelInternal(
       "inproc",
       grpc_inproc_channel_create(server_->server_, &channel_args, nullptr),
       std::move(interceptor_creators));
+  channel->pass_message_objects_ = PassMessageObjects(channel_args);
+  return channel;
 }
 
 static grpc_server_register_method_payload_handling PayloadHandlingForMethod(
@@ -1413,6 +1441,7 @@ grpc::CompletionQueue* Server::CallbackCQ() {
     callback_cq = new grpc::CompletionQueue(grpc_completion_queue_attributes{
         GRPC_CQ_CURRENT_VERSION, GRPC_CQ_CALLBACK, GRPC_CQ_DEFAULT_POLLING,
         shutdown_callback});
+    if (inline_callbacks_) grpc_cq_run_callbacks_inline(callback_cq->cq());
 
     // Transfer ownership of the new cq to its own shutdown callback
     shutdown_callback->TakeCQ(callback_cq);
@@ -52,6 +52,7 @@
 
 #include "absl/log/check.h"
 #include "absl/log/log.h"
+#include "absl/strings/str_cat.h"
 #include "absl/strings/str_format.h"
 #include "absl/strings/string_view.h"
 #include "src/core/lib/resource_quota/arena.h"
@@ -376,6 +377,11 @@ void ServerContextBase::set_compression_algorithm(
   AddInitialMetadata(GRPC_COMPRESSION_REQUEST_ALGORITHM_MD_KEY, algorithm_name);
 }
 
+void ServerContextBase::set_write_priority(uint32_t priority) {
+  CHECK_LE(priority, static_cast<uint32_t>(GRPC_MAX_WRITE_PRIORITY));
+  AddInitialMetadata(GRPC_WRITE_PRIORITY_MD_KEY, absl::StrCat(priority));
+}
+
 std::string ServerContextBase::peer() const {
   std::string peer;
   if (call_.call) {
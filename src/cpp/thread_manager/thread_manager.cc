@@ -18,7 +18,9 @@
 
 #include "src/cpp/thread_manager/thread_manager.h"
 
+#include <algorithm>
 #include <climits>
+#include <utility>
 
 #include "absl/log/check.h"
 #include "absl/log/log.h"
@@ -30,8 +32,9 @@
 
 namespace grpc {
 
-ThreadManager::WorkerThread::WorkerThread(ThreadManager* thd_mgr)
-    : thd_mgr_(thd_mgr) {
+ThreadManager::WorkerThread::WorkerThread(ThreadManager* thd_mgr,
+                                          bool handoff_worker)
+    : thd_mgr_(thd_mgr), handoff_worker_(handoff_worker) {
   // Make thread creation exclusive with respect to its join happening in
   // ~WorkerThread().
   thd_ = grpc_core::Thread(
@@ -44,7 +47,11 @@ ThreadManager::WorkerThread::WorkerThread(ThreadManager* thd_mgr)
 }
 
 void ThreadManager::WorkerThread::Run() {
-  thd_mgr_->MainWorkLoop();
+  if (handoff_worker_) {
+    thd_mgr_->HandoffWorkLoop();
+  } else {
+    thd_mgr_->MainWorkLoop();
+  }
   thd_mgr_->MarkAsCompleted(this);
 }
 
@@ -54,7 +61,8 @@ ThreadManager::WorkerThread::~WorkerThread() {
 }
 
 ThreadManager::ThreadManager(const char*, grpc_resource_quota* resource_quota,
-                             int min_pollers, int max_pollers)
+                             int min_pollers, int max_pollers, int min_workers,
+                             int max_workers)
     : shutdown_(false),
       thread_quota_(
           grpc_core::ResourceQuota::FromC(resource_quota)->thread_quota()),
@@ -62,6 +70,8 @@ ThreadManager::ThreadManager(const char*, grpc_resource_quota* resource_quota,
       min_pollers_(min_pollers),
       max_pollers_(max_pollers == -1 ? INT_MAX : max_pollers),
       num_threads_(0),
+      min_workers_(std::min(std::max(min_workers, 0), max_workers)),
+      max_workers_(std::max(max_workers, 0)),
       max_active_threads_sofar_(0) {}
 
 ThreadManager::~ThreadManager() {
@@ -83,6 +93,7 @@ void ThreadManager::Wait() {
 void ThreadManager::Shutdown() {
   grpc_core::MutexLock lock(&mu_);
   shutdown_ = true;
+  work_cv_.SignalAll();
 }
 
 bool ThreadManager::IsShutdown() {
@@ -125,27 +136,104 @@ void ThreadManager::CleanupCompletedThreads() {
 }
 
 void ThreadManager::Initialize() {
-  if (!thread_quota_->Reserve(min_pollers_)) {
+  if (!thread_quota_->Reserve(min_pollers_ + min_workers_)) {
     grpc_core::Crash(absl::StrFormat(
         "No thread quota available to even create the minimum required "
-        "polling threads (i.e %d). Unable to start the thread manager",
-        min_pollers_));
+        "polling and worker threads (i.e %d and %d). Unable to start the "
+        "thread manager",
+        min_pollers_, min_workers_));
   }
 
   {
     grpc_core::MutexLock lock(&mu_);
     num_pollers_ = min_pollers_;
-    num_threads_ = min_pollers_;
-    max_active_threads_sofar_ = min_pollers_;
+    num_workers_ = min_workers_;
+    num_threads_ = min_pollers_ + min_workers_;
+    max_active_threads_sofar_ = num_threads_;
   }
 
+  for (int i = 0; i < min_workers_; i++) {
+    WorkerThread* worker = new WorkerThread(this, /*handoff_worker=*/true);
+    CHECK(worker->created());  // Must be able to create the minimum
+    worker->Start();
+  }
   for (int i = 0; i < min_pollers_; i++) {
-    WorkerThread* worker = new WorkerThread(this);
+    WorkerThread* worker = new WorkerThread(this, /*handoff_worker=*/false);
     CHECK(worker->created());  // Must be able to create the minimum
     worker->Start();
   }
 }
 
+void ThreadManager::HandOff(void* tag, bool ok) {
+  grpc_core::LockableAndReleasableMutexLock lock(&mu_);
+  handoff_queue_.push_back(PendingWork{tag, ok});
+  // Each idle worker takes one queued item once it wakes, so only rely on them
+  // while there are enough of them for everything still queued. Otherwise the
+  // work would wait behind a busy worker's DoWork(), however long that runs.
+  if (handoff_queue_.size() <= static_cast<size_t>(idle_workers_)) {
+    work_cv_.Signal();
+    return;
+  }
+  bool resources = true;
+  if (!shutdown_ && num_workers_ < max_workers_) {
+    if (thread_quota_->Reserve(1)) {
+      num_workers_++;
+      num_threads_++;
+      if (num_threads_ > max_active_threads_sofar_) {
+        max_active_threads_sofar_ = num_threads_;
+      }
+      // Drop lock before spawning thread to avoid contention
+      lock.Release();
+      WorkerThread* worker = new WorkerThread(this, /*handoff_worker=*/true);
+      if (worker->created()) {
+        worker->Start();
+        return;
+      }
+      delete worker;
+      thread_quota_->Release(1);
+      lock.Lock();
+      num_workers_--;
+      num_threads_--;
+    }
+    resources = false;
+  }
+  if (num_workers_ > 0) return;
+  // No worker is left to take the work (we are out of threads, or the workers
+  // have exited during shutdown), so do it on this thread.
+  std::deque<PendingWork> work;
+  work.swap(handoff_queue_);
+  lock.Release();
+  for (const PendingWork& w : work) DoWork(w.tag, w.ok, resources);
+}
+
+void ThreadManager::HandoffWorkLoop() {
+  grpc_core::LockableAndReleasableMutexLock lock(&mu_);
+  while (true) {
+    if (handoff_queue_.empty()) {
+      if (shutdown_) break;
+      idle_workers_++;
+      const bool timed_out = work_cv_.WaitWithTimeout(
+          &mu_, absl::Milliseconds(kWorkerIdleTimeout.millis()));
+      idle_workers_--;
+      if (timed_out && handoff_queue_.empty() && num_workers_ > min_workers_) {
+        break;
+      }
+      continue;
+    }
+    PendingWork work = handoff_queue_.front();
+    handoff_queue_.pop_front();
+    lock.Release();
+    DoWork(work.tag, work.ok, true);
+    lock.Lock();
+  }
+  num_workers_--;
+  lock.Release();
+
+  // This thread is exiting. Do some cleanup work i.e delete already completed
+  // worker threads
+  CleanupCompletedThreads();
+}
+
 void ThreadManager::MainWorkLoop() {
   while (true) {
     void* tag;
@@ -167,6 +255,14 @@ void ThreadManager::MainWorkLoop() {
         done = true;
         break;
       case WORK_FOUND:
+        if (max_workers_ > 0) {
+          // Hand the work off and go straight back to polling.
+          lock.Release();
+          HandOff(tag, ok);
+          lock.Lock();
+          if (shutdown_) done = true;
+          break;
+        }
         // If we got work and there are now insufficient pollers and there is
         // quota available to create a new thread, start a new poller thread
         bool resource_exhausted = false;
@@ -180,7 +276,8 @@ void ThreadManager::MainWorkLoop() {
             }
             // Drop lock before spawning thread to avoid contention
             lock.Release();
-            WorkerThread* worker = new WorkerThread(this);
+            WorkerThread* worker =
+                new WorkerThread(this, /*handoff_worker=*/false);
             if (worker->created()) {
               worker->Start();
             } else {
@@ -19,19 +19,33 @@
 #ifndef GRPC_SRC_CPP_THREAD_MANAGER_THREAD_MANAGER_H
 #define GRPC_SRC_CPP_THREAD_MANAGER_THREAD_MANAGER_H
 
+#include <deque>
 #include <list>
 
 #include "src/core/lib/resource_quota/api.h"
 #include "src/core/lib/resource_quota/thread_quota.h"
 #include "src/core/util/sync.h"
 #include "src/core/util/thd.h"
+#include "src/core/util/time.h"
 
 namespace grpc {
 
+// Runs a pool of threads that poll for work with PollForWork() and perform
+// it with DoWork().
+//
+// By default each poller performs the work it finds itself, and new pollers
+// are created whenever too few are left polling. When max_workers is positive,
+// the pollers instead hand the work they find to a separate pool of worker
+// threads and go straight back to polling. Idle workers are woken one at a
+// time, and a new worker is created whenever more work is queued than there
+// are idle workers to take it, up to max_workers. Workers beyond min_workers
+// exit once they have been idle for kWorkerIdleTimeout, so a burst that needs
+// more threads than usual doesn't pay for thread creation again soon after.
 class ThreadManager {
  public:
   explicit ThreadManager(const char* name, grpc_resource_quota* resource_quota,
-                         int min_pollers, int max_pollers);
+                         int min_pollers, int max_pollers, int min_workers = 0,
+                         int max_workers = 0);
   virtual ~ThreadManager();
 
   // Initializes and Starts the Rpc Manager threads
@@ -90,6 +104,10 @@ class ThreadManager {
   // to check if resource_quota is properly being enforced.
   int GetMaxActiveThreadsSoFar();
 
+  // How long a worker beyond min_workers stays idle before exiting.
+  static constexpr grpc_core::Duration kWorkerIdleTimeout =
+      grpc_core::Duration::Seconds(30);
+
  private:
   // Helper wrapper class around grpc_core::Thread. Takes a ThreadManager object
   // and starts a new grpc_core::Thread to calls the Run() function.
@@ -117,18 +135,20 @@ class ThreadManager {
   // not be called (and the need for this WorkerThread class is eliminated)
   class WorkerThread {
    public:
-    explicit WorkerThread(ThreadManager* thd_mgr);
+    WorkerThread(ThreadManager* thd_mgr, bool handoff_worker);
     ~WorkerThread();
 
     bool created() const { return created_; }
     void Start() { thd_.Start(); }
 
    private:
-    // Calls thd_mgr_->MainWorkLoop() and once that completes, calls
-    // thd_mgr_>MarkAsCompleted(this) to mark the thread as completed
+    // Calls thd_mgr_->MainWorkLoop() (or HandoffWorkLoop() for a handoff
+    // worker) and once that completes, calls thd_mgr_>MarkAsCompleted(this) to
+    // mark the thread as completed
     void Run();
 
     ThreadManager* const thd_mgr_;
+    const bool handoff_worker_;
     grpc_core::Thread thd_;
     bool created_;
   };
@@ -136,11 +156,23 @@ class ThreadManager {
   // The main function in ThreadManager
   void MainWorkLoop();
 
+  // Work found by a poller, waiting for a handoff worker.
+  struct PendingWork {
+    void* tag;
+    bool ok;
+  };
+
+  // Queues work found by a poller for the handoff workers, waking or creating
+  // one if needed.
+  void HandOff(void* tag, bool ok);
+  // The main function of a handoff worker thread.
+  void HandoffWorkLoop();
+
   void MarkAsCompleted(WorkerThread* thd);
   void CleanupCompletedThreads();
 
-  // Protects shutdown_, num_pollers_, num_threads_ and
-  // max_active_threads_sofar_
+  // Protects shutdown_, num_pollers_, num_threads_, max_active_threads_sofar_
+  // and the handoff worker state
   grpc_core::Mutex mu_;
 
   bool shutdown_;
@@ -165,6 +197,14 @@ class ThreadManager {
   // threads that are currently polling i.e num_pollers_)
   int num_threads_;
 
+  // The number of handoff workers, and how many of them are waiting for work.
+  int min_workers_;
+  int max_workers_;
+  int num_workers_ = 0;
+  int idle_workers_ = 0;
+  std::deque<PendingWork> handoff_queue_;
+  grpc_core::CondVar work_cv_;
+
   // See GetMaxActiveThreadsSoFar()'s description.
   // To be more specific, this variable tracks the max value num_threads_ was
   // ever set so far
@@ -113,8 +113,11 @@ CORE_SOURCE_FILES = [
     'src/core/credentials/transport/xds/xds_credentials.cc',
     'src/core/ext/filters/backend_metrics/backend_metric_filter.cc',
     'src/core/ext/filters/census/grpc_context.cc',
+    'src/core/ext/filters/channel_idle/goaway_pacer.cc',
     'src/core/ext/filters/channel_idle/idle_filter_state.cc',
     'src/core/ext/filters/channel_idle/legacy_channel_idle_filter.cc',
+    'src/core/ext/filters/concurrency_limit/client_concurrency_limit_filter.cc',
+    'src/core/ext/filters/concurrency_limit/server_concurrency_limit_filter.cc',
     'src/core/ext/filters/fault_injection/fault_injection_filter.cc',
     'src/core/ext/filters/fault_injection/fault_injection_service_config_parser.cc',
     'src/core/ext/filters/gcp_authentication/gcp_authentication_filter.cc',
@@ -523,6 +526,7 @@ CORE_SOURCE_FILES = [
     'src/core/lib/event_engine/event_engine.cc',
     'src/core/lib/event_engine/forkable.cc',
     'src/core/lib/event_engine/posix_engine/ev_epoll1_linux.cc',
+    'src/core/lib/event_engine/posix_engine/ev_io_uring_linux.cc',
     'src/core/lib/event_engine/posix_engine/ev_poll_posix.cc',
     'src/core/lib/event_engine/posix_engine/event_poller_posix_default.cc',
     'src/core/lib/event_engine/posix_engine/internal_errqueue.cc',
@@ -532,11 +536,13 @@ CORE_SOURCE_FILES = [
     'src/core/lib/event_engine/posix_engine/posix_engine.cc',
     'src/core/lib/event_engine/posix_engine/posix_engine_listener.cc',
     'src/core/lib/event_engine/posix_engine/posix_engine_listener_utils.cc',
+    'src/core/lib/event_engine/posix_engine/read_buffer_pool.cc',
     'src/core/lib/event_engine/posix_engine/set_socket_dualstack.cc',
     'src/core/lib/event_engine/posix_engine/tcp_socket_utils.cc',
     'src/core/lib/event_engine/posix_engine/timer.cc',
     'src/core/lib/event_engine/posix_engine/timer_heap.cc',
     'src/core/lib/event_engine/posix_engine/timer_manager.cc',
+    'src/core/lib/event_engine/posix_engine/timer_wheel.cc',
     'src/core/lib/event_engine/posix_engine/traced_buffer_list.cc',
     'src/core/lib/event_engine/posix_engine/wakeup_fd_eventfd.cc',
     'src/core/lib/event_engine/posix_engine/wakeup_fd_pipe.cc',
@@ -639,6 +645,7 @@ CORE_SOURCE_FILES = [
     'src/core/lib/resource_quota/api.cc',
     'src/core/lib/resource_quota/arena.cc',
     'src/core/lib/resource_quota/connection_quota.cc',
+    'src/core/lib/resource_quota/cpu_quota.cc',
     'src/core/lib/resource_quota/memory_quota.cc',
     'src/core/lib/resource_quota/periodic_update.cc',
     'src/core/lib/resource_quota/resource_quota.cc',
@@ -668,6 +675,7 @@ CORE_SOURCE_FILES = [
     'src/core/lib/surface/completion_queue.cc',
     'src/core/lib/surface/completion_queue_factory.cc',
     'src/core/lib/surface/connection_context.cc',
+    'src/core/lib/surface/deadline_sweeper.cc',
     'src/core/lib/surface/event_string.cc',
     'src/core/lib/surface/filter_stack_call.cc',
     'src/core/lib/surface/init.cc',
@@ -697,8 +705,10 @@ CORE_SOURCE_FILES = [
     'src/core/load_balancing/health_check_client.cc',
     'src/core/load_balancing/lb_policy.cc',
     'src/core/load_balancing/lb_policy_registry.cc',
+    'src/core/load_balancing/least_request/least_request.cc',
     'src/core/load_balancing/oob_backend_metric.cc',
     'src/core/load_balancing/outlier_detection/outlier_detection.cc',
+    'src/core/load_balancing/peak_ewma/peak_ewma.cc',
     'src/core/load_balancing/pick_first/pick_first.cc',
     'src/core/load_balancing/priority/priority.cc',
     'src/core/load_balancing/ring_hash/ring_hash.cc',
@@ -721,6 +731,7 @@ CORE_SOURCE_FILES = [
     'src/core/resolver/dns/c_ares/grpc_ares_wrapper_posix.cc',
     'src/core/resolver/dns/c_ares/grpc_ares_wrapper_windows.cc',
     'src/core/resolver/dns/dns_resolver_plugin.cc',
+    'src/core/resolver/dns/event_engine/dns_cache.cc',
     'src/core/resolver/dns/event_engine/event_engine_client_channel_resolver.cc',
     'src/core/resolver/dns/event_engine/service_config_helper.cc',
     'src/core/resolver/dns/native/dns_resolver.cc',
@@ -739,6 +750,7 @@ CORE_SOURCE_FILES = [
     'src/core/server/server_call_tracer_filter.cc',
     'src/core/server/server_config_selector_filter.cc',
     'src/core/server/xds_channel_stack_modifier.cc',
+    'src/core/server/xds_filter_chain_match_table.cc',
     'src/core/server/xds_server_config_fetcher.cc',
     'src/core/service_config/service_config_channel_arg_filter.cc',
     'src/core/service_config/service_config_impl.cc',
@@ -761,6 +773,7 @@ CORE_SOURCE_FILES = [
     'src/core/tsi/alts/frame_protector/alts_seal_privacy_integrity_crypter.cc',
     'src/core/tsi/alts/frame_protector/alts_unseal_privacy_integrity_crypter.cc',
     'src/core/tsi/alts/frame_protector/frame_handler.cc',
+    'src/core/tsi/alts/handshaker/alts_handshaker_channel_pool.cc',
     'src/core/tsi/alts/handshaker/alts_handshaker_client.cc',
     'src/core/tsi/alts/handshaker/alts_shared_resource.cc',
     'src/core/tsi/alts/handshaker/alts_tsi_handshaker.cc',
@@ -777,12 +790,16 @@ CORE_SOURCE_FILES = [
     'src/core/tsi/ssl/session_cache/ssl_session_boringssl.cc',
     'src/core/tsi/ssl/session_cache/ssl_session_cache.cc',
     'src/core/tsi/ssl/session_cache/ssl_session_openssl.cc',
+    'src/core/tsi/ssl/session_ticket/ssl_session_ticket_keys.cc',
+    'src/core/tsi/ssl/verified_chain_cache/ssl_verified_chain_cache.cc',
     'src/core/tsi/ssl_transport_security.cc',
     'src/core/tsi/ssl_transport_security_utils.cc',
     'src/core/tsi/transport_security.cc',
     'src/core/tsi/transport_security_grpc.cc',
     'src/core/util/alloc.cc',
     'src/core/util/backoff.cc',
+    'src/core/util/codel.cc',
+    'src/core/util/concurrent_tdigest.cc',
     'src/core/util/crash.cc',
     'src/core/util/dump_args.cc',
     'src/core/util/event_log.cc',
@@ -801,6 +818,7 @@ CORE_SOURCE_FILES = [
     'src/core/util/http_client/httpcli.cc',
     'src/core/util/http_client/httpcli_security_connector.cc',
     'src/core/util/http_client/parser.cc',
+    'src/core/util/huge_page_allocator.cc',
     'src/core/util/iphone/cpu.cc',
     'src/core/util/json/json_object_loader.cc',
     'src/core/util/json/json_reader.cc',
@@ -814,6 +832,7 @@ CORE_SOURCE_FILES = [
     'src/core/util/matchers.cc',
     'src/core/util/mpscq.cc',
     'src/core/util/msys/tmpfile.cc',
+    'src/core/util/numa.cc',
     'src/core/util/per_cpu.cc',
     'src/core/util/posix/cpu.cc',
     'src/core/util/posix/directory_reader.cc',
@@ -833,6 +852,7 @@ CORE_SOURCE_FILES = [
     'src/core/util/sync.cc',
     'src/core/util/sync_abseil.cc',
     'src/core/util/tchar.cc',
+    'src/core/util/tdigest.cc',
     'src/core/util/time.cc',
     'src/core/util/time_averaged_stats.cc',
     'src/core/util/time_precise.cc',
@@ -294,6 +294,9 @@ extern grpc_tls_credentials_options_set_check_call_host_type grpc_tls_credential
 typedef void(*grpc_tls_credentials_options_set_tls_session_key_log_file_path_type)(grpc_tls_credentials_options* options, const char* path);
 extern grpc_tls_credentials_options_set_tls_session_key_log_file_path_type grpc_tls_credentials_options_set_tls_session_key_log_file_path_import;
 #define grpc_tls_credentials_options_set_tls_session_key_log_file_path grpc_tls_credentials_options_set_tls_session_key_log_file_path_import
+typedef void(*grpc_tls_credentials_options_set_tls_session_ticket_key_file_path_type)(grpc_tls_credentials_options* options, const char* path);
+extern grpc_tls_credentials_options_set_tls_session_ticket_key_file_path_type grpc_tls_credentials_options_set_tls_session_ticket_key_file_path_import;
+#define grpc_tls_credentials_options_set_tls_session_ticket_key_file_path grpc_tls_credentials_options_set_tls_session_ticket_key_file_path_import
 typedef void(*grpc_metadata_array_init_type)(grpc_metadata_array* array);
 extern grpc_metadata_array_init_type grpc_metadata_array_init_import;
 #define grpc_metadata_array_init grpc_metadata_array_init_import
@@ -342,6 +345,9 @@ extern grpc_completion_queue_create_type grpc_completion_queue_create_import;
 typedef grpc_event(*grpc_completion_queue_next_type)(grpc_completion_queue* cq, gpr_timespec deadline, void* reserved);
 extern grpc_completion_queue_next_type grpc_completion_queue_next_import;
 #define grpc_completion_queue_next grpc_completion_queue_next_import
+typedef int(*grpc_completion_queue_next_batch_type)(grpc_completion_queue* cq, grpc_event* events, int max_events, gpr_timespec deadline, void* reserved);
+extern grpc_completion_queue_next_batch_type grpc_completion_queue_next_batch_import;
+#define grpc_completion_queue_next_batch grpc_completion_queue_next_batch_import
 typedef grpc_event(*grpc_completion_queue_pluck_type)(grpc_completion_queue* cq, void* tag, gpr_timespec deadline, void* reserved);
 extern grpc_completion_queue_pluck_type grpc_completion_queue_pluck_import;
 #define grpc_completion_queue_pluck grpc_completion_queue_pluck_import
@@ -501,6 +507,9 @@ extern grpc_resource_quota_resize_type grpc_resource_quota_resize_import;
 typedef void(*grpc_resource_quota_set_max_threads_type)(grpc_resource_quota* resource_quota, int new_max_threads);
 extern grpc_resource_quota_set_max_threads_type grpc_resource_quota_set_max_threads_import;
 #define grpc_resource_quota_set_max_threads grpc_resource_quota_set_max_threads_import
+typedef void(*grpc_resource_quota_set_max_cpu_type)(grpc_resource_quota* resource_quota, double max_cores);
+extern grpc_resource_quota_set_max_cpu_type grpc_resource_quota_set_max_cpu_import;
+#define grpc_resource_quota_set_max_cpu grpc_resource_quota_set_max_cpu_import
 typedef grpc_slice(*grpc_dump_xds_configs_type)(void);
 extern grpc_dump_xds_configs_type grpc_dump_xds_configs_import;
 #define grpc_dump_xds_configs grpc_dump_xds_configs_import
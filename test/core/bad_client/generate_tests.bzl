@@ -63,6 +63,7 @@ def grpc_bad_client_tests():
             tags = ["bad_client_test"],
             external_deps = [
                 "absl/log:check",
+                "absl/strings",
                 "gtest",
             ],
         )
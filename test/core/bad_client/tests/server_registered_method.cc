@@ -20,7 +20,11 @@
 #include <grpc/grpc.h>
 #include <grpc/support/time.h>
 
+#include <string>
+
 #include "absl/log/check.h"
+#include "absl/strings/match.h"
+#include "src/core/lib/slice/slice.h"
 #include "src/core/server/server.h"
 #include "test/core/bad_client/bad_client.h"
 #include "test/core/end2end/cq_verifier.h"
@@ -75,6 +79,19 @@ static void verifier_fails(grpc_server* server, grpc_completion_queue* cq,
   }
 }
 
+// Checks that the server failed the stream with the message size filter's
+// error as soon as it saw the length prefix.
+static bool message_too_large_validator(grpc_slice_buffer* incoming,
+                                        void* /*arg*/) {
+  std::string response;
+  for (size_t i = 0; i < incoming->count; ++i) {
+    response += grpc_core::StringViewFromSlice(incoming->slices[i]);
+  }
+  return absl::StrContains(response,
+                           "SERVER: Received message larger than max "
+                           "(2147483647 vs. 4194304)");
+}
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(&argc, argv);
   grpc_init();
@@ -124,6 +141,12 @@ int main(int argc, char** argv) {
       "\x00\x00\x07\x00\x01\x00\x00\x00\x01\x00\x00\x00\x00\x02\x00\x00",
       0);
 
+  // A length prefix over the limit, with none of the body: the server must not
+  // wait for the body before failing the stream.
+  GRPC_RUN_BAD_CLIENT_TEST(
+      nullptr, message_too_large_validator,
+      PFX_STR "\x00\x00\x05\x00\x00\x00\x00\x00\x01\x00\x7f\xff\xff\xff", 0);
+
   grpc_shutdown();
   return 0;
 }
@@ -33,6 +33,7 @@
 #include "absl/strings/str_join.h"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
 #include "src/core/util/ref_counted_ptr.h"
@@ -71,6 +72,18 @@ TEST(CallArenaAllocatorTest, SettlesWithAllocation) {
   LOG(INFO) << estimate;
 }
 
+TEST(CallArenaAllocatorTest, ReusesArenaMemory) {
+  if (!IsCallArenaRecyclingEnabled()) {
+    GTEST_SKIP() << "Requires the call_arena_recycling experiment";
+  }
+  auto allocator = MakeRefCounted<CallArenaAllocator>(
+      ResourceQuota::Default()->memory_quota()->CreateMemoryAllocator(
+          "test-allocator"),
+      1024);
+  void* first = allocator->MakeArena().get();
+  EXPECT_EQ(allocator->MakeArena().get(), first);
+}
+
 }  // namespace grpc_core
 
 int main(int argc, char* argv[]) {
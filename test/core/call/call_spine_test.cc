@@ -18,12 +18,15 @@
 
 #include <atomic>
 #include <memory>
+#include <optional>
 #include <queue>
 
+#include "absl/status/status.h"
 #include "absl/strings/string_view.h"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 #include "src/core/call/metadata.h"
+#include "src/core/lib/promise/map.h"
 #include "src/core/lib/resource_quota/arena.h"
 #include "test/core/call/yodel/yodel_test.h"
 
@@ -182,4 +185,119 @@ CALL_SPINE_TEST(UnaryRequestThroughForwardCallWithServerTrailingMetadataHook) {
   EXPECT_TRUE(got_md);
 }
 
+CALL_SPINE_TEST(ForwardCallHoldsBackWriterUntilReaderTakesMessages) {
+  auto call1 = MakeCall(MakeClientInitialMetadata());
+  auto handler1 = call1.handler.StartCall();
+  std::optional<CallHandler> handler2;
+  int messages_pushed = 0;
+  SpawnTestSeq(
+      call1.initiator, "forward",
+      [handler1]() mutable { return handler1.PullClientInitialMetadata(); },
+      [this, handler1,
+       &handler2](ValueOrFailure<ClientMetadataHandle> md) mutable {
+        EXPECT_TRUE(md.ok());
+        auto call2 = MakeCall(std::move(md.value()));
+        ForwardCall(handler1, call2.initiator);
+        handler2 = call2.handler.StartCall();
+      });
+  auto push = [initiator = call1.initiator, &messages_pushed]() mutable {
+    return Map(initiator.PushMessage(Arena::MakePooled<Message>(
+                   SliceBuffer(Slice::FromCopiedString("hello")), 0)),
+               [&messages_pushed](StatusFlag status) {
+                 EXPECT_TRUE(status.ok());
+                 ++messages_pushed;
+                 return status;
+               });
+  };
+  SpawnTestSeq(
+      call1.initiator, "writer", push, [push](StatusFlag) { return push(); },
+      [push](StatusFlag) { return push(); },
+      [initiator = call1.initiator](StatusFlag) mutable {
+        initiator.FinishSends();
+        return initiator.PullServerTrailingMetadata();
+      },
+      [](ValueOrFailure<ServerMetadataHandle> md) {
+        EXPECT_TRUE(md.ok());
+        EXPECT_EQ(*md.value()->get_pointer(GrpcStatusMetadata()),
+                  GRPC_STATUS_OK);
+      });
+  TickUntilTrue([&]() { return handler2.has_value(); });
+  event_engine()->TickUntilIdle();
+  // The first message is held by the forwarding call until the second call
+  // takes it, so the writer cannot get further ahead of the reader.
+  EXPECT_EQ(messages_pushed, 1);
+  SpawnTestSeq(
+      *handler2, "reader",
+      [handler = *handler2]() mutable {
+        return handler.PullClientInitialMetadata();
+      },
+      [handler = *handler2](ValueOrFailure<ClientMetadataHandle>) mutable {
+        return handler.PullMessage();
+      },
+      [handler = *handler2](ClientToServerNextMessage msg) mutable {
+        EXPECT_TRUE(msg.has_value());
+        return handler.PullMessage();
+      },
+      [handler = *handler2](ClientToServerNextMessage msg) mutable {
+        EXPECT_TRUE(msg.has_value());
+        return handler.PullMessage();
+      },
+      [handler = *handler2](ClientToServerNextMessage msg) mutable {
+        EXPECT_TRUE(msg.has_value());
+        return handler.PullMessage();
+      },
+      [handler = *handler2](ClientToServerNextMessage msg) mutable {
+        EXPECT_TRUE(msg.ok());
+        EXPECT_FALSE(msg.has_value());
+        auto md = Arena::MakePooledForOverwrite<ServerMetadata>();
+        md->Set(GrpcStatusMetadata(), GRPC_STATUS_OK);
+        handler.PushServerTrailingMetadata(std::move(md));
+      });
+  WaitForAllPendingWork();
+  EXPECT_EQ(messages_pushed, 3);
+}
+
+CALL_SPINE_TEST(ForwardCallStopsWhenReceivingCallIsCancelled) {
+  auto call1 = MakeCall(MakeClientInitialMetadata());
+  auto handler1 = call1.handler.StartCall();
+  std::optional<CallHandler> handler2;
+  SpawnTestSeq(
+      call1.initiator, "forward",
+      [handler1]() mutable { return handler1.PullClientInitialMetadata(); },
+      [this, handler1,
+       &handler2](ValueOrFailure<ClientMetadataHandle> md) mutable {
+        EXPECT_TRUE(md.ok());
+        auto call2 = MakeCall(std::move(md.value()));
+        ForwardCall(handler1, call2.initiator);
+        handler2 = call2.handler.StartCall();
+      });
+  SpawnTestSeq(
+      call1.initiator, "writer",
+      [initiator = call1.initiator]() mutable {
+        return initiator.PushMessage(Arena::MakePooled<Message>(
+            SliceBuffer(Slice::FromCopiedString("hello")), 0));
+      },
+      [initiator = call1.initiator](StatusFlag) mutable {
+        return initiator.PushMessage(Arena::MakePooled<Message>(
+            SliceBuffer(Slice::FromCopiedString("hello again")), 0));
+      },
+      [initiator = call1.initiator](StatusFlag) mutable {
+        return initiator.PullServerTrailingMetadata();
+      },
+      [](ValueOrFailure<ServerMetadataHandle> md) {
+        EXPECT_TRUE(md.ok());
+        EXPECT_EQ(*md.value()->get_pointer(GrpcStatusMetadata()),
+                  GRPC_STATUS_CANCELLED);
+      });
+  TickUntilTrue([&]() { return handler2.has_value(); });
+  event_engine()->TickUntilIdle();
+  // Cancel the second call while the forwarding call waits for it to take the
+  // first message. The forwarding must stop rather than wait forever.
+  SpawnTestSeq(*handler2, "cancel", [handler = *handler2]() mutable {
+    handler.PushServerTrailingMetadata(
+        CancelledServerMetadataFromStatus(absl::CancelledError()));
+  });
+  WaitForAllPendingWork();
+}
+
 }  // namespace grpc_core
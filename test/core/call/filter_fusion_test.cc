@@ -312,7 +312,7 @@ TEST(FusedFilterTest, ClientFilterTest) {
   absl::StatusOr<std::unique_ptr<TestFusedFilter>> filter =
       TestFusedFilter::Create(ChannelArgs(), ChannelFilter::Args());
   CHECK(filter.ok());
-  TestFusedFilter::Call call;
+  TestFusedFilter::Call call(filter->get());
   history.clear();
   auto message = Arena::MakePooled<Message>();
   auto server_metadata_handle = Arena::MakePooled<ServerMetadata>();
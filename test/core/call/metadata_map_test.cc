@@ -335,6 +335,37 @@ TEST(MetadataMapTest, FilterTest) {
   EXPECT_EQ(map.count(), kNumNonEncodableHeaders);
 }
 
+TEST(MetadataMapTest, NameIndexFindsEveryName) {
+  std::vector<std::string> names = GetEncodableHeaders();
+  names.push_back("");
+  std::vector<absl::string_view> views(names.begin(), names.end());
+  metadata_detail::NameIndex index(views);
+  for (size_t i = 0; i < names.size(); ++i) {
+    EXPECT_EQ(index.Find(names[i]), static_cast<int>(i)) << names[i];
+  }
+  EXPECT_EQ(index.Find("unknown_key"), -1);
+  EXPECT_EQ(index.Find(":pat"), -1);
+  EXPECT_EQ(index.Find(":pathx"), -1);
+}
+
+TEST(MetadataMapTest, LookupByName) {
+  grpc_metadata_batch map;
+  for (const std::string& key : GetEncodableHeaders()) {
+    map.Append(key, Slice::FromStaticString("1"),
+               [](absl::string_view /*error*/, const Slice& /*value*/) {});
+  }
+  map.Append("unknown_key", Slice::FromStaticString("1"),
+             [](absl::string_view /*error*/, const Slice& /*value*/) {});
+  EXPECT_NE(map.get_pointer(HttpPathMetadata()), nullptr);
+  EXPECT_EQ(map.get(GrpcStatusMetadata()), GRPC_STATUS_CANCELLED);
+  std::string buffer;
+  EXPECT_EQ(map.GetStringValue(":path", &buffer), "1");
+  EXPECT_EQ(map.GetStringValue("unknown_key", &buffer), "1");
+  EXPECT_EQ(map.GetStringValue("other_key", &buffer), std::nullopt);
+  map.Remove(":path");
+  EXPECT_EQ(map.get_pointer(HttpPathMetadata()), nullptr);
+}
+
 }  // namespace testing
 }  // namespace grpc_core
 
@@ -14,6 +14,8 @@
 
 #include "src/core/call/request_buffer.h"
 
+#include <grpc/slice.h>
+
 #include "gtest/gtest.h"
 #include "test/core/promise/poll_matcher.h"
 
@@ -585,6 +587,47 @@ TEST(RequestBufferTest, HedgeReadMetadataLateSwitchAfterPullInitialMetadata) {
   EXPECT_FALSE(value2.ok());
 }
 
+TEST(RequestBufferTest, CommitReleasesMessagesAlreadyPulledByWinner) {
+  static char payload[] = "message 0";
+  bool released = false;
+  RequestBuffer buffer;
+  EXPECT_EQ(buffer.PushClientInitialMetadata(TestMetadata()), 40);
+  RequestBuffer::Reader reader1(&buffer);
+  RequestBuffer::Reader reader2(&buffer);
+  auto pull_md = reader1.PullClientInitialMetadata();
+  EXPECT_THAT(pull_md(), IsReady());  // value tested elsewhere
+  auto pusher1 = buffer.PushMessage(Arena::MakePooled<Message>(
+      SliceBuffer(Slice(grpc_slice_new_with_user_data(
+          payload, sizeof(payload) - 1,
+          [](void* p) { *static_cast<bool*>(p) = true; }, &released))),
+      0));
+  EXPECT_THAT(pusher1(), IsReady(49));
+  auto pusher2 = buffer.PushMessage(TestMessage(1));
+  EXPECT_THAT(pusher2(), IsReady(58));
+  {
+    auto pull_msg = reader1.PullMessage();
+    auto poll_msg = pull_msg();
+    ASSERT_TRUE(poll_msg.ready());
+    ASSERT_TRUE(poll_msg.value().ok());
+    ASSERT_TRUE(poll_msg.value().value().has_value());
+    EXPECT_THAT(poll_msg.value().value().value(), IsTestMessage(0));
+  }
+  // reader2 may still read the first message.
+  EXPECT_FALSE(released);
+  buffer.Commit(&reader1);
+  EXPECT_TRUE(released);
+  auto pull_msg = reader1.PullMessage();
+  auto poll_msg = pull_msg();
+  ASSERT_TRUE(poll_msg.ready());
+  ASSERT_TRUE(poll_msg.value().ok());
+  ASSERT_TRUE(poll_msg.value().value().has_value());
+  EXPECT_THAT(poll_msg.value().value().value(), IsTestMessage(1));
+  auto pull_md2 = reader2.PullClientInitialMetadata();
+  auto poll_md2 = pull_md2();
+  ASSERT_THAT(poll_md2, IsReady());
+  EXPECT_FALSE(poll_md2.value().ok());
+}
+
 TEST(RequestBufferTest, StreamingPushBeforeLastMessagePulled) {
   StrictMock<MockActivity> activity;
   activity.Activate();
@@ -87,6 +87,30 @@ TEST(ChannelArgsTest, RemoveAllKeysWithPrefix) {
   EXPECT_EQ(modified.GetInt("bar"), 4);
 }
 
+TEST(ChannelArgsTest, EqualArgsHaveEqualHashes) {
+  struct Test : public RefCounted<Test> {
+    explicit Test(int n) : n(n) {}
+    int n;
+    static int ChannelArgsCompare(const Test* a, const Test* b) {
+      return a->n - b->n;
+    }
+  };
+  // Built in a different order, and with distinct but equal pointers.
+  ChannelArgs a = ChannelArgs()
+                      .Set("int", 1)
+                      .Set("string", "foo")
+                      .Set("pointer", MakeRefCounted<Test>(123));
+  ChannelArgs b = ChannelArgs()
+                      .Set("pointer", MakeRefCounted<Test>(123))
+                      .Set("string", "foo")
+                      .Set("int", 1);
+  ASSERT_EQ(a, b);
+  EXPECT_EQ(a.Hash(), b.Hash());
+  EXPECT_NE(a.Hash(), a.Set("int", 2).Hash());
+  EXPECT_NE(a.Hash(), a.Set("string", "bar").Hash());
+  EXPECT_NE(a.Hash(), a.Remove("int").Hash());
+}
+
 TEST(ChannelArgsTest, StoreRefCountedPtr) {
   struct Test : public RefCounted<Test> {
     explicit Test(int n) : n(n) {}
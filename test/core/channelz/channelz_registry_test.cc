@@ -205,6 +205,29 @@ TEST_P(ChannelzRegistryTest, HugeNodeCount) {
   std::shuffle(nodes.begin(), nodes.end(), SharedBitGen());
 }
 
+TEST_P(ChannelzRegistryTest, PaginationVisitsEveryNodeInOrder) {
+  std::vector<RefCountedPtr<BaseNode>> nodes;
+  nodes.reserve(5000);
+  for (int i = 0; i < 5000; ++i) {
+    nodes.push_back(MakeRefCounted<ChannelNode>("x", 1, false));
+  }
+  // Number a few nodes up front so that the query sees both numbered and
+  // unnumbered nodes.
+  for (int i = 0; i < 5000; i += 7) nodes[i]->uuid();
+  std::vector<intptr_t> uuids;
+  intptr_t start = 0;
+  while (true) {
+    auto [channels, end] = ChannelzRegistry::GetTopChannels(start);
+    for (const auto& channel : channels) uuids.push_back(channel->uuid());
+    if (end) break;
+    ASSERT_FALSE(channels.empty());
+    start = channels.back()->uuid() + 1;
+  }
+  EXPECT_EQ(uuids.size(), nodes.size());
+  EXPECT_TRUE(std::is_sorted(uuids.begin(), uuids.end()));
+  EXPECT_EQ(std::adjacent_find(uuids.begin(), uuids.end()), uuids.end());
+}
+
 TEST_P(ChannelzRegistryTest, HugeNodeCountWithParents) {
   std::vector<RefCountedPtr<BaseNode>> nodes;
   for (int i = 0; i < 10; ++i) {
@@ -161,6 +161,61 @@ TEST(ZTraceCollectorTest, EarlyTerminationWorks) {
   grpc_shutdown();
 }
 
+TEST(ZTraceCollectorTest, TraceStartsWithHistory) {
+  grpc_init();
+  ZTraceCollector<TestConfig, TestData> collector;
+  collector.KeepHistory(1024 * 1024);
+  int i = 0;
+  for (; i < 10; i++) collector.Append(TestData{1000 + i});
+  Notification n;
+  Json result;
+  collector.MakeZTrace()->Run(
+      Timestamp::Now() + Duration::Milliseconds(100),
+      {{"memory_cap", std::to_string(1024 * 1024 * 1024)},
+       {"test_arg", "test_value"}},
+      grpc_event_engine::experimental::GetDefaultEventEngine(),
+      [&n, &result](Json r) {
+        result = r;
+        n.Notify();
+      });
+  while (!n.HasBeenNotified()) {
+    collector.Append(TestData{1000 + i});
+    i++;
+  }
+  ValidateSimpleTrace(result, i);
+  EXPECT_GE(result.object().find("entries")->second.array().size(), 10);
+  grpc_shutdown();
+}
+
+TEST(ZTraceCollectorTest, HistoryIsBounded) {
+  grpc_init();
+  ZTraceCollector<TestConfig, TestData> collector;
+  collector.KeepHistory(10 * MemoryUsage(TestData{0}));
+  for (int i = 0; i < 100; i++) collector.Append(TestData{i});
+  Notification n;
+  Json result;
+  collector.MakeZTrace()->Run(
+      Timestamp::Now() + Duration::Hours(100), {{"test_arg", "test_value"}},
+      grpc_event_engine::experimental::GetDefaultEventEngine(),
+      [&n, &result](Json r) {
+        result = r;
+        n.Notify();
+      });
+  collector.Append(TestData{42});
+  n.WaitForNotification();
+  ASSERT_EQ(result.type(), Json::Type::kObject);
+  auto entries_it = result.object().find("entries");
+  ASSERT_NE(entries_it, result.object().end());
+  const auto& entries_array = entries_it->second.array();
+  ASSERT_EQ(entries_array.size(), 11);
+  for (int i = 0; i < 10; i++) {
+    EXPECT_EQ(entries_array[i].object().find("n")->second.string(),
+              std::to_string(90 + i));
+  }
+  EXPECT_EQ(entries_array[10].object().find("n")->second.string(), "42");
+  grpc_shutdown();
+}
+
 struct ExhaustionResult {
   Json result;
   Notification n;
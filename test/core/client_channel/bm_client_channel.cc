@@ -29,14 +29,16 @@ const Slice kTestPath = Slice::FromExternalString("/foo/bar");
 
 class ClientChannelTraits {
  public:
+  ClientChannelTraits() = default;
+  explicit ClientChannelTraits(ChannelArgs args) : args_(std::move(args)) {}
+
   RefCountedPtr<UnstartedCallDestination> CreateCallDestination(
       RefCountedPtr<UnstartedCallDestination> final_destination) {
     call_destination_factory_ = std::make_unique<TestCallDestinationFactory>(
         std::move(final_destination));
     auto channel = ClientChannel::Create(
         "test:///target",
-        ChannelArgs()
-            .SetObject(&client_channel_factory_)
+        args_.SetObject(&client_channel_factory_)
             .SetObject(call_destination_factory_.get())
             .SetObject(ResourceQuota::Default())
             .SetObject(grpc_event_engine::experimental::GetDefaultEventEngine())
@@ -105,11 +107,29 @@ class ClientChannelTraits {
     RefCountedPtr<UnstartedCallDestination> call_destination_;
   };
 
+  const ChannelArgs args_;
   std::unique_ptr<TestCallDestinationFactory> call_destination_factory_;
   TestClientChannelFactory client_channel_factory_;
 };
 GRPC_CALL_SPINE_BENCHMARK(UnstartedCallDestinationFixture<ClientChannelTraits>);
 
+// Calls whose method config comes from a service config: the test path has
+// no method config of its own, so each call falls back to the wildcard
+// config for its service, with a timeout and wait_for_ready to apply.
+class ClientChannelWithServiceConfigTraits : public ClientChannelTraits {
+ public:
+  ClientChannelWithServiceConfigTraits()
+      : ClientChannelTraits(ChannelArgs().Set(
+            GRPC_ARG_SERVICE_CONFIG,
+            "{\"methodConfig\":["
+            "{\"name\":[{\"service\":\"foo\",\"method\":\"baz\"}],"
+            "\"timeout\":\"5s\"},"
+            "{\"name\":[{\"service\":\"foo\"}],"
+            "\"timeout\":\"10s\",\"waitForReady\":true}]}")) {}
+};
+GRPC_CALL_SPINE_BENCHMARK(
+    UnstartedCallDestinationFixture<ClientChannelWithServiceConfigTraits>);
+
 namespace {
 class TestResolver final : public Resolver {
  public:
@@ -15,15 +15,22 @@
 #include "src/core/client_channel/retry_interceptor.h"
 
 #include <grpc/grpc.h>
+#include <grpc/impl/channel_arg_names.h>
 
 #include <atomic>
 #include <memory>
+#include <optional>
 #include <queue>
+#include <string>
 
+#include "absl/log/check.h"
+#include "absl/strings/str_cat.h"
 #include "absl/strings/string_view.h"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/service_config/service_config_call_data.h"
+#include "src/core/service_config/service_config_impl.h"
 #include "test/core/call/yodel/yodel_test.h"
 
 namespace grpc_core {
@@ -32,6 +39,31 @@ using EventEngine = grpc_event_engine::experimental::EventEngine;
 
 namespace {
 const absl::string_view kTestPath = "/test_method";
+
+std::string HedgingServiceConfig(int max_attempts,
+                                 absl::string_view hedging_delay) {
+  return absl::StrCat(
+      "{\n"
+      "  \"methodConfig\": [ {\n"
+      "    \"name\": [ {} ],\n"
+      "    \"hedgingPolicy\": {\n"
+      "      \"maxAttempts\": ",
+      max_attempts,
+      ",\n"
+      "      \"hedgingDelay\": \"",
+      hedging_delay,
+      "\",\n"
+      "      \"nonFatalStatusCodes\": [\"UNAVAILABLE\"]\n"
+      "    }\n"
+      "  } ]\n"
+      "}");
+}
+
+ServerMetadataHandle MakeServerTrailingMetadata(grpc_status_code status) {
+  auto md = Arena::MakePooledForOverwrite<ServerMetadata>();
+  md->Set(GrpcStatusMetadata(), status);
+  return md;
+}
 }  // namespace
 
 class RetryInterceptorTest : public YodelTest {
@@ -45,6 +77,14 @@ class RetryInterceptorTest : public YodelTest {
     destination_under_test_ = builder.Build(call_destination_).value();
   }
 
+  // Calls made after this get the method config in \a json.
+  void SetServiceConfig(absl::string_view json) {
+    auto service_config = ServiceConfigImpl::Create(
+        ChannelArgs().Set(GRPC_ARG_EXPERIMENTAL_ENABLE_HEDGING, true), json);
+    CHECK_OK(service_config);
+    service_config_ = std::move(*service_config);
+  }
+
   ClientMetadataHandle MakeClientInitialMetadata() {
     auto client_initial_metadata =
         Arena::MakePooledForOverwrite<ClientMetadata>();
@@ -57,6 +97,15 @@ class RetryInterceptorTest : public YodelTest {
       ClientMetadataHandle client_initial_metadata) {
     auto arena = call_arena_allocator_->MakeArena();
     arena->SetContext<EventEngine>(event_engine().get());
+    if (service_config_ != nullptr) {
+      auto* service_config_call_data =
+          arena->ManagedNew<ServiceConfigCallData>(arena.get());
+      service_config_call_data->SetServiceConfig(
+          service_config_, service_config_->GetMethodParsedConfigVector(
+                               client_initial_metadata->get_pointer(
+                                       HttpPathMetadata())
+                                   ->c_slice()));
+    }
     return MakeCallPair(std::move(client_initial_metadata), std::move(arena));
   }
 
@@ -69,6 +118,10 @@ class RetryInterceptorTest : public YodelTest {
     return TickUntil(absl::FunctionRef<Poll<CallHandler>()>(poll));
   }
 
+  // Returns true if no attempt was started since the last
+  // TickUntilCallStarted().
+  bool NoCallStarted() { return !call_destination_->PopHandler().has_value(); }
+
   UnstartedCallDestination& destination_under_test() {
     CHECK(destination_under_test_ != nullptr);
     return *destination_under_test_;
@@ -97,6 +150,7 @@ class RetryInterceptorTest : public YodelTest {
   void InitCoreConfiguration() override {}
 
   void Shutdown() override {
+    service_config_.reset();
     call_destination_.reset();
     destination_under_test_.reset();
     call_arena_allocator_.reset();
@@ -105,6 +159,7 @@ class RetryInterceptorTest : public YodelTest {
   RefCountedPtr<TestCallDestination> call_destination_ =
       MakeRefCounted<TestCallDestination>();
   RefCountedPtr<UnstartedCallDestination> destination_under_test_;
+  RefCountedPtr<ServiceConfig> service_config_;
   RefCountedPtr<CallArenaAllocator> call_arena_allocator_ =
       MakeRefCounted<CallArenaAllocator>(
           ResourceQuota::Default()->memory_quota()->CreateMemoryAllocator(
@@ -145,6 +200,124 @@ RETRY_INTERCEPTOR_TEST(StartCall) {
   WaitForAllPendingWork();
 }
 
+RETRY_INTERCEPTOR_TEST(HedgingFirstResponseWins) {
+  SetServiceConfig(HedgingServiceConfig(3, "1s"));
+  InitInterceptor(ChannelArgs());
+  auto call = MakeCall(MakeClientInitialMetadata());
+  SpawnTestSeq(
+      call.initiator, "initiator",
+      [this, handler = std::move(call.handler)]() {
+        destination_under_test().StartCall(handler);
+      },
+      [initiator = call.initiator]() mutable {
+        initiator.FinishSends();
+        return initiator.PullServerInitialMetadata();
+      },
+      [initiator = call.initiator](
+          ValueOrFailure<std::optional<ServerMetadataHandle>> md) mutable {
+        EXPECT_TRUE(md.ok());
+        EXPECT_TRUE(md.value().has_value());
+        return initiator.PullServerTrailingMetadata();
+      },
+      [](ValueOrFailure<ServerMetadataHandle> md) {
+        EXPECT_TRUE(md.ok());
+        EXPECT_EQ(md.value()->get(GrpcStatusMetadata()), GRPC_STATUS_OK);
+      });
+  auto first = TickUntilCallStarted();
+  const Timestamp first_started = Timestamp::Now();
+  // The second attempt is sent once the hedging delay passes without a
+  // response to the first.
+  auto second = TickUntilCallStarted();
+  EXPECT_GE(Timestamp::Now() - first_started, Duration::Seconds(1));
+  SpawnTestSeq(
+      first, "first", [first]() mutable { return first.WasCancelled(); },
+      [](bool cancelled) { EXPECT_TRUE(cancelled); });
+  SpawnTestSeq(
+      second, "second",
+      [second]() mutable { return second.PullClientInitialMetadata(); },
+      [second](ValueOrFailure<ClientMetadataHandle> md) mutable {
+        EXPECT_TRUE(md.ok());
+        EXPECT_EQ(md.value()->get(GrpcPreviousRpcAttemptsMetadata()), 1u);
+        EXPECT_TRUE(
+            second
+                .PushServerInitialMetadata(
+                    Arena::MakePooledForOverwrite<ServerMetadata>())
+                .ok());
+        second.PushServerTrailingMetadata(
+            MakeServerTrailingMetadata(GRPC_STATUS_OK));
+      });
+  WaitForAllPendingWork();
+  // Once committed to the second attempt, the call sends no third.
+  EXPECT_TRUE(NoCallStarted());
+}
+
+RETRY_INTERCEPTOR_TEST(HedgingNonFatalFailureSendsNextAttempt) {
+  SetServiceConfig(HedgingServiceConfig(3, "100s"));
+  InitInterceptor(ChannelArgs());
+  auto call = MakeCall(MakeClientInitialMetadata());
+  SpawnTestSeq(
+      call.initiator, "initiator",
+      [this, handler = std::move(call.handler)]() {
+        destination_under_test().StartCall(handler);
+      },
+      [initiator = call.initiator]() mutable {
+        initiator.FinishSends();
+        return initiator.PullServerTrailingMetadata();
+      },
+      [](ValueOrFailure<ServerMetadataHandle> md) {
+        EXPECT_TRUE(md.ok());
+        EXPECT_EQ(md.value()->get(GrpcStatusMetadata()), GRPC_STATUS_OK);
+      });
+  auto first = TickUntilCallStarted();
+  SpawnTestSeq(first, "first", [first]() mutable {
+    first.PushServerTrailingMetadata(
+        MakeServerTrailingMetadata(GRPC_STATUS_UNAVAILABLE));
+  });
+  const Timestamp first_failed = Timestamp::Now();
+  // A non-fatal failure sends the next attempt without waiting for the
+  // hedging delay.
+  auto second = TickUntilCallStarted();
+  EXPECT_LT(Timestamp::Now() - first_failed, Duration::Seconds(100));
+  SpawnTestSeq(second, "second", [second]() mutable {
+    second.PushServerTrailingMetadata(
+        MakeServerTrailingMetadata(GRPC_STATUS_OK));
+  });
+  WaitForAllPendingWork();
+}
+
+RETRY_INTERCEPTOR_TEST(HedgingFatalFailureEndsCall) {
+  SetServiceConfig(HedgingServiceConfig(3, "1s"));
+  InitInterceptor(ChannelArgs());
+  auto call = MakeCall(MakeClientInitialMetadata());
+  SpawnTestSeq(
+      call.initiator, "initiator",
+      [this, handler = std::move(call.handler)]() {
+        destination_under_test().StartCall(handler);
+      },
+      [initiator = call.initiator]() mutable {
+        initiator.FinishSends();
+        return initiator.PullServerTrailingMetadata();
+      },
+      [](ValueOrFailure<ServerMetadataHandle> md) {
+        EXPECT_TRUE(md.ok());
+        EXPECT_EQ(md.value()->get(GrpcStatusMetadata()),
+                  GRPC_STATUS_INVALID_ARGUMENT);
+      });
+  auto first = TickUntilCallStarted();
+  auto second = TickUntilCallStarted();
+  // A fatal status from either attempt is the result of the call, and the
+  // other attempt is cancelled.
+  SpawnTestSeq(
+      first, "first", [first]() mutable { return first.WasCancelled(); },
+      [](bool cancelled) { EXPECT_TRUE(cancelled); });
+  SpawnTestSeq(second, "second", [second]() mutable {
+    second.PushServerTrailingMetadata(
+        MakeServerTrailingMetadata(GRPC_STATUS_INVALID_ARGUMENT));
+  });
+  WaitForAllPendingWork();
+  EXPECT_TRUE(NoCallStarted());
+}
+
 // TODO(roth, ctiller): more tests
 
 }  // namespace grpc_core
@@ -16,6 +16,7 @@
 
 #include <sys/types.h>
 
+#include <algorithm>
 #include <cstdint>
 #include <memory>
 #include <string>
@@ -384,6 +385,119 @@ FUZZ_TEST(MyTestSuite, NeverExceedMaxBackoff)
     .WithDomains(AnyRetryMethodConfig(), VectorOf(AnyServerMetadata()),
                  AnyServerThrottleData());
 
+// Construct a hedging policy from json text
+internal::HedgingPolicy MakeHedgingPolicy(absl::string_view json) {
+  auto json_obj = JsonParse(json);
+  CHECK_OK(json_obj) << json;
+  auto obj = LoadFromJson<internal::HedgingPolicy>(*json_obj);
+  CHECK_OK(obj) << json;
+  return std::move(*obj);
+}
+
+// Domain including valid hedging policies that treat UNAVAILABLE as non-fatal
+auto AnyHedgingPolicy() {
+  return fuzztest::Map(
+      [](uint32_t max_attempts, uint32_t hedging_delay) {
+        return MakeHedgingPolicy(absl::StrCat(
+            "{\"maxAttempts\":", max_attempts, ",\"hedgingDelay\":\"",
+            Duration::Milliseconds(hedging_delay).ToJsonString(),
+            "\",\"nonFatalStatusCodes\":[\"UNAVAILABLE\"]}"));
+      },
+      InRange(2, 5), InRange(0, 100000));
+}
+
+void HedgingNeverExceedsMaxAttempts(
+    internal::HedgingPolicy policy,
+    RefCountedPtr<internal::ServerRetryThrottleData> throttle_data) {
+  HedgingState hedging_state(&policy, throttle_data, nullptr);
+  std::ignore = absl::StrCat(hedging_state);
+  // The first attempt is always started.
+  EXPECT_TRUE(hedging_state.StartAttempt(FuzzerDebugTag));
+  while (hedging_state.StartAttempt(FuzzerDebugTag)) {
+  }
+  EXPECT_LE(hedging_state.num_attempts_started(), policy.max_attempts());
+  EXPECT_FALSE(hedging_state.StartAttempt(FuzzerDebugTag));
+}
+FUZZ_TEST(MyTestSuite, HedgingNeverExceedsMaxAttempts)
+    .WithDomains(AnyHedgingPolicy(), AnyServerThrottleData());
+
+void HedgingCommitsToFatalStatus(
+    internal::HedgingPolicy policy, ServerMetadataHandle md,
+    RefCountedPtr<internal::ServerRetryThrottleData> throttle_data) {
+  HedgingState hedging_state(&policy, throttle_data, nullptr);
+  ASSERT_TRUE(hedging_state.StartAttempt(FuzzerDebugTag));
+  EXPECT_EQ(hedging_state.OnAttemptFailed(*md, FuzzerDebugTag), std::nullopt);
+}
+FUZZ_TEST(MyTestSuite, HedgingCommitsToFatalStatus)
+    .WithDomains(AnyHedgingPolicy(),
+                 ServerMetadataWithStatus(AnyStatusExcept(
+                     GRPC_STATUS_UNAVAILABLE)),
+                 AnyServerThrottleData());
+
+void HedgingStopsOnNegativePushback(internal::HedgingPolicy policy,
+                                    Duration pushback) {
+  HedgingState hedging_state(&policy, nullptr, nullptr);
+  ASSERT_TRUE(hedging_state.StartAttempt(FuzzerDebugTag));
+  auto md = Arena::MakePooled<ServerMetadata>();
+  md->Set(GrpcStatusMetadata(), GRPC_STATUS_UNAVAILABLE);
+  md->Set(GrpcRetryPushbackMsMetadata(), pushback);
+  EXPECT_EQ(hedging_state.OnAttemptFailed(*md, FuzzerDebugTag),
+            Duration::Zero());
+  EXPECT_FALSE(hedging_state.attempts_remaining());
+  EXPECT_FALSE(hedging_state.StartAttempt(FuzzerDebugTag));
+}
+FUZZ_TEST(MyTestSuite, HedgingStopsOnNegativePushback)
+    .WithDomains(AnyHedgingPolicy(), NegativeDuration());
+
+void LatencySketchPercentileIsCloseToExact(std::vector<uint32_t> millis,
+                                           double p) {
+  LatencySketch sketch;
+  for (uint32_t m : millis) sketch.Add(Duration::Milliseconds(m));
+  std::sort(millis.begin(), millis.end());
+  const uint32_t exact =
+      millis[std::min<size_t>(millis.size() - 1,
+                              static_cast<size_t>(p * millis.size()))];
+  const Duration estimate = sketch.Percentile(p);
+  // Buckets are about 19% wide, and estimates are rounded up.
+  EXPECT_GE(estimate, Duration::Milliseconds(exact) * 0.8) << exact;
+  EXPECT_LE(estimate, Duration::Milliseconds(exact) * 1.2 +
+                          Duration::Milliseconds(1))
+      << exact;
+}
+FUZZ_TEST(MyTestSuite, LatencySketchPercentileIsCloseToExact)
+    .WithDomains(VectorOf(InRange<uint32_t>(0, 100000))
+                     .WithMinSize(1)
+                     .WithMaxSize(1000),
+                 InRange(0.5, 0.99));
+
+void AdaptiveHedgingNeverExceedsCap(internal::HedgingPolicy policy,
+                                    uint32_t num_calls, int max_percent) {
+  auto method_stats =
+      MakeRefCounted<HedgingMethodStats>(max_percent / 100.0);
+  int hedged_attempts = 0;
+  for (uint32_t i = 0; i < num_calls; ++i) {
+    HedgingState hedging_state(&policy, nullptr, method_stats);
+    ASSERT_TRUE(hedging_state.StartAttempt(FuzzerDebugTag));
+    while (hedging_state.StartAttempt(FuzzerDebugTag)) ++hedged_attempts;
+  }
+  EXPECT_LE(hedged_attempts, num_calls * max_percent / 100.0);
+}
+FUZZ_TEST(MyTestSuite, AdaptiveHedgingNeverExceedsCap)
+    .WithDomains(AnyHedgingPolicy(), InRange<uint32_t>(0, 1000),
+                 InRange(0, 100));
+
+TEST(HedgingMethodStatsTest, HedgingDelayFollowsObservedLatency) {
+  auto method_stats = MakeRefCounted<HedgingMethodStats>(0.1);
+  const Duration configured_delay = Duration::Seconds(1);
+  EXPECT_EQ(method_stats->HedgingDelay(configured_delay), configured_delay);
+  for (uint32_t i = 0; i < HedgingMethodStats::kMinSamples; ++i) {
+    method_stats->RecordLatency(Duration::Milliseconds(i < 96 ? 10 : 500));
+  }
+  const Duration delay = method_stats->HedgingDelay(configured_delay);
+  EXPECT_GE(delay, Duration::Milliseconds(10));
+  EXPECT_LE(delay, Duration::Milliseconds(12));
+}
+
 }  // namespace
 }  // namespace retry_detail
 }  // namespace grpc_core
@@ -64,6 +64,24 @@ TEST(ServerRetryThrottleData, Basic) {
   EXPECT_TRUE(throttle_data->RecordFailure());
 }
 
+TEST(ServerRetryThrottleData, RetryAllowed) {
+  // Max token count is 4, so threshold for retrying is 2.
+  auto throttle_data =
+      MakeRefCounted<ServerRetryThrottleData>(4000, 1000, 4000);
+  EXPECT_TRUE(throttle_data->RetryAllowed());
+  // Checking does not consume tokens.
+  EXPECT_TRUE(throttle_data->RetryAllowed());
+  // Failure: token_count=3.  Above threshold.
+  EXPECT_TRUE(throttle_data->RecordFailure());
+  EXPECT_TRUE(throttle_data->RetryAllowed());
+  // Failure: token_count=2.  At threshold, so no retries.
+  EXPECT_FALSE(throttle_data->RecordFailure());
+  EXPECT_FALSE(throttle_data->RetryAllowed());
+  // Success: token_count=3.  Above threshold.
+  throttle_data->RecordSuccess();
+  EXPECT_TRUE(throttle_data->RetryAllowed());
+}
+
 TEST(ServerRetryThrottleMap, Replacement) {
   const std::string kServerName = "server_name";
   // Create old throttle data.
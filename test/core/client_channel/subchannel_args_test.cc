@@ -77,6 +77,32 @@ TEST(MakeSubchannelArgs, StripsOutNoSubchannelArgs) {
   EXPECT_EQ(args.GetString(GRPC_ARG_NO_SUBCHANNEL_PREFIX "bar"), std::nullopt);
 }
 
+TEST(MakeSubchannelKeyArgs, KeepsAllArgsByDefault) {
+  ChannelArgs args = ChannelArgs()
+                         .Set(GRPC_ARG_PRIMARY_USER_AGENT_STRING, "tenant-a")
+                         .Set(GRPC_ARG_ENABLE_RETRIES, false);
+  EXPECT_EQ(Subchannel::MakeSubchannelKeyArgs(args), args);
+}
+
+TEST(MakeSubchannelKeyArgs, NormalizesChannelOnlyArgsWhenSharing) {
+  ChannelArgs base =
+      ChannelArgs()
+          .Set(GRPC_ARG_SHARE_SUBCHANNELS_ACROSS_CHANNEL_ARGS, true)
+          .Set(GRPC_ARG_DEFAULT_AUTHORITY, "foo.example.com");
+  ChannelArgs a = Subchannel::MakeSubchannelKeyArgs(
+      base.Set(GRPC_ARG_PRIMARY_USER_AGENT_STRING, "tenant-a")
+          .Set(GRPC_ARG_SERVICE_CONFIG, "{}"));
+  ChannelArgs b = Subchannel::MakeSubchannelKeyArgs(
+      base.Set(GRPC_ARG_PRIMARY_USER_AGENT_STRING, "tenant-b")
+          .Set(GRPC_ARG_ENABLE_RETRIES, false));
+  EXPECT_EQ(a, b);
+  EXPECT_EQ(a.GetString(GRPC_ARG_DEFAULT_AUTHORITY), "foo.example.com");
+  // Args that shape the connection still keep subchannels apart.
+  EXPECT_NE(Subchannel::MakeSubchannelKeyArgs(
+                base.Set(GRPC_ARG_KEEPALIVE_TIME_MS, 1000)),
+            Subchannel::MakeSubchannelKeyArgs(base));
+}
+
 }  // namespace
 }  // namespace testing
 }  // namespace grpc_core
@@ -0,0 +1,131 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/filters/channel_idle/goaway_pacer.h"
+
+#include <grpc/grpc.h>
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include "absl/strings/str_cat.h"
+#include "absl/synchronization/notification.h"
+#include "gtest/gtest.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/util/sync.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+constexpr Duration kInterval = Duration::Milliseconds(100);
+
+class GoawayPacerTest : public ::testing::Test {
+ protected:
+  GoawayPacer::Ticket Enqueue(std::string name, bool idle,
+                              absl::Notification* done = nullptr) {
+    return pacer_.Enqueue(
+        kInterval, [idle] { return idle; },
+        [this, name = std::move(name), done] {
+          {
+            MutexLock lock(&mu_);
+            turns_.push_back(name);
+          }
+          if (done != nullptr) done->Notify();
+        });
+  }
+
+  std::vector<std::string> Turns() {
+    MutexLock lock(&mu_);
+    return turns_;
+  }
+
+  GoawayPacer pacer_{grpc_event_engine::experimental::GetDefaultEventEngine()};
+  Mutex mu_;
+  std::vector<std::string> turns_ ABSL_GUARDED_BY(mu_);
+};
+
+TEST_F(GoawayPacerTest, FirstConnectionGoesRightAway) {
+  auto ticket = Enqueue("a", /*idle=*/false);
+  EXPECT_EQ(Turns(), std::vector<std::string>({"a"}));
+}
+
+TEST_F(GoawayPacerTest, PacesConnections) {
+  absl::Notification done;
+  const Timestamp start = Timestamp::Now();
+  auto a = Enqueue("a", /*idle=*/false);
+  auto b = Enqueue("b", /*idle=*/false);
+  auto c = Enqueue("c", /*idle=*/false, &done);
+  EXPECT_EQ(Turns(), std::vector<std::string>({"a"}));
+  done.WaitForNotification();
+  EXPECT_GE(Timestamp::Now() - start, kInterval * 2);
+  EXPECT_EQ(Turns(), std::vector<std::string>({"a", "b", "c"}));
+}
+
+TEST_F(GoawayPacerTest, IdleConnectionsGoFirst) {
+  absl::Notification done;
+  auto a = Enqueue("a", /*idle=*/false);
+  auto b = Enqueue("b", /*idle=*/false, &done);
+  auto c = Enqueue("c", /*idle=*/true);
+  done.WaitForNotification();
+  EXPECT_EQ(Turns(), std::vector<std::string>({"a", "c", "b"}));
+}
+
+TEST_F(GoawayPacerTest, DestroyedTicketGivesUpItsTurn) {
+  absl::Notification done;
+  auto a = Enqueue("a", /*idle=*/false);
+  {
+    auto b = Enqueue("b", /*idle=*/false);
+  }
+  auto c = Enqueue("c", /*idle=*/false, &done);
+  done.WaitForNotification();
+  EXPECT_EQ(Turns(), std::vector<std::string>({"a", "c"}));
+}
+
+TEST_F(GoawayPacerTest, BusyConnectionIsNotPassedOverForever) {
+  absl::Notification done;
+  auto a = Enqueue("a", /*idle=*/false);
+  auto b = Enqueue("b", /*idle=*/false);
+  std::vector<GoawayPacer::Ticket> idle;
+  for (int i = 0; i <= GoawayPacer::kMaxTurnsPassedOver; ++i) {
+    idle.push_back(Enqueue(absl::StrCat("c", i), /*idle=*/true,
+                           i == GoawayPacer::kMaxTurnsPassedOver ? &done
+                                                                 : nullptr));
+  }
+  done.WaitForNotification();
+  EXPECT_EQ(Turns(),
+            std::vector<std::string>({"a", "c0", "c1", "c2", "b", "c3"}));
+}
+
+TEST_F(GoawayPacerTest, MoveAssignedTicketGivesUpItsTurn) {
+  absl::Notification done;
+  auto a = Enqueue("a", /*idle=*/false);
+  auto b = Enqueue("b", /*idle=*/false);
+  b = Enqueue("c", /*idle=*/false, &done);
+  done.WaitForNotification();
+  EXPECT_EQ(Turns(), std::vector<std::string>({"a", "c"}));
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc_init();
+  int ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
+}
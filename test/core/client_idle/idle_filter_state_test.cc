@@ -17,6 +17,7 @@
 #include <chrono>
 #include <random>
 #include <thread>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -25,8 +26,15 @@
 namespace grpc_core {
 namespace testing {
 
-TEST(IdleFilterStateTest, IdlenessStartsTimer) {
-  IdleFilterState s(false);
+template <typename State>
+class IdleFilterStateTest : public ::testing::Test {};
+
+using IdleFilterStates =
+    ::testing::Types<IdleFilterState, ShardedIdleFilterState>;
+TYPED_TEST_SUITE(IdleFilterStateTest, IdleFilterStates);
+
+TYPED_TEST(IdleFilterStateTest, IdlenessStartsTimer) {
+  TypeParam s(false);
   s.IncreaseCallCount();
   // First idle should start the timer
   EXPECT_TRUE(s.DecreaseCallCount());
@@ -37,13 +45,13 @@ TEST(IdleFilterStateTest, IdlenessStartsTimer) {
   }
 }
 
-TEST(IdleFilterStateTest, TimerStopsAfterIdle) {
-  IdleFilterState s(true);
+TYPED_TEST(IdleFilterStateTest, TimerStopsAfterIdle) {
+  TypeParam s(true);
   EXPECT_FALSE(s.CheckTimer());
 }
 
-TEST(IdleFilterStateTest, TimerKeepsGoingWithActivity) {
-  IdleFilterState s(true);
+TYPED_TEST(IdleFilterStateTest, TimerKeepsGoingWithActivity) {
+  TypeParam s(true);
   for (int i = 0; i < 10; i++) {
     s.IncreaseCallCount();
     (void)s.DecreaseCallCount();
@@ -52,8 +60,25 @@ TEST(IdleFilterStateTest, TimerKeepsGoingWithActivity) {
   EXPECT_FALSE(s.CheckTimer());
 }
 
-TEST(IdleFilterStateTest, StressTest) {
-  IdleFilterState s(false);
+TEST(ShardedIdleFilterStateTest, TimerKeepsGoingWithCallsInProgress) {
+  ShardedIdleFilterState s(false);
+  s.IncreaseCallCount();
+  s.IncreaseCallCount();
+  // The first call to finish starts the timer, even with another in progress.
+  EXPECT_TRUE(s.DecreaseCallCount());
+  EXPECT_FALSE(s.IsIdle());
+  EXPECT_TRUE(s.CheckTimer());
+  EXPECT_TRUE(s.CheckTimer());
+  EXPECT_FALSE(s.DecreaseCallCount());
+  EXPECT_TRUE(s.IsIdle());
+  EXPECT_FALSE(s.CheckTimer());
+  // With the timer stopped, the next call to finish starts it again.
+  s.IncreaseCallCount();
+  EXPECT_TRUE(s.DecreaseCallCount());
+}
+
+TYPED_TEST(IdleFilterStateTest, StressTest) {
+  TypeParam s(false);
   std::atomic<bool> done{false};
   int idle_polls = 0;
   int thread_jumps = 0;
@@ -70,7 +95,9 @@ TEST(IdleFilterStateTest, StressTest) {
         if (s.DecreaseCallCount()) {
           thread_jumps++;
           if (thread_jumps == 10) done.store(true, std::memory_order_relaxed);
-          EXPECT_EQ(ctr, 0);
+          // The sharded state starts the timer whenever none is running, not
+          // only when the last call finishes.
+          if (std::is_same_v<TypeParam, IdleFilterState>) EXPECT_EQ(ctr, 0);
           do {
             idle_polls++;
             std::this_thread::sleep_for(std::chrono::milliseconds(10));
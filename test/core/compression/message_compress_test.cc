@@ -25,10 +25,12 @@
 #include <string.h>
 
 #include <memory>
+#include <string>
 
 #include "absl/log/log.h"
 #include "gtest/gtest.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/slice/slice_internal.h"
 #include "src/core/util/useful.h"
 #include "test/core/test_util/slice_splitter.h"
 #include "test/core/test_util/test_config.h"
@@ -300,6 +302,83 @@ TEST(MessageCompressTest, BadDecompressionAlgorithm) {
   grpc_slice_buffer_destroy(&output);
 }
 
+TEST(MessageCompressTest, CompressionLevels) {
+  // Mildly compressible data, large enough to span several output blocks.
+  std::string value;
+  for (int i = 0; value.size() < 1024 * 1024; ++i) {
+    value += std::to_string(i % 4096);
+  }
+  grpc_core::ExecCtx exec_ctx;
+  for (grpc_compression_algorithm algorithm :
+       {GRPC_COMPRESS_DEFLATE, GRPC_COMPRESS_GZIP}) {
+    size_t fastest_size = 0;
+    // Out-of-range levels fall back to the default.
+    for (int level : {1, 6, 9, -1, 42}) {
+      grpc_slice_buffer input;
+      grpc_slice_buffer compressed;
+      grpc_slice_buffer output;
+      grpc_slice_buffer_init(&input);
+      grpc_slice_buffer_init(&compressed);
+      grpc_slice_buffer_init(&output);
+      grpc_slice_buffer_add(&input,
+                            grpc_slice_from_copied_buffer(value.data(),
+                                                          value.size()));
+      ASSERT_EQ(grpc_msg_compress_with_level(algorithm, level, &input,
+                                             &compressed),
+                1)
+          << level;
+      if (level == 1) {
+        fastest_size = compressed.length;
+      } else {
+        EXPECT_LE(compressed.length, fastest_size) << level;
+      }
+      ASSERT_EQ(grpc_msg_decompress(algorithm, &compressed, &output), 1);
+      grpc_slice round_trip = grpc_slice_merge(output.slices, output.count);
+      EXPECT_EQ(grpc_core::StringViewFromSlice(round_trip), value) << level;
+      grpc_slice_unref(round_trip);
+      grpc_slice_buffer_destroy(&input);
+      grpc_slice_buffer_destroy(&compressed);
+      grpc_slice_buffer_destroy(&output);
+    }
+  }
+}
+
+TEST(MessageCompressTest, BackToBackMessages) {
+  // Streams may be reused between messages, so a failed or abandoned
+  // message, or a change of algorithm or level, must not leak into the
+  // next one.
+  grpc_core::ExecCtx exec_ctx;
+  const std::string value(4096, 'x');
+  for (int i = 0; i < 6; ++i) {
+    const grpc_compression_algorithm algorithm =
+        i % 2 == 0 ? GRPC_COMPRESS_GZIP : GRPC_COMPRESS_DEFLATE;
+    grpc_slice_buffer garbage;
+    grpc_slice_buffer input;
+    grpc_slice_buffer compressed;
+    grpc_slice_buffer output;
+    grpc_slice_buffer_init(&garbage);
+    grpc_slice_buffer_init(&input);
+    grpc_slice_buffer_init(&compressed);
+    grpc_slice_buffer_init(&output);
+    grpc_slice_buffer_add(&garbage,
+                          grpc_slice_from_copied_string("definitely not zlib"));
+    EXPECT_EQ(grpc_msg_decompress(algorithm, &garbage, &output), 0);
+    grpc_slice_buffer_add(
+        &input, grpc_slice_from_copied_buffer(value.data(), value.size()));
+    ASSERT_EQ(grpc_msg_compress_with_level(algorithm, i < 3 ? 1 : 9, &input,
+                                           &compressed),
+              1);
+    ASSERT_EQ(grpc_msg_decompress(algorithm, &compressed, &output), 1);
+    grpc_slice round_trip = grpc_slice_merge(output.slices, output.count);
+    EXPECT_EQ(grpc_core::StringViewFromSlice(round_trip), value);
+    grpc_slice_unref(round_trip);
+    grpc_slice_buffer_destroy(&garbage);
+    grpc_slice_buffer_destroy(&input);
+    grpc_slice_buffer_destroy(&compressed);
+    grpc_slice_buffer_destroy(&output);
+  }
+}
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(&argc, argv);
   ::testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,278 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/credentials/call/token_fetcher/token_fetcher_credentials.h"
+
+#include <grpc/grpc.h>
+
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "absl/log/check.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+#include "gtest/gtest.h"
+#include "src/core/call/metadata_batch.h"
+#include "src/core/lib/experiments/config.h"
+#include "src/core/lib/experiments/experiments.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/iomgr/timer_manager.h"
+#include "src/core/lib/promise/activity.h"
+#include "src/core/lib/promise/exec_ctx_wakeup_scheduler.h"
+#include "src/core/lib/promise/seq.h"
+#include "src/core/lib/resource_quota/arena.h"
+#include "src/core/util/time.h"
+#include "src/core/util/unique_type_name.h"
+#include "src/core/util/wait_for_single_owner.h"
+#include "test/core/event_engine/event_engine_test_utils.h"
+#include "test/core/event_engine/fuzzing_event_engine/fuzzing_event_engine.h"
+#include "test/core/test_util/test_config.h"
+
+// Covers the token_fetcher_proactive_refresh and token_fetcher_shared_cache
+// experiments, which main() enables for every test in this binary.
+
+namespace grpc_core {
+namespace {
+
+using grpc_event_engine::experimental::FuzzingEventEngine;
+
+class TestTokenFetcherCredentials final : public TokenFetcherCredentials {
+ public:
+  TestTokenFetcherCredentials(
+      std::shared_ptr<grpc_event_engine::experimental::EventEngine>
+          event_engine,
+      std::optional<std::string> token_cache_key = std::nullopt)
+      : TokenFetcherCredentials(std::move(event_engine),
+                                /*test_only_use_backoff_jitter=*/false),
+        token_cache_key_(std::move(token_cache_key)) {}
+
+  ~TestTokenFetcherCredentials() override { CHECK_EQ(queue_.size(), 0); }
+
+  void AddResult(absl::StatusOr<RefCountedPtr<Token>> result) {
+    MutexLock lock(&mu_);
+    queue_.push_front(std::move(result));
+  }
+
+  size_t num_fetches() const { return num_fetches_; }
+
+ private:
+  class TestFetchRequest final : public FetchRequest {
+   public:
+    TestFetchRequest(
+        grpc_event_engine::experimental::EventEngine& event_engine,
+        absl::AnyInvocable<void(absl::StatusOr<RefCountedPtr<Token>>)> on_done,
+        absl::StatusOr<RefCountedPtr<Token>> result) {
+      event_engine.Run([on_done = std::move(on_done),
+                        result = std::move(result)]() mutable {
+        ExecCtx exec_ctx;
+        std::exchange(on_done, nullptr)(std::move(result));
+      });
+    }
+
+    void Orphan() override { Unref(); }
+  };
+
+  std::optional<std::string> TokenCacheKey() const override {
+    return token_cache_key_;
+  }
+
+  OrphanablePtr<FetchRequest> FetchToken(
+      Timestamp /*deadline*/,
+      absl::AnyInvocable<void(absl::StatusOr<RefCountedPtr<Token>>)> on_done)
+      override {
+    absl::StatusOr<RefCountedPtr<Token>> result;
+    {
+      MutexLock lock(&mu_);
+      CHECK(!queue_.empty());
+      result = std::move(queue_.back());
+      queue_.pop_back();
+    }
+    num_fetches_.fetch_add(1);
+    return MakeOrphanable<TestFetchRequest>(
+        event_engine(), std::move(on_done), std::move(result));
+  }
+
+  std::string debug_string() override { return "TestTokenFetcherCredentials"; }
+
+  UniqueTypeName type() const override {
+    static UniqueTypeName::Factory kFactory("TestTokenFetcherCredentials");
+    return kFactory.Create();
+  }
+
+  const std::optional<std::string> token_cache_key_;
+  Mutex mu_;
+  std::deque<absl::StatusOr<RefCountedPtr<Token>>> queue_
+      ABSL_GUARDED_BY(&mu_);
+  std::atomic<size_t> num_fetches_{0};
+};
+
+class TokenFetcherCredentialsTest : public ::testing::Test {
+ protected:
+  // The result of one GetRequestMetadata call.
+  struct Result {
+    std::optional<absl::Status> status;
+    std::string authorization;
+    bool delayed = false;
+  };
+
+  void SetUp() override {
+    event_engine_ = std::make_shared<FuzzingEventEngine>(
+        FuzzingEventEngine::Options(), fuzzing_event_engine::Actions());
+    grpc_timer_manager_set_start_threaded(false);
+    grpc_init();
+  }
+
+  void TearDown() override {
+    event_engine_->FuzzingDone();
+    event_engine_->TickUntilIdle();
+    event_engine_->UnsetGlobalHooks();
+    activities_.clear();
+    WaitForSingleOwner(std::move(event_engine_));
+    grpc_shutdown_blocking();
+  }
+
+  static RefCountedPtr<TokenFetcherCredentials::Token> MakeToken(
+      absl::string_view token, Timestamp expiration = Timestamp::InfFuture()) {
+    return MakeRefCounted<TokenFetcherCredentials::Token>(
+        Slice::FromCopiedString(token), expiration);
+  }
+
+  // Starts a GetRequestMetadata call on creds. The result is filled in once
+  // the call completes, which may need the event engine to run.
+  std::shared_ptr<Result> GetRequestMetadata(TokenFetcherCredentials* creds) {
+    auto result = std::make_shared<Result>();
+    auto md = std::make_shared<grpc_metadata_batch>();
+    activities_.push_back(MakeActivity(
+        [creds, md, result, this] {
+          return Seq(
+              CheckDelayed(creds->GetRequestMetadata(
+                  ClientMetadataHandle(md.get(), Arena::PooledDeleter(nullptr)),
+                  &args_)),
+              [md, result](std::tuple<absl::StatusOr<ClientMetadataHandle>,
+                                      bool>
+                               metadata_and_delayed) {
+                auto& metadata = std::get<0>(metadata_and_delayed);
+                result->delayed = std::get<1>(metadata_and_delayed);
+                if (metadata.ok()) {
+                  std::string buffer;
+                  result->authorization = std::string(
+                      md->GetStringValue("authorization", &buffer)
+                          .value_or(""));
+                }
+                return metadata.status();
+              });
+        },
+        ExecCtxWakeupScheduler(),
+        [result](absl::Status status) { result->status = std::move(status); },
+        arena_.get()));
+    return result;
+  }
+
+  std::shared_ptr<FuzzingEventEngine> event_engine_;
+  RefCountedPtr<Arena> arena_ = SimpleArenaAllocator()->MakeArena();
+  grpc_call_credentials::GetRequestMetadataArgs args_;
+  std::vector<ActivityPtr> activities_;
+};
+
+TEST_F(TokenFetcherCredentialsTest, RefreshesTokenAheadOfExpiration) {
+  ASSERT_TRUE(IsTokenFetcherProactiveRefreshEnabled());
+  ExecCtx exec_ctx;
+  auto creds = MakeRefCounted<TestTokenFetcherCredentials>(event_engine_);
+  creds->AddResult(MakeToken("foo", Timestamp::Now() + Duration::Hours(1)));
+  creds->AddResult(MakeToken("bar"));
+  // First request will trigger a fetch.
+  auto result = GetRequestMetadata(creds.get());
+  ExecCtx::Get()->Flush();
+  EXPECT_EQ(creds->num_fetches(), 1);
+  // Since a call used the token, it is refreshed five minutes before it
+  // expires without any call asking for it.
+  event_engine_->TickUntilIdle();
+  ASSERT_TRUE(result->status.has_value());
+  EXPECT_TRUE(result->status->ok()) << *result->status;
+  EXPECT_TRUE(result->delayed);
+  EXPECT_EQ(result->authorization, "foo");
+  EXPECT_EQ(creds->num_fetches(), 2);
+  result = GetRequestMetadata(creds.get());
+  ExecCtx::Get()->Flush();
+  ASSERT_TRUE(result->status.has_value());
+  EXPECT_FALSE(result->delayed);
+  EXPECT_EQ(result->authorization, "bar");
+  EXPECT_EQ(creds->num_fetches(), 2);
+}
+
+TEST_F(TokenFetcherCredentialsTest, DoesNotRefreshUnusedToken) {
+  ASSERT_TRUE(IsTokenFetcherProactiveRefreshEnabled());
+  ExecCtx exec_ctx;
+  auto creds = MakeRefCounted<TestTokenFetcherCredentials>(event_engine_);
+  creds->AddResult(MakeToken("foo", Timestamp::Now() + Duration::Hours(1)));
+  creds->AddResult(MakeToken("bar", Timestamp::Now() + Duration::Hours(3)));
+  auto result = GetRequestMetadata(creds.get());
+  // The call waiting for "foo" used it, so "bar" is fetched ahead of foo's
+  // expiration. No call uses "bar", so its refresh timer does not fetch
+  // again; a third fetch would find no result queued.
+  event_engine_->TickUntilIdle();
+  ASSERT_TRUE(result->status.has_value());
+  EXPECT_EQ(result->authorization, "foo");
+  EXPECT_EQ(creds->num_fetches(), 2);
+}
+
+TEST_F(TokenFetcherCredentialsTest, SharesTokensWithSameCacheKey) {
+  ASSERT_TRUE(IsTokenFetcherSharedCacheEnabled());
+  constexpr absl::string_view kCacheKey = "SharesTokensWithSameCacheKey";
+  ExecCtx exec_ctx;
+  auto creds1 = MakeRefCounted<TestTokenFetcherCredentials>(
+      event_engine_, std::string(kCacheKey));
+  auto creds2 = MakeRefCounted<TestTokenFetcherCredentials>(
+      event_engine_, std::string(kCacheKey));
+  auto creds3 = MakeRefCounted<TestTokenFetcherCredentials>(event_engine_);
+  creds1->AddResult(MakeToken("foo"));
+  auto result = GetRequestMetadata(creds1.get());
+  event_engine_->TickUntilIdle();
+  ASSERT_TRUE(result->status.has_value());
+  EXPECT_TRUE(result->delayed);
+  EXPECT_EQ(result->authorization, "foo");
+  EXPECT_EQ(creds1->num_fetches(), 1);
+  // The second credentials object uses the token the first one fetched.
+  result = GetRequestMetadata(creds2.get());
+  event_engine_->TickUntilIdle();
+  ASSERT_TRUE(result->status.has_value());
+  EXPECT_EQ(result->authorization, "foo");
+  EXPECT_EQ(creds2->num_fetches(), 0);
+  // Credentials without a cache key still fetch their own token.
+  creds3->AddResult(MakeToken("bar"));
+  result = GetRequestMetadata(creds3.get());
+  event_engine_->TickUntilIdle();
+  ASSERT_TRUE(result->status.has_value());
+  EXPECT_TRUE(result->delayed);
+  EXPECT_EQ(result->authorization, "bar");
+  EXPECT_EQ(creds3->num_fetches(), 1);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  grpc_core::ForceEnableExperiment("token_fetcher_proactive_refresh", true);
+  grpc_core::ForceEnableExperiment("token_fetcher_shared_cache", true);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
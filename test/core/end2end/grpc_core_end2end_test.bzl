@@ -66,6 +66,7 @@ _DEPS = [
     "//src/core:closure",
     "//src/core:error",
     "//src/core:experiments",
+    "//src/core:goaway_pacer",
     "//src/core:grpc_authorization_base",
     "//src/core:grpc_fake_credentials",
     "//src/core:endpoint_transport",
@@ -372,5 +372,48 @@ CORE_END2END_TEST(Http2FullstackSingleHopTests, StreamStats) {
   EXPECT_LE(server_incoming_transport_stats.framing_bytes, 58);
 }
 
+// This test verifies that the server records how long a call waited for a
+// request from the application.
+CORE_END2END_TEST(Http2FullstackSingleHopTests, ServerQueueDuration) {
+  GlobalStatsPluginRegistryTestPeer::ResetGlobalStatsPluginRegistry();
+  auto stats_plugin = FakeStatsPluginBuilder()
+                          .UseDisabledByDefaultMetrics(true)
+                          .BuildAndRegister();
+  auto handle =
+      GlobalInstrumentsRegistryTestPeer::FindDoubleHistogramHandleByName(
+          "grpc.server.call.queue_duration");
+  ASSERT_TRUE(handle.has_value());
+  const Timestamp start = Timestamp::Now();
+  IncomingStatusOnClient server_status;
+  IncomingMetadata server_initial_metadata;
+  IncomingCloseOnServer client_close;
+  {
+    auto c = NewClientCall("/foo").Timeout(Duration::Minutes(5)).Create();
+    c.NewBatch(1)
+        .SendInitialMetadata({})
+        .SendCloseFromClient()
+        .RecvInitialMetadata(server_initial_metadata)
+        .RecvStatusOnClient(server_status);
+    auto s = RequestCall(101);
+    Expect(101, true);
+    Step(Duration::Minutes(1));
+    s.NewBatch(102)
+        .SendInitialMetadata({})
+        .SendStatusFromServer(GRPC_STATUS_UNIMPLEMENTED, "xyz", {})
+        .RecvCloseOnServer(client_close);
+    Expect(102, true);
+    Expect(1, true);
+    Step(Duration::Minutes(1));
+  }
+  EXPECT_EQ(server_status.status(), GRPC_STATUS_UNIMPLEMENTED);
+  // The call either found the request waiting for it, and recorded zero, or
+  // waited for it for no longer than the test has been running.
+  auto values = stats_plugin->GetDoubleHistogramValue(*handle, {}, {});
+  ASSERT_TRUE(values.has_value());
+  ASSERT_EQ(values->size(), 1u);
+  EXPECT_GE((*values)[0], 0);
+  EXPECT_LE((*values)[0], (Timestamp::Now() - start).seconds());
+}
+
 }  // namespace
 }  // namespace grpc_core
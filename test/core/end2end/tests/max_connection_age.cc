@@ -24,6 +24,7 @@
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
+#include "src/core/ext/filters/channel_idle/goaway_pacer.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/util/time.h"
 #include "test/core/end2end/end2end_tests.h"
@@ -45,6 +46,8 @@
 #define CQ_MAX_CONNECTION_AGE_GRACE_WAIT_TIME_S 2
 // The grace period for the test to observe the channel shutdown process
 #define IMMEDIATE_SHUTDOWN_GRACE_TIME_MS 3000
+// How long the test holds the turn of the GOAWAY pacer
+#define PACED_GOAWAY_TURN_MS 3000
 
 namespace grpc_core {
 namespace {
@@ -170,5 +173,60 @@ CORE_END2END_TEST(Http2Tests, MaxAgeGracefullyClose) {
   }
 }
 
+CORE_END2END_TEST(Http2Tests, MaxAgeGoawayWaitsForItsTurn) {
+  SKIP_IF_MINSTACK();
+  SKIP_IF_FUZZING();
+  // Take the turn of the process-wide pacer, so that the connection has to
+  // wait for the next one before sending its GOAWAY.
+  const Timestamp turn_taken = Timestamp::Now();
+  bool got_turn = false;
+  GoawayPacer::Global().Enqueue(
+      Duration::Milliseconds(PACED_GOAWAY_TURN_MS), [] { return true; },
+      [&got_turn] { got_turn = true; });
+  ASSERT_TRUE(got_turn);
+  InitClient(ChannelArgs());
+  InitServer(ChannelArgs()
+                 .Set(GRPC_ARG_MAX_CONNECTION_AGE_MS, MAX_CONNECTION_AGE_MS)
+                 .Set(GRPC_ARG_MAX_CONNECTION_AGE_GRACE_MS,
+                      MAX_CONNECTION_AGE_GRACE_MS)
+                 .Set(GRPC_ARG_MAX_CONNECTION_IDLE_MS, MAX_CONNECTION_IDLE_MS)
+                 .Set(GRPC_ARG_EXPERIMENTAL_MAX_CONNECTION_AGE_GOAWAY_RATE, 1));
+  auto c = NewClientCall("/foo")
+               .Timeout(Duration::Seconds(CALL_DEADLINE_S))
+               .Create();
+  IncomingMetadata server_initial_metadata;
+  IncomingStatusOnClient server_status;
+  c.NewBatch(1)
+      .SendInitialMetadata({})
+      .SendCloseFromClient()
+      .RecvInitialMetadata(server_initial_metadata)
+      .RecvStatusOnClient(server_status);
+  // The connection cannot send its GOAWAY before the turn is over, so the
+  // request gets through.
+  auto s = RequestCall(101);
+  Expect(101, true);
+  Step();
+  // The call is only cut off once the grace period that follows the paced
+  // GOAWAY is over, well after the max age and grace period alone.
+  Expect(1, true);
+  Step(Duration::Seconds(CALL_DEADLINE_S));
+  EXPECT_GE(Timestamp::Now(),
+            turn_taken + Duration::Milliseconds(PACED_GOAWAY_TURN_MS +
+                                                MAX_CONNECTION_AGE_GRACE_MS));
+  IncomingCloseOnServer client_close;
+  s.NewBatch(102)
+      .SendInitialMetadata({})
+      .SendStatusFromServer(GRPC_STATUS_UNIMPLEMENTED, "xyz", {})
+      .RecvCloseOnServer(client_close);
+  Expect(102, true);
+  Step();
+  EXPECT_TRUE(client_close.was_cancelled());
+  ShutdownServerAndNotify(1000);
+  Expect(1000, true);
+  Step();
+  EXPECT_EQ(server_status.status(), GRPC_STATUS_UNAVAILABLE);
+  EXPECT_EQ(server_status.message(), "max connection age");
+}
+
 }  // namespace
 }  // namespace grpc_core
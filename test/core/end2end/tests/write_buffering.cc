@@ -17,11 +17,13 @@
 //
 
 #include <grpc/grpc.h>
+#include <grpc/impl/channel_arg_names.h>
 #include <grpc/status.h>
 
 #include <memory>
 
 #include "gtest/gtest.h"
+#include "src/core/lib/channel/channel_args.h"
 #include "src/core/util/time.h"
 #include "test/core/end2end/end2end_tests.h"
 
@@ -79,4 +81,37 @@ CORE_END2END_TEST(WriteBufferingTests, WriteBufferingWorks) {
   EXPECT_EQ(request_payload_recv1.payload(), "hello world");
   EXPECT_EQ(request_payload_recv2.payload(), "abc123");
 }
+
+// A buffered message is sent once the flush delay passes, even if no other
+// write follows it.
+CORE_END2END_TEST(WriteBufferingTests, WriteBufferingFlushesAfterDelay) {
+  InitClient(ChannelArgs().Set(GRPC_ARG_HTTP2_WRITE_BUFFER_FLUSH_DELAY_MS, 10));
+  auto c = NewClientCall("/foo").Timeout(Duration::Minutes(1)).Create();
+  c.NewBatch(1).SendInitialMetadata({});
+  auto s = RequestCall(101);
+  Expect(1, true);
+  Expect(101, true);
+  Step();
+  c.NewBatch(2).SendMessage("hello world", GRPC_WRITE_BUFFER_HINT);
+  IncomingMessage request_payload_recv;
+  s.NewBatch(102).RecvMessage(request_payload_recv);
+  Expect(2, true);
+  Expect(102, true);
+  Step();
+
+  IncomingStatusOnClient server_status;
+  c.NewBatch(3).SendCloseFromClient().RecvStatusOnClient(server_status);
+  IncomingCloseOnServer client_close;
+  s.NewBatch(103)
+      .SendInitialMetadata({})
+      .RecvCloseOnServer(client_close)
+      .SendStatusFromServer(GRPC_STATUS_OK, "xyz", {});
+  Expect(103, true);
+  Expect(3, true);
+  Step();
+
+  EXPECT_EQ(server_status.status(), GRPC_STATUS_OK);
+  EXPECT_FALSE(client_close.was_cancelled());
+  EXPECT_EQ(request_payload_recv.payload(), "hello world");
+}
 }  // namespace grpc_core
@@ -55,6 +55,8 @@
 #include "absl/log/log.h"
 #include "absl/status/status.h"
 #include "src/core/lib/event_engine/common_closures.h"
+#include "src/core/lib/event_engine/posix_engine/ev_epoll1_linux.h"
+#include "src/core/lib/event_engine/posix_engine/ev_io_uring_linux.h"
 #include "src/core/lib/event_engine/posix_engine/event_poller.h"
 #include "src/core/lib/event_engine/posix_engine/event_poller_posix_default.h"
 #include "src/core/lib/event_engine/posix_engine/posix_engine.h"
@@ -419,6 +421,53 @@ TEST_F(EventPollerTest, TestEventPollerHandle) {
   EXPECT_EQ(sv.read_bytes_total, cl.write_bytes_total);
 }
 
+// Same as TestEventPollerHandle, but always uses the io_uring poller (which is
+// never picked by the "all" poll strategy) when the kernel supports it.
+TEST_F(EventPollerTest, TestIoUringPollerHandle) {
+  server sv;
+  client cl;
+  int port;
+  std::shared_ptr<PosixEventPoller> poller = MakeIoUringPoller(Scheduler());
+  if (g_event_poller == nullptr || poller == nullptr) {
+    GTEST_SKIP() << "io_uring poller is not supported";
+  }
+  std::swap(g_event_poller, poller);
+  ServerInit(&sv);
+  port = ServerStart(&sv);
+  ClientInit(&cl);
+  ClientStart(&cl, port);
+
+  WaitAndShutdown(&sv, &cl);
+  EXPECT_EQ(sv.read_bytes_total, cl.write_bytes_total);
+  std::swap(g_event_poller, poller);
+  poller->Shutdown();
+}
+
+// Same as TestEventPollerHandle, but with an epoll1 poller that busy polls.
+TEST_F(EventPollerTest, TestBusyPollingEpoll1PollerHandle) {
+  server sv;
+  client cl;
+  int port;
+  grpc_core::ConfigVars::Overrides overrides;
+  overrides.event_engine_poller_busy_poll_us = 50;
+  grpc_core::ConfigVars::SetOverrides(overrides);
+  std::shared_ptr<PosixEventPoller> poller = MakeEpoll1Poller(Scheduler());
+  grpc_core::ConfigVars::SetOverrides(grpc_core::ConfigVars::Overrides());
+  if (g_event_poller == nullptr || poller == nullptr) {
+    GTEST_SKIP() << "epoll1 poller is not supported";
+  }
+  std::swap(g_event_poller, poller);
+  ServerInit(&sv);
+  port = ServerStart(&sv);
+  ClientInit(&cl);
+  ClientStart(&cl, port);
+
+  WaitAndShutdown(&sv, &cl);
+  EXPECT_EQ(sv.read_bytes_total, cl.write_bytes_total);
+  std::swap(g_event_poller, poller);
+  poller->Shutdown();
+}
+
 typedef struct FdChangeData {
   void (*cb_that_ran)(struct FdChangeData*, absl::Status);
 } FdChangeData;
@@ -17,9 +17,12 @@
 #include <grpc/event_engine/event_engine.h>
 #include <grpc/grpc.h>
 #include <grpc/impl/channel_arg_names.h>
+#include <sys/socket.h>
+#include <unistd.h>
 
 #include <algorithm>
 #include <chrono>
+#include <cstring>
 #include <list>
 #include <memory>
 #include <string>
@@ -33,16 +36,20 @@
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_split.h"
 #include "absl/strings/string_view.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
 #include "gtest/gtest.h"
 #include "src/core/config/config_vars.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/event_engine/channel_args_endpoint_config.h"
+#include "src/core/lib/event_engine/extensions/tcp_info.h"
 #include "src/core/lib/event_engine/poller.h"
 #include "src/core/lib/event_engine/posix_engine/event_poller.h"
 #include "src/core/lib/event_engine/posix_engine/event_poller_posix_default.h"
 #include "src/core/lib/event_engine/posix_engine/posix_engine.h"
 #include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
 #include "src/core/lib/event_engine/posix_engine/tcp_socket_utils.h"
+#include "src/core/lib/event_engine/query_extensions.h"
 #include "src/core/lib/event_engine/tcp_socket_utils.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
 #include "src/core/util/dual_ref_counted.h"
@@ -266,6 +273,37 @@ TEST_P(PosixEndpointTest, ConnectExchangeBidiDataTransferTest) {
   worker->Wait();
 }
 
+TEST_P(PosixEndpointTest, TcpConnectionInfoTest) {
+  if (PosixPoller() == nullptr) {
+    return;
+  }
+  Worker* worker = new Worker(GetPosixEE(), PosixPoller());
+  worker->Start();
+  {
+    auto connections = CreateConnectedEndpoints(*PosixPoller(), GetParam(), 1,
+                                                GetPosixEE(), GetOracleEE());
+    auto client_endpoint = std::move(connections.front().client_endpoint);
+    auto server_endpoint = std::move(connections.front().server_endpoint);
+    connections.clear();
+    ASSERT_TRUE(SendValidatePayload(GetNextSendMessage(), client_endpoint.get(),
+                                    server_endpoint.get())
+                    .ok());
+    auto* tcp_info = QueryExtension<TcpInfoExtension>(client_endpoint.get());
+    ASSERT_NE(tcp_info, nullptr);
+    // Older kernels and non-Linux platforms do not report TCP_INFO.
+    auto info = tcp_info->GetTcpConnectionInfo();
+    if (info.has_value()) {
+      EXPECT_GT(info->rtt.count(), 0);
+      EXPECT_GT(info->min_rtt.count(), 0);
+      EXPECT_GT(info->mss, 0u);
+      // The payload has been read by the server, so none of it is left
+      // unsent.
+      EXPECT_EQ(info->notsent_bytes, 0u);
+    }
+  }
+  worker->Wait();
+}
+
 // Create  N connections and exchange and verify random number of messages over
 // each connection in parallel.
 TEST_P(PosixEndpointTest, MultipleIPv6ConnectionsToOneOracleListenerTest) {
@@ -325,10 +363,261 @@ TEST_P(PosixEndpointTest, MultipleIPv6ConnectionsToOneOracleListenerTest) {
   worker->Wait();
 }
 
+TEST_P(PosixEndpointTest, UnixSocketMemfdDataTransferTest) {
+  if (PosixPoller() == nullptr) {
+    return;
+  }
+  int fds[2];
+  ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, fds), 0);
+  grpc_core::ChannelArgs args =
+      grpc_core::ChannelArgs()
+          .Set(GRPC_ARG_RESOURCE_QUOTA, grpc_core::ResourceQuota::Default())
+          .Set(GRPC_ARG_UNIX_SOCKET_MEMFD_THRESHOLD, 2 * kMinMessageSize)
+          .Set(GRPC_ARG_UNIX_SOCKET_ACCEPT_MEMFD, 1);
+  PosixTcpOptions options =
+      TcpOptionsFromEndpointConfig(ChannelArgsEndpointConfig(args));
+  std::unique_ptr<EventEngine::Endpoint> endpoints[2];
+  for (int i = 0; i < 2; ++i) {
+    EventHandle* handle = PosixPoller()->CreateHandle(
+        fds[i], "test", PosixPoller()->CanTrackErrors());
+    ++g_num_active_connections;
+    endpoints[i] = CreatePosixEndpoint(
+        handle,
+        PosixEngineClosure::TestOnlyToClosure([poller = PosixPoller()](
+                                                  absl::Status /*status*/) {
+          if (--g_num_active_connections == 0) {
+            poller->Kick();
+          }
+        }),
+        GetPosixEE(),
+        options.resource_quota->memory_quota()->CreateMemoryAllocator("test"),
+        options);
+  }
+  Worker* worker = new Worker(GetPosixEE(), PosixPoller());
+  worker->Start();
+  for (int i = 0; i < kNumExchangedMessages; i++) {
+    // Large messages are passed as memfds, small ones through the socket.
+    std::string message = GetNextSendMessage();
+    ASSERT_TRUE(SendValidatePayload(message, endpoints[0].get(),
+                                    endpoints[1].get())
+                    .ok());
+    ASSERT_TRUE(SendValidatePayload(message, endpoints[1].get(),
+                                    endpoints[0].get())
+                    .ok());
+  }
+  endpoints[0].reset();
+  endpoints[1].reset();
+  worker->Wait();
+}
+
+TEST_P(PosixEndpointTest, UnixSocketRejectsFdWithoutOptInTest) {
+  if (PosixPoller() == nullptr) {
+    return;
+  }
+  int fds[2];
+  ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, fds), 0);
+  grpc_core::ChannelArgs args = grpc_core::ChannelArgs().Set(
+      GRPC_ARG_RESOURCE_QUOTA, grpc_core::ResourceQuota::Default());
+  PosixTcpOptions options =
+      TcpOptionsFromEndpointConfig(ChannelArgsEndpointConfig(args));
+  EventHandle* handle = PosixPoller()->CreateHandle(
+      fds[1], "test", PosixPoller()->CanTrackErrors());
+  ++g_num_active_connections;
+  std::unique_ptr<EventEngine::Endpoint> endpoint = CreatePosixEndpoint(
+      handle,
+      PosixEngineClosure::TestOnlyToClosure(
+          [poller = PosixPoller()](absl::Status /*status*/) {
+            if (--g_num_active_connections == 0) {
+              poller->Kick();
+            }
+          }),
+      GetPosixEE(),
+      options.resource_quota->memory_quota()->CreateMemoryAllocator("test"),
+      options);
+  Worker* worker = new Worker(GetPosixEE(), PosixPoller());
+  worker->Start();
+  // Pass a descriptor by hand, as a peer that sends memfds would.
+  char marker = 0;
+  struct iovec iov;
+  iov.iov_base = &marker;
+  iov.iov_len = 1;
+  alignas(cmsghdr) char cmsgbuf[CMSG_SPACE(sizeof(int))];
+  struct msghdr msg = {};
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = cmsgbuf;
+  msg.msg_controllen = sizeof(cmsgbuf);
+  struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+  cmsg->cmsg_level = SOL_SOCKET;
+  cmsg->cmsg_type = SCM_RIGHTS;
+  cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+  memcpy(CMSG_DATA(cmsg), &fds[0], sizeof(int));
+  ASSERT_EQ(sendmsg(fds[0], &msg, 0), 1);
+  SliceBuffer buffer;
+  absl::Status read_status;
+  grpc_core::Notification read_done;
+  if (endpoint->Read(
+          [&](absl::Status status) {
+            read_status = std::move(status);
+            read_done.Notify();
+          },
+          &buffer, EventEngine::Endpoint::ReadArgs())) {
+    read_done.Notify();
+  }
+  read_done.WaitForNotification();
+  EXPECT_FALSE(read_status.ok());
+  EXPECT_EQ(buffer.Length(), 0u);
+  close(fds[0]);
+  endpoint.reset();
+  worker->Wait();
+}
+
+TEST_P(PosixEndpointTest, ReclamationShrinksReceiveBufferUntilReadsGrowIt) {
+  if (PosixPoller() == nullptr) {
+    return;
+  }
+  constexpr size_t kQuotaSize = 64 * 1024 * 1024;
+  constexpr int kMinBufferSize = 16 * 1024;
+  auto quota = grpc_core::MakeResourceQuota("socket_buffers");
+  quota->memory_quota()->SetSize(kQuotaSize);
+  int fds[2];
+  ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, fds), 0);
+  grpc_core::ChannelArgs args =
+      grpc_core::ChannelArgs()
+          .Set(GRPC_ARG_RESOURCE_QUOTA, quota)
+          .Set(GRPC_ARG_TCP_AUTO_TUNE_BUFFER_SIZES, 1);
+  PosixTcpOptions options =
+      TcpOptionsFromEndpointConfig(ChannelArgsEndpointConfig(args));
+  std::unique_ptr<EventEngine::Endpoint> endpoints[2];
+  for (int i = 0; i < 2; ++i) {
+    EventHandle* handle = PosixPoller()->CreateHandle(
+        fds[i], "test", PosixPoller()->CanTrackErrors());
+    ++g_num_active_connections;
+    endpoints[i] = CreatePosixEndpoint(
+        handle,
+        PosixEngineClosure::TestOnlyToClosure([poller = PosixPoller()](
+                                                  absl::Status /*status*/) {
+          if (--g_num_active_connections == 0) {
+            poller->Kick();
+          }
+        }),
+        GetPosixEE(),
+        options.resource_quota->memory_quota()->CreateMemoryAllocator("test"),
+        options);
+  }
+  auto socket_option = [fd = fds[1]](int name) {
+    int value = 0;
+    socklen_t len = sizeof(value);
+    EXPECT_EQ(getsockopt(fd, SOL_SOCKET, name, &value, &len), 0);
+    return value;
+  };
+  // The kernel reports twice the size that was set.
+  auto receive_buffer_size = [&]() { return socket_option(SO_RCVBUF) / 2; };
+  const int send_buffer_size = socket_option(SO_SNDBUF);
+  Worker* worker = new Worker(GetPosixEE(), PosixPoller());
+  worker->Start();
+  // A read posts the endpoint's reclaimer.
+  ASSERT_TRUE(SendValidatePayload(GetNextSendMessage(), endpoints[0].get(),
+                                  endpoints[1].get())
+                  .ok());
+  {
+    // Overcommit the quota so that its benign reclaimers run.
+    auto pressure = quota->memory_quota()->CreateMemoryAllocator("pressure");
+    auto reservation = pressure.MakeReservation(2 * kQuotaSize);
+    const auto deadline = absl::Now() + absl::Seconds(30);
+    while (receive_buffer_size() > kMinBufferSize && absl::Now() < deadline) {
+      absl::SleepFor(absl::Milliseconds(10));
+    }
+    EXPECT_EQ(receive_buffer_size(), kMinBufferSize);
+  }
+  // Once the pressure is gone, reads that find more than the buffer holds
+  // grow it back. The send buffer is left to the kernel throughout.
+  const std::string large_message(4 * 1024 * 1024, 'a');
+  const auto deadline = absl::Now() + absl::Seconds(60);
+  while (receive_buffer_size() <= kMinBufferSize && absl::Now() < deadline) {
+    ASSERT_TRUE(SendValidatePayload(large_message, endpoints[0].get(),
+                                    endpoints[1].get())
+                    .ok());
+  }
+  EXPECT_GT(receive_buffer_size(), kMinBufferSize);
+  EXPECT_EQ(socket_option(SO_SNDBUF), send_buffer_size);
+  endpoints[0].reset();
+  endpoints[1].reset();
+  worker->Wait();
+}
+
 // Test with zero copy enabled and disabled.
 INSTANTIATE_TEST_SUITE_P(PosixEndpoint, PosixEndpointTest,
                          ::testing::ValuesIn({false, true}), &TestScenarioName);
 
+TEST(TcpZerocopySendCtxTest, FixedPoolDoesNotGrow) {
+  TcpZerocopySendCtx ctx(/*zerocopy_enabled=*/true, /*max_sends=*/2);
+  TcpZerocopySendRecord* first = ctx.GetSendRecord();
+  TcpZerocopySendRecord* second = ctx.GetSendRecord();
+  ASSERT_NE(first, nullptr);
+  ASSERT_NE(second, nullptr);
+  EXPECT_EQ(ctx.GetSendRecord(), nullptr);
+  EXPECT_EQ(ctx.NumSendRecords(), 2);
+  ctx.PutSendRecord(first);
+  ctx.PutSendRecord(second);
+  EXPECT_TRUE(ctx.AllSendRecordsEmpty());
+}
+
+TEST(TcpZerocopySendCtxTest, AdaptivePoolGrows) {
+  constexpr int kMaxSends = 2;
+  TcpZerocopySendCtx ctx(/*zerocopy_enabled=*/true, kMaxSends,
+                         TcpZerocopySendCtx::kDefaultSendBytesThreshold,
+                         /*adaptive=*/true);
+  std::vector<TcpZerocopySendRecord*> records;
+  for (int i = 0; i < kMaxSends * TcpZerocopySendCtx::kMaxSendsGrowthFactor;
+       ++i) {
+    TcpZerocopySendRecord* record = ctx.GetSendRecord();
+    ASSERT_NE(record, nullptr);
+    records.push_back(record);
+  }
+  EXPECT_EQ(ctx.GetSendRecord(), nullptr);
+  EXPECT_EQ(ctx.NumSendRecords(),
+            kMaxSends * TcpZerocopySendCtx::kMaxSendsGrowthFactor);
+  EXPECT_FALSE(ctx.AllSendRecordsEmpty());
+  for (TcpZerocopySendRecord* record : records) ctx.PutSendRecord(record);
+  EXPECT_TRUE(ctx.AllSendRecordsEmpty());
+}
+
+TEST(TcpZerocopySendCtxTest, AdaptivePoolDoesNotGrowWhenOptMemIsFull) {
+  TcpZerocopySendCtx ctx(/*zerocopy_enabled=*/true, /*max_sends=*/1,
+                         TcpZerocopySendCtx::kDefaultSendBytesThreshold,
+                         /*adaptive=*/true);
+  TcpZerocopySendRecord* record = ctx.GetSendRecord();
+  ASSERT_NE(record, nullptr);
+  bool constrained;
+  EXPECT_FALSE(ctx.UpdateZeroCopyOptMemStateAfterSend(
+      /*seen_enobuf=*/true, constrained));
+  EXPECT_EQ(ctx.GetSendRecord(), nullptr);
+  EXPECT_EQ(ctx.NumSendRecords(), 1);
+  ctx.PutSendRecord(record);
+}
+
+TEST(TcpZerocopySendCtxTest, AdaptiveThresholdFollowsCopiedSends) {
+  constexpr size_t kThreshold = 16 * 1024;
+  TcpZerocopySendCtx ctx(/*zerocopy_enabled=*/true,
+                         TcpZerocopySendCtx::kDefaultMaxSends, kThreshold,
+                         /*adaptive=*/true);
+  ctx.NoteSendComplete(/*copied=*/true);
+  EXPECT_EQ(ctx.ThresholdBytes(), 2 * kThreshold);
+  for (int i = 0; i < 20; ++i) ctx.NoteSendComplete(/*copied=*/true);
+  EXPECT_EQ(ctx.ThresholdBytes(), TcpZerocopySendCtx::kMaxSendBytesThreshold);
+  for (int i = 0; i < 20; ++i) ctx.NoteSendComplete(/*copied=*/false);
+  EXPECT_EQ(ctx.ThresholdBytes(), kThreshold);
+}
+
+TEST(TcpZerocopySendCtxTest, FixedThresholdIgnoresCopiedSends) {
+  constexpr size_t kThreshold = 16 * 1024;
+  TcpZerocopySendCtx ctx(/*zerocopy_enabled=*/true,
+                         TcpZerocopySendCtx::kDefaultMaxSends, kThreshold);
+  ctx.NoteSendComplete(/*copied=*/true);
+  EXPECT_EQ(ctx.ThresholdBytes(), kThreshold);
+}
+
 }  // namespace experimental
 }  // namespace grpc_event_engine
 
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <grpc/event_engine/event_engine.h>
+#include <grpc/impl/channel_arg_names.h>
 #include <string.h>
 #include <sys/socket.h>
 #include <unistd.h>
@@ -33,6 +34,7 @@
 #include <ifaddrs.h>
 
 #include "absl/log/log.h"
+#include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/event_engine/channel_args_endpoint_config.h"
 #include "src/core/lib/event_engine/posix_engine/posix_engine_listener_utils.h"
 #include "src/core/lib/event_engine/posix_engine/tcp_socket_utils.h"
@@ -229,6 +231,41 @@ TEST(PosixEngineListenerUtils, ListenerContainerAddAllLocalAddressesTest) {
 }
 #endif  // GRPC_HAVE_IFADDRS
 
+TEST(PosixEngineListenerUtils, ListenerShardsShareAPortTest) {
+  if (!PosixSocketWrapper::IsSocketReusePortSupported()) {
+    LOG(INFO) << "Skipping ListenerShardsShareAPortTest because SO_REUSEPORT "
+                 "is not supported.";
+    return;
+  }
+  ChannelArgsEndpointConfig config(
+      grpc_core::ChannelArgs()
+          .Set(GRPC_ARG_TCP_LISTENER_SHARDS, 2)
+          .Set(GRPC_ARG_TCP_LISTENER_SHARD_CPU_STEERING, 1));
+  PosixTcpOptions options = TcpOptionsFromEndpointConfig(config);
+  EXPECT_EQ(options.listener_shards, 2);
+  EXPECT_TRUE(options.listener_cpu_steering);
+  auto addr = URIToResolvedAddress("ipv4:127.0.0.1:0");
+  ASSERT_TRUE(addr.ok());
+  auto first = CreateAndPrepareListenerSocket(options, *addr);
+  ASSERT_TRUE(first.ok()) << first.status();
+  ResolvedAddressSetPort(*addr, first->port);
+  auto second = CreateAndPrepareListenerSocket(options, *addr);
+  ASSERT_TRUE(second.ok()) << second.status();
+  EXPECT_EQ(second->port, first->port);
+#ifdef GPR_LINUX
+  EXPECT_TRUE(first->sock.SetSocketReusePortCpuSteering(2).ok());
+#endif
+  close(first->sock.Fd());
+  close(second->sock.Fd());
+}
+
+TEST(PosixEngineListenerUtils, ListenerShardsRequireReusePortTest) {
+  ChannelArgsEndpointConfig config(grpc_core::ChannelArgs()
+                                       .Set(GRPC_ARG_TCP_LISTENER_SHARDS, 4)
+                                       .Set(GRPC_ARG_ALLOW_REUSEPORT, 0));
+  EXPECT_EQ(TcpOptionsFromEndpointConfig(config).listener_shards, 1);
+}
+
 }  // namespace experimental
 }  // namespace grpc_event_engine
 
@@ -37,6 +37,7 @@
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_format.h"
 #include "gtest/gtest.h"
+#include "src/core/config/config_vars.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/event_engine/channel_args_endpoint_config.h"
 #include "src/core/lib/event_engine/posix_engine/posix_engine.h"
@@ -202,6 +203,77 @@ TEST(PosixEventEngineTest, IndefiniteConnectCancellationTest) {
   grpc_core::WaitForSingleOwner(std::move(posix_ee));
 }
 
+// Connections made and accepted by an engine with several pollers, which are
+// spread over the pollers, carry data both ways.
+TEST(PosixEventEngineTest, MultiplePollersTest) {
+  static constexpr int kNumConnections = 8;
+  grpc_core::ConfigVars::Overrides overrides;
+  overrides.event_engine_poller_count = 4;
+  grpc_core::ConfigVars::SetOverrides(overrides);
+  std::shared_ptr<EventEngine> posix_ee =
+      PosixEventEngine::MakePosixEventEngine();
+  grpc_core::ConfigVars::SetOverrides(grpc_core::ConfigVars::Overrides());
+  std::string target_addr = absl::StrCat(
+      "ipv6:[::1]:", std::to_string(grpc_pick_unused_port_or_die()));
+  auto resolved_addr = URIToResolvedAddress(target_addr);
+  CHECK_OK(resolved_addr);
+  grpc_core::ChannelArgs args;
+  auto quota = grpc_core::ResourceQuota::Default();
+  args = args.Set(GRPC_ARG_RESOURCE_QUOTA, quota);
+  ChannelArgsEndpointConfig config(args);
+  auto memory_quota = absl::make_unique<grpc_core::MemoryQuota>("bar");
+  std::unique_ptr<EventEngine::Endpoint> server_endpoint;
+  auto server_signal = std::make_unique<grpc_core::Notification>();
+  auto listener = posix_ee->CreateListener(
+      [&server_endpoint, &server_signal](
+          std::unique_ptr<EventEngine::Endpoint> ep,
+          grpc_core::MemoryAllocator /*memory_allocator*/) {
+        server_endpoint = std::move(ep);
+        server_signal->Notify();
+      },
+      [](absl::Status status) { EXPECT_TRUE(status.ok()) << status; }, config,
+      std::make_unique<grpc_core::MemoryQuota>("foo"));
+  ASSERT_TRUE(listener.ok()) << listener.status();
+  ASSERT_TRUE((*listener)->Bind(*resolved_addr).ok());
+  ASSERT_TRUE((*listener)->Start().ok());
+  std::vector<std::pair<std::unique_ptr<EventEngine::Endpoint>,
+                        std::unique_ptr<EventEngine::Endpoint>>>
+      connections;
+  for (int i = 0; i < kNumConnections; ++i) {
+    std::unique_ptr<EventEngine::Endpoint> client_endpoint;
+    grpc_core::Notification client_signal;
+    posix_ee->Connect(
+        [&client_endpoint, &client_signal](
+            absl::StatusOr<std::unique_ptr<EventEngine::Endpoint>> endpoint) {
+          ASSERT_TRUE(endpoint.ok()) << endpoint.status();
+          client_endpoint = std::move(*endpoint);
+          client_signal.Notify();
+        },
+        *resolved_addr, config,
+        memory_quota->CreateMemoryAllocator(absl::StrCat("conn-", i)), 24h);
+    client_signal.WaitForNotification();
+    server_signal->WaitForNotification();
+    ASSERT_NE(client_endpoint, nullptr);
+    ASSERT_NE(server_endpoint, nullptr);
+    server_signal = std::make_unique<grpc_core::Notification>();
+    connections.emplace_back(std::move(client_endpoint),
+                             std::move(server_endpoint));
+  }
+  for (auto& connection : connections) {
+    EXPECT_TRUE(SendValidatePayload(GetNextSendMessage(),
+                                    connection.first.get(),
+                                    connection.second.get())
+                    .ok());
+    EXPECT_TRUE(SendValidatePayload(GetNextSendMessage(),
+                                    connection.second.get(),
+                                    connection.first.get())
+                    .ok());
+  }
+  connections.clear();
+  listener->reset();
+  grpc_core::WaitForSingleOwner(std::move(posix_ee));
+}
+
 }  // namespace experimental
 }  // namespace grpc_event_engine
 
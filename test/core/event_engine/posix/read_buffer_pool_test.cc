@@ -0,0 +1,92 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/posix_engine/read_buffer_pool.h"
+
+#include <grpc/slice.h>
+
+#include <memory>
+
+#include "gtest/gtest.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/lib/slice/slice.h"
+
+namespace grpc_event_engine::experimental {
+namespace {
+
+class ReadBufferPoolTest : public ::testing::Test {
+ protected:
+  grpc_core::MemoryQuota memory_quota_{"read_buffer_pool_test"};
+  MemoryAllocator allocator_ = memory_quota_.CreateMemoryAllocator("test");
+};
+
+TEST_F(ReadBufferPoolTest, ReusesReturnedBlocks) {
+  auto pool = std::make_shared<ReadBufferPool>();
+  bool reused = true;
+  grpc_slice first =
+      pool->MakeSlice(ReadBufferPool::kSmallBufferSize, allocator_, &reused);
+  EXPECT_FALSE(reused);
+  EXPECT_EQ(GRPC_SLICE_LENGTH(first), ReadBufferPool::kSmallBufferSize);
+  uint8_t* first_data = GRPC_SLICE_START_PTR(first);
+  EXPECT_EQ(pool->TestOnlyCachedBytes(), 0u);
+  grpc_core::CSliceUnref(first);
+  EXPECT_EQ(pool->TestOnlyCachedBytes(), ReadBufferPool::kSmallBufferSize);
+  grpc_slice second =
+      pool->MakeSlice(ReadBufferPool::kSmallBufferSize, allocator_, &reused);
+  EXPECT_TRUE(reused);
+  EXPECT_EQ(GRPC_SLICE_START_PTR(second), first_data);
+  EXPECT_EQ(pool->TestOnlyCachedBytes(), 0u);
+  grpc_core::CSliceUnref(second);
+}
+
+TEST_F(ReadBufferPoolTest, SizeClassesAreSeparate) {
+  auto pool = std::make_shared<ReadBufferPool>();
+  grpc_core::CSliceUnref(
+      pool->MakeSlice(ReadBufferPool::kSmallBufferSize, allocator_));
+  bool reused = true;
+  grpc_slice large =
+      pool->MakeSlice(ReadBufferPool::kLargeBufferSize, allocator_, &reused);
+  EXPECT_FALSE(reused);
+  EXPECT_EQ(GRPC_SLICE_LENGTH(large), ReadBufferPool::kLargeBufferSize);
+  grpc_core::CSliceUnref(large);
+  EXPECT_EQ(pool->TestOnlyCachedBytes(), ReadBufferPool::kSmallBufferSize +
+                                             ReadBufferPool::kLargeBufferSize);
+}
+
+TEST_F(ReadBufferPoolTest, RespectsCacheLimit) {
+  auto pool =
+      std::make_shared<ReadBufferPool>(ReadBufferPool::kSmallBufferSize);
+  grpc_slice a = pool->MakeSlice(ReadBufferPool::kSmallBufferSize, allocator_);
+  grpc_slice b = pool->MakeSlice(ReadBufferPool::kSmallBufferSize, allocator_);
+  grpc_core::CSliceUnref(a);
+  grpc_core::CSliceUnref(b);
+  EXPECT_EQ(pool->TestOnlyCachedBytes(), ReadBufferPool::kSmallBufferSize);
+}
+
+TEST_F(ReadBufferPoolTest, SlicesOutliveThePool) {
+  auto pool = std::make_shared<ReadBufferPool>();
+  grpc_slice slice =
+      pool->MakeSlice(ReadBufferPool::kLargeBufferSize, allocator_);
+  pool.reset();
+  GRPC_SLICE_START_PTR(slice)[0] = 'a';
+  grpc_core::CSliceUnref(slice);
+}
+
+}  // namespace
+}  // namespace grpc_event_engine::experimental
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
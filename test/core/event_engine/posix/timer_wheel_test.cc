@@ -0,0 +1,234 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/posix_engine/timer_wheel.h"
+
+#include <grpc/event_engine/event_engine.h>
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "src/core/lib/event_engine/posix_engine/timer.h"
+#include "src/core/util/time.h"
+
+namespace grpc_event_engine {
+namespace experimental {
+
+namespace {
+
+class CountingClosure : public experimental::EventEngine::Closure {
+ public:
+  void Run() override { ++runs; }
+  int runs = 0;
+};
+
+class AtomicCountingClosure : public experimental::EventEngine::Closure {
+ public:
+  void Run() override { runs.fetch_add(1, std::memory_order_relaxed); }
+  std::atomic<int> runs{0};
+};
+
+class FakeHost : public TimerListHost {
+ public:
+  grpc_core::Timestamp Now() override {
+    return grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(now);
+  }
+  void Kick() override { ++kicks; }
+
+  int64_t now = 100;
+  std::atomic<int> kicks{0};
+};
+
+// Returns the number of timers that fired.
+size_t Check(TimerWheel& wheel, grpc_core::Timestamp* next = nullptr) {
+  auto closures = wheel.TimerCheck(next);
+  EXPECT_TRUE(closures.has_value());
+  for (auto* closure : *closures) closure->Run();
+  return closures->size();
+}
+
+grpc_core::Timestamp At(int64_t millis) {
+  return grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(millis);
+}
+
+}  // namespace
+
+TEST(TimerWheelTest, FiresEveryTimerOnItsDeadline) {
+  FakeHost host;
+  TimerWheel wheel(&host);
+  // Deadlines on either side of the boundaries between levels, and one
+  // beyond the top level.
+  const std::vector<int64_t> delays = {
+      1,          63,         64,       65,       4095,     4096,
+      4097,       262143,     262144,   300000,   16777215, 16777216,
+      16777217,   36000000};
+  std::vector<Timer> timers(delays.size());
+  std::vector<CountingClosure> closures(delays.size());
+  for (size_t i = 0; i < delays.size(); ++i) {
+    wheel.TimerInit(&timers[i], At(host.now + delays[i]), &closures[i]);
+  }
+  const int64_t start = host.now;
+  for (size_t i = 0; i < delays.size(); ++i) {
+    host.now = start + delays[i] - 1;
+    EXPECT_EQ(Check(wheel), 0u) << "delay " << delays[i];
+    EXPECT_EQ(closures[i].runs, 0);
+    host.now = start + delays[i];
+    EXPECT_EQ(Check(wheel), 1u) << "delay " << delays[i];
+    EXPECT_EQ(closures[i].runs, 1);
+  }
+  for (auto& timer : timers) EXPECT_FALSE(wheel.TimerCancel(&timer));
+}
+
+TEST(TimerWheelTest, CancelledTimersDoNotFire) {
+  FakeHost host;
+  TimerWheel wheel(&host);
+  constexpr int kTimers = 1000;
+  std::vector<Timer> timers(kTimers);
+  std::vector<CountingClosure> closures(kTimers);
+  for (int i = 0; i < kTimers; ++i) {
+    wheel.TimerInit(&timers[i], At(host.now + 1 + i * 37), &closures[i]);
+  }
+  for (int i = 0; i < kTimers; i += 2) {
+    EXPECT_TRUE(wheel.TimerCancel(&timers[i]));
+    EXPECT_FALSE(wheel.TimerCancel(&timers[i]));
+  }
+  host.now += kTimers * 37;
+  EXPECT_EQ(Check(wheel), static_cast<size_t>(kTimers / 2));
+  for (int i = 0; i < kTimers; ++i) {
+    EXPECT_EQ(closures[i].runs, i % 2) << i;
+  }
+}
+
+TEST(TimerWheelTest, ReportsNextWakeup) {
+  FakeHost host;
+  TimerWheel wheel(&host);
+  Timer timer;
+  CountingClosure closure;
+  const int64_t deadline = host.now + 10000;
+  wheel.TimerInit(&timer, At(deadline), &closure);
+  // Waking up at each reported time eventually fires the timer on time, and
+  // never early.
+  int wakeups = 0;
+  while (closure.runs == 0) {
+    grpc_core::Timestamp next = grpc_core::Timestamp::InfFuture();
+    Check(wheel, &next);
+    if (closure.runs != 0) break;
+    ASSERT_LE(next.milliseconds_after_process_epoch(), deadline);
+    ASSERT_GT(next.milliseconds_after_process_epoch(), host.now);
+    host.now = next.milliseconds_after_process_epoch();
+    ASSERT_LT(++wakeups, 10);
+  }
+  EXPECT_EQ(host.now, deadline);
+}
+
+TEST(TimerWheelTest, KicksForEarlierTimer) {
+  FakeHost host;
+  TimerWheel wheel(&host);
+  Timer late, early;
+  CountingClosure late_closure, early_closure;
+  wheel.TimerInit(&late, At(host.now + 100000), &late_closure);
+  Check(wheel);
+  const int kicks = host.kicks.load();
+  wheel.TimerInit(&early, At(host.now + 10), &early_closure);
+  EXPECT_EQ(host.kicks.load(), kicks + 1);
+  host.now += 10;
+  EXPECT_EQ(Check(wheel), 1u);
+  EXPECT_EQ(early_closure.runs, 1);
+  EXPECT_TRUE(wheel.TimerCancel(&late));
+}
+
+TEST(TimerWheelTest, PastDeadlinesFireOnNextCheck) {
+  FakeHost host;
+  TimerWheel wheel(&host);
+  Timer timer;
+  CountingClosure closure;
+  host.now += 1000;
+  Check(wheel);
+  wheel.TimerInit(&timer, At(host.now - 500), &closure);
+  host.now += 1;
+  EXPECT_EQ(Check(wheel), 1u);
+  EXPECT_EQ(closure.runs, 1);
+}
+
+TEST(TimerWheelTest, FarFutureDeadlines) {
+  FakeHost host;
+  TimerWheel wheel(&host);
+  Timer timers[2];
+  CountingClosure closures[2];
+  wheel.TimerInit(&timers[0],
+                  At(std::numeric_limits<int64_t>::max() - 1), &closures[0]);
+  wheel.TimerInit(&timers[1], At(host.now + 3), &closures[1]);
+  host.now += 4;
+  EXPECT_EQ(Check(wheel), 1u);
+  EXPECT_EQ(closures[1].runs, 1);
+  EXPECT_TRUE(wheel.TimerCancel(&timers[0]));
+}
+
+TEST(TimerWheelTest, ConcurrentInitAndCheckReportEveryTimer) {
+  FakeHost host;
+  TimerWheel wheel(&host);
+  constexpr int kThreads = 4;
+  constexpr int kTimersPerThread = 2000;
+  // Due timers keep TimerCheck scanning the shards while future timers are
+  // being added; a TimerCheck that starts after a future timer was added
+  // must never report a wakeup later than its deadline.
+  std::vector<Timer> due(kThreads * kTimersPerThread);
+  std::vector<Timer> future(kThreads * kTimersPerThread);
+  AtomicCountingClosure due_closure;
+  AtomicCountingClosure future_closure;
+  std::atomic<bool> done{false};
+  std::thread checker([&] {
+    while (!done.load(std::memory_order_relaxed)) {
+      auto closures = wheel.TimerCheck(nullptr);
+      if (!closures.has_value()) continue;
+      for (auto* closure : *closures) closure->Run();
+    }
+  });
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&, t] {
+      for (int i = t * kTimersPerThread; i < (t + 1) * kTimersPerThread;
+           ++i) {
+        wheel.TimerInit(&due[i], At(host.now), &due_closure);
+        const int64_t deadline = host.now + 1 + i;
+        wheel.TimerInit(&future[i], At(deadline), &future_closure);
+        grpc_core::Timestamp next = grpc_core::Timestamp::InfFuture();
+        auto closures = wheel.TimerCheck(&next);
+        if (!closures.has_value()) continue;
+        for (auto* closure : *closures) closure->Run();
+        ASSERT_LE(next.milliseconds_after_process_epoch(), deadline) << i;
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  done.store(true, std::memory_order_relaxed);
+  checker.join();
+  Check(wheel);
+  EXPECT_EQ(due_closure.runs.load(), kThreads * kTimersPerThread);
+  EXPECT_EQ(future_closure.runs.load(), 0);
+  for (auto& timer : future) EXPECT_TRUE(wheel.TimerCancel(&timer));
+}
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -16,11 +16,13 @@
 #include <grpc/grpc.h>
 #include <grpc/support/thd_id.h>
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <cmath>
 #include <cstddef>
 #include <functional>
+#include <map>
 #include <memory>
 #include <thread>
 #include <tuple>
@@ -29,8 +31,11 @@
 #include "absl/time/clock.h"
 #include "absl/time/time.h"
 #include "gtest/gtest.h"
+#include "src/core/config/config_vars.h"
+#include "src/core/lib/event_engine/common_closures.h"
 #include "src/core/lib/event_engine/thread_pool/thread_count.h"
 #include "src/core/lib/event_engine/thread_pool/work_stealing_thread_pool.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/util/notification.h"
 #include "src/core/util/thd.h"
 #include "src/core/util/time.h"
@@ -85,6 +90,39 @@ TYPED_TEST(ThreadPoolTest, CanSurviveFork) {
   p.Quiesce();
 }
 
+TYPED_TEST(ThreadPoolTest, ChildRestartsOnFirstUseWithLazyForkRestart) {
+  grpc_core::ConfigVars::Overrides overrides;
+  overrides.event_engine_lazy_fork_restart = true;
+  grpc_core::ConfigVars::SetOverrides(overrides);
+  TypeParam p(8);
+  grpc_core::Notification saved_closure_ran;
+  grpc_core::Notification outer_closure_started;
+  p.Run([&] {
+    outer_closure_started.Notify();
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+    p.Run([&saved_closure_ran] { saved_closure_ran.Notify(); });
+  });
+  outer_closure_started.WaitForNotification();
+  // The closure queued while forking is saved, and the child does not run it
+  // until it uses the pool.
+  p.PrepareFork();
+  p.PostforkChild();
+  EXPECT_FALSE(saved_closure_ran.WaitForNotificationWithTimeout(
+      absl::Milliseconds(500)));
+  grpc_core::Notification n;
+  p.Run([&n] { n.Notify(); });
+  n.WaitForNotification();
+  saved_closure_ran.WaitForNotification();
+  // A second fork before the child uses the pool keeps the restart deferred
+  // in the parent too, and quiescing still succeeds.
+  p.PrepareFork();
+  p.PostforkChild();
+  p.PrepareFork();
+  p.PostforkParent();
+  p.Quiesce();
+  grpc_core::ConfigVars::Reset();
+}
+
 TYPED_TEST(ThreadPoolTest, ForkStressTest) {
   // Runs a large number of closures and multiple simulated fork events,
   // ensuring that only some fixed number of closures are executed between fork
@@ -289,6 +327,51 @@ TYPED_TEST(ThreadPoolTest, WorkerThreadLocalRunWorksWithOtherPools) {
   p1.Quiesce();
 }
 
+TYPED_TEST(ThreadPoolTest, RunWithAffinityRunsAllClosures) {
+  constexpr int closure_count = 1000;
+  TypeParam p(8);
+  std::atomic<int> runcount{0};
+  grpc_core::Notification done;
+  std::vector<std::unique_ptr<AnyInvocableClosure>> closures;
+  for (int i = 0; i < closure_count; i++) {
+    closures.push_back(std::make_unique<AnyInvocableClosure>([&]() {
+      if (runcount.fetch_add(1) + 1 == closure_count) done.Notify();
+    }));
+  }
+  for (int i = 0; i < closure_count; i++) {
+    p.RunWithAffinity(i, closures[i].get());
+  }
+  done.WaitForNotification();
+  p.Quiesce();
+  EXPECT_EQ(runcount.load(), closure_count);
+}
+
+TYPED_TEST(ThreadPoolTest, RunWithAffinityPrefersTheSameThread) {
+  if (!grpc_core::IsEventEngineWorkerAffinityEnabled()) {
+    GTEST_SKIP() << "Requires the event_engine_worker_affinity experiment";
+  }
+  constexpr int iterations = 200;
+  TypeParam p(8);
+  std::map<gpr_thd_id, int> threads;
+  for (int i = 0; i < iterations; i++) {
+    grpc_core::Notification ran;
+    AnyInvocableClosure closure([&]() {
+      ++threads[gpr_thd_currentid()];
+      ran.Notify();
+    });
+    p.RunWithAffinity(3, &closure);
+    ran.WaitForNotification();
+  }
+  p.Quiesce();
+  int most_used = 0;
+  for (const auto& thread : threads) {
+    most_used = std::max(most_used, thread.second);
+  }
+  // Idle workers may occasionally steal a closure before its home worker
+  // wakes up, but most of them must run on the home worker.
+  EXPECT_GT(most_used, iterations / 2);
+}
+
 TYPED_TEST(ThreadPoolTest, DISABLED_TestDumpStack) {
   TypeParam p1(8);
   for (size_t i = 0; i < 8; i++) {
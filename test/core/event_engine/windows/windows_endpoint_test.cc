@@ -21,6 +21,7 @@
 
 #include "absl/status/status.h"
 #include "gtest/gtest.h"
+#include "src/core/config/config_vars.h"
 #include "src/core/lib/event_engine/channel_args_endpoint_config.h"
 #include "src/core/lib/event_engine/thread_pool/thread_pool.h"
 #include "src/core/lib/event_engine/windows/iocp.h"
@@ -84,6 +85,59 @@ TEST_F(WindowsEndpointTest, BasicCommunication) {
   thread_pool->Quiesce();
 }
 
+TEST_F(WindowsEndpointTest, ZeroByteReads) {
+  grpc_core::ConfigVars::Overrides overrides;
+  overrides.event_engine_windows_zero_byte_reads = true;
+  grpc_core::ConfigVars::SetOverrides(overrides);
+  // Setup
+  auto thread_pool = MakeThreadPool(8);
+  IOCP iocp(thread_pool.get());
+  grpc_core::MemoryQuota quota("endpoint_test");
+  SOCKET sockpair[2];
+  CreateSockpair(sockpair, IOCP::GetDefaultSocketFlags());
+  auto wrapped_client_socket = iocp.Watch(sockpair[0]);
+  auto wrapped_server_socket = iocp.Watch(sockpair[1]);
+  sockaddr_in loopback_addr = GetSomeIpv4LoopbackAddress();
+  auto engine = std::make_shared<WindowsEventEngine>();
+  EventEngine::ResolvedAddress addr((sockaddr*)&loopback_addr,
+                                    sizeof(loopback_addr));
+  WindowsEndpoint client(addr, std::move(wrapped_client_socket),
+                         quota.CreateMemoryAllocator("client"),
+                         ChannelArgsEndpointConfig(), thread_pool.get(),
+                         engine);
+  WindowsEndpoint server(addr, std::move(wrapped_server_socket),
+                         quota.CreateMemoryAllocator("server"),
+                         ChannelArgsEndpointConfig(), thread_pool.get(),
+                         engine);
+  // Test
+  // The read is queued before any data is written, so it waits on a zero-byte
+  // read and then reads the data synchronously.
+  std::string message = "0xDEADBEEF";
+  grpc_core::Notification read_done;
+  SliceBuffer read_buffer;
+  EXPECT_FALSE(server.Read(
+      [&read_done, &message, &read_buffer](absl::Status status) {
+        EXPECT_TRUE(status.ok()) << status;
+        ASSERT_EQ(read_buffer.Count(), 1u);
+        auto slice = read_buffer.TakeFirst();
+        EXPECT_EQ(slice.as_string_view(), message);
+        read_done.Notify();
+      },
+      &read_buffer, EventEngine::Endpoint::ReadArgs()));
+  grpc_core::Notification write_done;
+  SliceBuffer write_buffer;
+  write_buffer.Append(Slice::FromCopiedString(message));
+  EXPECT_FALSE(
+      client.Write([&write_done](absl::Status) { write_done.Notify(); },
+                   &write_buffer, EventEngine::Endpoint::WriteArgs()));
+  iocp.Work(5s, []() {});
+  // Cleanup
+  write_done.WaitForNotification();
+  read_done.WaitForNotification();
+  thread_pool->Quiesce();
+  grpc_core::ConfigVars::SetOverrides(grpc_core::ConfigVars::Overrides());
+}
+
 TEST_F(WindowsEndpointTest, Conversation) {
   // Setup
   auto thread_pool = MakeThreadPool(8);
@@ -0,0 +1,149 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/filters/backend_metrics/backend_metric_filter.h"
+
+#include <grpc/impl/channel_arg_names.h>
+
+#include <cstddef>
+#include <deque>
+#include <string>
+
+#include "absl/strings/string_view.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "src/core/call/metadata_batch.h"
+#include "src/core/ext/filters/backend_metrics/backend_metric_provider.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/load_balancing/backend_metric_data.h"
+#include "src/core/load_balancing/backend_metric_parser.h"
+#include "src/core/util/time.h"
+#include "test/core/filters/filter_test.h"
+
+using ::testing::_;
+using ::testing::StrictMock;
+
+namespace grpc_core {
+namespace {
+
+constexpr absl::string_view kLatencyP50 = "grpc.server.call.latency_p50";
+constexpr absl::string_view kLatencyP99 = "grpc.server.call.latency_p99";
+
+class FakeBackendMetricProvider final : public BackendMetricProvider {
+ public:
+  BackendMetricData GetBackendMetricData() override {
+    BackendMetricData data;
+    data.cpu_utilization = 0.5;
+    return data;
+  }
+};
+
+class BackendMetricFilterTest : public FilterTest<BackendMetricFilter> {
+ protected:
+  // Keeps the parsed reports, like the client's call arena does.
+  class Allocator : public BackendMetricAllocatorInterface {
+   public:
+    BackendMetricData* AllocateBackendMetricData() override {
+      return &data_.emplace_back();
+    }
+
+    char* AllocateString(size_t size) override {
+      return strings_.emplace_back(size, '\0').data();
+    }
+
+   private:
+    std::deque<BackendMetricData> data_;
+    std::deque<std::string> strings_;
+  };
+
+  // Runs a call through \a channel, and returns the load report that the
+  // filter adds to its trailing metadata, if any.
+  const BackendMetricData* RunCall(Channel& channel) {
+    const BackendMetricData* report = nullptr;
+    StrictMock<FilterTest::Call> call(channel);
+    call.arena()->SetContext<BackendMetricProvider>(&provider_);
+    EXPECT_EVENT(Started(&call, _));
+    call.Start(call.NewClientMetadata({{":path", "/foo"}}));
+    call.FinishNextFilter(call.NewServerMetadata({{"grpc-status", "0"}}));
+    EXPECT_EVENT(Finished(&call, _))
+        .WillOnce([&](FilterTestBase::Call*, const ServerMetadata& md) {
+          auto* serialized = md.get_pointer(EndpointLoadMetricsBinMetadata());
+          if (serialized == nullptr) return;
+          report = ParseBackendMetricData(serialized->as_string_view(),
+                                          &allocator_);
+        });
+    Step();
+    return report;
+  }
+
+  FakeBackendMetricProvider provider_;
+  Allocator allocator_;
+};
+
+TEST_F(BackendMetricFilterTest, NoLatencyMetricsByDefault) {
+  auto channel = MakeChannel(ChannelArgs()).value();
+  const BackendMetricData* report = RunCall(channel);
+  ASSERT_NE(report, nullptr);
+  EXPECT_EQ(report->cpu_utilization, 0.5);
+  EXPECT_TRUE(report->named_metrics.empty());
+}
+
+TEST_F(BackendMetricFilterTest, ReportsLatencyQuantiles) {
+  auto channel =
+      MakeChannel(ChannelArgs().Set(GRPC_ARG_SERVER_CALL_LATENCY_METRICS, true))
+          .value();
+  const BackendMetricData* report = RunCall(channel);
+  ASSERT_NE(report, nullptr);
+  EXPECT_EQ(report->cpu_utilization, 0.5);
+  ASSERT_EQ(report->named_metrics.size(), 2u);
+  const double p50 = report->named_metrics.at(kLatencyP50);
+  const double p99 = report->named_metrics.at(kLatencyP99);
+  EXPECT_GE(p50, 0);
+  EXPECT_LE(p50, p99);
+}
+
+TEST_F(BackendMetricFilterTest, QuantilesOnlyChangeOncePerWindow) {
+  ScopedTimeCache time_cache;
+  Timestamp now = Timestamp::Now();
+  auto channel =
+      MakeChannel(ChannelArgs().Set(GRPC_ARG_SERVER_CALL_LATENCY_METRICS, true))
+          .value();
+  const BackendMetricData* first = RunCall(channel);
+  ASSERT_NE(first, nullptr);
+  // Calls that finish within the window report the same quantiles.
+  for (int i = 0; i < 10; ++i) {
+    const BackendMetricData* report = RunCall(channel);
+    ASSERT_NE(report, nullptr);
+    EXPECT_EQ(report->named_metrics.at(kLatencyP50),
+              first->named_metrics.at(kLatencyP50));
+    EXPECT_EQ(report->named_metrics.at(kLatencyP99),
+              first->named_metrics.at(kLatencyP99));
+  }
+  // The first call after the window folds it into the quantiles.
+  now = now + Duration::Seconds(1);
+  time_cache.TestOnlySetNow(now);
+  const BackendMetricData* next = RunCall(channel);
+  ASSERT_NE(next, nullptr);
+  EXPECT_GE(next->named_metrics.at(kLatencyP50), 0);
+  EXPECT_LE(next->named_metrics.at(kLatencyP50),
+            next->named_metrics.at(kLatencyP99));
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
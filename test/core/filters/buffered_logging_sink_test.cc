@@ -0,0 +1,151 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/filters/logging/buffered_logging_sink.h"
+
+#include <grpc/event_engine/event_engine.h>
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "absl/functional/any_invocable.h"
+#include "absl/strings/string_view.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "src/core/util/time.h"
+#include "test/core/event_engine/mock_event_engine.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+using grpc_event_engine::experimental::EventEngine;
+using grpc_event_engine::experimental::MockEventEngine;
+using ::testing::_;
+using ::testing::NiceMock;
+
+// Records the batches it is handed.
+class CollectingSink final : public LoggingSink {
+ public:
+  Config FindMatch(bool /*is_client*/, absl::string_view /*service*/,
+                   absl::string_view /*method*/) override {
+    return Config(1, 1);
+  }
+  void LogEntry(Entry entry) override {
+    std::vector<Entry> entries;
+    entries.push_back(std::move(entry));
+    LogEntries(std::move(entries));
+  }
+  void LogEntries(std::vector<Entry> entries) override {
+    batches.push_back(std::move(entries));
+  }
+
+  std::vector<std::vector<Entry>> batches;
+};
+
+// Holds the closures the sink schedules until the test runs them.
+class BufferedLoggingSinkTest : public ::testing::Test {
+ protected:
+  BufferedLoggingSinkTest() {
+    ON_CALL(*event_engine_, Run(::testing::An<absl::AnyInvocable<void()>>()))
+        .WillByDefault([this](absl::AnyInvocable<void()> closure) {
+          pending_.push_back(std::move(closure));
+        });
+    ON_CALL(*event_engine_,
+            RunAfter(_, ::testing::An<absl::AnyInvocable<void()>>()))
+        .WillByDefault([this](EventEngine::Duration /*when*/,
+                              absl::AnyInvocable<void()> closure) {
+          pending_.push_back(std::move(closure));
+          return EventEngine::TaskHandle::kInvalid;
+        });
+  }
+
+  std::shared_ptr<BufferedLoggingSink> MakeSink(size_t max_entries) {
+    BufferedLoggingSink::Options options;
+    options.max_entries_per_shard = max_entries;
+    options.max_shards = 1;
+    return std::make_shared<BufferedLoggingSink>(&sink_, options,
+                                                 event_engine_);
+  }
+
+  static LoggingSink::Entry MakeEntry(int sequence_id) {
+    LoggingSink::Entry entry;
+    entry.sequence_id = sequence_id;
+    entry.timestamp = Timestamp::Now();
+    return entry;
+  }
+
+  void RunPending() {
+    auto pending = std::move(pending_);
+    pending_.clear();
+    for (auto& closure : pending) closure();
+  }
+
+  CollectingSink sink_;
+  std::shared_ptr<NiceMock<MockEventEngine>> event_engine_ =
+      std::make_shared<NiceMock<MockEventEngine>>();
+  std::vector<absl::AnyInvocable<void()>> pending_;
+};
+
+TEST_F(BufferedLoggingSinkTest, FlushesOnTimerInOneBatch) {
+  auto buffered = MakeSink(100);
+  EXPECT_CALL(*event_engine_,
+              RunAfter(_, ::testing::An<absl::AnyInvocable<void()>>()))
+      .Times(1);
+  for (int i = 0; i < 10; ++i) buffered->LogEntry(MakeEntry(i));
+  EXPECT_TRUE(sink_.batches.empty());
+  RunPending();
+  ASSERT_EQ(sink_.batches.size(), 1);
+  ASSERT_EQ(sink_.batches[0].size(), 10);
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_EQ(sink_.batches[0][i].sequence_id, i);
+  }
+  EXPECT_EQ(buffered->dropped_entries(), 0);
+}
+
+TEST_F(BufferedLoggingSinkTest, DropsEntriesWhenFull) {
+  auto buffered = MakeSink(4);
+  for (int i = 0; i < 10; ++i) buffered->LogEntry(MakeEntry(i));
+  EXPECT_EQ(buffered->dropped_entries(), 6);
+  buffered->Flush();
+  ASSERT_EQ(sink_.batches.size(), 1);
+  EXPECT_EQ(sink_.batches[0].size(), 4);
+  // Once drained, the buffer accepts entries again.
+  buffered->LogEntry(MakeEntry(10));
+  buffered->Flush();
+  ASSERT_EQ(sink_.batches.size(), 2);
+  EXPECT_EQ(sink_.batches[1][0].sequence_id, 10);
+  EXPECT_EQ(buffered->dropped_entries(), 6);
+}
+
+TEST_F(BufferedLoggingSinkTest, FlushesOnDestruction) {
+  auto buffered = MakeSink(100);
+  buffered->LogEntry(MakeEntry(0));
+  buffered.reset();
+  ASSERT_EQ(sink_.batches.size(), 1);
+  EXPECT_EQ(sink_.batches[0].size(), 1);
+  // A flush scheduled for a destroyed sink does nothing.
+  RunPending();
+  EXPECT_EQ(sink_.batches.size(), 1);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
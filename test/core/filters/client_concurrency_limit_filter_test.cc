@@ -0,0 +1,120 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/filters/concurrency_limit/client_concurrency_limit_filter.h"
+
+#include <grpc/impl/channel_arg_names.h>
+
+#include <memory>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "src/core/client_channel/client_channel_args.h"
+#include "src/core/util/time.h"
+#include "test/core/filters/filter_test.h"
+
+using ::testing::StrictMock;
+
+namespace grpc_core {
+namespace {
+
+TEST(ClientConcurrencyLimiterTest, SharedByTarget) {
+  auto a = ClientConcurrencyLimiter::Get("shared-a", 100);
+  EXPECT_EQ(ClientConcurrencyLimiter::Get("shared-a", 100), a);
+  EXPECT_NE(ClientConcurrencyLimiter::Get("shared-b", 100), a);
+}
+
+TEST(ClientConcurrencyLimiterTest, LimitsInFlightCalls) {
+  auto limiter = ClientConcurrencyLimiter::Get("in-flight", 5);
+  EXPECT_EQ(limiter->limit(), 5);
+  for (int i = 0; i < 5; ++i) EXPECT_TRUE(limiter->TryAcquire());
+  EXPECT_FALSE(limiter->TryAcquire());
+  limiter->Release();
+  EXPECT_TRUE(limiter->TryAcquire());
+  for (int i = 0; i < 5; ++i) limiter->Release();
+  EXPECT_EQ(limiter->in_flight(), 0);
+}
+
+TEST(ClientConcurrencyLimiterTest, GrowsWhileLatencyIsSteady) {
+  auto limiter = ClientConcurrencyLimiter::Get("steady", 100);
+  const int initial_limit = limiter->limit();
+  for (int i = 0; i < initial_limit; ++i) ASSERT_TRUE(limiter->TryAcquire());
+  for (int i = 0; i < 100; ++i) {
+    limiter->RecordLatency(Duration::Milliseconds(10));
+  }
+  EXPECT_GT(limiter->limit(), initial_limit);
+  for (int i = 0; i < initial_limit; ++i) limiter->Release();
+}
+
+TEST(ClientConcurrencyLimiterTest, DoesNotGrowWhileIdle) {
+  auto limiter = ClientConcurrencyLimiter::Get("idle", 100);
+  const int initial_limit = limiter->limit();
+  for (int i = 0; i < 100; ++i) {
+    limiter->RecordLatency(Duration::Milliseconds(10));
+  }
+  EXPECT_EQ(limiter->limit(), initial_limit);
+}
+
+TEST(ClientConcurrencyLimiterTest, ShrinksWhenLatencyRises) {
+  auto limiter = ClientConcurrencyLimiter::Get("brownout", 100);
+  const int initial_limit = limiter->limit();
+  for (int i = 0; i < 100; ++i) {
+    limiter->RecordLatency(Duration::Milliseconds(10));
+  }
+  for (int i = 0; i < 50; ++i) {
+    limiter->RecordLatency(Duration::Milliseconds(100));
+  }
+  EXPECT_LT(limiter->limit(), initial_limit / 2);
+  EXPECT_GE(limiter->limit(), 4);
+}
+
+using ClientConcurrencyLimitFilterTest =
+    FilterTest<ClientConcurrencyLimitFilter>;
+
+TEST_F(ClientConcurrencyLimitFilterTest, CreateFailsWithoutLimit) {
+  EXPECT_FALSE(MakeChannel(ChannelArgs()).ok());
+}
+
+TEST_F(ClientConcurrencyLimitFilterTest, FailsCallsOverTheLimit) {
+  // The smallest limit the limiter allows.
+  constexpr int kLimit = 4;
+  auto channel =
+      MakeChannel(ChannelArgs()
+                      .Set(GRPC_ARG_CLIENT_ADAPTIVE_CONCURRENCY_LIMIT, kLimit)
+                      .Set(GRPC_ARG_SERVER_URI, "dns:///filter-test"))
+          .value();
+  std::vector<std::unique_ptr<StrictMock<FilterTest::Call>>> calls;
+  for (int i = 0; i < kLimit; ++i) {
+    calls.push_back(std::make_unique<StrictMock<FilterTest::Call>>(channel));
+    EXPECT_EVENT(Started(calls.back().get(), ::testing::_));
+    calls.back()->Start(calls.back()->NewClientMetadata());
+    Step();
+  }
+  StrictMock<FilterTest::Call> rejected(channel);
+  rejected.Start(rejected.NewClientMetadata());
+  EXPECT_EVENT(Finished(
+      &rejected, HasMetadataResult(absl::ResourceExhaustedError(
+                     "Too many concurrent calls to the target"))));
+  Step();
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
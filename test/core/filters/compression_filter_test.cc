@@ -0,0 +1,175 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/filters/http/message_compress/compression_filter.h"
+
+#include <grpc/grpc.h>
+#include <grpc/impl/channel_arg_names.h>
+
+#include <optional>
+#include <string>
+#include <utility>
+
+#include "absl/random/random.h"
+#include "absl/strings/numbers.h"
+#include "gtest/gtest.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/event_engine/event_engine_context.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/promise/activity.h"
+#include "src/core/lib/promise/map.h"
+#include "src/core/lib/resource_quota/arena.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/slice/slice_buffer.h"
+#include "src/core/util/notification.h"
+#include "test/core/promise/test_wakeup_schedulers.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+MessageHandle MakeMessage(const std::string& payload) {
+  SliceBuffer buffer;
+  buffer.Append(Slice::FromCopiedString(payload));
+  return Arena::MakePooled<Message>(std::move(buffer), 0);
+}
+
+bool SentCompressed(const MessageHandle& message) {
+  return (message->flags() & GRPC_WRITE_INTERNAL_COMPRESS) != 0;
+}
+
+std::string RandomBytes(size_t n) {
+  absl::BitGen bitgen;
+  std::string bytes(n, '\0');
+  for (char& c : bytes) c = absl::Uniform<unsigned char>(bitgen);
+  return bytes;
+}
+
+// Runs the transform returned by start inside an activity, as the filter
+// would, and returns its result.
+template <typename Start>
+ServerMetadataOrHandle<Message> RunTransform(Start start) {
+  ExecCtx exec_ctx;
+  auto engine = grpc_event_engine::experimental::GetDefaultEventEngine();
+  auto arena = SimpleArenaAllocator()->MakeArena();
+  arena->SetContext<grpc_event_engine::experimental::EventEngine>(
+      engine.get());
+  std::optional<ServerMetadataOrHandle<Message>> result;
+  Notification done;
+  auto activity = MakeActivity(
+      [&]() {
+        return Map(start(), [&](ServerMetadataOrHandle<Message> r) {
+          result.emplace(std::move(r));
+          return absl::OkStatus();
+        });
+      },
+      InlineWakeupScheduler(), [&](absl::Status) { done.Notify(); },
+      std::move(arena));
+  done.WaitForNotification();
+  return std::move(*result);
+}
+
+TEST(CompressionFilterTest, SkipsSmallMessages) {
+  ChannelCompression compression(
+      ChannelArgs().Set(GRPC_ARG_COMPRESSION_MIN_MESSAGE_SIZE, 100));
+  EXPECT_FALSE(SentCompressed(compression.CompressMessage(
+      MakeMessage(std::string(99, 'a')), GRPC_COMPRESS_GZIP, nullptr,
+      nullptr)));
+  EXPECT_TRUE(SentCompressed(compression.CompressMessage(
+      MakeMessage(std::string(100, 'a')), GRPC_COMPRESS_GZIP, nullptr,
+      nullptr)));
+}
+
+TEST(CompressionFilterTest, AdaptiveCompressionDisabledByDefault) {
+  ChannelCompression compression((ChannelArgs()));
+  EXPECT_EQ(compression.GetMethodStats("/foo/bar"), nullptr);
+}
+
+TEST(CompressionFilterTest, AdaptiveCompressionBacksOffIncompressibleMethod) {
+  ChannelCompression compression(
+      ChannelArgs().Set(GRPC_ARG_ADAPTIVE_COMPRESSION, true));
+  auto* incompressible = compression.GetMethodStats("/foo/random");
+  auto* compressible = compression.GetMethodStats("/foo/text");
+  ASSERT_NE(incompressible, nullptr);
+  EXPECT_EQ(compression.GetMethodStats("/foo/random"), incompressible);
+  for (int i = 0; i < 64; ++i) {
+    EXPECT_FALSE(SentCompressed(compression.CompressMessage(
+        MakeMessage(RandomBytes(1024)), GRPC_COMPRESS_GZIP, nullptr,
+        incompressible)));
+    // Text on another method keeps being compressed.
+    EXPECT_TRUE(SentCompressed(compression.CompressMessage(
+        MakeMessage(std::string(1024, 'a')), GRPC_COMPRESS_GZIP, nullptr,
+        compressible)));
+  }
+  auto stats = compression.ToJsonObject().at("methodCompressionStats");
+  const Json::Object& random = stats.object().at("/foo/random").object();
+  EXPECT_EQ(random.at("messages").string(), "64");
+  // Random bytes never compress, so after a few tries the filter stops
+  // attempting them except for periodic samples.
+  int skipped = 0;
+  ASSERT_TRUE(absl::SimpleAtoi(random.at("skipped").string(), &skipped));
+  EXPECT_GT(skipped, 32);
+  EXPECT_EQ(stats.object().at("/foo/text").object().at("skipped").string(),
+            "0");
+}
+
+TEST(CompressionFilterTest, OffloadsLargeMessages) {
+  ChannelCompression compression(
+      ChannelArgs().Set(GRPC_ARG_COMPRESSION_OFFLOAD_THRESHOLD, 1024));
+  for (size_t size : {100, 100000}) {
+    const std::string payload(size, 'a');
+    auto compressed = RunTransform([&]() {
+      return compression.MaybeOffloadCompressMessage(
+          MakeMessage(payload), GRPC_COMPRESS_GZIP, nullptr, nullptr);
+    });
+    ASSERT_TRUE(compressed.ok());
+    EXPECT_TRUE(SentCompressed(*compressed));
+    EXPECT_LT((*compressed)->payload()->Length(), size);
+    auto decompressed = RunTransform([&]() {
+      return compression.MaybeOffloadDecompressMessage(
+          /*is_client=*/true, std::move(compressed).TakeValue(),
+          {GRPC_COMPRESS_GZIP, std::nullopt}, nullptr);
+    });
+    ASSERT_TRUE(decompressed.ok());
+    EXPECT_EQ((*decompressed)->payload()->JoinIntoString(), payload);
+  }
+}
+
+TEST(CompressionFilterTest, OffloadedDecompressionFailure) {
+  ChannelCompression compression(
+      ChannelArgs().Set(GRPC_ARG_COMPRESSION_OFFLOAD_THRESHOLD, 1));
+  auto result = RunTransform([&]() {
+    auto message = MakeMessage("not gzip at all");
+    message->mutable_flags() |= GRPC_WRITE_INTERNAL_COMPRESS;
+    return compression.MaybeOffloadDecompressMessage(
+        /*is_client=*/false, std::move(message),
+        {GRPC_COMPRESS_GZIP, std::nullopt}, nullptr);
+  });
+  ASSERT_FALSE(result.ok());
+  EXPECT_EQ(result.metadata()->get(GrpcStatusMetadata()),
+            GRPC_STATUS_INTERNAL);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc_init();
+  int ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
+}
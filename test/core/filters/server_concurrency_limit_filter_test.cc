@@ -0,0 +1,136 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/filters/concurrency_limit/server_concurrency_limit_filter.h"
+
+#include <grpc/impl/channel_arg_names.h>
+
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "src/core/util/time.h"
+#include "test/core/filters/filter_test.h"
+
+using ::testing::StrictMock;
+
+namespace grpc_core {
+namespace {
+
+TEST(ServerConcurrencyLimiterTest, LimitsEachMethodAndTenant) {
+  auto limiter = MakeRefCounted<ServerConcurrencyLimiter>(
+      2, "tenant", Duration::Infinity());
+  std::vector<ServerConcurrencyLimiter::Permit> permits;
+  for (int i = 0; i < 2; ++i) {
+    auto permit = limiter->TryAcquire("/svc/A", "alice");
+    ASSERT_TRUE(permit.has_value());
+    permits.push_back(std::move(*permit));
+  }
+  EXPECT_FALSE(limiter->TryAcquire("/svc/A", "alice").has_value());
+  // Other tenants and other methods have limits of their own.
+  EXPECT_TRUE(limiter->TryAcquire("/svc/A", "bob").has_value());
+  EXPECT_TRUE(limiter->TryAcquire("/svc/B", "alice").has_value());
+  permits.pop_back();
+  EXPECT_TRUE(limiter->TryAcquire("/svc/A", "alice").has_value());
+}
+
+TEST(ServerConcurrencyLimiterTest, LimitAdaptsToLatency) {
+  ScopedTimeCache time_cache;
+  Timestamp now = Timestamp::Now();
+  auto limiter = MakeRefCounted<ServerConcurrencyLimiter>(
+      10, "", Duration::Milliseconds(100));
+  auto run_call = [&](Duration latency) {
+    auto permit = limiter->TryAcquire("/svc/A", "");
+    ASSERT_TRUE(permit.has_value());
+    now = now + latency;
+    time_cache.TestOnlySetNow(now);
+  };
+  // Slow calls shrink the limit, down to one.
+  for (int i = 0; i < 50; ++i) run_call(Duration::Seconds(1));
+  EXPECT_EQ(limiter->TestOnlyLimit("/svc/A", ""), 1);
+  {
+    auto permit = limiter->TryAcquire("/svc/A", "");
+    ASSERT_TRUE(permit.has_value());
+    EXPECT_FALSE(limiter->TryAcquire("/svc/A", "").has_value());
+  }
+  // Fast calls grow it back, up to the maximum.
+  for (int i = 0; i < 100; ++i) run_call(Duration::Milliseconds(1));
+  EXPECT_EQ(limiter->TestOnlyLimit("/svc/A", ""), 10);
+}
+
+TEST(ServerConcurrencyLimiterTest, ForgetsLeastRecentlyIdleTenants) {
+  ScopedTimeCache time_cache;
+  Timestamp now = Timestamp::Now();
+  auto limiter = MakeRefCounted<ServerConcurrencyLimiter>(
+      10, "tenant", Duration::Milliseconds(100));
+  // One slow call each leaves every tenant idle with a shrunk limit.
+  constexpr int kNumTenants = 20000;
+  for (int i = 0; i < kNumTenants; ++i) {
+    auto permit = limiter->TryAcquire("/svc/A", absl::StrCat(i));
+    ASSERT_TRUE(permit.has_value());
+    now = now + Duration::Seconds(1);
+    time_cache.TestOnlySetNow(now);
+  }
+  EXPECT_EQ(limiter->TestOnlyLimit("/svc/A", "0"), 10);
+  EXPECT_EQ(limiter->TestOnlyLimit("/svc/A", absl::StrCat(kNumTenants - 1)),
+            9);
+}
+
+using ServerConcurrencyLimitFilterTest =
+    FilterTest<ServerConcurrencyLimitFilter>;
+
+TEST_F(ServerConcurrencyLimitFilterTest, CreateFailsWithoutLimit) {
+  EXPECT_FALSE(MakeChannel(ChannelArgs()).ok());
+}
+
+TEST_F(ServerConcurrencyLimitFilterTest, RejectsCallsOverTheLimit) {
+  auto channel =
+      MakeChannel(
+          ChannelArgs()
+              .Set(GRPC_ARG_SERVER_MAX_CONCURRENT_CALLS_PER_METHOD, 1)
+              .Set(GRPC_ARG_SERVER_CONCURRENCY_LIMIT_TENANT_METADATA,
+                   "x-tenant"))
+          .value();
+  StrictMock<FilterTest::Call> first(channel);
+  EXPECT_EVENT(Started(&first, ::testing::_));
+  first.Start(first.NewClientMetadata(
+      {{":path", "/svc/A"}, {"x-tenant", "alice"}}));
+  Step();
+  // Same method and tenant: rejected.
+  StrictMock<FilterTest::Call> second(channel);
+  second.Start(second.NewClientMetadata(
+      {{":path", "/svc/A"}, {"x-tenant", "alice"}}));
+  EXPECT_EVENT(Finished(
+      &second, HasMetadataResult(absl::ResourceExhaustedError(
+                   "Too many concurrent calls to this method"))));
+  Step();
+  // Another tenant: allowed.
+  StrictMock<FilterTest::Call> third(channel);
+  EXPECT_EVENT(Started(&third, ::testing::_));
+  third.Start(
+      third.NewClientMetadata({{":path", "/svc/A"}, {"x-tenant", "bob"}}));
+  Step();
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,304 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include "src/core/handshaker/security/security_handshaker.h"
+
+#include <grpc/credentials.h>
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/grpc.h>
+#include <grpc/impl/channel_arg_names.h>
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/synchronization/notification.h"
+#include "gtest/gtest.h"
+#include "src/core/client_channel/client_channel_args.h"
+#include "src/core/credentials/transport/transport_credentials.h"
+#include "src/core/handshaker/handshaker.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/experiments/config.h"
+#include "src/core/lib/iomgr/endpoint_pair.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
+#include "src/core/transport/auth_context.h"
+#include "src/core/tsi/local_transport_security.h"
+#include "src/core/tsi/transport_security.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+using ::grpc_event_engine::experimental::EventEngine;
+using ::grpc_event_engine::experimental::GetDefaultEventEngine;
+
+// A TSI handshaker whose only step optionally blocks until released, and then
+// fails.
+struct FakeTsiHandshaker {
+  tsi_handshaker base;
+  absl::Notification* started;
+  absl::Notification* release;
+};
+
+tsi_result FakeNext(tsi_handshaker* self, const unsigned char*, size_t,
+                    const unsigned char**, size_t*, tsi_handshaker_result**,
+                    tsi_handshaker_on_next_done_cb, void*, std::string* error) {
+  auto* h = reinterpret_cast<FakeTsiHandshaker*>(self);
+  if (h->started != nullptr) h->started->Notify();
+  if (h->release != nullptr) h->release->WaitForNotification();
+  *error = "fake handshaker";
+  return TSI_INTERNAL_ERROR;
+}
+
+void FakeDestroy(tsi_handshaker* self) {
+  delete reinterpret_cast<FakeTsiHandshaker*>(self);
+}
+
+const tsi_handshaker_vtable kFakeVtable = {
+    nullptr, nullptr, nullptr, nullptr, nullptr, FakeDestroy, FakeNext,
+    nullptr};
+
+tsi_handshaker* MakeFakeTsiHandshaker(absl::Notification* started,
+                                      absl::Notification* release) {
+  auto* h = new FakeTsiHandshaker();
+  h->base.vtable = &kFakeVtable;
+  h->started = started;
+  h->release = release;
+  return &h->base;
+}
+
+class SecurityHandshakerTest : public ::testing::Test {
+ protected:
+  SecurityHandshakerTest()
+      : engine_(GetDefaultEventEngine()),
+        creds_(grpc_insecure_server_credentials_create()),
+        connector_(creds_->create_security_connector(ChannelArgs())) {}
+
+  ~SecurityHandshakerTest() override { creds_->Unref(); }
+
+  // Starts a handshake that allows at most \a max_pending offloaded steps,
+  // and returns a notification that fires when it finishes.
+  std::shared_ptr<absl::Notification> StartHandshake(
+      tsi_handshaker* tsi_handshaker, int max_pending, absl::Status* status) {
+    auto args = std::make_unique<HandshakerArgs>();
+    args->args = ChannelArgs()
+                     .SetObject(engine_)
+                     .Set(GRPC_ARG_SECURITY_HANDSHAKE_OFFLOAD_MAX_PENDING,
+                          max_pending);
+    args->event_engine = engine_.get();
+    auto handshaker =
+        SecurityHandshakerCreate(tsi_handshaker, connector_.get(), args->args);
+    auto done = std::make_shared<absl::Notification>();
+    HandshakerArgs* args_ptr = args.get();
+    ExecCtx exec_ctx;
+    handshaker->DoHandshake(
+        args_ptr, [handshaker, args = std::move(args), done,
+                   status](absl::Status s) mutable {
+          *status = std::move(s);
+          done->Notify();
+        });
+    return done;
+  }
+
+  std::shared_ptr<EventEngine> engine_;
+  grpc_server_credentials* creds_;
+  RefCountedPtr<grpc_server_security_connector> connector_;
+};
+
+TEST_F(SecurityHandshakerTest, ShedsNewHandshakesWhenOffloadQueueIsFull) {
+  absl::Notification started;
+  absl::Notification release;
+  absl::Status first_status;
+  auto first_done = StartHandshake(MakeFakeTsiHandshaker(&started, &release),
+                                   /*max_pending=*/1, &first_status);
+  started.WaitForNotification();
+  // The first handshake's step occupies the only slot, so the second one is
+  // refused without ever reaching its TSI handshaker.
+  auto before = global_stats().Collect();
+  absl::Notification second_started;
+  absl::Status second_status;
+  StartHandshake(MakeFakeTsiHandshaker(&second_started, nullptr),
+                 /*max_pending=*/1, &second_status)
+      ->WaitForNotification();
+  EXPECT_EQ(second_status.code(), absl::StatusCode::kResourceExhausted)
+      << second_status;
+  EXPECT_FALSE(second_started.HasBeenNotified());
+  EXPECT_EQ(global_stats().Collect()->Diff(*before)->security_handshakes_shed,
+            1);
+  release.Notify();
+  first_done->WaitForNotification();
+  EXPECT_EQ(first_status.code(), absl::StatusCode::kUnknown) << first_status;
+}
+
+TEST_F(SecurityHandshakerTest, DoesNotShedWithoutLimit) {
+  absl::Notification started;
+  absl::Notification release;
+  absl::Status first_status;
+  auto first_done = StartHandshake(MakeFakeTsiHandshaker(&started, &release),
+                                   /*max_pending=*/0, &first_status);
+  started.WaitForNotification();
+  absl::Notification second_started;
+  absl::Status second_status;
+  auto second_done =
+      StartHandshake(MakeFakeTsiHandshaker(&second_started, nullptr),
+                     /*max_pending=*/0, &second_status);
+  release.Notify();
+  first_done->WaitForNotification();
+  second_done->WaitForNotification();
+  EXPECT_TRUE(second_started.HasBeenNotified());
+  EXPECT_NE(second_status.code(), absl::StatusCode::kResourceExhausted)
+      << second_status;
+}
+
+// What a successful handshake hands to the transport.
+struct HandshakeOutcome {
+  absl::Status status;
+  // The properties of the auth context attached to the channel args, in
+  // order, as name and value.
+  std::vector<std::pair<std::string, std::string>> auth_properties;
+  std::string peer_identity_property_name;
+  // The names and values of the peer identity properties.
+  std::vector<std::pair<std::string, std::string>> peer_identity;
+  // Whether the transport gets the endpoint the handshake started with.
+  bool same_endpoint = false;
+};
+
+std::vector<std::pair<std::string, std::string>> PropertiesOf(
+    grpc_auth_property_iterator it) {
+  std::vector<std::pair<std::string, std::string>> properties;
+  while (const grpc_auth_property* prop =
+             grpc_auth_property_iterator_next(&it)) {
+    properties.emplace_back(prop->name,
+                            std::string(prop->value, prop->value_length));
+  }
+  return properties;
+}
+
+// Runs \a handshaker to completion over one end of a unix socket pair.
+HandshakeOutcome RunHandshake(RefCountedPtr<Handshaker> handshaker) {
+  HandshakeOutcome outcome;
+  auto engine = GetDefaultEventEngine();
+  grpc_endpoint_pair endpoints =
+      grpc_iomgr_create_endpoint_pair("security_handshaker_test", nullptr);
+  grpc_endpoint* endpoint = endpoints.server;
+  auto args = std::make_unique<HandshakerArgs>();
+  args->endpoint.reset(endpoint);
+  args->args = ChannelArgs().SetObject(engine);
+  args->event_engine = engine.get();
+  args->deadline = Timestamp::InfFuture();
+  absl::Notification done;
+  {
+    ExecCtx exec_ctx;
+    handshaker->DoHandshake(args.get(), [&](absl::Status status) {
+      outcome.status = std::move(status);
+      done.Notify();
+    });
+  }
+  done.WaitForNotification();
+  ExecCtx exec_ctx;
+  auto* auth_context = args->args.GetObject<grpc_auth_context>();
+  if (auth_context != nullptr) {
+    outcome.auth_properties =
+        PropertiesOf(grpc_auth_context_property_iterator(auth_context));
+    const char* name =
+        grpc_auth_context_peer_identity_property_name(auth_context);
+    if (name != nullptr) outcome.peer_identity_property_name = name;
+    outcome.peer_identity =
+        PropertiesOf(grpc_auth_context_peer_identity(auth_context));
+  }
+  outcome.same_endpoint = args->endpoint.get() == endpoint;
+  args.reset();
+  OrphanablePtr<grpc_endpoint>(endpoints.client).reset();
+  return outcome;
+}
+
+// Checks that the handshaker \a connector now uses, which only checks the
+// peer, gives the transport what a full handshake with the local TSI
+// handshaker - which these connectors used before - would.
+void ExpectSameAsLocalTsiHandshake(grpc_security_connector* connector) {
+  tsi_handshaker* tsi_handshaker = nullptr;
+  ASSERT_EQ(tsi_local_handshaker_create(&tsi_handshaker), TSI_OK);
+  HandshakeOutcome full = RunHandshake(
+      SecurityHandshakerCreate(tsi_handshaker, connector, ChannelArgs()));
+  HandshakeOutcome peer_check =
+      RunHandshake(SecurityPeerCheckHandshakerCreate(connector));
+  ASSERT_TRUE(full.status.ok()) << full.status;
+  ASSERT_TRUE(peer_check.status.ok()) << peer_check.status;
+  EXPECT_FALSE(full.auth_properties.empty());
+  EXPECT_EQ(peer_check.auth_properties, full.auth_properties);
+  EXPECT_EQ(peer_check.peer_identity_property_name,
+            full.peer_identity_property_name);
+  EXPECT_EQ(peer_check.peer_identity, full.peer_identity);
+  EXPECT_TRUE(full.same_endpoint);
+  EXPECT_TRUE(peer_check.same_endpoint);
+}
+
+TEST(SecurityPeerCheckHandshakerTest, InsecureServerMatchesTsiHandshake) {
+  grpc_server_credentials* creds = grpc_insecure_server_credentials_create();
+  auto connector = creds->create_security_connector(ChannelArgs());
+  ExpectSameAsLocalTsiHandshake(connector.get());
+  connector.reset();
+  grpc_server_credentials_release(creds);
+}
+
+TEST(SecurityPeerCheckHandshakerTest, InsecureChannelMatchesTsiHandshake) {
+  grpc_channel_credentials* creds = grpc_insecure_credentials_create();
+  ChannelArgs args;
+  auto connector = creds->create_security_connector(nullptr, "target", &args);
+  ExpectSameAsLocalTsiHandshake(connector.get());
+  connector.reset();
+  grpc_channel_credentials_release(creds);
+}
+
+TEST(SecurityPeerCheckHandshakerTest, LocalServerMatchesTsiHandshake) {
+  grpc_server_credentials* creds = grpc_local_server_credentials_create(UDS);
+  auto connector = creds->create_security_connector(ChannelArgs());
+  ExpectSameAsLocalTsiHandshake(connector.get());
+  connector.reset();
+  grpc_server_credentials_release(creds);
+}
+
+TEST(SecurityPeerCheckHandshakerTest, LocalChannelMatchesTsiHandshake) {
+  grpc_channel_credentials* creds = grpc_local_credentials_create(UDS);
+  ChannelArgs args = ChannelArgs().Set(GRPC_ARG_SERVER_URI, "unix:");
+  auto connector = creds->create_security_connector(nullptr, "unix:", &args);
+  ASSERT_NE(connector, nullptr);
+  ExpectSameAsLocalTsiHandshake(connector.get());
+  connector.reset();
+  grpc_channel_credentials_release(creds);
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  grpc_core::ForceEnableExperiment("security_handshake_offload", true);
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc_init();
+  int ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
+}
@@ -0,0 +1,102 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Measures how an address update flows through a priority ->
+// weighted_target -> leaf hierarchy: each level splits its addresses by
+// the next element of their hierarchical path, and each leaf then walks
+// its own addresses once.
+
+#include <benchmark/benchmark.h>
+#include <string.h>
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "absl/log/check.h"
+#include "absl/strings/str_cat.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/load_balancing/address_filtering.h"
+#include "src/core/resolver/endpoint_addresses.h"
+#include "src/core/util/ref_counted_string.h"
+
+namespace grpc_core {
+namespace {
+
+constexpr size_t kPriorities = 2;
+
+// state.range(0) endpoints, spread evenly over state.range(1) localities in
+// each of kPriorities priorities.
+std::shared_ptr<EndpointAddressesIterator> MakeEndpoints(
+    const benchmark::State& state) {
+  const size_t num_endpoints = state.range(0);
+  const size_t num_localities = state.range(1);
+  EndpointAddressesList endpoints;
+  endpoints.reserve(num_endpoints);
+  std::vector<RefCountedPtr<HierarchicalPathArg>> paths;
+  for (size_t p = 0; p < kPriorities; ++p) {
+    for (size_t l = 0; l < num_localities; ++l) {
+      paths.push_back(MakeRefCounted<HierarchicalPathArg>(
+          std::vector<RefCountedStringValue>{
+              RefCountedStringValue(absl::StrCat("priority", p)),
+              RefCountedStringValue(absl::StrCat("locality", l))}));
+    }
+  }
+  const size_t per_path = (num_endpoints + paths.size() - 1) / paths.size();
+  for (size_t i = 0; i < num_endpoints; ++i) {
+    grpc_resolved_address address;
+    memset(&address, 0, sizeof(address));
+    memcpy(address.addr, &i, sizeof(i));
+    address.len = sizeof(i);
+    endpoints.emplace_back(address,
+                           ChannelArgs().SetObject(paths[i / per_path]));
+  }
+  return std::make_shared<EndpointAddressesListIterator>(std::move(endpoints));
+}
+
+void BM_HierarchicalUpdate(benchmark::State& state) {
+  auto endpoints = MakeEndpoints(state);
+  for (auto _ : state) {
+    size_t delivered = 0;
+    auto priorities = MakeHierarchicalAddressMap(endpoints);
+    CHECK_OK(priorities);
+    for (const auto& [priority, priority_addresses] : *priorities) {
+      auto localities = MakeHierarchicalAddressMap(priority_addresses);
+      CHECK_OK(localities);
+      for (const auto& [locality, locality_addresses] : *localities) {
+        locality_addresses->ForEach(
+            [&](const EndpointAddresses&) { ++delivered; });
+      }
+    }
+    CHECK_EQ(delivered, static_cast<size_t>(state.range(0)));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_HierarchicalUpdate)
+    ->ArgsProduct({{100, 1000, 10000}, {1, 10, 100}});
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  ::benchmark::Initialize(&argc, argv);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
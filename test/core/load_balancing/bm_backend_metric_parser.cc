@@ -0,0 +1,108 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Measures ParseBackendMetricData, which the client channel runs for every
+// call that carries an ORCA load report in its trailing metadata.
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <deque>
+#include <string>
+
+#include "absl/log/check.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "src/core/load_balancing/backend_metric_data.h"
+#include "src/core/load_balancing/backend_metric_parser.h"
+#include "upb/base/string_view.h"
+#include "upb/mem/arena.hpp"
+#include "xds/data/orca/v3/orca_load_report.upb.h"
+
+namespace grpc_core {
+namespace {
+
+// Keeps everything it hands out until the next Reset(), like the call
+// arena does.
+class Allocator : public BackendMetricAllocatorInterface {
+ public:
+  BackendMetricData* AllocateBackendMetricData() override {
+    return &data_.emplace_back();
+  }
+
+  char* AllocateString(size_t size) override {
+    return strings_.emplace_back(size, '\0').data();
+  }
+
+  void Reset() {
+    data_.clear();
+    strings_.clear();
+  }
+
+ private:
+  std::deque<BackendMetricData> data_;
+  std::deque<std::string> strings_;
+};
+
+// A serialized report with the utilization fields set and \a num_named
+// named metrics.
+std::string MakeLoadReport(int num_named) {
+  upb::Arena arena;
+  auto* report = xds_data_orca_v3_OrcaLoadReport_new(arena.ptr());
+  xds_data_orca_v3_OrcaLoadReport_set_cpu_utilization(report, 0.5);
+  xds_data_orca_v3_OrcaLoadReport_set_mem_utilization(report, 0.25);
+  xds_data_orca_v3_OrcaLoadReport_set_application_utilization(report, 0.75);
+  xds_data_orca_v3_OrcaLoadReport_set_rps_fractional(report, 1000);
+  xds_data_orca_v3_OrcaLoadReport_set_eps(report, 10);
+  std::deque<std::string> names;
+  for (int i = 0; i < num_named; ++i) {
+    const std::string& name = names.emplace_back(absl::StrCat("metric_", i));
+    xds_data_orca_v3_OrcaLoadReport_named_metrics_set(
+        report, upb_StringView_FromDataAndSize(name.data(), name.size()), i,
+        arena.ptr());
+  }
+  size_t length;
+  char* buf =
+      xds_data_orca_v3_OrcaLoadReport_serialize(report, arena.ptr(), &length);
+  CHECK_NE(buf, nullptr);
+  return std::string(buf, length);
+}
+
+void BM_ParseBackendMetricData(benchmark::State& state) {
+  const std::string report = MakeLoadReport(state.range(0));
+  Allocator allocator;
+  for (auto _ : state) {
+    const BackendMetricData* data =
+        ParseBackendMetricData(report, &allocator);
+    benchmark::DoNotOptimize(data);
+    allocator.Reset();
+  }
+  state.SetBytesProcessed(state.iterations() * report.size());
+}
+BENCHMARK(BM_ParseBackendMetricData)->Arg(0)->Arg(4)->Arg(16)->Arg(64);
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  ::benchmark::Initialize(&argc, argv);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -0,0 +1,167 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Measures the WorkSerializer time a petiole policy spends handling one
+// endpoint's health check flapping from READY to TRANSIENT_FAILURE and
+// back, with every other endpoint staying READY.
+
+#include <benchmark/benchmark.h>
+#include <grpc/grpc.h>
+
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/log/check.h"
+#include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "src/core/lib/address_utils/parse_address.h"
+#include "src/core/lib/address_utils/sockaddr_utils.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/load_balancing/lb_policy.h"
+#include "test/core/test_util/build.h"
+#include "test/core/test_util/lb_benchmark_helper.h"
+
+namespace grpc_core {
+namespace {
+
+bool IsSlowBuild() {
+  return BuiltUnderMsan() || BuiltUnderUbsan() || BuiltUnderTsan();
+}
+
+std::string AddressString(size_t i) {
+  return absl::StrCat("ipv4:127.0.", i / 65536, ".", i / 256 % 256, ":",
+                      i % 256 + 1);
+}
+
+class ChurnHelper {
+ public:
+  ChurnHelper(absl::string_view name, absl::string_view config,
+              size_t num_endpoints)
+      : helper_(name) {
+    EndpointAddressesList addresses;
+    for (size_t i = 0; i < num_endpoints; ++i) {
+      grpc_resolved_address addr;
+      CHECK(grpc_parse_uri(URI::Parse(AddressString(i)).value(), &addr));
+      addresses.emplace_back(addr, ChannelArgs());
+      addresses_.push_back(grpc_sockaddr_to_string(&addr, false).value());
+    }
+    helper_.Update(std::move(addresses),
+                   testing::LbBenchmarkHelper::ParseConfig(config));
+  }
+
+  // Makes picks for many different request hashes, so that ring_hash
+  // connects to all of its endpoints.
+  void ConnectAllByHash(const char* header) {
+    for (size_t i = 0; i < 20 * addresses_.size(); ++i) {
+      ExecCtx exec_ctx;
+      FakeMetadata metadata(header, absl::StrCat(i));
+      helper_.GetPicker()->Pick(
+          LoadBalancingPolicy::PickArgs{"/foo/bar", &metadata, nullptr});
+    }
+    helper_.RunInWorkSerializer([]() {});
+  }
+
+  // Flaps the health of one endpoint and returns how long the
+  // WorkSerializer spent handling it.
+  absl::Duration Flap(size_t index) {
+    absl::Duration elapsed;
+    helper_.RunInWorkSerializer([&]() {
+      const absl::Time start = absl::Now();
+      helper_.SetHealthLocked(addresses_[index],
+                              GRPC_CHANNEL_TRANSIENT_FAILURE,
+                              absl::UnavailableError("health check failed"));
+      helper_.SetHealthLocked(addresses_[index], GRPC_CHANNEL_READY,
+                              absl::OkStatus());
+      // Anything the flap queued runs before this.
+      helper_.work_serializer()->Run(
+          [&, start]() { elapsed = absl::Now() - start; });
+    });
+    helper_.RunInWorkSerializer([]() {});
+    return elapsed;
+  }
+
+ private:
+  class FakeMetadata final : public LoadBalancingPolicy::MetadataInterface {
+   public:
+    FakeMetadata(absl::string_view key, std::string value)
+        : key_(key), value_(std::move(value)) {}
+
+    std::optional<absl::string_view> Lookup(
+        absl::string_view key, std::string* /*buffer*/) const override {
+      if (key != key_) return std::nullopt;
+      return value_;
+    }
+
+   private:
+    absl::string_view key_;
+    std::string value_;
+  };
+
+  testing::LbBenchmarkHelper helper_;
+  std::vector<std::string> addresses_;
+};
+
+void BM_EndpointChurn(benchmark::State& state, absl::string_view policy,
+                      absl::string_view config, const char* hash_header) {
+  const size_t num_endpoints = state.range(0);
+  ChurnHelper helper(policy, config, num_endpoints);
+  if (hash_header != nullptr) helper.ConnectAllByHash(hash_header);
+  absl::Duration work_serializer_run_time;
+  size_t i = 0;
+  for (auto _ : state) {
+    work_serializer_run_time += helper.Flap(i++ % num_endpoints);
+  }
+  state.counters["work_serializer_run_time_ms"] = benchmark::Counter(
+      absl::ToDoubleMilliseconds(work_serializer_run_time),
+      benchmark::Counter::kAvgIterations);
+}
+
+#define CHURN_BENCHMARK(policy, config, hash_header)          \
+  BENCHMARK_CAPTURE(BM_EndpointChurn, policy, #policy, config, \
+                    hash_header)                               \
+      ->Arg(100)                                               \
+      ->Arg(1000)                                              \
+      ->Arg(IsSlowBuild() ? 1000 : 5000)                       \
+      ->UseRealTime()
+
+CHURN_BENCHMARK(round_robin, "[{\"round_robin\":{}}]", nullptr);
+CHURN_BENCHMARK(weighted_round_robin,
+                "[{\"weighted_round_robin\":{\"enableOobLoadReport\":false}}]",
+                nullptr);
+CHURN_BENCHMARK(
+    ring_hash_experimental,
+    "[{\"ring_hash_experimental\":{\"requestHashHeader\":\"x-hash\"}}]",
+    "x-hash");
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  ::benchmark::Initialize(&argc, argv);
+  grpc_init();
+  benchmark::RunTheBenchmarksNamespaced();
+  grpc_shutdown();
+  return 0;
+}
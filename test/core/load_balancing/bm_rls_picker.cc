@@ -0,0 +1,165 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Measures RLS pick throughput for requests whose keys are all in the cache.
+// Compare runs with and without GRPC_EXPERIMENTS=rls_lock_free_picks.
+
+#include <benchmark/benchmark.h>
+#include <grpc/grpc.h>
+#include <grpcpp/security/server_credentials.h>
+#include <grpcpp/server.h>
+#include <grpcpp/server_builder.h>
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "absl/log/check.h"
+#include "absl/strings/str_cat.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "src/core/config/core_configuration.h"
+#include "src/core/load_balancing/lb_policy.h"
+#include "test/core/test_util/lb_benchmark_helper.h"
+#include "test/core/test_util/port.h"
+#include "test/core/test_util/test_lb_policies.h"
+#include "test/cpp/end2end/rls_server.h"
+
+namespace grpc_core {
+namespace {
+
+using grpc::testing::BuildRlsRequest;
+using grpc::testing::BuildRlsResponse;
+using grpc::testing::RlsServiceImpl;
+
+// Number of distinct request keys, and of targets they map to.
+constexpr size_t kNumKeys = 1000;
+constexpr size_t kNumTargets = 16;
+
+std::string KeyName(size_t i) { return absl::StrCat("m", i); }
+
+class RlsBenchmarkHelper {
+ public:
+  RlsBenchmarkHelper() {
+    const int port = grpc_pick_unused_port_or_die();
+    grpc::ServerBuilder builder;
+    builder.AddListeningPort(absl::StrCat("localhost:", port),
+                             grpc::InsecureServerCredentials());
+    builder.RegisterService(&rls_service_);
+    server_ = builder.BuildAndStart();
+    CHECK(server_ != nullptr);
+    for (size_t i = 0; i < kNumKeys; ++i) {
+      rls_service_.SetResponse(
+          BuildRlsRequest({{"m", KeyName(i)}}),
+          BuildRlsResponse(
+              {absl::StrCat("ipv4:127.0.0.1:", 1000 + i % kNumTargets)}));
+      paths_.push_back(absl::StrCat("/foo/", KeyName(i)));
+    }
+    auto config = testing::LbBenchmarkHelper::ParseConfig(absl::StrCat(
+        "[{\"rls_experimental\":{"
+        "  \"routeLookupConfig\":{"
+        "    \"lookupService\":\"localhost:",
+        port,
+        "\","
+        "    \"cacheSizeBytes\":10485760,"
+        "    \"maxAge\":\"3600s\","
+        "    \"grpcKeybuilders\":[{"
+        "      \"names\":[{\"service\":\"foo\"}],"
+        "      \"extraKeys\":{\"method\":\"m\"}"
+        "    }]"
+        "  },"
+        "  \"childPolicy\":[{\"fixed_address_lb\":{}}],"
+        "  \"childPolicyConfigTargetFieldName\":\"address\""
+        "}}]"));
+    helper_.Update(EndpointAddressesList(), std::move(config));
+    WaitForAllKeysCached();
+  }
+
+  const std::vector<std::string>& paths() const { return paths_; }
+
+  RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> GetPicker() {
+    return helper_.GetPicker();
+  }
+
+ private:
+  // The first pick for each key starts its RLS request; the cache is warm
+  // once every key completes on the same picker.
+  void WaitForAllKeysCached() {
+    while (true) {
+      auto picker = GetPicker();
+      bool all_complete = true;
+      for (const std::string& path : paths_) {
+        auto result = picker->Pick(
+            LoadBalancingPolicy::PickArgs{path, nullptr, nullptr});
+        if (!std::holds_alternative<LoadBalancingPolicy::PickResult::Complete>(
+                result.result)) {
+          all_complete = false;
+        }
+      }
+      if (all_complete) return;
+      absl::SleepFor(absl::Milliseconds(10));
+    }
+  }
+
+  RlsServiceImpl rls_service_;
+  std::unique_ptr<grpc::Server> server_;
+  std::vector<std::string> paths_;
+  testing::LbBenchmarkHelper helper_{"rls_experimental"};
+};
+
+RlsBenchmarkHelper& GetHelper() {
+  static auto* helper = new RlsBenchmarkHelper();
+  return *helper;
+}
+
+// Every thread picks from the same picker over state.range(0) keys, so with
+// more than one thread the picks contend on whatever the picker shares.
+void BM_RlsCachedPick(benchmark::State& state) {
+  const std::vector<std::string>& paths = GetHelper().paths();
+  auto picker = GetHelper().GetPicker();
+  const size_t num_keys = state.range(0);
+  size_t i = state.thread_index();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(picker->Pick(LoadBalancingPolicy::PickArgs{
+        paths[i % num_keys], nullptr, nullptr}));
+    ++i;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_RlsCachedPick)
+    ->Arg(1)
+    ->Arg(kNumKeys)
+    ->ThreadRange(1, 16)
+    ->UseRealTime();
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  ::benchmark::Initialize(&argc, argv);
+  grpc_core::CoreConfiguration::RegisterEphemeralBuilder(
+      grpc_core::RegisterFixedAddressLoadBalancingPolicy);
+  grpc_init();
+  benchmark::RunTheBenchmarksNamespaced();
+  grpc_shutdown();
+  return 0;
+}
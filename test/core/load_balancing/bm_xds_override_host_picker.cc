@@ -0,0 +1,172 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Measures xds_override_host picks for calls whose session cookie names a
+// READY endpoint, as done for stateful session affinity.
+
+#include <benchmark/benchmark.h>
+#include <grpc/grpc.h>
+
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "absl/log/check.h"
+#include "absl/log/log.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "src/core/client_channel/client_channel_internal.h"
+#include "src/core/ext/filters/stateful_session/stateful_session_filter.h"
+#include "src/core/lib/address_utils/parse_address.h"
+#include "src/core/load_balancing/lb_policy.h"
+#include "src/core/resolver/xds/xds_config.h"
+#include "src/core/util/sync.h"
+#include "src/core/xds/grpc/xds_cluster.h"
+#include "src/core/xds/grpc/xds_health_status.h"
+#include "test/core/test_util/build.h"
+#include "test/core/test_util/lb_benchmark_helper.h"
+
+namespace grpc_core {
+namespace {
+
+constexpr absl::string_view kClusterName = "cluster_name";
+
+bool IsSlowBuild() {
+  return BuiltUnderMsan() || BuiltUnderUbsan() || BuiltUnderTsan();
+}
+
+std::string AddressString(size_t index) {
+  return absl::StrCat("127.", (index >> 16) & 0xff, ".", (index >> 8) & 0xff,
+                      ".", index & 0xff, ":443");
+}
+
+// An xds_override_host policy over round_robin whose subchannels, and
+// their health, are all READY as soon as they are watched.
+class BenchmarkHelper {
+ public:
+  BenchmarkHelper()
+      : config_(testing::LbBenchmarkHelper::ParseConfig(absl::StrCat(
+            "[{\"xds_override_host_experimental\":{\"clusterName\":\"",
+            kClusterName, "\",\"childPolicy\":[{\"round_robin\":{}}]}}]"))) {}
+
+  // Returns a picker for num_endpoints READY endpoints.  Safe to call
+  // from several benchmark threads at once.
+  RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> GetPicker(
+      size_t num_endpoints) {
+    MutexLock lock(&pickers_mu_);
+    auto& picker = pickers_[num_endpoints];
+    if (picker == nullptr) picker = UpdateAndGetPicker(num_endpoints);
+    return picker;
+  }
+
+ private:
+  RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> UpdateAndGetPicker(
+      size_t num_endpoints) {
+    auto cluster_resource = std::make_shared<XdsClusterResource>();
+    cluster_resource->override_host_statuses.Add(
+        XdsHealthStatus(XdsHealthStatus::kUnknown));
+    auto xds_config = MakeRefCounted<XdsConfig>();
+    xds_config->clusters[std::string(kClusterName)].emplace(
+        std::move(cluster_resource), nullptr, "");
+    EndpointAddressesList addresses;
+    for (size_t i = 0; i < num_endpoints; ++i) {
+      grpc_resolved_address addr;
+      CHECK(grpc_parse_uri(
+          URI::Parse(absl::StrCat("ipv4:", AddressString(i))).value(), &addr));
+      addresses.emplace_back(addr, ChannelArgs());
+    }
+    // Once every connectivity and health notification has been delivered,
+    // the last picker reported has every endpoint READY.
+    helper_.Update(std::move(addresses), config_,
+                   ChannelArgs().SetObject(
+                       RefCountedPtr<const XdsConfig>(std::move(xds_config))));
+    CHECK_EQ(helper_.state(), GRPC_CHANNEL_READY);
+    return helper_.GetPicker();
+  }
+
+  testing::LbBenchmarkHelper helper_{"xds_override_host_experimental"};
+  RefCountedPtr<LoadBalancingPolicy::Config> config_;
+  Mutex pickers_mu_;
+  std::map<size_t, RefCountedPtr<LoadBalancingPolicy::SubchannelPicker>>
+      pickers_ ABSL_GUARDED_BY(pickers_mu_);
+};
+
+class CookieCallState final : public ClientChannelLbCallState {
+ public:
+  explicit CookieCallState(XdsOverrideHostAttribute* attribute)
+      : attribute_(attribute) {}
+
+  void* Alloc(size_t /*size*/) override { LOG(FATAL) << "unimplemented"; }
+
+  ServiceConfigCallData::CallAttributeInterface* GetCallAttribute(
+      UniqueTypeName type) const override {
+    if (type == XdsOverrideHostAttribute::TypeName()) return attribute_;
+    return nullptr;
+  }
+
+  ClientCallTracer::CallAttemptTracer* GetCallAttemptTracer() const override {
+    return nullptr;
+  }
+
+ private:
+  XdsOverrideHostAttribute* attribute_;
+};
+
+BenchmarkHelper& Helper() {
+  static auto* helper = new BenchmarkHelper();
+  return *helper;
+}
+
+void BM_PickWithCookie(benchmark::State& state) {
+  const size_t num_endpoints = state.range(0);
+  auto picker = Helper().GetPicker(num_endpoints);
+  // Cookies spread over the endpoints, as many sessions would be.
+  std::vector<std::string> cookies;
+  for (size_t i = 0; i < 1024; ++i) {
+    cookies.push_back(AddressString((i * 7919) % num_endpoints));
+  }
+  size_t i = 0;
+  for (auto _ : state) {
+    XdsOverrideHostAttribute attribute(cookies[i++ % cookies.size()]);
+    CookieCallState call_state(&attribute);
+    auto result = picker->Pick(
+        LoadBalancingPolicy::PickArgs{"/foo/bar", nullptr, &call_state});
+    CHECK(std::holds_alternative<LoadBalancingPolicy::PickResult::Complete>(
+        result.result));
+  }
+}
+BENCHMARK(BM_PickWithCookie)
+    ->RangeMultiplier(10)
+    ->Range(10, IsSlowBuild() ? 1000 : 10000)
+    ->ThreadRange(1, 8);
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  ::benchmark::Initialize(&argc, argv);
+  grpc_init();
+  benchmark::RunTheBenchmarksNamespaced();
+  grpc_shutdown();
+  return 0;
+}
@@ -0,0 +1,165 @@
+//
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <grpc/grpc.h>
+
+#include <array>
+#include <memory>
+#include <optional>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "absl/log/check.h"
+#include "absl/status/status.h"
+#include "absl/strings/string_view.h"
+#include "gtest/gtest.h"
+#include "src/core/config/core_configuration.h"
+#include "src/core/util/json/json.h"
+#include "src/core/util/json/json_reader.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "test/core/load_balancing/lb_policy_test_lib.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+class LeastRequestTest : public LoadBalancingPolicyTest {
+ protected:
+  LeastRequestTest() : LoadBalancingPolicyTest("least_request") {}
+
+  static RefCountedPtr<LoadBalancingPolicy::Config> MakeLeastRequestConfig(
+      int choice_count) {
+    return MakeConfig(Json::FromArray({Json::FromObject(
+        {{"least_request",
+          Json::FromObject(
+              {{"choiceCount", Json::FromNumber(choice_count)}})}})}));
+  }
+
+  // Connects every address and returns the picker from the last update.
+  RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> ExpectStartup(
+      absl::Span<const absl::string_view> addresses) {
+    for (size_t i = 0; i < addresses.size(); ++i) {
+      auto* subchannel = FindSubchannel(addresses[i]);
+      EXPECT_NE(subchannel, nullptr) << addresses[i];
+      if (subchannel == nullptr) return nullptr;
+      EXPECT_TRUE(subchannel->ConnectionRequested());
+      subchannel->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+      if (i == 0) EXPECT_TRUE(ExpectConnectingUpdate());
+    }
+    FindSubchannel(addresses[0])->SetConnectivityState(GRPC_CHANNEL_READY);
+    auto picker = WaitForConnected();
+    for (size_t i = 1; i < addresses.size(); ++i) {
+      FindSubchannel(addresses[i])->SetConnectivityState(GRPC_CHANNEL_READY);
+    }
+    return DrainReadyUpdates(std::move(picker));
+  }
+
+  // Returns the picker from the last of any queued READY updates, or
+  // picker if there are none.
+  RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> DrainReadyUpdates(
+      RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> picker) {
+    while (!helper_->QueueEmpty()) {
+      picker = ExpectState(GRPC_CHANNEL_READY);
+      if (picker == nullptr) break;
+    }
+    return picker;
+  }
+};
+
+TEST_F(LeastRequestTest, PicksEndpointWithFewestCallsInFlight) {
+  const std::array<absl::string_view, 3> kAddresses = {
+      "ipv4:127.0.0.1:441", "ipv4:127.0.0.1:442", "ipv4:127.0.0.1:443"};
+  // With as many choices as endpoints, every pick looks at all of them.
+  EXPECT_EQ(ApplyUpdate(BuildUpdate(kAddresses, MakeLeastRequestConfig(3)),
+                        lb_policy()),
+            absl::OkStatus());
+  auto picker = ExpectStartup(kAddresses);
+  ASSERT_NE(picker, nullptr);
+  // Calls that are still in flight spread over all endpoints.
+  std::vector<
+      std::unique_ptr<LoadBalancingPolicy::SubchannelCallTrackerInterface>>
+      trackers;
+  auto picks = GetCompletePicks(picker.get(), 3, {}, &trackers);
+  ASSERT_TRUE(picks.has_value());
+  EXPECT_EQ(std::set<std::string>(picks->begin(), picks->end()).size(), 3);
+  // Once one of them finishes, its endpoint is the least loaded.
+  ReportCompletionToCallTracker(std::move(trackers[1]), (*picks)[1]);
+  EXPECT_EQ(ExpectPickComplete(picker.get()), (*picks)[1]);
+  // A pick that is abandoned before its call starts stops counting too.
+  std::unique_ptr<LoadBalancingPolicy::SubchannelCallTrackerInterface>
+      abandoned;
+  EXPECT_EQ(ExpectPickComplete(picker.get(), {}, {}, &abandoned), (*picks)[1]);
+  abandoned.reset();
+  EXPECT_EQ(ExpectPickComplete(picker.get()), (*picks)[1]);
+}
+
+TEST_F(LeastRequestTest, CountsSurvivePickerUpdates) {
+  const std::array<absl::string_view, 2> kAddresses = {"ipv4:127.0.0.1:441",
+                                                       "ipv4:127.0.0.1:442"};
+  EXPECT_EQ(ApplyUpdate(BuildUpdate(kAddresses, MakeLeastRequestConfig(2)),
+                        lb_policy()),
+            absl::OkStatus());
+  auto picker = ExpectStartup(kAddresses);
+  ASSERT_NE(picker, nullptr);
+  std::unique_ptr<LoadBalancingPolicy::SubchannelCallTrackerInterface> tracker;
+  auto busy = ExpectPickComplete(picker.get(), {}, {}, &tracker);
+  ASSERT_TRUE(busy.has_value());
+  // Re-sending the same addresses creates a new endpoint list, whose picker
+  // still sees the call in flight.
+  EXPECT_EQ(ApplyUpdate(BuildUpdate(kAddresses, MakeLeastRequestConfig(2)),
+                        lb_policy()),
+            absl::OkStatus());
+  picker = DrainReadyUpdates(std::move(picker));
+  ASSERT_NE(picker, nullptr);
+  for (int i = 0; i < 10; ++i) {
+    auto address = ExpectPickComplete(picker.get());
+    ASSERT_TRUE(address.has_value());
+    EXPECT_NE(*address, *busy);
+  }
+  ReportCompletionToCallTracker(std::move(tracker), *busy);
+}
+
+TEST(LeastRequestConfigTest, ChoiceCount) {
+  auto parse = [](absl::string_view json) {
+    auto parsed = JsonParse(json);
+    CHECK_OK(parsed);
+    return CoreConfiguration::Get()
+        .lb_policy_registry()
+        .ParseLoadBalancingConfig(*parsed);
+  };
+  EXPECT_TRUE(parse("[{\"least_request\":{}}]").ok());
+  EXPECT_TRUE(parse("[{\"least_request\":{\"choiceCount\":20}}]").ok());
+  auto config = parse("[{\"least_request\":{\"choiceCount\":1}}]");
+  EXPECT_EQ(config.status(),
+            absl::InvalidArgumentError(
+                "errors validating least_request LB policy config: "
+                "[field:choiceCount error:must be at least 2]"));
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  grpc_init();
+  int ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
+}
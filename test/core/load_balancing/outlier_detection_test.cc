@@ -111,6 +111,23 @@ class OutlierDetectionTest : public LoadBalancingPolicyTest {
       return *this;
     }
 
+    ConfigBuilder& SetLatencyPercentile(uint32_t value) {
+      GetLatency()["percentile"] = Json::FromNumber(value);
+      return *this;
+    }
+    ConfigBuilder& SetLatencyThresholdFactor(uint32_t value) {
+      GetLatency()["thresholdFactor"] = Json::FromNumber(value);
+      return *this;
+    }
+    ConfigBuilder& SetLatencyMinimumHosts(uint32_t value) {
+      GetLatency()["minimumHosts"] = Json::FromNumber(value);
+      return *this;
+    }
+    ConfigBuilder& SetLatencyRequestVolume(uint32_t value) {
+      GetLatency()["requestVolume"] = Json::FromNumber(value);
+      return *this;
+    }
+
     RefCountedPtr<LoadBalancingPolicy::Config> Build() {
       Json::Object fields = json_;
       if (success_rate_.has_value()) {
@@ -120,6 +137,9 @@ class OutlierDetectionTest : public LoadBalancingPolicyTest {
         fields["failurePercentageEjection"] =
             Json::FromObject(*failure_percentage_);
       }
+      if (latency_.has_value()) {
+        fields["latencyEjection"] = Json::FromObject(*latency_);
+      }
       Json config = Json::FromArray(
           {Json::FromObject({{"outlier_detection_experimental",
                               Json::FromObject(std::move(fields))}})});
@@ -137,9 +157,15 @@ class OutlierDetectionTest : public LoadBalancingPolicyTest {
       return *failure_percentage_;
     }
 
+    Json::Object& GetLatency() {
+      if (!latency_.has_value()) latency_.emplace();
+      return *latency_;
+    }
+
     Json::Object json_;
     std::optional<Json::Object> success_rate_;
     std::optional<Json::Object> failure_percentage_;
+    std::optional<Json::Object> latency_;
   };
 
   OutlierDetectionTest()
@@ -166,6 +192,24 @@ class OutlierDetectionTest : public LoadBalancingPolicyTest {
     }
     return address;
   }
+
+  // Does a pick and reports a successful call that took latency.
+  std::optional<std::string> DoPickWithSuccessfulCall(
+      LoadBalancingPolicy::SubchannelPicker* picker, Duration latency) {
+    std::unique_ptr<LoadBalancingPolicy::SubchannelCallTrackerInterface>
+        subchannel_call_tracker;
+    auto address = ExpectPickComplete(picker, {}, {}, &subchannel_call_tracker);
+    if (address.has_value()) {
+      subchannel_call_tracker->Start();
+      if (latency > Duration::Zero()) IncrementTimeBy(latency);
+      FakeMetadata metadata({});
+      FakeBackendMetricAccessor backend_metric_accessor({});
+      LoadBalancingPolicy::SubchannelCallTrackerInterface::FinishArgs args = {
+          *address, absl::OkStatus(), &metadata, &backend_metric_accessor};
+      subchannel_call_tracker->Finish(args);
+    }
+    return address;
+  }
 };
 
 TEST_F(OutlierDetectionTest, Basic) {
@@ -234,6 +278,51 @@ TEST_F(OutlierDetectionTest, FailurePercentage) {
   WaitForRoundRobinListChange(remaining_addresses, kAddresses);
 }
 
+TEST_F(OutlierDetectionTest, Latency) {
+  constexpr std::array<absl::string_view, 3> kAddresses = {
+      "ipv4:127.0.0.1:440", "ipv4:127.0.0.1:441", "ipv4:127.0.0.1:442"};
+  // Send initial update.
+  absl::Status status = ApplyUpdate(
+      BuildUpdate(kAddresses, ConfigBuilder()
+                                  .SetLatencyPercentile(50)
+                                  .SetLatencyThresholdFactor(3000)
+                                  .SetLatencyMinimumHosts(3)
+                                  .SetLatencyRequestVolume(1)
+                                  .SetMaxEjectionTime(Duration::Seconds(1))
+                                  .SetBaseEjectionTime(Duration::Seconds(1))
+                                  .Build()),
+      lb_policy());
+  EXPECT_TRUE(status.ok()) << status;
+  // Expect normal startup.
+  auto picker = ExpectRoundRobinStartup(kAddresses);
+  ASSERT_NE(picker, nullptr);
+  LOG(INFO) << "### RR startup complete";
+  // Report a slow call on one endpoint and fast calls on the others.
+  auto address = DoPickWithSuccessfulCall(picker.get(), Duration::Seconds(2));
+  ASSERT_TRUE(address.has_value());
+  LOG(INFO) << "### slow RPC on " << *address;
+  for (size_t i = 0; i < 2; ++i) {
+    auto fast_address =
+        DoPickWithSuccessfulCall(picker.get(), Duration::Zero());
+    ASSERT_TRUE(fast_address.has_value());
+    ASSERT_NE(*fast_address, *address);
+  }
+  // Advance time and run the timer callback to trigger ejection.
+  IncrementTimeBy(Duration::Seconds(8));
+  LOG(INFO) << "### ejection complete";
+  // Expect a picker update.
+  std::vector<absl::string_view> remaining_addresses;
+  for (const auto& addr : kAddresses) {
+    if (addr != *address) remaining_addresses.push_back(addr);
+  }
+  WaitForRoundRobinListChange(kAddresses, remaining_addresses);
+  // Advance time and run the timer callback to trigger un-ejection.
+  IncrementTimeBy(Duration::Seconds(10));
+  LOG(INFO) << "### un-ejection complete";
+  // Expect a picker update.
+  WaitForRoundRobinListChange(remaining_addresses, kAddresses);
+}
+
 TEST_F(OutlierDetectionTest, MultipleAddressesPerEndpoint) {
   // Can't use timer duration expectation here, because the Happy
   // Eyeballs timer inside pick_first will use a different duration than
@@ -0,0 +1,260 @@
+//
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <grpc/grpc.h>
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <optional>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "absl/log/check.h"
+#include "absl/status/status.h"
+#include "absl/strings/string_view.h"
+#include "gtest/gtest.h"
+#include "src/core/config/core_configuration.h"
+#include "src/core/util/json/json.h"
+#include "src/core/util/json/json_reader.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/time.h"
+#include "test/core/load_balancing/lb_policy_test_lib.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+class PeakEwmaTest : public LoadBalancingPolicyTest {
+ protected:
+  PeakEwmaTest() : LoadBalancingPolicyTest("peak_ewma") {}
+
+  static RefCountedPtr<LoadBalancingPolicy::Config> MakePeakEwmaConfig(
+      int choice_count = 2, absl::string_view decay_time = "10s") {
+    return MakeConfig(Json::FromArray({Json::FromObject(
+        {{"peak_ewma",
+          Json::FromObject(
+              {{"choiceCount", Json::FromNumber(choice_count)},
+               {"decayTime", Json::FromString(std::string(decay_time))}})}})}));
+  }
+
+  // Connects every address and returns the picker from the last update.
+  RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> ExpectStartup(
+      absl::Span<const absl::string_view> addresses) {
+    for (size_t i = 0; i < addresses.size(); ++i) {
+      auto* subchannel = FindSubchannel(addresses[i]);
+      EXPECT_NE(subchannel, nullptr) << addresses[i];
+      if (subchannel == nullptr) return nullptr;
+      EXPECT_TRUE(subchannel->ConnectionRequested());
+      subchannel->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+      if (i == 0) EXPECT_TRUE(ExpectConnectingUpdate());
+    }
+    FindSubchannel(addresses[0])->SetConnectivityState(GRPC_CHANNEL_READY);
+    auto picker = WaitForConnected();
+    for (size_t i = 1; i < addresses.size(); ++i) {
+      FindSubchannel(addresses[i])->SetConnectivityState(GRPC_CHANNEL_READY);
+    }
+    return DrainReadyUpdates(std::move(picker));
+  }
+
+  // Returns the picker from the last of any queued READY updates, or
+  // picker if there are none.
+  RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> DrainReadyUpdates(
+      RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> picker) {
+    while (!helper_->QueueEmpty()) {
+      picker = ExpectState(GRPC_CHANNEL_READY);
+      if (picker == nullptr) break;
+    }
+    return picker;
+  }
+
+  // Starts a call on the next pick and returns its address.
+  std::optional<std::string> StartCall(
+      LoadBalancingPolicy::SubchannelPicker* picker,
+      std::unique_ptr<LoadBalancingPolicy::SubchannelCallTrackerInterface>*
+          tracker) {
+    auto address = ExpectPickComplete(picker, {}, {}, tracker);
+    if (address.has_value()) (*tracker)->Start();
+    return address;
+  }
+
+  // Unlike ReportCompletionToCallTracker(), does not restart the call, so
+  // that the time since StartCall() counts as its latency.
+  void FinishCall(
+      std::unique_ptr<LoadBalancingPolicy::SubchannelCallTrackerInterface>
+          tracker,
+      absl::string_view address) {
+    FakeMetadata metadata({});
+    FakeBackendMetricAccessor backend_metric_accessor({});
+    tracker->Finish(
+        {address, absl::OkStatus(), &metadata, &backend_metric_accessor});
+  }
+
+  // Makes one call to each address, taking the corresponding latency.
+  void MakeCallsWithLatencies(
+      LoadBalancingPolicy::SubchannelPicker* picker,
+      absl::Span<const absl::string_view> addresses,
+      absl::Span<const Duration> latencies) {
+    // Unmeasured endpoints with a call in flight are avoided, so the first
+    // addresses.size() calls go to distinct endpoints.
+    std::vector<
+        std::unique_ptr<LoadBalancingPolicy::SubchannelCallTrackerInterface>>
+        trackers(addresses.size());
+    std::vector<std::string> picked(addresses.size());
+    for (size_t i = 0; i < addresses.size(); ++i) {
+      auto address = StartCall(picker, &trackers[i]);
+      ASSERT_TRUE(address.has_value());
+      picked[i] = *address;
+    }
+    EXPECT_EQ(std::set<std::string>(picked.begin(), picked.end()).size(),
+              addresses.size());
+    // Finish the calls in order of latency.
+    std::vector<size_t> order(addresses.size());
+    for (size_t i = 0; i < order.size(); ++i) order[i] = i;
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+      return latencies[a] < latencies[b];
+    });
+    Duration elapsed;
+    for (size_t i : order) {
+      auto it = std::find(picked.begin(), picked.end(), addresses[i]);
+      ASSERT_NE(it, picked.end()) << addresses[i];
+      IncrementTimeBy(latencies[i] - elapsed);
+      elapsed = latencies[i];
+      FinishCall(std::move(trackers[it - picked.begin()]), addresses[i]);
+    }
+  }
+};
+
+TEST_F(PeakEwmaTest, PrefersLowerLatency) {
+  const std::array<absl::string_view, 2> kAddresses = {"ipv4:127.0.0.1:441",
+                                                       "ipv4:127.0.0.1:442"};
+  EXPECT_EQ(ApplyUpdate(BuildUpdate(kAddresses, MakePeakEwmaConfig()),
+                        lb_policy()),
+            absl::OkStatus());
+  auto picker = ExpectStartup(kAddresses);
+  ASSERT_NE(picker, nullptr);
+  MakeCallsWithLatencies(
+      picker.get(), kAddresses,
+      {Duration::Milliseconds(100), Duration::Milliseconds(1)});
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_EQ(ExpectPickComplete(picker.get()), kAddresses[1]);
+  }
+  // Enough calls in flight to the faster endpoint outweigh its latency.
+  std::vector<
+      std::unique_ptr<LoadBalancingPolicy::SubchannelCallTrackerInterface>>
+      trackers;
+  auto picks = GetCompletePicks(picker.get(), 200, {}, &trackers);
+  ASSERT_TRUE(picks.has_value());
+  EXPECT_NE(std::find(picks->begin(), picks->end(), kAddresses[0]),
+            picks->end());
+}
+
+TEST_F(PeakEwmaTest, ProbesNewEndpoints) {
+  const std::array<absl::string_view, 2> kAddresses = {"ipv4:127.0.0.1:441",
+                                                       "ipv4:127.0.0.1:442"};
+  EXPECT_EQ(ApplyUpdate(BuildUpdate(kAddresses, MakePeakEwmaConfig()),
+                        lb_policy()),
+            absl::OkStatus());
+  auto picker = ExpectStartup(kAddresses);
+  ASSERT_NE(picker, nullptr);
+  MakeCallsWithLatencies(
+      picker.get(), kAddresses,
+      {Duration::Milliseconds(100), Duration::Milliseconds(10)});
+  // Add a third endpoint, looking at all endpoints on every pick.  Its
+  // first call goes to it even though nothing is known about it; while that
+  // call is in flight, it is avoided.  The latencies measured for the other
+  // endpoints are still used.
+  const std::array<absl::string_view, 3> kNewAddresses = {
+      "ipv4:127.0.0.1:441", "ipv4:127.0.0.1:442", "ipv4:127.0.0.1:443"};
+  EXPECT_EQ(ApplyUpdate(BuildUpdate(kNewAddresses, MakePeakEwmaConfig(3)),
+                        lb_policy()),
+            absl::OkStatus());
+  auto* subchannel = FindSubchannel(kNewAddresses[2]);
+  ASSERT_NE(subchannel, nullptr);
+  EXPECT_TRUE(subchannel->ConnectionRequested());
+  subchannel->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+  subchannel->SetConnectivityState(GRPC_CHANNEL_READY);
+  picker = DrainReadyUpdates(std::move(picker));
+  ASSERT_NE(picker, nullptr);
+  std::unique_ptr<LoadBalancingPolicy::SubchannelCallTrackerInterface> tracker;
+  EXPECT_EQ(StartCall(picker.get(), &tracker), kNewAddresses[2]);
+  EXPECT_EQ(ExpectPickComplete(picker.get()), kNewAddresses[1]);
+  FinishCall(std::move(tracker), kNewAddresses[2]);
+}
+
+TEST_F(PeakEwmaTest, StaleLatencyDecays) {
+  const std::array<absl::string_view, 2> kAddresses = {"ipv4:127.0.0.1:441",
+                                                       "ipv4:127.0.0.1:442"};
+  EXPECT_EQ(ApplyUpdate(BuildUpdate(kAddresses, MakePeakEwmaConfig(2, "1s")),
+                        lb_policy()),
+            absl::OkStatus());
+  auto picker = ExpectStartup(kAddresses);
+  ASSERT_NE(picker, nullptr);
+  MakeCallsWithLatencies(
+      picker.get(), kAddresses,
+      {Duration::Milliseconds(100), Duration::Milliseconds(10)});
+  // Keep the faster endpoint busy at a steady 10ms.  The slower endpoint's
+  // only measurement ages, until it becomes cheaper than the faster one
+  // and gets probed again.
+  for (int i = 0; i < 500; ++i) {
+    std::unique_ptr<LoadBalancingPolicy::SubchannelCallTrackerInterface>
+        tracker;
+    auto address = StartCall(picker.get(), &tracker);
+    ASSERT_TRUE(address.has_value());
+    if (*address == kAddresses[0]) {
+      FinishCall(std::move(tracker), *address);
+      // Roughly ln(100ms / 10ms) decay times in.
+      EXPECT_GT(i, 100);
+      return;
+    }
+    IncrementTimeBy(Duration::Milliseconds(10));
+    FinishCall(std::move(tracker), *address);
+  }
+  FAIL() << "slower endpoint never probed again";
+}
+
+TEST(PeakEwmaConfigTest, Validation) {
+  auto parse = [](absl::string_view json) {
+    auto parsed = JsonParse(json);
+    CHECK_OK(parsed);
+    return CoreConfiguration::Get()
+        .lb_policy_registry()
+        .ParseLoadBalancingConfig(*parsed);
+  };
+  EXPECT_TRUE(parse("[{\"peak_ewma\":{}}]").ok());
+  auto config = parse(
+      "[{\"peak_ewma\":{\"choiceCount\":1,\"decayTime\":\"0s\"}}]");
+  EXPECT_EQ(config.status(),
+            absl::InvalidArgumentError(
+                "errors validating peak_ewma LB policy config: ["
+                "field:choiceCount error:must be at least 2; "
+                "field:decayTime error:must be greater than 0]"));
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  grpc_init();
+  int ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
+}
@@ -1056,6 +1056,93 @@ TEST_F(PickFirstTest, GoesIdleWhenConnectionFailsThenCanReconnect) {
   }
 }
 
+TEST_F(PickFirstTest, FailsOverToStandbyConnection) {
+  constexpr std::array<absl::string_view, 2> kAddresses = {
+      "ipv4:127.0.0.1:443", "ipv4:127.0.0.1:444"};
+  absl::Status status = ApplyUpdate(
+      BuildUpdate(kAddresses,
+                  MakeConfig(Json::FromArray({Json::FromObject(
+                      {{"pick_first",
+                        Json::FromObject({{"standbyConnections",
+                                           Json::FromNumber(1)}})}})}))),
+      lb_policy());
+  EXPECT_TRUE(status.ok()) << status;
+  auto* subchannel = FindSubchannel(kAddresses[0]);
+  ASSERT_NE(subchannel, nullptr);
+  auto* subchannel2 = FindSubchannel(kAddresses[1]);
+  ASSERT_NE(subchannel2, nullptr);
+  EXPECT_TRUE(subchannel->ConnectionRequested());
+  subchannel->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+  ExpectConnectingUpdate();
+  subchannel->SetConnectivityState(GRPC_CHANNEL_READY);
+  auto picker = WaitForConnected();
+  ASSERT_NE(picker, nullptr);
+  EXPECT_EQ(ExpectPickComplete(picker.get()), kAddresses[0]);
+  // Once the first address is selected, the second is connected as a
+  // standby, without any change in the reported state.
+  WaitForWorkSerializerToFlush();
+  EXPECT_TRUE(subchannel2->ConnectionRequested());
+  subchannel2->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+  subchannel2->SetConnectivityState(GRPC_CHANNEL_READY);
+  EXPECT_TRUE(helper_->QueueEmpty());
+  // When the selected connection fails, we move to the standby instead
+  // of going IDLE.
+  subchannel->SetConnectivityState(GRPC_CHANNEL_IDLE);
+  picker = ExpectState(GRPC_CHANNEL_READY);
+  ASSERT_NE(picker, nullptr);
+  ExpectReresolutionRequest();
+  for (size_t i = 0; i < 3; ++i) {
+    EXPECT_EQ(ExpectPickComplete(picker.get()), kAddresses[1]);
+  }
+  // The first address is now the standby, so it reconnects.
+  WaitForWorkSerializerToFlush();
+  EXPECT_TRUE(subchannel->ConnectionRequested());
+}
+
+TEST_F(PickFirstTest, SwitchesToStandbyBeforeMaxConnectionAge) {
+  SetExpectedTimerDuration(std::nullopt);
+  constexpr std::array<absl::string_view, 2> kAddresses = {
+      "ipv4:127.0.0.1:443", "ipv4:127.0.0.1:444"};
+  absl::Status status = ApplyUpdate(
+      BuildUpdate(kAddresses,
+                  MakeConfig(Json::FromArray({Json::FromObject(
+                      {{"pick_first",
+                        Json::FromObject(
+                            {{"standbyConnections", Json::FromNumber(1)},
+                             {"maxConnectionAge",
+                              Json::FromString("100s")}})}})}))),
+      lb_policy());
+  EXPECT_TRUE(status.ok()) << status;
+  auto* subchannel = FindSubchannel(kAddresses[0]);
+  ASSERT_NE(subchannel, nullptr);
+  auto* subchannel2 = FindSubchannel(kAddresses[1]);
+  ASSERT_NE(subchannel2, nullptr);
+  EXPECT_TRUE(subchannel->ConnectionRequested());
+  subchannel->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+  ExpectConnectingUpdate();
+  subchannel->SetConnectivityState(GRPC_CHANNEL_READY);
+  auto picker = WaitForConnected();
+  ASSERT_NE(picker, nullptr);
+  EXPECT_EQ(ExpectPickComplete(picker.get()), kAddresses[0]);
+  WaitForWorkSerializerToFlush();
+  EXPECT_TRUE(subchannel2->ConnectionRequested());
+  subchannel2->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+  subchannel2->SetConnectivityState(GRPC_CHANNEL_READY);
+  // Nothing changes until 90% of the max connection age has passed.
+  IncrementTimeBy(Duration::Seconds(89));
+  EXPECT_TRUE(helper_->QueueEmpty());
+  // Then we move to the standby while the old connection is still up.
+  IncrementTimeBy(Duration::Seconds(1));
+  picker = ExpectState(GRPC_CHANNEL_READY);
+  ASSERT_NE(picker, nullptr);
+  EXPECT_EQ(ExpectPickComplete(picker.get()), kAddresses[1]);
+  // When the server closes the old connection, nothing is reported, and
+  // it reconnects as a standby.
+  subchannel->SetConnectivityState(GRPC_CHANNEL_IDLE);
+  EXPECT_TRUE(helper_->QueueEmpty());
+  EXPECT_TRUE(subchannel->ConnectionRequested());
+}
+
 TEST_F(PickFirstTest, AddressUpdateRemovedSelectedAddress) {
   // Send an update containing two addresses.
   constexpr std::array<absl::string_view, 2> kAddresses = {
@@ -1448,6 +1535,91 @@ TEST_F(PickFirstTest, MetricValues) {
       ::testing::Optional(1));
 }
 
+class PickFirstConnectionRaceTest : public PickFirstTest {
+ protected:
+  PickFirstConnectionRaceTest()
+      : PickFirstTest(ChannelArgs().Set(
+            GRPC_ARG_HAPPY_EYEBALLS_PARALLEL_CONNECTION_ATTEMPTS, 2)) {}
+};
+
+TEST_F(PickFirstConnectionRaceTest, RacesFirstAddresses) {
+  constexpr std::array<absl::string_view, 3> kAddresses = {
+      "ipv4:127.0.0.1:443", "ipv4:127.0.0.1:444", "ipv4:127.0.0.1:445"};
+  absl::Status status = ApplyUpdate(
+      BuildUpdate(kAddresses, MakePickFirstConfig(false)), lb_policy());
+  EXPECT_TRUE(status.ok()) << status;
+  auto* subchannel = FindSubchannel(kAddresses[0]);
+  ASSERT_NE(subchannel, nullptr);
+  auto* subchannel2 = FindSubchannel(kAddresses[1]);
+  ASSERT_NE(subchannel2, nullptr);
+  auto* subchannel3 = FindSubchannel(kAddresses[2]);
+  ASSERT_NE(subchannel3, nullptr);
+  // The first two subchannels are asked to connect right away.
+  EXPECT_TRUE(subchannel->ConnectionRequested());
+  EXPECT_TRUE(subchannel2->ConnectionRequested());
+  EXPECT_FALSE(subchannel3->ConnectionRequested());
+  subchannel->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+  ExpectConnectingUpdate();
+  subchannel2->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+  // The third one waits for the Connection Attempt Delay as usual.
+  IncrementTimeBy(Duration::Milliseconds(250));
+  EXPECT_TRUE(subchannel3->ConnectionRequested());
+  subchannel3->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+  DrainConnectingUpdates();
+  // The second subchannel wins the race.
+  subchannel2->SetConnectivityState(GRPC_CHANNEL_READY);
+  auto picker = WaitForConnected();
+  ASSERT_NE(picker, nullptr);
+  for (size_t i = 0; i < 3; ++i) {
+    EXPECT_EQ(ExpectPickComplete(picker.get()), kAddresses[1]);
+  }
+}
+
+class PickFirstAdaptiveConnectionAttemptDelayTest : public PickFirstTest {
+ protected:
+  PickFirstAdaptiveConnectionAttemptDelayTest()
+      : PickFirstTest(ChannelArgs().Set(
+            GRPC_ARG_HAPPY_EYEBALLS_ADAPTIVE_CONNECTION_ATTEMPT_DELAY, true)) {}
+};
+
+TEST_F(PickFirstAdaptiveConnectionAttemptDelayTest,
+       DelayShrinksAfterFastConnect) {
+  constexpr std::array<absl::string_view, 2> kAddresses = {
+      "ipv4:127.0.0.1:443", "ipv4:127.0.0.1:444"};
+  absl::Status status = ApplyUpdate(
+      BuildUpdate(kAddresses, MakePickFirstConfig(false)), lb_policy());
+  EXPECT_TRUE(status.ok()) << status;
+  auto* subchannel = FindSubchannel(kAddresses[0]);
+  ASSERT_NE(subchannel, nullptr);
+  auto* subchannel2 = FindSubchannel(kAddresses[1]);
+  ASSERT_NE(subchannel2, nullptr);
+  // With no history, the first pass uses the configured delay.
+  EXPECT_TRUE(subchannel->ConnectionRequested());
+  subchannel->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+  ExpectConnectingUpdate();
+  // The first subchannel connects after 20ms.
+  IncrementTimeBy(Duration::Milliseconds(20));
+  EXPECT_FALSE(subchannel2->ConnectionRequested());
+  subchannel->SetConnectivityState(GRPC_CHANNEL_READY);
+  auto picker = WaitForConnected();
+  ASSERT_NE(picker, nullptr);
+  EXPECT_EQ(ExpectPickComplete(picker.get()), kAddresses[0]);
+  // The connection drops, and the next pass starts when the picker is
+  // used.  Its delay is twice the connect time seen so far.
+  subchannel->SetConnectivityState(GRPC_CHANNEL_IDLE);
+  ExpectReresolutionRequest();
+  SetExpectedTimerDuration(std::chrono::milliseconds(40));
+  ExpectStateAndQueuingPicker(GRPC_CHANNEL_IDLE);
+  WaitForWorkSerializerToFlush();
+  WaitForWorkSerializerToFlush();
+  EXPECT_TRUE(subchannel->ConnectionRequested());
+  subchannel->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+  ExpectConnectingUpdate();
+  EXPECT_FALSE(subchannel2->ConnectionRequested());
+  IncrementTimeBy(Duration::Milliseconds(40));
+  EXPECT_TRUE(subchannel2->ConnectionRequested());
+}
+
 class PickFirstHealthCheckingEnabledTest : public PickFirstTest {
  protected:
   PickFirstHealthCheckingEnabledTest()
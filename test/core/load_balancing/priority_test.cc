@@ -0,0 +1,122 @@
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <grpc/grpc.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/strings/string_view.h"
+#include "gtest/gtest.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/load_balancing/address_filtering.h"
+#include "src/core/resolver/endpoint_addresses.h"
+#include "src/core/util/json/json.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/ref_counted_string.h"
+#include "test/core/load_balancing/lb_policy_test_lib.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+class PriorityTest : public LoadBalancingPolicyTest {
+ protected:
+  PriorityTest() : LoadBalancingPolicyTest("priority_experimental") {}
+
+  // Returns a config with a round_robin child for each of \a priorities,
+  // in order.  Re-resolution requests from the children are ignored, so
+  // that the only events the helper sees are state updates.
+  static RefCountedPtr<LoadBalancingPolicy::Config> MakePriorityConfig(
+      const std::vector<absl::string_view>& priorities) {
+    Json::Object children;
+    Json::Array priority_list;
+    for (absl::string_view priority : priorities) {
+      children[std::string(priority)] = Json::FromObject(
+          {{"config", Json::FromArray({Json::FromObject(
+                          {{"round_robin", Json::FromObject({})}})})},
+           {"ignore_reresolution_requests", Json::FromBool(true)}});
+      priority_list.push_back(Json::FromString(std::string(priority)));
+    }
+    Json config = Json::FromObject(
+        {{"children", Json::FromObject(std::move(children))},
+         {"priorities", Json::FromArray(std::move(priority_list))}});
+    return MakeConfig(Json::FromArray(
+        {Json::FromObject({{"priority_experimental", std::move(config)}})}));
+  }
+
+  // Returns an endpoint for \a address that is routed to the child
+  // named \a priority.
+  EndpointAddresses MakeEndpoint(absl::string_view address,
+                                 absl::string_view priority) {
+    auto path = MakeRefCounted<HierarchicalPathArg>(
+        std::vector<RefCountedStringValue>{RefCountedStringValue(priority)});
+    return MakeEndpointAddresses({address},
+                                 ChannelArgs().SetObject(std::move(path)));
+  }
+};
+
+TEST_F(PriorityTest, UpdateFromOtherPriorityIsNotReported) {
+  constexpr absl::string_view kAddress0 = "ipv4:127.0.0.1:441";
+  constexpr absl::string_view kAddress1 = "ipv4:127.0.0.1:442";
+  const std::vector<EndpointAddresses> endpoints = {
+      MakeEndpoint(kAddress0, "p0"), MakeEndpoint(kAddress1, "p1")};
+  EXPECT_EQ(
+      ApplyUpdate(BuildUpdate(endpoints, MakePriorityConfig({"p0", "p1"})),
+                  lb_policy()),
+      absl::OkStatus());
+  // The first priority fails, so the policy fails over to the second.
+  auto* subchannel0 = FindSubchannel(kAddress0);
+  ASSERT_NE(subchannel0, nullptr);
+  EXPECT_TRUE(subchannel0->ConnectionRequested());
+  subchannel0->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+  subchannel0->SetConnectivityState(GRPC_CHANNEL_TRANSIENT_FAILURE,
+                                    absl::UnavailableError("failed"));
+  auto* subchannel1 = FindSubchannel(kAddress1);
+  ASSERT_NE(subchannel1, nullptr);
+  EXPECT_TRUE(subchannel1->ConnectionRequested());
+  subchannel1->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+  subchannel1->SetConnectivityState(GRPC_CHANNEL_READY);
+  auto picker = WaitForConnected();
+  ASSERT_NE(picker, nullptr);
+  EXPECT_EQ(ExpectPickComplete(picker.get()), kAddress1);
+  // The first priority retries and fails again.  It reports a new
+  // picker, but the channel keeps using the second priority, so nothing
+  // is passed up.
+  subchannel0->SetConnectivityState(GRPC_CHANNEL_IDLE);
+  EXPECT_TRUE(subchannel0->ConnectionRequested());
+  subchannel0->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+  subchannel0->SetConnectivityState(GRPC_CHANNEL_TRANSIENT_FAILURE,
+                                    absl::UnavailableError("failed again"));
+  ExpectQueueEmpty();
+  // An update from the current priority is still passed up.
+  subchannel1->SetConnectivityState(GRPC_CHANNEL_IDLE);
+  ExpectConnectingUpdate();
+  DrainConnectingUpdates();
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  return RUN_ALL_TESTS();
+}
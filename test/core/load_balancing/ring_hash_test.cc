@@ -32,6 +32,7 @@
 #include "absl/strings/string_view.h"
 #include "absl/strings/strip.h"
 #include "gtest/gtest.h"
+#include "src/core/config/core_configuration.h"
 #include "src/core/load_balancing/lb_policy.h"
 #include "src/core/resolver/endpoint_addresses.h"
 #include "src/core/util/json/json.h"
@@ -55,8 +56,8 @@ class RingHashTest : public LoadBalancingPolicyTest {
 
   static RefCountedPtr<LoadBalancingPolicy::Config> MakeRingHashConfig(
       int min_ring_size = 0, int max_ring_size = 0,
-      const std::string& request_hash_header = "") {
-    Json::Object fields;
+      const std::string& request_hash_header = "",
+      Json::Object fields = {}) {
     if (min_ring_size > 0) {
       fields["minRingSize"] = Json::FromString(absl::StrCat(min_ring_size));
     }
@@ -82,6 +83,30 @@ class RingHashTest : public LoadBalancingPolicyTest {
     return MakeHashAttributeForString(absl::StripPrefix(address, "ipv4:"));
   }
 
+  // Connects to every address in turn, using a pick hashed to each one,
+  // and returns the resulting picker.
+  RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> ConnectAll(
+      absl::Span<const absl::string_view> addresses) {
+    auto picker = ExpectState(GRPC_CHANNEL_IDLE);
+    for (size_t i = 0; i < addresses.size(); ++i) {
+      auto* attribute = MakeHashAttribute(addresses[i]);
+      ExpectPickQueued(picker.get(), {attribute});
+      WaitForWorkSerializerToFlush();
+      WaitForWorkSerializerToFlush();
+      auto* subchannel = FindSubchannel(addresses[i]);
+      EXPECT_NE(subchannel, nullptr) << addresses[i];
+      if (subchannel == nullptr) return nullptr;
+      EXPECT_TRUE(subchannel->ConnectionRequested());
+      subchannel->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+      picker = ExpectState(i == 0 ? GRPC_CHANNEL_CONNECTING
+                                  : GRPC_CHANNEL_READY);
+      subchannel->SetConnectivityState(GRPC_CHANNEL_READY);
+      picker = ExpectState(GRPC_CHANNEL_READY);
+      if (picker == nullptr) return nullptr;
+    }
+    return picker;
+  }
+
   std::vector<std::unique_ptr<RequestHashAttribute>> attribute_storage_;
 };
 
@@ -449,6 +474,97 @@ TEST_F(RingHashTest, RequestHashHeaderNotPresent) {
   EXPECT_EQ(address, kAddresses[index]);
 }
 
+TEST_F(RingHashTest, BoundedLoadSpillsOverToNextEndpoint) {
+  const std::array<absl::string_view, 2> kAddresses = {"ipv4:127.0.0.1:441",
+                                                       "ipv4:127.0.0.1:442"};
+  EXPECT_EQ(ApplyUpdate(BuildUpdate(kAddresses,
+                                    MakeRingHashConfig(
+                                        0, 0, "",
+                                        {{"hashBalanceFactor",
+                                          Json::FromNumber(100)}})),
+                        lb_policy()),
+            absl::OkStatus());
+  auto picker = ConnectAll(kAddresses);
+  ASSERT_NE(picker, nullptr);
+  auto* address0_attribute = MakeHashAttribute(kAddresses[0]);
+  // With a factor of 100%, neither endpoint may get more than half of the
+  // calls in flight, rounded up, so calls for the same key alternate.
+  std::vector<
+      std::unique_ptr<LoadBalancingPolicy::SubchannelCallTrackerInterface>>
+      trackers;
+  auto picks = GetCompletePicks(picker.get(), 4, {address0_attribute},
+                                &trackers);
+  ASSERT_TRUE(picks.has_value());
+  const std::string address0(kAddresses[0]);
+  const std::string address1(kAddresses[1]);
+  EXPECT_EQ(*picks, std::vector<std::string>(
+                        {address0, address1, address0, address1}));
+  // Once calls finish, the key goes back to its own endpoint.
+  trackers.clear();
+  EXPECT_EQ(ExpectPickComplete(picker.get(), {address0_attribute}),
+            kAddresses[0]);
+}
+
+TEST_F(RingHashTest, MaglevTable) {
+  const std::array<absl::string_view, 3> kAddresses = {
+      "ipv4:127.0.0.1:441", "ipv4:127.0.0.1:442", "ipv4:127.0.0.1:443"};
+  EXPECT_EQ(
+      ApplyUpdate(
+          BuildUpdate(kAddresses,
+                      MakeRingHashConfig(
+                          0, 0, "",
+                          {{"lookupTable", Json::FromString("MAGLEV")},
+                           {"maglevTableSize", Json::FromNumber(101)}})),
+          lb_policy()),
+      absl::OkStatus());
+  auto picker = ExpectState(GRPC_CHANNEL_IDLE);
+  auto* attribute = MakeHashAttributeForString("foo");
+  ExpectPickQueued(picker.get(), {attribute});
+  WaitForWorkSerializerToFlush();
+  WaitForWorkSerializerToFlush();
+  // Exactly one endpoint, the one the table maps the hash to, is asked to
+  // connect.
+  SubchannelState* subchannel = nullptr;
+  size_t index = 0;
+  for (size_t i = 0; i < kAddresses.size(); ++i) {
+    auto* candidate = FindSubchannel(kAddresses[i]);
+    if (candidate == nullptr) continue;
+    EXPECT_EQ(subchannel, nullptr) << "second connection: " << kAddresses[i];
+    subchannel = candidate;
+    index = i;
+  }
+  ASSERT_NE(subchannel, nullptr);
+  EXPECT_TRUE(subchannel->ConnectionRequested());
+  subchannel->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+  picker = ExpectState(GRPC_CHANNEL_CONNECTING);
+  ExpectPickQueued(picker.get(), {attribute});
+  subchannel->SetConnectivityState(GRPC_CHANNEL_READY);
+  picker = ExpectState(GRPC_CHANNEL_READY);
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_EQ(ExpectPickComplete(picker.get(), {attribute}),
+              kAddresses[index]);
+  }
+}
+
+TEST_F(RingHashTest, BoundedLoadAndMaglevConfigValidation) {
+  auto config = CoreConfiguration::Get()
+                    .lb_policy_registry()
+                    .ParseLoadBalancingConfig(Json::FromArray({Json::FromObject(
+                        {{"ring_hash_experimental",
+                          Json::FromObject({
+                              {"hashBalanceFactor", Json::FromNumber(50)},
+                              {"lookupTable", Json::FromString("FOO")},
+                              {"maglevTableSize", Json::FromNumber(100)},
+                          })}})}));
+  EXPECT_EQ(config.status(),
+            absl::InvalidArgumentError(
+                "errors validating ring_hash LB policy config: ["
+                "field:hashBalanceFactor error:must be at least 100; "
+                "field:lookupTable error:must be RING or MAGLEV; "
+                "field:maglevTableSize error:must be a prime number at most "
+                "5000011]"));
+}
+
 }  // namespace
 }  // namespace testing
 }  // namespace grpc_core
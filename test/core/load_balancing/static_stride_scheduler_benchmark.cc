@@ -28,6 +28,7 @@
 #include "absl/types/span.h"
 #include "src/core/load_balancing/weighted_round_robin/static_stride_scheduler.h"
 #include "src/core/util/no_destruct.h"
+#include "src/core/util/per_cpu.h"
 
 namespace grpc_core {
 namespace {
@@ -35,6 +36,8 @@ namespace {
 const int kNumWeightsLow = 10;
 const int kNumWeightsHigh = 10000;
 const int kRangeMultiplier = 10;
+const int kNumWeightsThreaded = 1000;
+const int kMaxThreads = 16;
 
 // Returns a randomly ordered list of weights equally distributed between 0.6
 // and 1.0.
@@ -84,6 +87,44 @@ BENCHMARK(BM_StaticStrideSchedulerPickAtomic)
     ->RangeMultiplier(kRangeMultiplier)
     ->Range(kNumWeightsLow, kNumWeightsHigh);
 
+// Picks from many threads at once on one scheduler, as a WRR picker does
+// under load, with every thread sharing one sequence counter.
+void BM_StaticStrideSchedulerPickSharedCounter(benchmark::State& state) {
+  static NoDestruct<std::atomic<uint32_t>> sequence{0};
+  static const NoDestruct<std::optional<StaticStrideScheduler>> scheduler(
+      StaticStrideScheduler::Make(
+          absl::MakeSpan(Weights()).subspan(0, kNumWeightsThreaded), [] {
+            return sequence->fetch_add(1, std::memory_order_relaxed);
+          }));
+  CHECK(scheduler->has_value());
+  for (auto s : state) {
+    benchmark::DoNotOptimize((*scheduler)->Pick());
+  }
+}
+BENCHMARK(BM_StaticStrideSchedulerPickSharedCounter)
+    ->ThreadRange(1, kMaxThreads);
+
+// As above, but with a sequence counter per CPU, as WRR uses.
+void BM_StaticStrideSchedulerPickPerCpuCounter(benchmark::State& state) {
+  struct alignas(GPR_CACHELINE_SIZE) Sequence {
+    std::atomic<uint32_t> value{0};
+  };
+  static NoDestruct<PerCpu<Sequence>> sequence(
+      PerCpuOptions().SetCpusPerShard(1).SetMaxShards(16));
+  static const NoDestruct<std::optional<StaticStrideScheduler>> scheduler(
+      StaticStrideScheduler::Make(
+          absl::MakeSpan(Weights()).subspan(0, kNumWeightsThreaded), [] {
+            return sequence->this_cpu().value.fetch_add(
+                1, std::memory_order_relaxed);
+          }));
+  CHECK(scheduler->has_value());
+  for (auto s : state) {
+    benchmark::DoNotOptimize((*scheduler)->Pick());
+  }
+}
+BENCHMARK(BM_StaticStrideSchedulerPickPerCpuCounter)
+    ->ThreadRange(1, kMaxThreads);
+
 void BM_StaticStrideSchedulerMake(benchmark::State& state) {
   uint32_t sequence = 0;
   for (auto s : state) {
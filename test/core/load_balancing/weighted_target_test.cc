@@ -0,0 +1,128 @@
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <grpc/grpc.h>
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/strings/string_view.h"
+#include "gtest/gtest.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/load_balancing/address_filtering.h"
+#include "src/core/resolver/endpoint_addresses.h"
+#include "src/core/util/json/json.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/ref_counted_string.h"
+#include "test/core/load_balancing/lb_policy_test_lib.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+class WeightedTargetTest : public LoadBalancingPolicyTest {
+ protected:
+  WeightedTargetTest()
+      : LoadBalancingPolicyTest("weighted_target_experimental") {}
+
+  // Returns a config with a round_robin child for each target, with the
+  // weights given in \a weights.
+  static RefCountedPtr<LoadBalancingPolicy::Config> MakeWeightedTargetConfig(
+      const std::map<absl::string_view, uint32_t>& weights) {
+    Json::Object targets;
+    for (const auto& [name, weight] : weights) {
+      targets[std::string(name)] = Json::FromObject(
+          {{"weight", Json::FromNumber(weight)},
+           {"childPolicy", Json::FromArray({Json::FromObject(
+                               {{"round_robin", Json::FromObject({})}})})}});
+    }
+    Json config =
+        Json::FromObject({{"targets", Json::FromObject(std::move(targets))}});
+    return MakeConfig(Json::FromArray({Json::FromObject(
+        {{"weighted_target_experimental", std::move(config)}})}));
+  }
+
+  // Returns an endpoint for \a address that is routed to \a target.
+  EndpointAddresses MakeEndpoint(absl::string_view address,
+                                 absl::string_view target) {
+    auto path = MakeRefCounted<HierarchicalPathArg>(
+        std::vector<RefCountedStringValue>{RefCountedStringValue(target)});
+    return MakeEndpointAddresses({address},
+                                 ChannelArgs().SetObject(std::move(path)));
+  }
+};
+
+TEST_F(WeightedTargetTest, UpdateThatLeavesPickerUnchangedIsNotReported) {
+  constexpr absl::string_view kAddressA = "ipv4:127.0.0.1:441";
+  constexpr absl::string_view kAddressB = "ipv4:127.0.0.1:442";
+  constexpr absl::string_view kAddressC = "ipv4:127.0.0.1:443";
+  const std::vector<EndpointAddresses> endpoints = {
+      MakeEndpoint(kAddressA, "a"), MakeEndpoint(kAddressB, "b"),
+      MakeEndpoint(kAddressC, "c")};
+  EXPECT_EQ(ApplyUpdate(BuildUpdate(endpoints,
+                                    MakeWeightedTargetConfig(
+                                        {{"a", 1}, {"b", 1}, {"c", 1}})),
+                        lb_policy()),
+            absl::OkStatus());
+  auto* subchannel_a = FindSubchannel(kAddressA);
+  ASSERT_NE(subchannel_a, nullptr);
+  auto* subchannel_b = FindSubchannel(kAddressB);
+  ASSERT_NE(subchannel_b, nullptr);
+  auto* subchannel_c = FindSubchannel(kAddressC);
+  ASSERT_NE(subchannel_c, nullptr);
+  EXPECT_TRUE(subchannel_a->ConnectionRequested());
+  EXPECT_TRUE(subchannel_b->ConnectionRequested());
+  EXPECT_TRUE(subchannel_c->ConnectionRequested());
+  // Targets a and b connect.
+  subchannel_a->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+  subchannel_b->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+  subchannel_a->SetConnectivityState(GRPC_CHANNEL_READY);
+  auto picker = WaitForConnected();
+  ASSERT_NE(picker, nullptr);
+  EXPECT_EQ(ExpectPickComplete(picker.get()), kAddressA);
+  subchannel_b->SetConnectivityState(GRPC_CHANNEL_READY);
+  picker = ExpectState(GRPC_CHANNEL_READY);
+  ASSERT_NE(picker, nullptr);
+  // Target c starts connecting.  It reports a new picker, but c is not
+  // in the picker we already reported, so nothing is passed up.
+  subchannel_c->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+  ExpectQueueEmpty();
+  // A weight change is still passed up.
+  EXPECT_EQ(ApplyUpdate(BuildUpdate(endpoints,
+                                    MakeWeightedTargetConfig(
+                                        {{"a", 3}, {"b", 1}, {"c", 1}})),
+                        lb_policy()),
+            absl::OkStatus());
+  do {
+    picker = ExpectState(GRPC_CHANNEL_READY);
+    ASSERT_NE(picker, nullptr);
+  } while (!helper_->QueueEmpty());
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  return RUN_ALL_TESTS();
+}
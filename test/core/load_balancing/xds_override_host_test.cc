@@ -334,6 +334,67 @@ TEST_F(XdsOverrideHostTest,
                                      {kAddresses[0], kAddresses[2]});
 }
 
+TEST_F(XdsOverrideHostTest, ReadyOverrideHostIsPickedFromPickerSnapshot) {
+  const std::array<absl::string_view, 3> kAddresses = {
+      "ipv4:127.0.0.1:441", "ipv4:127.0.0.1:442", "ipv4:127.0.0.1:443"};
+  auto old_picker = ExpectStartupWithRoundRobin(kAddresses);
+  ASSERT_NE(old_picker, nullptr);
+  auto* address1_attribute = MakeOverrideHostAttribute(kAddresses[1]);
+  ExpectOverridePicks(old_picker.get(), address1_attribute, kAddresses[1]);
+  // Subchannel 1 leaves READY while the old picker is still in use.
+  LOG(INFO) << "### subchannel 1 reporting IDLE";
+  auto subchannel = FindSubchannel(kAddresses[1]);
+  ASSERT_NE(subchannel, nullptr);
+  subchannel->SetConnectivityState(GRPC_CHANNEL_IDLE);
+  EXPECT_TRUE(subchannel->ConnectionRequested());
+  ExpectReresolutionRequest();
+  auto picker =
+      WaitForRoundRobinListChange(kAddresses, {kAddresses[0], kAddresses[2]});
+  // The old picker still routes to the host it saw READY, without looking
+  // at the policy's current state; the channel retries such picks with the
+  // new picker once the subchannel turns out not to be connected.
+  ExpectOverridePicks(old_picker.get(), address1_attribute, kAddresses[1]);
+  // The new picker does look, and queues the pick.
+  ExpectPickQueued(picker.get(), {address1_attribute});
+  // Once the subchannel is READY again, a new picker routes to it.
+  LOG(INFO) << "### subchannel 1 reporting READY";
+  subchannel->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+  subchannel->SetConnectivityState(GRPC_CHANNEL_READY);
+  picker = WaitForRoundRobinListChange({kAddresses[0], kAddresses[2]},
+                                       kAddresses);
+  ExpectOverridePicks(picker.get(), address1_attribute, kAddresses[1]);
+}
+
+TEST_F(XdsOverrideHostTest, OverrideHostNotReadyFallsBackToNextAddress) {
+  const std::array<absl::string_view, 3> kAddresses = {
+      "ipv4:127.0.0.1:441", "ipv4:127.0.0.1:442", "ipv4:127.0.0.1:443"};
+  auto picker = ExpectStartupWithRoundRobin(kAddresses);
+  ASSERT_NE(picker, nullptr);
+  LOG(INFO) << "### subchannel 1 reporting IDLE";
+  auto subchannel = FindSubchannel(kAddresses[1]);
+  ASSERT_NE(subchannel, nullptr);
+  subchannel->SetConnectivityState(GRPC_CHANNEL_IDLE);
+  EXPECT_TRUE(subchannel->ConnectionRequested());
+  ExpectReresolutionRequest();
+  picker =
+      WaitForRoundRobinListChange(kAddresses, {kAddresses[0], kAddresses[2]});
+  // The cookie's first host is not READY, so the pick goes to the next one.
+  const std::array<absl::string_view, 2> kCookieAddresses = {kAddresses[1],
+                                                             kAddresses[2]};
+  auto* attribute = MakeOverrideHostAttribute(kCookieAddresses);
+  ExpectOverridePicks(picker.get(), attribute, kAddresses[2]);
+  // With no READY host in the cookie, the pick is queued while the IDLE one
+  // connects.
+  auto* address1_attribute = MakeOverrideHostAttribute(kAddresses[1]);
+  ExpectPickQueued(picker.get(), {address1_attribute});
+  LOG(INFO) << "### subchannel 1 reporting CONNECTING";
+  subchannel->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+  picker = ExpectState(GRPC_CHANNEL_READY);
+  ASSERT_NE(picker, nullptr);
+  ExpectPickQueued(picker.get(), {address1_attribute});
+  ExpectOverridePicks(picker.get(), attribute, kAddresses[2]);
+}
+
 TEST_F(XdsOverrideHostTest, DrainingState) {
   const std::array<absl::string_view, 3> kAddresses = {
       "ipv4:127.0.0.1:441", "ipv4:127.0.0.1:442", "ipv4:127.0.0.1:443"};
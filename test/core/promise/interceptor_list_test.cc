@@ -131,6 +131,38 @@ TEST_F(InterceptorListTest, CanRunManyWithCapturesThatDelay) {
   EXPECT_EQ(promise().value().value(), expected);
 }
 
+TEST_F(InterceptorListTest, RunsReusePromiseMemory) {
+  InterceptorList<std::string> list;
+  list.AppendMap([](std::string s) { return s + "a"; }, DEBUG_LOCATION);
+  EXPECT_EQ(list.Run("hello")(), Poll<std::optional<std::string>>("helloa"));
+  const size_t used = arena_->TotalUsedBytes();
+  for (int i = 0; i < 100; i++) {
+    EXPECT_EQ(list.Run("hello")(), Poll<std::optional<std::string>>("helloa"));
+  }
+  EXPECT_EQ(arena_->TotalUsedBytes(), used);
+}
+
+TEST_F(InterceptorListTest, ConcurrentRunsDoNotShareMemory) {
+  InterceptorList<std::string> list;
+  list.AppendMap(
+      [](std::string s) {
+        return [x = false, s]() mutable -> Poll<std::optional<std::string>> {
+          if (!x) {
+            x = true;
+            return Pending{};
+          }
+          return s + "a";
+        };
+      },
+      DEBUG_LOCATION);
+  auto first = list.Run("hello");
+  auto second = list.Run("world");
+  EXPECT_TRUE(first().pending());
+  EXPECT_TRUE(second().pending());
+  EXPECT_EQ(second(), Poll<std::optional<std::string>>("worlda"));
+  EXPECT_EQ(first(), Poll<std::optional<std::string>>("helloa"));
+}
+
 }  // namespace
 }  // namespace grpc_core
 
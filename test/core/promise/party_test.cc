@@ -30,6 +30,7 @@
 #include "gtest/gtest.h"
 #include "src/core/lib/event_engine/default_event_engine.h"
 #include "src/core/lib/event_engine/event_engine_context.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/promise/context.h"
 #include "src/core/lib/promise/inter_activity_latch.h"
@@ -502,6 +503,24 @@ TEST_F(PartyTest, CanBulkSpawn) {
   n2.WaitForNotification();
 }
 
+TEST_F(PartyTest, ReusesMemoryOfCompletedParticipants) {
+  if (!IsPartyArenaParticipantsEnabled()) {
+    GTEST_SKIP() << "party_arena_participants experiment is disabled";
+  }
+  // Participants come from the party's arena: spawning one after another
+  // must keep reusing the same memory rather than growing the arena.
+  auto party = MakeParty();
+  int completed = 0;
+  auto spawn = [&]() {
+    party->Spawn("spawn", []() {}, [&completed](Empty) { ++completed; });
+  };
+  spawn();
+  const size_t used_after_first_spawn = party->arena()->TotalUsedBytes();
+  for (int i = 0; i < kLargeNumSpawns; i++) spawn();
+  EXPECT_EQ(completed, kLargeNumSpawns + 1);
+  EXPECT_EQ(party->arena()->TotalUsedBytes(), used_after_first_spawn);
+}
+
 TEST_F(PartyTest, CanNestWakeupHold) {
   // This test is similar to the previous test CanBulkSpawn, but the WakeupHold
   // objects are nested.
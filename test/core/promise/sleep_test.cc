@@ -149,6 +149,73 @@ TEST(Sleep, StressTest) {
   }
 }
 
+TEST(CoarseSleep, Zzzz) {
+  ExecCtx exec_ctx;
+  Notification done;
+  Timestamp done_time = Timestamp::Now() + Duration::Milliseconds(123);
+  auto engine = GetDefaultEventEngine();
+  auto activity = MakeActivity(
+      CoarseSleep(done_time, Duration::Milliseconds(100)),
+      InlineWakeupScheduler(),
+      [&done](absl::Status r) {
+        EXPECT_EQ(r, absl::OkStatus());
+        done.Notify();
+      },
+      ArenaWithEventEngine(engine.get()));
+  done.WaitForNotification();
+  exec_ctx.InvalidateNow();
+  EXPECT_GE(Timestamp::Now(), done_time);
+}
+
+TEST(CoarseSleep, Cancel) {
+  ExecCtx exec_ctx;
+  Notification done;
+  Timestamp done_time = Timestamp::Now() + Duration::Seconds(1);
+  auto engine = GetDefaultEventEngine();
+  auto activity = MakeActivity(
+      Race(CoarseSleep(done_time), [] { return absl::CancelledError(); }),
+      InlineWakeupScheduler(),
+      [&done](absl::Status r) {
+        EXPECT_EQ(r, absl::CancelledError());
+        done.Notify();
+      },
+      ArenaWithEventEngine(engine.get()));
+  done.WaitForNotification();
+  exec_ctx.InvalidateNow();
+  EXPECT_LT(Timestamp::Now(), done_time);
+}
+
+TEST(CoarseSleep, SleepsShareTimers) {
+  static const int kNumActivities = 1000;
+  ExecCtx exec_ctx;
+  auto engine = std::make_shared<::testing::StrictMock<
+      grpc_event_engine::experimental::MockEventEngine>>();
+  // One timer per shard at most, however many sleeps there are, and each is
+  // cancelled once all of its sleeps are.
+  int timers = 0;
+  EXPECT_CALL(*engine, RunAfter(::testing::_,
+                                ::testing::An<absl::AnyInvocable<void()>>()))
+      .WillRepeatedly([&timers](EventEngine::Duration,
+                                absl::AnyInvocable<void()>) {
+        ++timers;
+        return EventEngine::TaskHandle{timers, 0};
+      });
+  EXPECT_CALL(*engine, Cancel(::testing::_))
+      .WillRepeatedly(::testing::Return(true));
+  const Timestamp deadline = Timestamp::Now() + Duration::Seconds(10);
+  std::vector<ActivityPtr> activities;
+  for (int i = 0; i < kNumActivities; i++) {
+    activities.push_back(MakeActivity(
+        CoarseSleep(deadline + Duration::Milliseconds(i % 10),
+                    Duration::Seconds(1)),
+        InlineWakeupScheduler(), [](absl::Status) {},
+        ArenaWithEventEngine(engine.get())));
+  }
+  EXPECT_GE(timers, 1);
+  EXPECT_LE(timers, 32);
+  activities.clear();
+}
+
 }  // namespace
 }  // namespace grpc_core
 
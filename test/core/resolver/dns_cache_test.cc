@@ -0,0 +1,209 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/resolver/dns/event_engine/dns_cache.h"
+
+#include <grpc/event_engine/event_engine.h>
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "gtest/gtest.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/util/notification.h"
+#include "src/core/util/sync.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+using grpc_event_engine::experimental::EventEngine;
+
+// Queues TXT lookups until the test answers them.
+class FakeResolver final : public EventEngine::DNSResolver {
+ public:
+  struct State {
+    Mutex mu;
+    std::vector<LookupTXTCallback> pending ABSL_GUARDED_BY(mu);
+    int num_lookups ABSL_GUARDED_BY(mu) = 0;
+
+    int NumLookups() {
+      MutexLock lock(&mu);
+      return num_lookups;
+    }
+
+    void Answer(absl::StatusOr<std::vector<std::string>> result) {
+      std::vector<LookupTXTCallback> pending_callbacks;
+      {
+        MutexLock lock(&mu);
+        pending_callbacks = std::move(pending);
+        pending.clear();
+      }
+      for (auto& callback : pending_callbacks) callback(result);
+    }
+  };
+
+  explicit FakeResolver(std::shared_ptr<State> state)
+      : state_(std::move(state)) {}
+
+  void LookupHostname(LookupHostnameCallback on_resolve,
+                      absl::string_view /*name*/,
+                      absl::string_view /*default_port*/) override {
+    on_resolve(absl::UnimplementedError("not used"));
+  }
+  void LookupSRV(LookupSRVCallback on_resolve,
+                 absl::string_view /*name*/) override {
+    on_resolve(absl::UnimplementedError("not used"));
+  }
+  void LookupTXT(LookupTXTCallback on_resolve,
+                 absl::string_view /*name*/) override {
+    MutexLock lock(&state_->mu);
+    ++state_->num_lookups;
+    state_->pending.push_back(std::move(on_resolve));
+  }
+
+ private:
+  std::shared_ptr<State> state_;
+};
+
+class DnsCacheTest : public ::testing::Test {
+ protected:
+  std::unique_ptr<EventEngine::DNSResolver> MakeResolver(
+      DnsCache::Options options) {
+    return cache_.MakeCachingResolver(std::make_unique<FakeResolver>(state_),
+                                      "", options, event_engine_);
+  }
+
+  // Starts a TXT lookup for name and returns a handle to its result.
+  struct Lookup {
+    Notification done;
+    absl::StatusOr<std::vector<std::string>> result;
+  };
+  std::shared_ptr<Lookup> StartLookup(EventEngine::DNSResolver* resolver,
+                                      absl::string_view name) {
+    auto lookup = std::make_shared<Lookup>();
+    resolver->LookupTXT(
+        [lookup](absl::StatusOr<std::vector<std::string>> result) {
+          lookup->result = std::move(result);
+          lookup->done.Notify();
+        },
+        name);
+    return lookup;
+  }
+
+  DnsCache cache_;
+  std::shared_ptr<FakeResolver::State> state_ =
+      std::make_shared<FakeResolver::State>();
+  std::shared_ptr<EventEngine> event_engine_ =
+      grpc_event_engine::experimental::GetDefaultEventEngine();
+};
+
+TEST_F(DnsCacheTest, CoalescesConcurrentLookups) {
+  auto resolver1 = MakeResolver({});
+  auto resolver2 = MakeResolver({});
+  auto lookup1 = StartLookup(resolver1.get(), "foo");
+  auto lookup2 = StartLookup(resolver2.get(), "foo");
+  auto lookup3 = StartLookup(resolver2.get(), "bar");
+  EXPECT_EQ(state_->NumLookups(), 2);
+  // The query outlives the resolver that started it, but that resolver's
+  // own lookup is cancelled.
+  resolver1.reset();
+  lookup1->done.WaitForNotification();
+  EXPECT_EQ(lookup1->result.status().code(), absl::StatusCode::kCancelled);
+  state_->Answer(std::vector<std::string>{"txt"});
+  for (const auto& lookup : {lookup2, lookup3}) {
+    lookup->done.WaitForNotification();
+    ASSERT_TRUE(lookup->result.ok()) << lookup->result.status();
+    EXPECT_EQ(*lookup->result, std::vector<std::string>{"txt"});
+  }
+  // Nothing is cached without a max age.
+  auto lookup4 = StartLookup(resolver2.get(), "foo");
+  EXPECT_EQ(state_->NumLookups(), 3);
+  state_->Answer(std::vector<std::string>{});
+  lookup4->done.WaitForNotification();
+}
+
+TEST_F(DnsCacheTest, CachesResultsForMaxAge) {
+  auto resolver = MakeResolver({Duration::Hours(1), Duration::Zero()});
+  auto lookup = StartLookup(resolver.get(), "foo");
+  state_->Answer(std::vector<std::string>{"txt"});
+  lookup->done.WaitForNotification();
+  // A later lookup, even from another resolver, is answered from the
+  // cache.
+  auto resolver2 = MakeResolver({Duration::Hours(1), Duration::Zero()});
+  lookup = StartLookup(resolver2.get(), "foo");
+  lookup->done.WaitForNotification();
+  ASSERT_TRUE(lookup->result.ok()) << lookup->result.status();
+  EXPECT_EQ(*lookup->result, std::vector<std::string>{"txt"});
+  EXPECT_EQ(state_->NumLookups(), 1);
+  cache_.ClearForTesting();
+  lookup = StartLookup(resolver2.get(), "foo");
+  EXPECT_EQ(state_->NumLookups(), 2);
+  state_->Answer(std::vector<std::string>{});
+  lookup->done.WaitForNotification();
+}
+
+TEST_F(DnsCacheTest, NegativeCaching) {
+  auto resolver = MakeResolver({Duration::Zero(), Duration::Hours(1)});
+  auto lookup = StartLookup(resolver.get(), "foo");
+  state_->Answer(absl::NotFoundError("no such name"));
+  lookup->done.WaitForNotification();
+  lookup = StartLookup(resolver.get(), "foo");
+  lookup->done.WaitForNotification();
+  EXPECT_EQ(lookup->result.status(), absl::NotFoundError("no such name"));
+  EXPECT_EQ(state_->NumLookups(), 1);
+  // Cancellations are never cached.
+  lookup = StartLookup(resolver.get(), "bar");
+  state_->Answer(absl::CancelledError());
+  lookup->done.WaitForNotification();
+  lookup = StartLookup(resolver.get(), "bar");
+  EXPECT_EQ(state_->NumLookups(), 3);
+  state_->Answer(std::vector<std::string>{});
+  lookup->done.WaitForNotification();
+}
+
+TEST_F(DnsCacheTest, TimedOutLookupIsCancelled) {
+  // The channel's DNS request gives up on a lookup by destroying its
+  // resolver when GRPC_ARG_DNS_ARES_QUERY_TIMEOUT_MS expires.
+  auto resolver = MakeResolver({Duration::Hours(1), Duration::Zero()});
+  auto lookup = StartLookup(resolver.get(), "foo");
+  resolver.reset();
+  lookup->done.WaitForNotification();
+  EXPECT_EQ(lookup->result.status().code(), absl::StatusCode::kCancelled);
+  // The query it started is still shared with later lookups, and its
+  // result is cached once it arrives.
+  auto resolver2 = MakeResolver({Duration::Hours(1), Duration::Zero()});
+  lookup = StartLookup(resolver2.get(), "foo");
+  EXPECT_EQ(state_->NumLookups(), 1);
+  state_->Answer(std::vector<std::string>{"txt"});
+  lookup->done.WaitForNotification();
+  ASSERT_TRUE(lookup->result.ok()) << lookup->result.status();
+  EXPECT_EQ(*lookup->result, std::vector<std::string>{"txt"});
+  lookup = StartLookup(resolver2.get(), "foo");
+  lookup->done.WaitForNotification();
+  EXPECT_EQ(state_->NumLookups(), 1);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -33,6 +33,7 @@
 #include "absl/strings/str_join.h"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
 #include "src/core/util/ref_counted_ptr.h"
@@ -256,6 +257,17 @@ TEST(ArenaTest, CreatePoolArray) {
   EXPECT_TRUE(IsScribbled(p.get(), 5, 1));
 }
 
+TEST(ArenaTest, PooledMemoryIsReused) {
+  if (!IsCallArenaRecyclingEnabled()) {
+    GTEST_SKIP() << "Requires the call_arena_recycling experiment";
+  }
+  struct Pooled {
+    int values[8];
+  };
+  void* first = Arena::MakePooled<Pooled>().get();
+  EXPECT_EQ(Arena::MakePooled<Pooled>().get(), first);
+}
+
 TEST(ArenaTest, ConcurrentMakePooled) {
   concurrent_test_args args;
   gpr_event_init(&args.ev_start);
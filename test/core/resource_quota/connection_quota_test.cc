@@ -0,0 +1,104 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/resource_quota/connection_quota.h"
+
+#include <optional>
+
+#include "gtest/gtest.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/util/time.h"
+
+namespace grpc_core {
+namespace testing {
+
+class ConnectionQuotaTest : public ::testing::Test {
+ protected:
+  bool Allow() {
+    return quota_->AllowIncomingConnection(memory_quota_, "peer");
+  }
+
+  ConnectionQuotaRefPtr quota_ = MakeRefCounted<ConnectionQuota>();
+  MemoryQuotaRefPtr memory_quota_ = MakeMemoryQuota("test");
+};
+
+TEST_F(ConnectionQuotaTest, MaxIncomingConnections) {
+  quota_->SetMaxIncomingConnections(2);
+  EXPECT_TRUE(Allow());
+  EXPECT_TRUE(Allow());
+  EXPECT_FALSE(Allow());
+  quota_->ReleaseConnections(1);
+  EXPECT_TRUE(Allow());
+  EXPECT_EQ(quota_->TestOnlyActiveIncomingConnections(), 2);
+}
+
+TEST_F(ConnectionQuotaTest, MaxPendingHandshakes) {
+  quota_->SetMaxPendingHandshakes(2);
+  EXPECT_TRUE(Allow());
+  EXPECT_TRUE(Allow());
+  EXPECT_FALSE(Allow());
+  quota_->HandshakeDone(Duration::Milliseconds(10));
+  EXPECT_TRUE(Allow());
+  EXPECT_FALSE(Allow());
+  quota_->HandshakeDone(std::nullopt);
+  quota_->HandshakeDone(std::nullopt);
+  EXPECT_EQ(quota_->TestOnlyPendingHandshakes(), 0);
+}
+
+TEST_F(ConnectionQuotaTest, RefusedConnectionReleasesItsHandshake) {
+  quota_->SetMaxIncomingConnections(1);
+  quota_->SetMaxPendingHandshakes(10);
+  EXPECT_TRUE(Allow());
+  EXPECT_FALSE(Allow());
+  EXPECT_EQ(quota_->TestOnlyPendingHandshakes(), 1);
+}
+
+TEST_F(ConnectionQuotaTest, LimitAdaptsToHandshakeLatency) {
+  quota_->SetMaxPendingHandshakes(100);
+  quota_->SetHandshakeLatencyTarget(Duration::Milliseconds(100));
+  EXPECT_EQ(quota_->TestOnlyPendingHandshakeLimit(), 100);
+  // Slow handshakes shrink the limit, down to one.
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_TRUE(Allow());
+    quota_->HandshakeDone(Duration::Seconds(1));
+  }
+  EXPECT_EQ(quota_->TestOnlyPendingHandshakeLimit(), 1);
+  EXPECT_TRUE(Allow());
+  EXPECT_FALSE(Allow());
+  // Fast handshakes grow it back, up to the maximum.
+  quota_->HandshakeDone(Duration::Milliseconds(1));
+  EXPECT_EQ(quota_->TestOnlyPendingHandshakeLimit(), 2);
+  for (int i = 0; i < 200; ++i) {
+    ASSERT_TRUE(Allow());
+    quota_->HandshakeDone(Duration::Milliseconds(1));
+  }
+  EXPECT_EQ(quota_->TestOnlyPendingHandshakeLimit(), 100);
+  // Abandoned handshakes say nothing about latency.
+  ASSERT_TRUE(Allow());
+  quota_->HandshakeDone(std::nullopt);
+  EXPECT_EQ(quota_->TestOnlyPendingHandshakeLimit(), 100);
+}
+
+TEST_F(ConnectionQuotaTest, LatencyTargetWithoutMaximum) {
+  quota_->SetHandshakeLatencyTarget(Duration::Milliseconds(100));
+  EXPECT_EQ(quota_->TestOnlyPendingHandshakeLimit(), 1000);
+}
+
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,87 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/resource_quota/cpu_quota.h"
+
+#include <optional>
+
+#include "gtest/gtest.h"
+#include "src/core/util/time.h"
+
+namespace grpc_core {
+namespace testing {
+
+class CpuQuotaTest : public ::testing::Test {
+ protected:
+  // Advances wall time by \a wall and process CPU time by \a cpu.
+  void Advance(Duration wall, Duration cpu) {
+    now_ = now_ + wall;
+    time_cache_.TestOnlySetNow(now_);
+    cpu_time_ = cpu_time_ + cpu;
+  }
+
+  ScopedTimeCache time_cache_;
+  Timestamp now_ = Timestamp::Now();
+  Duration cpu_time_;
+  CpuQuotaPtr quota_ = MakeRefCounted<CpuQuota>(
+      [this]() -> std::optional<Duration> { return cpu_time_; });
+};
+
+TEST_F(CpuQuotaTest, UnlimitedByDefault) {
+  Advance(Duration::Zero(), Duration::Zero());
+  EXPECT_EQ(quota_->GetUtilization(), 0);
+  Advance(Duration::Seconds(1), Duration::Seconds(8));
+  EXPECT_EQ(quota_->GetUtilization(), 0);
+  EXPECT_FALSE(quota_->IsOverBudget());
+}
+
+TEST_F(CpuQuotaTest, TracksUtilizationAgainstBudget) {
+  Advance(Duration::Zero(), Duration::Zero());
+  quota_->SetMax(2);
+  EXPECT_EQ(quota_->GetUtilization(), 0);
+  // One core's worth of CPU is half the budget.
+  Advance(Duration::Seconds(1), Duration::Seconds(1));
+  EXPECT_DOUBLE_EQ(quota_->GetUtilization(), 0.5);
+  EXPECT_FALSE(quota_->IsOverBudget());
+  // Within a sampling period, the last value is kept.
+  Advance(Duration::Milliseconds(10), Duration::Seconds(1));
+  EXPECT_DOUBLE_EQ(quota_->GetUtilization(), 0.5);
+  // Three cores over the next period: over budget.
+  Advance(Duration::Milliseconds(990), Duration::Seconds(2));
+  EXPECT_DOUBLE_EQ(quota_->GetUtilization(), 1.5);
+  EXPECT_TRUE(quota_->IsOverBudget());
+  quota_->SetMax(0);
+  EXPECT_FALSE(quota_->IsOverBudget());
+}
+
+TEST(ProcessCpuQuotaTest, MeasuresThisProcess) {
+  CpuQuota quota;
+  quota.SetMax(1);
+  EXPECT_EQ(quota.GetUtilization(), 0);
+  // Spin for just over a sampling period.
+  const Timestamp deadline = Timestamp::Now() + Duration::Milliseconds(200);
+  while (Timestamp::Now() < deadline) {
+  }
+  const double utilization = quota.GetUtilization();
+  EXPECT_GE(utilization, 0);
+  EXPECT_LE(utilization, 2);
+}
+
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
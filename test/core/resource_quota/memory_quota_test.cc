@@ -187,6 +187,27 @@ TEST(MemoryQuotaTest, AllMemoryQuotas) {
   EXPECT_EQ(gather(), std::set<std::string>({"m2"}));
 }
 
+TEST(MemoryQuotaTest, ManyThreadsReturnEverything) {
+  MemoryQuota memory_quota("foo");
+  memory_quota.SetSize(1024 * 1024 * 1024);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 8; i++) {
+    threads.emplace_back([&memory_quota]() {
+      auto memory_allocator = memory_quota.CreateMemoryAllocator("bar");
+      for (int j = 0; j < 10000; j++) {
+        ExecCtx exec_ctx;
+        memory_allocator.Release(
+            memory_allocator.Reserve(MemoryRequest(4096 * (j % 8 + 1))));
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  // Resizing drains any memory held close to a cpu back into the quota.
+  memory_quota.SetSize(1024 * 1024 * 1024);
+  auto owner = memory_quota.CreateMemoryOwner();
+  EXPECT_LT(owner.GetPressureInfo().instantaneous_pressure, 0.01);
+}
+
 TEST(MemoryQuotaTest, ContainerMemoryAccountedFor) {
   MemoryQuota memory_quota("foo");
   memory_quota.SetSize(1000000);
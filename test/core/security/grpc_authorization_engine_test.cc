@@ -22,6 +22,8 @@
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
+#include "src/core/handshaker/endpoint_info/endpoint_info_handshaker.h"
+#include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/security/authorization/audit_logging.h"
 #include "src/core/util/json/json.h"
 #include "test/core/test_util/audit_logging_utils.h"
@@ -341,6 +343,77 @@ TEST_F(GrpcAuthorizationEngineTest, MultipleAuditLoggerInvoked) {
               kPolicyName, kSpiffeId, kRpcMethod)));
 }
 
+TEST_F(GrpcAuthorizationEngineTest, PathIndexPreservesPolicyOrder) {
+  auto path_policy = [](StringMatcher::Type type, absl::string_view path) {
+    return Rbac::Policy(Rbac::Permission::MakePathPermission(
+                            StringMatcher::Create(type, path).value()),
+                        Rbac::Principal::MakeAnyPrincipal());
+  };
+  std::map<std::string, Rbac::Policy> policies;
+  policies["a_other_method"] =
+      path_policy(StringMatcher::Type::kExact, "/foo.Bar/Other");
+  policies["b_service_prefix"] =
+      path_policy(StringMatcher::Type::kPrefix, "/foo.Bar/");
+  policies["c_exact_method"] =
+      path_policy(StringMatcher::Type::kExact, kRpcMethod);
+  // Matches any call without an x-missing header, whatever its path.
+  policies["d_header"] = Rbac::Policy(
+      Rbac::Permission::MakeHeaderPermission(
+          HeaderMatcher::Create("x-missing", HeaderMatcher::Type::kPresent, "")
+              .value()),
+      Rbac::Principal::MakeAnyPrincipal());
+  GrpcAuthorizationEngine engine(
+      Rbac("authz", Rbac::Action::kAllow, std::move(policies)));
+  EXPECT_EQ(engine.num_policies(), 4);
+  EXPECT_EQ(
+      engine.Evaluate(evaluate_args_util_.MakeEvaluateArgs())
+          .matching_policy_name,
+      "b_service_prefix");
+  EvaluateArgsTestUtil other_service;
+  other_service.AddPairToMetadata(":path", "/foo.Baz/Echo");
+  EXPECT_EQ(
+      engine.Evaluate(other_service.MakeEvaluateArgs()).matching_policy_name,
+      "d_header");
+  EvaluateArgsTestUtil other_method;
+  other_method.AddPairToMetadata(":path", "/foo.Bar/Other");
+  EXPECT_EQ(
+      engine.Evaluate(other_method.MakeEvaluateArgs()).matching_policy_name,
+      "a_other_method");
+}
+
+TEST_F(GrpcAuthorizationEngineTest, CachesConnectionResultsPerChannel) {
+  std::map<std::string, Rbac::Policy> policies;
+  policies["policy"] = Rbac::Policy(
+      Rbac::Permission::MakeAnyPermission(),
+      Rbac::Principal::MakeSourceIpPrincipal(Rbac::CidrRange("10.0.0.0", 8)));
+  GrpcAuthorizationEngine engine(
+      Rbac("authz", Rbac::Action::kAllow, std::move(policies)));
+  EvaluateArgs::PerChannelArgs channel_args(
+      nullptr, ChannelArgs().Set(GRPC_ARG_ENDPOINT_PEER_ADDRESS,
+                                 "ipv4:10.1.2.3:443"));
+  EXPECT_EQ(engine.Evaluate(EvaluateArgs(nullptr, &channel_args)).type,
+            AuthorizationEngine::Decision::Type::kAllow);
+  // The peer of a channel never changes, so the engine does not look at it
+  // again.
+  EvaluateArgs::PerChannelArgs other_channel_args(
+      nullptr, ChannelArgs().Set(GRPC_ARG_ENDPOINT_PEER_ADDRESS,
+                                 "ipv4:192.168.0.1:443"));
+  channel_args.peer_address = std::move(other_channel_args.peer_address);
+  EXPECT_EQ(engine.Evaluate(EvaluateArgs(nullptr, &channel_args)).type,
+            AuthorizationEngine::Decision::Type::kAllow);
+  EXPECT_EQ(engine.Evaluate(EvaluateArgs(nullptr, &other_channel_args)).type,
+            AuthorizationEngine::Decision::Type::kDeny);
+  // Another engine has its own results.
+  std::map<std::string, Rbac::Policy> other_policies;
+  other_policies["policy"] = Rbac::Policy(
+      Rbac::Permission::MakeAnyPermission(),
+      Rbac::Principal::MakeSourceIpPrincipal(Rbac::CidrRange("10.0.0.0", 8)));
+  GrpcAuthorizationEngine other_engine(
+      Rbac("authz", Rbac::Action::kAllow, std::move(other_policies)));
+  EXPECT_EQ(other_engine.Evaluate(EvaluateArgs(nullptr, &channel_args)).type,
+            AuthorizationEngine::Decision::Type::kDeny);
+}
+
 }  // namespace grpc_core
 
 int main(int argc, char** argv) {
@@ -0,0 +1,99 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "absl/log/check.h"
+#include "absl/strings/str_cat.h"
+#include "src/core/lib/address_utils/parse_address.h"
+#include "src/core/server/xds_filter_chain_match_table.h"
+#include "src/core/xds/grpc/xds_listener.h"
+
+namespace grpc_core {
+namespace {
+
+using FilterChainMap = XdsListenerResource::FilterChainMap;
+
+grpc_resolved_address Address(uint32_t ip) {
+  auto address =
+      StringToSockaddr(absl::StrCat(ip >> 24, ".", (ip >> 16) & 0xff, ".",
+                                    (ip >> 8) & 0xff, ".", ip & 0xff),
+                       0);
+  CHECK(address.ok());
+  return *address;
+}
+
+// A listener with \a num_chains filter chains under a single destination,
+// each matching a random source range of length /16 to /32, plus a catch-all
+// chain: the shape that per-client filter chains produce.
+FilterChainMap MakeFilterChainMap(int num_chains, std::mt19937* gen) {
+  FilterChainMap map;
+  map.destination_ip_vector.emplace_back();
+  auto& source_ips = map.destination_ip_vector.back().source_types_array[0];
+  for (int i = 0; i < num_chains; ++i) {
+    FilterChainMap::SourceIp source_ip;
+    const uint32_t prefix_len = 16 + i % 17;
+    source_ip.prefix_range = FilterChainMap::CidrRange{
+        Address((*gen)() & (~uint32_t{0} << (32 - prefix_len))), prefix_len};
+    source_ip.ports_map[0].data =
+        std::make_shared<XdsListenerResource::FilterChainData>();
+    source_ips.push_back(std::move(source_ip));
+  }
+  FilterChainMap::SourceIp catch_all;
+  catch_all.ports_map[0].data =
+      std::make_shared<XdsListenerResource::FilterChainData>();
+  source_ips.push_back(std::move(catch_all));
+  return map;
+}
+
+void BM_FindFilterChain(benchmark::State& state) {
+  std::mt19937 gen(1234);
+  const FilterChainMap map = MakeFilterChainMap(state.range(0), &gen);
+  const XdsFilterChainMatchTable table(map);
+  constexpr size_t kNumSources = 1024;
+  std::vector<grpc_resolved_address> sources;
+  sources.reserve(kNumSources);
+  for (size_t i = 0; i < kNumSources; ++i) sources.push_back(Address(gen()));
+  const grpc_resolved_address destination = Address(0x0a000001);
+  while (state.KeepRunningBatch(kNumSources)) {
+    for (const grpc_resolved_address& source : sources) {
+      benchmark::DoNotOptimize(table.Find(destination, source, 443, false));
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FindFilterChain)->Arg(1)->Arg(10)->Arg(100)->Arg(1000);
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  ::benchmark::Initialize(&argc, argv);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -0,0 +1,152 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include "src/core/server/xds_filter_chain_match_table.h"
+
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "absl/log/check.h"
+#include "gtest/gtest.h"
+#include "src/core/lib/address_utils/parse_address.h"
+#include "src/core/xds/grpc/xds_listener.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+using FilterChainData = XdsListenerResource::FilterChainData;
+using FilterChainMap = XdsListenerResource::FilterChainMap;
+using ConnectionSourceType = FilterChainMap::ConnectionSourceType;
+
+grpc_resolved_address Address(const std::string& ip) {
+  auto address = StringToSockaddr(ip, 0);
+  CHECK(address.ok()) << address.status();
+  return *address;
+}
+
+std::optional<FilterChainMap::CidrRange> Cidr(const std::string& ip,
+                                              uint32_t prefix_len) {
+  return FilterChainMap::CidrRange{Address(ip), prefix_len};
+}
+
+FilterChainMap::SourceIp SourceIp(
+    std::optional<FilterChainMap::CidrRange> range,
+    std::shared_ptr<FilterChainData> data, uint16_t port = 0) {
+  FilterChainMap::SourceIp source_ip;
+  source_ip.prefix_range = std::move(range);
+  source_ip.ports_map[port].data = std::move(data);
+  return source_ip;
+}
+
+FilterChainMap::DestinationIp DestinationIp(
+    std::optional<FilterChainMap::CidrRange> range, ConnectionSourceType type,
+    FilterChainMap::SourceIpVector source_ips) {
+  FilterChainMap::DestinationIp destination_ip;
+  destination_ip.prefix_range = std::move(range);
+  destination_ip.source_types_array[static_cast<int>(type)] =
+      std::move(source_ips);
+  return destination_ip;
+}
+
+TEST(CidrMatcherTest, LongestPrefixWins) {
+  CidrMatcher matcher;
+  matcher.Insert(Cidr("10.0.0.0", 8), 0);
+  matcher.Insert(Cidr("10.1.0.0", 16), 1);
+  matcher.Insert(Cidr("10.1.2.3", 32), 2);
+  EXPECT_EQ(matcher.Lookup(Address("10.1.2.3")), 2u);
+  EXPECT_EQ(matcher.Lookup(Address("10.1.2.4")), 1u);
+  EXPECT_EQ(matcher.Lookup(Address("10.2.0.1")), 0u);
+  EXPECT_EQ(matcher.Lookup(Address("11.0.0.1")), CidrMatcher::kNoMatch);
+}
+
+TEST(CidrMatcherTest, OddPrefixLengths) {
+  CidrMatcher matcher;
+  // 192.168.0.0/23 covers 192.168.0.0 - 192.168.1.255.
+  matcher.Insert(Cidr("192.168.1.7", 23), 0);
+  EXPECT_EQ(matcher.Lookup(Address("192.168.0.1")), 0u);
+  EXPECT_EQ(matcher.Lookup(Address("192.168.1.255")), 0u);
+  EXPECT_EQ(matcher.Lookup(Address("192.168.2.0")), CidrMatcher::kNoMatch);
+}
+
+TEST(CidrMatcherTest, CatchAllAndFamilies) {
+  CidrMatcher matcher;
+  matcher.Insert(std::nullopt, 0);
+  matcher.Insert(Cidr("2001:db8::", 32), 1);
+  matcher.Insert(Cidr("0.0.0.0", 0), 2);
+  EXPECT_EQ(matcher.Lookup(Address("2001:db8::1")), 1u);
+  EXPECT_EQ(matcher.Lookup(Address("2001:db9::1")), 0u);
+  EXPECT_EQ(matcher.Lookup(Address("8.8.8.8")), 2u);
+}
+
+TEST(XdsFilterChainMatchTableTest, PicksMostSpecificDestination) {
+  auto wide = std::make_shared<FilterChainData>();
+  auto narrow = std::make_shared<FilterChainData>();
+  FilterChainMap map;
+  map.destination_ip_vector.push_back(
+      DestinationIp(Cidr("10.0.0.0", 8), ConnectionSourceType::kAny,
+                    {SourceIp(std::nullopt, wide)}));
+  map.destination_ip_vector.push_back(
+      DestinationIp(Cidr("10.0.0.0", 24), ConnectionSourceType::kAny,
+                    {SourceIp(std::nullopt, narrow)}));
+  XdsFilterChainMatchTable table(map);
+  const grpc_resolved_address source = Address("1.2.3.4");
+  EXPECT_EQ(table.Find(Address("10.0.0.5"), source, 1234, false),
+            narrow.get());
+  EXPECT_EQ(table.Find(Address("10.9.0.5"), source, 1234, false), wide.get());
+  EXPECT_EQ(table.Find(Address("11.0.0.5"), source, 1234, false), nullptr);
+}
+
+TEST(XdsFilterChainMatchTableTest, MatchesSourceTypeAndPort) {
+  auto local = std::make_shared<FilterChainData>();
+  auto external = std::make_shared<FilterChainData>();
+  auto external_port = std::make_shared<FilterChainData>();
+  FilterChainMap map;
+  FilterChainMap::DestinationIp destination_ip =
+      DestinationIp(std::nullopt, ConnectionSourceType::kSameIpOrLoopback,
+                    {SourceIp(std::nullopt, local)});
+  FilterChainMap::SourceIp external_ip =
+      SourceIp(Cidr("192.168.0.0", 16), external);
+  external_ip.ports_map[443].data = external_port;
+  destination_ip
+      .source_types_array[static_cast<int>(ConnectionSourceType::kExternal)]
+      .push_back(std::move(external_ip));
+  map.destination_ip_vector.push_back(std::move(destination_ip));
+  XdsFilterChainMatchTable table(map);
+  const grpc_resolved_address destination = Address("10.0.0.1");
+  EXPECT_EQ(table.Find(destination, Address("127.0.0.1"), 1234, true),
+            local.get());
+  EXPECT_EQ(table.Find(destination, Address("192.168.1.1"), 1234, false),
+            external.get());
+  EXPECT_EQ(table.Find(destination, Address("192.168.1.1"), 443, false),
+            external_port.get());
+  EXPECT_EQ(table.Find(destination, Address("172.16.0.1"), 443, false),
+            nullptr);
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -22,6 +22,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <vector>
 
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
@@ -30,6 +31,7 @@
 #include "gtest/gtest.h"
 #include "src/core/config/core_configuration.h"
 #include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/service_config/service_config_impl.h"
 #include "src/core/service_config/service_config_parser.h"
 #include "src/core/util/json/json.h"
@@ -65,6 +67,10 @@ class TestParser1 : public ServiceConfigParser::Parser {
  public:
   absl::string_view name() const override { return "test_parser_1"; }
 
+  std::vector<absl::string_view> ChannelArgKeys() const override {
+    return {GRPC_ARG_DISABLE_PARSING};
+  }
+
   std::unique_ptr<ServiceConfigParser::ParsedConfig> ParseGlobalParams(
       const ChannelArgs& args, const Json& json,
       ValidationErrors* errors) override {
@@ -96,6 +102,10 @@ class TestParser2 : public ServiceConfigParser::Parser {
  public:
   absl::string_view name() const override { return "test_parser_2"; }
 
+  std::vector<absl::string_view> ChannelArgKeys() const override {
+    return {GRPC_ARG_DISABLE_PARSING};
+  }
+
   std::unique_ptr<ServiceConfigParser::ParsedConfig> ParsePerMethodParams(
       const ChannelArgs& args, const Json& json,
       ValidationErrors* errors) override {
@@ -290,6 +300,35 @@ TEST_F(ServiceConfigTest, Parser1DisabledViaChannelArg) {
   EXPECT_EQ((*service_config)->GetGlobalParsedConfig(0), nullptr);
 }
 
+TEST_F(ServiceConfigTest, SharedBetweenChannelsWithSameParserArgs) {
+  if (!IsSharedServiceConfigsEnabled()) {
+    GTEST_SKIP() << "shared_service_configs experiment not enabled";
+  }
+  const char* test_json = "{\"global_param\":5}";
+  auto svc_cfg = ServiceConfigImpl::Create(ChannelArgs(), test_json);
+  ASSERT_TRUE(svc_cfg.ok()) << svc_cfg.status();
+  // Args that the parsers do not read do not prevent sharing.
+  auto shared_svc_cfg = ServiceConfigImpl::Create(
+      ChannelArgs().Set("grpc.unrelated_arg", 1), test_json);
+  ASSERT_TRUE(shared_svc_cfg.ok()) << shared_svc_cfg.status();
+  EXPECT_EQ(shared_svc_cfg->get(), svc_cfg->get());
+  // Args that the parsers read do.
+  auto disabled_svc_cfg = ServiceConfigImpl::Create(
+      ChannelArgs().Set(GRPC_ARG_DISABLE_PARSING, 1), test_json);
+  ASSERT_TRUE(disabled_svc_cfg.ok()) << disabled_svc_cfg.status();
+  EXPECT_NE(disabled_svc_cfg->get(), svc_cfg->get());
+  EXPECT_EQ((*disabled_svc_cfg)->GetGlobalParsedConfig(0), nullptr);
+  // Once released, the service config is parsed again.
+  svc_cfg->reset();
+  shared_svc_cfg->reset();
+  svc_cfg = ServiceConfigImpl::Create(ChannelArgs(), test_json);
+  ASSERT_TRUE(svc_cfg.ok()) << svc_cfg.status();
+  auto parsed_config = static_cast<TestParsedConfig1*>(
+      (*svc_cfg)->GetGlobalParsedConfig(0));
+  ASSERT_NE(parsed_config, nullptr);
+  EXPECT_EQ(parsed_config->value(), 5);
+}
+
 TEST_F(ServiceConfigTest, Parser1ErrorInvalidType) {
   const char* test_json = "{\"global_param\":[]}";
   auto service_config = ServiceConfigImpl::Create(ChannelArgs(), test_json);
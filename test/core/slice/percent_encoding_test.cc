@@ -118,6 +118,22 @@ TEST(PercentEncodingTest, MainTest) {
   TEST_NONCONFORMANT_VECTOR("\0", "\0");
 }
 
+TEST(PercentEncodingTest, LongVectors) {
+  // Long enough to exercise the word-at-a-time scan, with the byte that
+  // needs escaping at the start, inside and at the end of a word.
+  TEST_VECTOR("%bcdefghijklmnopqrstuvwxyz", "%25bcdefghijklmnopqrstuvwxyz",
+              grpc_core::PercentEncodingType::Compatible);
+  TEST_VECTOR("abcdefghijk\nmnopqrstuvwxyz", "abcdefghijk%0Amnopqrstuvwxyz",
+              grpc_core::PercentEncodingType::Compatible);
+  TEST_VECTOR("abcdefghijklmnopqrstuvwxy\x7f", "abcdefghijklmnopqrstuvwxy%7F",
+              grpc_core::PercentEncodingType::Compatible);
+  TEST_VECTOR("abcdefghijklmnop\xc3\xa9", "abcdefghijklmnop%C3%A9",
+              grpc_core::PercentEncodingType::Compatible);
+  TEST_VECTOR("status message: all good", "status message: all good",
+              grpc_core::PercentEncodingType::Compatible);
+  TEST_NONCONFORMANT_VECTOR("abcdefghijklmnop%4", "abcdefghijklmnop%4");
+}
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(&argc, argv);
   ::testing::InitGoogleTest(&argc, argv);
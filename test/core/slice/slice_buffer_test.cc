@@ -20,10 +20,12 @@
 #include <string.h>
 
 #include <memory>
+#include <string>
 #include <utility>
 
 #include "absl/log/check.h"
 #include "gtest/gtest.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/slice/slice.h"
 
 using ::grpc_core::Slice;
@@ -76,6 +78,81 @@ TEST(SliceBufferTest, SliceRefTest) {
   sb.Clear();
 }
 
+TEST(SliceBufferTest, CoalesceSmallSlicesTest) {
+  SliceBuffer sb;
+  std::string expected;
+  auto append = [&sb, &expected](size_t len, char c) {
+    std::string contents(len, c);
+    sb.Append(Slice::FromCopiedString(contents));
+    expected += contents;
+  };
+  append(100, 'a');
+  append(100, 'b');
+  append(100, 'c');
+  append(5000, 'd');
+  append(100, 'e');
+  append(5000, 'f');
+  append(100, 'g');
+  append(100, 'h');
+  ASSERT_EQ(sb.Count(), 8);
+  sb.CoalesceSmallSlices(512, 16384);
+  ASSERT_EQ(sb.Count(), 5);
+  EXPECT_EQ(sb[0].length(), 300);
+  EXPECT_EQ(sb[1].length(), 5000);
+  EXPECT_EQ(sb[2].length(), 100);
+  EXPECT_EQ(sb[3].length(), 5000);
+  EXPECT_EQ(sb[4].length(), 200);
+  EXPECT_EQ(sb.Length(), expected.size());
+  EXPECT_EQ(sb.JoinIntoString(), expected);
+}
+
+TEST(SliceBufferTest, CoalesceSmallSlicesRespectsRunSizeTest) {
+  SliceBuffer sb;
+  std::string expected;
+  for (int i = 0; i < 10; i++) {
+    std::string contents(100, static_cast<char>('a' + i));
+    sb.Append(Slice::FromCopiedString(contents));
+    expected += contents;
+  }
+  sb.CoalesceSmallSlices(512, 400);
+  ASSERT_EQ(sb.Count(), 3);
+  EXPECT_EQ(sb[0].length(), 400);
+  EXPECT_EQ(sb[1].length(), 400);
+  EXPECT_EQ(sb[2].length(), 200);
+  EXPECT_EQ(sb.JoinIntoString(), expected);
+}
+
+TEST(SliceBufferTest, CoalesceSmallSlicesLeavesLargeSlicesTest) {
+  SliceBuffer sb;
+  Slice first_slice = MakeSlice(kNewSliceLength);
+  Slice second_slice = MakeSlice(kNewSliceLength);
+  const uint8_t* first_data = first_slice.data();
+  sb.Append(std::move(first_slice));
+  sb.Append(std::move(second_slice));
+  sb.CoalesceSmallSlices(kNewSliceLength, kNewSliceLength * 2);
+  ASSERT_EQ(sb.Count(), 2);
+  EXPECT_EQ(sb[0].data(), first_data);
+}
+
+TEST(SliceBufferTest, GrowsGeometrically) {
+  if (!grpc_core::IsSmallSliceInliningEnabled()) {
+    GTEST_SKIP() << "small_slice_inlining experiment is disabled";
+  }
+  SliceBuffer sb;
+  size_t reallocations = 0;
+  size_t capacity = sb.c_slice_buffer()->capacity;
+  for (int i = 0; i < 1000; ++i) {
+    sb.Append(MakeSlice(kNewSliceLength));
+    if (sb.c_slice_buffer()->capacity != capacity) {
+      capacity = sb.c_slice_buffer()->capacity;
+      ++reallocations;
+    }
+  }
+  EXPECT_EQ(sb.Count(), 1000);
+  // 3 (inline) -> 8 -> 16 -> ... -> 1024
+  EXPECT_LE(reallocations, 8);
+}
+
 int main(int argc, char** argv) {
   testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
@@ -33,6 +33,7 @@
 #include "absl/log/log.h"
 #include "absl/strings/string_view.h"
 #include "gtest/gtest.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/slice/slice_internal.h"
 #include "src/core/lib/slice/slice_refcount.h"
 #include "src/core/util/memory.h"
@@ -306,6 +307,24 @@ TEST(SliceTest, FromSmallCopiedString) {
   EXPECT_EQ(0, memcmp(slice.data(), "hello", 5));
 }
 
+TEST(SliceTest, FromRefcountAndBytesInlinesSmallSlices) {
+  if (!IsSmallSliceInliningEnabled()) {
+    GTEST_SKIP() << "small_slice_inlining experiment is disabled";
+  }
+  grpc_slice backing = grpc_slice_from_cpp_string(std::string(64, 'x'));
+  const uint8_t* begin = GRPC_SLICE_START_PTR(backing);
+  Slice small = Slice::FromRefcountAndBytes(backing.refcount, begin, begin + 5);
+  EXPECT_EQ(small.c_slice().refcount, nullptr);
+  EXPECT_EQ(small.as_string_view(), "xxxxx");
+  Slice large =
+      Slice::FromRefcountAndBytes(backing.refcount, begin, begin + 32);
+  EXPECT_EQ(large.c_slice().refcount, backing.refcount);
+  EXPECT_EQ(large.data(), begin);
+  CSliceUnref(backing);
+  // The large slice still holds a reference to the backing buffer.
+  EXPECT_EQ(large.as_string_view(), std::string(32, 'x'));
+}
+
 class SliceSizedTest : public ::testing::TestWithParam<size_t> {};
 
 std::string RandomString(size_t length) {
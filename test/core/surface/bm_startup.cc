@@ -0,0 +1,83 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Measures what a short-lived process pays before its first RPC: grpc_init
+// and the creation of its first channel.
+
+#include <benchmark/benchmark.h>
+#include <grpc/credentials.h>
+#include <grpc/grpc.h>
+
+#include "src/core/config/core_configuration.h"
+
+namespace grpc_core {
+namespace {
+
+void CreateAndDestroyChannel() {
+  grpc_channel_credentials* creds = grpc_insecure_credentials_create();
+  grpc_channel* channel = grpc_channel_create("localhost:1", creds, nullptr);
+  grpc_channel_credentials_release(creds);
+  grpc_channel_destroy(channel);
+}
+
+// A cold start: the core configuration (every LB policy, resolver, filter
+// and credentials type) is built again on each iteration.
+void BM_InitAndFirstChannel(benchmark::State& state) {
+  for (auto _ : state) {
+    grpc_init();
+    CreateAndDestroyChannel();
+    grpc_shutdown_blocking();
+    state.PauseTiming();
+    CoreConfiguration::Reset();
+    state.ResumeTiming();
+  }
+}
+BENCHMARK(BM_InitAndFirstChannel);
+
+// The same with the configuration already built, to separate its cost from
+// that of bringing up iomgr and the channel itself.
+void BM_InitAndFirstChannelWarmConfig(benchmark::State& state) {
+  for (auto _ : state) {
+    grpc_init();
+    CreateAndDestroyChannel();
+    grpc_shutdown_blocking();
+  }
+}
+BENCHMARK(BM_InitAndFirstChannelWarmConfig);
+
+// Building the core configuration alone.
+void BM_BuildCoreConfiguration(benchmark::State& state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(&CoreConfiguration::Get());
+    state.PauseTiming();
+    CoreConfiguration::Reset();
+    state.ResumeTiming();
+  }
+}
+BENCHMARK(BM_BuildCoreConfiguration);
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  ::benchmark::Initialize(&argc, argv);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
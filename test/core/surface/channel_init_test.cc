@@ -17,6 +17,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "absl/strings/string_view.h"
 #include "gtest/gtest.h"
@@ -24,6 +25,7 @@
 #include "src/core/lib/channel/channel_stack.h"
 #include "src/core/lib/channel/channel_stack_builder_impl.h"
 #include "src/core/lib/channel/promise_based_filter.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
 #include "src/core/lib/surface/channel_stack_type.h"
 #include "test/core/test_util/test_config.h"
@@ -344,6 +346,121 @@ TEST(ChannelInitTest, CanCreateFilterWithCall) {
   EXPECT_EQ(handled, 1);
 }
 
+constexpr absl::string_view kLoggingFilterNames[] = {"a", "b", "c", "ab",
+                                                      "abc"};
+
+// Records its name in the "log" channel arg when it is created.
+template <int N>
+class LoggingFilter {
+ public:
+  static absl::string_view TypeName() { return kLoggingFilterNames[N]; }
+
+  static absl::StatusOr<std::unique_ptr<LoggingFilter>> Create(
+      const ChannelArgs& args, ChannelFilter::Args) {
+    args.GetPointer<std::vector<std::string>>("log")->emplace_back(TypeName());
+    return std::make_unique<LoggingFilter>();
+  }
+
+  static const grpc_channel_filter kFilter;
+
+  class Call {
+   public:
+    static const NoInterceptor OnClientInitialMetadata;
+    static const NoInterceptor OnServerInitialMetadata;
+    static const NoInterceptor OnServerTrailingMetadata;
+    static const NoInterceptor OnClientToServerMessage;
+    static const NoInterceptor OnClientToServerHalfClose;
+    static const NoInterceptor OnServerToClientMessage;
+    static const NoInterceptor OnFinalize;
+  };
+};
+
+template <int N>
+const grpc_channel_filter LoggingFilter<N>::kFilter = {
+    nullptr, nullptr, 0,       nullptr,
+    nullptr, nullptr, 0,       nullptr,
+    nullptr, nullptr, nullptr, UniqueTypeNameFor<LoggingFilter<N>>()};
+template <int N>
+const NoInterceptor LoggingFilter<N>::Call::OnClientInitialMetadata;
+template <int N>
+const NoInterceptor LoggingFilter<N>::Call::OnServerInitialMetadata;
+template <int N>
+const NoInterceptor LoggingFilter<N>::Call::OnServerTrailingMetadata;
+template <int N>
+const NoInterceptor LoggingFilter<N>::Call::OnClientToServerMessage;
+template <int N>
+const NoInterceptor LoggingFilter<N>::Call::OnClientToServerHalfClose;
+template <int N>
+const NoInterceptor LoggingFilter<N>::Call::OnServerToClientMessage;
+template <int N>
+const NoInterceptor LoggingFilter<N>::Call::OnFinalize;
+
+// Stands in for a FusedFilter over Filters, so that tests can see which
+// fusion was used.
+template <int N, typename... Filters>
+class LoggingFusedFilter : public LoggingFilter<N> {
+ public:
+  static std::vector<UniqueTypeName> FilterNames() {
+    return {UniqueTypeNameFor<Filters>()...};
+  }
+};
+
+using FilterA = LoggingFilter<0>;
+using FilterB = LoggingFilter<1>;
+using FilterC = LoggingFilter<2>;
+using FusedAB = LoggingFusedFilter<3, FilterA, FilterB>;
+using FusedABC = LoggingFusedFilter<4, FilterA, FilterB, FilterC>;
+
+std::vector<std::string> GetCreatedFilters(const ChannelInit& init) {
+  std::vector<std::string> log;
+  InterceptionChainBuilder chain_builder{
+      ChannelArgs().Set("log", ChannelArgs::UnownedPointer(&log))};
+  init.AddToInterceptionChainBuilder(GRPC_CLIENT_CHANNEL, chain_builder);
+  return log;
+}
+
+TEST(ChannelInitTest, FusesAdjacentFilters) {
+  if (!IsFusedFilterStacksEnabled()) {
+    GTEST_SKIP() << "fused_filter_stacks experiment is disabled";
+  }
+  ChannelInit::Builder b;
+  b.RegisterFilter<FilterA>(GRPC_CLIENT_CHANNEL);
+  b.RegisterFilter<FilterB>(GRPC_CLIENT_CHANNEL);
+  b.RegisterFilter<FilterC>(GRPC_CLIENT_CHANNEL);
+  b.RegisterFusedFilter<FusedAB>(GRPC_CLIENT_CHANNEL);
+  EXPECT_EQ(GetCreatedFilters(b.Build()),
+            std::vector<std::string>({"ab", "c"}));
+}
+
+TEST(ChannelInitTest, PrefersLongestFusion) {
+  if (!IsFusedFilterStacksEnabled()) {
+    GTEST_SKIP() << "fused_filter_stacks experiment is disabled";
+  }
+  ChannelInit::Builder b;
+  b.RegisterFilter<FilterA>(GRPC_CLIENT_CHANNEL);
+  b.RegisterFilter<FilterB>(GRPC_CLIENT_CHANNEL);
+  b.RegisterFilter<FilterC>(GRPC_CLIENT_CHANNEL);
+  b.RegisterFusedFilter<FusedAB>(GRPC_CLIENT_CHANNEL);
+  b.RegisterFusedFilter<FusedABC>(GRPC_CLIENT_CHANNEL);
+  EXPECT_EQ(GetCreatedFilters(b.Build()), std::vector<std::string>({"abc"}));
+}
+
+TEST(ChannelInitTest, DoesNotFuseAroundExcludedFilters) {
+  if (!IsFusedFilterStacksEnabled()) {
+    GTEST_SKIP() << "fused_filter_stacks experiment is disabled";
+  }
+  ChannelInit::Builder b;
+  b.RegisterFilter<FilterA>(GRPC_CLIENT_CHANNEL);
+  b.RegisterFilter<FilterB>(GRPC_CLIENT_CHANNEL).If([](const ChannelArgs&) {
+    return false;
+  });
+  b.RegisterFilter<FilterC>(GRPC_CLIENT_CHANNEL);
+  b.RegisterFusedFilter<FusedAB>(GRPC_CLIENT_CHANNEL);
+  b.RegisterFusedFilter<FusedABC>(GRPC_CLIENT_CHANNEL);
+  EXPECT_EQ(GetCreatedFilters(b.Build()),
+            std::vector<std::string>({"a", "c"}));
+}
+
 }  // namespace
 }  // namespace grpc_core
 
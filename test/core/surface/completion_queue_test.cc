@@ -24,12 +24,15 @@
 #include <stddef.h>
 
 #include <memory>
+#include <thread>
 
 #include "absl/log/log.h"
 #include "absl/status/status.h"
 #include "gtest/gtest.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
 #include "src/core/lib/event_engine/shim.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/util/notification.h"
 #include "src/core/util/useful.h"
 #include "test/core/test_util/test_config.h"
 
@@ -175,6 +178,45 @@ TEST(GrpcCompletionQueueTest, TestCqEndOp) {
   }
 }
 
+TEST(GrpcCompletionQueueTest, TestNextBatch) {
+  grpc_core::ExecCtx exec_ctx;
+  grpc_completion_queue* cc = grpc_completion_queue_create_for_next(nullptr);
+  grpc_cq_completion completions[5];
+  void* tags[GPR_ARRAY_SIZE(completions)];
+  for (size_t i = 0; i < GPR_ARRAY_SIZE(completions); i++) {
+    tags[i] = create_test_tag();
+    ASSERT_TRUE(grpc_cq_begin_op(cc, tags[i]));
+    grpc_cq_end_op(cc, tags[i], absl::OkStatus(), do_nothing_end_completion,
+                   nullptr, &completions[i]);
+  }
+
+  grpc_event events[4];
+  ASSERT_EQ(grpc_completion_queue_next_batch(
+                cc, events, 4, gpr_inf_past(GPR_CLOCK_REALTIME), nullptr),
+            4);
+  for (size_t i = 0; i < 4; i++) {
+    ASSERT_EQ(events[i].type, GRPC_OP_COMPLETE);
+    ASSERT_EQ(events[i].tag, tags[i]);
+    ASSERT_TRUE(events[i].success);
+  }
+  // Only what is left is returned, without waiting for more.
+  ASSERT_EQ(grpc_completion_queue_next_batch(
+                cc, events, 4, gpr_inf_past(GPR_CLOCK_REALTIME), nullptr),
+            1);
+  ASSERT_EQ(events[0].tag, tags[4]);
+  ASSERT_EQ(grpc_completion_queue_next_batch(
+                cc, events, 4, gpr_inf_past(GPR_CLOCK_REALTIME), nullptr),
+            1);
+  ASSERT_EQ(events[0].type, GRPC_QUEUE_TIMEOUT);
+
+  grpc_completion_queue_shutdown(cc);
+  ASSERT_EQ(grpc_completion_queue_next_batch(
+                cc, events, 4, gpr_inf_past(GPR_CLOCK_REALTIME), nullptr),
+            1);
+  ASSERT_EQ(events[0].type, GRPC_QUEUE_SHUTDOWN);
+  grpc_completion_queue_destroy(cc);
+}
+
 TEST(GrpcCompletionQueueTest, TestCqTlsCacheFull) {
   grpc_event ev;
   grpc_completion_queue* cc;
@@ -490,6 +532,64 @@ TEST(GrpcCompletionQueueTest, TestCallback) {
   gpr_mu_destroy(&shutdown_mu);
 }
 
+TEST(GrpcCompletionQueueTest, TestCallbackInline) {
+  struct InlineTag : public grpc_completion_queue_functor {
+    InlineTag() {
+      functor_run = &InlineTag::Run;
+      inlineable = false;
+    }
+    static void Run(grpc_completion_queue_functor* cb, int ok) {
+      auto* tag = static_cast<InlineTag*>(cb);
+      ASSERT_TRUE(ok);
+      tag->thread = std::this_thread::get_id();
+      tag->done.Notify();
+    }
+    std::thread::id thread;
+    grpc_core::Notification done;
+  };
+  grpc_completion_queue_attributes attr = {};
+  attr.version = 2;
+  attr.cq_completion_type = GRPC_CQ_CALLBACK;
+  attr.cq_polling_type = GRPC_CQ_DEFAULT_POLLING;
+  grpc_completion_queue* cc = grpc_completion_queue_create(
+      grpc_completion_queue_factory_lookup(&attr), &attr, nullptr);
+  grpc_cq_run_callbacks_inline(cc);
+
+  // Completed on an EventEngine thread: runs there once its ExecCtx flushes.
+  InlineTag on_engine;
+  grpc_cq_completion engine_completion;
+  grpc_core::Notification engine_done;
+  std::thread::id engine_thread;
+  grpc_event_engine::experimental::GetDefaultEventEngine()->Run([&]() {
+    grpc_core::ExecCtx exec_ctx;
+    engine_thread = std::this_thread::get_id();
+    ASSERT_TRUE(grpc_cq_begin_op(cc, &on_engine));
+    grpc_cq_end_op(cc, &on_engine, absl::OkStatus(),
+                   do_nothing_end_completion, nullptr, &engine_completion);
+    EXPECT_FALSE(on_engine.done.HasBeenNotified());
+    exec_ctx.Flush();
+    EXPECT_TRUE(on_engine.done.HasBeenNotified());
+    engine_done.Notify();
+  });
+  engine_done.WaitForNotification();
+  EXPECT_EQ(on_engine.thread, engine_thread);
+
+  // Completed on an application thread: still handed to the EventEngine.
+  InlineTag on_app;
+  grpc_cq_completion app_completion;
+  {
+    grpc_core::ExecCtx exec_ctx;
+    ASSERT_TRUE(grpc_cq_begin_op(cc, &on_app));
+    grpc_cq_end_op(cc, &on_app, absl::OkStatus(), do_nothing_end_completion,
+                   nullptr, &app_completion);
+  }
+  on_app.done.WaitForNotification();
+  EXPECT_NE(on_app.thread, std::this_thread::get_id());
+
+  grpc_completion_queue_shutdown(cc);
+  grpc_completion_queue_destroy(cc);
+}
+
 struct thread_state {
   grpc_completion_queue* cc;
   void* tag;
@@ -0,0 +1,143 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/surface/deadline_sweeper.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/grpc.h>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/util/notification.h"
+#include "src/core/util/time.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+using grpc_event_engine::experimental::EventEngine;
+using grpc_event_engine::experimental::GetDefaultEventEngine;
+
+class RecordingClosure : public EventEngine::Closure {
+ public:
+  void Run() override {
+    fired_at = Timestamp::Now();
+    runs.fetch_add(1, std::memory_order_relaxed);
+    done.Notify();
+  }
+
+  Timestamp fired_at;
+  std::atomic<int> runs{0};
+  Notification done;
+};
+
+TEST(DeadlineSweeperTest, FiresNoEarlierThanDeadline) {
+  auto event_engine = GetDefaultEventEngine();
+  // Short deadlines are armed straight away, long ones by a sweep.
+  const std::vector<Duration> timeouts = {
+      Duration::Milliseconds(10), Duration::Milliseconds(150),
+      Duration::Milliseconds(350), Duration::Milliseconds(700)};
+  std::vector<DeadlineSweeper::Entry> entries(timeouts.size());
+  std::vector<RecordingClosure> closures(timeouts.size());
+  std::vector<Timestamp> deadlines;
+  for (size_t i = 0; i < timeouts.size(); ++i) {
+    deadlines.push_back(Timestamp::Now() + timeouts[i]);
+    DeadlineSweeper::Get()->Schedule(&entries[i], deadlines[i],
+                                     event_engine.get(), &closures[i]);
+  }
+  for (size_t i = 0; i < timeouts.size(); ++i) {
+    closures[i].done.WaitForNotification();
+    EXPECT_GE(closures[i].fired_at, deadlines[i]) << timeouts[i];
+    EXPECT_FALSE(DeadlineSweeper::Get()->Cancel(&entries[i]));
+  }
+}
+
+TEST(DeadlineSweeperTest, CancelledEntriesDoNotFire) {
+  auto event_engine = GetDefaultEventEngine();
+  constexpr int kEntries = 100;
+  std::vector<DeadlineSweeper::Entry> entries(kEntries);
+  std::vector<RecordingClosure> closures(kEntries);
+  for (int i = 0; i < kEntries; ++i) {
+    DeadlineSweeper::Get()->Schedule(
+        &entries[i], Timestamp::Now() + Duration::Milliseconds(300 + 5 * i),
+        event_engine.get(), &closures[i]);
+  }
+  for (int i = 0; i < kEntries; i += 2) {
+    EXPECT_TRUE(DeadlineSweeper::Get()->Cancel(&entries[i]));
+  }
+  for (int i = 1; i < kEntries; i += 2) closures[i].done.WaitForNotification();
+  for (int i = 0; i < kEntries; ++i) {
+    EXPECT_EQ(closures[i].runs.load(), i % 2) << i;
+  }
+}
+
+TEST(DeadlineSweeperTest, EntriesScheduledOutOfOrder) {
+  auto event_engine = GetDefaultEventEngine();
+  constexpr int kEntries = 50;
+  std::vector<DeadlineSweeper::Entry> entries(kEntries);
+  std::vector<RecordingClosure> closures(kEntries);
+  std::vector<Timestamp> deadlines;
+  // Later deadlines first, interleaved with earlier ones.
+  for (int i = 0; i < kEntries; ++i) {
+    const int offset = i % 2 == 0 ? kEntries - i : i;
+    deadlines.push_back(Timestamp::Now() +
+                        Duration::Milliseconds(300 + 10 * offset));
+    DeadlineSweeper::Get()->Schedule(&entries[i], deadlines[i],
+                                     event_engine.get(), &closures[i]);
+  }
+  // Cancel from the middle of the queue.
+  for (int i = 0; i < kEntries; i += 3) {
+    EXPECT_TRUE(DeadlineSweeper::Get()->Cancel(&entries[i]));
+  }
+  for (int i = 0; i < kEntries; ++i) {
+    if (i % 3 == 0) continue;
+    closures[i].done.WaitForNotification();
+    EXPECT_GE(closures[i].fired_at, deadlines[i]) << i;
+  }
+  for (int i = 0; i < kEntries; ++i) {
+    EXPECT_EQ(closures[i].runs.load(), i % 3 == 0 ? 0 : 1) << i;
+  }
+}
+
+TEST(DeadlineSweeperTest, RescheduleAfterCancel) {
+  auto event_engine = GetDefaultEventEngine();
+  DeadlineSweeper::Entry entry;
+  RecordingClosure closure;
+  DeadlineSweeper::Get()->Schedule(&entry,
+                                   Timestamp::Now() + Duration::Hours(1),
+                                   event_engine.get(), &closure);
+  EXPECT_TRUE(DeadlineSweeper::Get()->Cancel(&entry));
+  const Timestamp deadline = Timestamp::Now() + Duration::Milliseconds(250);
+  DeadlineSweeper::Get()->Schedule(&entry, deadline, event_engine.get(),
+                                   &closure);
+  closure.done.WaitForNotification();
+  EXPECT_GE(closure.fired_at, deadline);
+  EXPECT_EQ(closure.runs.load(), 1);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc_init();
+  int ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
+}
@@ -0,0 +1,290 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "test/core/test_util/lb_benchmark_helper.h"
+
+#include <utility>
+#include <vector>
+
+#include "absl/log/check.h"
+#include "src/core/config/core_configuration.h"
+#include "src/core/credentials/transport/insecure/insecure_credentials.h"
+#include "src/core/lib/address_utils/sockaddr_utils.h"
+#include "src/core/lib/event_engine/channel_args_endpoint_config.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/load_balancing/health_check_client_internal.h"
+#include "src/core/util/down_cast.h"
+#include "src/core/util/json/json_reader.h"
+
+namespace grpc_core {
+namespace testing {
+
+//
+// LbBenchmarkHelper::FakeSubchannel
+//
+
+class LbBenchmarkHelper::FakeSubchannel final : public SubchannelInterface {
+ public:
+  FakeSubchannel(LbBenchmarkHelper* helper, std::string address)
+      : helper_(helper), address_(std::move(address)) {
+    MutexLock lock(&helper_->subchannels_mu_);
+    helper_->subchannels_[address_].insert(this);
+  }
+
+  ~FakeSubchannel() override {
+    MutexLock lock(&helper_->subchannels_mu_);
+    auto it = helper_->subchannels_.find(address_);
+    it->second.erase(this);
+    if (it->second.empty()) helper_->subchannels_.erase(it);
+  }
+
+  void WatchConnectivityState(
+      std::unique_ptr<ConnectivityStateWatcherInterface> watcher) override {
+    std::shared_ptr<ConnectivityStateWatcherInterface> w(std::move(watcher));
+    helper_->Notify(w, GRPC_CHANNEL_READY, absl::OkStatus());
+    connectivity_watchers_.emplace(w.get(), std::move(w));
+  }
+
+  void CancelConnectivityStateWatch(
+      ConnectivityStateWatcherInterface* watcher) override {
+    connectivity_watchers_.erase(watcher);
+  }
+
+  void RequestConnection() override {}
+
+  void ResetBackoff() override {}
+
+  void AddDataWatcher(std::unique_ptr<DataWatcherInterface> watcher) override {
+    auto* watcher_internal =
+        DownCast<InternalSubchannelDataWatcherInterface*>(watcher.get());
+    CHECK(watcher_internal->type() == HealthProducer::Type())
+        << "unimplemented watcher type: " << watcher_internal->type();
+    std::shared_ptr<ConnectivityStateWatcherInterface> w =
+        DownCast<HealthWatcher*>(watcher_internal)->TakeWatcher();
+    helper_->Notify(w, health_state_, health_status_);
+    DataWatcherInterface* key = watcher.get();
+    health_watchers_.emplace(key, HealthWatcherEntry{std::move(watcher), w});
+  }
+
+  void CancelDataWatcher(DataWatcherInterface* watcher) override {
+    health_watchers_.erase(watcher);
+  }
+
+  std::string address() const override { return address_; }
+
+  void SetHealth(grpc_connectivity_state state, const absl::Status& status) {
+    health_state_ = state;
+    health_status_ = status;
+    // Copy, since a watcher may cancel itself.
+    std::vector<std::shared_ptr<ConnectivityStateWatcherInterface>> watchers;
+    for (const auto& [_, entry] : health_watchers_) {
+      watchers.push_back(entry.watcher);
+    }
+    for (const auto& watcher : watchers) {
+      watcher->OnConnectivityStateChange(state, status);
+    }
+  }
+
+ private:
+  struct HealthWatcherEntry {
+    std::unique_ptr<DataWatcherInterface> data_watcher;
+    std::shared_ptr<ConnectivityStateWatcherInterface> watcher;
+  };
+
+  LbBenchmarkHelper* helper_;
+  const std::string address_;
+  // Only used from the WorkSerializer.
+  grpc_connectivity_state health_state_ = GRPC_CHANNEL_READY;
+  absl::Status health_status_;
+  std::map<ConnectivityStateWatcherInterface*,
+           std::shared_ptr<ConnectivityStateWatcherInterface>>
+      connectivity_watchers_;
+  std::map<DataWatcherInterface*, HealthWatcherEntry> health_watchers_;
+};
+
+//
+// LbBenchmarkHelper::LbHelper
+//
+
+class LbBenchmarkHelper::LbHelper final
+    : public LoadBalancingPolicy::ChannelControlHelper {
+ public:
+  explicit LbHelper(LbBenchmarkHelper* helper) : helper_(helper) {}
+
+  RefCountedPtr<SubchannelInterface> CreateSubchannel(
+      const grpc_resolved_address& address,
+      const ChannelArgs& /*per_address_args*/,
+      const ChannelArgs& /*args*/) override {
+    return MakeRefCounted<FakeSubchannel>(
+        helper_, grpc_sockaddr_to_string(&address, false).value());
+  }
+
+  void UpdateState(
+      grpc_connectivity_state state, const absl::Status& /*status*/,
+      RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> picker) override {
+    // The old picker is released after unlocking, since it may hold the
+    // last refs to some subchannels.
+    MutexLock lock(&helper_->mu_);
+    helper_->state_ = state;
+    std::swap(helper_->picker_, picker);
+    helper_->cv_.SignalAll();
+  }
+
+  void RequestReresolution() override {}
+
+  absl::string_view GetTarget() override { return "foo"; }
+
+  absl::string_view GetAuthority() override { return "foo"; }
+
+  RefCountedPtr<grpc_channel_credentials> GetChannelCredentials() override {
+    return MakeRefCounted<InsecureCredentials>();
+  }
+
+  RefCountedPtr<grpc_channel_credentials> GetUnsafeChannelCredentials()
+      override {
+    return MakeRefCounted<InsecureCredentials>();
+  }
+
+  grpc_event_engine::experimental::EventEngine* GetEventEngine() override {
+    return helper_->event_engine_.get();
+  }
+
+  GlobalStatsPluginRegistry::StatsPluginGroup& GetStatsPluginGroup()
+      override {
+    return *helper_->stats_plugin_group_;
+  }
+
+  void AddTraceEvent(TraceSeverity /*severity*/,
+                     absl::string_view /*message*/) override {}
+
+ private:
+  LbBenchmarkHelper* helper_;
+};
+
+//
+// LbBenchmarkHelper
+//
+
+LbBenchmarkHelper::LbBenchmarkHelper(absl::string_view policy_name,
+                                     const ChannelArgs& args)
+    : event_engine_(grpc_event_engine::experimental::GetDefaultEventEngine()),
+      work_serializer_(std::make_shared<WorkSerializer>(event_engine_)),
+      stats_plugin_group_(GlobalStatsPluginRegistry::GetStatsPluginsForChannel(
+          experimental::StatsPluginChannelScope(
+              "foo", "foo",
+              grpc_event_engine::experimental::ChannelArgsEndpointConfig{
+                  args}))),
+      lb_policy_(CoreConfiguration::Get()
+                     .lb_policy_registry()
+                     .CreateLoadBalancingPolicy(
+                         policy_name, LoadBalancingPolicy::Args{
+                                          work_serializer_,
+                                          std::make_unique<LbHelper>(this),
+                                          args})) {
+  CHECK(lb_policy_ != nullptr) << "Failed to create LB policy: "
+                               << policy_name;
+}
+
+LbBenchmarkHelper::~LbBenchmarkHelper() {
+  RunInWorkSerializer([this]() { lb_policy_.reset(); });
+}
+
+RefCountedPtr<LoadBalancingPolicy::Config> LbBenchmarkHelper::ParseConfig(
+    absl::string_view json) {
+  auto parsed_json = JsonParse(json);
+  CHECK_OK(parsed_json);
+  auto config =
+      CoreConfiguration::Get().lb_policy_registry().ParseLoadBalancingConfig(
+          *parsed_json);
+  CHECK_OK(config);
+  return std::move(*config);
+}
+
+void LbBenchmarkHelper::Update(
+    EndpointAddressesList addresses,
+    RefCountedPtr<LoadBalancingPolicy::Config> config,
+    const ChannelArgs& args) {
+  RunInWorkSerializer([&]() {
+    CHECK_OK(lb_policy_->UpdateLocked(LoadBalancingPolicy::UpdateArgs{
+        std::make_shared<EndpointAddressesListIterator>(std::move(addresses)),
+        std::move(config), "", args}));
+  });
+}
+
+void LbBenchmarkHelper::RunInWorkSerializer(
+    absl::AnyInvocable<void()> callback) {
+  {
+    MutexLock lock(&mu_);
+    ++pending_notifications_;
+  }
+  work_serializer_->Run([this, callback = std::move(callback)]() mutable {
+    callback();
+    MutexLock lock(&mu_);
+    --pending_notifications_;
+    cv_.SignalAll();
+  });
+  // Notifications queued by a notification are counted before the one
+  // that queued them is done, so this only sees zero once all are done.
+  MutexLock lock(&mu_);
+  while (pending_notifications_ != 0) cv_.Wait(&mu_);
+}
+
+void LbBenchmarkHelper::Notify(
+    std::shared_ptr<SubchannelInterface::ConnectivityStateWatcherInterface>
+        watcher,
+    grpc_connectivity_state state, absl::Status status) {
+  {
+    MutexLock lock(&mu_);
+    ++pending_notifications_;
+  }
+  work_serializer_->Run([this, watcher = std::move(watcher), state,
+                         status = std::move(status)]() {
+    watcher->OnConnectivityStateChange(state, status);
+    MutexLock lock(&mu_);
+    --pending_notifications_;
+    cv_.SignalAll();
+  });
+}
+
+void LbBenchmarkHelper::SetHealthLocked(const std::string& address,
+                                        grpc_connectivity_state state,
+                                        const absl::Status& status) {
+  // Copy, since the policy may create or drop subchannels in response.
+  // The caller must make sure that none of these go away meanwhile, by
+  // not holding pickers from before the last update.
+  std::set<FakeSubchannel*> subchannels;
+  {
+    MutexLock lock(&subchannels_mu_);
+    auto it = subchannels_.find(address);
+    if (it != subchannels_.end()) subchannels = it->second;
+  }
+  for (FakeSubchannel* subchannel : subchannels) {
+    subchannel->SetHealth(state, status);
+  }
+}
+
+RefCountedPtr<LoadBalancingPolicy::SubchannelPicker>
+LbBenchmarkHelper::GetPicker() {
+  MutexLock lock(&mu_);
+  while (picker_ == nullptr) cv_.Wait(&mu_);
+  return picker_;
+}
+
+grpc_connectivity_state LbBenchmarkHelper::state() {
+  MutexLock lock(&mu_);
+  return state_;
+}
+
+}  // namespace testing
+}  // namespace grpc_core
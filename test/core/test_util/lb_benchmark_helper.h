@@ -0,0 +1,117 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_TEST_CORE_TEST_UTIL_LB_BENCHMARK_HELPER_H
+#define GRPC_TEST_CORE_TEST_UTIL_LB_BENCHMARK_HELPER_H
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/impl/connectivity_state.h>
+
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/functional/any_invocable.h"
+#include "absl/status/status.h"
+#include "absl/strings/string_view.h"
+#include "src/core/client_channel/subchannel_interface_internal.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/load_balancing/lb_policy.h"
+#include "src/core/resolver/endpoint_addresses.h"
+#include "src/core/telemetry/metrics.h"
+#include "src/core/util/orphanable.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/sync.h"
+#include "src/core/util/work_serializer.h"
+
+namespace grpc_core {
+namespace testing {
+
+// Runs an LB policy outside of a channel, for benchmarks.  Subchannels
+// report READY, and healthy, as soon as they are watched; the health of
+// each address can then be changed with SetHealthLocked().  Thread-safe.
+class LbBenchmarkHelper {
+ public:
+  explicit LbBenchmarkHelper(absl::string_view policy_name,
+                             const ChannelArgs& args = ChannelArgs());
+  ~LbBenchmarkHelper();
+
+  LbBenchmarkHelper(const LbBenchmarkHelper&) = delete;
+  LbBenchmarkHelper& operator=(const LbBenchmarkHelper&) = delete;
+
+  // Parses an LB policy config, CHECK-failing if it is invalid.
+  static RefCountedPtr<LoadBalancingPolicy::Config> ParseConfig(
+      absl::string_view json);
+
+  // Sends an update to the policy, and waits until it and every
+  // connectivity and health notification it leads to have been handled.
+  void Update(EndpointAddressesList addresses,
+              RefCountedPtr<LoadBalancingPolicy::Config> config,
+              const ChannelArgs& args = ChannelArgs());
+
+  // Runs callback in the WorkSerializer, and then waits until the
+  // notifications it leads to have been handled.
+  void RunInWorkSerializer(absl::AnyInvocable<void()> callback);
+
+  // Sets the health of every subchannel for address, which is in the form
+  // returned by grpc_sockaddr_to_string().  Must be called from the
+  // WorkSerializer.
+  void SetHealthLocked(const std::string& address,
+                       grpc_connectivity_state state,
+                       const absl::Status& status);
+
+  // Returns the last picker reported by the policy, waiting for the first
+  // one if necessary.
+  RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> GetPicker();
+
+  // Returns the state reported alongside GetPicker().
+  grpc_connectivity_state state();
+
+  WorkSerializer* work_serializer() { return work_serializer_.get(); }
+
+ private:
+  class FakeSubchannel;
+  class LbHelper;
+
+  // Delivers a notification to watcher in the WorkSerializer, counting it
+  // as pending until it has been handled.
+  void Notify(
+      std::shared_ptr<SubchannelInterface::ConnectivityStateWatcherInterface>
+          watcher,
+      grpc_connectivity_state state, absl::Status status);
+
+  std::shared_ptr<grpc_event_engine::experimental::EventEngine> event_engine_;
+  std::shared_ptr<WorkSerializer> work_serializer_;
+  std::shared_ptr<GlobalStatsPluginRegistry::StatsPluginGroup>
+      stats_plugin_group_;
+  OrphanablePtr<LoadBalancingPolicy> lb_policy_;
+  Mutex mu_;
+  CondVar cv_;
+  RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> picker_
+      ABSL_GUARDED_BY(mu_);
+  grpc_connectivity_state state_ ABSL_GUARDED_BY(mu_) = GRPC_CHANNEL_IDLE;
+  size_t pending_notifications_ ABSL_GUARDED_BY(mu_) = 0;
+  // Subchannels may be released by pickers on any thread, so they
+  // register themselves here under a mutex of their own.
+  Mutex subchannels_mu_;
+  std::map<std::string, std::set<FakeSubchannel*>> subchannels_
+      ABSL_GUARDED_BY(subchannels_mu_);
+};
+
+}  // namespace testing
+}  // namespace grpc_core
+
+#endif  // GRPC_TEST_CORE_TEST_UTIL_LB_BENCHMARK_HELPER_H
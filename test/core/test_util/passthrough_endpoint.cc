@@ -14,6 +14,9 @@
 
 #include "test/core/test_util/passthrough_endpoint.h"
 
+#include <algorithm>
+#include <chrono>
+
 namespace grpc_event_engine {
 namespace experimental {
 
@@ -45,14 +48,22 @@ class PassthroughEndpoint::CallbackHelper {
 PassthroughEndpoint::PassthroughEndpointPair
 PassthroughEndpoint::MakePassthroughEndpoint(int client_port, int server_port,
                                              bool allow_inline_callbacks) {
+  return MakePassthroughEndpoint(client_port, server_port,
+                                 allow_inline_callbacks, Shaping());
+}
+
+PassthroughEndpoint::PassthroughEndpointPair
+PassthroughEndpoint::MakePassthroughEndpoint(int client_port, int server_port,
+                                             bool allow_inline_callbacks,
+                                             Shaping shaping) {
   auto send_middle =
       grpc_core::MakeRefCounted<PassthroughEndpoint::Middle>(client_port);
   auto recv_middle =
       grpc_core::MakeRefCounted<PassthroughEndpoint::Middle>(server_port);
   auto client = std::unique_ptr<PassthroughEndpoint>(new PassthroughEndpoint(
-      send_middle, recv_middle, allow_inline_callbacks));
+      send_middle, recv_middle, allow_inline_callbacks, shaping));
   auto server = std::unique_ptr<PassthroughEndpoint>(new PassthroughEndpoint(
-      recv_middle, send_middle, allow_inline_callbacks));
+      recv_middle, send_middle, allow_inline_callbacks, shaping));
   return {std::move(client), std::move(server)};
 }
 
@@ -74,6 +85,14 @@ bool PassthroughEndpoint::Read(absl::AnyInvocable<void(absl::Status)> on_read,
   }
   if (recv_middle_->on_write != nullptr) {
     *buffer = std::move(*recv_middle_->write_buffer);
+    if (shaped()) {
+      FinishShapedTransfer(recv_middle_,
+                           Transfer(*recv_middle_, buffer->Length()),
+                           std::move(recv_middle_->on_write),
+                           std::move(on_read));
+      recv_middle_->on_write = nullptr;
+      return false;
+    }
     callback_helper.AddCallback(
         [on_write = std::move(recv_middle_->on_write)]() mutable {
           on_write(absl::OkStatus());
@@ -98,6 +117,14 @@ bool PassthroughEndpoint::Write(absl::AnyInvocable<void(absl::Status)> on_write,
   }
   if (send_middle_->on_read != nullptr) {
     *send_middle_->read_buffer = std::move(*buffer);
+    if (shaped()) {
+      FinishShapedTransfer(
+          send_middle_,
+          Transfer(*send_middle_, send_middle_->read_buffer->Length()),
+          std::move(on_write), std::move(send_middle_->on_read));
+      send_middle_->on_read = nullptr;
+      return false;
+    }
     callback_helper.AddCallback(
         [on_read = std::move(send_middle_->on_read)]() mutable {
           on_read(absl::OkStatus());
@@ -110,6 +137,46 @@ bool PassthroughEndpoint::Write(absl::AnyInvocable<void(absl::Status)> on_write,
   return false;
 }
 
+PassthroughEndpoint::TransferDelays PassthroughEndpoint::Transfer(
+    Middle& middle, size_t bytes) {
+  const auto now = std::chrono::steady_clock::now();
+  EventEngine::Duration write_delay{0};
+  if (shaping_.bytes_per_second > 0) {
+    middle.link_free =
+        std::max(now, middle.link_free) +
+        std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<double>(
+                static_cast<double>(bytes) / shaping_.bytes_per_second));
+    write_delay =
+        std::chrono::duration_cast<EventEngine::Duration>(middle.link_free -
+                                                          now);
+  }
+  return {write_delay, write_delay + shaping_.latency};
+}
+
+void PassthroughEndpoint::FinishShapedTransfer(
+    grpc_core::RefCountedPtr<Middle> middle, TransferDelays delays,
+    absl::AnyInvocable<void(absl::Status)> on_write,
+    absl::AnyInvocable<void(absl::Status)> on_read) {
+  auto finish = [middle = std::move(middle)](
+                    absl::AnyInvocable<void(absl::Status)> callback) {
+    absl::Status status;
+    {
+      grpc_core::MutexLock lock(&middle->mu);
+      if (middle->closed) status = absl::CancelledError();
+    }
+    callback(status);
+  };
+  event_engine_->RunAfter(
+      delays.write, [finish, on_write = std::move(on_write)]() mutable {
+        finish(std::move(on_write));
+      });
+  event_engine_->RunAfter(
+      delays.read, [finish, on_read = std::move(on_read)]() mutable {
+        finish(std::move(on_read));
+      });
+}
+
 void PassthroughEndpoint::Middle::Close(CallbackHelper& callback_helper) {
   grpc_core::MutexLock lock(&mu);
   closed = true;
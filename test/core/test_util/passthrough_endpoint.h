@@ -17,6 +17,8 @@
 
 #include <grpc/event_engine/event_engine.h>
 
+#include <chrono>
+#include <cstddef>
 #include <memory>
 
 #include "src/core/lib/event_engine/default_event_engine.h"
@@ -40,6 +42,20 @@ class PassthroughEndpoint final : public EventEngine::Endpoint {
   static PassthroughEndpointPair MakePassthroughEndpoint(
       int client_port, int server_port, bool allow_inline_callbacks);
 
+  // Makes the pair behave like a link with some latency and bandwidth,
+  // without any of the kernel's costs. Shaped transfers always complete
+  // asynchronously, so they never run callbacks inline.
+  struct Shaping {
+    // Added to the time it takes each write to reach the reader.
+    EventEngine::Duration latency{0};
+    // The rate at which the link moves bytes in each direction, or 0 for
+    // no limit.
+    size_t bytes_per_second = 0;
+  };
+  static PassthroughEndpointPair MakePassthroughEndpoint(
+      int client_port, int server_port, bool allow_inline_callbacks,
+      Shaping shaping);
+
   ~PassthroughEndpoint() override;
 
   bool Read(absl::AnyInvocable<void(absl::Status)> on_read, SliceBuffer* buffer,
@@ -81,20 +97,49 @@ class PassthroughEndpoint final : public EventEngine::Endpoint {
     SliceBuffer* write_buffer ABSL_GUARDED_BY(mu) = nullptr;
     absl::AnyInvocable<void(absl::Status)> on_write ABSL_GUARDED_BY(mu) =
         nullptr;
+    // When the link is done sending what it has been given, for shaped
+    // pairs.
+    std::chrono::steady_clock::time_point link_free ABSL_GUARDED_BY(mu);
     EventEngine::ResolvedAddress address;
   };
 
+  // When a shaped transfer completes for the writer and for the reader,
+  // counted from now.
+  struct TransferDelays {
+    EventEngine::Duration write;
+    EventEngine::Duration read;
+  };
+
   PassthroughEndpoint(grpc_core::RefCountedPtr<Middle> send_middle,
                       grpc_core::RefCountedPtr<Middle> recv_middle,
-                      bool allow_inline_callbacks)
+                      bool allow_inline_callbacks, Shaping shaping)
       : send_middle_(std::move(send_middle)),
         recv_middle_(std::move(recv_middle)),
-        allow_inline_callbacks_(allow_inline_callbacks) {}
+        allow_inline_callbacks_(allow_inline_callbacks),
+        shaping_(shaping) {}
+
+  bool shaped() const {
+    return shaping_.latency > EventEngine::Duration::zero() ||
+           shaping_.bytes_per_second > 0;
+  }
+
+  // Accounts for moving \a bytes through \a middle.
+  TransferDelays Transfer(Middle& middle, size_t bytes)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(middle.mu);
+
+  // Completes a shaped transfer through \a middle: calls \a on_write and
+  // \a on_read once \a delays have passed, with an error if the pair has
+  // been closed in the meantime.
+  void FinishShapedTransfer(grpc_core::RefCountedPtr<Middle> middle,
+                            TransferDelays delays,
+                            absl::AnyInvocable<void(absl::Status)> on_write,
+                            absl::AnyInvocable<void(absl::Status)> on_read);
 
   grpc_core::RefCountedPtr<Middle> send_middle_;
   grpc_core::RefCountedPtr<Middle> recv_middle_;
   std::shared_ptr<EventEngine> event_engine_ = GetDefaultEventEngine();
   bool allow_inline_callbacks_;
+  const Shaping shaping_;
 };
 
 }  // namespace experimental
@@ -33,6 +33,7 @@
 
 #include <cmath>
 #include <cstdint>
+#include <optional>
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
@@ -102,6 +103,56 @@ FUZZ_TEST(SendRateTest, SendRateIsRobust)
     .WithDomains(fuzztest::InRange<double>(1e-9, 1e9),
                  fuzztest::VectorOf(AnySendOp()));
 
+TEST(ActiveEndpointsTest, StartsWithAllEndpointsActive) {
+  ActiveEndpoints active_endpoints;
+  active_endpoints.AddEndpoint();
+  active_endpoints.AddEndpoint();
+  active_endpoints.AddEndpoint();
+  EXPECT_EQ(active_endpoints.active(), 3u);
+}
+
+TEST(ActiveEndpointsTest, ShrinksWhileWritesArePrompt) {
+  ActiveEndpoints active_endpoints;
+  active_endpoints.AddEndpoint();
+  active_endpoints.AddEndpoint();
+  for (uint32_t i = 0; i < ActiveEndpoints::kShrinkAfterWrites - 1; i++) {
+    EXPECT_FALSE(active_endpoints.RecordWrite(1e-6));
+  }
+  EXPECT_EQ(active_endpoints.active(), 2u);
+  EXPECT_FALSE(active_endpoints.RecordWrite(1e-6));
+  EXPECT_EQ(active_endpoints.active(), 1u);
+  // Never drops the last endpoint.
+  for (uint32_t i = 0; i < ActiveEndpoints::kShrinkAfterWrites; i++) {
+    EXPECT_FALSE(active_endpoints.RecordWrite(1e-6));
+  }
+  EXPECT_EQ(active_endpoints.active(), 1u);
+}
+
+TEST(ActiveEndpointsTest, UnknownRatesDoNotShrink) {
+  ActiveEndpoints active_endpoints;
+  active_endpoints.AddEndpoint();
+  active_endpoints.AddEndpoint();
+  for (uint32_t i = 0; i < 2 * ActiveEndpoints::kShrinkAfterWrites; i++) {
+    EXPECT_FALSE(active_endpoints.RecordWrite(0.0));
+  }
+  EXPECT_EQ(active_endpoints.active(), 2u);
+}
+
+TEST(ActiveEndpointsTest, GrowsWhenWritesQueue) {
+  ActiveEndpoints active_endpoints;
+  active_endpoints.AddEndpoint();
+  active_endpoints.AddEndpoint();
+  for (uint32_t i = 0; i < ActiveEndpoints::kShrinkAfterWrites; i++) {
+    active_endpoints.RecordWrite(1e-6);
+  }
+  ASSERT_EQ(active_endpoints.active(), 1u);
+  EXPECT_TRUE(active_endpoints.RecordWrite(0.01));
+  EXPECT_EQ(active_endpoints.active(), 2u);
+  // Already using every endpoint.
+  EXPECT_FALSE(active_endpoints.RecordWrite(std::nullopt));
+  EXPECT_EQ(active_endpoints.active(), 2u);
+}
+
 TEST(DataFrameHeaderTest, CanSerialize) {
   TcpDataFrameHeader header;
   header.payload_tag = 0x0012'3456'789a'bcde;
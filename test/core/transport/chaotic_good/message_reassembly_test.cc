@@ -0,0 +1,148 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chaotic_good/message_reassembly.h"
+
+#include <grpc/grpc.h>
+#include <grpc/status.h>
+
+#include <cstdint>
+
+#include "absl/strings/string_view.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "src/core/call/metadata_batch.h"
+#include "src/core/ext/transport/chaotic_good/frame.h"
+#include "src/core/lib/promise/map.h"
+#include "src/core/lib/promise/seq.h"
+#include "src/core/lib/resource_quota/arena.h"
+#include "test/core/transport/util/transport_test.h"
+
+using testing::MockFunction;
+using testing::StrictMock;
+
+using grpc_core::util::testing::TransportTest;
+
+namespace grpc_core {
+namespace chaotic_good {
+namespace testing {
+
+ClientMetadataHandle TestInitialMetadata() {
+  auto md = Arena::MakePooledForOverwrite<ClientMetadata>();
+  md->Set(HttpPathMetadata(), Slice::FromStaticString("/demo.Service/Step"));
+  return md;
+}
+
+BeginMessageFrame MakeBeginMessage(uint64_t length) {
+  BeginMessageFrame frame;
+  frame.stream_id = 1;
+  frame.body.set_length(length);
+  return frame;
+}
+
+// Expects the call to end with RESOURCE_EXHAUSTED and \a message.
+void ExpectCallFails(CallInitiator initiator, absl::string_view message,
+                     MockFunction<void()>* on_done) {
+  initiator.SpawnInfallible(
+      "test-read", [initiator, message, on_done]() mutable {
+        return Seq(initiator.PullServerTrailingMetadata(),
+                   [message, on_done](ServerMetadataHandle md) {
+                     EXPECT_EQ(md->get(GrpcStatusMetadata()).value(),
+                               GRPC_STATUS_RESOURCE_EXHAUSTED);
+                     EXPECT_EQ(md->get_pointer(GrpcMessageMetadata())
+                                   ->as_string_view(),
+                               message);
+                     on_done->Call();
+                   });
+      });
+}
+
+TEST_F(TransportTest, ClientFailsBeginMessageOverMaxBeforeBuffering) {
+  MessageReassembly reassembly(16);
+  auto call = MakeCall(TestInitialMetadata());
+  CallHandler handler = call.handler.StartCall();
+  StrictMock<MockFunction<void()>> on_done;
+  EXPECT_CALL(on_done, Call());
+  handler.SpawnInfallible("begin-message", [&reassembly, handler]() mutable {
+    return Map(reassembly.PushFrameInto(MakeBeginMessage(100), handler),
+               [&reassembly](StatusFlag ok) {
+                 EXPECT_FALSE(ok.ok());
+                 // No chunk of the message will be buffered.
+                 EXPECT_TRUE(reassembly.in_message_boundary());
+                 return Empty{};
+               });
+  });
+  ExpectCallFails(call.initiator,
+                  "CLIENT: Received message larger than max (100 vs. 16)",
+                  &on_done);
+  event_engine()->TickUntilIdle();
+  event_engine()->UnsetGlobalHooks();
+}
+
+TEST_F(TransportTest, ServerFailsBeginMessageOverMaxBeforeBuffering) {
+  MessageReassembly reassembly(16);
+  auto call = MakeCall(TestInitialMetadata());
+  CallHandler handler = call.handler.StartCall();
+  StrictMock<MockFunction<void()>> on_done;
+  EXPECT_CALL(on_done, Call());
+  call.initiator.SpawnInfallible(
+      "begin-message", [&reassembly, initiator = call.initiator]() mutable {
+        return Map(reassembly.PushFrameInto(MakeBeginMessage(100), initiator),
+                   [&reassembly](StatusFlag ok) {
+                     EXPECT_FALSE(ok.ok());
+                     EXPECT_TRUE(reassembly.in_message_boundary());
+                     return Empty{};
+                   });
+      });
+  ExpectCallFails(call.initiator,
+                  "SERVER: Received message larger than max (100 vs. 16)",
+                  &on_done);
+  event_engine()->TickUntilIdle();
+  event_engine()->UnsetGlobalHooks();
+}
+
+TEST_F(TransportTest, BeginMessageAtMaxIsAccepted) {
+  MessageReassembly reassembly(16);
+  auto call = MakeCall(TestInitialMetadata());
+  CallHandler handler = call.handler.StartCall();
+  StrictMock<MockFunction<void()>> on_done;
+  EXPECT_CALL(on_done, Call());
+  handler.SpawnInfallible(
+      "begin-message", [&reassembly, &on_done, handler]() mutable {
+        return Map(reassembly.PushFrameInto(MakeBeginMessage(16), handler),
+                   [&reassembly, &on_done](StatusFlag ok) {
+                     EXPECT_TRUE(ok.ok());
+                     EXPECT_FALSE(reassembly.in_message_boundary());
+                     on_done.Call();
+                     return Empty{};
+                   });
+      });
+  event_engine()->TickUntilIdle();
+  call.initiator.Cancel();
+  event_engine()->TickUntilIdle();
+  event_engine()->UnsetGlobalHooks();
+}
+
+}  // namespace testing
+}  // namespace chaotic_good
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  // Must call to create default EventEngine.
+  grpc_init();
+  int ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
+}
@@ -0,0 +1,156 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chaotic_good/shared_memory_ring.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "absl/log/check.h"
+#include "absl/status/status.h"
+#include "gtest/gtest.h"
+#include "src/core/lib/event_engine/tcp_socket_utils.h"
+
+namespace grpc_core {
+namespace chaotic_good {
+namespace {
+
+using grpc_event_engine::experimental::URIToResolvedAddress;
+
+SliceBuffer Payload(size_t size, char c) {
+  SliceBuffer buffer;
+  buffer.Append(Slice::FromCopiedString(std::string(size, c)));
+  return buffer;
+}
+
+std::shared_ptr<SharedMemoryRing> MakeRing(size_t size) {
+  auto ring = SharedMemoryRing::Create(size);
+  CHECK_OK(ring);
+  return std::move(*ring);
+}
+
+std::shared_ptr<SharedMemoryRing> OpenRing(const SharedMemoryRing& writer) {
+  auto ring = SharedMemoryRing::Open(writer.name());
+  CHECK_OK(ring);
+  return std::move(*ring);
+}
+
+TEST(SharedMemoryRingTest, ChunkSerializeRoundTrip) {
+  uint8_t buffer[SharedMemoryRing::Chunk::kWireSize];
+  SharedMemoryRing::Chunk{0x0102030405060708, 0x090a0b0c}.Serialize(buffer);
+  auto chunk = SharedMemoryRing::Chunk::Parse(buffer);
+  ASSERT_TRUE(chunk.ok()) << chunk.status();
+  EXPECT_EQ(chunk->offset, 0x0102030405060708u);
+  EXPECT_EQ(chunk->length, 0x090a0b0cu);
+  buffer[15] = 1;
+  EXPECT_FALSE(SharedMemoryRing::Chunk::Parse(buffer).ok());
+}
+
+TEST(SharedMemoryRingTest, OpenRemovesName) {
+  auto writer = MakeRing(4096);
+  auto reader = OpenRing(*writer);
+  EXPECT_EQ(reader->size(), 4096u);
+  EXPECT_FALSE(SharedMemoryRing::Open(writer->name()).ok());
+}
+
+TEST(SharedMemoryRingTest, OpenRejectsForeignNames) {
+  EXPECT_EQ(SharedMemoryRing::Open("/some-other-segment").status().code(),
+            absl::StatusCode::kInvalidArgument);
+  EXPECT_EQ(
+      SharedMemoryRing::Open("/grpc-chaotic-good-/../x").status().code(),
+      absl::StatusCode::kInvalidArgument);
+}
+
+TEST(SharedMemoryRingTest, WriteThenRead) {
+  auto writer = MakeRing(4096);
+  auto reader = OpenRing(*writer);
+  SliceBuffer payload = Payload(1000, 'a');
+  auto chunk = writer->Write(payload);
+  ASSERT_TRUE(chunk.has_value());
+  EXPECT_EQ(chunk->length, 1000u);
+  auto received = reader->Read(*chunk);
+  ASSERT_TRUE(received.ok()) << received.status();
+  EXPECT_EQ(received->JoinIntoString(), std::string(1000, 'a'));
+  // A chunk can only be read once.
+  EXPECT_FALSE(reader->Read(*chunk).ok());
+}
+
+TEST(SharedMemoryRingTest, FullRingRejectsWritesUntilRead) {
+  auto writer = MakeRing(4096);
+  auto reader = OpenRing(*writer);
+  SharedMemoryRing::Chunk chunks[3];
+  for (int i = 0; i < 3; ++i) {
+    SliceBuffer payload = Payload(1000, 'a' + i);
+    auto chunk = writer->Write(payload);
+    ASSERT_TRUE(chunk.has_value());
+    chunks[i] = *chunk;
+  }
+  SliceBuffer payload = Payload(1000, 'd');
+  EXPECT_FALSE(writer->Write(payload).has_value());
+  EXPECT_EQ(payload.Length(), 1000u);
+  ASSERT_TRUE(reader->Read(chunks[0]).ok());
+  // Space freed at the start of the ring is reused once the write wraps.
+  auto chunk = writer->Write(payload);
+  ASSERT_TRUE(chunk.has_value());
+  EXPECT_EQ(chunk->offset, 0u);
+  for (int i = 1; i < 3; ++i) {
+    auto received = reader->Read(chunks[i]);
+    ASSERT_TRUE(received.ok()) << received.status();
+    EXPECT_EQ(received->JoinIntoString(), std::string(1000, 'a' + i));
+  }
+  auto received = reader->Read(*chunk);
+  ASSERT_TRUE(received.ok()) << received.status();
+  EXPECT_EQ(received->JoinIntoString(), std::string(1000, 'd'));
+}
+
+TEST(SharedMemoryRingTest, OversizedWriteRejected) {
+  auto writer = MakeRing(4096);
+  SliceBuffer payload = Payload(4096, 'a');
+  EXPECT_FALSE(writer->Write(payload).has_value());
+}
+
+TEST(SharedMemoryRingTest, ReadRejectsOutOfRangeChunk) {
+  auto writer = MakeRing(4096);
+  auto reader = OpenRing(*writer);
+  EXPECT_FALSE(reader->Read({4096, 1}).ok());
+  EXPECT_FALSE(reader->Read({3, 1}).ok());
+  EXPECT_FALSE(reader->Read({0, 4096}).ok());
+  EXPECT_FALSE(reader->Read({0, 10}).ok());
+}
+
+TEST(SharedMemoryRingTest, SameHostPeer) {
+  auto loopback4 = URIToResolvedAddress("ipv4:127.0.0.1:1234");
+  auto loopback6 = URIToResolvedAddress("ipv6:[::1]:1234");
+  auto host_a = URIToResolvedAddress("ipv4:10.0.0.1:1234");
+  auto host_a_other_port = URIToResolvedAddress("ipv4:10.0.0.1:4321");
+  auto host_b = URIToResolvedAddress("ipv4:10.0.0.2:1234");
+  ASSERT_TRUE(loopback4.ok() && loopback6.ok() && host_a.ok() &&
+              host_a_other_port.ok() && host_b.ok());
+  EXPECT_TRUE(IsLoopbackAddress(*loopback4));
+  EXPECT_TRUE(IsLoopbackAddress(*loopback6));
+  EXPECT_FALSE(IsLoopbackAddress(*host_a));
+  EXPECT_TRUE(IsSameHostPeer(*host_a, *loopback4));
+  EXPECT_TRUE(IsSameHostPeer(*host_a, *host_a_other_port));
+  EXPECT_FALSE(IsSameHostPeer(*host_a, *host_b));
+}
+
+}  // namespace
+}  // namespace chaotic_good
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
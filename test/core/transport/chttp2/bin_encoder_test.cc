@@ -22,10 +22,15 @@
 #include <grpc/support/alloc.h>
 #include <string.h>
 
+#include <functional>
 #include <memory>
+#include <random>
+#include <vector>
 
 #include "absl/log/log.h"
 #include "gtest/gtest.h"
+#include "src/core/ext/transport/chttp2/transport/decode_huff.h"
+#include "src/core/ext/transport/chttp2/transport/huffsyms.h"
 #include "src/core/lib/slice/slice_string_helpers.h"
 #include "src/core/util/string.h"
 #include "test/core/test_util/test_config.h"
@@ -173,6 +178,67 @@ TEST(BinEncoderTest, MainTest) {
   expect_binary_header("-bin", 0);
 }
 
+// Encodes input one bit at a time, straight from the HPACK huffman table.
+static std::vector<uint8_t> ReferenceHuffmanCompress(
+    const std::vector<uint8_t>& input) {
+  std::vector<uint8_t> output;
+  uint8_t byte = 0;
+  int bits_in_byte = 0;
+  for (uint8_t c : input) {
+    const grpc_chttp2_huffsym& sym = grpc_chttp2_huffsyms[c];
+    for (int i = sym.length - 1; i >= 0; i--) {
+      byte = static_cast<uint8_t>((byte << 1) | ((sym.bits >> i) & 1));
+      if (++bits_in_byte == 8) {
+        output.push_back(byte);
+        byte = 0;
+        bits_in_byte = 0;
+      }
+    }
+  }
+  if (bits_in_byte != 0) {
+    output.push_back(static_cast<uint8_t>((byte << (8 - bits_in_byte)) |
+                                          (0xff >> bits_in_byte)));
+  }
+  return output;
+}
+
+TEST(BinEncoderTest, HuffmanCompressMatchesReference) {
+  std::mt19937 rng(0);
+  for (int i = 0; i < 1000; i++) {
+    std::vector<uint8_t> input(rng() % 300);
+    // Alternate between arbitrary bytes and printable ones, which have short
+    // codes and exercise different bit alignments.
+    for (uint8_t& c : input) {
+      c = static_cast<uint8_t>(i % 2 == 0 ? rng() % 256 : 32 + rng() % 95);
+    }
+    grpc_slice slice = grpc_slice_from_copied_buffer(
+        reinterpret_cast<const char*>(input.data()), input.size());
+    grpc_slice compressed = grpc_chttp2_huffman_compress(slice);
+    std::vector<uint8_t> got(GRPC_SLICE_START_PTR(compressed),
+                             GRPC_SLICE_END_PTR(compressed));
+    EXPECT_EQ(got, ReferenceHuffmanCompress(input));
+    std::vector<uint8_t> decoded;
+    EXPECT_TRUE(grpc_core::HuffDecoder<std::function<void(uint8_t)>>(
+                    [&decoded](uint8_t c) { decoded.push_back(c); },
+                    got.data(), got.data() + got.size())
+                    .Run());
+    EXPECT_EQ(decoded, input);
+    // The combined encoder must match huffman compressing base64.
+    grpc_slice base64 = grpc_chttp2_base64_encode(slice);
+    grpc_slice expected = grpc_chttp2_huffman_compress(base64);
+    uint32_t wire_size;
+    grpc_slice combined =
+        grpc_chttp2_base64_encode_and_huffman_compress(slice, &wire_size);
+    EXPECT_TRUE(grpc_slice_eq(combined, expected));
+    EXPECT_EQ(wire_size, GRPC_SLICE_LENGTH(base64));
+    grpc_slice_unref(combined);
+    grpc_slice_unref(expected);
+    grpc_slice_unref(base64);
+    grpc_slice_unref(compressed);
+    grpc_slice_unref(slice);
+  }
+}
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(&argc, argv);
   ::testing::InitGoogleTest(&argc, argv);
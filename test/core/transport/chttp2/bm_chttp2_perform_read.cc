@@ -0,0 +1,135 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Measures grpc_chttp2_perform_read, the legacy transport's deframer, on a
+// stream of small frames of the kind a busy client connection receives:
+// connection and stream WINDOW_UPDATEs, with the odd RST_STREAM.  The reads
+// are cut into slices of a fixed size, so that some frame headers straddle
+// two slices, as they do on the wire.
+
+#include <benchmark/benchmark.h>
+#include <grpc/grpc.h>
+#include <grpc/impl/channel_arg_names.h>
+#include <grpc/slice.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "absl/log/check.h"
+#include "absl/status/status.h"
+#include "absl/types/span.h"
+#include "src/core/ext/transport/chttp2/transport/chttp2_transport.h"
+#include "src/core/ext/transport/chttp2/transport/frame.h"
+#include "src/core/ext/transport/chttp2/transport/internal.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/iomgr/endpoint.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/slice/slice_buffer.h"
+#include "test/core/test_util/mock_endpoint.h"
+
+namespace grpc_core {
+namespace {
+
+constexpr size_t kFramesPerRead = 256;
+
+// The wire bytes of kFramesPerRead frames, mostly WINDOW_UPDATEs, with one
+// RST_STREAM in every 64 frames.  None of the streams exist, so the frames
+// exercise the deframer rather than call processing.
+std::string MakeFrames() {
+  std::vector<Http2Frame> frames;
+  for (size_t i = 0; i < kFramesPerRead; ++i) {
+    const uint32_t stream_id = 2 * static_cast<uint32_t>(i % 100) + 1;
+    if (i % 64 == 63) {
+      frames.push_back(Http2RstStreamFrame{stream_id, 0});
+    } else if (i % 4 == 0) {
+      frames.push_back(Http2WindowUpdateFrame{0, 1});
+    } else {
+      frames.push_back(Http2WindowUpdateFrame{stream_id, 1});
+    }
+  }
+  SliceBuffer wire;
+  Serialize(absl::MakeSpan(frames), wire);
+  return std::string(wire.JoinIntoString());
+}
+
+void BM_PerformRead(benchmark::State& state) {
+  const size_t slice_size = state.range(0);
+  ExecCtx exec_ctx;
+  auto engine = grpc_event_engine::experimental::GetDefaultEventEngine();
+  auto mock_endpoint_controller =
+      grpc_event_engine::experimental::MockEndpointController::Create(engine);
+  mock_endpoint_controller->NoMoreReads();
+  auto args = ChannelArgs()
+                  .SetObject(ResourceQuota::Default())
+                  .SetObject(std::move(engine))
+                  .Set(GRPC_ARG_HTTP2_BDP_PROBE, false);
+  auto* t =
+      reinterpret_cast<grpc_chttp2_transport*>(grpc_create_chttp2_transport(
+          args,
+          OrphanablePtr<grpc_endpoint>(
+              mock_endpoint_controller->TakeCEndpoint()),
+          /*is_client=*/true));
+  const std::string frames = MakeFrames();
+  std::vector<Slice> slices;
+  for (size_t offset = 0; offset < frames.size(); offset += slice_size) {
+    slices.push_back(Slice::FromCopiedString(frames.substr(
+        offset, std::min(slice_size, frames.size() - offset))));
+  }
+  for (auto _ : state) {
+    size_t requests_started = 0;
+    for (const Slice& slice : slices) {
+      grpc_slice remaining = slice.c_slice();
+      while (true) {
+        auto r = grpc_chttp2_perform_read(t, remaining, requests_started);
+        if (auto* status = std::get_if<absl::Status>(&r)) {
+          CHECK_OK(*status);
+          break;
+        }
+        // An RST_STREAM ends the read; the transport would requeue the rest.
+        remaining = grpc_slice_sub_no_ref(remaining, std::get<size_t>(r),
+                                          GRPC_SLICE_LENGTH(remaining));
+        requests_started = 0;
+      }
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kFramesPerRead);
+  state.SetBytesProcessed(state.iterations() * frames.size());
+  t->Orphan();
+}
+BENCHMARK(BM_PerformRead)->Arg(1024)->Arg(8192)->Arg(65536);
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  ::benchmark::Initialize(&argc, argv);
+  grpc_init();
+  benchmark::RunTheBenchmarksNamespaced();
+  grpc_shutdown();
+  return 0;
+}
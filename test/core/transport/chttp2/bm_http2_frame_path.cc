@@ -0,0 +1,195 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Measures the per-frame work of the promise based HTTP2 transport, following
+// the steps Http2ClientTransport takes for each call:
+// - encoding initial metadata into a HEADERS frame with HPACK,
+// - framing messages into DATA frames and serializing a batch of frames, as
+//   one pass of the write loop does,
+// - splitting received bytes into frames and parsing them, as the read loop
+//   does.
+// The equivalent costs of the legacy transport are measured by
+// test/cpp/microbenchmarks/bm_chttp2_hpack and bm_chttp2_transport.
+
+#include <benchmark/benchmark.h>
+#include <grpc/grpc.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "absl/log/check.h"
+#include "absl/types/span.h"
+#include "src/core/call/metadata_batch.h"
+#include "src/core/ext/transport/chttp2/transport/frame.h"
+#include "src/core/ext/transport/chttp2/transport/hpack_encoder.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/slice/slice_buffer.h"
+
+namespace grpc_core {
+namespace {
+
+void PrepareClientInitialMetadata(grpc_metadata_batch& md) {
+  md.Set(HttpSchemeMetadata(), HttpSchemeMetadata::kHttp);
+  md.Set(HttpMethodMetadata(), HttpMethodMetadata::kPost);
+  md.Set(HttpPathMetadata(), Slice(StaticSlice::FromStaticString("/foo/bar")));
+  md.Set(HttpAuthorityMetadata(),
+         Slice(StaticSlice::FromStaticString("foo.test.google.fr:1234")));
+  md.Set(TeMetadata(), TeMetadata::kTrailers);
+  md.Set(ContentTypeMetadata(), ContentTypeMetadata::kApplicationGrpc);
+  md.Set(UserAgentMetadata(), Slice(StaticSlice::FromStaticString(
+                                  "grpc-c/3.0.0-dev (linux; chttp2; green)")));
+}
+
+// The DATA frame carrying one message of payload_size bytes, built the way
+// Http2ClientTransport::CallOutboundLoop() does.
+Http2Frame MakeMessageFrame(uint32_t stream_id, size_t payload_size) {
+  SliceBuffer message;
+  message.Append(Slice::FromCopiedString(std::string(payload_size, 'a')));
+  SliceBuffer frame_payload;
+  AppendGrpcHeaderToSliceBuffer(frame_payload, 0, payload_size);
+  frame_payload.TakeAndAppend(message);
+  return Http2DataFrame{stream_id, /*end_stream=*/false,
+                        std::move(frame_payload)};
+}
+
+// Encodes client initial metadata with one compressor for the whole run, so
+// that after the first call the HPACK table is warm, as it is on a long lived
+// connection.
+void BM_EncodeClientInitialMetadata(benchmark::State& state) {
+  HPackCompressor encoder;
+  grpc_metadata_batch md;
+  PrepareClientInitialMetadata(md);
+  uint32_t stream_id = 1;
+  size_t bytes = 0;
+  for (auto _ : state) {
+    SliceBuffer buf;
+    encoder.EncodeRawHeaders(md, buf);
+    Http2Frame frame = Http2HeaderFrame{stream_id, /*end_headers=*/true,
+                                        /*end_stream=*/false, std::move(buf)};
+    SliceBuffer out;
+    Serialize(absl::Span<Http2Frame>(&frame, 1), out);
+    bytes += out.Length();
+    stream_id += 2;
+  }
+  state.SetBytesProcessed(bytes);
+}
+BENCHMARK(BM_EncodeClientInitialMetadata);
+
+// range(0): message payload size.
+// range(1): number of frames serialized per write.
+void BM_SerializeDataFrames(benchmark::State& state) {
+  const size_t payload_size = state.range(0);
+  const int frames_per_write = state.range(1);
+  size_t bytes = 0;
+  for (auto _ : state) {
+    std::vector<Http2Frame> frames;
+    frames.reserve(frames_per_write);
+    for (int i = 0; i < frames_per_write; i++) {
+      frames.push_back(MakeMessageFrame(2 * i + 1, payload_size));
+    }
+    SliceBuffer out;
+    Serialize(absl::MakeSpan(frames), out);
+    bytes += out.Length();
+  }
+  state.SetItemsProcessed(state.iterations() * frames_per_write);
+  state.SetBytesProcessed(bytes);
+}
+BENCHMARK(BM_SerializeDataFrames)
+    ->ArgsProduct({{0, 64, 1024, 16 * 1024}, {1, 16, 64}});
+
+// Splits the bytes of a serialized batch into frames and parses each of them,
+// as Http2ClientTransport::ReadAndProcessOneFrame() does, then strips the
+// gRPC message header from every DATA frame.
+// range(0): message payload size.
+// range(1): number of frames in the batch.
+void BM_ParseDataFrames(benchmark::State& state) {
+  const size_t payload_size = state.range(0);
+  const int num_frames = state.range(1);
+  SliceBuffer wire;
+  {
+    std::vector<Http2Frame> frames;
+    for (int i = 0; i < num_frames; i++) {
+      frames.push_back(MakeMessageFrame(2 * i + 1, payload_size));
+    }
+    Serialize(absl::MakeSpan(frames), wire);
+  }
+  for (auto _ : state) {
+    SliceBuffer input = wire.Copy();
+    while (input.Length() > 0) {
+      uint8_t header_bytes[kFrameHeaderSize];
+      input.MoveFirstNBytesIntoBuffer(kFrameHeaderSize, header_bytes);
+      Http2FrameHeader header = Http2FrameHeader::Parse(header_bytes);
+      SliceBuffer payload;
+      input.MoveFirstNBytesIntoSliceBuffer(header.length, payload);
+      auto frame = ParseFramePayload(header, std::move(payload));
+      CHECK(frame.IsOk());
+      auto& data = std::get<Http2DataFrame>(frame.value());
+      GrpcMessageHeader message_header = ExtractGrpcHeader(data.payload);
+      benchmark::DoNotOptimize(message_header);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * num_frames);
+  state.SetBytesProcessed(state.iterations() * wire.Length());
+}
+BENCHMARK(BM_ParseDataFrames)
+    ->ArgsProduct({{0, 64, 1024, 16 * 1024}, {1, 16, 64}});
+
+// The control frames exchanged alongside data on a busy connection: a
+// WINDOW_UPDATE for the connection and for a stream, a PING and its ACK, and a
+// SETTINGS ACK.
+void BM_SerializeAndParseControlFrames(benchmark::State& state) {
+  for (auto _ : state) {
+    std::vector<Http2Frame> frames;
+    frames.push_back(Http2WindowUpdateFrame{0, 65535});
+    frames.push_back(Http2WindowUpdateFrame{1, 65535});
+    frames.push_back(Http2PingFrame{/*ack=*/false, /*opaque=*/1});
+    frames.push_back(Http2PingFrame{/*ack=*/true, /*opaque=*/1});
+    frames.push_back(Http2SettingsFrame{/*ack=*/true, {}});
+    const size_t num_frames = frames.size();
+    SliceBuffer wire;
+    Serialize(absl::MakeSpan(frames), wire);
+    for (size_t i = 0; i < num_frames; i++) {
+      uint8_t header_bytes[kFrameHeaderSize];
+      wire.MoveFirstNBytesIntoBuffer(kFrameHeaderSize, header_bytes);
+      Http2FrameHeader header = Http2FrameHeader::Parse(header_bytes);
+      SliceBuffer payload;
+      wire.MoveFirstNBytesIntoSliceBuffer(header.length, payload);
+      auto frame = ParseFramePayload(header, std::move(payload));
+      CHECK(frame.IsOk());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * 5);
+}
+BENCHMARK(BM_SerializeAndParseControlFrames);
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  ::benchmark::Initialize(&argc, argv);
+  grpc_init();
+  benchmark::RunTheBenchmarksNamespaced();
+  grpc_shutdown();
+  return 0;
+}
@@ -0,0 +1,123 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Measures handing frames from many streams of one connection to the write
+// loop of the promise based HTTP2 transport. Every stream sends its frames
+// to the outgoing frame queue from its own party, while a write loop party
+// takes them off in batches, as Http2ClientTransport::WriteFromQueue() does.
+
+#include <benchmark/benchmark.h>
+#include <grpc/grpc.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "src/core/ext/transport/chttp2/transport/frame.h"
+#include "src/core/ext/transport/chttp2/transport/http2_transport.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/promise/loop.h"
+#include "src/core/lib/promise/map.h"
+#include "src/core/lib/promise/mpsc.h"
+#include "src/core/lib/promise/party.h"
+#include "src/core/lib/resource_quota/arena.h"
+#include "src/core/util/notification.h"
+
+namespace grpc_core {
+namespace http2 {
+namespace {
+
+constexpr size_t kFramesPerStream = 100;
+
+RefCountedPtr<Party> MakeParty() {
+  auto arena = SimpleArenaAllocator()->MakeArena();
+  arena->SetContext(
+      grpc_event_engine::experimental::GetDefaultEventEngine().get());
+  return Party::Make(std::move(arena));
+}
+
+// range(0): number of concurrent streams.
+// range(1): 1 to make a new sender for every frame, 0 to share one sender.
+// range(2): number of frames that may be queued before senders block.
+void BM_OutgoingFrameQueue(benchmark::State& state) {
+  const int num_streams = state.range(0);
+  const bool sender_per_frame = state.range(1) != 0;
+  const int max_queued_frames = state.range(2);
+  std::vector<RefCountedPtr<Party>> stream_parties;
+  for (int i = 0; i < num_streams; i++) {
+    stream_parties.push_back(MakeParty());
+  }
+  auto write_party = MakeParty();
+  for (auto _ : state) {
+    MpscReceiver<Http2Frame> outgoing_frames(max_queued_frames);
+    MpscSender<Http2Frame> sender = outgoing_frames.MakeSender();
+    Notification done;
+    write_party->Spawn(
+        "write-loop",
+        Loop([&outgoing_frames,
+              remaining = num_streams * kFramesPerStream]() mutable {
+          return Map(outgoing_frames.NextBatch(kMaxWriteBatchSize),
+                     [&remaining](ValueOrFailure<std::vector<Http2Frame>>
+                                      frames) -> LoopCtl<StatusFlag> {
+                       if (!frames.ok()) return Failure{};
+                       remaining -= frames->size();
+                       if (remaining == 0) return Success{};
+                       return Continue{};
+                     });
+        }),
+        [&done](StatusFlag) { done.Notify(); });
+    for (int i = 0; i < num_streams; i++) {
+      const uint32_t stream_id = 2 * i + 1;
+      stream_parties[i]->Spawn(
+          "send-loop",
+          NTimes(kFramesPerStream,
+                 [&outgoing_frames, &sender, sender_per_frame,
+                  stream_id](size_t) {
+                   Http2Frame frame =
+                       Http2DataFrame{stream_id, false, SliceBuffer()};
+                   return sender_per_frame
+                              ? outgoing_frames.MakeSender().Send(
+                                    std::move(frame), 1)
+                              : sender.Send(std::move(frame), 1);
+                 }),
+          [](StatusFlag) {});
+    }
+    done.WaitForNotification();
+  }
+  state.SetItemsProcessed(state.iterations() * num_streams * kFramesPerStream);
+}
+BENCHMARK(BM_OutgoingFrameQueue)
+    ->ArgsProduct({{1, 64}, {0, 1}, {10, kMpscSize}})
+    ->UseRealTime();
+
+}  // namespace
+}  // namespace http2
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  ::benchmark::Initialize(&argc, argv);
+  grpc_init();
+  {
+    auto ee = grpc_event_engine::experimental::GetDefaultEventEngine();
+    benchmark::RunTheBenchmarksNamespaced();
+  }
+  grpc_shutdown();
+  return 0;
+}
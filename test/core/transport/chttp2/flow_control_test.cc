@@ -18,6 +18,8 @@
 
 #include <memory>
 #include <tuple>
+#include <utility>
+#include <vector>
 
 #include "absl/log/check.h"
 #include "gtest/gtest.h"
@@ -263,6 +265,71 @@ TEST_F(FlowControlTest, GradualReadsUpdate) {
   EXPECT_EQ(immediate_updates + queued_updates, 65535);
 }
 
+TEST_F(FlowControlTest, InitialWindowSplitBetweenStreams) {
+  ExecCtx exec_ctx;
+  auto* mocker = std::exchange(
+      g_test_only_transport_target_window_estimates_mocker, nullptr);
+  // A 64MB quota recommends at most 4MB for any single allocation.
+  auto resource_quota = MakeRefCounted<ResourceQuota>("test");
+  resource_quota->memory_quota()->SetSize(64 * 1024 * 1024);
+  MemoryOwner memory_owner =
+      resource_quota->memory_quota()->CreateMemoryOwner();
+  TransportFlowControl tfc("test", true, &memory_owner);
+  std::vector<std::unique_ptr<StreamFlowControl>> streams;
+  streams.push_back(std::make_unique<StreamFlowControl>(&tfc));
+  std::ignore = tfc.PeriodicUpdate();
+  EXPECT_EQ(tfc.queued_init_window(), 4 * 1024 * 1024);
+  for (int i = 0; i < 15; ++i) {
+    streams.push_back(std::make_unique<StreamFlowControl>(&tfc));
+  }
+  std::ignore = tfc.PeriodicUpdate();
+  EXPECT_EQ(tfc.queued_init_window(), 256 * 1024);
+  // Frames are sized for the connection, not for each stream's share.
+  EXPECT_EQ(tfc.target_frame_size(), 4 * 1024 * 1024);
+  // Never below the HTTP/2 default window.
+  for (int i = 0; i < 1000; ++i) {
+    streams.push_back(std::make_unique<StreamFlowControl>(&tfc));
+  }
+  std::ignore = tfc.PeriodicUpdate();
+  EXPECT_EQ(tfc.queued_init_window(), 65536);
+  streams.resize(1);
+  std::ignore = tfc.PeriodicUpdate();
+  EXPECT_EQ(tfc.queued_init_window(), 4 * 1024 * 1024);
+  g_test_only_transport_target_window_estimates_mocker = mocker;
+}
+
+TEST_F(FlowControlTest, InitialWindowSplitHasHysteresis) {
+  ExecCtx exec_ctx;
+  auto* mocker = std::exchange(
+      g_test_only_transport_target_window_estimates_mocker, nullptr);
+  auto resource_quota = MakeRefCounted<ResourceQuota>("test");
+  resource_quota->memory_quota()->SetSize(64 * 1024 * 1024);
+  MemoryOwner memory_owner =
+      resource_quota->memory_quota()->CreateMemoryOwner();
+  TransportFlowControl tfc("test", true, &memory_owner);
+  std::vector<std::unique_ptr<StreamFlowControl>> streams;
+  for (int i = 0; i < 16; ++i) {
+    streams.push_back(std::make_unique<StreamFlowControl>(&tfc));
+  }
+  std::ignore = tfc.PeriodicUpdate();
+  EXPECT_EQ(tfc.queued_init_window(), 256 * 1024);
+  // 15 streams would round up to 512KB each, but the window only grows back
+  // once the stream count has halved.
+  streams.resize(15);
+  std::ignore = tfc.PeriodicUpdate();
+  EXPECT_EQ(tfc.queued_init_window(), 256 * 1024);
+  streams.resize(8);
+  std::ignore = tfc.PeriodicUpdate();
+  EXPECT_EQ(tfc.queued_init_window(), 512 * 1024);
+  // More streams shrink the window straight away.
+  while (streams.size() < 16) {
+    streams.push_back(std::make_unique<StreamFlowControl>(&tfc));
+  }
+  std::ignore = tfc.PeriodicUpdate();
+  EXPECT_EQ(tfc.queued_init_window(), 256 * 1024);
+  g_test_only_transport_target_window_estimates_mocker = mocker;
+}
+
 }  // namespace chttp2
 }  // namespace grpc_core
 
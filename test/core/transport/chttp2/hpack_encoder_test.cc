@@ -27,6 +27,7 @@
 #include <string>
 
 #include "absl/log/log.h"
+#include "absl/strings/string_view.h"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 #include "src/core/ext/transport/chttp2/transport/legacy_frame.h"
@@ -34,6 +35,7 @@
 #include "src/core/lib/resource_quota/arena.h"
 #include "src/core/lib/resource_quota/memory_quota.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/lib/slice/slice_buffer.h"
 #include "src/core/util/ref_counted_ptr.h"
 #include "test/core/test_util/parse_hexstring.h"
 #include "test/core/test_util/slice_splitter.h"
@@ -413,6 +415,138 @@ TEST(HpackEncoderTest, EncodeBinaryAsTrueBinary) {
   EXPECT_EQ(compressor.test_only_table_size(), 114);
 }
 
+static void PrepareUnaryRequest(grpc_metadata_batch* b,
+                                absl::string_view path) {
+  b->Set(grpc_core::HttpPathMetadata(),
+         grpc_core::Slice::FromCopiedString(path));
+  b->Set(grpc_core::HttpAuthorityMetadata(),
+         grpc_core::Slice::FromStaticString("foo.test"));
+  b->Set(grpc_core::HttpMethodMetadata(),
+         grpc_core::HttpMethodMetadata::kPost);
+  b->Set(grpc_core::HttpSchemeMetadata(),
+         grpc_core::HttpSchemeMetadata::kHttp);
+  b->Set(grpc_core::ContentTypeMetadata(),
+         grpc_core::ContentTypeMetadata::kApplicationGrpc);
+  b->Set(grpc_core::TeMetadata(), grpc_core::TeMetadata::kTrailers);
+  b->Set(grpc_core::UserAgentMetadata(),
+         grpc_core::Slice::FromStaticString("test-agent"));
+}
+
+static grpc_core::Slice EncodeUnaryRequest(
+    grpc_core::HPackCompressor& compressor, absl::string_view path,
+    absl::string_view custom_value = "") {
+  grpc_metadata_batch b;
+  PrepareUnaryRequest(&b, path);
+  if (!custom_value.empty()) {
+    b.Append("x-custom", grpc_core::Slice::FromCopiedString(custom_value),
+             CrashOnAppendError);
+  }
+  grpc_core::SliceBuffer output;
+  EXPECT_TRUE(compressor.EncodeRawHeaders(b, output));
+  return output.JoinIntoSlice();
+}
+
+// With the hpack_encoder_prefix_cache experiment, the request headers of the
+// calls below after the first are replayed from the cache.
+TEST(HpackEncoderTest, RepeatedRequestHeadersAreIndexed) {
+  grpc_core::ExecCtx exec_ctx;
+  grpc_core::HPackCompressor compressor;
+  const grpc_core::Slice all_indexed =
+      grpc_core::ParseHexstring("c2c18386c0bfbe");
+  EncodeUnaryRequest(compressor, "/foo/bar");
+  EXPECT_EQ(EncodeUnaryRequest(compressor, "/foo/bar"), all_indexed);
+  EXPECT_EQ(EncodeUnaryRequest(compressor, "/foo/bar"), all_indexed);
+  EXPECT_EQ(EncodeUnaryRequest(compressor, "/foo/bar", "v"),
+            grpc_core::ParseHexstring("c2c18386c0bfbe 00 08 782d637573746f6d "
+                                      "01 76"));
+}
+
+TEST(HpackEncoderTest, RequestHeadersFollowTableChanges) {
+  grpc_core::ExecCtx exec_ctx;
+  grpc_core::HPackCompressor compressor;
+  EncodeUnaryRequest(compressor, "/foo/bar");
+  EXPECT_EQ(EncodeUnaryRequest(compressor, "/foo/bar"),
+            grpc_core::ParseHexstring("c2c18386c0bfbe"));
+  // Adds :path /foo/baz to the table, moving all previous entries by one.
+  EncodeUnaryRequest(compressor, "/foo/baz");
+  EXPECT_EQ(EncodeUnaryRequest(compressor, "/foo/bar"),
+            grpc_core::ParseHexstring("c3c28386c1c0bf"));
+  EXPECT_EQ(EncodeUnaryRequest(compressor, "/foo/baz"),
+            grpc_core::ParseHexstring("bec28386c1c0bf"));
+}
+
+TEST(HpackEncoderTest, AdmissionControlIndexesValuesOnSecondUse) {
+  grpc_core::ExecCtx exec_ctx;
+  grpc_core::HPackCompressor compressor;
+  compressor.set_admission_control(true);
+  EncodeUnaryRequest(compressor, "/foo/bar");
+  EncodeUnaryRequest(compressor, "/foo/bar");
+  const uint32_t table_size = compressor.test_only_table_size();
+  // A path sent once stays out of the table...
+  EXPECT_THAT(EncodeUnaryRequest(compressor, "/foo/baz").as_string_view(),
+              ::testing::HasSubstr("/foo/baz"));
+  EXPECT_EQ(compressor.test_only_table_size(), table_size);
+  // ...until it is sent again.
+  EncodeUnaryRequest(compressor, "/foo/baz");
+  EXPECT_GT(compressor.test_only_table_size(), table_size);
+  EXPECT_EQ(EncodeUnaryRequest(compressor, "/foo/baz"),
+            EncodeUnaryRequest(compressor, "/foo/baz"));
+}
+
+static grpc_core::Slice EncodeTrailers(grpc_core::HPackCompressor& compressor,
+                                       grpc_status_code status,
+                                       absl::string_view message) {
+  grpc_metadata_batch b;
+  b.Set(grpc_core::GrpcStatusMetadata(), status);
+  b.Set(grpc_core::GrpcMessageMetadata(),
+        grpc_core::GrpcMessageMetadata::FromString(message));
+  grpc_core::SliceBuffer output;
+  EXPECT_TRUE(compressor.EncodeRawHeaders(b, output));
+  return output.JoinIntoSlice();
+}
+
+TEST(HpackEncoderTest, InternedStatusMessagesAreIndexed) {
+  grpc_core::ExecCtx exec_ctx;
+  grpc_core::HPackCompressor compressor;
+  EncodeTrailers(compressor, GRPC_STATUS_DEADLINE_EXCEEDED,
+                 "Deadline Exceeded");
+  const uint32_t table_size = compressor.test_only_table_size();
+  // Both the status and the message are sent as indices from then on...
+  EXPECT_EQ(EncodeTrailers(compressor, GRPC_STATUS_DEADLINE_EXCEEDED,
+                           "Deadline Exceeded")
+                .length(),
+            2u);
+  // ...while other messages are sent as literals, and kept out of the table.
+  EXPECT_THAT(EncodeTrailers(compressor, GRPC_STATUS_DEADLINE_EXCEEDED,
+                             "deadline of 1s exceeded")
+                  .as_string_view(),
+              ::testing::HasSubstr("deadline of 1s exceeded"));
+  EncodeTrailers(compressor, GRPC_STATUS_DEADLINE_EXCEEDED,
+                 "deadline of 1s exceeded");
+  EXPECT_EQ(compressor.test_only_table_size(), table_size);
+}
+
+TEST(HpackEncoderTest, AuthorizationValuesAreNeverIndexed) {
+  grpc_core::ExecCtx exec_ctx;
+  grpc_core::HPackCompressor compressor;
+  auto encode = [&compressor]() {
+    grpc_metadata_batch b;
+    b.Append("authorization", grpc_core::Slice::FromStaticString("Bearer foo"),
+             CrashOnAppendError);
+    grpc_core::SliceBuffer output;
+    EXPECT_TRUE(compressor.EncodeRawHeaders(b, output));
+    return output.JoinIntoSlice();
+  };
+  // A never-indexed literal naming static entry 23, sent whole every time
+  // and kept out of the table.
+  const grpc_core::Slice expected =
+      grpc_core::ParseHexstring("1f080a42656172657220666f6f");
+  const uint32_t table_size = compressor.test_only_table_size();
+  EXPECT_EQ(encode(), expected);
+  EXPECT_EQ(encode(), expected);
+  EXPECT_EQ(compressor.test_only_table_size(), table_size);
+}
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(&argc, argv);
   ::testing::InitGoogleTest(&argc, argv);
@@ -22,6 +22,7 @@
 
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "absl/strings/str_cat.h"
 #include "gtest/gtest.h"
@@ -188,6 +189,69 @@ TEST(HpackParserTableTest, ManyUnusedAdditions) {
   EXPECT_GT(num_buckets_changed, 0);
 }
 
+TEST(HpackSharedValuesTest, EqualValuesShareMemory) {
+  HPackSharedValues shared_values;
+  const std::string value(100, 'v');
+  auto stats_before = global_stats().Collect();
+  Slice first = shared_values.Intern(Slice::FromCopiedString(value));
+  Slice second = shared_values.Intern(Slice::FromCopiedString(value));
+  auto stats_after = global_stats().Collect();
+  EXPECT_EQ(first.as_string_view(), value);
+  EXPECT_EQ(first.data(), second.data());
+  EXPECT_EQ(shared_values.TestOnlyNumValues(), 1u);
+  const auto& sizes_before = stats_before->http2_hpack_shared_value_size;
+  const auto& sizes_after = stats_after->http2_hpack_shared_value_size;
+  const int bucket = sizes_before.BucketFor(value.size());
+  EXPECT_EQ(sizes_after.buckets()[bucket] - sizes_before.buckets()[bucket], 1u);
+}
+
+TEST(HpackSharedValuesTest, ReturnedValueDoesNotReferenceInput) {
+  HPackSharedValues shared_values;
+  Slice input = Slice::FromCopiedString(std::string(100, 'v'));
+  Slice interned = shared_values.Intern(input.Ref());
+  EXPECT_NE(interned.data(), input.data());
+  EXPECT_EQ(interned.as_string_view(), input.as_string_view());
+}
+
+TEST(HpackSharedValuesTest, ShortAndLongValuesAreNotPooled) {
+  HPackSharedValues shared_values;
+  shared_values.Intern(Slice::FromCopiedString("short"));
+  shared_values.Intern(Slice::FromCopiedString(
+      std::string(HPackSharedValues::kMaxValueLength + 1, 'v')));
+  EXPECT_EQ(shared_values.TestOnlyNumValues(), 0u);
+}
+
+TEST(HpackSharedValuesTest, UnreferencedValuesAreDropped) {
+  HPackSharedValues shared_values;
+  const std::string kept_value(100, 'k');
+  Slice kept = shared_values.Intern(Slice::FromCopiedString(kept_value));
+  const int kNumValues = 100000;
+  for (int i = 0; i < kNumValues; i++) {
+    shared_values.Intern(
+        Slice::FromCopiedString(absl::StrCat(std::string(50, 'v'), i)));
+  }
+  EXPECT_LT(shared_values.TestOnlyNumValues(), kNumValues);
+  EXPECT_EQ(shared_values.Intern(Slice::FromCopiedString(kept_value)).data(),
+            kept.data());
+}
+
+TEST(HpackSharedValuesTest, FullPoolCopiesValuesPrivately) {
+  HPackSharedValues shared_values;
+  const std::string kept_value(100, 'k');
+  Slice kept = shared_values.Intern(Slice::FromCopiedString(kept_value));
+  // Hold on to every value, so that sweeps cannot make room.
+  std::vector<Slice> values;
+  const int kNumValues = 100000;
+  for (int i = 0; i < kNumValues; i++) {
+    const std::string value = absl::StrCat(std::string(50, 'v'), i);
+    values.push_back(shared_values.Intern(Slice::FromCopiedString(value)));
+    EXPECT_EQ(values.back().as_string_view(), value);
+  }
+  EXPECT_LT(shared_values.TestOnlyNumValues(), kNumValues);
+  EXPECT_EQ(shared_values.Intern(Slice::FromCopiedString(kept_value)).data(),
+            kept.data());
+}
+
 }  // namespace grpc_core
 
 int main(int argc, char** argv) {
@@ -511,6 +511,18 @@ INSTANTIATE_TEST_SUITE_P(
                  {"c0", absl::InternalError("Illegal header key: MiXeD-CaSe"),
                   kEndOfHeaders},
              }},
+        Test{"HuffmanCodedKeys",
+             {},
+             {},
+             {
+                 // Keys are checked as they are Huffman decoded.
+                 {"4089f2b50598742dd4bebf84ee3a2d2f", "x-legal-key: value\n",
+                  kEndOfHeaders},
+                 {"4088d06fc2df5af0f7178c44e7b68914a8e952b1d882ff",
+                  absl::InternalError("Illegal header key: MiXeD-CaSe"),
+                  kEndOfHeaders},
+                 {"4084b958d33f8163", ":path: /\n", kEndOfHeaders},
+             }},
         Test{"TeIsTrailers",
              {},
              {},
@@ -0,0 +1,431 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpc/grpc.h>
+#include <grpc/impl/channel_arg_names.h>
+#include <grpc/slice.h>
+#include <grpc/slice_buffer.h>
+#include <limits.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/functional/any_invocable.h"
+#include "absl/log/check.h"
+#include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "gtest/gtest.h"
+#include "src/core/ext/transport/chttp2/transport/chttp2_transport.h"
+#include "src/core/ext/transport/chttp2/transport/internal.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/iomgr/closure.h"
+#include "src/core/lib/iomgr/combiner.h"
+#include "src/core/lib/iomgr/endpoint.h"
+#include "src/core/lib/iomgr/endpoint_pair.h"
+#include "src/core/lib/iomgr/error.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/slice/slice_internal.h"
+#include "src/core/lib/surface/completion_queue.h"
+#include "src/core/server/server.h"
+#include "src/core/util/crash.h"
+#include "src/core/util/notification.h"
+#include "src/core/util/orphanable.h"
+#include "src/core/util/sync.h"
+#include "test/core/end2end/cq_verifier.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+void* Tag(intptr_t t) { return reinterpret_cast<void*>(t); }
+
+constexpr absl::string_view kSettingsAck(
+    "\x00\x00\x00\x04\x01\x00\x00\x00\x00", 9);
+// SETTINGS frames that only change SETTINGS_HEADER_TABLE_SIZE.
+constexpr absl::string_view kHeaderTableSize0(
+    "\x00\x00\x06\x04\x00\x00\x00\x00\x00"
+    "\x00\x01\x00\x00\x00\x00",
+    15);
+constexpr absl::string_view kHeaderTableSize4096(
+    "\x00\x00\x06\x04\x00\x00\x00\x00\x00"
+    "\x00\x01\x00\x00\x10\x00",
+    15);
+// The request headers, as literals that are never indexed.
+constexpr absl::string_view kRequestHeaders(
+    "\x10\x05:path\x08/foo/bar"
+    "\x10\x07:scheme\x04http"
+    "\x10\x07:method\x04POST"
+    "\x10\x0a:authority\x09localhost"
+    "\x10\x0c"
+    "content-type\x10"
+    "application/grpc"
+    "\x10\x02te\x08trailers");
+// A header the server's HPACK parser adds to its dynamic table.
+constexpr absl::string_view kIndexedHeader("\x40\x05x-foo\x03"
+                                           "bar");
+// A dynamic table size update to 0.
+constexpr absl::string_view kTableSizeUpdate0("\x20");
+
+// Returns a HEADERS frame with END_HEADERS set for stream_id.
+std::string HeadersFrame(uint32_t stream_id, absl::string_view block) {
+  std::string frame;
+  frame.push_back(static_cast<char>(block.size() >> 16));
+  frame.push_back(static_cast<char>(block.size() >> 8));
+  frame.push_back(static_cast<char>(block.size()));
+  frame.push_back('\x01');
+  frame.push_back('\x04');
+  frame.push_back(static_cast<char>(stream_id >> 24));
+  frame.push_back(static_cast<char>(stream_id >> 16));
+  frame.push_back(static_cast<char>(stream_id >> 8));
+  frame.push_back(static_cast<char>(stream_id));
+  absl::StrAppend(&frame, block);
+  return frame;
+}
+
+// Returns a RST_STREAM frame cancelling stream_id.
+std::string CancelFrame(uint32_t stream_id) {
+  std::string frame("\x00\x00\x04\x03\x00", 5);
+  frame.push_back(static_cast<char>(stream_id >> 24));
+  frame.push_back(static_cast<char>(stream_id >> 16));
+  frame.push_back(static_cast<char>(stream_id >> 8));
+  frame.push_back(static_cast<char>(stream_id));
+  frame.append("\x00\x00\x00\x08", 4);
+  return frame;
+}
+
+class IdleTransportReclamationTest : public ::testing::Test {
+ protected:
+  IdleTransportReclamationTest() { SetupAndStart(); }
+
+  ~IdleTransportReclamationTest() override {
+    {
+      ExecCtx exec_ctx;
+      {
+        MutexLock lock(&sweep_mu_);
+        benign_sweep_.reset();
+      }
+      observer_.reset();
+      resource_quota_->memory_quota()->SetSize(1024 * 1024 * 1024);
+    }
+    ShutdownAndDestroy();
+  }
+
+  // Sets up the server, with a transport on one end of an endpoint pair
+  // that stands in for the client.
+  void SetupAndStart() {
+    ExecCtx exec_ctx;
+    cq_ = grpc_completion_queue_create_for_next(nullptr);
+    cqv_ = std::make_unique<CqVerifier>(cq_);
+    resource_quota_ = MakeResourceQuota("idle_transport_reclamation_test");
+    auto server_args = ChannelArgs()
+                           .Set(GRPC_ARG_HTTP2_BDP_PROBE, 0)
+                           .Set(GRPC_ARG_KEEPALIVE_TIME_MS, INT_MAX)
+                           .SetObject(resource_quota_)
+                           .ToC();
+    server_ = grpc_server_create(server_args.get(), nullptr);
+    auto* core_server = Server::FromC(server_);
+    grpc_server_register_completion_queue(server_, cq_, nullptr);
+    grpc_server_start(server_);
+    fds_ = grpc_iomgr_create_endpoint_pair("fixture", nullptr);
+    auto* transport = grpc_create_chttp2_transport(
+        core_server->channel_args(), OrphanablePtr<grpc_endpoint>(fds_.server),
+        false);
+    transport_ = static_cast<grpc_chttp2_transport*>(transport);
+    grpc_endpoint_add_to_pollset(fds_.server, grpc_cq_pollset(cq_));
+    CHECK(core_server->SetupTransport(transport, nullptr,
+                                      core_server->channel_args()) ==
+          absl::OkStatus());
+    grpc_chttp2_transport_start_reading(transport, nullptr, nullptr, nullptr,
+                                        nullptr);
+    // Start polling on the client
+    Notification client_poller_thread_started_notification;
+    client_poll_thread_ = std::make_unique<std::thread>(
+        [this, &client_poller_thread_started_notification]() {
+          grpc_completion_queue* client_cq =
+              grpc_completion_queue_create_for_next(nullptr);
+          {
+            ExecCtx exec_ctx;
+            grpc_endpoint_add_to_pollset(fds_.client,
+                                         grpc_cq_pollset(client_cq));
+            grpc_endpoint_add_to_pollset(fds_.server,
+                                         grpc_cq_pollset(client_cq));
+          }
+          client_poller_thread_started_notification.Notify();
+          while (!shutdown_) {
+            CHECK(grpc_completion_queue_next(
+                      client_cq, grpc_timeout_milliseconds_to_deadline(10),
+                      nullptr)
+                      .type == GRPC_QUEUE_TIMEOUT);
+          }
+          grpc_completion_queue_destroy(client_cq);
+        });
+    client_poller_thread_started_notification.WaitForNotification();
+    // Write connection prefix and settings frame
+    constexpr char kPrefix[] =
+        "PRI * HTTP/2.0\r\n\r\nSM\r\n\r\n\x00\x00\x00\x04\x00\x00\x00\x00\x00";
+    Write(absl::string_view(kPrefix, sizeof(kPrefix) - 1));
+    // Start reading on the client
+    grpc_slice_buffer_init(&read_buffer_);
+    GRPC_CLOSURE_INIT(&on_read_done_, OnReadDone, this, nullptr);
+    GRPC_CLOSURE_INIT(&on_read_done_scheduler_, OnReadDoneScheduler, this,
+                      nullptr);
+    grpc_endpoint_read(fds_.client, &read_buffer_, &on_read_done_, false,
+                       /*min_progress_size=*/1);
+  }
+
+  // Shuts down and destroys the client and server.
+  void ShutdownAndDestroy() {
+    shutdown_ = true;
+    ExecCtx exec_ctx;
+    {
+      MutexLock lock(&ep_destroy_mu_);
+      grpc_endpoint_destroy(fds_.client);
+      fds_.client = nullptr;
+    }
+    ExecCtx::Get()->Flush();
+    client_poll_thread_->join();
+    CHECK(read_end_notification_.WaitForNotificationWithTimeout(
+        absl::Seconds(5)));
+    // Shutdown and destroy server
+    grpc_server_shutdown_and_notify(server_, cq_, Tag(1000));
+    cqv_->Expect(Tag(1000), true);
+    cqv_->Verify();
+    grpc_server_destroy(server_);
+    cqv_.reset();
+    grpc_completion_queue_destroy(cq_);
+  }
+
+  static void OnReadDone(void* arg, grpc_error_handle error) {
+    auto* self = static_cast<IdleTransportReclamationTest*>(arg);
+    if (error.ok()) {
+      {
+        MutexLock lock(&self->mu_);
+        for (size_t i = 0; i < self->read_buffer_.count; ++i) {
+          absl::StrAppend(&self->read_bytes_,
+                          StringViewFromSlice(self->read_buffer_.slices[i]));
+        }
+        self->read_cv_.SignalAll();
+      }
+      MutexLock lock(&self->ep_destroy_mu_);
+      if (self->fds_.client != nullptr) {
+        grpc_slice_buffer_reset_and_unref(&self->read_buffer_);
+        grpc_endpoint_read(self->fds_.client, &self->read_buffer_,
+                           &self->on_read_done_scheduler_, false,
+                           /*min_progress_size=*/1);
+        return;
+      }
+    }
+    grpc_slice_buffer_destroy(&self->read_buffer_);
+    self->read_end_notification_.Notify();
+  }
+
+  // Do async hop for OnReadDone() in case grpc_endpoint_read() invokes
+  // us synchronously while we're holding the lock.
+  static void OnReadDoneScheduler(void* arg, grpc_error_handle error) {
+    auto* self = static_cast<IdleTransportReclamationTest*>(arg);
+    ExecCtx::Run(DEBUG_LOCATION, &self->on_read_done_, std::move(error));
+  }
+
+  // Waits for \a bytes to show up in read_bytes_
+  void WaitForReadBytes(absl::string_view bytes) {
+    auto start_time = absl::Now();
+    MutexLock lock(&mu_);
+    while (true) {
+      auto where = read_bytes_.find(std::string(bytes));
+      if (where != std::string::npos) {
+        read_bytes_ = read_bytes_.substr(where + bytes.size());
+        break;
+      }
+      ASSERT_LT(absl::Now() - start_time, absl::Seconds(60));
+      read_cv_.WaitWithTimeout(&mu_, absl::Seconds(5));
+    }
+  }
+
+  // This is a blocking call. It waits for the write callback to be invoked
+  // before returning.
+  void Write(absl::string_view bytes) {
+    ExecCtx exec_ctx;
+    grpc_slice slice =
+        grpc_slice_from_copied_buffer(bytes.data(), bytes.size());
+    grpc_slice_buffer buffer;
+    grpc_slice_buffer_init(&buffer);
+    grpc_slice_buffer_add(&buffer, slice);
+    Notification on_write_done_notification;
+    GRPC_CLOSURE_INIT(&on_write_done_, OnWriteDone,
+                      &on_write_done_notification, nullptr);
+    grpc_endpoint_write(
+        fds_.client, &buffer, &on_write_done_,
+        grpc_event_engine::experimental::EventEngine::Endpoint::WriteArgs());
+    ExecCtx::Get()->Flush();
+    CHECK(on_write_done_notification.WaitForNotificationWithTimeout(
+        absl::Seconds(5)));
+    grpc_slice_buffer_destroy(&buffer);
+  }
+
+  static void OnWriteDone(void* arg, grpc_error_handle error) {
+    if (!error.ok()) {
+      Crash(absl::StrCat("Write failed: ", error.ToString()));
+    }
+    static_cast<Notification*>(arg)->Notify();
+  }
+
+  // Runs \a f in the transport's combiner, and waits for it to finish.
+  void RunInCombiner(absl::AnyInvocable<void(grpc_chttp2_transport*)> f) {
+    Notification done;
+    {
+      ExecCtx exec_ctx;
+      transport_->combiner->Run(
+          NewClosure([this, &f, &done](grpc_error_handle) {
+            f(transport_);
+            done.Notify();
+          }),
+          absl::OkStatus());
+    }
+    done.WaitForNotification();
+  }
+
+  // Waits until \a predicate, evaluated in the transport's combiner, holds.
+  void WaitInCombiner(
+      absl::AnyInvocable<bool(grpc_chttp2_transport*)> predicate) {
+    auto start_time = absl::Now();
+    while (true) {
+      bool done = false;
+      RunInCombiner([&](grpc_chttp2_transport* t) { done = predicate(t); });
+      if (done) return;
+      ASSERT_LT(absl::Now() - start_time, absl::Seconds(60));
+      absl::SleepFor(absl::Milliseconds(10));
+    }
+  }
+
+  // Queues a benign reclaimer behind the transport's, which holds on to its
+  // sweep so that no later pass runs until the test is done looking.
+  void PostBenignObserver() {
+    ExecCtx exec_ctx;
+    observer_.emplace(resource_quota_->memory_quota()->CreateMemoryOwner());
+    observer_->PostReclaimer(
+        ReclamationPass::kBenign,
+        [this](std::optional<ReclamationSweep> sweep) {
+          if (!sweep.has_value()) return;
+          MutexLock lock(&sweep_mu_);
+          benign_sweep_ = std::move(*sweep);
+          benign_pass_done_.Notify();
+        });
+  }
+
+  // Held when destroying fds_.client so we know not to start another read.
+  Mutex ep_destroy_mu_;
+
+  grpc_endpoint_pair fds_;
+  grpc_server* server_ = nullptr;
+  grpc_chttp2_transport* transport_ = nullptr;
+  grpc_completion_queue* cq_ = nullptr;
+  std::unique_ptr<CqVerifier> cqv_;
+  std::unique_ptr<std::thread> client_poll_thread_;
+  std::atomic<bool> shutdown_{false};
+  grpc_closure on_read_done_;
+  grpc_closure on_read_done_scheduler_;
+  Mutex mu_;
+  CondVar read_cv_;
+  Notification read_end_notification_;
+  grpc_slice_buffer read_buffer_;
+  std::string read_bytes_ ABSL_GUARDED_BY(mu_);
+  grpc_closure on_write_done_;
+  RefCountedPtr<ResourceQuota> resource_quota_;
+  std::optional<MemoryOwner> observer_;
+  Mutex sweep_mu_;
+  std::optional<ReclamationSweep> benign_sweep_ ABSL_GUARDED_BY(sweep_mu_);
+  Notification benign_pass_done_;
+};
+
+TEST_F(IdleTransportReclamationTest, BenignSweepCompactsIdleTransport) {
+  // The server's SETTINGS frame comes before its ack of ours.
+  WaitForReadBytes(kSettingsAck);
+  Write(kSettingsAck);
+  // A call that leaves an entry in the server's HPACK table, and is then
+  // cancelled, so that the transport has no streams.
+  Write(HeadersFrame(1, absl::StrCat(kRequestHeaders, kIndexedHeader)));
+  Write(CancelFrame(1));
+  WaitInCombiner([](grpc_chttp2_transport* t) {
+    return t->stream_map.empty() &&
+           t->hpack_parser.hpack_table()->num_entries() == 1u;
+  });
+  // Put the quota under pressure.
+  PostBenignObserver();
+  {
+    ExecCtx exec_ctx;
+    resource_quota_->memory_quota()->SetSize(0);
+  }
+  // The benign pass asks the client to empty the table, and does nothing
+  // else that the client can see.
+  WaitForReadBytes(kHeaderTableSize0);
+  ASSERT_TRUE(benign_pass_done_.WaitForNotificationWithTimeout(
+      absl::Seconds(60)));
+  RunInCombiner([](grpc_chttp2_transport* t) {
+    EXPECT_EQ(t->sent_goaway_state, GRPC_CHTTP2_NO_GOAWAY_SEND);
+  });
+  // The table is emptied once the client acks.
+  Write(kSettingsAck);
+  WaitInCombiner([](grpc_chttp2_transport* t) {
+    return t->settings.acked().header_table_size() == 0u;
+  });
+  RunInCombiner([](grpc_chttp2_transport* t) {
+    EXPECT_EQ(t->hpack_parser.hpack_table()->num_entries(), 0u);
+    EXPECT_EQ(t->hpack_parser.hpack_table()->test_only_table_size(), 0u);
+  });
+  // The next stream gets the table back.
+  Write(HeadersFrame(3, absl::StrCat(kTableSizeUpdate0, kRequestHeaders)));
+  WaitForReadBytes(kHeaderTableSize4096);
+  RunInCombiner([](grpc_chttp2_transport* t) {
+    EXPECT_EQ(t->settings.local().header_table_size(), 4096u);
+    EXPECT_EQ(t->sent_goaway_state, GRPC_CHTTP2_NO_GOAWAY_SEND);
+  });
+  Write(kSettingsAck);
+  Write(CancelFrame(3));
+  WaitInCombiner(
+      [](grpc_chttp2_transport* t) { return t->stream_map.empty(); });
+  // Only the idle pass, which runs once the benign one is done and the quota
+  // is still under pressure, sends a GOAWAY.
+  {
+    ExecCtx exec_ctx;
+    MutexLock lock(&sweep_mu_);
+    benign_sweep_.reset();
+  }
+  WaitInCombiner([](grpc_chttp2_transport* t) {
+    return t->sent_goaway_state != GRPC_CHTTP2_NO_GOAWAY_SEND;
+  });
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  grpc_init();
+  int result = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return result;
+}
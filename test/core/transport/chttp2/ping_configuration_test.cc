@@ -62,6 +62,7 @@ TEST_F(ConfigurationTest, ClientKeepaliveDefaults) {
               mock_endpoint_controller_->TakeCEndpoint()),
           /*is_client=*/true));
   EXPECT_EQ(t->keepalive_time, Duration::Infinity());
+  EXPECT_EQ(t->keepalive_max_idle_time, Duration::Infinity());
   EXPECT_EQ(t->keepalive_timeout, Duration::Infinity());
   EXPECT_EQ(t->keepalive_permit_without_calls, false);
   EXPECT_EQ(t->ping_rate_policy.TestOnlyMaxPingsWithoutData(), 2);
@@ -132,6 +133,36 @@ TEST_F(ConfigurationTest, ServerKeepaliveExplicitArgs) {
   t->Orphan();
 }
 
+TEST_F(ConfigurationTest, ClientKeepaliveMaxIdleTime) {
+  ExecCtx exec_ctx;
+  args_ = args_.Set(GRPC_ARG_KEEPALIVE_TIME_MS, 20000);
+  args_ = args_.Set(GRPC_ARG_EXPERIMENTAL_KEEPALIVE_MAX_IDLE_TIME_MS, 160000);
+  grpc_chttp2_transport* t =
+      reinterpret_cast<grpc_chttp2_transport*>(grpc_create_chttp2_transport(
+          args_,
+          OrphanablePtr<grpc_endpoint>(
+              mock_endpoint_controller_->TakeCEndpoint()),
+          /*is_client=*/true));
+  EXPECT_EQ(t->keepalive_time, Duration::Seconds(20));
+  EXPECT_EQ(t->keepalive_max_idle_time, Duration::Seconds(160));
+  EXPECT_EQ(t->current_keepalive_time, Duration::Seconds(20));
+  t->Orphan();
+}
+
+TEST_F(ConfigurationTest, ClientKeepaliveMaxIdleTimeBelowKeepaliveTime) {
+  ExecCtx exec_ctx;
+  args_ = args_.Set(GRPC_ARG_KEEPALIVE_TIME_MS, 20000);
+  args_ = args_.Set(GRPC_ARG_EXPERIMENTAL_KEEPALIVE_MAX_IDLE_TIME_MS, 1000);
+  grpc_chttp2_transport* t =
+      reinterpret_cast<grpc_chttp2_transport*>(grpc_create_chttp2_transport(
+          args_,
+          OrphanablePtr<grpc_endpoint>(
+              mock_endpoint_controller_->TakeCEndpoint()),
+          /*is_client=*/true));
+  EXPECT_EQ(t->keepalive_max_idle_time, Duration::Seconds(20));
+  t->Orphan();
+}
+
 // This test modifies the defaults of the client side settings, so it would
 // affect any test that is run after this.
 // TODO(yashykt): If adding more client side tests after this, add a reset to
@@ -192,6 +223,36 @@ TEST_F(ConfigurationTest, ModifyServerDefaults) {
   t->Orphan();
 }
 
+TEST_F(ConfigurationTest, ServerAdaptiveMaxConcurrentStreams) {
+  ExecCtx exec_ctx;
+  args_ = args_.Set(GRPC_ARG_MAX_CONCURRENT_STREAMS, 1000);
+  args_ = args_.Set(GRPC_ARG_HTTP2_ADAPTIVE_MAX_CONCURRENT_STREAMS, true);
+  grpc_chttp2_transport* t =
+      reinterpret_cast<grpc_chttp2_transport*>(grpc_create_chttp2_transport(
+          args_,
+          OrphanablePtr<grpc_endpoint>(
+              mock_endpoint_controller_->TakeCEndpoint()),
+          /*is_client=*/false));
+  EXPECT_TRUE(t->adaptive_max_concurrent_streams);
+  EXPECT_EQ(t->configured_max_concurrent_streams, 1000);
+  t->Orphan();
+}
+
+TEST(AdaptiveMaxConcurrentStreamsTest, ScalesWithPressure) {
+  // Low pressure: the configured limit.
+  EXPECT_EQ(grpc_chttp2_adaptive_max_concurrent_streams(1000, 100, 0.0), 1000);
+  EXPECT_EQ(grpc_chttp2_adaptive_max_concurrent_streams(1000, 100, 0.49),
+            1000);
+  // Rising pressure: room for half as many again, then none, then shedding.
+  EXPECT_EQ(grpc_chttp2_adaptive_max_concurrent_streams(1000, 100, 0.5), 150);
+  EXPECT_EQ(grpc_chttp2_adaptive_max_concurrent_streams(1000, 100, 0.75),
+            100);
+  EXPECT_EQ(grpc_chttp2_adaptive_max_concurrent_streams(1000, 100, 1.0), 50);
+  // Never above the configured limit, nor below the floor.
+  EXPECT_EQ(grpc_chttp2_adaptive_max_concurrent_streams(120, 100, 0.5), 120);
+  EXPECT_EQ(grpc_chttp2_adaptive_max_concurrent_streams(1000, 0, 1.0), 16);
+}
+
 }  // namespace
 }  // namespace grpc_core
 
@@ -0,0 +1,238 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/grpc.h>
+#include <grpc/impl/channel_arg_names.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "absl/functional/any_invocable.h"
+#include "absl/status/status.h"
+#include "absl/strings/string_view.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "gtest/gtest.h"
+#include "src/core/ext/transport/chttp2/transport/chttp2_transport.h"
+#include "src/core/ext/transport/chttp2/transport/internal.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/event_engine/extensions/tcp_info.h"
+#include "src/core/lib/event_engine/query_extensions.h"
+#include "src/core/lib/event_engine/tcp_socket_utils.h"
+#include "src/core/lib/iomgr/endpoint.h"
+#include "src/core/lib/iomgr/event_engine_shims/endpoint.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/util/orphanable.h"
+#include "test/core/test_util/fake_stats_plugin.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+using grpc_event_engine::experimental::EventEngine;
+using grpc_event_engine::experimental::ExtendedType;
+using grpc_event_engine::experimental::SliceBuffer;
+using grpc_event_engine::experimental::TcpConnectionInfo;
+using grpc_event_engine::experimental::TcpInfoExtension;
+
+// An endpoint that never reads, drops what is written to it, and reports
+// TCP_INFO that the test sets.
+class TcpInfoEndpoint final
+    : public ExtendedType<EventEngine::Endpoint, TcpInfoExtension> {
+ public:
+  TcpInfoEndpoint(std::shared_ptr<EventEngine> engine,
+                  std::shared_ptr<std::atomic<uint32_t>> total_retransmits)
+      : engine_(std::move(engine)),
+        total_retransmits_(std::move(total_retransmits)),
+        peer_addr_(grpc_event_engine::experimental::URIToResolvedAddress(
+                       "ipv4:127.0.0.1:12345")
+                       .value()),
+        local_addr_(grpc_event_engine::experimental::URIToResolvedAddress(
+                        "ipv4:127.0.0.1:6789")
+                        .value()) {}
+
+  ~TcpInfoEndpoint() override {
+    if (on_read_ != nullptr) {
+      engine_->Run([cb = std::move(on_read_)]() mutable {
+        cb(absl::UnavailableError("Endpoint shutdown"));
+      });
+    }
+  }
+
+  bool Read(absl::AnyInvocable<void(absl::Status)> on_read,
+            SliceBuffer* /*buffer*/, ReadArgs /*args*/) override {
+    on_read_ = std::move(on_read);
+    return false;
+  }
+
+  bool Write(absl::AnyInvocable<void(absl::Status)> on_writable,
+             SliceBuffer* data, WriteArgs /*args*/) override {
+    data->Clear();
+    engine_->Run(
+        [cb = std::move(on_writable)]() mutable { cb(absl::OkStatus()); });
+    return false;
+  }
+
+  const EventEngine::ResolvedAddress& GetPeerAddress() const override {
+    return peer_addr_;
+  }
+  const EventEngine::ResolvedAddress& GetLocalAddress() const override {
+    return local_addr_;
+  }
+
+  std::vector<size_t> AllWriteMetrics() override { return {}; }
+  std::optional<absl::string_view> GetMetricName(size_t) override {
+    return std::nullopt;
+  }
+  std::optional<size_t> GetMetricKey(absl::string_view) override {
+    return std::nullopt;
+  }
+
+  std::optional<TcpConnectionInfo> GetTcpConnectionInfo() override {
+    TcpConnectionInfo info;
+    info.rtt = std::chrono::microseconds(2000);
+    info.min_rtt = std::chrono::microseconds(1000);
+    info.delivery_rate = 1000000;
+    info.congestion_window = 10;
+    info.mss = 1448;
+    info.total_retransmits = total_retransmits_->load();
+    info.notsent_bytes = 5;
+    return info;
+  }
+
+ private:
+  const std::shared_ptr<EventEngine> engine_;
+  const std::shared_ptr<std::atomic<uint32_t>> total_retransmits_;
+  const EventEngine::ResolvedAddress peer_addr_;
+  const EventEngine::ResolvedAddress local_addr_;
+  absl::AnyInvocable<void(absl::Status)> on_read_;
+};
+
+class TcpInfoSamplingTest : public ::testing::Test {
+ protected:
+  TcpInfoSamplingTest() {
+    GlobalStatsPluginRegistryTestPeer::ResetGlobalStatsPluginRegistry();
+    stats_plugin_ = FakeStatsPluginBuilder()
+                        .UseDisabledByDefaultMetrics(true)
+                        .BuildAndRegister();
+    args_ = args_.SetObject(ResourceQuota::Default());
+    args_ = args_.SetObject(engine_);
+  }
+
+  // Creates a server transport on a TcpInfoEndpoint.
+  grpc_chttp2_transport* CreateTransport(const ChannelArgs& args) {
+    ExecCtx exec_ctx;
+    return static_cast<grpc_chttp2_transport*>(grpc_create_chttp2_transport(
+        args,
+        OrphanablePtr<grpc_endpoint>(grpc_event_engine_endpoint_create(
+            std::make_unique<TcpInfoEndpoint>(engine_, total_retransmits_))),
+        /*is_client=*/false));
+  }
+
+  static void Orphan(grpc_chttp2_transport* t) {
+    ExecCtx exec_ctx;
+    t->Orphan();
+  }
+
+  // Waits until the retransmits counter reaches \a value.
+  void WaitForRetransmits(uint64_t value) {
+    auto handle = GlobalInstrumentsRegistryTestPeer::
+        FindUInt64CounterHandleByName("grpc.tcp.retransmits");
+    ASSERT_TRUE(handle.has_value());
+    auto start_time = absl::Now();
+    while (stats_plugin_->GetUInt64CounterValue(*handle, {}, {}) != value) {
+      ASSERT_LT(absl::Now() - start_time, absl::Seconds(60));
+      absl::SleepFor(absl::Milliseconds(10));
+    }
+  }
+
+  std::shared_ptr<EventEngine> engine_ =
+      grpc_event_engine::experimental::GetDefaultEventEngine();
+  std::shared_ptr<std::atomic<uint32_t>> total_retransmits_ =
+      std::make_shared<std::atomic<uint32_t>>(0);
+  std::shared_ptr<FakeStatsPlugin> stats_plugin_;
+  ChannelArgs args_;
+};
+
+TEST_F(TcpInfoSamplingTest, DisabledByDefault) {
+  grpc_chttp2_transport* t = CreateTransport(args_);
+  EXPECT_EQ(t->tcp_info_sample_interval, Duration::Zero());
+  EXPECT_EQ(t->stats_plugin_group, nullptr);
+  EXPECT_EQ(t->tcp_info_sample_timer_handle,
+            EventEngine::TaskHandle::kInvalid);
+  Orphan(t);
+}
+
+TEST_F(TcpInfoSamplingTest, RecordsSamples) {
+  total_retransmits_->store(3);
+  grpc_chttp2_transport* t = CreateTransport(
+      args_.Set(GRPC_ARG_TCP_INFO_SAMPLE_INTERVAL_MS, 10));
+  EXPECT_EQ(t->tcp_info_sample_interval, Duration::Milliseconds(10));
+  ASSERT_NE(t->tcp_info_extension, nullptr);
+  // The first sample reports every retransmit so far.
+  WaitForRetransmits(3);
+  auto rtt = GlobalInstrumentsRegistryTestPeer::
+      FindDoubleHistogramHandleByName("grpc.tcp.rtt");
+  ASSERT_TRUE(rtt.has_value());
+  auto rtt_values = stats_plugin_->GetDoubleHistogramValue(*rtt, {}, {});
+  ASSERT_TRUE(rtt_values.has_value());
+  ASSERT_FALSE(rtt_values->empty());
+  EXPECT_DOUBLE_EQ(rtt_values->front(), 0.002);
+  auto min_rtt = GlobalInstrumentsRegistryTestPeer::
+      FindDoubleHistogramHandleByName("grpc.tcp.min_rtt");
+  ASSERT_TRUE(min_rtt.has_value());
+  auto min_rtt_values =
+      stats_plugin_->GetDoubleHistogramValue(*min_rtt, {}, {});
+  ASSERT_TRUE(min_rtt_values.has_value());
+  ASSERT_FALSE(min_rtt_values->empty());
+  EXPECT_DOUBLE_EQ(min_rtt_values->front(), 0.001);
+  for (const auto& [name, expected] :
+       std::vector<std::pair<absl::string_view, uint64_t>>{
+           {"grpc.tcp.delivery_rate", 1000000},
+           {"grpc.tcp.congestion_window", 10},
+           {"grpc.tcp.notsent_bytes", 5}}) {
+    auto handle =
+        GlobalInstrumentsRegistryTestPeer::FindUInt64HistogramHandleByName(
+            name);
+    ASSERT_TRUE(handle.has_value()) << name;
+    auto values = stats_plugin_->GetUInt64HistogramValue(*handle, {}, {});
+    ASSERT_TRUE(values.has_value()) << name;
+    ASSERT_FALSE(values->empty()) << name;
+    EXPECT_EQ(values->front(), expected) << name;
+  }
+  // Later samples only add the increase.
+  total_retransmits_->store(7);
+  WaitForRetransmits(7);
+  Orphan(t);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  grpc_init();
+  int result = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return result;
+}
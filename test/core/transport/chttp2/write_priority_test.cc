@@ -0,0 +1,439 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpc/byte_buffer.h>
+#include <grpc/credentials.h>
+#include <grpc/grpc.h>
+#include <grpc/impl/channel_arg_names.h>
+#include <grpc/impl/grpc_types.h>
+#include <grpc/impl/propagation_bits.h>
+#include <grpc/slice.h>
+#include <grpc/slice_buffer.h>
+#include <grpc/status.h>
+#include <grpc/support/alloc.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/functional/function_ref.h"
+#include "absl/log/check.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "absl/time/time.h"
+#include "gtest/gtest.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/experiments/config.h"
+#include "src/core/lib/experiments/experiments.h"
+#include "src/core/lib/iomgr/closure.h"
+#include "src/core/lib/iomgr/endpoint.h"
+#include "src/core/lib/iomgr/error.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/iomgr/tcp_server.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/slice/slice_internal.h"
+#include "src/core/util/host_port.h"
+#include "src/core/util/notification.h"
+#include "src/core/util/sync.h"
+#include "src/core/util/time.h"
+#include "test/core/end2end/cq_verifier.h"
+#include "test/core/test_util/port.h"
+#include "test/core/test_util/test_config.h"
+#include "test/core/test_util/test_tcp_server.h"
+
+// Tests the order in which chttp2 frames the data of streams that become
+// writable together (chttp2_weighted_write_scheduling). The test plays the
+// server on a raw connection and reads the frames the client sends.
+
+namespace grpc_core {
+namespace {
+
+constexpr uint8_t kDataFrame = 0;
+constexpr uint8_t kHeadersFrame = 1;
+constexpr size_t kMaxFrameSize = 16384;
+// The connection's initial flow control window.
+constexpr size_t kConnectionWindow = 65535;
+constexpr char kSettingsAck[] = "\x00\x00\x00\x04\x01\x00\x00\x00\x00";
+
+void* Tag(intptr_t t) { return reinterpret_cast<void*>(t); }
+
+struct Frame {
+  uint8_t type;
+  uint32_t stream_id;
+  size_t length;
+};
+
+class WritePriorityTest : public ::testing::Test {
+ protected:
+  WritePriorityTest() {
+    grpc_slice_buffer_init(&read_buffer_);
+    GRPC_CLOSURE_INIT(&on_read_done_, OnReadDone, this, nullptr);
+    GRPC_CLOSURE_INIT(&on_read_done_scheduler_, OnReadDoneScheduler, this,
+                      nullptr);
+    port_ = grpc_pick_unused_port_or_die();
+    test_tcp_server_init(&server_, OnConnect, this);
+    test_tcp_server_start(&server_, port_);
+    server_poll_thread_ = std::make_unique<std::thread>([this]() {
+      while (!shutdown_) {
+        test_tcp_server_poll(&server_, 10);
+      }
+    });
+    cq_ = grpc_completion_queue_create_for_next(nullptr);
+    cqv_ = std::make_unique<CqVerifier>(cq_);
+    grpc_arg client_args[] = {
+        grpc_channel_arg_integer_create(
+            const_cast<char*>(GRPC_ARG_HTTP2_BDP_PROBE), 0),
+        grpc_channel_arg_integer_create(
+            const_cast<char*>(GRPC_ARG_ENABLE_RETRIES), 0)};
+    grpc_channel_args client_channel_args = {GPR_ARRAY_SIZE(client_args),
+                                             client_args};
+    grpc_channel_credentials* creds = grpc_insecure_credentials_create();
+    channel_ = grpc_channel_create(JoinHostPort("127.0.0.1", port_).c_str(),
+                                   creds, &client_channel_args);
+    grpc_channel_credentials_release(creds);
+    grpc_connectivity_state state = grpc_channel_check_connectivity_state(
+        channel_, /*try_to_connect=*/true);
+    while (state != GRPC_CHANNEL_READY) {
+      grpc_channel_watch_connectivity_state(
+          channel_, state, grpc_timeout_seconds_to_deadline(1), cq_, Tag(1));
+      cqv_->Expect(Tag(1), true);
+      cqv_->Verify(Duration::Seconds(5));
+      state = grpc_channel_check_connectivity_state(channel_, false);
+    }
+    ExecCtx::Get()->Flush();
+    CHECK(
+        connect_notification_.WaitForNotificationWithTimeout(absl::Seconds(5)));
+    // Wait for the client to apply the server's settings.
+    WaitForFrames([](const std::vector<Frame>&, absl::string_view bytes) {
+      return bytes.find(absl::string_view(kSettingsAck,
+                                          sizeof(kSettingsAck) - 1)) !=
+             absl::string_view::npos;
+    });
+  }
+
+  ~WritePriorityTest() override {
+    cqv_.reset();
+    grpc_completion_queue_shutdown(cq_);
+    grpc_event ev;
+    do {
+      ev = grpc_completion_queue_next(cq_, grpc_timeout_seconds_to_deadline(1),
+                                      nullptr);
+    } while (ev.type != GRPC_QUEUE_SHUTDOWN);
+    grpc_completion_queue_destroy(cq_);
+    grpc_channel_destroy(channel_);
+    {
+      MutexLock lock(&tcp_destroy_mu_);
+      if (tcp_ != nullptr) grpc_endpoint_destroy(tcp_);
+      tcp_ = nullptr;
+    }
+    ExecCtx::Get()->Flush();
+    CHECK(read_end_notification_.WaitForNotificationWithTimeout(
+        absl::Seconds(5)));
+    shutdown_ = true;
+    server_poll_thread_->join();
+    test_tcp_server_destroy(&server_);
+    ExecCtx::Get()->Flush();
+  }
+
+  static void OnConnect(void* arg, grpc_endpoint* tcp,
+                        grpc_pollset* /*accepting_pollset*/,
+                        grpc_tcp_server_acceptor* acceptor) {
+    gpr_free(acceptor);
+    WritePriorityTest* self = static_cast<WritePriorityTest*>(arg);
+    {
+      MutexLock lock(&self->tcp_destroy_mu_);
+      self->tcp_ = tcp;
+    }
+    grpc_endpoint_add_to_pollset(tcp, self->server_.pollset[0]);
+    grpc_endpoint_read(tcp, &self->read_buffer_, &self->on_read_done_, false,
+                       /*min_progress_size=*/1);
+    std::thread([self]() {
+      ExecCtx exec_ctx;
+      // SETTINGS with a 1MB initial stream window, so that only the
+      // connection window limits the client, followed by a SETTINGS ack.
+      constexpr char kSettings[] =
+          "\x00\x00\x06\x04\x00\x00\x00\x00\x00"
+          "\x00\x04\x00\x10\x00\x00"
+          "\x00\x00\x00\x04\x01\x00\x00\x00\x00";
+      self->Write(absl::string_view(kSettings, sizeof(kSettings) - 1));
+      self->connect_notification_.Notify();
+    }).detach();
+  }
+
+  // Blocks until the write completes.
+  void Write(absl::string_view bytes) {
+    grpc_slice_buffer buffer;
+    grpc_slice_buffer_init(&buffer);
+    grpc_slice_buffer_add(&buffer, grpc_slice_from_copied_buffer(
+                                       bytes.data(), bytes.size()));
+    Notification done;
+    grpc_closure on_write_done;
+    GRPC_CLOSURE_INIT(
+        &on_write_done,
+        [](void* arg, grpc_error_handle error) {
+          CHECK_OK(error);
+          static_cast<Notification*>(arg)->Notify();
+        },
+        &done, nullptr);
+    {
+      MutexLock lock(&tcp_destroy_mu_);
+      CHECK_NE(tcp_, nullptr);
+      grpc_endpoint_write(
+          tcp_, &buffer, &on_write_done,
+          grpc_event_engine::experimental::EventEngine::Endpoint::WriteArgs());
+    }
+    ExecCtx::Get()->Flush();
+    CHECK(done.WaitForNotificationWithTimeout(absl::Seconds(5)));
+    grpc_slice_buffer_destroy(&buffer);
+  }
+
+  // Grants the client \a increment more bytes of connection window.
+  void SendConnectionWindowUpdate(uint32_t increment) {
+    std::string frame("\x00\x00\x04\x08\x00\x00\x00\x00\x00", 9);
+    for (int shift = 24; shift >= 0; shift -= 8) {
+      frame.push_back(static_cast<char>(increment >> shift));
+    }
+    Write(frame);
+  }
+
+  static void OnReadDone(void* arg, grpc_error_handle error) {
+    WritePriorityTest* self = static_cast<WritePriorityTest*>(arg);
+    if (error.ok()) {
+      {
+        MutexLock lock(&self->mu_);
+        for (size_t i = 0; i < self->read_buffer_.count; ++i) {
+          absl::StrAppend(&self->read_bytes_,
+                          StringViewFromSlice(self->read_buffer_.slices[i]));
+        }
+        self->read_cv_.SignalAll();
+      }
+      MutexLock lock(&self->tcp_destroy_mu_);
+      if (self->tcp_ != nullptr) {
+        grpc_slice_buffer_reset_and_unref(&self->read_buffer_);
+        grpc_endpoint_read(self->tcp_, &self->read_buffer_,
+                           &self->on_read_done_scheduler_, false,
+                           /*min_progress_size=*/1);
+        return;
+      }
+    }
+    grpc_slice_buffer_destroy(&self->read_buffer_);
+    self->read_end_notification_.Notify();
+  }
+
+  // Async hop for OnReadDone(), in case grpc_endpoint_read() invokes
+  // the callback synchronously while holding the lock.
+  static void OnReadDoneScheduler(void* arg, grpc_error_handle error) {
+    WritePriorityTest* self = static_cast<WritePriorityTest*>(arg);
+    ExecCtx::Run(DEBUG_LOCATION, &self->on_read_done_, std::move(error));
+  }
+
+  // Splits what the client has sent so far into frames, leaving out the
+  // connection preface and any incomplete frame at the end.
+  static std::vector<Frame> ParseFrames(absl::string_view bytes) {
+    constexpr size_t kPrefaceSize = 24;
+    constexpr size_t kFrameHeaderSize = 9;
+    std::vector<Frame> frames;
+    if (bytes.size() < kPrefaceSize) return frames;
+    bytes.remove_prefix(kPrefaceSize);
+    while (bytes.size() >= kFrameHeaderSize) {
+      const auto byte = [&](size_t i) {
+        return static_cast<uint32_t>(static_cast<uint8_t>(bytes[i]));
+      };
+      Frame frame;
+      frame.length = (byte(0) << 16) | (byte(1) << 8) | byte(2);
+      frame.type = static_cast<uint8_t>(byte(3));
+      frame.stream_id = ((byte(5) & 0x7f) << 24) | (byte(6) << 16) |
+                        (byte(7) << 8) | byte(8);
+      if (bytes.size() < kFrameHeaderSize + frame.length) break;
+      bytes.remove_prefix(kFrameHeaderSize + frame.length);
+      frames.push_back(frame);
+    }
+    return frames;
+  }
+
+  // Waits until \a done returns true for the frames the client has sent,
+  // and returns those frames.
+  std::vector<Frame> WaitForFrames(
+      absl::FunctionRef<bool(const std::vector<Frame>&, absl::string_view)>
+          done) {
+    std::atomic<bool> cq_done{false};
+    std::thread cq_driver([&]() {
+      while (!cq_done) {
+        grpc_event ev = grpc_completion_queue_next(
+            cq_, grpc_timeout_milliseconds_to_deadline(10), nullptr);
+        if (ev.type == GRPC_OP_COMPLETE) {
+          MutexLock lock(&mu_);
+          completed_tags_.push_back(ev.tag);
+        } else {
+          CHECK(ev.type == GRPC_QUEUE_TIMEOUT);
+        }
+      }
+    });
+    std::vector<Frame> frames;
+    {
+      const absl::Time deadline = absl::Now() + absl::Seconds(30);
+      MutexLock lock(&mu_);
+      for (;;) {
+        frames = ParseFrames(read_bytes_);
+        if (done(frames, read_bytes_)) break;
+        CHECK_LT(absl::Now(), deadline);
+        read_cv_.WaitWithTimeout(&mu_, absl::Seconds(1));
+      }
+    }
+    cq_done = true;
+    cq_driver.join();
+    return frames;
+  }
+
+  static size_t DataBytes(const std::vector<Frame>& frames,
+                          uint32_t stream_id) {
+    size_t bytes = 0;
+    for (const Frame& frame : frames) {
+      if (frame.type == kDataFrame && frame.stream_id == stream_id) {
+        bytes += frame.length;
+      }
+    }
+    return bytes;
+  }
+
+  // Starts a call that sends \a message_size bytes with the given write
+  // priority. The call never gets a response and is cancelled by
+  // CancelCall().
+  grpc_call* StartCall(uint32_t priority, size_t message_size, int tag) {
+    grpc_call* call = grpc_channel_create_call(
+        channel_, nullptr, GRPC_PROPAGATE_DEFAULTS, cq_,
+        grpc_slice_from_static_string("/foo"), nullptr,
+        grpc_timeout_seconds_to_deadline(60), nullptr);
+    CHECK_NE(call, nullptr);
+    const std::string priority_value = absl::StrCat(priority);
+    grpc_metadata metadata;
+    metadata.key = grpc_slice_from_static_string(GRPC_WRITE_PRIORITY_MD_KEY);
+    metadata.value = grpc_slice_from_copied_buffer(priority_value.data(),
+                                                   priority_value.size());
+    grpc_slice payload = grpc_slice_malloc(message_size);
+    memset(GRPC_SLICE_START_PTR(payload), 'a', message_size);
+    grpc_byte_buffer* message = grpc_raw_byte_buffer_create(&payload, 1);
+    grpc_slice_unref(payload);
+    grpc_op ops[2];
+    memset(ops, 0, sizeof(ops));
+    ops[0].op = GRPC_OP_SEND_INITIAL_METADATA;
+    ops[0].data.send_initial_metadata.count = 1;
+    ops[0].data.send_initial_metadata.metadata = &metadata;
+    ops[1].op = GRPC_OP_SEND_MESSAGE;
+    ops[1].data.send_message.send_message = message;
+    CHECK_EQ(grpc_call_start_batch(call, ops, 2, Tag(tag), nullptr),
+             GRPC_CALL_OK);
+    grpc_byte_buffer_destroy(message);
+    grpc_slice_unref(metadata.value);
+    return call;
+  }
+
+  void CancelCall(grpc_call* call, int tag) {
+    grpc_call_cancel(call, nullptr);
+    bool completed;
+    {
+      MutexLock lock(&mu_);
+      completed = std::find(completed_tags_.begin(), completed_tags_.end(),
+                            Tag(tag)) != completed_tags_.end();
+    }
+    // The batch may already have completed while WaitForFrames() drove the
+    // completion queue.
+    if (!completed) {
+      cqv_->Expect(Tag(tag), CqVerifier::AnyStatus());
+      cqv_->Verify();
+    }
+    grpc_call_unref(call);
+  }
+
+  int port_;
+  test_tcp_server server_;
+  std::unique_ptr<std::thread> server_poll_thread_;
+  // Guards destroying tcp_, so that we know not to start the next read/write.
+  Mutex tcp_destroy_mu_;
+  grpc_endpoint* tcp_ ABSL_GUARDED_BY(tcp_destroy_mu_) = nullptr;
+  Notification connect_notification_;
+  grpc_slice_buffer read_buffer_;
+  grpc_closure on_read_done_;
+  grpc_closure on_read_done_scheduler_;
+  Notification read_end_notification_;
+  grpc_channel* channel_ = nullptr;
+  grpc_completion_queue* cq_ = nullptr;
+  std::unique_ptr<CqVerifier> cqv_;
+  Mutex mu_;
+  CondVar read_cv_;
+  std::string read_bytes_ ABSL_GUARDED_BY(mu_);
+  std::vector<void*> completed_tags_ ABSL_GUARDED_BY(mu_);
+  std::atomic<bool> shutdown_{false};
+};
+
+TEST_F(WritePriorityTest, StreamsTakeTurnsByPriority) {
+  ASSERT_TRUE(IsChttp2WeightedWriteSchedulingEnabled());
+  // The bulk call, with priority 1, uses up the connection window and then
+  // stalls with most of its message left.
+  grpc_call* bulk = StartCall(/*priority=*/1, 256 * 1024, 101);
+  WaitForFrames([](const std::vector<Frame>& frames, absl::string_view) {
+    return DataBytes(frames, 1) == kConnectionWindow;
+  });
+  // The small call stalls behind it. Its headers are not flow controlled,
+  // so seeing them means its message is queued too.
+  grpc_call* small = StartCall(/*priority=*/0, 100, 102);
+  const size_t frames_before_update =
+      WaitForFrames([](const std::vector<Frame>& frames, absl::string_view) {
+        for (const Frame& frame : frames) {
+          if (frame.type == kHeadersFrame && frame.stream_id == 3) return true;
+        }
+        return false;
+      }).size();
+  // Once the window opens, both streams become writable in the order they
+  // stalled. The bulk stream may frame (priority + 1) max size frames before
+  // it goes back behind the small stream.
+  SendConnectionWindowUpdate(1 << 20);
+  std::vector<Frame> frames =
+      WaitForFrames([](const std::vector<Frame>& frames, absl::string_view) {
+        return DataBytes(frames, 3) > 0;
+      });
+  std::vector<Frame> data;
+  for (size_t i = frames_before_update; i < frames.size(); ++i) {
+    if (frames[i].type == kDataFrame) data.push_back(frames[i]);
+  }
+  ASSERT_GE(data.size(), 3u);
+  EXPECT_EQ(data[0].stream_id, 1u);
+  EXPECT_EQ(data[0].length, kMaxFrameSize);
+  EXPECT_EQ(data[1].stream_id, 1u);
+  EXPECT_EQ(data[1].length, kMaxFrameSize);
+  // The message and its 5 byte gRPC header.
+  EXPECT_EQ(data[2].stream_id, 3u);
+  EXPECT_EQ(data[2].length, 105u);
+  CancelCall(small, 102);
+  CancelCall(bulk, 101);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  grpc_core::ForceEnableExperiment("chttp2_weighted_write_scheduling", true);
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc_init();
+  int result = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return result;
+}
@@ -14,6 +14,7 @@
 
 #include "src/core/ext/transport/chttp2/transport/write_size_policy.h"
 
+#include <chrono>
 #include <memory>
 
 #include "gtest/gtest.h"
@@ -116,6 +117,33 @@ TEST(WriteSizePolicyTest, MediumWritesJustHangOut) {
   EXPECT_EQ(policy.WriteTargetSize(), 131072);
 }
 
+TEST(WriteSizePolicyTest, NoCoalescingByDefault) {
+  Chttp2WriteSizePolicy policy;
+  EXPECT_EQ(policy.CoalescingDelay(0), std::chrono::microseconds::zero());
+  EXPECT_EQ(policy.CoalescingDelay(1000), std::chrono::microseconds::zero());
+}
+
+TEST(WriteSizePolicyTest, CoalescingOnlyWithManyStreams) {
+  Chttp2WriteSizePolicy policy;
+  policy.SetCoalescingWindow(std::chrono::microseconds(200), 16);
+  EXPECT_EQ(policy.CoalescingWindow(), std::chrono::microseconds(200));
+  EXPECT_EQ(policy.CoalescingDelay(0), std::chrono::microseconds::zero());
+  EXPECT_EQ(policy.CoalescingDelay(15), std::chrono::microseconds::zero());
+  EXPECT_EQ(policy.CoalescingDelay(16), std::chrono::microseconds(200));
+  EXPECT_EQ(policy.CoalescingDelay(100), std::chrono::microseconds(200));
+}
+
+TEST(WriteSizePolicyTest, CoalescingWindowIsBounded) {
+  Chttp2WriteSizePolicy policy;
+  policy.SetCoalescingWindow(std::chrono::seconds(1), 1);
+  EXPECT_EQ(policy.CoalescingWindow(),
+            Chttp2WriteSizePolicy::kMaxCoalescingWindow);
+  EXPECT_EQ(policy.CoalescingDelay(1),
+            Chttp2WriteSizePolicy::kMaxCoalescingWindow);
+  policy.SetCoalescingWindow(std::chrono::microseconds(-5), 1);
+  EXPECT_EQ(policy.CoalescingDelay(1), std::chrono::microseconds::zero());
+}
+
 }  // namespace
 }  // namespace grpc_core
 
@@ -97,6 +97,14 @@ TEST(TimeoutTest, DecodingSucceeds) {
   assert_decodes_as("1000000001S", Duration::Infinity());
   assert_decodes_as("2000000001S", Duration::Infinity());
   assert_decodes_as("9999999999S", Duration::Infinity());
+  // The longest values and leading zeros the fast path takes, and padded
+  // values that need the general path.
+  assert_decodes_as("99999999m", Duration::Milliseconds(99999999));
+  assert_decodes_as("00000001S", Duration::Seconds(1));
+  assert_decodes_as("999999999m", Duration::Milliseconds(999999999));
+  assert_decodes_as(" 1m", Duration::Milliseconds(1));
+  assert_decodes_as("1 m", Duration::Milliseconds(1));
+  assert_decodes_as("1m ", Duration::Milliseconds(1));
 }
 
 void assert_decoding_fails(const char* s) {
@@ -114,6 +122,9 @@ TEST(TimeoutTest, DecodingFails) {
   assert_decoding_fails("!");
   assert_decoding_fails("n1");
   assert_decoding_fails("-1u");
+  assert_decoding_fails("12");
+  assert_decoding_fails("1 ");
+  assert_decoding_fails("1m1");
 }
 
 }  // namespace
@@ -0,0 +1,68 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/tsi/alts/handshaker/alts_handshaker_channel_pool.h"
+
+#include <grpc/grpc.h>
+
+#include "gtest/gtest.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/surface/channel.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+constexpr char kHandshakerServiceUrl[] = "localhost:1234";
+
+TEST(AltsHandshakerChannelPoolTest, HandsOutChannelsRoundRobin) {
+  ExecCtx exec_ctx;
+  auto pool =
+      MakeRefCounted<AltsHandshakerChannelPool>(kHandshakerServiceUrl, 2);
+  grpc_channel* first = pool->GetChannel();
+  grpc_channel* second = pool->GetChannel();
+  grpc_channel* third = pool->GetChannel();
+  EXPECT_NE(first, nullptr);
+  EXPECT_NE(second, nullptr);
+  EXPECT_NE(first, second);
+  EXPECT_EQ(first, third);
+  grpc_channel_destroy_internal(first);
+  grpc_channel_destroy_internal(second);
+  grpc_channel_destroy_internal(third);
+}
+
+TEST(AltsHandshakerChannelPoolTest, ChannelsOutliveThePool) {
+  ExecCtx exec_ctx;
+  auto pool =
+      MakeRefCounted<AltsHandshakerChannelPool>(kHandshakerServiceUrl, 1);
+  grpc_channel* channel = pool->GetChannel();
+  pool.reset();
+  EXPECT_FALSE(Channel::FromC(channel)->IsLame());
+  grpc_channel_destroy_internal(channel);
+}
+
+TEST(AltsHandshakerChannelPoolTest, DefaultSizeIsPositive) {
+  EXPECT_GT(AltsHandshakerChannelPool::DefaultSize(), 0);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestGrpcScope grpc_scope;
+  return RUN_ALL_TESTS();
+}
@@ -20,6 +20,7 @@
 
 #include <grpc/support/alloc.h>
 
+#include <algorithm>
 #include <memory>
 
 #include "absl/types/span.h"
@@ -466,6 +467,54 @@ static void privacy_integrity_random_seal_unseal(
   }
 }
 
+static void privacy_integrity_batch_seal_unseal(
+    alts_iovec_record_protocol* sender, alts_iovec_record_protocol* receiver) {
+  for (size_t i = 0; i < kSealRepeatTimes; i++) {
+    alts_iovec_record_protocol_test_var* var =
+        alts_iovec_record_protocol_test_var_create();
+    size_t max_frame_data_size = gsec_test_bias_random_uint32(kMaxDataSize) + 1;
+    size_t protected_length =
+        alts_iovec_record_protocol_get_batch_protected_size(
+            sender, var->data_length, max_frame_data_size);
+    size_t frame_count =
+        (var->data_length + max_frame_data_size - 1) / max_frame_data_size;
+    ASSERT_EQ(protected_length,
+              var->data_length +
+                  frame_count * (var->header_length + var->tag_length));
+    uint8_t* protected_buf =
+        static_cast<uint8_t*>(gpr_malloc(protected_length));
+    iovec_t protected_frames = {protected_buf, protected_length};
+    // Seals all the frames at once.
+    grpc_status_code status =
+        alts_iovec_record_protocol_privacy_integrity_protect_batch(
+            sender, var->data_iovec, var->data_iovec_length,
+            max_frame_data_size, protected_frames, nullptr);
+    ASSERT_EQ(status, GRPC_STATUS_OK);
+    // Unseals the frames one by one.
+    uint8_t* frame = protected_buf;
+    size_t remaining = var->data_length;
+    uint8_t* unprotected = var->data_buf;
+    while (remaining > 0) {
+      size_t frame_data_length = std::min(remaining, max_frame_data_size);
+      iovec_t header_iovec = {frame, var->header_length};
+      iovec_t protected_iovec = {frame + var->header_length,
+                                 frame_data_length + var->tag_length};
+      iovec_t unprotected_iovec = {unprotected, frame_data_length};
+      status = alts_iovec_record_protocol_privacy_integrity_unprotect(
+          receiver, header_iovec, &protected_iovec, 1, unprotected_iovec,
+          nullptr);
+      ASSERT_EQ(status, GRPC_STATUS_OK);
+      frame += var->header_length + frame_data_length + var->tag_length;
+      unprotected += frame_data_length;
+      remaining -= frame_data_length;
+    }
+    // Makes sure unprotected data are the same as the original.
+    ASSERT_EQ(memcmp(var->data_buf, var->dup_buf, var->data_length), 0);
+    gpr_free(protected_buf);
+    alts_iovec_record_protocol_test_var_destroy(var);
+  }
+}
+
 static void privacy_integrity_empty_seal_unseal(
     alts_iovec_record_protocol* sender, alts_iovec_record_protocol* receiver) {
   alts_iovec_record_protocol_test_var* var =
@@ -785,6 +834,25 @@ TEST(AltsIovecRecordProtocolTest,
   alts_iovec_record_protocol_test_fixture_destroy(fixture);
 }
 
+TEST(AltsIovecRecordProtocolTest, AltsIovecRecordProtocolBatchSealUnsealTests) {
+  alts_iovec_record_protocol_test_fixture* fixture =
+      alts_iovec_record_protocol_test_fixture_create(
+          /*rekey=*/false, /*integrity_only=*/false);
+  privacy_integrity_batch_seal_unseal(fixture->client_protect,
+                                      fixture->server_unprotect);
+  privacy_integrity_batch_seal_unseal(fixture->server_protect,
+                                      fixture->client_unprotect);
+  alts_iovec_record_protocol_test_fixture_destroy(fixture);
+
+  fixture = alts_iovec_record_protocol_test_fixture_create(
+      /*rekey=*/true, /*integrity_only=*/false);
+  privacy_integrity_batch_seal_unseal(fixture->client_protect,
+                                      fixture->server_unprotect);
+  privacy_integrity_batch_seal_unseal(fixture->server_protect,
+                                      fixture->client_unprotect);
+  alts_iovec_record_protocol_test_fixture_destroy(fixture);
+}
+
 TEST(AltsIovecRecordProtocolTest, AltsIovecRecordProtocolEmptySealUnsealTests) {
   alts_iovec_record_protocol_test_fixture* fixture =
       alts_iovec_record_protocol_test_fixture_create(
@@ -317,6 +317,10 @@ class SslTransportSecurityTest
       session_ticket_key_size_ = session_ticket_key_size;
     }
 
+    void SetSessionTicketKeys(tsi::TlsSessionTicketKeys* session_ticket_keys) {
+      session_ticket_keys_ = session_ticket_keys;
+    }
+
     void SetBioBufSizes(size_t network_bio_buf_size, size_t ssl_bio_buf_size) {
       network_bio_buf_size_ = network_bio_buf_size;
       ssl_bio_buf_size_ = ssl_bio_buf_size;
@@ -422,6 +426,7 @@ class SslTransportSecurityTest
       server_options.session_ticket_key = ssl_fixture->session_ticket_key_;
       server_options.session_ticket_key_size =
           ssl_fixture->session_ticket_key_size_;
+      server_options.session_ticket_keys = ssl_fixture->session_ticket_keys_;
       server_options.min_tls_version = ssl_fixture->tls_version_;
       server_options.max_tls_version = ssl_fixture->tls_version_;
       ASSERT_EQ(tsi_create_ssl_server_handshaker_factory_with_options(
@@ -695,6 +700,7 @@ class SslTransportSecurityTest
     bool session_reused_;
     const char* session_ticket_key_ = nullptr;
     size_t session_ticket_key_size_;
+    tsi::TlsSessionTicketKeys* session_ticket_keys_ = nullptr;
     size_t network_bio_buf_size_;
     size_t ssl_bio_buf_size_;
     bool verify_root_cert_subject_;
@@ -1033,6 +1039,48 @@ TEST_P(SslTransportSecurityTest, DoHandshakeSessionCache) {
   do_handshake(true);
   tsi_ssl_session_cache_unref(session_cache);
 }
+
+TEST_P(SslTransportSecurityTest, DoHandshakeRotatedSessionTicketKeys) {
+  LOG(INFO) << "ssl_tsi_test_do_handshake_rotated_session_ticket_keys";
+  auto make_key = [](char c) {
+    tsi::TlsSessionTicketKeys::Key key;
+    memset(&key, c, sizeof(key));
+    return key;
+  };
+  std::vector<tsi::TlsSessionTicketKeys::Key> current_keys = {make_key('a')};
+  // Reload on every handshake, so that each change to current_keys is seen by
+  // the next handshake.
+  auto session_ticket_keys =
+      grpc_core::MakeRefCounted<tsi::TlsSessionTicketKeys>(
+          [&current_keys]() { return current_keys; }, absl::ZeroDuration());
+  tsi_ssl_session_cache* session_cache = tsi_ssl_session_cache_create_lru(16);
+  auto do_handshake = [&](bool session_reused) {
+    SetUpSslFixture(/*tls_version=*/std::get<0>(GetParam()),
+                    /*send_client_ca_list=*/std::get<1>(GetParam()));
+    ssl_fixture_->SetServerNameIndication(
+        const_cast<char*>("waterzooi.test.google.be"));
+    ssl_fixture_->SetSessionTicketKeys(session_ticket_keys.get());
+    tsi_ssl_session_cache_ref(session_cache);
+    ssl_fixture_->SetSessionCache(session_cache);
+    ssl_fixture_->SetSessionReused(session_reused);
+    DoRoundTrip();
+    DestroyFixture();
+  };
+  do_handshake(false);
+  do_handshake(true);
+  // A new key encrypts new tickets, and tickets encrypted with the previous
+  // key are still accepted.
+  current_keys = {make_key('b'), make_key('a')};
+  do_handshake(true);
+  // The ticket was renewed with the new key, so the previous key can go.
+  current_keys = {make_key('b')};
+  do_handshake(true);
+  // Tickets encrypted with keys that are gone are not accepted.
+  current_keys = {make_key('c')};
+  do_handshake(false);
+  do_handshake(true);
+  tsi_ssl_session_cache_unref(session_cache);
+}
 #endif  // OPENSSL_IS_BORINGSSL
 
 TEST_P(SslTransportSecurityTest, DoHandshakeAlpnServerNoClient) {
@@ -1082,6 +1130,29 @@ TEST_P(SslTransportSecurityTest, Protect) {
   tsi_frame_protector_destroy(protector);
 }
 
+TEST_P(SslTransportSecurityTest, RecordsGrowAfterTheFirstBytes) {
+  SetUpSslFixture(tsi_tls_version::TSI_TLS1_3, /*send_client_ca_list=*/false);
+  DoHandshake();
+  tsi_frame_protector* protector;
+  EXPECT_EQ(tsi_handshaker_result_create_frame_protector(
+                ssl_tsi_test_fixture_->client_result,
+                /*max_output_protected_frame_size=*/nullptr, &protector),
+            TSI_OK);
+  ASSERT_NE(protector, nullptr);
+  std::string buffer(3000, 'a');
+  // Small records to start with.
+  EXPECT_EQ(Protect(protector, buffer).size(),
+            buffer.size() + 3 * kTls13FrameOverhead);
+  for (size_t protected_size = buffer.size(); protected_size < 128 * 1024;
+       protected_size += buffer.size()) {
+    Protect(protector, buffer);
+  }
+  // Then one record per flush.
+  EXPECT_EQ(Protect(protector, buffer).size(),
+            buffer.size() + kTls13FrameOverhead);
+  tsi_frame_protector_destroy(protector);
+}
+
 TEST_P(SslTransportSecurityTest, ProtectAndUnprotect) {
   LOG(INFO) << "ssl_tsi_test_protect_and_unprotect";
   SetUpSslFixture(tsi_tls_version::TSI_TLS1_3, /*send_client_ca_list=*/false);
@@ -1106,6 +1177,49 @@ TEST_P(SslTransportSecurityTest, ProtectAndUnprotect) {
   tsi_frame_protector_destroy(server_protector);
 }
 
+TEST_P(SslTransportSecurityTest, KtlsCryptoInfoIsUnimplementedForTls13) {
+  SetUpSslFixture(tsi_tls_version::TSI_TLS1_3, /*send_client_ca_list=*/false);
+  DoHandshake();
+  tsi_ktls_crypto_info crypto_info;
+  EXPECT_EQ(tsi_handshaker_result_get_ktls_crypto_info(
+                ssl_tsi_test_fixture_->client_result, &crypto_info),
+            TSI_UNIMPLEMENTED);
+  EXPECT_EQ(tsi_handshaker_result_get_ktls_crypto_info(
+                ssl_tsi_test_fixture_->server_result, &crypto_info),
+            TSI_UNIMPLEMENTED);
+}
+
+TEST_P(SslTransportSecurityTest, KtlsCryptoInfoMatchesBetweenPeersForTls12) {
+#if defined(OPENSSL_IS_BORINGSSL)
+  SetUpSslFixture(tsi_tls_version::TSI_TLS1_2, /*send_client_ca_list=*/false);
+  DoHandshake();
+  tsi_ktls_crypto_info client;
+  ASSERT_EQ(tsi_handshaker_result_get_ktls_crypto_info(
+                ssl_tsi_test_fixture_->client_result, &client),
+            TSI_OK);
+  tsi_ktls_crypto_info server;
+  ASSERT_EQ(tsi_handshaker_result_get_ktls_crypto_info(
+                ssl_tsi_test_fixture_->server_result, &server),
+            TSI_OK);
+  EXPECT_EQ(client.version, TSI_TLS1_2);
+  EXPECT_EQ(client.cipher, server.cipher);
+  ASSERT_EQ(client.key_size, server.key_size);
+  EXPECT_EQ(memcmp(client.tx_key, server.rx_key, client.key_size), 0);
+  EXPECT_EQ(memcmp(client.rx_key, server.tx_key, client.key_size), 0);
+  EXPECT_NE(memcmp(client.tx_key, client.rx_key, client.key_size), 0);
+  EXPECT_EQ(memcmp(client.tx_salt, server.rx_salt, sizeof(client.tx_salt)), 0);
+  EXPECT_EQ(memcmp(client.rx_salt, server.tx_salt, sizeof(client.rx_salt)), 0);
+  EXPECT_EQ(
+      memcmp(client.tx_rec_seq, server.rx_rec_seq, sizeof(client.tx_rec_seq)),
+      0);
+  EXPECT_EQ(
+      memcmp(client.rx_rec_seq, server.tx_rec_seq, sizeof(client.rx_rec_seq)),
+      0);
+#else
+  GTEST_SKIP() << "kTLS crypto info is only exported with BoringSSL";
+#endif
+}
+
 TEST_P(SslTransportSecurityTest, ConcurrentlyProtectAndUnprotectOnClient) {
   LOG(INFO) << "ssl_tsi_test_protect_and_unprotect";
   SetUpSslFixture(tsi_tls_version::TSI_TLS1_3, /*send_client_ca_list=*/false);
@@ -1128,8 +1242,10 @@ TEST_P(SslTransportSecurityTest, ConcurrentlyProtectAndUnprotectOnClient) {
     std::string second_buffer(2048, 'b');
     std::string second_protected_buffer =
         Protect(client_protector, second_buffer);
+    // The first bytes of a connection go out in small records, so this takes
+    // two.
     EXPECT_EQ(second_protected_buffer.size(),
-              second_buffer.size() + kTls13FrameOverhead);
+              second_buffer.size() + 2 * kTls13FrameOverhead);
   });
   std::thread unprotect_thread([&client_protector, protected_bytes, buffer]() {
     std::string unprotected_bytes =
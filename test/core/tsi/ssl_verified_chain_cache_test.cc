@@ -0,0 +1,148 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/tsi/ssl/verified_chain_cache/ssl_verified_chain_cache.h"
+
+#include <openssl/bio.h>
+#include <openssl/pem.h>
+#include <openssl/x509.h>
+
+#include <string>
+
+#include "absl/log/check.h"
+#include "gtest/gtest.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "test/core/test_util/test_config.h"
+#include "test/core/test_util/tls_utils.h"
+
+namespace tsi {
+namespace {
+
+constexpr char kCaCertPath[] = "src/core/tsi/test_creds/ca.pem";
+constexpr char kServer0CertPath[] = "src/core/tsi/test_creds/server0.pem";
+constexpr char kServer1CertPath[] = "src/core/tsi/test_creds/server1.pem";
+
+X509* ReadCert(const char* path) {
+  std::string pem = grpc_core::testing::GetFileContents(path);
+  BIO* bio = BIO_new_mem_buf(pem.data(), static_cast<int>(pem.size()));
+  CHECK_NE(bio, nullptr);
+  X509* cert = PEM_read_bio_X509(bio, nullptr, nullptr, nullptr);
+  CHECK_NE(cert, nullptr);
+  BIO_free(bio);
+  return cert;
+}
+
+class VerifiedChainCacheTest : public ::testing::Test {
+ protected:
+  VerifiedChainCacheTest()
+      : ca_(ReadCert(kCaCertPath)),
+        server0_(ReadCert(kServer0CertPath)),
+        server1_(ReadCert(kServer1CertPath)) {}
+
+  ~VerifiedChainCacheTest() override {
+    X509_free(ca_);
+    X509_free(server0_);
+    X509_free(server1_);
+  }
+
+  // Returns the chain leaf -> ca, which the caller must free.
+  STACK_OF(X509)* MakeChain(X509* leaf) {
+    STACK_OF(X509)* chain = sk_X509_new_null();
+    X509_up_ref(leaf);
+    sk_X509_push(chain, leaf);
+    X509_up_ref(ca_);
+    sk_X509_push(chain, ca_);
+    return chain;
+  }
+
+  static void FreeChain(STACK_OF(X509)* chain) {
+    sk_X509_pop_free(chain, X509_free);
+  }
+
+  X509* ca_;
+  X509* server0_;
+  X509* server1_;
+};
+
+TEST_F(VerifiedChainCacheTest, FingerprintCoversEveryPresentedCert) {
+  STACK_OF(X509)* intermediates = sk_X509_new_null();
+  sk_X509_push(intermediates, ca_);
+  auto leaf_only = VerifiedChainCache::Fingerprint(server0_, nullptr);
+  auto with_intermediate =
+      VerifiedChainCache::Fingerprint(server0_, intermediates);
+  auto other_leaf = VerifiedChainCache::Fingerprint(server1_, nullptr);
+  sk_X509_free(intermediates);
+  ASSERT_TRUE(leaf_only.has_value());
+  ASSERT_TRUE(with_intermediate.has_value());
+  ASSERT_TRUE(other_leaf.has_value());
+  EXPECT_EQ(*leaf_only, *VerifiedChainCache::Fingerprint(server0_, nullptr));
+  EXPECT_NE(*leaf_only, *with_intermediate);
+  EXPECT_NE(*leaf_only, *other_leaf);
+  EXPECT_FALSE(VerifiedChainCache::Fingerprint(nullptr, nullptr).has_value());
+}
+
+TEST_F(VerifiedChainCacheTest, ReturnsStoredChain) {
+  auto cache = grpc_core::MakeRefCounted<VerifiedChainCache>();
+  std::string fingerprint = *VerifiedChainCache::Fingerprint(server0_, nullptr);
+  EXPECT_EQ(cache->Get(fingerprint), nullptr);
+  STACK_OF(X509)* chain = MakeChain(server0_);
+  cache->Put(fingerprint, chain);
+  FreeChain(chain);
+  STACK_OF(X509)* cached = cache->Get(fingerprint);
+  ASSERT_NE(cached, nullptr);
+  ASSERT_EQ(sk_X509_num(cached), 2);
+  EXPECT_EQ(X509_cmp(sk_X509_value(cached, 0), server0_), 0);
+  EXPECT_EQ(X509_cmp(sk_X509_value(cached, 1), ca_), 0);
+  FreeChain(cached);
+  EXPECT_EQ(cache->Get(*VerifiedChainCache::Fingerprint(server1_, nullptr)),
+            nullptr);
+}
+
+TEST_F(VerifiedChainCacheTest, EntriesExpire) {
+  auto cache = grpc_core::MakeRefCounted<VerifiedChainCache>(
+      VerifiedChainCache::kDefaultMaxEntries, absl::ZeroDuration());
+  std::string fingerprint = *VerifiedChainCache::Fingerprint(server0_, nullptr);
+  STACK_OF(X509)* chain = MakeChain(server0_);
+  cache->Put(fingerprint, chain);
+  FreeChain(chain);
+  EXPECT_EQ(cache->Get(fingerprint), nullptr);
+}
+
+TEST_F(VerifiedChainCacheTest, EvictsLeastRecentlyUsedChain) {
+  auto cache = grpc_core::MakeRefCounted<VerifiedChainCache>(
+      /*max_entries=*/1);
+  std::string fingerprint0 =
+      *VerifiedChainCache::Fingerprint(server0_, nullptr);
+  std::string fingerprint1 =
+      *VerifiedChainCache::Fingerprint(server1_, nullptr);
+  STACK_OF(X509)* chain0 = MakeChain(server0_);
+  STACK_OF(X509)* chain1 = MakeChain(server1_);
+  cache->Put(fingerprint0, chain0);
+  cache->Put(fingerprint1, chain1);
+  FreeChain(chain0);
+  FreeChain(chain1);
+  EXPECT_EQ(cache->Get(fingerprint0), nullptr);
+  STACK_OF(X509)* cached = cache->Get(fingerprint1);
+  ASSERT_NE(cached, nullptr);
+  FreeChain(cached);
+}
+
+}  // namespace
+}  // namespace tsi
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
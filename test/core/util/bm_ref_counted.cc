@@ -0,0 +1,67 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Multi-threaded Ref/Unref throughput on a single shared object, with a
+// plain RefCount and with ShardedRefCount.
+
+#include <benchmark/benchmark.h>
+
+#include "src/core/util/ref_counted.h"
+#include "src/core/util/sharded_ref_count.h"
+
+namespace grpc_core {
+namespace {
+
+class PlainObject : public RefCounted<PlainObject> {};
+
+class ShardedObject : public RefCounted<ShardedObject, PolymorphicRefCount,
+                                        UnrefDelete, ShardedRefCount> {};
+
+// Never released, so the sharded object is never reconciled.
+template <typename T>
+T* GetObject() {
+  static T* object = new T();
+  return object;
+}
+
+template <typename T>
+void BM_RefUnref(benchmark::State& state) {
+  T* object = GetObject<T>();
+  for (auto _ : state) {
+    object->Ref().release();
+    object->Unref();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(BM_RefUnref, PlainObject)
+    ->ThreadRange(1, 64)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_RefUnref, ShardedObject)
+    ->ThreadRange(1, 64)
+    ->UseRealTime();
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  ::benchmark::Initialize(&argc, argv);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -0,0 +1,63 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/util/byte_scan.h"
+
+#include <string>
+
+#include "gtest/gtest.h"
+
+namespace grpc_core {
+namespace testing {
+
+// The byte-at-a-time definition the word scan must agree with.
+size_t SlowPrintableAsciiPrefixLength(absl::string_view s, char stop) {
+  size_t i = 0;
+  while (i < s.size() && s[i] >= 0x20 && s[i] <= 0x7e && s[i] != stop) ++i;
+  return i;
+}
+
+TEST(ByteScanTest, Empty) { EXPECT_EQ(PrintableAsciiPrefixLength(""), 0); }
+
+TEST(ByteScanTest, AllPrintable) {
+  std::string s;
+  for (int c = 0x20; c <= 0x7e; ++c) s.push_back(c);
+  EXPECT_EQ(PrintableAsciiPrefixLength(s), s.size());
+  EXPECT_EQ(PrintableAsciiPrefixLength(s, '%'), s.find('%'));
+}
+
+TEST(ByteScanTest, EveryByteAtEveryPosition) {
+  for (size_t length = 1; length <= 24; ++length) {
+    for (size_t pos = 0; pos < length; ++pos) {
+      for (int c = 0; c < 256; ++c) {
+        std::string s(length, 'a');
+        s[pos] = static_cast<char>(c);
+        for (char stop : {'\0', '%'}) {
+          EXPECT_EQ(PrintableAsciiPrefixLength(s, stop),
+                    SlowPrintableAsciiPrefixLength(s, stop))
+              << "length=" << length << " pos=" << pos << " c=" << c
+              << " stop=" << static_cast<int>(stop);
+        }
+      }
+    }
+  }
+}
+
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,110 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/util/codel.h"
+
+#include "gtest/gtest.h"
+
+namespace grpc_core {
+namespace {
+
+constexpr Duration kTarget = Duration::Milliseconds(5);
+constexpr Duration kInterval = Duration::Milliseconds(100);
+
+// Counts rejections of one arrival per millisecond between start and end,
+// with each arrival seeing a queue that has waited for delay.
+int CountRejections(Codel& codel, Timestamp start, Timestamp end,
+                    Duration delay) {
+  int rejected = 0;
+  for (Timestamp now = start; now < end; now += Duration::Milliseconds(1)) {
+    if (codel.Reject(now)) {
+      ++rejected;
+    } else {
+      codel.RecordDelay(delay, now);
+    }
+  }
+  return rejected;
+}
+
+TEST(CodelTest, NoOp) {
+  Codel codel(kTarget, kInterval);
+  EXPECT_EQ(codel.target(), kTarget);
+  EXPECT_EQ(codel.interval(), kInterval);
+  EXPECT_FALSE(codel.dropping());
+}
+
+TEST(CodelTest, AcceptsWhileDelayIsBelowTarget) {
+  Codel codel(kTarget, kInterval);
+  const Timestamp start = Timestamp::ProcessEpoch();
+  EXPECT_EQ(CountRejections(codel, start, start + Duration::Seconds(10),
+                            kTarget),
+            0);
+  EXPECT_FALSE(codel.dropping());
+}
+
+TEST(CodelTest, OneShortDelayKeepsTheQueueGood) {
+  Codel codel(kTarget, kInterval);
+  Timestamp now = Timestamp::ProcessEpoch();
+  for (int i = 0; i < 20; ++i) {
+    codel.RecordDelay(Duration::Seconds(1), now);
+    codel.RecordDelay(Duration::Zero(), now);
+    EXPECT_FALSE(codel.Reject(now));
+    now += kInterval;
+  }
+}
+
+TEST(CodelTest, RejectionsGrowWhileDelayStaysHigh) {
+  Codel codel(kTarget, kInterval);
+  const Timestamp start = Timestamp::ProcessEpoch();
+  const Duration delay = Duration::Milliseconds(50);
+  // The first interval only measures.
+  EXPECT_EQ(CountRejections(codel, start, start + kInterval, delay), 0);
+  EXPECT_EQ(CountRejections(codel, start + kInterval,
+                            start + kInterval + Duration::Milliseconds(1),
+                            delay),
+            1);
+  EXPECT_TRUE(codel.dropping());
+  const int first_second =
+      CountRejections(codel, start + kInterval + Duration::Milliseconds(1),
+                      start + Duration::Seconds(1), delay);
+  const int next_second =
+      CountRejections(codel, start + Duration::Seconds(1),
+                      start + Duration::Seconds(2), delay);
+  EXPECT_GT(first_second, 0);
+  EXPECT_GT(next_second, first_second);
+}
+
+TEST(CodelTest, StopsRejectingWhenDelayRecovers) {
+  Codel codel(kTarget, kInterval);
+  const Timestamp start = Timestamp::ProcessEpoch();
+  CountRejections(codel, start, start + Duration::Seconds(1),
+                  Duration::Milliseconds(50));
+  EXPECT_TRUE(codel.dropping());
+  const Timestamp recovered = start + Duration::Seconds(1);
+  CountRejections(codel, recovered, recovered + kInterval * 2,
+                  Duration::Zero());
+  EXPECT_FALSE(codel.dropping());
+  EXPECT_EQ(CountRejections(codel, recovered + kInterval * 2,
+                            recovered + Duration::Seconds(2),
+                            Duration::Zero()),
+            0);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,74 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/util/concurrent_tdigest.h"
+
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "src/core/util/tdigest.h"
+
+namespace grpc_core {
+namespace {
+
+TEST(ConcurrentTDigestTest, CollectEmpty) {
+  ConcurrentTDigest digest(100);
+  TDigest out(0);
+  digest.Collect(out);
+  EXPECT_EQ(out.Count(), 0);
+}
+
+TEST(ConcurrentTDigestTest, CollectFromManyThreads) {
+  constexpr int kThreads = 8;
+  constexpr int kValuesPerThread = 1000;
+  ConcurrentTDigest digest(100);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kThreads; ++i) {
+    threads.emplace_back([&digest]() {
+      for (int j = 1; j <= kValuesPerThread; ++j) digest.Add(j);
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  TDigest out(0);
+  digest.Collect(out);
+  EXPECT_EQ(out.Count(), kThreads * kValuesPerThread);
+  EXPECT_EQ(out.Min(), 1);
+  EXPECT_EQ(out.Max(), kValuesPerThread);
+  EXPECT_NEAR(out.Quantile(0.5), kValuesPerThread / 2, kValuesPerThread / 50);
+  EXPECT_NEAR(out.Quantile(0.99), kValuesPerThread * 0.99,
+              kValuesPerThread / 50);
+}
+
+TEST(ConcurrentTDigestTest, CollectForgetsValues) {
+  ConcurrentTDigest digest(100);
+  digest.Add(1);
+  digest.Add(2);
+  TDigest first(0);
+  digest.Collect(first);
+  EXPECT_EQ(first.Count(), 2);
+  digest.Add(3);
+  TDigest second(0);
+  digest.Collect(second);
+  EXPECT_EQ(second.Count(), 1);
+  EXPECT_EQ(second.Min(), 3);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -23,6 +23,7 @@
 #include <string.h>
 
 #include <string>
+#include <utility>
 
 #include "absl/status/status.h"
 #include "absl/strings/str_format.h"
@@ -326,6 +327,83 @@ TEST(ParserTest, MainTest) {
   }
 }
 
+// Parses \a response_text and returns the parser's view of its framing as
+// {complete, keep_alive}.
+static std::pair<bool, bool> parse_framing(const char* response_text) {
+  grpc_http_parser parser;
+  grpc_http_response response;
+  response = {};
+  grpc_http_parser_init(&parser, GRPC_HTTP_RESPONSE, &response);
+  grpc_slice slice = grpc_slice_from_copied_string(response_text);
+  EXPECT_EQ(grpc_http_parser_parse(&parser, slice, nullptr), absl::OkStatus());
+  grpc_slice_unref(slice);
+  std::pair<bool, bool> framing = {
+      grpc_http_parser_response_complete(&parser),
+      grpc_http_parser_response_keep_alive(&parser)};
+  grpc_http_response_destroy(&response);
+  grpc_http_parser_destroy(&parser);
+  return framing;
+}
+
+TEST(ParserTest, ResponseFraming) {
+  using Framing = std::pair<bool, bool>;
+  EXPECT_EQ(parse_framing("HTTP/1.1 200 OK\r\n"
+                          "Content-Length: 5\r\n"
+                          "\r\n"
+                          "hel"),
+            Framing(false, false));
+  EXPECT_EQ(parse_framing("HTTP/1.1 200 OK\r\n"
+                          "content-length: 5\r\n"
+                          "\r\n"
+                          "hello"),
+            Framing(true, true));
+  EXPECT_EQ(parse_framing("HTTP/1.1 200 OK\r\n"
+                          "Content-Length: 0\r\n"
+                          "\r\n"),
+            Framing(true, true));
+  EXPECT_EQ(parse_framing("HTTP/1.1 200 OK\r\n"
+                          "Content-Length: 5\r\n"
+                          "\r\n"
+                          "hello world"),
+            Framing(true, false));
+  EXPECT_EQ(parse_framing("HTTP/1.1 200 OK\r\n"
+                          "Content-Length: 5\r\n"
+                          "Connection: close\r\n"
+                          "\r\n"
+                          "hello"),
+            Framing(true, false));
+  EXPECT_EQ(parse_framing("HTTP/1.0 200 OK\r\n"
+                          "Content-Length: 5\r\n"
+                          "\r\n"
+                          "hello"),
+            Framing(true, false));
+  EXPECT_EQ(parse_framing("HTTP/1.0 200 OK\r\n"
+                          "Content-Length: 5\r\n"
+                          "Connection: keep-alive\r\n"
+                          "\r\n"
+                          "hello"),
+            Framing(true, true));
+  EXPECT_EQ(parse_framing("HTTP/1.1 200 OK\r\n"
+                          "Transfer-Encoding: chunked\r\n"
+                          "\r\n"
+                          "5\r\n"
+                          "hello\r\n"),
+            Framing(false, false));
+  EXPECT_EQ(parse_framing("HTTP/1.1 200 OK\r\n"
+                          "Transfer-Encoding: chunked\r\n"
+                          "\r\n"
+                          "5\r\n"
+                          "hello\r\n"
+                          "0\r\n"
+                          "\r\n"),
+            Framing(true, true));
+  // Without a length, the body ends when the connection closes.
+  EXPECT_EQ(parse_framing("HTTP/1.1 200 OK\r\n"
+                          "\r\n"
+                          "hello"),
+            Framing(false, false));
+}
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(&argc, argv);
   ::testing::InitGoogleTest(&argc, argv);
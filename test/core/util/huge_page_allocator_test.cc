@@ -0,0 +1,121 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/util/huge_page_allocator.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+TEST(HugePageAllocatorTest, RejectsUnsupportedSizes) {
+  HugePageAllocator* allocator = HugePageAllocator::Get();
+  if (allocator == nullptr) GTEST_SKIP() << "Not supported on this platform";
+  EXPECT_EQ(allocator->Alloc(100), nullptr);
+  EXPECT_EQ(allocator->Alloc(HugePageAllocator::kMaxBlockSize +
+                             HugePageAllocator::kBlockHeaderRoom + 1),
+            nullptr);
+}
+
+TEST(HugePageAllocatorTest, AllocFreeReuse) {
+  HugePageAllocator* allocator = HugePageAllocator::Get();
+  if (allocator == nullptr) GTEST_SKIP() << "Not supported on this platform";
+  void* p = allocator->Alloc(64 * 1024 + 64);
+  ASSERT_NE(p, nullptr);
+  EXPECT_TRUE(allocator->Owns(p));
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(p) % 64, 0u);
+  memset(p, 0xab, 64 * 1024 + 64);
+  EXPECT_TRUE(HugePageAllocator::MaybeFree(p));
+  // The freed block is at the head of its slab's free list.
+  EXPECT_EQ(allocator->Alloc(64 * 1024), p);
+  allocator->Free(p);
+}
+
+TEST(HugePageAllocatorTest, MaybeFreeIgnoresForeignMemory) {
+  HugePageAllocator::Get();
+  std::vector<char> other(8192);
+  EXPECT_FALSE(HugePageAllocator::MaybeFree(other.data()));
+}
+
+TEST(HugePageAllocatorTest, BlocksDoNotOverlap) {
+  HugePageAllocator* allocator = HugePageAllocator::Get();
+  if (allocator == nullptr) GTEST_SKIP() << "Not supported on this platform";
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; t++) {
+    threads.emplace_back([allocator, t]() {
+      std::vector<char*> blocks;
+      for (int i = 0; i < 100; i++) {
+        char* p = static_cast<char*>(allocator->Alloc(8 * 1024));
+        ASSERT_NE(p, nullptr);
+        memset(p, t * 100 + i, 8 * 1024);
+        blocks.push_back(p);
+      }
+      for (int i = 0; i < 100; i++) {
+        for (int j = 0; j < 8 * 1024; j += 1024) {
+          ASSERT_EQ(blocks[i][j], static_cast<char>(t * 100 + i));
+        }
+        allocator->Free(blocks[i]);
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+}
+
+TEST(HugePageAllocatorTest, IdleSlabsAreReleasedAndReused) {
+  HugePageAllocator* allocator = HugePageAllocator::Get();
+  if (allocator == nullptr) GTEST_SKIP() << "Not supported on this platform";
+  // Enough 64KB blocks to fill several slabs, even if this thread moves
+  // between shards.
+  constexpr size_t kBlockSize = 64 * 1024;
+  constexpr size_t kBlocks = 10 * HugePageAllocator::kSlabSize / kBlockSize;
+  const size_t slabs_before = allocator->slabs_in_use();
+  std::vector<char*> blocks;
+  for (size_t i = 0; i < kBlocks; i++) {
+    char* p = static_cast<char*>(allocator->Alloc(kBlockSize));
+    ASSERT_NE(p, nullptr);
+    memset(p, 0xab, kBlockSize);
+    blocks.push_back(p);
+  }
+  const size_t slabs_allocated = allocator->slabs_in_use();
+  EXPECT_GE(slabs_allocated, slabs_before + 9);
+  for (char* p : blocks) allocator->Free(p);
+  // Only the slabs that shards are still allocating from stay committed.
+  const size_t slabs_freed = allocator->slabs_in_use();
+  EXPECT_LT(slabs_freed, slabs_allocated - 5);
+  // Idle slabs serve other size classes.
+  std::vector<char*> small_blocks;
+  for (size_t i = 0; i < 2 * HugePageAllocator::kSlabSize / 8192; i++) {
+    char* p = static_cast<char*>(allocator->Alloc(8 * 1024));
+    ASSERT_NE(p, nullptr);
+    small_blocks.push_back(p);
+  }
+  EXPECT_LE(allocator->slabs_in_use(), slabs_allocated);
+  for (char* p : small_blocks) allocator->Free(p);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
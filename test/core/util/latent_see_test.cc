@@ -0,0 +1,158 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/util/latent_see.h"
+
+#include <thread>
+#include <vector>
+
+#include "absl/types/span.h"
+#include "gtest/gtest.h"
+
+namespace grpc_core {
+namespace latent_see {
+namespace {
+
+#ifdef GRPC_ENABLE_LATENT_SEE
+
+class LatentSeeTest : public ::testing::Test {
+ protected:
+  LatentSeeTest() { Pull(); }
+  ~LatentSeeTest() override {
+    Log::SetSampleOneIn(1);
+    Log::SetMaxEventsPerCpu(0);
+    Pull();
+  }
+
+  // Returns the events recorded since the last pull, one vector per cpu.
+  static std::vector<std::vector<Log::RecordedEvent>> Pull() {
+    std::vector<std::vector<Log::RecordedEvent>> fragments;
+    Log::Get().TryPullEventsAndFlush(
+        [&](absl::Span<const Log::RecordedEvent> events) {
+          fragments.emplace_back(events.begin(), events.end());
+        });
+    return fragments;
+  }
+
+  static int Count(
+      const std::vector<std::vector<Log::RecordedEvent>>& fragments,
+      const Metadata* metadata, EventType type) {
+    int count = 0;
+    for (const auto& fragment : fragments) {
+      for (const auto& event : fragment) {
+        if (event.event.metadata == metadata && event.event.type == type) {
+          ++count;
+        }
+      }
+    }
+    return count;
+  }
+
+  // Runs f on a new thread, so that it starts with fresh sampling state.
+  template <typename F>
+  static void RunOnNewThread(F f) {
+    std::thread(f).join();
+  }
+};
+
+TEST_F(LatentSeeTest, SamplesOneInNParentScopes) {
+  static Metadata parent = {__FILE__, __LINE__, "parent"};
+  static Metadata mark = {__FILE__, __LINE__, "mark"};
+  Log::SetSampleOneIn(4);
+  RunOnNewThread([] {
+    for (int i = 0; i < 100; ++i) {
+      ParentScope scope(&parent);
+      Mark(&mark);
+    }
+  });
+  auto fragments = Pull();
+  EXPECT_EQ(Count(fragments, &parent, EventType::kBegin), 25);
+  EXPECT_EQ(Count(fragments, &parent, EventType::kEnd), 25);
+  EXPECT_EQ(Count(fragments, &mark, EventType::kMark), 25);
+}
+
+TEST_F(LatentSeeTest, SampleOneInZeroRecordsNothing) {
+  static Metadata parent = {__FILE__, __LINE__, "parent"};
+  Log::SetSampleOneIn(0);
+  RunOnNewThread([] {
+    for (int i = 0; i < 10; ++i) {
+      ParentScope scope(&parent);
+    }
+  });
+  EXPECT_EQ(Count(Pull(), &parent, EventType::kBegin), 0);
+}
+
+TEST_F(LatentSeeTest, ParentNestedInUnsampledParentIsNotSampled) {
+  static Metadata outer = {__FILE__, __LINE__, "outer"};
+  static Metadata inner = {__FILE__, __LINE__, "inner"};
+  Log::SetSampleOneIn(2);
+  RunOnNewThread([] {
+    for (int i = 0; i < 10; ++i) {
+      ParentScope outer_scope(&outer);
+      // The inner scope is recorded with its sampled outer scope, and
+      // dropped with an unsampled one: it never starts a trace of its own.
+      ParentScope inner_scope(&inner);
+    }
+  });
+  auto fragments = Pull();
+  EXPECT_EQ(Count(fragments, &outer, EventType::kBegin), 5);
+  EXPECT_EQ(Count(fragments, &inner, EventType::kBegin), 5);
+}
+
+TEST_F(LatentSeeTest, BoundedFragmentsKeepMostRecentEventsInOrder) {
+  static Metadata parent = {__FILE__, __LINE__, "parent"};
+  static Metadata mark = {__FILE__, __LINE__, "mark"};
+  static Metadata last = {__FILE__, __LINE__, "last"};
+  constexpr size_t kMaxEvents = 16;
+  Log::SetMaxEventsPerCpu(kMaxEvents);
+  RunOnNewThread([] {
+    // Each scope records three events, so the fragment wraps many times.
+    for (int i = 0; i < 100; ++i) {
+      ParentScope scope(&parent);
+      Mark(&mark);
+    }
+    ParentScope scope(&last);
+  });
+  auto fragments = Pull();
+  for (const auto& fragment : fragments) {
+    EXPECT_LE(fragment.size(), kMaxEvents);
+    for (size_t i = 1; i < fragment.size(); ++i) {
+      EXPECT_LE(fragment[i - 1].batch_id, fragment[i].batch_id);
+      if (fragment[i - 1].batch_id == fragment[i].batch_id) {
+        EXPECT_LE(fragment[i - 1].event.timestamp,
+                  fragment[i].event.timestamp);
+      }
+    }
+  }
+  // The newest events survive the wrap-around.
+  EXPECT_EQ(Count(fragments, &last, EventType::kBegin), 1);
+  EXPECT_EQ(Count(fragments, &last, EventType::kEnd), 1);
+}
+
+#else  // !GRPC_ENABLE_LATENT_SEE
+
+TEST(LatentSeeTest, RequiresLatentSee) {
+  GTEST_SKIP() << "latent_see is only built with GRPC_ENABLE_LATENT_SEE";
+}
+
+#endif  // GRPC_ENABLE_LATENT_SEE
+
+}  // namespace
+}  // namespace latent_see
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
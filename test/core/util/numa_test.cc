@@ -0,0 +1,84 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/util/numa.h"
+
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace grpc_core {
+namespace {
+
+using ::testing::ElementsAre;
+using ::testing::IsEmpty;
+using ::testing::Optional;
+
+TEST(NumaTopologyTest, ParsesLists) {
+  EXPECT_THAT(NumaTopology::ParseList("0"), Optional(ElementsAre(0)));
+  EXPECT_THAT(NumaTopology::ParseList("0-3"),
+              Optional(ElementsAre(0, 1, 2, 3)));
+  EXPECT_THAT(NumaTopology::ParseList("8,0-1,10-11\n"),
+              Optional(ElementsAre(0, 1, 8, 10, 11)));
+  EXPECT_THAT(NumaTopology::ParseList(""), Optional(IsEmpty()));
+}
+
+TEST(NumaTopologyTest, RejectsMalformedLists) {
+  EXPECT_EQ(NumaTopology::ParseList("a"), std::nullopt);
+  EXPECT_EQ(NumaTopology::ParseList("3-1"), std::nullopt);
+  EXPECT_EQ(NumaTopology::ParseList("0,,1"), std::nullopt);
+  EXPECT_EQ(NumaTopology::ParseList("0-4294967295"), std::nullopt);
+}
+
+TEST(NumaTopologyTest, MapsCpusToNodes) {
+  NumaTopology topology({{0, 1, 4, 5}, {2, 3, 6, 7}});
+  EXPECT_EQ(topology.num_nodes(), 2u);
+  EXPECT_THAT(topology.cpus(1), ElementsAre(2, 3, 6, 7));
+  EXPECT_EQ(topology.NodeOfCpu(5), 0u);
+  EXPECT_EQ(topology.NodeOfCpu(6), 1u);
+  // Unknown cpus map to the first node.
+  EXPECT_EQ(topology.NodeOfCpu(100), 0u);
+}
+
+TEST(NumaTopologyTest, RestrictsNodesToAllowedCpus) {
+  EXPECT_THAT(
+      NumaTopology::RestrictToCpus({{0, 1, 4, 5}, {2, 3, 6, 7}}, {1, 4, 5}),
+      ElementsAre(ElementsAre(1, 4, 5)));
+  EXPECT_THAT(
+      NumaTopology::RestrictToCpus({{0, 1, 4, 5}, {2, 3, 6, 7}}, {0, 7}),
+      ElementsAre(ElementsAre(0), ElementsAre(7)));
+  // Allowed cpus that no node lists form a node of their own.
+  EXPECT_THAT(NumaTopology::RestrictToCpus({{0, 1}}, {8, 9}),
+              ElementsAre(ElementsAre(8, 9)));
+}
+
+TEST(NumaTopologyTest, HostHasAtLeastOneNode) {
+  const NumaTopology& topology = NumaTopology::Get();
+  ASSERT_GE(topology.num_nodes(), 1u);
+  for (size_t node = 0; node < topology.num_nodes(); ++node) {
+    EXPECT_THAT(topology.cpus(node), ::testing::Not(IsEmpty()));
+    for (unsigned cpu : topology.cpus(node)) {
+      EXPECT_EQ(topology.NodeOfCpu(cpu), node);
+    }
+  }
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
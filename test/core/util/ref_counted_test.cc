@@ -18,13 +18,17 @@
 
 #include "src/core/util/ref_counted.h"
 
+#include <atomic>
 #include <memory>
 #include <new>
 #include <set>
+#include <thread>
 #include <type_traits>
+#include <vector>
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
+#include "src/core/util/sharded_ref_count.h"
 #include "test/core/test_util/test_config.h"
 
 namespace grpc_core {
@@ -206,6 +210,54 @@ TEST(RefCountedNonPolymorphicWithTracing, Basic) {
   foo->Unref(DEBUG_LOCATION, "original_ref");
 }
 
+class FooSharded : public RefCounted<FooSharded, PolymorphicRefCount,
+                                    UnrefDelete, ShardedRefCount> {
+ public:
+  explicit FooSharded(std::atomic<bool>* destroyed) : destroyed_(destroyed) {}
+  ~FooSharded() override { destroyed_->store(true); }
+
+  void Orphan() {
+    ReconcileRefs();
+    Unref();
+  }
+
+ private:
+  std::atomic<bool>* destroyed_;
+};
+
+TEST(RefCountedSharded, DestroyedOnlyAfterReconcile) {
+  std::atomic<bool> destroyed{false};
+  FooSharded* foo = new FooSharded(&destroyed);
+  // Enough refs to make the shard take and give back several batches.
+  std::vector<RefCountedPtr<FooSharded>> refs;
+  for (int i = 0; i < 1000; ++i) refs.push_back(foo->Ref());
+  refs.clear();
+  EXPECT_FALSE(destroyed.load());
+  RefCountedPtr<FooSharded> ref = foo->Ref();
+  foo->Orphan();
+  EXPECT_FALSE(destroyed.load());
+  EXPECT_NE(foo->RefIfNonZero(), nullptr);
+  ref.reset();
+  EXPECT_TRUE(destroyed.load());
+}
+
+TEST(RefCountedSharded, ConcurrentRefsAcrossReconcile) {
+  std::atomic<bool> destroyed{false};
+  FooSharded* foo = new FooSharded(&destroyed);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 8; ++t) {
+    threads.emplace_back([ref = foo->Ref()]() mutable {
+      for (int i = 0; i < 100000; ++i) {
+        RefCountedPtr<FooSharded> other = ref->Ref();
+        if (i % 3 == 0) ref = std::move(other);
+      }
+    });
+  }
+  foo->Orphan();
+  for (auto& thread : threads) thread.join();
+  EXPECT_TRUE(destroyed.load());
+}
+
 }  // namespace
 }  // namespace testing
 }  // namespace grpc_core
@@ -53,6 +53,17 @@ TEST(StatusUtilTest, SetAndGetInt) {
   EXPECT_EQ(2021, StatusGetInt(s, StatusIntProperty::kStreamId));
 }
 
+TEST(StatusUtilTest, SetIntOnSharedCopy) {
+  absl::Status original = absl::CancelledError("shared");
+  StatusSetInt(&original, StatusIntProperty::kStreamId, 2021);
+  absl::Status copy = original;
+  StatusSetInt(&copy, StatusIntProperty::kStreamId, 2021);
+  EXPECT_EQ(copy, original);
+  StatusSetInt(&copy, StatusIntProperty::kStreamId, 2022);
+  EXPECT_EQ(2022, StatusGetInt(copy, StatusIntProperty::kStreamId));
+  EXPECT_EQ(2021, StatusGetInt(original, StatusIntProperty::kStreamId));
+}
+
 TEST(StatusUtilTest, GetIntNotExistent) {
   absl::Status s = absl::CancelledError();
   EXPECT_EQ(std::optional<intptr_t>(),
@@ -23,6 +23,7 @@
 #include <grpc/support/time.h>
 #include <stddef.h>
 
+#include <chrono>
 #include <memory>
 #include <thread>
 #include <utility>
@@ -193,6 +194,25 @@ class TestThreadScheduleAndDrain {
   gpr_event done_;
 };
 
+TEST(WorkSerializerTest, ExecuteManyWithSmallDrainBudget) {
+  // Every item runs in its own EventEngine callback, or callbacks are cut
+  // short by the time budget: order must hold across the reschedules.
+  for (auto budget :
+       {WorkSerializer::DrainBudget{1, std::chrono::seconds(1)},
+        WorkSerializer::DrainBudget{1000, std::chrono::microseconds(1)}}) {
+    auto lock =
+        std::make_unique<WorkSerializer>(GetDefaultEventEngine(), budget);
+    {
+      std::vector<std::unique_ptr<TestThread>> threads;
+      for (size_t i = 0; i < 10; ++i) {
+        threads.push_back(std::make_unique<TestThread>(lock.get()));
+      }
+    }
+    lock.reset();
+    WaitForSingleOwner(GetDefaultEventEngine());
+  }
+}
+
 TEST(WorkSerializerTest, ExecuteManyScheduleAndDrain) {
   auto lock = std::make_unique<WorkSerializer>(GetDefaultEventEngine());
   {
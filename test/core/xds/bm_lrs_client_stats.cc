@@ -0,0 +1,138 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+// Measures the cost of the per-call load reporting accounting done by the
+// xds_cluster_impl LB policy, with many threads reporting into the same
+// locality and cluster.
+
+#include <benchmark/benchmark.h>
+#include <grpc/grpc.h>
+
+#include <memory>
+#include <string>
+
+#include "absl/log/check.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/load_balancing/backend_metric_data.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/xds/grpc/xds_bootstrap_grpc.h"
+#include "src/core/xds/grpc/xds_transport_grpc.h"
+#include "src/core/xds/xds_client/lrs_client.h"
+#include "src/core/xds/xds_client/xds_backend_metric_propagation.h"
+#include "src/core/xds/xds_client/xds_locality.h"
+
+namespace grpc_core {
+namespace {
+
+// Nothing listens on the LRS server; reports are never sent, which is fine
+// since only the accounting is measured.
+constexpr char kBootstrap[] =
+    "{\"xds_servers\": [{\"server_uri\": \"localhost:1\","
+    " \"channel_creds\": [{\"type\": \"insecure\"}]}],"
+    " \"node\": {\"id\": \"bm_lrs_client_stats\"}}";
+
+class LrsStatsHelper {
+ public:
+  LrsStatsHelper() {
+    ExecCtx exec_ctx;
+    auto bootstrap = GrpcXdsBootstrap::Create(kBootstrap);
+    CHECK(bootstrap.ok()) << bootstrap.status();
+    std::shared_ptr<XdsBootstrap> shared_bootstrap = std::move(*bootstrap);
+    auto lrs_server = shared_bootstrap->servers()[0]->target();
+    lrs_client_ = MakeRefCounted<LrsClient>(
+        std::move(shared_bootstrap), "bm", "1",
+        MakeRefCounted<GrpcXdsTransportFactory>(ChannelArgs()),
+        grpc_event_engine::experimental::GetDefaultEventEngine());
+    auto propagation = MakeRefCounted<BackendMetricPropagation>();
+    propagation->propagation_bits = BackendMetricPropagation::kCpuUtilization;
+    locality_stats_ = lrs_client_->AddClusterLocalityStats(
+        lrs_server, "cluster", "eds_service",
+        MakeRefCounted<XdsLocalityName>("region", "zone", "sub_zone"),
+        std::move(propagation));
+    drop_stats_ =
+        lrs_client_->AddClusterDropStats(lrs_server, "cluster", "eds_service");
+  }
+
+  LrsClient::ClusterLocalityStats* locality_stats() const {
+    return locality_stats_.get();
+  }
+  LrsClient::ClusterDropStats* drop_stats() const { return drop_stats_.get(); }
+
+ private:
+  RefCountedPtr<LrsClient> lrs_client_;
+  RefCountedPtr<LrsClient::ClusterLocalityStats> locality_stats_;
+  RefCountedPtr<LrsClient::ClusterDropStats> drop_stats_;
+};
+
+LrsStatsHelper& GetHelper() {
+  static auto* helper = new LrsStatsHelper();
+  return *helper;
+}
+
+void BM_CallStartedAndFinished(benchmark::State& state) {
+  LrsClient::ClusterLocalityStats* stats = GetHelper().locality_stats();
+  for (auto _ : state) {
+    stats->AddCallStarted();
+    stats->AddCallFinished(nullptr);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_CallStartedAndFinished)->ThreadRange(1, 64)->UseRealTime();
+
+void BM_CallFinishedWithBackendMetrics(benchmark::State& state) {
+  LrsClient::ClusterLocalityStats* stats = GetHelper().locality_stats();
+  BackendMetricData backend_metrics;
+  backend_metrics.cpu_utilization = 0.5;
+  for (auto _ : state) {
+    stats->AddCallStarted();
+    stats->AddCallFinished(&backend_metrics);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_CallFinishedWithBackendMetrics)
+    ->ThreadRange(1, 64)
+    ->UseRealTime();
+
+void BM_CallDropped(benchmark::State& state) {
+  LrsClient::ClusterDropStats* stats = GetHelper().drop_stats();
+  const std::string category = "throttle";
+  for (auto _ : state) {
+    stats->AddCallDropped(category);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_CallDropped)->ThreadRange(1, 64)->UseRealTime();
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  ::benchmark::Initialize(&argc, argv);
+  grpc_init();
+  benchmark::RunTheBenchmarksNamespaced();
+  grpc_shutdown();
+  return 0;
+}
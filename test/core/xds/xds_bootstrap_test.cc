@@ -219,6 +219,29 @@ TEST(XdsBootstrapTest, ValidWithoutNode) {
   EXPECT_EQ(bootstrap->node(), nullptr);
 }
 
+TEST(XdsBootstrapTest, DeltaAdsServerFeature) {
+  const char* json_str =
+      "{"
+      "  \"xds_servers\": ["
+      "    {"
+      "      \"server_uri\": \"fake:///lb1\","
+      "      \"channel_creds\": [{\"type\": \"fake\"}],"
+      "      \"server_features\": [\"delta_ads\"]"
+      "    },"
+      "    {"
+      "      \"server_uri\": \"fake:///lb2\","
+      "      \"channel_creds\": [{\"type\": \"fake\"}]"
+      "    }"
+      "  ]"
+      "}";
+  auto bootstrap_or = GrpcXdsBootstrap::Create(json_str);
+  ASSERT_TRUE(bootstrap_or.ok()) << bootstrap_or.status();
+  auto servers = (*bootstrap_or)->servers();
+  ASSERT_EQ(servers.size(), 2);
+  EXPECT_TRUE(servers[0]->UseDeltaAds());
+  EXPECT_FALSE(servers[1]->UseDeltaAds());
+}
+
 TEST(XdsBootstrapTest, InsecureCreds) {
   const char* json_str =
       "{"
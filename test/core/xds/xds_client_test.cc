@@ -71,6 +71,8 @@
 // IWYU pragma: no_include "google/protobuf/util/json_util.h"
 
 using envoy::admin::v3::ClientResourceStatus;
+using envoy::service::discovery::v3::DeltaDiscoveryRequest;
+using envoy::service::discovery::v3::DeltaDiscoveryResponse;
 using envoy::service::discovery::v3::DiscoveryRequest;
 using envoy::service::discovery::v3::DiscoveryResponse;
 using envoy::service::status::v3::ClientConfig;
@@ -155,12 +157,14 @@ class XdsClientTest : public ::testing::Test {
       explicit FakeXdsServer(
           absl::string_view server_uri = kDefaultXdsServerUrl,
           bool fail_on_data_errors = false,
-          bool resource_timer_is_transient_failure = false)
+          bool resource_timer_is_transient_failure = false,
+          bool use_delta_ads = false)
           : server_target_(
                 std::make_shared<FakeXdsServerTarget>(std::string(server_uri))),
             fail_on_data_errors_(fail_on_data_errors),
             resource_timer_is_transient_failure_(
-                resource_timer_is_transient_failure) {}
+                resource_timer_is_transient_failure),
+            use_delta_ads_(use_delta_ads) {}
       bool IgnoreResourceDeletion() const override {
         return !fail_on_data_errors_;
       }
@@ -168,6 +172,7 @@ class XdsClientTest : public ::testing::Test {
       bool ResourceTimerIsTransientFailure() const override {
         return resource_timer_is_transient_failure_;
       }
+      bool UseDeltaAds() const override { return use_delta_ads_; }
       bool Equals(const XdsServer& other) const override {
         const auto& o = static_cast<const FakeXdsServer&>(other);
         return *server_target_ == *o.server_target_ &&
@@ -185,6 +190,7 @@ class XdsClientTest : public ::testing::Test {
       std::shared_ptr<FakeXdsServerTarget> server_target_;
       bool fail_on_data_errors_ = false;
       bool resource_timer_is_transient_failure_ = false;
+      bool use_delta_ads_ = false;
     };
 
     class FakeAuthority : public Authority {
@@ -880,6 +886,13 @@ class XdsClientTest : public ::testing::Test {
     return WaitForAdsStream(*xds_client_->bootstrap().servers().front());
   }
 
+  RefCountedPtr<FakeXdsTransportFactory::FakeStreamingCall>
+  WaitForDeltaAdsStream() {
+    return transport_factory_->WaitForStream(
+        *xds_client_->bootstrap().servers().front()->target(),
+        FakeXdsTransportFactory::kDeltaAdsMethod);
+  }
+
   void TriggerConnectionFailure(const XdsBootstrap::XdsServer& xds_server,
                                 absl::Status status) {
     transport_factory_->TriggerConnectionFailure(*xds_server.target(),
@@ -900,6 +913,42 @@ class XdsClientTest : public ::testing::Test {
     return std::move(request);
   }
 
+  // Gets the latest delta request sent to the fake xDS server.
+  std::optional<DeltaDiscoveryRequest> WaitForDeltaRequest(
+      FakeXdsTransportFactory::FakeStreamingCall* stream) {
+    auto message = stream->WaitForMessageFromClient();
+    if (!message.has_value()) return std::nullopt;
+    DeltaDiscoveryRequest request;
+    bool success = request.ParseFromString(*message);
+    EXPECT_TRUE(success) << "Failed to deserialize DeltaDiscoveryRequest";
+    if (!success) return std::nullopt;
+    return std::move(request);
+  }
+
+  // Serializes a delta response carrying the given Foo resources, each
+  // with the given version, and removing the given names.
+  static std::string MakeDeltaFooResponse(
+      absl::string_view nonce,
+      const std::vector<std::pair<XdsFooResource, std::string>>& resources,
+      const std::vector<std::string>& removed = {}) {
+    DeltaDiscoveryResponse response;
+    response.set_type_url(absl::StrCat("type.googleapis.com/",
+                                       XdsFooResourceType::Get()->type_url()));
+    response.set_nonce(std::string(nonce));
+    for (const auto& [resource, version] : resources) {
+      auto* res = response.add_resources();
+      res->set_name(resource.name);
+      res->set_version(version);
+      *res->mutable_resource() = XdsFooResourceType::EncodeAsAny(resource);
+    }
+    for (const std::string& name : removed) {
+      response.add_removed_resources(name);
+    }
+    std::string serialized_response;
+    EXPECT_TRUE(response.SerializeToString(&serialized_response));
+    return serialized_response;
+  }
+
   // Helper function to check the fields of a DiscoveryRequest.
   void CheckRequest(const DiscoveryRequest& request, absl::string_view type_url,
                     absl::string_view version_info,
@@ -1333,6 +1382,196 @@ TEST_F(XdsClientTest, UpdateFromServer) {
   EXPECT_TRUE(stream->IsOrphaned());
 }
 
+TEST_F(XdsClientTest, UpdateWithUnchangedResourceBytes) {
+  InitXdsClient();
+  // Start a watch for "foo1".
+  auto watcher = StartFooWatch("foo1");
+  auto stream = WaitForAdsStream();
+  ASSERT_TRUE(stream != nullptr);
+  auto request = WaitForRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  // Send a response.
+  stream->SendMessageToClient(
+      ResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_version_info("1")
+          .set_nonce("A")
+          .AddFooResource(XdsFooResource("foo1", 6))
+          .Serialize());
+  auto resource = watcher->WaitForNextResource();
+  ASSERT_NE(resource, nullptr);
+  EXPECT_EQ(resource->value, 6);
+  request = WaitForRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckRequest(*request, XdsFooResourceType::Get()->type_url(),
+               /*version_info=*/"1", /*response_nonce=*/"A",
+               /*error_detail=*/absl::OkStatus(),
+               /*resource_names=*/{"foo1"});
+  // Server sends a new version with the same bytes, both with and
+  // without the Resource wrapper that carries the name.
+  time_cache_.TestOnlySetNow(kTime1);
+  stream->SendMessageToClient(
+      ResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_version_info("2")
+          .set_nonce("B")
+          .AddFooResource(XdsFooResource("foo1", 6),
+                          /*in_resource_wrapper=*/true)
+          .Serialize());
+  request = WaitForRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckRequest(*request, XdsFooResourceType::Get()->type_url(),
+               /*version_info=*/"2", /*response_nonce=*/"B",
+               /*error_detail=*/absl::OkStatus(),
+               /*resource_names=*/{"foo1"});
+  stream->SendMessageToClient(
+      ResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_version_info("3")
+          .set_nonce("C")
+          .AddFooResource(XdsFooResource("foo1", 6))
+          .Serialize());
+  request = WaitForRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckRequest(*request, XdsFooResourceType::Get()->type_url(),
+               /*version_info=*/"3", /*response_nonce=*/"C",
+               /*error_detail=*/absl::OkStatus(),
+               /*resource_names=*/{"foo1"});
+  // The watcher keeps the resource it already has, but CSDS shows the
+  // new version.
+  EXPECT_TRUE(watcher->ExpectNoEvent());
+  ClientConfig csds = DumpCsds();
+  EXPECT_THAT(csds.generic_xds_configs(),
+              ::testing::ElementsAre(CsdsResourceAcked(
+                  XdsFooResourceType::Get()->type_url(), "foo1",
+                  resource->AsJsonString(), "3", TimestampProtoEq(kTime1))));
+  // Changed bytes are still delivered.
+  stream->SendMessageToClient(
+      ResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_version_info("4")
+          .set_nonce("D")
+          .AddFooResource(XdsFooResource("foo1", 9))
+          .Serialize());
+  resource = watcher->WaitForNextResource();
+  ASSERT_NE(resource, nullptr);
+  EXPECT_EQ(resource->value, 9);
+  request = WaitForRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckRequest(*request, XdsFooResourceType::Get()->type_url(),
+               /*version_info=*/"4", /*response_nonce=*/"D",
+               /*error_detail=*/absl::OkStatus(),
+               /*resource_names=*/{"foo1"});
+  // Cancel watch.
+  CancelFooWatch(watcher.get(), "foo1");
+  EXPECT_TRUE(stream->IsOrphaned());
+}
+
+TEST_F(XdsClientTest, DeltaAds) {
+  InitXdsClient(FakeXdsBootstrap::Builder().SetServers(
+      {FakeXdsBootstrap::FakeXdsServer(
+          kDefaultXdsServerUrl, /*fail_on_data_errors=*/true,
+          /*resource_timer_is_transient_failure=*/false,
+          /*use_delta_ads=*/true)}));
+  // Start a watch for "foo1".
+  auto watcher = StartFooWatch("foo1");
+  // XdsClient should have created a delta ADS stream and subscribed.
+  auto stream = WaitForDeltaAdsStream();
+  ASSERT_TRUE(stream != nullptr);
+  auto request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  EXPECT_EQ(request->type_url(),
+            absl::StrCat("type.googleapis.com/",
+                         XdsFooResourceType::Get()->type_url()));
+  EXPECT_THAT(request->resource_names_subscribe(),
+              ::testing::ElementsAre("foo1"));
+  EXPECT_THAT(request->resource_names_unsubscribe(), ::testing::IsEmpty());
+  EXPECT_EQ(request->node().id(), "xds_client_test");
+  // Server sends the resource.
+  stream->SendMessageToClient(
+      MakeDeltaFooResponse("A", {{XdsFooResource("foo1", 6), "v1"}}));
+  auto resource = watcher->WaitForNextResource();
+  ASSERT_NE(resource, nullptr);
+  EXPECT_EQ(resource->value, 6);
+  // XdsClient should ACK without repeating the subscription.
+  request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  EXPECT_EQ(request->response_nonce(), "A");
+  EXPECT_FALSE(request->has_error_detail());
+  EXPECT_THAT(request->resource_names_subscribe(), ::testing::IsEmpty());
+  EXPECT_FALSE(request->has_node());
+  // CSDS shows the per-resource version.
+  ClientConfig csds = DumpCsds();
+  EXPECT_THAT(csds.generic_xds_configs(),
+              ::testing::ElementsAre(CsdsResourceAcked(
+                  XdsFooResourceType::Get()->type_url(), "foo1",
+                  resource->AsJsonString(), "v1", TimestampProtoEq(kTime0))));
+  // A second watch subscribes to just the new name.
+  auto watcher2 = StartFooWatch("foo2");
+  request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  EXPECT_THAT(request->resource_names_subscribe(),
+              ::testing::ElementsAre("foo2"));
+  EXPECT_THAT(request->resource_names_unsubscribe(), ::testing::IsEmpty());
+  // Server sends only foo2; foo1 is untouched.
+  stream->SendMessageToClient(
+      MakeDeltaFooResponse("B", {{XdsFooResource("foo2", 7), "v1"}}));
+  resource = watcher2->WaitForNextResource();
+  ASSERT_NE(resource, nullptr);
+  EXPECT_EQ(resource->value, 7);
+  EXPECT_TRUE(watcher->ExpectNoEvent());
+  request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  EXPECT_EQ(request->response_nonce(), "B");
+  // Server removes foo2.
+  stream->SendMessageToClient(MakeDeltaFooResponse("C", {}, {"foo2"}));
+  EXPECT_TRUE(watcher2->WaitForDoesNotExist());
+  EXPECT_TRUE(watcher->ExpectNoEvent());
+  request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  EXPECT_EQ(request->response_nonce(), "C");
+  // Cancelling the watch for foo2 unsubscribes from just that name.
+  CancelFooWatch(watcher2.get(), "foo2");
+  request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  EXPECT_THAT(request->resource_names_subscribe(), ::testing::IsEmpty());
+  EXPECT_THAT(request->resource_names_unsubscribe(),
+              ::testing::ElementsAre("foo2"));
+  // Cancel watch.
+  CancelFooWatch(watcher.get(), "foo1");
+  EXPECT_TRUE(stream->IsOrphaned());
+}
+
+TEST_F(XdsClientTest, DeltaAdsReportsCachedVersionsOnReconnect) {
+  InitXdsClient(FakeXdsBootstrap::Builder().SetServers(
+      {FakeXdsBootstrap::FakeXdsServer(
+          kDefaultXdsServerUrl, /*fail_on_data_errors=*/false,
+          /*resource_timer_is_transient_failure=*/false,
+          /*use_delta_ads=*/true)}));
+  auto watcher = StartFooWatch("foo1");
+  auto stream = WaitForDeltaAdsStream();
+  ASSERT_TRUE(stream != nullptr);
+  auto request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  EXPECT_THAT(request->initial_resource_versions(), ::testing::IsEmpty());
+  stream->SendMessageToClient(
+      MakeDeltaFooResponse("A", {{XdsFooResource("foo1", 6), "v1"}}));
+  auto resource = watcher->WaitForNextResource();
+  ASSERT_NE(resource, nullptr);
+  request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  // The stream fails, and XdsClient starts a new one.
+  stream->MaybeSendStatusToClient(absl::UnavailableError("ugh"));
+  stream = WaitForDeltaAdsStream();
+  ASSERT_TRUE(stream != nullptr);
+  // The first request on the new stream tells the server what we have.
+  request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  EXPECT_THAT(request->resource_names_subscribe(),
+              ::testing::ElementsAre("foo1"));
+  EXPECT_THAT(request->initial_resource_versions(),
+              ::testing::UnorderedElementsAre(::testing::Pair("foo1", "v1")));
+  // Cancel watch.
+  CancelFooWatch(watcher.get(), "foo1");
+  EXPECT_TRUE(stream->IsOrphaned());
+}
+
 TEST_F(XdsClientTest, MultipleWatchersForSameResource) {
   InitXdsClient();
   // Start a watch for "foo1".
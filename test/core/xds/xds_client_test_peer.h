@@ -19,8 +19,6 @@
 
 #include <grpc/support/port_platform.h>
 
-#include <set>
-
 #include "absl/functional/function_ref.h"
 #include "absl/strings/str_cat.h"
 #include "src/core/xds/xds_client/xds_client.h"
@@ -35,9 +33,11 @@ class XdsClientTestPeer {
   std::string TestDumpClientConfig() {
     upb::Arena arena;
     auto* client_config = envoy_service_status_v3_ClientConfig_new(arena.ptr());
-    std::set<std::string> string_pool;
-    MutexLock lock(xds_client_->mu());
-    xds_client_->DumpClientConfig(&string_pool, arena.ptr(), client_config);
+    XdsClient::ConfigDumpStorage storage;
+    {
+      MutexLock lock(xds_client_->mu());
+      xds_client_->DumpClientConfig(&storage, arena.ptr(), client_config);
+    }
     size_t output_length;
     char* output = envoy_service_status_v3_ClientConfig_serialize(
         client_config, arena.ptr(), &output_length);
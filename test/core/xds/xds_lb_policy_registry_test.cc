@@ -439,6 +439,86 @@ TEST(WrrLocality, UnsupportedChildPolicyTypeSkipped) {
             "\"childPolicy\":[{\"round_robin\":{}}]}}");
 }
 
+//
+// LeastRequest
+//
+
+TEST(LeastRequest, Basic) {
+  LoadBalancingPolicyProto policy;
+  auto* lb_policy = policy.add_policies();
+  lb_policy->mutable_typed_extension_config()
+      ->mutable_typed_config()
+      ->set_type_url(
+          "type.googleapis.com/"
+          "envoy.extensions.load_balancing_policies.least_request.v3."
+          "LeastRequest");
+  auto result = ConvertXdsPolicy(policy);
+  ASSERT_TRUE(result.ok()) << result.status();
+  EXPECT_EQ(*result, "{\"least_request\":{}}");
+}
+
+// There are no generated protos for LeastRequest, so these tests serialize
+// it by hand: choice_count is field 1, and active_request_bias field 2.
+std::string LeastRequestWithChoiceCount(uint32_t choice_count) {
+  google::protobuf::UInt32Value value;
+  value.set_value(choice_count);
+  std::string serialized_value = value.SerializeAsString();
+  // active_request_bias, which is skipped, then choice_count.
+  std::string serialized("\x12\x00", 2);
+  serialized += '\x0a';
+  serialized += static_cast<char>(serialized_value.size());
+  serialized += serialized_value;
+  return serialized;
+}
+
+void SetLeastRequest(LoadBalancingPolicyProto* policy,
+                     std::string serialized) {
+  auto* typed_config = policy->add_policies()
+                           ->mutable_typed_extension_config()
+                           ->mutable_typed_config();
+  typed_config->set_type_url(
+      "type.googleapis.com/"
+      "envoy.extensions.load_balancing_policies.least_request.v3."
+      "LeastRequest");
+  typed_config->set_value(std::move(serialized));
+}
+
+TEST(LeastRequest, ChoiceCount) {
+  LoadBalancingPolicyProto policy;
+  SetLeastRequest(&policy, LeastRequestWithChoiceCount(5));
+  auto result = ConvertXdsPolicy(policy);
+  ASSERT_TRUE(result.ok()) << result.status();
+  EXPECT_EQ(*result, "{\"least_request\":{\"choiceCount\":5}}");
+}
+
+TEST(LeastRequest, ChoiceCountTooSmall) {
+  LoadBalancingPolicyProto policy;
+  SetLeastRequest(&policy, LeastRequestWithChoiceCount(1));
+  auto result = ConvertXdsPolicy(policy);
+  EXPECT_EQ(result.status().code(), absl::StatusCode::kInvalidArgument);
+  EXPECT_EQ(result.status().message(),
+            "validation errors: ["
+            "field:load_balancing_policy.policies[0].typed_extension_config"
+            ".typed_config.value[envoy.extensions.load_balancing_policies"
+            ".least_request.v3.LeastRequest].choice_count "
+            "error:value must be at least 2]")
+      << result.status();
+}
+
+TEST(LeastRequest, Undecodable) {
+  LoadBalancingPolicyProto policy;
+  SetLeastRequest(&policy, std::string("\x0a\x05", 2));
+  auto result = ConvertXdsPolicy(policy);
+  EXPECT_EQ(result.status().code(), absl::StatusCode::kInvalidArgument);
+  EXPECT_EQ(result.status().message(),
+            "validation errors: ["
+            "field:load_balancing_policy.policies[0].typed_extension_config"
+            ".typed_config.value[envoy.extensions.load_balancing_policies"
+            ".least_request.v3.LeastRequest] "
+            "error:can't decode LeastRequest LB policy config]")
+      << result.status();
+}
+
 //
 // PickFirst
 //
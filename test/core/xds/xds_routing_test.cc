@@ -0,0 +1,214 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include "src/core/xds/grpc/xds_routing.h"
+
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "absl/log/check.h"
+#include "absl/strings/str_cat.h"
+#include "gtest/gtest.h"
+#include "src/core/call/metadata_batch.h"
+#include "src/core/util/matchers.h"
+#include "src/core/xds/grpc/xds_route_config.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+using Matchers = XdsRouteConfigResource::Route::Matchers;
+
+class VirtualHosts final : public XdsRouting::VirtualHostListIterator {
+ public:
+  explicit VirtualHosts(std::vector<std::vector<std::string>> domains)
+      : domains_(std::move(domains)) {}
+
+  size_t Size() const override { return domains_.size(); }
+  const std::vector<std::string>& GetDomainsForVirtualHost(
+      size_t index) const override {
+    return domains_[index];
+  }
+
+ private:
+  std::vector<std::vector<std::string>> domains_;
+};
+
+class Routes final : public XdsRouting::RouteListIterator {
+ public:
+  void Add(StringMatcher::Type type, absl::string_view path,
+           bool case_sensitive = true,
+           std::vector<HeaderMatcher> header_matchers = {},
+           std::optional<uint32_t> fraction_per_million = std::nullopt) {
+    auto path_matcher = StringMatcher::Create(type, path, case_sensitive);
+    CHECK(path_matcher.ok()) << path_matcher.status();
+    matchers_.push_back(Matchers{std::move(*path_matcher),
+                                 std::move(header_matchers),
+                                 fraction_per_million});
+  }
+
+  size_t Size() const override { return matchers_.size(); }
+  const Matchers& GetMatchersForRoute(size_t index) const override {
+    return matchers_[index];
+  }
+
+ private:
+  std::vector<Matchers> matchers_;
+};
+
+HeaderMatcher ExactHeader(absl::string_view name, absl::string_view value) {
+  auto matcher =
+      HeaderMatcher::Create(name, HeaderMatcher::Type::kExact, value);
+  CHECK(matcher.ok()) << matcher.status();
+  return std::move(*matcher);
+}
+
+// Checks that the compiled virtual host list agrees with
+// XdsRouting::FindVirtualHostForDomain() on every domain.
+void ExpectSameVirtualHosts(const VirtualHosts& virtual_hosts,
+                            const std::vector<std::string>& domains) {
+  XdsRouting::CompiledVirtualHostList compiled(virtual_hosts);
+  for (const std::string& domain : domains) {
+    EXPECT_EQ(compiled.FindVirtualHostForDomain(domain),
+              XdsRouting::FindVirtualHostForDomain(virtual_hosts, domain))
+        << domain;
+  }
+}
+
+// Checks that the compiled route list agrees with
+// XdsRouting::GetRouteForRequest() on every path.
+void ExpectSameRoutes(const Routes& routes,
+                      const std::vector<std::string>& paths,
+                      grpc_metadata_batch* metadata) {
+  XdsRouting::CompiledRouteList compiled(routes);
+  for (const std::string& path : paths) {
+    EXPECT_EQ(compiled.GetRouteForRequest(routes, path, metadata),
+              XdsRouting::GetRouteForRequest(routes, path, metadata))
+        << path;
+  }
+}
+
+TEST(CompiledVirtualHostListTest, MatchesReference) {
+  VirtualHosts virtual_hosts({
+      {"*.example.com", "foo.*"},
+      {"Bar.Example.Com"},
+      {"*.com"},
+      {"*"},
+      {"*.example.com", "bar.example.com"},
+      {"foo.bar*"},
+  });
+  ExpectSameVirtualHosts(
+      virtual_hosts, {"bar.example.com", "BAR.example.COM", "x.example.com",
+                      ".example.com", "example.com", "foo.bar.baz", "foo.",
+                      "foo.x", "a.com", ".com", "com", "other", ""});
+}
+
+TEST(CompiledVirtualHostListTest, NoUniverseMatch) {
+  VirtualHosts virtual_hosts({{"a.b"}, {"*b"}});
+  ExpectSameVirtualHosts(virtual_hosts, {"a.b", "xb", "b", "c"});
+  XdsRouting::CompiledVirtualHostList compiled(virtual_hosts);
+  EXPECT_EQ(compiled.FindVirtualHostForDomain("c"), std::nullopt);
+}
+
+TEST(CompiledRouteListTest, PathMatchersMatchReference) {
+  Routes routes;
+  routes.Add(StringMatcher::Type::kExact, "/svc.A/Get");
+  routes.Add(StringMatcher::Type::kPrefix, "/svc.A/");
+  routes.Add(StringMatcher::Type::kExact, "/SVC.B/get", false);
+  routes.Add(StringMatcher::Type::kSafeRegex, "/svc\\.B/.*");
+  routes.Add(StringMatcher::Type::kPrefix, "/svc.b/", false);
+  routes.Add(StringMatcher::Type::kSafeRegex, "/svc\\.[CD]/Put");
+  routes.Add(StringMatcher::Type::kPrefix, "/svc.C");
+  routes.Add(StringMatcher::Type::kPrefix, "");
+  grpc_metadata_batch metadata;
+  ExpectSameRoutes(routes,
+                   {"/svc.A/Get", "/svc.A/Put", "/svc.B/get", "/svc.b/GET",
+                    "/svc.B/Put", "/SVC.b/Put", "/svc.C/Put", "/svc.D/Put",
+                    "/svc.C/Get", "/svc.E/Get", ""},
+                   &metadata);
+}
+
+TEST(CompiledRouteListTest, HeaderAndFractionMatchersMatchReference) {
+  Routes routes;
+  routes.Add(StringMatcher::Type::kPrefix, "/", true,
+             {ExactHeader("x-route", "canary")});
+  routes.Add(StringMatcher::Type::kPrefix, "/svc.A/", true, {},
+             /*fraction_per_million=*/0);
+  routes.Add(StringMatcher::Type::kSafeRegex, "/svc\\.A/.*", true,
+             {ExactHeader("x-user", "alice")});
+  routes.Add(StringMatcher::Type::kExact, "/svc.A/Get", true, {},
+             /*fraction_per_million=*/1000000);
+  const std::vector<std::string> paths = {"/svc.A/Get", "/svc.A/Put",
+                                          "/svc.B/Get"};
+  grpc_metadata_batch metadata;
+  ExpectSameRoutes(routes, paths, &metadata);
+  metadata.Append("x-user", Slice::FromCopiedString("alice"),
+                  [](absl::string_view error, const Slice&) {
+                    FAIL() << error;
+                  });
+  ExpectSameRoutes(routes, paths, &metadata);
+  metadata.Append("x-route", Slice::FromCopiedString("canary"),
+                  [](absl::string_view error, const Slice&) {
+                    FAIL() << error;
+                  });
+  ExpectSameRoutes(routes, paths, &metadata);
+}
+
+TEST(CompiledRouteListTest, ManyRoutesMatchReference) {
+  std::mt19937 gen(1234);
+  Routes routes;
+  std::vector<std::string> paths;
+  for (int i = 0; i < 1000; ++i) {
+    const std::string service = absl::StrCat("/svc", gen() % 100, ".S");
+    const std::string path = absl::StrCat(service, "/M", gen() % 10);
+    paths.push_back(path);
+    switch (gen() % 4) {
+      case 0:
+        routes.Add(StringMatcher::Type::kExact, path, gen() % 2 == 0);
+        break;
+      case 1:
+        routes.Add(StringMatcher::Type::kPrefix, service + "/",
+                   gen() % 2 == 0);
+        break;
+      case 2:
+        routes.Add(StringMatcher::Type::kSafeRegex,
+                   absl::StrCat(service, "/M[0-", gen() % 10, "]"));
+        break;
+      default:
+        routes.Add(StringMatcher::Type::kPrefix, service);
+        break;
+    }
+  }
+  paths.push_back("/svc1.s/M1");
+  paths.push_back("/unknown/M1");
+  grpc_metadata_batch metadata;
+  ExpectSameRoutes(routes, paths, &metadata);
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -705,6 +705,42 @@ class LoggingInterceptorFactory
   }
 };
 
+// Declares interest only in POST_RECV_STATUS, and counts the batches it is
+// invoked for.
+class StatusOnlyInterceptor : public experimental::Interceptor {
+ public:
+  explicit StatusOnlyInterceptor(experimental::ClientRpcInfo* /*info*/) {}
+
+  uint32_t InterceptionHookPointMask() const override {
+    return experimental::InterceptionHookPointBit(
+        experimental::InterceptionHookPoints::POST_RECV_STATUS);
+  }
+
+  void Intercept(experimental::InterceptorBatchMethods* methods) override {
+    EXPECT_TRUE(methods->QueryInterceptionHookPoint(
+        experimental::InterceptionHookPoints::POST_RECV_STATUS));
+    num_times_run_++;
+    methods->Proceed();
+  }
+
+  static void Reset() { num_times_run_.store(0); }
+  static int GetNumTimesRun() { return num_times_run_.load(); }
+
+ private:
+  static std::atomic<int> num_times_run_;
+};
+
+std::atomic<int> StatusOnlyInterceptor::num_times_run_;
+
+class StatusOnlyInterceptorFactory
+    : public experimental::ClientInterceptorFactoryInterface {
+ public:
+  experimental::Interceptor* CreateClientInterceptor(
+      experimental::ClientRpcInfo* info) override {
+    return new StatusOnlyInterceptor(info);
+  }
+};
+
 class TestScenario {
  public:
   explicit TestScenario(const ChannelType& channel_type,
@@ -1053,6 +1089,41 @@ TEST_F(ClientInterceptorsStreamingEnd2endTest, ClientStreamingTest) {
   EXPECT_EQ(PhonyInterceptor::GetNumTimesRun(), 20);
 }
 
+TEST_F(ClientInterceptorsStreamingEnd2endTest,
+       InterceptorOnlySeesRequestedHookPoints) {
+  ChannelArguments args;
+  StatusOnlyInterceptor::Reset();
+  std::vector<std::unique_ptr<experimental::ClientInterceptorFactoryInterface>>
+      creators;
+  creators.push_back(std::make_unique<StatusOnlyInterceptorFactory>());
+  auto channel = experimental::CreateCustomChannelWithInterceptors(
+      server_address_, InsecureChannelCredentials(), args, std::move(creators));
+  MakeClientStreamingCall(channel);
+  // Only the results of the Finish batch carry POST_RECV_STATUS.
+  EXPECT_EQ(StatusOnlyInterceptor::GetNumTimesRun(), 1);
+}
+
+TEST_F(ClientInterceptorsStreamingEnd2endTest,
+       UninterestedInterceptorIsSkippedInTheChain) {
+  ChannelArguments args;
+  PhonyInterceptor::Reset();
+  StatusOnlyInterceptor::Reset();
+  std::vector<std::unique_ptr<experimental::ClientInterceptorFactoryInterface>>
+      creators;
+  creators.push_back(std::make_unique<StatusOnlyInterceptorFactory>());
+  creators.push_back(std::make_unique<LoggingInterceptorFactory>());
+  for (auto i = 0; i < 20; i++) {
+    creators.push_back(std::make_unique<PhonyInterceptorFactory>());
+  }
+  creators.push_back(std::make_unique<StatusOnlyInterceptorFactory>());
+  auto channel = experimental::CreateCustomChannelWithInterceptors(
+      server_address_, InsecureChannelCredentials(), args, std::move(creators));
+  MakeClientStreamingCall(channel);
+  LoggingInterceptor::VerifyClientStreamingCall();
+  EXPECT_EQ(PhonyInterceptor::GetNumTimesRun(), 20);
+  EXPECT_EQ(StatusOnlyInterceptor::GetNumTimesRun(), 2);
+}
+
 TEST_F(ClientInterceptorsStreamingEnd2endTest, ServerStreamingTest) {
   ChannelArguments args;
   PhonyInterceptor::Reset();
@@ -914,6 +914,37 @@ TEST_F(PickFirstTest, Basic) {
   EXPECT_EQ("pick_first", channel->GetLoadBalancingPolicyName());
 }
 
+TEST_F(PickFirstTest, PoolsConnectionsWhenSaturated) {
+  StartServers(1);
+  FakeResolverResponseGeneratorWrapper response_generator;
+  ChannelArguments args;
+  args.SetInt(GRPC_ARG_MAX_CONNECTIONS_PER_SUBCHANNEL, 2);
+  args.SetInt(GRPC_ARG_SUBCHANNEL_MAX_CALLS_PER_CONNECTION, 1);
+  auto channel = BuildChannel("", response_generator, args);
+  auto stub = BuildStub(channel);
+  response_generator.SetNextResolution(GetServersPorts());
+  CheckRpcSendOk(DEBUG_LOCATION, stub, /*wait_for_ready=*/true);
+  EXPECT_EQ(servers_[0]->service_.clients().size(), 1);
+  // Keep a call in flight on the first connection, saturating it.
+  std::thread slow_call([&]() {
+    EchoRequest request;
+    request.mutable_param()->set_server_sleep_us(5 * 1000 * 1000);
+    Status status = SendRpc(stub, /*response=*/nullptr, /*timeout_ms=*/30000,
+                            /*wait_for_ready=*/false, &request);
+    EXPECT_TRUE(status.ok()) << status.error_message();
+  });
+  while (servers_[0]->service_.request_count() < 2) {
+    absl::SleepFor(absl::Milliseconds(10));
+  }
+  // Calls made meanwhile open a second connection, and then use it.
+  SendRpcsUntil(DEBUG_LOCATION, stub, [&](const Status& status) {
+    EXPECT_TRUE(status.ok()) << status.error_message();
+    return servers_[0]->service_.clients().size() < 2;
+  });
+  slow_call.join();
+  EXPECT_EQ(servers_[0]->service_.clients().size(), 2);
+}
+
 TEST_F(PickFirstTest, ProcessPending) {
   StartServers(1);  // Single server
   FakeResolverResponseGeneratorWrapper response_generator;
@@ -1118,6 +1149,33 @@ TEST_F(ClientLbEnd2endTest,
   EXPECT_LT(waited.millis(), 1000 * grpc_test_slowdown_factor());
 }
 
+TEST_F(PickFirstTest, WarmupChannels) {
+  StartServers(2);
+  std::vector<FakeResolverResponseGeneratorWrapper> response_generators(3);
+  std::vector<std::shared_ptr<Channel>> channels;
+  for (const auto& response_generator : response_generators) {
+    channels.push_back(BuildChannel("pick_first", response_generator));
+  }
+  response_generators[0].SetNextResolution(GetServersPorts(0, 1));
+  response_generators[1].SetNextResolution(GetServersPorts(1, 2));
+  // The last channel won't become connected (there's no server).
+  response_generators[2].SetNextResolution({grpc_pick_unused_port_or_die()});
+  experimental::ChannelWarmupOptions options;
+  options.max_concurrent_connects = 1;
+  options.target_ready_fraction = 0.5;
+  EXPECT_TRUE(experimental::WarmupChannels(
+      channels, options, grpc_timeout_seconds_to_deadline(10)));
+  int num_ready = 0;
+  for (const auto& channel : channels) {
+    if (channel->GetState(false) == GRPC_CHANNEL_READY) ++num_ready;
+  }
+  EXPECT_GE(num_ready, 2);
+  options.target_ready_fraction = 1.0;
+  EXPECT_FALSE(experimental::WarmupChannels(
+      channels, options, grpc_timeout_milliseconds_to_deadline(500)));
+  EXPECT_NE(channels[2]->GetState(false), GRPC_CHANNEL_READY);
+}
+
 TEST_F(PickFirstTest, Updates) {
   // Start servers and send one RPC per server.
   const int kNumServers = 3;
@@ -2295,6 +2353,31 @@ TEST_F(RoundRobinTest, HealthCheckingRetryOnStreamEnd) {
   EXPECT_GT(servers_[1]->noop_health_check_service_impl_.request_count(), 1);
 }
 
+TEST_F(RoundRobinTest, HealthCheckingNotSampled) {
+  // Start servers.
+  const int kNumServers = 2;
+  CreateServers(kNumServers);
+  EnableNoopHealthCheckService();
+  StartServer(0);
+  StartServer(1);
+  ChannelArguments args;
+  // Create a channel with health-checking enabled, but with no subchannels
+  // sampled for health checking.
+  args.SetServiceConfigJSON(
+      "{\"healthCheckConfig\": "
+      "{\"serviceName\": \"health_check_service_name\"}}");
+  args.SetInt(GRPC_ARG_HEALTH_CHECK_SAMPLE_PERCENT, 0);
+  FakeResolverResponseGeneratorWrapper response_generator;
+  auto channel = BuildChannel("round_robin", response_generator, args);
+  auto stub = BuildStub(channel);
+  response_generator.SetNextResolution(GetServersPorts());
+  // The channel becomes READY without health checking any backend.
+  WaitForServers(DEBUG_LOCATION, stub);
+  EXPECT_TRUE(WaitForChannelReady(channel.get()));
+  EXPECT_EQ(servers_[0]->noop_health_check_service_impl_.request_count(), 0);
+  EXPECT_EQ(servers_[1]->noop_health_check_service_impl_.request_count(), 0);
+}
+
 //
 // LB policy pick args
 //
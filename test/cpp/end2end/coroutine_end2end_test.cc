@@ -0,0 +1,198 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include <grpcpp/support/coroutine.h>
+
+#include "gtest/gtest.h"
+#include "test/core/test_util/test_config.h"
+
+#if defined(__cpp_impl_coroutine) && __cplusplus >= 202002L
+
+#include <grpcpp/channel.h>
+#include <grpcpp/client_context.h>
+#include <grpcpp/create_channel.h>
+#include <grpcpp/server.h>
+#include <grpcpp/server_builder.h>
+#include <grpcpp/server_context.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "absl/strings/str_cat.h"
+#include "absl/synchronization/notification.h"
+#include "src/proto/grpc/testing/echo.grpc.pb.h"
+#include "test/core/test_util/port.h"
+
+namespace grpc {
+namespace testing {
+namespace {
+
+using experimental::Task;
+
+constexpr int kNumMessages = 10;
+
+class CoroutineEchoService : public EchoTestService::CallbackService {
+ public:
+  ServerUnaryReactor* Echo(CallbackServerContext* context,
+                           const EchoRequest* request,
+                           EchoResponse* response) override {
+    return experimental::RunUnaryCoroutine(context,
+                                           HandleEcho(request, response));
+  }
+
+  // The bodies of the streaming handlers keep their state in the lambda's
+  // captures, which must stay alive for as long as the coroutine runs.
+  ServerWriteReactor<EchoResponse>* ResponseStream(
+      CallbackServerContext* /*context*/, const EchoRequest* request) override {
+    return new experimental::ServerWriterCoroutine<EchoResponse>(
+        [request, response = EchoResponse()](
+            auto& reactor) mutable -> Task<Status> {
+          for (int i = 0; i < kNumMessages; ++i) {
+            response.set_message(absl::StrCat(request->message(), i));
+            if (!co_await reactor.Write(&response)) {
+              co_return Status(StatusCode::CANCELLED, "Write failed");
+            }
+          }
+          co_return Status::OK;
+        });
+  }
+
+  ServerReadReactor<EchoRequest>* RequestStream(
+      CallbackServerContext* /*context*/, EchoResponse* response) override {
+    return new experimental::ServerReaderCoroutine<EchoRequest>(
+        [response, request = EchoRequest(), received = std::string()](
+            auto& reactor) mutable -> Task<Status> {
+          while (co_await reactor.Read(&request)) {
+            received += request.message();
+          }
+          response->set_message(received);
+          co_return Status::OK;
+        });
+  }
+
+ private:
+  static Task<Status> HandleEcho(const EchoRequest* request,
+                                 EchoResponse* response) {
+    response->set_message(request->message());
+    co_return Status::OK;
+  }
+};
+
+// Runs a client coroutine to completion from the test thread.
+Status RunToCompletion(Task<Status> task) {
+  Status status;
+  absl::Notification done;
+  experimental::internal::Detach(std::move(task), [&](Status s) {
+    status = std::move(s);
+    done.Notify();
+  });
+  done.WaitForNotification();
+  return status;
+}
+
+class CoroutineEnd2endTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    std::string server_address =
+        absl::StrCat("localhost:", grpc_pick_unused_port_or_die());
+    ServerBuilder builder;
+    builder.AddListeningPort(server_address, InsecureServerCredentials());
+    builder.RegisterService(&service_);
+    server_ = builder.BuildAndStart();
+    stub_ = EchoTestService::NewStub(
+        CreateChannel(server_address, InsecureChannelCredentials()));
+  }
+
+  void TearDown() override { server_->Shutdown(); }
+
+  CoroutineEchoService service_;
+  std::unique_ptr<Server> server_;
+  std::unique_ptr<EchoTestService::Stub> stub_;
+};
+
+TEST_F(CoroutineEnd2endTest, Unary) {
+  ClientContext context;
+  EchoRequest request;
+  EchoResponse response;
+  request.set_message("hello");
+  auto call = [&]() -> Task<Status> {
+    co_return co_await experimental::UnaryCall(
+        [&](std::function<void(Status)> done) {
+          stub_->async()->Echo(&context, &request, &response, std::move(done));
+        });
+  };
+  Status status = RunToCompletion(call());
+  EXPECT_TRUE(status.ok()) << status.error_message();
+  EXPECT_EQ(response.message(), "hello");
+}
+
+TEST_F(CoroutineEnd2endTest, ServerStreaming) {
+  ClientContext context;
+  EchoRequest request;
+  request.set_message("hello");
+  std::vector<std::string> received;
+  auto call = [&]() -> Task<Status> {
+    experimental::ClientReaderCoroutine<EchoResponse> reader;
+    stub_->async()->ResponseStream(&context, &request, &reader);
+    EchoResponse response;
+    while (co_await reader.Read(&response)) {
+      received.push_back(response.message());
+    }
+    co_return co_await reader.Finish();
+  };
+  Status status = RunToCompletion(call());
+  EXPECT_TRUE(status.ok()) << status.error_message();
+  ASSERT_EQ(received.size(), static_cast<size_t>(kNumMessages));
+  for (int i = 0; i < kNumMessages; ++i) {
+    EXPECT_EQ(received[i], absl::StrCat("hello", i));
+  }
+}
+
+TEST_F(CoroutineEnd2endTest, ClientStreaming) {
+  ClientContext context;
+  EchoResponse response;
+  std::string sent;
+  auto call = [&]() -> Task<Status> {
+    experimental::ClientWriterCoroutine<EchoRequest> writer;
+    stub_->async()->RequestStream(&context, &response, &writer);
+    EchoRequest request;
+    for (int i = 0; i < kNumMessages; ++i) {
+      request.set_message(absl::StrCat(i));
+      sent += request.message();
+      if (!co_await writer.Write(&request)) break;
+    }
+    co_await writer.WritesDone();
+    co_return co_await writer.Finish();
+  };
+  Status status = RunToCompletion(call());
+  EXPECT_TRUE(status.ok()) << status.error_message();
+  EXPECT_EQ(response.message(), sent);
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc
+
+#endif  // defined(__cpp_impl_coroutine) && __cplusplus >= 202002L
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
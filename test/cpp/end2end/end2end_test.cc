@@ -22,6 +22,7 @@
 #include <grpcpp/channel.h>
 #include <grpcpp/client_context.h>
 #include <grpcpp/create_channel.h>
+#include <grpcpp/impl/message_object.h>
 #include <grpcpp/resource_quota.h>
 #include <grpcpp/security/auth_metadata_processor.h>
 #include <grpcpp/security/credentials.h>
@@ -34,6 +35,7 @@
 
 #include <mutex>
 #include <thread>
+#include <vector>
 
 #include "absl/log/check.h"
 #include "absl/log/log.h"
@@ -413,6 +415,9 @@ class End2endTest : public ::testing::TestWithParam<TestScenario> {
       args.SetUserAgentPrefix(user_agent_prefix_);
     }
     args.SetString(GRPC_ARG_SECONDARY_USER_AGENT_STRING, "end2end_test");
+    if (pass_message_objects_) {
+      args.SetInt(GRPC_ARG_INPROC_PASS_MESSAGE_OBJECTS, 1);
+    }
 
     if (!GetParam().inproc()) {
       if (!GetParam().use_interceptors()) {
@@ -477,6 +482,7 @@ class End2endTest : public ::testing::TestWithParam<TestScenario> {
   TestServiceImpl special_service_;
   TestServiceImplDupPkg dup_pkg_service_;
   std::string user_agent_prefix_;
+  bool pass_message_objects_ = false;
   int first_picked_port_;
 };
 
@@ -926,6 +932,67 @@ TEST_P(End2endTest, ReconnectChannel) {
   SendRpc(stub_.get(), 1, false);
 }
 
+TEST_P(End2endTest, InprocPassMessageObjects) {
+  if (!GetParam().inproc()) {
+    return;
+  }
+  pass_message_objects_ = true;
+  ResetStub();
+  const size_t num_moved = internal::MessageObject::NumMovedForTesting();
+  SendRpc(stub_.get(), 10, false);
+
+  EchoRequest request;
+  EchoResponse response;
+  ClientContext context;
+  auto stream = stub_->RequestStream(&context, &response);
+  request.set_message("hello");
+  EXPECT_TRUE(stream->Write(request));
+  EXPECT_TRUE(stream->Write(request));
+  stream->WritesDone();
+  Status s = stream->Finish();
+  EXPECT_EQ(response.message(), request.message() + request.message());
+  EXPECT_TRUE(s.ok());
+  // Every request reached the server as an object, without being serialized.
+  EXPECT_EQ(internal::MessageObject::NumMovedForTesting() - num_moved, 12u);
+}
+
+// Reads every outgoing message in serialized form.
+class SerializingInterceptor : public experimental::Interceptor {
+ public:
+  void Intercept(experimental::InterceptorBatchMethods* methods) override {
+    if (methods->QueryInterceptionHookPoint(
+            experimental::InterceptionHookPoints::PRE_SEND_MESSAGE)) {
+      EXPECT_NE(methods->GetSerializedSendMessage(), nullptr);
+    }
+    methods->Proceed();
+  }
+};
+
+class SerializingInterceptorFactory
+    : public experimental::ClientInterceptorFactoryInterface {
+ public:
+  experimental::Interceptor* CreateClientInterceptor(
+      experimental::ClientRpcInfo* /*info*/) override {
+    return new SerializingInterceptor();
+  }
+};
+
+TEST_P(End2endTest, InprocPassMessageObjectsSerializedByInterceptor) {
+  if (!GetParam().inproc() || !GetParam().use_interceptors()) {
+    return;
+  }
+  pass_message_objects_ = true;
+  std::vector<std::unique_ptr<experimental::ClientInterceptorFactoryInterface>>
+      creators;
+  creators.push_back(std::make_unique<SerializingInterceptorFactory>());
+  ResetStub(std::move(creators));
+  const size_t num_moved = internal::MessageObject::NumMovedForTesting();
+  SendRpc(stub_.get(), 10, false);
+  // Once an interceptor has asked for the bytes, the messages travel
+  // serialized.
+  EXPECT_EQ(internal::MessageObject::NumMovedForTesting(), num_moved);
+}
+
 TEST_P(End2endTest, RequestStreamOneRequest) {
   ResetStub();
   EchoRequest request;
@@ -1005,6 +1072,24 @@ TEST_P(End2endTest, RequestStreamTwoRequestsWithCoalescingApi) {
   EXPECT_TRUE(s.ok());
 }
 
+TEST_P(End2endTest, RequestStreamWithWriteBatch) {
+  ResetStub();
+  std::vector<EchoRequest> requests(3);
+  requests[0].set_message("a");
+  requests[1].set_message("b");
+  requests[2].set_message("c");
+  EchoResponse response;
+  ClientContext context;
+
+  auto stream = stub_->RequestStream(&context, &response);
+  EXPECT_TRUE(stream->WriteBatch(requests.begin(), requests.end()));
+  EXPECT_TRUE(stream->WriteBatch(requests.begin(), requests.end(),
+                                 WriteOptions().set_last_message()));
+  Status s = stream->Finish();
+  EXPECT_EQ(response.message(), "abcabc");
+  EXPECT_TRUE(s.ok());
+}
+
 TEST_P(End2endTest, ResponseStream) {
   ResetStub();
   EchoRequest request;
@@ -23,6 +23,7 @@
 #include <grpcpp/server.h>
 #include <grpcpp/server_builder.h>
 #include <grpcpp/server_context.h>
+#include <grpcpp/support/arena_message_allocator.h>
 #include <grpcpp/support/client_callback.h>
 #include <grpcpp/support/message_allocator.h>
 
@@ -350,6 +351,26 @@ TEST_P(ArenaAllocatorTest, SimpleRpc) {
   EXPECT_EQ(kRpcCount, allocator->allocation_count);
 }
 
+class BuiltinArenaAllocatorTest : public MessageAllocatorEnd2endTestBase {};
+
+TEST_P(BuiltinArenaAllocatorTest, SimpleRpc) {
+  const int kRpcCount = 10;
+  ArenaMessageAllocator<EchoRequest, EchoResponse> allocator;
+  std::atomic_int rpcs_on_arena{0};
+  auto mutator = [&rpcs_on_arena](RpcAllocatorState* /*allocator_state*/,
+                                  const EchoRequest* req, EchoResponse* resp) {
+    if (req->GetArena() != nullptr && req->GetArena() == resp->GetArena()) {
+      rpcs_on_arena++;
+    }
+  };
+  callback_service_.SetAllocatorMutator(mutator);
+  CreateServer(&allocator);
+  ResetStub();
+  SendRpcs(kRpcCount);
+  DestroyServer();
+  EXPECT_EQ(kRpcCount, rpcs_on_arena);
+}
+
 std::vector<TestScenario> CreateTestScenarios(bool test_insecure) {
   std::vector<TestScenario> scenarios;
   std::vector<std::string> credentials_types{
@@ -385,6 +406,8 @@ INSTANTIATE_TEST_SUITE_P(SimpleAllocatorTest, SimpleAllocatorTest,
                          ::testing::ValuesIn(CreateTestScenarios(true)));
 INSTANTIATE_TEST_SUITE_P(ArenaAllocatorTest, ArenaAllocatorTest,
                          ::testing::ValuesIn(CreateTestScenarios(true)));
+INSTANTIATE_TEST_SUITE_P(BuiltinArenaAllocatorTest, BuiltinArenaAllocatorTest,
+                         ::testing::ValuesIn(CreateTestScenarios(true)));
 
 }  // namespace
 }  // namespace testing
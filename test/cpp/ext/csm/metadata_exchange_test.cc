@@ -558,6 +558,44 @@ TEST(MeshLabelsIterableTest, TestResetIteratorPosition) {
   EXPECT_THAT(labels, expected_labels_matcher) << PrettyPrintLabels(labels);
 }
 
+TEST(ServiceMeshLabelsInjectorTest, RepeatedPeerMetadata) {
+  grpc::internal::ServiceMeshLabelsInjector injector(
+      TestGceResource().GetAttributes());
+  grpc_core::Slice remote_metadata =
+      RemoteMetadataSliceFromResource(TestGkeResource());
+  std::vector<std::unique_ptr<grpc::internal::LabelsIterable>> iterables;
+  std::vector<std::pair<absl::string_view, absl::string_view>> first_labels;
+  // The second call is served from the injector's cache of decoded labels.
+  for (int i = 0; i < 2; ++i) {
+    grpc_metadata_batch metadata;
+    metadata.Set(grpc_core::XEnvoyPeerMetadata(), remote_metadata.Ref());
+    iterables.push_back(injector.GetLabels(&metadata));
+    auto* mesh_iterable =
+        static_cast<grpc::internal::MeshLabelsIterable*>(
+            iterables.back().get());
+    EXPECT_TRUE(mesh_iterable->GotRemoteLabels());
+    auto labels = LabelsFromIterable(mesh_iterable);
+    EXPECT_THAT(labels, ::testing::Contains(Pair("csm.remote_workload_type",
+                                                 "gcp_kubernetes_engine")))
+        << PrettyPrintLabels(labels);
+    if (i == 0) {
+      first_labels = labels;
+    } else {
+      EXPECT_EQ(labels, first_labels) << PrettyPrintLabels(labels);
+    }
+  }
+  // An invalid value yields no remote labels, each time.
+  for (int i = 0; i < 2; ++i) {
+    grpc_metadata_batch metadata;
+    metadata.Set(grpc_core::XEnvoyPeerMetadata(),
+                 grpc_core::Slice::FromStaticString("not base64!"));
+    auto iterable = injector.GetLabels(&metadata);
+    EXPECT_FALSE(static_cast<grpc::internal::MeshLabelsIterable*>(
+                     iterable.get())
+                     ->GotRemoteLabels());
+  }
+}
+
 INSTANTIATE_TEST_SUITE_P(
     MetadataExchange, MetadataExchangeTest,
     ::testing::Values(TestScenario(TestScenario::ResourceType::kGke),
@@ -47,17 +47,11 @@ BENCHMARK(BM_Alarm_Tag_Immediate);
 }  // namespace testing
 }  // namespace grpc
 
-// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
-// and others do not. This allows us to support both modes.
-namespace benchmark {
-void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
-}  // namespace benchmark
-
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(&argc, argv);
   LibraryInitializer libInit;
   ::benchmark::Initialize(&argc, argv);
   grpc::testing::InitTest(&argc, &argv, false);
-  benchmark::RunTheBenchmarksNamespaced();
+  grpc::testing::RunBenchmarks();
   return 0;
 }
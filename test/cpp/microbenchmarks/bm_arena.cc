@@ -20,6 +20,7 @@
 
 #include <benchmark/benchmark.h>
 
+#include "src/core/call/call_arena_allocator.h"
 #include "src/core/lib/resource_quota/arena.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
 #include "test/core/test_util/test_config.h"
@@ -92,16 +93,31 @@ static void BM_Arena_NewDeleteComparison_Small(benchmark::State& state) {
 }
 BENCHMARK(BM_Arena_NewDeleteComparison_Small);
 
-// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
-// and others do not. This allows us to support both modes.
-namespace benchmark {
-void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
-}  // namespace benchmark
+// Mimic the life of a call: make an arena sized by the call allocator, fill
+// it with a few allocations and pooled objects, then destroy it.
+static void BM_Arena_CallLifecycle(benchmark::State& state) {
+  auto allocator = grpc_core::MakeRefCounted<grpc_core::CallArenaAllocator>(
+      grpc_core::ResourceQuota::Default()
+          ->memory_quota()
+          ->CreateMemoryAllocator("bm-call-arena"),
+      1024);
+  for (auto _ : state) {
+    auto arena = allocator->MakeArena();
+    for (int i = 0; i < state.range(0); i++) {
+      benchmark::DoNotOptimize(arena->Alloc(64));
+    }
+    auto x = arena->MakePooled<TestThingToAllocate>();
+    auto y = arena->MakePooled<TestThingToAllocate>();
+    benchmark::DoNotOptimize(x.get());
+    benchmark::DoNotOptimize(y.get());
+  }
+}
+BENCHMARK(BM_Arena_CallLifecycle)->Range(1, 256);
 
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(&argc, argv);
   ::benchmark::Initialize(&argc, argv);
   grpc::testing::InitTest(&argc, &argv, false);
-  benchmark::RunTheBenchmarksNamespaced();
+  grpc::testing::RunBenchmarks();
   return 0;
 }
@@ -26,8 +26,11 @@
 #include <grpcpp/support/byte_buffer.h>
 
 #include <memory>
+#include <string>
 
 #include "absl/log/check.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/slice/slice_buffer.h"
 #include "test/core/test_util/test_config.h"
 #include "test/cpp/microbenchmarks/helpers.h"
 #include "test/cpp/util/test_config.h"
@@ -108,21 +111,57 @@ static void BM_ByteBufferReader_Peek(benchmark::State& state) {
 }
 BENCHMARK(BM_ByteBufferReader_Peek)->Ranges({{64 * 1024, 1024 * 1024}});
 
+// chttp2 framing: a frame header followed by a payload slice, appended for
+// each frame of a message, then drained slice by slice by the writer.
+static void BM_SliceBuffer_AppendTakeFirst(benchmark::State& state) {
+  const int num_frames = state.range(0);
+  constexpr size_t kFrameHeaderSize = 9;
+  constexpr size_t kPayloadSize = 16384;
+  grpc_core::Slice payload =
+      grpc_core::Slice::FromCopiedString(std::string(kPayloadSize, 'a'));
+  const uint8_t header[kFrameHeaderSize] = {};
+  for (auto _ : state) {
+    grpc_core::SliceBuffer buffer;
+    for (int i = 0; i < num_frames; ++i) {
+      buffer.Append(grpc_core::Slice::FromCopiedBuffer(header, sizeof(header)));
+      buffer.Append(payload.Ref());
+    }
+    while (buffer.Count() > 0) {
+      benchmark::DoNotOptimize(buffer.TakeFirst());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * num_frames);
+}
+BENCHMARK(BM_SliceBuffer_AppendTakeFirst)->Range(1, 256);
+
+// Small metadata values parsed out of a larger read buffer.
+static void BM_Slice_SmallSubSlices(benchmark::State& state) {
+  const size_t value_size = state.range(0);
+  grpc_core::Slice read_buffer =
+      grpc_core::Slice::FromCopiedString(std::string(8192, 'v'));
+  const grpc_slice& backing = read_buffer.c_slice();
+  const uint8_t* begin = GRPC_SLICE_START_PTR(backing);
+  for (auto _ : state) {
+    grpc_core::SliceBuffer values;
+    for (size_t offset = 0; offset + value_size <= 4096;
+         offset += value_size) {
+      values.Append(grpc_core::Slice::FromRefcountAndBytes(
+          backing.refcount, begin + offset, begin + offset + value_size));
+    }
+    benchmark::DoNotOptimize(values.Length());
+  }
+}
+BENCHMARK(BM_Slice_SmallSubSlices)->Arg(8)->Arg(16)->Arg(64);
+
 }  // namespace testing
 }  // namespace grpc
 
-// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
-// and others do not. This allows us to support both modes.
-namespace benchmark {
-void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
-}  // namespace benchmark
-
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(&argc, argv);
   LibraryInitializer libInit;
   ::benchmark::Initialize(&argc, argv);
   grpc::testing::InitTest(&argc, &argv, false);
 
-  benchmark::RunTheBenchmarksNamespaced();
+  grpc::testing::RunBenchmarks();
   return 0;
 }
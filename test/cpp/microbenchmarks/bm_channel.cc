@@ -23,6 +23,17 @@
 #include <grpc/grpc.h>
 #include <grpc/grpc_security.h>
 
+#include "absl/log/check.h"
+#include "absl/strings/string_view.h"
+#include "src/core/call/call_arena_allocator.h"
+#include "src/core/call/call_filters.h"
+#include "src/core/call/filter_fusion.h"
+#include "src/core/call/metadata.h"
+#include "src/core/ext/filters/http/client/http_client_filter.h"
+#include "src/core/ext/filters/http/message_compress/compression_filter.h"
+#include "src/core/ext/filters/message_size/message_size_filter.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/lib/transport/transport.h"
 #include "test/core/test_util/test_config.h"
 #include "test/cpp/microbenchmarks/helpers.h"
 #include "test/cpp/util/test_config.h"
@@ -80,17 +91,103 @@ BENCHMARK_TEMPLATE(BM_InsecureChannelCreateDestroy, LameChannelFixture)
     ->Range(0, 512);
 ;
 
-// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
-// and others do not. This allows us to support both modes.
-namespace benchmark {
-void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
-}  // namespace benchmark
+namespace grpc_core {
+namespace {
+
+class FakeHttpTransport final : public Transport {
+ public:
+  FilterStackTransport* filter_stack_transport() override { return nullptr; }
+  ClientTransport* client_transport() override { return nullptr; }
+  ServerTransport* server_transport() override { return nullptr; }
+  absl::string_view GetTransportName() const override { return "fake-http"; }
+  void SetPollset(grpc_stream*, grpc_pollset*) override {}
+  void SetPollsetSet(grpc_stream*, grpc_pollset_set*) override {}
+  void PerformOp(grpc_transport_op*) override {}
+  void Orphan() override {}
+  RefCountedPtr<channelz::SocketNode> GetSocketNode() const override {
+    return nullptr;
+  }
+};
+
+template <typename Filter>
+void AddFilter(const ChannelArgs& args, CallFilters::StackBuilder& builder) {
+  auto filter = Filter::Create(args, ChannelFilter::Args{});
+  CHECK(filter.ok());
+  builder.Add(filter->get());
+  builder.AddOwnedObject(std::move(*filter));
+}
+
+// The default client filters, added one by one as ChannelInit does without
+// fusion...
+template <typename... Filters>
+struct SeparateFilters {
+  static void AddTo(const ChannelArgs& args,
+                    CallFilters::StackBuilder& builder) {
+    (AddFilter<Filters>(args, builder), ...);
+  }
+};
+
+// ... and as a single fused filter.
+template <typename... Filters>
+struct FusedFilters {
+  static void AddTo(const ChannelArgs& args,
+                    CallFilters::StackBuilder& builder) {
+    AddFilter<FusedFilter<Filters...>>(args, builder);
+  }
+};
+
+using DynamicClientStack =
+    SeparateFilters<ClientMessageSizeFilter, HttpClientFilter,
+                    ClientCompressionFilter>;
+using FusedClientStack = FusedFilters<ClientMessageSizeFilter, HttpClientFilter,
+                                      ClientCompressionFilter>;
+
+ServerMetadataHandle MakeServerMetadata() {
+  auto md = Arena::MakePooledForOverwrite<ServerMetadata>();
+  md->Set(HttpStatusMetadata(), 200);
+  return md;
+}
+
+// Run the metadata of a call through the client filter stack.
+template <typename Stack>
+void BM_ClientFilterStackMetadata(benchmark::State& state) {
+  FakeHttpTransport transport;
+  const ChannelArgs args = ChannelArgs().SetObject(&transport);
+  CallFilters::StackBuilder builder;
+  Stack::AddTo(args, builder);
+  auto stack = builder.Build();
+  auto arena_allocator = MakeRefCounted<CallArenaAllocator>(
+      ResourceQuota::Default()->memory_quota()->CreateMemoryAllocator(
+          "bm-filter-stack"),
+      1024);
+  for (auto _ : state) {
+    auto arena = arena_allocator->MakeArena();
+    promise_detail::Context<Arena> ctx(arena.get());
+    CallFilters filters(Arena::MakePooledForOverwrite<ClientMetadata>());
+    filters.AddStack(stack);
+    filters.Start();
+    auto pull_client_initial_metadata = filters.PullClientInitialMetadata();
+    CHECK(pull_client_initial_metadata().ready());
+    filters.PushServerInitialMetadata(MakeServerMetadata());
+    auto pull_server_initial_metadata = filters.PullServerInitialMetadata();
+    CHECK(pull_server_initial_metadata().ready());
+    filters.PushServerTrailingMetadata(MakeServerMetadata());
+    auto pull_server_trailing_metadata = filters.PullServerTrailingMetadata();
+    CHECK(pull_server_trailing_metadata().ready());
+    filters.Finalize(nullptr);
+  }
+}
+BENCHMARK_TEMPLATE(BM_ClientFilterStackMetadata, DynamicClientStack);
+BENCHMARK_TEMPLATE(BM_ClientFilterStackMetadata, FusedClientStack);
+
+}  // namespace
+}  // namespace grpc_core
 
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(&argc, argv);
   LibraryInitializer libInit;
   ::benchmark::Initialize(&argc, argv);
   grpc::testing::InitTest(&argc, &argv, false);
-  benchmark::RunTheBenchmarksNamespaced();
+  grpc::testing::RunBenchmarks();
   return 0;
 }
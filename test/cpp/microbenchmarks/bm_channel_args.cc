@@ -17,11 +17,17 @@
 
 #include <benchmark/benchmark.h>
 #include <grpcpp/support/channel_arguments.h>
+#include <string.h>
 
+#include <map>
 #include <random>
+#include <vector>
 
 #include "absl/container/btree_map.h"
+#include "absl/strings/str_cat.h"
+#include "src/core/client_channel/subchannel_pool_interface.h"
 #include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/iomgr/resolved_address.h"
 
 const char kKey[] = "a very long key";
 const char kValue[] = "a very long value";
@@ -80,6 +86,48 @@ void BM_ChannelArgsAsKeyIntoBTree(benchmark::State& state) {
 }
 BENCHMARK(BM_ChannelArgsAsKeyIntoBTree);
 
+grpc_resolved_address MakeAddress(int backend) {
+  grpc_resolved_address address;
+  memset(&address, 0, sizeof(address));
+  address.len = 16;
+  memcpy(address.addr, &backend, sizeof(backend));
+  return address;
+}
+
+// Channels usually have many args in common, and differ in a few.
+grpc_core::ChannelArgs MakeSubchannelArgs(int channel) {
+  grpc_core::ChannelArgs args;
+  for (int i = 0; i < 20; i++) {
+    args = args.Set(absl::StrCat("grpc.test.arg", i), kValue);
+  }
+  return args.Set("grpc.test.channel", channel);
+}
+
+// Looks up subchannel keys the way a new channel does when it creates its
+// subchannels: each key is built from fresh args, which are equal to but not
+// the same object as the args of the key already in the pool, and many keys
+// in the pool share the address.
+void BM_SubchannelKeyLookup(benchmark::State& state) {
+  const int kBackends = 10;
+  std::map<grpc_core::SubchannelKey, int> pool;
+  std::vector<grpc_core::SubchannelKey> lookups;
+  for (int channel = 0; channel < state.range(0); channel++) {
+    for (int backend = 0; backend < kBackends; backend++) {
+      pool.emplace(grpc_core::SubchannelKey(MakeAddress(backend),
+                                            MakeSubchannelArgs(channel)),
+                   channel);
+      lookups.emplace_back(MakeAddress(backend), MakeSubchannelArgs(channel));
+    }
+  }
+  std::shuffle(lookups.begin(), lookups.end(),
+               std::mt19937(std::random_device()()));
+  size_t n = 0;
+  for (auto s : state) {
+    benchmark::DoNotOptimize(pool.find(lookups[n++ % lookups.size()]));
+  }
+}
+BENCHMARK(BM_SubchannelKeyLookup)->Range(1, 1024);
+
 // Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
 // and others do not. This allows us to support both modes.
 namespace benchmark {
@@ -321,6 +321,11 @@ BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader, SingleBinaryElem<31, false>)
     ->Args({0, 16384});
 BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader, SingleBinaryElem<100, false>)
     ->Args({0, 16384});
+// binary headers of the size tracing and auth systems send
+BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader, SingleBinaryElem<1024, false>)
+    ->Args({0, 16384});
+BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader, SingleBinaryElem<8192, false>)
+    ->Args({0, 16384});
 // test with a tiny frame size, to highlight continuation costs
 BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader, SingleNonBinaryElem)
     ->Args({0, 1});
@@ -340,6 +345,40 @@ BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader,
 
 }  // namespace hpack_encoder_fixtures
 
+// Steady state of a client issuing unary calls of a single method on one
+// connection: every call builds a fresh batch with the same request headers,
+// which are all in the dynamic table after the first call. Compare runs with
+// and without GRPC_EXPERIMENTS=hpack_encoder_prefix_cache.
+// range(0): 1 to also send a deadline with every call, which usually adds a
+// new grpc-timeout entry to the dynamic table.
+static void BM_HpackEncoderEncodeUnaryRequest(benchmark::State& state) {
+  grpc_core::ExecCtx exec_ctx;
+  const bool with_deadline = state.range(0) != 0;
+  grpc_core::HPackCompressor c;
+  grpc_core::FakeCallTracer call_tracer;
+  grpc_slice_buffer outbuf;
+  grpc_slice_buffer_init(&outbuf);
+  uint32_t stream_id = 1;
+  for (auto _ : state) {
+    grpc_metadata_batch b;
+    hpack_encoder_fixtures::RepresentativeClientInitialMetadata::Prepare(&b);
+    if (with_deadline) {
+      b.Set(grpc_core::GrpcTimeoutMetadata(),
+            grpc_core::Timestamp::Now() + grpc_core::Duration::Seconds(30));
+    }
+    c.EncodeHeaders(
+        grpc_core::HPackCompressor::EncodeHeaderOptions{
+            stream_id, false, true, size_t{16384}, &call_tracer,
+            grpc_core::ztrace_collector},
+        b, &outbuf);
+    stream_id += 2;
+    grpc_slice_buffer_reset_and_unref(&outbuf);
+    grpc_core::ExecCtx::Get()->Flush();
+  }
+  grpc_slice_buffer_destroy(&outbuf);
+}
+BENCHMARK(BM_HpackEncoderEncodeUnaryRequest)->Arg(0)->Arg(1);
+
 ////////////////////////////////////////////////////////////////////////////////
 // HPACK parser
 //
@@ -602,6 +641,9 @@ using RepresentativeServerTrailingMetadata = FromEncoderFixture<
     hpack_encoder_fixtures::RepresentativeServerTrailingMetadata>;
 using MoreRepresentativeClientInitialMetadata = FromEncoderFixture<
     hpack_encoder_fixtures::MoreRepresentativeClientInitialMetadata>;
+// Too large for the dynamic table, so every parse decodes them.
+using LargeBinaryElem =
+    FromEncoderFixture<hpack_encoder_fixtures::SingleBinaryElem<8192, false>>;
 
 // Send the same deadline repeatedly
 class SameDeadline {
@@ -635,6 +677,7 @@ BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, NonIndexedBinaryElem<3, true>);
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, NonIndexedBinaryElem<10, true>);
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, NonIndexedBinaryElem<31, true>);
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, NonIndexedBinaryElem<100, true>);
+BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, LargeBinaryElem);
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader,
                    RepresentativeClientInitialMetadata);
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader,
@@ -653,17 +696,11 @@ BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, SameDeadline);
 
 }  // namespace hpack_parser_fixtures
 
-// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
-// and others do not. This allows us to support both modes.
-namespace benchmark {
-void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
-}  // namespace benchmark
-
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(&argc, argv);
   LibraryInitializer libInit;
   ::benchmark::Initialize(&argc, argv);
   grpc::testing::InitTest(&argc, &argv, false);
-  benchmark::RunTheBenchmarksNamespaced();
+  grpc::testing::RunBenchmarks();
   return 0;
 }
@@ -22,6 +22,7 @@
 #include <string.h>
 
 #include <atomic>
+#include <vector>
 
 #include "absl/log/check.h"
 #include "absl/log/log.h"
@@ -42,6 +43,8 @@ static gpr_mu g_mu;
 static gpr_cv g_cv;
 static int g_threads_active;
 static bool g_active;
+// Number of completions queued by each pollset_work call.
+static int g_completions_per_work = 1;
 
 namespace grpc {
 namespace testing {
@@ -81,10 +84,12 @@ static grpc_error_handle pollset_work(grpc_pollset* ps,
   gpr_mu_unlock(&ps->mu);
 
   void* tag = reinterpret_cast<void*>(10);  // Some random number
-  CHECK(grpc_cq_begin_op(g_cq, tag));
-  grpc_cq_end_op(
-      g_cq, tag, absl::OkStatus(), cq_done_cb, nullptr,
-      static_cast<grpc_cq_completion*>(gpr_malloc(sizeof(grpc_cq_completion))));
+  for (int i = 0; i < g_completions_per_work; i++) {
+    CHECK(grpc_cq_begin_op(g_cq, tag));
+    grpc_cq_end_op(g_cq, tag, absl::OkStatus(), cq_done_cb, nullptr,
+                   static_cast<grpc_cq_completion*>(
+                       gpr_malloc(sizeof(grpc_cq_completion))));
+  }
   grpc_core::ExecCtx::Get()->Flush();
   gpr_mu_lock(&ps->mu);
   return absl::OkStatus();
@@ -156,13 +161,13 @@ static void teardown() {
 // by grpc, and its Finish call must take place before grpc_shutdown so that it
 // can use grpc_stats).
 //
-static void BM_Cq_Throughput(benchmark::State& state) {
+static void StartThread(benchmark::State& state, int completions_per_work) {
   gpr_timespec deadline = gpr_inf_future(GPR_CLOCK_MONOTONIC);
-  auto thd_idx = state.thread_index();
 
   gpr_mu_lock(&g_mu);
   g_threads_active++;
-  if (thd_idx == 0) {
+  if (state.thread_index() == 0) {
+    g_completions_per_work = completions_per_work;
     setup();
     g_active = true;
     gpr_cv_broadcast(&g_cv);
@@ -172,13 +177,10 @@ static void BM_Cq_Throughput(benchmark::State& state) {
     }
   }
   gpr_mu_unlock(&g_mu);
+}
 
-  for (auto _ : state) {
-    CHECK(grpc_completion_queue_next(g_cq, deadline, nullptr).type ==
-          GRPC_OP_COMPLETE);
-  }
-
-  state.SetItemsProcessed(state.iterations());
+static void FinishThread(benchmark::State& state) {
+  gpr_timespec deadline = gpr_inf_future(GPR_CLOCK_MONOTONIC);
 
   gpr_mu_lock(&g_mu);
   g_threads_active--;
@@ -191,14 +193,53 @@ static void BM_Cq_Throughput(benchmark::State& state) {
   }
   gpr_mu_unlock(&g_mu);
 
-  if (thd_idx == 0) {
+  if (state.thread_index() == 0) {
     teardown();
     g_active = false;
   }
 }
 
+static void BM_Cq_Throughput(benchmark::State& state) {
+  gpr_timespec deadline = gpr_inf_future(GPR_CLOCK_MONOTONIC);
+  StartThread(state, 1);
+
+  for (auto _ : state) {
+    CHECK(grpc_completion_queue_next(g_cq, deadline, nullptr).type ==
+          GRPC_OP_COMPLETE);
+  }
+
+  state.SetItemsProcessed(state.iterations());
+  FinishThread(state);
+}
+
 BENCHMARK(BM_Cq_Throughput)->ThreadRange(1, 16)->UseRealTime();
 
+// Each poll queues state.range(0) completions, which each thread takes up to
+// state.range(0) at a time with grpc_completion_queue_next_batch.
+static void BM_Cq_BatchThroughput(benchmark::State& state) {
+  gpr_timespec deadline = gpr_inf_future(GPR_CLOCK_MONOTONIC);
+  const int batch_size = state.range(0);
+  StartThread(state, batch_size);
+
+  std::vector<grpc_event> events(batch_size);
+  int64_t events_processed = 0;
+  for (auto _ : state) {
+    int n = grpc_completion_queue_next_batch(g_cq, events.data(), batch_size,
+                                             deadline, nullptr);
+    CHECK(events[0].type == GRPC_OP_COMPLETE);
+    events_processed += n;
+  }
+
+  state.SetItemsProcessed(events_processed);
+  FinishThread(state);
+}
+
+BENCHMARK(BM_Cq_BatchThroughput)
+    ->RangeMultiplier(4)
+    ->Range(1, 64)
+    ->ThreadRange(1, 16)
+    ->UseRealTime();
+
 namespace {
 const grpc_event_engine_vtable g_none_vtable =
     grpc::testing::make_engine_vtable("none");
@@ -209,12 +250,6 @@ const grpc_event_engine_vtable g_bm_vtable =
 }  // namespace testing
 }  // namespace grpc
 
-// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
-// and others do not. This allows us to support both modes.
-namespace benchmark {
-void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
-}  // namespace benchmark
-
 int main(int argc, char** argv) {
   // This test should only ever be run with a non or any polling engine
   // Override the polling engine for the non-polling engine
@@ -226,6 +261,6 @@ int main(int argc, char** argv) {
   gpr_cv_init(&g_cv);
   ::benchmark::Initialize(&argc, argv);
   grpc::testing::InitTest(&argc, &argv, false);
-  benchmark::RunTheBenchmarksNamespaced();
+  grpc::testing::RunBenchmarks();
   return 0;
 }
@@ -17,8 +17,10 @@
 #include <grpcpp/impl/grpc_library.h>
 
 #include <atomic>
+#include <chrono>
 #include <cmath>
 #include <memory>
+#include <thread>
 #include <vector>
 
 #include "absl/debugging/leak_check.h"
@@ -130,6 +132,34 @@ BENCHMARK(BM_EventEngine_RunClosure)
     ->MeasureProcessCPUTime()
     ->UseRealTime();
 
+// Measures how long an idle worker takes to start running a closure, after
+// state.range(0) microseconds without any work. Compare runs with and without
+// GRPC_EXPERIMENTS=event_engine_adaptive_spinning or
+// GRPC_EXPERIMENTS=event_engine_hot_spinners.
+void BM_EventEngine_WakeToRun(benchmark::State& state) {
+  auto engine = GetDefaultEventEngine();
+  const auto idle = std::chrono::microseconds(state.range(0));
+  for (auto _ : state) {
+    std::this_thread::sleep_for(idle);
+    grpc_core::Notification ran;
+    std::chrono::steady_clock::time_point started;
+    const auto scheduled = std::chrono::steady_clock::now();
+    engine->Run([&]() {
+      started = std::chrono::steady_clock::now();
+      ran.Notify();
+    });
+    ran.WaitForNotification();
+    state.SetIterationTime(
+        std::chrono::duration<double>(started - scheduled).count());
+  }
+}
+BENCHMARK(BM_EventEngine_WakeToRun)
+    ->Arg(0)
+    ->Arg(50)
+    ->Arg(1000)
+    ->UseManualTime()
+    ->Unit(benchmark::kMicrosecond);
+
 void FanoutTestArguments(benchmark::internal::Benchmark* b) {
   // TODO(hork): enable when the engines are fast enough to run these:
   // ->Args({10000, 1})  // chain of callbacks scheduling callbacks
@@ -262,18 +292,12 @@ BENCHMARK(BM_EventEngine_Closure_FanOut)->Apply(FanoutTestArguments);
 
 }  // namespace
 
-// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
-// and others do not. This allows us to support both modes.
-namespace benchmark {
-void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
-}  // namespace benchmark
-
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(&argc, argv);
   LibraryInitializer libInit;
   benchmark::Initialize(&argc, argv);
   grpc::testing::InitTest(&argc, &argv, false);
 
-  benchmark::RunTheBenchmarksNamespaced();
+  grpc::testing::RunBenchmarks();
   return 0;
 }
@@ -87,18 +87,12 @@ BENCHMARK(BM_ExecCtx_RunCounted)
     ->UseRealTime();
 }  // namespace
 
-// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
-// and others do not. This allows us to support both modes.
-namespace benchmark {
-void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
-}  // namespace benchmark
-
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(&argc, argv);
   LibraryInitializer libInit;
   benchmark::Initialize(&argc, argv);
   grpc::testing::InitTest(&argc, &argv, false);
 
-  benchmark::RunTheBenchmarksNamespaced();
+  grpc::testing::RunBenchmarks();
   return 0;
 }
@@ -0,0 +1,184 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Measures the latency of unary calls sharing a connection with a saturating
+// client to server stream, as in BM_PumpStreamClientToServer. The 50th and
+// 99th percentile unary latencies are reported as the unary_p50_us and
+// unary_p99_us counters.
+//
+// Compare runs with and without
+// GRPC_EXPERIMENTS=chttp2_weighted_write_scheduling.
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "absl/log/check.h"
+#include "src/core/util/crash.h"
+#include "src/proto/grpc/testing/echo.grpc.pb.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/microbenchmarks/fullstack_fixtures.h"
+#include "test/cpp/util/test_config.h"
+
+namespace grpc {
+namespace testing {
+
+namespace {
+
+enum Tag : intptr_t {
+  kServerStreamRead,
+  kClientStreamWrite,
+  kServerUnaryRequest,
+  kServerUnaryFinish,
+  kClientUnaryFinish,
+};
+
+void* tag(intptr_t x) { return reinterpret_cast<void*>(x); }
+
+}  // namespace
+
+// range(0): size of the messages pumped on the stream.
+// range(1): write priority of the unary calls.
+template <class Fixture>
+static void BM_UnaryLatencyUnderPump(benchmark::State& state) {
+  EchoTestService::AsyncService service;
+  std::unique_ptr<Fixture> fixture(new Fixture(&service));
+  EchoRequest pump_request;
+  pump_request.set_message(std::string(state.range(0), 'a'));
+  EchoRequest recv_pump_request;
+  ServerContext pump_svr_ctx;
+  ServerAsyncReaderWriter<EchoResponse, EchoRequest> pump_response_rw(
+      &pump_svr_ctx);
+  service.RequestBidiStream(&pump_svr_ctx, &pump_response_rw, fixture->cq(),
+                            fixture->cq(), tag(kServerStreamRead));
+  std::unique_ptr<EchoTestService::Stub> stub(
+      EchoTestService::NewStub(fixture->channel()));
+  ClientContext pump_cli_ctx;
+  auto pump_request_rw = stub->AsyncBidiStream(&pump_cli_ctx, fixture->cq(),
+                                               tag(kClientStreamWrite));
+  int need_tags = (1 << kServerStreamRead) | (1 << kClientStreamWrite);
+  void* t;
+  bool ok;
+  while (need_tags) {
+    CHECK(fixture->cq()->Next(&t, &ok));
+    CHECK(ok);
+    int i = static_cast<int>(reinterpret_cast<intptr_t>(t));
+    CHECK(need_tags & (1 << i));
+    need_tags &= ~(1 << i);
+  }
+  pump_response_rw.Read(&recv_pump_request, tag(kServerStreamRead));
+  pump_request_rw->Write(pump_request, tag(kClientStreamWrite));
+
+  struct ServerEnv {
+    ServerContext ctx;
+    EchoRequest recv_request;
+    grpc::ServerAsyncResponseWriter<EchoResponse> response_writer;
+    ServerEnv() : response_writer(&ctx) {}
+  };
+  auto server_env = std::make_unique<ServerEnv>();
+  service.RequestEcho(&server_env->ctx, &server_env->recv_request,
+                      &server_env->response_writer, fixture->cq(),
+                      fixture->cq(), tag(kServerUnaryRequest));
+  EchoRequest send_request;
+  EchoResponse send_response;
+  EchoResponse recv_response;
+  Status recv_status;
+  std::vector<double> latencies_us;
+  for (auto _ : state) {
+    recv_response.Clear();
+    ClientContext cli_ctx;
+    if (state.range(1) > 0) {
+      cli_ctx.set_write_priority(state.range(1));
+    }
+    const auto start = std::chrono::steady_clock::now();
+    std::unique_ptr<ClientAsyncResponseReader<EchoResponse>> response_reader(
+        stub->AsyncEcho(&cli_ctx, send_request, fixture->cq()));
+    response_reader->Finish(&recv_response, &recv_status,
+                            tag(kClientUnaryFinish));
+    // Keep the stream saturated until both sides of the unary call are done.
+    need_tags = (1 << kServerUnaryFinish) | (1 << kClientUnaryFinish);
+    while (need_tags) {
+      CHECK(fixture->cq()->Next(&t, &ok));
+      CHECK(ok);
+      switch (reinterpret_cast<intptr_t>(t)) {
+        case kServerStreamRead:
+          pump_response_rw.Read(&recv_pump_request, tag(kServerStreamRead));
+          break;
+        case kClientStreamWrite:
+          pump_request_rw->Write(pump_request, tag(kClientStreamWrite));
+          break;
+        case kServerUnaryRequest:
+          server_env->response_writer.Finish(send_response, Status::OK,
+                                             tag(kServerUnaryFinish));
+          break;
+        case kServerUnaryFinish:
+          need_tags &= ~(1 << kServerUnaryFinish);
+          break;
+        case kClientUnaryFinish:
+          latencies_us.push_back(
+              std::chrono::duration<double, std::micro>(
+                  std::chrono::steady_clock::now() - start)
+                  .count());
+          need_tags &= ~(1 << kClientUnaryFinish);
+          break;
+        default:
+          grpc_core::Crash("unreachable");
+      }
+    }
+    CHECK(recv_status.ok());
+    server_env = std::make_unique<ServerEnv>();
+    service.RequestEcho(&server_env->ctx, &server_env->recv_request,
+                        &server_env->response_writer, fixture->cq(),
+                        fixture->cq(), tag(kServerUnaryRequest));
+  }
+  // The pending stream operations complete as the fixture drains its queue.
+  pump_cli_ctx.TryCancel();
+  stub.reset();
+  fixture.reset();
+  if (!latencies_us.empty()) {
+    std::sort(latencies_us.begin(), latencies_us.end());
+    state.counters["unary_p50_us"] =
+        benchmark::Counter(latencies_us[latencies_us.size() / 2]);
+    state.counters["unary_p99_us"] =
+        benchmark::Counter(latencies_us[latencies_us.size() * 99 / 100]);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+//******************************************************************************
+// CONFIGURATIONS
+//
+
+BENCHMARK_TEMPLATE(BM_UnaryLatencyUnderPump, TCP)
+    ->ArgsProduct({{64 * 1024, 4 * 1024 * 1024}, {0, GRPC_MAX_WRITE_PRIORITY}})
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_UnaryLatencyUnderPump, UDS)
+    ->ArgsProduct({{64 * 1024, 4 * 1024 * 1024}, {0, GRPC_MAX_WRITE_PRIORITY}})
+    ->UseRealTime();
+
+}  // namespace testing
+}  // namespace grpc
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  ::benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+  grpc::testing::RunBenchmarks();
+  return 0;
+}
@@ -0,0 +1,143 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Benchmark TLB behaviour of read buffers from malloc vs huge page slabs
+
+#include <benchmark/benchmark.h>
+#include <grpc/support/port_platform.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <vector>
+
+#include "src/core/util/huge_page_allocator.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+#ifdef GPR_LINUX
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+constexpr size_t kBufferSize = 64 * 1024;
+
+// Counts data TLB load misses of the calling thread, where the kernel lets
+// us. Counters are left out of the results when it does not.
+class DtlbMissCounter {
+ public:
+  DtlbMissCounter() {
+#ifdef GPR_LINUX
+    perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HW_CACHE;
+    attr.size = sizeof(attr);
+    attr.config = PERF_COUNT_HW_CACHE_DTLB |
+                  (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                  (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    fd_ = syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+#endif
+  }
+  ~DtlbMissCounter() {
+#ifdef GPR_LINUX
+    if (fd_ >= 0) close(fd_);
+#endif
+  }
+
+  void Start() {
+#ifdef GPR_LINUX
+    if (fd_ < 0) return;
+    ioctl(fd_, PERF_EVENT_IOC_RESET, 0);
+    ioctl(fd_, PERF_EVENT_IOC_ENABLE, 0);
+#endif
+  }
+
+  // Report the misses since Start() as a per iteration counter.
+  void Stop(benchmark::State& state) {
+#ifdef GPR_LINUX
+    if (fd_ < 0) return;
+    ioctl(fd_, PERF_EVENT_IOC_DISABLE, 0);
+    uint64_t misses;
+    if (read(fd_, &misses, sizeof(misses)) != sizeof(misses)) return;
+    state.counters["dtlb_misses"] = benchmark::Counter(
+        static_cast<double>(misses), benchmark::Counter::kAvgIterations);
+#else
+    (void)state;
+#endif
+  }
+
+ private:
+  int fd_ = -1;
+};
+
+struct MallocBuffers {
+  static void* Alloc() { return malloc(kBufferSize); }
+  static void Free(void* p) { free(p); }
+};
+
+struct HugePageBuffers {
+  static void* Alloc() {
+    void* p = grpc_core::HugePageAllocator::MaybeAlloc(kBufferSize);
+    return p == nullptr ? malloc(kBufferSize) : p;
+  }
+  static void Free(void* p) {
+    if (!grpc_core::HugePageAllocator::MaybeFree(p)) free(p);
+  }
+};
+
+}  // namespace
+
+// Touch one cache line in each of a set of read buffers per iteration, in a
+// scattered order, as a poller draining many connections would.
+template <typename Buffers>
+static void BM_TouchReadBuffers(benchmark::State& state) {
+  std::vector<char*> buffers;
+  for (int i = 0; i < state.range(0); i++) {
+    char* p = static_cast<char*>(Buffers::Alloc());
+    memset(p, 1, kBufferSize);
+    buffers.push_back(p);
+  }
+  DtlbMissCounter counter;
+  uint64_t offset = 0;
+  uint64_t sum = 0;
+  counter.Start();
+  for (auto _ : state) {
+    for (char* buffer : buffers) {
+      // Step through each buffer one page at a time.
+      offset = (offset + 4096 + 64) % kBufferSize;
+      sum += buffer[offset];
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  counter.Stop(state);
+  for (char* buffer : buffers) Buffers::Free(buffer);
+}
+BENCHMARK_TEMPLATE(BM_TouchReadBuffers, MallocBuffers)->Range(64, 4096);
+BENCHMARK_TEMPLATE(BM_TouchReadBuffers, HugePageBuffers)->Range(64, 4096);
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+  grpc::testing::RunBenchmarks();
+  return 0;
+}
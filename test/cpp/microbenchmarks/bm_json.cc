@@ -0,0 +1,89 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Measures parsing of large service configs: the JSON parse on its own, and
+// the whole of ServiceConfigImpl::Create(), which also runs every registered
+// service config parser over each method config.
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include "absl/log/check.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_join.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/service_config/service_config_impl.h"
+#include "src/core/util/json/json_reader.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace {
+
+// Returns a service config with num_methods method configs, each naming its
+// own method and setting a timeout and a retry policy.
+std::string MakeServiceConfig(int num_methods) {
+  std::vector<std::string> method_configs;
+  method_configs.reserve(num_methods);
+  for (int i = 0; i < num_methods; ++i) {
+    method_configs.push_back(absl::StrCat(
+        "{\"name\":[{\"service\":\"grpc.testing.BenchmarkService", i,
+        "\",\"method\":\"UnaryCall\"}],"
+        "\"timeout\":\"1.5s\",\"waitForReady\":true,"
+        "\"maxRequestMessageBytes\":4194304,"
+        "\"retryPolicy\":{\"maxAttempts\":3,\"initialBackoff\":\"0.1s\","
+        "\"maxBackoff\":\"1s\",\"backoffMultiplier\":2,"
+        "\"retryableStatusCodes\":[\"UNAVAILABLE\",\"ABORTED\"]}}"));
+  }
+  return absl::StrCat(
+      "{\"loadBalancingConfig\":[{\"round_robin\":{}}],"
+      "\"methodConfig\":[",
+      absl::StrJoin(method_configs, ","), "]}");
+}
+
+void BM_JsonParseServiceConfig(benchmark::State& state) {
+  const std::string json = MakeServiceConfig(state.range(0));
+  for (auto _ : state) {
+    auto parsed = grpc_core::JsonParse(json);
+    CHECK(parsed.ok());
+    benchmark::DoNotOptimize(parsed);
+  }
+  state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK(BM_JsonParseServiceConfig)->Range(1, 4096);
+
+void BM_ServiceConfigCreate(benchmark::State& state) {
+  const std::string json = MakeServiceConfig(state.range(0));
+  const grpc_core::ChannelArgs args;
+  for (auto _ : state) {
+    auto service_config = grpc_core::ServiceConfigImpl::Create(args, json);
+    CHECK(service_config.ok());
+    benchmark::DoNotOptimize(service_config);
+  }
+  state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK(BM_ServiceConfigCreate)->Range(1, 4096);
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+  grpc::testing::RunBenchmarks();
+  return 0;
+}
@@ -0,0 +1,85 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Benchmark contention on a memory quota shared by many allocators
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/util/no_destruct.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace {
+
+std::shared_ptr<grpc_core::BasicMemoryQuota> SharedQuota() {
+  static grpc_core::NoDestruct<std::shared_ptr<grpc_core::BasicMemoryQuota>>
+      quota([]() {
+        auto quota = std::make_shared<grpc_core::BasicMemoryQuota>("bm");
+        quota->Start();
+        return quota;
+      }());
+  return *quota;
+}
+
+}  // namespace
+
+// Each thread owns an allocator and hands its free bytes back after every
+// release, so that every reservation refills from the shared quota.
+static void BM_MemoryQuota_ReserveRelease(benchmark::State& state) {
+  grpc_core::ExecCtx exec_ctx;
+  auto impl =
+      std::make_shared<grpc_core::GrpcMemoryAllocatorImpl>(SharedQuota());
+  const size_t size = state.range(0);
+  for (auto _ : state) {
+    impl->Release(impl->Reserve(grpc_core::MemoryRequest(size)));
+    impl->ReturnFree();
+  }
+  impl->Shutdown();
+}
+BENCHMARK(BM_MemoryQuota_ReserveRelease)
+    ->Arg(4096)
+    ->Arg(64 * 1024)
+    ->ThreadRange(1, 64)
+    ->UseRealTime();
+
+// Allocators keep their free bytes, and only go to the quota when their own
+// pool runs dry or grows large enough to donate back.
+static void BM_MemoryQuota_ReserveReleaseBuffered(benchmark::State& state) {
+  grpc_core::ExecCtx exec_ctx;
+  auto impl =
+      std::make_shared<grpc_core::GrpcMemoryAllocatorImpl>(SharedQuota());
+  const size_t size = state.range(0);
+  for (auto _ : state) {
+    impl->Release(impl->Reserve(grpc_core::MemoryRequest(size)));
+  }
+  impl->Shutdown();
+}
+BENCHMARK(BM_MemoryQuota_ReserveReleaseBuffered)
+    ->Arg(4096)
+    ->Arg(64 * 1024)
+    ->ThreadRange(1, 64)
+    ->UseRealTime();
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+  grpc::testing::RunBenchmarks();
+  return 0;
+}
@@ -0,0 +1,143 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Benchmark matching incoming calls to requests on a server that drains
+// many completion queues from many threads.
+
+#include <benchmark/benchmark.h>
+#include <grpcpp/grpcpp.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "absl/log/check.h"
+#include "src/proto/grpc/testing/echo.grpc.pb.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace grpc {
+namespace testing {
+
+// Requests each server thread keeps outstanding on its completion queue.
+constexpr int kRequestsPerCq = 4;
+
+// An async server with one thread per completion queue.
+class MultiCqServer {
+ public:
+  explicit MultiCqServer(int num_cqs) {
+    ServerBuilder builder;
+    builder.RegisterService(&service_);
+    for (int i = 0; i < num_cqs; ++i) {
+      cqs_.push_back(builder.AddCompletionQueue());
+    }
+    server_ = builder.BuildAndStart();
+    channel_ = server_->InProcessChannel(ChannelArguments());
+    for (auto& cq : cqs_) {
+      threads_.emplace_back([this, cq = cq.get()]() { Serve(cq); });
+    }
+  }
+
+  ~MultiCqServer() {
+    shutdown_.store(true);
+    server_->Shutdown();
+    for (auto& cq : cqs_) cq->Shutdown();
+    for (auto& thread : threads_) thread.join();
+  }
+
+  std::shared_ptr<Channel> channel() const { return channel_; }
+
+ private:
+  struct ServerCall {
+    ServerContext ctx;
+    EchoRequest request;
+    EchoResponse response;
+    ServerAsyncResponseWriter<EchoResponse> responder{&ctx};
+    bool finishing = false;
+  };
+
+  void RequestCall(ServerCompletionQueue* cq) {
+    auto* call = new ServerCall;
+    service_.RequestEcho(&call->ctx, &call->request, &call->responder, cq, cq,
+                         call);
+  }
+
+  void Serve(ServerCompletionQueue* cq) {
+    for (int i = 0; i < kRequestsPerCq; ++i) RequestCall(cq);
+    void* tag;
+    bool ok;
+    while (cq->Next(&tag, &ok)) {
+      auto* call = static_cast<ServerCall*>(tag);
+      if (ok && !call->finishing) {
+        call->response.set_message(call->request.message());
+        call->finishing = true;
+        call->responder.Finish(call->response, Status::OK, call);
+        continue;
+      }
+      // Replace each call that finished (or never started) with a new
+      // request, until the server shuts down.
+      const bool requested = call->finishing;
+      delete call;
+      if (requested && !shutdown_.load()) RequestCall(cq);
+    }
+  }
+
+  EchoTestService::AsyncService service_;
+  std::vector<std::unique_ptr<ServerCompletionQueue>> cqs_;
+  std::unique_ptr<Server> server_;
+  std::shared_ptr<Channel> channel_;
+  std::vector<std::thread> threads_;
+  std::atomic<bool> shutdown_{false};
+};
+
+MultiCqServer* g_server;
+
+// Concurrent unary calls from state.threads() clients to a server with
+// state.range(0) completion queues.
+static void BM_ServerRequestMatcher(benchmark::State& state) {
+  if (state.thread_index() == 0) g_server = new MultiCqServer(state.range(0));
+  std::unique_ptr<EchoTestService::Stub> stub;
+  EchoRequest request;
+  EchoResponse response;
+  for (auto _ : state) {
+    if (stub == nullptr) stub = EchoTestService::NewStub(g_server->channel());
+    ClientContext ctx;
+    CHECK(stub->Echo(&ctx, request, &response).ok());
+  }
+  stub.reset();
+  if (state.thread_index() == 0) {
+    delete g_server;
+    g_server = nullptr;
+  }
+}
+BENCHMARK(BM_ServerRequestMatcher)
+    ->Arg(1)
+    ->Arg(8)
+    ->Arg(32)
+    ->ThreadRange(1, 64)
+    ->UseRealTime();
+
+}  // namespace testing
+}  // namespace grpc
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  ::benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+  grpc::testing::RunBenchmarks();
+  return 0;
+}
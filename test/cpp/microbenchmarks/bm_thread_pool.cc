@@ -17,8 +17,10 @@
 #include <grpcpp/impl/grpc_library.h>
 
 #include <atomic>
+#include <chrono>
 #include <cmath>
 #include <memory>
+#include <thread>
 #include <vector>
 
 #include "absl/log/check.h"
@@ -105,6 +107,36 @@ BENCHMARK(BM_ThreadPool_RunClosure)
     ->MeasureProcessCPUTime()
     ->UseRealTime();
 
+// Measures how long an idle worker takes to start running a closure, after
+// state.range(0) microseconds without any work. Compare runs with and without
+// GRPC_EXPERIMENTS=event_engine_adaptive_spinning or
+// GRPC_EXPERIMENTS=event_engine_hot_spinners.
+void BM_ThreadPool_WakeToRun(benchmark::State& state) {
+  auto pool = grpc_event_engine::experimental::MakeThreadPool(
+      grpc_core::Clamp(gpr_cpu_num_cores(), 2u, 16u));
+  const auto idle = std::chrono::microseconds(state.range(0));
+  for (auto _ : state) {
+    std::this_thread::sleep_for(idle);
+    grpc_core::Notification ran;
+    std::chrono::steady_clock::time_point started;
+    const auto scheduled = std::chrono::steady_clock::now();
+    pool->Run([&]() {
+      started = std::chrono::steady_clock::now();
+      ran.Notify();
+    });
+    ran.WaitForNotification();
+    state.SetIterationTime(
+        std::chrono::duration<double>(started - scheduled).count());
+  }
+  pool->Quiesce();
+}
+BENCHMARK(BM_ThreadPool_WakeToRun)
+    ->Arg(0)
+    ->Arg(50)
+    ->Arg(1000)
+    ->UseManualTime()
+    ->Unit(benchmark::kMicrosecond);
+
 void FanoutTestArguments(benchmark::internal::Benchmark* b) {
   // TODO(hork): enable when the engines are fast enough to run these:
   // ->Args({10000, 1})  // chain of callbacks scheduling callbacks
@@ -241,18 +273,12 @@ BENCHMARK(BM_ThreadPool_Closure_FanOut)->Apply(FanoutTestArguments);
 
 }  // namespace
 
-// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
-// and others do not. This allows us to support both modes.
-namespace benchmark {
-void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
-}  // namespace benchmark
-
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(&argc, argv);
   LibraryInitializer libInit;
   benchmark::Initialize(&argc, argv);
   grpc::testing::InitTest(&argc, &argv, false);
 
-  benchmark::RunTheBenchmarksNamespaced();
+  grpc::testing::RunBenchmarks();
   return 0;
 }
@@ -0,0 +1,200 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Compares running per-connection callbacks with and without worker affinity.
+//
+// Every simulated connection owns a block of state which each of its
+// callbacks reads and writes, much like chttp2 transport state is touched by
+// every read on an endpoint. Callbacks of a connection form a chain: each one
+// schedules the next, either with ThreadPool::Run() or with
+// ThreadPool::RunWithAffinity() keyed by the connection id. On Linux, the
+// number of last level cache misses per callback is reported as the
+// llc_misses_per_item counter when perf events are available.
+//
+// RunWithAffinity() only differs from Run() when the pool is created with the
+// event_engine_worker_affinity experiment, so compare runs with and without
+// GRPC_EXPERIMENTS=event_engine_worker_affinity.
+
+#include <benchmark/benchmark.h>
+#include <grpc/support/cpu.h>
+#include <grpc/support/port_platform.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "src/core/lib/event_engine/common_closures.h"
+#include "src/core/lib/event_engine/thread_pool/thread_pool.h"
+#include "src/core/util/notification.h"
+#include "src/core/util/useful.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+#ifdef GPR_LINUX
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+using ::grpc_event_engine::experimental::AnyInvocableClosure;
+using ::grpc_event_engine::experimental::ThreadPool;
+
+// Counts last level cache misses of the calling thread and of all the threads
+// it creates afterwards.
+class LlcMissCounter {
+ public:
+  LlcMissCounter() {
+#ifdef GPR_LINUX
+    perf_event_attr attr{};
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = PERF_COUNT_HW_CACHE_MISSES;
+    attr.inherit = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    fd_ = static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+#endif
+  }
+  ~LlcMissCounter() {
+#ifdef GPR_LINUX
+    if (fd_ >= 0) close(fd_);
+#endif
+  }
+  LlcMissCounter(const LlcMissCounter&) = delete;
+  LlcMissCounter& operator=(const LlcMissCounter&) = delete;
+
+  std::optional<uint64_t> Read() {
+#ifdef GPR_LINUX
+    uint64_t value;
+    if (fd_ >= 0 && read(fd_, &value, sizeof(value)) == sizeof(value)) {
+      return value;
+    }
+#endif
+    return std::nullopt;
+  }
+
+ private:
+  int fd_ = -1;
+};
+
+class Connection {
+ public:
+  Connection(ThreadPool* pool, size_t id, size_t state_bytes, bool affinity,
+             std::atomic<int>* pending, grpc_core::Notification** done)
+      : pool_(pool),
+        id_(id),
+        affinity_(affinity),
+        state_(state_bytes / sizeof(uint64_t)),
+        pending_(pending),
+        done_(done),
+        closure_([this]() { Step(); }) {}
+
+  void Start(int steps) {
+    remaining_ = steps;
+    Schedule();
+  }
+
+ private:
+  void Step() {
+    uint64_t sum = 0;
+    for (auto& word : state_) {
+      sum += word;
+      word = sum;
+    }
+    benchmark::DoNotOptimize(sum);
+    if (--remaining_ > 0) {
+      Schedule();
+    } else if (pending_->fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      (*done_)->Notify();
+    }
+  }
+
+  void Schedule() {
+    if (affinity_) {
+      pool_->RunWithAffinity(id_, &closure_);
+    } else {
+      pool_->Run(&closure_);
+    }
+  }
+
+  ThreadPool* pool_;
+  const size_t id_;
+  const bool affinity_;
+  std::vector<uint64_t> state_;
+  std::atomic<int>* pending_;
+  grpc_core::Notification** done_;
+  int remaining_ = 0;
+  AnyInvocableClosure closure_;
+};
+
+// range(0): 0 to schedule with Run(), 1 to schedule with RunWithAffinity().
+// range(1): number of connections.
+// range(2): bytes of state per connection.
+void BM_ThreadPool_ConnectionAffinity(benchmark::State& state) {
+  constexpr int kStepsPerConnection = 100;
+  const bool affinity = state.range(0) != 0;
+  const int connection_count = state.range(1);
+  const size_t state_bytes = state.range(2);
+  // Must be created before the pool so that its threads are counted.
+  LlcMissCounter llc_misses;
+  auto pool = grpc_event_engine::experimental::MakeThreadPool(
+      grpc_core::Clamp(gpr_cpu_num_cores(), 2u, 16u));
+  std::atomic<int> pending{0};
+  grpc_core::Notification* done = nullptr;
+  std::vector<std::unique_ptr<Connection>> connections;
+  for (int i = 0; i < connection_count; i++) {
+    connections.push_back(std::make_unique<Connection>(
+        pool.get(), i, state_bytes, affinity, &pending, &done));
+  }
+  std::optional<uint64_t> misses_before = llc_misses.Read();
+  for (auto _ : state) {
+    grpc_core::Notification iteration_done;
+    done = &iteration_done;
+    pending.store(connection_count, std::memory_order_relaxed);
+    for (auto& connection : connections) {
+      connection->Start(kStepsPerConnection);
+    }
+    iteration_done.WaitForNotification();
+  }
+  std::optional<uint64_t> misses_after = llc_misses.Read();
+  const int64_t items =
+      state.iterations() * connection_count * kStepsPerConnection;
+  state.SetItemsProcessed(items);
+  if (misses_before.has_value() && misses_after.has_value() && items > 0) {
+    state.counters["llc_misses_per_item"] = benchmark::Counter(
+        static_cast<double>(*misses_after - *misses_before) / items);
+  }
+  pool->Quiesce();
+}
+BENCHMARK(BM_ThreadPool_ConnectionAffinity)
+    ->ArgsProduct({{0, 1}, {16, 256}, {4096, 65536}})
+    ->MeasureProcessCPUTime()
+    ->UseRealTime();
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+
+  grpc::testing::RunBenchmarks();
+  return 0;
+}
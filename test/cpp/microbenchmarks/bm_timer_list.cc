@@ -0,0 +1,121 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Compares the posix EventEngine's timer implementations under the load that
+// call deadlines put on them: many pending timers, almost all of which are
+// cancelled long before they are due.
+
+#include <benchmark/benchmark.h>
+#include <grpc/event_engine/event_engine.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "src/core/lib/event_engine/posix_engine/timer.h"
+#include "src/core/lib/event_engine/posix_engine/timer_wheel.h"
+#include "src/core/util/time.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace {
+
+using ::grpc_event_engine::experimental::EventEngine;
+using ::grpc_event_engine::experimental::Timer;
+using ::grpc_event_engine::experimental::TimerList;
+using ::grpc_event_engine::experimental::TimerListHost;
+using ::grpc_event_engine::experimental::TimerWheel;
+
+class ManualHost final : public TimerListHost {
+ public:
+  grpc_core::Timestamp Now() override {
+    return grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(now);
+  }
+  void Kick() override {}
+
+  int64_t now = 1000;
+};
+
+class NoopClosure final : public EventEngine::Closure {
+ public:
+  void Run() override {}
+};
+
+// Delays in milliseconds: one in a hundred is short enough to fire during the
+// benchmark, the rest look like call deadlines of a few seconds to a minute.
+std::vector<int64_t> MakeDelays(size_t n) {
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<int64_t> short_delay(1, 50);
+  std::uniform_int_distribution<int64_t> long_delay(1000, 60000);
+  std::vector<int64_t> delays(n);
+  for (size_t i = 0; i < n; ++i) {
+    delays[i] = i % 100 == 0 ? short_delay(rng) : long_delay(rng);
+  }
+  return delays;
+}
+
+// Keeps state.range(0) timers pending. Every iteration cancels the oldest
+// timer (unless it already fired) and replaces it, and time moves forward by
+// a millisecond every 64 iterations, checking for expired timers.
+template <typename T>
+void BM_TimerCancelHeavy(benchmark::State& state) {
+  const size_t num_timers = state.range(0);
+  ManualHost host;
+  T timers(&host);
+  NoopClosure closure;
+  std::vector<Timer> pending(num_timers);
+  const std::vector<int64_t> delays = MakeDelays(4096);
+  for (size_t i = 0; i < num_timers; ++i) {
+    timers.TimerInit(&pending[i],
+                     host.Now() + grpc_core::Duration::Milliseconds(
+                                      delays[i % delays.size()]),
+                     &closure);
+  }
+  size_t next = 0;
+  uint64_t cancelled = 0;
+  uint64_t iteration = 0;
+  for (auto _ : state) {
+    Timer* timer = &pending[next];
+    if (++next == num_timers) next = 0;
+    if (timers.TimerCancel(timer)) ++cancelled;
+    timers.TimerInit(timer,
+                     host.Now() + grpc_core::Duration::Milliseconds(
+                                      delays[iteration % delays.size()]),
+                     &closure);
+    if (++iteration % 64 == 0) {
+      ++host.now;
+      auto expired = timers.TimerCheck(nullptr);
+      benchmark::DoNotOptimize(expired);
+    }
+  }
+  for (Timer& timer : pending) {
+    benchmark::DoNotOptimize(timers.TimerCancel(&timer));
+  }
+  state.counters["cancelled_fraction"] =
+      static_cast<double>(cancelled) / state.iterations();
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TimerCancelHeavy<TimerList>)->Range(1024, 1024 * 1024);
+BENCHMARK(BM_TimerCancelHeavy<TimerWheel>)->Range(1024, 1024 * 1024);
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+  grpc::testing::RunBenchmarks();
+  return 0;
+}
@@ -0,0 +1,84 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Benchmark scheduling callbacks on a WorkSerializer. Compare runs with and
+// without GRPC_EXPERIMENTS=lock_free_work_serializer.
+
+#include <benchmark/benchmark.h>
+#include <grpc/event_engine/event_engine.h>
+
+#include <atomic>
+#include <memory>
+
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/util/no_destruct.h"
+#include "src/core/util/notification.h"
+#include "src/core/util/work_serializer.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace {
+
+constexpr int kCallbacksPerIteration = 1000;
+
+grpc_core::WorkSerializer* SharedWorkSerializer() {
+  static grpc_core::NoDestruct<std::shared_ptr<grpc_core::WorkSerializer>>
+      work_serializer(std::make_shared<grpc_core::WorkSerializer>(
+          grpc_event_engine::experimental::GetDefaultEventEngine()));
+  return work_serializer->get();
+}
+
+}  // namespace
+
+// Each iteration schedules a batch of callbacks and waits for the last one,
+// measuring how quickly the serializer drains while producers keep adding to
+// it.
+static void BM_WorkSerializer_RunBatch(benchmark::State& state) {
+  grpc_core::WorkSerializer* work_serializer = SharedWorkSerializer();
+  std::atomic<int> counter{0};
+  for (auto _ : state) {
+    grpc_core::Notification done;
+    for (int i = 1; i < kCallbacksPerIteration; ++i) {
+      work_serializer->Run([&counter]() {
+        counter.fetch_add(1, std::memory_order_relaxed);
+      });
+    }
+    work_serializer->Run([&done]() { done.Notify(); });
+    done.WaitForNotification();
+  }
+  state.SetItemsProcessed(state.iterations() * kCallbacksPerIteration);
+}
+BENCHMARK(BM_WorkSerializer_RunBatch)->ThreadRange(1, 16)->UseRealTime();
+
+// Each iteration runs a single callback on an idle serializer, measuring the
+// latency of waking it up.
+static void BM_WorkSerializer_RunOne(benchmark::State& state) {
+  auto work_serializer = std::make_shared<grpc_core::WorkSerializer>(
+      grpc_event_engine::experimental::GetDefaultEventEngine());
+  for (auto _ : state) {
+    grpc_core::Notification done;
+    work_serializer->Run([&done]() { done.Notify(); });
+    done.WaitForNotification();
+  }
+}
+BENCHMARK(BM_WorkSerializer_RunOne);
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+  grpc::testing::RunBenchmarks();
+  return 0;
+}
@@ -34,6 +34,7 @@
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/iomgr/endpoint.h"
 #include "src/core/lib/iomgr/endpoint_pair.h"
+#include "src/core/lib/iomgr/event_engine_shims/endpoint.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/iomgr/tcp_posix.h"
 #include "src/core/lib/surface/channel.h"
@@ -42,6 +43,7 @@
 #include "src/core/server/server.h"
 #include "src/core/util/crash.h"
 #include "src/cpp/client/create_channel_internal.h"
+#include "test/core/test_util/passthrough_endpoint.h"
 #include "test/core/test_util/port.h"
 #include "test/core/test_util/test_config.h"
 #include "test/cpp/microbenchmarks/helpers.h"
@@ -259,6 +261,35 @@ class SockPair : public EndpointPairFixture {
                             fixture_configuration) {}
 };
 
+// Like SockPair, but the endpoints hand each other their slices directly
+// instead of going through the kernel, so that only gRPC's own costs are
+// measured. \a shaping can make the pair behave like a slower link.
+class Passthrough : public EndpointPairFixture {
+ public:
+  explicit Passthrough(
+      Service* service,
+      const FixtureConfiguration& fixture_configuration =
+          FixtureConfiguration(),
+      grpc_event_engine::experimental::PassthroughEndpoint::Shaping shaping =
+          {})
+      : EndpointPairFixture(service, MakeEndpointPair(shaping),
+                            fixture_configuration) {}
+
+ private:
+  static grpc_endpoint_pair MakeEndpointPair(
+      grpc_event_engine::experimental::PassthroughEndpoint::Shaping shaping) {
+    auto endpoints = grpc_event_engine::experimental::PassthroughEndpoint::
+        MakePassthroughEndpoint(1, 2, /*allow_inline_callbacks=*/false,
+                                shaping);
+    grpc_endpoint_pair pair;
+    pair.client = grpc_event_engine::experimental::
+        grpc_event_engine_endpoint_create(std::move(endpoints.client));
+    pair.server = grpc_event_engine::experimental::
+        grpc_event_engine_endpoint_create(std::move(endpoints.server));
+    return pair;
+  }
+};
+
 ////////////////////////////////////////////////////////////////////////////////
 // Minimal stack fixtures
 
@@ -285,6 +316,7 @@ typedef MinStackize<TCP> MinTCP;
 typedef MinStackize<UDS> MinUDS;
 typedef MinStackize<InProcess> MinInProcess;
 typedef MinStackize<SockPair> MinSockPair;
+typedef MinStackize<Passthrough> MinPassthrough;
 
 }  // namespace testing
 }  // namespace grpc
@@ -161,6 +161,71 @@ static void BM_PumpStreamServerToClient(benchmark::State& state) {
   fixture.reset();
   state.SetBytesProcessed(state.range(0) * state.iterations());
 }
+
+// Like BM_PumpStreamServerToClient, but each iteration writes a batch of
+// state.range(1) messages the way WriterInterface::WriteBatch does: all but
+// the last with the buffer hint set, so the batch goes out in one flush.
+template <class Fixture>
+static void BM_PumpStreamServerToClientBatched(benchmark::State& state) {
+  EchoTestService::AsyncService service;
+  std::unique_ptr<Fixture> fixture(new Fixture(&service));
+  {
+    EchoResponse send_response;
+    EchoResponse recv_response;
+    if (state.range(0) > 0) {
+      send_response.set_message(std::string(state.range(0), 'a'));
+    }
+    const int batch_size = state.range(1);
+    Status recv_status;
+    ServerContext svr_ctx;
+    ServerAsyncReaderWriter<EchoResponse, EchoRequest> response_rw(&svr_ctx);
+    service.RequestBidiStream(&svr_ctx, &response_rw, fixture->cq(),
+                              fixture->cq(), tag(0));
+    std::unique_ptr<EchoTestService::Stub> stub(
+        EchoTestService::NewStub(fixture->channel()));
+    ClientContext cli_ctx;
+    auto request_rw = stub->AsyncBidiStream(&cli_ctx, fixture->cq(), tag(1));
+    int need_tags = (1 << 0) | (1 << 1);
+    void* t;
+    bool ok;
+    while (need_tags) {
+      CHECK(fixture->cq()->Next(&t, &ok));
+      CHECK(ok);
+      int i = static_cast<int>(reinterpret_cast<intptr_t>(t));
+      CHECK(need_tags & (1 << i));
+      need_tags &= ~(1 << i);
+    }
+    request_rw->Read(&recv_response, tag(0));
+    for (auto _ : state) {
+      for (int n = 0; n < batch_size; n++) {
+        WriteOptions options;
+        if (n + 1 < batch_size) options.set_buffer_hint();
+        response_rw.Write(send_response, options, tag(1));
+        while (true) {
+          CHECK(fixture->cq()->Next(&t, &ok));
+          if (t == tag(0)) {
+            request_rw->Read(&recv_response, tag(0));
+          } else if (t == tag(1)) {
+            break;
+          } else {
+            grpc_core::Crash("unreachable");
+          }
+        }
+      }
+    }
+    response_rw.Finish(Status::OK, tag(1));
+    need_tags = (1 << 0) | (1 << 1);
+    while (need_tags) {
+      CHECK(fixture->cq()->Next(&t, &ok));
+      int i = static_cast<int>(reinterpret_cast<intptr_t>(t));
+      CHECK(need_tags & (1 << i));
+      need_tags &= ~(1 << i);
+    }
+  }
+  fixture.reset();
+  state.SetBytesProcessed(state.range(0) * state.range(1) *
+                          state.iterations());
+}
 }  // namespace testing
 }  // namespace grpc
 
@@ -18,9 +18,30 @@
 
 #include "test/cpp/microbenchmarks/helpers.h"
 
+#include <errno.h>
+#include <grpc/support/port_platform.h>
+#include <stdlib.h>
 #include <string.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <new>
+#include <vector>
+
 #include "absl/log/check.h"
+#include "absl/log/log.h"
+#include "src/core/util/env.h"
+
+#ifdef GPR_LINUX
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 static LibraryInitializer* g_libraryInitializer;
 
@@ -35,3 +56,251 @@ LibraryInitializer& LibraryInitializer::get() {
   CHECK_NE(g_libraryInitializer, nullptr);
   return *g_libraryInitializer;
 }
+
+namespace {
+
+// Allocation counts, only updated while g_count_allocations is set so that
+// benchmarks run without GRPC_BENCHMARK_COUNTERS pay for one relaxed load.
+std::atomic<bool> g_count_allocations{false};
+std::atomic<int64_t> g_num_allocs{0};
+std::atomic<int64_t> g_allocated_bytes{0};
+
+}  // namespace
+
+// Replacing the global operator new affects every allocation in the binary,
+// so it is only done in builds that opt in with
+// --copt=-DGRPC_BENCHMARK_COUNTERS.  Other builds report no allocation
+// counts.
+#ifdef GRPC_BENCHMARK_COUNTERS
+
+namespace {
+
+void* CountedAlloc(size_t size) {
+  if (g_count_allocations.load(std::memory_order_relaxed)) {
+    g_num_allocs.fetch_add(1, std::memory_order_relaxed);
+    g_allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+  }
+  void* p = malloc(size == 0 ? 1 : size);
+  if (p == nullptr) abort();
+  return p;
+}
+
+}  // namespace
+
+void* operator new(size_t size) { return CountedAlloc(size); }
+void* operator new[](size_t size) { return CountedAlloc(size); }
+void operator delete(void* p) noexcept { free(p); }
+void operator delete[](void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+void operator delete[](void* p, size_t) noexcept { free(p); }
+
+#endif  // GRPC_BENCHMARK_COUNTERS
+
+namespace grpc {
+namespace testing {
+namespace {
+
+struct Counts {
+  int64_t instructions = 0;
+  int64_t cycles = 0;
+  int64_t cache_misses = 0;
+  int64_t branch_misses = 0;
+  int64_t allocs = 0;
+  int64_t allocated_bytes = 0;
+  int64_t combiner_closures = 0;
+  int64_t combiner_offloads = 0;
+  bool have_hardware_counts = false;
+  bool have_allocation_counts = false;
+};
+
+// Hardware event counters of the calling thread and the threads it starts
+// while counting.
+class HardwareCounters {
+ public:
+  HardwareCounters() {
+#ifdef GPR_LINUX
+    const uint64_t kEvents[kNumEvents] = {
+        PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CPU_CYCLES,
+        PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+    for (int i = 0; i < kNumEvents; i++) {
+      perf_event_attr attr;
+      memset(&attr, 0, sizeof(attr));
+      attr.size = sizeof(attr);
+      attr.type = PERF_TYPE_HARDWARE;
+      attr.config = kEvents[i];
+      attr.disabled = 1;
+      attr.inherit = 1;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+      fds_[i] = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+      if (fds_[i] < 0) {
+        LOG(INFO) << "perf_event_open failed (" << strerror(errno)
+                  << "); benchmarks will report allocation counts only";
+        Close();
+        return;
+      }
+    }
+    available_ = true;
+#endif
+  }
+
+  ~HardwareCounters() { Close(); }
+
+  HardwareCounters(const HardwareCounters&) = delete;
+  HardwareCounters& operator=(const HardwareCounters&) = delete;
+
+  void Start() {
+#ifdef GPR_LINUX
+    if (!available_) return;
+    for (int fd : fds_) {
+      ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+      ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+#endif
+  }
+
+  void Stop(Counts& counts) {
+#ifdef GPR_LINUX
+    if (!available_) return;
+    int64_t values[kNumEvents];
+    for (int i = 0; i < kNumEvents; i++) {
+      ioctl(fds_[i], PERF_EVENT_IOC_DISABLE, 0);
+      uint64_t value = 0;
+      if (read(fds_[i], &value, sizeof(value)) != sizeof(value)) return;
+      values[i] = static_cast<int64_t>(value);
+    }
+    counts.instructions = values[0];
+    counts.cycles = values[1];
+    counts.cache_misses = values[2];
+    counts.branch_misses = values[3];
+    counts.have_hardware_counts = true;
+#else
+    (void)counts;
+#endif
+  }
+
+ private:
+  static constexpr int kNumEvents = 4;
+
+  void Close() {
+    for (int& fd : fds_) {
+#ifdef GPR_LINUX
+      if (fd >= 0) close(fd);
+#endif
+      fd = -1;
+    }
+  }
+
+  int fds_[kNumEvents] = {-1, -1, -1, -1};
+  bool available_ = false;
+};
+
+// Counts the pass the benchmark library makes with a memory manager
+// registered, and queues the counts for CountersReporter to pick up, since the
+// library reports each run after its counted pass.
+class CountingMemoryManager final : public benchmark::MemoryManager {
+ public:
+  void Start() override {
+    g_num_allocs.store(0, std::memory_order_relaxed);
+    g_allocated_bytes.store(0, std::memory_order_relaxed);
+    g_count_allocations.store(true, std::memory_order_relaxed);
+    stats_before_ = grpc_core::global_stats().Collect();
+    hardware_counters_.Start();
+  }
+
+  void Stop(Result& result) override {
+    Counts counts;
+    hardware_counters_.Stop(counts);
+    g_count_allocations.store(false, std::memory_order_relaxed);
+    counts.allocs = g_num_allocs.load(std::memory_order_relaxed);
+    counts.allocated_bytes = g_allocated_bytes.load(std::memory_order_relaxed);
+#ifdef GRPC_BENCHMARK_COUNTERS
+    counts.have_allocation_counts = true;
+#endif
+    auto stats = grpc_core::global_stats().Collect()->Diff(*stats_before_);
+    counts.combiner_closures = stats->combiner_closures_run;
+    counts.combiner_offloads = stats->combiner_offloads;
+    if (counts.have_allocation_counts) {
+      result.num_allocs = counts.allocs;
+      result.total_allocated_bytes = counts.allocated_bytes;
+    }
+    counts_.push_back(counts);
+  }
+
+  Counts Next() {
+    if (counts_.empty()) return Counts();
+    Counts counts = counts_.front();
+    counts_.pop_front();
+    return counts;
+  }
+
+ private:
+  HardwareCounters hardware_counters_;
+  std::unique_ptr<grpc_core::GlobalStats> stats_before_;
+  std::deque<Counts> counts_;
+};
+
+// Adds the counts of the counted pass to each run and hands it on to the
+// reporter selected by --benchmark_format.
+class CountersReporter final : public benchmark::BenchmarkReporter {
+ public:
+  explicit CountersReporter(CountingMemoryManager* memory_manager)
+      : memory_manager_(memory_manager),
+        display_reporter_(benchmark::CreateDefaultDisplayReporter()) {}
+
+  bool ReportContext(const Context& context) override {
+    display_reporter_->SetOutputStream(&GetOutputStream());
+    display_reporter_->SetErrorStream(&GetErrorStream());
+    return display_reporter_->ReportContext(context);
+  }
+
+  void ReportRuns(const std::vector<Run>& runs) override {
+    std::vector<Run> counted_runs = runs;
+    for (Run& run : counted_runs) {
+      if (run.run_type != Run::RT_Iteration) continue;
+      const Counts counts = memory_manager_->Next();
+      // The library makes the counted pass on one thread, for at most 16 of
+      // the iterations each thread of the timed run made.
+      const double iterations = std::max<benchmark::IterationCount>(
+          1, std::min<benchmark::IterationCount>(
+                 16, run.iterations / std::max<int64_t>(1, run.threads)));
+      if (counts.have_hardware_counts) {
+        run.counters["instructions"] = counts.instructions / iterations;
+        run.counters["cycles"] = counts.cycles / iterations;
+        run.counters["cache_misses"] = counts.cache_misses / iterations;
+        run.counters["branch_misses"] = counts.branch_misses / iterations;
+      }
+      if (counts.have_allocation_counts) {
+        run.counters["allocs"] = counts.allocs / iterations;
+        run.counters["allocated_bytes"] = counts.allocated_bytes / iterations;
+      }
+      run.counters["combiner_closures"] = counts.combiner_closures / iterations;
+      run.counters["combiner_offloads"] = counts.combiner_offloads / iterations;
+    }
+    display_reporter_->ReportRuns(counted_runs);
+  }
+
+  void Finalize() override { display_reporter_->Finalize(); }
+
+ private:
+  CountingMemoryManager* const memory_manager_;
+  // Owned by the benchmark library.
+  benchmark::BenchmarkReporter* const display_reporter_;
+};
+
+}  // namespace
+
+void RunBenchmarks() {
+  if (!grpc_core::GetEnv("GRPC_BENCHMARK_COUNTERS").has_value()) {
+    benchmark::RunSpecifiedBenchmarks();
+    return;
+  }
+  CountingMemoryManager memory_manager;
+  CountersReporter reporter(&memory_manager);
+  benchmark::RegisterMemoryManager(&memory_manager);
+  benchmark::RunSpecifiedBenchmarks(&reporter);
+  benchmark::RegisterMemoryManager(nullptr);
+}
+
+}  // namespace testing
+}  // namespace grpc
@@ -40,4 +40,24 @@ class LibraryInitializer {
   grpc::internal::GrpcLibrary init_lib_;
 };
 
+namespace grpc {
+namespace testing {
+
+// Runs the registered benchmarks.
+//
+// If the GRPC_BENCHMARK_COUNTERS environment variable is set, every benchmark
+// is run once more after being timed, this time counting the hardware events
+// (instructions, cycles, cache misses and branch misses, read through
+// perf_event_open on Linux) of the benchmark thread and the threads it starts,
+// and the closures run by (and offloaded from) combiners in the whole process.
+// Binaries built with --copt=-DGRPC_BENCHMARK_COUNTERS also replace the
+// global operator new and count the allocations made through it. The
+// per-iteration values are added to the counters of each run. Instruction
+// and allocation counts are much less noisy than timings, so a report written
+// with --benchmark_format=json can be compared across commits.
+void RunBenchmarks();
+
+}  // namespace testing
+}  // namespace grpc
+
 #endif  // GRPC_TEST_CPP_MICROBENCHMARKS_HELPERS_H
@@ -32,6 +32,7 @@
 #include <memory>
 #include <mutex>
 #include <thread>
+#include <vector>
 
 #include "absl/log/log.h"
 #include "src/core/lib/surface/completion_queue.h"
@@ -104,6 +105,7 @@ class AsyncQpsServerTest final : public grpc::testing::Server {
     for (int i = 0; i < num_threads; i++) {
       cq_.emplace_back(i % srv_cqs_.size());
     }
+    cq_batch_size_ = std::max(1, config.cq_batch_size());
 
     ApplyConfigToBuilder(config, builder.get());
 
@@ -202,6 +204,10 @@ class AsyncQpsServerTest final : public grpc::testing::Server {
 
  private:
   void ThreadFunc(int thread_idx) {
+    if (cq_batch_size_ > 1) {
+      BatchThreadFunc(thread_idx);
+      return;
+    }
     // Wait until work is available or we are shutting down
     bool ok;
     void* got_tag;
@@ -232,6 +238,28 @@ class AsyncQpsServerTest final : public grpc::testing::Server {
         &got_tag, &ok, gpr_inf_future(GPR_CLOCK_REALTIME)));
   }
 
+  // Like ThreadFunc, but takes up to cq_batch_size_ events from the
+  // completion queue at a time.
+  void BatchThreadFunc(int thread_idx) {
+    std::vector<void*> tags(cq_batch_size_);
+    std::unique_ptr<bool[]> oks(new bool[cq_batch_size_]);
+    std::mutex* mu_ptr = &shutdown_state_[thread_idx]->mutex;
+    int n;
+    while ((n = srv_cqs_[cq_[thread_idx]]->NextBatch(tags.data(), oks.get(),
+                                                     cq_batch_size_)) > 0) {
+      std::lock_guard<std::mutex> lock(*mu_ptr);
+      if (shutdown_state_[thread_idx]->shutdown) return;
+      for (int i = 0; i < n; i++) {
+        ServerRpcContext* ctx = detag(tags[i]);
+        ctx->lock();
+        if (!ctx->RunNextState(oks[i])) {
+          ctx->Reset();
+        }
+        ctx->unlock();
+      }
+    }
+  }
+
   class ServerRpcContext {
    public:
     ServerRpcContext() {}
@@ -522,6 +550,7 @@ class AsyncQpsServerTest final : public grpc::testing::Server {
   std::unique_ptr<grpc::Server> server_;
   std::vector<std::unique_ptr<grpc::ServerCompletionQueue>> srv_cqs_;
   std::vector<int> cq_;
+  int cq_batch_size_;
   ServiceType async_service_;
   std::vector<std::unique_ptr<ServerRpcContext>> contexts_;
 
@@ -0,0 +1,141 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Measures LoadReporter::FetchAndSample(), which merges the call-end view
+// data for every (client, user, status) row into the load data store, while
+// report streams concurrently read the store with GenerateLoads().
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "opencensus/stats/stats.h"
+#include "opencensus/stats/testing/test_utils.h"
+#include "src/core/ext/filters/load_reporting/registered_opencensus_objects.h"
+#include "src/cpp/server/load_reporter/constants.h"
+#include "src/cpp/server/load_reporter/load_reporter.h"
+
+namespace grpc {
+namespace load_reporter {
+namespace {
+
+const char kHostname[] = "hostname";
+// Pad to the length of a valid LB ID.
+const char kLbId[] = "lb_id_01";
+const char kLbToken[] = "lb_id_01lb_tag";
+const char kClientIp[] = "0800000001";
+const char kLoadKey[] = "load_key";
+
+// Returns the same call-end view data, one row for each of num_users users,
+// on every fetch.  The data is recorded through Census once, up front.
+class FakeCensusViewProvider : public CensusViewProvider {
+ public:
+  explicit FakeCensusViewProvider(int num_users) {
+    // Access the measures to make them valid.
+    MeasureEndCount();
+    MeasureEndBytesSent();
+    MeasureEndBytesReceived();
+    MeasureEndLatencyMs();
+    std::map<std::string, std::unique_ptr<::opencensus::stats::View>> views;
+    for (const char* view_name : {kViewEndCount, kViewEndBytesSent,
+                                  kViewEndBytesReceived, kViewEndLatencyMs}) {
+      views.emplace(view_name, std::make_unique<::opencensus::stats::View>(
+                                   view_descriptor_map().at(view_name)));
+    }
+    const std::string token = std::string(kClientIp) + kLbToken;
+    for (int i = 0; i < num_users; ++i) {
+      const std::string user_id = "user" + std::to_string(i);
+      ::opencensus::stats::Record({{MeasureEndCount(), 10},
+                                   {MeasureEndBytesSent(), 1000},
+                                   {MeasureEndBytesReceived(), 2000},
+                                   {MeasureEndLatencyMs(), 50}},
+                                  {{TagKeyToken(), token},
+                                   {TagKeyHost(), kHostname},
+                                   {TagKeyUserId(), user_id},
+                                   {TagKeyStatus(), kCallStatusOk}});
+    }
+    ::opencensus::stats::testing::TestUtils::Flush();
+    for (auto& [view_name, view] : views) {
+      view_data_map_.emplace(view_name, view->GetData());
+    }
+  }
+
+  ViewDataMap FetchViewData() override { return view_data_map_; }
+
+ private:
+  ViewDataMap view_data_map_;
+};
+
+class FakeCpuStatsProvider : public CpuStatsProvider {
+ public:
+  CpuStatsSample GetCpuStats() override {
+    used_ += 1;
+    total_ += 2;
+    return {used_, total_};
+  }
+
+ private:
+  uint64_t used_ = 0;
+  uint64_t total_ = 0;
+};
+
+// Args: users per fetch, and report streams reading the store meanwhile.
+void BM_FetchAndSampleWithReaders(benchmark::State& state) {
+  LoadReporter load_reporter(
+      /*feedback_sample_window_seconds=*/5,
+      std::make_unique<FakeCensusViewProvider>(state.range(0)),
+      std::make_unique<FakeCpuStatsProvider>());
+  load_reporter.ReportStreamCreated(kHostname, kLbId, kLoadKey);
+  std::atomic<bool> done{false};
+  std::vector<std::thread> readers;
+  for (int i = 0; i < state.range(1); ++i) {
+    readers.emplace_back([&load_reporter, &done]() {
+      while (!done.load(std::memory_order_relaxed)) {
+        benchmark::DoNotOptimize(
+            load_reporter.GenerateLoads(kHostname, kLbId));
+        load_reporter.GenerateLoadBalancingFeedback();
+      }
+    });
+  }
+  for (auto _ : state) {
+    load_reporter.FetchAndSample();
+  }
+  done.store(true, std::memory_order_relaxed);
+  for (auto& reader : readers) reader.join();
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_FetchAndSampleWithReaders)
+    ->ArgsProduct({{1, 32, 1024}, {0, 1, 4}})
+    ->UseRealTime();
+
+}  // namespace
+}  // namespace load_reporter
+}  // namespace grpc
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  ::benchmark::Initialize(&argc, argv);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -24,10 +24,13 @@
 #include <atomic>
 #include <chrono>
 #include <climits>
+#include <cstdint>
 #include <memory>
 #include <thread>
 
 #include "absl/log/log.h"
+#include "absl/synchronization/notification.h"
+#include "absl/time/time.h"
 #include "gtest/gtest.h"
 #include "src/core/util/crash.h"
 #include "test/core/test_util/test_config.h"
@@ -56,13 +59,18 @@ struct TestThreadManagerSettings {
 
   // How many should be instantiated
   int thread_manager_count;
+
+  // The min and max number of handoff workers (0 means pollers do the work)
+  int min_workers = 0;
+  int max_workers = 0;
 };
 
 class TestThreadManager final : public grpc::ThreadManager {
  public:
   TestThreadManager(const char* name, grpc_resource_quota* rq,
                     const TestThreadManagerSettings& settings)
-      : ThreadManager(name, rq, settings.min_pollers, settings.max_pollers),
+      : ThreadManager(name, rq, settings.min_pollers, settings.max_pollers,
+                      settings.min_workers, settings.max_workers),
         settings_(settings),
         num_do_work_(0),
         num_poll_for_work_(0),
@@ -153,7 +161,14 @@ TestThreadManagerSettings scenarios[] = {
      INT_MAX /* thread_limit */, 1 /* thread_manager_count */},
     {1 /* min_pollers */, 1 /* max_pollers */, 1 /* poll_duration_ms */,
      10 /* work_duration_ms */, 50 /* max_poll_calls */, 3 /* thread_limit */,
-     2 /* thread_manager_count */}};
+     2 /* thread_manager_count */},
+    {2 /* min_pollers */, 10 /* max_pollers */, 1 /* poll_duration_ms */,
+     10 /* work_duration_ms */, 50 /* max_poll_calls */,
+     INT_MAX /* thread_limit */, 1 /* thread_manager_count */,
+     1 /* min_workers */, 4 /* max_workers */},
+    {1 /* min_pollers */, 1 /* max_pollers */, 1 /* poll_duration_ms */,
+     10 /* work_duration_ms */, 50 /* max_poll_calls */, 3 /* thread_limit */,
+     2 /* thread_manager_count */, 0 /* min_workers */, 4 /* max_workers */}};
 
 INSTANTIATE_TEST_SUITE_P(ThreadManagerTest, ThreadManagerTest,
                          ::testing::ValuesIn(scenarios));
@@ -177,6 +192,59 @@ TEST_P(ThreadManagerTest, TestThreadQuota) {
   }
 }
 
+// Finds two items of work. The first blocks in DoWork() until released, and
+// the second must still be done meanwhile by another handoff worker.
+class BlockingThreadManager final : public grpc::ThreadManager {
+ public:
+  explicit BlockingThreadManager(grpc_resource_quota* rq)
+      : ThreadManager("BlockingThreadManager", rq, /*min_pollers=*/1,
+                      /*max_pollers=*/1, /*min_workers=*/1,
+                      /*max_workers=*/2) {}
+
+  WorkStatus PollForWork(void** tag, bool* ok) override {
+    int call_num = num_poll_for_work_.fetch_add(1, std::memory_order_relaxed);
+    *ok = true;
+    if (call_num < 2) {
+      *tag = reinterpret_cast<void*>(static_cast<intptr_t>(call_num));
+      return WORK_FOUND;
+    }
+    if (stop_.HasBeenNotified()) {
+      Shutdown();
+      return SHUTDOWN;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    *tag = nullptr;
+    return TIMEOUT;
+  }
+
+  void DoWork(void* tag, bool /*ok*/, bool /*resources*/) override {
+    if (reinterpret_cast<intptr_t>(tag) == 0) {
+      release_.WaitForNotification();
+    } else {
+      second_done_.Notify();
+    }
+  }
+
+  absl::Notification release_;
+  absl::Notification second_done_;
+  absl::Notification stop_;
+
+ private:
+  std::atomic_int num_poll_for_work_{0};
+};
+
+TEST(ThreadManagerHandoffTest, WorkIsNotHeldBehindLongRunningDoWork) {
+  grpc_resource_quota* rq = grpc_resource_quota_create("Thread manager test");
+  BlockingThreadManager tm(rq);
+  grpc_resource_quota_unref(rq);
+  tm.Initialize();
+  EXPECT_TRUE(
+      tm.second_done_.WaitForNotificationWithTimeout(absl::Seconds(10)));
+  tm.release_.Notify();
+  tm.stop_.Notify();
+  tm.Wait();
+}
+
 }  // namespace
 }  // namespace grpc
 
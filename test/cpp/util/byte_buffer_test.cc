@@ -21,6 +21,7 @@
 #include <grpc/slice.h>
 #include <grpcpp/impl/grpc_library.h>
 #include <grpcpp/support/slice.h>
+#include <grpcpp/support/slice_message.h>
 
 #include <cstring>
 #include <vector>
@@ -149,6 +150,36 @@ TEST_F(ByteBufferTest, DumpToSingleSlice) {
   EXPECT_EQ(strlen(kContent1) + strlen(kContent2), slice.size());
 }
 
+TEST_F(ByteBufferTest, SliceMessageSerializesWithoutCopying) {
+  static const char kBlob[] = "precomputed blob";
+  experimental::SliceMessage message(
+      Slice(kBlob, sizeof(kBlob) - 1, Slice::STATIC_SLICE));
+  ByteBuffer buffer;
+  bool own_buffer;
+  EXPECT_TRUE(SerializationTraits<experimental::SliceMessage>::Serialize(
+                  message, &buffer, &own_buffer)
+                  .ok());
+  Slice slice;
+  EXPECT_TRUE(buffer.TrySingleSlice(&slice).ok());
+  EXPECT_EQ(slice.begin(), reinterpret_cast<const uint8_t*>(kBlob));
+}
+
+TEST_F(ByteBufferTest, SliceMessageDeserializesWithoutFlattening) {
+  std::vector<Slice> slices;
+  slices.emplace_back(kContent1);
+  slices.emplace_back(kContent2);
+  ByteBuffer buffer(&slices[0], 2);
+  experimental::SliceMessage message;
+  EXPECT_TRUE(SerializationTraits<experimental::SliceMessage>::Deserialize(
+                  &buffer, &message)
+                  .ok());
+  EXPECT_FALSE(buffer.Valid());
+  ASSERT_EQ(message.slices().size(), 2);
+  EXPECT_EQ(message.slices()[0].begin(), slices[0].begin());
+  EXPECT_EQ(message.slices()[1].begin(), slices[1].begin());
+  EXPECT_EQ(message.Length(), strlen(kContent1) + strlen(kContent2));
+}
+
 }  // namespace
 }  // namespace grpc
 
@@ -0,0 +1,162 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include <grpc/grpc.h>
+#include <grpcpp/support/parallel_message_parser.h>
+#include <grpcpp/support/slice.h>
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include "absl/strings/match.h"
+#include "absl/strings/str_cat.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/synchronization/notification.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "gtest/gtest.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc {
+namespace {
+
+struct TestMessage {
+  std::string payload;
+};
+
+}  // namespace
+
+// Messages whose payload starts with "slow" take a while to parse, and
+// "bad" fails to parse.
+template <>
+class SerializationTraits<TestMessage, void> {
+ public:
+  static Status Deserialize(ByteBuffer* buffer, TestMessage* message) {
+    std::vector<Slice> slices;
+    Status status = buffer->Dump(&slices);
+    if (!status.ok()) return status;
+    for (const Slice& slice : slices) {
+      message->payload.append(reinterpret_cast<const char*>(slice.begin()),
+                              slice.size());
+    }
+    if (absl::StartsWith(message->payload, "slow")) {
+      absl::SleepFor(absl::Milliseconds(50));
+    }
+    if (message->payload == "bad") {
+      return Status(StatusCode::INTERNAL, "bad message");
+    }
+    return Status::OK;
+  }
+};
+
+namespace {
+
+using experimental::ParallelMessageParser;
+
+ByteBuffer MakeBuffer(const std::string& payload) {
+  Slice slice(payload);
+  return ByteBuffer(&slice, 1);
+}
+
+class ParallelMessageParserTest : public ::testing::Test {
+ protected:
+  static void SetUpTestSuite() { grpc_init(); }
+
+  static void TearDownTestSuite() { grpc_shutdown(); }
+
+  void OnParsed(Status status, TestMessage* message) {
+    absl::MutexLock lock(&mu_);
+    payloads_.push_back(status.ok() ? message->payload
+                                    : "error:" + status.error_message());
+    if (payloads_.size() == expected_) done_.Notify();
+  }
+
+  std::vector<std::string> Payloads() {
+    absl::MutexLock lock(&mu_);
+    return payloads_;
+  }
+
+  absl::Mutex mu_;
+  std::vector<std::string> payloads_ ABSL_GUARDED_BY(mu_);
+  size_t expected_ = 0;
+  absl::Notification done_;
+};
+
+TEST_F(ParallelMessageParserTest, DeliversInStreamOrder) {
+  expected_ = 10;
+  ParallelMessageParser<TestMessage> parser(
+      /*max_outstanding=*/16,
+      [this](Status status, TestMessage* message) {
+        OnParsed(std::move(status), message);
+      },
+      [] { FAIL() << "the window never fills up"; });
+  std::vector<std::string> want;
+  for (size_t i = 0; i < expected_; ++i) {
+    want.push_back(absl::StrCat(i % 2 == 0 ? "slow" : "fast", i));
+    parser.Submit(MakeBuffer(want.back()));
+  }
+  done_.WaitForNotification();
+  EXPECT_EQ(Payloads(), want);
+}
+
+TEST_F(ParallelMessageParserTest, ReportsParseErrorsInOrder) {
+  expected_ = 3;
+  ParallelMessageParser<TestMessage> parser(
+      expected_,
+      [this](Status status, TestMessage* message) {
+        OnParsed(std::move(status), message);
+      },
+      [] {});
+  parser.Submit(MakeBuffer("slow"));
+  parser.Submit(MakeBuffer("bad"));
+  parser.Submit(MakeBuffer("fine"));
+  done_.WaitForNotification();
+  EXPECT_EQ(Payloads(),
+            std::vector<std::string>({"slow", "error:bad message", "fine"}));
+}
+
+TEST_F(ParallelMessageParserTest, SignalsWhenWindowReopens) {
+  expected_ = 2;
+  std::atomic<int> ready_calls{0};
+  absl::Notification ready;
+  ParallelMessageParser<TestMessage> parser(
+      2,
+      [this](Status status, TestMessage* message) {
+        OnParsed(std::move(status), message);
+      },
+      [&] {
+        ready_calls++;
+        ready.Notify();
+      });
+  EXPECT_TRUE(parser.Submit(MakeBuffer("slow1")));
+  EXPECT_FALSE(parser.Submit(MakeBuffer("slow2")));
+  ready.WaitForNotification();
+  done_.WaitForNotification();
+  EXPECT_EQ(ready_calls.load(), 1);
+  EXPECT_EQ(Payloads(), std::vector<std::string>({"slow1", "slow2"}));
+}
+
+}  // namespace
+}  // namespace grpc
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
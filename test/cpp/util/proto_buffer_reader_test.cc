@@ -75,6 +75,30 @@ TEST(ProtoBufferReaderTest, ReadCord) {
   EXPECT_EQ(reader.ByteCount(), cord1.size() + cord2.size());
 }
 
+TEST(ProtoBufferReaderTest, ReadCordReferencesSlices) {
+  Slice slice(std::string(1024, 'a'));
+  absl::Cord cord;
+  {
+    ByteBuffer buffer(&slice, 1);
+    ProtoBufferReader reader(&buffer);
+    EXPECT_TRUE(reader.ReadCord(&cord, slice.size()));
+  }
+  // The Cord keeps the slice alive after the buffer is gone.
+  auto flat = cord.TryFlat();
+  ASSERT_TRUE(flat.has_value());
+  EXPECT_EQ(flat->data(), reinterpret_cast<const char*>(slice.begin()));
+  EXPECT_EQ(std::string(cord), std::string(1024, 'a'));
+}
+
+TEST(ProtoBufferReaderTest, ReadCordCopiesInlinedSlices) {
+  Slice slice(grpc_slice_from_copied_string("abc"), Slice::STEAL_REF);
+  ByteBuffer buffer(&slice, 1);
+  ProtoBufferReader reader(&buffer);
+  absl::Cord cord;
+  EXPECT_TRUE(reader.ReadCord(&cord, 3));
+  EXPECT_EQ(std::string(cord), "abc");
+}
+
 #endif  // GRPC_PROTOBUF_CORD_SUPPORT_ENABLED
 
 }  // namespace
@@ -67,6 +67,21 @@ TEST(ProtoBufferWriterTest, WriteCord) {
   EXPECT_EQ(memcmp(slice.begin() + str1.size(), str2.c_str(), str2.size()), 0);
 }
 
+TEST(ProtoBufferWriterTest, WriteCordReferencesCordMemory) {
+  std::string str(4096, 'a');
+  absl::Cord cord = absl::MakeCordFromExternal(str, [](absl::string_view) {});
+  ByteBuffer buffer;
+  {
+    ProtoBufferWriter writer(&buffer, 16, 4096);
+    writer.WriteCord(cord);
+  }
+  std::vector<Slice> slices;
+  ASSERT_TRUE(buffer.Dump(&slices).ok());
+  ASSERT_EQ(slices.size(), 1u);
+  EXPECT_EQ(reinterpret_cast<const char*>(slices[0].begin()), str.data());
+  EXPECT_EQ(slices[0].size(), str.size());
+}
+
 #endif  // GRPC_PROTOBUF_CORD_SUPPORT_ENABLED
 
 }  // namespace
@@ -0,0 +1,105 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include <grpc/grpc.h>
+#include <grpcpp/support/serialized_response_cache.h>
+#include <grpcpp/support/slice.h>
+
+#include <chrono>
+#include <string>
+#include <thread>
+
+#include "gtest/gtest.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc {
+namespace {
+
+using experimental::SerializedResponseCache;
+
+ByteBuffer MakeBuffer(const std::string& payload) {
+  Slice slice(payload);
+  return ByteBuffer(&slice, 1);
+}
+
+std::string Contents(const ByteBuffer& buffer) {
+  Slice slice;
+  EXPECT_TRUE(buffer.DumpToSingleSlice(&slice).ok());
+  return std::string(reinterpret_cast<const char*>(slice.begin()),
+                     slice.size());
+}
+
+class SerializedResponseCacheTest : public ::testing::Test {
+ protected:
+  static void SetUpTestSuite() { grpc_init(); }
+
+  static void TearDownTestSuite() { grpc_shutdown(); }
+};
+
+TEST_F(SerializedResponseCacheTest, LookupFindsInsertedResponse) {
+  SerializedResponseCache cache(4, std::chrono::hours(1));
+  ByteBuffer response;
+  EXPECT_FALSE(cache.Lookup("a", &response));
+  cache.Insert("a", MakeBuffer("response for a"));
+  ASSERT_TRUE(cache.Lookup("a", &response));
+  EXPECT_EQ(Contents(response), "response for a");
+}
+
+TEST_F(SerializedResponseCacheTest, KeyIsTheSerializedRequest) {
+  EXPECT_EQ(SerializedResponseCache::KeyFor(MakeBuffer("request")),
+            "request");
+}
+
+TEST_F(SerializedResponseCacheTest, EntriesExpire) {
+  SerializedResponseCache cache(4, std::chrono::milliseconds(10));
+  cache.Insert("a", MakeBuffer("response"));
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  ByteBuffer response;
+  EXPECT_FALSE(cache.Lookup("a", &response));
+}
+
+TEST_F(SerializedResponseCacheTest, EvictsLeastRecentlyUsed) {
+  SerializedResponseCache cache(2, std::chrono::hours(1));
+  cache.Insert("a", MakeBuffer("a"));
+  cache.Insert("b", MakeBuffer("b"));
+  ByteBuffer response;
+  // Touch "a" so that "b" is the least recently used entry.
+  EXPECT_TRUE(cache.Lookup("a", &response));
+  cache.Insert("c", MakeBuffer("c"));
+  EXPECT_TRUE(cache.Lookup("a", &response));
+  EXPECT_FALSE(cache.Lookup("b", &response));
+  EXPECT_TRUE(cache.Lookup("c", &response));
+}
+
+TEST_F(SerializedResponseCacheTest, InsertReplacesExistingEntry) {
+  SerializedResponseCache cache(1, std::chrono::hours(1));
+  cache.Insert("a", MakeBuffer("old"));
+  cache.Insert("a", MakeBuffer("new"));
+  ByteBuffer response;
+  ASSERT_TRUE(cache.Lookup("a", &response));
+  EXPECT_EQ(Contents(response), "new");
+}
+
+}  // namespace
+}  // namespace grpc
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -205,6 +205,15 @@ _DATA_MEMBERS = [
         test_value_1='"file_path_1"',
         test_value_2='"file_path_2"',
     ),
+    DataMember(
+        name="tls_session_ticket_key_file_path",
+        type="std::string",
+        special_getter_return_type="const std::string&",
+        setter_move_semantics=True,
+        test_name="DifferentTlsSessionTicketKeyFilePath",
+        test_value_1='"file_path_1"',
+        test_value_2='"file_path_2"',
+    ),
     DataMember(
         name="crl_directory",
         type="std::string",
@@ -1034,6 +1034,7 @@ include/grpcpp/impl/generic_stub_internal.h \
 include/grpcpp/impl/grpc_library.h \
 include/grpcpp/impl/intercepted_channel.h \
 include/grpcpp/impl/interceptor_common.h \
+include/grpcpp/impl/message_object.h \
 include/grpcpp/impl/metadata_map.h \
 include/grpcpp/impl/method_handler_impl.h \
 include/grpcpp/impl/proto_utils.h \
@@ -1066,6 +1067,7 @@ include/grpcpp/server_builder.h \
 include/grpcpp/server_context.h \
 include/grpcpp/server_interface.h \
 include/grpcpp/server_posix.h \
+include/grpcpp/support/arena_message_allocator.h \
 include/grpcpp/support/async_stream.h \
 include/grpcpp/support/async_unary_call.h \
 include/grpcpp/support/byte_buffer.h \
@@ -1074,15 +1076,19 @@ include/grpcpp/support/channel_arguments.h \
 include/grpcpp/support/client_callback.h \
 include/grpcpp/support/client_interceptor.h \
 include/grpcpp/support/config.h \
+include/grpcpp/support/coroutine.h \
 include/grpcpp/support/global_callback_hook.h \
 include/grpcpp/support/interceptor.h \
 include/grpcpp/support/message_allocator.h \
 include/grpcpp/support/method_handler.h \
+include/grpcpp/support/parallel_message_parser.h \
 include/grpcpp/support/proto_buffer_reader.h \
 include/grpcpp/support/proto_buffer_writer.h \
+include/grpcpp/support/serialized_response_cache.h \
 include/grpcpp/support/server_callback.h \
 include/grpcpp/support/server_interceptor.h \
 include/grpcpp/support/slice.h \
+include/grpcpp/support/slice_message.h \
 include/grpcpp/support/status.h \
 include/grpcpp/support/status_code_enum.h \
 include/grpcpp/support/string_ref.h \
@@ -466,6 +466,7 @@ def main() -> None:
             "sweep",
             "psm",
             "dashboard",
+            "mesh",
         ],
         default="all",
         help="Select a category of tests to run.",
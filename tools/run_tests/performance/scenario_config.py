@@ -26,6 +26,8 @@ SCALABLE = "scalable"
 INPROC = "inproc"
 SWEEP = "sweep"
 PSM = "psm"
+# Open-loop TLS scenarios shaped like service mesh traffic
+MESH = "mesh"
 # A small superset of the benchmarks required to produce
 # https://grafana-dot-grpc-testing.appspot.com/
 DASHBOARD = "dashboard"
@@ -287,6 +289,64 @@ class CXXLanguage(Language):
             warmup_seconds=CXX_WARMUP_SECONDS,
         )
 
+        # Mesh traffic is latency-bound rather than throughput-bound: load is
+        # offered at a fixed rate so the latency percentiles and the CPU per
+        # RPC are comparable between runs, and every connection uses TLS.
+        # Message sizes in a mesh are roughly log-normal around 1KB, so sample
+        # the body and the tail of that distribution instead of one size.
+        for req_size, resp_size in ((128, 512), (1024, 1024), (16384, 4096)):
+            yield _ping_pong_scenario(
+                "cpp_protobuf_async_unary_mesh_%sBreq_%sBresp_secure"
+                % (req_size, resp_size),
+                rpc_type="UNARY",
+                client_type="ASYNC_CLIENT",
+                server_type="ASYNC_SERVER",
+                req_size=req_size,
+                resp_size=resp_size,
+                unconstrained_client="async",
+                outstanding=1000,
+                channels=100,
+                offered_load=10000,
+                async_server_threads=16,
+                categories=[MESH],
+                warmup_seconds=CXX_WARMUP_SECONDS,
+            )
+
+        # A server behind many mostly idle clients.
+        yield _ping_pong_scenario(
+            "cpp_protobuf_async_unary_mesh_1000channels_secure",
+            rpc_type="UNARY",
+            client_type="ASYNC_CLIENT",
+            server_type="ASYNC_SERVER",
+            req_size=1024,
+            resp_size=1024,
+            unconstrained_client="async",
+            outstanding=1000,
+            channels=1000,
+            offered_load=10000,
+            async_server_threads=16,
+            categories=[MESH],
+            warmup_seconds=CXX_WARMUP_SECONDS,
+        )
+
+        # A new stream for every message.
+        yield _ping_pong_scenario(
+            "cpp_protobuf_async_streaming_mesh_1mps_secure",
+            rpc_type="STREAMING",
+            client_type="ASYNC_CLIENT",
+            server_type="ASYNC_SERVER",
+            req_size=1024,
+            resp_size=1024,
+            unconstrained_client="async",
+            outstanding=1000,
+            channels=100,
+            offered_load=10000,
+            messages_per_stream=1,
+            async_server_threads=16,
+            categories=[MESH],
+            warmup_seconds=CXX_WARMUP_SECONDS,
+        )
+
         # TODO(ctiller): add 70% load latency test
         yield _ping_pong_scenario(
             "cpp_protobuf_async_unary_1channel_100rpcs_1MB",
@@ -196,6 +196,7 @@ def main() -> None:
             "sweep",
             "psm",
             "dashboard",
+            "mesh",
         ],
         help="Select scenarios for a category of tests.",
     )